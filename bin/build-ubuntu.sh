@@ -17,7 +17,9 @@ sudo apt install -y --no-install-recommends \
     bison \
     libfl-dev \
     libbenchmark-dev \
-    libz-dev
+    libz-dev \
+    liblz4-dev \
+    libzstd-dev
 PREREQUISITES
 
 set -e
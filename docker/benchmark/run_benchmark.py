@@ -0,0 +1,588 @@
+#!/usr/bin/env python3
+
+# Copyright 2023 Bloomberg Finance L.P.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Benchmark BlazingMQ clusters of various sizes, running in containers.
+
+For each topology of 'workloads.json', this script generates the
+configuration of a cluster and of its proxies, brings them up with docker
+compose, and runs each workload with 'bmqtool' in load mode against a proxy.
+The throughput and latency reported by 'bmqtool', and the CPU used by each
+broker container, are written to a JSON and a CSV file, so that the results
+of two releases can be compared.
+
+See README.md for details.
+"""
+
+import argparse
+import copy
+import csv
+import json
+import os
+import re
+import subprocess
+import sys
+import threading
+import time
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+REPO_DIR = os.path.dirname(os.path.dirname(SCRIPT_DIR))
+TEMPLATE_DIR = os.path.join(REPO_DIR, "docker", "cluster", "config")
+
+IMAGE = "bmqbrkr:latest"
+CLUSTER_NAME = "bench"
+PORT = 30114
+CONFIG_DIR = "/etc/local/bmq"
+RESULTS_DIR = "/results"
+
+# Limits of the benchmark domains, high enough to never be reached by the
+# standard workloads as long as the consumers keep up.
+DOMAIN_LIMITS = {
+    "domainLimits": {
+        "bytes": 64 * 1024 * 1024 * 1024,
+        "messages": 100000000,
+        "bytesWatermarkRatio": 0.8,
+        "messagesWatermarkRatio": 0.8,
+    },
+    "queueLimits": {
+        "bytes": 16 * 1024 * 1024 * 1024,
+        "messages": 25000000,
+        "bytesWatermarkRatio": 0.8,
+        "messagesWatermarkRatio": 0.8,
+    },
+}
+
+DOMAINS = {
+    "bmq.bench.persistent.priority": ({"fileBacked": {}}, {"priority": {}}),
+    "bmq.bench.persistent.fanout": (
+        {"fileBacked": {}},
+        {"fanout": {"appIDs": ["foo", "bar", "baz"]}},
+    ),
+    "bmq.bench.mem.priority": ({"inMemory": {}}, {"priority": {}}),
+    "bmq.bench.mem.broadcast": ({"inMemory": {}}, {"broadcast": {}}),
+}
+
+
+def log(message):
+    print("[{}] {}".format(time.strftime("%H:%M:%S"), message), flush=True)
+
+
+def node_name(index):
+    return "node{}".format(index + 1)
+
+
+def proxy_name(index):
+    return "proxy{}".format(index + 1)
+
+
+def data_center(index):
+    # Nodes are split between two data centers, proxies live in the first.
+    return "DC{}".format(index % 2 + 1)
+
+
+def load_template(name):
+    with open(os.path.join(TEMPLATE_DIR, name)) as f:
+        return json.load(f)
+
+
+def write_json(path, content):
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, "w") as f:
+        json.dump(content, f, indent=4)
+        f.write("\n")
+
+
+def generate_broker_config(path):
+    config = load_template("bmqbrkrcfg.json")
+
+    # The stack trace test allocator of the sample configuration is far too
+    # expensive for a benchmark.
+    config["taskConfig"]["allocatorType"] = "NEWDELETE"
+    config["taskConfig"]["logController"]["loggingVerbosity"] = "WARNING"
+    config["taskConfig"]["logController"]["consoleSeverityThreshold"] = "ERROR"
+
+    write_json(path, config)
+
+
+def generate_clusters_config(node_path, proxy_path, topology, partitions):
+    template = load_template("clusters.json")["myClusters"][0]
+
+    nodes = []
+    for i in range(topology["nodes"]):
+        nodes.append(
+            {
+                "id": i + 1,
+                "dataCenter": data_center(i),
+                "name": node_name(i),
+                "transport": {
+                    "tcp": {
+                        "endpoint": "tcp://{}:{}".format(node_name(i), PORT)
+                    }
+                },
+            }
+        )
+
+    cluster = copy.deepcopy(template)
+    cluster["name"] = CLUSTER_NAME
+    cluster["nodes"] = nodes
+    cluster["partitionConfig"].update(
+        {
+            "numPartitions": partitions,
+            "maxDataFileSize": 4 * 1024 * 1024 * 1024,
+            "maxJournalFileSize": 1024 * 1024 * 1024,
+            "maxQlistFileSize": 64 * 1024 * 1024,
+        }
+    )
+    # Elect a leader quickly, the cluster being brought up from scratch.
+    cluster["elector"]["leaderSyncDelayMs"] = 5000
+
+    write_json(node_path, {"myClusters": [cluster], "proxyClusters": []})
+
+    proxy = {
+        "name": CLUSTER_NAME,
+        "nodes": nodes,
+        "queueOperations": cluster["queueOperations"],
+        "clusterMonitorConfig": cluster["clusterMonitorConfig"],
+        "messageThrottleConfig": cluster["messageThrottleConfig"],
+    }
+    write_json(
+        proxy_path,
+        {
+            "myClusters": [],
+            "proxyClusters": [proxy],
+            "myProxyClusters": [CLUSTER_NAME],
+        },
+    )
+
+
+def generate_domains(path):
+    template = load_template(os.path.join("domains",
+                                          "bmq.test.persistent.priority.json"))
+    for name, (storage, mode) in DOMAINS.items():
+        domain = copy.deepcopy(template)
+        parameters = domain["definition"]["parameters"]
+        domain["definition"]["location"] = CLUSTER_NAME
+        parameters["storage"]["config"] = storage
+        parameters["storage"].update(copy.deepcopy(DOMAIN_LIMITS))
+        parameters["mode"] = mode
+        write_json(os.path.join(path, name + ".json"), domain)
+
+
+def generate_compose(path, topology):
+    lines = ["services:"]
+
+    def service(name, config, dc):
+        lines.extend(
+            [
+                "  {}:".format(name),
+                "    image: {}".format(IMAGE),
+                "    hostname: {}".format(name),
+                "    volumes:",
+                "      - ./{}:{}:ro".format(config, CONFIG_DIR),
+                '    command: "/usr/local/bin/bmqbrkr -h {} -d {} {}"'.format(
+                    name, dc, CONFIG_DIR
+                ),
+            ]
+        )
+
+    for i in range(topology["nodes"]):
+        service(node_name(i), "node", data_center(i))
+    for i in range(topology["proxies"]):
+        service(proxy_name(i), "proxy", data_center(0))
+
+    lines.extend(
+        [
+            "  bmqtool:",
+            "    image: {}".format(IMAGE),
+            "    hostname: client",
+            "    user: root",
+            "    volumes:",
+            "      - ./results:{}".format(RESULTS_DIR),
+            "",
+            "networks:",
+            "  default:",
+            "    driver: bridge",
+        ]
+    )
+
+    with open(path, "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+def generate_topology(output_dir, topology, partitions):
+    directory = os.path.join(output_dir, topology["name"])
+    for role in ("node", "proxy"):
+        generate_broker_config(
+            os.path.join(directory, role, "bmqbrkrcfg.json"))
+        generate_domains(os.path.join(directory, role, "domains"))
+    generate_clusters_config(
+        os.path.join(directory, "node", "clusters.json"),
+        os.path.join(directory, "proxy", "clusters.json"),
+        topology,
+        partitions,
+    )
+    os.makedirs(os.path.join(directory, "results"), exist_ok=True)
+    generate_compose(os.path.join(directory, "docker-compose.yaml"), topology)
+    return directory
+
+
+class Compose:
+    """Wrapper of the docker compose commands of one topology."""
+
+    def __init__(self, directory, topology):
+        self.directory = directory
+        self.project = "bmqbench-{}".format(topology["name"])
+        self.brokers = [node_name(i) for i in range(topology["nodes"])] + [
+            proxy_name(i) for i in range(topology["proxies"])
+        ]
+
+    def command(self, *args):
+        return [
+            "docker",
+            "compose",
+            "-p",
+            self.project,
+            "-f",
+            os.path.join(self.directory, "docker-compose.yaml"),
+        ] + list(args)
+
+    def up(self):
+        subprocess.run(self.command("up", "-d", *self.brokers), check=True)
+
+    def down(self):
+        subprocess.run(self.command("down", "-v"), check=False)
+
+    def bmqtool(self, args, name=None):
+        options = ["--name", name] if name else []
+        return self.command(
+            "run",
+            "--rm",
+            "-T",
+            *options,
+            "bmqtool",
+            "/usr/local/bin/bmqtool",
+            *args
+        )
+
+    def containers(self):
+        output = subprocess.run(
+            self.command("ps", "-q", *self.brokers),
+            check=True,
+            capture_output=True,
+            text=True,
+        ).stdout
+        return output.split()
+
+
+class CpuSampler(threading.Thread):
+    """Sample the CPU used by the specified containers every second."""
+
+    def __init__(self, containers):
+        super().__init__(daemon=True)
+        self.containers = containers
+        self.samples = {}
+        self.stopped = threading.Event()
+
+    def run(self):
+        while not self.stopped.is_set():
+            output = subprocess.run(
+                [
+                    "docker",
+                    "stats",
+                    "--no-stream",
+                    "--format",
+                    "{{.Name}} {{.CPUPerc}}",
+                ]
+                + self.containers,
+                capture_output=True,
+                text=True,
+            ).stdout
+            for line in output.splitlines():
+                name, cpu = line.split()
+                # Strip the project prefix and replica suffix of the name.
+                name = name.split("-")[-2] if "-" in name else name
+                self.samples.setdefault(name, []).append(
+                    float(cpu.rstrip("%"))
+                )
+            self.stopped.wait(1)
+
+    def stop(self):
+        self.stopped.set()
+        self.join()
+        return {
+            name: {
+                "avg": round(sum(values) / len(values), 1),
+                "max": round(max(values), 1),
+            }
+            for name, values in self.samples.items()
+            if values
+        }
+
+
+FINAL_STATS = re.compile(r"Final stats: consumed ([\d,]+) messages")
+POSTED = re.compile(r", posted ([\d,]+) messages")
+
+
+def run_workload(compose, topology, workload, args):
+    name = workload["name"]
+    report = "{}.json".format(name)
+    uri = "bmq://{}/{}".format(workload["domain"], name)
+    app_ids = workload.get("appIds", [])
+    broker = "tcp://{}:{}".format(proxy_name(0), PORT)
+
+    flags = "write,ack" if args.ack else "write"
+    load_args = [
+        "--mode=load",
+        "--broker={}".format(broker),
+        "--queueuri={}".format(uri + ("?id=" + app_ids[0] if app_ids else "")),
+        "--queueflags={}".format(flags),
+        "--producers={}".format(workload["producers"]),
+        "--consumers={}".format(workload["consumers"]),
+        "--msgsize={}".format(workload["msgSize"]),
+        "--eventsize={}".format(workload["eventSize"]),
+        "--postrate={}".format(workload["postRate"]),
+        "--postinterval={}".format(workload["postInterval"]),
+        "--eventscount={}s".format(args.duration),
+        "--latency=hires",
+        "--latency-report={}/{}".format(RESULTS_DIR, report),
+        "--shutdownGrace={}".format(args.grace),
+        "--verbosity=warning",
+    ]
+
+    # The other apps of a fan-out queue are consumed by separate readers,
+    # so that the broker delivers each message to every app.  These readers
+    # run until interrupted, once the load run is over.
+    readers = []
+    for app_id in app_ids[1:]:
+        reader = "{}-{}-{}".format(compose.project, name, app_id)
+        readers.append(reader)
+        subprocess.Popen(
+            compose.bmqtool(
+                [
+                    "--mode=auto",
+                    "--broker={}".format(broker),
+                    "--queueuri={}?id={}".format(uri, app_id),
+                    "--queueflags=read",
+                    "--confirmmsg",
+                    "--verbosity=silent",
+                ],
+                name=reader,
+            ),
+            stdout=subprocess.DEVNULL,
+            stderr=subprocess.DEVNULL,
+        )
+
+    log("Running '{}' on '{}'".format(name, topology["name"]))
+    sampler = CpuSampler(compose.containers())
+    sampler.start()
+    start = time.time()
+    process = subprocess.run(
+        compose.bmqtool(load_args), capture_output=True, text=True
+    )
+    elapsed = time.time() - start
+    cpu = sampler.stop()
+
+    for reader in readers:
+        subprocess.run(
+            ["docker", "kill", "--signal=INT", reader],
+            stdout=subprocess.DEVNULL,
+            stderr=subprocess.DEVNULL,
+        )
+
+    result = {
+        "topology": topology["name"],
+        "workload": name,
+        "rc": process.returncode,
+        "durationS": args.duration,
+        "cpuPercent": cpu,
+    }
+
+    match = FINAL_STATS.search(process.stdout)
+    if process.returncode != 0 or not match:
+        log("'{}' failed [rc: {}]:\n{}".format(
+            name, process.returncode, process.stderr[-2000:]))
+        return result
+
+    consumed = int(match.group(1).replace(",", ""))
+    result["consumedMsgs"] = consumed
+    posted = POSTED.search(process.stdout)
+    if posted:
+        result["postedMsgs"] = int(posted.group(1).replace(",", ""))
+    result["msgsPerSecond"] = round(consumed / args.duration)
+    result["bytesPerSecond"] = round(
+        consumed * workload["msgSize"] / args.duration
+    )
+    result["elapsedS"] = round(elapsed, 1)
+
+    report_path = os.path.join(compose.directory, "results", report)
+    if os.path.exists(report_path):
+        with open(report_path) as f:
+            result["latencyNs"] = json.load(f).get("histogram", {})
+
+    log(
+        "'{}' on '{}': {} msgs/s, p50 {} ns, p99 {} ns".format(
+            name,
+            topology["name"],
+            result["msgsPerSecond"],
+            result.get("latencyNs", {}).get("p50"),
+            result.get("latencyNs", {}).get("p99"),
+        )
+    )
+    return result
+
+
+def write_results(output_dir, results):
+    write_json(os.path.join(output_dir, "results.json"), results)
+
+    columns = [
+        "topology",
+        "workload",
+        "msgsPerSecond",
+        "bytesPerSecond",
+        "p50Ns",
+        "p99Ns",
+        "p999Ns",
+        "maxNs",
+        "maxBrokerCpuPercent",
+        "rc",
+    ]
+    with open(os.path.join(output_dir, "results.csv"), "w", newline="") as f:
+        writer = csv.DictWriter(f, fieldnames=columns)
+        writer.writeheader()
+        for result in results:
+            latency = result.get("latencyNs", {})
+            cpu = result.get("cpuPercent", {})
+            writer.writerow(
+                {
+                    "topology": result["topology"],
+                    "workload": result["workload"],
+                    "msgsPerSecond": result.get("msgsPerSecond"),
+                    "bytesPerSecond": result.get("bytesPerSecond"),
+                    "p50Ns": latency.get("p50"),
+                    "p99Ns": latency.get("p99"),
+                    "p999Ns": latency.get("p99.9"),
+                    "maxNs": latency.get("max"),
+                    "maxBrokerCpuPercent": max(
+                        [v["avg"] for v in cpu.values()], default=None
+                    ),
+                    "rc": result["rc"],
+                }
+            )
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument(
+        "--workloads",
+        default=os.path.join(SCRIPT_DIR, "workloads.json"),
+        help="JSON file describing the topologies and workloads to run",
+    )
+    parser.add_argument(
+        "--output",
+        default=os.path.join(os.getcwd(), "bmqbench-results"),
+        help="directory to write the configurations and results to",
+    )
+    parser.add_argument(
+        "--topology",
+        action="append",
+        help="only run the topologies having this name (may be repeated)",
+    )
+    parser.add_argument(
+        "--workload",
+        action="append",
+        help="only run the workloads having this name (may be repeated)",
+    )
+    parser.add_argument(
+        "--duration", type=int, default=60, help="seconds of each workload"
+    )
+    parser.add_argument(
+        "--grace",
+        type=int,
+        default=5,
+        help="seconds left to the consumers once the producers are done",
+    )
+    parser.add_argument(
+        "--startup-wait",
+        type=int,
+        default=30,
+        help="seconds to wait for the cluster to elect a leader",
+    )
+    parser.add_argument(
+        "--partitions", type=int, default=4, help="number of partitions"
+    )
+    parser.add_argument(
+        "--ack", action="store_true", help="post with acknowledgments"
+    )
+    parser.add_argument(
+        "--no-build",
+        action="store_true",
+        help="do not build the '{}' image".format(IMAGE),
+    )
+    args = parser.parse_args()
+
+    with open(args.workloads) as f:
+        spec = json.load(f)
+
+    topologies = [
+        t
+        for t in spec["topologies"]
+        if not args.topology or t["name"] in args.topology
+    ]
+    workloads = [
+        w
+        for w in spec["workloads"]
+        if not args.workload or w["name"] in args.workload
+    ]
+    if not topologies or not workloads:
+        parser.error("no topology or workload selected")
+
+    if not args.no_build:
+        log("Building the '{}' image".format(IMAGE))
+        subprocess.run(
+            [
+                "docker",
+                "build",
+                "-t",
+                IMAGE,
+                "-f",
+                os.path.join(REPO_DIR, "docker", "Dockerfile"),
+                REPO_DIR,
+            ],
+            check=True,
+        )
+
+    results = []
+    for topology in topologies:
+        directory = generate_topology(args.output, topology, args.partitions)
+        compose = Compose(directory, topology)
+
+        log("Starting '{}'".format(topology["name"]))
+        compose.down()
+        compose.up()
+        try:
+            time.sleep(args.startup_wait)
+            for workload in workloads:
+                results.append(run_workload(compose, topology, workload, args))
+                write_results(args.output, results)
+        finally:
+            compose.down()
+
+    log("Results written to '{}'".format(args.output))
+    return 0 if all(r["rc"] == 0 for r in results) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -48,6 +48,15 @@ namespace m_bmqbrkr {
 namespace {
 const char k_MTRAP_SET_THREADNAME[] = "__setThreadName";
 
+/// Number of writer-local shards, and flush threshold in bytes of each
+/// shard, with which the counting allocators account for their allocations
+/// (see 'mwcma::CountingAllocator::setThreadLocalCounting').  The allocation
+/// limit may thus be exceeded by up to 512KB per level of the allocators
+/// hierarchy before being detected, which is negligible compared to the
+/// limits in use.
+const int                k_ALLOCATOR_NUM_SHARDS      = 8;
+const bsls::Types::Int64 k_ALLOCATOR_FLUSH_THRESHOLD = 64 * 1024;
+
 /// Invoked by the top level CountingAllocator when its cumulated allocation
 /// has crossed the configured specified `limit`.
 void onAllocationLimit(bsls::Types::Uint64 limit)
@@ -139,7 +148,10 @@ Task_AllocatorManager::Task_AllocatorManager(mqbcfg::AllocatorType::Value type)
     case mqbcfg::AllocatorType::COUNTING: {
         mwcma::CountingAllocatorUtil::initGlobalAllocators(
             mwcst::StatContextConfiguration("task"),
-            "allocators");
+            "allocators",
+            k_ALLOCATOR_NUM_SHARDS,
+            k_ALLOCATOR_FLUSH_THRESHOLD,
+            1);  // samplingPeriod
 
         d_statContext_p = mwcma::CountingAllocatorUtil::globalStatContext();
         d_store_p       = &mwcma::CountingAllocatorUtil::topAllocatorStore();
@@ -160,7 +160,7 @@ static bool parseArgs(Parameters* parameters, int argc, const char* argv[])
     balcl::OptionInfo specTable[] = {
         {"mode",
          "mode",
-         "mode ([<cli>, auto, storage, syschk])",
+         "mode ([<cli>, auto, storage, syschk, load, replay])",
          balcl::TypeInfo(&params.mode(), &ParametersMode::isValid),
          balcl::OccurrenceInfo::e_OPTIONAL},
         {"b|broker",
@@ -255,6 +255,22 @@ static bool parseArgs(Parameters* parameters, int argc, const char* argv[])
          " no message received in auto consumer mode) before shutting down",
          balcl::TypeInfo(&params.shutdownGrace()),
          balcl::OccurrenceInfo::e_OPTIONAL},
+        {"producers",
+         "producers",
+         "number of producer threads (for load mode)",
+         balcl::TypeInfo(&params.producers()),
+         balcl::OccurrenceInfo(params.producers())},
+        {"consumers",
+         "consumers",
+         "number of consumers (for load mode)",
+         balcl::TypeInfo(&params.consumers()),
+         balcl::OccurrenceInfo(params.consumers())},
+        {"sharedsession",
+         "sharedSession",
+         "share one session between all producers and consumers (for load "
+         "mode)",
+         balcl::TypeInfo(&params.sharedSession()),
+         balcl::OccurrenceInfo::e_OPTIONAL},
         {"nosessioneventhandler",
          "noSessionEventHandler",
          "use custom event handler threads",
@@ -265,6 +281,12 @@ static bool parseArgs(Parameters* parameters, int argc, const char* argv[])
          "path to storage files to open",
          balcl::TypeInfo(&params.storage()),
          balcl::OccurrenceInfo(params.storage())},
+        {"replayspeed",
+         "replaySpeed",
+         "speed factor of the replay of the storage (for replay mode): 1 to "
+         "replay at the original speed, 0 to replay as fast as possible",
+         balcl::TypeInfo(&params.replaySpeed()),
+         balcl::OccurrenceInfo(params.replaySpeed())},
         {"log",
          "log",
          "path to log file",
@@ -30,6 +30,7 @@
 #include <bmqa_sessionevent.h>
 #include <bmqimp_event.h>
 #include <bmqp_confirmeventbuilder.h>
+#include <bmqp_protocolutil.h>
 #include <bmqt_queueflags.h>
 #include <bmqt_resultcode.h>
 #include <bmqt_sessioneventtype.h>
@@ -57,9 +58,12 @@
 #include <bdlt_timeunitratio.h>
 #include <bsl_algorithm.h>
 #include <bsl_numeric.h>
+#include <bsl_unordered_map.h>
+#include <bsl_unordered_set.h>
 #include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
+#include <bslmt_lockguard.h>
 #include <bslmt_semaphore.h>
 #include <bslmt_turnstile.h>
 #include <bsls_assert.h>
@@ -87,6 +91,12 @@ const int k_STAT_DUMP_INTERVAL = 1;
 // time), as computed by the configured frequency of message publishing.
 const int k_LATENCY_INTERVAL_MS = 5;
 
+// Highest latency (in ns) recorded in the latency histograms without being
+// clamped, and number of significant digits of their precision.
+const bsls::Types::Int64 k_LATENCY_HISTOGRAM_HIGHEST_NS = 3600LL * 1000 *
+                                                          1000 * 1000;
+const int                k_LATENCY_HISTOGRAM_DIGITS     = 3;
+
 // Id of the Queue (in non interactive mode)
 const int k_QUEUEID_ID = 1;
 
@@ -140,6 +150,132 @@ computePercentile(const bsl::vector<bsls::Types::Int64>& data, double k)
 
 }  // close unnamed namespace
 
+// ------------------------------
+// class Application::LoadSession
+// ------------------------------
+
+/// Session, with its queue, of the load mode.  The session delivers its
+/// message events to `Application::onLoadMessageEvent`.
+class Application::LoadSession : public bmqa::SessionEventHandler {
+  private:
+    // DATA
+    Application* d_application_p;
+    // Application owning this object.
+
+    bslma::ManagedPtr<bmqa::Session> d_session_mp;
+    // Session with the BlazingMQ broker.
+
+    bmqa::QueueId d_queueId;
+    // Queue opened by the session.
+
+    bsls::AtomicBool d_isConnected;
+    // Is the session connected to the
+    // broker?
+
+  private:
+    // NOT IMPLEMENTED
+    LoadSession(const LoadSession&) BSLS_KEYWORD_DELETED;
+    LoadSession& operator=(const LoadSession&) BSLS_KEYWORD_DELETED;
+
+    // PRIVATE MANIPULATORS
+    //   (virtual: bmqa::SessionEventHandler)
+    void onSessionEvent(const bmqa::SessionEvent& event) BSLS_KEYWORD_OVERRIDE
+    {
+        if (event.type() == bmqt::SessionEventType::e_CONNECTED ||
+            event.type() == bmqt::SessionEventType::e_RECONNECTED) {
+            d_isConnected = true;
+        }
+        else if (event.type() == bmqt::SessionEventType::e_DISCONNECTED ||
+                 event.type() == bmqt::SessionEventType::e_CONNECTION_LOST) {
+            d_isConnected = false;
+        }
+
+        if (d_application_p->d_parameters_p->verbosity() !=
+            ParametersVerbosity::e_SILENT) {
+            BALL_LOG_INFO << "==> EVENT received: " << event;
+        }
+    }
+
+    void onMessageEvent(const bmqa::MessageEvent& event) BSLS_KEYWORD_OVERRIDE
+    {
+        d_application_p->onLoadMessageEvent(this, event);
+    }
+
+  public:
+    // CREATORS
+
+    /// Create a session of the specified `application` with the specified
+    /// `options`, using the specified `allocator` to supply memory.
+    LoadSession(Application*                application,
+                const bmqt::SessionOptions& options,
+                bslma::Allocator*           allocator)
+    : d_application_p(application)
+    , d_session_mp()
+    , d_queueId(k_QUEUEID_ID, allocator)
+    , d_isConnected(false)
+    {
+        bslma::ManagedPtr<bmqa::SessionEventHandler> managedHandler(
+            this,
+            allocator,
+            bslma::ManagedPtrNilDeleter<bmqa::SessionEventHandler>::deleter);
+        d_session_mp.load(
+            new (*allocator) bmqa::Session(managedHandler, options, allocator),
+            allocator);
+    }
+
+    /// Stop the session, and destroy this object.
+    ~LoadSession() BSLS_KEYWORD_OVERRIDE
+    {
+        // Stop the session while this object, which is its event handler,
+        // is still valid.
+        d_session_mp->stop();
+    }
+
+    // MANIPULATORS
+
+    /// Start the session.  Return 0 on success, or a non-zero value
+    /// otherwise.
+    int start()
+    {
+        int rc = d_session_mp->start();
+        if (rc != 0) {
+            BALL_LOG_ERROR << "Unable to start session [rc: " << rc << " - "
+                           << bmqt::GenericResult::Enum(rc) << "]";
+        }
+
+        return rc;
+    }
+
+    /// Open the queue having the specified `uri` with the specified `flags`
+    /// and `options`.  Return true on success, or false otherwise.
+    bool openQueue(const bsl::string&        uri,
+                   bsls::Types::Uint64       flags,
+                   const bmqt::QueueOptions& options)
+    {
+        bmqa::OpenQueueStatus result =
+            d_session_mp->openQueueSync(&d_queueId, uri, flags, options);
+        if (!result) {
+            BALL_LOG_ERROR << "Error while opening queue: [result: " << result
+                           << "]";
+            return false;  // RETURN
+        }
+
+        return true;
+    }
+
+    /// Return a reference offering modifiable access to the session.
+    bmqa::Session& session() { return *d_session_mp; }
+
+    /// Return a reference offering modifiable access to the queue opened
+    /// by the session.
+    bmqa::QueueId& queueId() { return d_queueId; }
+
+    // ACCESSORS
+
+    /// Return true if the session is connected to the broker.
+    bool isConnected() const { return d_isConnected; }
+};
+
 // -----------------
 // class Application
 // -----------------
@@ -228,6 +364,12 @@ void Application::snapshotStats()
 {
     d_statContext_mp->snapshot();
 
+    if (!d_parameters_p->latencyReportPath().empty() && isConsumerStats() &&
+        d_parameters_p->latency() != ParametersLatency::e_NONE) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_latenciesMutex);  // LOCK
+        snapshotLatencyHistogram();
+    }
+
     static unsigned int count = 0;
     if (++count % k_STAT_DUMP_INTERVAL == 0 &&
         d_parameters_p->verbosity() != ParametersVerbosity::e_SILENT &&
@@ -236,6 +378,34 @@ void Application::snapshotStats()
     }
 }
 
+void Application::reportLatency(bsls::Types::Int64 latency)
+{
+    d_statContext_mp->reportValue(k_STAT_LAT, latency);
+
+    // Keep each individual latency when requested to generate a latency
+    // report.  Note that since only one message every k_LATENCY_INTERVAL_MS
+    // time interval has latency, this list will not grow out of control when
+    // run during a 'decent' amount of time.  With a default of 5ms, this
+    // implies 200 items per second, or 120,000 for 10 minutes.
+    if (!d_parameters_p->latencyReportPath().empty()) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_latenciesMutex);  // LOCK
+        d_latencies.push_back(latency);
+        d_intervalLatencies.record(latency);
+    }
+}
+
+void Application::snapshotLatencyHistogram()
+{
+    // d_latenciesMutex LOCKED
+
+    LatencyPercentiles percentiles;
+    d_intervalLatencies.loadPercentiles(&percentiles);
+    d_latencyIntervals.push_back(percentiles);
+
+    d_totalLatencies.add(d_intervalLatencies);
+    d_intervalLatencies.reset();
+}
+
 void Application::autoReadShutdown()
 {
     if (!d_autoReadActivity) {
@@ -245,6 +415,16 @@ void Application::autoReadShutdown()
     d_autoReadActivity = false;
 }
 
+bool Application::isConsumerStats() const
+{
+    if (d_parameters_p->mode() == ParametersMode::e_REPLAY) {
+        return false;  // RETURN
+    }
+
+    return d_parameters_p->mode() == ParametersMode::e_LOAD ||
+           bmqt::QueueFlagsUtil::isReader(d_parameters_p->queueFlags());
+}
+
 void Application::printStatHeader() const
 {
     static bool headerPrinted = false;  // To only print it once
@@ -253,8 +433,7 @@ void Application::printStatHeader() const
     }
     headerPrinted = true;
 
-    bool printLatency = bmqt::QueueFlagsUtil::isReader(
-                            d_parameters_p->queueFlags()) &&
+    bool printLatency = isConsumerStats() &&
                         d_parameters_p->latency() != ParametersLatency::e_NONE;
 
     bsl::cout << "Mode     |"
@@ -309,10 +488,11 @@ void Application::printStats(int interval) const
                                                                         t1);
 
     mwcu::MemOutStream ss;
-    if (bmqt::QueueFlagsUtil::isReader(d_parameters_p->queueFlags())) {
+    if (isConsumerStats()) {
         ss << "consumed ";
     }
-    else if (bmqt::QueueFlagsUtil::isWriter(d_parameters_p->queueFlags())) {
+    else if (d_parameters_p->mode() == ParametersMode::e_REPLAY ||
+             bmqt::QueueFlagsUtil::isWriter(d_parameters_p->queueFlags())) {
         ss << "produced ";
     }
     else {
@@ -344,7 +524,7 @@ void Application::printStats(int interval) const
     }
 
     // Latency
-    if (bmqt::QueueFlagsUtil::isReader(d_parameters_p->queueFlags()) &&
+    if (isConsumerStats() &&
         d_parameters_p->latency() != ParametersLatency::e_NONE) {
         const mwcst::StatValue& latency = d_statContext_mp->value(
             mwcst::StatContext::DMCST_DIRECT_VALUE,
@@ -387,10 +567,11 @@ void Application::printFinalStats()
     bsls::Types::Int64 evtBytes = mwcst::StatUtil::value(evt, loc);
 
     mwcu::MemOutStream ss;
-    if (bmqt::QueueFlagsUtil::isReader(d_parameters_p->queueFlags())) {
+    if (isConsumerStats()) {
         ss << "consumed ";
     }
-    else if (bmqt::QueueFlagsUtil::isWriter(d_parameters_p->queueFlags())) {
+    else if (d_parameters_p->mode() == ParametersMode::e_REPLAY ||
+             bmqt::QueueFlagsUtil::isWriter(d_parameters_p->queueFlags())) {
         ss << "produced ";
     }
     else {
@@ -407,8 +588,29 @@ void Application::printFinalStats()
         ss << " (Protocol: " << bsl::setprecision(4) << protocol << "%)";
     }
 
+    if (d_parameters_p->mode() == ParametersMode::e_LOAD) {
+        ss << ", posted "
+           << mwcu::PrintUtil::prettyNumber(d_numLoadPostedMsgs.load())
+           << " messages in "
+           << mwcu::PrintUtil::prettyNumber(d_numLoadPostedEvents.load())
+           << " events";
+        if (d_numLoadFailedPosts != 0) {
+            ss << " ("
+               << mwcu::PrintUtil::prettyNumber(d_numLoadFailedPosts.load())
+               << " events failed to post)";
+        }
+    }
+    else if (d_parameters_p->mode() == ParametersMode::e_REPLAY) {
+        const bsls::Types::Int64 numNotReplayed =
+            d_numReplayFailedMsgs.load() + d_journalReplayer.numSkipped();
+        if (numNotReplayed != 0) {
+            ss << " (" << mwcu::PrintUtil::prettyNumber(numNotReplayed)
+               << " messages not replayed)";
+        }
+    }
+
     // Latency
-    if (bmqt::QueueFlagsUtil::isReader(d_parameters_p->queueFlags()) &&
+    if (isConsumerStats() &&
         d_parameters_p->latency() != ParametersLatency::e_NONE) {
         const mwcst::StatValue& latency = d_statContext_mp->value(
             mwcst::StatContext::DMCST_DIRECT_VALUE,
@@ -431,7 +633,7 @@ void Application::generateLatencyReport()
     BSLS_ASSERT_SAFE(!d_latencies.empty());
     BSLS_ASSERT_SAFE(!d_parameters_p->latencyReportPath().empty());
 
-    if (!(bmqt::QueueFlagsUtil::isReader(d_parameters_p->queueFlags()) &&
+    if (!(isConsumerStats() &&
           d_parameters_p->latency() != ParametersLatency::e_NONE)) {
         // Not a consumer, or not asked to gather latency, nothing to do
         return;  // RETURN
@@ -494,6 +696,18 @@ void Application::generateLatencyReport()
     const bsls::Types::Int64 p96 = computePercentile(dataSet, 96.0);
     const bsls::Types::Int64 p95 = computePercentile(dataSet, 95.0);
 
+    // The histograms cover the whole run, including the warmup: account for
+    // the latencies reported since the last snapshot of the stats, as a last
+    // (partial) interval.
+    LatencyPercentiles histogram;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_latenciesMutex);  // LOCK
+        if (d_intervalLatencies.count() != 0) {
+            snapshotLatencyHistogram();
+        }
+        d_totalLatencies.loadPercentiles(&histogram);
+    }
+
     // 4. Print summary stats to stdout
     bsl::cout
         << "  Population size.: " << dataSet.size() << "\n"
@@ -515,6 +729,20 @@ void Application::generateLatencyReport()
         << "\n"
         << "  99Percentile....: " << mwcu::PrintUtil::prettyTimeInterval(p99)
         << "\n"
+        << "  Whole run (HDR histogram of " << histogram.d_count
+        << " data points):\n"
+        << "    p50...........: "
+        << mwcu::PrintUtil::prettyTimeInterval(histogram.d_p50) << "\n"
+        << "    p90...........: "
+        << mwcu::PrintUtil::prettyTimeInterval(histogram.d_p90) << "\n"
+        << "    p99...........: "
+        << mwcu::PrintUtil::prettyTimeInterval(histogram.d_p99) << "\n"
+        << "    p99.9.........: "
+        << mwcu::PrintUtil::prettyTimeInterval(histogram.d_p999) << "\n"
+        << "    p99.99........: "
+        << mwcu::PrintUtil::prettyTimeInterval(histogram.d_p9999) << "\n"
+        << "    max...........: "
+        << mwcu::PrintUtil::prettyTimeInterval(histogram.d_max) << "\n"
         << bsl::endl;
 
     // 5. Generate the JSON report
@@ -535,6 +763,16 @@ void Application::generateLatencyReport()
            << "  \"97percentile\": " << p97 << ",\n"
            << "  \"96percentile\": " << p96 << ",\n"
            << "  \"95percentile\": " << p95 << ",\n"
+           << "  \"histogram\": ";
+    histogram.printJson(output);
+    output << ",\n"
+           << "  \"intervalMs\": 1000,\n"
+           << "  \"intervals\": [";
+    for (bsl::size_t i = 0; i < d_latencyIntervals.size(); ++i) {
+        output << (i == 0 ? "\n    " : ",\n    ");
+        d_latencyIntervals[i].printJson(output);
+    }
+    output << "\n  ],\n"
            << "  \"dataPoints\": [";
     // Print the unsorted (i.e. in reporting order) data, so that if needed, we
     // could see the evolution over time and maybe some pattern (for example
@@ -556,6 +794,31 @@ void Application::generateLatencyReport()
     output.close();
 }
 
+void Application::initializePayload()
+{
+    int msgPayloadSize = d_parameters_p->msgSize();
+
+    if (d_parameters_p->latency() != ParametersLatency::e_NONE) {
+        // To optimize, if asked to insert latency, we put in a first blob of
+        // 8 bytes that will be swapped out at every post with a new timestamp
+        // value.
+        bdlbb::BlobBuffer latencyBuffer;
+        d_timeBufferFactory.allocate(&latencyBuffer);
+        latencyBuffer.setSize(sizeof(bdlb::BigEndianInt64));
+        bdlb::BigEndianInt64 zero = bdlb::BigEndianInt64::make(0);
+        bsl::memcpy(latencyBuffer.buffer().get(), &zero, sizeof(zero));
+        d_blob.appendDataBuffer(latencyBuffer);
+        msgPayloadSize -= sizeof(bdlb::BigEndianInt64);
+    }
+
+    // Initialize a buffer of the right published size, with alphabet's
+    // letters
+    for (int i = 0; i < msgPayloadSize; ++i) {
+        char c = static_cast<char>('A' + i % 26);
+        bdlbb::BlobUtil::append(&d_blob, &c, 1);
+    }
+}
+
 int Application::initialize()
 {
     enum RC {
@@ -564,6 +827,7 @@ int Application::initialize()
         e_INIT_STORAGE_ERROR          = -2,
         e_OPEN_QUEUE_ERROR            = -3,
         e_VALIDATE_SUBSCRIPTION_ERROR = -4,
+        e_INIT_REPLAY_ERROR           = -5,
         e_START_SESSION_ERROR         = -10
     };
 
@@ -573,6 +837,11 @@ int Application::initialize()
         bsl::cout << bsl::endl;
     }
 
+    if (d_parameters_p->mode() == ParametersMode::e_LOAD) {
+        // The load mode uses its own sessions
+        return initializeLoad();  // RETURN
+    }
+
     // First, setup the session options
     int                  rc = 0;
     bmqt::SessionOptions options;
@@ -657,34 +926,44 @@ int Application::initialize()
 
         // If in producer mode, prepare the blob that we will post over and
         // over again
-        if (bmqt::QueueFlagsUtil::isWriter(d_parameters_p->queueFlags())) {
-            if (d_parameters_p->sequentialMessagePattern().empty()) {
-                int msgPayloadSize = d_parameters_p->msgSize();
-
-                if (d_parameters_p->latency() != ParametersLatency::e_NONE) {
-                    // To optimize, if asked to insert latency, we put in a
-                    // first blob of 8 bytes that will be swapped out at every
-                    // post with a new timestamp value.
-                    bdlbb::BlobBuffer latencyBuffer;
-                    d_timeBufferFactory.allocate(&latencyBuffer);
-                    latencyBuffer.setSize(sizeof(bdlb::BigEndianInt64));
-                    bdlb::BigEndianInt64 zero = bdlb::BigEndianInt64::make(0);
-                    bsl::memcpy(latencyBuffer.buffer().get(),
-                                &zero,
-                                sizeof(zero));
-                    d_blob.appendDataBuffer(latencyBuffer);
-                    msgPayloadSize -= sizeof(bdlb::BigEndianInt64);
-                }
+        if (bmqt::QueueFlagsUtil::isWriter(d_parameters_p->queueFlags()) &&
+            d_parameters_p->sequentialMessagePattern().empty()) {
+            initializePayload();
+        }
 
-                // Initialize a buffer of the right published size, with
-                // alphabet's letters
-                for (int i = 0; i < msgPayloadSize; ++i) {
-                    char c = static_cast<char>('A' + i % 26);
-                    bdlbb::BlobUtil::append(&d_blob, &c, 1);
-                }
-            }
+        // Schedule a clock to collect / dump stats
+        bdlmt::EventScheduler::RecurringEventHandle handle;
+        d_scheduler.scheduleRecurringEvent(
+            &handle,
+            bsls::TimeInterval(1.0),
+            bdlf::BindUtil::bind(&Application::snapshotStats, this));
+    }
+    else if (d_parameters_p->mode() == ParametersMode::e_REPLAY) {
+        rc = d_journalReplayer.open(d_parameters_p->journalFilePath(),
+                                    d_parameters_p->dataFilePath(),
+                                    d_parameters_p->qlistFilePath());
+        if (rc != 0) {
+            BALL_LOG_ERROR << "Failed to open the storage to replay [" << rc
+                           << "]";
+            return e_INIT_REPLAY_ERROR;  // RETURN
         }
 
+        rc = d_session_mp->start();
+        if (rc != 0) {
+            BALL_LOG_ERROR << "Unable to start session [rc: " << rc << " - "
+                           << bmqt::GenericResult::Enum(rc) << "]";
+            return e_START_SESSION_ERROR + rc;  // RETURN
+        }
+        BSLS_ASSERT_SAFE(d_sessionContext_mp);
+
+        BALL_LOG_INFO << "Session started.";
+
+        d_session_mp->loadMessageEventBuilder(
+            &d_sessionContext_mp->d_eventBuilder);
+
+        // The queues are opened by the replay thread, as their messages are
+        // read.
+
         // Schedule a clock to collect / dump stats
         bdlmt::EventScheduler::RecurringEventHandle handle;
         d_scheduler.scheduleRecurringEvent(
@@ -821,18 +1100,7 @@ void Application::onMessageEvent(const bmqa::MessageEvent& event)
                         // Apparently, for some reasons, the delta sometimes
                         // comes up negative, don't report it so that the stats
                         // remain decently representative of actual measures.
-                        d_statContext_mp->reportValue(k_STAT_LAT, delta);
-
-                        // Keep each individual latency when requested to
-                        // generate a latency report.  Note that since only one
-                        // message every k_LATENCY_INTERVAL_MS time interval
-                        // has latency, this list will not grow out of control
-                        // when run during a 'decent' amount of time.  With a
-                        // default of 5ms, this implies 200 items per second,
-                        // or 120,000 for 10 minutes.
-                        if (!d_parameters_p->latencyReportPath().empty()) {
-                            d_latencies.push_back(delta);
-                        }
+                        reportLatency(delta);
                     }
                 }
             }
@@ -1056,6 +1324,515 @@ void Application::producerThread()
     }
 }
 
+int Application::initializeLoad()
+{
+    enum RC {
+        e_OK                          = 0,
+        e_OPEN_QUEUE_ERROR            = -3,
+        e_VALIDATE_SUBSCRIPTION_ERROR = -4,
+        e_START_SESSION_ERROR         = -10
+    };
+
+    const int  numProducers  = d_parameters_p->numProducers();
+    const int  numConsumers  = d_parameters_p->numConsumers();
+    const bool sharedSession = d_parameters_p->sharedSession();
+
+    // Producers request acknowledgments if the queue flags say so, and
+    // otherwise ignore the queue flags.
+    const bsls::Types::Uint64 writeFlags =
+        bmqt::QueueFlags::e_WRITE |
+        (d_parameters_p->queueFlags() & bmqt::QueueFlags::e_ACK);
+
+    bmqt::QueueOptions queueOptions;
+    queueOptions
+        .setMaxUnconfirmedMessages(d_parameters_p->maxUnconfirmedMsgs())
+        .setMaxUnconfirmedBytes(d_parameters_p->maxUnconfirmedBytes());
+    if (!InputUtil::populateSubscriptions(&queueOptions,
+                                          d_parameters_p->subscriptions())) {
+        BALL_LOG_ERROR << "Invalid subscriptions";
+        return e_VALIDATE_SUBSCRIPTION_ERROR;  // RETURN
+    }
+
+    bmqt::SessionOptions options;
+    options.setBrokerUri(d_parameters_p->broker())
+        .setNumProcessingThreads(d_parameters_p->numProcessingThreads())
+        .configureEventQueue(1000, 10 * 1000);
+
+    if (sharedSession) {
+        // The consumers are the processing threads of the shared session,
+        // which opens the queue for both reading and writing.
+        options.setNumProcessingThreads(
+            bsl::max(numConsumers, d_parameters_p->numProcessingThreads()));
+
+        d_loadSessions.push_back(bsl::allocate_shared<LoadSession>(
+            d_allocator_p,
+            this,
+            options,
+            d_allocator_p));
+        LoadSession& loadSession = *d_loadSessions.back();
+
+        const int rc = loadSession.start();
+        if (rc != 0) {
+            return e_START_SESSION_ERROR + rc;  // RETURN
+        }
+        if (!loadSession.openQueue(d_parameters_p->queueUri(),
+                                   writeFlags | bmqt::QueueFlags::e_READ,
+                                   queueOptions)) {
+            return e_OPEN_QUEUE_ERROR;  // RETURN
+        }
+    }
+    else {
+        for (int i = 0; i < numProducers + numConsumers; ++i) {
+            const bool isProducer = i < numProducers;
+
+            d_loadSessions.push_back(bsl::allocate_shared<LoadSession>(
+                d_allocator_p,
+                this,
+                options,
+                d_allocator_p));
+            LoadSession& loadSession = *d_loadSessions.back();
+
+            const int rc = loadSession.start();
+            if (rc != 0) {
+                return e_START_SESSION_ERROR + rc;  // RETURN
+            }
+
+            bool isOpen = false;
+            if (isProducer) {
+                isOpen = loadSession.openQueue(d_parameters_p->queueUri(),
+                                               writeFlags,
+                                               bmqt::QueueOptions());
+            }
+            else {
+                isOpen = loadSession.openQueue(d_parameters_p->queueUri(),
+                                               bmqt::QueueFlags::e_READ,
+                                               queueOptions);
+            }
+            if (!isOpen) {
+                return e_OPEN_QUEUE_ERROR;  // RETURN
+            }
+        }
+    }
+
+    BALL_LOG_INFO << "Load sessions started [numProducers: " << numProducers
+                  << ", numConsumers: " << numConsumers
+                  << ", sharedSession: " << bsl::boolalpha << sharedSession
+                  << "]";
+
+    // The stats are printed as long as the application is considered
+    // connected, which the load sessions individually keep track of.
+    d_isConnected = true;
+
+    initializePayload();
+
+    // Schedule a clock to collect / dump stats
+    bdlmt::EventScheduler::RecurringEventHandle handle;
+    d_scheduler.scheduleRecurringEvent(
+        &handle,
+        bsls::TimeInterval(1.0),
+        bdlf::BindUtil::bind(&Application::snapshotStats, this));
+
+    return e_OK;
+}
+
+void Application::stopLoadSessions()
+{
+    // Destroying a load session stops it.
+    d_loadSessions.clear();
+}
+
+void Application::loadProducerThread(int index)
+{
+    LoadSession& loadSession =
+        *d_loadSessions[d_parameters_p->sharedSession() ? 0 : index];
+
+    bmqa::MessageEventBuilder eventBuilder;
+    loadSession.session().loadMessageEventBuilder(&eventBuilder);
+
+    bmqa::MessageProperties properties(d_allocator_p);
+    InputUtil::populateProperties(&properties,
+                                  d_parameters_p->messageProperties());
+
+    // Copy of the payload, sharing its buffers, whose first buffer holds the
+    // timestamp when latency is requested: that buffer is swapped with a new
+    // one for each stamped message, so that the payload of the messages
+    // already packed is never modified.
+    bdlbb::Blob blob(d_blob, d_allocator_p);
+
+    const ParametersLatency::Value latency      = d_parameters_p->latency();
+    const bool                     stampLatency = latency !=
+                                              ParametersLatency::e_NONE;
+    bdlbb::BlobBuffer              zeroBuffer;
+    if (stampLatency) {
+        zeroBuffer = blob.buffer(0);
+    }
+
+    // The schedule is kept in the clock used for latency, if any, so that
+    // the intended post times can be stamped as is.
+    const ParametersLatency::Value clock = stampLatency
+                                               ? latency
+                                               : ParametersLatency::e_HIRES;
+
+    // Open-loop schedule: the 'k'th event is intended to be posted at
+    // 'startNs + k * periodNs', regardless of when the previous events were
+    // posted.  The producers are staggered over one period.
+    const bsls::Types::Int64 periodNs =
+        static_cast<bsls::Types::Int64>(d_parameters_p->postInterval()) *
+        bdlt::TimeUnitRatio::k_NANOSECONDS_PER_MILLISECOND /
+        d_parameters_p->postRate();
+    const bsls::Types::Int64 startNs = getNowAsNs(clock) +
+                                       periodNs * index /
+                                           d_parameters_p->numProducers();
+    const bsls::Types::Int64 stampIntervalNs =
+        k_LATENCY_INTERVAL_MS *
+        bdlt::TimeUnitRatio::k_NANOSECONDS_PER_MILLISECOND;
+
+    bsls::Types::Int64 nextStampNs = startNs;
+    int                numPosted   = 0;
+
+    for (bsls::Types::Int64 k = 0;
+         d_isRunning && (d_parameters_p->eventsCount() == 0 ||
+                         numPosted < d_parameters_p->eventsCount());
+         ++k) {
+        const bsls::Types::Int64 intendedNs = startNs + k * periodNs;
+
+        const bsls::Types::Int64 nowNs = getNowAsNs(clock);
+        if (nowNs < intendedNs) {
+            bsls::TimeInterval delay;
+            delay.addNanoseconds(intendedNs - nowNs);
+            bslmt::ThreadUtil::sleep(delay);
+        }
+        // else: behind schedule, post right away; the delay is accounted for
+        // by the latency, measured from the intended post time.
+
+        if (!loadSession.isConnected()) {
+            // The events intended to be posted while disconnected are
+            // skipped, rather than posted in a burst once reconnected.
+            continue;  // CONTINUE
+        }
+
+        eventBuilder.reset();
+        for (int msgId = 0; msgId < d_parameters_p->eventSize(); ++msgId) {
+            bmqa::Message& msg = eventBuilder.startMessage();
+
+            if (bmqt::QueueFlagsUtil::isAck(d_parameters_p->queueFlags())) {
+                msg.setCorrelationId(bmqt::CorrelationId::autoValue());
+            }
+
+            if (stampLatency) {
+                // Stamp the first message of one event every
+                // 'k_LATENCY_INTERVAL_MS' with the intended post time of the
+                // event.
+                if (msgId == 0 && intendedNs >= nextStampNs) {
+                    nextStampNs = intendedNs + stampIntervalNs;
+
+                    bdlb::BigEndianInt64 timeNs = bdlb::BigEndianInt64::make(
+                        intendedNs);
+                    bdlbb::BlobBuffer buffer;
+                    d_timeBufferFactory.allocate(&buffer);
+                    buffer.setSize(sizeof(bdlb::BigEndianInt64));
+                    bsl::memcpy(buffer.buffer().get(),
+                                &timeNs,
+                                sizeof(timeNs));
+                    blob.swapBufferRaw(0, &buffer);
+                }
+                else if (blob.buffer(0).data() != zeroBuffer.data()) {
+                    bdlbb::BlobBuffer buffer(zeroBuffer);
+                    blob.swapBufferRaw(0, &buffer);
+                }
+            }
+            msg.setDataRef(&blob);
+
+            if (properties.numProperties()) {
+                msg.setPropertiesRef(&properties);
+            }
+
+            bmqt::EventBuilderResult::Enum rc = eventBuilder.packMessage(
+                loadSession.queueId());
+            if (rc != 0) {
+                BALL_LOG_ERROR << "Failed to pack message [rc: " << rc << "]";
+            }
+        }
+
+        const bmqa::MessageEvent& messageEvent = eventBuilder.messageEvent();
+
+        const int rc = loadSession.session().post(messageEvent);
+        if (rc != 0) {
+            // Not logged, as this could flood the logs when the broker does
+            // not keep up; reported with the final stats instead.
+            ++d_numLoadFailedPosts;
+            continue;  // CONTINUE
+        }
+
+        ++numPosted;
+        ++d_numLoadPostedEvents;
+        d_numLoadPostedMsgs.add(eventBuilder.messageCount());
+    }
+
+    // Signal the main thread to exit once the last producer is done posting,
+    // if a shutdown grace period was requested.
+    if (--d_numLoadProducers == 0 && d_parameters_p->shutdownGrace() != 0) {
+        d_shutdownSemaphore_p->post();
+    }
+}
+
+void Application::onLoadMessageEvent(LoadSession*              loadSession,
+                                     const bmqa::MessageEvent& event)
+{
+    if (event.type() != bmqt::MessageEventType::e_PUSH) {
+        // Acknowledgments of the producers
+        return;  // RETURN
+    }
+
+    // Update event size (i.e. including protocol overhead)
+    const bsl::shared_ptr<bmqimp::Event>& eventImpl =
+        reinterpret_cast<const bsl::shared_ptr<bmqimp::Event>&>(event);
+    d_statContext_mp->adjustValue(k_STAT_EVT,
+                                  eventImpl->rawEvent().blob()->length());
+
+    bmqa::ConfirmEventBuilder confirmBuilder;
+    loadSession->session().loadConfirmEventBuilder(&confirmBuilder);
+
+    bmqa::MessageIterator iter = event.messageIterator();
+    while (iter.nextMessage()) {
+        const bmqa::Message& message = iter.message();
+
+        bdlbb::Blob blob;
+        message.getData(&blob);
+
+        // disambiguate ConfirmEventBuilder::addMessageConfirmation
+        bdlf::MemFn<bmqt::EventBuilderResult::Enum (
+            bmqa::ConfirmEventBuilder::*)(const bmqa::Message& message)>
+            f(&bmqa::ConfirmEventBuilder::addMessageConfirmation);
+
+        bmqt::EventBuilderResult::Enum buildRc =
+            bmqp::ProtocolUtil::buildEvent(
+                bdlf::BindUtil::bind(f, &confirmBuilder, message),
+                bdlf::BindUtil::bind(&bmqa::Session::confirmMessages,
+                                     &loadSession->session(),
+                                     &confirmBuilder));
+        BSLS_ASSERT_SAFE(buildRc == 0);
+        (void)buildRc;  // compiler happiness
+
+        // Update latency stats, from the intended post time of the message
+        if (d_parameters_p->latency() != ParametersLatency::e_NONE) {
+            bdlb::BigEndianInt64 time;
+
+            int rc = mwcu::BlobUtil::readNBytes(reinterpret_cast<char*>(&time),
+                                                blob,
+                                                mwcu::BlobPosition(0, 0),
+                                                sizeof(bdlb::BigEndianInt64));
+            BSLS_ASSERT_SAFE(rc == 0);
+            (void)rc;
+
+            if (time != 0) {
+                const bsls::Types::Int64 delta =
+                    getNowAsNs(d_parameters_p->latency()) - time;
+                if (delta >= 0) {
+                    reportLatency(delta);
+                }
+            }
+        }
+
+        d_statContext_mp->adjustValue(k_STAT_MSG, blob.length());
+    }
+
+    const int rc = loadSession->session().confirmMessages(&confirmBuilder);
+    if (rc != 0) {
+        BALL_LOG_ERROR << "Failed to confirm messages of " << event
+                       << " [rc: " << rc << "]";
+    }
+}
+
+void Application::replayThread()
+{
+    BSLS_ASSERT_SAFE(d_sessionContext_mp);
+    BSLS_ASSERT_SAFE(d_session_mp);
+
+    bmqa::MessageEventBuilder& eventBuilder =
+        d_sessionContext_mp->d_eventBuilder;
+    eventBuilder.reset();
+
+    // The queues are opened for writing, with acknowledgments if the queue
+    // flags say so, the queue flags being otherwise ignored.
+    const bsls::Types::Uint64 writeFlags =
+        bmqt::QueueFlags::e_WRITE |
+        (d_parameters_p->queueFlags() & bmqt::QueueFlags::e_ACK);
+    const bool isAck = bmqt::QueueFlagsUtil::isAck(writeFlags);
+
+    typedef bsl::unordered_map<bsl::string, bmqa::QueueId> QueueIds;
+    QueueIds                        queueIds(d_allocator_p);
+    bsl::unordered_set<bsl::string> failedQueues(d_allocator_p);
+
+    // Messages written during the same second, and payload and properties
+    // of the message being packed.
+    bsl::vector<JournalReplayer::Record> batch(d_allocator_p);
+    bdlbb::Blob             payload(&d_bufferFactory, d_allocator_p);
+    bmqa::MessageProperties properties(d_allocator_p);
+
+    const double             speed   = d_parameters_p->replaySpeed();
+    const bsls::Types::Int64 startNs = getNowAsNs(ParametersLatency::e_HIRES);
+
+    JournalReplayer::Record   next;
+    int                       rc = d_journalReplayer.nextRecord(&next);
+    const bsls::Types::Uint64 firstTimestamp = next.d_timestamp;
+
+    while (d_isRunning && rc == 1) {
+        // Read the messages written during the same second as the next one.
+        batch.clear();
+        const bsls::Types::Uint64 timestamp = next.d_timestamp;
+        do {
+            batch.push_back(next);
+            rc = d_journalReplayer.nextRecord(&next);
+        } while (rc == 1 && next.d_timestamp == timestamp);
+
+        for (bsl::size_t i = 0; d_isRunning && i < batch.size(); ++i) {
+            const JournalReplayer::Record& record = batch[i];
+
+            if (speed != 0) {
+                // Open-loop schedule: the messages of the second are spread
+                // evenly over that second, scaled by the replay speed.
+                const double offsetS =
+                    static_cast<double>(timestamp - firstTimestamp) +
+                    static_cast<double>(i) / batch.size();
+                const double offsetNs =
+                    offsetS * bdlt::TimeUnitRatio::k_NANOSECONDS_PER_SECOND /
+                    speed;
+                const bsls::Types::Int64 intendedNs =
+                    startNs + static_cast<bsls::Types::Int64>(offsetNs);
+
+                const bsls::Types::Int64 nowNs = getNowAsNs(
+                    ParametersLatency::e_HIRES);
+                if (nowNs < intendedNs) {
+                    // Post the messages already packed before waiting.
+                    postReplayEvent(&eventBuilder);
+
+                    bsls::TimeInterval delay;
+                    delay.addNanoseconds(intendedNs - nowNs);
+                    bslmt::ThreadUtil::sleep(delay);
+                }
+            }
+
+            const bsl::string& uri = *record.d_queueUri_p;
+            if (failedQueues.count(uri) != 0) {
+                ++d_numReplayFailedMsgs;
+                continue;  // CONTINUE
+            }
+
+            QueueIds::iterator queueIt = queueIds.find(uri);
+            if (queueIt == queueIds.end()) {
+                // Post the messages already packed, as opening the queue
+                // takes a round trip to the broker.
+                postReplayEvent(&eventBuilder);
+
+                queueIt = queueIds
+                              .insert(bsl::make_pair(
+                                  uri,
+                                  bmqa::QueueId(
+                                      bmqt::CorrelationId::autoValue(),
+                                      d_allocator_p)))
+                              .first;
+
+                bmqa::OpenQueueStatus result = d_session_mp->openQueueSync(
+                    &queueIt->second,
+                    uri,
+                    writeFlags);
+                if (!result) {
+                    BALL_LOG_ERROR << "Error while opening queue: [result: "
+                                   << result << "], its messages are not "
+                                   << "replayed";
+                    queueIds.erase(queueIt);
+                    failedQueues.insert(uri);
+                    ++d_numReplayFailedMsgs;
+                    continue;  // CONTINUE
+                }
+            }
+
+            if (0 != d_journalReplayer.loadMessage(&payload,
+                                                   &properties,
+                                                   record,
+                                                   &d_bufferFactory)) {
+                ++d_numReplayFailedMsgs;
+                continue;  // CONTINUE
+            }
+
+            bmqa::Message& msg = eventBuilder.startMessage();
+            if (isAck) {
+                msg.setCorrelationId(bmqt::CorrelationId::autoValue());
+            }
+            msg.setDataRef(&payload);
+            if (properties.numProperties()) {
+                msg.setPropertiesRef(&properties);
+            }
+            msg.setCompressionAlgorithmType(record.d_compressionAlgorithmType);
+
+            bmqt::EventBuilderResult::Enum packRc = eventBuilder.packMessage(
+                queueIt->second);
+            if (packRc != 0) {
+                BALL_LOG_ERROR << "Failed to pack message [rc: " << packRc
+                               << "]";
+                ++d_numReplayFailedMsgs;
+                continue;  // CONTINUE
+            }
+            d_statContext_mp->adjustValue(k_STAT_MSG, payload.length());
+
+            if (eventBuilder.messageCount() >= d_parameters_p->eventSize()) {
+                postReplayEvent(&eventBuilder);
+            }
+        }
+    }
+
+    postReplayEvent(&eventBuilder);
+
+    if (rc < 0) {
+        BALL_LOG_ERROR << "Failed to read the journal [rc: " << rc << "]";
+    }
+    else if (rc == 0) {
+        BALL_LOG_INFO << "Finished replaying the journal.";
+    }
+
+    // If shutDownGrace is set, signal to the main thread to exit.
+    if (d_parameters_p->shutdownGrace() != 0) {
+        // We do not need to sleep the grace period, since it is done by the
+        // main thread, in the stop() function.
+        d_shutdownSemaphore_p->post();
+    }
+}
+
+void Application::postReplayEvent(bmqa::MessageEventBuilder* eventBuilder)
+{
+    const int numMessages = eventBuilder->messageCount();
+    if (numMessages == 0) {
+        return;  // RETURN
+    }
+
+    const bmqa::MessageEvent& messageEvent = eventBuilder->messageEvent();
+
+    // Write PUTs to log file before posting
+    if (d_fileLogger.isOpen()) {
+        bmqa::MessageIterator it = messageEvent.messageIterator();
+        while (it.nextMessage()) {
+            d_fileLogger.writePutMessage(it.message());
+        }
+    }
+
+    const int rc = d_session_mp->post(messageEvent);
+    if (rc != 0) {
+        BALL_LOG_ERROR << "Failed to post: " << bmqt::PostResult::Enum(rc)
+                       << " (" << rc << ")";
+        d_numReplayFailedMsgs.add(numMessages);
+    }
+    else {
+        const bsl::shared_ptr<bmqimp::Event>& eventImpl =
+            reinterpret_cast<const bsl::shared_ptr<bmqimp::Event>&>(
+                messageEvent);
+        d_statContext_mp->adjustValue(k_STAT_EVT,
+                                      eventImpl->rawEvent().blob()->length());
+    }
+
+    eventBuilder->reset();
+}
+
 // CLASS METHODS
 int Application::syschk(const m_bmqtool::Parameters& parameters)
 {
@@ -1131,6 +1908,22 @@ Application::Application(Parameters*       parameters,
 , d_latencies(allocator)
 , d_autoReadInProgress(false)
 , d_autoReadActivity(false)
+, d_loadSessions(d_allocator_p)
+, d_loadThreads(d_allocator_p)
+, d_numLoadProducers(0)
+, d_numLoadPostedMsgs(0)
+, d_numLoadPostedEvents(0)
+, d_numLoadFailedPosts(0)
+, d_latenciesMutex()
+, d_intervalLatencies(k_LATENCY_HISTOGRAM_HIGHEST_NS,
+                      k_LATENCY_HISTOGRAM_DIGITS,
+                      d_allocator_p)
+, d_totalLatencies(k_LATENCY_HISTOGRAM_HIGHEST_NS,
+                   k_LATENCY_HISTOGRAM_DIGITS,
+                   d_allocator_p)
+, d_latencyIntervals(d_allocator_p)
+, d_journalReplayer(d_allocator_p)
+, d_numReplayFailedMsgs(0)
 {
     // NOTHING
 }
@@ -1166,6 +1959,7 @@ int Application::start()
         if (d_session_mp) {
             d_session_mp->stop();
         }
+        stopLoadSessions();
         d_sessionContext_mp.reset();
         d_session_mp.reset();
         d_scheduler.stop();
@@ -1193,6 +1987,27 @@ int Application::run()
         rc = d_storageInspector.mainLoop();
         d_shutdownSemaphore_p->post();
     }
+    else if (d_parameters_p->mode() == ParametersMode::e_LOAD) {
+        // Start the producer threads
+        const int numProducers = d_parameters_p->numProducers();
+        d_numLoadProducers     = numProducers;
+        for (int i = 0; i < numProducers && rc == 0; ++i) {
+            bslmt::ThreadUtil::Handle handle;
+            rc = bslmt::ThreadUtil::create(
+                &handle,
+                bdlf::BindUtil::bind(&Application::loadProducerThread,
+                                     this,
+                                     i));
+            if (rc == 0) {
+                d_loadThreads.push_back(handle);
+            }
+        }
+    }
+    else if (d_parameters_p->mode() == ParametersMode::e_REPLAY) {
+        rc = bslmt::ThreadUtil::create(
+            &d_runningThread,
+            bdlf::MemFnUtil::memFn(&Application::replayThread, this));
+    }
     else {
         // Start the thread
         if (bmqt::QueueFlagsUtil::isWriter(d_parameters_p->queueFlags())) {
@@ -1221,14 +2036,32 @@ void Application::stop()
         d_runningThread = bslmt::ThreadUtil::invalidHandle();
     }
 
+    for (bsl::vector<bslmt::ThreadUtil::Handle>::iterator it =
+             d_loadThreads.begin();
+         it != d_loadThreads.end();
+         ++it) {
+        bslmt::ThreadUtil::join(*it);
+    }
+    d_loadThreads.clear();
+
     // Disconnect from the broker
-    if (d_parameters_p->mode() == ParametersMode::e_AUTO) {
+    if (d_parameters_p->mode() == ParametersMode::e_AUTO ||
+        d_parameters_p->mode() == ParametersMode::e_REPLAY) {
         if (d_parameters_p->shutdownGrace() != 0) {
             bslmt::ThreadUtil::sleep(
                 bsls::TimeInterval(d_parameters_p->shutdownGrace()));
         }
         d_session_mp->stop();
     }
+    else if (d_parameters_p->mode() == ParametersMode::e_LOAD) {
+        // Leave the consumers the grace period to receive the messages
+        // posted last.
+        if (d_parameters_p->shutdownGrace() != 0) {
+            bslmt::ThreadUtil::sleep(
+                bsls::TimeInterval(d_parameters_p->shutdownGrace()));
+        }
+        stopLoadSessions();
+    }
 
     // Must release SessionContext before the session
     d_sessionContext_mp.reset();
@@ -1236,6 +2069,10 @@ void Application::stop()
     // Delete the session
     d_session_mp.reset();
 
+    // The messages replayed may refer to the files of the storage, which
+    // must only be closed once the session is deleted.
+    d_journalReplayer.close();
+
     if (d_fileLogger.isOpen()) {
         d_fileLogger.close();
     }
@@ -24,10 +24,48 @@
 //
 //@DESCRIPTION: This component provides the main class for the 'bmqtool'
 // application.
+//
+/// Load Mode
+///---------
+// In load mode, 'bmqtool' runs both ends of a queue in one process: a number
+// of producer threads post to the queue, and a number of consumers confirm
+// the messages posted, each producer and consumer using its own session
+// unless all of them are requested to share a single session.  Each producer
+// thread follows an open-loop schedule: the 'k'th event of a producer is
+// intended to be posted at 'start + k * postInterval / postRate', regardless
+// of when the previous events were actually posted, so that a slow broker
+// delays the posts instead of reducing the rate they are attempted at.  The
+// messages stamped for latency carry their intended post time rather than
+// their actual post time, so that the latencies reported include the time
+// spent waiting behind a stalled post (i.e., they do not suffer from
+// coordinated omission).
+//
+/// Latency Report
+///--------------
+// When requested to generate a latency report (with '--latency-report'), the
+// latencies of the messages consumed are also recorded in a High Dynamic
+// Range histogram, whose percentiles (p50, p90, p99, p99.9, p99.99 and max)
+// are computed for each one second interval as well as for the whole run.
+// Both the time series of the intervals and the summary of the whole run are
+// written in the JSON report, so that it can be consumed by tools (e.g., to
+// compare the latencies of two runs).
+//
+/// Replay Mode
+///-----------
+// In replay mode, 'bmqtool' reads the messages of the journal and data files
+// of a partition (e.g., copied from a production broker), and posts them
+// again, with their properties, to the queue they were originally posted to,
+// on the broker it is connected to.  The messages are posted at the times
+// they were originally written, relative to the first one, scaled by the
+// requested replay speed, or as fast as possible if the replay speed is 0.
+// As the journal only records the time of each message to the second, the
+// messages written during the same second are spread evenly over that second.
 
 // BMQTOOL
 #include <m_bmqtool_filelogger.h>
 #include <m_bmqtool_interactive.h>
+#include <m_bmqtool_journalreplayer.h>
+#include <m_bmqtool_latencyhistogram.h>
 #include <m_bmqtool_messages.h>
 #include <m_bmqtool_storageinspector.h>
 
@@ -49,8 +87,11 @@
 #include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlmt_eventscheduler.h>
 #include <bsl_list.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
+#include <bslmt_mutex.h>
 #include <bslmt_threadutil.h>
 #include <bsls_atomic.h>
 #include <bsls_types.h>
@@ -88,6 +129,11 @@ class Application : public bmqa::SessionEventHandler {
         SessionContext(bslma::Allocator* d_allocator);
     };
 
+    /// Session, with its queue, of the load mode.
+    class LoadSession;
+
+    typedef bsl::shared_ptr<LoadSession> LoadSessionSp;
+
     // DATA
     bslma::Allocator* d_allocator_p;
     // Held, not owned
@@ -167,6 +213,62 @@ class Application : public bmqa::SessionEventHandler {
     // message was seen during the current
     // grace period.
 
+    bsl::vector<LoadSessionSp> d_loadSessions;
+    // Load mode only.  Sessions of the
+    // producers followed by the sessions of
+    // the consumers, or single session
+    // shared by all of them.
+
+    bsl::vector<bslmt::ThreadUtil::Handle> d_loadThreads;
+    // Load mode only.  Handles of the
+    // producer threads.
+
+    bsls::AtomicInt d_numLoadProducers;
+    // Load mode only.  Number of producer
+    // threads still posting.
+
+    bsls::AtomicInt64 d_numLoadPostedMsgs;
+    // Load mode only.  Number of messages
+    // posted.
+
+    bsls::AtomicInt64 d_numLoadPostedEvents;
+    // Load mode only.  Number of events
+    // posted.
+
+    bsls::AtomicInt64 d_numLoadFailedPosts;
+    // Load mode only.  Number of events
+    // which failed to be posted.
+
+    bslmt::Mutex d_latenciesMutex;
+    // Mutex protecting 'd_latencies' and the
+    // latency histograms, populated
+    // concurrently by the consumers in load
+    // mode, and snapshotted by the
+    // scheduler thread.
+
+    LatencyHistogram d_intervalLatencies;
+    // Histogram of the latencies reported
+    // since the last snapshot of the stats.
+    // Only populated when requested to
+    // generate a latency report.
+
+    LatencyHistogram d_totalLatencies;
+    // Histogram of the latencies reported
+    // until the last snapshot of the stats.
+
+    bsl::vector<LatencyPercentiles> d_latencyIntervals;
+    // Percentiles of the latencies of each
+    // interval between two snapshots of the
+    // stats, in chronological order.
+
+    JournalReplayer d_journalReplayer;
+    // Replay mode only.  Reader of the
+    // messages of the storage to replay.
+
+    bsls::AtomicInt64 d_numReplayFailedMsgs;
+    // Replay mode only.  Number of messages
+    // which failed to be replayed.
+
     // PRIVATE MANIPULATORS
     //   (virtual: bmqa::SessionEventHandler)
 
@@ -190,10 +292,25 @@ class Application : public bmqa::SessionEventHandler {
     /// Snapshot the stats.
     void snapshotStats();
 
+    /// Report the specified `latency` (in ns) of a consumed message to the
+    /// stats and, if requested to generate a latency report, keep it for
+    /// the report.
+    void reportLatency(bsls::Types::Int64 latency);
+
+    /// Accumulate the histogram of the latencies of the current interval
+    /// into the histogram of the whole run, keep its percentiles and reset
+    /// it.  The behavior is undefined unless `d_latenciesMutex` is locked.
+    void snapshotLatencyHistogram();
+
     /// Check if no message was received within the grace period in auto
     /// read mode.
     void autoReadShutdown();
 
+    /// Return true if the stats track consumed messages, i.e. in auto mode
+    /// on a queue opened for reading, or in load mode, and false if they
+    /// track produced messages.
+    bool isConsumerStats() const;
+
     /// Print column headers for stats to the standard output, if it was not
     /// already printed.
     void printStatHeader() const;
@@ -216,6 +333,33 @@ class Application : public bmqa::SessionEventHandler {
     /// Thread to process the publish.
     void producerThread();
 
+    /// Prepare in `d_blob` the payload of the messages to publish.
+    void initializePayload();
+
+    /// Start the sessions of the load mode, open their queue, and prepare
+    /// the payload to publish.  Return 0 on success.
+    int initializeLoad();
+
+    /// Stop and destroy the sessions of the load mode.
+    void stopLoadSessions();
+
+    /// Thread of the producer having the specified `index` in load mode,
+    /// posting events on an open-loop schedule.
+    void loadProducerThread(int index);
+
+    /// Process the specified message `event` received by the specified
+    /// `loadSession` in load mode: confirm the messages pushed, and report
+    /// their latency from their intended post time.
+    void onLoadMessageEvent(LoadSession*              loadSession,
+                            const bmqa::MessageEvent& event);
+
+    /// Thread replaying the messages of the storage in replay mode.
+    void replayThread();
+
+    /// Post the event being built by the specified `eventBuilder`, if it
+    /// holds any message, and reset `eventBuilder`.
+    void postReplayEvent(bmqa::MessageEventBuilder* eventBuilder);
+
   public:
     // CLASS METHODS
 
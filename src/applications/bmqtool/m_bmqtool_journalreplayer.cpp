@@ -0,0 +1,401 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// m_bmqtool_journalreplayer.cpp                                      -*-C++-*-
+#include <m_bmqtool_journalreplayer.h>
+
+// MQB
+#include <mqbs_filestoreprotocol.h>
+#include <mqbs_filestoreprotocolutil.h>
+#include <mqbs_filesystemutil.h>
+#include <mqbs_offsetptr.h>
+#include <mqbs_qlistfileiterator.h>
+
+// BMQ
+#include <bmqp_compression.h>
+#include <bmqp_messageproperties.h>
+#include <bmqp_protocol.h>
+#include <bmqt_propertytype.h>
+
+// MWC
+#include <mwcu_memoutstream.h>
+
+// BDE
+#include <ball_log.h>
+#include <bdlbb_blob.h>
+#include <bdls_filesystemutil.h>
+#include <bsl_memory.h>
+#include <bslma_default.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace m_bmqtool {
+
+namespace {
+
+BALL_LOG_SET_NAMESPACE_CATEGORY("BMQTOOL.JOURNALREPLAYER");
+
+/// Open the file having the specified `filename` into the specified `mfd`,
+/// and check that it starts with a BlazingMQ header.  Return true on
+/// success, or false otherwise, in which case `mfd` is closed.
+bool openFile(mqbs::MappedFileDescriptor* mfd, const bsl::string& filename)
+{
+    if (!bdls::FilesystemUtil::isRegularFile(filename)) {
+        BALL_LOG_ERROR << "File [" << filename << "] is not a regular file.";
+        return false;  // RETURN
+    }
+
+    mwcu::MemOutStream errorDesc;
+    int                rc = mqbs::FileSystemUtil::open(
+        mfd,
+        filename.c_str(),
+        bdls::FilesystemUtil::getFileSize(filename),
+        true,  // read only
+        errorDesc);
+    if (0 != rc) {
+        BALL_LOG_ERROR << "Failed to open file [" << filename << "] rc: " << rc
+                       << ", error: " << errorDesc.str();
+        return false;  // RETURN
+    }
+
+    rc = mqbs::FileStoreProtocolUtil::hasBmqHeader(*mfd);
+    if (0 != rc) {
+        BALL_LOG_ERROR << "Missing BlazingMQ header from file [" << filename
+                       << "] rc: " << rc;
+        mqbs::FileSystemUtil::close(mfd);
+        return false;  // RETURN
+    }
+
+    return true;
+}
+
+/// Return a blob buffer referring, without owning it, to the specified
+/// `length` bytes at the specified `data`.
+bdlbb::BlobBuffer makeBuffer(const char* data, int length)
+{
+    bsl::shared_ptr<char> dataSp(const_cast<char*>(data),
+                                 bslstl::SharedPtrNilDeleter(),
+                                 0);
+    return bdlbb::BlobBuffer(dataSp, length);
+}
+
+/// Load into the specified `out` the properties of the specified `in`.
+/// Return 0 on success, or a non-zero value otherwise.
+int copyProperties(bmqa::MessageProperties*       out,
+                   const bmqp::MessageProperties& in)
+{
+    int rc = 0;
+
+    bmqp::MessagePropertiesIterator it(&in);
+    while (rc == 0 && it.hasNext()) {
+        switch (it.type()) {
+        case bmqt::PropertyType::e_BOOL: {
+            rc = out->setPropertyAsBool(it.name(), it.getAsBool());
+        } break;
+        case bmqt::PropertyType::e_CHAR: {
+            rc = out->setPropertyAsChar(it.name(), it.getAsChar());
+        } break;
+        case bmqt::PropertyType::e_SHORT: {
+            rc = out->setPropertyAsShort(it.name(), it.getAsShort());
+        } break;
+        case bmqt::PropertyType::e_INT32: {
+            rc = out->setPropertyAsInt32(it.name(), it.getAsInt32());
+        } break;
+        case bmqt::PropertyType::e_INT64: {
+            rc = out->setPropertyAsInt64(it.name(), it.getAsInt64());
+        } break;
+        case bmqt::PropertyType::e_STRING: {
+            rc = out->setPropertyAsString(it.name(), it.getAsString());
+        } break;
+        case bmqt::PropertyType::e_BINARY: {
+            rc = out->setPropertyAsBinary(it.name(), it.getAsBinary());
+        } break;
+        case bmqt::PropertyType::e_UNDEFINED:
+        default: {
+            rc = -1;
+        } break;
+        }
+    }
+
+    return rc;
+}
+
+}  // close unnamed namespace
+
+// -----------------------------
+// struct JournalReplayer::Record
+// -----------------------------
+
+JournalReplayer::Record::Record()
+: d_queueUri_p(0)
+, d_timestamp(0)
+, d_dataOffset(0)
+, d_compressionAlgorithmType(bmqt::CompressionAlgorithmType::e_NONE)
+{
+    // NOTHING
+}
+
+// ---------------------
+// class JournalReplayer
+// ---------------------
+
+// CREATORS
+JournalReplayer::JournalReplayer(bslma::Allocator* basicAllocator)
+: d_journalFd()
+, d_dataFd()
+, d_journalIter()
+, d_queueUris(basicAllocator)
+, d_numSkipped(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    // NOTHING
+}
+
+JournalReplayer::~JournalReplayer()
+{
+    close();
+}
+
+// MANIPULATORS
+int JournalReplayer::open(const bsl::string& journalFile,
+                          const bsl::string& dataFile,
+                          const bsl::string& qlistFile)
+{
+    enum RC {
+        e_OK            = 0,
+        e_OPEN_ERROR    = -1,
+        e_ITERATOR_FAIL = -2,
+        e_QLIST_ERROR   = -3
+    };
+
+    close();
+    d_numSkipped = 0;
+
+    // Read the queues of the qlist file, which is not needed past this point
+    mqbs::MappedFileDescriptor qlistFd;
+    if (!openFile(&qlistFd, qlistFile)) {
+        return e_OPEN_ERROR;  // RETURN
+    }
+
+    mqbs::QlistFileIterator qlistIter;
+    int rc = qlistIter.reset(&qlistFd,
+                             mqbs::FileStoreProtocolUtil::bmqHeader(qlistFd));
+    if (0 != rc) {
+        BALL_LOG_ERROR << "Failed to create iterator for file [" << qlistFile
+                       << "] rc: " << rc;
+        mqbs::FileSystemUtil::close(&qlistFd);
+        return e_ITERATOR_FAIL;  // RETURN
+    }
+
+    while (1 == (rc = qlistIter.nextRecord())) {
+        const char*  uri    = 0;
+        const char*  qkey   = 0;
+        unsigned int uriLen = 0;
+
+        qlistIter.loadQueueUri(&uri, &uriLen);
+        qlistIter.loadQueueUriHash(&qkey);
+
+        d_queueUris[mqbu::StorageKey(mqbu::StorageKey::BinaryRepresentation(),
+                                     qkey)]
+            .assign(uri, uriLen);
+    }
+    qlistIter.clear();
+    mqbs::FileSystemUtil::close(&qlistFd);
+
+    if (rc < 0) {
+        BALL_LOG_ERROR << "Failed to read file [" << qlistFile
+                       << "] rc: " << rc;
+        d_queueUris.clear();
+        return e_QLIST_ERROR;  // RETURN
+    }
+
+    // Open the journal and data files
+    if (!openFile(&d_journalFd, journalFile)) {
+        d_queueUris.clear();
+        return e_OPEN_ERROR;  // RETURN
+    }
+
+    rc = d_journalIter.reset(
+        &d_journalFd,
+        mqbs::FileStoreProtocolUtil::bmqHeader(d_journalFd));
+    if (0 != rc) {
+        BALL_LOG_ERROR << "Failed to create iterator for file [" << journalFile
+                       << "] rc: " << rc;
+        close();
+        return e_ITERATOR_FAIL;  // RETURN
+    }
+
+    if (!openFile(&d_dataFd, dataFile)) {
+        close();
+        return e_OPEN_ERROR;  // RETURN
+    }
+
+    BALL_LOG_INFO << "Replaying journal [" << journalFile << "] with "
+                  << d_queueUris.size() << " queues.";
+
+    return e_OK;
+}
+
+void JournalReplayer::close()
+{
+    d_journalIter.clear();
+
+    if (d_journalFd.isValid()) {
+        mqbs::FileSystemUtil::close(&d_journalFd);
+    }
+    if (d_dataFd.isValid()) {
+        mqbs::FileSystemUtil::close(&d_dataFd);
+    }
+
+    d_queueUris.clear();
+}
+
+int JournalReplayer::nextRecord(Record* record)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(record);
+
+    if (!d_journalIter.isValid()) {
+        return 0;  // RETURN
+    }
+
+    int rc;
+    while (1 == (rc = d_journalIter.nextRecord())) {
+        if (d_journalIter.recordType() != mqbs::RecordType::e_MESSAGE) {
+            continue;  // CONTINUE
+        }
+
+        const mqbs::MessageRecord& rec = d_journalIter.asMessageRecord();
+
+        QueueUris::const_iterator it = d_queueUris.find(rec.queueKey());
+        if (it == d_queueUris.end()) {
+            ++d_numSkipped;
+            continue;  // CONTINUE
+        }
+
+        record->d_queueUri_p = &it->second;
+        record->d_timestamp  = rec.header().timestamp();
+        record->d_dataOffset = static_cast<bsls::Types::Uint64>(
+                                   rec.messageOffsetDwords()) *
+                               bmqp::Protocol::k_DWORD_SIZE;
+        record->d_compressionAlgorithmType = rec.compressionAlgorithmType();
+
+        return 1;  // RETURN
+    }
+
+    return rc;
+}
+
+int JournalReplayer::loadMessage(bdlbb::Blob*              payload,
+                                 bmqa::MessageProperties*  properties,
+                                 const Record&             record,
+                                 bdlbb::BlobBufferFactory* bufferFactory)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(payload);
+    BSLS_ASSERT_SAFE(properties);
+    BSLS_ASSERT_SAFE(bufferFactory);
+    BSLS_ASSERT_SAFE(d_dataFd.isValid());
+
+    enum RC {
+        e_OK                  = 0,
+        e_INVALID_OFFSET      = -1,
+        e_INVALID_RECORD      = -2,
+        e_PROPERTIES_ERROR    = -3,
+        e_DECOMPRESSION_ERROR = -4
+    };
+
+    payload->removeAll();
+    properties->clear();
+
+    const bsls::Types::Uint64 fileSize = d_dataFd.fileSize();
+    if (record.d_dataOffset + sizeof(mqbs::DataHeader) > fileSize) {
+        return e_INVALID_OFFSET;  // RETURN
+    }
+
+    const mqbs::DataHeader& dh = *mqbs::OffsetPtr<const mqbs::DataHeader>(
+        d_dataFd.block(),
+        record.d_dataOffset);
+
+    const int headerSize  = dh.headerWords() * bmqp::Protocol::k_WORD_SIZE;
+    const int optionsSize = dh.optionsWords() * bmqp::Protocol::k_WORD_SIZE;
+    const int messageSize = dh.messageWords() * bmqp::Protocol::k_WORD_SIZE;
+    const int paddedLen   = messageSize - headerSize - optionsSize;
+    if (paddedLen <= 0 || record.d_dataOffset + messageSize > fileSize) {
+        return e_INVALID_RECORD;  // RETURN
+    }
+
+    const char* appData = d_dataFd.block().base() + record.d_dataOffset +
+                          headerSize + optionsSize;
+    int         appDataLen = paddedLen - appData[paddedLen - 1];
+
+    // Properties, never compressed
+    if (mqbs::DataHeaderFlagUtil::isSet(
+            dh.flags(),
+            mqbs::DataHeaderFlags::e_MESSAGE_PROPERTIES)) {
+        const bmqp::MessagePropertiesHeader& mph =
+            *reinterpret_cast<const bmqp::MessagePropertiesHeader*>(appData);
+        const int propertiesAreaLen = mph.messagePropertiesAreaWords() *
+                                      bmqp::Protocol::k_WORD_SIZE;
+        if (propertiesAreaLen > appDataLen) {
+            return e_INVALID_RECORD;  // RETURN
+        }
+
+        bdlbb::Blob propertiesBlob(d_allocator_p);
+        propertiesBlob.appendDataBuffer(
+            makeBuffer(appData, propertiesAreaLen));
+
+        bmqp::MessageProperties in(d_allocator_p);
+        if (0 != in.streamIn(propertiesBlob,
+                             bmqp::MessagePropertiesInfo(dh).isExtended()) ||
+            0 != copyProperties(properties, in)) {
+            return e_PROPERTIES_ERROR;  // RETURN
+        }
+
+        appData += propertiesAreaLen;
+        appDataLen -= propertiesAreaLen;
+    }
+
+    if (appDataLen == 0) {
+        return e_OK;  // RETURN
+    }
+
+    // Payload
+    if (record.d_compressionAlgorithmType ==
+        bmqt::CompressionAlgorithmType::e_NONE) {
+        payload->appendDataBuffer(makeBuffer(appData, appDataLen));
+        return e_OK;  // RETURN
+    }
+
+    bdlbb::Blob compressed(d_allocator_p);
+    compressed.appendDataBuffer(makeBuffer(appData, appDataLen));
+
+    mwcu::MemOutStream errorStream(d_allocator_p);
+    if (0 != bmqp::Compression::decompress(payload,
+                                           bufferFactory,
+                                           record.d_compressionAlgorithmType,
+                                           compressed,
+                                           &errorStream,
+                                           d_allocator_p)) {
+        BALL_LOG_WARN << "Failed to decompress message at offset "
+                      << record.d_dataOffset << ": " << errorStream.str();
+        return e_DECOMPRESSION_ERROR;  // RETURN
+    }
+
+    return e_OK;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,234 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// m_bmqtool_journalreplayer.h                                        -*-C++-*-
+#ifndef INCLUDED_M_BMQTOOL_JOURNALREPLAYER
+#define INCLUDED_M_BMQTOOL_JOURNALREPLAYER
+
+//@PURPOSE: Provide a reader of the messages of a storage, for replay.
+//
+//@CLASSES:
+//  m_bmqtool::JournalReplayer:         reader of the messages of a storage
+//  m_bmqtool::JournalReplayer::Record: message record of the journal
+//
+//@DESCRIPTION: 'm_bmqtool::JournalReplayer' reads, in the order in which they
+// were written, the message records of the journal file of a partition, and
+// loads the payload and properties of each message from the data file of the
+// partition, so that the messages can be posted again to a broker.  The URI
+// of the queue of each message is resolved from the qlist file of the
+// partition.
+//
+// The messages are read directly from the memory mapped files, the same way
+// as the storage inspector does, and the payload of a compressed message is
+// decompressed, so that it can be compressed again with the same algorithm
+// when posted.
+//
+// Note that the timestamp of a message record is the time, in seconds since
+// the epoch, at which the message was written to the journal: it is the only
+// indication of the original arrival time of the messages.
+//
+/// Thread Safety
+///-------------
+// 'm_bmqtool::JournalReplayer' is *not* thread-safe.
+//
+/// Usage
+///-----
+//..
+//  m_bmqtool::JournalReplayer replayer(allocator);
+//  int rc = replayer.open(journalFile, dataFile, qlistFile);
+//
+//  m_bmqtool::JournalReplayer::Record record;
+//  while ((rc = replayer.nextRecord(&record)) == 1) {
+//      bdlbb::Blob             payload(&bufferFactory, allocator);
+//      bmqa::MessageProperties properties(allocator);
+//      rc = replayer.loadMessage(&payload,
+//                                &properties,
+//                                record,
+//                                &bufferFactory);
+//      // ...
+//  }
+//..
+
+// MQB
+#include <mqbs_journalfileiterator.h>
+#include <mqbs_mappedfiledescriptor.h>
+#include <mqbu_storagekey.h>
+
+// BMQ
+#include <bmqa_messageproperties.h>
+#include <bmqt_compressionalgorithmtype.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bslh_hash.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace m_bmqtool {
+
+// =====================
+// class JournalReplayer
+// =====================
+
+/// Reader of the messages of a storage, for replay.
+class JournalReplayer {
+  public:
+    // TYPES
+
+    /// Message record of the journal.
+    struct Record {
+        // PUBLIC DATA
+        const bsl::string* d_queueUri_p;
+        // URI of the queue of the message.
+        // Owned by the replayer.
+
+        bsls::Types::Uint64 d_timestamp;
+        // Time, in seconds since the epoch, at
+        // which the message was written.
+
+        bsls::Types::Uint64 d_dataOffset;
+        // Offset, in bytes, of the message in
+        // the data file.
+
+        bmqt::CompressionAlgorithmType::Enum d_compressionAlgorithmType;
+        // Algorithm the payload of the message
+        // is compressed with.
+
+        // CREATORS
+
+        /// Create a record referring to no message.
+        Record();
+    };
+
+  private:
+    // PRIVATE TYPES
+    /// queueKey -> queueUri
+    typedef bsl::unordered_map<mqbu::StorageKey,
+                               bsl::string,
+                               bslh::Hash<mqbu::StorageKeyHashAlgo> >
+        QueueUris;
+
+    // DATA
+    mqbs::MappedFileDescriptor d_journalFd;
+    // Journal file.
+
+    mqbs::MappedFileDescriptor d_dataFd;
+    // Data file.
+
+    mqbs::JournalFileIterator d_journalIter;
+    // Iterator on the records of the
+    // journal file.
+
+    QueueUris d_queueUris;
+    // URI of each queue of the qlist file,
+    // by queue key.
+
+    bsls::Types::Int64 d_numSkipped;
+    // Number of message records skipped,
+    // as their queue is unknown.
+
+    bslma::Allocator* d_allocator_p;
+    // Allocator to use.
+
+  private:
+    // NOT IMPLEMENTED
+    JournalReplayer(const JournalReplayer&) BSLS_KEYWORD_DELETED;
+    JournalReplayer& operator=(const JournalReplayer&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(JournalReplayer, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a replayer having no file opened.  Optionally specify a
+    /// `basicAllocator` used to supply memory.
+    explicit JournalReplayer(bslma::Allocator* basicAllocator = 0);
+
+    /// Close the files, if opened, and destroy this object.
+    ~JournalReplayer();
+
+    // MANIPULATORS
+
+    /// Open the specified `journalFile`, `dataFile` and `qlistFile` of a
+    /// partition, and read the queues of `qlistFile`.  Return 0 on
+    /// success, or a non-zero value otherwise, in which case no file is
+    /// opened.
+    int open(const bsl::string& journalFile,
+             const bsl::string& dataFile,
+             const bsl::string& qlistFile);
+
+    /// Close the files, if opened.
+    void close();
+
+    /// Load into the specified `record` the next message record of the
+    /// journal, skipping the records of the other types and the messages
+    /// of an unknown queue.  Return 1 if a record was loaded, 0 if the end
+    /// of the journal was reached, or a negative value if an error was
+    /// encountered.
+    int nextRecord(Record* record);
+
+    /// Load into the specified `payload` the payload, decompressed, and
+    /// into the specified `properties` the properties of the message of the
+    /// specified `record`, using the specified `bufferFactory` to supply
+    /// the buffers of a decompressed payload.  Return 0 on success, or a
+    /// non-zero value otherwise.  The behavior is undefined unless `record`
+    /// was loaded by this object since the files were opened.  Note that,
+    /// unless decompressed, `payload` refers to the memory of the data file,
+    /// and is only valid until the files are closed.
+    int loadMessage(bdlbb::Blob*              payload,
+                    bmqa::MessageProperties*  properties,
+                    const Record&             record,
+                    bdlbb::BlobBufferFactory* bufferFactory);
+
+    // ACCESSORS
+
+    /// Return the number of queues of the qlist file.
+    int numQueues() const;
+
+    /// Return the number of message records skipped since the files were
+    /// last opened, as their queue is not in the qlist file.
+    bsls::Types::Int64 numSkipped() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ---------------------
+// class JournalReplayer
+// ---------------------
+
+// ACCESSORS
+inline int JournalReplayer::numQueues() const
+{
+    return static_cast<int>(d_queueUris.size());
+}
+
+inline bsls::Types::Int64 JournalReplayer::numSkipped() const
+{
+    return d_numSkipped;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,282 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// m_bmqtool_latencyhistogram.cpp                                     -*-C++-*-
+#include <m_bmqtool_latencyhistogram.h>
+
+// BDE
+#include <bdlb_bitutil.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstdint.h>
+#include <bsl_limits.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace m_bmqtool {
+
+// -------------------------
+// struct LatencyPercentiles
+// -------------------------
+
+// CREATORS
+LatencyPercentiles::LatencyPercentiles()
+: d_count(0)
+, d_min(0)
+, d_mean(0.0)
+, d_p50(0)
+, d_p90(0)
+, d_p99(0)
+, d_p999(0)
+, d_p9999(0)
+, d_max(0)
+{
+    // NOTHING
+}
+
+// ACCESSORS
+bsl::ostream& LatencyPercentiles::printJson(bsl::ostream& stream) const
+{
+    stream << "{ \"count\": " << d_count << ", \"min\": " << d_min
+           << ", \"mean\": " << d_mean << ", \"p50\": " << d_p50
+           << ", \"p90\": " << d_p90 << ", \"p99\": " << d_p99
+           << ", \"p99.9\": " << d_p999 << ", \"p99.99\": " << d_p9999
+           << ", \"max\": " << d_max << " }";
+
+    return stream;
+}
+
+// ----------------------
+// class LatencyHistogram
+// ----------------------
+
+// PRIVATE ACCESSORS
+int LatencyHistogram::bucketIndex(bsls::Types::Int64 value) const
+{
+    // Position of the highest bit set in the value, the values lower than
+    // the number of sub-buckets all belonging to the first bucket.
+    const int pow2Ceiling =
+        64 - bdlb::BitUtil::numLeadingUnsetBits(
+                 static_cast<bsl::uint64_t>(value | d_subBucketMask));
+
+    return pow2Ceiling - (d_subBucketHalfCountMagnitude + 1);
+}
+
+int LatencyHistogram::countsIndex(bsls::Types::Int64 value) const
+{
+    const int                bucketIdx    = bucketIndex(value);
+    const bsls::Types::Int64 subBucketIdx = value >> bucketIdx;
+
+    // The lower half of the sub-buckets of each bucket but the first one is
+    // omitted, as it overlaps with the upper half of the previous bucket.
+    return static_cast<int>(
+        (static_cast<bsls::Types::Int64>(bucketIdx + 1)
+         << d_subBucketHalfCountMagnitude) +
+        (subBucketIdx - (1LL << d_subBucketHalfCountMagnitude)));
+}
+
+bsls::Types::Int64 LatencyHistogram::highestEquivalentValue(int index) const
+{
+    const bsls::Types::Int64 subBucketHalfCount =
+        1LL << d_subBucketHalfCountMagnitude;
+
+    int bucketIdx = (index >> d_subBucketHalfCountMagnitude) - 1;
+    bsls::Types::Int64 subBucketIdx = (index & (subBucketHalfCount - 1)) +
+                                      subBucketHalfCount;
+    if (bucketIdx < 0) {
+        subBucketIdx -= subBucketHalfCount;
+        bucketIdx = 0;
+    }
+
+    return (subBucketIdx << bucketIdx) + (1LL << bucketIdx) - 1;
+}
+
+// CREATORS
+LatencyHistogram::LatencyHistogram(bsls::Types::Int64 highestTrackableValue,
+                                   int                significantDigits,
+                                   bslma::Allocator*  basicAllocator)
+: d_highestTrackableValue(highestTrackableValue)
+, d_subBucketHalfCountMagnitude(0)
+, d_subBucketMask(0)
+, d_counts(basicAllocator)
+, d_totalCount(0)
+, d_min(bsl::numeric_limits<bsls::Types::Int64>::max())
+, d_max(0)
+, d_sum(0.0)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(highestTrackableValue >= 2);
+    BSLS_ASSERT_OPT(1 <= significantDigits && significantDigits <= 5);
+
+    // Number of sub-buckets needed for the values lower than it to be
+    // recorded exactly, i.e. with a precision of 'significantDigits'.
+    bsls::Types::Int64 largestValueWithSingleUnitResolution = 2;
+    for (int i = 0; i < significantDigits; ++i) {
+        largestValueWithSingleUnitResolution *= 10;
+    }
+
+    int subBucketCountMagnitude = 0;
+    while ((1LL << subBucketCountMagnitude) <
+           largestValueWithSingleUnitResolution) {
+        ++subBucketCountMagnitude;
+    }
+
+    d_subBucketHalfCountMagnitude = subBucketCountMagnitude - 1;
+    d_subBucketMask               = (1LL << subBucketCountMagnitude) - 1;
+
+    // Number of buckets needed to cover 'highestTrackableValue', each bucket
+    // covering twice the range of the previous one.
+    bsls::Types::Int64 smallestUntrackableValue = 1LL
+                                                  << subBucketCountMagnitude;
+    int                bucketCount              = 1;
+    while (smallestUntrackableValue <= highestTrackableValue) {
+        if (smallestUntrackableValue >
+            bsl::numeric_limits<bsls::Types::Int64>::max() / 2) {
+            ++bucketCount;
+            break;  // BREAK
+        }
+        smallestUntrackableValue <<= 1;
+        ++bucketCount;
+    }
+
+    d_counts.resize((bucketCount + 1) << d_subBucketHalfCountMagnitude, 0);
+}
+
+LatencyHistogram::LatencyHistogram(const LatencyHistogram& original,
+                                   bslma::Allocator*       basicAllocator)
+: d_highestTrackableValue(original.d_highestTrackableValue)
+, d_subBucketHalfCountMagnitude(original.d_subBucketHalfCountMagnitude)
+, d_subBucketMask(original.d_subBucketMask)
+, d_counts(original.d_counts, basicAllocator)
+, d_totalCount(original.d_totalCount)
+, d_min(original.d_min)
+, d_max(original.d_max)
+, d_sum(original.d_sum)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+LatencyHistogram& LatencyHistogram::operator=(const LatencyHistogram& rhs)
+{
+    if (this != &rhs) {
+        d_highestTrackableValue       = rhs.d_highestTrackableValue;
+        d_subBucketHalfCountMagnitude = rhs.d_subBucketHalfCountMagnitude;
+        d_subBucketMask               = rhs.d_subBucketMask;
+        d_counts                      = rhs.d_counts;
+        d_totalCount                  = rhs.d_totalCount;
+        d_min                         = rhs.d_min;
+        d_max                         = rhs.d_max;
+        d_sum                         = rhs.d_sum;
+    }
+
+    return *this;
+}
+
+void LatencyHistogram::record(bsls::Types::Int64 value)
+{
+    if (value < 0) {
+        value = 0;
+    }
+
+    const int index = countsIndex(
+        bsl::min(value, d_highestTrackableValue));
+    BSLS_ASSERT_SAFE(0 <= index &&
+                     index < static_cast<int>(d_counts.size()));
+
+    ++d_counts[index];
+    ++d_totalCount;
+    d_min = bsl::min(d_min, value);
+    d_max = bsl::max(d_max, value);
+    d_sum += static_cast<double>(value);
+}
+
+void LatencyHistogram::add(const LatencyHistogram& other)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_counts.size() == other.d_counts.size());
+    BSLS_ASSERT_SAFE(d_subBucketHalfCountMagnitude ==
+                     other.d_subBucketHalfCountMagnitude);
+
+    if (other.d_totalCount == 0) {
+        return;  // RETURN
+    }
+
+    for (bsl::size_t i = 0; i < d_counts.size(); ++i) {
+        d_counts[i] += other.d_counts[i];
+    }
+
+    d_totalCount += other.d_totalCount;
+    d_min = bsl::min(d_min, other.d_min);
+    d_max = bsl::max(d_max, other.d_max);
+    d_sum += other.d_sum;
+}
+
+void LatencyHistogram::reset()
+{
+    if (d_totalCount == 0) {
+        return;  // RETURN
+    }
+
+    bsl::fill(d_counts.begin(), d_counts.end(), 0);
+    d_totalCount = 0;
+    d_min        = bsl::numeric_limits<bsls::Types::Int64>::max();
+    d_max        = 0;
+    d_sum        = 0.0;
+}
+
+// ACCESSORS
+bsls::Types::Int64
+LatencyHistogram::valueAtPercentile(double percentile) const
+{
+    if (d_totalCount == 0) {
+        return 0;  // RETURN
+    }
+
+    percentile = bsl::min(bsl::max(percentile, 0.0), 100.0);
+
+    bsls::Types::Int64 countAtPercentile = static_cast<bsls::Types::Int64>(
+        percentile / 100.0 * static_cast<double>(d_totalCount) + 0.5);
+    countAtPercentile = bsl::max(countAtPercentile, 1LL);
+
+    bsls::Types::Int64 cumulativeCount = 0;
+    for (bsl::size_t i = 0; i < d_counts.size(); ++i) {
+        cumulativeCount += d_counts[i];
+        if (cumulativeCount >= countAtPercentile) {
+            return bsl::min(highestEquivalentValue(static_cast<int>(i)),
+                            d_max);  // RETURN
+        }
+    }
+
+    return d_max;
+}
+
+void LatencyHistogram::loadPercentiles(LatencyPercentiles* percentiles) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(percentiles);
+
+    percentiles->d_count = count();
+    percentiles->d_min   = min();
+    percentiles->d_mean  = mean();
+    percentiles->d_p50   = valueAtPercentile(50.0);
+    percentiles->d_p90   = valueAtPercentile(90.0);
+    percentiles->d_p99   = valueAtPercentile(99.0);
+    percentiles->d_p999  = valueAtPercentile(99.9);
+    percentiles->d_p9999 = valueAtPercentile(99.99);
+    percentiles->d_max   = max();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,279 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// m_bmqtool_latencyhistogram.h                                       -*-C++-*-
+#ifndef INCLUDED_M_BMQTOOL_LATENCYHISTOGRAM
+#define INCLUDED_M_BMQTOOL_LATENCYHISTOGRAM
+
+//@PURPOSE: Provide a high dynamic range histogram of latencies.
+//
+//@CLASSES:
+//  m_bmqtool::LatencyHistogram:   HDR histogram of latencies
+//  m_bmqtool::LatencyPercentiles: percentiles summarizing a histogram
+//
+//@DESCRIPTION: 'm_bmqtool::LatencyHistogram' records latencies (or any
+// non-negative integer values) in a High Dynamic Range histogram, i.e., a
+// histogram whose buckets grow exponentially while each one is divided in a
+// fixed number of linear sub-buckets, so that any value up to the highest
+// trackable value is recorded with the same relative precision (expressed as
+// a number of significant decimal digits).  Recording a value is a constant
+// time operation which does not allocate, and the memory used by the
+// histogram only depends on its range and precision, not on the number of
+// values recorded, so that the latency of every message can be recorded for
+// the whole duration of a run.
+//
+// Histograms having the same range and precision can be added together,
+// which allows to record the latencies of an interval (e.g., one second) in
+// one histogram, and to accumulate them in a histogram covering the whole
+// run once the interval is over.
+//
+// 'm_bmqtool::LatencyPercentiles' is a simple attribute type holding the
+// percentiles of interest of a histogram, which can be printed as a JSON
+// object.
+//
+/// Thread Safety
+///-------------
+// 'm_bmqtool::LatencyHistogram' is *not* thread-safe: concurrent accesses
+// must be externally synchronized.
+//
+/// Usage
+///-----
+//..
+//  m_bmqtool::LatencyHistogram histogram(3600LL * 1000 * 1000 * 1000,
+//                                        3,
+//                                        allocator);
+//  histogram.record(latencyNs);
+//
+//  // ...
+//
+//  m_bmqtool::LatencyPercentiles percentiles;
+//  histogram.loadPercentiles(&percentiles);
+//  percentiles.printJson(bsl::cout);
+//..
+
+// BDE
+#include <bsl_ostream.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace m_bmqtool {
+
+// =========================
+// struct LatencyPercentiles
+// =========================
+
+/// Percentiles summarizing the values recorded in a `LatencyHistogram`.
+struct LatencyPercentiles {
+    // PUBLIC DATA
+    bsls::Types::Int64 d_count;
+    // Number of values recorded.
+
+    bsls::Types::Int64 d_min;
+    // Lowest value recorded.
+
+    double d_mean;
+    // Mean of the values recorded.
+
+    bsls::Types::Int64 d_p50;
+    // 50th percentile (median).
+
+    bsls::Types::Int64 d_p90;
+    // 90th percentile.
+
+    bsls::Types::Int64 d_p99;
+    // 99th percentile.
+
+    bsls::Types::Int64 d_p999;
+    // 99.9th percentile.
+
+    bsls::Types::Int64 d_p9999;
+    // 99.99th percentile.
+
+    bsls::Types::Int64 d_max;
+    // Highest value recorded.
+
+    // CREATORS
+
+    /// Create an object with all its attributes set to zero.
+    LatencyPercentiles();
+
+    // ACCESSORS
+
+    /// Print to the specified `stream` the attributes of this object, as a
+    /// JSON object on a single line, and return a reference to `stream`.
+    bsl::ostream& printJson(bsl::ostream& stream) const;
+};
+
+// ======================
+// class LatencyHistogram
+// ======================
+
+/// High Dynamic Range histogram of latencies.
+class LatencyHistogram {
+  private:
+    // DATA
+    bsls::Types::Int64 d_highestTrackableValue;
+    // Highest value recorded without being
+    // clamped.
+
+    int d_subBucketHalfCountMagnitude;
+    // Base 2 logarithm of half the number
+    // of sub-buckets of each bucket.
+
+    bsls::Types::Int64 d_subBucketMask;
+    // Mask of the bits of a value selecting
+    // its sub-bucket in the first bucket.
+
+    bsl::vector<bsls::Types::Int64> d_counts;
+    // Number of values recorded in each
+    // sub-bucket, the sub-buckets of the
+    // lower half of each bucket other than
+    // the first one being omitted, as they
+    // overlap with the previous bucket.
+
+    bsls::Types::Int64 d_totalCount;
+    // Number of values recorded.
+
+    bsls::Types::Int64 d_min;
+    // Lowest value recorded, exactly.
+
+    bsls::Types::Int64 d_max;
+    // Highest value recorded, exactly.
+
+    double d_sum;
+    // Sum of the values recorded.
+
+  private:
+    // PRIVATE ACCESSORS
+
+    /// Return the index of the bucket of the specified `value`.
+    int bucketIndex(bsls::Types::Int64 value) const;
+
+    /// Return the index in `d_counts` of the sub-bucket of the specified
+    /// `value`.
+    int countsIndex(bsls::Types::Int64 value) const;
+
+    /// Return the highest value equivalent, i.e. recorded in the same
+    /// sub-bucket, to the values of the sub-bucket having the specified
+    /// `index` in `d_counts`.
+    bsls::Types::Int64 highestEquivalentValue(int index) const;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(LatencyHistogram,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty histogram recording values from 0 to the specified
+    /// `highestTrackableValue` with the specified number of
+    /// `significantDigits` of precision.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  The behavior is undefined
+    /// unless `highestTrackableValue >= 2` and
+    /// `1 <= significantDigits <= 5`.
+    LatencyHistogram(bsls::Types::Int64 highestTrackableValue,
+                     int                significantDigits,
+                     bslma::Allocator*  basicAllocator = 0);
+
+    /// Create a histogram having the same range, precision and values as
+    /// the specified `original` one.  Optionally specify a `basicAllocator`
+    /// used to supply memory.
+    LatencyHistogram(const LatencyHistogram& original,
+                     bslma::Allocator*       basicAllocator = 0);
+
+    // MANIPULATORS
+
+    /// Assign to this histogram the range, precision and values of the
+    /// specified `rhs` one, and return a reference to this object.
+    LatencyHistogram& operator=(const LatencyHistogram& rhs);
+
+    /// Record the specified `value`.  A negative value is recorded as 0,
+    /// and a value higher than the highest trackable value is recorded as
+    /// the highest trackable value, except for the exact minimum and
+    /// maximum of the histogram.
+    void record(bsls::Types::Int64 value);
+
+    /// Add to this histogram all the values recorded in the specified
+    /// `other` histogram.  The behavior is undefined unless `other` has
+    /// the same range and precision as this histogram.
+    void add(const LatencyHistogram& other);
+
+    /// Discard all the values recorded.
+    void reset();
+
+    // ACCESSORS
+
+    /// Return the number of values recorded.
+    bsls::Types::Int64 count() const;
+
+    /// Return the lowest value recorded, or 0 if the histogram is empty.
+    bsls::Types::Int64 min() const;
+
+    /// Return the highest value recorded, or 0 if the histogram is empty.
+    bsls::Types::Int64 max() const;
+
+    /// Return the mean of the values recorded, or 0 if the histogram is
+    /// empty.
+    double mean() const;
+
+    /// Return the value at the specified `percentile` (in the range
+    /// [0, 100]) of the values recorded, i.e. the highest value equivalent
+    /// to the lowest value that is greater than or equal to `percentile`
+    /// percent of the values recorded, bounded by the maximum value
+    /// recorded.  Return 0 if the histogram is empty.
+    bsls::Types::Int64 valueAtPercentile(double percentile) const;
+
+    /// Load into the specified `percentiles` the percentiles of the values
+    /// recorded.
+    void loadPercentiles(LatencyPercentiles* percentiles) const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ----------------------
+// class LatencyHistogram
+// ----------------------
+
+// ACCESSORS
+inline bsls::Types::Int64 LatencyHistogram::count() const
+{
+    return d_totalCount;
+}
+
+inline bsls::Types::Int64 LatencyHistogram::min() const
+{
+    return d_totalCount == 0 ? 0 : d_min;
+}
+
+inline bsls::Types::Int64 LatencyHistogram::max() const
+{
+    return d_max;
+}
+
+inline double LatencyHistogram::mean() const
+{
+    return d_totalCount == 0 ? 0.0 : d_sum / d_totalCount;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -2174,6 +2174,133 @@ const char* QlistCommandChoice::selectionName() const
     }
 }
 
+// -------------------
+// class SearchCommand
+// -------------------
+
+// CONSTANTS
+
+const char SearchCommand::CLASS_NAME[] = "SearchCommand";
+
+const bdlat_AttributeInfo SearchCommand::ATTRIBUTE_INFO_ARRAY[] = {
+    {ATTRIBUTE_ID_GUID,
+     "guid",
+     sizeof("guid") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_KEY,
+     "key",
+     sizeof("key") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT}};
+
+// CLASS METHODS
+
+const bdlat_AttributeInfo*
+SearchCommand::lookupAttributeInfo(const char* name, int nameLength)
+{
+    for (int i = 0; i < 2; ++i) {
+        const bdlat_AttributeInfo& attributeInfo =
+            SearchCommand::ATTRIBUTE_INFO_ARRAY[i];
+
+        if (nameLength == attributeInfo.d_nameLength &&
+            0 == bsl::memcmp(attributeInfo.d_name_p, name, nameLength)) {
+            return &attributeInfo;
+        }
+    }
+
+    return 0;
+}
+
+const bdlat_AttributeInfo* SearchCommand::lookupAttributeInfo(int id)
+{
+    switch (id) {
+    case ATTRIBUTE_ID_GUID: return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GUID];
+    case ATTRIBUTE_ID_KEY: return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_KEY];
+    default: return 0;
+    }
+}
+
+// CREATORS
+
+SearchCommand::SearchCommand(bslma::Allocator* basicAllocator)
+: d_guid(basicAllocator)
+, d_key(basicAllocator)
+{
+}
+
+SearchCommand::SearchCommand(const SearchCommand& original,
+                             bslma::Allocator*    basicAllocator)
+: d_guid(original.d_guid, basicAllocator)
+, d_key(original.d_key, basicAllocator)
+{
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+SearchCommand::SearchCommand(SearchCommand&& original) noexcept
+: d_guid(bsl::move(original.d_guid)),
+  d_key(bsl::move(original.d_key))
+{
+}
+
+SearchCommand::SearchCommand(SearchCommand&&   original,
+                             bslma::Allocator* basicAllocator)
+: d_guid(bsl::move(original.d_guid), basicAllocator)
+, d_key(bsl::move(original.d_key), basicAllocator)
+{
+}
+#endif
+
+SearchCommand::~SearchCommand()
+{
+}
+
+// MANIPULATORS
+
+SearchCommand& SearchCommand::operator=(const SearchCommand& rhs)
+{
+    if (this != &rhs) {
+        d_guid = rhs.d_guid;
+        d_key = rhs.d_key;
+    }
+
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+SearchCommand& SearchCommand::operator=(SearchCommand&& rhs)
+{
+    if (this != &rhs) {
+        d_guid = bsl::move(rhs.d_guid);
+        d_key = bsl::move(rhs.d_key);
+    }
+
+    return *this;
+}
+#endif
+
+void SearchCommand::reset()
+{
+    bdlat_ValueTypeFunctions::reset(&d_guid);
+    bdlat_ValueTypeFunctions::reset(&d_key);
+}
+
+// ACCESSORS
+
+bsl::ostream& SearchCommand::print(bsl::ostream& stream,
+                                   int           level,
+                                   int           spacesPerLevel) const
+{
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("guid", this->guid());
+    printer.printAttribute("key", this->key());
+    printer.end();
+    return stream;
+}
+
 // ------------------
 // class StartCommand
 // ------------------
@@ -4211,6 +4338,14 @@ const char
     CommandLineParameters::DEFAULT_INITIALIZER_SEQUENTIAL_MESSAGE_PATTERN[] =
         "";
 
+const int CommandLineParameters::DEFAULT_INITIALIZER_PRODUCERS = 1;
+
+const int CommandLineParameters::DEFAULT_INITIALIZER_CONSUMERS = 1;
+
+const bool CommandLineParameters::DEFAULT_INITIALIZER_SHARED_SESSION = false;
+
+const double CommandLineParameters::DEFAULT_INITIALIZER_REPLAY_SPEED = 1.0;
+
 const bdlat_AttributeInfo CommandLineParameters::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_MODE,
      "mode",
@@ -4336,6 +4471,26 @@ const bdlat_AttributeInfo CommandLineParameters::ATTRIBUTE_INFO_ARRAY[] = {
      "subscriptions",
      sizeof("subscriptions") - 1,
      "",
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_PRODUCERS,
+     "producers",
+     sizeof("producers") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_CONSUMERS,
+     "consumers",
+     sizeof("consumers") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_SHARED_SESSION,
+     "sharedSession",
+     sizeof("sharedSession") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_REPLAY_SPEED,
+     "replaySpeed",
+     sizeof("replaySpeed") - 1,
+     "",
      bdlat_FormattingMode::e_DEFAULT}};
 
 // CLASS METHODS
@@ -4343,7 +4498,7 @@ const bdlat_AttributeInfo CommandLineParameters::ATTRIBUTE_INFO_ARRAY[] = {
 const bdlat_AttributeInfo*
 CommandLineParameters::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 25; ++i) {
+    for (int i = 0; i < 29; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             CommandLineParameters::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -4408,6 +4563,14 @@ const bdlat_AttributeInfo* CommandLineParameters::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MESSAGE_PROPERTIES];
     case ATTRIBUTE_ID_SUBSCRIPTIONS:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SUBSCRIPTIONS];
+    case ATTRIBUTE_ID_PRODUCERS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRODUCERS];
+    case ATTRIBUTE_ID_CONSUMERS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSUMERS];
+    case ATTRIBUTE_ID_SHARED_SESSION:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SHARED_SESSION];
+    case ATTRIBUTE_ID_REPLAY_SPEED:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLAY_SPEED];
     default: return 0;
     }
 }
@@ -4431,16 +4594,20 @@ CommandLineParameters::CommandLineParameters(bslma::Allocator* basicAllocator)
 , d_log(DEFAULT_INITIALIZER_LOG, basicAllocator)
 , d_sequentialMessagePattern(DEFAULT_INITIALIZER_SEQUENTIAL_MESSAGE_PATTERN,
                              basicAllocator)
+, d_replaySpeed(DEFAULT_INITIALIZER_REPLAY_SPEED)
 , d_eventSize(DEFAULT_INITIALIZER_EVENT_SIZE)
 , d_msgSize(DEFAULT_INITIALIZER_MSG_SIZE)
 , d_postRate(DEFAULT_INITIALIZER_POST_RATE)
 , d_postInterval(DEFAULT_INITIALIZER_POST_INTERVAL)
 , d_threads(DEFAULT_INITIALIZER_THREADS)
 , d_shutdownGrace(DEFAULT_INITIALIZER_SHUTDOWN_GRACE)
+, d_producers(DEFAULT_INITIALIZER_PRODUCERS)
+, d_consumers(DEFAULT_INITIALIZER_CONSUMERS)
 , d_dumpMsg(DEFAULT_INITIALIZER_DUMP_MSG)
 , d_confirmMsg(DEFAULT_INITIALIZER_CONFIRM_MSG)
 , d_memoryDebug(DEFAULT_INITIALIZER_MEMORY_DEBUG)
 , d_noSessionEventHandler(DEFAULT_INITIALIZER_NO_SESSION_EVENT_HANDLER)
+, d_sharedSession(DEFAULT_INITIALIZER_SHARED_SESSION)
 {
 }
 
@@ -4463,16 +4630,20 @@ CommandLineParameters::CommandLineParameters(
 , d_log(original.d_log, basicAllocator)
 , d_sequentialMessagePattern(original.d_sequentialMessagePattern,
                              basicAllocator)
+, d_replaySpeed(original.d_replaySpeed)
 , d_eventSize(original.d_eventSize)
 , d_msgSize(original.d_msgSize)
 , d_postRate(original.d_postRate)
 , d_postInterval(original.d_postInterval)
 , d_threads(original.d_threads)
 , d_shutdownGrace(original.d_shutdownGrace)
+, d_producers(original.d_producers)
+, d_consumers(original.d_consumers)
 , d_dumpMsg(original.d_dumpMsg)
 , d_confirmMsg(original.d_confirmMsg)
 , d_memoryDebug(original.d_memoryDebug)
 , d_noSessionEventHandler(original.d_noSessionEventHandler)
+, d_sharedSession(original.d_sharedSession)
 {
 }
 
@@ -4495,16 +4666,20 @@ CommandLineParameters::CommandLineParameters(
   d_storage(bsl::move(original.d_storage)),
   d_log(bsl::move(original.d_log)),
   d_sequentialMessagePattern(bsl::move(original.d_sequentialMessagePattern)),
+  d_replaySpeed(bsl::move(original.d_replaySpeed)),
   d_eventSize(bsl::move(original.d_eventSize)),
   d_msgSize(bsl::move(original.d_msgSize)),
   d_postRate(bsl::move(original.d_postRate)),
   d_postInterval(bsl::move(original.d_postInterval)),
   d_threads(bsl::move(original.d_threads)),
   d_shutdownGrace(bsl::move(original.d_shutdownGrace)),
+  d_producers(bsl::move(original.d_producers)),
+  d_consumers(bsl::move(original.d_consumers)),
   d_dumpMsg(bsl::move(original.d_dumpMsg)),
   d_confirmMsg(bsl::move(original.d_confirmMsg)),
   d_memoryDebug(bsl::move(original.d_memoryDebug)),
-  d_noSessionEventHandler(bsl::move(original.d_noSessionEventHandler))
+  d_noSessionEventHandler(bsl::move(original.d_noSessionEventHandler)),
+  d_sharedSession(bsl::move(original.d_sharedSession))
 {
 }
 
@@ -4526,16 +4701,20 @@ CommandLineParameters::CommandLineParameters(CommandLineParameters&& original,
 , d_log(bsl::move(original.d_log), basicAllocator)
 , d_sequentialMessagePattern(bsl::move(original.d_sequentialMessagePattern),
                              basicAllocator)
+, d_replaySpeed(bsl::move(original.d_replaySpeed))
 , d_eventSize(bsl::move(original.d_eventSize))
 , d_msgSize(bsl::move(original.d_msgSize))
 , d_postRate(bsl::move(original.d_postRate))
 , d_postInterval(bsl::move(original.d_postInterval))
 , d_threads(bsl::move(original.d_threads))
 , d_shutdownGrace(bsl::move(original.d_shutdownGrace))
+, d_producers(bsl::move(original.d_producers))
+, d_consumers(bsl::move(original.d_consumers))
 , d_dumpMsg(bsl::move(original.d_dumpMsg))
 , d_confirmMsg(bsl::move(original.d_confirmMsg))
 , d_memoryDebug(bsl::move(original.d_memoryDebug))
 , d_noSessionEventHandler(bsl::move(original.d_noSessionEventHandler))
+, d_sharedSession(bsl::move(original.d_sharedSession))
 {
 }
 #endif
@@ -4575,6 +4754,10 @@ CommandLineParameters::operator=(const CommandLineParameters& rhs)
         d_sequentialMessagePattern = rhs.d_sequentialMessagePattern;
         d_messageProperties        = rhs.d_messageProperties;
         d_subscriptions            = rhs.d_subscriptions;
+        d_producers                = rhs.d_producers;
+        d_consumers                = rhs.d_consumers;
+        d_sharedSession            = rhs.d_sharedSession;
+        d_replaySpeed              = rhs.d_replaySpeed;
     }
 
     return *this;
@@ -4611,6 +4794,10 @@ CommandLineParameters::operator=(CommandLineParameters&& rhs)
         d_sequentialMessagePattern = bsl::move(rhs.d_sequentialMessagePattern);
         d_messageProperties        = bsl::move(rhs.d_messageProperties);
         d_subscriptions            = bsl::move(rhs.d_subscriptions);
+        d_producers                = bsl::move(rhs.d_producers);
+        d_consumers                = bsl::move(rhs.d_consumers);
+        d_sharedSession            = bsl::move(rhs.d_sharedSession);
+        d_replaySpeed              = bsl::move(rhs.d_replaySpeed);
     }
 
     return *this;
@@ -4645,6 +4832,10 @@ void CommandLineParameters::reset()
         DEFAULT_INITIALIZER_SEQUENTIAL_MESSAGE_PATTERN;
     bdlat_ValueTypeFunctions::reset(&d_messageProperties);
     bdlat_ValueTypeFunctions::reset(&d_subscriptions);
+    d_producers     = DEFAULT_INITIALIZER_PRODUCERS;
+    d_consumers     = DEFAULT_INITIALIZER_CONSUMERS;
+    d_sharedSession = DEFAULT_INITIALIZER_SHARED_SESSION;
+    d_replaySpeed   = DEFAULT_INITIALIZER_REPLAY_SPEED;
 }
 
 // ACCESSORS
@@ -4682,6 +4873,10 @@ bsl::ostream& CommandLineParameters::print(bsl::ostream& stream,
                            this->sequentialMessagePattern());
     printer.printAttribute("messageProperties", this->messageProperties());
     printer.printAttribute("subscriptions", this->subscriptions());
+    printer.printAttribute("producers", this->producers());
+    printer.printAttribute("consumers", this->consumers());
+    printer.printAttribute("sharedSession", this->sharedSession());
+    printer.printAttribute("replaySpeed", this->replaySpeed());
     printer.end();
     return stream;
 }
@@ -87,6 +87,9 @@ namespace m_bmqtool {
 class QlistCommandChoice;
 }
 namespace m_bmqtool {
+class SearchCommand;
+}
+namespace m_bmqtool {
 class StartCommand;
 }
 namespace m_bmqtool {
@@ -2504,6 +2507,212 @@ void hashAppend(HASH_ALGORITHM&                      hashAlg,
 
 BDLAT_DECL_CHOICE_WITH_BITWISEMOVEABLE_TRAITS(m_bmqtool::QlistCommandChoice)
 
+// ===================
+// class SearchCommand
+// ===================
+
+class SearchCommand {
+    // INSTANCE DATA
+    bsl::vector<bsl::string> d_guid;
+    bsl::string              d_key;
+
+  public:
+    // TYPES
+    enum { ATTRIBUTE_ID_GUID = 0, ATTRIBUTE_ID_KEY = 1 };
+
+    enum { NUM_ATTRIBUTES = 2 };
+
+    enum { ATTRIBUTE_INDEX_GUID = 0, ATTRIBUTE_INDEX_KEY = 1 };
+
+    // CONSTANTS
+    static const char CLASS_NAME[];
+
+    static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+
+  public:
+    // CLASS METHODS
+
+    /// Return attribute information for the attribute indicated by the
+    /// specified `id` if the attribute exists, and 0 otherwise.
+    static const bdlat_AttributeInfo* lookupAttributeInfo(int id);
+
+    /// Return attribute information for the attribute indicated by the
+    /// specified `name` of the specified `nameLength` if the attribute
+    /// exists, and 0 otherwise.
+    static const bdlat_AttributeInfo* lookupAttributeInfo(const char* name,
+                                                          int nameLength);
+
+    // CREATORS
+
+    /// Create an object of type `SearchCommand` having the default value.
+    /// Use the optionally specified `basicAllocator` to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.
+    explicit SearchCommand(bslma::Allocator* basicAllocator = 0);
+
+    /// Create an object of type `SearchCommand` having the value of the
+    /// specified `original` object.  Use the optionally specified
+    /// `basicAllocator` to supply memory.  If `basicAllocator` is 0, the
+    /// currently installed default allocator is used.
+    SearchCommand(const SearchCommand& original,
+                  bslma::Allocator*    basicAllocator = 0);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+    /// Create an object of type `SearchCommand` having the value of the
+    /// specified `original` object.  After performing this action, the
+    /// `original` object will be left in a valid, but unspecified state.
+    SearchCommand(SearchCommand&& original) noexcept;
+
+    /// Create an object of type `SearchCommand` having the value of the
+    /// specified `original` object.  After performing this action, the
+    /// `original` object will be left in a valid, but unspecified state.
+    /// Use the optionally specified `basicAllocator` to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.
+    SearchCommand(SearchCommand&& original, bslma::Allocator* basicAllocator);
+#endif
+
+    /// Destroy this object.
+    ~SearchCommand();
+
+    // MANIPULATORS
+
+    /// Assign to this object the value of the specified `rhs` object.
+    SearchCommand& operator=(const SearchCommand& rhs);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+    /// Assign to this object the value of the specified `rhs` object.
+    /// After performing this action, the `rhs` object will be left in a
+    /// valid, but unspecified state.
+    SearchCommand& operator=(SearchCommand&& rhs);
+#endif
+
+    /// Reset this object to the default value (i.e., its value upon
+    /// default construction).
+    void reset();
+
+    /// Invoke the specified `manipulator` sequentially on the address of
+    /// each (modifiable) attribute of this object, supplying `manipulator`
+    /// with the corresponding attribute information structure until such
+    /// invocation returns a non-zero value.  Return the value from the
+    /// last invocation of `manipulator` (i.e., the invocation that
+    /// terminated the sequence).
+    template <class MANIPULATOR>
+    int manipulateAttributes(MANIPULATOR& manipulator);
+
+    /// Invoke the specified `manipulator` on the address of
+    /// the (modifiable) attribute indicated by the specified `id`,
+    /// supplying `manipulator` with the corresponding attribute
+    /// information structure.  Return the value returned from the
+    /// invocation of `manipulator` if `id` identifies an attribute of this
+    /// class, and -1 otherwise.
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR& manipulator, int id);
+
+    /// Invoke the specified `manipulator` on the address of
+    /// the (modifiable) attribute indicated by the specified `name` of the
+    /// specified `nameLength`, supplying `manipulator` with the
+    /// corresponding attribute information structure.  Return the value
+    /// returned from the invocation of `manipulator` if `name` identifies
+    /// an attribute of this class, and -1 otherwise.
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR& manipulator,
+                            const char*  name,
+                            int          nameLength);
+
+    /// Return a reference to the modifiable "Guid" attribute of this object.
+    bsl::vector<bsl::string>& guid();
+
+    /// Return a reference to the modifiable "Key" attribute of this object.
+    bsl::string& key();
+
+    // ACCESSORS
+
+    /// Format this object to the specified output `stream` at the
+    /// optionally specified indentation `level` and return a reference to
+    /// the modifiable `stream`.  If `level` is specified, optionally
+    /// specify `spacesPerLevel`, the number of spaces per indentation level
+    /// for this and all of its nested objects.  Each line is indented by
+    /// the absolute value of `level * spacesPerLevel`.  If `level` is
+    /// negative, suppress indentation of the first line.  If
+    /// `spacesPerLevel` is negative, suppress line breaks and format the
+    /// entire output on one line.  If `stream` is initially invalid, this
+    /// operation has no effect.  Note that a trailing newline is provided
+    /// in multiline mode only.
+    bsl::ostream&
+    print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
+
+    /// Invoke the specified `accessor` sequentially on each
+    /// (non-modifiable) attribute of this object, supplying `accessor`
+    /// with the corresponding attribute information structure until such
+    /// invocation returns a non-zero value.  Return the value from the
+    /// last invocation of `accessor` (i.e., the invocation that terminated
+    /// the sequence).
+    template <class ACCESSOR>
+    int accessAttributes(ACCESSOR& accessor) const;
+
+    /// Invoke the specified `accessor` on the (non-modifiable) attribute
+    /// of this object indicated by the specified `id`, supplying `accessor`
+    /// with the corresponding attribute information structure.  Return the
+    /// value returned from the invocation of `accessor` if `id` identifies
+    /// an attribute of this class, and -1 otherwise.
+    template <class ACCESSOR>
+    int accessAttribute(ACCESSOR& accessor, int id) const;
+
+    /// Invoke the specified `accessor` on the (non-modifiable) attribute
+    /// of this object indicated by the specified `name` of the specified
+    /// `nameLength`, supplying `accessor` with the corresponding attribute
+    /// information structure.  Return the value returned from the
+    /// invocation of `accessor` if `name` identifies an attribute of this
+    /// class, and -1 otherwise.
+    template <class ACCESSOR>
+    int accessAttribute(ACCESSOR&   accessor,
+                        const char* name,
+                        int         nameLength) const;
+
+    /// Return a reference to the non-modifiable "Guid" attribute of this
+    /// object.
+    const bsl::vector<bsl::string>& guid() const;
+
+    /// Return a reference to the non-modifiable "Key" attribute of this
+    /// object.
+    const bsl::string& key() const;
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified `lhs` and `rhs` attribute objects have
+/// the same value, and `false` otherwise.  Two attribute objects have the
+/// same value if each respective attribute has the same value.
+inline bool operator==(const SearchCommand& lhs, const SearchCommand& rhs);
+
+/// Return `true` if the specified `lhs` and `rhs` attribute objects do not
+/// have the same value, and `false` otherwise.  Two attribute objects do
+/// not have the same value if one or more respective attributes differ in
+/// values.
+inline bool operator!=(const SearchCommand& lhs, const SearchCommand& rhs);
+
+/// Format the specified `rhs` to the specified output `stream` and
+/// return a reference to the modifiable `stream`.
+inline bsl::ostream& operator<<(bsl::ostream&        stream,
+                                const SearchCommand& rhs);
+
+/// Pass the specified `object` to the specified `hashAlg`.  This function
+/// integrates with the `bslh` modular hashing system and effectively
+/// provides a `bsl::hash` specialization for `SearchCommand`.
+template <typename HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM&                 hashAlg,
+                const m_bmqtool::SearchCommand& object);
+
+}  // close package namespace
+
+// TRAITS
+
+BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(
+    m_bmqtool::SearchCommand)
+
 namespace m_bmqtool {
 
 // ==================
@@ -4715,16 +4924,20 @@ class CommandLineParameters {
     bsl::string                  d_storage;
     bsl::string                  d_log;
     bsl::string                  d_sequentialMessagePattern;
+    double                       d_replaySpeed;
     int                          d_eventSize;
     int                          d_msgSize;
     int                          d_postRate;
     int                          d_postInterval;
     int                          d_threads;
     int                          d_shutdownGrace;
+    int                          d_producers;
+    int                          d_consumers;
     bool                         d_dumpMsg;
     bool                         d_confirmMsg;
     bool                         d_memoryDebug;
     bool                         d_noSessionEventHandler;
+    bool                         d_sharedSession;
 
   public:
     // TYPES
@@ -4753,10 +4966,14 @@ class CommandLineParameters {
         ATTRIBUTE_ID_LOG                        = 21,
         ATTRIBUTE_ID_SEQUENTIAL_MESSAGE_PATTERN = 22,
         ATTRIBUTE_ID_MESSAGE_PROPERTIES         = 23,
-        ATTRIBUTE_ID_SUBSCRIPTIONS              = 24
+        ATTRIBUTE_ID_SUBSCRIPTIONS              = 24,
+        ATTRIBUTE_ID_PRODUCERS                  = 25,
+        ATTRIBUTE_ID_CONSUMERS                  = 26,
+        ATTRIBUTE_ID_SHARED_SESSION             = 27,
+        ATTRIBUTE_ID_REPLAY_SPEED               = 28
     };
 
-    enum { NUM_ATTRIBUTES = 25 };
+    enum { NUM_ATTRIBUTES = 29 };
 
     enum {
         ATTRIBUTE_INDEX_MODE                       = 0,
@@ -4783,7 +5000,11 @@ class CommandLineParameters {
         ATTRIBUTE_INDEX_LOG                        = 21,
         ATTRIBUTE_INDEX_SEQUENTIAL_MESSAGE_PATTERN = 22,
         ATTRIBUTE_INDEX_MESSAGE_PROPERTIES         = 23,
-        ATTRIBUTE_INDEX_SUBSCRIPTIONS              = 24
+        ATTRIBUTE_INDEX_SUBSCRIPTIONS              = 24,
+        ATTRIBUTE_INDEX_PRODUCERS                  = 25,
+        ATTRIBUTE_INDEX_CONSUMERS                  = 26,
+        ATTRIBUTE_INDEX_SHARED_SESSION             = 27,
+        ATTRIBUTE_INDEX_REPLAY_SPEED               = 28
     };
 
     // CONSTANTS
@@ -4835,6 +5056,14 @@ class CommandLineParameters {
 
     static const char DEFAULT_INITIALIZER_SEQUENTIAL_MESSAGE_PATTERN[];
 
+    static const int DEFAULT_INITIALIZER_PRODUCERS;
+
+    static const int DEFAULT_INITIALIZER_CONSUMERS;
+
+    static const bool DEFAULT_INITIALIZER_SHARED_SESSION;
+
+    static const double DEFAULT_INITIALIZER_REPLAY_SPEED;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -5030,6 +5259,22 @@ class CommandLineParameters {
     /// this object.
     bsl::vector<Subscription>& subscriptions();
 
+    /// Return a reference to the modifiable "Producers" attribute of this
+    /// object.
+    int& producers();
+
+    /// Return a reference to the modifiable "Consumers" attribute of this
+    /// object.
+    int& consumers();
+
+    /// Return a reference to the modifiable "SharedSession" attribute of
+    /// this object.
+    bool& sharedSession();
+
+    /// Return a reference to the modifiable "ReplaySpeed" attribute of this
+    /// object.
+    double& replaySpeed();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -5173,6 +5418,22 @@ class CommandLineParameters {
     /// Return a reference to the non-modifiable "Subscriptions" attribute
     /// of this object.
     const bsl::vector<Subscription>& subscriptions() const;
+
+    /// Return a reference to the non-modifiable "Producers" attribute of
+    /// this object.
+    int producers() const;
+
+    /// Return a reference to the non-modifiable "Consumers" attribute of
+    /// this object.
+    int consumers() const;
+
+    /// Return a reference to the non-modifiable "SharedSession" attribute
+    /// of this object.
+    bool sharedSession() const;
+
+    /// Return a reference to the non-modifiable "ReplaySpeed" attribute of
+    /// this object.
+    double replaySpeed() const;
 };
 
 // FREE OPERATORS
@@ -7734,6 +7995,145 @@ void hashAppend(HASH_ALGORITHM&                      hashAlg,
     }
 }
 
+// -------------------
+// class SearchCommand
+// -------------------
+
+// CLASS METHODS
+// MANIPULATORS
+template <class MANIPULATOR>
+int SearchCommand::manipulateAttributes(MANIPULATOR& manipulator)
+{
+    int ret;
+
+    ret = manipulator(&d_guid, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GUID]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_key, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_KEY]);
+    if (ret) {
+        return ret;
+    }
+
+    return ret;
+}
+
+template <class MANIPULATOR>
+int SearchCommand::manipulateAttribute(MANIPULATOR& manipulator, int id)
+{
+    enum { NOT_FOUND = -1 };
+
+    switch (id) {
+    case ATTRIBUTE_ID_GUID: {
+        return manipulator(&d_guid,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GUID]);
+    }
+    case ATTRIBUTE_ID_KEY: {
+        return manipulator(&d_key, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_KEY]);
+    }
+    default: return NOT_FOUND;
+    }
+}
+
+template <class MANIPULATOR>
+int SearchCommand::manipulateAttribute(MANIPULATOR& manipulator,
+                                       const char*  name,
+                                       int          nameLength)
+{
+    enum { NOT_FOUND = -1 };
+
+    const bdlat_AttributeInfo* attributeInfo = lookupAttributeInfo(name,
+                                                                   nameLength);
+    if (0 == attributeInfo) {
+        return NOT_FOUND;
+    }
+
+    return manipulateAttribute(manipulator, attributeInfo->d_id);
+}
+
+inline bsl::vector<bsl::string>& SearchCommand::guid()
+{
+    return d_guid;
+}
+
+inline bsl::string& SearchCommand::key()
+{
+    return d_key;
+}
+
+// ACCESSORS
+template <class ACCESSOR>
+int SearchCommand::accessAttributes(ACCESSOR& accessor) const
+{
+    int ret;
+
+    ret = accessor(d_guid, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GUID]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_key, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_KEY]);
+    if (ret) {
+        return ret;
+    }
+
+    return ret;
+}
+
+template <class ACCESSOR>
+int SearchCommand::accessAttribute(ACCESSOR& accessor, int id) const
+{
+    enum { NOT_FOUND = -1 };
+
+    switch (id) {
+    case ATTRIBUTE_ID_GUID: {
+        return accessor(d_guid, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GUID]);
+    }
+    case ATTRIBUTE_ID_KEY: {
+        return accessor(d_key, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_KEY]);
+    }
+    default: return NOT_FOUND;
+    }
+}
+
+template <class ACCESSOR>
+int SearchCommand::accessAttribute(ACCESSOR&   accessor,
+                                   const char* name,
+                                   int         nameLength) const
+{
+    enum { NOT_FOUND = -1 };
+
+    const bdlat_AttributeInfo* attributeInfo = lookupAttributeInfo(name,
+                                                                   nameLength);
+    if (0 == attributeInfo) {
+        return NOT_FOUND;
+    }
+
+    return accessAttribute(accessor, attributeInfo->d_id);
+}
+
+inline const bsl::vector<bsl::string>& SearchCommand::guid() const
+{
+    return d_guid;
+}
+
+inline const bsl::string& SearchCommand::key() const
+{
+    return d_key;
+}
+
+template <typename HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM&                 hashAlg,
+                const m_bmqtool::SearchCommand& object)
+{
+    (void)hashAlg;
+    (void)object;
+    using bslh::hashAppend;
+    hashAppend(hashAlg, object.guid());
+    hashAppend(hashAlg, object.key());
+}
+
 // ------------------
 // class StartCommand
 // ------------------
@@ -9640,6 +10040,30 @@ int CommandLineParameters::manipulateAttributes(MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_producers,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRODUCERS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_consumers,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSUMERS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_sharedSession,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SHARED_SESSION]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_replaySpeed,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLAY_SPEED]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -9757,6 +10181,23 @@ int CommandLineParameters::manipulateAttribute(MANIPULATOR& manipulator,
             &d_subscriptions,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SUBSCRIPTIONS]);
     }
+    case ATTRIBUTE_ID_PRODUCERS: {
+        return manipulator(&d_producers,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRODUCERS]);
+    }
+    case ATTRIBUTE_ID_CONSUMERS: {
+        return manipulator(&d_consumers,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSUMERS]);
+    }
+    case ATTRIBUTE_ID_SHARED_SESSION: {
+        return manipulator(
+            &d_sharedSession,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SHARED_SESSION]);
+    }
+    case ATTRIBUTE_ID_REPLAY_SPEED: {
+        return manipulator(&d_replaySpeed,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLAY_SPEED]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -9902,6 +10343,26 @@ inline bsl::vector<Subscription>& CommandLineParameters::subscriptions()
     return d_subscriptions;
 }
 
+inline int& CommandLineParameters::producers()
+{
+    return d_producers;
+}
+
+inline int& CommandLineParameters::consumers()
+{
+    return d_consumers;
+}
+
+inline bool& CommandLineParameters::sharedSession()
+{
+    return d_sharedSession;
+}
+
+inline double& CommandLineParameters::replaySpeed()
+{
+    return d_replaySpeed;
+}
+
 // ACCESSORS
 template <class ACCESSOR>
 int CommandLineParameters::accessAttributes(ACCESSOR& accessor) const
@@ -10052,6 +10513,30 @@ int CommandLineParameters::accessAttributes(ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_producers,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRODUCERS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_consumers,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSUMERS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_sharedSession,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SHARED_SESSION]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_replaySpeed,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLAY_SPEED]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -10162,6 +10647,22 @@ int CommandLineParameters::accessAttribute(ACCESSOR& accessor, int id) const
         return accessor(d_subscriptions,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SUBSCRIPTIONS]);
     }
+    case ATTRIBUTE_ID_PRODUCERS: {
+        return accessor(d_producers,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRODUCERS]);
+    }
+    case ATTRIBUTE_ID_CONSUMERS: {
+        return accessor(d_consumers,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSUMERS]);
+    }
+    case ATTRIBUTE_ID_SHARED_SESSION: {
+        return accessor(d_sharedSession,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SHARED_SESSION]);
+    }
+    case ATTRIBUTE_ID_REPLAY_SPEED: {
+        return accessor(d_replaySpeed,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLAY_SPEED]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -10310,6 +10811,26 @@ CommandLineParameters::subscriptions() const
     return d_subscriptions;
 }
 
+inline int CommandLineParameters::producers() const
+{
+    return d_producers;
+}
+
+inline int CommandLineParameters::consumers() const
+{
+    return d_consumers;
+}
+
+inline bool CommandLineParameters::sharedSession() const
+{
+    return d_sharedSession;
+}
+
+inline double CommandLineParameters::replaySpeed() const
+{
+    return d_replaySpeed;
+}
+
 template <typename HASH_ALGORITHM>
 void hashAppend(HASH_ALGORITHM&                         hashAlg,
                 const m_bmqtool::CommandLineParameters& object)
@@ -10342,6 +10863,10 @@ void hashAppend(HASH_ALGORITHM&                         hashAlg,
     hashAppend(hashAlg, object.sequentialMessagePattern());
     hashAppend(hashAlg, object.messageProperties());
     hashAppend(hashAlg, object.subscriptions());
+    hashAppend(hashAlg, object.producers());
+    hashAppend(hashAlg, object.consumers());
+    hashAppend(hashAlg, object.sharedSession());
+    hashAppend(hashAlg, object.replaySpeed());
 }
 
 // --------------------
@@ -11432,6 +11957,25 @@ m_bmqtool::operator<<(bsl::ostream&                        stream,
     return rhs.print(stream, 0, -1);
 }
 
+inline bool m_bmqtool::operator==(const m_bmqtool::SearchCommand& lhs,
+                                  const m_bmqtool::SearchCommand& rhs)
+{
+    return lhs.guid() == rhs.guid() && lhs.key() == rhs.key();
+}
+
+inline bool m_bmqtool::operator!=(const m_bmqtool::SearchCommand& lhs,
+                                  const m_bmqtool::SearchCommand& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline bsl::ostream&
+m_bmqtool::operator<<(bsl::ostream&                   stream,
+                      const m_bmqtool::SearchCommand& rhs)
+{
+    return rhs.print(stream, 0, -1);
+}
+
 inline bool m_bmqtool::operator==(const m_bmqtool::StartCommand& lhs,
                                   const m_bmqtool::StartCommand& rhs)
 {
@@ -11657,7 +12201,11 @@ inline bool m_bmqtool::operator==(const m_bmqtool::CommandLineParameters& lhs,
            lhs.storage() == rhs.storage() && lhs.log() == rhs.log() &&
            lhs.sequentialMessagePattern() == rhs.sequentialMessagePattern() &&
            lhs.messageProperties() == rhs.messageProperties() &&
-           lhs.subscriptions() == rhs.subscriptions();
+           lhs.subscriptions() == rhs.subscriptions() &&
+           lhs.producers() == rhs.producers() &&
+           lhs.consumers() == rhs.consumers() &&
+           lhs.sharedSession() == rhs.sharedSession() &&
+           lhs.replaySpeed() == rhs.replaySpeed();
 }
 
 inline bool m_bmqtool::operator!=(const m_bmqtool::CommandLineParameters& lhs,
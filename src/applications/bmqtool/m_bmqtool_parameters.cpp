@@ -140,7 +140,9 @@ const char* ParametersMode::toAscii(ParametersMode::Value value)
         CASE(CLI)
         CASE(AUTO)
         CASE(STORAGE)
-        CASE(SYSCHK);
+        CASE(SYSCHK)
+        CASE(LOAD)
+        CASE(REPLAY)
     default: return "(* UNKNOWN *)";
     }
 
@@ -161,6 +163,8 @@ bool ParametersMode::fromAscii(ParametersMode::Value*   out,
     CHECKVALUE(AUTO);
     CHECKVALUE(STORAGE);
     CHECKVALUE(SYSCHK);
+    CHECKVALUE(LOAD);
+    CHECKVALUE(REPLAY);
 
     // Invalid string
     return false;
@@ -175,7 +179,8 @@ bool ParametersMode::isValid(const bsl::string* str, bsl::ostream& stream)
         return true;  // RETURN
     }
 
-    stream << "Error: mode parameter must be one of [cli, auto, syschk]\n";
+    stream << "Error: mode parameter must be one of "
+           << "[cli, auto, storage, syschk, load, replay]\n";
     return false;
 }
 
@@ -302,6 +307,10 @@ Parameters::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("numProcessingThreads", numProcessingThreads());
     printer.printAttribute("shutdownGrace", shutdownGrace());
     printer.printAttribute("noSessionEventHandler", noSessionEventHandler());
+    printer.printAttribute("numProducers", numProducers());
+    printer.printAttribute("numConsumers", numConsumers());
+    printer.printAttribute("sharedSession", sharedSession());
+    printer.printAttribute("replaySpeed", replaySpeed());
     printer.printAttribute("sequentialMessagePattern",
                            d_sequentialMessagePattern);
     printer.printAttribute("messageProperties", d_messageProperties);
@@ -401,6 +410,10 @@ bool Parameters::from(bsl::ostream&                stream,
     setLogFilePath(params.log());
     setSequentialMessagePattern(params.sequentialMessagePattern());
     setShutdownGrace(params.shutdownGrace());
+    setNumProducers(params.producers());
+    setNumConsumers(params.consumers());
+    setSharedSession(params.sharedSession());
+    setReplaySpeed(params.replaySpeed());
     setMessageProperties(params.messageProperties());
     setSubscriptions(params.subscriptions());
 
@@ -418,21 +431,50 @@ bool Parameters::validate(bsl::string* error)
 
     if (d_queueFlags == 0 && d_mode != ParametersMode::e_CLI &&
         d_mode != ParametersMode::e_STORAGE &&
-        d_mode != ParametersMode::e_SYSCHK) {
-        ss << "QueueFlags must be specified if not in interactive, storage or "
-           << "syschk mode\n";
+        d_mode != ParametersMode::e_SYSCHK &&
+        d_mode != ParametersMode::e_LOAD &&
+        d_mode != ParametersMode::e_REPLAY) {
+        ss << "QueueFlags must be specified if not in interactive, storage, "
+           << "syschk, load or replay mode\n";
     }
     if (d_queueUri.empty() && d_mode != ParametersMode::e_CLI &&
         d_mode != ParametersMode::e_STORAGE &&
-        d_mode != ParametersMode::e_SYSCHK) {
-        ss << "QueueURI must be specified if not in interactive, storage or "
-           << "syschk mode\n";
+        d_mode != ParametersMode::e_SYSCHK &&
+        d_mode != ParametersMode::e_REPLAY) {
+        ss << "QueueURI must be specified if not in interactive, storage, "
+           << "syschk or replay mode\n";
     }
     if (d_noSessionEventHandler && d_mode != ParametersMode::e_CLI &&
         d_mode != ParametersMode::e_STORAGE) {
         ss << "NoSessionEventHandler is only to use in interactive or storage "
            << "mode\n";
     }
+    if (d_mode == ParametersMode::e_LOAD) {
+        if (d_numProducers < 1 || d_numConsumers < 1) {
+            ss << "Load mode requires at least one producer and one "
+               << "consumer\n";
+        }
+        if (d_postInterval <= 0 || d_postRate <= 0 || d_eventSize <= 0) {
+            ss << "Load mode requires a strictly positive postInterval, "
+               << "postRate and eventSize\n";
+        }
+        if (!d_sequentialMessagePattern.empty()) {
+            ss << "Load mode does not support a sequential message pattern\n";
+        }
+    }
+    if (d_mode == ParametersMode::e_REPLAY) {
+        if (d_journalFilePath.empty() || d_dataFilePath.empty() ||
+            d_qlistFilePath.empty()) {
+            ss << "Replay mode requires the journal, data and qlist files of "
+               << "a storage (e.g. '--storage /path/to/bmq_0.<timestamp>*')\n";
+        }
+        if (d_replaySpeed < 0) {
+            ss << "Replay mode requires a positive or null replaySpeed\n";
+        }
+        if (d_eventSize <= 0) {
+            ss << "Replay mode requires a strictly positive eventSize\n";
+        }
+    }
 
     error->assign(ss.str().data(), ss.str().length());
     return error->empty();
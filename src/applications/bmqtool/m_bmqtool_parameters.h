@@ -99,6 +99,10 @@ struct ParametersMode {
         e_STORAGE  // Inspect storage
         ,
         e_SYSCHK  // Run in syschk mode
+        ,
+        e_LOAD  // Open-loop load generation mode
+        ,
+        e_REPLAY  // Replay the messages of a storage
     };
 
     // CLASS METHODS
@@ -264,6 +268,28 @@ class Parameters {
     // Should we use a testAllocator
     // Default: false
 
+    int d_numProducers;
+    // Number of producer threads, in load
+    // mode.
+    // Default: 1
+
+    int d_numConsumers;
+    // Number of consumers, in load mode.
+    // Default: 1
+
+    bool d_sharedSession;
+    // True if all producers and consumers
+    // share one session in load mode, false
+    // if each one uses its own session.
+    // Default: false
+
+    double d_replaySpeed;
+    // Speed factor of the replay, in replay
+    // mode, relative to the original speed
+    // of the messages, or 0 to replay them
+    // as fast as possible.
+    // Default: 1.0
+
     bsl::vector<MessageProperty> d_messageProperties;
 
     bsl::vector<Subscription> d_subscriptions;
@@ -299,6 +325,10 @@ class Parameters {
     Parameters& setLogFilePath(const bsl::string& value);
     Parameters& setSequentialMessagePattern(const bsl::string& value);
     Parameters& setShutdownGrace(int value);
+    Parameters& setNumProducers(int value);
+    Parameters& setNumConsumers(int value);
+    Parameters& setSharedSession(bool value);
+    Parameters& setReplaySpeed(double value);
     Parameters&
     setMessageProperties(const bsl::vector<MessageProperty>& value);
     Parameters& setSubscriptions(const bsl::vector<Subscription>& value);
@@ -357,6 +387,10 @@ class Parameters {
     int                                 numProcessingThreads() const;
     int                                 shutdownGrace() const;
     bool                                noSessionEventHandler() const;
+    int                                 numProducers() const;
+    int                                 numConsumers() const;
+    bool                                sharedSession() const;
+    double                              replaySpeed() const;
     const bsl::vector<MessageProperty>& messageProperties() const;
 
     /// Return the corresponding data member value.
@@ -501,6 +535,30 @@ inline Parameters& Parameters::setNoSessionEventHandler(bool value)
     return *this;
 }
 
+inline Parameters& Parameters::setNumProducers(int value)
+{
+    d_numProducers = value;
+    return *this;
+}
+
+inline Parameters& Parameters::setNumConsumers(int value)
+{
+    d_numConsumers = value;
+    return *this;
+}
+
+inline Parameters& Parameters::setSharedSession(bool value)
+{
+    d_sharedSession = value;
+    return *this;
+}
+
+inline Parameters& Parameters::setReplaySpeed(double value)
+{
+    d_replaySpeed = value;
+    return *this;
+}
+
 inline Parameters& Parameters::setStoragePath(const bsl::string& value)
 {
     bsl::string dataExt(mqbs::FileStoreProtocol::k_DATA_FILE_EXTENSION);
@@ -694,6 +752,26 @@ inline bool Parameters::noSessionEventHandler() const
     return d_noSessionEventHandler;
 }
 
+inline int Parameters::numProducers() const
+{
+    return d_numProducers;
+}
+
+inline int Parameters::numConsumers() const
+{
+    return d_numConsumers;
+}
+
+inline bool Parameters::sharedSession() const
+{
+    return d_sharedSession;
+}
+
+inline double Parameters::replaySpeed() const
+{
+    return d_replaySpeed;
+}
+
 inline const bsl::vector<MessageProperty>&
 Parameters::messageProperties() const
 {
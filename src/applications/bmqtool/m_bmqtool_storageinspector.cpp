@@ -29,6 +29,7 @@
 #include <bmqp_messageproperties.h>
 #include <bmqp_optionsview.h>
 #include <bmqp_protocol.h>
+#include <bmqt_messageguid.h>
 
 // MWC
 #include <mwcu_alignedprinter.h>
@@ -40,12 +41,16 @@
 #include <ball_log.h>
 #include <bdlb_print.h>
 #include <bdlbb_blob.h>
+#include <bdlf_bind.h>
 #include <bdls_filesystemutil.h>
 #include <bdlt_datetime.h>
 #include <bdlt_epochutil.h>
 #include <bsl_algorithm.h>
+#include <bsl_unordered_set.h>
+#include <bslh_hash.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
+#include <bslmt_threadutil.h>
 #include <bsls_annotation.h>
 
 namespace BloombergLP {
@@ -252,6 +257,220 @@ void iterateNextPosition(CHOICE&                     choice,
     }
 }
 
+/// Maximum number of threads used to scan a journal file.
+const int k_MAX_SCAN_THREADS = 8;
+
+/// Minimum number of journal records handed to a scanning thread, so that
+/// small journals are not split across more threads than is worthwhile.
+const bsls::Types::Uint64 k_MIN_RECORDS_PER_SCAN_THREAD = 64 * 1024;
+
+/// Number of distinct `mqbs::RecordType` values.
+const int k_NUM_RECORD_TYPES = mqbs::RecordType::e_JOURNAL_OP + 1;
+
+typedef bsl::unordered_set<bmqt::MessageGUID,
+                           bslh::Hash<bmqt::MessageGUIDHashAlgo> >
+    GuidSet;
+
+/// Criteria used to select journal records during a scan.  A record is
+/// selected if its GUID is in `d_guids_p` (unless that set is empty) and
+/// its queue key is `d_queueKey` (unless that key is null).  If neither
+/// criterion is set, no record is selected and the scan only counts.
+struct JournalScanFilter {
+    // DATA
+    const GuidSet*   d_guids_p;
+    mqbu::StorageKey d_queueKey;
+
+    // ACCESSORS
+    bool isActive() const
+    {
+        return !d_guids_p->empty() || !d_queueKey.isNull();
+    }
+};
+
+/// Outcome of scanning all or part of a journal file.
+struct JournalScanResult {
+    // DATA
+
+    /// Offsets of the selected records, in increasing order.
+    bsl::vector<bsls::Types::Uint64> d_matches;
+
+    /// Number of scanned records of each type, indexed by `RecordType`.
+    bsls::Types::Uint64 d_counts[k_NUM_RECORD_TYPES];
+
+    // CREATORS
+    JournalScanResult()
+    : d_matches()
+    {
+        bsl::fill(d_counts, d_counts + k_NUM_RECORD_TYPES, 0);
+    }
+};
+
+/// Return true if the record of the specified `type` located at the
+/// specified `offset` in the specified `mfd` is selected by the specified
+/// `filter`, and false otherwise.
+bool isSelected(const mqbs::MappedFileDescriptor& mfd,
+                bsls::Types::Uint64               offset,
+                mqbs::RecordType::Enum            type,
+                const JournalScanFilter&          filter)
+{
+    const bmqt::MessageGUID* guid = 0;
+    const mqbu::StorageKey*  key  = 0;
+
+    switch (type) {
+    case mqbs::RecordType::e_MESSAGE: {
+        mqbs::OffsetPtr<const mqbs::MessageRecord> rec(mfd.block(), offset);
+        guid = &rec->messageGUID();
+        key  = &rec->queueKey();
+    } break;
+    case mqbs::RecordType::e_CONFIRM: {
+        mqbs::OffsetPtr<const mqbs::ConfirmRecord> rec(mfd.block(), offset);
+        guid = &rec->messageGUID();
+        key  = &rec->queueKey();
+    } break;
+    case mqbs::RecordType::e_DELETION: {
+        mqbs::OffsetPtr<const mqbs::DeletionRecord> rec(mfd.block(), offset);
+        guid = &rec->messageGUID();
+        key  = &rec->queueKey();
+    } break;
+    case mqbs::RecordType::e_QUEUE_OP: {
+        mqbs::OffsetPtr<const mqbs::QueueOpRecord> rec(mfd.block(), offset);
+        key = &rec->queueKey();
+    } break;
+    case mqbs::RecordType::e_JOURNAL_OP:
+    case mqbs::RecordType::e_UNDEFINED:
+    default: return false;  // RETURN
+    }
+
+    if (!filter.d_guids_p->empty() &&
+        (0 == guid || 0 == filter.d_guids_p->count(*guid))) {
+        return false;  // RETURN
+    }
+
+    return filter.d_queueKey.isNull() || *key == filter.d_queueKey;
+}
+
+/// Scan the records of the specified `recordSize` located in the specified
+/// `mfd` in the range `[beginOffset, endOffset)`, and load into the
+/// specified `result` the number of records of each type and the offsets of
+/// the records selected by the specified `filter`.
+void scanJournalChunk(JournalScanResult*                result,
+                      const mqbs::MappedFileDescriptor* mfd,
+                      bsls::Types::Uint64               beginOffset,
+                      bsls::Types::Uint64               endOffset,
+                      unsigned int                      recordSize,
+                      const JournalScanFilter*          filter)
+{
+    const bool isActive = filter->isActive();
+
+    for (bsls::Types::Uint64 offset = beginOffset; offset < endOffset;
+         offset += recordSize) {
+        mqbs::OffsetPtr<const mqbs::RecordHeader> header(mfd->block(),
+                                                         offset);
+        mqbs::RecordType::Enum type = header->type();
+        if (type >= k_NUM_RECORD_TYPES) {
+            type = mqbs::RecordType::e_UNDEFINED;
+        }
+
+        ++result->d_counts[type];
+
+        if (isActive && isSelected(*mfd, offset, type, *filter)) {
+            result->d_matches.push_back(offset);
+        }
+    }
+}
+
+/// Scan all valid records of the journal file associated with the
+/// specified `iter`, and load into the specified `result` the number of
+/// records of each type and the offsets, in file order, of the records
+/// selected by the specified `filter`.  Journal records have a fixed size,
+/// so the mapped journal is split at record boundaries into contiguous
+/// chunks which are scanned concurrently, and the per-chunk results are
+/// merged.  The behavior is undefined unless `iter` is valid.
+void scanJournal(JournalScanResult*               result,
+                 const mqbs::JournalFileIterator& iter,
+                 const JournalScanFilter&         filter)
+{
+    typedef bsls::Types::Uint64 Uint64;
+
+    const Uint64 firstRecordPos = iter.firstRecordPosition();
+    const Uint64 lastRecordPos  = iter.lastRecordPosition();
+    if (0 == firstRecordPos || 0 == lastRecordPos) {
+        // No valid record
+
+        return;  // RETURN
+    }
+
+    const unsigned int recordSize = iter.header().recordWords() *
+                                    bmqp::Protocol::k_WORD_SIZE;
+    const Uint64       endPos     = lastRecordPos + recordSize;
+    const Uint64       numRecords = (endPos - firstRecordPos) / recordSize;
+
+    // Split the records evenly across at most 'k_MAX_SCAN_THREADS' chunks of
+    // at least 'k_MIN_RECORDS_PER_SCAN_THREAD' records each (except the
+    // last one).
+
+    const Uint64 maxChunks = 1 + (numRecords - 1) /
+                                     k_MIN_RECORDS_PER_SCAN_THREAD;
+    const int    numChunks = static_cast<int>(
+        bsl::min(static_cast<Uint64>(k_MAX_SCAN_THREADS), maxChunks));
+    const Uint64 chunkSize = (numRecords + numChunks - 1) / numChunks *
+                             recordSize;
+
+    const mqbs::MappedFileDescriptor*      mfd = iter.mappedFileDescriptor();
+    bsl::vector<JournalScanResult>         chunkResults(numChunks);
+    bsl::vector<bslmt::ThreadUtil::Handle> threads;
+    threads.reserve(numChunks);
+
+    for (int i = 0; i < numChunks; ++i) {
+        const Uint64 begin = firstRecordPos + i * chunkSize;
+        const Uint64 end   = bsl::min(endPos, begin + chunkSize);
+
+        if (i != numChunks - 1) {
+            bslmt::ThreadUtil::Handle handle;
+            int rc = bslmt::ThreadUtil::create(
+                &handle,
+                bdlf::BindUtil::bind(&scanJournalChunk,
+                                     &chunkResults[i],
+                                     mfd,
+                                     begin,
+                                     end,
+                                     recordSize,
+                                     &filter));
+            if (0 == rc) {
+                threads.push_back(handle);
+                continue;  // CONTINUE
+            }
+
+            BALL_LOG_WARN << "Failed to create scanning thread, rc: " << rc
+                          << ".  Scanning chunk #" << i
+                          << " in current thread.";
+        }
+
+        // Last chunk (or thread creation failure): scan in current thread.
+        scanJournalChunk(&chunkResults[i],
+                         mfd,
+                         begin,
+                         end,
+                         recordSize,
+                         &filter);
+    }
+
+    for (size_t i = 0; i < threads.size(); ++i) {
+        bslmt::ThreadUtil::join(threads[i]);
+    }
+
+    // Merge results in file order
+    for (int i = 0; i < numChunks; ++i) {
+        const JournalScanResult& chunk = chunkResults[i];
+        result->d_matches.insert(result->d_matches.end(),
+                                 chunk.d_matches.begin(),
+                                 chunk.d_matches.end());
+        for (int type = 0; type < k_NUM_RECORD_TYPES; ++type) {
+            result->d_counts[type] += chunk.d_counts[type];
+        }
+    }
+}
+
 }  // close unnamed namespace
 
 // ----------------------
@@ -268,6 +487,7 @@ void StorageInspector::printHelp() const
                   << "  metadata" << bsl::endl
                   << "  dump uri=\"\" (deleted=false) (messages=false)"
                   << bsl::endl
+                  << "  search guid=[\"\"] (key=\"\")" << bsl::endl
                   << "  help" << bsl::endl
                   << "  quit" << bsl::endl
                   << "  bye" << bsl::endl
@@ -527,6 +747,33 @@ void StorageInspector::processCommand(
                         << syncPt.qlistFileOffsetWords();
             }
         }
+
+        // Summary of journal records, per type
+        GuidSet           guids;
+        JournalScanFilter filter = {&guids, mqbu::StorageKey()};
+        JournalScanResult result;
+        scanJournal(&result, d_journalFileIter, filter);
+
+        const bsls::Types::Uint64* counts = result.d_counts;
+        BALL_LOG_INFO_BLOCK
+        {
+            BALL_LOG_OUTPUT_STREAM << "Journal Records Summary:\n";
+            bsl::vector<const char*> fields;
+            fields.push_back("Message Records");
+            fields.push_back("Confirm Records");
+            fields.push_back("Deletion Records");
+            fields.push_back("QueueOp Records");
+            fields.push_back("JournalOp Records");
+            fields.push_back("Undefined Records");
+
+            mwcu::AlignedPrinter printer(BALL_LOG_OUTPUT_STREAM, &fields);
+            printer << counts[mqbs::RecordType::e_MESSAGE]
+                    << counts[mqbs::RecordType::e_CONFIRM]
+                    << counts[mqbs::RecordType::e_DELETION]
+                    << counts[mqbs::RecordType::e_QUEUE_OP]
+                    << counts[mqbs::RecordType::e_JOURNAL_OP]
+                    << counts[mqbs::RecordType::e_UNDEFINED];
+        }
     }
 }
 
@@ -688,16 +935,18 @@ void StorageInspector::processCommand(const DumpQueueCommand& command)
                     BALL_LOG_OUTPUT_STREAM << "MessageRecord: \n";
                     printRecord(BALL_LOG_OUTPUT_STREAM, r);
                 }
-                while (
-                    d_dataFileIter.recordOffset() !=
-                    (r.messageOffsetDwords() * bmqp::Protocol::k_DWORD_SIZE)) {
-                    int rc = d_dataFileIter.nextRecord();
+                // Go straight to the message, rather than iterating over
+                // the DATA file, which may contain deallocated regions.
+                const bsls::Types::Uint64 messageOffset =
+                    static_cast<bsls::Types::Uint64>(r.messageOffsetDwords()) *
+                    bmqp::Protocol::k_DWORD_SIZE;
+                if (d_dataFileIter.recordOffset() != messageOffset) {
+                    int rc = d_dataFileIter.advanceToRecord(messageOffset);
                     if (rc != 1) {
                         BALL_LOG_ERROR
                             << "Failed to retrieve message from DATA "
                             << "file rc: " << rc;
                         failure = true;
-                        break;  // BREAK
                     }
                 }
 
@@ -744,6 +993,102 @@ void StorageInspector::processCommand(const DumpQueueCommand& command)
     }
 }
 
+void StorageInspector::processCommand(const SearchCommand& command)
+{
+    if (!d_journalFd.isValid()) {
+        BALL_LOG_ERROR << "You must open a journal file to use that command.";
+        return;  // RETURN
+    }
+
+    if (command.guid().empty() && command.key().empty()) {
+        BALL_LOG_ERROR << "At least one of 'guid' or 'key' must be specified.";
+        return;  // RETURN
+    }
+
+    if (!command.key().empty() &&
+        command.key().length() != mqbu::StorageKey::e_KEY_LENGTH_HEX) {
+        BALL_LOG_ERROR << "'key' length must be "
+                       << mqbu::StorageKey::e_KEY_LENGTH_HEX << " characters.";
+        return;  // RETURN
+    }
+
+    // Build the set of GUIDs to look for, shared by all scanning threads.
+
+    GuidSet guids;
+    for (size_t i = 0; i < command.guid().size(); ++i) {
+        const bsl::string& hex = command.guid()[i];
+        if (hex.length() != bmqt::MessageGUID::e_SIZE_HEX ||
+            !bmqt::MessageGUID::isValidHexRepresentation(hex.c_str())) {
+            BALL_LOG_ERROR << "Invalid GUID [" << hex << "].";
+            return;  // RETURN
+        }
+
+        bmqt::MessageGUID guid;
+        guid.fromHex(hex.c_str());
+        guids.insert(guid);
+    }
+
+    JournalScanFilter filter = {&guids, mqbu::StorageKey()};
+    if (!command.key().empty()) {
+        filter.d_queueKey.fromHex(command.key().c_str());
+    }
+
+    bool x = resetIterator(&d_journalFd,
+                           &d_journalFileIter,
+                           d_journalFile.c_str());
+    BSLS_ASSERT_OPT(x);
+
+    JournalScanResult result;
+    scanJournal(&result, d_journalFileIter, filter);
+
+    const mqbs::MemoryBlock& block = d_journalFd.block();
+    for (size_t i = 0; i < result.d_matches.size(); ++i) {
+        const bsls::Types::Uint64 offset = result.d_matches[i];
+        mqbs::OffsetPtr<const mqbs::RecordHeader> header(block, offset);
+
+        BALL_LOG_INFO_BLOCK
+        {
+            switch (header->type()) {
+            case mqbs::RecordType::e_MESSAGE: {
+                BALL_LOG_OUTPUT_STREAM << "MessageRecord: \n";
+                printRecord(BALL_LOG_OUTPUT_STREAM,
+                            *mqbs::OffsetPtr<const mqbs::MessageRecord>(
+                                block,
+                                offset));
+            } break;
+            case mqbs::RecordType::e_CONFIRM: {
+                BALL_LOG_OUTPUT_STREAM << "ConfirmRecord: \n";
+                printRecord(BALL_LOG_OUTPUT_STREAM,
+                            *mqbs::OffsetPtr<const mqbs::ConfirmRecord>(
+                                block,
+                                offset));
+            } break;
+            case mqbs::RecordType::e_DELETION: {
+                BALL_LOG_OUTPUT_STREAM << "DeletionRecord: \n";
+                printRecord(BALL_LOG_OUTPUT_STREAM,
+                            *mqbs::OffsetPtr<const mqbs::DeletionRecord>(
+                                block,
+                                offset));
+            } break;
+            case mqbs::RecordType::e_QUEUE_OP: {
+                BALL_LOG_OUTPUT_STREAM << "QueueOpRecord: \n";
+                printRecord(BALL_LOG_OUTPUT_STREAM,
+                            *mqbs::OffsetPtr<const mqbs::QueueOpRecord>(
+                                block,
+                                offset));
+            } break;
+            case mqbs::RecordType::e_JOURNAL_OP:
+            case mqbs::RecordType::e_UNDEFINED:
+            default:
+                BSLS_ASSERT_OPT(false && "Unexpected record type");
+            }
+        }
+    }
+
+    BALL_LOG_INFO << "Found " << result.d_matches.size()
+                  << " matching record(s).";
+}
+
 void StorageInspector::processCommand(const DataCommand& command)
 {
     if (!d_dataFd.isValid()) {
@@ -803,18 +1148,16 @@ void StorageInspector::processCommand(JournalCommand& command)
             return;  // RETURN
         }
 
-        const mqbs::MessageRecord& record = iter->asMessageRecord();
-        const unsigned int messageOffset  = record.messageOffsetDwords() *
-                                           bmqp::Protocol::k_DWORD_SIZE;
+        const mqbs::MessageRecord& record        = iter->asMessageRecord();
+        const bsls::Types::Uint64  messageOffset =
+            static_cast<bsls::Types::Uint64>(record.messageOffsetDwords()) *
+            bmqp::Protocol::k_DWORD_SIZE;
 
-        while (d_dataFileIter.recordOffset() != messageOffset) {
-            rc = d_dataFileIter.nextRecord();
-            if (rc != 1) {
-                BALL_LOG_ERROR
-                    << "Failed to iterate data file (exit status=" << rc
-                    << ")";
-                return;  // RETURN
-            }
+        rc = d_dataFileIter.advanceToRecord(messageOffset);
+        if (rc != 1) {
+            BALL_LOG_ERROR << "Failed to iterate data file (exit status="
+                           << rc << ")";
+            return;  // RETURN
         }
 
         printIterator(d_dataFileIter);
@@ -1133,6 +1476,12 @@ int StorageInspector::mainLoop()
                     processCommand(command);
                 }
             }
+            else if (verb == "search") {
+                SearchCommand command;
+                if (parseCommand(&command, jsonInput)) {
+                    processCommand(command);
+                }
+            }
             else if (verb == "j") {
                 JournalCommand command;
                 if (parseCommand(&command, jsonInput)) {
@@ -147,6 +147,7 @@ class StorageInspector {
     void processCommand(const MetadataCommand& command);
     void processCommand(const ListQueuesCommand& command);
     void processCommand(const DumpQueueCommand& command);
+    void processCommand(const SearchCommand& command);
     void processCommand(const DataCommand& command);
     void processCommand(const QlistCommand& command);
     void processCommand(JournalCommand& command);
@@ -268,6 +268,14 @@ Event AbstractSession::nextEvent(
     return Event();
 }
 
+int AbstractSession::tryNextEvent(BSLS_ANNOTATION_UNUSED Event* event)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(false && "Method is undefined in base protocol");
+
+    return -1;
+}
+
 int AbstractSession::post(BSLS_ANNOTATION_UNUSED const MessageEvent& event)
 {
     // PRECONDITIONS
@@ -372,6 +372,14 @@ class AbstractSession {
     virtual Event
     nextEvent(const bsls::TimeInterval& timeout = bsls::TimeInterval());
 
+    /// Load into the specified `event` the next available event received
+    /// for this session and return 0, or return a non-zero value and leave
+    /// `event` unchanged without blocking if there is no event available.
+    /// Note that this method can only be used if the session is in
+    /// synchronous mode (ie not using the EventHandler).  The behavior is
+    /// undefined unless the session was started.
+    virtual int tryNextEvent(Event* event);
+
     /// Asynchronously post the specified `event` that must contain one or
     /// more `Messages`.  The return value is one of the values defined in
     /// the `bmqt::PostResult::Enum` enum.  Return zero on success and a
@@ -126,7 +126,7 @@ struct ConfirmEventBuilderImpl {
     /// is big enough.  Note that since this buffer will hold a
     /// `bmqp::ConfirmEventBuilder` which holds a `bdlbb::Blob` data member,
     /// the size is different on 32 vs 64 bits.
-    static const int k_MAX_SIZEOF_BMQP_CONFIRMEVENTBUILDER = 64;
+    static const int k_MAX_SIZEOF_BMQP_CONFIRMEVENTBUILDER = 128;
 
     // PUBLIC DATA
     //   (for convenience)
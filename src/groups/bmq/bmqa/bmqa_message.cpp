@@ -426,6 +426,29 @@ int Message::getData(bdlbb::Blob* blob) const
     }
 }
 
+int Message::getDataBuffers(bsl::vector<bdlbb::BlobBuffer>* buffers) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isInitialized());
+    BSLS_ASSERT_SAFE(buffers);
+
+    const bmqp::Event& rawEvent = d_impl.d_event_p->rawEvent();
+
+    if (rawEvent.isPushEvent()) {
+        return d_impl.d_event_p->pushMessageIterator()
+            ->loadMessagePayloadBuffers(buffers);  // RETURN
+    }
+    else if (rawEvent.isPutEvent()) {
+        return d_impl.d_event_p->putMessageIterator()
+            ->loadMessagePayloadBuffers(buffers);  // RETURN
+    }
+    else {
+        BSLS_ASSERT_OPT(false && "Invalid raw event type");
+        return -1;  // Compiler Happiness                              //
+                    // RETURN
+    }
+}
+
 int Message::dataSize() const
 {
     // PRECONDITIONS
@@ -72,6 +72,7 @@
 #include <bsl_iosfwd.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bsls_annotation.h>
 
@@ -361,6 +362,21 @@ class Message {
     /// of invoking this method multiple times on a message.
     int getData(bdlbb::Blob* blob) const;
 
+    /// Load into the specified `buffers` the sequence of blob buffers
+    /// holding the payload of the message, if any, without copying it: the
+    /// loaded buffers alias the memory of the buffers the message was
+    /// received in.  Return zero if the message has a payload and non-zero
+    /// value otherwise.  The behaviour is undefined unless this instance
+    /// represents a `PUT` or `PUSH` message.  Any previous content of
+    /// `buffers` is removed but its capacity is reused, so that no memory
+    /// is allocated when the same `buffers` is used for consecutive
+    /// messages.  Note that each loaded buffer shares ownership of the
+    /// memory it refers to, thereby acting as a pin: the payload remains
+    /// valid for as long as `buffers` holds them, including after the
+    /// event callback returned.  Also note that the payload of a compressed
+    /// message refers to the decompressed buffers owned by the message.
+    int getDataBuffers(bsl::vector<bdlbb::BlobBuffer>* buffers) const;
+
     /// Return the number of bytes in the payload.  The behaviour is
     /// undefined unless this instance represents a `PUT` or a `PUSH`
     /// message.  Note that for efficiency, application should fetch payload
@@ -24,6 +24,8 @@
 #include <bdlbb_blobutil.h>
 #include <bdlbb_pooledblobbufferfactory.h>
 #include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
 
 // BMQ
 #include <bmqa_event.h>
@@ -220,6 +222,21 @@ static void test2_validPushMessagePrint()
     bmqa::Message message = mIter.message();
     ASSERT_EQ(message.compressionAlgorithmType(),
               bmqt::CompressionAlgorithmType::e_NONE);
+
+    // Zero-copy access to the payload
+    bsl::vector<bdlbb::BlobBuffer> buffers(s_allocator_p);
+    ASSERT_EQ(0, message.getDataBuffers(&buffers));
+    ASSERT(!buffers.empty());
+
+    bsl::string data(s_allocator_p);
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        data.append(buffers[i].data(), buffers[i].size());
+    }
+    ASSERT_EQ(data, bsl::string(buffer, s_allocator_p));
+
+    bdlbb::Blob dataBlob(s_allocator_p);
+    ASSERT_EQ(0, message.getData(&dataBlob));
+    ASSERT_EQ(buffers[0].data(), dataBlob.buffer(0).data());
 }
 
 static void test3_messageProperties()
@@ -0,0 +1,207 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqa_messagechunkutil.cpp                                          -*-C++-*-
+#include <bmqa_messagechunkutil.h>
+
+#include <bmqscm_version.h>
+// BMQA
+#include <bmqa_messageeventbuilder.h>
+
+// BMQ
+#include <bmqt_propertytype.h>
+#include <bmqt_resultcode.h>
+
+// BDE
+#include <bdlbb_blobutil.h>
+#include <bsl_algorithm.h>
+#include <bsl_utility.h>
+#include <bslma_default.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace bmqa {
+
+// -----------------------
+// struct MessageChunkUtil
+// -----------------------
+
+// CONSTANTS
+const char MessageChunkUtil::k_STREAM_ID_PROPERTY[] = "bmqChunkStreamId";
+const char MessageChunkUtil::k_INDEX_PROPERTY[]     = "bmqChunkIndex";
+const char MessageChunkUtil::k_COUNT_PROPERTY[]     = "bmqChunkCount";
+
+// CLASS METHODS
+int MessageChunkUtil::postChunked(AbstractSession*           session,
+                                  const QueueId&             queueId,
+                                  const bdlbb::Blob&         payload,
+                                  bsls::Types::Int64         streamId,
+                                  int                        chunkSize,
+                                  const MessageProperties*   properties,
+                                  const bmqt::CorrelationId& correlationId)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(session);
+    BSLS_ASSERT(0 < chunkSize && chunkSize <= k_MAX_CHUNK_SIZE);
+
+    const int length = payload.length();
+    const int count  = length == 0 ? 1 : (length - 1) / chunkSize + 1;
+
+    MessageProperties chunkProperties;
+    if (properties) {
+        chunkProperties = *properties;
+    }
+    chunkProperties.setPropertyAsInt64(k_STREAM_ID_PROPERTY, streamId);
+    chunkProperties.setPropertyAsInt32(k_COUNT_PROPERTY, count);
+
+    MessageEventBuilder builder;
+    session->loadMessageEventBuilder(&builder);
+
+    bdlbb::Blob chunk;
+    for (int index = 0; index < count; ++index) {
+        // Share the buffers of 'payload' rather than copying them.
+        const int offset = index * chunkSize;
+        chunk.removeAll();
+        bdlbb::BlobUtil::append(&chunk,
+                                payload,
+                                offset,
+                                bsl::min(chunkSize, length - offset));
+
+        chunkProperties.setPropertyAsInt32(k_INDEX_PROPERTY, index);
+
+        Message& message = builder.startMessage();
+        message.setDataRef(&chunk);
+        message.setPropertiesRef(&chunkProperties);
+        if (!correlationId.isUnset()) {
+            message.setCorrelationId(correlationId);
+        }
+
+        const bmqt::EventBuilderResult::Enum packRc = builder.packMessage(
+            queueId);
+        if (packRc != bmqt::EventBuilderResult::e_SUCCESS) {
+            return packRc;  // RETURN
+        }
+
+        const int postRc = session->post(builder.messageEvent());
+        if (postRc != 0) {
+            return postRc;  // RETURN
+        }
+
+        builder.reset();
+    }
+
+    return 0;
+}
+
+// ---------------------------
+// class MessageChunkAssembler
+// ---------------------------
+
+// CREATORS
+MessageChunkAssembler::MessageChunkAssembler(bslma::Allocator* allocator)
+: d_streams(allocator)
+, d_properties(allocator)
+, d_buffers(allocator)
+, d_allocator_p(bslma::Default::allocator(allocator))
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+MessageChunkAssembler::Result::Enum
+MessageChunkAssembler::add(bsls::Types::Int64* streamId,
+                           const Message&      message)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(streamId);
+
+    bmqt::PropertyType::Enum type;
+    if (!message.hasProperties() || message.loadProperties(&d_properties) ||
+        !d_properties.hasProperty(MessageChunkUtil::k_STREAM_ID_PROPERTY,
+                                  &type) ||
+        type != bmqt::PropertyType::e_INT64) {
+        return Result::e_NOT_A_CHUNK;  // RETURN
+    }
+
+    *streamId = d_properties.getPropertyAsInt64(
+        MessageChunkUtil::k_STREAM_ID_PROPERTY);
+    const int index = d_properties.getPropertyAsInt32Or(
+        MessageChunkUtil::k_INDEX_PROPERTY,
+        -1);
+    const int count = d_properties.getPropertyAsInt32Or(
+        MessageChunkUtil::k_COUNT_PROPERTY,
+        0);
+
+    Streams::iterator it = d_streams.find(*streamId);
+    if (it == d_streams.end()) {
+        if (index != 0 || count <= 0) {
+            return Result::e_INVALID;  // RETURN
+        }
+
+        Stream stream;
+        stream.d_nextIndex = 0;
+        stream.d_count     = count;
+        stream.d_data_sp.createInplace(d_allocator_p, d_allocator_p);
+        it = d_streams.insert(bsl::make_pair(*streamId, stream)).first;
+    }
+
+    Stream& stream = it->second;
+    if (index != stream.d_nextIndex || count != stream.d_count) {
+        // A chunk was lost, duplicated or reordered: the payload cannot be
+        // reassembled.
+        d_streams.erase(it);
+        return Result::e_INVALID;  // RETURN
+    }
+
+    if (message.getDataBuffers(&d_buffers) == 0) {
+        for (size_t i = 0; i < d_buffers.size(); ++i) {
+            stream.d_data_sp->appendDataBuffer(d_buffers[i]);
+        }
+    }
+    d_buffers.clear();
+
+    ++stream.d_nextIndex;
+
+    return stream.d_nextIndex == stream.d_count ? Result::e_COMPLETE
+                                                : Result::e_IN_PROGRESS;
+}
+
+void MessageChunkAssembler::release(bsls::Types::Int64 streamId)
+{
+    d_streams.erase(streamId);
+}
+
+// ACCESSORS
+const bdlbb::Blob*
+MessageChunkAssembler::data(bsls::Types::Int64 streamId) const
+{
+    Streams::const_iterator cit = d_streams.find(streamId);
+    return cit == d_streams.end() ? 0 : cit->second.d_data_sp.get();
+}
+
+bool MessageChunkAssembler::isComplete(bsls::Types::Int64 streamId) const
+{
+    Streams::const_iterator cit = d_streams.find(streamId);
+    return cit != d_streams.end() &&
+           cit->second.d_nextIndex == cit->second.d_count;
+}
+
+int MessageChunkAssembler::numStreams() const
+{
+    return static_cast<int>(d_streams.size());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
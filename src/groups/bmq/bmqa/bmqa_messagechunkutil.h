@@ -0,0 +1,262 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqa_messagechunkutil.h                                            -*-C++-*-
+#ifndef INCLUDED_BMQA_MESSAGECHUNKUTIL
+#define INCLUDED_BMQA_MESSAGECHUNKUTIL
+
+//@PURPOSE: Provide posting and reassembly of payloads split in chunks.
+//
+//@CLASSES:
+//  bmqa::MessageChunkUtil: post a large payload as a stream of chunks
+//  bmqa::MessageChunkAssembler: reassemble the streams of chunks received
+//
+//@SEE ALSO:
+//  bmqa_abstractsession, bmqa_message
+//
+//@DESCRIPTION: This component provides a utility, 'bmqa::MessageChunkUtil',
+// to post a payload larger than a single message can hold (see
+// 'bmqp::PutHeader::k_MAX_PAYLOAD_SIZE_SOFT'), or large enough that holding
+// it in a single message would cause memory spikes all along its way from
+// the producer to the consumers, as a *stream* of *chunks*: messages each
+// holding a slice of the payload, posted in their own event, so that they
+// are stored and replicated by the brokers one at a time.  It also provides
+// a mechanism, 'bmqa::MessageChunkAssembler', to reassemble the payloads on
+// the consumer as their chunks are received.
+//
+// Each chunk carries, in addition to the properties specified by the
+// producer, the properties 'k_STREAM_ID_PROPERTY' (the identifier, chosen by
+// the producer, of the stream), 'k_INDEX_PROPERTY' (the position of the chunk
+// in the stream) and 'k_COUNT_PROPERTY' (the number of chunks of the stream).
+//
+// The payload is reassembled without copy: the payload of each chunk is
+// appended, by reference, to the payload of its stream.  The payload
+// received so far can be read while the next chunks are still in flight
+// (e.g., with a 'bdlbb::InBlobStreamBuf'), so that the consumer can process
+// the payload in a streaming fashion.
+//
+/// Caveats
+///-------
+//: o The chunks are independent messages for the brokers: they must be
+//:   delivered, in order, to the same consumer to be reassembled, i.e. the
+//:   queue must have a single consumer (or a single consumer at the highest
+//:   priority), and the stream must be posted by a single producer.
+//:
+//: o Each chunk must be confirmed by the consumer, like any other message,
+//:   typically once the stream it belongs to is processed.
+//
+/// Thread Safety
+///-------------
+// 'bmqa::MessageChunkUtil' is thread-safe.  'bmqa::MessageChunkAssembler' is
+// *NOT* thread-safe.
+//
+/// Usage
+///-----
+// On the producer:
+//..
+//  int rc = bmqa::MessageChunkUtil::postChunked(&session,
+//                                               queueId,
+//                                               largePayload,
+//                                               streamId);
+//..
+// On the consumer, for each message received:
+//..
+//  bsls::Types::Int64                        streamId;
+//  bmqa::MessageChunkAssembler::Result::Enum result =
+//                                       assembler.add(&streamId, message);
+//  if (result == bmqa::MessageChunkAssembler::Result::e_COMPLETE) {
+//      process(*assembler.data(streamId));
+//      assembler.release(streamId);
+//  }
+//..
+
+// BMQA
+#include <bmqa_abstractsession.h>
+#include <bmqa_message.h>
+#include <bmqa_messageproperties.h>
+#include <bmqa_queueid.h>
+
+// BMQ
+#include <bmqp_protocol.h>
+#include <bmqt_correlationid.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bsl_memory.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bmqa {
+
+// =======================
+// struct MessageChunkUtil
+// =======================
+
+/// Utility to post a large payload as a stream of chunk messages.
+struct MessageChunkUtil {
+    // CONSTANTS
+
+    /// Name of the `Int64` property identifying the stream of a chunk.
+    static const char k_STREAM_ID_PROPERTY[];
+
+    /// Name of the `Int32` property holding the index of a chunk.
+    static const char k_INDEX_PROPERTY[];
+
+    /// Name of the `Int32` property holding the number of chunks of the
+    /// stream of a chunk.
+    static const char k_COUNT_PROPERTY[];
+
+    /// Default size of the payload of a chunk.
+    static const int k_DEFAULT_CHUNK_SIZE = 8 * 1024 * 1024;
+
+    /// Maximum size of the payload of a chunk.
+    static const int k_MAX_CHUNK_SIZE =
+        bmqp::PutHeader::k_MAX_PAYLOAD_SIZE_SOFT;
+
+    // CLASS METHODS
+
+    /// Post, on the specified `session`, to the queue identified by the
+    /// specified `queueId`, the specified `payload` as the stream of chunks
+    /// identified by the specified `streamId`, each holding at most the
+    /// optionally specified `chunkSize` bytes of `payload`, and posted in
+    /// its own event.  Optionally specify `properties` to set on each
+    /// chunk, and a `correlationId` to set on each chunk.  Return 0 on
+    /// success, or, if a chunk could not be posted, the non-zero
+    /// `bmqt::EventBuilderResult::Enum` or `bmqt::PostResult::Enum` of the
+    /// failure, in which case the chunks already posted are not recalled.
+    /// The behavior is undefined unless `0 < chunkSize <=
+    /// k_MAX_CHUNK_SIZE`, and unless `streamId` is unique among the
+    /// streams posted to the queue.
+    static int
+    postChunked(AbstractSession*           session,
+                const QueueId&             queueId,
+                const bdlbb::Blob&         payload,
+                bsls::Types::Int64         streamId,
+                int                        chunkSize  = k_DEFAULT_CHUNK_SIZE,
+                const MessageProperties*   properties = 0,
+                const bmqt::CorrelationId& correlationId =
+                    bmqt::CorrelationId());
+};
+
+// ===========================
+// class MessageChunkAssembler
+// ===========================
+
+/// Mechanism reassembling the payloads of the streams of chunk messages.
+class MessageChunkAssembler {
+  public:
+    // TYPES
+
+    /// Result of adding a message.
+    struct Result {
+        enum Enum {
+            e_INVALID = -1  // Chunk out of sequence; stream discarded
+            ,
+            e_NOT_A_CHUNK = 0  // Message is not a chunk
+            ,
+            e_IN_PROGRESS = 1  // More chunks are expected
+            ,
+            e_COMPLETE = 2  // All the chunks were received
+        };
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct Stream {
+        int d_nextIndex;
+        // Index of the next expected chunk.
+
+        int d_count;
+        // Number of chunks of the stream.
+
+        bsl::shared_ptr<bdlbb::Blob> d_data_sp;
+        // Payload received so far.
+    };
+
+    typedef bsl::unordered_map<bsls::Types::Int64, Stream> Streams;
+
+    // DATA
+    Streams d_streams;
+    // Streams being reassembled, or
+    // complete but not yet released.
+
+    MessageProperties d_properties;
+    // Properties of the last added message.
+
+    bsl::vector<bdlbb::BlobBuffer> d_buffers;
+    // Payload of the last added message.
+
+    bslma::Allocator* d_allocator_p;
+    // Allocator to use.
+
+  private:
+    // NOT IMPLEMENTED
+    MessageChunkAssembler(const MessageChunkAssembler&);  // = delete;
+    MessageChunkAssembler&
+    operator=(const MessageChunkAssembler&);  // = delete;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(MessageChunkAssembler,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an assembler having no stream.  Optionally specify an
+    /// `allocator` used to supply memory.  If `allocator` is 0, the
+    /// currently installed default allocator is used.
+    explicit MessageChunkAssembler(bslma::Allocator* allocator = 0);
+
+    // MANIPULATORS
+
+    /// Add the specified `message` to the stream it is a chunk of, if any,
+    /// and load into the specified `streamId` the identifier of that
+    /// stream.  Return `e_NOT_A_CHUNK` if `message` is not a chunk (in
+    /// which case `streamId` is not modified), `e_IN_PROGRESS` or
+    /// `e_COMPLETE` depending on whether more chunks of the stream are
+    /// expected, or `e_INVALID`, and discard the stream, if `message` is
+    /// not the next expected chunk of its stream.  The behavior is
+    /// undefined unless `message` is a `PUSH` message.
+    Result::Enum add(bsls::Types::Int64* streamId, const Message& message);
+
+    /// Discard the stream having the specified `streamId`, if any.
+    void release(bsls::Types::Int64 streamId);
+
+    // ACCESSORS
+
+    /// Return the payload received so far of the stream having the
+    /// specified `streamId`, or 0 if there is no such stream.  Note that
+    /// the returned blob remains valid, and is appended the payload of the
+    /// next chunks of the stream, until the stream is released or
+    /// discarded.
+    const bdlbb::Blob* data(bsls::Types::Int64 streamId) const;
+
+    /// Return `true` if all the chunks of the stream having the specified
+    /// `streamId` were received, and `false` otherwise.
+    bool isComplete(bsls::Types::Int64 streamId) const;
+
+    /// Return the number of streams held by this object.
+    int numStreams() const;
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,235 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqa_messagechunkutil.t.cpp                                        -*-C++-*-
+#include <bmqa_messagechunkutil.h>
+
+// BMQA
+#include <bmqa_event.h>
+#include <bmqa_messageevent.h>
+#include <bmqa_messageiterator.h>
+#include <bmqa_mocksession.h>
+
+// BMQ
+#include <bmqp_protocolutil.h>
+#include <bmqt_messageguid.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+typedef bmqa::MessageChunkAssembler::Result Result;
+
+typedef bsl::vector<bmqa::MockSessionUtil::PushMessageParams> PushMessages;
+
+/// Append to the specified `messages` a message having the specified
+/// `payload`, and being the chunk of the specified `index` among `count` of
+/// the stream having the specified `streamId` unless `index` is negative,
+/// using the specified `bufferFactory` to supply buffers.
+void addMessage(PushMessages*             messages,
+                const char*               payload,
+                bsls::Types::Int64        streamId,
+                int                       index,
+                int                       count,
+                bdlbb::BlobBufferFactory* bufferFactory)
+{
+    bdlbb::Blob blob(bufferFactory, s_allocator_p);
+    bdlbb::BlobUtil::append(&blob, payload, bsl::strlen(payload));
+
+    bmqa::MessageProperties properties(s_allocator_p);
+    properties.setPropertyAsString("app", "value");
+    if (index >= 0) {
+        properties.setPropertyAsInt64(
+            bmqa::MessageChunkUtil::k_STREAM_ID_PROPERTY,
+            streamId);
+        properties.setPropertyAsInt32(bmqa::MessageChunkUtil::k_INDEX_PROPERTY,
+                                      index);
+        properties.setPropertyAsInt32(bmqa::MessageChunkUtil::k_COUNT_PROPERTY,
+                                      count);
+    }
+
+    bmqt::MessageGUID guid;
+    guid.fromHex("00000000000000000000000000000001");
+
+    messages->emplace_back(blob, bmqa::QueueId(1), guid, properties);
+}
+
+/// Return the content of the specified `blob` as a string.
+bsl::string toString(const bdlbb::Blob& blob)
+{
+    bsl::string result(s_allocator_p);
+    for (int i = 0; i < blob.numDataBuffers(); ++i) {
+        result.append(blob.buffer(i).data(),
+                      i == blob.numDataBuffers() - 1
+                          ? blob.lastDataBufferLength()
+                          : blob.buffer(i).size());
+    }
+    return result;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_assembler()
+// ------------------------------------------------------------------------
+// ASSEMBLER
+//
+// Concerns:
+//   1. A message which is not a chunk is ignored.
+//   2. The payloads of the chunks of a stream are appended, in order, to
+//      the payload of the stream, which is complete once all its chunks
+//      were added, and interleaved streams are reassembled independently.
+//   3. A stream receiving an unexpected chunk is discarded.
+//
+// Testing:
+//   add
+//   release
+//   data
+//   isComplete
+//   numStreams
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("ASSEMBLER");
+
+    bmqp::ProtocolUtil::initialize(s_allocator_p);
+
+    {
+        bdlbb::PooledBlobBufferFactory bufferFactory(4 * 1024, s_allocator_p);
+        PushMessages messages(s_allocator_p);
+
+        addMessage(&messages, "plain", 0, -1, 0, &bufferFactory);
+        addMessage(&messages, "hello ", 7, 0, 3, &bufferFactory);
+        addMessage(&messages, "first ", 8, 0, 2, &bufferFactory);
+        addMessage(&messages, "chunked ", 7, 1, 3, &bufferFactory);
+        addMessage(&messages, "second", 8, 1, 2, &bufferFactory);
+        addMessage(&messages, "world", 7, 2, 3, &bufferFactory);
+        addMessage(&messages, "lost ", 9, 0, 3, &bufferFactory);
+        addMessage(&messages, "reordered", 9, 2, 3, &bufferFactory);
+        addMessage(&messages, "orphan", 10, 1, 3, &bufferFactory);
+
+        bmqa::Event event = bmqa::MockSessionUtil::createPushEvent(
+            messages,
+            &bufferFactory,
+            s_allocator_p);
+        bmqa::MessageIterator it = event.messageEvent().messageIterator();
+
+        bmqa::MessageChunkAssembler assembler(s_allocator_p);
+        bsls::Types::Int64          streamId = -1;
+
+        // Not a chunk
+        ASSERT(it.nextMessage());
+        ASSERT_EQ(assembler.add(&streamId, it.message()),
+                  Result::e_NOT_A_CHUNK);
+        ASSERT_EQ(streamId, -1);
+        ASSERT_EQ(assembler.numStreams(), 0);
+
+        // Interleaved streams
+        ASSERT(it.nextMessage());
+        ASSERT_EQ(assembler.add(&streamId, it.message()),
+                  Result::e_IN_PROGRESS);
+        ASSERT_EQ(streamId, 7);
+        ASSERT(assembler.data(7));
+        ASSERT_EQ(toString(*assembler.data(7)), "hello ");
+        ASSERT(!assembler.isComplete(7));
+
+        ASSERT(it.nextMessage());
+        ASSERT_EQ(assembler.add(&streamId, it.message()),
+                  Result::e_IN_PROGRESS);
+        ASSERT_EQ(streamId, 8);
+        ASSERT_EQ(assembler.numStreams(), 2);
+
+        ASSERT(it.nextMessage());
+        ASSERT_EQ(assembler.add(&streamId, it.message()),
+                  Result::e_IN_PROGRESS);
+        ASSERT_EQ(streamId, 7);
+        ASSERT_EQ(toString(*assembler.data(7)), "hello chunked ");
+
+        ASSERT(it.nextMessage());
+        ASSERT_EQ(assembler.add(&streamId, it.message()), Result::e_COMPLETE);
+        ASSERT_EQ(streamId, 8);
+        ASSERT(assembler.isComplete(8));
+        ASSERT_EQ(toString(*assembler.data(8)), "first second");
+
+        ASSERT(it.nextMessage());
+        ASSERT_EQ(assembler.add(&streamId, it.message()), Result::e_COMPLETE);
+        ASSERT_EQ(streamId, 7);
+        ASSERT(assembler.isComplete(7));
+        ASSERT_EQ(toString(*assembler.data(7)), "hello chunked world");
+
+        assembler.release(7);
+        ASSERT(!assembler.data(7));
+        ASSERT(!assembler.isComplete(7));
+        ASSERT_EQ(assembler.numStreams(), 1);
+
+        // Missing chunk
+        ASSERT(it.nextMessage());
+        ASSERT_EQ(assembler.add(&streamId, it.message()),
+                  Result::e_IN_PROGRESS);
+        ASSERT_EQ(streamId, 9);
+        ASSERT(it.nextMessage());
+        ASSERT_EQ(assembler.add(&streamId, it.message()), Result::e_INVALID);
+        ASSERT_EQ(streamId, 9);
+        ASSERT(!assembler.data(9));
+
+        // Missing first chunk
+        ASSERT(it.nextMessage());
+        ASSERT_EQ(assembler.add(&streamId, it.message()), Result::e_INVALID);
+        ASSERT_EQ(streamId, 10);
+        ASSERT(!assembler.data(10));
+
+        ASSERT(!it.nextMessage());
+        ASSERT_EQ(assembler.numStreams(), 1);
+    }
+
+    bmqp::ProtocolUtil::shutdown();
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 1: test1_assembler(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_DEFAULT);
+}
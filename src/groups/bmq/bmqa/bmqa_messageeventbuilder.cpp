@@ -44,6 +44,42 @@ BSLMF_ASSERT(sizeof(QueueId) == sizeof(bsl::shared_ptr<bmqimp::Queue>));
 
 }  // close unnamed namespace
 
+// ------------------------------
+// struct MessageEventBuilderImpl
+// ------------------------------
+
+MessageEventBuilderImpl::MessageEventBuilderImpl()
+: d_msgEvent()
+, d_msg()
+, d_guidGenerator_sp()
+, d_numReservedGUIDs(0)
+{
+    // NOTHING
+}
+
+MessageEventBuilderImpl::MessageEventBuilderImpl(
+    const MessageEventBuilderImpl& other)
+: d_msgEvent(other.d_msgEvent)
+, d_msg(other.d_msg)
+, d_guidGenerator_sp(other.d_guidGenerator_sp)
+, d_numReservedGUIDs(0)
+{
+    // NOTHING
+}
+
+MessageEventBuilderImpl&
+MessageEventBuilderImpl::operator=(const MessageEventBuilderImpl& rhs)
+{
+    if (this != &rhs) {
+        d_msgEvent         = rhs.d_msgEvent;
+        d_msg              = rhs.d_msg;
+        d_guidGenerator_sp = rhs.d_guidGenerator_sp;
+        d_numReservedGUIDs = 0;
+    }
+
+    return *this;
+}
+
 // -------------------------
 // class MessageEventBuilder
 // -------------------------
@@ -139,11 +175,34 @@ MessageEventBuilder::packMessage(const bmqa::QueueId& queueId)
         builder->setFlags(bmqp::PutHeaderFlags::e_ACK_REQUESTED);
     }
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_impl.d_numReservedGUIDs ==
+                                              0)) {
+        // Generate the GUIDs of the next messages all at once.
+        d_impl.d_guidGenerator_sp->generateGUIDs(
+            d_impl.d_reservedGUIDs,
+            MessageEventBuilderImpl::k_NUM_RESERVED_GUIDS);
+        d_impl.d_numReservedGUIDs =
+            MessageEventBuilderImpl::k_NUM_RESERVED_GUIDS;
+    }
+
     bmqt::EventBuilderResult::Enum rc;
-    bmqt::MessageGUID              guid;
-    d_impl.d_guidGenerator_sp->generateGUID(&guid);
+    const bmqt::MessageGUID        guid =
+        d_impl.d_reservedGUIDs[MessageEventBuilderImpl::k_NUM_RESERVED_GUIDS -
+                               d_impl.d_numReservedGUIDs];
+    --d_impl.d_numReservedGUIDs;
     builder->setMessageGUID(guid);
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            builder->compressionAlgorithmType() >
+                bmqt::CompressionAlgorithmType::e_ZLIB &&
+            !queueSpRef->hasExtendedCompression())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        // The broker does not support this algorithm, fall back to the one
+        // all brokers support.
+        builder->setCompressionAlgorithmType(
+            bmqt::CompressionAlgorithmType::e_ZLIB);
+    }
+
     if (queueSpRef->isOldStyle()) {
         // Temporary; shall remove after 2nd roll out of "new style" brokers.
         rc = builder->packMessageInOldStyle(queueSpRef->id());
@@ -153,6 +212,7 @@ MessageEventBuilder::packMessage(const bmqa::QueueId& queueId)
             queueSpRef->schemaGenerator().getSchemaId(
                 builder->messageProperties());
         builder->setMessagePropertiesInfo(info);
+        builder->setCompressionDictionary(queueSpRef->compressionDictionary());
 
         rc = builder->packMessage(queueSpRef->id());
     }
@@ -187,6 +247,10 @@ void MessageEventBuilder::reset()
     eventSpRef->upgradeMessageEventModeToWrite();
     // underlying PutEventBuilder is reset in
     // 'upgradeMessageEventModeToWrite'
+
+    // Discard the reserved GUIDs, so that the GUIDs of the next event
+    // reflect its creation time.
+    d_impl.d_numReservedGUIDs = 0;
 }
 
 const MessageEvent& MessageEventBuilder::messageEvent()
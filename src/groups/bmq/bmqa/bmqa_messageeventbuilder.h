@@ -241,6 +241,7 @@
 
 #include <bmqa_message.h>
 #include <bmqa_messageevent.h>
+#include <bmqt_messageguid.h>
 #include <bmqt_resultcode.h>
 
 // BDE
@@ -267,6 +268,12 @@ namespace bmqa {
 /// private members of MessageEventBuilder to initialize it, without having
 /// to expose them publicly).
 struct MessageEventBuilderImpl {
+    // PUBLIC CONSTANTS
+
+    /// Number of GUIDs generated at once when packing messages, so that
+    /// the cost of generating a GUID is amortized over a batch.
+    static const int k_NUM_RESERVED_GUIDS = 32;
+
     // PUBLIC DATA
     MessageEvent d_msgEvent;  // This is needed so that 'getMessageEvent()' can
                               // return a const ref.
@@ -276,6 +283,32 @@ struct MessageEventBuilderImpl {
 
     bsl::shared_ptr<bmqp::MessageGUIDGenerator> d_guidGenerator_sp;
     // GUID generator object.
+
+    bmqt::MessageGUID d_reservedGUIDs[k_NUM_RESERVED_GUIDS];
+    // GUIDs generated in bulk, of which
+    // the last 'd_numReservedGUIDs' are
+    // not used yet.
+
+    int d_numReservedGUIDs;
+    // Number of GUIDs not used yet in
+    // 'd_reservedGUIDs'.
+
+    // CREATORS
+
+    /// Create an object with no reserved GUIDs.
+    MessageEventBuilderImpl();
+
+    /// Create an object having the same value as the specified `other`,
+    /// except for the reserved GUIDs which are not copied, so that no two
+    /// builders use the same GUIDs.
+    MessageEventBuilderImpl(const MessageEventBuilderImpl& other);
+
+    // MANIPULATORS
+
+    /// Assign to this object the value of the specified `rhs`, except for
+    /// the reserved GUIDs which are discarded, and return a reference to
+    /// this modifiable object.
+    MessageEventBuilderImpl& operator=(const MessageEventBuilderImpl& rhs);
 };
 
 // =========================
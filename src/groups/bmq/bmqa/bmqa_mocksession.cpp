@@ -1500,6 +1500,7 @@ void MockSession::loadMessageEventBuilder(MessageEventBuilder* builder)
         reinterpret_cast<MessageEventBuilderImpl&>(builderRef);
 
     builderImplRef.d_guidGenerator_sp = g_guidGenerator_sp;
+    builderImplRef.d_numReservedGUIDs = 0;
 
     // Get bmqimp::Event sharedptr from MessageEventBuilderImpl
     bsl::shared_ptr<bmqimp::Event>& eventImplSpRef =
@@ -21,6 +21,7 @@
 #include <bmqa_event.h>
 #include <bmqa_message.h>
 #include <bmqa_messageevent.h>
+#include <bmqa_messageiterator.h>
 #include <bmqa_messageproperties.h>
 #include <bmqa_queueid.h>
 #include <bmqa_sessionevent.h>
@@ -34,7 +35,10 @@
 #include <bmqp_messageguidgenerator.h>
 #include <bmqp_protocol.h>
 #include <bmqt_correlationid.h>
+#include <bmqt_messageeventtype.h>
 #include <bmqt_queueflags.h>
+#include <bmqt_resultcode.h>
+#include <bmqt_sessioneventtype.h>
 
 // MWC
 #include <mwcu_memoutstream.h>
@@ -54,9 +58,11 @@
 #include <bslma_managedptr.h>
 #include <bslmf_assert.h>
 #include <bslmf_ispolymorphic.h>
+#include <bslmt_lockguard.h>
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
 #include <bsls_performancehint.h>
+#include <bsls_systemtime.h>
 
 namespace BloombergLP {
 namespace bmqa {
@@ -259,7 +265,17 @@ int SessionUtil::createApplication(SessionImpl* sessionImpl)
         .append(";")
         .append(bmqp::MessagePropertiesFeatures::k_FIELD_NAME)
         .append(":")
-        .append(bmqp::MessagePropertiesFeatures::k_MESSAGE_PROPERTIES_EX);
+        .append(bmqp::MessagePropertiesFeatures::k_MESSAGE_PROPERTIES_EX)
+        .append(";")
+        .append(bmqp::CompressionFeatures::k_FIELD_NAME)
+        .append(":")
+        .append(bmqp::CompressionFeatures::k_LZ4)
+        .append(",")
+        .append(bmqp::CompressionFeatures::k_ZSTD)
+        .append(";")
+        .append(bmqp::AckFeatures::k_FIELD_NAME)
+        .append(":")
+        .append(bmqp::AckFeatures::k_RANGES);
 
     ci.protocolVersion() = bmqp::Protocol::k_VERSION;
     ci.sdkVersion()      = bmqscm::Version::versionAsInt();
@@ -637,6 +653,23 @@ bmqt::CloseQueueResult::Enum SessionUtil::validateAndSetCloseQueueParameters(
     return bmqt::CloseQueueResult::e_SUCCESS;
 }
 
+/// Load into the specified `event` the oldest event of the specified
+/// `sessionImpl` received while fetching messages, and return 0, or return
+/// a non-zero value and leave `event` unchanged if there is no such event.
+int tryNextPendingEvent(Event* event, SessionImpl* sessionImpl)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(
+        &sessionImpl->d_pendingEventsMutex);  // LOCK
+
+    if (sessionImpl->d_pendingEvents.empty()) {
+        return -1;  // RETURN
+    }
+
+    *event = sessionImpl->d_pendingEvents.front();
+    sessionImpl->d_pendingEvents.pop_front();
+    return 0;
+}
+
 }  // close unnamed namespace
 
 // -------------------------
@@ -660,6 +693,8 @@ SessionImpl::SessionImpl(const bmqt::SessionOptions&            options,
 , d_eventHandler_mp(eventHandler)
 , d_guidGenerator_sp()
 , d_application_mp(0)
+, d_pendingEvents(d_allocator_p)
+, d_pendingEventsMutex()
 {
     // NOTHING
 }
@@ -779,6 +814,7 @@ MessageEventBuilder Session::createMessageEventBuilder()
         reinterpret_cast<MessageEventBuilderImpl&>(builder);
 
     builderRef.d_guidGenerator_sp = d_impl.d_guidGenerator_sp;
+    builderRef.d_numReservedGUIDs = 0;
 
     // Get bmqimp::Event sharedptr from MessageEventBuilderImpl
     bsl::shared_ptr<bmqimp::Event>& eventImplSpRef =
@@ -806,6 +842,7 @@ void Session::loadMessageEventBuilder(MessageEventBuilder* builder)
         reinterpret_cast<MessageEventBuilderImpl&>(builderRef);
 
     builderImplRef.d_guidGenerator_sp = d_impl.d_guidGenerator_sp;
+    builderImplRef.d_numReservedGUIDs = 0;
 
     // Get bmqimp::Event sharedptr from MessageEventBuilderImpl
     bsl::shared_ptr<bmqimp::Event>& eventImplSpRef =
@@ -816,6 +853,10 @@ void Session::loadMessageEventBuilder(MessageEventBuilder* builder)
 
     eventImplSpRef->configureAsMessageEvent(
         d_impl.d_application_mp->bufferFactory());
+    eventImplSpRef->putEventBuilder()->setCompressionThreadPool(
+        d_impl.d_application_mp->brokerSession().compressionThreadPool());
+    eventImplSpRef->putEventBuilder()->setZstdCompressionLevel(
+        d_impl.d_sessionOptions.zstdCompressionLevel());
 }
 
 void Session::loadConfirmEventBuilder(ConfirmEventBuilder* builder)
@@ -843,6 +884,11 @@ void Session::loadConfirmEventBuilder(ConfirmEventBuilder* builder)
 
     builderImplRef.d_builder_p = reinterpret_cast<bmqp::ConfirmEventBuilder*>(
         builderImplRef.d_buffer.buffer());
+
+    // Collapse the confirmations of consecutive messages into ranges; the
+    // event is converted back to individual confirmations before being sent,
+    // if the broker does not support it.
+    builderImplRef.d_builder_p->setRangeEncoding(true);
 }
 
 void Session::loadMessageProperties(MessageProperties* buffer)
@@ -1476,7 +1522,11 @@ Event Session::nextEvent(const bsls::TimeInterval& timeout)
     // PRECONDITIONS
     BSLS_ASSERT(d_impl.d_application_mp && "The session was not started");
 
-    Event                           event;
+    Event event;
+    if (tryNextPendingEvent(&event, &d_impl) == 0) {
+        return event;  // RETURN
+    }
+
     bsl::shared_ptr<bmqimp::Event>& eventImplSpRef =
         reinterpret_cast<bsl::shared_ptr<bmqimp::Event>&>(event);
 
@@ -1491,6 +1541,105 @@ Event Session::nextEvent(const bsls::TimeInterval& timeout)
     return event;
 }
 
+int Session::tryNextEvent(Event* event)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(d_impl.d_application_mp && "The session was not started");
+    BSLS_ASSERT_SAFE(event);
+
+    if (tryNextPendingEvent(event, &d_impl) == 0) {
+        return 0;  // RETURN
+    }
+
+    bsl::shared_ptr<bmqimp::Event>& eventImplSpRef =
+        reinterpret_cast<bsl::shared_ptr<bmqimp::Event>&>(*event);
+
+    return d_impl.d_application_mp->brokerSession().tryNextEvent(
+        &eventImplSpRef);
+}
+
+int Session::fetch(bsl::vector<Message>*     messages,
+                   QueueId*                  queueId,
+                   int                       maxCount,
+                   const bsls::TimeInterval& maxWait)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(d_impl.d_application_mp && "The session was not started");
+    BSLS_ASSERT_SAFE(messages);
+    BSLS_ASSERT_SAFE(queueId);
+    BSLS_ASSERT(0 < maxCount);
+
+    if (d_impl.d_eventHandler_mp) {
+        BALL_LOG_ERROR << "Fetching messages is not supported when using an "
+                       << "EventHandler";
+        return bmqt::ConfigureQueueResult::e_NOT_SUPPORTED;  // RETURN
+    }
+
+    const bsls::TimeInterval deadline = bsls::SystemTime::nowMonotonicClock() +
+                                        maxWait;
+
+    // Open the window to exactly the number of messages requested.
+    bmqt::QueueOptions options(queueId->options(), d_impl.d_allocator_p);
+    options.setMaxUnconfirmedMessages(maxCount);
+    if (options.maxUnconfirmedBytes() <= 0) {
+        options.setMaxUnconfirmedBytes(
+            bmqt::QueueOptions::k_DEFAULT_MAX_UNCONFIRMED_BYTES);
+    }
+
+    ConfigureQueueStatus status = configureQueueSync(queueId, options);
+    if (!status) {
+        return status.result();  // RETURN
+    }
+
+    int numFetched = 0;
+    while (numFetched < maxCount) {
+        const bsls::TimeInterval remaining =
+            deadline - bsls::SystemTime::nowMonotonicClock();
+        if (remaining <= bsls::TimeInterval()) {
+            break;  // BREAK
+        }
+
+        Event                           event;
+        bsl::shared_ptr<bmqimp::Event>& eventImplSpRef =
+            reinterpret_cast<bsl::shared_ptr<bmqimp::Event>&>(event);
+        eventImplSpRef = d_impl.d_application_mp->brokerSession().nextEvent(
+            remaining);
+
+        if (event.isSessionEvent() &&
+            event.sessionEvent().type() ==
+                bmqt::SessionEventType::e_TIMEOUT) {
+            break;  // BREAK
+        }
+
+        if (!event.isMessageEvent() ||
+            event.messageEvent().type() != bmqt::MessageEventType::e_PUSH) {
+            // Keep it for 'nextEvent'
+            bslmt::LockGuard<bslmt::Mutex> guard(
+                &d_impl.d_pendingEventsMutex);  // LOCK
+            d_impl.d_pendingEvents.push_back(event);
+            continue;  // CONTINUE
+        }
+
+        MessageIterator it = event.messageEvent().messageIterator();
+        while (it.nextMessage()) {
+            BSLS_ASSERT_SAFE(it.message().queueId() == *queueId);
+            messages->push_back(it.message().clone(d_impl.d_allocator_p));
+            ++numFetched;
+        }
+    }
+
+    // Close the window so that no message is prefetched until the next call.
+    options.setMaxUnconfirmedMessages(0);
+    status = configureQueueSync(queueId, options);
+    if (!status) {
+        BALL_LOG_WARN << "Failed to close the window of the queue after "
+                      << "fetching messages [queue: " << queueId->uri()
+                      << ", status: " << status << "]";
+    }
+
+    return 0;
+}
+
 int Session::post(const MessageEvent& event)
 {
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
@@ -201,6 +201,12 @@
 // proper synchronization logic to protect the internal event queue from
 // corruption in this scenario.
 //
+// Latency-critical applications dedicating cores to the reception of messages
+// can instead poll for events with the non-blocking 'tryNextEvent' method,
+// or set 'bmqt::SessionOptions::eventQueueSpinCount' to have 'nextEvent'
+// spin on the event queue before blocking, and bind the IO thread of the
+// session to a core with 'bmqt::SessionOptions::ioThreadCpu'.
+//
 /// Example 2
 ///- - - - -
 // The following example demonstrates how to write a function that queries and
@@ -508,6 +514,8 @@
 #include <bmqa_closequeuestatus.h>
 #include <bmqa_configurequeuestatus.h>
 #include <bmqa_confirmeventbuilder.h>
+#include <bmqa_event.h>
+#include <bmqa_message.h>
 #include <bmqa_messageeventbuilder.h>
 #include <bmqa_openqueuestatus.h>
 #include <bmqt_queueoptions.h>
@@ -516,12 +524,15 @@
 
 // BDE
 #include <ball_log.h>
+#include <bsl_deque.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_mutex.h>
 #include <bsls_keyword.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
@@ -604,6 +615,15 @@ struct SessionImpl {
     bslma::ManagedPtr<bmqimp::Application> d_application_mp;
     // The application object.
 
+    bsl::deque<Event> d_pendingEvents;
+    // Events received while fetching
+    // messages, and not yet returned by
+    // 'nextEvent' or 'tryNextEvent'.
+
+    bslmt::Mutex d_pendingEventsMutex;
+    // Mutex protecting
+    // 'd_pendingEvents'.
+
   private:
     // NOT IMPLEMENTED
     SessionImpl(const SessionImpl&) BSLS_KEYWORD_DELETED;
@@ -1041,6 +1061,39 @@ class Session : public AbstractSession {
     Event nextEvent(const bsls::TimeInterval& timeout = bsls::TimeInterval())
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Load into the specified `event` the next available event received
+    /// for this session and return 0, or return a non-zero value and leave
+    /// `event` unchanged without blocking if there is no event available.
+    /// Note that this method can only be used if the session is in
+    /// synchronous mode (ie not using the EventHandler).  The behavior is
+    /// undefined unless the session was started.
+    int tryNextEvent(Event* event) BSLS_KEYWORD_OVERRIDE;
+
+    /// Pull up to the specified `maxCount` messages from the queue
+    /// identified by the specified `queueId`, waiting up to the specified
+    /// `maxWait` for them to arrive, and append them to the specified
+    /// `messages`.  Return 0 on success (even if less than `maxCount`, or
+    /// no, messages arrived in time), or a non-zero value of the
+    /// `bmqt::ConfigureQueueResult::Enum` enum otherwise.  The queue is
+    /// reconfigured with a window of `maxCount` unconfirmed messages for
+    /// the duration of the call, so that the broker pushes exactly the
+    /// messages requested, and then with an empty window, so that no
+    /// message is prefetched between calls.  The events, other than the
+    /// `PUSH` events of the queue, received during the call are returned
+    /// by the next calls to `nextEvent` or `tryNextEvent`.  Note that the
+    /// unconfirmed messages previously received from the queue count
+    /// against `maxCount`: they should be confirmed before calling this
+    /// method.  Also note that this method can only be used if the session
+    /// is in synchronous mode (ie not using the EventHandler), and returns
+    /// `bmqt::ConfigureQueueResult::e_NOT_SUPPORTED` otherwise.  The
+    /// behavior is undefined unless the session was started, `queueId`
+    /// was opened for reading, `0 < maxCount`, and no other queue of this
+    /// session has a non-empty window.
+    int fetch(bsl::vector<Message>*     messages,
+              QueueId*                  queueId,
+              int                       maxCount,
+              const bsls::TimeInterval& maxWait);
+
     /// Asynchronously post the specified `event` that must contain one or
     /// more `Messages`.  The return value is one of the values defined in
     /// the `bmqt::PostResult::Enum` enum.  Return zero on success and a
@@ -0,0 +1,148 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqa_sessionfutureutil.cpp                                         -*-C++-*-
+#include <bmqa_sessionfutureutil.h>
+
+#include <bmqscm_version.h>
+// MWC
+#include <mwcex_promise.h>
+
+// BDE
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+#include <bsl_memory.h>
+#include <bslma_default.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace bmqa {
+
+namespace {
+
+/// Make the specified `promise` ready with the specified `status`.
+template <class STATUS>
+void setPromiseValue(const bsl::shared_ptr<mwcex::Promise<STATUS> >& promise,
+                     const STATUS&                                   status)
+{
+    promise->setValue(status);
+}
+
+/// Return a new promise of a result of the specified `STATUS` type, using
+/// the specified `allocator`.
+template <class STATUS>
+bsl::shared_ptr<mwcex::Promise<STATUS> >
+createPromise(bslma::Allocator* allocator)
+{
+    bsl::shared_ptr<mwcex::Promise<STATUS> > promise;
+    promise.createInplace(allocator, allocator);
+    return promise;
+}
+
+}  // close unnamed namespace
+
+// ------------------------
+// struct SessionFutureUtil
+// ------------------------
+
+// CLASS METHODS
+mwcex::Future<OpenQueueStatus>
+SessionFutureUtil::openQueue(AbstractSession*          session,
+                             QueueId*                  queueId,
+                             const bmqt::Uri&          uri,
+                             bsls::Types::Uint64       flags,
+                             const bmqt::QueueOptions& options,
+                             const bsls::TimeInterval& timeout,
+                             bslma::Allocator*         allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(session);
+    BSLS_ASSERT_SAFE(queueId);
+
+    allocator = bslma::Default::allocator(allocator);
+
+    bsl::shared_ptr<mwcex::Promise<OpenQueueStatus> > promise =
+        createPromise<OpenQueueStatus>(allocator);
+    mwcex::Future<OpenQueueStatus> future = promise->future();
+
+    session->openQueueAsync(
+        queueId,
+        uri,
+        flags,
+        bdlf::BindUtil::bind(&setPromiseValue<OpenQueueStatus>,
+                             promise,
+                             bdlf::PlaceHolders::_1),  // status
+        options,
+        timeout);
+
+    return future;
+}
+
+mwcex::Future<ConfigureQueueStatus>
+SessionFutureUtil::configureQueue(AbstractSession*          session,
+                                  QueueId*                  queueId,
+                                  const bmqt::QueueOptions& options,
+                                  const bsls::TimeInterval& timeout,
+                                  bslma::Allocator*         allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(session);
+    BSLS_ASSERT_SAFE(queueId);
+
+    allocator = bslma::Default::allocator(allocator);
+
+    bsl::shared_ptr<mwcex::Promise<ConfigureQueueStatus> > promise =
+        createPromise<ConfigureQueueStatus>(allocator);
+    mwcex::Future<ConfigureQueueStatus> future = promise->future();
+
+    session->configureQueueAsync(
+        queueId,
+        options,
+        bdlf::BindUtil::bind(&setPromiseValue<ConfigureQueueStatus>,
+                             promise,
+                             bdlf::PlaceHolders::_1),  // status
+        timeout);
+
+    return future;
+}
+
+mwcex::Future<CloseQueueStatus>
+SessionFutureUtil::closeQueue(AbstractSession*          session,
+                              QueueId*                  queueId,
+                              const bsls::TimeInterval& timeout,
+                              bslma::Allocator*         allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(session);
+    BSLS_ASSERT_SAFE(queueId);
+
+    allocator = bslma::Default::allocator(allocator);
+
+    bsl::shared_ptr<mwcex::Promise<CloseQueueStatus> > promise =
+        createPromise<CloseQueueStatus>(allocator);
+    mwcex::Future<CloseQueueStatus> future = promise->future();
+
+    session->closeQueueAsync(
+        queueId,
+        bdlf::BindUtil::bind(&setPromiseValue<CloseQueueStatus>,
+                             promise,
+                             bdlf::PlaceHolders::_1),  // status
+        timeout);
+
+    return future;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,180 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqa_sessionfutureutil.h                                           -*-C++-*-
+#ifndef INCLUDED_BMQA_SESSIONFUTUREUTIL
+#define INCLUDED_BMQA_SESSIONFUTUREUTIL
+
+//@PURPOSE: Provide future-returning flavors of the async queue operations.
+//
+//@CLASSES:
+//  bmqa::SessionFutureUtil: future-returning open/configure/close queue
+//
+//@SEE ALSO:
+//  bmqa_abstractsession, mwcex_future, mwcex_coroutine
+//
+//@DESCRIPTION: This component provides a utility, 'bmqa::SessionFutureUtil',
+// exposing flavors of the 'openQueueAsync', 'configureQueueAsync' and
+// 'closeQueueAsync' operations of a 'bmqa::AbstractSession' which, instead of
+// taking a callback, return a 'mwcex::Future' made ready with the status of
+// the operation once it completes.
+//
+// This allows an application hosting many queues to issue all its open (or
+// configure) requests at once, and then to either wait for all of them, or
+// chain a continuation to each of them with 'mwcex::Future::whenReady',
+// without dedicating a thread to each outstanding request.  When compiling
+// as C++20 with coroutine support (i.e., if 'MWCEX_COROUTINE_SUPPORTED' is
+// defined, see 'mwcex_coroutine'), the returned futures can also be awaited
+// from a coroutine with 'co_await'.  This component remains usable from
+// C++03, in which case only the futures are provided.
+//
+/// Thread Safety
+///-------------
+// The futures are made ready from the thread invoking the callback of the
+// underlying async operation (i.e. from the EventHandler thread(s), or from
+// the thread invoking 'nextEvent' if no 'bmqa::SessionEventHandler' was
+// specified).  Therefore, waiting on a returned future from the EventHandler
+// thread(s) *WILL* lead to a *DEADLOCK*, and continuations attached with
+// 'whenReady' are invoked from that thread, and should not block.
+//
+/// Usage
+///-----
+// The following example illustrates how to open several queues concurrently,
+// then wait for all of them to be opened.
+//..
+//  bsl::vector<mwcex::Future<bmqa::OpenQueueStatus> > futures;
+//  for (size_t i = 0; i < uris.size(); ++i) {
+//      futures.push_back(bmqa::SessionFutureUtil::openQueue(
+//                                                  &session,
+//                                                  &queueIds[i],
+//                                                  uris[i],
+//                                                  bmqt::QueueFlags::e_READ));
+//  }
+//
+//  for (size_t i = 0; i < futures.size(); ++i) {
+//      const bmqa::OpenQueueStatus& status = futures[i].get();
+//      if (!status) {
+//          bsl::cerr << "Failed to open queue: " << status << bsl::endl;
+//      }
+//  }
+//..
+// With coroutine support, a queue can be opened then configured from a
+// coroutine, without blocking any thread while the requests are pending.
+//..
+//  #ifdef MWCEX_COROUTINE_SUPPORTED
+//  mwcex::Future<int> openAndConfigure(bmqa::AbstractSession    *session,
+//                                      bmqa::QueueId            *queueId,
+//                                      const bmqt::Uri&          uri,
+//                                      const bmqt::QueueOptions& options)
+//  {
+//      bmqa::OpenQueueStatus openStatus =
+//          co_await bmqa::SessionFutureUtil::openQueue(
+//                                                  session,
+//                                                  queueId,
+//                                                  uri,
+//                                                  bmqt::QueueFlags::e_READ);
+//      if (!openStatus) {
+//          co_return openStatus.result();                            // RETURN
+//      }
+//
+//      bmqa::ConfigureQueueStatus configureStatus =
+//          co_await bmqa::SessionFutureUtil::configureQueue(session,
+//                                                           queueId,
+//                                                           options);
+//      co_return configureStatus.result();
+//  }
+//  #endif
+//..
+
+// BMQA
+#include <bmqa_abstractsession.h>
+#include <bmqa_closequeuestatus.h>
+#include <bmqa_configurequeuestatus.h>
+#include <bmqa_openqueuestatus.h>
+#include <bmqa_queueid.h>
+
+// BMQ
+#include <bmqt_queueoptions.h>
+#include <bmqt_uri.h>
+
+// MWC
+#include <mwcex_coroutine.h>
+#include <mwcex_future.h>
+
+// BDE
+#include <bslma_allocator.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bmqa {
+
+// ========================
+// struct SessionFutureUtil
+// ========================
+
+/// Future-returning flavors of the async queue operations of a session.
+struct SessionFutureUtil {
+    // CLASS METHODS
+
+    /// Asynchronously open, on the specified `session`, the queue having
+    /// the specified `uri` with the specified `flags`, using the optionally
+    /// specified `options` and `timeout`, as with
+    /// `AbstractSession::openQueueAsync`, and populate the specified
+    /// `queueId` with the resulting queue identifier.  Return a future made
+    /// ready with the status of the operation once it completes.
+    /// Optionally specify an `allocator` used to supply memory.  If
+    /// `allocator` is 0, the currently installed default allocator is used.
+    static mwcex::Future<OpenQueueStatus>
+    openQueue(AbstractSession*          session,
+              QueueId*                  queueId,
+              const bmqt::Uri&          uri,
+              bsls::Types::Uint64       flags,
+              const bmqt::QueueOptions& options   = bmqt::QueueOptions(),
+              const bsls::TimeInterval& timeout   = bsls::TimeInterval(),
+              bslma::Allocator*         allocator = 0);
+
+    /// Asynchronously configure, on the specified `session`, the queue
+    /// identified by the specified `queueId` using the specified `options`
+    /// and the optionally specified `timeout`, as with
+    /// `AbstractSession::configureQueueAsync`.  Return a future made ready
+    /// with the status of the operation once it completes.  Optionally
+    /// specify an `allocator` used to supply memory.  If `allocator` is 0,
+    /// the currently installed default allocator is used.
+    static mwcex::Future<ConfigureQueueStatus>
+    configureQueue(AbstractSession*          session,
+                   QueueId*                  queueId,
+                   const bmqt::QueueOptions& options,
+                   const bsls::TimeInterval& timeout   = bsls::TimeInterval(),
+                   bslma::Allocator*         allocator = 0);
+
+    /// Asynchronously close, on the specified `session`, the queue
+    /// identified by the specified `queueId` using the optionally specified
+    /// `timeout`, as with `AbstractSession::closeQueueAsync`.  Return a
+    /// future made ready with the status of the operation once it
+    /// completes.  Optionally specify an `allocator` used to supply memory.
+    /// If `allocator` is 0, the currently installed default allocator is
+    /// used.
+    static mwcex::Future<CloseQueueStatus>
+    closeQueue(AbstractSession*          session,
+               QueueId*                  queueId,
+               const bsls::TimeInterval& timeout   = bsls::TimeInterval(),
+               bslma::Allocator*         allocator = 0);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,409 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqa_sessionfutureutil.t.cpp                                       -*-C++-*-
+#include <bmqa_sessionfutureutil.h>
+
+// BMQ
+#include <bmqt_correlationid.h>
+#include <bmqt_queueflags.h>
+#include <bmqt_resultcode.h>
+
+// BDE
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+#include <bsls_annotation.h>
+#include <bsls_platform.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+#if defined(BSLS_PLATFORM_CMP_CLANG)
+#pragma clang diagnostic ignored "-Wweak-vtables"
+#endif  // BSLS_PLATFORM_CMP_CLANG
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Session recording the callbacks of the async queue operations, so that
+/// the test driver can later invoke them.
+class TestSession : public bmqa::AbstractSession {
+  public:
+    // PUBLIC DATA
+    bsl::vector<OpenQueueCallback> d_openQueueCallbacks;
+
+    bsl::vector<ConfigureQueueCallback> d_configureQueueCallbacks;
+
+    bsl::vector<CloseQueueCallback> d_closeQueueCallbacks;
+
+    // CREATORS
+    explicit TestSession(bslma::Allocator* allocator)
+    : d_openQueueCallbacks(allocator)
+    , d_configureQueueCallbacks(allocator)
+    , d_closeQueueCallbacks(allocator)
+    {
+        // NOTHING
+    }
+
+    // MANIPULATORS
+    using bmqa::AbstractSession::closeQueueAsync;
+    using bmqa::AbstractSession::configureQueueAsync;
+    using bmqa::AbstractSession::openQueueAsync;
+
+    void openQueueAsync(BSLS_ANNOTATION_UNUSED bmqa::QueueId* queueId,
+                        BSLS_ANNOTATION_UNUSED const bmqt::Uri& uri,
+                        BSLS_ANNOTATION_UNUSED bsls::Types::Uint64 flags,
+                        const OpenQueueCallback& callback,
+                        BSLS_ANNOTATION_UNUSED const bmqt::QueueOptions&
+                                                   options,
+                        BSLS_ANNOTATION_UNUSED const bsls::TimeInterval&
+                                                   timeout)
+        BSLS_KEYWORD_OVERRIDE
+    {
+        d_openQueueCallbacks.push_back(callback);
+    }
+
+    void configureQueueAsync(BSLS_ANNOTATION_UNUSED bmqa::QueueId* queueId,
+                             BSLS_ANNOTATION_UNUSED const bmqt::QueueOptions&
+                                                           options,
+                             const ConfigureQueueCallback& callback,
+                             BSLS_ANNOTATION_UNUSED const bsls::TimeInterval&
+                                                           timeout)
+        BSLS_KEYWORD_OVERRIDE
+    {
+        d_configureQueueCallbacks.push_back(callback);
+    }
+
+    void closeQueueAsync(BSLS_ANNOTATION_UNUSED bmqa::QueueId* queueId,
+                         const CloseQueueCallback&             callback,
+                         BSLS_ANNOTATION_UNUSED const bsls::TimeInterval&
+                                                               timeout)
+        BSLS_KEYWORD_OVERRIDE
+    {
+        d_closeQueueCallbacks.push_back(callback);
+    }
+};
+
+#ifdef MWCEX_COROUTINE_SUPPORTED
+/// Open, on the specified `session`, the queue having the specified `uri`
+/// and populate the specified `queueId`, then configure the queue.  Return
+/// the result of the open operation if it failed, and the result of the
+/// configure operation otherwise.  Use the specified `allocator` to supply
+/// memory.
+mwcex::Future<int> openAndConfigure(bsl::allocator_arg_t,
+                                    bslma::Allocator*      allocator,
+                                    bmqa::AbstractSession* session,
+                                    bmqa::QueueId*         queueId,
+                                    const bmqt::Uri&       uri)
+{
+    const bmqa::OpenQueueStatus openStatus =
+        co_await bmqa::SessionFutureUtil::openQueue(session,
+                                                    queueId,
+                                                    uri,
+                                                    bmqt::QueueFlags::e_READ,
+                                                    bmqt::QueueOptions(),
+                                                    bsls::TimeInterval(),
+                                                    allocator);
+    if (!openStatus) {
+        co_return openStatus.result();  // RETURN
+    }
+
+    const bmqa::ConfigureQueueStatus configureStatus =
+        co_await bmqa::SessionFutureUtil::configureQueue(session,
+                                                         queueId,
+                                                         bmqt::QueueOptions(),
+                                                         bsls::TimeInterval(),
+                                                         allocator);
+    co_return configureStatus.result();
+}
+#endif
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   1. The future returned by each operation is not ready until the
+//      callback of the underlying async operation is invoked.
+//   2. The future is then made ready with the status of the operation.
+//
+// Testing:
+//   openQueue
+//   configureQueue
+//   closeQueue
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    TestSession     session(s_allocator_p);
+    bmqa::QueueId   queueId(bmqt::CorrelationId(1), s_allocator_p);
+    const bmqt::Uri uri("bmq://bmq.test.mem.priority/queue", s_allocator_p);
+
+    {
+        PV("Open queue");
+
+        mwcex::Future<bmqa::OpenQueueStatus> future =
+            bmqa::SessionFutureUtil::openQueue(&session,
+                                               &queueId,
+                                               uri,
+                                               bmqt::QueueFlags::e_READ,
+                                               bmqt::QueueOptions(),
+                                               bsls::TimeInterval(),
+                                               s_allocator_p);
+
+        ASSERT(future.isValid());
+        ASSERT(!future.isReady());
+        ASSERT_EQ(session.d_openQueueCallbacks.size(), 1u);
+
+        session.d_openQueueCallbacks[0](
+            bmqa::OpenQueueStatus(queueId,
+                                  bmqt::OpenQueueResult::e_TIMEOUT,
+                                  "timeout",
+                                  s_allocator_p));
+
+        ASSERT(future.isReady());
+        ASSERT_EQ(future.get().result(), bmqt::OpenQueueResult::e_TIMEOUT);
+        ASSERT_EQ(future.get().errorDescription(), "timeout");
+        ASSERT_EQ(future.get().queueId(), queueId);
+    }
+
+    {
+        PV("Configure queue");
+
+        mwcex::Future<bmqa::ConfigureQueueStatus> future =
+            bmqa::SessionFutureUtil::configureQueue(&session,
+                                                    &queueId,
+                                                    bmqt::QueueOptions(),
+                                                    bsls::TimeInterval(),
+                                                    s_allocator_p);
+
+        ASSERT(!future.isReady());
+        ASSERT_EQ(session.d_configureQueueCallbacks.size(), 1u);
+
+        session.d_configureQueueCallbacks[0](
+            bmqa::ConfigureQueueStatus(queueId,
+                                       bmqt::ConfigureQueueResult::e_SUCCESS,
+                                       "",
+                                       s_allocator_p));
+
+        ASSERT(future.isReady());
+        ASSERT_EQ(future.get().result(),
+                  bmqt::ConfigureQueueResult::e_SUCCESS);
+    }
+
+    {
+        PV("Close queue");
+
+        mwcex::Future<bmqa::CloseQueueStatus> future =
+            bmqa::SessionFutureUtil::closeQueue(&session,
+                                                &queueId,
+                                                bsls::TimeInterval(),
+                                                s_allocator_p);
+
+        ASSERT(!future.isReady());
+        ASSERT_EQ(session.d_closeQueueCallbacks.size(), 1u);
+
+        session.d_closeQueueCallbacks[0](
+            bmqa::CloseQueueStatus(queueId,
+                                   bmqt::CloseQueueResult::e_SUCCESS,
+                                   "",
+                                   s_allocator_p));
+
+        ASSERT(future.isReady());
+        ASSERT_EQ(future.get().result(), bmqt::CloseQueueResult::e_SUCCESS);
+    }
+}
+
+static void test2_concurrentRequests()
+// ------------------------------------------------------------------------
+// CONCURRENT REQUESTS
+//
+// Concerns:
+//   Several operations can be outstanding at the same time, and each
+//   future is made ready independently, in the order of completion of its
+//   operation.
+//
+// Testing:
+//   openQueue
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("CONCURRENT REQUESTS");
+
+    const int k_NUM_QUEUES = 10;
+
+    TestSession     session(s_allocator_p);
+    const bmqt::Uri uri("bmq://bmq.test.mem.priority/queue", s_allocator_p);
+
+    bsl::vector<bmqa::QueueId> queueIds(s_allocator_p);
+    for (int i = 0; i < k_NUM_QUEUES; ++i) {
+        queueIds.push_back(
+            bmqa::QueueId(static_cast<bsls::Types::Int64>(i), s_allocator_p));
+    }
+
+    bsl::vector<mwcex::Future<bmqa::OpenQueueStatus> > futures(
+        s_allocator_p);
+    for (int i = 0; i < k_NUM_QUEUES; ++i) {
+        futures.push_back(
+            bmqa::SessionFutureUtil::openQueue(&session,
+                                               &queueIds[i],
+                                               uri,
+                                               bmqt::QueueFlags::e_WRITE,
+                                               bmqt::QueueOptions(),
+                                               bsls::TimeInterval(),
+                                               s_allocator_p));
+    }
+    ASSERT_EQ(session.d_openQueueCallbacks.size(),
+              static_cast<size_t>(k_NUM_QUEUES));
+
+    // Complete the requests in reverse order
+    for (int i = k_NUM_QUEUES - 1; i >= 0; --i) {
+        ASSERT(!futures[i].isReady());
+
+        session.d_openQueueCallbacks[i](
+            bmqa::OpenQueueStatus(queueIds[i],
+                                  bmqt::OpenQueueResult::e_SUCCESS,
+                                  "",
+                                  s_allocator_p));
+
+        ASSERT(futures[i].isReady());
+        ASSERT_EQ(futures[i].get().queueId(), queueIds[i]);
+        if (i > 0) {
+            ASSERT(!futures[i - 1].isReady());
+        }
+    }
+}
+
+static void test3_coroutine()
+// ------------------------------------------------------------------------
+// COROUTINE
+//
+// Concerns:
+//   If coroutines are supported, the returned futures can be awaited from
+//   a coroutine, which is resumed with the status of the operation once
+//   it completes.
+//
+// Plan:
+//   1. Call a coroutine awaiting an open then a configure operation, and
+//      complete both operations successfully: verify that each operation
+//      is issued only once the previous one completed, and that the
+//      coroutine completes with the result of the configure operation.
+//   2. Call the coroutine again and fail the open operation: verify that
+//      the coroutine completes with the result of the open operation,
+//      without issuing the configure operation.
+//
+// Testing:
+//   openQueue
+//   configureQueue
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("COROUTINE");
+
+#ifdef MWCEX_COROUTINE_SUPPORTED
+    TestSession     session(s_allocator_p);
+    bmqa::QueueId   queueId(bmqt::CorrelationId(1), s_allocator_p);
+    const bmqt::Uri uri("bmq://bmq.test.mem.priority/queue", s_allocator_p);
+
+    {
+        PV("Open and configure");
+
+        mwcex::Future<int> future = openAndConfigure(bsl::allocator_arg,
+                                                     s_allocator_p,
+                                                     &session,
+                                                     &queueId,
+                                                     uri);
+
+        // The coroutine is suspended pending the open operation
+        ASSERT(!future.isReady());
+        ASSERT_EQ(session.d_openQueueCallbacks.size(), 1u);
+        ASSERT_EQ(session.d_configureQueueCallbacks.size(), 0u);
+
+        session.d_openQueueCallbacks[0](
+            bmqa::OpenQueueStatus(queueId,
+                                  bmqt::OpenQueueResult::e_SUCCESS,
+                                  "",
+                                  s_allocator_p));
+
+        // The coroutine is suspended pending the configure operation
+        ASSERT(!future.isReady());
+        ASSERT_EQ(session.d_configureQueueCallbacks.size(), 1u);
+
+        session.d_configureQueueCallbacks[0](
+            bmqa::ConfigureQueueStatus(queueId,
+                                       bmqt::ConfigureQueueResult::e_SUCCESS,
+                                       "",
+                                       s_allocator_p));
+
+        ASSERT(future.isReady());
+        ASSERT_EQ(future.get(), bmqt::ConfigureQueueResult::e_SUCCESS);
+    }
+
+    {
+        PV("Open failure");
+
+        mwcex::Future<int> future = openAndConfigure(bsl::allocator_arg,
+                                                     s_allocator_p,
+                                                     &session,
+                                                     &queueId,
+                                                     uri);
+
+        ASSERT(!future.isReady());
+        ASSERT_EQ(session.d_openQueueCallbacks.size(), 2u);
+
+        session.d_openQueueCallbacks[1](
+            bmqa::OpenQueueStatus(queueId,
+                                  bmqt::OpenQueueResult::e_TIMEOUT,
+                                  "timeout",
+                                  s_allocator_p));
+
+        ASSERT(future.isReady());
+        ASSERT_EQ(future.get(), bmqt::OpenQueueResult::e_TIMEOUT);
+        ASSERT_EQ(session.d_configureQueueCallbacks.size(), 1u);
+    }
+#endif
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_coroutine(); break;
+    case 2: test2_concurrentRequests(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_GBL_ALLOC);
+}
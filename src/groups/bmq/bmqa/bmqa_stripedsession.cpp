@@ -0,0 +1,215 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqa_stripedsession.cpp                                            -*-C++-*-
+#include <bmqa_stripedsession.h>
+
+#include <bmqscm_version.h>
+// BMQ
+#include <bmqa_messageevent.h>
+#include <bmqa_sessionevent.h>
+
+// BDE
+#include <bslh_hash.h>
+#include <bslma_managedptr.h>
+#include <bslmt_lockguard.h>
+#include <bsls_annotation.h>
+
+namespace BloombergLP {
+namespace bmqa {
+
+namespace {
+
+// ========================
+// class StripeEventHandler
+// ========================
+
+/// Event handler of one stripe, forwarding all events to the event handler
+/// shared by all stripes.
+class StripeEventHandler : public SessionEventHandler {
+  private:
+    // DATA
+    SessionEventHandler* d_eventHandler_p;
+    // Event handler shared by all
+    // stripes, held not owned.
+
+  public:
+    // CREATORS
+
+    /// Create an object forwarding all events to the specified
+    /// `eventHandler`.
+    explicit StripeEventHandler(SessionEventHandler* eventHandler)
+    : d_eventHandler_p(eventHandler)
+    {
+        // NOTHING
+    }
+
+    // MANIPULATORS
+    void onSessionEvent(const SessionEvent& event) BSLS_KEYWORD_OVERRIDE
+    {
+        d_eventHandler_p->onSessionEvent(event);
+    }
+
+    void onMessageEvent(const MessageEvent& event) BSLS_KEYWORD_OVERRIDE
+    {
+        d_eventHandler_p->onMessageEvent(event);
+    }
+};
+
+}  // close unnamed namespace
+
+// --------------------
+// class StripedSession
+// --------------------
+
+// CREATORS
+StripedSession::StripedSession(int                         numStripes,
+                               const bmqt::SessionOptions& options,
+                               bslma::Allocator*           allocator)
+: d_allocator_p(bslma::Default::allocator(allocator))
+, d_stripes(d_allocator_p)
+, d_isAsync(false)
+, d_assignmentsLock()
+, d_assignments(d_allocator_p)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(0 < numStripes);
+
+    d_stripes.reserve(numStripes);
+    for (int i = 0; i < numStripes; ++i) {
+        SessionSp session;
+        session.createInplace(d_allocator_p, options, d_allocator_p);
+        d_stripes.push_back(session);
+    }
+}
+
+StripedSession::StripedSession(int                         numStripes,
+                               SessionEventHandler*        eventHandler,
+                               const bmqt::SessionOptions& options,
+                               bslma::Allocator*           allocator)
+: d_allocator_p(bslma::Default::allocator(allocator))
+, d_stripes(d_allocator_p)
+, d_isAsync(true)
+, d_assignmentsLock()
+, d_assignments(d_allocator_p)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(0 < numStripes);
+    BSLS_ASSERT_OPT(eventHandler);
+
+    d_stripes.reserve(numStripes);
+    for (int i = 0; i < numStripes; ++i) {
+        bslma::ManagedPtr<SessionEventHandler> handler(
+            new (*d_allocator_p) StripeEventHandler(eventHandler),
+            d_allocator_p);
+
+        SessionSp session;
+        session.createInplace(d_allocator_p, handler, options, d_allocator_p);
+        d_stripes.push_back(session);
+    }
+}
+
+StripedSession::~StripedSession()
+{
+    // Destroy the sessions in the reverse order of their creation
+    while (!d_stripes.empty()) {
+        d_stripes.pop_back();
+    }
+}
+
+// MANIPULATORS
+int StripedSession::start(const bsls::TimeInterval& timeout)
+{
+    for (size_t i = 0; i < d_stripes.size(); ++i) {
+        const int rc = d_stripes[i]->start(timeout);
+        if (rc != 0) {
+            // Stop the sessions already started
+            for (size_t j = 0; j < i; ++j) {
+                if (d_isAsync) {
+                    d_stripes[j]->stop();
+                }
+                else {
+                    d_stripes[j]->stopAsync();
+                }
+            }
+            return rc;  // RETURN
+        }
+    }
+
+    return 0;
+}
+
+int StripedSession::startAsync(const bsls::TimeInterval& timeout)
+{
+    for (size_t i = 0; i < d_stripes.size(); ++i) {
+        const int rc = d_stripes[i]->startAsync(timeout);
+        if (rc != 0) {
+            return rc;  // RETURN
+        }
+    }
+
+    return 0;
+}
+
+void StripedSession::stop()
+{
+    for (size_t i = 0; i < d_stripes.size(); ++i) {
+        d_stripes[i]->stop();
+    }
+}
+
+void StripedSession::stopAsync()
+{
+    for (size_t i = 0; i < d_stripes.size(); ++i) {
+        d_stripes[i]->stopAsync();
+    }
+}
+
+int StripedSession::assignQueue(const bmqt::Uri& uri, int stripeIndex)
+{
+    if (stripeIndex < 0 || stripeIndex >= numStripes()) {
+        return -1;  // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_assignmentsLock);  // LOCK
+    d_assignments[uri.canonical()] = stripeIndex;
+
+    return 0;
+}
+
+// ACCESSORS
+int StripedSession::stripeIndex(const bmqt::Uri& uri) const
+{
+    const bslstl::StringRef canonical = uri.canonical();
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_assignmentsLock);  // LOCK
+        if (!d_assignments.empty()) {
+            AssignmentsMap::const_iterator cit = d_assignments.find(
+                canonical);
+            if (cit != d_assignments.end()) {
+                return cit->second;  // RETURN
+            }
+        }
+    }
+
+    // Not explicitly assigned, hash the canonical URI (the default hash
+    // algorithm is not seeded, so that the assignment is stable)
+    const size_t hash = bslh::Hash<>()(canonical);
+    return static_cast<int>(hash % d_stripes.size());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,265 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqa_stripedsession.h                                              -*-C++-*-
+#ifndef INCLUDED_BMQA_STRIPEDSESSION
+#define INCLUDED_BMQA_STRIPEDSESSION
+
+//@PURPOSE: Provide a set of sessions striping queues over several channels.
+//
+//@CLASSES:
+//  bmqa::StripedSession: set of sessions to the same broker
+//
+//@DESCRIPTION: This component provides a mechanism, 'bmqa::StripedSession',
+// owning a fixed number of 'bmqa::Session' objects (the *stripes*), all
+// created with the same 'bmqt::SessionOptions' and therefore connecting to the
+// same broker, each over its own channel.  Each queue is assigned to exactly
+// one stripe, either explicitly (see 'assignQueue') or by hashing its
+// canonical URI, and all the operations on a queue (open, post, confirm,
+// configure, close) must be performed on the session of its stripe, obtained
+// with 'sessionFor'.
+//
+// A single 'bmqa::Session' multiplexes all its queues over one channel, which
+// is served by one IO thread in the client and one session in the broker.
+// Striping the queues of a high-throughput application over several sessions
+// allows to scale across several IO threads and TCP connections, on both the
+// client and the broker sides.  Since all the messages of a queue flow through
+// the same stripe, their ordering is preserved.
+//
+// Note that 'bmqa::MessageEventBuilder' and 'bmqa::ConfirmEventBuilder'
+// objects are bound to the session they are loaded from: an event must only
+// contain messages for queues of the stripe the builder was loaded from, and
+// must be posted on that very stripe.
+//
+/// Events
+///------
+// In asynchronous mode, all stripes deliver their events to the same
+// 'bmqa::SessionEventHandler', which is therefore invoked concurrently from
+// the threads of the different stripes and must be thread safe.  Session
+// events (e.g. 'CONNECTED', 'CONNECTION_LOST', 'STATE_RESTORED') are
+// delivered once per stripe.  Queue related events are delivered by the
+// stripe of the queue.
+//
+// In synchronous mode, the application must fetch the events of each stripe
+// with its 'nextEvent' method.
+//
+/// Thread-safety
+///-------------
+// This object is *thread* *enabled*, meaning that two threads can safely call
+// any methods on the *same* *instance* without external synchronization.
+//
+/// Usage
+///-----
+// The following example illustrates how to create a 'StripedSession' with 4
+// stripes in asynchronous mode, and open a queue on it.
+//..
+//  MyHandler            handler;   // thread-safe 'bmqa::SessionEventHandler'
+//  bmqa::StripedSession session(4, &handler, bmqt::SessionOptions());
+//
+//  int rc = session.start();
+//  if (rc != 0) {
+//      bsl::cerr << "Failed to start the session: " << rc << bsl::endl;
+//      return;                                                   // RETURN
+//  }
+//
+//  const bmqt::Uri uri("bmq://bmq.test.persistent.priority/my-queue");
+//  bmqa::Session&  stripe = session.sessionFor(uri);
+//
+//  bmqa::QueueId          queueId(bmqt::CorrelationId::autoValue());
+//  bmqa::OpenQueueStatus  status = stripe.openQueueSync(
+//                                                 &queueId,
+//                                                 uri,
+//                                                 bmqt::QueueFlags::e_WRITE);
+//
+//  bmqa::MessageEventBuilder builder;
+//  stripe.loadMessageEventBuilder(&builder);
+//  // ... pack messages for 'queueId', and post them on 'stripe'
+//..
+
+// BMQA
+#include <bmqa_session.h>
+
+// BMQ
+#include <bmqt_sessionoptions.h>
+#include <bmqt_uri.h>
+
+// BDE
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_mutex.h>
+#include <bsls_assert.h>
+#include <bsls_keyword.h>
+#include <bsls_timeinterval.h>
+
+namespace BloombergLP {
+namespace bmqa {
+
+// ====================
+// class StripedSession
+// ====================
+
+/// Set of sessions to the same broker, striping queues over their channels.
+class StripedSession {
+  private:
+    // PRIVATE TYPES
+    typedef bsl::shared_ptr<Session> SessionSp;
+
+    /// Map of canonical queue URI to the index of its stripe.
+    typedef bsl::unordered_map<bsl::string, int> AssignmentsMap;
+
+  private:
+    // DATA
+    bslma::Allocator* d_allocator_p;
+    // Allocator to use.
+
+    bsl::vector<SessionSp> d_stripes;
+    // Sessions, one per stripe.
+
+    bool d_isAsync;
+    // Whether the sessions are in asynchronous
+    // mode (i.e. have an event handler).
+
+    mutable bslmt::Mutex d_assignmentsLock;
+    // Mutex protecting 'd_assignments'.
+
+    AssignmentsMap d_assignments;
+    // Queues explicitly assigned to a
+    // stripe.
+
+  private:
+    // NOT IMPLEMENTED
+    StripedSession(const StripedSession&) BSLS_KEYWORD_DELETED;
+    StripedSession& operator=(const StripedSession&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(StripedSession, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a new `StripedSession` with the specified `numStripes`
+    /// sessions in *synchronous* mode, using the optionally specified
+    /// `options`.  Optionally specify an `allocator` used to supply memory.
+    /// If `allocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined unless `0 < numStripes`.
+    explicit StripedSession(
+        int                         numStripes,
+        const bmqt::SessionOptions& options   = bmqt::SessionOptions(),
+        bslma::Allocator*           allocator = 0);
+
+    /// Create a new `StripedSession` with the specified `numStripes`
+    /// sessions in *asynchronous* mode, delivering their events to the
+    /// specified `eventHandler`, using the optionally specified `options`.
+    /// Optionally specify an `allocator` used to supply memory.  If
+    /// `allocator` is 0, the currently installed default allocator is used.
+    /// The behavior is undefined unless `0 < numStripes`, and
+    /// `eventHandler` outlives this object and is thread safe.
+    StripedSession(
+        int                         numStripes,
+        SessionEventHandler*        eventHandler,
+        const bmqt::SessionOptions& options   = bmqt::SessionOptions(),
+        bslma::Allocator*           allocator = 0);
+
+    /// Destroy all the sessions of this object (which stops them).
+    ~StripedSession();
+
+    // MANIPULATORS
+
+    /// Start all the sessions of this object, as with `Session::start`,
+    /// using the optionally specified `timeout` for each of them.  Return 0
+    /// on success, or the non-zero value returned by the first session
+    /// which failed to start otherwise, in which case the sessions already
+    /// started have been stopped.
+    int start(const bsls::TimeInterval& timeout = bsls::TimeInterval());
+
+    /// Start all the sessions of this object, as with
+    /// `Session::startAsync`, using the optionally specified `timeout` for
+    /// each of them.  Return 0 on success, or the non-zero value returned
+    /// by the first session which failed to start otherwise.  Note that the
+    /// result of the connection of each session is communicated with a
+    /// session event.
+    int startAsync(const bsls::TimeInterval& timeout = bsls::TimeInterval());
+
+    /// Stop all the sessions of this object, as with `Session::stop`.  This
+    /// method must *NOT* be called if the sessions are in synchronous mode,
+    /// `stopAsync()` should be called in this case.
+    void stop();
+
+    /// Stop all the sessions of this object, as with `Session::stopAsync`.
+    void stopAsync();
+
+    /// Assign the queue having the specified `uri` to the stripe having the
+    /// specified `stripeIndex`, instead of the one resulting from the hash
+    /// of its URI.  Return 0 on success, or a non-zero value if
+    /// `stripeIndex` is not in the range `[0 .. numStripes() - 1]`.  The
+    /// behavior is undefined if the queue is currently opened.
+    int assignQueue(const bmqt::Uri& uri, int stripeIndex);
+
+    /// Return a reference offering modifiable access to the session of the
+    /// stripe the queue having the specified `uri` is assigned to.  Note
+    /// that this method is cheap but takes a lock, so that the result should
+    /// be cached by applications posting at high rate.
+    Session& sessionFor(const bmqt::Uri& uri);
+
+    /// Return a reference offering modifiable access to the session of the
+    /// stripe having the specified `index`.  The behavior is undefined
+    /// unless `0 <= index < numStripes()`.
+    Session& stripe(int index);
+
+    // ACCESSORS
+
+    /// Return the number of stripes of this object.
+    int numStripes() const;
+
+    /// Return the index of the stripe the queue having the specified `uri`
+    /// is assigned to.
+    int stripeIndex(const bmqt::Uri& uri) const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// --------------------
+// class StripedSession
+// --------------------
+
+inline Session& StripedSession::sessionFor(const bmqt::Uri& uri)
+{
+    return *d_stripes[stripeIndex(uri)];
+}
+
+inline Session& StripedSession::stripe(int index)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= index && index < numStripes());
+
+    return *d_stripes[index];
+}
+
+inline int StripedSession::numStripes() const
+{
+    return static_cast<int>(d_stripes.size());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,244 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqa_stripedsession.t.cpp                                          -*-C++-*-
+#include <bmqa_stripedsession.h>
+
+// BMQ
+#include <bmqa_messageevent.h>
+#include <bmqa_sessionevent.h>
+#include <bmqt_sessionoptions.h>
+#include <bmqt_uri.h>
+
+// BDE
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+// MWC
+#include <mwcu_memoutstream.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Event handler ignoring all events.
+class NoopEventHandler : public bmqa::SessionEventHandler {
+  public:
+    // MANIPULATORS
+    void onSessionEvent(const bmqa::SessionEvent&) BSLS_KEYWORD_OVERRIDE
+    {
+        // NOTHING
+    }
+
+    void onMessageEvent(const bmqa::MessageEvent&) BSLS_KEYWORD_OVERRIDE
+    {
+        // NOTHING
+    }
+};
+
+/// Return the URI of the queue having the specified `index`, using the
+/// specified `allocator`.
+bmqt::Uri queueUri(int index, bslma::Allocator* allocator)
+{
+    mwcu::MemOutStream os(allocator);
+    os << "bmq://bmq.test.mem.priority/queue" << index;
+    return bmqt::Uri(os.str(), allocator);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise the basic functionality of the component, without starting
+//   the sessions.
+//
+// Testing:
+//   StripedSession(int, options, allocator)
+//   StripedSession(int, eventHandler, options, allocator)
+//   numStripes
+//   stripe
+//   sessionFor
+//   stripeIndex
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    const bmqt::SessionOptions options(s_allocator_p);
+    const bmqt::Uri            uri(queueUri(0, s_allocator_p));
+
+    {
+        PV("Synchronous mode");
+
+        bmqa::StripedSession obj(3, options, s_allocator_p);
+
+        ASSERT_EQ(obj.numStripes(), 3);
+        ASSERT_NE(&obj.stripe(0), &obj.stripe(1));
+        ASSERT_NE(&obj.stripe(1), &obj.stripe(2));
+
+        const int index = obj.stripeIndex(uri);
+        ASSERT_LE(0, index);
+        ASSERT_LT(index, obj.numStripes());
+        ASSERT_EQ(&obj.sessionFor(uri), &obj.stripe(index));
+    }
+
+    {
+        PV("Asynchronous mode");
+
+        NoopEventHandler     handler;
+        bmqa::StripedSession obj(2, &handler, options, s_allocator_p);
+
+        ASSERT_EQ(obj.numStripes(), 2);
+        ASSERT_NE(&obj.stripe(0), &obj.stripe(1));
+        ASSERT_EQ(&obj.sessionFor(uri), &obj.stripe(obj.stripeIndex(uri)));
+    }
+
+    {
+        PV("Single stripe");
+
+        bmqa::StripedSession obj(1, options, s_allocator_p);
+
+        ASSERT_EQ(obj.numStripes(), 1);
+        ASSERT_EQ(obj.stripeIndex(uri), 0);
+    }
+}
+
+static void test2_hashAssignment()
+// ------------------------------------------------------------------------
+// HASH ASSIGNMENT
+//
+// Concerns:
+//   1. The stripe of a queue is stable, and does not depend on the
+//      StripedSession object.
+//   2. The stripe of a queue only depends on its canonical URI.
+//   3. Queues are spread over all the stripes.
+//
+// Testing:
+//   stripeIndex
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("HASH ASSIGNMENT");
+
+    const int k_NUM_STRIPES = 4;
+    const int k_NUM_QUEUES  = 400;
+
+    const bmqt::SessionOptions options(s_allocator_p);
+    bmqa::StripedSession       obj(k_NUM_STRIPES, options, s_allocator_p);
+    bmqa::StripedSession       other(k_NUM_STRIPES, options, s_allocator_p);
+
+    bsl::vector<int> counts(k_NUM_STRIPES, 0, s_allocator_p);
+    for (int i = 0; i < k_NUM_QUEUES; ++i) {
+        const bmqt::Uri uri(queueUri(i, s_allocator_p));
+
+        const int index = obj.stripeIndex(uri);
+        ASSERT_LE(0, index);
+        ASSERT_LT(index, k_NUM_STRIPES);
+        ASSERT_EQ(index, obj.stripeIndex(uri));
+        ASSERT_EQ(index, other.stripeIndex(uri));
+
+        ++counts[index];
+    }
+
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        PVV("Stripe " << i << ": " << counts[i] << " queues");
+        ASSERT_LT(0, counts[i]);
+    }
+
+    // The query part of a URI is not part of its canonical form
+    const bmqt::Uri uri("bmq://bmq.test.mem.priority/queue?id=foo",
+                        s_allocator_p);
+    const bmqt::Uri canonical(uri.canonical(), s_allocator_p);
+    ASSERT_EQ(obj.stripeIndex(uri), obj.stripeIndex(canonical));
+}
+
+static void test3_assignQueue()
+// ------------------------------------------------------------------------
+// ASSIGN QUEUE
+//
+// Concerns:
+//   1. A queue explicitly assigned to a stripe is reported on that
+//      stripe.
+//   2. Assigning a queue to an invalid stripe fails and has no effect.
+//   3. Assigning a queue does not affect the other queues.
+//
+// Testing:
+//   assignQueue
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("ASSIGN QUEUE");
+
+    const int k_NUM_STRIPES = 3;
+
+    const bmqt::SessionOptions options(s_allocator_p);
+    bmqa::StripedSession       obj(k_NUM_STRIPES, options, s_allocator_p);
+
+    const bmqt::Uri uri(queueUri(0, s_allocator_p));
+    const bmqt::Uri otherUri(queueUri(1, s_allocator_p));
+
+    const int initialIndex = obj.stripeIndex(uri);
+    const int otherIndex   = obj.stripeIndex(otherUri);
+    const int newIndex     = (initialIndex + 1) % k_NUM_STRIPES;
+
+    // Invalid stripes
+    ASSERT_NE(obj.assignQueue(uri, -1), 0);
+    ASSERT_NE(obj.assignQueue(uri, k_NUM_STRIPES), 0);
+    ASSERT_EQ(obj.stripeIndex(uri), initialIndex);
+
+    // Valid stripe
+    ASSERT_EQ(obj.assignQueue(uri, newIndex), 0);
+    ASSERT_EQ(obj.stripeIndex(uri), newIndex);
+    ASSERT_EQ(&obj.sessionFor(uri), &obj.stripe(newIndex));
+    ASSERT_EQ(obj.stripeIndex(otherUri), otherIndex);
+
+    // Reassign
+    ASSERT_EQ(obj.assignQueue(uri, initialIndex), 0);
+    ASSERT_EQ(obj.stripeIndex(uri), initialIndex);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_assignQueue(); break;
+    case 2: test2_hashAssignment(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_GBL_ALLOC);
+}
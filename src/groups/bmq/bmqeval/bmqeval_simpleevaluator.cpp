@@ -19,9 +19,593 @@
 #include <bmqeval_simpleevaluatorparser.hpp>
 #include <bmqeval_simpleevaluatorscanner.h>
 
+// BDE
+#include <bsl_algorithm.h>
+#include <bsl_deque.h>
+#include <bsl_limits.h>
+#include <bsl_vector.h>
+#include <bsls_assert.h>
+#include <bsls_keyword.h>
+#include <bslstl_stringref.h>
+
 namespace BloombergLP {
 namespace bmqeval {
 
+// ==============================
+// class SimpleEvaluator::Program
+// ==============================
+
+/// Flat, register-based bytecode of an expression.  Registers are
+/// allocated once for all at compile time: constant registers hold the
+/// literals of the expression, and every other register is written by a
+/// single instruction, so that evaluating an expression only requires a
+/// copy of the initial registers, and a loop over the instructions.
+class SimpleEvaluator::Program {
+  public:
+    // PUBLIC TYPES
+
+    /// Type of the value of a register.  At compile time, `e_OTHER` means
+    /// that the type is not known until evaluation.
+    enum Type { e_BOOL, e_INT, e_STRING, e_OTHER };
+
+    /// Value of a register.
+    struct Value {
+        // DATA
+        Type d_type;
+
+        // The length of 'd_string_p', if 'd_type' is 'e_STRING'.
+        int d_length;
+
+        union {
+            bool               d_bool;
+            bsls::Types::Int64 d_int;
+            const char*        d_string_p;
+        };
+    };
+
+    /// Operation codes of the instructions.
+    enum Opcode {
+        e_PROPERTY  // target = value of property '*d_name_p'
+        ,
+        e_COMPARE_INT  // target = left 'op' right, as integers
+        ,
+        e_COMPARE_STRING  // target = left 'op' right, as strings
+        ,
+        e_COMPARE  // target = left 'op' right, as strings or integers
+        ,
+        e_ARITHMETIC  // target = left 'op' right, as integers
+        ,
+        e_NEGATE  // target = -left
+        ,
+        e_NOT  // target = !left
+        ,
+        e_JUMP_IF_TRUE  // target = left, jump to 'd_jump' if true
+        ,
+        e_JUMP_IF_FALSE  // target = left, jump to 'd_jump' if false
+        ,
+        e_MOVE_BOOL  // target = left, as a boolean
+        ,
+        e_RETURN  // return left, as a boolean
+    };
+
+    /// Instruction of a program.  Unused operands are set to 0.
+    struct Instruction {
+        // DATA
+        Opcode d_opcode;
+
+        BinaryOperator::Enum d_operator;
+
+        int d_target;
+
+        int d_left;
+
+        int d_right;
+
+        // The index of the instruction to jump to.
+        int d_jump;
+
+        // The name of the property to read.
+        const bsl::string* d_name_p;
+    };
+
+    enum {
+        // The maximum number of registers: each node of an expression uses
+        // at most one, and an expression has at most one operand more than
+        // its operators.
+        k_MAX_REGISTERS = 2 * k_MAX_OPERATORS + 1
+    };
+
+  private:
+    // DATA
+
+    // The code of the program.
+    bsl::vector<Instruction> d_instructions;
+
+    // The initial values of the registers. Only constant registers are
+    // initialized.
+    bsl::vector<Value> d_registers;
+
+    // The type of the registers, as known at compile time.
+    bsl::vector<Type> d_types;
+
+    // The string literals and property names used by the program; a deque
+    // does not move its elements as it grows.
+    bsl::deque<bsl::string> d_strings;
+
+    // If `d_hasEquality`, the equality required by the expression, which
+    // refers to `d_strings`.
+    Equality d_equality;
+
+    bool d_hasEquality;
+
+    // NOT IMPLEMENTED
+    Program(const Program&) BSLS_KEYWORD_DELETED;
+    Program& operator=(const Program&) BSLS_KEYWORD_DELETED;
+
+    // PRIVATE MANIPULATORS
+
+    /// Add a register with the specified `value`, and return its index.
+    int addConstant(const Value& value);
+
+    // PRIVATE CLASS METHODS
+
+    /// Return the result of the comparison of the specified `a` and `b`,
+    /// using the specified `op`.
+    template <typename TYPE>
+    static bool compare(BinaryOperator::Enum op, const TYPE& a, const TYPE& b);
+
+    /// Return the result of the application of the specified `op` to the
+    /// specified `a` and `b`.
+    static bsls::Types::Int64 compute(BinaryOperator::Enum op,
+                                      bsls::Types::Int64   a,
+                                      bsls::Types::Int64   b);
+
+    /// Execute the specified `instruction`, which is neither a property
+    /// load, a jump, nor a return, on the specified `left` and `right`
+    /// operands, and load the result into the specified `target`.  Return
+    /// `true` on success, and `false` on a type error.
+    static bool execute(const Instruction& instruction,
+                        Value*             target,
+                        const Value&       left,
+                        const Value&       right);
+
+    /// Load into the specified `target` the value of the property with the
+    /// specified `name`, read from the specified `reader`.  Return `true`
+    /// on success, and `false` if the reader returned an error, in which
+    /// case the evaluation is stopped in the specified `context`.
+    static bool load(Value*             target,
+                     const bsl::string& name,
+                     PropertiesReader*  reader,
+                     EvaluationContext& context);
+
+    /// Stop evaluation on a type error in the specified `context`.  Return
+    /// `false`.
+    static bool typeError(EvaluationContext& context);
+
+  public:
+    // CREATORS
+
+    /// Create an empty program, using the specified `allocator` to supply
+    /// memory.
+    explicit Program(bslma::Allocator* allocator);
+
+    // MANIPULATORS
+
+    /// Add a constant register holding the specified `value`, and return
+    /// its index.
+    int addBoolean(bool value);
+    int addInteger(bsls::Types::Int64 value);
+    int addString(const bsl::string& value);
+
+    /// Add a register written by an instruction, producing a value of the
+    /// specified `type`, and return its index.
+    int addRegister(Type type);
+
+    /// Append an instruction with the specified `opcode`, `target`, `left`,
+    /// and optionally specified `right` registers, and `op` operator.
+    /// Return the index of the instruction.
+    int emit(Opcode               opcode,
+             int                  target,
+             int                  left,
+             int                  right = 0,
+             BinaryOperator::Enum op    = BinaryOperator::e_EQ);
+
+    /// Append an instruction loading into the specified `target` register
+    /// the property having the specified `name`.
+    void emitProperty(int target, const bsl::string& name);
+
+    /// Make the jump instruction at the specified `index` jump to the next
+    /// instruction to be appended.
+    void setJump(int index);
+
+    /// Record a copy of the specified `equality`, as the one required by
+    /// the expression.
+    void setEquality(const Equality& equality);
+
+    // ACCESSORS
+
+    /// Return the type of the specified `reg` register, as known at compile
+    /// time.
+    Type type(int reg) const;
+
+    /// Return the equality required by the expression, or 0 if there is
+    /// none.
+    const Equality* equality() const;
+
+    /// Run this program, reading properties from the specified `context`.
+    /// Return the result of the evaluation, or `false` if an error
+    /// occurred, in which case it is recorded in `context`.
+    bool run(EvaluationContext& context) const;
+};
+
+// ------------------------------
+// class SimpleEvaluator::Program
+// ------------------------------
+
+// CREATORS
+SimpleEvaluator::Program::Program(bslma::Allocator* allocator)
+: d_instructions(allocator)
+, d_registers(allocator)
+, d_types(allocator)
+, d_strings(allocator)
+, d_equality()
+, d_hasEquality(false)
+{
+    d_instructions.reserve(k_MAX_REGISTERS + 1);
+    d_registers.reserve(k_MAX_REGISTERS);
+    d_types.reserve(k_MAX_REGISTERS);
+}
+
+// PRIVATE MANIPULATORS
+int SimpleEvaluator::Program::addConstant(const Value& value)
+{
+    d_registers.push_back(value);
+    d_types.push_back(value.d_type);
+
+    BSLS_ASSERT_SAFE(static_cast<int>(d_registers.size()) <=
+                     k_MAX_REGISTERS);
+
+    return static_cast<int>(d_registers.size()) - 1;
+}
+
+// PRIVATE CLASS METHODS
+template <typename TYPE>
+inline bool SimpleEvaluator::Program::compare(BinaryOperator::Enum op,
+                                              const TYPE&          a,
+                                              const TYPE&          b)
+{
+    switch (op) {
+    case BinaryOperator::e_EQ: return a == b;  // RETURN
+    case BinaryOperator::e_NE: return a != b;  // RETURN
+    case BinaryOperator::e_LT: return a < b;   // RETURN
+    case BinaryOperator::e_LE: return a <= b;  // RETURN
+    case BinaryOperator::e_GT: return a > b;   // RETURN
+    case BinaryOperator::e_GE: return a >= b;  // RETURN
+    default: BSLS_ASSERT_SAFE(false && "Not a comparison");
+    }
+
+    return false;
+}
+
+inline bsls::Types::Int64
+SimpleEvaluator::Program::compute(BinaryOperator::Enum op,
+                                  bsls::Types::Int64   a,
+                                  bsls::Types::Int64   b)
+{
+    switch (op) {
+    case BinaryOperator::e_ADD: return a + b;  // RETURN
+    case BinaryOperator::e_SUB: return a - b;  // RETURN
+    case BinaryOperator::e_MUL: return a * b;  // RETURN
+    case BinaryOperator::e_DIV: return a / b;  // RETURN
+    case BinaryOperator::e_MOD: return a % b;  // RETURN
+    default: BSLS_ASSERT_SAFE(false && "Not an arithmetic operator");
+    }
+
+    return 0;
+}
+
+inline bool SimpleEvaluator::Program::execute(const Instruction& instruction,
+                                              Value*             target,
+                                              const Value&       left,
+                                              const Value&       right)
+{
+    switch (instruction.d_opcode) {
+    case e_COMPARE_INT: {
+        if (left.d_type != e_INT || right.d_type != e_INT) {
+            return false;  // RETURN
+        }
+
+        target->d_type = e_BOOL;
+        target->d_bool = compare(instruction.d_operator,
+                                 left.d_int,
+                                 right.d_int);
+    } break;
+    case e_COMPARE_STRING: {
+        if (left.d_type != e_STRING || right.d_type != e_STRING) {
+            return false;  // RETURN
+        }
+
+        target->d_type = e_BOOL;
+        target->d_bool = compare(
+            instruction.d_operator,
+            bslstl::StringRef(left.d_string_p, left.d_length),
+            bslstl::StringRef(right.d_string_p, right.d_length));
+    } break;
+    case e_COMPARE: {
+        target->d_type = e_BOOL;
+
+        if (left.d_type == e_STRING && right.d_type == e_STRING) {
+            target->d_bool = compare(
+                instruction.d_operator,
+                bslstl::StringRef(left.d_string_p, left.d_length),
+                bslstl::StringRef(right.d_string_p, right.d_length));
+        }
+        else if (left.d_type == e_INT && right.d_type == e_INT) {
+            target->d_bool = compare(instruction.d_operator,
+                                     left.d_int,
+                                     right.d_int);
+        }
+        else {
+            return false;  // RETURN
+        }
+    } break;
+    case e_ARITHMETIC: {
+        if (left.d_type != e_INT || right.d_type != e_INT) {
+            return false;  // RETURN
+        }
+
+        target->d_type = e_INT;
+        target->d_int  = compute(instruction.d_operator,
+                                left.d_int,
+                                right.d_int);
+    } break;
+    case e_NEGATE: {
+        if (left.d_type != e_INT) {
+            return false;  // RETURN
+        }
+
+        target->d_type = e_INT;
+        target->d_int  = -left.d_int;
+    } break;
+    case e_NOT: {
+        if (left.d_type != e_BOOL) {
+            return false;  // RETURN
+        }
+
+        target->d_type = e_BOOL;
+        target->d_bool = !left.d_bool;
+    } break;
+    case e_MOVE_BOOL: {
+        if (left.d_type != e_BOOL) {
+            return false;  // RETURN
+        }
+
+        *target = left;
+    } break;
+    default: BSLS_ASSERT_SAFE(false && "Not a computation");
+    }
+
+    return true;
+}
+
+bool SimpleEvaluator::Program::load(Value*             target,
+                                    const bsl::string& name,
+                                    PropertiesReader*  reader,
+                                    EvaluationContext& context)
+{
+    bdld::Datum value = reader->get(name, context.d_allocator);
+
+    if (value.isBoolean()) {
+        target->d_type = e_BOOL;
+        target->d_bool = value.theBoolean();
+    }
+    else if (value.isInteger64()) {
+        target->d_type = e_INT;
+        target->d_int  = value.theInteger64();
+    }
+    else if (value.isInteger()) {
+        target->d_type = e_INT;
+        target->d_int  = value.theInteger();
+    }
+    else if (value.isString()) {
+        const bslstl::StringRef string = value.theString();
+
+        target->d_type     = e_STRING;
+        target->d_string_p = string.data();
+        target->d_length   = static_cast<int>(string.length());
+    }
+    else if (value.isError()) {
+        context.d_stop = true;
+        int rc         = value.theError().code();
+
+        if (rc >= ErrorType::e_EVALUATION_FIRST &&
+            ErrorType::e_EVALUATION_LAST <= rc) {
+            context.d_lastError = static_cast<ErrorType::Enum>(rc);
+        }
+        else {
+            context.d_lastError = ErrorType::e_UNDEFINED;
+        }
+
+        return false;  // RETURN
+    }
+    else {
+        target->d_type = e_OTHER;
+    }
+
+    return true;
+}
+
+bool SimpleEvaluator::Program::typeError(EvaluationContext& context)
+{
+    context.d_stop      = true;
+    context.d_lastError = ErrorType::e_TYPE;
+
+    return false;
+}
+
+// MANIPULATORS
+int SimpleEvaluator::Program::addBoolean(bool value)
+{
+    Value constant;
+    constant.d_type   = e_BOOL;
+    constant.d_length = 0;
+    constant.d_bool   = value;
+
+    return addConstant(constant);
+}
+
+int SimpleEvaluator::Program::addInteger(bsls::Types::Int64 value)
+{
+    Value constant;
+    constant.d_type   = e_INT;
+    constant.d_length = 0;
+    constant.d_int    = value;
+
+    return addConstant(constant);
+}
+
+int SimpleEvaluator::Program::addString(const bsl::string& value)
+{
+    d_strings.push_back(value);
+
+    Value constant;
+    constant.d_type     = e_STRING;
+    constant.d_length   = static_cast<int>(value.length());
+    constant.d_string_p = d_strings.back().data();
+
+    return addConstant(constant);
+}
+
+int SimpleEvaluator::Program::addRegister(Type type)
+{
+    Value value;
+    value.d_type   = e_OTHER;
+    value.d_length = 0;
+    value.d_int    = 0;
+
+    const int reg = addConstant(value);
+    d_types.back() = type;
+
+    return reg;
+}
+
+int SimpleEvaluator::Program::emit(Opcode               opcode,
+                                   int                  target,
+                                   int                  left,
+                                   int                  right,
+                                   BinaryOperator::Enum op)
+{
+    Instruction instruction;
+    instruction.d_opcode   = opcode;
+    instruction.d_operator = op;
+    instruction.d_target   = target;
+    instruction.d_left     = left;
+    instruction.d_right    = right;
+    instruction.d_jump     = 0;
+    instruction.d_name_p   = 0;
+
+    d_instructions.push_back(instruction);
+
+    return static_cast<int>(d_instructions.size()) - 1;
+}
+
+void SimpleEvaluator::Program::emitProperty(int                target,
+                                            const bsl::string& name)
+{
+    d_strings.push_back(name);
+
+    const int index = emit(e_PROPERTY, target, 0);
+    d_instructions[index].d_name_p = &d_strings.back();
+}
+
+void SimpleEvaluator::Program::setJump(int index)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_instructions[index].d_opcode == e_JUMP_IF_TRUE ||
+                     d_instructions[index].d_opcode == e_JUMP_IF_FALSE);
+
+    d_instructions[index].d_jump = static_cast<int>(d_instructions.size());
+}
+
+void SimpleEvaluator::Program::setEquality(const Equality& equality)
+{
+    d_strings.push_back(equality.d_property);
+    d_equality.d_property = d_strings.back();
+
+    d_equality.d_isString   = equality.d_isString;
+    d_equality.d_integer    = equality.d_integer;
+    d_equality.d_isComplete = equality.d_isComplete;
+
+    if (equality.d_isString) {
+        d_strings.push_back(equality.d_string);
+        d_equality.d_string = d_strings.back();
+    }
+
+    d_hasEquality = true;
+}
+
+// ACCESSORS
+SimpleEvaluator::Program::Type SimpleEvaluator::Program::type(int reg) const
+{
+    return d_types[reg];
+}
+
+const SimpleEvaluator::Equality* SimpleEvaluator::Program::equality() const
+{
+    return d_hasEquality ? &d_equality : 0;
+}
+
+bool SimpleEvaluator::Program::run(EvaluationContext& context) const
+{
+    Value registers[k_MAX_REGISTERS];
+    bsl::copy(d_registers.begin(), d_registers.end(), registers);
+
+    const Instruction* code        = d_instructions.data();
+    const Instruction* instruction = code;
+
+    for (;; ++instruction) {
+        Value&       target = registers[instruction->d_target];
+        const Value& left   = registers[instruction->d_left];
+        const Value& right  = registers[instruction->d_right];
+
+        switch (instruction->d_opcode) {
+        case e_PROPERTY: {
+            if (!load(&target,
+                      *instruction->d_name_p,
+                      context.d_propertiesReader,
+                      context)) {
+                return false;  // RETURN
+            }
+        } break;
+        case e_JUMP_IF_TRUE:
+        case e_JUMP_IF_FALSE: {
+            if (left.d_type != e_BOOL) {
+                return typeError(context);  // RETURN
+            }
+
+            target = left;
+
+            if (left.d_bool == (instruction->d_opcode == e_JUMP_IF_TRUE)) {
+                // Compensate for the increment of the loop.
+                instruction = code + instruction->d_jump - 1;
+            }
+        } break;
+        case e_RETURN: {
+            if (left.d_type != e_BOOL) {
+                return typeError(context);  // RETURN
+            }
+
+            return left.d_bool;  // RETURN
+        }
+        default: {
+            if (!execute(*instruction, &target, left, right)) {
+                return typeError(context);  // RETURN
+            }
+        }
+        }
+    }
+}
+
 // ----------------------
 // class PropertiesReader
 // ----------------------
@@ -37,7 +621,7 @@ PropertiesReader::~PropertiesReader()
 // ---------------------
 
 SimpleEvaluator::SimpleEvaluator()
-: d_expression(0)
+: d_program()
 , d_isCompiled(false)
 {
     // NOTHING
@@ -54,12 +638,24 @@ int SimpleEvaluator::compile(const bsl::string&  expression,
     context.d_validationOnly = false;
     parse(expression, context);
 
-    if (context.hasError()) {
-        d_expression.reset();
-    }
-    else {
-        d_expression = context.d_expression;
+    d_program.reset();
+
+    if (!context.hasError()) {
+        // Lower the AST to bytecode; the AST is not needed afterwards.
+        bsl::shared_ptr<Program> program;
+        program.createInplace(context.d_allocator, context.d_allocator);
+
+        const int result = context.d_expression->generate(program.get());
+        program->emit(Program::e_RETURN, 0, result);
+
+        Equality equality;
+        if (context.d_expression->loadEquality(&equality)) {
+            program->setEquality(equality);
+        }
+
+        d_program = program;
     }
+    context.d_expression.reset();
     d_isCompiled = true;
 
     return context.lastError();
@@ -118,25 +714,97 @@ void SimpleEvaluator::parse(const bsl::string&  expression,
 
 bool SimpleEvaluator::evaluate(EvaluationContext& context) const
 {
-    BSLS_ASSERT_SAFE(d_expression.get());
+    BSLS_ASSERT_SAFE(d_program);
     BSLS_ASSERT_SAFE(context.d_propertiesReader);
 
     context.reset();
 
-    bdld::Datum value = d_expression->evaluate(context);
+    return d_program->run(context);
+}
+
+bool SimpleEvaluator::loadEquality(Equality* equality) const
+{
+    BSLS_ASSERT_SAFE(d_program);
+    BSLS_ASSERT_SAFE(equality);
+
+    const Equality* required = d_program->equality();
 
-    if (context.d_stop) {
+    if (!required) {
         return false;  // RETURN
     }
 
-    if (!value.isBoolean()) {
-        context.d_stop      = true;
-        context.d_lastError = ErrorType::e_TYPE;
+    *equality = *required;
+
+    return true;
+}
+
+int SimpleEvaluator::generateBinary(Program*             program,
+                                    BinaryOperator::Enum op,
+                                    const Expression&    left,
+                                    const Expression&    right)
+{
+    const int a = left.generate(program);
+    const int b = right.generate(program);
+
+    if (op >= BinaryOperator::e_ADD) {
+        const int result = program->addRegister(Program::e_INT);
+        program->emit(Program::e_ARITHMETIC, result, a, b, op);
+
+        return result;  // RETURN
+    }
+
+    // Type the comparison after the operand types known at compile time.
+    // Any mismatch with them is a type error at evaluation.
+    Program::Opcode opcode = Program::e_COMPARE;
 
+    if (program->type(a) == Program::e_STRING ||
+        program->type(b) == Program::e_STRING) {
+        opcode = Program::e_COMPARE_STRING;
+    }
+    else if (program->type(a) == Program::e_INT ||
+             program->type(b) == Program::e_INT) {
+        opcode = Program::e_COMPARE_INT;
+    }
+
+    const int result = program->addRegister(Program::e_BOOL);
+    program->emit(opcode, result, a, b, op);
+
+    return result;
+}
+
+bool SimpleEvaluator::loadPropertyEquality(Equality*         equality,
+                                           const Expression& property,
+                                           const Expression& literal)
+{
+    const Property* name = dynamic_cast<const Property*>(&property);
+
+    if (!name) {
         return false;  // RETURN
     }
 
-    return value.theBoolean();
+    if (const IntegerLiteral* integer =
+            dynamic_cast<const IntegerLiteral*>(&literal)) {
+        equality->d_property   = name->name();
+        equality->d_isString   = false;
+        equality->d_string     = bslstl::StringRef();
+        equality->d_integer    = integer->value();
+        equality->d_isComplete = true;
+
+        return true;  // RETURN
+    }
+
+    if (const StringLiteral* string = dynamic_cast<const StringLiteral*>(
+            &literal)) {
+        equality->d_property   = name->name();
+        equality->d_isString   = true;
+        equality->d_string     = string->value();
+        equality->d_integer    = 0;
+        equality->d_isComplete = true;
+
+        return true;  // RETURN
+    }
+
+    return false;
 }
 
 // -------------------------------
@@ -156,79 +824,43 @@ SimpleEvaluator::Property::Property(bsl::string&& name) noexcept
 }
 #endif
 
-bdld::Datum
-SimpleEvaluator::Property::evaluate(EvaluationContext& context) const
+int SimpleEvaluator::Property::generate(Program* program) const
 {
-    bdld::Datum value = context.d_propertiesReader->get(d_name,
-                                                        context.d_allocator);
-
-    if (value.isError()) {
-        context.d_stop = true;
-        int rc         = value.theError().code();
+    const int result = program->addRegister(Program::e_OTHER);
+    program->emitProperty(result, d_name);
 
-        if (rc >= ErrorType::e_EVALUATION_FIRST &&
-            ErrorType::e_EVALUATION_LAST <= rc) {
-            context.d_lastError = static_cast<ErrorType::Enum>(rc);
-        }
-        else {
-            context.d_lastError = ErrorType::e_UNDEFINED;
-        }
-    }
-
-    return value;
+    return result;
 }
 
 // -------------------------------------
 // class SimpleEvaluator::IntegerLiteral
 // -------------------------------------
 
-bdld::Datum
-SimpleEvaluator::IntegerLiteral::evaluate(EvaluationContext& context) const
+int SimpleEvaluator::IntegerLiteral::generate(Program* program) const
 {
-    // It looks like we could save a bit of time by storing a *datum* in
-    // 'd_value', but it would have to use the compile-time allocator. We don't
-    // want to require that that allocator is still alive at runtime.
-    return bdld::Datum::createInteger64(d_value, context.d_allocator);
+    return program->addInteger(d_value);
 }
 
 // -------------------------------------
 // class SimpleEvaluator::BooleanLiteral
 // -------------------------------------
 
-bdld::Datum
-SimpleEvaluator::BooleanLiteral::evaluate(EvaluationContext& context) const
+int SimpleEvaluator::BooleanLiteral::generate(Program* program) const
 {
-    return bdld::Datum::createBoolean(d_value);
+    return program->addBoolean(d_value);
 }
 
 // ---------------------------------
 // class SimpleEvaluator::UnaryMinus
 // ---------------------------------
 
-bdld::Datum
-SimpleEvaluator::UnaryMinus::evaluate(EvaluationContext& context) const
+int SimpleEvaluator::UnaryMinus::generate(Program* program) const
 {
-    bdld::Datum expr = d_expression->evaluate(context);
-
-    if (context.d_stop) {
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    bsls::Types::Int64 value;
+    const int operand = d_expression->generate(program);
+    const int result  = program->addRegister(Program::e_INT);
+    program->emit(Program::e_NEGATE, result, operand);
 
-    if (expr.isInteger64()) {
-        value = expr.theInteger64();
-    }
-    else if (expr.isInteger()) {
-        value = expr.theInteger();
-    }
-    else {
-        context.d_lastError = ErrorType::e_TYPE;
-
-        return context.stop();  // RETURN
-    }
-
-    return bdld::Datum::createInteger64(-value, context.d_allocator);
+    return result;
 }
 
 // ------------------------------------
@@ -248,105 +880,154 @@ SimpleEvaluator::StringLiteral::StringLiteral(bsl::string&& value) noexcept
 }
 #endif
 
-bdld::Datum
-SimpleEvaluator::StringLiteral::evaluate(EvaluationContext& context) const
+int SimpleEvaluator::StringLiteral::generate(Program* program) const
 {
-    // Same remark as above wrt allocators.
-
-    return bdld::Datum::createStringRef(d_value.data(),
-                                        d_value.length(),
-                                        context.d_allocator);
+    return program->addString(d_value);
 }
 
 // -------------------------
 // class SimpleEvaluator::Or
 // -------------------------
 
-bdld::Datum SimpleEvaluator::Or::evaluate(EvaluationContext& context) const
+int SimpleEvaluator::Or::generate(Program* program) const
 {
-    bdld::Datum left = d_left->evaluate(context);
+    const int left   = d_left->generate(program);
+    const int result = program->addRegister(Program::e_BOOL);
+    const int jump   = program->emit(Program::e_JUMP_IF_TRUE, result, left);
+    const int right  = d_right->generate(program);
+    program->emit(Program::e_MOVE_BOOL, result, right);
+    program->setJump(jump);
+
+    return result;
+}
 
-    if (context.d_stop) {
-        return bdld::Datum::createNull();  // RETURN
-    }
+// --------------------------
+// class SimpleEvaluator::And
+// --------------------------
 
-    if (!left.isBoolean()) {
-        context.d_lastError = ErrorType::e_TYPE;
-        return context.stop();  // RETURN
+bool SimpleEvaluator::And::loadEquality(Equality* equality) const
+{
+    if (d_left->loadEquality(equality) || d_right->loadEquality(equality)) {
+        // The other operand must hold too.
+        equality->d_isComplete = false;
+        return true;  // RETURN
     }
 
-    if (left.theBoolean()) {
-        return bdld::Datum::createBoolean(true);  // RETURN
-    }
+    return false;
+}
 
-    bdld::Datum right = d_right->evaluate(context);
+int SimpleEvaluator::And::generate(Program* program) const
+{
+    const int left   = d_left->generate(program);
+    const int result = program->addRegister(Program::e_BOOL);
+    const int jump   = program->emit(Program::e_JUMP_IF_FALSE, result, left);
+    const int right  = d_right->generate(program);
+    program->emit(Program::e_MOVE_BOOL, result, right);
+    program->setJump(jump);
+
+    return result;
+}
 
-    if (context.d_stop) {
-        return bdld::Datum::createNull();  // RETURN
-    }
+// --------------------------
+// class SimpleEvaluator::Not
+// --------------------------
 
-    if (!right.isBoolean()) {
-        context.d_lastError = ErrorType::e_TYPE;
-        return context.stop();  // RETURN
-    }
+int SimpleEvaluator::Not::generate(Program* program) const
+{
+    const int operand = d_expression->generate(program);
+    const int result  = program->addRegister(Program::e_BOOL);
+    program->emit(Program::e_NOT, result, operand);
 
-    return right;
+    return result;
 }
 
-// --------------------------
-// class SimpleEvaluator::And
-// --------------------------
+// ------------------------
+// class CompilationContext
+// ------------------------
 
-bdld::Datum SimpleEvaluator::And::evaluate(EvaluationContext& context) const
+// PRIVATE MANIPULATORS
+SimpleEvaluator::ExpressionPtr
+CompilationContext::fold(const SimpleEvaluator::Not*, ExpressionPtr operand)
 {
-    bdld::Datum left = d_left->evaluate(context);
+    typedef SimpleEvaluator::BooleanLiteral BooleanLiteral;
 
-    if (context.d_stop) {
-        return bdld::Datum::createNull();  // RETURN
-    }
+    const BooleanLiteral* boolean = dynamic_cast<const BooleanLiteral*>(
+        operand.get());
 
-    if (!left.isBoolean()) {
-        context.d_lastError = ErrorType::e_TYPE;
-        return context.stop();  // RETURN
+    if (!boolean) {
+        return ExpressionPtr();  // RETURN
     }
 
-    if (!left.theBoolean()) {
-        return bdld::Datum::createBoolean(false);  // RETURN
+    return ExpressionPtr(new (*d_allocator) BooleanLiteral(!boolean->value()),
+                         d_allocator);
+}
+
+SimpleEvaluator::ExpressionPtr
+CompilationContext::fold(const SimpleEvaluator::UnaryMinus*,
+                         ExpressionPtr operand)
+{
+    typedef SimpleEvaluator::IntegerLiteral IntegerLiteral;
+
+    const IntegerLiteral* integer = dynamic_cast<const IntegerLiteral*>(
+        operand.get());
+
+    if (!integer ||
+        integer->value() == bsl::numeric_limits<bsls::Types::Int64>::min()) {
+        return ExpressionPtr();  // RETURN
     }
 
-    bdld::Datum right = d_right->evaluate(context);
+    return ExpressionPtr(new (*d_allocator) IntegerLiteral(-integer->value()),
+                         d_allocator);
+}
+
+SimpleEvaluator::ExpressionPtr CompilationContext::fold(
+    const SimpleEvaluator::And*,
+    ExpressionPtr a,
+    ExpressionPtr b)
+{
+    typedef SimpleEvaluator::BooleanLiteral BooleanLiteral;
+
+    // 'false && b' is 'false', 'true && b' is 'b', 'a && true' is 'a'.
+    const BooleanLiteral* boolean_a = dynamic_cast<const BooleanLiteral*>(
+        a.get());
 
-    if (context.d_stop) {
-        return bdld::Datum::createNull();  // RETURN
+    if (boolean_a) {
+        return boolean_a->value() ? b : a;  // RETURN
     }
 
-    if (!right.isBoolean()) {
-        context.d_lastError = ErrorType::e_TYPE;
-        return context.stop();  // RETURN
+    const BooleanLiteral* boolean_b = dynamic_cast<const BooleanLiteral*>(
+        b.get());
+
+    if (boolean_b && boolean_b->value()) {
+        return a;  // RETURN
     }
 
-    return right;
+    return ExpressionPtr();
 }
 
-// --------------------------
-// class SimpleEvaluator::Not
-// --------------------------
-
-bdld::Datum SimpleEvaluator::Not::evaluate(EvaluationContext& context) const
+SimpleEvaluator::ExpressionPtr CompilationContext::fold(
+    const SimpleEvaluator::Or*,
+    ExpressionPtr a,
+    ExpressionPtr b)
 {
-    bdld::Datum value = d_expression->evaluate(context);
+    typedef SimpleEvaluator::BooleanLiteral BooleanLiteral;
+
+    // 'true || b' is 'true', 'false || b' is 'b', 'a || false' is 'a'.
+    const BooleanLiteral* boolean_a = dynamic_cast<const BooleanLiteral*>(
+        a.get());
 
-    if (context.d_stop) {
-        return bdld::Datum::createNull();  // RETURN
+    if (boolean_a) {
+        return boolean_a->value() ? a : b;  // RETURN
     }
 
-    if (!value.isBoolean()) {
-        context.d_lastError = ErrorType::e_TYPE;
+    const BooleanLiteral* boolean_b = dynamic_cast<const BooleanLiteral*>(
+        b.get());
 
-        return context.stop();  // RETURN
+    if (boolean_b && !boolean_b->value()) {
+        return a;  // RETURN
     }
 
-    return bdld::Datum::createBoolean(!value.theBoolean());
+    return ExpressionPtr();
 }
 
 }  // close package namespace
@@ -29,6 +29,15 @@
 //
 //@DESCRIPTION: 'SimpleEvaluator' handles expression evaluation.
 //
+// Compiling an expression parses it into an abstract syntax tree, which is
+// then lowered into a flat, register-based bytecode.  Literals are loaded in
+// constant registers, and each operation writes its result to a register of
+// its own, so that evaluating an expression runs a single loop over its
+// instructions, without allocating memory or walking the tree.  Comparisons
+// are typed after the operands whose type is known at compile time (e.g.
+// 'x > 42' compiles to an integer comparison), and 'and' and 'or' are
+// compiled to conditional jumps, preserving their short-circuit semantics.
+//
 /// Thread Safety
 ///-------------
 //: o SimpleEvaluator is thread safe
@@ -57,6 +66,7 @@
 // BDE
 #include <bdld_datum.h>
 #include <bsl_functional.h>
+#include <bsl_limits.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
@@ -65,6 +75,7 @@
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_issame.h>
 #include <bsls_types.h>
+#include <bslstl_stringref.h>
 
 // MWC
 #include <mwcu_memoutstream.h>
@@ -129,9 +140,57 @@ class PropertiesReader {
 
 /// Evaluator for boolean expressions based on message properties.
 class SimpleEvaluator {
+  public:
+    // PUBLIC TYPES
+
+    /// Requirement, for an expression to evaluate to `true`, that a
+    /// property is equal to an integer or a string literal.
+    struct Equality {
+        // DATA
+
+        // The name of the property.
+        bslstl::StringRef d_property;
+
+        // If `true`, the literal is `d_string`, otherwise it is
+        // `d_integer`.
+        bool d_isString;
+
+        bslstl::StringRef d_string;
+
+        bsls::Types::Int64 d_integer;
+
+        // If `true`, the expression is the equality itself, and evaluates
+        // to `true` if and only if the equality holds.
+        bool d_isComplete;
+    };
+
   private:
     // PRIVATE TYPES
 
+    /// Bytecode, lowered from an `Expression`, that is run by `evaluate`.
+    class Program;
+
+    /// Binary operators of the bytecode.
+    struct BinaryOperator {
+        enum Enum {
+            e_EQ,
+            e_NE,
+            e_LT,
+            e_LE,
+            e_GT,
+            e_GE,
+            e_ADD,
+            e_SUB,
+            e_MUL,
+            e_DIV,
+            e_MOD
+        };
+
+        /// Return the operator implemented by the standard functor `Op`.
+        template <template <typename> class Op>
+        static Enum fromFunctor();
+    };
+
     // ----------
     // Expression
     // ----------
@@ -142,8 +201,16 @@ class SimpleEvaluator {
       public:
         virtual ~Expression() {}
 
-        /// Evaluate a Expression.
-        virtual bdld::Datum evaluate(EvaluationContext& context) const = 0;
+        /// Append to the specified `program` the instructions evaluating
+        /// this Expression, and return the index of the register holding
+        /// its value once they are run.
+        virtual int generate(Program* program) const = 0;
+
+        /// If this Expression can only evaluate to `true` when a property
+        /// is equal to a literal, load that requirement into the specified
+        /// `equality` and return `true`.  Otherwise, return `false`.  Note
+        /// that `equality` refers to the strings of this Expression.
+        virtual bool loadEquality(Equality* equality) const { return false; }
     };
 
     // Bison generates different code for different available standards:
@@ -186,11 +253,14 @@ class SimpleEvaluator {
 
         // ACCESSORS
 
-        /// Return the boolean value of the property. If the property is not
-        /// a boolean, stop evaluation, set last error to e_TYPE, and return
-        /// `false`;
-        bdld::Datum
-        evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+        /// Generate the reading of the property from the properties reader
+        /// of the evaluation context.  If the reader returns an error, the
+        /// evaluation stops, and its last error is set to the code of that
+        /// error if it is an evaluation error, or to e_UNDEFINED otherwise.
+        int generate(Program* program) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Return the name of the property.
+        const bsl::string& name() const;
     };
 
     // --------------
@@ -213,9 +283,12 @@ class SimpleEvaluator {
 
         // ACCESSORS
 
-        /// Return the integer passed to the constructor, as an Int64 Datum.
-        bdld::Datum
-        evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+        /// Return the constant register holding the integer passed to the
+        /// constructor.
+        int generate(Program* program) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Return `d_value`.
+        bsls::Types::Int64 value() const;
     };
 
     // -------------
@@ -244,9 +317,12 @@ class SimpleEvaluator {
 
         // ACCESSORS
 
-        /// Return the string passed to the constructor, as StringRef Datum.
-        bdld::Datum
-        evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+        /// Return the constant register holding the string passed to the
+        /// constructor.
+        int generate(Program* program) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Return `d_value`.
+        const bsl::string& value() const;
     };
 
     // --------------
@@ -269,10 +345,9 @@ class SimpleEvaluator {
 
         // ACCESSORS
 
-        /// Return the boolean value passed to the constructor, as a boolean
-        /// Datum.
-        bdld::Datum
-        evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+        /// Return the constant register holding the boolean passed to the
+        /// constructor.
+        int generate(Program* program) const BSLS_KEYWORD_OVERRIDE;
 
         /// Return `d_value`.
         bool value() const;
@@ -302,13 +377,18 @@ class SimpleEvaluator {
 
         // ACCESSORS
 
-        /// Evaluate the `left` and `right` expressions passed to the
-        /// constructor.  If they have the same type, compare them using
-        /// `Op`, and return the result as a boolean Datum. Otherwise, set
-        /// the error in the context to  e_TYPE, stop the evaluation, and
-        /// return a null datum.
-        bdld::Datum
-        evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+        /// Generate the evaluation of the `left` and `right` expressions
+        /// passed to the constructor, followed by their comparison using
+        /// `Op`, typed after the operands whose type is known at compile
+        /// time.  If, at evaluation, they do not have the same type, the
+        /// error in the context is set to e_TYPE, and the evaluation stops.
+        int generate(Program* program) const BSLS_KEYWORD_OVERRIDE;
+
+        /// If `Op` is `equal_to`, and one operand is a property and the
+        /// other an integer or string literal, load their equality into the
+        /// specified `equality` and return `true`.  Otherwise, return
+        /// `false`.
+        bool loadEquality(Equality* equality) const BSLS_KEYWORD_OVERRIDE;
     };
 
     // --
@@ -334,16 +414,14 @@ class SimpleEvaluator {
 
         // ACCESSORS
 
-        /// Evaluate the `left` expression passed to the constructor. If it
-        /// is `true`, return `true` as a boolean Datum. If it is `false`,
-        /// evaluate the `right` expression and return its value as a
-        /// boolean Datum. If an expression evaluates to a non-boolean
-        /// Datum, set the error in the context to  e_TYPE, stop the
-        /// evaluation, and return a null datum. Note that the `right`
+        /// Generate the evaluation of the `left` expression passed to the
+        /// constructor, followed by a jump over the evaluation of the
+        /// `right` expression if it is `true`.  If, at evaluation, an
+        /// expression is not a boolean, the error in the context is set to
+        /// e_TYPE, and the evaluation stops.  Note that the `right`
         /// expression is not evaluated if `left` evaluates to `true`, and
         /// its type is not checked.
-        bdld::Datum
-        evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+        int generate(Program* program) const BSLS_KEYWORD_OVERRIDE;
     };
 
     // ---
@@ -369,16 +447,19 @@ class SimpleEvaluator {
 
         // ACCESSORS
 
-        /// Evaluate the `left` expression passed to the constructor. If it
-        /// is `false`, return `false` as a boolean Datum. If it is `true`,
-        /// evaluate the `right` expression and return its value as a
-        /// boolean Datum. If an expression evaluates to a non-boolean
-        /// Datum, set the error in the context to  e_TYPE, stop the
-        /// evaluation, and return a null datum. Note that the `right`
+        /// Generate the evaluation of the `left` expression passed to the
+        /// constructor, followed by a jump over the evaluation of the
+        /// `right` expression if it is `false`.  If, at evaluation, an
+        /// expression is not a boolean, the error in the context is set to
+        /// e_TYPE, and the evaluation stops.  Note that the `right`
         /// expression is not evaluated if `left` evaluates to `false`, and
         /// its type is not checked.
-        bdld::Datum
-        evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+        int generate(Program* program) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Load into the specified `equality` the requirement of the `left`
+        /// expression passed to the constructor, or else of the `right`
+        /// one, if any, and return `true`.  Otherwise, return `false`.
+        bool loadEquality(Equality* equality) const BSLS_KEYWORD_OVERRIDE;
     };
 
     // ------------------
@@ -406,13 +487,11 @@ class SimpleEvaluator {
 
         // ACCESSORS
 
-        /// Evaluate the `left` and `right` expressions passed to the
-        /// constructor. If they have are both integers, apply `Op`, and
-        /// return the result as a Int64 Datum. Otherwise, set the error in
-        /// the context to  e_TYPE, stop the evaluation, and return a null
-        /// datum.
-        bdld::Datum
-        evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+        /// Generate the evaluation of the `left` and `right` expressions
+        /// passed to the constructor, followed by the application of `Op`.
+        /// If, at evaluation, they are not both integers, the error in the
+        /// context is set to e_TYPE, and the evaluation stops.
+        int generate(Program* program) const BSLS_KEYWORD_OVERRIDE;
     };
 
     // ----------
@@ -434,12 +513,11 @@ class SimpleEvaluator {
 
         // ACCESSORS
 
-        /// Evaluate `expression` passed to the constructor. If it is an
-        /// integer, return the negated value as an Int64 Datum. Otherwise,
-        /// set the error in the context to  e_TYPE, stop the evaluation,
-        /// and return a null datum.
-        bdld::Datum
-        evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+        /// Generate the evaluation of `expression` passed to the
+        /// constructor, followed by its negation.  If, at evaluation, it is
+        /// not an integer, the error in the context is set to e_TYPE, and
+        /// the evaluation stops.
+        int generate(Program* program) const BSLS_KEYWORD_OVERRIDE;
     };
 
     // ---
@@ -461,12 +539,11 @@ class SimpleEvaluator {
 
         // ACCESSORS
 
-        /// Evaluate `expression` passed to the constructor. If it is a
-        /// boolean, return the negated value as a boolean Datum.
-        /// Otherwise, set the error in the context to  e_TYPE, stop the
-        /// evaluation, and return a null datum.
-        bdld::Datum
-        evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+        /// Generate the evaluation of `expression` passed to the
+        /// constructor, followed by its negation.  If, at evaluation, it is
+        /// not a boolean, the error in the context is set to e_TYPE, and
+        /// the evaluation stops.
+        int generate(Program* program) const BSLS_KEYWORD_OVERRIDE;
     };
 
   private:
@@ -476,8 +553,9 @@ class SimpleEvaluator {
 
     // DATA
 
-    // The expression to evaluate.
-    bsl::shared_ptr<Expression> d_expression;
+    // The bytecode of the expression to evaluate.  Note that it is never
+    // modified once compiled, and is therefore shared by copies.
+    bsl::shared_ptr<const Program> d_program;
 
     // The flag indicating that `compile` was called for this expression.
     bool d_isCompiled;
@@ -489,6 +567,23 @@ class SimpleEvaluator {
     static void parse(const bsl::string&  expression,
                       CompilationContext& context);
 
+    /// Append to the specified `program` the instructions evaluating the
+    /// specified `left` and `right` expressions, followed by the
+    /// application of the specified `op` to their values, and return the
+    /// index of the register holding the result.
+    static int generateBinary(Program*             program,
+                              BinaryOperator::Enum op,
+                              const Expression&    left,
+                              const Expression&    right);
+
+    /// If the specified `property` is a Property, and the specified
+    /// `literal` an IntegerLiteral or a StringLiteral, load their equality
+    /// into the specified `equality` and return `true`.  Otherwise, return
+    /// `false`.
+    static bool loadPropertyEquality(Equality*         equality,
+                                     const Expression& property,
+                                     const Expression& literal);
+
   public:
     // PUBLIC CONSTANTS
     enum {
@@ -513,7 +608,9 @@ class SimpleEvaluator {
     int compile(const bsl::string& expression, CompilationContext& context);
 
     /// Evaluate the expression, compiled from the `expression` passed to
-    /// the constructor.
+    /// `compile`, by running its bytecode.  Return the result, or `false`
+    /// if an error occurred, in which case the error is recorded in the
+    /// specified `context`.
     bool evaluate(EvaluationContext& context) const;
 
     /// Return `true` if the `compile` was called for this object.
@@ -524,6 +621,19 @@ class SimpleEvaluator {
     /// only if `isValid()` returns `true`.
     bool isValid() const;
 
+    /// If the compiled expression can only evaluate to `true` when a
+    /// property is equal to an integer or a string literal, load that
+    /// requirement into the specified `equality` and return `true`.
+    /// Otherwise, return `false`.  Only top-level conjunctions are looked
+    /// into, e.g. `region == "X" && type > 2` requires `region` to be
+    /// equal to `"X"`, but `region == "X" || type > 2` has no such
+    /// requirement.  `equality.d_isComplete` is set to `true` if the
+    /// expression is only that comparison, e.g. `region == "X"`.  Note
+    /// that the strings referred to by `equality` are valid as long as
+    /// this object, or a copy of it, is not destroyed or recompiled.  The
+    /// behavior is undefined unless `isValid()`.
+    bool loadEquality(Equality* equality) const;
+
     // PUBLIC STATIC FUNCTIONS
 
     /// Check `expression`. Return true if it is syntactically correct, and
@@ -597,6 +707,28 @@ class CompilationContext {
     /// property is already recorded with a different `type`.
     int getPropertyIndex(const bsl::string& property, Type type);
 
+    /// Return the folding of the specified `operand` of a `Not`, or of a
+    /// `UnaryMinus`, if it is a literal, e.g. `!true` is `false` and `-1`
+    /// is an integer literal.  Otherwise, return a null ExpressionPtr.
+    ExpressionPtr fold(const SimpleEvaluator::Not*, ExpressionPtr operand);
+    ExpressionPtr fold(const SimpleEvaluator::UnaryMinus*,
+                       ExpressionPtr operand);
+
+    /// Return the simplification of an `And`, or of an `Or`, of the
+    /// specified `a` and `b` if one of them is a boolean literal, e.g.
+    /// `false && b` is `false`, and `a || false` is `a`.  Otherwise, return
+    /// a null ExpressionPtr.  Note that an operand evaluated before a
+    /// boolean literal is kept, so that its errors are still reported.
+    ExpressionPtr
+    fold(const SimpleEvaluator::And*, ExpressionPtr a, ExpressionPtr b);
+    ExpressionPtr
+    fold(const SimpleEvaluator::Or*, ExpressionPtr a, ExpressionPtr b);
+
+    /// Return a null ExpressionPtr: expressions of type `Class` are not
+    /// folded.
+    template <typename Class, typename ArgType>
+    ExpressionPtr fold(const Class*, const ArgType&);
+
     /// In compilation mode, create a subclass of Expression, passing
     /// `value` to the constructor, and return an ExpressionPtr to it. In
     /// validation mode, return a null ExpressionPtr. NodeType is any of
@@ -667,7 +799,7 @@ class EvaluationContext {
     // The allocator to use during evaluation.
     bslma::Allocator* d_allocator;
 
-    // Set by `Expression::evaluate` functions when a property does not
+    // Set by `SimpleEvaluator::evaluate` when a property does not
     // have the type deduced during compilation. Stop evaluation and return
     // `true`.
     bool d_stop;
@@ -733,7 +865,61 @@ inline bool SimpleEvaluator::isCompiled() const
 
 inline bool SimpleEvaluator::isValid() const
 {
-    return d_expression != 0;
+    return d_program != 0;
+}
+
+// -------------------------------------
+// struct SimpleEvaluator::BinaryOperator
+// -------------------------------------
+
+template <template <typename> class Op>
+inline SimpleEvaluator::BinaryOperator::Enum
+SimpleEvaluator::BinaryOperator::fromFunctor()
+{
+    typedef Op<int> Functor;
+
+    if (bsl::is_same<Functor, bsl::equal_to<int> >::value) {
+        return e_EQ;  // RETURN
+    }
+
+    if (bsl::is_same<Functor, bsl::not_equal_to<int> >::value) {
+        return e_NE;  // RETURN
+    }
+
+    if (bsl::is_same<Functor, bsl::less<int> >::value) {
+        return e_LT;  // RETURN
+    }
+
+    if (bsl::is_same<Functor, bsl::less_equal<int> >::value) {
+        return e_LE;  // RETURN
+    }
+
+    if (bsl::is_same<Functor, bsl::greater<int> >::value) {
+        return e_GT;  // RETURN
+    }
+
+    if (bsl::is_same<Functor, bsl::greater_equal<int> >::value) {
+        return e_GE;  // RETURN
+    }
+
+    if (bsl::is_same<Functor, bsl::plus<int> >::value) {
+        return e_ADD;  // RETURN
+    }
+
+    if (bsl::is_same<Functor, bsl::minus<int> >::value) {
+        return e_SUB;  // RETURN
+    }
+
+    if (bsl::is_same<Functor, bsl::multiplies<int> >::value) {
+        return e_MUL;  // RETURN
+    }
+
+    if (bsl::is_same<Functor, bsl::divides<int> >::value) {
+        return e_DIV;  // RETURN
+    }
+
+    // bsl::modulus
+    return e_MOD;
 }
 
 // -------------------------------------
@@ -746,6 +932,20 @@ inline SimpleEvaluator::IntegerLiteral::IntegerLiteral(
 {
 }
 
+inline bsls::Types::Int64 SimpleEvaluator::IntegerLiteral::value() const
+{
+    return d_value;
+}
+
+// ------------------------------------
+// class SimpleEvaluator::StringLiteral
+// ------------------------------------
+
+inline const bsl::string& SimpleEvaluator::StringLiteral::value() const
+{
+    return d_value;
+}
+
 // -------------------------------------
 // class SimpleEvaluator::BooleanLiteral
 // -------------------------------------
@@ -760,6 +960,15 @@ inline bool SimpleEvaluator::BooleanLiteral::value() const
     return d_value;
 }
 
+// -------------------------------
+// class SimpleEvaluator::Property
+// -------------------------------
+
+inline const bsl::string& SimpleEvaluator::Property::name() const
+{
+    return d_name;
+}
+
 // ------------------------------------------
 // template class SimpleEvaluator::Comparison
 // ------------------------------------------
@@ -773,61 +982,24 @@ inline SimpleEvaluator::Comparison<Op>::Comparison(ExpressionPtr left,
 }
 
 template <template <typename> class Op>
-bdld::Datum
-SimpleEvaluator::Comparison<Op>::evaluate(EvaluationContext& context) const
+inline int SimpleEvaluator::Comparison<Op>::generate(Program* program) const
 {
-    bdld::Datum left = d_left->evaluate(context);
-
-    if (context.d_stop) {
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    bdld::Datum right = d_right->evaluate(context);
-
-    if (context.d_stop) {
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    if (left.isString()) {
-        if (right.isString()) {
-            return bdld::Datum::createBoolean(
-                Op<bslstl::StringRef>()(left.theString(), right.theString()));
-            // RETURN
-        }
-
-        context.d_lastError = ErrorType::e_TYPE;
-
-        return context.stop();  // RETURN
-    }
-
-    bsls::Types::Int64 a;
-    bsls::Types::Int64 b;
-
-    if (left.isInteger64()) {
-        a = left.theInteger64();
-    }
-    else if (left.isInteger()) {
-        a = left.theInteger();
-    }
-    else {
-        context.d_lastError = ErrorType::e_TYPE;
-
-        return context.stop();  // RETURN
-    }
-
-    if (right.isInteger64()) {
-        b = right.theInteger64();
-    }
-    else if (right.isInteger()) {
-        b = right.theInteger();
-    }
-    else {
-        context.d_lastError = ErrorType::e_TYPE;
+    return generateBinary(program,
+                          BinaryOperator::fromFunctor<Op>(),
+                          *d_left,
+                          *d_right);
+}
 
-        return context.stop();  // RETURN
+template <template <typename> class Op>
+inline bool
+SimpleEvaluator::Comparison<Op>::loadEquality(Equality* equality) const
+{
+    if (!bsl::is_same<Op<int>, bsl::equal_to<int> >::value) {
+        return false;  // RETURN
     }
 
-    return bdld::Datum::createBoolean(Op<bsls::Types::Int64>()(a, b));
+    return loadPropertyEquality(equality, *d_left, *d_right) ||
+           loadPropertyEquality(equality, *d_right, *d_left);
 }
 
 // ----------------------------------
@@ -864,51 +1036,13 @@ inline SimpleEvaluator::NumBinaryOperation<Op>::NumBinaryOperation(
 }
 
 template <template <typename> class Op>
-bdld::Datum SimpleEvaluator::NumBinaryOperation<Op>::evaluate(
-    EvaluationContext& context) const
+inline int
+SimpleEvaluator::NumBinaryOperation<Op>::generate(Program* program) const
 {
-    bdld::Datum left = d_left->evaluate(context);
-
-    if (context.d_stop) {
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    bdld::Datum right = d_right->evaluate(context);
-
-    if (context.d_stop) {
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    bsls::Types::Int64 a;
-    bsls::Types::Int64 b;
-
-    if (left.isInteger64()) {
-        a = left.theInteger64();
-    }
-    else if (left.isInteger()) {
-        a = left.theInteger();
-    }
-    else {
-        context.d_lastError = ErrorType::e_TYPE;
-
-        return context.stop();  // RETURN
-    }
-
-    if (right.isInteger64()) {
-        b = right.theInteger64();
-    }
-    else if (right.isInteger()) {
-        b = right.theInteger();
-    }
-    else {
-        context.d_lastError = ErrorType::e_TYPE;
-
-        return context.stop();  // RETURN
-    }
-
-    bsls::Types::Int64 result = Op<bsls::Types::Int64>()(a, b);
-
-    return bdld::Datum::createInteger64(result, context.d_allocator);
+    return generateBinary(program,
+                          BinaryOperator::fromFunctor<Op>(),
+                          *d_left,
+                          *d_right);
 }
 
 // ------------------------------------------
@@ -1009,10 +1143,38 @@ CompilationContext::makeComparison(ExpressionPtr a, ExpressionPtr b)
     //   - for 'expr = false' and 'false = expr' return '!expr'
     //   - if both sides are boolean literals, return
     //   'BooleanLiteral(a && b)'
+    // Fold comparisons of integer, or string, literals.
 
     typedef SimpleEvaluator::BooleanLiteral BooleanLiteral;
+    typedef SimpleEvaluator::IntegerLiteral IntegerLiteral;
+    typedef SimpleEvaluator::StringLiteral  StringLiteral;
     typedef SimpleEvaluator::Not            Not;
 
+    const IntegerLiteral* integer_a = dynamic_cast<const IntegerLiteral*>(
+        a.get());
+    const IntegerLiteral* integer_b = dynamic_cast<const IntegerLiteral*>(
+        b.get());
+
+    if (integer_a && integer_b) {
+        return ExpressionPtr(
+            new (*d_allocator) BooleanLiteral(
+                Op<bsls::Types::Int64>()(integer_a->value(),
+                                         integer_b->value())),
+            d_allocator);  // RETURN
+    }
+
+    const StringLiteral* string_a = dynamic_cast<const StringLiteral*>(
+        a.get());
+    const StringLiteral* string_b = dynamic_cast<const StringLiteral*>(
+        b.get());
+
+    if (string_a && string_b) {
+        return ExpressionPtr(
+            new (*d_allocator) BooleanLiteral(
+                Op<bsl::string>()(string_a->value(), string_b->value())),
+            d_allocator);  // RETURN
+    }
+
     // Booleans can only be compared for (in)equality.
     const bool isEquality =
         bsl::is_same<Op<int>, bsl::equal_to<int> >::value ||
@@ -1066,6 +1228,11 @@ CompilationContext::makeBooleanBinaryExpression(ExpressionPtr a,
         return ExpressionPtr();  // RETURN
     }
 
+    ExpressionPtr folded = fold(static_cast<const Class*>(0), a, b);
+    if (folded) {
+        return folded;  // RETURN
+    }
+
     return ExpressionPtr(new (*d_allocator) Class(a, b), d_allocator);
 }
 
@@ -1079,6 +1246,34 @@ CompilationContext::makeNumBinaryExpression(ExpressionPtr a, ExpressionPtr b)
         return ExpressionPtr();  // RETURN
     }
 
+    // Fold operations on integer literals, unless their result is not
+    // defined, e.g. a division by zero, which is left to the evaluation.
+    typedef SimpleEvaluator::IntegerLiteral IntegerLiteral;
+    typedef bsls::Types::Int64              Int64;
+
+    const IntegerLiteral* integer_a = dynamic_cast<const IntegerLiteral*>(
+        a.get());
+    const IntegerLiteral* integer_b = dynamic_cast<const IntegerLiteral*>(
+        b.get());
+
+    if (integer_a && integer_b) {
+        const Int64 value_a = integer_a->value();
+        const Int64 value_b = integer_b->value();
+
+        const bool isDivision =
+            bsl::is_same<Op<Int64>, bsl::divides<Int64> >::value ||
+            bsl::is_same<Op<Int64>, bsl::modulus<Int64> >::value;
+
+        if (!isDivision ||
+            (value_b != 0 &&
+             (value_b != -1 ||
+              value_a != bsl::numeric_limits<Int64>::min()))) {
+            return ExpressionPtr(new (*d_allocator) IntegerLiteral(
+                                     Op<Int64>()(value_a, value_b)),
+                                 d_allocator);  // RETURN
+        }
+    }
+
     return ExpressionPtr(new (*d_allocator)
                              SimpleEvaluator::NumBinaryOperation<Op>(a, b),
                          d_allocator);
@@ -1094,9 +1289,21 @@ CompilationContext::makeUnaryExpression(ArgType expr)
         return ExpressionPtr();  // RETURN
     }
 
+    ExpressionPtr folded = fold(static_cast<const Class*>(0), expr);
+    if (folded) {
+        return folded;  // RETURN
+    }
+
     return ExpressionPtr(new (*d_allocator) Class(expr), d_allocator);
 }
 
+template <typename Class, typename ArgType>
+inline SimpleEvaluator::ExpressionPtr
+CompilationContext::fold(const Class*, const ArgType&)
+{
+    return ExpressionPtr();
+}
+
 // -----------------------
 // class EvaluationContext
 // -----------------------
@@ -418,6 +418,38 @@ static void test3_evaluation()
         {"true && b_true", true},
         {"b_true == true", true},
         {"b_true < true", false},
+
+        // constant folding
+        {"1 + 2 * 3 == 7 && b_true", true},
+        {"-(-42) == i_42", true},
+        {"!(1 > 2) && s_foo == \"foo\"", true},
+        {"\"bar\" < \"foo\" && i_1 == 1", true},
+        {"i_42 == 84 / 2", true},
+        {"i_42 == 85 % 43", true},
+        {"i_1 == 1 && true", true},
+        {"false || i_1 == 1", true},
+        {"i_1 == 2 || false", false},
+        {"false && non_existing_property", false},
+        {"true || non_existing_property", true},
+
+        // comparisons of properties
+        {"i_42 == i64_42", true},
+        {"i_1 < i_2", true},
+        {"s_foo == s_foo", true},
+        {"i_1 + i_2 == i_3", true},
+        {"i_42 == s_foo", runtimeErrorResult},
+        {"b_true == i_1", runtimeErrorResult},
+
+        // short-circuit: the right operand is neither evaluated nor checked
+        {"b_true || s_foo", true},
+        {"b_false && i_42", false},
+        {"b_true || non_existing_property", true},
+        {"b_false || s_foo", runtimeErrorResult},
+
+        // nested logical operators
+        {"(b_false || i_1 == 1) && (b_true && s_foo != \"bar\")", true},
+        {"(b_false || i_1 == 2) && (b_true && s_foo != \"bar\")", false},
+        {"!(b_false || !(b_true && !b_false))", true},
         // overflows
         // supported_ints
         {"i_0 != -32768", true},                // -(2 ** 15)
@@ -482,6 +514,150 @@ static void test3_evaluation()
     }
 }
 
+static void test4_evaluationErrors()
+{
+    MockPropertiesReader reader(s_allocator_p);
+    EvaluationContext    evaluationContext(&reader, s_allocator_p);
+
+    struct TestParameters {
+        const char*     expression;
+        ErrorType::Enum errorCode;
+    } testParameters[] = {
+        {"b_true", ErrorType::e_OK},
+        {"non_existing_property", ErrorType::e_NAME},
+        {"i_42 == 42 && non_existing_property", ErrorType::e_NAME},
+        {"non_existing_property == s_foo", ErrorType::e_NAME},
+        {"s_foo == 42", ErrorType::e_TYPE},
+        {"42 == s_foo", ErrorType::e_TYPE},
+        {"i_42 == \"foo\"", ErrorType::e_TYPE},
+        {"i_42 > b_true", ErrorType::e_TYPE},
+        {"-s_foo == 1", ErrorType::e_TYPE},
+        {"s_foo + 1 == 1", ErrorType::e_TYPE},
+        {"!i_1", ErrorType::e_TYPE},
+        {"i_1 || b_true", ErrorType::e_TYPE},
+        {"b_false || i_1", ErrorType::e_TYPE},
+        {"i_1 + 1", ErrorType::e_TYPE},
+        {"s_foo", ErrorType::e_TYPE},
+        {"b_false && s_foo", ErrorType::e_OK},
+
+        // constant folding keeps the operands which are evaluated
+        {"true && non_existing_property", ErrorType::e_NAME},
+        {"non_existing_property || false", ErrorType::e_NAME},
+        {"\"a\" + 1 == 1 && b_true", ErrorType::e_TYPE},
+        {"false && non_existing_property", ErrorType::e_OK},
+    };
+    const TestParameters* testParametersEnd = testParameters +
+                                              sizeof(testParameters) /
+                                                  sizeof(*testParameters);
+
+    for (const TestParameters* parameters = testParameters;
+         parameters < testParametersEnd;
+         ++parameters) {
+        PV(bsl::string("TESTING ") + parameters->expression);
+
+        CompilationContext compilationContext(s_allocator_p);
+        SimpleEvaluator    evaluator;
+
+        ASSERT_EQ(evaluator.compile(parameters->expression,
+                                    compilationContext),
+                  0);
+
+        const bool result = evaluator.evaluate(evaluationContext);
+
+        ASSERT_EQ(evaluationContext.lastError(), parameters->errorCode);
+        ASSERT_EQ(evaluationContext.hasError(),
+                  parameters->errorCode != ErrorType::e_OK);
+
+        if (evaluationContext.hasError()) {
+            ASSERT_EQ(result, false);
+        }
+
+        // A copy of an evaluator shares its compiled program, and evaluates
+        // to the same result, even after the original is destroyed.
+        SimpleEvaluator* original = new (*s_allocator_p) SimpleEvaluator();
+        ASSERT_EQ(original->compile(parameters->expression,
+                                    compilationContext),
+                  0);
+
+        SimpleEvaluator copy(*original);
+        s_allocator_p->deleteObject(original);
+
+        ASSERT(copy.isValid());
+        ASSERT_EQ(copy.evaluate(evaluationContext), result);
+        ASSERT_EQ(evaluationContext.lastError(), parameters->errorCode);
+    }
+}
+
+static void test5_equality()
+{
+    struct TestParameters {
+        const char*        expression;
+        bool               hasEquality;
+        const char*        property;
+        bool               isString;
+        const char*        string;
+        bsls::Types::Int64 integer;
+        bool               isComplete;
+    } testParameters[] = {
+        {"x == 42", true, "x", false, "", 42, true},
+        {"42 == x", true, "x", false, "", 42, true},
+        {"x == \"foo\"", true, "x", true, "foo", 0, true},
+        {"\"foo\" == x", true, "x", true, "foo", 0, true},
+        {"region == \"X\" && type == 2", true, "region", true, "X", 0, false},
+        {"type > 2 && region == \"X\"", true, "region", true, "X", 0, false},
+        {"a && (b || c) && type == 3", true, "type", false, "", 3, false},
+        {"x == 42 && x == 42", true, "x", false, "", 42, false},
+        {"x", false},
+        {"x != 42", false},
+        {"x > 42", false},
+        {"x == y", false},
+        {"x == true", false},
+        {"x + 1 == 42", false},
+        {"x == 42 || y", false},
+        {"!(x == 42)", false},
+    };
+    const TestParameters* testParametersEnd = testParameters +
+                                              sizeof(testParameters) /
+                                                  sizeof(*testParameters);
+
+    for (const TestParameters* parameters = testParameters;
+         parameters < testParametersEnd;
+         ++parameters) {
+        PV(bsl::string("TESTING ") + parameters->expression);
+
+        CompilationContext compilationContext(s_allocator_p);
+        SimpleEvaluator    evaluator;
+
+        ASSERT_EQ(evaluator.compile(parameters->expression,
+                                    compilationContext),
+                  0);
+
+        SimpleEvaluator::Equality equality;
+        ASSERT_EQ(evaluator.loadEquality(&equality),
+                  parameters->hasEquality);
+
+        if (!parameters->hasEquality) {
+            continue;  // CONTINUE
+        }
+
+        // The equality refers to the program shared by copies.
+        SimpleEvaluator copy(evaluator);
+        evaluator = SimpleEvaluator();
+
+        ASSERT(copy.loadEquality(&equality));
+        ASSERT_EQ(equality.d_property, parameters->property);
+        ASSERT_EQ(equality.d_isString, parameters->isString);
+        ASSERT_EQ(equality.d_isComplete, parameters->isComplete);
+
+        if (parameters->isString) {
+            ASSERT_EQ(equality.d_string, parameters->string);
+        }
+        else {
+            ASSERT_EQ(equality.d_integer, parameters->integer);
+        }
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -492,6 +668,8 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 5: test5_equality(); break;
+    case 4: test4_evaluationErrors(); break;
     case 3: test3_evaluation(); break;
     case 2: test2_propertyNames(); break;
     case 1: test1_compilationErrors(); break;
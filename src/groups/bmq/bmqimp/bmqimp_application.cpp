@@ -28,6 +28,7 @@
 #include <mwcex_systemexecutor.h>
 #include <mwcio_channelutil.h>
 #include <mwcio_connectoptions.h>
+#include <mwcio_ntcchannel.h>
 #include <mwcio_status.h>
 #include <mwcio_tcpendpoint.h>
 #include <mwcma_countingallocatorutil.h>
@@ -37,6 +38,7 @@
 #include <mwcu_blob.h>
 #include <mwcu_memoutstream.h>
 #include <mwcu_printutil.h>
+#include <mwcu_stringutil.h>
 
 // MWC
 #include <mwcscm_version.h>
@@ -80,6 +82,10 @@ const double             k_RECONNECT_INTERVAL_MS = 500;
 const int                k_RECONNECT_COUNT = bsl::numeric_limits<int>::max();
 const bsls::Types::Int64 k_CHANNEL_LOW_WATERMARK = 512 * 1024;
 
+/// Scheme of a broker URI designating the path of the local socket of a
+/// broker running on this host, e.g. `unix:///var/run/bmq.sock`.
+const char k_LOCAL_URI_SCHEME[] = "unix://";
+
 /// Create the StatContextConfiguration to use, from the specified
 /// `options`, and using the specified `allocator` for memory allocations.
 mwcst::StatContextConfiguration
@@ -296,13 +302,15 @@ void Application::channelStateCallback(
 
 bslma::ManagedPtr<mwcst::StatContext> Application::channelStatContextCreator(
     BSLS_ANNOTATION_UNUSED const bsl::shared_ptr<mwcio::Channel>& channel,
-    const bsl::shared_ptr<mwcio::StatChannelFactoryHandle>&       handle)
+    const bsl::shared_ptr<mwcio::StatChannelFactoryHandle>&       handle,
+    const mwcst::StatContext::SnapshotCallback& preSnapshotCallback)
 {
     // The SDK only connects
     BSLS_ASSERT_SAFE(handle->options().is<mwcio::ConnectOptions>());
 
     mwcst::StatContextConfiguration config(
         handle->options().the<mwcio::ConnectOptions>().endpoint());
+    config.preSnapshotCallback(preSnapshotCallback);
     return d_channelsStatContext_mp->addSubcontext(config);
 }
 
@@ -362,16 +370,30 @@ bmqt::GenericResult::Enum Application::startChannel()
                              &d_reconnectingChannelFactory));
 
     // Connect to the broker.
-    mwcio::TCPEndpoint endpoint(d_sessionOptions.brokerUri());
-    if (!endpoint) {
-        BALL_LOG_ERROR << "Invalid brokerURI '" << d_sessionOptions.brokerUri()
-                       << "'";
-        return bmqt::GenericResult::e_INVALID_ARGUMENT;  // RETURN
-    }
+    const bsl::string& brokerUri = d_sessionOptions.brokerUri();
 
     bdlma::LocalSequentialAllocator<32> localAllocator(&d_allocator);
     mwcu::MemOutStream                  out(&localAllocator);
-    out << endpoint.host() << ":" << endpoint.port();
+    if (mwcu::StringUtil::startsWith(brokerUri, k_LOCAL_URI_SCHEME)) {
+        // Broker on this host, reached over its local socket
+        const bsl::size_t schemeLength = sizeof(k_LOCAL_URI_SCHEME) - 1;
+        if (brokerUri.length() == schemeLength) {
+            BALL_LOG_ERROR << "Invalid brokerURI '" << brokerUri << "'";
+            return bmqt::GenericResult::e_INVALID_ARGUMENT;  // RETURN
+        }
+
+        out << mwcio::NtcChannelUtil::localEndpointPrefix()
+            << brokerUri.substr(schemeLength);
+    }
+    else {
+        mwcio::TCPEndpoint endpoint(brokerUri);
+        if (!endpoint) {
+            BALL_LOG_ERROR << "Invalid brokerURI '" << brokerUri << "'";
+            return bmqt::GenericResult::e_INVALID_ARGUMENT;  // RETURN
+        }
+
+        out << endpoint.host() << ":" << endpoint.port();
+    }
 
     bsls::TimeInterval attemptInterval;
     attemptInterval.setTotalMilliseconds(k_RECONNECT_INTERVAL_MS);
@@ -589,7 +611,8 @@ Application::Application(
           bdlf::BindUtil::bind(&Application::channelStatContextCreator,
                                this,
                                bdlf::PlaceHolders::_1,   // channel
-                               bdlf::PlaceHolders::_2),  // handle
+                               bdlf::PlaceHolders::_2,   // handle
+                               bdlf::PlaceHolders::_3),  // preSnapshotCallback
           allocator),
       allocator)
 , d_negotiatedChannelFactory(
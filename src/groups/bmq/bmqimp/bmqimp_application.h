@@ -51,13 +51,13 @@
 #include <mwcio_statchannelfactory.h>
 #include <mwcma_countingallocator.h>
 #include <mwcma_countingallocatorstore.h>
+#include <mwcma_threadcachedblobbufferfactory.h>
 #include <mwcst_basictableinfoprovider.h>
 #include <mwcst_statcontext.h>
 #include <mwcst_table.h>
 
 // BDE
 #include <ball_log.h>
-#include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlmt_eventscheduler.h>
 #include <bsl_memory.h>
 #include <bslma_allocator.h>
@@ -114,7 +114,7 @@ class Application {
 
     mwcu::BasicTableInfoProvider d_channelsTip;
 
-    bdlbb::PooledBlobBufferFactory d_blobBufferFactory;
+    mwcma::ThreadCachedBlobBufferFactory d_blobBufferFactory;
     // Factory for blob buffers
 
     bdlmt::EventScheduler d_scheduler;
@@ -173,10 +173,12 @@ class Application {
                               const bsl::shared_ptr<mwcio::Channel>& channel);
 
     /// Create and return the statContext to be used for tracking stats of
-    /// the specified `channel` obtained from the specified `handle`.
+    /// the specified `channel` obtained from the specified `handle`, and
+    /// configured with the specified `preSnapshotCallback`.
     bslma::ManagedPtr<mwcst::StatContext> channelStatContextCreator(
         const bsl::shared_ptr<mwcio::Channel>&                  channel,
-        const bsl::shared_ptr<mwcio::StatChannelFactoryHandle>& handle);
+        const bsl::shared_ptr<mwcio::StatChannelFactoryHandle>& handle,
+        const mwcst::StatContext::SnapshotCallback& preSnapshotCallback);
 
     /// Method to call after the broker session has been stopped (whether
     /// sync or async), for cleanup of application.
@@ -18,10 +18,12 @@
 
 #include <bmqscm_version.h>
 // BMQ
+#include <bmqimp_flowcontrolmonitor.h>
 #include <bmqimp_negotiatedchannelfactory.h>
 #include <bmqimp_queue.h>
 #include <bmqp_ackeventbuilder.h>
 #include <bmqp_ackmessageiterator.h>
+#include <bmqp_compressiondictionary.h>
 #include <bmqp_confirmeventbuilder.h>
 #include <bmqp_confirmmessageiterator.h>
 #include <bmqp_controlmessageutil.h>
@@ -132,6 +134,16 @@ void poolCreateEvent(void*                     address,
     new (address) Event(bufferFactory, allocator);
 }
 
+/// Create a `bdlbb::Blob` object at the specified `address` using the
+/// specified `bufferFactory` and `allocator`.  This is used by the Object
+/// Pool.
+void poolCreateBlob(void*                     address,
+                    bdlbb::BlobBufferFactory* bufferFactory,
+                    bslma::Allocator*         allocator)
+{
+    new (address) bdlbb::Blob(bufferFactory, allocator);
+}
+
 void callbackAdapter(
     const bsl::function<void()>& f,
     BSLS_ANNOTATION_UNUSED const bsl::shared_ptr<Event>& eventSp)
@@ -402,6 +414,18 @@ void BrokerSession::SessionFsm::setStarted(
     d_onceConnected            = true;
     d_session.d_acceptRequests = true;
 
+    // Start adapting the unconfirmed windows of the reader queues, if enabled
+    const bsls::TimeInterval& flowControlInterval =
+        d_session.d_sessionOptions.flowControlAdaptationInterval();
+    if (flowControlInterval != bsls::TimeInterval(0) &&
+        !d_session.d_flowControlTimerHandle) {
+        d_session.d_scheduler_p->scheduleRecurringEvent(
+            &d_session.d_flowControlTimerHandle,
+            flowControlInterval,
+            bdlf::BindUtil::bind(&BrokerSession::onFlowControlTimeout,
+                                 &d_session));
+    }
+
     // Post on the semaphore (to wake-up a sync 'start', if any)
     d_session.d_startSemaphore.post();
 }
@@ -516,6 +540,12 @@ void BrokerSession::SessionFsm::setStopped(FsmEvent::Enum event,
     d_session.d_scheduler_p->cancelEvent(
         &d_session.d_messageExpirationTimeoutHandle);
 
+    // Cancel the linger timer of the PUT batch
+    d_session.d_scheduler_p->cancelEvent(&d_session.d_putBatchTimeoutHandle);
+
+    // Cancel the flow control adaptation timer
+    d_session.d_scheduler_p->cancelEvent(&d_session.d_flowControlTimerHandle);
+
     // The session is fully stopped, we can now reset its state to release any
     // references to objects (queues, ...) it may still hold.
     d_session.resetState();
@@ -769,6 +799,9 @@ void BrokerSession::SessionFsm::handleChannelDown()
 
     d_session.d_channel_sp.reset();
 
+    // Hand the pending PUT batch, if any, for retransmission
+    d_session.flushPutBatch();
+
     // Remove all pending blobs from the blob queue
     d_session.d_extensionBlobBuffer.clear();
 
@@ -1200,6 +1233,8 @@ void BrokerSession::QueueFsm::actionInitQueue(
     if (!isReopenRequest && d_session.d_queuesStats.d_statContext_mp) {
         queue->registerStatContext(
             d_session.d_queuesStats.d_statContext_mp.get());
+        queue->setLatencies(
+            d_session.d_eventsStats.queueLatencies(queue->uri().asString()));
     }
 }
 
@@ -1693,10 +1728,53 @@ void BrokerSession::QueueFsm::handleReopenRequest(
                                                                   context,
                                                                   timeout);
         if (res != bmqt::OpenQueueResult::e_SUCCESS) {
+            queue->setIsConfigurePipelined(false);
             handleRequestNotSent(
                 queue,
                 context,
                 static_cast<bmqp_ctrlmsg::StatusCategory::Value>(res));
+            break;  // BREAK
+        }
+
+        // If the broker holds the configure of a queue until the queue is
+        // opened, send the configure request right behind the open request
+        // so that the reopen takes a single round trip.  Suspended and
+        // write-only queues skip the configure step altogether.
+        int        isPipelined;
+        const bool pipelineConfigure =
+            d_session.d_channel_sp &&
+            d_session.d_channel_sp->properties().load(
+                &isPipelined,
+                NegotiatedChannelFactory::
+                    k_CHANNEL_PROPERTY_PIPELINED_CONFIGURE) &&
+            bmqt::QueueFlagsUtil::isReader(queue->flags()) &&
+            !(queue->options().suspendsOnBadHostHealth() &&
+              !d_session.isHostHealthy());
+
+        queue->setIsConfigurePipelined(pipelineConfigure);
+        if (!pipelineConfigure) {
+            break;  // BREAK
+        }
+
+        RequestManagerType::RequestSp configureQueueContext =
+            d_session.createConfigureQueueContext(queue,
+                                                  queue->options(),
+                                                  false,   // isDeconfigure
+                                                  false);  // isBuffered
+
+        bmqt::ConfigureQueueResult::Enum rc = actionOpenConfigureQueue(
+            context,
+            configureQueueContext,
+            queue,
+            mwcsys::Time::nowMonotonicClock() + timeout,
+            true);  // isReopenRequest
+        if (rc != bmqt::ConfigureQueueResult::e_SUCCESS) {
+            // The configure request will be sent once the open response is
+            // received, as with a broker not pipelining configure requests.
+            BALL_LOG_WARN << "Unable to pipeline the configure request of "
+                          << "the reopen of queue: " << *queue
+                          << " [rc: " << rc << "]";
+            queue->setIsConfigurePipelined(false);
         }
     } break;
     case QueueState::e_OPENED:
@@ -2494,10 +2572,8 @@ void BrokerSession::QueueFsm::handleResponseOk(
             break;  // BREAK
         }
 
-        bmqpi::DTSpan::Baggage baggage(d_session.d_allocator_p);
-        fillDTSpanQueueBaggage(&baggage, *queue);
         bsl::shared_ptr<bmqpi::DTSpan> configureSpan(
-            d_session.createDTSpan("bmq.queue.openConfigure", baggage));
+            d_session.createDTSpan("bmq.queue.openConfigure", *queue));
         bslma::ManagedPtr<void> scopedSpan(
             d_session.activateDTSpan(configureSpan));
 
@@ -2530,6 +2606,15 @@ void BrokerSession::QueueFsm::handleResponseOk(
         // Set REOPENING_CFG state and Send configure queue request
         setQueueState(queue, QueueState::e_REOPENING_CFG, event);
 
+        if (queue->isConfigurePipelined()) {
+            // The configure request was sent along with the open request:
+            // its response completes the reopen.
+            queue->setIsConfigurePipelined(false);
+            queue->setIsSuspended(false);
+            queue->setIsSuspendedWithBroker(false);
+            break;  // BREAK
+        }
+
         // If queue is sensitive to host health and the host is unhealthy,
         // then transition directly to suspended state.
         queue->setIsSuspended(queue->options().suspendsOnBadHostHealth() &&
@@ -3052,7 +3137,7 @@ void BrokerSession::fsmThreadLoop()
         const Event::EventType::Enum eventType = event->type();
         switch (eventType) {
         case Event::EventType::e_RAW: {
-            processRawEvent(event->rawEvent());
+            processRawEvent(event->rawEvent(), event->receivedTime());
         } break;
         case Event::EventType::e_REQUEST: {
             BSLS_ASSERT_SAFE(event->eventCallback() != 0);
@@ -3114,6 +3199,32 @@ void BrokerSession::eventHandlerCbWrapper(
     }
 }
 
+void BrokerSession::reenqueueIfDisconnected(
+    const bsl::shared_ptr<Event>& event)
+{
+    // executed by one of the *APPLICATION* threads
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            event->type() == Event::EventType::e_SESSION &&
+            event->sessionEventType() ==
+                bmqt::SessionEventType::e_DISCONNECTED)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        // By contract with the user, the 'DISCONNECTED' event is the event
+        // that their event loop should use to exit.  We have no control over
+        // how many threads the user have which are calling 'nextEvent',
+        // therefore we automatically immediately re-enqueue a DISCONNECTED
+        // event once we popped one out.
+        bsl::shared_ptr<Event> disconnectEvent = createEvent();
+        disconnectEvent->configureAsSessionEvent(
+            bmqt::SessionEventType::e_DISCONNECTED,
+            0,
+            bmqt::CorrelationId(),
+            "");
+        // Dispatch event to the user event queue
+        d_eventQueue.pushBack(disconnectEvent);
+    }
+}
+
 void BrokerSession::asyncRequestNotifier(
     const RequestManagerType::RequestSp& context,
     bmqt::SessionEventType::Enum         eventType,
@@ -3223,7 +3334,8 @@ void BrokerSession::manualSyncRequestNotifier(
     eventCallback(event);
 }
 
-void BrokerSession::processRawEvent(const bmqp::Event& event)
+void BrokerSession::processRawEvent(const bmqp::Event& event,
+                                    bsls::Types::Int64 receivedTime)
 {
     // executed by the FSM thread
     // PRECONDITIONS
@@ -3234,7 +3346,7 @@ void BrokerSession::processRawEvent(const bmqp::Event& event)
         processControlEvent(event);
     }
     else if (event.isPushEvent()) {
-        processPushEvent(event);
+        processPushEvent(event, receivedTime);
     }
     else if (event.isAckEvent()) {
         processAckEvent(event);
@@ -3355,21 +3467,29 @@ void BrokerSession::processPutEvent(const bmqp::Event& event)
     bool readyToSend = isStarted() && (d_numPendingReopenQueues == 0);
 
     if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(readyToSend)) {
-        // Post the event.
-        bmqt::GenericResult::Enum res = writeOrBuffer(
-            *event.blob(),
-            d_sessionOptions.channelHighWatermark());
+        // Coalesce the event with the other pending ones if batching is
+        // enabled.  Messages added to the batch are considered sent: if the
+        // batch can not be written, 'flushPutBatch' takes care of their
+        // retransmission.
+        const bool isBatched = d_sessionOptions.putBatchMaxBytes() > 0 &&
+                               batchPutEvent(*event.blob());
 
-        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
-                res != bmqt::GenericResult::e_SUCCESS)) {
-            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        if (!isBatched) {
+            bmqt::GenericResult::Enum res = writePutEvent(*event.blob());
 
-            BALL_LOG_ERROR << "Unable to post event [reason: 'NOT_CONNECTED']";
+            if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                    res != bmqt::GenericResult::e_SUCCESS)) {
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+                BALL_LOG_ERROR
+                    << "Unable to post event [reason: 'NOT_CONNECTED']";
 
-            // Channel is down. The blob hasn't been put into the extention
-            // buffer. The messages will be put into the retransmitting buffer
-            // to be sent once the session is reconnected.
-            readyToSend = false;
+                // Channel is down. The blob hasn't been put into the
+                // extention buffer. The messages will be put into the
+                // retransmitting buffer to be sent once the session is
+                // reconnected.
+                readyToSend = false;
+            }
         }
     }
 
@@ -3404,6 +3524,125 @@ void BrokerSession::processPutEvent(const bmqp::Event& event)
     }
 }
 
+bmqt::GenericResult::Enum
+BrokerSession::writePutEvent(const bdlbb::Blob& eventBlob)
+{
+    // executed by the FSM thread
+
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    // Post the event, in the compact encoding if the broker supports it.
+    // Note that the messages kept for retransmission refer to the original
+    // event.
+    const bdlbb::Blob* blob = &eventBlob;
+    bdlbb::Blob        compactEvent(d_bufferFactory_p, d_allocator_p);
+    int                isCompactPut;
+    if (d_channel_sp &&
+        d_channel_sp->properties().load(
+            &isCompactPut,
+            NegotiatedChannelFactory::k_CHANNEL_PROPERTY_COMPACT_PUT) &&
+        0 == bmqp::EventUtil::compactPutEvent(&compactEvent, *blob)) {
+        blob = &compactEvent;
+    }
+
+    return writeOrBuffer(*blob, d_sessionOptions.channelHighWatermark());
+}
+
+bool BrokerSession::batchPutEvent(const bdlbb::Blob& eventBlob)
+{
+    // executed by the FSM thread
+
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+    BSLS_ASSERT_SAFE(d_sessionOptions.putBatchMaxBytes() > 0);
+
+    const int maxBytes = bsl::min(d_sessionOptions.putBatchMaxBytes(),
+                                  bmqp::EventHeader::k_MAX_SIZE_SOFT);
+
+    if (eventBlob.length() >= maxBytes) {
+        // Large enough to be written alone.  Write the pending batch first to
+        // preserve the order of the messages.
+        flushPutBatch();
+        return false;  // RETURN
+    }
+
+    const int messagesSize = eventBlob.length() -
+                             static_cast<int>(sizeof(bmqp::EventHeader));
+    if (d_putBatch.length() + messagesSize > maxBytes) {
+        flushPutBatch();
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            0 != bmqp::EventUtil::appendPutEvent(&d_putBatch, eventBlob))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        // E.g., an event in the compact encoding: write it alone.
+        flushPutBatch();
+        return false;  // RETURN
+    }
+
+    if (d_putBatch.length() >= maxBytes) {
+        flushPutBatch();
+    }
+    else if (!d_putBatchTimeoutHandle) {
+        d_scheduler_p->scheduleEvent(
+            &d_putBatchTimeoutHandle,
+            mwcsys::Time::nowMonotonicClock() +
+                d_sessionOptions.putBatchLinger(),
+            bdlf::BindUtil::bind(&BrokerSession::onPutBatchTimeout, this));
+    }
+
+    return true;
+}
+
+void BrokerSession::flushPutBatch()
+{
+    // executed by the FSM thread
+
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    if (d_putBatchTimeoutHandle) {
+        d_scheduler_p->cancelEvent(&d_putBatchTimeoutHandle);
+    }
+
+    if (d_putBatch.length() == 0) {
+        return;  // RETURN
+    }
+
+    // Swap the batch out first, since 'writeOrBuffer' flushes the batch
+    // before writing any other event.
+    bdlbb::Blob batch(d_bufferFactory_p, d_allocator_p);
+    batch.swap(d_putBatch);
+
+    bmqt::GenericResult::Enum res = bmqt::GenericResult::e_NOT_CONNECTED;
+    if (d_channel_sp) {
+        res = writePutEvent(batch);
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(res ==
+                                            bmqt::GenericResult::e_SUCCESS)) {
+        return;  // RETURN
+    }
+
+    BALL_LOG_ERROR << "Unable to post batched PUT event "
+                   << "[reason: 'NOT_CONNECTED']";
+
+    // Messages with the ACK_REQUESTED flag have been added for
+    // retransmission when batched, add the other ones now.
+    const bsls::TimeInterval sentTime = mwcsys::Time::nowMonotonicClock();
+    bmqp::Event              event(&batch, d_allocator_p);
+    bmqp::PutMessageIterator putIter(d_bufferFactory_p, d_allocator_p);
+    event.loadPutMessageIterator(&putIter);
+
+    BSLS_ASSERT_SAFE(putIter.isValid());
+
+    while (putIter.next() == 1) {
+        if (!bmqp::PutHeaderFlagUtil::isSet(
+                putIter.header().flags(),
+                bmqp::PutHeaderFlags::e_ACK_REQUESTED)) {
+            enableMessageRetransmission(putIter, sentTime);
+        }
+    }
+}
+
 void BrokerSession::processConfirmEvent(const bmqp::Event& event)
 {
     // executed by the FSM thread
@@ -3421,11 +3660,58 @@ void BrokerSession::processConfirmEvent(const bmqp::Event& event)
     bmqp::ConfirmMessageIterator confirmIter;
     event.loadConfirmMessageIterator(&confirmIter);
 
-    // Iterate over the messages to count number of messages
+    const bool isFlowControlAdaptive =
+        d_sessionOptions.flowControlAdaptationInterval() !=
+        bsls::TimeInterval(0);
+
+    int        hasRanges;
+    const bool mustExpandRanges =
+        confirmIter.isValid() && confirmIter.isRangeEncoded() &&
+        !d_channel_sp->properties().load(
+            &hasRanges,
+            NegotiatedChannelFactory::k_CHANNEL_PROPERTY_CONFIRM_RANGES);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(mustExpandRanges)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        // The broker does not support range encoded confirm events: send
+        // the confirmations individually.
+        bmqp::ConfirmEventBuilder builder(d_bufferFactory_p, d_allocator_p);
+        int                       rc = 0;
+        while ((rc = confirmIter.next()) == 1) {
+            const bmqp::ConfirmMessage& message = confirmIter.message();
+            if (builder.messageCount() == builder.maxMessageCount()) {
+                sendConfirm(builder.blob(), builder.messageCount());
+                builder.reset();
+            }
+            builder.appendMessage(message.queueId(),
+                                  message.subQueueId(),
+                                  message.messageGUID());
+            if (isFlowControlAdaptive) {
+                recordConfirms(message.queueId(), message.subQueueId(), 1);
+            }
+        }
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc < 0)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            BALL_LOG_ERROR << "Unable to confirm event [reason: 'Iteration "
+                           << "failed',rc: " << rc << "]";
+        }
+        else if (builder.messageCount() != 0) {
+            sendConfirm(builder.blob(), builder.messageCount());
+        }
+        return;  // RETURN
+    }
+
+    // Iterate over the ranges to count number of messages
     int rc       = 0;
     int msgCount = 0;
-    while ((rc = confirmIter.next()) == 1) {
-        ++msgCount;
+    while ((rc = confirmIter.nextRange()) == 1) {
+        msgCount += confirmIter.rangeLength();
+        if (isFlowControlAdaptive) {
+            const bmqp::ConfirmMessage& message = confirmIter.message();
+            recordConfirms(message.queueId(),
+                           message.subQueueId(),
+                           confirmIter.rangeLength());
+        }
     }
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc < 0)) {
@@ -3439,7 +3725,23 @@ void BrokerSession::processConfirmEvent(const bmqp::Event& event)
     sendConfirm(*event.blob(), msgCount);
 }
 
-void BrokerSession::processPushEvent(const bmqp::Event& event)
+void BrokerSession::recordConfirms(int queueId,
+                                   int subQueueId,
+                                   int numMessages)
+{
+    // executed by the FSM thread
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    const QueueManager::QueueSp queue = d_queueManager.lookupQueue(
+        bmqp::QueueId(queueId, subQueueId));
+    if (queue) {
+        queue->flowControlMonitor().onConfirm(numMessages);
+    }
+}
+
+void BrokerSession::processPushEvent(const bmqp::Event& event,
+                                     bsls::Types::Int64 receivedTime)
 {
     // executed by the FSM thread
     // PRECONDITIONS
@@ -3490,7 +3792,8 @@ void BrokerSession::processPushEvent(const bmqp::Event& event)
         rc = bmqp::EventUtil::flattenPushEvent(&eventInfos,
                                                event,
                                                d_bufferFactory_p,
-                                               d_allocator_p);
+                                               d_allocator_p,
+                                               true);  // zeroCopy
         if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
             BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
             BALL_LOG_ERROR << "Unable to flatten PUSH event"
@@ -3508,6 +3811,14 @@ void BrokerSession::processPushEvent(const bmqp::Event& event)
         // No need to flatten, can use the original blob.
     }
 
+    // Average size of the messages of the event, recorded in the flow
+    // control monitor of their queues, or -1 if flow control is not adaptive
+    const int averageMessageSize =
+        d_sessionOptions.flowControlAdaptationInterval() ==
+                bsls::TimeInterval(0)
+            ? -1
+            : event.blob()->length() / bsl::max(eventMessageCount, 1);
+
     bsl::shared_ptr<Event> queueEvent;
 
     for (QueueManager::EventInfos::size_type i = 0; i < eventInfos.size();) {
@@ -3519,10 +3830,12 @@ void BrokerSession::processPushEvent(const bmqp::Event& event)
                                        d_allocator_p,
                                        true);
             queueEvent->configureAsMessageEvent(rawEvent);
+            queueEvent->setReceivedTime(receivedTime);
         }
         else if (i == 0) {
             queueEvent = createEvent();
             queueEvent->configureAsMessageEvent(event);
+            queueEvent->setReceivedTime(receivedTime);
         }
         // Insert queues in event
         const bmqp::EventUtilEventInfo::Ids& sIds = currEventInfo.d_ids;
@@ -3537,6 +3850,10 @@ void BrokerSession::processPushEvent(const bmqp::Event& event)
             BSLS_ASSERT(queue);
             queueEvent->insertQueue(citer->d_subscriptionId, queue);
 
+            if (averageMessageSize >= 0) {
+                queue->flowControlMonitor().onPush(averageMessageSize);
+            }
+
             queueEvent->addCorrelationId(correlationId,
                                          citer->d_subscriptionId);
         }
@@ -3604,7 +3921,8 @@ void BrokerSession::processAckEvent(const bmqp::Event& event)
 
     bmqp::AckMessageIterator it;
     event.loadAckMessageIterator(&it);
-    int numAckMsgs = 0;
+    int                      numAckMsgs = 0;
+    const bsls::TimeInterval now        = mwcsys::Time::nowMonotonicClock();
     while (it.next()) {
         ++numAckMsgs;
         const bmqp::AckMessage& ackMsg = it.message();
@@ -3626,13 +3944,20 @@ void BrokerSession::processAckEvent(const bmqp::Event& event)
         }
 
         bmqt::CorrelationId correlationId;
+        bsls::TimeInterval  sentTime;
         if (d_messageCorrelationIdContainer.remove(ackMsg.messageGUID(),
-                                                   &correlationId) != 0) {
+                                                   &correlationId,
+                                                   &sentTime) != 0) {
             // There is no correlationId associated with this GUID.
             // Per contract, broker does not send ACKs where status is zero and
             // correlationId is null.
             BSLS_ASSERT_SAFE(0 != ackMsg.status());
         }
+        else if (queue->latencies() && sentTime != bsls::TimeInterval()) {
+            queue->latencies()->onLatency(
+                EventsStatsLatencyType::e_PUT_TO_ACK,
+                (now - sentTime).totalNanoseconds());
+        }
 
         // Keep track of user-provided CorrelationId (it may be unset)
         queueEvent->addCorrelationId(correlationId);
@@ -4069,10 +4394,8 @@ bmqt::ConfigureQueueResult::Enum BrokerSession::sendDeconfigureRequest(
         .setMaxUnconfirmedBytes(0)
         .setConsumerPriority(bmqp::Protocol::k_CONSUMER_PRIORITY_INVALID);
 
-    bmqpi::DTSpan::Baggage baggage(d_allocator_p);
-    fillDTSpanQueueBaggage(&baggage, *queue);
     bsl::shared_ptr<bmqpi::DTSpan> configureSpan(
-        createDTSpan("bmq.queue.closeConfigure", baggage));
+        createDTSpan("bmq.queue.closeConfigure", *queue));
     bslma::ManagedPtr<void> scopedSpan(activateDTSpan(configureSpan));
 
     RequestManagerType::RequestSp configureQueueContext =
@@ -4099,6 +4422,97 @@ void BrokerSession::doHandleStartTimeout(
     d_sessionFsm.handleStartTimeout();
 }
 
+void BrokerSession::doHandlePutBatchTimeout(
+    BSLS_ANNOTATION_UNUSED const bsl::shared_ptr<Event>& eventSp)
+{
+    // executed by the FSM thread
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    flushPutBatch();
+}
+
+void BrokerSession::doHandleFlowControlTimeout(
+    BSLS_ANNOTATION_UNUSED const bsl::shared_ptr<Event>& eventSp)
+{
+    // executed by the FSM thread
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    if (!isStarted()) {
+        // The windows will be adapted once the session is reconnected
+        return;  // RETURN
+    }
+
+    bsl::vector<bsl::shared_ptr<Queue> > allQueues(d_allocator_p);
+    d_queueManager.getAllQueues(&allQueues);
+
+    for (bsl::vector<bsl::shared_ptr<Queue> >::size_type idx = 0;
+         idx != allQueues.size();
+         ++idx) {
+        const bsl::shared_ptr<Queue>& queue = allQueues[idx];
+
+        // Only adapt the windows of the opened reader queues which are not
+        // being configured or suspended.  Messages of 'atMostOnce' queues
+        // do not need to be confirmed, so that their consumption can't be
+        // observed.
+        if (!bmqt::QueueFlagsUtil::isReader(queue->flags()) ||
+            queue->state() != QueueState::e_OPENED || queue->atMostOnce() ||
+            queue->pendingConfigureId() != Queue::k_INVALID_CONFIGURE_ID ||
+            queue->isSuspended() || queue->isSuspendedWithBroker()) {
+            continue;  // CONTINUE
+        }
+
+        FlowControlMonitor&       monitor = queue->flowControlMonitor();
+        const bmqt::QueueOptions& options = queue->options();
+
+        if (!monitor.hasLimits()) {
+            // The queue was opened with the windows of its options
+            if (options.maxUnconfirmedMessages() <= 0 ||
+                options.maxUnconfirmedBytes() <= 0) {
+                continue;  // CONTINUE
+            }
+            monitor.setLimits(options.maxUnconfirmedMessages(),
+                              options.maxUnconfirmedBytes());
+        }
+
+        int maxMessages = 0;
+        int maxBytes    = 0;
+        if (!monitor.computeWindow(&maxMessages,
+                                   &maxBytes,
+                                   options.maxUnconfirmedMessages(),
+                                   options.maxUnconfirmedBytes())) {
+            continue;  // CONTINUE
+        }
+
+        BALL_LOG_INFO << "Adapting unconfirmed windows [queue: "
+                      << queue->uri() << ", maxUnconfirmedMessages: "
+                      << options.maxUnconfirmedMessages() << " -> "
+                      << maxMessages << ", maxUnconfirmedBytes: "
+                      << options.maxUnconfirmedBytes() << " -> " << maxBytes
+                      << ", monitor: " << monitor << "]";
+
+        bmqt::QueueOptions updatedOptions(options, d_allocator_p);
+        updatedOptions.setMaxUnconfirmedMessages(maxMessages)
+            .setMaxUnconfirmedBytes(maxBytes);
+        queue->setOptions(updatedOptions);
+
+        const bmqt::ConfigureQueueResult::Enum rc = sendReconfigureRequest(
+            queue);
+        if (rc == bmqt::ConfigureQueueResult::e_SUCCESS) {
+            // This configure is internal to the SDK: as in
+            // 'actionReconfigureQueue', reset the pending configure id so
+            // that it does not make a configure from the user fail.
+            queue->setPendingConfigureId(Queue::k_INVALID_CONFIGURE_ID);
+        }
+        else {
+            BALL_LOG_WARN << "Failed to send the adapted unconfirmed windows "
+                          << "[queue: " << queue->uri() << ", rc: " << rc
+                          << "]";
+        }
+    }
+}
+
 void BrokerSession::doHandlePendingPutExpirationTimeout(
     BSLS_ANNOTATION_UNUSED const bsl::shared_ptr<Event>& eventSp)
 {
@@ -4965,6 +5379,28 @@ void BrokerSession::doConfigureQueue(
     bmqt::QueueOptions updatedOptions(queue->options());
     updatedOptions.merge(options);
 
+    if (d_sessionOptions.flowControlAdaptationInterval() !=
+        bsls::TimeInterval(0)) {
+        // The windows explicitly configured by the user become the highest
+        // windows the flow control adaptation may set.
+        FlowControlMonitor& monitor  = queue->flowControlMonitor();
+        int                 maxBytes = updatedOptions.maxUnconfirmedBytes();
+        int maxMessages = updatedOptions.maxUnconfirmedMessages();
+        if (monitor.hasLimits()) {
+            // 'updatedOptions' may hold adapted windows: keep the limits
+            // not explicitly configured.
+            if (!options.hasMaxUnconfirmedMessages()) {
+                maxMessages = monitor.messagesLimit();
+            }
+            if (!options.hasMaxUnconfirmedBytes()) {
+                maxBytes = monitor.bytesLimit();
+            }
+        }
+        if (0 < maxMessages && 0 < maxBytes) {
+            monitor.setLimits(maxMessages, maxBytes);
+        }
+    }
+
     RequestManagerType::RequestSp context =
         createStandaloneConfigureQueueContext(queue,
                                               updatedOptions,
@@ -5514,6 +5950,12 @@ BrokerSession::writeOrBuffer(const bdlbb::Blob& eventBlob,
     BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
     BSLS_ASSERT_SAFE(d_channel_sp);
 
+    // Write any pending PUT batch first, so that events are sent in the
+    // order they were posted.
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_putBatch.length() != 0)) {
+        flushPutBatch();
+    }
+
     mwcio::Status             status(d_allocator_p);
     bmqt::GenericResult::Enum res = bmqt::GenericResult::e_SUCCESS;
 
@@ -5558,6 +6000,13 @@ BrokerSession::BrokerSession(
     const StateFunctor&                     stateCb,
     bslma::Allocator*                       allocator)
 : d_allocators(allocator)
+, d_compressionThreadPool_mp()
+, d_blobSpPool(bdlf::BindUtil::bind(&poolCreateBlob,
+                                    bufferFactory,
+                                    bdlf::PlaceHolders::_1,   // address
+                                    bdlf::PlaceHolders::_2),  // allocator
+                -1,
+                d_allocators.get("BlobSpPool"))
 , d_eventPool(bdlf::BindUtil::bind(&poolCreateEvent,
                                    bdlf::PlaceHolders::_1,  // address
                                    bufferFactory,
@@ -5569,6 +6018,7 @@ BrokerSession::BrokerSession(
 , d_bufferFactory_p(bufferFactory)
 , d_channel_sp()
 , d_extensionBlobBuffer(allocator)
+, d_putBatch(bufferFactory, allocator)
 , d_acceptRequests(false)
 , d_extensionBufferEmpty(true)
 , d_extensionBufferCondition(bsls::SystemClockType::e_MONOTONIC)
@@ -5596,6 +6046,7 @@ BrokerSession::BrokerSession(
                // supply an empty handler callback if session is not
                // configured to use event handler
                (eventHandlerCb ? sessionOptions.numProcessingThreads() : 0),
+               sessionOptions.eventQueueLockFree(),
                d_allocators.get("EventQueue"))
 , d_requestManager(bmqp::EventType::e_CONTROL,
                    bufferFactory,
@@ -5622,6 +6073,8 @@ BrokerSession::BrokerSession(
 , d_inProgressEventHandlerCount(0)
 , d_isStopping(false)
 , d_messageExpirationTimeoutHandle()
+, d_putBatchTimeoutHandle()
+, d_flowControlTimerHandle()
 , d_nextRequestGroupId(k_NON_BUFFERED_REQUEST_GROUP_ID)
 , d_queueRetransmissionTimeoutMap(allocator)
 {
@@ -5639,6 +6092,8 @@ BrokerSession::BrokerSession(
     // remain in sync to prevent misleading values.
     resetState();
 
+    d_eventQueue.setSpinCount(sessionOptions.eventQueueSpinCount());
+
     // Spawn the FSM thread
     bslmt::ThreadAttributes threadAttributes =
         mwcsys::ThreadUtil::defaultAttributes();
@@ -5655,6 +6110,25 @@ BrokerSession::BrokerSession(
     if (d_eventQueue.start() != bmqt::GenericResult::e_SUCCESS) {
         BSLS_ASSERT_OPT(false && "Failed to start user event queue");
     }
+
+    // Start the compression thread pool, if configured
+    const int numCompressionThreads = sessionOptions.numCompressionThreads();
+    if (numCompressionThreads > 0) {
+        threadAttributes.setThreadName("bmqCompress");
+        d_compressionThreadPool_mp.load(
+            new (*d_allocator_p) bdlmt::FixedThreadPool(threadAttributes,
+                                                        numCompressionThreads,
+                                                        numCompressionThreads,
+                                                        d_allocator_p),
+            d_allocator_p);
+        if (d_compressionThreadPool_mp->start() != 0) {
+            // Not fatal, payloads are compressed synchronously.
+            BALL_LOG_ERROR << "Failed to start the compression thread pool "
+                           << "[numThreads: " << numCompressionThreads
+                           << "]";
+            d_compressionThreadPool_mp.reset();
+        }
+    }
 }
 
 BrokerSession::~BrokerSession()
@@ -5673,6 +6147,12 @@ BrokerSession::~BrokerSession()
 
     // Now stop user event queue
     d_eventQueue.stop();
+
+    // Complete the pending compressions, if any; subsequent ones are done
+    // synchronously.
+    if (d_compressionThreadPool_mp) {
+        d_compressionThreadPool_mp->stop();
+    }
 }
 
 void BrokerSession::initializeStats(
@@ -5699,8 +6179,13 @@ BrokerSession::processPacket(const bdlbb::Blob& packet)
 
     enum { e_NUM_BYTES_IN_BLOB_TO_DUMP = 256 };
 
-    // Create a raw event with a cloned blob
-    bmqp::Event event(&packet, d_allocator_p, true);
+    // Create a raw event with a copy of the blob, recycled from the pool so
+    // that the steady-state receive path does not allocate.
+    bsl::shared_ptr<bdlbb::Blob> blob = d_blobSpPool.getObject();
+    *blob                             = packet;
+
+    bmqp::Event event(d_allocator_p);
+    event.reset(blob);
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!event.isValid())) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
         BALL_LOG_ERROR << "Received an invalid packet: "
@@ -5719,6 +6204,11 @@ BrokerSession::processPacket(const bdlbb::Blob& packet)
     // Add to event queue
     bsl::shared_ptr<Event> queueEvent = createEvent();
     queueEvent->configureAsRawEvent(event);
+    if (event.isPushEvent()) {
+        // Keep track of the reception time, to report the latency from PUSH
+        // to user callback.
+        queueEvent->setReceivedTime(mwcsys::Time::highResolutionTimer());
+    }
     return enqueueFsmEvent(queueEvent);
 }
 
@@ -5730,6 +6220,13 @@ void BrokerSession::setChannel(const bsl::shared_ptr<mwcio::Channel>& channel)
         mwcsys::ThreadUtil::setCurrentThreadNameOnce("bmqTCPIO");
     }
 
+    if (d_sessionOptions.ioThreadCpu() >= 0 && channel) {
+        // Bind the IO thread to the requested CPU; this is idempotent, so it
+        // is fine to do it on every connection.
+        mwcsys::ThreadUtil::setCurrentThreadAffinity(
+            d_sessionOptions.ioThreadCpu());
+    }
+
     if (channel) {  // We are now connected to bmqbrkr
         BALL_LOG_INFO << "Channel is CREATED [host: " << channel->peerUri()
                       << "]";
@@ -5925,6 +6422,25 @@ void BrokerSession::onOpenQueueResponse(
             BSLS_ASSERT_SAFE(isMPsEx);
             queue->setOldStyle(false);
         }
+
+        int isCompressionEx;
+        queue->setHasExtendedCompression(
+            d_channel_sp->properties().load(
+                &isCompressionEx,
+                NegotiatedChannelFactory::k_CHANNEL_PROPERTY_COMPRESSION_EX));
+
+        // Register the dictionary, if any, the broker trained for the queue,
+        // so that messages compressed with it can be decompressed.
+        const bsl::vector<char>& dictionary = context->response()
+                                                  .choice()
+                                                  .openQueueResponse()
+                                                  .compressionDictionary();
+        if (!dictionary.empty()) {
+            queue->setCompressionDictionary(
+                bmqp::CompressionDictionaryRegistry::add(
+                    dictionary.data(),
+                    static_cast<int>(dictionary.size())));
+        }
     }
 
     handleQueueFsmEvent(context,
@@ -5973,8 +6489,10 @@ bmqt::ConfigureQueueResult::Enum BrokerSession::sendOpenConfigureQueue(
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
 
-    // We expect the response to be 'OpenQueueResponse'.
+    // We expect the response to be 'OpenQueueResponse', unless the configure
+    // request is pipelined with the open request of a reopen.
     BSLS_ASSERT_SAFE(
+        queue->isConfigurePipelined() ||
         openQueueContext->response().choice().isOpenQueueResponseValue());
 
     // Do the 2nd step in openQueue flow: configure queue
@@ -6065,6 +6583,16 @@ void BrokerSession::onOpenQueueConfigured(
         BSLS_ASSERT_SAFE(isReopenRequest);
     }
 
+    if (isReopenRequest && queue->isConfigurePipelined()) {
+        // The configure request was pipelined with the open request of the
+        // reopen, and the open response either failed or has not been
+        // processed: the outcome of the reopen is that of the open request.
+        BALL_LOG_INFO << "Ignoring the response of the configure request "
+                      << "pipelined with a failed reopen: [queue: "
+                      << (*queue) << "]";
+        return;  // RETURN
+    }
+
     if (configureQueueContext->isError()) {
         // NOTE: We explicitly set here the response of the openQueue request
         //       to that of the configureQueue request because it is possible
@@ -6437,6 +6965,10 @@ void BrokerSession::notifyQueuesChannelDown()
     for (bsl::vector<bsl::shared_ptr<Queue> >::size_type idx = 0;
          idx != allQueues.size();
          ++idx) {
+        // The consumption observed before the channel went down is
+        // meaningless once the queue is reopened
+        allQueues[idx]->flowControlMonitor().reset();
+
         d_queueFsm.handleChannelDown(allQueues[idx]);
     }
 }
@@ -6492,25 +7024,7 @@ BrokerSession::nextEvent(const bsls::TimeInterval& timeout)
     const bsls::TimeInterval beginTime = mwcsys::Time::nowMonotonicClock();
     bsl::shared_ptr<Event>   event     = d_eventQueue.timedPopFront(timeout);
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
-            event->type() == Event::EventType::e_SESSION &&
-            event->sessionEventType() ==
-                bmqt::SessionEventType::e_DISCONNECTED)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        // By contract with the user, the 'DISCONNECTED' event is the event
-        // that their event loop should use to exit.  We have no control over
-        // how many threads the user have which are calling 'nextEvent',
-        // therefore we automatically immediately re-enqueue a DISCONNECTED
-        // event once we popped one out.
-        bsl::shared_ptr<Event> disconnectEvent = createEvent();
-        disconnectEvent->configureAsSessionEvent(
-            bmqt::SessionEventType::e_DISCONNECTED,
-            0,
-            bmqt::CorrelationId(),
-            "");
-        // Dispatch event to the user event queue
-        d_eventQueue.pushBack(disconnectEvent);
-    }
+    reenqueueIfDisconnected(event);
 
     if (event->eventCallback()) {
         // This is a serialized SESSION event with a user-specified callback.
@@ -6542,6 +7056,33 @@ BrokerSession::nextEvent(const bsls::TimeInterval& timeout)
     return event;
 }
 
+int BrokerSession::tryNextEvent(bsl::shared_ptr<bmqimp::Event>* event)
+{
+    // executed by one of the *APPLICATION* threads
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(event);
+    BSLS_ASSERT_SAFE(!d_usingSessionEventHandler &&
+                     "tryNextEvent() should be used without EventHandler");
+
+    bsl::shared_ptr<Event> poppedEvent;
+    while (d_eventQueue.tryPopFront(&poppedEvent) == 0) {
+        reenqueueIfDisconnected(poppedEvent);
+
+        if (!poppedEvent->eventCallback()) {
+            *event = poppedEvent;
+            return 0;  // RETURN
+        }
+
+        // This is a serialized SESSION event with a user-specified callback:
+        // invoke it inplace for serialization, and try to pop the next event
+        // for the user.
+        poppedEvent->eventCallback()(poppedEvent);
+    }
+
+    return -1;
+}
+
 int BrokerSession::openQueue(const bsl::shared_ptr<Queue>& queue,
                              bsls::TimeInterval            timeout)
 {
@@ -6555,10 +7096,8 @@ int BrokerSession::openQueue(const bsl::shared_ptr<Queue>& queue,
                              &rc,
                              bdlf::PlaceHolders::_1);  // request
 
-    bmqpi::DTSpan::Baggage baggage(d_allocator_p);
-    fillDTSpanQueueBaggage(&baggage, *queue);
     bsl::shared_ptr<bmqpi::DTSpan> openSpan(
-        createDTSpan("bmq.queue.open", baggage));
+        createDTSpan("bmq.queue.open", *queue));
 
     toFsm(fsmCallback,
           bdlf::BindUtil::bind(&BrokerSession::doOpenQueue,
@@ -6589,10 +7128,8 @@ int BrokerSession::openQueueAsync(const bsl::shared_ptr<Queue>& queue,
         queue,
         eventCallback);
 
-    bmqpi::DTSpan::Baggage baggage(d_allocator_p);
-    fillDTSpanQueueBaggage(&baggage, *queue);
     bsl::shared_ptr<bmqpi::DTSpan> openSpan(
-        createDTSpan("bmq.queue.open", baggage));
+        createDTSpan("bmq.queue.open", *queue));
 
     int rc = toFsm(fsmCallback,
                    bdlf::BindUtil::bind(&BrokerSession::doOpenQueue,
@@ -6633,10 +7170,8 @@ void BrokerSession::openQueueSync(const bsl::shared_ptr<Queue>& queue,
             queue,
             callbackAdapter);  // adapter
 
-        bmqpi::DTSpan::Baggage baggage(d_allocator_p);
-        fillDTSpanQueueBaggage(&baggage, *queue);
         bsl::shared_ptr<bmqpi::DTSpan> openSpan(
-            createDTSpan("bmq.queue.open", baggage));
+            createDTSpan("bmq.queue.open", *queue));
 
         toFsm(fsmCallback,
               bdlf::BindUtil::bind(&BrokerSession::doOpenQueue,
@@ -6670,10 +7205,8 @@ int BrokerSession::configureQueue(const bsl::shared_ptr<Queue>& queue,
                              &rc,
                              bdlf::PlaceHolders::_1);  // request
 
-    bmqpi::DTSpan::Baggage baggage(d_allocator_p);
-    fillDTSpanQueueBaggage(&baggage, *queue);
     bsl::shared_ptr<bmqpi::DTSpan> configureSpan(
-        createDTSpan("bmq.queue.configure", baggage));
+        createDTSpan("bmq.queue.configure", *queue));
 
     toFsm(fsmCallback,
           bdlf::BindUtil::bind(&BrokerSession::doConfigureQueue,
@@ -6723,10 +7256,8 @@ void BrokerSession::configureQueueSync(const bsl::shared_ptr<Queue>& queue,
                 queue,
                 callbackAdapter);  // adapter
 
-        bmqpi::DTSpan::Baggage baggage(d_allocator_p);
-        fillDTSpanQueueBaggage(&baggage, *queue);
         bsl::shared_ptr<bmqpi::DTSpan> configureSpan(
-            createDTSpan("bmq.queue.configure", baggage));
+            createDTSpan("bmq.queue.configure", *queue));
 
         toFsm(fsmCallback,
               bdlf::BindUtil::bind(&BrokerSession::doConfigureQueue,
@@ -6760,10 +7291,8 @@ int BrokerSession::configureQueueAsync(const bsl::shared_ptr<Queue>& queue,
                              queue,
                              eventCallback);
 
-    bmqpi::DTSpan::Baggage baggage(d_allocator_p);
-    fillDTSpanQueueBaggage(&baggage, *queue);
     bsl::shared_ptr<bmqpi::DTSpan> configureSpan(
-        createDTSpan("bmq.queue.configure", baggage));
+        createDTSpan("bmq.queue.configure", *queue));
 
     int rc = toFsm(fsmCallback,
                    bdlf::BindUtil::bind(&BrokerSession::doConfigureQueue,
@@ -6826,10 +7355,8 @@ int BrokerSession::closeQueue(const bsl::shared_ptr<Queue>& queue,
                              &rc,
                              bdlf::PlaceHolders::_1);  // request
 
-    bmqpi::DTSpan::Baggage baggage(d_allocator_p);
-    fillDTSpanQueueBaggage(&baggage, *queue);
     bsl::shared_ptr<bmqpi::DTSpan> closeSpan(
-        createDTSpan("bmq.queue.close", baggage));
+        createDTSpan("bmq.queue.close", *queue));
 
     toFsm(fsmCallback,
           bdlf::BindUtil::bind(&BrokerSession::doCloseQueue,
@@ -6860,10 +7387,8 @@ int BrokerSession::closeQueueAsync(const bsl::shared_ptr<Queue>& queue,
                              queue,
                              eventCallback);
 
-    bmqpi::DTSpan::Baggage baggage(d_allocator_p);
-    fillDTSpanQueueBaggage(&baggage, *queue);
     bsl::shared_ptr<bmqpi::DTSpan> closeSpan(
-        createDTSpan("bmq.queue.close", baggage));
+        createDTSpan("bmq.queue.close", *queue));
 
     int rc = toFsm(fsmCallback,
                    bdlf::BindUtil::bind(&BrokerSession::doCloseQueue,
@@ -6904,10 +7429,8 @@ void BrokerSession::closeQueueSync(const bsl::shared_ptr<Queue>& queue,
                                  queue,
                                  callbackAdapter);  // adapter
 
-        bmqpi::DTSpan::Baggage baggage(d_allocator_p);
-        fillDTSpanQueueBaggage(&baggage, *queue);
         bsl::shared_ptr<bmqpi::DTSpan> closeSpan(
-            createDTSpan("bmq.queue.close", baggage));
+            createDTSpan("bmq.queue.close", *queue));
 
         toFsm(fsmCallback,
               bdlf::BindUtil::bind(&BrokerSession::doCloseQueue,
@@ -7027,8 +7550,34 @@ BrokerSession::createDTSpan(bsl::string_view              operation,
     bsl::shared_ptr<bmqpi::DTSpan> result;
     if (tracer && context) {
         bsl::shared_ptr<bmqpi::DTSpan> parent(context->span());
-        result = tracer->createChildSpan(parent, operation, baggage);
+        if (tracer->isSampled(parent, operation)) {
+            result = tracer->createChildSpan(parent, operation, baggage);
+        }
+    }
+    return result;
+}
+
+bsl::shared_ptr<bmqpi::DTSpan>
+BrokerSession::createDTSpan(bsl::string_view operation,
+                            const Queue&     queue) const
+{
+    const bsl::shared_ptr<bmqpi::DTTracer>& tracer = d_sessionOptions.tracer();
+    const bsl::shared_ptr<bmqpi::DTContext>& context =
+        d_sessionOptions.traceContext();
+    bsl::shared_ptr<bmqpi::DTSpan> result;
+    if (!tracer || !context) {
+        return result;  // RETURN
     }
+
+    bsl::shared_ptr<bmqpi::DTSpan> parent(context->span());
+    if (!tracer->isSampled(parent, operation)) {
+        // Do not even build the baggage of an operation not traced.
+        return result;  // RETURN
+    }
+
+    bmqpi::DTSpan::Baggage baggage(d_allocator_p);
+    fillDTSpanQueueBaggage(&baggage, queue);
+    result = tracer->createChildSpan(parent, operation, baggage);
     return result;
 }
 
@@ -7311,6 +7860,30 @@ void BrokerSession::onPendingPutExpirationTimeout()
     enqueueFsmEvent(event);
 }
 
+void BrokerSession::onFlowControlTimeout()
+{
+    // executed by the *SCHEDULER* thread
+
+    bsl::shared_ptr<Event> event = createEvent();
+    event->configureAsRequestEvent(
+        bdlf::BindUtil::bind(&BrokerSession::doHandleFlowControlTimeout,
+                             this,
+                             bdlf::PlaceHolders::_1));  // eventImpl
+    enqueueFsmEvent(event);
+}
+
+void BrokerSession::onPutBatchTimeout()
+{
+    // executed by the *SCHEDULER* thread
+
+    bsl::shared_ptr<Event> event = createEvent();
+    event->configureAsRequestEvent(
+        bdlf::BindUtil::bind(&BrokerSession::doHandlePutBatchTimeout,
+                             this,
+                             bdlf::PlaceHolders::_1));  // eventImpl
+    enqueueFsmEvent(event);
+}
+
 void BrokerSession::handleChannelWatermark(
     mwcio::ChannelWatermarkType::Enum type)
 {
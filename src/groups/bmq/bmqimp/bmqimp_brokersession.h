@@ -69,12 +69,14 @@
 #include <bdlcc_sharedobjectpool.h>
 #include <bdlcc_singleconsumerqueue.h>
 #include <bdlmt_eventscheduler.h>
+#include <bdlmt_fixedthreadpool.h>
 #include <bsl_deque.h>
 #include <bsl_functional.h>
 #include <bsl_memory.h>
 #include <bsl_unordered_map.h>
 #include <bsl_vector.h>
 #include <bslma_allocator.h>
+#include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bslmt_condition.h>
@@ -358,6 +360,13 @@ class BrokerSession BSLS_CPP11_FINAL {
                                     bdlcc::ObjectPoolFunctors::Clear<Event> >
         EventPool;
 
+    /// Pool of shared pointers to Blobs
+    typedef bdlcc::SharedObjectPool<
+        bdlbb::Blob,
+        bdlcc::ObjectPoolFunctors::DefaultCreator,
+        bdlcc::ObjectPoolFunctors::RemoveAll<bdlbb::Blob> >
+        BlobSpPool;
+
     typedef bdlcc::SingleConsumerQueue<bsl::shared_ptr<Event> > FsmEventQueue;
 
     typedef bsl::unordered_map<int, int> QueueRetransmissionTimeoutMap;
@@ -683,6 +692,19 @@ class BrokerSession BSLS_CPP11_FINAL {
     // Allocator store to spawn new
     // allocators for sub-components
 
+    bslma::ManagedPtr<bdlmt::FixedThreadPool> d_compressionThreadPool_mp;
+    // Thread pool compressing the payloads
+    // of the PUT messages asynchronously,
+    // if configured.  Note that it has to
+    // outlive 'd_eventPool'.
+
+    BlobSpPool d_blobSpPool;
+    // Pool of the blobs holding a copy of
+    // the packets received from the
+    // broker.  Note that it has to
+    // outlive 'd_eventPool', whose events
+    // refer to these blobs.
+
     EventPool d_eventPool;
     // ObjectPool of Event
 
@@ -706,6 +728,13 @@ class BrokerSession BSLS_CPP11_FINAL {
     // they cannot be sent due to the
     // channel HWM condition.
 
+    bdlbb::Blob d_putBatch;
+    // PUT event coalescing the PUT events
+    // posted by the user, pending to be
+    // written to the channel.  Only used
+    // if 'putBatchMaxBytes' is set in the
+    // session options.
+
     bsls::AtomicBool d_acceptRequests;
     // False if a session is not
     // started yet or a disconnect
@@ -843,6 +872,15 @@ class BrokerSession BSLS_CPP11_FINAL {
     // Timer Event handle for pending PUT
     // messages' expiration timeout
 
+    bdlmt::EventScheduler::EventHandle d_putBatchTimeoutHandle;
+    // Timer Event handle for the linger
+    // timeout of 'd_putBatch'
+
+    bdlmt::EventScheduler::RecurringEventHandle d_flowControlTimerHandle;
+    // Timer Event handle for the periodic
+    // adaptation of the unconfirmed
+    // windows of the reader queues
+
     int d_nextRequestGroupId;
     // Id of the next request group to
     // use
@@ -894,6 +932,12 @@ class BrokerSession BSLS_CPP11_FINAL {
         const bsl::shared_ptr<Event>&           event,
         const EventQueue::EventHandlerCallback& eventHandlerCb);
 
+    /// Re-enqueue a `DISCONNECTED` session event if the specified `event`,
+    /// just popped out from the event queue by the user, is one.
+    ///
+    /// THREAD: This method is called from one of the APPLICATION threads.
+    void reenqueueIfDisconnected(const bsl::shared_ptr<Event>& event);
+
     /// Callback used as a wrapper for async operations and new-style
     /// operations in event handler mode.  Read result from the specified
     /// `context`.  Create and enqueue user event with the specified
@@ -925,9 +969,12 @@ class BrokerSession BSLS_CPP11_FINAL {
                               const EventCallback&          eventCallback);
 
     /// Process the raw BlazingMQ event represented by the specified
-    /// `event`.  This method gets called each time a new event (received
-    /// from the broker) is taken from the FSM event queue.
-    void processRawEvent(const bmqp::Event& event);
+    /// `event`, received at the specified `receivedTime` (high resolution
+    /// timer value, or 0 if unknown).  This method gets called each time a
+    /// new event (received from the broker) is taken from the FSM event
+    /// queue.
+    void processRawEvent(const bmqp::Event& event,
+                         bsls::Types::Int64 receivedTime);
 
     /// Process the control event represented by the specified `event`.
     /// This method gets called each time a new control event (received from
@@ -945,15 +992,42 @@ class BrokerSession BSLS_CPP11_FINAL {
     /// method gets called each time a new put event is poseted by the user.
     void processPutEvent(const bmqp::Event& event);
 
+    /// Write the specified PUT `eventBlob` into the channel, in the compact
+    /// encoding if the broker supports it.  Return the result of
+    /// `writeOrBuffer`.
+    bmqt::GenericResult::Enum writePutEvent(const bdlbb::Blob& eventBlob);
+
+    /// Append the messages of the specified PUT `eventBlob` to the pending
+    /// PUT batch, writing the batch into the channel if it reached the
+    /// `putBatchMaxBytes` session option, and scheduling the linger timer
+    /// otherwise.  Return true if `eventBlob` was added to the batch, and
+    /// false if it can't be batched (e.g., because it is too large), in
+    /// which case the caller must write it.
+    bool batchPutEvent(const bdlbb::Blob& eventBlob);
+
+    /// Write the pending PUT batch, if any, into the channel and cancel the
+    /// linger timer.  If the batch can not be written, enable the
+    /// retransmission of its messages not having the `ACK_REQUESTED` flag
+    /// (the ones having it always are), so that they are sent once the
+    /// session is reconnected.
+    void flushPutBatch();
+
     /// Process the confirm event represented by the specified `event`.
     /// This method gets called each time a new confirm event is poseted by
     /// the user.
     void processConfirmEvent(const bmqp::Event& event);
 
-    /// Process the push event represented by the specified `event`.  This
-    /// method gets called each time a new push event (received from the
-    /// broker) is available on the channel.
-    void processPushEvent(const bmqp::Event& event);
+    /// Record, in the flow control monitor of the queue having the
+    /// specified `queueId` and `subQueueId`, the confirmation of the
+    /// specified `numMessages` messages.
+    void recordConfirms(int queueId, int subQueueId, int numMessages);
+
+    /// Process the push event represented by the specified `event`,
+    /// received at the specified `receivedTime` (high resolution timer
+    /// value, or 0 if unknown).  This method gets called each time a new
+    /// push event (received from the broker) is available on the channel.
+    void processPushEvent(const bmqp::Event& event,
+                          bsls::Types::Int64 receivedTime);
 
     /// Process the ack event represented by the specified `event`.  This
     /// method gets called each time a new ack event (received from the
@@ -1321,6 +1395,18 @@ class BrokerSession BSLS_CPP11_FINAL {
     void
     doHandlePendingPutExpirationTimeout(const bsl::shared_ptr<Event>& eventSp);
 
+    /// Invoked from the FSM thread as a handler to the PUT batch linger
+    /// timeout event specified as `eventSp` and sent by the scheduler
+    /// thread.  This method writes the pending PUT batch, if any.
+    void doHandlePutBatchTimeout(const bsl::shared_ptr<Event>& eventSp);
+
+    /// Invoked from the FSM thread as a handler to the flow control
+    /// adaptation timer event specified as `eventSp` and sent by the
+    /// scheduler thread.  This method adapts the unconfirmed windows of the
+    /// opened reader queues to their observed consumption, and reconfigures
+    /// the ones whose window changed.
+    void doHandleFlowControlTimeout(const bsl::shared_ptr<Event>& eventSp);
+
     /// Invoked from the FSM thread as a handler to the channel watermark
     /// event specified as `eventSp` with the specified watermark `type`
     /// sent by the IO thread.
@@ -1442,15 +1528,22 @@ class BrokerSession BSLS_CPP11_FINAL {
     bslma::ManagedPtr<void>
     activateDTSpan(const bsl::shared_ptr<bmqpi::DTSpan>& span);
 
-    /// If Distributed Trace is configured by the session options, create a
-    /// new span, as a child of the one currently active.  Otherwise, return
-    /// an empty `shared_ptr`.  The specified `operation` and the specified
-    /// `baggage` are used for creation.
+    /// If Distributed Trace is configured by the session options, and the
+    /// tracer samples the specified `operation`, create a new span, as a
+    /// child of the one currently active.  Otherwise, return an empty
+    /// `shared_ptr`.  The specified `operation` and the specified `baggage`
+    /// are used for creation.
     bsl::shared_ptr<bmqpi::DTSpan>
     createDTSpan(bsl::string_view              operation,
                  const bmqpi::DTSpan::Baggage& baggage =
                      bmqpi::DTSpan::Baggage()) const;
 
+    /// Create a span for the specified `operation` on the specified `queue`
+    /// as above, having the baggage describing `queue`.  Note that the
+    /// baggage is only built if the span is created.
+    bsl::shared_ptr<bmqpi::DTSpan> createDTSpan(bsl::string_view operation,
+                                                const Queue&     queue) const;
+
     /// True if the session is started.
     bool isStarted() const;
 
@@ -1524,6 +1617,13 @@ class BrokerSession BSLS_CPP11_FINAL {
     bsl::shared_ptr<bmqimp::Event>
     nextEvent(const bsls::TimeInterval& timeout);
 
+    /// Load into the specified `event` the next event and return 0 if the
+    /// event queue is not empty, or return a non-zero value without
+    /// blocking and leave `event` unchanged if it is empty.
+    ///
+    /// THREAD: This method is called from one of the APPLICATION threads.
+    int tryNextEvent(bsl::shared_ptr<bmqimp::Event>* event);
+
     int openQueue(const bsl::shared_ptr<Queue>& queue,
                   bsls::TimeInterval            timeout);
 
@@ -1596,6 +1696,12 @@ class BrokerSession BSLS_CPP11_FINAL {
     /// Invoked when pending PUT expiration timeout fires.
     void onPendingPutExpirationTimeout();
 
+    /// Invoked when the linger timeout of the pending PUT batch fires.
+    void onPutBatchTimeout();
+
+    /// Invoked when the flow control adaptation timer fires.
+    void onFlowControlTimeout();
+
     /// Process the specified dump `command`.
     void processDumpCommand(const bmqp_ctrlmsg::DumpMessages& command);
 
@@ -1614,6 +1720,11 @@ class BrokerSession BSLS_CPP11_FINAL {
     /// Return the state of the broker session.
     State::Enum state() const;
 
+    /// Return the thread pool compressing the payloads of the PUT messages
+    /// built by this session, or 0 if they are compressed synchronously
+    /// (see `bmqt::SessionOptions::numCompressionThreads`).
+    bdlmt::FixedThreadPool* compressionThreadPool() const;
+
     /// Lookup the queue with the specified `queueId`, or `uri`, or
     /// `correlationId`, and return a shared pointer to the Queue object (if
     /// found), or an empty shared pointer (if not found).
@@ -1720,6 +1831,11 @@ inline BrokerSession::State::Enum BrokerSession::state() const
     return d_sessionFsm.state();
 }
 
+inline bdlmt::FixedThreadPool* BrokerSession::compressionThreadPool() const
+{
+    return d_compressionThreadPool_mp.get();
+}
+
 inline bsl::vector<BrokerSession::StateTransition>
 BrokerSession::getSessionFsmTransitionTable() const
 {
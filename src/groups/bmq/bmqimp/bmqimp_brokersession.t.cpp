@@ -19,6 +19,7 @@
 // BMQ
 #include <bmqimp_event.h>
 #include <bmqimp_manualhosthealthmonitor.h>
+#include <bmqimp_negotiatedchannelfactory.h>
 #include <bmqimp_queue.h>
 #include <bmqp_ackeventbuilder.h>
 #include <bmqp_confirmeventbuilder.h>
@@ -2750,19 +2751,31 @@ class DTTestSpan : public bmqpi::DTSpan {
 
 class DTTestTracer : public bmqpi::DTTracer {
     bdlcc::Deque<bsl::string>* d_eventsQueue_p;
+    bool                       d_headSampling;
     bslma::Allocator*          d_allocator_p;
 
   public:
+    /// Create a tracer reporting span events to the specified
+    /// `eventsQueue_p`.  If the optionally specified `headSampling` is
+    /// `true`, only the spans having a parent are sampled.
     DTTestTracer(bdlcc::Deque<bsl::string>* eventsQueue_p,
-                 bslma::Allocator*          allocator_p)
+                 bslma::Allocator*          allocator_p,
+                 bool                       headSampling = false)
     : DTTracer()
     , d_eventsQueue_p(eventsQueue_p)
+    , d_headSampling(headSampling)
     , d_allocator_p(bslma::Default::allocator(allocator_p))
     {
         // PRECONDITIONS
         BSLS_ASSERT_SAFE(d_eventsQueue_p);
     }
 
+    bool isSampled(const bsl::shared_ptr<bmqpi::DTSpan>& parent,
+                   const bsl::string_view&) const BSLS_KEYWORD_OVERRIDE
+    {
+        return !d_headSampling || parent;
+    }
+
     bsl::shared_ptr<bmqpi::DTSpan> createChildSpan(
         const bsl::shared_ptr<bmqpi::DTSpan>& parent,
         const bsl::string_view&               operation,
@@ -10223,6 +10236,346 @@ static void test70_queueLateAsyncCanceledHybrid5()
                            bmqimp::QueueState::e_CLOSED);
 }
 
+static void test71_putBatching()
+// ------------------------------------------------------------------------
+// PUT BATCHING
+//
+// Concerns:
+//   1. If 'putBatchMaxBytes' is set, PUT events posted by the user are
+//      coalesced and written as a single PUT event once the linger time
+//      elapsed.
+//   2. A pending batch is written before any other event, once the batch
+//      exceeds 'putBatchMaxBytes'.
+//
+// Plan:
+//   1. Create bmqimp::BrokerSession test wrapper object with PUT batching
+//      enabled and start the session.
+//   2. Open a queue.
+//   3. Post several PUT events and verify that a single PUT event with all
+//      the messages is written after the linger time.
+//   4. Post PUT events exceeding 'putBatchMaxBytes' and verify batches are
+//      written without waiting for the linger time.
+//   5. Stop the session.
+//
+// Testing manipulators:
+//   - post
+//-------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("PUT BATCHING TEST");
+
+    const bsls::TimeInterval timeout = bsls::TimeInterval(15);
+    const int                k_NUM_EVENTS     = 3;
+    const int                k_PAYLOAD_LEN    = 1000;
+    const int                k_MAX_BATCH_SIZE = 2 * k_PAYLOAD_LEN + 512;
+    bmqt::SessionOptions     sessionOptions;
+    bmqt::QueueOptions       queueOptions;
+    bdlmt::EventScheduler    scheduler(bsls::SystemClockType::e_MONOTONIC,
+                                    s_allocator_p);
+
+    sessionOptions.setNumProcessingThreads(1)
+        .setPutBatchMaxBytes(k_MAX_BATCH_SIZE)
+        .setPutBatchLinger(bsls::TimeInterval(0.1));
+
+    // Create test session with the system time source
+    TestSession obj(sessionOptions, scheduler, s_allocator_p);
+
+    bsl::shared_ptr<bmqimp::Queue> pQueue =
+        obj.createQueue(k_URI, bmqt::QueueFlags::e_WRITE, queueOptions);
+
+    PVV_SAFE("Step 1. Starting session...");
+    obj.startAndConnect();
+
+    PVV_SAFE("Step 2. Open the queue");
+    obj.openQueue(pQueue, timeout);
+
+    PVV_SAFE("Step 3. Post small PUT events");
+    bmqp::Crc32c::initialize();
+    bmqp::PutEventBuilder builder(&obj.blobBufferFactory(), obj.allocator());
+    bsl::string           payload(k_PAYLOAD_LEN / 10, 'a', s_allocator_p);
+
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        builder.reset();
+        builder.startMessage();
+        builder.setMessagePayload(payload.data(), payload.length())
+            .setMessageGUID(bmqp::MessageGUIDGenerator::testGUID());
+        ASSERT_EQ(bmqt::EventBuilderResult::e_SUCCESS,
+                  builder.packMessage(pQueue->id()));
+
+        ASSERT_EQ(obj.session().post(builder.blob(), timeout),
+                  bmqt::PostResult::e_SUCCESS);
+    }
+
+    // The events are held until the linger time elapsed
+    bmqp::Event rawEvent(s_allocator_p);
+    obj.getOutboundEvent(&rawEvent);
+    ASSERT(rawEvent.isPutEvent());
+
+    bmqp::PutMessageIterator putIter(&obj.blobBufferFactory(),
+                                     s_allocator_p);
+    rawEvent.loadPutMessageIterator(&putIter);
+    ASSERT(putIter.isValid());
+
+    int numMessages = 0;
+    while (putIter.next() == 1) {
+        ++numMessages;
+    }
+    ASSERT_EQ(numMessages, k_NUM_EVENTS);
+    ASSERT(obj.channel().writeCalls().empty());
+
+    PVV_SAFE("Step 4. Post PUT events exceeding the batch size");
+    payload.assign(k_PAYLOAD_LEN, 'b');
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        builder.reset();
+        builder.startMessage();
+        builder.setMessagePayload(payload.data(), payload.length())
+            .setMessageGUID(bmqp::MessageGUIDGenerator::testGUID());
+        ASSERT_EQ(bmqt::EventBuilderResult::e_SUCCESS,
+                  builder.packMessage(pQueue->id()));
+
+        ASSERT_EQ(obj.session().post(builder.blob(), timeout),
+                  bmqt::PostResult::e_SUCCESS);
+    }
+
+    // The first two events fill a batch, which is written when the third
+    // one is posted.  The third one is written after the linger time.
+    for (int expected = 2; expected > 0; --expected) {
+        rawEvent.clear();
+        obj.getOutboundEvent(&rawEvent);
+        ASSERT(rawEvent.isPutEvent());
+
+        rawEvent.loadPutMessageIterator(&putIter);
+        ASSERT(putIter.isValid());
+
+        numMessages = 0;
+        while (putIter.next() == 1) {
+            ++numMessages;
+        }
+        ASSERT_EQ(numMessages, expected);
+    }
+
+    PV_SAFE("Step 5. Stop the session");
+    obj.stopGracefully();
+}
+
+static void test72_distributedTraceSampling()
+// ------------------------------------------------------------------------
+// DISTRIBUTED TRACE SAMPLING
+//
+// Concerns:
+//   1. No span is created for the operations the tracer does not sample.
+//   2. The children of a sampled span are sampled, and the spans created
+//      by the session are nested as when all operations are sampled.
+//
+// Plan:
+//   1. Configure the session with a tracer sampling only the operations
+//      having a parent span, and start the session: verify that no span
+//      is created.
+//   2. Open a queue outside of any span: verify that no span is created.
+//   3. Close the queue within a span created by the application: verify
+//      that the 'bmq.queue.close' and 'bmq.queue.closeConfigure' spans
+//      are created.
+//   4. Stop the session: verify that no span is created.
+//
+// Testing manipulators:
+//   - start
+//   - openQueue
+//   - closeQueue
+//   - stop
+//   ----------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("DISTRIBUTED TRACE SAMPLING TEST");
+
+    bdlcc::Deque<bsl::string> dtEventsQueue(s_allocator_p);
+
+    bsl::shared_ptr<bmqpi::DTContext> dtContext(
+        new (*s_allocator_p) DTTestContext(s_allocator_p),
+        s_allocator_p);
+    bsl::shared_ptr<bmqpi::DTTracer> dtTracer(
+        new (*s_allocator_p)
+            DTTestTracer(&dtEventsQueue, s_allocator_p, true),
+        s_allocator_p);
+
+    const bsls::TimeInterval timeout = bsls::TimeInterval(15);
+    bmqt::SessionOptions     sessionOptions;
+    bmqt::QueueOptions       queueOptions;
+    bdlmt::EventScheduler    scheduler(bsls::SystemClockType::e_MONOTONIC,
+                                    s_allocator_p);
+    TestClock                testClock(scheduler);
+
+    sessionOptions.setNumProcessingThreads(1).setTraceOptions(dtContext,
+                                                              dtTracer);
+
+    TestSession obj(sessionOptions, testClock, s_allocator_p);
+
+    bsl::shared_ptr<bmqimp::Queue> pQueue =
+        obj.createQueue(k_URI, bmqt::QueueFlags::e_READ, queueOptions);
+
+    PVV_SAFE("Step 1. Starting session...");
+    obj.startAndConnect();
+    ASSERT_EQ(dtEventsQueue.length(), 0u);
+
+    PVV_SAFE("Step 2. Open a queue outside of any span");
+    obj.openQueue(pQueue, timeout);
+    ASSERT_EQ(dtEventsQueue.length(), 0u);
+
+    PVV_SAFE("Step 3. Close the queue within a span");
+    {
+        bmqpi::DTSpan::Baggage         baggage(s_allocator_p);
+        bsl::shared_ptr<bmqpi::DTSpan> span(
+            new (*s_allocator_p)
+                DTTestSpan("test72", baggage, &dtEventsQueue, s_allocator_p),
+            s_allocator_p);
+        bslma::ManagedPtr<void> scopeGuard(dtContext->scope(span));
+
+        obj.closeQueue(pQueue, timeout, true);
+    }
+
+    // START and END of the application span, 'bmq.queue.close' and
+    // 'bmq.queue.closeConfigure'.
+    bsl::vector<bsl::string> dtEvents(6, s_allocator_p);
+    for (size_t i = 0; i < dtEvents.size(); ++i) {
+        ASSERT_EQ_D(i,
+                    dtEventsQueue.timedPopFront(&dtEvents[i],
+                                                bdlt::CurrentTime::now() +
+                                                    bsls::TimeInterval(0.1)),
+                    0);
+    }
+    ASSERT_EQ(dtEvents[0], "START test72");
+    ASSERT_EQ(dtEvents[1],
+              "START bmq.queue.close < test72; "
+              "bmq.queue.uri=bmq://ts.trades.myapp/my.queue?id=my.app");
+    ASSERT_EQ(dtEventsQueue.length(), 0u);
+
+    PVV_SAFE("Step 4. Stop the session");
+    obj.stopGracefully();
+    ASSERT_EQ(dtEventsQueue.length(), 0u);
+}
+
+static void test73_pipelinedReopen()
+// ------------------------------------------------------------------------
+// PIPELINED REOPEN
+//
+// Concerns:
+//   1. If the broker advertises that it holds the configure of a queue
+//      until the queue is opened, the configure request of a reopen is
+//      sent along with the open request, without waiting for the open
+//      response.
+//   2. The reopen completes once both responses are received.
+//   3. If the channel goes down while both requests are pending, the
+//      response of the pipelined configure request is ignored and the
+//      queue is reopened once the channel is restored.
+//
+// Plan:
+//   1. Create bmqimp::BrokerSession test wrapper object, start the
+//      session and open a reader queue.
+//   2. Set the channel property advertising pipelined configure requests,
+//      drop the channel and restore it: verify that the open and
+//      configure requests are both sent before any response.
+//   3. Send the open response: verify that no other request is sent and
+//      that the queue waits for the configure response.
+//   4. Send the configure response: verify the reopen succeeds.
+//   5. Drop the channel and restore it, then drop it again while the
+//      pipelined requests are pending: verify that the queue is reopened
+//      once the channel is restored.
+//   6. Stop the session.
+//
+// Testing manipulators:
+//   - setChannel
+//   ----------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("PIPELINED REOPEN TEST");
+
+    const bsls::TimeInterval timeout = bsls::TimeInterval(15);
+    bmqt::SessionOptions     sessionOptions;
+    bmqt::QueueOptions       queueOptions;
+    bdlmt::EventScheduler    scheduler(bsls::SystemClockType::e_MONOTONIC,
+                                    s_allocator_p);
+
+    sessionOptions.setNumProcessingThreads(1);
+
+    TestSession obj(sessionOptions, scheduler, s_allocator_p);
+
+    bsl::shared_ptr<bmqimp::Queue> pQueue =
+        obj.createQueue(k_URI, bmqt::QueueFlags::e_READ, queueOptions);
+
+    PVV_SAFE("Step 1. Start the session and open the queue");
+    obj.startAndConnect();
+    obj.openQueue(pQueue, timeout);
+
+    PVV_SAFE("Step 2. Drop and restore the channel");
+    obj.channel().properties().set(
+        bmqimp::NegotiatedChannelFactory::
+            k_CHANNEL_PROPERTY_PIPELINED_CONFIGURE,
+        1);
+
+    obj.session().setChannel(bsl::shared_ptr<mwcio::Channel>());
+    ASSERT(obj.waitConnectionLostEvent());
+    ASSERT(obj.waitForQueueState(pQueue, bmqimp::QueueState::e_PENDING));
+
+    obj.setChannel();
+    ASSERT(obj.waitReconnectedEvent());
+
+    bmqp_ctrlmsg::ControlMessage openRequest = obj.getNextOutboundRequest(
+        TestSession::e_REQ_OPEN_QUEUE);
+    bmqp_ctrlmsg::ControlMessage configureRequest =
+        obj.getNextOutboundRequest(TestSession::e_REQ_CONFIG_QUEUE);
+
+    ASSERT_EQ(pQueue->state(), bmqimp::QueueState::e_REOPENING_OPN);
+    ASSERT(pQueue->isConfigurePipelined());
+
+    PVV_SAFE("Step 3. Send the open response");
+    obj.sendResponse(openRequest);
+
+    ASSERT(obj.waitForQueueState(pQueue, bmqimp::QueueState::e_REOPENING_CFG));
+    ASSERT(!pQueue->isConfigurePipelined());
+    ASSERT(obj.channel().writeCalls().empty());
+
+    PVV_SAFE("Step 4. Send the configure response");
+    obj.sendResponse(configureRequest);
+
+    ASSERT(obj.verifyOperationResult(
+        bmqt::SessionEventType::e_QUEUE_REOPEN_RESULT,
+        bmqp_ctrlmsg::StatusCategory::E_SUCCESS));
+    ASSERT(obj.waitStateRestoredEvent());
+    ASSERT_EQ(pQueue->state(), bmqimp::QueueState::e_OPENED);
+    ASSERT(pQueue->isValid());
+
+    PVV_SAFE("Step 5. Drop the channel while the requests are pending");
+    obj.session().setChannel(bsl::shared_ptr<mwcio::Channel>());
+    ASSERT(obj.waitConnectionLostEvent());
+    ASSERT(obj.waitForQueueState(pQueue, bmqimp::QueueState::e_PENDING));
+
+    obj.setChannel();
+    ASSERT(obj.waitReconnectedEvent());
+
+    obj.verifyRequestSent(TestSession::e_REQ_OPEN_QUEUE);
+    obj.verifyRequestSent(TestSession::e_REQ_CONFIG_QUEUE);
+
+    obj.session().setChannel(bsl::shared_ptr<mwcio::Channel>());
+    ASSERT(obj.waitConnectionLostEvent());
+    ASSERT(obj.waitForQueueState(pQueue, bmqimp::QueueState::e_PENDING));
+
+    obj.setChannel();
+    ASSERT(obj.waitReconnectedEvent());
+
+    openRequest = obj.getNextOutboundRequest(TestSession::e_REQ_OPEN_QUEUE);
+    configureRequest = obj.getNextOutboundRequest(
+        TestSession::e_REQ_CONFIG_QUEUE);
+
+    obj.sendResponse(openRequest);
+    obj.sendResponse(configureRequest);
+
+    ASSERT(obj.verifyOperationResult(
+        bmqt::SessionEventType::e_QUEUE_REOPEN_RESULT,
+        bmqp_ctrlmsg::StatusCategory::E_SUCCESS));
+    ASSERT(obj.waitStateRestoredEvent());
+    ASSERT_EQ(pQueue->state(), bmqimp::QueueState::e_OPENED);
+    ASSERT(pQueue->isValid());
+
+    PVV_SAFE("Step 6. Stop the session");
+    obj.stopGracefully();
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -10238,6 +10591,9 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 73: test73_pipelinedReopen(); break;
+    case 72: test72_distributedTraceSampling(); break;
+    case 71: test71_putBatching(); break;
     case 70: test70_queueLateAsyncCanceledHybrid5(); break;
     case 69: test69_queueLateAsyncCanceledHybrid4(); break;
     case 68: test68_queueLateAsyncCanceledHybrid3(); break;
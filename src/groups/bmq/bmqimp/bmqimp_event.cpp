@@ -58,7 +58,7 @@ Event::Event(bdlbb::BlobBufferFactory* blobBufferFactory,
 , d_putEventBuilderBuffer()
 , d_isPutEventBuilderConstructed(false)
 , d_correlationIds(allocator)
-
+, d_receivedTime(0)
 {
     // NOTHING
 }
@@ -84,7 +84,7 @@ Event::Event(const Event& other, bslma::Allocator* allocator)
 , d_putEventBuilderBuffer()
 , d_isPutEventBuilderConstructed(false)
 , d_correlationIds(other.d_correlationIds, allocator)
-
+, d_receivedTime(other.d_receivedTime)
 {
     // PRECONDITIONS
     BSLS_ASSERT_OPT(EventType::e_MESSAGE != other.d_type ||
@@ -157,6 +157,7 @@ Event& Event::operator=(const Event& rhs)
     d_errorDescription                = rhs.d_errorDescription;
     d_msgEventMode                    = rhs.d_msgEventMode;
     d_correlationIds                  = rhs.d_correlationIds;
+    d_receivedTime                    = rhs.d_receivedTime;
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_type ==
                                               EventType::e_SESSION)) {
@@ -225,6 +226,7 @@ void Event::reset()
     d_ackMsgIter.clear();
     d_putMsgIter.clear();
     d_correlationIds.clear();
+    d_receivedTime = 0;
 }
 
 void Event::clear()
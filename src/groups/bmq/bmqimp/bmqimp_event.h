@@ -97,6 +97,7 @@
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bsls_assert.h>
 #include <bsls_objectbuffer.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 
@@ -258,6 +259,11 @@ class Event {
     // For PUSH messages optional corresponding
     // subscription Ids may be provided.
 
+    bsls::Types::Int64 d_receivedTime;
+    // High resolution timer value of when the
+    // raw event of this message event was
+    // received, or 0 if unknown.
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(Event, bslma::UsesBslmaAllocator)
@@ -402,6 +408,11 @@ class Event {
     /// to use because it is populated once.
     const QueuesMap& queues() const;
 
+    /// Return a reference not offering modifiable access to the map of
+    /// queues associated with this event by subscription.  The returned map
+    /// is thread-safe to use because it is populated once.
+    const QueuesBySubscriptionId& queuesBySubscriptionId() const;
+
     // - - - - - - - - - - - - - - - -
     // SessionEvent specific operations
     // ACCESSORS
@@ -473,6 +484,10 @@ class Event {
     /// underlying raw event is of type PUSH.
     const unsigned int subscriptionId(int position) const;
 
+    /// Return the high resolution timer value of when the raw event of this
+    /// message event was received, or 0 if it was not set.
+    bsls::Types::Int64 receivedTime() const;
+
     // MANIPULATORS
 
     /// Behavior is undefined unless event's `type()` is MESSAGEVENT,
@@ -494,6 +509,11 @@ class Event {
     /// `messageEventType()` is WRITE.
     bmqp::PutEventBuilder* putEventBuilder();
 
+    /// Set the high resolution timer value of when the raw event of this
+    /// message event was received to the specified `value` and return a
+    /// reference offering modifiable access to this object.
+    Event& setReceivedTime(bsls::Types::Int64 value);
+
     /// Add the specified 'correlationId' and the optionally specified
     /// 'subscriptionId' to the list of correlationId-subscriptionId pairs
     /// maintained by this instance.  The behavior is undefined unless
@@ -643,6 +663,12 @@ inline const Event::QueuesMap& Event::queues() const
     return d_queues;
 }
 
+inline const Event::QueuesBySubscriptionId&
+Event::queuesBySubscriptionId() const
+{
+    return d_queuesBySubscriptionId;
+}
+
 inline bmqt::SessionEventType::Enum Event::sessionEventType() const
 {
     // PRECONDITIONS
@@ -758,6 +784,11 @@ inline const unsigned int Event::subscriptionId(int position) const
     return d_correlationIds[position].second;
 }
 
+inline bsls::Types::Int64 Event::receivedTime() const
+{
+    return d_receivedTime;
+}
+
 inline bmqp::PushMessageIterator* Event::pushMessageIterator()
 {
     // PRECONDITIONS
@@ -788,6 +819,12 @@ inline bmqp::PutMessageIterator* Event::putMessageIterator()
     return &d_putMsgIter;
 }
 
+inline Event& Event::setReceivedTime(bsls::Types::Int64 value)
+{
+    d_receivedTime = value;
+    return *this;
+}
+
 inline bmqp::PutEventBuilder* Event::putEventBuilder()
 {
     // PRECONDITIONS
@@ -18,6 +18,8 @@
 
 #include <bmqscm_version.h>
 // BMQ
+#include <bmqimp_eventsstats.h>
+#include <bmqimp_queue.h>
 #include <bmqt_correlationid.h>
 
 // MWC
@@ -36,9 +38,11 @@
 #include <bdlf_memfn.h>
 #include <bdlf_placeholder.h>
 #include <bdlma_localsequentialallocator.h>
+#include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_string.h>
 #include <bslma_allocator.h>
+#include <bslmt_lockguard.h>
 #include <bslmt_threadutil.h>
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
@@ -60,6 +64,36 @@ enum {
     k_STAT_TIME = 1  // Event queued time
 };
 
+/// Capacity of the bounded lock-free queue, as a multiple of its high
+/// watermark: the queue must hold the events pushed after reaching the high
+/// watermark, which are not dropped.
+const int k_LOCK_FREE_CAPACITY_FACTOR = 2;
+
+/// Report to the latencies of each queue in the specified `queues` map the
+/// specified `queuedTime` and, if the specified `pushToCallbackTime` is not
+/// negative, the time from PUSH to user callback.
+template <class QUEUES_MAP>
+void reportLatencies(const QUEUES_MAP&  queues,
+                     bsls::Types::Int64 queuedTime,
+                     bsls::Types::Int64 pushToCallbackTime)
+{
+    for (typename QUEUES_MAP::const_iterator cit = queues.begin();
+         cit != queues.end();
+         ++cit) {
+        EventsStatsQueueLatencies* latencies = cit->second->latencies();
+        if (!latencies) {
+            continue;  // CONTINUE
+        }
+
+        latencies->onLatency(EventsStatsLatencyType::e_QUEUE_TIME,
+                             queuedTime);
+        if (pushToCallbackTime >= 0) {
+            latencies->onLatency(EventsStatsLatencyType::e_PUSH_TO_CALLBACK,
+                                 pushToCallbackTime);
+        }
+    }
+}
+
 }  // close unnamed namespace
 
 // ----------------------------
@@ -89,6 +123,65 @@ bsl::shared_ptr<Event> EventQueue::getEvent()
     return d_eventPool_p->getObject();
 }
 
+int EventQueue::tryPushBack(const QueueItem& item)
+{
+    if (d_fixedQueue_mp) {
+        // The lock-free queue supports concurrent producers
+        return d_fixedQueue_mp->tryPushBack(item);  // RETURN
+    }
+
+    bsls::SpinLockGuard guard(&d_pushBackSpinlock);  // LOCK
+    return d_queue_mp->tryPushBack(item);
+}
+
+void EventQueue::pushBackNoDrop(const QueueItem& item)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_fixedQueue_mp);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_overflowMutex);  // LOCK
+
+    if (d_overflow.empty() && d_fixedQueue_mp->tryPushBack(item) == 0) {
+        return;  // RETURN
+    }
+
+    BALL_LOG_WARN << "EventQueue is full, keeping event in the overflow list "
+                  << "[overflowSize: " << d_overflow.size() + 1 << "]";
+
+    d_overflow.push_back(item);
+    ++d_overflowSize;
+
+    // A processing thread may have made room before the item was added to
+    // the overflow list, without seeing it: attempt to move it now.
+    drainOverflow();
+}
+
+void EventQueue::drainOverflow()
+{
+    while (!d_overflow.empty() &&
+           d_fixedQueue_mp->tryPushBack(d_overflow.front()) == 0) {
+        d_overflow.pop_front();
+        --d_overflowSize;
+    }
+}
+
+int EventQueue::tryPopFrontItem(QueueItem* item)
+{
+    return d_fixedQueue_mp ? d_fixedQueue_mp->tryPopFront(item)
+                           : d_queue_mp->tryPopFront(item);
+}
+
+int EventQueue::spinPopFrontItem(QueueItem* item)
+{
+    for (int i = 0; i < d_spinCount; ++i) {
+        if (tryPopFrontItem(item) == 0) {
+            return 0;  // RETURN
+        }
+    }
+
+    return -1;
+}
+
 void EventQueue::stateCallback(mwcc::MonitoredQueueState::Enum state)
 {
     // Because of MessageEvent that should be dropped while SessionEvent should
@@ -96,7 +189,8 @@ void EventQueue::stateCallback(mwcc::MonitoredQueueState::Enum state)
     // meanings:
     //: o lowWatermark:  the queue is back to its low watermark
     //: o highWatermark: the queue has reached the user provided high watermark
-    //: o queueFilled:   should never happen with a resizable queue
+    //: o queueFilled:   should never happen with a resizable queue, and
+    //:                  means events are dropped with a bounded queue
 
     switch (state) {
     case mwcc::MonitoredQueueState::e_NORMAL: {
@@ -104,7 +198,7 @@ void EventQueue::stateCallback(mwcc::MonitoredQueueState::Enum state)
         {
             BALL_LOG_OUTPUT_STREAM << "EventQueue has reached its "
                                    << "low-watermark of "
-                                   << d_queue.lowWatermark() << ", ";
+                                   << queueLowWatermark() << ", ";
             printLastEventTime(BALL_LOG_OUTPUT_STREAM);
         }
 
@@ -124,7 +218,7 @@ void EventQueue::stateCallback(mwcc::MonitoredQueueState::Enum state)
         os << "BMQALARM [EVENTQUEUE::HIGH_WATERMARK]: BlazingMQ EventQueue "
            << "(buffer between the events delivered by the broker and the "
            << "application processing them in the event handler) has reached "
-           << "its high-watermark of " << d_queue.highWatermark() << ", ";
+           << "its high-watermark of " << queueHighWatermark() << ", ";
         printLastEventTime(os);
         bsl::cerr << os.str() << '\n' << bsl::flush;
         // Also print warning in users log
@@ -137,10 +231,24 @@ void EventQueue::stateCallback(mwcc::MonitoredQueueState::Enum state)
                          "Impossible - highWatermark2 is not reachable");
     } break;
     case mwcc::MonitoredQueueState::e_QUEUE_FILLED: {
-        BALL_LOG_ERROR
-            << "EventQueue has reached an un-expected queue filled state";
-        // This should NEVER happen while using 'bdlcc::SingleProducerQueue'.
-        BSLS_ASSERT_SAFE(false && "Impossible - Queue has reached capacity");
+        if (d_fixedQueue_mp) {
+            BALL_LOG_ERROR_BLOCK
+            {
+                BALL_LOG_OUTPUT_STREAM
+                    << "BlazingMQ EventQueue has reached its capacity of "
+                    << d_fixedQueue_mp->capacity()
+                    << ", message events will be dropped, ";
+                printLastEventTime(BALL_LOG_OUTPUT_STREAM);
+            }
+        }
+        else {
+            BALL_LOG_ERROR
+                << "EventQueue has reached an un-expected queue filled state";
+            // This should NEVER happen while using
+            // 'bdlcc::SingleProducerQueue'.
+            BSLS_ASSERT_SAFE(false &&
+                             "Impossible - Queue has reached capacity");
+        }
     } break;
     default: {
         BALL_LOG_ERROR_BLOCK
@@ -153,7 +261,7 @@ void EventQueue::stateCallback(mwcc::MonitoredQueueState::Enum state)
                 << state
                 << "), "
                    " it contains "
-                << d_queue.numElements() << ".";
+                << queueNumElements() << ".";
             printLastEventTime(BALL_LOG_OUTPUT_STREAM);
         }
     } break;
@@ -191,6 +299,13 @@ void EventQueue::afterEventPopped(const QueueItem& item)
     const bsls::Types::Int64 popOutTime = mwcsys::Time::highResolutionTimer();
     const bsls::Types::Int64 queuedTime = popOutTime - item.d_enqueueTime;
 
+    // Room was made in the bounded queue: move the overflowing events to it
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_overflowSize > 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_overflowMutex);  // LOCK
+        drainOverflow();
+    }
+
     {  // d_lasPoppedOutSpinLock   LOCKED
         bsls::SpinLockGuard guard(&d_lastPoppedOutSpinLock);
         d_lastPoppedOutTime = popOutTime;
@@ -216,6 +331,23 @@ void EventQueue::afterEventPopped(const QueueItem& item)
         d_stats_mp->adjustValue(k_STAT_QUEUE, -1);
         d_stats_mp->reportValue(k_STAT_TIME, queuedTime);
     }
+
+    // Update the latencies of the queues associated to message events.  The
+    // event is popped right before being handed to the user callback.
+    if (item.d_event_sp &&
+        item.d_event_sp->type() == Event::EventType::e_MESSAGE) {
+        const Event& event = *item.d_event_sp;
+
+        bsls::Types::Int64 pushToCallbackTime = -1;
+        if (event.rawEvent().isPushEvent() && event.receivedTime() != 0) {
+            pushToCallbackTime = popOutTime - event.receivedTime();
+        }
+
+        reportLatencies(event.queues(), queuedTime, pushToCallbackTime);
+        reportLatencies(event.queuesBySubscriptionId(),
+                        queuedTime,
+                        pushToCallbackTime);
+    }
 }
 
 void EventQueue::printLastEventTime(bsl::ostream& stream)
@@ -267,16 +399,37 @@ void EventQueue::dispatchNextEvent()
                   << "[id: " << bslmt::ThreadUtil::selfIdAsUint64() << "]";
 }
 
+// PRIVATE ACCESSORS
+bsls::Types::Int64 EventQueue::queueLowWatermark() const
+{
+    return d_fixedQueue_mp ? d_fixedQueue_mp->lowWatermark()
+                           : d_queue_mp->lowWatermark();
+}
+
+bsls::Types::Int64 EventQueue::queueHighWatermark() const
+{
+    return d_fixedQueue_mp ? d_fixedQueue_mp->highWatermark()
+                           : d_queue_mp->highWatermark();
+}
+
+bsls::Types::Int64 EventQueue::queueNumElements() const
+{
+    return d_fixedQueue_mp ? d_fixedQueue_mp->numElements() + d_overflowSize
+                           : d_queue_mp->numElements();
+}
+
 EventQueue::EventQueue(EventPool*                  eventPool,
                        int                         initialCapacity,
                        int                         lowWatermark,
                        int                         highWatermark,
                        const EventHandlerCallback& eventHandler,
                        int                         numProcessingThreads,
+                       bool                        lockFree,
                        bslma::Allocator*           allocator)
 : d_allocator_p(allocator)
 , d_eventPool_p(eventPool)
-, d_queue(initialCapacity, true, allocator)
+, d_queue_mp()
+, d_fixedQueue_mp()
 , d_threadPool_mp()
 , d_eventHandler(bsl::allocator_arg, allocator, eventHandler)
 , d_numProcessingThreads(numProcessingThreads)
@@ -289,6 +442,10 @@ EventQueue::EventQueue(EventPool*                  eventPool,
 , d_statTip(&d_statTable, allocator)
 , d_statTipNoDelta(&d_statTable, allocator)
 , d_pushBackSpinlock(bsls::SpinLock::s_unlocked)
+, d_overflowMutex()
+, d_overflow(allocator)
+, d_overflowSize(0)
+, d_spinCount(0)
 {
     // PRECONDITIONS
     BSLS_ASSERT_OPT((eventHandler && numProcessingThreads > 0) ||
@@ -301,7 +458,8 @@ EventQueue::EventQueue(EventPool*                  eventPool,
               << ", highWatermark: "
               << mwcu::PrintUtil::prettyNumber(highWatermark)
               << ", initialCapacity: "
-              << mwcu::PrintUtil::prettyNumber(initialCapacity);
+              << mwcu::PrintUtil::prettyNumber(initialCapacity)
+              << ", lockFree: " << bsl::boolalpha << lockFree;
     if (eventHandler) {
         outStream << ", using " << d_numProcessingThreads << " threads]";
     }
@@ -311,11 +469,33 @@ EventQueue::EventQueue(EventPool*                  eventPool,
 
     BALL_LOG_INFO << outStream.str();
 
-    d_queue.setWatermarks(lowWatermark, highWatermark);
-    d_queue.setStateCallback(
-        bdlf::BindUtil::bind(&EventQueue::stateCallback,
-                             this,
-                             bdlf::PlaceHolders::_1));  // state
+    const MonitoredEventQueue::StateCallback stateCb = bdlf::BindUtil::bind(
+        &EventQueue::stateCallback,
+        this,
+        bdlf::PlaceHolders::_1);  // state
+
+    if (lockFree) {
+        const int capacity = bsl::max(initialCapacity,
+                                      k_LOCK_FREE_CAPACITY_FACTOR *
+                                          highWatermark);
+
+        d_fixedQueue_mp.load(new (*d_allocator_p)
+                                 MonitoredFixedEventQueue(capacity,
+                                                          true,
+                                                          d_allocator_p),
+                             d_allocator_p);
+        d_fixedQueue_mp->setWatermarks(lowWatermark, highWatermark);
+        d_fixedQueue_mp->setStateCallback(stateCb);
+    }
+    else {
+        d_queue_mp.load(new (*d_allocator_p)
+                            MonitoredEventQueue(initialCapacity,
+                                                true,
+                                                d_allocator_p),
+                        d_allocator_p);
+        d_queue_mp->setWatermarks(lowWatermark, highWatermark);
+        d_queue_mp->setStateCallback(stateCb);
+    }
 }
 
 EventQueue::~EventQueue()
@@ -423,7 +603,15 @@ int EventQueue::start()
 {
     // Make sure the queue is empty (so that we can do start, stop, start, ...
     // sequence of operations).
-    d_queue.reset();
+    if (d_fixedQueue_mp) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_overflowMutex);  // LOCK
+        d_fixedQueue_mp->reset();
+        d_overflow.clear();
+        d_overflowSize = 0;
+    }
+    else {
+        d_queue_mp->reset();
+    }
 
     // Resets the stats
     if (d_stats_mp) {
@@ -498,6 +686,14 @@ void EventQueue::stop()
     d_threadPool_mp.reset();
 }
 
+void EventQueue::setSpinCount(int value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= value);
+
+    d_spinCount = value;
+}
+
 int EventQueue::pushBack(bsl::shared_ptr<Event>& event)
 {
     // PRECONDITIONS
@@ -505,21 +701,35 @@ int EventQueue::pushBack(bsl::shared_ptr<Event>& event)
 
     // This method is mostly called from the IO thread. We NEVER want to block
     // the IO thread, because it will push back contention to the broker side.
-    // Instead, we read the event and drop it.
+    // Instead, with the bounded lock-free queue, we drop message events and
+    // keep any other event in the overflow list when the queue is full: a
+    // lost session event (e.g. the result of an open queue, or CONNECTED)
+    // would leave the application waiting for it forever.
 
     BALL_LOG_TRACE << "Enqueuing " << *event;
 
     QueueItem item(event, mwcsys::Time::highResolutionTimer());
     int       rc = 0;
 
-    {  // d_pushBackSpinlock   LOCKED
-        bsls::SpinLockGuard guard(&d_pushBackSpinlock);
-        rc = d_queue.tryPushBack(item);
-    }  // d_pushBackSpinlock UNLOCKED
+    if (!d_fixedQueue_mp) {
+        rc = tryPushBack(item);
+    }
+    else if (event->type() != Event::EventType::e_MESSAGE) {
+        pushBackNoDrop(item);
+    }
+    else if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_overflowSize > 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        // Don't overtake the older events in the overflow list
+        rc = -1;
+    }
+    else {
+        rc = tryPushBack(item);
+    }
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        BSLS_ASSERT_SAFE(false && "Impossible - failed to enqueue");
+        // The bounded lock-free queue drops the message event when full.
+        BSLS_ASSERT_SAFE(d_fixedQueue_mp && "Impossible - failed to enqueue");
         BALL_LOG_ERROR << "Failed to enqueue: " << *item.d_event_sp;
         return -1;  // RETURN
     }
@@ -544,16 +754,42 @@ bsl::shared_ptr<Event> EventQueue::popFront()
         return event;  // RETURN
     }
 
-    // Look in the queue
+    // Look in the queue, spinning first if configured to
     QueueItem item;
-    const int rc = d_queue.popFront(&item);
-    BSLS_ASSERT_SAFE(rc == 0);
-    (void)rc;
+    if (spinPopFrontItem(&item) != 0) {
+        const int rc = d_fixedQueue_mp ? d_fixedQueue_mp->popFront(&item)
+                                       : d_queue_mp->popFront(&item);
+        BSLS_ASSERT_SAFE(rc == 0);
+        (void)rc;
+    }
     event = item.d_event_sp;
     afterEventPopped(item);
     return event;
 }
 
+int EventQueue::tryPopFront(bsl::shared_ptr<Event>* event)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(event);
+
+    // Check for priority events first
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(hasPriorityEvents(event))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        afterEventPopped(
+            QueueItem(*event, mwcsys::Time::highResolutionTimer()));
+        return 0;  // RETURN
+    }
+
+    QueueItem item;
+    if (tryPopFrontItem(&item) != 0) {
+        return -1;  // RETURN
+    }
+
+    *event = item.d_event_sp;
+    afterEventPopped(item);
+    return 0;
+}
+
 bsl::shared_ptr<Event>
 EventQueue::timedPopFront(const bsls::TimeInterval& timeout,
                           const bsls::TimeInterval& now)
@@ -569,9 +805,14 @@ EventQueue::timedPopFront(const bsls::TimeInterval& timeout,
     }
 
     const bsls::TimeInterval absTimeOut = timeout + now;
-    // Look in the queue
+    // Look in the queue, spinning first if configured to
     QueueItem item;
-    const int rc = d_queue.timedPopFront(&item, absTimeOut);
+    int       rc = spinPopFrontItem(&item);
+    if (rc != 0) {
+        rc = d_fixedQueue_mp
+                 ? d_fixedQueue_mp->timedPopFront(&item, absTimeOut)
+                 : d_queue_mp->timedPopFront(&item, absTimeOut);
+    }
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
@@ -618,10 +859,14 @@ void EventQueue::enqueuePoisonPill()
     // PoisonPill has a null event
     QueueItem item(0, mwcsys::Time::highResolutionTimer());
 
-    {  // d_pushBackSpinlock   LOCKED
-        bsls::SpinLockGuard guard(&d_pushBackSpinlock);
-        d_queue.tryPushBack(item);
-    }  // d_pushBackSpinlock UNLOCKED
+    if (d_fixedQueue_mp) {
+        // The poison pill must not be dropped, but 'stop' must not block
+        // waiting for room either (it may be called from the event handler).
+        pushBackNoDrop(item);
+    }
+    else {
+        tryPushBack(item);
+    }
 
     // Update stats
     if (d_stats_mp) {
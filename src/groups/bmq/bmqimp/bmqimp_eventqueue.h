@@ -33,6 +33,23 @@
 // The queue has a built-in monitoring mechanism that will emit alarms when it
 // reaches certain user-customizable thresholds.
 //
+// By default, the queue is an unbounded 'bdlcc::SingleProducerQueue', and
+// producers are serialized with a spin lock.  When created with 'lockFree',
+// the queue is instead a bounded lock-free 'bdlcc::FixedQueue', supporting
+// concurrent producers without contention on a lock, with a capacity of
+// twice the 'highWatermark' (and at least 'initialCapacity'); a message event
+// pushed while the queue is full is dropped and an error is logged.  Any other
+// event (such as a session event carrying the result of an operation, or the
+// poison pill stopping a processing thread) is instead kept in an unbounded
+// overflow list, in order, and moved to the queue as soon as it has room, so
+// that pushing never blocks and the application is never left waiting for an
+// event that was lost.
+//
+// A spin count can be set with 'setSpinCount': 'popFront' and
+// 'timedPopFront' then first attempt to pop an event that many times without
+// blocking, to avoid the latency of waking up a blocked thread when events are
+// pushed at a high rate.
+//
 /// Statistics
 ///----------
 // If configured for the queue can keep keep track of the following statistics:
@@ -135,6 +152,7 @@
 #include <bmqimp_event.h>
 
 // MWC
+#include <mwcc_monitoredqueue_bdlccfixedqueue.h>
 #include <mwcc_monitoredqueue_bdlccsingleproducerqueue.h>
 #include <mwcc_multiqueuethreadpool.h>
 #include <mwcsys_time.h>
@@ -146,15 +164,18 @@
 #include <mwcst_table.h>
 
 // BDE
+#include <bdlcc_fixedqueue.h>
 #include <bdlcc_sharedobjectpool.h>
 #include <bdlcc_singleproducerqueue.h>
 #include <bdlmt_fixedthreadpool.h>
 #include <bdlt_currenttime.h>
+#include <bsl_deque.h>
 #include <bsl_functional.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_mutex.h>
 #include <bsls_atomic.h>
 #include <bsls_cpp11.h>
 #include <bsls_spinlock.h>
@@ -213,6 +234,9 @@ class EventQueue {
     typedef mwcc::MonitoredQueue<bdlcc::SingleProducerQueue<QueueItem> >
         MonitoredEventQueue;
 
+    typedef mwcc::MonitoredQueue<bdlcc::FixedQueue<QueueItem> >
+        MonitoredFixedEventQueue;
+
   private:
     // DATA
     bslma::Allocator* d_allocator_p;
@@ -222,8 +246,12 @@ class EventQueue {
     // Pointer to the ObjectPool of
     // Event (held, not owned)
 
-    MonitoredEventQueue d_queue;
-    // The queue
+    bslma::ManagedPtr<MonitoredEventQueue> d_queue_mp;
+    // The queue, if not lock-free
+
+    bslma::ManagedPtr<MonitoredFixedEventQueue> d_fixedQueue_mp;
+    // The bounded lock-free queue, if
+    // lock-free
 
     FixedThreadPoolMP d_threadPool_mp;
     // Thread pool to process items
@@ -282,7 +310,26 @@ class EventQueue {
 
     bsls::SpinLock d_pushBackSpinlock;
     // SpinLock to synchronize
-    // 'pushBack'
+    // 'pushBack', if not lock-free
+
+    bslmt::Mutex d_overflowMutex;
+    // Mutex serializing the events that
+    // cannot be dropped, and protecting
+    // 'd_overflow', if lock-free
+
+    bsl::deque<QueueItem> d_overflow;
+    // Events that cannot be dropped,
+    // pushed while the bounded queue was
+    // full, in order, if lock-free
+
+    bsls::AtomicInt d_overflowSize;
+    // Number of items in 'd_overflow',
+    // readable without locking
+
+    int d_spinCount;
+    // Number of non-blocking attempts
+    // at popping an item before
+    // blocking
 
   private:
     // NOT IMPLEMENTED
@@ -295,6 +342,30 @@ class EventQueue {
     /// Queries the object pool for a new event item.
     bsl::shared_ptr<Event> getEvent();
 
+    /// Push the specified `item` to the queue without blocking, and return
+    /// 0 on success or non-zero if the queue is full or disabled.
+    int tryPushBack(const QueueItem& item);
+
+    /// Push the specified `item`, which must not be dropped, to the bounded
+    /// queue without blocking, keeping it in the overflow list if the queue
+    /// is full or if older items are still in the overflow list.  The
+    /// behavior is undefined unless the queue is lock-free.
+    void pushBackNoDrop(const QueueItem& item);
+
+    /// Move as many items as possible from the overflow list to the bounded
+    /// queue, in order.  The behavior is undefined unless
+    /// `d_overflowMutex` is locked.
+    void drainOverflow();
+
+    /// Pop the front item of the queue without blocking into the specified
+    /// `item`, and return 0 on success or non-zero if the queue is empty.
+    int tryPopFrontItem(QueueItem* item);
+
+    /// Attempt up to the spin count times to pop the front item of the
+    /// queue without blocking into the specified `item`, and return 0 on
+    /// success or non-zero if the queue remained empty.
+    int spinPopFrontItem(QueueItem* item);
+
     /// Callback invoked by the MonitoredFixedQueue when it has changed to
     /// the specified `state`.
     void stateCallback(mwcc::MonitoredQueueState::Enum state);
@@ -316,6 +387,17 @@ class EventQueue {
     /// the queue and call out the provided EventHandler.
     void dispatchNextEvent();
 
+    // PRIVATE ACCESSORS
+
+    /// Return the low watermark of the queue.
+    bsls::Types::Int64 queueLowWatermark() const;
+
+    /// Return the high watermark of the queue.
+    bsls::Types::Int64 queueHighWatermark() const;
+
+    /// Return the number of elements in the queue.
+    bsls::Types::Int64 queueNumElements() const;
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(EventQueue, bslma::UsesBslmaAllocator)
@@ -326,14 +408,17 @@ class EventQueue {
     /// `lowWatermark` and `highWatermark`.  If the specified `eventHandler`
     /// is callable, a thread pool having the specified
     /// `numProcessingThreads` will be created and used to dispatch
-    /// processing of the events by invoking the `eventHandler`.  Use the
-    /// specified `allocator` for any memory allocations.
+    /// processing of the events by invoking the `eventHandler`.  If the
+    /// specified `lockFree` is true, use a bounded lock-free queue (see the
+    /// component level documentation).  Use the specified `allocator` for
+    /// any memory allocations.
     EventQueue(EventPool*                  eventPool,
                int                         initialCapacity,
                int                         lowWatermark,
                int                         highWatermark,
                const EventHandlerCallback& eventHandler,
                int                         numProcessingThreads,
+               bool                        lockFree,
                bslma::Allocator*           allocator);
 
     /// Destructor
@@ -358,14 +443,27 @@ class EventQueue {
     /// have been processed.
     void stop();
 
+    /// Set the number of attempts at popping an item without blocking in
+    /// `popFront` and `timedPopFront` to the specified `value`.  The
+    /// behavior is undefined unless `0 <= value`, and unless this method is
+    /// called before `start`.
+    void setSpinCount(int value);
+
     /// Push the specified `event` to the queue, returning 0 on success or
-    /// non-zero on failure to push.
+    /// non-zero on failure to push.  Note that only a message event can fail
+    /// to be pushed, when the queue is lock-free and full.
     int pushBack(bsl::shared_ptr<Event>& event);
 
     /// Return the front item of the queue, if the queue is not empty; or
     /// block and wait until an item is being pushed to the queue.
     bsl::shared_ptr<Event> popFront();
 
+    /// Load into the specified `event` the front item of the queue and
+    /// return 0 if the queue is not empty, or return a non-zero value and
+    /// leave `event` unchanged, without blocking, if it is empty.  Note
+    /// that the loaded `event` is null if it is a poison pill.
+    int tryPopFront(bsl::shared_ptr<Event>* event);
+
     /// Return the front item of the queue, if the queue is not empty; or
     /// wait for up to the specified `timeout` in respect to the specified
     /// `now` - as a relative offset from between
@@ -389,6 +487,9 @@ class EventQueue {
     /// Return the event pool use by this object.
     EventPool* eventPool() const;
 
+    /// Return true if this object uses a bounded lock-free queue.
+    bool isLockFree() const;
+
     /// Print the statistics of this `EventQueue` to the specified `stream`.
     /// If the specified `includeDelta` is true, the printed report will
     /// include delta statistics (if any) representing variations since the
@@ -410,6 +511,11 @@ inline EventQueue::EventPool* EventQueue::eventPool() const
     return d_eventPool_p;
 }
 
+inline bool EventQueue::isLockFree() const
+{
+    return d_fixedQueue_mp.get() != 0;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
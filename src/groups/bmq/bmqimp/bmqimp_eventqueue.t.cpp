@@ -132,6 +132,7 @@ void queuePerformance(int                       numReaders,
                       int                       numWriters,
                       int                       numIter,
                       int                       queueSize,
+                      bool                      lockFree,
                       bdlbb::BlobBufferFactory* bufferFactory)
 {
     bdlmt::ThreadPool threadPool(
@@ -143,8 +144,9 @@ void queuePerformance(int                       numReaders,
     BSLS_ASSERT_OPT(threadPool.start() == 0);
 
     PRINT_SAFE("===================");
-    PRINT_SAFE("Queue numReaders: " << numReaders
-                                    << " numWriters: " << numWriters);
+    PRINT_SAFE("Queue numReaders: " << numReaders << " numWriters: "
+                                    << numWriters << " lockFree: "
+                                    << bsl::boolalpha << lockFree);
     PRINT_SAFE("===================");
     bmqimp::EventQueue::EventPool eventPool(
         bdlf::BindUtil::bind(&poolCreateEvent,
@@ -161,6 +163,7 @@ void queuePerformance(int                       numReaders,
                            queueSize / 2,  // highWatermark
                            emptyEventHandler,
                            0,  // numProcessingThreads
+                           lockFree,  // lockFree
                            s_allocator_p);
 
     for (int i = 0; i < numReaders; i++) {
@@ -213,6 +216,7 @@ static void test1_breathingTest()
                            6,  // highWatermark
                            emptyEventHandler,
                            0,  // numProcessingThreads
+                           false,  // lockFree
                            s_allocator_p);
 
     // Basic testing.. enqueue one item, pop it out ..
@@ -275,6 +279,7 @@ static void test2_capacityTest()
                            k_INITIAL_CAPACITY - 1,  // highWatermark
                            emptyEventHandler,
                            0,  // numProcessingThreads
+                           false,  // lockFree
                            s_allocator_p);
 
     builder.startMessage();
@@ -332,6 +337,7 @@ static void test3_watermark()
                            6,  // highWatermark
                            emptyEventHandler,
                            0,  // numProcessingThreads
+                           false,  // lockFree
                            s_allocator_p);
 
     bsl::shared_ptr<bmqimp::Event> event;
@@ -413,6 +419,7 @@ static void test4_basicEventHandlerTest()
                                                 bdlf::PlaceHolders::_1,
                                                 bsl::ref(eventCounter)),
                            k_NUM_THREADS,  // numProcessingThreads
+                           false,  // lockFree
                            s_allocator_p);
 
     obj.start();
@@ -495,6 +502,7 @@ static void test5_emptyStatsTest()
                            6,  // highWatermark
                            emptyEventHandler,
                            0,  // numProcessingThreads
+                           false,  // lockFree
                            s_allocator_p);
 
     ASSERT_SAFE_FAIL(obj.printStats(out, false));
@@ -595,6 +603,7 @@ static void test6_workingStatsTest()
                            k_QUEUE_HWM,         // highWatermark
                            emptyEventHandler,
                            0,  // numProcessingThreads
+                           false,  // lockFree
                            s_allocator_p);
 
     // May also call 'start' for the queue without custom event
@@ -654,6 +663,252 @@ static void test6_workingStatsTest()
     ASSERT_EQ(valTime.max(), k_INITIAL_CAPACITY * k_MILL_SEC + k_QUEUE_WAIT);
 }
 
+static void test7_lockFreeQueue()
+// ------------------------------------------------------------------------
+// LOCK-FREE QUEUE
+//
+// Concerns:
+//   1. A lock-free bmqimp::EventQueue has a bounded capacity of twice its
+//      high watermark, drops message events pushed while full, keeps the
+//      session events pushed while full in order, and still emits the
+//      watermark events.
+//   2. Events pushed concurrently by multiple producers are all
+//      delivered.
+//
+// Plan:
+//   1. Create a lock-free bmqimp::EventQueue, fill it, and check that one
+//      more message event is rejected while two more session events are
+//      accepted, and that a message event is rejected until they are
+//      dequeued.  Dequeue events and verify their order.
+//   2. Create a lock-free bmqimp::EventQueue with processing threads,
+//      push events from several threads, and check that the handler is
+//      called for every event.
+//
+// Testing manipulators:
+//   - pushBack
+//   - popFront
+//   - isLockFree
+//   ----------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("LOCK-FREE QUEUE");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    bmqimp::EventQueue::EventPool  eventPool(
+        bdlf::BindUtil::bind(&poolCreateEvent,
+                             bdlf::PlaceHolders::_1,  // address
+                             &bufferFactory,
+                             bdlf::PlaceHolders::_2),  // allocator
+        -1,
+        s_allocator_p);
+
+    PV("Bounded capacity");
+    {
+        const int k_HIGH_WATERMARK = 6;
+        const int k_CAPACITY       = 2 * k_HIGH_WATERMARK;
+
+        bmqimp::EventQueue::EventHandlerCallback emptyEventHandler;
+
+        bmqimp::EventQueue obj(&eventPool,
+                               1,                 // initialCapacity
+                               3,                 // lowWatermark
+                               k_HIGH_WATERMARK,  // highWatermark
+                               emptyEventHandler,
+                               0,     // numProcessingThreads
+                               true,  // lockFree
+                               s_allocator_p);
+
+        ASSERT(obj.isLockFree());
+
+        bsl::shared_ptr<bmqimp::Event> event;
+
+        for (int i = 0; i < k_CAPACITY; ++i) {
+            event = eventPool.getObject();
+            event->configureAsSessionEvent(
+                bmqt::SessionEventType::e_UNDEFINED,
+                i,
+                bmqt::CorrelationId(),
+                "");
+            ASSERT_EQ_D(i, obj.pushBack(event), 0);
+        }
+
+        bmqp::PutEventBuilder builder(&bufferFactory, s_allocator_p);
+        builder.startMessage();
+        const bdlbb::Blob& eventBlob = builder.blob();
+        bmqp::Event        rawEvent(&eventBlob, s_allocator_p);
+
+        // The queue is full: the message event is dropped
+        event = eventPool.getObject();
+        event->configureAsMessageEvent(rawEvent);
+        ASSERT_NE(obj.pushBack(event), 0);
+
+        // .. but the session events are kept
+        for (int i = k_CAPACITY; i < k_CAPACITY + 2; ++i) {
+            event = eventPool.getObject();
+            event->configureAsSessionEvent(
+                bmqt::SessionEventType::e_UNDEFINED,
+                i,
+                bmqt::CorrelationId(),
+                "");
+            ASSERT_EQ_D(i, obj.pushBack(event), 0);
+        }
+
+        // The high watermark event is prioritized
+        event = obj.popFront();
+        ASSERT_EQ(event->sessionEventType(),
+                  bmqt::SessionEventType::e_SLOWCONSUMER_HIGHWATERMARK);
+
+        event = obj.popFront();
+        ASSERT_EQ(event->statusCode(), 0);
+
+        // There is room in the queue, but a message event must not overtake
+        // the session event still waiting for it
+        event = eventPool.getObject();
+        event->configureAsMessageEvent(rawEvent);
+        ASSERT_NE(obj.pushBack(event), 0);
+
+        for (int i = 1; i < k_CAPACITY + 2; ++i) {
+            event = obj.popFront();
+            PVV("Dequeued: " << (*event));
+            ASSERT_EQ_D(i, event->statusCode(), i);
+        }
+
+        event = obj.popFront();
+        ASSERT_EQ(event->sessionEventType(),
+                  bmqt::SessionEventType::e_SLOWCONSUMER_NORMAL);
+    }
+
+    PV("Concurrent producers");
+    {
+        const int k_NUM_THREADS   = 4;
+        const int k_NUM_PRODUCERS = 4;
+        const int k_NUM_EVENTS    = 1000;  // per producer
+
+        bsls::AtomicInt eventCounter;
+
+        bmqimp::EventQueue obj(
+            &eventPool,
+            100,                              // initialCapacity
+            3,                                // lowWatermark
+            k_NUM_PRODUCERS * k_NUM_EVENTS,  // highWatermark
+            bdlf::BindUtil::bind(&eventHandler,
+                                 bdlf::PlaceHolders::_1,
+                                 bsl::ref(eventCounter)),
+            k_NUM_THREADS,  // numProcessingThreads
+            true,           // lockFree
+            s_allocator_p);
+
+        ASSERT_EQ(obj.start(), 0);
+
+        bdlmt::ThreadPool threadPool(
+            bslmt::ThreadAttributes(),        // default
+            k_NUM_PRODUCERS,                  // minThreads
+            k_NUM_PRODUCERS,                  // maxThreads
+            bsl::numeric_limits<int>::max(),  // maxIdleTime
+            s_allocator_p);
+        ASSERT_EQ(threadPool.start(), 0);
+
+        for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+            threadPool.enqueueJob(
+                bdlf::BindUtil::bindS(s_allocator_p,
+                                      &performanceTestQueuePusher,
+                                      &obj,
+                                      k_NUM_EVENTS));
+        }
+        threadPool.drain();
+
+        // Stopping waits for all events to be processed
+        obj.stop();
+
+        ASSERT_EQ(eventCounter, k_NUM_PRODUCERS * k_NUM_EVENTS);
+    }
+}
+
+static void test8_tryPopFrontAndSpinning()
+// ------------------------------------------------------------------------
+// TRY POP FRONT AND SPINNING
+//
+// Concerns:
+//   1. 'tryPopFront' does not block and fails if the queue is empty.
+//   2. With a spin count, 'popFront' and 'timedPopFront' still return
+//      the events in order, and 'timedPopFront' still times out.
+//
+// Plan:
+//   1. For both the default and lock-free queues, with and without a
+//      spin count, push events and pop them with 'tryPopFront',
+//      'popFront' and 'timedPopFront'.
+//
+// Testing manipulators:
+//   - setSpinCount
+//   - tryPopFront
+//   - popFront
+//   - timedPopFront
+//   ----------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("TRY POP FRONT AND SPINNING");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    bmqimp::EventQueue::EventPool  eventPool(
+        bdlf::BindUtil::bind(&poolCreateEvent,
+                             bdlf::PlaceHolders::_1,  // address
+                             &bufferFactory,
+                             bdlf::PlaceHolders::_2),  // allocator
+        -1,
+        s_allocator_p);
+
+    bmqimp::EventQueue::EventHandlerCallback emptyEventHandler;
+
+    for (int lockFree = 0; lockFree < 2; ++lockFree) {
+        for (int spinCount = 0; spinCount <= 100; spinCount += 100) {
+            PV("lockFree: " << lockFree << ", spinCount: " << spinCount);
+
+            bmqimp::EventQueue obj(&eventPool,
+                                   10,  // initialCapacity
+                                   3,   // lowWatermark
+                                   10,  // highWatermark
+                                   emptyEventHandler,
+                                   0,  // numProcessingThreads
+                                   lockFree,
+                                   s_allocator_p);
+            obj.setSpinCount(spinCount);
+
+            bsl::shared_ptr<bmqimp::Event> event;
+
+            // Empty queue
+            ASSERT_NE(obj.tryPopFront(&event), 0);
+            ASSERT(!event);
+
+            for (int i = 0; i < 3; ++i) {
+                event = eventPool.getObject();
+                event->configureAsSessionEvent(
+                    bmqt::SessionEventType::e_UNDEFINED,
+                    i,
+                    bmqt::CorrelationId(),
+                    "");
+                ASSERT_EQ(obj.pushBack(event), 0);
+            }
+            event.reset();
+
+            ASSERT_EQ(obj.tryPopFront(&event), 0);
+            ASSERT(event);
+            ASSERT_EQ(event->statusCode(), 0);
+
+            event = obj.popFront();
+            ASSERT_EQ(event->statusCode(), 1);
+
+            event = obj.timedPopFront(bsls::TimeInterval(0, 2000000));
+            ASSERT_EQ(event->statusCode(), 2);
+
+            // Empty queue again
+            ASSERT_NE(obj.tryPopFront(&event), 0);
+            ASSERT_EQ(event->statusCode(), 2);
+
+            event = obj.timedPopFront(bsls::TimeInterval(0, 2000000));
+            ASSERT_EQ(event->sessionEventType(),
+                      bmqt::SessionEventType::e_TIMEOUT);
+        }
+    }
+}
+
 static void testN1_performance()
 // ------------------------------------------------------------------------
 // QUEUE - PERFORMANCE TEST
@@ -661,6 +916,8 @@ static void testN1_performance()
 // Concerns:
 //  a) Check the performance of bmqimp::EventQueue for the case of
 //     multiple readers and a single writer.
+//  b) Compare the performance of the default and lock-free queues for
+//     the case of multiple writers.
 //
 // Plan:
 //  1) Create a bmqimp::EventQueue and enqueue events as quickly as
@@ -680,26 +937,45 @@ static void testN1_performance()
                      1,
                      k_NUM_ITERATIONS,
                      k_FIXED_QUEUE_SIZE,
+                     false,  // lockFree
                      &bufferFactory);
     queuePerformance(2,
                      1,
                      k_NUM_ITERATIONS,
                      k_FIXED_QUEUE_SIZE,
+                     false,  // lockFree
                      &bufferFactory);
     queuePerformance(4,
                      1,
                      k_NUM_ITERATIONS,
                      k_FIXED_QUEUE_SIZE,
+                     false,  // lockFree
                      &bufferFactory);
     queuePerformance(8,
                      1,
                      k_NUM_ITERATIONS,
                      k_FIXED_QUEUE_SIZE,
+                     false,  // lockFree
                      &bufferFactory);
     queuePerformance(16,
                      1,
                      k_NUM_ITERATIONS,
                      k_FIXED_QUEUE_SIZE,
+                     false,  // lockFree
+                     &bufferFactory);
+
+    // Multiple writers, with and without the lock-free queue
+    queuePerformance(1,
+                     4,
+                     k_NUM_ITERATIONS,
+                     k_FIXED_QUEUE_SIZE,
+                     false,  // lockFree
+                     &bufferFactory);
+    queuePerformance(1,
+                     4,
+                     k_NUM_ITERATIONS,
+                     k_FIXED_QUEUE_SIZE,
+                     true,  // lockFree
                      &bufferFactory);
 }
 
@@ -716,6 +992,8 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 8: test8_tryPopFrontAndSpinning(); break;
+    case 7: test7_lockFreeQueue(); break;
     case 6: test6_workingStatsTest(); break;
     case 5: test5_emptyStatsTest(); break;
     case 4: test4_basicEventHandlerTest(); break;
@@ -20,10 +20,13 @@
 // MWC
 #include <mwcst_statcontext.h>
 #include <mwcst_statutil.h>
+#include <mwcu_printutil.h>
 
 // BDE
 #include <bdlma_localsequentialallocator.h>
+#include <bsl_iomanip.h>
 #include <bslma_allocator.h>
+#include <bslmt_lockguard.h>
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
 
@@ -39,6 +42,31 @@ enum {
     ,
     k_STAT_MESSAGE = 1  // value = number of messages
 };
+
+/// Percentiles of the latencies to print
+const double k_PERCENTILES[] = {50.0, 90.0, 99.0, 99.9};
+
+/// Print to the specified `stream` the count, percentiles and max of the
+/// specified `histogram`, in one line prefixed with the specified `name`.
+void printHistogram(bsl::ostream&           stream,
+                    const char*             name,
+                    const mwcst::Histogram& histogram)
+{
+    stream << "    " << bsl::left << bsl::setw(18) << name << bsl::right
+           << "count: " << histogram.count();
+
+    const size_t numPercentiles = sizeof(k_PERCENTILES) /
+                                  sizeof(*k_PERCENTILES);
+    for (size_t i = 0; i < numPercentiles; ++i) {
+        stream << ", p" << k_PERCENTILES[i] << ": "
+               << mwcu::PrintUtil::prettyTimeInterval(
+                      histogram.valueAtPercentile(k_PERCENTILES[i]));
+    }
+
+    stream << ", max: "
+           << mwcu::PrintUtil::prettyTimeInterval(histogram.max()) << "\n";
+}
+
 }  // close unnamed namespace
 
 // ---------------------------
@@ -63,6 +91,43 @@ const char* EventsStatsEventType::toAscii(EventsStatsEventType::Enum value)
 #undef CASE
 }
 
+// -----------------------------
+// struct EventsStatsLatencyType
+// -----------------------------
+
+const char*
+EventsStatsLatencyType::toAscii(EventsStatsLatencyType::Enum value)
+{
+#define CASE(X)                                                               \
+    case e_##X: return #X;
+
+    switch (value) {
+        CASE(QUEUE_TIME)
+        CASE(PUT_TO_ACK)
+        CASE(PUSH_TO_CALLBACK)
+        CASE(LAST)
+    default: return "(* UNKNOWN *)";
+    }
+
+#undef CASE
+}
+
+// -------------------------------
+// class EventsStatsQueueLatencies
+// -------------------------------
+
+EventsStatsQueueLatencies::EventsStatsQueueLatencies()
+{
+    // NOTHING
+}
+
+void EventsStatsQueueLatencies::reset()
+{
+    for (int type = 0; type < EventsStatsLatencyType::e_LAST; ++type) {
+        d_histograms[type].reset();
+    }
+}
+
 // -----------------
 // class EventsStats
 // -----------------
@@ -70,6 +135,8 @@ const char* EventsStatsEventType::toAscii(EventsStatsEventType::Enum value)
 EventsStats::EventsStats(bslma::Allocator* allocator)
 : d_allocator_p(allocator)
 , d_stat(allocator)
+, d_queueLatenciesLock()
+, d_queueLatencies(allocator)
 {
     // NOTHING
 }
@@ -193,6 +260,14 @@ void EventsStats::resetStats()
     if (d_stat.d_statContext_mp) {
         d_stat.d_statContext_mp->clearValues();
     }
+
+    // Reset the latencies, but keep the entries: queues may have cached them
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_queueLatenciesLock);  // LOCK
+    for (QueueLatenciesMap::iterator it = d_queueLatencies.begin();
+         it != d_queueLatencies.end();
+         ++it) {
+        it->second->reset();
+    }
 }
 
 void EventsStats::onEvent(EventsStatsEventType::Enum type,
@@ -209,5 +284,63 @@ void EventsStats::onEvent(EventsStatsEventType::Enum type,
     d_statContexts_mp[type]->adjustValue(k_STAT_MESSAGE, messageCount);
 }
 
+EventsStats::QueueLatenciesSp
+EventsStats::queueLatencies(const bsl::string& queueUri)
+{
+    if (!d_stat.d_statContext_mp) {
+        // Stats are disabled (i.e. 'initializeStats' was not called).
+        return QueueLatenciesSp();  // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_queueLatenciesLock);  // LOCK
+
+    QueueLatenciesSp& latencies = d_queueLatencies[queueUri];
+    if (!latencies) {
+        latencies.createInplace(d_allocator_p);
+    }
+
+    return latencies;
+}
+
+void EventsStats::printStats(bsl::ostream& stream, bool includeDelta) const
+{
+    d_stat.printStats(stream, includeDelta);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_queueLatenciesLock);  // LOCK
+
+    bool headerPrinted = false;
+    for (QueueLatenciesMap::const_iterator it = d_queueLatencies.begin();
+         it != d_queueLatencies.end();
+         ++it) {
+        const EventsStatsQueueLatencies& latencies = *it->second;
+
+        bool queuePrinted = false;
+        for (int i = 0; i < EventsStatsLatencyType::e_LAST; ++i) {
+            const EventsStatsLatencyType::Enum type =
+                static_cast<EventsStatsLatencyType::Enum>(i);
+            const mwcst::Histogram& histogram = latencies.histogram(type);
+            if (histogram.count() == 0) {
+                continue;  // CONTINUE
+            }
+
+            if (!headerPrinted) {
+                stream << "Latencies (since session start):\n";
+                headerPrinted = true;
+            }
+            if (!queuePrinted) {
+                stream << "  " << it->first << "\n";
+                queuePrinted = true;
+            }
+            printHistogram(stream,
+                           EventsStatsLatencyType::toAscii(type),
+                           histogram);
+        }
+    }
+
+    if (headerPrinted) {
+        stream << "\n";
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -20,31 +20,54 @@
 //@PURPOSE: Provide a mechanism to keep track of Events statistics.
 //
 //@CLASSES:
-//  bmqimp::EventsStatsEventType: Enum of the various events types
-//  bmqimp::EventsStats         : Events statistics manipulator
+//  bmqimp::EventsStatsEventType     : Enum of the various events types
+//  bmqimp::EventsStatsLatencyType   : Enum of the various latencies tracked
+//  bmqimp::EventsStatsQueueLatencies: Latency histograms of one queue
+//  bmqimp::EventsStats              : Events statistics manipulator
 //
 //@DESCRIPTION: 'bmqimp::EventsStats' allows to keep track of statistics for
 // the various events, represented by the 'bmqimp::EventsStatsEventType'.
 //
+// 'bmqimp::EventsStats' also keeps, for each queue, a
+// 'bmqimp::EventsStatsQueueLatencies' holding one histogram for each of the
+// latencies represented by the 'bmqimp::EventsStatsLatencyType' (time spent
+// by an event in the event queue, time from PUT to ACK, time from PUSH to the
+// user callback).  The percentiles of those histograms are printed along with
+// the events statistics.  Note that, unlike the events statistics, the
+// histograms are cumulative since the session started, there is no delta
+// version of them.
+//
 /// Usage
 ///-----
 // The 'initializeStats' method must be called once on the EventsStats, before
 // being able to report statistics update using the 'onEvent' method.
+//
+// The 'EventsStatsQueueLatencies' of a queue is obtained once (typically when
+// the queue is opened) with the 'queueLatencies' method, and latencies are
+// then reported directly to it, from any thread, using its 'onLatency'
+// method.
 
 // BMQ
 
 #include <bmqimp_stat.h>
 
 // MWC
+#include <mwcst_histogram.h>
 #include <mwcst_statcontext.h>
 #include <mwcst_statvalue.h>
 
 // BDE
+#include <bsl_map.h>
+#include <bsl_memory.h>
 #include <bsl_ostream.h>
+#include <bsl_string.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_mutex.h>
+#include <bsls_assert.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 
@@ -84,6 +107,69 @@ struct EventsStatsEventType {
     static const char* toAscii(EventsStatsEventType::Enum value);
 };
 
+// =============================
+// struct EventsStatsLatencyType
+// =============================
+
+/// Enum representing the various latencies being tracked.
+struct EventsStatsLatencyType {
+    // TYPES
+    enum Enum {
+        e_QUEUE_TIME       = 0,  // time spent in the event queue
+        e_PUT_TO_ACK       = 1,  // time from PUT sent to ACK received
+        e_PUSH_TO_CALLBACK = 2,  // time from PUSH received to user callback
+        e_LAST             = 3   // enum item count
+    };
+
+    // MANIPULATORS
+
+    /// Return the non-modifiable string representation corresponding to the
+    /// specified enumeration `value`, if it exists, and a unique (error)
+    /// string otherwise.  The string representation of `value` matches its
+    /// corresponding enumerator name with the `e_` prefix elided.
+    static const char* toAscii(EventsStatsLatencyType::Enum value);
+};
+
+// ===============================
+// class EventsStatsQueueLatencies
+// ===============================
+
+/// Latency histograms of one queue, one for each of the
+/// `EventsStatsLatencyType`.
+class EventsStatsQueueLatencies {
+  private:
+    // DATA
+    mwcst::Histogram d_histograms[EventsStatsLatencyType::e_LAST];
+    // Histogram for each of the latency types
+
+  private:
+    // NOT IMPLEMENTED
+    EventsStatsQueueLatencies(const EventsStatsQueueLatencies&);
+    EventsStatsQueueLatencies& operator=(const EventsStatsQueueLatencies&);
+
+  public:
+    // CREATORS
+
+    /// Create an object with empty histograms.
+    EventsStatsQueueLatencies();
+
+    // MANIPULATORS
+
+    /// Report a latency of the specified `type` having the specified
+    /// `nanoseconds` duration.  This method is thread-safe and lock-free.
+    void onLatency(EventsStatsLatencyType::Enum type,
+                   bsls::Types::Int64           nanoseconds);
+
+    /// Reset all histograms.
+    void reset();
+
+    // ACCESSORS
+
+    /// Return a reference not offering modifiable access to the histogram of
+    /// the latencies of the specified `type`.
+    const mwcst::Histogram& histogram(EventsStatsLatencyType::Enum type) const;
+};
+
 // =================
 // class EventsStats
 // =================
@@ -94,6 +180,12 @@ class EventsStats {
     // PRIVATE TYPES
     typedef bslma::ManagedPtr<mwcst::StatContext> StatContextMp;
 
+    typedef bsl::shared_ptr<EventsStatsQueueLatencies> QueueLatenciesSp;
+
+    /// Map of queue URI to the latencies of that queue.  This is an ordered
+    /// map so that queues are printed in a stable order.
+    typedef bsl::map<bsl::string, QueueLatenciesSp> QueueLatenciesMap;
+
   private:
     // DATA
     bslma::Allocator* d_allocator_p;
@@ -105,6 +197,14 @@ class EventsStats {
     StatContextMp d_statContexts_mp[EventsStatsEventType::e_LAST];
     // SubContext for each of the various event's type
 
+    mutable bslmt::Mutex d_queueLatenciesLock;
+    // Mutex protecting 'd_queueLatencies'
+
+    QueueLatenciesMap d_queueLatencies;
+    // Latencies of each queue.  Entries are never
+    // removed, so that the latencies of closed
+    // queues are still printed.
+
   private:
     // NOT IMPLEMENTED
 
@@ -145,10 +245,18 @@ class EventsStats {
     void
     onEvent(EventsStatsEventType::Enum type, int eventSize, int messageCount);
 
+    /// Return a shared pointer to the latencies associated to the queue
+    /// having the specified `queueUri`, creating it if needed, or an empty
+    /// shared pointer if stats are disabled (i.e. `initializeStats` has not
+    /// been called).  This method is thread-safe but not lock-free, and
+    /// should therefore be called once per queue, and the result cached.
+    QueueLatenciesSp queueLatencies(const bsl::string& queueUri);
+
     // ACCESSORS
 
     /// Print the stats to the specified `stream`; print the `delta` stats
-    /// column if the specified `includeDelta` is true.
+    /// column if the specified `includeDelta` is true.  The percentiles of
+    /// the latencies of each queue are printed after the events stats.
     void printStats(bsl::ostream& stream, bool includeDelta) const;
 };
 
@@ -156,14 +264,27 @@ class EventsStats {
 //                             INLINE DEFINITIONS
 // ============================================================================
 
-// -----------------
-// class EventsStats
-// -----------------
+// -------------------------------
+// class EventsStatsQueueLatencies
+// -------------------------------
 
-inline void EventsStats::printStats(bsl::ostream& stream,
-                                    bool          includeDelta) const
+inline void
+EventsStatsQueueLatencies::onLatency(EventsStatsLatencyType::Enum type,
+                                     bsls::Types::Int64           nanoseconds)
 {
-    d_stat.printStats(stream, includeDelta);
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= type && type < EventsStatsLatencyType::e_LAST);
+
+    d_histograms[type].record(nanoseconds);
+}
+
+inline const mwcst::Histogram&
+EventsStatsQueueLatencies::histogram(EventsStatsLatencyType::Enum type) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= type && type < EventsStatsLatencyType::e_LAST);
+
+    return d_histograms[type];
 }
 
 }  // close package namespace
@@ -0,0 +1,166 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqimp_flowcontrolmonitor.cpp                                      -*-C++-*-
+#include <bmqimp_flowcontrolmonitor.h>
+
+#include <bmqscm_version.h>
+// BDE
+#include <bsl_algorithm.h>
+#include <bslim_printer.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace bmqimp {
+
+// ------------------------
+// class FlowControlMonitor
+// ------------------------
+
+// PRIVATE MANIPULATORS
+void FlowControlMonitor::startInterval()
+{
+    d_minInFlight    = d_numInFlight;
+    d_maxInFlight    = d_numInFlight;
+    d_numPushed      = 0;
+    d_numPushedBytes = 0;
+    d_numConfirmed   = 0;
+}
+
+// CREATORS
+FlowControlMonitor::FlowControlMonitor()
+: d_numInFlight(0)
+, d_minInFlight(0)
+, d_maxInFlight(0)
+, d_numPushed(0)
+, d_numPushedBytes(0)
+, d_numConfirmed(0)
+, d_averageMessageSize(0)
+, d_messagesLimit(0)
+, d_bytesLimit(0)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+void FlowControlMonitor::setLimits(int maxMessages, int maxBytes)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 < maxMessages);
+    BSLS_ASSERT_SAFE(0 < maxBytes);
+
+    d_messagesLimit = maxMessages;
+    d_bytesLimit    = maxBytes;
+}
+
+void FlowControlMonitor::reset()
+{
+    d_numInFlight = 0;
+    startInterval();
+}
+
+bool FlowControlMonitor::computeWindow(int* maxMessages,
+                                       int* maxBytes,
+                                       int  currentMessages,
+                                       int  currentBytes)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(maxMessages);
+    BSLS_ASSERT_SAFE(maxBytes);
+    BSLS_ASSERT_SAFE(hasLimits());
+
+    typedef bsls::Types::Int64 Int64;
+
+    const Int64 numConfirmed = d_numConfirmed;
+    const Int64 minInFlight  = d_minInFlight;
+    const Int64 maxInFlight  = d_maxInFlight;
+    if (d_numPushed != 0) {
+        d_averageMessageSize = d_numPushedBytes / d_numPushed;
+    }
+
+    startInterval();
+
+    if (numConfirmed < k_MIN_CONFIRMS) {
+        // Not enough observations
+        return false;  // RETURN
+    }
+
+    const Int64 current = bsl::max(static_cast<Int64>(currentMessages),
+                                   static_cast<Int64>(1));
+    Int64       target  = current;
+    if (minInFlight == 0) {
+        if (2 * maxInFlight >= current) {
+            // The consumer drained all its messages while the window was in
+            // use: it is starved by its window.
+            target = 2 * current;
+        }
+    }
+    else if (8 * minInFlight > current) {
+        // Standing backlog of 'minInFlight' messages the consumer did not
+        // need to keep busy.
+        target = current - minInFlight / 2;
+    }
+
+    const Int64 lowest = bsl::min(static_cast<Int64>(k_MIN_MESSAGES),
+                                  static_cast<Int64>(d_messagesLimit));
+    target = bsl::max(lowest,
+                      bsl::min(target, static_cast<Int64>(d_messagesLimit)));
+
+    const bool  isInLimits = lowest <= current && current <= d_messagesLimit;
+    const Int64 change     = target > current ? target - current
+                                              : current - target;
+    if (isInLimits && change * 100 < current * k_MIN_CHANGE_PERCENT) {
+        // Not worth a reconfiguration
+        return false;  // RETURN
+    }
+
+    Int64 bytes = d_averageMessageSize != 0 ? 2 * target * d_averageMessageSize
+                                            : currentBytes;
+    const Int64 lowestBytes = bsl::min(static_cast<Int64>(k_MIN_BYTES),
+                                       static_cast<Int64>(d_bytesLimit));
+    bytes = bsl::max(lowestBytes,
+                     bsl::min(bytes, static_cast<Int64>(d_bytesLimit)));
+
+    *maxMessages = static_cast<int>(target);
+    *maxBytes    = static_cast<int>(bytes);
+
+    return true;
+}
+
+// ACCESSORS
+bsl::ostream& FlowControlMonitor::print(bsl::ostream& stream,
+                                        int           level,
+                                        int           spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;  // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("numInFlight", d_numInFlight);
+    printer.printAttribute("minInFlight", d_minInFlight);
+    printer.printAttribute("maxInFlight", d_maxInFlight);
+    printer.printAttribute("numConfirmed", d_numConfirmed);
+    printer.printAttribute("averageMessageSize", d_averageMessageSize);
+    printer.printAttribute("messagesLimit", d_messagesLimit);
+    printer.printAttribute("bytesLimit", d_bytesLimit);
+    printer.end();
+
+    return stream;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,271 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqimp_flowcontrolmonitor.h                                        -*-C++-*-
+#ifndef INCLUDED_BMQIMP_FLOWCONTROLMONITOR
+#define INCLUDED_BMQIMP_FLOWCONTROLMONITOR
+
+//@PURPOSE: Provide a mechanism to adapt the unconfirmed window of a queue.
+//
+//@CLASSES:
+//  bmqimp::FlowControlMonitor: adaptive unconfirmed window of a reader queue
+//
+//@DESCRIPTION: 'bmqimp::FlowControlMonitor' observes the messages pushed to,
+// and confirmed by, a consumer of a queue, and computes the
+// 'maxUnconfirmedMessages' and 'maxUnconfirmedBytes' the consumer should
+// configure so that its window of unconfirmed messages stays close to the
+// bandwidth-delay product of the consumer, that is its processing rate times
+// the time it takes for a message to be processed and for its confirmation to
+// be replaced by a new message from the broker.
+//
+// The monitor tracks, over each observation interval, the number of messages
+// which have been received but not yet confirmed (the *local* in-flight
+// messages, as opposed to the messages in transit between the broker and the
+// client).  At the end of each interval ('computeWindow'):
+//: o if the local in-flight count dropped to 0 at some point, while the
+//:   window was used at least by half, the consumer was idle waiting for
+//:   messages and so is starved by its window, which is doubled;
+//: o if the local in-flight count never dropped below 1/8th of the window,
+//:   the consumer had a standing backlog of messages that it did not need to
+//:   keep busy, and which could have been delivered to other consumers, and
+//:   the window is reduced by half of that backlog;
+//: o otherwise the window is left unchanged.
+//
+// The window is always kept between 'k_MIN_MESSAGES' and the limits set with
+// 'setLimits' (which are the values configured by the application), and no
+// change is reported if it is lower than 'k_MIN_CHANGE_PERCENT' percent of
+// the current window, or if fewer than 'k_MIN_CONFIRMS' messages were
+// confirmed over the interval.  'maxUnconfirmedBytes' follows the message
+// window, based on the average size of the messages pushed over the interval,
+// with a margin of 2 to accommodate variations of message sizes.
+//
+/// Thread Safety
+///-------------
+// NOT Thread-Safe.  In the BMQ SDK, all methods of this object are invoked
+// from the FSM thread of the session.
+
+// BDE
+#include <bsl_ostream.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bmqimp {
+
+// ========================
+// class FlowControlMonitor
+// ========================
+
+/// Mechanism computing the adaptive unconfirmed window of a reader queue.
+class FlowControlMonitor {
+  public:
+    // PUBLIC CONSTANTS
+    static const int k_MIN_MESSAGES = 16;
+    // Lowest message window ever computed,
+    // unless the configured limit is lower.
+
+    static const int k_MIN_BYTES = 64 * 1024;
+    // Lowest bytes window ever computed,
+    // unless the configured limit is lower.
+
+    static const int k_MIN_CONFIRMS = 32;
+    // Minimum number of messages confirmed
+    // over an interval for the window to
+    // be adapted.
+
+    static const int k_MIN_CHANGE_PERCENT = 25;
+    // Minimum change of the message
+    // window, in percent, to be reported.
+
+  private:
+    // DATA
+    bsls::Types::Int64 d_numInFlight;
+    // Number of messages received and not
+    // yet confirmed.
+
+    bsls::Types::Int64 d_minInFlight;
+    // Lowest value of 'd_numInFlight' over
+    // the current interval.
+
+    bsls::Types::Int64 d_maxInFlight;
+    // Highest value of 'd_numInFlight'
+    // over the current interval.
+
+    bsls::Types::Int64 d_numPushed;
+    // Number of messages received over the
+    // current interval.
+
+    bsls::Types::Int64 d_numPushedBytes;
+    // Number of bytes received over the
+    // current interval.
+
+    bsls::Types::Int64 d_numConfirmed;
+    // Number of messages confirmed over
+    // the current interval.
+
+    bsls::Types::Int64 d_averageMessageSize;
+    // Average size of the messages
+    // received over the last interval
+    // having received messages, or 0.
+
+    int d_messagesLimit;
+    // Highest message window, or 0 if the
+    // limits were never set.
+
+    int d_bytesLimit;
+    // Highest bytes window.
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Start a new observation interval.
+    void startInterval();
+
+  public:
+    // CREATORS
+
+    /// Create a `FlowControlMonitor` with no in-flight messages and no
+    /// limits.
+    FlowControlMonitor();
+
+    // MANIPULATORS
+
+    /// Set the highest windows this object may compute to the specified
+    /// `maxMessages` and `maxBytes`.
+    void setLimits(int maxMessages, int maxBytes);
+
+    /// Record the reception of one message of the specified `numBytes`.
+    void onPush(int numBytes);
+
+    /// Record the confirmation of the specified `numMessages`.
+    void onConfirm(int numMessages);
+
+    /// Forget all the in-flight messages and the observations of the
+    /// current interval, but keep the limits.  This must be called when
+    /// the unconfirmed messages are going to be redelivered (e.g. on
+    /// reconnection).
+    void reset();
+
+    /// End the current observation interval and start a new one.  Return
+    /// `true` and load the new windows into the specified `maxMessages`
+    /// and `maxBytes` if the specified `currentMessages` and
+    /// `currentBytes` windows should be changed based on the observations
+    /// of the interval, and return `false` otherwise.  The behavior is
+    /// undefined unless `hasLimits()`.
+    bool computeWindow(int* maxMessages,
+                       int* maxBytes,
+                       int  currentMessages,
+                       int  currentBytes);
+
+    // ACCESSORS
+
+    /// Return `true` if the limits have been set, and `false` otherwise.
+    bool hasLimits() const;
+
+    /// Return the highest message window this object may compute.
+    int messagesLimit() const;
+
+    /// Return the highest bytes window this object may compute.
+    int bytesLimit() const;
+
+    /// Return the number of messages received and not yet confirmed.
+    bsls::Types::Int64 numInFlight() const;
+
+    /// Format this object to the specified output `stream` at the (absolute
+    /// value of) the optionally specified indentation `level` and return a
+    /// reference to `stream`.  If `level` is specified, optionally specify
+    /// `spacesPerLevel`, the number of spaces per indentation level for
+    /// this and all of its nested objects.  If `level` is negative,
+    /// suppress indentation of the first line.  If `spacesPerLevel` is
+    /// negative format the entire output on one line, suppressing all but
+    /// the initial indentation (as governed by `level`).  If `stream` is
+    /// not valid on entry, this operation has no effect.
+    bsl::ostream&
+    print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
+};
+
+// FREE OPERATORS
+
+/// Format the specified `rhs` to the specified output `stream` and return a
+/// reference to the modifiable `stream`.
+bsl::ostream& operator<<(bsl::ostream& stream, const FlowControlMonitor& rhs);
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ------------------------
+// class FlowControlMonitor
+// ------------------------
+
+// MANIPULATORS
+inline void FlowControlMonitor::onPush(int numBytes)
+{
+    ++d_numInFlight;
+    ++d_numPushed;
+    d_numPushedBytes += numBytes;
+
+    if (d_numInFlight > d_maxInFlight) {
+        d_maxInFlight = d_numInFlight;
+    }
+}
+
+inline void FlowControlMonitor::onConfirm(int numMessages)
+{
+    d_numConfirmed += numMessages;
+
+    // Confirmations of messages received before the last 'reset' are not
+    // accounted for in 'd_numInFlight'.
+    d_numInFlight = d_numInFlight > numMessages ? d_numInFlight - numMessages
+                                                : 0;
+
+    if (d_numInFlight < d_minInFlight) {
+        d_minInFlight = d_numInFlight;
+    }
+}
+
+// ACCESSORS
+inline bool FlowControlMonitor::hasLimits() const
+{
+    return d_messagesLimit != 0;
+}
+
+inline int FlowControlMonitor::messagesLimit() const
+{
+    return d_messagesLimit;
+}
+
+inline int FlowControlMonitor::bytesLimit() const
+{
+    return d_bytesLimit;
+}
+
+inline bsls::Types::Int64 FlowControlMonitor::numInFlight() const
+{
+    return d_numInFlight;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline bsl::ostream&
+bmqimp::operator<<(bsl::ostream&                     stream,
+                   const bmqimp::FlowControlMonitor& rhs)
+{
+    return rhs.print(stream, 0, -1);
+}
+
+}  // close enterprise namespace
+
+#endif
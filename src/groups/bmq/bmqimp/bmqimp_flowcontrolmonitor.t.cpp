@@ -0,0 +1,291 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqimp_flowcontrolmonitor.t.cpp                                    -*-C++-*-
+#include <bmqimp_flowcontrolmonitor.h>
+
+// MWC
+#include <mwcu_memoutstream.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   1. A default constructed object has no limits and no in-flight
+//      messages.
+//   2. Pushes and confirms update the number of in-flight messages, which
+//      never becomes negative.
+//   3. 'reset' forgets the in-flight messages but keeps the limits.
+//
+// Testing:
+//   FlowControlMonitor()
+//   setLimits
+//   onPush
+//   onConfirm
+//   reset
+//   print
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    bmqimp::FlowControlMonitor obj;
+    ASSERT(!obj.hasLimits());
+    ASSERT_EQ(obj.numInFlight(), 0);
+
+    obj.setLimits(1000, 1024 * 1024);
+    ASSERT(obj.hasLimits());
+    ASSERT_EQ(obj.messagesLimit(), 1000);
+    ASSERT_EQ(obj.bytesLimit(), 1024 * 1024);
+
+    obj.onPush(100);
+    obj.onPush(100);
+    obj.onPush(100);
+    ASSERT_EQ(obj.numInFlight(), 3);
+
+    obj.onConfirm(2);
+    ASSERT_EQ(obj.numInFlight(), 1);
+
+    // Confirmation of messages received before a reset
+    obj.onConfirm(5);
+    ASSERT_EQ(obj.numInFlight(), 0);
+
+    obj.onPush(100);
+    obj.reset();
+    ASSERT_EQ(obj.numInFlight(), 0);
+    ASSERT(obj.hasLimits());
+    ASSERT_EQ(obj.messagesLimit(), 1000);
+
+    mwcu::MemOutStream os(s_allocator_p);
+    os << obj;
+    PVV(os.str());
+    ASSERT_NE(os.str().find("messagesLimit = 1000"), bsl::string::npos);
+}
+
+static void test2_starvedConsumer()
+// ------------------------------------------------------------------------
+// STARVED CONSUMER
+//
+// Concerns:
+//   1. The window of a consumer draining all its messages while using its
+//      window is doubled, up to the configured limits.
+//   2. The window of a consumer receiving a trickle of messages is not
+//      changed.
+//   3. No change is reported without enough confirmations.
+//
+// Testing:
+//   computeWindow
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("STARVED CONSUMER");
+
+    const int k_MSG_SIZE = 1000;
+
+    int maxMessages = 0;
+    int maxBytes    = 0;
+
+    {
+        PV("Not enough confirmations");
+
+        bmqimp::FlowControlMonitor obj;
+        obj.setLimits(1000, 32 * 1024 * 1024);
+
+        for (int i = 0; i < bmqimp::FlowControlMonitor::k_MIN_CONFIRMS - 1;
+             ++i) {
+            obj.onPush(k_MSG_SIZE);
+        }
+        obj.onConfirm(bmqimp::FlowControlMonitor::k_MIN_CONFIRMS - 1);
+
+        ASSERT(!obj.computeWindow(&maxMessages, &maxBytes, 50, 1024 * 1024));
+    }
+
+    {
+        PV("Starved by the window");
+
+        bmqimp::FlowControlMonitor obj;
+        obj.setLimits(300, 32 * 1024 * 1024);
+
+        int window = 100;
+        for (int round = 0; round < 3; ++round) {
+            // A full window is received, then confirmed
+            for (int i = 0; i < window; ++i) {
+                obj.onPush(k_MSG_SIZE);
+            }
+            obj.onConfirm(window);
+
+            const bool changed =
+                obj.computeWindow(&maxMessages, &maxBytes, window, 0);
+
+            PVV("Round " << round << ": " << changed << ", " << maxMessages
+                         << ", " << maxBytes);
+
+            if (round < 2) {
+                ASSERT(changed);
+                ASSERT_EQ(maxMessages, bsl::min(2 * window, 300));
+                ASSERT_EQ(maxBytes, 2 * maxMessages * k_MSG_SIZE);
+                window = maxMessages;
+            }
+            else {
+                // The limit is reached
+                ASSERT_EQ(window, 300);
+                ASSERT(!changed);
+            }
+        }
+    }
+
+    {
+        PV("Trickle of messages");
+
+        bmqimp::FlowControlMonitor obj;
+        obj.setLimits(1000, 32 * 1024 * 1024);
+
+        for (int i = 0; i < 100; ++i) {
+            obj.onPush(k_MSG_SIZE);
+            obj.onConfirm(1);
+        }
+
+        ASSERT(!obj.computeWindow(&maxMessages, &maxBytes, 100, 1024 * 1024));
+    }
+}
+
+static void test3_backloggedConsumer()
+// ------------------------------------------------------------------------
+// BACKLOGGED CONSUMER
+//
+// Concerns:
+//   1. The window of a consumer having a standing backlog of messages is
+//      reduced by half of the backlog, down to 'k_MIN_MESSAGES'.
+//   2. A small standing backlog does not change the window.
+//   3. The bytes window follows the message window, within the limits.
+//
+// Testing:
+//   computeWindow
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BACKLOGGED CONSUMER");
+
+    const int k_MSG_SIZE = 100;
+
+    int maxMessages = 0;
+    int maxBytes    = 0;
+
+    {
+        PV("Standing backlog");
+
+        bmqimp::FlowControlMonitor obj;
+        obj.setLimits(1000, 32 * 1024 * 1024);
+
+        // Fill the window, then start a new interval
+        for (int i = 0; i < 1000; ++i) {
+            obj.onPush(k_MSG_SIZE);
+        }
+        ASSERT(!obj.computeWindow(&maxMessages, &maxBytes, 1000, 0));
+
+        // Each confirmation is immediately replaced by a new message
+        for (int i = 0; i < 100; ++i) {
+            obj.onConfirm(1);
+            obj.onPush(k_MSG_SIZE);
+        }
+
+        ASSERT(obj.computeWindow(&maxMessages, &maxBytes, 1000, 0));
+        ASSERT_EQ(maxMessages, 1000 - 999 / 2);
+
+        // The bytes window follows the message window
+        ASSERT_EQ(maxBytes, 2 * maxMessages * k_MSG_SIZE);
+    }
+
+    {
+        PV("Lower bounds");
+
+        bmqimp::FlowControlMonitor obj;
+        obj.setLimits(1000, 32 * 1024 * 1024);
+
+        for (int i = 0; i < 40; ++i) {
+            obj.onPush(k_MSG_SIZE);
+        }
+        ASSERT(!obj.computeWindow(&maxMessages, &maxBytes, 40, 0));
+
+        for (int i = 0; i < 40; ++i) {
+            obj.onConfirm(1);
+            obj.onPush(k_MSG_SIZE);
+        }
+
+        ASSERT(obj.computeWindow(&maxMessages, &maxBytes, 40, 0));
+        ASSERT_EQ(maxMessages, 40 - 39 / 2);
+        ASSERT_EQ(maxBytes, bmqimp::FlowControlMonitor::k_MIN_BYTES);
+
+        for (int i = 0; i < 40; ++i) {
+            obj.onConfirm(1);
+            obj.onPush(k_MSG_SIZE);
+        }
+
+        // The window is never lower than 'k_MIN_MESSAGES'
+        ASSERT(obj.computeWindow(&maxMessages, &maxBytes, 30, 0));
+        ASSERT_EQ(maxMessages, bmqimp::FlowControlMonitor::k_MIN_MESSAGES);
+    }
+
+    {
+        PV("Small backlog");
+
+        bmqimp::FlowControlMonitor obj;
+        obj.setLimits(1000, 32 * 1024 * 1024);
+
+        for (int i = 0; i < 10; ++i) {
+            obj.onPush(k_MSG_SIZE);
+        }
+        ASSERT(!obj.computeWindow(&maxMessages, &maxBytes, 1000, 0));
+
+        for (int i = 0; i < 100; ++i) {
+            obj.onConfirm(1);
+            obj.onPush(k_MSG_SIZE);
+        }
+
+        // A backlog of 9 messages is lower than 1/8th of the window
+        ASSERT(!obj.computeWindow(&maxMessages, &maxBytes, 1000, 0));
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_backloggedConsumer(); break;
+    case 2: test2_starvedConsumer(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
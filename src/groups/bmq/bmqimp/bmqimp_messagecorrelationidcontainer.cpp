@@ -24,11 +24,52 @@
 #include <bmqp_queueid.h>
 
 // BDE
+#include <bslh_hash.h>
+#include <bsls_assert.h>
 #include <bsls_performancehint.h>
 
 namespace BloombergLP {
 namespace bmqimp {
 
+namespace {
+
+// ====================
+// class AllShardsGuard
+// ====================
+
+/// Guard locking all the specified shards, in order, upon construction and
+/// unlocking them upon destruction.
+template <class SHARDS>
+class AllShardsGuard {
+  private:
+    // DATA
+    const SHARDS& d_shards;
+
+  private:
+    // NOT IMPLEMENTED
+    AllShardsGuard(const AllShardsGuard&) BSLS_CPP11_DELETED;
+    AllShardsGuard& operator=(const AllShardsGuard&) BSLS_CPP11_DELETED;
+
+  public:
+    // CREATORS
+    explicit AllShardsGuard(const SHARDS& shards)
+    : d_shards(shards)
+    {
+        for (size_t i = 0; i < d_shards.size(); ++i) {
+            d_shards[i]->d_lock.lock();  // LOCK
+        }
+    }
+
+    ~AllShardsGuard()
+    {
+        for (size_t i = d_shards.size(); i > 0; --i) {
+            d_shards[i - 1]->d_lock.unlock();  // UNLOCK
+        }
+    }
+};
+
+}  // close unnamed namespace
+
 // ----------------------------------------------------------
 // class MessageCorrelationIdContainer::QueueAndCorrelationId
 // ----------------------------------------------------------
@@ -39,6 +80,8 @@ MessageCorrelationIdContainer::QueueAndCorrelationId::QueueAndCorrelationId(
 , d_queueId(bmqp::QueueId::k_UNASSIGNED_QUEUE_ID)
 , d_messageType(bmqp::EventType::e_UNDEFINED)
 , d_messageData(allocator)
+, d_sequenceNumber(0)
+, d_sentTime()
 {
     // NOTHING
 }
@@ -51,6 +94,8 @@ MessageCorrelationIdContainer::QueueAndCorrelationId::QueueAndCorrelationId(
 , d_queueId(queueId)
 , d_messageType(bmqp::EventType::e_UNDEFINED)
 , d_messageData(allocator)
+, d_sequenceNumber(0)
+, d_sentTime()
 {
     // NOTHING
 }
@@ -63,15 +108,62 @@ MessageCorrelationIdContainer::QueueAndCorrelationId::QueueAndCorrelationId(
 , d_messageType(other.d_messageType)
 , d_messageData(other.d_messageData, allocator)
 , d_requestContext(other.d_requestContext)
+, d_sequenceNumber(other.d_sequenceNumber)
+, d_sentTime(other.d_sentTime)
 {
     // NOTHING
 }
 
-// -----------------------------------
-// class MessageCorrelationIdContainer
-// -----------------------------------
+// ------------------------------------------
+// class MessageCorrelationIdContainer::Shard
+// ------------------------------------------
+
+MessageCorrelationIdContainer::Shard::Shard(bslma::Allocator* allocator)
+: d_lock(bsls::SpinLock::s_unlocked)
+, d_correlationIds(allocator)
+, d_queueItems(allocator)
+, d_numPuts(0)
+, d_numControls(0)
+{
+    // NOTHING
+}
 
-void MessageCorrelationIdContainer::addQueueItem(
+void MessageCorrelationIdContainer::Shard::clear()
+{
+    d_numPuts     = 0;
+    d_numControls = 0;
+    d_correlationIds.clear();
+    d_queueItems.clear();
+}
+
+MessageCorrelationIdContainer::CorrelationIdsMap::const_iterator
+MessageCorrelationIdContainer::Shard::removeLocked(
+    const CorrelationIdsMap::const_iterator& cit)
+{
+    BSLS_ASSERT_SAFE(cit != d_correlationIds.end());
+
+    if (cit->second.d_messageType == bmqp::EventType::e_PUT) {
+        BSLS_ASSERT_SAFE(d_numPuts > 0);
+        --d_numPuts;
+        const bool isAckRequested = bmqp::PutHeaderFlagUtil::isSet(
+            cit->second.d_header.flags(),
+            bmqp::PutHeaderFlags::e_ACK_REQUESTED);
+        if (isAckRequested) {
+            removeQueueItem(cit->second.d_queueId, cit->first);
+        }
+    }
+    else if (cit->second.d_messageType == bmqp::EventType::e_CONTROL) {
+        BSLS_ASSERT_SAFE(d_numControls > 0);
+        BSLS_ASSERT_SAFE(cit->second.d_requestContext);
+
+        cit->second.d_requestContext->adoptUserData(bdld::Datum::createNull());
+        --d_numControls;
+    }
+
+    return d_correlationIds.erase(cit);
+}
+
+void MessageCorrelationIdContainer::Shard::addQueueItem(
     const bmqp::QueueId&      queueId,
     const bmqt::MessageGUID&  itemGUID,
     const bsls::TimeInterval& sentTime)
@@ -79,7 +171,7 @@ void MessageCorrelationIdContainer::addQueueItem(
     d_queueItems[queueId].insert(bsl::make_pair(itemGUID, sentTime));
 }
 
-void MessageCorrelationIdContainer::removeQueueItem(
+void MessageCorrelationIdContainer::Shard::removeQueueItem(
     const bmqp::QueueId&     queueId,
     const bmqt::MessageGUID& itemGUID)
 {
@@ -99,25 +191,64 @@ void MessageCorrelationIdContainer::removeQueueItem(
     }
 }
 
+// -----------------------------------
+// class MessageCorrelationIdContainer
+// -----------------------------------
+
+// PRIVATE MANIPULATORS
+MessageCorrelationIdContainer::Shard&
+MessageCorrelationIdContainer::shardFor(const bmqt::MessageGUID& key)
+{
+    bslh::Hash<bmqt::MessageGUIDHashAlgo> hasher;
+    return *d_shards[hasher(key) % d_shards.size()];
+}
+
+void MessageCorrelationIdContainer::insertLocked(
+    Shard*                       shard,
+    const bmqt::MessageGUID&     key,
+    const QueueAndCorrelationId& item)
+{
+    // Assigning the sequence number while holding the shard's lock guarantees
+    // that the items of every shard are ordered by their sequence number,
+    // which 'iterateAndInvoke' relies upon to merge the shards.
+    bsl::pair<CorrelationIdsMap::iterator, bool> rc =
+        shard->d_correlationIds.insert(bsl::make_pair(key, item));
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(rc.second)) {
+        rc.first->second.d_sequenceNumber = d_nextSequenceNumber.add(1);
+    }
+}
+
+// PRIVATE ACCESSORS
+const MessageCorrelationIdContainer::Shard&
+MessageCorrelationIdContainer::shardFor(const bmqt::MessageGUID& key) const
+{
+    bslh::Hash<bmqt::MessageGUIDHashAlgo> hasher;
+    return *d_shards[hasher(key) % d_shards.size()];
+}
+
+// CREATORS
 MessageCorrelationIdContainer::MessageCorrelationIdContainer(
     bslma::Allocator* allocator)
-: d_lock(bsls::SpinLock::s_unlocked)
-, d_correlationIds(allocator)
-, d_queueItems(allocator)
-, d_numPuts(0)
-, d_numControls(0)
+: d_shards(allocator)
+, d_nextSequenceNumber(0)
 , d_allocator_p(allocator)
 {
-    // NOTHING
+    d_shards.reserve(k_NUM_SHARDS);
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        ShardSp shard;
+        shard.createInplace(d_allocator_p, d_allocator_p);
+        d_shards.push_back(shard);
+    }
 }
 
+// MANIPULATORS
 void MessageCorrelationIdContainer::reset()
 {
-    bsls::SpinLockGuard guard(&d_lock);  // LOCK
-    d_numPuts     = 0;
-    d_numControls = 0;
-    d_correlationIds.clear();
-    d_queueItems.clear();
+    AllShardsGuard<bsl::vector<ShardSp> > guard(d_shards);  // LOCK
+
+    for (size_t i = 0; i < d_shards.size(); ++i) {
+        d_shards[i]->clear();
+    }
 }
 
 void MessageCorrelationIdContainer::add(
@@ -125,10 +256,12 @@ void MessageCorrelationIdContainer::add(
     const bmqt::CorrelationId& correlationId,
     const bmqp::QueueId&       queueId)
 {
-    bsls::SpinLockGuard guard(&d_lock);  // LOCK
-
     QueueAndCorrelationId toInsert(correlationId, queueId, d_allocator_p);
-    d_correlationIds.insert(bsl::make_pair(key, toInsert));
+
+    Shard&              shard = shardFor(key);
+    bsls::SpinLockGuard guard(&shard.d_lock);  // LOCK
+
+    insertLocked(&shard, key, toInsert);
 }
 
 bmqt::MessageGUID MessageCorrelationIdContainer::add(
@@ -136,8 +269,6 @@ bmqt::MessageGUID MessageCorrelationIdContainer::add(
     const bmqp::QueueId&                 queueId,
     const bdlbb::Blob&                   blob)
 {
-    bsls::SpinLockGuard guard(&d_lock);  // LOCK
-
     QueueAndCorrelationId toInsert(d_allocator_p);
     toInsert.d_messageType    = bmqp::EventType::e_CONTROL;
     toInsert.d_requestContext = context;
@@ -146,46 +277,26 @@ bmqt::MessageGUID MessageCorrelationIdContainer::add(
 
     // Use internal GUID as a key to add the control message
     bmqt::MessageGUID key = bmqp::MessageGUIDGenerator::testGUID();
-    d_correlationIds.insert(bsl::make_pair(key, toInsert));
-    ++d_numControls;
 
-    return key;
-}
+    Shard&              shard = shardFor(key);
+    bsls::SpinLockGuard guard(&shard.d_lock);  // LOCK
 
-MessageCorrelationIdContainer::CorrelationIdsMap::const_iterator
-MessageCorrelationIdContainer::removeLocked(
-    const CorrelationIdsMap::const_iterator& cit)
-{
-    BSLS_ASSERT_SAFE(cit != d_correlationIds.end());
+    insertLocked(&shard, key, toInsert);
+    ++shard.d_numControls;
 
-    if (cit->second.d_messageType == bmqp::EventType::e_PUT) {
-        BSLS_ASSERT_SAFE(d_numPuts > 0);
-        --d_numPuts;
-        const bool isAckRequested = bmqp::PutHeaderFlagUtil::isSet(
-            cit->second.d_header.flags(),
-            bmqp::PutHeaderFlags::e_ACK_REQUESTED);
-        if (isAckRequested) {
-            removeQueueItem(cit->second.d_queueId, cit->first);
-        }
-    }
-    else if (cit->second.d_messageType == bmqp::EventType::e_CONTROL) {
-        BSLS_ASSERT_SAFE(d_numControls > 0);
-        BSLS_ASSERT_SAFE(cit->second.d_requestContext);
-
-        cit->second.d_requestContext->adoptUserData(bdld::Datum::createNull());
-        --d_numControls;
-    }
-
-    return d_correlationIds.erase(cit);
+    return key;
 }
 
 int MessageCorrelationIdContainer::remove(const bmqt::MessageGUID& key,
-                                          bmqt::CorrelationId* correlationId)
+                                          bmqt::CorrelationId* correlationId,
+                                          bsls::TimeInterval*  sentTime)
 {
-    bsls::SpinLockGuard guard(&d_lock);  // LOCK
+    Shard&              shard = shardFor(key);
+    bsls::SpinLockGuard guard(&shard.d_lock);  // LOCK
 
-    CorrelationIdsMap::const_iterator cit = d_correlationIds.find(key);
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_correlationIds.end() == cit)) {
+    CorrelationIdsMap::const_iterator cit = shard.d_correlationIds.find(key);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(shard.d_correlationIds.end() ==
+                                              cit)) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
         return -1;  // RETURN
     }
@@ -193,8 +304,11 @@ int MessageCorrelationIdContainer::remove(const bmqt::MessageGUID& key,
     if (correlationId) {
         *correlationId = cit->second.d_correlationId;
     }
+    if (sentTime) {
+        *sentTime = cit->second.d_sentTime;
+    }
 
-    removeLocked(cit);
+    shard.removeLocked(cit);
 
     return 0;
 }
@@ -204,11 +318,13 @@ void MessageCorrelationIdContainer::associateMessageData(
     const bdlbb::Blob&        appData,
     const bsls::TimeInterval& sentTime)
 {
-    bsls::SpinLockGuard guard(&d_lock);  // LOCK
+    Shard&              shard = shardFor(header.messageGUID());
+    bsls::SpinLockGuard guard(&shard.d_lock);  // LOCK
 
-    CorrelationIdsMap::iterator it = d_correlationIds.find(
+    CorrelationIdsMap::iterator it = shard.d_correlationIds.find(
         header.messageGUID());
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(it == d_correlationIds.end())) {
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(it ==
+                                              shard.d_correlationIds.end())) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
         BSLS_ASSERT_SAFE(false && "Key not found");
         return;  // RETURN
@@ -218,7 +334,8 @@ void MessageCorrelationIdContainer::associateMessageData(
     it->second.d_header      = header;
     it->second.d_messageData = appData;
     it->second.d_queueId     = qid;
-    ++d_numPuts;
+    it->second.d_sentTime    = sentTime;
+    ++shard.d_numPuts;
 
     const bool isAckRequested = bmqp::PutHeaderFlagUtil::isSet(
         header.flags(),
@@ -226,20 +343,44 @@ void MessageCorrelationIdContainer::associateMessageData(
 
     if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(isAckRequested)) {
         // Add a per queue item with sending timestamp
-        addQueueItem(it->second.d_queueId, header.messageGUID(), sentTime);
+        shard.addQueueItem(it->second.d_queueId,
+                           header.messageGUID(),
+                           sentTime);
     }
 }
 
 bool MessageCorrelationIdContainer::iterateAndInvoke(const KeyIdsCb& callback)
 {
-    bsls::SpinLockGuard guard(&d_lock);  // LOCK
+    AllShardsGuard<bsl::vector<ShardSp> > guard(d_shards);  // LOCK
+
+    // Items of each shard are ordered by their sequence number, so visit them
+    // in insertion order by repeatedly picking the shard whose next item has
+    // the smallest sequence number.
+    CorrelationIdsMap::const_iterator cits[k_NUM_SHARDS];
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        cits[i] = d_shards[i]->d_correlationIds.begin();
+    }
 
-    CorrelationIdsMap::const_iterator cit = d_correlationIds.begin();
-    while (cit != d_correlationIds.end()) {
-        bool       removeItem = false;
-        const bool interrupt  = callback(&removeItem, cit->first, cit->second);
+    while (true) {
+        int next = -1;
+        for (int i = 0; i < k_NUM_SHARDS; ++i) {
+            if (cits[i] == d_shards[i]->d_correlationIds.end()) {
+                continue;  // CONTINUE
+            }
+            if (next == -1 || cits[i]->second.d_sequenceNumber <
+                                  cits[next]->second.d_sequenceNumber) {
+                next = i;
+            }
+        }
+        if (next == -1) {
+            break;  // BREAK
+        }
+
+        CorrelationIdsMap::const_iterator& cit        = cits[next];
+        bool                               removeItem = false;
+        const bool interrupt = callback(&removeItem, cit->first, cit->second);
         if (removeItem) {
-            cit = removeLocked(cit);
+            cit = d_shards[next]->removeLocked(cit);
         }
         else {
             ++cit;
@@ -256,12 +397,14 @@ bool MessageCorrelationIdContainer::iterateAndInvoke(
     const bsl::vector<bmqt::MessageGUID>& keys,
     const KeyIdsCb&                       callback)
 {
-    bsls::SpinLockGuard guard(&d_lock);  // LOCK
-
     for (size_t i = 0; i < keys.size(); ++i) {
-        CorrelationIdsMap::const_iterator cit = d_correlationIds.find(keys[i]);
-        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(cit ==
-                                                  d_correlationIds.end())) {
+        Shard&              shard = shardFor(keys[i]);
+        bsls::SpinLockGuard guard(&shard.d_lock);  // LOCK
+
+        CorrelationIdsMap::const_iterator cit = shard.d_correlationIds.find(
+            keys[i]);
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                cit == shard.d_correlationIds.end())) {
             BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
             BSLS_ASSERT_SAFE(false && "Key not found");
             continue;  // CONTINUE
@@ -269,7 +412,7 @@ bool MessageCorrelationIdContainer::iterateAndInvoke(
         bool       removeItem = false;
         const bool interrupt  = callback(&removeItem, cit->first, cit->second);
         if (removeItem) {
-            removeLocked(cit);
+            shard.removeLocked(cit);
         }
         if (interrupt) {
             return false;  // RETURN
@@ -285,68 +428,76 @@ bsls::TimeInterval MessageCorrelationIdContainer::getExpiredIds(
 {
     BSLS_ASSERT_SAFE(keys);
 
-    bsls::SpinLockGuard guard(&d_lock);  // LOCK
-
     bsls::TimeInterval minTs(0);
-    // Iterate over each queue
-    for (QueueItemsMap::iterator qit = d_queueItems.begin();
-         qit != d_queueItems.end();
-         ++qit) {
-        // Get the queue expiration timeout
-        const int                                    qId = qit->first.id();
-        bsl::unordered_map<int, int>::const_iterator cit =
-            queueExpirationTimeoutMap.find(qId);
-
-        // If queueId is absent in the queue timeout map that means this queue
-        // is no longer opened. All its pending messages should be removed, so
-        // add them to the expired list.
-        const bool isOrphan = cit == queueExpirationTimeoutMap.end();
-        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(isOrphan)) {
-            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-            for (HandleAndExpirationTimeMap::iterator hit =
-                     qit->second.begin();
-                 hit != qit->second.end();
-                 ++hit) {
-                keys->push_back(hit->first);
-            }
-            continue;  // CONTINUE
-        }
 
-        const int queueTimeoutMs = cit->second;
+    for (size_t s = 0; s < d_shards.size(); ++s) {
+        Shard&              shard = *d_shards[s];
+        bsls::SpinLockGuard guard(&shard.d_lock);  // LOCK
+
+        // Iterate over each queue
+        for (QueueItemsMap::iterator qit = shard.d_queueItems.begin();
+             qit != shard.d_queueItems.end();
+             ++qit) {
+            // Get the queue expiration timeout
+            const int                                    qId = qit->first.id();
+            bsl::unordered_map<int, int>::const_iterator cit =
+                queueExpirationTimeoutMap.find(qId);
+
+            // If queueId is absent in the queue timeout map that means this
+            // queue is no longer opened. All its pending messages should be
+            // removed, so add them to the expired list.
+            const bool isOrphan = cit == queueExpirationTimeoutMap.end();
+            if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(isOrphan)) {
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+                for (HandleAndExpirationTimeMap::iterator hit =
+                         qit->second.begin();
+                     hit != qit->second.end();
+                     ++hit) {
+                    keys->push_back(hit->first);
+                }
+                continue;  // CONTINUE
+            }
 
-        BSLS_ASSERT_SAFE(queueTimeoutMs > 0);
+            const int queueTimeoutMs = cit->second;
 
-        // Iterate over queue items (PUT message keys and timestamps)
-        for (HandleAndExpirationTimeMap::iterator hit = qit->second.begin();
-             hit != qit->second.end();
-             ++hit) {
-            // Calculate message expiration time (sentTime + queueTimeout)
-            bsls::TimeInterval messageTimeout = hit->second;
-            messageTimeout.addMilliseconds(queueTimeoutMs);
+            BSLS_ASSERT_SAFE(queueTimeoutMs > 0);
 
-            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(messageTimeout >
-                                                    expirationTime)) {
-                // No more expired items in the current queue.  Check the next
-                // expiration time.
-                if ((minTs == 0) || (minTs > messageTimeout)) {
-                    minTs = messageTimeout;
+            // Iterate over queue items (PUT message keys and timestamps)
+            for (HandleAndExpirationTimeMap::iterator hit =
+                     qit->second.begin();
+                 hit != qit->second.end();
+                 ++hit) {
+                // Calculate message expiration time (sentTime + queueTimeout)
+                bsls::TimeInterval messageTimeout = hit->second;
+                messageTimeout.addMilliseconds(queueTimeoutMs);
+
+                if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(messageTimeout >
+                                                        expirationTime)) {
+                    // No more expired items in the current queue.  Check the
+                    // next expiration time.
+                    if ((minTs == 0) || (minTs > messageTimeout)) {
+                        minTs = messageTimeout;
+                    }
+                    break;  // BREAK
                 }
-                break;  // BREAK
+                keys->push_back(hit->first);
             }
-            keys->push_back(hit->first);
         }
     }
 
     return minTs;
 }
 
+// ACCESSORS
 int MessageCorrelationIdContainer::find(bmqt::CorrelationId*     correlationId,
                                         const bmqt::MessageGUID& key) const
 {
-    bsls::SpinLockGuard guard(&d_lock);  // LOCK
+    const Shard&        shard = shardFor(key);
+    bsls::SpinLockGuard guard(&shard.d_lock);  // LOCK
 
-    CorrelationIdsMap::const_iterator cit = d_correlationIds.find(key);
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_correlationIds.end() == cit)) {
+    CorrelationIdsMap::const_iterator cit = shard.d_correlationIds.find(key);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(shard.d_correlationIds.end() ==
+                                              cit)) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
         return -1;  // RETURN
     }
@@ -355,5 +506,32 @@ int MessageCorrelationIdContainer::find(bmqt::CorrelationId*     correlationId,
     return 0;
 }
 
+size_t MessageCorrelationIdContainer::size() const
+{
+    size_t result = 0;
+    for (size_t i = 0; i < d_shards.size(); ++i) {
+        result += d_shards[i]->d_correlationIds.size();
+    }
+    return result;
+}
+
+size_t MessageCorrelationIdContainer::numberOfPuts() const
+{
+    size_t result = 0;
+    for (size_t i = 0; i < d_shards.size(); ++i) {
+        result += d_shards[i]->d_numPuts;
+    }
+    return result;
+}
+
+size_t MessageCorrelationIdContainer::numberOfControls() const
+{
+    size_t result = 0;
+    for (size_t i = 0; i < d_shards.size(); ++i) {
+        result += d_shards[i]->d_numControls;
+    }
+    return result;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -29,6 +29,13 @@
 // is returned which can be used later on to assign the 'queueId' as well as
 // retrieve and remove the 'correlationId'.
 //
+// Items are spread over a fixed number of independently locked shards, chosen
+// by hashing the message GUID, so that concurrent producers posting messages
+// rarely contend on the same lock.  Every item is stamped with a sequence
+// number upon insertion, which allows iterating over the whole container in
+// insertion order (so that local NAKs are generated in the order in which PUTs
+// were posted) even though the items are stored in different shards.
+//
 /// Thread Safety
 ///-------------
 // Thread safe.
@@ -45,11 +52,17 @@
 
 // BDE
 #include <bsl_functional.h>
+#include <bsl_memory.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_atomic.h>
 #include <bsls_cpp11.h>
 #include <bsls_spinlock.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 namespace bmqimp {
@@ -88,6 +101,14 @@ class MessageCorrelationIdContainer {
         RequestManagerType::RequestSp d_requestContext;
         // Control request context.
 
+        bsls::Types::Uint64 d_sequenceNumber;
+        // Insertion order of the item in the
+        // container.
+
+        bsls::TimeInterval d_sentTime;
+        // Time the PUT message was sent, as
+        // provided to 'associateMessageData'.
+
         /// Create a `QueueAndCorrelationId` having an invalid queueId and
         /// empty correlationId using the specified `allocator`.
         QueueAndCorrelationId(bslma::Allocator* allocator);
@@ -126,53 +147,107 @@ class MessageCorrelationIdContainer {
     typedef bsl::unordered_map<bmqp::QueueId, HandleAndExpirationTimeMap>
         QueueItemsMap;
 
-    mutable bsls::SpinLock d_lock;  // Spin lock for manipulating data
-                                    // members
+    /// Set of items stored under a dedicated lock.
+    struct Shard {
+        // DATA
+        mutable bsls::SpinLock d_lock;
+        // Spin lock for manipulating data
+        // members of this shard.
+
+        CorrelationIdsMap d_correlationIds;
+        // Map of registered items.
+
+        QueueItemsMap d_queueItems;
+        // Per queue message Ids with
+        // timestamps.
+
+        size_t d_numPuts;
+        // Number of pending PUT messages.
+
+        size_t d_numControls;
+        // Number of pending control
+        // requests.
+
+        // CREATORS
+
+        /// Create an empty shard using the specified `allocator`.
+        explicit Shard(bslma::Allocator* allocator);
+
+        // MANIPULATORS
+
+        /// Remove all items from this shard.  The caller must acquire the
+        /// `d_lock` before calling this method.
+        void clear();
+
+        /// Remove the item pointed by the specifed `cit` from the
+        /// `d_correlationIds`.  If the item is PUT message with
+        /// `ACK_REQUESTED` flag also remove related item from the
+        /// `d_queueItems` container.  Decrement `d_numPuts` or
+        /// `d_numControls` counter depending on the item's type.  Return a
+        /// constant iterator pointing to the next valid item from the
+        /// `d_correlationIds` container or its `end` iterator.  The caller
+        /// must acquire the `d_lock` before calling this method.  The
+        /// behavior is underfined if the `cit` doesn't point to a valid
+        /// item.
+        CorrelationIdsMap::const_iterator
+        removeLocked(const CorrelationIdsMap::const_iterator& cit);
+
+        /// Add an item into `d_queueItems` map using the specified
+        /// `queueId` as a key and the specified `itemGUID` and
+        /// `expirationTime` as a value pair.
+        void addQueueItem(const bmqp::QueueId&      queueId,
+                          const bmqt::MessageGUID&  itemGUID,
+                          const bsls::TimeInterval& expirationTime);
+
+        /// Remove an item from the `d_queueItems` container using the
+        /// specified `queueId` as a key to find the per queue items map and
+        /// then remove an item using the specified `itemGUID` as a key of
+        /// that second map.  If the removed item is the last one in the
+        /// items map then also remove the entry from the first map that has
+        /// the `queueId` as a key.  The behavior is underfined if there is
+        /// no item with `queueId` key in the first map or with `itemGUID` in
+        /// the second map.
+        void removeQueueItem(const bmqp::QueueId&     queueId,
+                             const bmqt::MessageGUID& itemGUID);
+    };
 
-    CorrelationIdsMap d_correlationIds;
-    // Map of all registered items.
+    typedef bsl::shared_ptr<Shard> ShardSp;
 
-    QueueItemsMap d_queueItems;
-    // Per queue message Ids with
-    // timestamps.
+    // PRIVATE CONSTANTS
+    static const int k_NUM_SHARDS = 16;
+    // Number of shards the items are
+    // spread over.
 
-    size_t d_numPuts;  // Number of pending PUT messages.
+    // DATA
+    bsl::vector<ShardSp> d_shards;
+    // Shards holding the items.
 
-    size_t d_numControls;
-    // Number of pending control requests.
+    bsls::AtomicUint64 d_nextSequenceNumber;
+    // Sequence number to assign to the
+    // next inserted item.
 
     bslma::Allocator* d_allocator_p;
     // Allocator to use.
 
   private:
-    /// Remove the item pointed by the specifed `cit` from the
-    /// `d_correlationIds`.  If the item is PUT message with `ACK_REQUESTED`
-    /// flag also remove related item from the `d_queueItems` container.
-    /// Decrement `d_numPuts` or `d_numControls` counter depending on the
-    /// item's type.  Return a constant iterator pointing to the next valid
-    /// item from the `d_correlationIds` container or its `end` iterator.
-    /// The caller must acquire the `d_lock` before calling this method.
-    /// The behavior is underfined if the `cit` doesn't point to a valid
-    /// item.
-    CorrelationIdsMap::const_iterator
-    removeLocked(const CorrelationIdsMap::const_iterator& cit);
-
-    /// Add an item into `d_queueItems` map using the specified `queueId` as
-    /// a key and the specified `itemGUID` and `expirationTime` as a value
-    /// pair.
-    void addQueueItem(const bmqp::QueueId&      queueId,
-                      const bmqt::MessageGUID&  itemGUID,
-                      const bsls::TimeInterval& expirationTime);
-
-    /// Remove an item from the `d_queueItems` container using the specified
-    /// `queueId` as a key to find the per queue items map and then remove
-    /// an item using the specified `itemGUID` as a key of that second map.
-    /// If the removed item is the last one in the items map then also
-    /// remove the entry from the first map that has the `queueId` as a key.
-    /// The behavior is underfined if there is no item with `queueId` key in
-    /// the first map or with `itemGUID` in the second map.
-    void removeQueueItem(const bmqp::QueueId&     queueId,
-                         const bmqt::MessageGUID& itemGUID);
+    // PRIVATE MANIPULATORS
+
+    /// Return a reference to the shard responsible for the item having the
+    /// specified `key`.
+    Shard& shardFor(const bmqt::MessageGUID& key);
+
+    /// Insert the specified `item` with the specified `key` into the
+    /// specified `shard`, stamping it with the next sequence number.  The
+    /// caller must acquire the lock of `shard` before calling this method.
+    void insertLocked(Shard*                       shard,
+                      const bmqt::MessageGUID&     key,
+                      const QueueAndCorrelationId& item);
+
+    // PRIVATE ACCESSORS
+
+    /// Return a reference offering non-modifiable access to the shard
+    /// responsible for the item having the specified `key`.
+    const Shard& shardFor(const bmqt::MessageGUID& key) const;
 
   private:
     // NOT IMPLEMENTED
@@ -211,10 +286,14 @@ class MessageCorrelationIdContainer {
 
     /// Remove the item uniquely identified by the specified `key`,
     /// and populate the optionally specified `correlationId` with the
-    /// removed correlationId.  Return zero on success, non-zero value
-    /// otherwise.
+    /// removed correlationId, and the optionally specified `sentTime` with
+    /// the time the removed item was sent if it is a PUT message (as
+    /// provided to `associateMessageData`), or a default constructed
+    /// `bsls::TimeInterval` otherwise.  Return zero on success, non-zero
+    /// value otherwise.
     int remove(const bmqt::MessageGUID& key,
-               bmqt::CorrelationId*     correlationId = 0);
+               bmqt::CorrelationId*     correlationId = 0,
+               bsls::TimeInterval*      sentTime      = 0);
 
     /// Associate the specified message data to the item having the key
     /// equals to the GUID from the specified PUT `header`.  The behavior is
@@ -252,7 +331,9 @@ class MessageCorrelationIdContainer {
     int find(bmqt::CorrelationId*     correlationId,
              const bmqt::MessageGUID& key) const;
 
-    /// Return the current number of elements in the container.
+    /// Return the current number of elements in the container.  Note that
+    /// the shards are not locked, so the result may be stale if the
+    /// container is concurrently modified.
     size_t size() const;
 
     /// Return the current number of PUT messages in the container.
@@ -262,29 +343,6 @@ class MessageCorrelationIdContainer {
     size_t numberOfControls() const;
 };
 
-// ============================================================================
-//                             INLINE DEFINITIONS
-// ============================================================================
-
-// -----------------------------------
-// class MessageCorrelationIdContainer
-// -----------------------------------
-
-inline size_t MessageCorrelationIdContainer::size() const
-{
-    return d_correlationIds.size();
-}
-
-inline size_t MessageCorrelationIdContainer::numberOfPuts() const
-{
-    return d_numPuts;
-}
-
-inline size_t MessageCorrelationIdContainer::numberOfControls() const
-{
-    return d_numControls;
-}
-
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -19,15 +19,19 @@
 // BMQ
 #include <bmqimp_queue.h>
 #include <bmqp_messageguidgenerator.h>
+#include <bmqp_protocol.h>
 #include <bmqt_correlationid.h>
 #include <bmqt_messageguid.h>
 
 // BDE
+#include <bdlbb_blob.h>
 #include <bdlf_bind.h>
 #include <bsl_functional.h>
 #include <bsl_unordered_map.h>
 #include <bsl_vector.h>
 #include <bslma_allocator.h>
+#include <bsls_annotation.h>
+#include <bsls_timeinterval.h>
 
 // TEST DRIVER
 #include <mwctst_testhelper.h>
@@ -75,6 +79,21 @@ struct IterateAndInvokeHelper {
 
         return false;  // do not interrupt
     }
+
+    /// Append the specified `handle` to the specified `handles`.  The
+    /// specified `deleteVisitedItem` relates to the item with the specified
+    /// `handle`.  It is always set to `false` in this visitor
+    /// implementation.
+    static bool appendKey(bsl::vector<bmqt::MessageGUID>* handles,
+                          bool*                           deleteVisitedItem,
+                          const bmqt::MessageGUID&        handle,
+                          BSLS_ANNOTATION_UNUSED const QAC& qac)
+    {
+        handles->push_back(handle);
+        *deleteVisitedItem = false;
+
+        return false;  // do not interrupt
+    }
 };
 
 // ============================================================================
@@ -213,6 +232,91 @@ static void test3_associate()
     }
 }
 
+static void test4_iterationOrder()
+{
+    mwctst::TestHelper::printTestName("ITERATION ORDER");
+
+    const int k_NUM_ITEMS = 256;
+
+    bmqimp::MessageCorrelationIdContainer container(s_allocator_p);
+    bsl::vector<bmqt::MessageGUID>        expected(s_allocator_p);
+    bsl::vector<bmqt::MessageGUID>        visited(s_allocator_p);
+
+    for (int i = 0; i < k_NUM_ITEMS; ++i) {
+        bmqt::MessageGUID guid = bmqp::MessageGUIDGenerator::testGUID();
+        container.add(guid, bmqt::CorrelationId(i), bmqp::QueueId(1));
+        expected.push_back(guid);
+    }
+    ASSERT_EQ(container.size(), static_cast<size_t>(k_NUM_ITEMS));
+
+    Callback callback = bdlf::BindUtil::bind(
+        &IterateAndInvokeHelper::appendKey,
+        &visited,
+        bdlf::PlaceHolders::_1,
+        bdlf::PlaceHolders::_2,
+        bdlf::PlaceHolders::_3);
+
+    {
+        PVV("Insertion order");
+        ASSERT(container.iterateAndInvoke(callback));
+        ASSERT(visited == expected);
+    }
+
+    {
+        PVV("Insertion order after removal");
+        bsl::vector<bmqt::MessageGUID> remaining(s_allocator_p);
+        for (int i = 0; i < k_NUM_ITEMS; ++i) {
+            if (i % 2) {
+                ASSERT_EQ(container.remove(expected[i]), 0);
+            }
+            else {
+                remaining.push_back(expected[i]);
+            }
+        }
+        ASSERT_EQ(container.size(), remaining.size());
+
+        visited.clear();
+        ASSERT(container.iterateAndInvoke(callback));
+        ASSERT(visited == remaining);
+    }
+}
+
+static void test5_sentTime()
+{
+    mwctst::TestHelper::printTestName("SENT TIME");
+
+    bmqimp::MessageCorrelationIdContainer container(s_allocator_p);
+
+    const bmqt::MessageGUID  guid = bmqp::MessageGUIDGenerator::testGUID();
+    const bsls::TimeInterval sentTime(123, 456);
+    bdlbb::Blob              appData(s_allocator_p);
+    bmqp::PutHeader          header;
+    bmqt::CorrelationId      corrId;
+    bsls::TimeInterval       removedSentTime(1, 1);
+
+    {
+        PVV("Item not associated to a PUT message");
+        container.add(guid, bmqt::CorrelationId(1), bmqp::QueueId(1));
+
+        ASSERT_EQ(container.remove(guid, &corrId, &removedSentTime), 0);
+        ASSERT_EQ(corrId, bmqt::CorrelationId(1));
+        ASSERT_EQ(removedSentTime, bsls::TimeInterval());
+    }
+
+    {
+        PVV("Item associated to a PUT message");
+        header.setMessageGUID(guid).setQueueId(1).setFlags(0);
+
+        container.add(guid, bmqt::CorrelationId(2), bmqp::QueueId(1));
+        container.associateMessageData(header, appData, sentTime);
+
+        ASSERT_EQ(container.remove(guid, &corrId, &removedSentTime), 0);
+        ASSERT_EQ(corrId, bmqt::CorrelationId(2));
+        ASSERT_EQ(removedSentTime, sentTime);
+        ASSERT_EQ(container.numberOfPuts(), 0U);
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -223,6 +327,8 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 5: test5_sentTime(); break;
+    case 4: test4_iterationOrder(); break;
     case 3: test3_associate(); break;
     case 2: test2_iterateAndInvoke(); break;
     case 1: test1_addFindRemove(); break;
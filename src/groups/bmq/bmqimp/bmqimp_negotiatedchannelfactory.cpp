@@ -100,6 +100,19 @@ NegotiatedChannelFactoryConfig::NegotiatedChannelFactoryConfig(
 const char* NegotiatedChannelFactory::k_CHANNEL_PROPERTY_MPS_EX =
     "broker.response.mps.ex";
 
+const char* NegotiatedChannelFactory::k_CHANNEL_PROPERTY_COMPRESSION_EX =
+    "broker.response.compression.ex";
+
+const char* NegotiatedChannelFactory::k_CHANNEL_PROPERTY_CONFIRM_RANGES =
+    "broker.response.confirm.ranges";
+
+const char* NegotiatedChannelFactory::k_CHANNEL_PROPERTY_COMPACT_PUT =
+    "broker.response.put.compact";
+
+const char*
+    NegotiatedChannelFactory::k_CHANNEL_PROPERTY_PIPELINED_CONFIGURE =
+        "broker.response.queue.pipelined.configure";
+
 // PRIVATE ACCESSORS
 void NegotiatedChannelFactory::baseResultCallback(
     const ResultCallback&                  userCb,
@@ -322,6 +335,37 @@ void NegotiatedChannelFactory::onBrokerNegotiationResponse(
         channel->properties().set(k_CHANNEL_PROPERTY_MPS_EX, 1);
     }
 
+    // Negotiation of LZ4 and ZSTD requires both of them to be advertised.
+    const bsl::string& brokerFeatures =
+        response.brokerResponse().brokerIdentity().features();
+    if (bmqp::ProtocolUtil::hasFeature(bmqp::CompressionFeatures::k_FIELD_NAME,
+                                       bmqp::CompressionFeatures::k_LZ4,
+                                       brokerFeatures) &&
+        bmqp::ProtocolUtil::hasFeature(bmqp::CompressionFeatures::k_FIELD_NAME,
+                                       bmqp::CompressionFeatures::k_ZSTD,
+                                       brokerFeatures)) {
+        channel->properties().set(k_CHANNEL_PROPERTY_COMPRESSION_EX, 1);
+    }
+
+    if (bmqp::ProtocolUtil::hasFeature(bmqp::ConfirmFeatures::k_FIELD_NAME,
+                                       bmqp::ConfirmFeatures::k_RANGES,
+                                       brokerFeatures)) {
+        channel->properties().set(k_CHANNEL_PROPERTY_CONFIRM_RANGES, 1);
+    }
+
+    if (bmqp::ProtocolUtil::hasFeature(bmqp::PutFeatures::k_FIELD_NAME,
+                                       bmqp::PutFeatures::k_COMPACT,
+                                       brokerFeatures)) {
+        channel->properties().set(k_CHANNEL_PROPERTY_COMPACT_PUT, 1);
+    }
+
+    if (bmqp::ProtocolUtil::hasFeature(
+            bmqp::QueueFeatures::k_FIELD_NAME,
+            bmqp::QueueFeatures::k_PIPELINED_CONFIGURE,
+            brokerFeatures)) {
+        channel->properties().set(k_CHANNEL_PROPERTY_PIPELINED_CONFIGURE, 1);
+    }
+
     cb(mwcio::ChannelFactoryEvent::e_CHANNEL_UP, mwcio::Status(), channel);
 }
 
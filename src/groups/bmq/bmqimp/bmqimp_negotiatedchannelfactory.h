@@ -107,6 +107,23 @@ class NegotiatedChannelFactory : public mwcio::ChannelFactory {
     /// Temporary; shall remove after 2nd roll out of "new style" brokers.
     static const char* k_CHANNEL_PROPERTY_MPS_EX;
 
+    /// Name of a property set on the channel when the broker supports the
+    /// compression algorithms advertised in `bmqp::CompressionFeatures`.
+    static const char* k_CHANNEL_PROPERTY_COMPRESSION_EX;
+
+    /// Name of a property set on the channel when the broker supports range
+    /// encoded confirm events (see `bmqp::ConfirmFeatures`).
+    static const char* k_CHANNEL_PROPERTY_CONFIRM_RANGES;
+
+    /// Name of a property set on the channel when the broker supports
+    /// compact put events (see `bmqp::PutFeatures`).
+    static const char* k_CHANNEL_PROPERTY_COMPACT_PUT;
+
+    /// Name of a property set on the channel when the broker supports
+    /// configure requests pipelined with the open request of a queue (see
+    /// `bmqp::QueueFeatures`).
+    static const char* k_CHANNEL_PROPERTY_PIPELINED_CONFIGURE;
+
   private:
     // PRIVATE DATA
     Config d_config;
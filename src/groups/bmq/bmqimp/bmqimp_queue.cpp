@@ -318,13 +318,18 @@ Queue::Queue(bslma::Allocator* allocator)
 , d_requestGroupId()
 , d_correlationId()
 , d_stats_mp(0)
+, d_latencies_sp()
 , d_isSuspended(false)
 , d_isOldStyle(true)
+, d_hasExtendedCompression(false)
+, d_compressionDictionary_p(0)
 , d_isSuspendedWithBroker(false)
+, d_isConfigurePipelined(false)
 , d_schemaGenerator(allocator)
 , d_schemaLearner(allocator)
 , d_schemaLearnerContext(d_schemaLearner.createContext())
 , d_config(allocator)
+, d_flowControlMonitor()
 {
     d_handleParameters.uri()   = "";
     d_handleParameters.flags() = bmqt::QueueFlagsUtil::empty();
@@ -416,6 +421,7 @@ Queue::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     }
     printer.printAttribute("isSuspended", d_isSuspended.load());
     printer.printAttribute("isSuspendedWithBroker", d_isSuspendedWithBroker);
+    printer.printAttribute("isConfigurePipelined", d_isConfigurePipelined);
     printer.end();
 
     return stream;
@@ -29,8 +29,11 @@
 // functionality related to stats associated to Queues.
 
 // BMQ
+#include <bmqimp_eventsstats.h>
+#include <bmqimp_flowcontrolmonitor.h>
 #include <bmqimp_stat.h>
 
+#include <bmqp_compressiondictionary.h>
 #include <bmqp_ctrlmsg_messages.h>
 #include <bmqp_queueid.h>
 #include <bmqp_schemagenerator.h>
@@ -46,6 +49,7 @@
 
 // BDE
 #include <bsl_iosfwd.h>
+#include <bsl_memory.h>
 #include <bsl_optional.h>
 #include <bsl_string.h>
 #include <bslma_allocator.h>
@@ -233,6 +237,12 @@ class Queue {
     // open and 'registerStatContext()' has
     // been called
 
+    bsl::shared_ptr<EventsStatsQueueLatencies> d_latencies_sp;
+    // Latency histograms associated to this
+    // queue, if stats are enabled.  Set once
+    // when the queue is first opened and
+    // kept across reopens
+
     bsls::AtomicBool d_isSuspended;
     // Whether the queue is suspended.
     // While suspended, a queue receives no
@@ -244,10 +254,29 @@ class Queue {
     // Temporary; shall remove after 2nd
     // roll out of "new style" brokers.
 
+    bsls::AtomicBool d_hasExtendedCompression;
+    // Whether the broker hosting this
+    // queue supports compression
+    // algorithms other than ZLIB.
+
+    bsls::AtomicPointer<const bmqp::CompressionDictionary>
+        d_compressionDictionary_p;
+    // ZSTD dictionary advertised by the
+    // broker for this queue, if any,
+    // owned by the
+    // 'bmqp::CompressionDictionaryRegistry'.
+
     bool d_isSuspendedWithBroker;
     // Whether the queue is suspended from
     // the perspective of the broker.
 
+    bool d_isConfigurePipelined;
+    // Whether the configure request of the
+    // pending reopen of this queue was
+    // sent along with the open request,
+    // without waiting for the open
+    // response.
+
     bmqp::SchemaGenerator d_schemaGenerator;
 
     bmqp::SchemaLearner d_schemaLearner;
@@ -256,6 +285,12 @@ class Queue {
 
     bmqp_ctrlmsg::StreamParameters d_config;
 
+    FlowControlMonitor d_flowControlMonitor;
+    // Adaptive unconfirmed window of this
+    // queue, only used by the FSM thread
+    // of the session if adaptive flow
+    // control is enabled.
+
   private:
     // NOT IMPLEMENTED
 
@@ -297,6 +332,7 @@ class Queue {
     Queue& setRequestGroupId(int value);
     Queue& setIsSuspended(bool value);
     Queue& setIsSuspendedWithBroker(bool value);
+    Queue& setIsConfigurePipelined(bool value);
 
     /// Set the corresponding member of this object to the specified `value`
     /// and return a reference offering modifiable access to this object.
@@ -305,6 +341,24 @@ class Queue {
     /// Temporary; shall remove after 2nd roll out of "new style" brokers.
     Queue& setOldStyle(bool value);
 
+    /// Set whether the broker hosting this queue supports the compression
+    /// algorithms advertised in `bmqp::CompressionFeatures` to the
+    /// specified `value` and return a reference offering modifiable access
+    /// to this object.
+    Queue& setHasExtendedCompression(bool value);
+
+    /// Set the ZSTD dictionary advertised by the broker for this queue to
+    /// the specified `value` and return a reference offering modifiable
+    /// access to this object.  The behavior is undefined unless `value` is
+    /// 0 or is owned by `bmqp::CompressionDictionaryRegistry`.
+    Queue& setCompressionDictionary(const bmqp::CompressionDictionary* value);
+
+    /// Set the latency histograms associated to this queue to the specified
+    /// `value` and return a reference offering modifiable access to this
+    /// object.
+    Queue&
+    setLatencies(const bsl::shared_ptr<EventsStatsQueueLatencies>& value);
+
     /// Create a new subcontext for this queue, out of the specified
     /// `parentStatContext`.  The behavior is undefined unless this method
     /// is called on valid queue in opened state.  The behavior is also
@@ -325,6 +379,10 @@ class Queue {
     /// reinitialize the state before a new start).
     void clearStatContext();
 
+    /// Return a reference offering modifiable access to the adaptive
+    /// unconfirmed window of this queue.
+    FlowControlMonitor& flowControlMonitor();
+
     // ACCESSORS
 
     /// Return true if this Queue object has a SubQueueId having the default
@@ -352,11 +410,24 @@ class Queue {
 
     /// Return the corresponding member of this object.
     bool isSuspendedWithBroker() const;
+    bool isConfigurePipelined() const;
 
     /// Temporary; shall remove after 2nd roll out of "new style" brokers.
     bool                                  isOldStyle() const;
+
+    /// Return true if the broker hosting this queue supports compression
+    /// algorithms other than `ZLIB`, and false otherwise.
+    bool hasExtendedCompression() const;
+
+    /// Return the ZSTD dictionary advertised by the broker for this queue,
+    /// or 0 if there is none.
+    const bmqp::CompressionDictionary* compressionDictionary() const;
     const bmqp_ctrlmsg::StreamParameters& config() const;
 
+    /// Return a pointer to the latency histograms associated to this queue,
+    /// or 0 if there are none (e.g. if stats are disabled).
+    EventsStatsQueueLatencies* latencies() const;
+
     bmqp::SchemaGenerator&        schemaGenerator();
     bmqp::SchemaLearner&          schemaLearner();
     bmqp::SchemaLearner::Context& schemaLearnerContext();
@@ -516,12 +587,43 @@ inline Queue& Queue::setOldStyle(bool value)
     return *this;
 }
 
+inline Queue& Queue::setHasExtendedCompression(bool value)
+{
+    d_hasExtendedCompression = value;
+    return *this;
+}
+
+inline Queue&
+Queue::setCompressionDictionary(const bmqp::CompressionDictionary* value)
+{
+    d_compressionDictionary_p = value;
+    return *this;
+}
+
+inline Queue&
+Queue::setLatencies(const bsl::shared_ptr<EventsStatsQueueLatencies>& value)
+{
+    d_latencies_sp = value;
+    return *this;
+}
+
+inline FlowControlMonitor& Queue::flowControlMonitor()
+{
+    return d_flowControlMonitor;
+}
+
 inline Queue& Queue::setIsSuspendedWithBroker(bool value)
 {
     d_isSuspendedWithBroker = value;
     return *this;
 }
 
+inline Queue& Queue::setIsConfigurePipelined(bool value)
+{
+    d_isConfigurePipelined = value;
+    return *this;
+}
+
 inline Queue& Queue::setConfig(const bmqp_ctrlmsg::StreamParameters& value)
 {
     d_config = value;
@@ -614,11 +716,31 @@ inline bool Queue::isOldStyle() const
     return d_isOldStyle;
 }
 
+inline bool Queue::hasExtendedCompression() const
+{
+    return d_hasExtendedCompression;
+}
+
+inline const bmqp::CompressionDictionary* Queue::compressionDictionary() const
+{
+    return d_compressionDictionary_p;
+}
+
+inline EventsStatsQueueLatencies* Queue::latencies() const
+{
+    return d_latencies_sp.get();
+}
+
 inline bool Queue::isSuspendedWithBroker() const
 {
     return d_isSuspendedWithBroker;
 }
 
+inline bool Queue::isConfigurePipelined() const
+{
+    return d_isConfigurePipelined;
+}
+
 inline const bmqp_ctrlmsg::StreamParameters& Queue::config() const
 {
     return d_config;
@@ -24,6 +24,7 @@
 
 // BDE
 #include <bdlma_localsequentialallocator.h>
+#include <bsl_algorithm.h>
 #include <bsl_utility.h>
 #include <bslmf_assert.h>
 #include <bslmt_mutexassert.h>
@@ -40,12 +41,87 @@ BSLMF_ASSERT(bmqp::QueueId::k_DEFAULT_SUBQUEUE_ID <
 // SubQueueId for the purpose of correctly generating an increasing
 // sequence of non-default 'subQueueId' integers that are used when
 // communicating with upstream.
+
+/// Comparator of the subscription entries of a queue slot, ordered by
+/// subscriptionId, with a subscriptionId.
+struct SubscriptionIdLess {
+    template <class ENTRY>
+    bool operator()(const ENTRY& entry, unsigned int subscriptionId) const
+    {
+        return entry.first < subscriptionId;
+    }
+};
+
 }  // close unnamed namespace
 
 // ------------------
 // class QueueManager
 // ------------------
 
+// PRIVATE MANIPULATORS
+QueueManager::QueueSlot& QueueManager::queueSlot(int queueId)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(queueId >= 0);
+
+    if (static_cast<size_t>(queueId) >= d_queueSlots.size()) {
+        d_queueSlots.resize(queueId + 1, QueueSlot(d_allocator_p));
+    }
+
+    return d_queueSlots[queueId];
+}
+
+void QueueManager::trimQueueSlots()
+{
+    while (!d_queueSlots.empty() && !d_queueSlots.back().d_queue &&
+           d_queueSlots.back().d_subscriptions.empty()) {
+        d_queueSlots.pop_back();
+    }
+}
+
+QueueManager::QueuesBySubscriptions::iterator
+QueueManager::insertSubscription(const SubscriptionId&      id,
+                                 const QueueBySubscription& value)
+{
+    bsl::pair<QueuesBySubscriptions::iterator, bool> insertRet =
+        d_queuesBySubscriptionIds.insert(bsl::make_pair(id, value));
+    if (!insertRet.second) {
+        return insertRet.first;  // RETURN
+    }
+
+    bsl::vector<SubscriptionEntry>& subscriptions =
+        queueSlot(id.d_queueId).d_subscriptions;
+    subscriptions.insert(bsl::lower_bound(subscriptions.begin(),
+                                          subscriptions.end(),
+                                          id.d_subscriptionId,
+                                          SubscriptionIdLess()),
+                         SubscriptionEntry(id.d_subscriptionId,
+                                           &insertRet.first->second));
+
+    return insertRet.first;
+}
+
+void QueueManager::eraseSubscription(const SubscriptionId& id)
+{
+    if (d_queuesBySubscriptionIds.erase(id) == 0) {
+        return;  // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(static_cast<size_t>(id.d_queueId) <
+                     d_queueSlots.size());
+
+    bsl::vector<SubscriptionEntry>& subscriptions =
+        d_queueSlots[id.d_queueId].d_subscriptions;
+    bsl::vector<SubscriptionEntry>::iterator it = bsl::lower_bound(
+        subscriptions.begin(),
+        subscriptions.end(),
+        id.d_subscriptionId,
+        SubscriptionIdLess());
+    BSLS_ASSERT_SAFE(it != subscriptions.end() &&
+                     it->first == id.d_subscriptionId);
+    subscriptions.erase(it);
+}
+
 // PRIVATE ACCESSORS
 QueueManager::QueueSp
 QueueManager::lookupQueueLocked(const bmqp::QueueId& queueId) const
@@ -73,35 +149,47 @@ QueueManager::QueueSp QueueManager::lookupQueueBySubscriptionIdLocked(
     // PRECONDITIONS
     // d_queuesLock locked
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            qId < 0 || static_cast<size_t>(qId) >= d_queueSlots.size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return QueueSp();  // RETURN
+    }
+
+    const QueueSlot& slot = d_queueSlots[qId];
+
     if (sid == bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID) {
         // Look up by 'bmqp::QueueId'
-        const QueueSp& result = lookupQueueLocked(bmqp::QueueId(qId));
 
         // This is the case when we receive no Subscription - Options are
         // missing or packed.  We have two options here - empty CorrelationId
         // or the one of the queue.  Perhaps, the empty one is a better choice.
         *correlationId = bmqt::CorrelationId();
-        return result;
+        return slot.d_queue;  // RETURN
     }
-    // lookup by 'subscriptionId'
-    SubscriptionId id(qId, sid);
 
-    QueuesBySubscriptions::const_iterator cit = d_queuesBySubscriptionIds.find(
-        id);
+    // lookup by 'subscriptionId'
+    bsl::vector<SubscriptionEntry>::const_iterator cit = bsl::lower_bound(
+        slot.d_subscriptions.begin(),
+        slot.d_subscriptions.end(),
+        sid,
+        SubscriptionIdLess());
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
-            cit == d_queuesBySubscriptionIds.end())) {
+            cit == slot.d_subscriptions.end() || cit->first != sid)) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
         return QueueSp();  // RETURN
     }
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!cit->second.d_isCommited)) {
+
+    const QueueBySubscription& queueBySubscription = *cit->second;
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            !queueBySubscription.d_isCommited)) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
         return QueueSp();  // RETURN
     }
-    BSLS_ASSERT_SAFE(cit->second.d_queue);
+    BSLS_ASSERT_SAFE(queueBySubscription.d_queue);
 
-    *correlationId = cit->second.d_correlatonId;
+    *correlationId = queueBySubscription.d_correlatonId;
 
-    return cit->second.d_queue;
+    return queueBySubscription.d_queue;
 }
 
 // CREATORS
@@ -111,6 +199,7 @@ QueueManager::QueueManager(bslma::Allocator* allocator)
 , d_uris(allocator)
 , d_nextQueueId(0)
 , d_queuesBySubscriptionIds(allocator)
+, d_queueSlots(allocator)
 , d_allocator_p(allocator)
 {
     // NOTHING
@@ -186,6 +275,10 @@ void QueueManager::insertQueue(const QueueSp& queue)
         d_queues.insert(queueId, queue->correlationId(), queue);
     BSLS_ASSERT_SAFE(addRet.second == QueuesMap::e_INSERTED);
     (void)addRet.second;  // Compiler happiness
+
+    if (queueId.subId() == bmqp::QueueId::k_DEFAULT_SUBQUEUE_ID) {
+        queueSlot(queueId.id()).d_queue = queue;
+    }
 }
 
 QueueManager::QueueSp QueueManager::removeQueue(const Queue* queue)
@@ -206,6 +299,10 @@ QueueManager::QueueSp QueueManager::removeQueue(const Queue* queue)
     const QueueSp queueSp = iter->value();
     d_queues.erase(iter);
 
+    if (queueId.subId() == bmqp::QueueId::k_DEFAULT_SUBQUEUE_ID) {
+        queueSlot(queueId.id()).d_queue.reset();
+    }
+
     // Erase appId from subQueueIds map
     UrisMap::iterator uriIter = d_uris.find(
         bsl::string(queue->uri().canonical(), d_allocator_p));
@@ -234,9 +331,11 @@ QueueManager::QueueSp QueueManager::removeQueue(const Queue* queue)
          cit != snapshot.end();
          ++cit) {
         SubscriptionId id(queue->id(), cit->first.id());
-        d_queuesBySubscriptionIds.erase(id);
+        eraseSubscription(id);
     }
 
+    trimQueueSlots();
+
     return queueSp;
 }
 
@@ -297,6 +396,8 @@ void QueueManager::resetState()
     d_nextQueueId = 0;
     d_queues.clear();
     d_uris.clear();
+    d_queuesBySubscriptionIds.clear();
+    d_queueSlots.clear();
 }
 
 const QueueManager::QueueSp
@@ -511,9 +612,8 @@ void QueueManager::registerSubscription(
 {
     BSLS_ASSERT_SAFE(queue);
 
-    d_queuesBySubscriptionIds.insert(
-        bsl::make_pair(SubscriptionId(queue->id(), subscriptionId),
-                       QueueBySubscription(queue, correlationId)));
+    insertSubscription(SubscriptionId(queue->id(), subscriptionId),
+                       QueueBySubscription(queue, correlationId));
 }
 
 void QueueManager::updateSubscriptions(
@@ -542,11 +642,9 @@ void QueueManager::updateSubscriptions(
             // For backward compatibility, allow missing 'registerSubscription'
             // in which case Subscription Correlation Id will be empty.
 
-            it = d_queuesBySubscriptionIds
-                     .insert(bsl::make_pair(
-                         id,
-                         QueueBySubscription(queue, bmqt::CorrelationId())))
-                     .first;
+            it = insertSubscription(
+                id,
+                QueueBySubscription(queue, bmqt::CorrelationId()));
         }
 
         it->second.d_isCommited = true;
@@ -59,6 +59,18 @@
 // need to lookup the queue when we eventually receive a (late) response from
 // upstream.
 //
+/// PUSH Messages
+///-------------
+// The queue, and subscription correlationId, of each PUSH message are looked
+// up in a table indexed by queueId, each entry of which holds the queue
+// having the default subQueueId and the subscriptions, sorted by id, of the
+// queues having that queueId.  Because queueIds are generated in sequence,
+// the table is dense, and a lookup costs an array access and a binary search
+// of the (typically few) subscriptions of the queue, rather than hashing.
+// This table is only accessed from the thread processing the events of the
+// session (which also opens, configures and closes the queues), and is
+// therefore not protected by a lock.
+//
 /// Thread Safety
 ///-------------
 // Thread safe.
@@ -81,6 +93,7 @@
 #include <bsl_memory.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
+#include <bsl_utility.h>
 #include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
@@ -190,6 +203,36 @@ class QueueManager {
     /// canonicalUri -> queueInfo
     typedef bsl::unordered_map<bsl::string, QueueManager_QueueInfo> UrisMap;
 
+    /// Subscription id, and the corresponding element of
+    /// `d_queuesBySubscriptionIds`.
+    typedef bsl::pair<unsigned int, const QueueBySubscription*>
+        SubscriptionEntry;
+
+    /// Entry, indexed by queueId, of the table used to lookup the queue of
+    /// each PUSH message.
+    struct QueueSlot {
+        // PUBLIC DATA
+        QueueSp d_queue;
+        // Queue having this queueId and the
+        // default subQueueId, if any.
+
+        bsl::vector<SubscriptionEntry> d_subscriptions;
+        // Subscriptions of the queues
+        // having this queueId, sorted by
+        // id.
+
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(QueueSlot, bslma::UsesBslmaAllocator)
+
+        // CREATORS
+        explicit QueueSlot(bslma::Allocator* allocator);
+
+        QueueSlot(const QueueSlot& original, bslma::Allocator* allocator);
+    };
+
+    /// queueId -> queueSlot
+    typedef bsl::vector<QueueSlot> QueueSlots;
+
   public:
     // CLASS DATA
 
@@ -226,6 +269,13 @@ class QueueManager {
     // both Queue id and Subscription/
     // SubQueue id,
 
+    QueueSlots d_queueSlots;
+    // Lookup table, indexed by queueId, of
+    // the queues and subscriptions of the
+    // PUSH messages.  Not protected by
+    // 'd_queuesLock', see 'PUSH Messages'
+    // in the component documentation.
+
     bslma::Allocator* d_allocator_p;
     // Allocator to use
 
@@ -241,6 +291,25 @@ class QueueManager {
     /// that this method is useful when setting the queueId for a new queue.
     int generateNextQueueId();
 
+    /// Return a reference to the element of `d_queueSlots` for the
+    /// specified `queueId`, growing `d_queueSlots` if needed.
+    QueueSlot& queueSlot(int queueId);
+
+    /// Remove the trailing empty elements of `d_queueSlots`.
+    void trimQueueSlots();
+
+    /// Insert into `d_queuesBySubscriptionIds`, and index in
+    /// `d_queueSlots`, the specified `value` for the specified `id` unless
+    /// `id` is already present, and return an iterator to the element for
+    /// `id`.
+    QueuesBySubscriptions::iterator
+    insertSubscription(const SubscriptionId&      id,
+                       const QueueBySubscription& value);
+
+    /// Erase the specified `id`, if present, from
+    /// `d_queuesBySubscriptionIds` and `d_queueSlots`.
+    void eraseSubscription(const SubscriptionId& id);
+
     // PRIVATE ACCESSORS
 
     /// Lookup the queue with the specified `queueId` and return a shared
@@ -400,6 +469,25 @@ inline QueueManager::QueueBySubscription::QueueBySubscription(
     // NOTHING
 }
 
+// ------------------------------
+// struct QueueManager::QueueSlot
+// ------------------------------
+
+inline QueueManager::QueueSlot::QueueSlot(bslma::Allocator* allocator)
+: d_queue()
+, d_subscriptions(allocator)
+{
+    // NOTHING
+}
+
+inline QueueManager::QueueSlot::QueueSlot(const QueueSlot&  original,
+                                          bslma::Allocator* allocator)
+: d_queue(original.d_queue)
+, d_subscriptions(original.d_subscriptions, allocator)
+{
+    // NOTHING
+}
+
 // -----------------------------
 // struct QueueManager_QueueInfo
 // -----------------------------
@@ -20,10 +20,14 @@
 #include <bmqimp_event.h>
 #include <bmqimp_stat.h>
 #include <bmqp_crc32c.h>
+#include <bmqp_ctrlmsg_messages.h>
+#include <bmqp_protocol.h>
 #include <bmqp_protocolutil.h>
 #include <bmqp_pusheventbuilder.h>
 #include <bmqp_puteventbuilder.h>
+#include <bmqt_queueoptions.h>
 #include <bmqt_resultcode.h>
+#include <bmqt_subscription.h>
 #include <bmqt_uri.h>
 
 // BDE
@@ -740,6 +744,139 @@ static void test10_putStatsTest()
     ASSERT_EQ(eventMessageCount, 1);
 }
 
+static void test11_lookupQueueBySubscriptionId()
+// ------------------------------------------------------------------------
+// LOOKUP QUEUE BY SUBSCRIPTION ID
+//
+// Concerns:
+//   1. A queue is found by its queueId and the default subscriptionId,
+//      with an empty correlationId.
+//   2. A queue is found by its queueId and the id of one of its
+//      subscriptions, with the correlationId of the subscription, only
+//      while the subscription is committed.
+//   3. Neither an unknown queueId nor an unknown subscriptionId is found.
+//   4. Once the queue is removed, it is found neither by the default
+//      subscriptionId nor by the ids of its subscriptions.
+//
+// Plan:
+//   1) Insert a reader queue and register two subscriptions, in reverse
+//      order of their ids.
+//   2) Commit both subscriptions, then only one of them, and look up the
+//      queue by each of the subscriptionIds after each step.
+//   3) Remove the queue and look it up again.
+//
+// Testing:
+//   registerSubscription
+//   updateSubscriptions
+//   lookupQueueBySubscriptionId
+//   removeQueue
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("LOOKUP QUEUE BY SUBSCRIPTION ID");
+
+    const unsigned int k_DEFAULT_SID =
+        bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID;
+
+    bmqimp::QueueManager obj(s_allocator_p);
+
+    const char k_URI[] = "bmq://ts.trades.myapp/my.queue";
+
+    bmqt::Uri                     uri(k_URI, s_allocator_p);
+    const bmqt::CorrelationId     k_CORID  = bmqt::CorrelationId::autoValue();
+    const bmqt::CorrelationId     k_CORID1 = bmqt::CorrelationId::autoValue();
+    const bmqt::CorrelationId     k_CORID2 = bmqt::CorrelationId::autoValue();
+    bmqimp::QueueManager::QueueSp queueSp;
+
+    queueSp.createInplace(s_allocator_p, s_allocator_p);
+
+    bsls::Types::Uint64 flags = 0;
+    bmqt::QueueFlagsUtil::setReader(&flags);
+
+    bmqp::QueueId queueId(bmqimp::Queue::k_INVALID_QUEUE_ID);
+    obj.generateQueueAndSubQueueId(&queueId, uri, flags);
+
+    const bmqt::SubscriptionHandle handle1(k_CORID1);
+    const bmqt::SubscriptionHandle handle2(k_CORID2);
+    const unsigned int             sid1 = handle1.id();
+    const unsigned int             sid2 = handle2.id();
+
+    bmqt::QueueOptions options(s_allocator_p);
+    bsl::string        error(s_allocator_p);
+    ASSERT(options.addOrUpdateSubscription(&error,
+                                           handle1,
+                                           bmqt::Subscription()));
+    ASSERT(options.addOrUpdateSubscription(&error,
+                                           handle2,
+                                           bmqt::Subscription()));
+
+    (*queueSp)
+        .setUri(uri)
+        .setId(queueId.id())
+        .setSubQueueId(queueId.subId())
+        .setFlags(flags)
+        .setOptions(options)
+        .setCorrelationId(k_CORID);
+
+    obj.insertQueue(queueSp);
+
+    bmqt::CorrelationId corId;
+
+    // 1. Default subscriptionId
+    corId = k_CORID;
+    ASSERT(obj.lookupQueueBySubscriptionId(&corId,
+                                           queueId.id(),
+                                           k_DEFAULT_SID) == queueSp);
+    ASSERT(corId.isUnset());
+    ASSERT(!obj.lookupQueueBySubscriptionId(&corId,
+                                            queueId.id() + 1,
+                                            k_DEFAULT_SID));
+
+    // 2. Registered but not committed subscriptions
+    obj.registerSubscription(queueSp, sid2, k_CORID2);
+    obj.registerSubscription(queueSp, sid1, k_CORID1);
+
+    ASSERT(!obj.lookupQueueBySubscriptionId(&corId, queueId.id(), sid1));
+    ASSERT(!obj.lookupQueueBySubscriptionId(&corId, queueId.id(), sid2));
+
+    // 3. Committed subscriptions
+    bmqp_ctrlmsg::StreamParameters config(s_allocator_p);
+    config.subscriptions().resize(2);
+    config.subscriptions()[0].sId() = sid1;
+    config.subscriptions()[1].sId() = sid2;
+
+    obj.updateSubscriptions(queueSp, config);
+    queueSp->setConfig(config);
+
+    ASSERT(obj.lookupQueueBySubscriptionId(&corId, queueId.id(), sid1) ==
+           queueSp);
+    ASSERT_EQ(corId, k_CORID1);
+    ASSERT(obj.lookupQueueBySubscriptionId(&corId, queueId.id(), sid2) ==
+           queueSp);
+    ASSERT_EQ(corId, k_CORID2);
+    ASSERT(!obj.lookupQueueBySubscriptionId(&corId, queueId.id(), sid2 + 1));
+    ASSERT(!obj.lookupQueueBySubscriptionId(&corId, queueId.id() + 1, sid1));
+
+    // 4. Only 'sid2' remains committed
+    config.subscriptions().erase(config.subscriptions().begin());
+
+    obj.updateSubscriptions(queueSp, config);
+    queueSp->setConfig(config);
+
+    ASSERT(!obj.lookupQueueBySubscriptionId(&corId, queueId.id(), sid1));
+    ASSERT(obj.lookupQueueBySubscriptionId(&corId, queueId.id(), sid2) ==
+           queueSp);
+    ASSERT_EQ(corId, k_CORID2);
+
+    // 5. Removed queue
+    ASSERT(obj.removeQueue(queueSp.get()) == queueSp);
+
+    ASSERT(!obj.lookupQueueBySubscriptionId(&corId,
+                                            queueId.id(),
+                                            k_DEFAULT_SID));
+    ASSERT(!obj.lookupQueueBySubscriptionId(&corId, queueId.id(), sid1));
+    ASSERT(!obj.lookupQueueBySubscriptionId(&corId, queueId.id(), sid2));
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -758,6 +895,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 11: test11_lookupQueueBySubscriptionId(); break;
     case 10: test10_putStatsTest(); break;
     case 9: test9_pushStatsTest(); break;
     case 8: test8_substreamCountTest(); break;
@@ -18,6 +18,7 @@
 
 #include <bmqscm_version.h>
 // BMQ
+#include <bmqp_messageguidgenerator.h>
 #include <bmqp_protocolutil.h>
 
 // MWC
@@ -39,6 +40,11 @@ AckEventBuilder::AckEventBuilder(bdlbb::BlobBufferFactory* bufferFactory,
                                  bslma::Allocator*         allocator)
 : d_blob(bufferFactory, allocator)
 , d_msgCount(0)
+, d_rangeCount(0)
+, d_useRanges(false)
+, d_lastRange()
+, d_lastRangePosition()
+, d_nextGUID()
 {
     reset();
 }
@@ -46,7 +52,8 @@ AckEventBuilder::AckEventBuilder(bdlbb::BlobBufferFactory* bufferFactory,
 void AckEventBuilder::reset()
 {
     d_blob.removeAll();
-    d_msgCount = 0;
+    d_msgCount   = 0;
+    d_rangeCount = 0;
 
     // NOTE: Since AckEventBuilder owns the blob and we just reset it, we have
     //       guarantee that buffer(0) will contain the entire headers (unless
@@ -66,7 +73,22 @@ void AckEventBuilder::reset()
     new (d_blob.buffer(0).data()) EventHeader(EventType::e_ACK);
 
     // AckHeader
-    new (d_blob.buffer(0).data() + sizeof(EventHeader)) AckHeader();
+    AckHeader* ackHeader = new (d_blob.buffer(0).data() + sizeof(EventHeader))
+        AckHeader();
+    if (d_useRanges) {
+        ackHeader->setFlags(AckHeaderFlags::e_RANGES)
+            .setPerMessageWords(sizeof(AckMessageRange) /
+                                Protocol::k_WORD_SIZE);
+    }
+}
+
+void AckEventBuilder::setRangeEncoding(bool value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(messageCount() == 0);
+
+    d_useRanges = value;
+    reset();
 }
 
 bmqt::EventBuilderResult::Enum
@@ -75,6 +97,11 @@ AckEventBuilder::appendMessage(int                      status,
                                const bmqt::MessageGUID& guid,
                                int                      queueId)
 {
+    if (d_useRanges) {
+        return appendToRange(status, correlationId, guid, queueId);
+        // RETURN
+    }
+
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(messageCount() ==
                                               maxMessageCount())) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
@@ -105,6 +132,55 @@ AckEventBuilder::appendMessage(int                      status,
     return bmqt::EventBuilderResult::e_SUCCESS;
 }
 
+bmqt::EventBuilderResult::Enum
+AckEventBuilder::appendToRange(int                      status,
+                               int                      correlationId,
+                               const bmqt::MessageGUID& guid,
+                               int                      queueId)
+{
+    const AckMessage& last = d_lastRange.firstMessage();
+
+    if (d_rangeCount != 0 && status == last.status() &&
+        queueId == last.queueId() &&
+        correlationId != AckMessage::k_NULL_CORRELATION_ID &&
+        correlationId == last.correlationId() + d_lastRange.count() &&
+        guid == d_nextGUID) {
+        // This message extends the last range: only update its count.
+        d_lastRange.setCount(d_lastRange.count() + 1);
+    }
+    else {
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_rangeCount ==
+                                                  maxRangeCount())) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            return bmqt::EventBuilderResult::e_EVENT_TOO_BIG;  // RETURN
+        }
+
+        // Start a new range: resize the blob to have space for an
+        // 'AckMessageRange' at the end ...
+        mwcu::BlobUtil::reserve(&d_lastRangePosition,
+                                &d_blob,
+                                sizeof(AckMessageRange));
+
+        const AckMessage message(status, correlationId, guid, queueId);
+        d_lastRange.setFirstMessage(message).setCount(1);
+
+        ++d_rangeCount;
+    }
+
+    MessageGUIDGenerator::loadNextGUID(&d_nextGUID, guid);
+
+    mwcu::BlobObjectProxy<AckMessageRange> range(&d_blob,
+                                                 d_lastRangePosition,
+                                                 false,  // no read
+                                                 true);  // write mode
+    *range = d_lastRange;
+    range.reset();  // i.e., flush writing to blob.
+
+    ++d_msgCount;
+
+    return bmqt::EventBuilderResult::e_SUCCESS;
+}
+
 const bdlbb::Blob& AckEventBuilder::blob() const
 {
     // PRECONDITIONS
@@ -28,6 +28,20 @@
 // can be reused to build multiple Events, by calling the 'reset()' method on
 // it.
 //
+/// Range encoding
+///--------------
+// At high throughput, most of the acknowledgements sent to a producer are
+// successful ones, for the same queue, with consecutive correlation Ids and
+// GUIDs (as generated in bulk by 'MessageGUIDGenerator::generateGUIDs').
+// When range encoding is enabled (see 'setRangeEncoding'), the event is made
+// of 'AckMessageRange' instead of 'AckMessage', and the builder collapses
+// such runs of acknowledgements into a single range, reducing the size of
+// the event by up to ~85%.  The 'AckHeaderFlags::e_RANGES' flag is set in
+// the 'AckHeader' of such an event, and 'bmqp::AckMessageIterator'
+// transparently expands the ranges into the original messages.  Range
+// encoding must only be enabled if the peer advertised the
+// 'AckFeatures::k_RANGES' feature.
+//
 /// Padding
 ///-------
 // AckEvent messages are not meant to be sent in batch and are therefore not
@@ -62,6 +76,9 @@
 #include <bmqt_messageguid.h>
 #include <bmqt_resultcode.h>
 
+// MWC
+#include <mwcu_blob.h>
+
 // BDE
 #include <bdlbb_blob.h>
 #include <bslma_allocator.h>
@@ -89,6 +106,34 @@ class AckEventBuilder BSLS_CPP11_FINAL {
     int d_msgCount;              // number of messages currently in the
                                  // event
 
+    int d_rangeCount;  // number of ranges currently in the
+                       // event, if range encoding is enabled
+
+    bool d_useRanges;  // whether range encoding is enabled
+
+    AckMessageRange d_lastRange;  // last range appended to the event
+
+    mwcu::BlobPosition d_lastRangePosition;
+    // position of the last range in the
+    // blob
+
+    bmqt::MessageGUID d_nextGUID;  // GUID of the message which would extend
+                                   // the last range
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Append an acknowledgement for the specified `status`,
+    /// `correlationId`, `guid` and `queueId` to the last range of the
+    /// event being built if it extends it, or to a new range otherwise.
+    /// Return 0 on success, or a non-zero code if it failed (due to event
+    /// being full).
+    bmqt::EventBuilderResult::Enum
+    appendToRange(int                      status,
+                  int                      correlationId,
+                  const bmqt::MessageGUID& guid,
+                  int                      queueId);
+
   private:
     // NOT IMPLEMENTED
     AckEventBuilder(const AckEventBuilder&) BSLS_CPP11_DELETED;
@@ -115,6 +160,12 @@ class AckEventBuilder BSLS_CPP11_FINAL {
     /// content of the blob returned by the `blob()` method.
     void reset();
 
+    /// Enable range encoding if the specified `value` is true, and disable
+    /// it otherwise (see `Range encoding` in the component documentation).
+    /// The behavior is undefined unless this builder is empty, i.e.,
+    /// `messageCount() == 0`.
+    void setRangeEncoding(bool value);
+
     /// Append an AckMessage for the specified `status`, `correlationId`,
     /// `guid` and `queueId` to the event being built.  Return 0 if the
     /// message was successfully added, or a non-zero code if it failed (due
@@ -126,13 +177,22 @@ class AckEventBuilder BSLS_CPP11_FINAL {
 
     // ACCESSORS
 
+    /// Return true if range encoding is enabled, and false otherwise.
+    bool isRangeEncoding() const;
+
     /// Return the number of messages currently in the event being built.
+    /// Note that, if range encoding is enabled, this is the number of
+    /// messages in all of the ranges.
     int messageCount() const;
 
     /// Return the maximum number of messages that can be added to this
     /// event, with respect to protocol limitations.
     int maxMessageCount() const;
 
+    /// Return the maximum number of ranges that can be added to this event,
+    /// with respect to protocol limitations, if range encoding is enabled.
+    int maxRangeCount() const;
+
     /// Return the current size of the event being built.  If no messages
     /// were added, this will return 0.
     int eventSize() const;
@@ -151,6 +211,11 @@ class AckEventBuilder BSLS_CPP11_FINAL {
 // class AckEventBuilder
 // ---------------------
 
+inline bool AckEventBuilder::isRangeEncoding() const
+{
+    return d_useRanges;
+}
+
 inline int AckEventBuilder::messageCount() const
 {
     return d_msgCount;
@@ -164,6 +229,14 @@ inline int AckEventBuilder::maxMessageCount() const
     return res;
 }
 
+inline int AckEventBuilder::maxRangeCount() const
+{
+    static const int res = (EventHeader::k_MAX_SIZE_SOFT -
+                            sizeof(EventHeader) - sizeof(AckHeader)) /
+                           sizeof(AckMessageRange);
+    return res;
+}
+
 inline int AckEventBuilder::eventSize() const
 {
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(messageCount() == 0)) {
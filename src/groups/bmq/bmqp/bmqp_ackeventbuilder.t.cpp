@@ -19,6 +19,7 @@
 // BMQ
 #include <bmqp_ackmessageiterator.h>
 #include <bmqp_event.h>
+#include <bmqp_messageguidgenerator.h>
 #include <bmqt_messageguid.h>
 #include <bmqt_resultcode.h>
 
@@ -33,11 +34,20 @@
 #include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlf_bind.h>
 #include <bsl_fstream.h>
+#include <bsl_ios.h>
 #include <bsl_vector.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
 
 // TEST DRIVER
 #include <mwctst_testhelper.h>
 
+// BENCHMARKING LIBRARY
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <benchmark/benchmark.h>
+#endif
+
 // CONVENIENCE
 using namespace BloombergLP;
 using namespace bsl;
@@ -128,6 +138,30 @@ static void verifyContent(const bmqp::AckEventBuilder& builder,
     ASSERT_EQ(iter.isValid(), false);
 }
 
+/// Reset the specified `builder`, append to it one message for each GUID of
+/// the specified `guids`, all having the same status and queueId and
+/// consecutive correlationIds, and iterate over the messages of the
+/// resulting event.  Return the number of messages iterated over.
+static int packAndIterate(bmqp::AckEventBuilder*                builder,
+                          const bsl::vector<bmqt::MessageGUID>& guids)
+{
+    builder->reset();
+    for (size_t i = 0; i < guids.size(); ++i) {
+        builder->appendMessage(0, static_cast<int>(i), guids[i], 5);
+    }
+
+    bmqp::Event              event(&builder->blob(), s_allocator_p);
+    bmqp::AckMessageIterator iter;
+    event.loadAckMessageIterator(&iter);
+
+    int numMsgs = 0;
+    while (iter.next() == 1) {
+        ++numMsgs;
+    }
+
+    return numMsgs;
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -241,6 +275,146 @@ static void test4_capacity()
     ASSERT(obj.eventSize() <= bmqp::EventHeader::k_MAX_SIZE_SOFT);
 }
 
+static void test5_rangeEncoding()
+// --------------------------------------------------------------------
+// RANGE ENCODING
+//
+// Concerns:
+//   1. Runs of ACK messages having the same status and queueId, and
+//      consecutive correlationIds and GUIDs are collapsed into one
+//      'AckMessageRange'.
+//   2. Any break of a run starts a new range.
+//   3. The event is decoded by 'AckMessageIterator' into the appended
+//      messages.
+//   4. Once the maximum number of ranges is reached, 'appendMessage'
+//      returns an error, unless the message extends the last range.
+//
+// Plan:
+//   1. Enable range encoding, append runs of messages with GUIDs
+//      generated in bulk, interleaved with messages breaking the runs.
+//   2. Verify the size of the event and iterate over its messages.
+//   3. Fill up the event with ranges of one message.
+//
+// Testing:
+//   setRangeEncoding
+//   isRangeEncoding
+//   maxRangeCount
+//   appendMessage
+// --------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("RANGE ENCODING");
+
+    const int k_RUN_LENGTH = 100;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(256, s_allocator_p);
+    bmqp::AckEventBuilder          obj(&bufferFactory, s_allocator_p);
+    bmqp::MessageGUIDGenerator     generator(0);
+    bsl::vector<bmqt::MessageGUID> guids(k_RUN_LENGTH, s_allocator_p);
+    bsl::vector<Data>              messages(s_allocator_p);
+
+    ASSERT_EQ(obj.isRangeEncoding(), false);
+    obj.setRangeEncoding(true);
+    ASSERT_EQ(obj.isRangeEncoding(), true);
+    ASSERT_EQ(obj.messageCount(), 0);
+    ASSERT_NE(obj.maxRangeCount(), 0);
+
+    PVV("Appending messages");
+    generator.generateGUIDs(guids.data(), k_RUN_LENGTH);
+
+    // Range #1: one run of 'k_RUN_LENGTH' messages
+    for (int i = 0; i < k_RUN_LENGTH; ++i) {
+        Data data = {0, 1 + i, guids[i], 5};
+        messages.push_back(data);
+    }
+
+    // Range #2: different queueId
+    {
+        Data data = {0, 1 + k_RUN_LENGTH, guids[k_RUN_LENGTH - 1], 6};
+        messages.push_back(data);
+    }
+
+    // Range #3: different status
+    {
+        Data data = {1, 2 + k_RUN_LENGTH, guids[0], 6};
+        messages.push_back(data);
+    }
+
+    // Range #4 and #5: non consecutive GUIDs
+    {
+        Data data = {1, 3 + k_RUN_LENGTH, guids[0], 6};
+        messages.push_back(data);
+        messages.push_back(data);
+        messages.back().d_corrId = 4 + k_RUN_LENGTH;
+    }
+
+    // Range #6: null correlationId
+    {
+        Data data = {1, bmqp::AckMessage::k_NULL_CORRELATION_ID, guids[0], 6};
+        messages.push_back(data);
+    }
+
+    for (size_t i = 0; i < messages.size(); ++i) {
+        const Data& data = messages[i];
+        int         rc   = obj.appendMessage(data.d_status,
+                                        data.d_corrId,
+                                        data.d_guid,
+                                        data.d_queueId);
+        ASSERT_EQ_D(i, rc, 0);
+    }
+
+    PVV("Verifying content");
+    const size_t expectedSize = sizeof(bmqp::EventHeader) +
+                                sizeof(bmqp::AckHeader) +
+                                (6 * sizeof(bmqp::AckMessageRange));
+    ASSERT_EQ(static_cast<size_t>(obj.messageCount()), messages.size());
+    ASSERT_EQ(static_cast<size_t>(obj.eventSize()), expectedSize);
+
+    bmqp::Event event(&obj.blob(), s_allocator_p);
+    ASSERT_EQ(event.isValid(), true);
+    ASSERT_EQ(event.isAckEvent(), true);
+
+    bmqp::AckMessageIterator iter;
+    event.loadAckMessageIterator(&iter);
+    ASSERT_EQ(iter.isValid(), true);
+    ASSERT_EQ(iter.isRangeEncoded(), true);
+
+    size_t idx = 0;
+    while (iter.next() == 1 && idx < messages.size()) {
+        const Data& d = messages[idx];
+
+        ASSERT_EQ_D(idx, d.d_guid, iter.message().messageGUID());
+        ASSERT_EQ_D(idx, d.d_corrId, iter.message().correlationId());
+        ASSERT_EQ_D(idx, d.d_status, iter.message().status());
+        ASSERT_EQ_D(idx, d.d_queueId, iter.message().queueId());
+
+        ++idx;
+    }
+    ASSERT_EQ(idx, messages.size());
+    ASSERT_EQ(iter.isValid(), false);
+
+    PVV("Filling up AckEventBuilder");
+    obj.reset();
+    ASSERT_EQ(obj.isRangeEncoding(), true);
+
+    for (int i = 0; i < obj.maxRangeCount(); ++i) {
+        // Same GUID for all messages: each message is a new range.
+        int rc = obj.appendMessage(0, 1 + i, guids[0], 0);
+        ASSERT_EQ_D(i, rc, 0);
+    }
+    ASSERT(obj.eventSize() <= bmqp::EventHeader::k_MAX_SIZE_SOFT);
+
+    int rc = obj.appendMessage(0, 1, guids[0], 0);
+    ASSERT_EQ(rc, static_cast<int>(bmqt::EventBuilderResult::e_EVENT_TOO_BIG));
+
+    // Extending the last range does not need more space.
+    bmqt::MessageGUID next;
+    bmqp::MessageGUIDGenerator::loadNextGUID(&next, guids[0]);
+    rc = obj.appendMessage(0, 1 + obj.maxRangeCount(), next, 0);
+    ASSERT_EQ(rc, 0);
+    ASSERT_EQ(obj.messageCount(), obj.maxRangeCount() + 1);
+    ASSERT(obj.eventSize() <= bmqp::EventHeader::k_MAX_SIZE_SOFT);
+}
+
 static void testN1_decodeFromFile()
 // --------------------------------------------------------------------
 // DECODE FROM FILE
@@ -342,6 +516,88 @@ static void testN1_decodeFromFile()
     ASSERT_EQ(iter.isValid(), false);
 }
 
+static void testN2_packAndIterate()
+// --------------------------------------------------------------------
+// BENCHMARK: PACK AND ITERATE
+//
+// Concerns:
+//   Measure the cost of building an ACK event, with and without range
+//   encoding, and of iterating over its messages.
+//
+// Plan:
+//   - For each encoding, time a large number of events of
+//     'k_NUM_MSGS' messages being built and iterated over, and report the
+//     average time per message.
+//
+// Testing:
+//   Performance of appendMessage and AckMessageIterator::next.
+// --------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BENCHMARK: PACK AND ITERATE");
+
+    const int k_NUM_MSGS  = 1000;
+    const int k_NUM_ITERS = 10000;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(4096, s_allocator_p);
+    bmqp::AckEventBuilder          obj(&bufferFactory, s_allocator_p);
+    bmqp::MessageGUIDGenerator     generator(0);
+    bsl::vector<bmqt::MessageGUID> guids(k_NUM_MSGS, s_allocator_p);
+
+    generator.generateGUIDs(guids.data(), k_NUM_MSGS);
+
+    for (int useRanges = 0; useRanges < 2; ++useRanges) {
+        obj.reset();
+        obj.setRangeEncoding(useRanges);
+
+        // Warm up
+        ASSERT_EQ(k_NUM_MSGS, packAndIterate(&obj, guids));
+
+        bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+        for (int i = 0; i < k_NUM_ITERS; ++i) {
+            packAndIterate(&obj, guids);
+        }
+        bsls::Types::Int64 endTime = bsls::TimeUtil::getTimer();
+
+        cout << "Range encoding: " << bsl::boolalpha << (useRanges != 0)
+             << ", event size: " << obj.eventSize() << " bytes"
+             << ", average time per message (ns): "
+             << (endTime - startTime) / (k_NUM_ITERS * k_NUM_MSGS) << '\n';
+    }
+}
+
+// Begin Benchmarking Tests
+#ifdef BSLS_PLATFORM_OS_LINUX
+static void testN2_packAndIterate_GoogleBenchmark(benchmark::State& state)
+// --------------------------------------------------------------------
+// BENCHMARK: PACK AND ITERATE
+//
+// Concerns:
+//   Measure the cost of building an ACK event and of iterating over its
+//   messages.  'state.range(0)' is non-zero for range encoding, and
+//   'state.range(1)' is the number of messages in the event.
+// --------------------------------------------------------------------
+{
+    const int numMsgs = state.range(1);
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(4096, s_allocator_p);
+    bmqp::AckEventBuilder          obj(&bufferFactory, s_allocator_p);
+    bmqp::MessageGUIDGenerator     generator(0);
+    bsl::vector<bmqt::MessageGUID> guids(numMsgs, s_allocator_p);
+
+    generator.generateGUIDs(guids.data(), numMsgs);
+    obj.setRangeEncoding(state.range(0) != 0);
+
+    // <time>
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(packAndIterate(&obj, guids));
+    }
+    // </time>
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            numMsgs);
+}
+#endif  // BSLS_PLATFORM_OS_LINUX
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -352,16 +608,29 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 5: test5_rangeEncoding(); break;
     case 4: test4_capacity(); break;
     case 3: test3_reset(); break;
     case 2: test2_multiMessage(); break;
     case 1: test1_breathingTest(); break;
     case -1: testN1_decodeFromFile(); break;
+    case -2:
+        MWC_BENCHMARK_WITH_ARGS(
+            testN2_packAndIterate,
+            Args({0, 1000})->Args({1, 1000})->Args({0, 10000})->Args(
+                {1, 10000}));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
     } break;
     }
+#ifdef BSLS_PLATFORM_OS_LINUX
+    if (_testCase < 0) {
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+    }
+#endif
 
     TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
 }
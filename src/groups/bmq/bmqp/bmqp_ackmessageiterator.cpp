@@ -17,6 +17,9 @@
 #include <bmqp_ackmessageiterator.h>
 
 #include <bmqscm_version.h>
+// BMQ
+#include <bmqp_messageguidgenerator.h>
+
 // BDE
 #include <bsl_iostream.h>
 #include <bsls_performancehint.h>
@@ -30,8 +33,10 @@ namespace bmqp {
 
 void AckMessageIterator::copyFrom(const AckMessageIterator& src)
 {
-    d_blobIter      = src.d_blobIter;
-    d_advanceLength = src.d_advanceLength;
+    d_blobIter       = src.d_blobIter;
+    d_advanceLength  = src.d_advanceLength;
+    d_rangeMessage   = src.d_rangeMessage;
+    d_rangeRemaining = src.d_rangeRemaining;
 
     if (!src.d_header.isSet()) {
         d_header.reset();
@@ -68,6 +73,9 @@ int AckMessageIterator::next()
         rc_NOT_ENOUGH_BYTES = -2  // The number of bytes in the blob is less
                                   // than the payload size of the message
                                   // declared in the header
+        ,
+        rc_INVALID_RANGE = -3  // The range has no messages, or more
+                               // messages than correlation Ids
     };
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
@@ -75,6 +83,20 @@ int AckMessageIterator::next()
         return rc_INVALID;  // RETURN
     }
 
+    if (d_rangeRemaining > 0) {
+        // Next message of the current range: it has the next correlation Id
+        // and GUID.
+        --d_rangeRemaining;
+        d_rangeMessage.setCorrelationId(d_rangeMessage.correlationId() + 1);
+
+        bmqt::MessageGUID guid;
+        MessageGUIDGenerator::loadNextGUID(&guid,
+                                           d_rangeMessage.messageGUID());
+        d_rangeMessage.setMessageGUID(guid);
+
+        return rc_HAS_NEXT;  // RETURN
+    }
+
     if (d_blobIter.advance(d_advanceLength) == false) {
         d_header.reset();
         return rc_AT_END;  // RETURN
@@ -100,6 +122,32 @@ int AckMessageIterator::next()
         return rc_NOT_ENOUGH_BYTES;  // RETURN
     }
 
+    if (isRangeEncoded()) {
+        mwcu::BlobObjectProxy<AckMessageRange> range(
+            d_blobIter.blob(),
+            d_blobIter.position(),
+            d_header->perMessageWords() * Protocol::k_WORD_SIZE,
+            true,
+            false);
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!range.isSet())) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            return rc_NOT_ENOUGH_BYTES;  // RETURN
+        }
+
+        // All the correlation Ids of the range must be valid.
+        const int count    = range->count();
+        const int maxCount = AckMessage::k_MAX_CORRELATION_ID + 1 -
+                             range->firstMessage().correlationId();
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(count <= 0 ||
+                                                  count > maxCount)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            return rc_INVALID_RANGE;  // RETURN
+        }
+
+        d_rangeMessage   = range->firstMessage();
+        d_rangeRemaining = count - 1;
+    }
+
     return rc_HAS_NEXT;
 }
 
@@ -123,6 +171,9 @@ int AckMessageIterator::reset(const bdlbb::Blob* blob,
         rc_NOT_ENOUGH_BYTES = -3  // The number of bytes in the blob is less
                                   // than the header size declared in the
                                   // header
+        ,
+        rc_INVALID_RANGES = -4  // The header declares ranges smaller than
+                                // an 'AckMessageRange'
     };
 
     d_blobIter.reset(blob, mwcu::BlobPosition(), blob->length(), true);
@@ -171,8 +222,18 @@ int AckMessageIterator::reset(const bdlbb::Blob* blob,
         return rc_INVALID_ACKHEADER;  // RETURN
     }
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            isRangeEncoded() &&
+            d_header->perMessageWords() * Protocol::k_WORD_SIZE <
+                static_cast<int>(sizeof(AckMessageRange)))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        d_header.reset();
+        return rc_INVALID_RANGES;  // RETURN
+    }
+
     // Reset the current message
     d_message.reset();
+    d_rangeRemaining = 0;
 
     // Below code snippet is needed so that 'next()' works seamlessly during
     // first invocation too, by skipping over the 'AckHeader'.
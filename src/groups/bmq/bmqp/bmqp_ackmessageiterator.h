@@ -25,6 +25,14 @@
 //@DESCRIPTION: 'bmqp::AckMessageIterator' is an iterator-like mechanism
 // providing read-only sequential access to messages contained into a AckEvent.
 //
+/// Range encoding
+///--------------
+// If the 'AckHeaderFlags::e_RANGES' flag is set in the 'AckHeader' of the
+// event, the payload is made of 'AckMessageRange' (see
+// 'bmqp::AckEventBuilder').  The iterator transparently expands each range,
+// so that each message of the range is returned, in order, by successive
+// calls to 'next()', exactly as if the event was made of 'AckMessage'.
+//
 /// Error handling: Logging and Assertion
 ///-------------------------------------
 //: o logging: This iterator will not log anything in case of invalid data:
@@ -93,6 +101,15 @@ class AckMessageIterator {
     // How much should we advance in
     // 'next()'.
 
+    AckMessage d_rangeMessage;
+    // Current message, if the event is
+    // made of ranges.
+
+    int d_rangeRemaining;
+    // Number of messages remaining in the
+    // current range after the current
+    // message.
+
   private:
     // PRIVATE MANIPULATORS
 
@@ -165,6 +182,10 @@ class AckMessageIterator {
     /// is undefined unless `isValid` returns true.
     const AckHeader& header() const;
 
+    /// Return true if the event is made of `AckMessageRange`s, and false
+    /// otherwise.  Behavior is undefined unless `isValid` returns true.
+    bool isRangeEncoded() const;
+
     /// Return a const reference to the message currently point to by this
     /// iterator.  Behavior is undefined unless latest call to `next()`
     /// returned 1.
@@ -183,6 +204,8 @@ class AckMessageIterator {
 inline AckMessageIterator::AckMessageIterator()
 : d_blobIter(0, mwcu::BlobPosition(), 0, true)
 , d_advanceLength(0)
+, d_rangeMessage()
+, d_rangeRemaining(0)
 {
     // NOTHING
 }
@@ -216,7 +239,8 @@ inline void AckMessageIterator::clear()
     d_blobIter.reset(0, mwcu::BlobPosition(), 0, true);
     d_header.reset();
     d_message.reset();
-    d_advanceLength = 0;
+    d_advanceLength  = 0;
+    d_rangeRemaining = 0;
 }
 
 // ACCESSORS
@@ -233,11 +257,23 @@ inline const AckHeader& AckMessageIterator::header() const
     return *d_header;
 }
 
+inline bool AckMessageIterator::isRangeEncoded() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isValid());
+
+    return d_header->flags() & AckHeaderFlags::e_RANGES;
+}
+
 inline const AckMessage& AckMessageIterator::message() const
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(isValid());
 
+    if (isRangeEncoded()) {
+        return d_rangeMessage;  // RETURN
+    }
+
     return *d_message;
 }
 
@@ -17,6 +17,7 @@
 #include <bmqp_ackmessageiterator.h>
 
 // BMQ
+#include <bmqp_messageguidgenerator.h>
 #include <bmqp_protocol.h>
 #include <bmqt_messageguid.h>
 
@@ -160,6 +161,49 @@ void populateBlob(bdlbb::Blob*             blob,
                             sizeof(bmqp::AckMessage));
 }
 
+/// Populate the specified `blob` with an ACK event made of one
+/// `AckMessageRange` having the specified `status`, `corrId`, `guid`,
+/// `queueId` and `count`, and load its header into the specified `eh`.
+void populateRangeBlob(bdlbb::Blob*             blob,
+                       bmqp::EventHeader*       eh,
+                       int                      status,
+                       int                      corrId,
+                       const bmqt::MessageGUID& guid,
+                       int                      queueId,
+                       int                      count)
+{
+    int eventLength = sizeof(bmqp::EventHeader) + sizeof(bmqp::AckHeader) +
+                      sizeof(bmqp::AckMessageRange);
+
+    // EventHeader
+    (*eh)
+        .setLength(eventLength)
+        .setType(bmqp::EventType::e_ACK)
+        .setHeaderWords(sizeof(bmqp::EventHeader) /
+                        bmqp::Protocol::k_WORD_SIZE);
+    bdlbb::BlobUtil::append(blob,
+                            reinterpret_cast<const char*>(eh),
+                            sizeof(bmqp::EventHeader));
+
+    // AckHeader
+    bmqp::AckHeader ah;
+    ah.setFlags(bmqp::AckHeaderFlags::e_RANGES)
+        .setHeaderWords(sizeof(bmqp::AckHeader) / bmqp::Protocol::k_WORD_SIZE)
+        .setPerMessageWords(sizeof(bmqp::AckMessageRange) /
+                            bmqp::Protocol::k_WORD_SIZE);
+
+    bdlbb::BlobUtil::append(blob,
+                            reinterpret_cast<const char*>(&ah),
+                            sizeof(bmqp::AckHeader));
+
+    const bmqp::AckMessage      ackMessage(status, corrId, guid, queueId);
+    const bmqp::AckMessageRange range(ackMessage, count);
+
+    bdlbb::BlobUtil::append(blob,
+                            reinterpret_cast<const char*>(&range),
+                            sizeof(bmqp::AckMessageRange));
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -642,6 +686,121 @@ static void test5_dumpBlob()
     }
 }
 
+static void test6_rangeEncodedEvent()
+{
+    // --------------------------------------------------------------------
+    // RANGE ENCODED EVENT
+    //
+    // Concerns:
+    //   1. Each 'AckMessageRange' of a range encoded event is expanded
+    //      into as many messages as its count, having consecutive
+    //      correlationIds and GUIDs.
+    //   2. Iterating over a range having an invalid count fails.
+    //   3. An event declaring ranges smaller than 'AckMessageRange' is
+    //      invalid.
+    //
+    // Plan:
+    //   1. Create a blob containing one range and iterate over it.
+    //   2. Create blobs containing a range of zero message, and a range
+    //      overflowing the correlationIds, and iterate over them.
+    //   3. Create a blob with the 'e_RANGES' flag, but containing
+    //      'AckMessage' and initialize an iterator with it.
+    //
+    // Testing:
+    //   bool isRangeEncoded() const;
+    //   int next();
+    // --------------------------------------------------------------------
+    mwctst::TestHelper::printTestName("RANGE ENCODED EVENT");
+
+    const int k_CORR_ID  = 54321;
+    const int k_STATUS   = 0;
+    const int k_QUEUE_ID = 9876;
+    const int k_COUNT    = 10;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    bmqp::EventHeader              eventHeader;
+    bmqt::MessageGUID              guid;
+    guid.fromHex("0000000000003039CD8101000000270F");
+
+    {
+        PVV("Valid range");
+        bdlbb::Blob blob(&bufferFactory, s_allocator_p);
+        populateRangeBlob(&blob,
+                          &eventHeader,
+                          k_STATUS,
+                          k_CORR_ID,
+                          guid,
+                          k_QUEUE_ID,
+                          k_COUNT);
+
+        bmqp::AckMessageIterator iter(&blob, eventHeader);
+        ASSERT(iter.isValid());
+        ASSERT(iter.isRangeEncoded());
+
+        bmqt::MessageGUID expectedGUID = guid;
+        for (int i = 0; i < k_COUNT; ++i) {
+            ASSERT_EQ_D(i, iter.next(), 1);
+            ASSERT_EQ_D(i, iter.message().status(), k_STATUS);
+            ASSERT_EQ_D(i, iter.message().correlationId(), k_CORR_ID + i);
+            ASSERT_EQ_D(i, iter.message().messageGUID(), expectedGUID);
+            ASSERT_EQ_D(i, iter.message().queueId(), k_QUEUE_ID);
+
+            bmqt::MessageGUID next;
+            bmqp::MessageGUIDGenerator::loadNextGUID(&next, expectedGUID);
+            expectedGUID = next;
+        }
+        ASSERT_EQ(iter.next(), 0);
+        ASSERT_EQ(iter.isValid(), false);
+    }
+
+    {
+        PVV("Empty range");
+        bdlbb::Blob blob(&bufferFactory, s_allocator_p);
+        populateRangeBlob(&blob,
+                          &eventHeader,
+                          k_STATUS,
+                          k_CORR_ID,
+                          guid,
+                          k_QUEUE_ID,
+                          0);
+
+        bmqp::AckMessageIterator iter(&blob, eventHeader);
+        ASSERT(iter.isValid());
+        ASSERT_LT(iter.next(), 0);  // rc_INVALID_RANGE
+    }
+
+    {
+        PVV("Range overflowing the correlationIds");
+        bdlbb::Blob blob(&bufferFactory, s_allocator_p);
+        populateRangeBlob(&blob,
+                          &eventHeader,
+                          k_STATUS,
+                          bmqp::AckMessage::k_MAX_CORRELATION_ID,
+                          guid,
+                          k_QUEUE_ID,
+                          2);
+
+        bmqp::AckMessageIterator iter(&blob, eventHeader);
+        ASSERT(iter.isValid());
+        ASSERT_LT(iter.next(), 0);  // rc_INVALID_RANGE
+    }
+
+    {
+        PVV("Ranges smaller than AckMessageRange");
+        bdlbb::Blob blob(&bufferFactory, s_allocator_p);
+        populateBlob(&blob,
+                     &eventHeader,
+                     k_STATUS,
+                     k_CORR_ID,
+                     guid,
+                     k_QUEUE_ID,
+                     bmqp::AckHeaderFlags::e_RANGES);
+
+        bmqp::AckMessageIterator iter(&blob, eventHeader);
+        ASSERT_EQ(iter.isValid(), false);
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -652,6 +811,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 6: test6_rangeEncodedEvent(); break;
     case 5: test5_dumpBlob(); break;
     case 4: test4_resetMethod(); break;
     case 3: test3_nextMethod(); break;
@@ -17,17 +17,29 @@
 #include <bmqp_compression.h>
 
 #include <bmqscm_version.h>
+// BMQ
+#include <bmqp_compressiondictionary.h>
+
 // MWC
 #include <mwcu_blob.h>
 
 // BDE
 #include <bdlbb_blobutil.h>
 #include <bdlma_sequentialallocator.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
 #include <bslma_allocator.h>
+#include <bsls_annotation.h>
 
 // ZLIB
 #include <zlib.h>
 
+// LZ4
+#include <lz4frame.h>
+
+// ZSTD
+#include <zstd.h>
+
 // MemorySanitizer
 #if defined(__has_feature)
 #if __has_feature(memory_sanitizer)
@@ -298,6 +310,350 @@ int ZLib::writeOutput(bdlbb::Blob*              output,
     return rc_SUCCESS;
 }
 
+// ======================
+// class BlobOutputCursor
+// ======================
+
+/// This mechanism provides a writable window into the trailing data buffer
+/// of a blob, allocating buffers from a factory as needed.  It is used by
+/// the streaming LZ4 and ZSTD routines, which write into a caller-provided
+/// contiguous region on each call.
+class BlobOutputCursor {
+  private:
+    // DATA
+    bdlbb::Blob*              d_output_p;   // blob to append data to
+
+    bdlbb::BlobBufferFactory* d_factory_p;  // factory for data buffers
+
+    bdlbb::BlobBuffer         d_buffer;     // current data buffer
+
+    int                       d_position;   // bytes written in 'd_buffer'
+
+  private:
+    // NOT IMPLEMENTED
+    BlobOutputCursor(const BlobOutputCursor&);
+    BlobOutputCursor& operator=(const BlobOutputCursor&);
+
+  public:
+    // CREATORS
+
+    /// Create a cursor appending to the specified `output`, using the
+    /// specified `factory` to supply data buffers.
+    BlobOutputCursor(bdlbb::Blob* output, bdlbb::BlobBufferFactory* factory);
+
+    // MANIPULATORS
+
+    /// Return the address of the free space in the current data buffer,
+    /// and load its size into the specified `available`.  If the current
+    /// buffer is full, append it to the output and allocate a new one.
+    char* reserve(size_t* available);
+
+    /// Return the address of the free space in the current data buffer,
+    /// and load its size into the specified `available`, if it is at least
+    /// the specified `minimum`.  Otherwise, append the current data buffer
+    /// to the output, leaving the rest of it unused, and do the same with a
+    /// new one.  Return 0 if even a new data buffer is smaller than
+    /// `minimum`.
+    char* reserve(size_t* available, size_t minimum);
+
+    /// Mark the specified `numBytes` of the space last returned by
+    /// `reserve` as written.
+    void commit(size_t numBytes);
+
+    /// Append any partially written data buffer to the output.
+    void finish();
+};
+
+// ----------------------
+// class BlobOutputCursor
+// ----------------------
+
+BlobOutputCursor::BlobOutputCursor(bdlbb::Blob*              output,
+                                   bdlbb::BlobBufferFactory* factory)
+: d_output_p(output)
+, d_factory_p(factory)
+, d_buffer()
+, d_position(0)
+{
+    // NOTHING
+}
+
+char* BlobOutputCursor::reserve(size_t* available)
+{
+    if (d_position == d_buffer.size()) {
+        if (d_position) {
+            // Append the previous (full) data buffer to output.
+            d_output_p->appendDataBuffer(d_buffer);
+        }
+        d_factory_p->allocate(&d_buffer);
+        d_position = 0;
+    }
+
+    *available = d_buffer.size() - d_position;
+    return d_buffer.data() + d_position;
+}
+
+char* BlobOutputCursor::reserve(size_t* available, size_t minimum)
+{
+    char* out = reserve(available);
+    if (*available < minimum && d_position) {
+        finish();
+        out = reserve(available);
+    }
+
+    return *available < minimum ? 0 : out;
+}
+
+void BlobOutputCursor::commit(size_t numBytes)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_position + numBytes <=
+                     static_cast<size_t>(d_buffer.size()));
+
+    d_position += static_cast<int>(numBytes);
+}
+
+void BlobOutputCursor::finish()
+{
+    if (d_position) {
+        d_buffer.setSize(d_position);
+        d_output_p->appendDataBuffer(d_buffer);
+        d_buffer.reset();
+        d_position = 0;
+    }
+}
+
+// ==========
+// struct Lz4
+// ==========
+
+/// This struct provides the utility functions for enabling compression
+/// using the LZ4 frame format.
+struct Lz4 {
+    // CONSTANTS
+
+    /// Maximum size of the blocks of the LZ4 frames, as per
+    /// `preferences()`.
+    static const int k_BLOCK_SIZE = 64 * 1024;
+
+    // CLASS METHODS
+
+    /// Return the preferences used for compressing LZ4 frames.
+    static LZ4F_preferences_t preferences();
+
+    /// If the specified `stream` is non-zero, output the specified
+    /// `baseMessage`, followed by the description of the specified LZ4
+    /// error `code`.
+    static void setError(bsl::ostream*            stream,
+                         const bslstl::StringRef& baseMessage,
+                         size_t                   code);
+
+    /// If the specified `stream` is non-zero, output the specified
+    /// `baseMessage`, followed by the description of the failure to get
+    /// enough free space in a blob buffer.
+    static void setBufferError(bsl::ostream*            stream,
+                               const bslstl::StringRef& baseMessage);
+};
+
+// ----------
+// struct Lz4
+// ----------
+
+LZ4F_preferences_t Lz4::preferences()
+{
+    LZ4F_preferences_t prefs;
+    bsl::memset(&prefs, 0, sizeof(prefs));
+
+    // Flush on every update so the output bound is known for each input
+    // buffer, and make blocks independent since each message is compressed
+    // on its own.
+    prefs.autoFlush             = 1;
+    prefs.frameInfo.blockMode   = LZ4F_blockIndependent;
+    prefs.frameInfo.blockSizeID = LZ4F_max64KB;
+
+    return prefs;
+}
+
+void Lz4::setError(bsl::ostream*            stream,
+                   const bslstl::StringRef& baseMessage,
+                   size_t                   code)
+{
+    if (stream) {
+        (*stream) << baseMessage << ", Message: " << LZ4F_getErrorName(code);
+    }
+}
+
+void Lz4::setBufferError(bsl::ostream*            stream,
+                         const bslstl::StringRef& baseMessage)
+{
+    if (stream) {
+        (*stream) << baseMessage << ", Message: "
+                  << "blob buffers are too small";
+    }
+}
+
+// ===========
+// struct Zstd
+// ===========
+
+/// This struct provides the utility functions for enabling compression
+/// using the Zstandard frame format.
+struct Zstd {
+    // CLASS METHODS
+
+    /// If the specified `stream` is non-zero, output the specified
+    /// `baseMessage`, followed by the description of the specified ZSTD
+    /// error `code`.
+    static void setError(bsl::ostream*            stream,
+                         const bslstl::StringRef& baseMessage,
+                         size_t                   code);
+
+    /// Compress the specified `input` with the specified `context` and
+    /// write the resulting frame to the specified `output`.  Return 0 on
+    /// success and non-zero otherwise, in which case a message is written
+    /// to the specified `errorStream` if it is non-zero.
+    static int compressStream(BlobOutputCursor*  output,
+                              ZSTD_CCtx*         context,
+                              bsl::ostream*      errorStream,
+                              const bdlbb::Blob& input);
+
+    /// Decompress the specified `input` with the specified `context` and
+    /// write the resulting data to the specified `output`.  Return 0 on
+    /// success and non-zero otherwise, in which case a message is written
+    /// to the specified `errorStream` if it is non-zero.
+    static int decompressStream(BlobOutputCursor*  output,
+                                ZSTD_DCtx*         context,
+                                bsl::ostream*      errorStream,
+                                const bdlbb::Blob& input);
+};
+
+// -----------
+// struct Zstd
+// -----------
+
+void Zstd::setError(bsl::ostream*            stream,
+                    const bslstl::StringRef& baseMessage,
+                    size_t                   code)
+{
+    if (stream) {
+        (*stream) << baseMessage << ", Message: " << ZSTD_getErrorName(code);
+    }
+}
+
+int Zstd::compressStream(BlobOutputCursor*  output,
+                         ZSTD_CCtx*         context,
+                         bsl::ostream*      errorStream,
+                         const bdlbb::Blob& input)
+{
+    enum RcEnum {
+        rc_SUCCESS                = 0,
+        rc_STREAM_PROCESS_FAILURE = -2,
+        rc_STREAM_END_FAILURE     = -3
+    };
+
+    size_t result;
+
+    // Process input data until all input buffers have been read.
+    for (int i = 0; i < input.numDataBuffers(); ++i) {
+        ZSTD_inBuffer in = {input.buffer(i).data(),
+                            static_cast<size_t>(
+                                mwcu::BlobUtil::bufferSize(input, i)),
+                            0};
+        while (in.pos < in.size) {
+            ZSTD_outBuffer out = {0, 0, 0};
+            out.dst            = output->reserve(&out.size);
+
+            result = ZSTD_compressStream2(context, &out, &in, ZSTD_e_continue);
+            if (ZSTD_isError(result)) {
+                setError(errorStream, "Error processing stream", result);
+                return rc_STREAM_PROCESS_FAILURE;  // RETURN
+            }
+            output->commit(out.pos);
+        }
+    }
+
+    // Flush the frame epilogue, until the library reports nothing remains.
+    do {
+        ZSTD_inBuffer  in  = {0, 0, 0};
+        ZSTD_outBuffer out = {0, 0, 0};
+        out.dst            = output->reserve(&out.size);
+
+        result = ZSTD_compressStream2(context, &out, &in, ZSTD_e_end);
+        if (ZSTD_isError(result)) {
+            setError(errorStream, "Error finishing stream", result);
+            return rc_STREAM_END_FAILURE;  // RETURN
+        }
+        output->commit(out.pos);
+    } while (0 != result);
+
+    output->finish();
+
+    return rc_SUCCESS;
+}
+
+int Zstd::decompressStream(BlobOutputCursor*  output,
+                           ZSTD_DCtx*         context,
+                           bsl::ostream*      errorStream,
+                           const bdlbb::Blob& input)
+{
+    enum RcEnum {
+        rc_SUCCESS                = 0,
+        rc_STREAM_PROCESS_FAILURE = -2,
+        rc_STREAM_END_FAILURE     = -3
+    };
+
+    // 'result' is 0 once a frame is fully decoded and flushed, and
+    // 'fullOutput' indicates that the last call filled the whole output
+    // window, in which case the library may hold more decoded data.
+    size_t result     = 1;
+    bool   fullOutput = false;
+
+    for (int i = 0; i < input.numDataBuffers(); ++i) {
+        ZSTD_inBuffer in = {input.buffer(i).data(),
+                            static_cast<size_t>(
+                                mwcu::BlobUtil::bufferSize(input, i)),
+                            0};
+        while (in.pos < in.size) {
+            ZSTD_outBuffer out = {0, 0, 0};
+            out.dst            = output->reserve(&out.size);
+
+            result = ZSTD_decompressStream(context, &out, &in);
+            if (ZSTD_isError(result)) {
+                setError(errorStream, "Error processing stream", result);
+                return rc_STREAM_PROCESS_FAILURE;  // RETURN
+            }
+            output->commit(out.pos);
+            fullOutput = (out.pos == out.size);
+        }
+    }
+
+    while (0 != result && fullOutput) {
+        ZSTD_inBuffer  in  = {0, 0, 0};
+        ZSTD_outBuffer out = {0, 0, 0};
+        out.dst            = output->reserve(&out.size);
+
+        result = ZSTD_decompressStream(context, &out, &in);
+        if (ZSTD_isError(result)) {
+            setError(errorStream, "Error finishing stream", result);
+            return rc_STREAM_END_FAILURE;  // RETURN
+        }
+        output->commit(out.pos);
+        fullOutput = (out.pos == out.size);
+    }
+
+    if (0 != result) {
+        if (errorStream) {
+            (*errorStream) << "Error finishing stream, Message: "
+                           << "truncated input";
+        }
+        return rc_STREAM_END_FAILURE;  // RETURN
+    }
+
+    output->finish();
+
+    return rc_SUCCESS;
+}
+
 }  // close unnamed namespace
 
 // ==================
@@ -310,6 +666,23 @@ int Compression::compress(bdlbb::Blob*                         output,
                           const bdlbb::Blob&                   input,
                           bsl::ostream*                        errorStream,
                           bslma::Allocator*                    allocator)
+{
+    return compress(output,
+                    factory,
+                    algorithm,
+                    k_ZSTD_DEFAULT_LEVEL,
+                    input,
+                    errorStream,
+                    allocator);
+}
+
+int Compression::compress(bdlbb::Blob*                         output,
+                          bdlbb::BlobBufferFactory*            factory,
+                          bmqt::CompressionAlgorithmType::Enum algorithm,
+                          int                                  zstdLevel,
+                          const bdlbb::Blob&                   input,
+                          bsl::ostream*                        errorStream,
+                          bslma::Allocator*                    allocator)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(output);
@@ -325,6 +698,19 @@ int Compression::compress(bdlbb::Blob*                         output,
                                               Z_DEFAULT_COMPRESSION,
                                               errorStream,
                                               allocator);  // RETURN
+    case bmqt::CompressionAlgorithmType::e_LZ4:
+        return Compression_Impl::compressLz4(output,
+                                             factory,
+                                             input,
+                                             errorStream,
+                                             allocator);  // RETURN
+    case bmqt::CompressionAlgorithmType::e_ZSTD:
+        return Compression_Impl::compressZstd(output,
+                                              factory,
+                                              input,
+                                              zstdLevel,
+                                              errorStream,
+                                              allocator);  // RETURN
     case bmqt::CompressionAlgorithmType::e_NONE:
         if (output->length() == 0) {
             *output = input;
@@ -355,7 +741,9 @@ int Compression::compress(bdlbb::Blob*                         output,
 
     bdlbb::Blob inputBlob(factory, allocator);
     switch (algorithm) {
-    case bmqt::CompressionAlgorithmType::e_ZLIB: {
+    case bmqt::CompressionAlgorithmType::e_ZLIB:
+    case bmqt::CompressionAlgorithmType::e_LZ4:
+    case bmqt::CompressionAlgorithmType::e_ZSTD: {
         bsl::shared_ptr<char> inputBufferSp(const_cast<char*>(input),
                                             bslstl::SharedPtrNilDeleter(),
                                             allocator);
@@ -365,12 +753,12 @@ int Compression::compress(bdlbb::Blob*                         output,
             inputBlob.appendDataBuffer(inputBlobBuffer);
         }
 
-        return Compression_Impl::compressZlib(output,
-                                              factory,
-                                              inputBlob,
-                                              Z_DEFAULT_COMPRESSION,
-                                              errorStream,
-                                              allocator);  // RETURN
+        return compress(output,
+                        factory,
+                        algorithm,
+                        inputBlob,
+                        errorStream,
+                        allocator);  // RETURN
     }
     case bmqt::CompressionAlgorithmType::e_NONE:
         // deep copy of input character array to output Blob
@@ -381,6 +769,26 @@ int Compression::compress(bdlbb::Blob*                         output,
     }
 }
 
+int Compression::compress(bdlbb::Blob*                 output,
+                          bdlbb::BlobBufferFactory*    factory,
+                          const CompressionDictionary& dictionary,
+                          const bdlbb::Blob&           input,
+                          bsl::ostream*                errorStream,
+                          bslma::Allocator*            allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(output);
+    BSLS_ASSERT_SAFE(factory);
+    BSLS_ASSERT_SAFE(dictionary.isValid());
+
+    return Compression_Impl::compressZstd(output,
+                                          factory,
+                                          input,
+                                          dictionary,
+                                          errorStream,
+                                          allocator);
+}
+
 int Compression::decompress(bdlbb::Blob*                         output,
                             bdlbb::BlobBufferFactory*            factory,
                             bmqt::CompressionAlgorithmType::Enum algorithm,
@@ -397,6 +805,18 @@ int Compression::decompress(bdlbb::Blob*                         output,
                                                 input,
                                                 errorStream,
                                                 allocator);  // RETURN
+    case bmqt::CompressionAlgorithmType::e_LZ4:
+        return Compression_Impl::decompressLz4(output,
+                                               factory,
+                                               input,
+                                               errorStream,
+                                               allocator);  // RETURN
+    case bmqt::CompressionAlgorithmType::e_ZSTD:
+        return Compression_Impl::decompressZstd(output,
+                                                factory,
+                                                input,
+                                                errorStream,
+                                                allocator);  // RETURN
     case bmqt::CompressionAlgorithmType::e_NONE:
         if (output->length() == 0) {
             *output = input;
@@ -483,5 +903,329 @@ int Compression_Impl::decompressZlib(bdlbb::Blob*              output,
                              &::inflateEnd);
 }
 
+int Compression_Impl::compressLz4(bdlbb::Blob*              output,
+                                  bdlbb::BlobBufferFactory* factory,
+                                  const bdlbb::Blob&        input,
+                                  bsl::ostream*             errorStream,
+                                  BSLS_ANNOTATION_UNUSED bslma::Allocator*
+                                      allocator)
+{
+    enum RcEnum {
+        rc_SUCCESS                = 0,
+        rc_STREAM_INIT_FAILURE    = -1,
+        rc_STREAM_PROCESS_FAILURE = -2,
+        rc_STREAM_END_FAILURE     = -3
+    };
+
+    // The LZ4 frame API requires the destination of each call to be large
+    // enough for the worst case of its input.  With auto-flush, that bound
+    // is the size of the input plus a per-block overhead, so the input is fed
+    // by chunks fitting in the free space of the current output buffer.
+    const LZ4F_preferences_t prefs    = Lz4::preferences();
+    const size_t             overhead = LZ4F_compressBound(1, &prefs) - 1;
+    const size_t             endSize  = LZ4F_compressBound(0, &prefs);
+
+    LZ4F_cctx*   context = 0;
+    const size_t rc = LZ4F_createCompressionContext(&context, LZ4F_VERSION);
+    if (LZ4F_isError(rc)) {
+        Lz4::setError(errorStream, "Error initializing LZ4 context", rc);
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+
+    BlobOutputCursor cursor(output, factory);
+    int              status    = rc_SUCCESS;
+    size_t           available = 0;
+    size_t           result    = 0;
+
+    char* dst = cursor.reserve(&available, LZ4F_HEADER_SIZE_MAX);
+    if (!dst) {
+        Lz4::setBufferError(errorStream, "Error initializing LZ4 frame");
+        status = rc_STREAM_INIT_FAILURE;
+    }
+    else {
+        result = LZ4F_compressBegin(context, dst, available, &prefs);
+        if (LZ4F_isError(result)) {
+            Lz4::setError(errorStream, "Error initializing LZ4 frame", result);
+            status = rc_STREAM_INIT_FAILURE;
+        }
+        else {
+            cursor.commit(result);
+        }
+    }
+
+    for (int i = 0; rc_SUCCESS == status && i < input.numDataBuffers(); ++i) {
+        const char* src     = input.buffer(i).data();
+        size_t      srcLeft = mwcu::BlobUtil::bufferSize(input, i);
+
+        while (srcLeft) {
+            dst = cursor.reserve(&available, overhead + 1);
+            if (!dst) {
+                Lz4::setBufferError(errorStream, "Error processing stream");
+                status = rc_STREAM_PROCESS_FAILURE;
+                break;  // BREAK
+            }
+
+            const size_t srcSize = bsl::min(
+                bsl::min(srcLeft, available - overhead),
+                static_cast<size_t>(Lz4::k_BLOCK_SIZE));
+
+            result = LZ4F_compressUpdate(context,
+                                         dst,
+                                         available,
+                                         src,
+                                         srcSize,
+                                         0);
+            if (LZ4F_isError(result)) {
+                Lz4::setError(errorStream, "Error processing stream", result);
+                status = rc_STREAM_PROCESS_FAILURE;
+                break;  // BREAK
+            }
+            cursor.commit(result);
+            src += srcSize;
+            srcLeft -= srcSize;
+        }
+    }
+
+    if (rc_SUCCESS == status) {
+        dst = cursor.reserve(&available, endSize);
+        if (!dst) {
+            Lz4::setBufferError(errorStream, "Error finishing stream");
+            status = rc_STREAM_END_FAILURE;
+        }
+        else {
+            result = LZ4F_compressEnd(context, dst, available, 0);
+            if (LZ4F_isError(result)) {
+                Lz4::setError(errorStream, "Error finishing stream", result);
+                status = rc_STREAM_END_FAILURE;
+            }
+            else {
+                cursor.commit(result);
+            }
+        }
+    }
+
+    LZ4F_freeCompressionContext(context);
+
+    if (rc_SUCCESS != status) {
+        return status;  // RETURN
+    }
+
+    cursor.finish();
+
+    return rc_SUCCESS;
+}
+
+int Compression_Impl::decompressLz4(bdlbb::Blob*              output,
+                                    bdlbb::BlobBufferFactory* factory,
+                                    const bdlbb::Blob&        input,
+                                    bsl::ostream*             errorStream,
+                                    BSLS_ANNOTATION_UNUSED bslma::Allocator*
+                                        allocator)
+{
+    enum RcEnum {
+        rc_SUCCESS                = 0,
+        rc_STREAM_INIT_FAILURE    = -1,
+        rc_STREAM_PROCESS_FAILURE = -2,
+        rc_STREAM_END_FAILURE     = -3
+    };
+
+    LZ4F_dctx*   context = 0;
+    const size_t rc = LZ4F_createDecompressionContext(&context, LZ4F_VERSION);
+    if (LZ4F_isError(rc)) {
+        Lz4::setError(errorStream, "Error initializing LZ4 context", rc);
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+
+    // 'result' is 0 once a frame is fully decoded and flushed, and
+    // 'fullOutput' indicates that the last call filled the whole output
+    // window, in which case the library may hold more decoded data.
+    BlobOutputCursor cursor(output, factory);
+    int              status     = rc_SUCCESS;
+    size_t           result     = 1;
+    bool             fullOutput = false;
+
+    for (int i = 0; rc_SUCCESS == status && i < input.numDataBuffers(); ++i) {
+        const char* src     = input.buffer(i).data();
+        size_t      srcLeft = mwcu::BlobUtil::bufferSize(input, i);
+
+        while (srcLeft) {
+            size_t available;
+            char*  dst     = cursor.reserve(&available);
+            size_t dstSize = available;
+            size_t srcSize = srcLeft;
+
+            result = LZ4F_decompress(context, dst, &dstSize, src, &srcSize, 0);
+            if (LZ4F_isError(result)) {
+                Lz4::setError(errorStream, "Error processing stream", result);
+                status = rc_STREAM_PROCESS_FAILURE;
+                break;  // BREAK
+            }
+            cursor.commit(dstSize);
+            fullOutput = (dstSize == available);
+            src += srcSize;
+            srcLeft -= srcSize;
+        }
+    }
+
+    while (rc_SUCCESS == status && 0 != result && fullOutput) {
+        size_t available;
+        char*  dst     = cursor.reserve(&available);
+        size_t dstSize = available;
+        size_t srcSize = 0;
+
+        result = LZ4F_decompress(context, dst, &dstSize, 0, &srcSize, 0);
+        if (LZ4F_isError(result)) {
+            Lz4::setError(errorStream, "Error finishing stream", result);
+            status = rc_STREAM_END_FAILURE;
+            break;  // BREAK
+        }
+        cursor.commit(dstSize);
+        fullOutput = (dstSize == available);
+    }
+
+    LZ4F_freeDecompressionContext(context);
+
+    if (rc_SUCCESS != status) {
+        return status;  // RETURN
+    }
+
+    if (0 != result) {
+        if (errorStream) {
+            (*errorStream) << "Error finishing stream, Message: "
+                           << "truncated input";
+        }
+        return rc_STREAM_END_FAILURE;  // RETURN
+    }
+
+    cursor.finish();
+
+    return rc_SUCCESS;
+}
+
+int Compression_Impl::compressZstd(bdlbb::Blob*              output,
+                                   bdlbb::BlobBufferFactory* factory,
+                                   const bdlbb::Blob&        input,
+                                   int                       level,
+                                   bsl::ostream*             errorStream,
+                                   BSLS_ANNOTATION_UNUSED bslma::Allocator*
+                                       allocator)
+{
+    enum RcEnum { rc_SUCCESS = 0, rc_STREAM_INIT_FAILURE = -1 };
+
+    ZSTD_CCtx* context = ZSTD_createCCtx();
+    if (!context) {
+        if (errorStream) {
+            (*errorStream) << "Error initializing ZSTD context";
+        }
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+
+    const size_t result = ZSTD_CCtx_setParameter(context,
+                                                 ZSTD_c_compressionLevel,
+                                                 level);
+    if (ZSTD_isError(result)) {
+        Zstd::setError(errorStream, "Error setting compression level", result);
+        ZSTD_freeCCtx(context);
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+
+    BlobOutputCursor cursor(output, factory);
+    const int rc = Zstd::compressStream(&cursor, context, errorStream, input);
+
+    ZSTD_freeCCtx(context);
+
+    return rc;
+}
+
+int Compression_Impl::compressZstd(bdlbb::Blob*                 output,
+                                   bdlbb::BlobBufferFactory*    factory,
+                                   const bdlbb::Blob&           input,
+                                   const CompressionDictionary& dictionary,
+                                   bsl::ostream*                errorStream,
+                                   BSLS_ANNOTATION_UNUSED bslma::Allocator*
+                                       allocator)
+{
+    enum RcEnum { rc_SUCCESS = 0, rc_STREAM_INIT_FAILURE = -1 };
+
+    ZSTD_CCtx* context = ZSTD_createCCtx();
+    if (!context) {
+        if (errorStream) {
+            (*errorStream) << "Error initializing ZSTD context";
+        }
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+
+    const size_t result = ZSTD_CCtx_refCDict(context,
+                                             dictionary.compressionDict());
+    if (ZSTD_isError(result)) {
+        Zstd::setError(errorStream, "Error referencing dictionary", result);
+        ZSTD_freeCCtx(context);
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+
+    BlobOutputCursor cursor(output, factory);
+    const int rc = Zstd::compressStream(&cursor, context, errorStream, input);
+
+    ZSTD_freeCCtx(context);
+
+    return rc;
+}
+
+int Compression_Impl::decompressZstd(bdlbb::Blob*              output,
+                                     bdlbb::BlobBufferFactory* factory,
+                                     const bdlbb::Blob&        input,
+                                     bsl::ostream*             errorStream,
+                                     BSLS_ANNOTATION_UNUSED bslma::Allocator*
+                                         allocator)
+{
+    enum RcEnum {
+        rc_SUCCESS             = 0,
+        rc_STREAM_INIT_FAILURE = -1,
+        rc_UNKNOWN_DICTIONARY  = -4
+    };
+
+    const CompressionDictionary* dictionary = 0;
+    const unsigned int dictionaryId = CompressionDictionary::frameDictionaryId(
+        input);
+    if (dictionaryId) {
+        dictionary = CompressionDictionaryRegistry::lookup(dictionaryId);
+        if (!dictionary) {
+            if (errorStream) {
+                (*errorStream) << "Unknown ZSTD dictionary: " << dictionaryId;
+            }
+            return rc_UNKNOWN_DICTIONARY;  // RETURN
+        }
+    }
+
+    ZSTD_DCtx* context = ZSTD_createDCtx();
+    if (!context) {
+        if (errorStream) {
+            (*errorStream) << "Error initializing ZSTD context";
+        }
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+
+    if (dictionary) {
+        const size_t result = ZSTD_DCtx_refDDict(
+            context,
+            dictionary->decompressionDict());
+        if (ZSTD_isError(result)) {
+            Zstd::setError(errorStream,
+                           "Error referencing dictionary",
+                           result);
+            ZSTD_freeDCtx(context);
+            return rc_STREAM_INIT_FAILURE;  // RETURN
+        }
+    }
+
+    BlobOutputCursor cursor(output, factory);
+    const int        rc =
+        Zstd::decompressStream(&cursor, context, errorStream, input);
+
+    ZSTD_freeDCtx(context);
+
+    return rc;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
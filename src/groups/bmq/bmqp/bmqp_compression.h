@@ -29,6 +29,23 @@
 // provides implementation for compression and decompression for all supported
 // types of compression algorithms.
 //
+///Supported Algorithms
+///--------------------
+//: o !ZLIB!: 'deflate' stream at the default compression level.
+//: o !LZ4!:  LZ4 frame format, at the (fast) default compression level.  LZ4
+//:   trades compression ratio for a much lower CPU cost than ZLIB.
+//: o !ZSTD!: Zstandard frame format, at the 'k_ZSTD_DEFAULT_LEVEL'
+//:   compression level unless another one is specified to 'compress'.  ZSTD
+//:   typically compresses better than ZLIB at a fraction of its CPU cost.
+//
+// Note that 'LZ4' and 'ZSTD' must only be used toward peers having advertised
+// support for them (see 'bmqp::CompressionFeatures').
+//
+// 'ZSTD' data can also be compressed using a dictionary (see
+// 'bmqp_compressiondictionary').  Such data is decompressed like any other
+// 'ZSTD' data, provided the dictionary has been registered with
+// 'bmqp::CompressionDictionaryRegistry'.
+//
 
 // BMQ
 
@@ -43,12 +60,21 @@ namespace BloombergLP {
 
 namespace bmqp {
 
+// FORWARD DECLARATION
+class CompressionDictionary;
+
 // ==================
 // struct Compression
 // ==================
 
 /// This struct provides the ability for compression functionality.
 struct Compression {
+    // CONSTANTS
+
+    /// Compression level used for the `e_ZSTD` algorithm by the `compress`
+    /// methods not taking a level.
+    static const int k_ZSTD_DEFAULT_LEVEL = 3;
+
     // CLASS METHODS
 
     /// Compress the data within the specified `input` as per the specified
@@ -66,6 +92,26 @@ struct Compression {
                         bsl::ostream*                        errorStream = 0,
                         bslma::Allocator*                    allocator   = 0);
 
+    /// Compress the data within the specified `input` as per the specified
+    /// `algorithm`, at the specified `zstdLevel` compression level if
+    /// `algorithm` is `e_ZSTD`, and load the compressed data into the
+    /// specified `output`, using the specified `factory` to supply data
+    /// buffers.  Return 0 on success, and non-zero otherwise.  Optionally
+    /// specify an `errorStream` to record details on any errors that may
+    /// occur during this operation, and an `allocator` which will be used
+    /// to supply memory.  The behavior is undefined unless `zstdLevel` is
+    /// a level supported by the ZSTD library (typically, in the range
+    /// `[1 .. 22]`).  Note that `zstdLevel` is ignored by the other
+    /// algorithms, and that any existing data in `output` will be
+    /// preserved.
+    static int compress(bdlbb::Blob*                         output,
+                        bdlbb::BlobBufferFactory*            factory,
+                        bmqt::CompressionAlgorithmType::Enum algorithm,
+                        int                                  zstdLevel,
+                        const bdlbb::Blob&                   input,
+                        bsl::ostream*                        errorStream = 0,
+                        bslma::Allocator*                    allocator   = 0);
+
     /// Compress the data within the specified `input` as per the specified
     /// `algorithm`, and load the compressed data into the specified
     /// `output`, using the specified `factory` to supply data buffers.
@@ -85,6 +131,22 @@ struct Compression {
                         bsl::ostream*                        errorStream = 0,
                         bslma::Allocator*                    allocator   = 0);
 
+    /// Compress the data within the specified `input` as per the `e_ZSTD`
+    /// algorithm using the specified `dictionary`, and load the compressed
+    /// data into the specified `output`, using the specified `factory` to
+    /// supply data buffers.  Return 0 on success, and non-zero otherwise.
+    /// Optionally specify an `errorStream` to record details on any errors
+    /// that may occur during this operation, and an `allocator` which will
+    /// be used to supply memory.  The behavior is undefined unless
+    /// `dictionary.isValid()`.  Note that any existing data in `output`
+    /// will be preserved.
+    static int compress(bdlbb::Blob*                 output,
+                        bdlbb::BlobBufferFactory*    factory,
+                        const CompressionDictionary& dictionary,
+                        const bdlbb::Blob&           input,
+                        bsl::ostream*                errorStream = 0,
+                        bslma::Allocator*            allocator   = 0);
+
     /// Decompress the data within the specified `input` as per the
     /// specified `algorithm`, and load the uncompressed data into specified
     /// `output`, using the specified `factory` to supply the needed data
@@ -141,6 +203,80 @@ struct Compression_Impl {
                               const bdlbb::Blob&        input,
                               bsl::ostream*             errorStream,
                               bslma::Allocator*         allocator);
+
+    /// Compress the data within the specified `input` as per the LZ4 frame
+    /// format, and load the compressed data into the specified `output`,
+    /// using the specified `factory` to supply data buffers.  Specify an
+    /// `errorStream` to record details on any errors that may occur during
+    /// this operation.  Finally, specify `allocator` which will be used to
+    /// supply memory.  Return 0 on success, and non-zero otherwise.
+    static int compressLz4(bdlbb::Blob*              output,
+                           bdlbb::BlobBufferFactory* factory,
+                           const bdlbb::Blob&        input,
+                           bsl::ostream*             errorStream,
+                           bslma::Allocator*         allocator);
+
+    /// Decompress the data within the specified `input` as according to the
+    /// LZ4 frame format, and load the uncompressed data into the specified
+    /// `output` blob, using the specified `factory` to supply needed data
+    /// buffers.  Specify an `errorStream` to record details on any errors
+    /// that may occur during this operation.  Also, specify `allocator`
+    /// which will be used to supply memory.  Return 0 on success, and
+    /// non-zero otherwise.
+    static int decompressLz4(bdlbb::Blob*              output,
+                             bdlbb::BlobBufferFactory* factory,
+                             const bdlbb::Blob&        input,
+                             bsl::ostream*             errorStream,
+                             bslma::Allocator*         allocator);
+
+    /// Compress the data within the specified `input` as per the Zstandard
+    /// frame format, and load the compressed data into the specified
+    /// `output`, using the specified `factory` to supply data buffers.
+    /// Specify a compression `level`, with negative values indicating
+    /// faster compression, 1 indicating fast compression and 19 indicating
+    /// best (regular) compression; a level of 0 selects the library's
+    /// default level.  Also, specify an `errorStream` to record details on
+    /// any errors that may occur during this operation.  Finally, specify
+    /// `allocator` which will be used to supply memory.  Return 0 on
+    /// success, and non-zero otherwise.  Note that `level` is clamped by
+    /// the library to the range it supports.
+    static int compressZstd(bdlbb::Blob*              output,
+                            bdlbb::BlobBufferFactory* factory,
+                            const bdlbb::Blob&        input,
+                            int                       level,
+                            bsl::ostream*             errorStream,
+                            bslma::Allocator*         allocator);
+
+    /// Compress the data within the specified `input` as per the Zstandard
+    /// frame format using the specified `dictionary`, and load the
+    /// compressed data into the specified `output`, using the specified
+    /// `factory` to supply data buffers.  Also, specify an `errorStream` to
+    /// record details on any errors that may occur during this operation.
+    /// Finally, specify `allocator` which will be used to supply memory.
+    /// Return 0 on success, and non-zero otherwise.  Note that the
+    /// compression level is the one `dictionary` is prepared for.
+    static int compressZstd(bdlbb::Blob*                 output,
+                            bdlbb::BlobBufferFactory*    factory,
+                            const bdlbb::Blob&           input,
+                            const CompressionDictionary& dictionary,
+                            bsl::ostream*                errorStream,
+                            bslma::Allocator*            allocator);
+
+    /// Decompress the data within the specified `input` as according to the
+    /// Zstandard frame format, and load the uncompressed data into the
+    /// specified `output` blob, using the specified `factory` to supply
+    /// needed data buffers.  Specify an `errorStream` to record details on
+    /// any errors that may occur during this operation.  Also, specify
+    /// `allocator` which will be used to supply memory.  Return 0 on
+    /// success, and non-zero otherwise.  If `input` was compressed using a
+    /// dictionary, the dictionary is looked up in
+    /// `CompressionDictionaryRegistry`, and the decompression fails if it
+    /// is not found.
+    static int decompressZstd(bdlbb::Blob*              output,
+                              bdlbb::BlobBufferFactory* factory,
+                              const bdlbb::Blob&        input,
+                              bsl::ostream*             errorStream,
+                              bslma::Allocator*         allocator);
 };
 
 }  // close package namespace
@@ -22,6 +22,7 @@
 // BMQ
 #include <bmqp_ctrlmsg_messages.h>
 #include <bmqp_protocolutil.h>
+#include <bmqt_compressionalgorithmtype.h>
 
 // MWC
 #include <mwcu_blob.h>
@@ -33,7 +34,10 @@
 #include <bdlbb_blob.h>
 #include <bdlbb_blobutil.h>
 #include <bdlbb_pooledblobbufferfactory.h>
+#include <bdlt_timeunitratio.h>
+#include <bsl_iomanip.h>
 #include <bsl_numeric.h>
+#include <bsls_platform.h>
 #include <bsls_timeutil.h>
 
 // BENCHMARKING LIBRARY
@@ -359,6 +363,30 @@ static void eZlibCompressionRatioHelper(bsls::Types::Int64* inputSize,
     ASSERT_EQ(bdlbb::BlobUtil::compare(decompressed, input), 0);
 }
 
+#ifdef BSLS_PLATFORM_OS_LINUX
+/// Apply to the specified Google Benchmark `b` the arguments pairs
+/// `{algorithm, length}` for every compression algorithm and various
+/// lengths up to 1 Mi.
+static void populateAlgorithmsAndLengths_GoogleBenchmark(
+    benchmark::internal::Benchmark* b)
+{
+    typedef bmqt::CompressionAlgorithmType Type;
+
+    std::vector<long int> lengths;
+    lengths.push_back(1024);     // 1 Ki
+    lengths.push_back(16384);    // 16 Ki
+    lengths.push_back(65536);    // 64 Ki
+    lengths.push_back(1048576);  // 1 Mi
+    for (int algorithm = Type::k_LOWEST_SUPPORTED_TYPE;
+         algorithm <= Type::k_HIGHEST_SUPPORTED_TYPE;
+         ++algorithm) {
+        for (auto i : lengths) {
+            b->Args({algorithm, i});
+        }
+    }
+}
+#endif
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -698,6 +726,235 @@ static void test3_compression_decompression_none()
     }
 }
 
+static void test4_compression_decompression_lz4_zstd()
+// ------------------------------------------------------------------------
+// TEST USING LZ4 AND ZSTD ALGORITHM TYPES
+//
+// Concerns:
+//   1. Data compressed with 'e_LZ4' or 'e_ZSTD' decompresses back to the
+//      original data, including for empty input, input spread over
+//      multiple buffers, and output spanning many factory buffers.
+//   2. Truncated compressed input is reported as an error.
+//
+// Plan:
+//   - For each algorithm, round-trip a set of inputs, using a small blob
+//     buffer factory so that the streaming paths cross buffer boundaries.
+//   - Drop the last byte of a compressed frame, and verify decompression
+//     fails.
+//
+// Testing:
+//   Compression::compress(..., e_LZ4, ...)
+//   Compression::compress(..., e_ZSTD, ...)
+//   Compression::decompress(..., e_LZ4, ...)
+//   Compression::decompress(..., e_ZSTD, ...)
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("LZ4 AND ZSTD ALGORITHMS TEST");
+
+    const bmqt::CompressionAlgorithmType::Enum k_ALGORITHMS[] = {
+        bmqt::CompressionAlgorithmType::e_LZ4,
+        bmqt::CompressionAlgorithmType::e_ZSTD};
+    const size_t k_NUM_ALGORITHMS = sizeof(k_ALGORITHMS) /
+                                    sizeof(*k_ALGORITHMS);
+
+    // Small buffers, to exercise both input and output buffer boundaries.
+    bdlbb::PooledBlobBufferFactory bufferFactory(64, s_allocator_p);
+
+    // Build a compressible payload spanning many buffers.
+    bsl::string largeData(s_allocator_p);
+    for (int i = 0; i < 4096; ++i) {
+        largeData.append("Hello World ");
+        largeData.push_back(static_cast<char>('a' + i % 26));
+    }
+
+    const bsl::string k_DATA[] = {bsl::string("", s_allocator_p),
+                                  bsl::string("Hello World", s_allocator_p),
+                                  bsl::string("abcdefghijklmnopqrstuvwxyz"
+                                              "1234567890",
+                                              s_allocator_p),
+                                  largeData};
+    const size_t      k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    for (size_t algoIdx = 0; algoIdx < k_NUM_ALGORITHMS; ++algoIdx) {
+        const bmqt::CompressionAlgorithmType::Enum algorithm =
+            k_ALGORITHMS[algoIdx];
+
+        PV("ALGORITHM: " << algorithm);
+
+        for (size_t idx = 0; idx < k_NUM_DATA; ++idx) {
+            PVV("Input length: " << k_DATA[idx].length());
+
+            mwcu::MemOutStream error(s_allocator_p);
+            bdlbb::Blob        input(&bufferFactory, s_allocator_p);
+            bdlbb::Blob        compressed(&bufferFactory, s_allocator_p);
+            bdlbb::Blob        decompressed(&bufferFactory, s_allocator_p);
+
+            bdlbb::BlobUtil::append(&input,
+                                    k_DATA[idx].data(),
+                                    k_DATA[idx].length());
+
+            int rc = bmqp::Compression::compress(&compressed,
+                                                 &bufferFactory,
+                                                 algorithm,
+                                                 input,
+                                                 &error,
+                                                 s_allocator_p);
+            ASSERT_EQ_D(error.str(), rc, 0);
+            ASSERT_GT(compressed.length(), 0);
+
+            rc = bmqp::Compression::decompress(&decompressed,
+                                               &bufferFactory,
+                                               algorithm,
+                                               compressed,
+                                               &error,
+                                               s_allocator_p);
+            ASSERT_EQ_D(error.str(), rc, 0);
+            ASSERT_EQ(bdlbb::BlobUtil::compare(decompressed, input), 0);
+
+            // Same input, through the contiguous buffer overload.
+            bdlbb::Blob compressed2(&bufferFactory, s_allocator_p);
+            rc = bmqp::Compression::compress(&compressed2,
+                                             &bufferFactory,
+                                             algorithm,
+                                             k_DATA[idx].data(),
+                                             k_DATA[idx].length(),
+                                             &error,
+                                             s_allocator_p);
+            ASSERT_EQ_D(error.str(), rc, 0);
+            ASSERT_EQ(bdlbb::BlobUtil::compare(compressed2, compressed), 0);
+
+            // Truncated frame
+            bdlbb::Blob truncated(compressed, s_allocator_p);
+            bdlbb::Blob output(&bufferFactory, s_allocator_p);
+            truncated.setLength(truncated.length() - 1);
+
+            rc = bmqp::Compression::decompress(&output,
+                                               &bufferFactory,
+                                               algorithm,
+                                               truncated,
+                                               &error,
+                                               s_allocator_p);
+            ASSERT_NE(rc, 0);
+        }
+    }
+}
+
+static void test5_compression_zstdLevel()
+// ------------------------------------------------------------------------
+// TEST ZSTD COMPRESSION LEVEL
+//
+// Concerns:
+//   1. Data compressed with 'e_ZSTD' at any supported level decompresses
+//      back to the original data.
+//   2. Compressing without specifying a level uses
+//      'Compression::k_ZSTD_DEFAULT_LEVEL'.
+//   3. The level is ignored by the other algorithms.
+//
+// Testing:
+//   Compression::compress(..., algorithm, zstdLevel, input, ...)
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("ZSTD COMPRESSION LEVEL TEST");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+
+    bsl::string data(s_allocator_p);
+    for (int i = 0; i < 1024; ++i) {
+        data.append("{ \"key\": \"value\", \"id\": ");
+        data.push_back(static_cast<char>('0' + i % 10));
+        data.append(" }");
+    }
+
+    bdlbb::Blob input(&bufferFactory, s_allocator_p);
+    bdlbb::BlobUtil::append(&input, data.data(), data.length());
+
+    mwcu::MemOutStream error(s_allocator_p);
+
+    PV("Round trip at various levels");
+    const int k_LEVELS[] = {1,
+                            bmqp::Compression::k_ZSTD_DEFAULT_LEVEL,
+                            9,
+                            19};
+    const int k_NUM_LEVELS = sizeof(k_LEVELS) / sizeof(*k_LEVELS);
+    for (int i = 0; i < k_NUM_LEVELS; ++i) {
+        PVV("Level: " << k_LEVELS[i]);
+
+        bdlbb::Blob compressed(&bufferFactory, s_allocator_p);
+        bdlbb::Blob decompressed(&bufferFactory, s_allocator_p);
+
+        int rc = bmqp::Compression::compress(
+            &compressed,
+            &bufferFactory,
+            bmqt::CompressionAlgorithmType::e_ZSTD,
+            k_LEVELS[i],
+            input,
+            &error,
+            s_allocator_p);
+        ASSERT_EQ_D(error.str(), rc, 0);
+        ASSERT_LT(compressed.length(), input.length());
+
+        rc = bmqp::Compression::decompress(
+            &decompressed,
+            &bufferFactory,
+            bmqt::CompressionAlgorithmType::e_ZSTD,
+            compressed,
+            &error,
+            s_allocator_p);
+        ASSERT_EQ_D(error.str(), rc, 0);
+        ASSERT_EQ(bdlbb::BlobUtil::compare(decompressed, input), 0);
+    }
+
+    PV("Default level");
+    {
+        bdlbb::Blob withDefault(&bufferFactory, s_allocator_p);
+        bdlbb::Blob withLevel(&bufferFactory, s_allocator_p);
+
+        ASSERT_EQ(0,
+                  bmqp::Compression::compress(
+                      &withDefault,
+                      &bufferFactory,
+                      bmqt::CompressionAlgorithmType::e_ZSTD,
+                      input,
+                      &error,
+                      s_allocator_p));
+        ASSERT_EQ(0,
+                  bmqp::Compression::compress(
+                      &withLevel,
+                      &bufferFactory,
+                      bmqt::CompressionAlgorithmType::e_ZSTD,
+                      bmqp::Compression::k_ZSTD_DEFAULT_LEVEL,
+                      input,
+                      &error,
+                      s_allocator_p));
+        ASSERT_EQ(bdlbb::BlobUtil::compare(withDefault, withLevel), 0);
+    }
+
+    PV("Level ignored by other algorithms");
+    {
+        bdlbb::Blob withoutLevel(&bufferFactory, s_allocator_p);
+        bdlbb::Blob withLevel(&bufferFactory, s_allocator_p);
+
+        ASSERT_EQ(0,
+                  bmqp::Compression::compress(
+                      &withoutLevel,
+                      &bufferFactory,
+                      bmqt::CompressionAlgorithmType::e_LZ4,
+                      input,
+                      &error,
+                      s_allocator_p));
+        ASSERT_EQ(0,
+                  bmqp::Compression::compress(
+                      &withLevel,
+                      &bufferFactory,
+                      bmqt::CompressionAlgorithmType::e_LZ4,
+                      19,
+                      input,
+                      &error,
+                      s_allocator_p));
+        ASSERT_EQ(bdlbb::BlobUtil::compare(withoutLevel, withLevel), 0);
+    }
+}
+
 // ============================================================================
 //                              PERFORMANCE TESTS
 // ----------------------------------------------------------------------------
@@ -963,6 +1220,113 @@ static void testN3_performanceCompressionRatio()
     }
 }
 
+static void testN4_calculateThroughputAllAlgorithms()
+// ------------------------------------------------------------------------
+// BENCHMARK: COMPRESSION DECOMPRESSION THROUGHPUT OF ALL ALGORITHMS
+//
+// Concerns:
+//   Compare the throughput and the compression ratio of every compression
+//   algorithm through 'bmqp::Compression', for buffers of various sizes,
+//   in a single thread environment.
+//
+// Plan:
+//   - For each algorithm and buffer size, time enough compressions and
+//     decompressions to process about 256 MiB, and report the throughputs
+//     and the compression ratio.
+//
+// Testing:
+//   Throughput of bmqp::Compression::compress and decompress.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName(
+        "BENCHMARK: COMPRESSION DECOMPRESSION THROUGHPUT OF ALL ALGORITHMS");
+
+    typedef bmqt::CompressionAlgorithmType Type;
+
+    const bsls::Types::Int64 k_TOTAL_BYTES = 256 * 1024 * 1024;  // 256 Mi
+    const int                k_LENGTHS[]   = {1024, 16384, 65536, 1048576};
+    const int k_NUM_LENGTHS = sizeof(k_LENGTHS) / sizeof(*k_LENGTHS);
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(4096, s_allocator_p);
+
+    bsl::cout << bsl::setw(5) << "Algo" << " | " << bsl::setw(10)
+              << "Size(B)" << " | " << bsl::setw(14) << "compress"
+              << " | " << bsl::setw(14) << "decompress" << " | "
+              << "ratio\n";
+
+    for (int algorithm = Type::k_LOWEST_SUPPORTED_TYPE;
+         algorithm <= Type::k_HIGHEST_SUPPORTED_TYPE;
+         ++algorithm) {
+        const Type::Enum type = static_cast<Type::Enum>(algorithm);
+
+        for (int i = 0; i < k_NUM_LENGTHS; ++i) {
+            const int                length   = k_LENGTHS[i];
+            const bsls::Types::Int64 numIters = k_TOTAL_BYTES / length;
+
+            bsl::string str("", s_allocator_p);
+            generateRandomString(&str, length);
+
+            bdlbb::Blob input(&bufferFactory, s_allocator_p);
+            bdlbb::Blob compressed(&bufferFactory, s_allocator_p);
+            bdlbb::Blob decompressed(&bufferFactory, s_allocator_p);
+            bdlbb::BlobUtil::append(&input, str.data(), length);
+
+            // <time>
+            bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+            for (bsls::Types::Int64 k = 0; k < numIters; ++k) {
+                compressed.removeAll();
+                bmqp::Compression::compress(&compressed,
+                                            &bufferFactory,
+                                            type,
+                                            input,
+                                            0,
+                                            s_allocator_p);
+            }
+            const bsls::Types::Int64 compressionTime =
+                bsls::TimeUtil::getTimer() - start;
+
+            start = bsls::TimeUtil::getTimer();
+            for (bsls::Types::Int64 k = 0; k < numIters; ++k) {
+                decompressed.removeAll();
+                bmqp::Compression::decompress(&decompressed,
+                                              &bufferFactory,
+                                              type,
+                                              compressed,
+                                              0,
+                                              s_allocator_p);
+            }
+            const bsls::Types::Int64 decompressionTime =
+                bsls::TimeUtil::getTimer() - start;
+            // </time>
+
+            ASSERT_EQ_D(algorithm << ", " << length,
+                        0,
+                        bdlbb::BlobUtil::compare(decompressed, input));
+
+            mwcu::MemOutStream compression(s_allocator_p);
+            mwcu::MemOutStream decompression(s_allocator_p);
+            compression << mwcu::PrintUtil::prettyBytes(
+                               (numIters * length *
+                                bdlt::TimeUnitRatio::k_NS_PER_S) /
+                               compressionTime)
+                        << "/s";
+            decompression << mwcu::PrintUtil::prettyBytes(
+                                 (numIters * length *
+                                  bdlt::TimeUnitRatio::k_NS_PER_S) /
+                                 decompressionTime)
+                          << "/s";
+
+            bsl::cout << bsl::setw(5) << Type::toAscii(type) << " | "
+                      << bsl::setw(10) << length << " | " << bsl::setw(14)
+                      << compression.str() << " | " << bsl::setw(14)
+                      << decompression.str() << " | "
+                      << static_cast<double>(length) / compressed.length()
+                      << '\n';
+        }
+    }
+    bsl::cout << bsl::endl;
+}
+
 // Begin Benchmarking Tests
 #ifdef BSLS_PLATFORM_OS_LINUX
 static void testN1_performanceCompressionDecompressionDefault_GoogleBenchmark(
@@ -1043,6 +1407,55 @@ static void testN2_calculateThroughput_GoogleBenchmark(benchmark::State& state)
     }
     // </time>
 }
+
+static void testN4_calculateThroughputAllAlgorithms_GoogleBenchmark(
+    benchmark::State& state)
+// ------------------------------------------------------------------------
+// BENCHMARK: COMPRESSION DECOMPRESSION THROUGHPUT OF ALL ALGORITHMS
+//
+// Concerns:
+//   Compare the throughput of compressing and decompressing a buffer with
+//   every compression algorithm.  'state.range(0)' is the compression
+//   algorithm, and 'state.range(1)' the size of the buffer.
+// ------------------------------------------------------------------------
+{
+    const bmqt::CompressionAlgorithmType::Enum algorithm =
+        static_cast<bmqt::CompressionAlgorithmType::Enum>(state.range(0));
+    const int length = state.range(1);
+
+    state.SetLabel(bmqt::CompressionAlgorithmType::toAscii(algorithm));
+
+    bsl::string str("", s_allocator_p);
+    generateRandomString(&str, length);
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(4096, s_allocator_p);
+    bdlbb::Blob                    input(&bufferFactory, s_allocator_p);
+    bdlbb::Blob                    compressed(&bufferFactory, s_allocator_p);
+    bdlbb::Blob                    decompressed(&bufferFactory, s_allocator_p);
+    bdlbb::BlobUtil::append(&input, str.data(), length);
+
+    // <time>
+    for (auto _ : state) {
+        compressed.removeAll();
+        decompressed.removeAll();
+        bmqp::Compression::compress(&compressed,
+                                    &bufferFactory,
+                                    algorithm,
+                                    input,
+                                    0,
+                                    s_allocator_p);
+        bmqp::Compression::decompress(&decompressed,
+                                      &bufferFactory,
+                                      algorithm,
+                                      compressed,
+                                      0,
+                                      s_allocator_p);
+    }
+    // </time>
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            length);
+}
 #endif  // BSLS_PLATFORM_OS_LINUX
 // ============================================================================
 //                                 MAIN PROGRAM
@@ -1057,6 +1470,8 @@ int main(int argc, char* argv[])
     case 1: test1_breathingTest(); break;
     case 2: test2_compression_cluster_message(); break;
     case 3: test3_compression_decompression_none(); break;
+    case 4: test4_compression_decompression_lz4_zstd(); break;
+    case 5: test5_compression_zstdLevel(); break;
     case -1:
         MWC_BENCHMARK_WITH_ARGS(
             testN1_performanceCompressionDecompressionDefault,
@@ -1071,6 +1486,11 @@ int main(int argc, char* argv[])
                                     ->Unit(benchmark::kMillisecond));
         break;
     case -3: testN3_performanceCompressionRatio(); break;
+    case -4:
+        MWC_BENCHMARK_WITH_ARGS(
+            testN4_calculateThroughputAllAlgorithms,
+            Apply(populateAlgorithmsAndLengths_GoogleBenchmark));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
@@ -0,0 +1,302 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqp_compressiondictionary.cpp                                     -*-C++-*-
+#include <bmqp_compressiondictionary.h>
+
+#include <bmqscm_version.h>
+// MWC
+#include <mwcu_blob.h>
+
+// BDE
+#include <bsl_algorithm.h>
+#include <bsl_memory.h>
+#include <bsl_unordered_map.h>
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_once.h>
+#include <bsls_assert.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_performancehint.h>
+
+// ZSTD
+#include <zdict.h>
+#include <zstd.h>
+
+namespace BloombergLP {
+namespace bmqp {
+
+namespace {
+
+/// Maximum size of a ZSTD frame header, as per the format specification.
+const int k_ZSTD_FRAME_HEADER_SIZE_MAX = 18;
+
+// ===============
+// struct Registry
+// ===============
+
+/// Storage of the `CompressionDictionaryRegistry`.
+struct Registry {
+    // TYPES
+    typedef bsl::unordered_map<unsigned int,
+                               bsl::shared_ptr<CompressionDictionary> >
+        DictionaryMap;
+
+    // DATA
+    bslmt::Mutex d_mutex;  // protects 'd_dictionaries'
+
+    DictionaryMap d_dictionaries;  // registered dictionaries, by id
+
+    // CREATORS
+    explicit Registry(bslma::Allocator* allocator)
+    : d_mutex()
+    , d_dictionaries(allocator)
+    {
+        // NOTHING
+    }
+};
+
+/// Return the process-wide registry, creating it on first use.  Note that
+/// the registry is never destroyed, so that dictionaries it holds can be
+/// referred to until the end of the process.
+Registry& registry()
+{
+    static Registry* s_registry_p = 0;
+
+    BSLMT_ONCE_DO
+    {
+        static bsls::ObjectBuffer<Registry> s_buffer;
+        new (s_buffer.buffer()) Registry(bslma::Default::globalAllocator());
+        s_registry_p = &s_buffer.object();
+    }
+
+    return *s_registry_p;
+}
+
+}  // close unnamed namespace
+
+// ---------------------------
+// class CompressionDictionary
+// ---------------------------
+
+// CLASS METHODS
+unsigned int CompressionDictionary::idFromData(const char* data, int length)
+{
+    if (0 >= length) {
+        return 0;  // RETURN
+    }
+
+    return ZDICT_getDictID(data, length);
+}
+
+unsigned int CompressionDictionary::frameDictionaryId(const bdlbb::Blob& blob,
+                                                      int offset)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= offset && offset <= blob.length());
+
+    char      header[k_ZSTD_FRAME_HEADER_SIZE_MAX];
+    const int length = bsl::min(k_ZSTD_FRAME_HEADER_SIZE_MAX,
+                                blob.length() - offset);
+    if (0 == length) {
+        return 0;  // RETURN
+    }
+
+    mwcu::BlobPosition start;
+    if (0 != mwcu::BlobUtil::findOffsetSafe(&start,
+                                            blob,
+                                            mwcu::BlobPosition(),
+                                            offset) ||
+        0 != mwcu::BlobUtil::readNBytes(header, blob, start, length)) {
+        return 0;  // RETURN
+    }
+
+    return ZSTD_getDictID_fromFrame(header, length);
+}
+
+// CREATORS
+CompressionDictionary::CompressionDictionary(const char*       data,
+                                             int               length,
+                                             bslma::Allocator* basicAllocator)
+: d_data(data, data + length, basicAllocator)
+, d_id(idFromData(data, length))
+, d_compressionDict_p(0)
+, d_decompressionDict_p(0)
+{
+    if (0 == d_id) {
+        return;  // RETURN
+    }
+
+    d_compressionDict_p   = ZSTD_createCDict(d_data.data(),
+                                           d_data.size(),
+                                           k_COMPRESSION_LEVEL);
+    d_decompressionDict_p = ZSTD_createDDict(d_data.data(), d_data.size());
+
+    if (!d_compressionDict_p || !d_decompressionDict_p) {
+        // Should never happen, unless running out of memory.
+        d_id = 0;
+    }
+}
+
+CompressionDictionary::~CompressionDictionary()
+{
+    ZSTD_freeCDict(d_compressionDict_p);
+    ZSTD_freeDDict(d_decompressionDict_p);
+}
+
+// ------------------------------------
+// struct CompressionDictionaryRegistry
+// ------------------------------------
+
+const CompressionDictionary*
+CompressionDictionaryRegistry::add(const char* data, int length)
+{
+    const unsigned int id = CompressionDictionary::idFromData(data, length);
+    if (0 == id) {
+        return 0;  // RETURN
+    }
+
+    Registry&                     theRegistry = registry();
+    bslmt::LockGuard<bslmt::Mutex> guard(&theRegistry.d_mutex);  // LOCK
+
+    Registry::DictionaryMap::iterator it = theRegistry.d_dictionaries.find(
+        id);
+    if (it != theRegistry.d_dictionaries.end()) {
+        return it->second.get();  // RETURN
+    }
+
+    bslma::Allocator* allocator = bslma::Default::globalAllocator();
+    bsl::shared_ptr<CompressionDictionary> dictionary;
+    dictionary.createInplace(allocator, data, length, allocator);
+    if (!dictionary->isValid()) {
+        return 0;  // RETURN
+    }
+
+    theRegistry.d_dictionaries.insert(bsl::make_pair(id, dictionary));
+
+    return dictionary.get();
+}
+
+const CompressionDictionary*
+CompressionDictionaryRegistry::lookup(unsigned int id)
+{
+    Registry&                     theRegistry = registry();
+    bslmt::LockGuard<bslmt::Mutex> guard(&theRegistry.d_mutex);  // LOCK
+
+    Registry::DictionaryMap::const_iterator it =
+        theRegistry.d_dictionaries.find(id);
+
+    return it == theRegistry.d_dictionaries.end() ? 0 : it->second.get();
+}
+
+// ----------------------------------
+// class CompressionDictionaryTrainer
+// ----------------------------------
+
+// CREATORS
+CompressionDictionaryTrainer::CompressionDictionaryTrainer(
+    bslma::Allocator* basicAllocator)
+: d_state(e_COLLECTING)
+, d_samples(basicAllocator)
+, d_sampleSizes(basicAllocator)
+, d_dictionary(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+bool CompressionDictionaryTrainer::observe(const bdlbb::Blob& sample)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(!isCollecting())) {
+        return false;  // RETURN
+    }
+
+    const int length = sample.length();
+    if (length < k_MIN_SAMPLE_SIZE || length > k_MAX_SAMPLE_SIZE) {
+        return false;  // RETURN
+    }
+
+    if (d_samples.empty()) {
+        d_samples.reserve(k_NUM_SAMPLES * k_MAX_SAMPLE_SIZE / 4);
+        d_sampleSizes.reserve(k_NUM_SAMPLES);
+    }
+
+    for (int i = 0; i < sample.numDataBuffers(); ++i) {
+        const char* data = sample.buffer(i).data();
+        d_samples.insert(d_samples.end(),
+                         data,
+                         data + mwcu::BlobUtil::bufferSize(sample, i));
+    }
+    d_sampleSizes.push_back(length);
+
+    if (d_sampleSizes.size() < static_cast<size_t>(k_NUM_SAMPLES)) {
+        return false;  // RETURN
+    }
+
+    // Stop collecting; 'd_samples' now belongs to 'train'.
+    d_state = e_TRAINING;
+    return true;
+}
+
+int CompressionDictionaryTrainer::train()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_state == e_TRAINING);
+
+    enum RcEnum {
+        rc_SUCCESS          = 0,
+        rc_TRAINING_FAILURE = -1,
+        rc_INVALID          = -2
+    };
+
+    // The recommended ratio between the total size of the samples and the
+    // dictionary is about 100.
+    const size_t capacity = bsl::min(
+        static_cast<size_t>(k_DICTIONARY_CAPACITY),
+        bsl::max(d_samples.size() / 100, static_cast<size_t>(1024)));
+
+    bsl::vector<char> buffer(capacity, d_allocator_p);
+    const size_t      result = ZDICT_trainFromBuffer(
+        buffer.data(),
+        buffer.size(),
+        d_samples.data(),
+        d_sampleSizes.data(),
+        static_cast<unsigned int>(d_sampleSizes.size()));
+
+    // Release the samples
+    bsl::vector<char>(d_allocator_p).swap(d_samples);
+    bsl::vector<size_t>(d_allocator_p).swap(d_sampleSizes);
+
+    int rc = rc_SUCCESS;
+    if (ZDICT_isError(result)) {
+        rc = rc_TRAINING_FAILURE;
+    }
+    else {
+        d_dictionary = CompressionDictionaryRegistry::add(
+            buffer.data(),
+            static_cast<int>(result));
+        if (!d_dictionary) {
+            rc = rc_INVALID;
+        }
+    }
+
+    d_state = e_DONE;
+    return rc;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,334 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqp_compressiondictionary.h                                       -*-C++-*-
+#ifndef INCLUDED_BMQP_COMPRESSIONDICTIONARY
+#define INCLUDED_BMQP_COMPRESSIONDICTIONARY
+
+//@PURPOSE: Provide ZSTD dictionaries shared per queue.
+//
+//@CLASSES:
+//  bmqp::CompressionDictionary        : a prepared ZSTD dictionary.
+//  bmqp::CompressionDictionaryRegistry: process-wide dictionaries, by id.
+//  bmqp::CompressionDictionaryTrainer : collects samples, trains dictionary.
+//
+//@DESCRIPTION: Small messages of similar structure barely shrink with
+// generic compression.  A dictionary trained on samples of such messages,
+// and known to both the compressing and the decompressing side, results in
+// much better ratios.  This component provides the pieces to share such
+// dictionaries per queue:
+//
+//: o 'bmqp::CompressionDictionary' holds the content of a dictionary along
+//:   with the ZSTD compression and decompression states prepared out of it.
+//:   The id of a dictionary is embedded, by ZSTD, in the header of every
+//:   frame compressed with it.
+//:
+//: o 'bmqp::CompressionDictionaryRegistry' keeps all the dictionaries known
+//:   to the process, so that a frame can be decompressed knowing only its
+//:   content.  Dictionaries are never removed from the registry, which makes
+//:   it safe to keep raw pointers to them.
+//:
+//: o 'bmqp::CompressionDictionaryTrainer' collects samples of application
+//:   data (typically of one queue, at its primary) and trains a dictionary
+//:   out of them.
+//
+// The primary of a queue trains the dictionary out of uncompressed PUTs, and
+// advertises it in the 'compressionDictionary' field of the 'OpenQueue'
+// response.  Each node registers the dictionaries it receives, so that
+// ZSTD-compressed PUTs (and the resulting PUSHes) using it can be
+// decompressed anywhere, the same way 'bmqp::SchemaLearner' shares per
+// queue message properties schemas.
+//
+/// Thread Safety
+///-------------
+// 'CompressionDictionary' is const thread-safe.
+// 'CompressionDictionaryRegistry' is fully thread-safe.
+// 'CompressionDictionaryTrainer::observe' must be called from one thread at
+// a time, while 'train' and 'dictionary' can be called from any other thread.
+//
+/// Usage
+///-----
+//..
+//  bmqp::CompressionDictionaryTrainer trainer(allocator);
+//
+//  // Collect samples ...
+//  if (trainer.observe(applicationData)) {
+//      // Enough samples were collected; this can be offloaded to another
+//      // thread.
+//      trainer.train();
+//  }
+//
+//  // ... then compress using the trained dictionary.
+//  if (trainer.dictionary()) {
+//      bmqp::Compression::compress(&output,
+//                                  factory,
+//                                  *trainer.dictionary(),
+//                                  input);
+//  }
+//..
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_atomic.h>
+
+// ZSTD
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+namespace BloombergLP {
+
+namespace bmqp {
+
+// ===========================
+// class CompressionDictionary
+// ===========================
+
+/// This class holds a ZSTD dictionary along with the compression and
+/// decompression states prepared out of it.
+class CompressionDictionary {
+  private:
+    // DATA
+    bsl::vector<char> d_data;  // content of the dictionary
+
+    unsigned int d_id;  // id of the dictionary (0 if invalid)
+
+    ZSTD_CDict_s* d_compressionDict_p;  // prepared compression state
+
+    ZSTD_DDict_s* d_decompressionDict_p;  // prepared decompression state
+
+  private:
+    // NOT IMPLEMENTED
+    CompressionDictionary(const CompressionDictionary&);
+    CompressionDictionary& operator=(const CompressionDictionary&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(CompressionDictionary,
+                                   bslma::UsesBslmaAllocator)
+
+    // CONSTANTS
+
+    /// Compression level the dictionary is prepared for.  Note that this is
+    /// the same as `Compression::k_ZSTD_DEFAULT_LEVEL`.
+    static const int k_COMPRESSION_LEVEL = 3;
+
+    // CLASS METHODS
+
+    /// Return the id of the dictionary having the specified `length` bytes
+    /// of content at the specified `data`, or 0 if that content is not a
+    /// ZSTD dictionary.
+    static unsigned int idFromData(const char* data, int length);
+
+    /// Return the id of the dictionary used to compress the ZSTD frame
+    /// starting at the specified `offset` in the specified `blob`, or 0 if
+    /// the frame was compressed without a dictionary or if it is not a
+    /// ZSTD frame.
+    static unsigned int frameDictionaryId(const bdlbb::Blob& blob,
+                                          int                offset = 0);
+
+    // CREATORS
+
+    /// Create a dictionary out of the specified `length` bytes of content
+    /// at the specified `data`.  Use the specified `basicAllocator` to
+    /// supply memory.  Note that `isValid` returns false if `data` is not a
+    /// ZSTD dictionary.
+    CompressionDictionary(const char*       data,
+                          int               length,
+                          bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~CompressionDictionary();
+
+    // ACCESSORS
+
+    /// Return true if this object holds a valid dictionary.
+    bool isValid() const;
+
+    /// Return the id of this dictionary, unique per content.
+    unsigned int id() const;
+
+    /// Return the content of this dictionary.
+    const bsl::vector<char>& data() const;
+
+    /// Return the prepared compression state of this dictionary.  The
+    /// behavior is undefined unless `isValid()`.
+    const ZSTD_CDict_s* compressionDict() const;
+
+    /// Return the prepared decompression state of this dictionary.  The
+    /// behavior is undefined unless `isValid()`.
+    const ZSTD_DDict_s* decompressionDict() const;
+};
+
+// ====================================
+// struct CompressionDictionaryRegistry
+// ====================================
+
+/// This struct provides access to the process-wide collection of ZSTD
+/// dictionaries, keyed by their id.
+struct CompressionDictionaryRegistry {
+    // CLASS METHODS
+
+    /// Register a dictionary having the specified `length` bytes of content
+    /// at the specified `data`, unless a dictionary with the same id is
+    /// already registered, and return the registered dictionary.  Return
+    /// 0 if `data` is not a ZSTD dictionary.
+    static const CompressionDictionary* add(const char* data, int length);
+
+    /// Return the dictionary having the specified `id`, or 0 if no such
+    /// dictionary is registered.
+    static const CompressionDictionary* lookup(unsigned int id);
+};
+
+// ==================================
+// class CompressionDictionaryTrainer
+// ==================================
+
+/// This mechanism collects samples of application data and trains a ZSTD
+/// dictionary out of them.
+class CompressionDictionaryTrainer {
+  public:
+    // CONSTANTS
+
+    /// Samples bigger than this are not collected, as they compress well
+    /// without a dictionary.
+    static const int k_MAX_SAMPLE_SIZE = 4096;
+
+    /// Samples smaller than this are not collected.
+    static const int k_MIN_SAMPLE_SIZE = 32;
+
+    /// Number of samples to collect before training.
+    static const int k_NUM_SAMPLES = 512;
+
+    /// Maximum size of the trained dictionary.
+    static const int k_DICTIONARY_CAPACITY = 16 * 1024;
+
+  private:
+    // PRIVATE TYPES
+    enum State { e_COLLECTING = 0, e_TRAINING = 1, e_DONE = 2 };
+
+    // DATA
+    bsls::AtomicInt d_state;  // one of 'State'
+
+    bsl::vector<char> d_samples;  // concatenated samples
+
+    bsl::vector<size_t> d_sampleSizes;  // size of each sample
+
+    bsls::AtomicPointer<const CompressionDictionary> d_dictionary;
+    // trained dictionary, owned by the
+    // registry
+
+    bslma::Allocator* d_allocator_p;  // allocator to use
+
+  private:
+    // NOT IMPLEMENTED
+    CompressionDictionaryTrainer(const CompressionDictionaryTrainer&);
+    CompressionDictionaryTrainer&
+    operator=(const CompressionDictionaryTrainer&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(CompressionDictionaryTrainer,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a trainer using the specified `basicAllocator` to supply
+    /// memory.
+    explicit CompressionDictionaryTrainer(
+        bslma::Allocator* basicAllocator = 0);
+
+    // MANIPULATORS
+
+    /// Collect the specified `sample` of uncompressed application data, if
+    /// still collecting samples and `sample` is of a size worth
+    /// collecting.  Return true if this call completed the collection of
+    /// samples, in which case the caller is expected to call `train`, and
+    /// false otherwise.
+    bool observe(const bdlbb::Blob& sample);
+
+    /// Train a dictionary out of the collected samples, register it with
+    /// `CompressionDictionaryRegistry`, and release the samples.  Return 0
+    /// on success, and non-zero otherwise, in which case no dictionary is
+    /// trained by this object.  The behavior is undefined unless a
+    /// previous call to `observe` returned true and `train` has not been
+    /// called since.
+    int train();
+
+    // ACCESSORS
+
+    /// Return true if this object is still collecting samples, and false
+    /// otherwise.
+    bool isCollecting() const;
+
+    /// Return the trained dictionary, or 0 if none has been trained yet.
+    const CompressionDictionary* dictionary() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ---------------------------
+// class CompressionDictionary
+// ---------------------------
+
+inline bool CompressionDictionary::isValid() const
+{
+    return 0 != d_id;
+}
+
+inline unsigned int CompressionDictionary::id() const
+{
+    return d_id;
+}
+
+inline const bsl::vector<char>& CompressionDictionary::data() const
+{
+    return d_data;
+}
+
+inline const ZSTD_CDict_s* CompressionDictionary::compressionDict() const
+{
+    return d_compressionDict_p;
+}
+
+inline const ZSTD_DDict_s* CompressionDictionary::decompressionDict() const
+{
+    return d_decompressionDict_p;
+}
+
+// ----------------------------------
+// class CompressionDictionaryTrainer
+// ----------------------------------
+
+inline bool CompressionDictionaryTrainer::isCollecting() const
+{
+    return d_state == e_COLLECTING;
+}
+
+inline const CompressionDictionary*
+CompressionDictionaryTrainer::dictionary() const
+{
+    return d_dictionary;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,367 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqp_compressiondictionary.t.cpp                                   -*-C++-*-
+#include <bmqp_compressiondictionary.h>
+
+// BMQ
+#include <bmqp_compression.h>
+
+// MWC
+#include <mwcu_memoutstream.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bsl_string.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Load into the specified `blob` a small JSON-like record, similar for all
+/// values of the specified `index`.
+void makeSample(bdlbb::Blob* blob, int index)
+{
+    mwcu::MemOutStream os(s_allocator_p);
+    os << "{\"symbol\":\"SYM" << index % 37 << "\",\"price\":"
+       << (index * 7) % 1000 << ",\"side\":\""
+       << (index % 2 ? "BUY" : "SELL") << "\",\"account\":\"ACCOUNT"
+       << index % 13 << "\"}";
+
+    bdlbb::BlobUtil::append(blob,
+                            os.str().data(),
+                            static_cast<int>(os.str().length()));
+}
+
+/// Feed the specified `trainer` with samples until it is ready to train, and
+/// train it.  Return the result of `train`.
+int trainDictionary(bmqp::CompressionDictionaryTrainer* trainer,
+                    bdlbb::BlobBufferFactory*           factory)
+{
+    bool done = false;
+    for (int i = 0; !done; ++i) {
+        bdlbb::Blob sample(factory, s_allocator_p);
+        makeSample(&sample, i);
+        done = trainer->observe(sample);
+    }
+
+    return trainer->train();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise the basic functionality of the component.
+//
+// Testing:
+//   Basic functionality
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    {
+        PV("Invalid dictionary");
+
+        const char                  k_DATA[] = "not a dictionary";
+        bmqp::CompressionDictionary obj(k_DATA,
+                                        sizeof(k_DATA) - 1,
+                                        s_allocator_p);
+
+        ASSERT_EQ(obj.isValid(), false);
+        ASSERT_EQ(obj.id(), 0U);
+        ASSERT_EQ(bmqp::CompressionDictionary::idFromData(k_DATA,
+                                                          sizeof(k_DATA) - 1),
+                  0U);
+        ASSERT(bmqp::CompressionDictionaryRegistry::add(k_DATA,
+                                                        sizeof(k_DATA) - 1) ==
+               0);
+    }
+
+    {
+        PV("Trainer initial state");
+
+        bmqp::CompressionDictionaryTrainer obj(s_allocator_p);
+        bdlbb::PooledBlobBufferFactory     bufferFactory(128, s_allocator_p);
+        bdlbb::Blob tooSmall(&bufferFactory, s_allocator_p);
+        bdlbb::BlobUtil::append(&tooSmall, "abc", 3);
+
+        ASSERT(obj.dictionary() == 0);
+        ASSERT_EQ(obj.observe(tooSmall), false);
+        ASSERT(obj.dictionary() == 0);
+    }
+}
+
+static void test2_training()
+// ------------------------------------------------------------------------
+// TRAINING
+//
+// Concerns:
+//   1. The trainer asks for training once 'k_NUM_SAMPLES' samples were
+//      collected, and ignores samples afterwards.
+//   2. The trained dictionary is valid and registered.
+//   3. Registering the same content again returns the same dictionary.
+//
+// Testing:
+//   CompressionDictionaryTrainer::observe
+//   CompressionDictionaryTrainer::train
+//   CompressionDictionaryTrainer::dictionary
+//   CompressionDictionaryRegistry::add
+//   CompressionDictionaryRegistry::lookup
+// ------------------------------------------------------------------------
+{
+    s_ignoreCheckGblAlloc = true;
+    // The registry allocates dictionaries from the global allocator.
+
+    mwctst::TestHelper::printTestName("TRAINING");
+
+    bdlbb::PooledBlobBufferFactory     bufferFactory(128, s_allocator_p);
+    bmqp::CompressionDictionaryTrainer obj(s_allocator_p);
+
+    int numObserved = 0;
+    for (; numObserved < bmqp::CompressionDictionaryTrainer::k_NUM_SAMPLES;
+         ++numObserved) {
+        bdlbb::Blob sample(&bufferFactory, s_allocator_p);
+        makeSample(&sample, numObserved);
+        if (obj.observe(sample)) {
+            break;  // BREAK
+        }
+    }
+    ASSERT_EQ(numObserved,
+              bmqp::CompressionDictionaryTrainer::k_NUM_SAMPLES - 1);
+
+    ASSERT_EQ(obj.train(), 0);
+
+    const bmqp::CompressionDictionary* dictionary = obj.dictionary();
+    ASSERT(dictionary != 0);
+    ASSERT_EQ(dictionary->isValid(), true);
+    ASSERT_NE(dictionary->id(), 0U);
+    ASSERT_EQ(bmqp::CompressionDictionary::idFromData(
+                  dictionary->data().data(),
+                  static_cast<int>(dictionary->data().size())),
+              dictionary->id());
+
+    // Samples are ignored once trained
+    bdlbb::Blob sample(&bufferFactory, s_allocator_p);
+    makeSample(&sample, 0);
+    ASSERT_EQ(obj.observe(sample), false);
+
+    // Registration
+    ASSERT(bmqp::CompressionDictionaryRegistry::lookup(dictionary->id()) ==
+           dictionary);
+    ASSERT(bmqp::CompressionDictionaryRegistry::add(
+               dictionary->data().data(),
+               static_cast<int>(dictionary->data().size())) == dictionary);
+    ASSERT(bmqp::CompressionDictionaryRegistry::lookup(dictionary->id() +
+                                                       1) == 0);
+}
+
+static void test3_compression()
+// ------------------------------------------------------------------------
+// COMPRESSION
+//
+// Concerns:
+//   1. Data compressed with a dictionary decompresses back, as 'e_ZSTD',
+//      to the original data as long as the dictionary is registered.
+//   2. Small data compresses better with the dictionary than without.
+//   3. The id of the dictionary can be read from the compressed frame, and
+//      is 0 for frames compressed without dictionary.
+//
+// Testing:
+//   Compression::compress(..., const CompressionDictionary&, ...)
+//   Compression::decompress(..., e_ZSTD, ...)
+//   CompressionDictionary::frameDictionaryId
+// ------------------------------------------------------------------------
+{
+    s_ignoreCheckGblAlloc = true;
+    // The registry allocates dictionaries from the global allocator.
+
+    mwctst::TestHelper::printTestName("COMPRESSION");
+
+    bdlbb::PooledBlobBufferFactory     bufferFactory(32, s_allocator_p);
+    bmqp::CompressionDictionaryTrainer trainer(s_allocator_p);
+    ASSERT_EQ(trainDictionary(&trainer, &bufferFactory), 0);
+
+    const bmqp::CompressionDictionary* dictionary = trainer.dictionary();
+    ASSERT(dictionary != 0);
+
+    bdlbb::Blob input(&bufferFactory, s_allocator_p);
+    makeSample(&input, 1234);
+
+    bdlbb::Blob        withDictionary(&bufferFactory, s_allocator_p);
+    bdlbb::Blob        withoutDictionary(&bufferFactory, s_allocator_p);
+    mwcu::MemOutStream error(s_allocator_p);
+
+    ASSERT_EQ(bmqp::Compression::compress(&withDictionary,
+                                          &bufferFactory,
+                                          *dictionary,
+                                          input,
+                                          &error,
+                                          s_allocator_p),
+              0);
+    ASSERT_EQ(bmqp::Compression::compress(
+                  &withoutDictionary,
+                  &bufferFactory,
+                  bmqt::CompressionAlgorithmType::e_ZSTD,
+                  input,
+                  &error,
+                  s_allocator_p),
+              0);
+    PVV("Input: " << input.length()
+                  << ", with dictionary: " << withDictionary.length()
+                  << ", without dictionary: " << withoutDictionary.length());
+
+    ASSERT_GT(withoutDictionary.length(), withDictionary.length());
+
+    ASSERT_EQ(bmqp::CompressionDictionary::frameDictionaryId(withDictionary),
+              dictionary->id());
+    ASSERT_EQ(
+        bmqp::CompressionDictionary::frameDictionaryId(withoutDictionary),
+        0U);
+
+    // Offset and empty input
+    bdlbb::Blob prefixed(&bufferFactory, s_allocator_p);
+    bdlbb::BlobUtil::append(&prefixed, "pad", 3);
+    bdlbb::BlobUtil::append(&prefixed, withDictionary);
+    ASSERT_EQ(bmqp::CompressionDictionary::frameDictionaryId(prefixed, 3),
+              dictionary->id());
+    ASSERT_EQ(bmqp::CompressionDictionary::frameDictionaryId(
+                  prefixed,
+                  prefixed.length()),
+              0U);
+
+    bdlbb::Blob output(&bufferFactory, s_allocator_p);
+    ASSERT_EQ(bmqp::Compression::decompress(
+                  &output,
+                  &bufferFactory,
+                  bmqt::CompressionAlgorithmType::e_ZSTD,
+                  withDictionary,
+                  &error,
+                  s_allocator_p),
+              0);
+    ASSERT_EQ(bdlbb::BlobUtil::compare(output, input), 0);
+    ASSERT_EQ(error.length(), 0U);
+}
+
+static void test4_unknownDictionary()
+// ------------------------------------------------------------------------
+// UNKNOWN DICTIONARY
+//
+// Concerns:
+//   Decompressing a frame compressed with a dictionary which is not
+//   registered fails gracefully.
+//
+// Plan:
+//   Alter the dictionary id in the header of a frame compressed with a
+//   dictionary, so that it refers to a dictionary not in the registry.
+//
+// Testing:
+//   Compression::decompress(..., e_ZSTD, ...)
+// ------------------------------------------------------------------------
+{
+    s_ignoreCheckGblAlloc = true;
+    // The registry allocates dictionaries from the global allocator.
+
+    mwctst::TestHelper::printTestName("UNKNOWN DICTIONARY");
+
+    bdlbb::PooledBlobBufferFactory     bufferFactory(256, s_allocator_p);
+    bmqp::CompressionDictionaryTrainer trainer(s_allocator_p);
+    ASSERT_EQ(trainDictionary(&trainer, &bufferFactory), 0);
+
+    bdlbb::Blob input(&bufferFactory, s_allocator_p);
+    makeSample(&input, 42);
+
+    bdlbb::Blob compressed(&bufferFactory, s_allocator_p);
+    ASSERT_EQ(bmqp::Compression::compress(&compressed,
+                                          &bufferFactory,
+                                          *trainer.dictionary(),
+                                          input,
+                                          0,
+                                          s_allocator_p),
+              0);
+
+    // Find an id which is not registered.
+    unsigned int unknownId = trainer.dictionary()->id();
+    do {
+        ++unknownId;
+    } while (bmqp::CompressionDictionaryRegistry::lookup(unknownId));
+
+    // The dictionary id is stored little-endian right after the 4 bytes of
+    // magic number, the frame header descriptor and, unless the frame is
+    // single-segment, the window descriptor.  Trained dictionaries have ids
+    // requiring 4 bytes.
+    char*          header     = compressed.buffer(0).data();
+    const unsigned descriptor = static_cast<unsigned char>(header[4]);
+    const int      offset     = (descriptor & 0x20) ? 5 : 6;
+    ASSERT_EQ(descriptor & 0x3, 3U);
+
+    for (int i = 0; i < 4; ++i) {
+        header[offset + i] = static_cast<char>((unknownId >> (8 * i)) & 0xFF);
+    }
+    ASSERT_EQ(bmqp::CompressionDictionary::frameDictionaryId(compressed),
+              unknownId);
+
+    bdlbb::Blob        output(&bufferFactory, s_allocator_p);
+    mwcu::MemOutStream error(s_allocator_p);
+    ASSERT_NE(bmqp::Compression::decompress(
+                  &output,
+                  &bufferFactory,
+                  bmqt::CompressionAlgorithmType::e_ZSTD,
+                  compressed,
+                  &error,
+                  s_allocator_p),
+              0);
+    ASSERT_NE(error.length(), 0U);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 4: test4_unknownDictionary(); break;
+    case 3: test3_compression(); break;
+    case 2: test2_training(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -18,6 +18,7 @@
 
 #include <bmqscm_version.h>
 // BMQ
+#include <bmqp_messageguidgenerator.h>
 #include <bmqp_protocolutil.h>
 
 // MWC
@@ -40,6 +41,10 @@ ConfirmEventBuilder::ConfirmEventBuilder(
     bslma::Allocator*         allocator)
 : d_blob(bufferFactory, allocator)
 , d_msgCount(0)
+, d_rangeCount(0)
+, d_useRanges(false)
+, d_lastRangePosition()
+, d_nextGUID()
 {
     reset();
 }
@@ -48,7 +53,8 @@ void ConfirmEventBuilder::reset()
 {
     d_blob.removeAll();
 
-    d_msgCount = 0;
+    d_msgCount   = 0;
+    d_rangeCount = 0;
 
     // NOTE: Since ConfirmEventBuilder owns the blob and we just reset it, we
     //       have guarantee that buffer(0) will contain the entire headers
@@ -68,7 +74,22 @@ void ConfirmEventBuilder::reset()
     new (d_blob.buffer(0).data()) EventHeader(EventType::e_CONFIRM);
 
     // ConfirmHeader
-    new (d_blob.buffer(0).data() + sizeof(EventHeader)) ConfirmHeader();
+    ConfirmHeader* confirmHeader = new (d_blob.buffer(0).data() +
+                                        sizeof(EventHeader)) ConfirmHeader();
+    if (d_useRanges) {
+        confirmHeader->setFlags(ConfirmHeaderFlags::e_RANGES)
+            .setPerMessageWords(sizeof(ConfirmMessageRange) /
+                                Protocol::k_WORD_SIZE);
+    }
+}
+
+void ConfirmEventBuilder::setRangeEncoding(bool value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(messageCount() == 0);
+
+    d_useRanges = value;
+    reset();
 }
 
 bmqt::EventBuilderResult::Enum
@@ -80,6 +101,10 @@ ConfirmEventBuilder::appendMessage(int                      queueId,
     // 'bmqt::EventBuilderResult::Enum' values because the return value is
     // directly exposed to the client.
 
+    if (d_useRanges) {
+        return appendToRange(queueId, subQueueId, guid);  // RETURN
+    }
+
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(messageCount() ==
                                               maxMessageCount())) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
@@ -109,6 +134,59 @@ ConfirmEventBuilder::appendMessage(int                      queueId,
     return bmqt::EventBuilderResult::e_SUCCESS;
 }
 
+bmqt::EventBuilderResult::Enum
+ConfirmEventBuilder::appendToRange(int                      queueId,
+                                   int                      subQueueId,
+                                   const bmqt::MessageGUID& guid)
+{
+    if (d_rangeCount != 0 && guid == d_nextGUID) {
+        mwcu::BlobObjectProxy<ConfirmMessageRange> range(&d_blob,
+                                                         d_lastRangePosition,
+                                                         true,   // read
+                                                         true);  // write
+        const ConfirmMessage& last = range->firstMessage();
+        if (queueId == last.queueId() && subQueueId == last.subQueueId() &&
+            range->count() < ConfirmMessageRange::k_MAX_COUNT) {
+            // This message extends the last range: only update its count.
+            range->setCount(range->count() + 1);
+            range.reset();  // i.e., flush writing to blob.
+
+            MessageGUIDGenerator::loadNextGUID(&d_nextGUID, guid);
+            ++d_msgCount;
+
+            return bmqt::EventBuilderResult::e_SUCCESS;  // RETURN
+        }
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_rangeCount ==
+                                              maxRangeCount())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return bmqt::EventBuilderResult::e_EVENT_TOO_BIG;  // RETURN
+    }
+
+    // Start a new range: resize the blob to have space for a
+    // 'ConfirmMessageRange' at the end ...
+    mwcu::BlobUtil::reserve(&d_lastRangePosition,
+                            &d_blob,
+                            sizeof(ConfirmMessageRange));
+
+    mwcu::BlobObjectProxy<ConfirmMessageRange> range(&d_blob,
+                                                     d_lastRangePosition,
+                                                     false,  // no read
+                                                     true);  // write mode
+    ConfirmMessage message;
+    message.setQueueId(queueId).setSubQueueId(subQueueId).setMessageGUID(
+        guid);
+    *range = ConfirmMessageRange(message, 1);
+    range.reset();  // i.e., flush writing to blob.
+
+    MessageGUIDGenerator::loadNextGUID(&d_nextGUID, guid);
+    ++d_rangeCount;
+    ++d_msgCount;
+
+    return bmqt::EventBuilderResult::e_SUCCESS;
+}
+
 const bdlbb::Blob& ConfirmEventBuilder::blob() const
 {
     // PRECONDITIONS
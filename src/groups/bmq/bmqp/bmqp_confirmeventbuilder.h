@@ -28,6 +28,21 @@
 // An 'ConfirmEventBuilder' can be reused to build multiple Events, by calling
 // the 'reset()' method on it.
 //
+/// Range encoding
+///--------------
+// Consumers processing messages in order confirm runs of messages for the
+// same queue and subQueue which, when posted by the same producer, have
+// consecutive GUIDs (as generated in bulk by
+// 'MessageGUIDGenerator::generateGUIDs').  When range encoding is enabled
+// (see 'setRangeEncoding'), the event is made of 'ConfirmMessageRange'
+// instead of 'ConfirmMessage', and the builder collapses such runs of
+// confirmations into a single range.  The 'ConfirmHeaderFlags::e_RANGES'
+// flag is set in the 'ConfirmHeader' of such an event, and
+// 'bmqp::ConfirmMessageIterator' either transparently expands the ranges
+// into the original messages, or iterates over the ranges themselves.
+// Range encoding must only be enabled if the peer advertised the
+// 'ConfirmFeatures::k_RANGES' feature.
+//
 /// Padding
 ///-------
 // ConfirmEvent messages are not meant to be sent in batch and are therefore
@@ -63,6 +78,9 @@
 #include <bmqt_messageguid.h>
 #include <bmqt_resultcode.h>
 
+// MWC
+#include <mwcu_blob.h>
+
 // BDE
 #include <bdlbb_blob.h>
 #include <bslma_usesbslmaallocator.h>
@@ -88,6 +106,28 @@ class ConfirmEventBuilder {
     int d_msgCount;              // number of messages currently in the
                                  // event
 
+    int d_rangeCount;  // number of ranges currently in the
+                       // event, if range encoding is enabled
+
+    bool d_useRanges;  // whether range encoding is enabled
+
+    mwcu::BlobPosition d_lastRangePosition;
+    // position of the last range in the
+    // blob
+
+    bmqt::MessageGUID d_nextGUID;  // GUID of the message which would extend
+                                   // the last range
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Append a confirmation for the specified `queueId`, `subQueueId` and
+    /// `guid` to the last range of the event being built if it extends it,
+    /// or to a new range otherwise.  Return 0 on success, or a non-zero
+    /// code if it failed (due to event being full).
+    bmqt::EventBuilderResult::Enum
+    appendToRange(int queueId, int subQueueId, const bmqt::MessageGUID& guid);
+
   private:
     // NOT IMPLEMENTED
     ConfirmEventBuilder(const ConfirmEventBuilder&) BSLS_KEYWORD_DELETED;
@@ -116,6 +156,12 @@ class ConfirmEventBuilder {
     /// content of the blob returned by the `blob()` method.
     void reset();
 
+    /// Enable range encoding if the specified `value` is true, and disable
+    /// it otherwise (see `Range encoding` in the component documentation).
+    /// The behavior is undefined unless this builder is empty, i.e.,
+    /// `messageCount() == 0`.
+    void setRangeEncoding(bool value);
+
     /// Append a ConfirmMessage for the specified `queueId`, `subQueueId`,
     /// and `guid` to the event being built.  Return 0 if the message was
     /// successfully added, or a non-zero code if it failed (due to event
@@ -125,13 +171,22 @@ class ConfirmEventBuilder {
 
     // ACCESSORS
 
+    /// Return true if range encoding is enabled, and false otherwise.
+    bool isRangeEncoding() const;
+
     /// Return the number of messages currently in the event being built.
+    /// Note that, if range encoding is enabled, this is the number of
+    /// messages in all of the ranges.
     int messageCount() const;
 
     /// Return the maximum number of messages that can be added to this
     /// event, with respect to protocol limitations.
     int maxMessageCount() const;
 
+    /// Return the maximum number of ranges that can be added to this event,
+    /// with respect to protocol limitations, if range encoding is enabled.
+    int maxRangeCount() const;
+
     /// Return the current size of the event being built.  If no messages
     /// were added, this will return 0.
     int eventSize() const;
@@ -150,6 +205,11 @@ class ConfirmEventBuilder {
 // class ConfirmEventBuilder
 // -------------------------
 
+inline bool ConfirmEventBuilder::isRangeEncoding() const
+{
+    return d_useRanges;
+}
+
 inline int ConfirmEventBuilder::messageCount() const
 {
     return d_msgCount;
@@ -163,6 +223,14 @@ inline int ConfirmEventBuilder::maxMessageCount() const
     return res;
 }
 
+inline int ConfirmEventBuilder::maxRangeCount() const
+{
+    static const int res = (EventHeader::k_MAX_SIZE_SOFT -
+                            sizeof(EventHeader) - sizeof(ConfirmHeader)) /
+                           sizeof(ConfirmMessageRange);
+    return res;
+}
+
 inline int ConfirmEventBuilder::eventSize() const
 {
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(messageCount() == 0)) {
@@ -17,6 +17,9 @@
 #include <bmqp_confirmmessageiterator.h>
 
 #include <bmqscm_version.h>
+// BMQ
+#include <bmqp_messageguidgenerator.h>
+
 // BDE
 #include <bdlbb_blob.h>
 #include <bsl_iostream.h>
@@ -31,8 +34,10 @@ namespace bmqp {
 
 void ConfirmMessageIterator::copyFrom(const ConfirmMessageIterator& src)
 {
-    d_blobIter      = src.d_blobIter;
-    d_advanceLength = src.d_advanceLength;
+    d_blobIter       = src.d_blobIter;
+    d_advanceLength  = src.d_advanceLength;
+    d_rangeMessage   = src.d_rangeMessage;
+    d_rangeRemaining = src.d_rangeRemaining;
 
     if (!src.d_header.isSet()) {
         d_header.reset();
@@ -72,6 +77,8 @@ int ConfirmMessageIterator::next()
                                   // message declared in the header
         ,
         rc_INVALID_ADVANCE_LENGTH = -3  // Advance length is not positive
+        ,
+        rc_INVALID_RANGE = -4  // The range has no messages, or too many
     };
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
@@ -79,6 +86,18 @@ int ConfirmMessageIterator::next()
         return rc_INVALID;  // RETURN
     }
 
+    if (d_rangeRemaining > 0) {
+        // Next message of the current range: it has the next GUID.
+        --d_rangeRemaining;
+
+        bmqt::MessageGUID guid;
+        MessageGUIDGenerator::loadNextGUID(&guid,
+                                           d_rangeMessage.messageGUID());
+        d_rangeMessage.setMessageGUID(guid);
+
+        return rc_HAS_NEXT;  // RETURN
+    }
+
     if (d_blobIter.advance(d_advanceLength) == false) {
         d_header.reset();
         return rc_AT_END;  // RETURN
@@ -111,6 +130,29 @@ int ConfirmMessageIterator::next()
         return rc_NOT_ENOUGH_BYTES;  // RETURN
     }
 
+    if (isRangeEncoded()) {
+        mwcu::BlobObjectProxy<ConfirmMessageRange> range(
+            d_blobIter.blob(),
+            d_blobIter.position(),
+            d_header->perMessageWords() * Protocol::k_WORD_SIZE,
+            true,
+            false);
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!range.isSet())) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            return rc_NOT_ENOUGH_BYTES;  // RETURN
+        }
+
+        const int count = range->count();
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                count <= 0 || count > ConfirmMessageRange::k_MAX_COUNT)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            return rc_INVALID_RANGE;  // RETURN
+        }
+
+        d_rangeMessage   = range->firstMessage();
+        d_rangeRemaining = count - 1;
+    }
+
     return rc_HAS_NEXT;
 }
 
@@ -134,6 +176,9 @@ int ConfirmMessageIterator::reset(const bdlbb::Blob* blob,
         rc_NOT_ENOUGH_BYTES = -3  // The number of bytes in the blob is
                                   // less than the header size declared
                                   // in the header
+        ,
+        rc_INVALID_RANGES = -4  // The header declares ranges smaller
+                                // than a 'ConfirmMessageRange'
     };
 
     d_blobIter.reset(blob, mwcu::BlobPosition(), blob->length(), true);
@@ -193,8 +238,18 @@ int ConfirmMessageIterator::reset(const bdlbb::Blob* blob,
         return rc_INVALID_CONFIRMHEADER;  // RETURN
     }
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            isRangeEncoded() &&
+            d_header->perMessageWords() * Protocol::k_WORD_SIZE <
+                static_cast<int>(sizeof(ConfirmMessageRange)))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        d_header.reset();
+        return rc_INVALID_RANGES;  // RETURN
+    }
+
     // Reset the current message
     d_message.reset();
+    d_rangeRemaining = 0;
 
     // Below code snippet is needed so that 'next()' works seamlessly during
     // first invocation too, by skipping over the 'ConfirmHeader'.
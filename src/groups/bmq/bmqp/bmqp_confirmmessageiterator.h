@@ -26,6 +26,18 @@
 // providing read-only sequential access to messages contained into an
 // ConfirmEvent.
 //
+/// Range encoding
+///--------------
+// If the event is range encoded (see 'ConfirmHeaderFlags::e_RANGES' and
+// 'bmqp::ConfirmEventBuilder'), 'next' transparently expands each
+// 'ConfirmMessageRange' into the messages it stands for, so that the
+// iterator can be used the same way for both encodings.  Alternatively,
+// 'nextRange' advances to the first message of the next range, and
+// 'rangeLength' returns the number of messages of the range starting with
+// the current message, which allows processing a range at once.  Note that
+// each message of an event which is not range encoded is a range of one
+// message.
+//
 /// Error handling: Logging and Assertion
 ///-------------------------------------
 //: o logging: This iterator will not log anything in case of invalid data:
@@ -95,6 +107,16 @@ class ConfirmMessageIterator {
     // How much should we advance in
     // 'next()'.
 
+    ConfirmMessage d_rangeMessage;
+    // Current message, if the event is
+    // range encoded.
+
+    int d_rangeRemaining;
+    // Number of messages remaining in
+    // the current range after the current
+    // message, if the event is range
+    // encoded.
+
   private:
     // PRIVATE MANIPULATORS
 
@@ -135,6 +157,15 @@ class ConfirmMessageIterator {
     /// and `isValid`.
     int next();
 
+    /// Advance to the first message of the next range, skipping the
+    /// remaining messages of the current range, if any.  Return 1 if the
+    /// new position is valid and represent a valid message, 0 if iteration
+    /// has reached the end of the event, or < 0 if an error was
+    /// encountered.  Note that if this method returns 0, this instance goes
+    /// in an invalid state, and after that, only valid operations on this
+    /// instance are assignment, `reset` and `isValid`.
+    int nextRange();
+
     /// Reset this instance using the specified `blob` and `eventHeader`.
     /// Behavior is undefined if the `blob` pointer is null, or the
     /// pointed-to blob does not contain enough bytes to fit at least the
@@ -159,6 +190,19 @@ class ConfirmMessageIterator {
     /// Behavior is undefined unless `isValid` returns true.
     const ConfirmHeader& header() const;
 
+    /// Return true if this event is made of `ConfirmMessageRange`, and
+    /// false otherwise.  Behavior is undefined unless `isValid` returns
+    /// true.
+    bool isRangeEncoded() const;
+
+    /// Return the number of messages of the range starting with the message
+    /// currently pointed to by this iterator, including that message, i.e.,
+    /// the message returned by `message()` and the following messages
+    /// having the next GUIDs (see `MessageGUIDGenerator::loadNextGUID`).
+    /// Behavior is undefined unless latest call to `next()` or
+    /// `nextRange()` returned 1.
+    int rangeLength() const;
+
     /// Return a const reference to the message currently point to by this
     /// iterator.  Behavior is undefined unless latest call to `next()`
     /// returned 1.
@@ -177,6 +221,8 @@ class ConfirmMessageIterator {
 inline ConfirmMessageIterator::ConfirmMessageIterator()
 : d_blobIter(0, mwcu::BlobPosition(), 0, true)
 , d_advanceLength(0)
+, d_rangeMessage()
+, d_rangeRemaining(0)
 {
     // NOTHING
 }
@@ -185,6 +231,8 @@ inline ConfirmMessageIterator::ConfirmMessageIterator(
     const bdlbb::Blob* blob,
     const EventHeader& eventHeader)
 : d_blobIter(0, mwcu::BlobPosition(), 0, true)  // no def ctor - set in reset
+, d_rangeMessage()
+, d_rangeRemaining(0)
 {
     reset(blob, eventHeader);
 }
@@ -195,6 +243,8 @@ inline ConfirmMessageIterator::ConfirmMessageIterator(
              mwcu::BlobPosition(),
              0,
              true)  // no def ctor - set in copyFrom
+, d_rangeMessage()
+, d_rangeRemaining(0)
 {
     copyFrom(src);
 }
@@ -212,7 +262,14 @@ inline void ConfirmMessageIterator::clear()
     d_blobIter.reset(0, mwcu::BlobPosition(), 0, true);
     d_header.reset();
     d_message.reset();
-    d_advanceLength = 0;
+    d_advanceLength  = 0;
+    d_rangeRemaining = 0;
+}
+
+inline int ConfirmMessageIterator::nextRange()
+{
+    d_rangeRemaining = 0;
+    return next();
 }
 
 // ACCESSORS
@@ -229,12 +286,28 @@ inline const ConfirmHeader& ConfirmMessageIterator::header() const
     return *d_header;
 }
 
+inline bool ConfirmMessageIterator::isRangeEncoded() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isValid());
+
+    return d_header->flags() & ConfirmHeaderFlags::e_RANGES;
+}
+
+inline int ConfirmMessageIterator::rangeLength() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isValid());
+
+    return d_rangeRemaining + 1;
+}
+
 inline const ConfirmMessage& ConfirmMessageIterator::message() const
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(isValid());
 
-    return *d_message;
+    return isRangeEncoded() ? d_rangeMessage : *d_message;
 }
 
 }  // close package namespace
@@ -17,6 +17,7 @@
 #include <bmqp_confirmmessageiterator.h>
 
 // BMQ
+#include <bmqp_messageguidgenerator.h>
 #include <bmqp_protocol.h>
 #include <bmqt_messageguid.h>
 
@@ -181,6 +182,59 @@ static void populateBlob(bdlbb::Blob*             blob,
     appendConfirmMessage(blob, data);
 }
 
+/// Populate the specified `blob` with a range encoded ConfirmMessage event
+/// made of the specified `numRanges` ranges, each one of the corresponding
+/// specified `counts` messages for the specified `queueId` and
+/// `subQueueId`, and starting with the specified `guid`; and populate the
+/// specified `eh` with the corresponding event header.
+static void populateRangeBlob(bdlbb::Blob*             blob,
+                              bmqp::EventHeader*       eh,
+                              int                      queueId,
+                              const bmqt::MessageGUID& guid,
+                              int                      subQueueId,
+                              const int*               counts,
+                              int                      numRanges)
+{
+    int eventLength = sizeof(bmqp::EventHeader) + sizeof(bmqp::ConfirmHeader) +
+                      numRanges * sizeof(bmqp::ConfirmMessageRange);
+
+    // Event Header
+    (*eh)
+        .setType(bmqp::EventType::e_CONFIRM)
+        .setLength(eventLength)
+        .setHeaderWords(sizeof(bmqp::EventHeader) /
+                        bmqp::Protocol::k_WORD_SIZE);
+
+    bdlbb::BlobUtil::append(blob,
+                            reinterpret_cast<const char*>(eh),
+                            sizeof(bmqp::EventHeader));
+
+    // Confirm Header
+    bmqp::ConfirmHeader ch;
+    ch.setFlags(bmqp::ConfirmHeaderFlags::e_RANGES)
+        .setHeaderWords(sizeof(bmqp::ConfirmHeader) /
+                        bmqp::Protocol::k_WORD_SIZE)
+        .setPerMessageWords(sizeof(bmqp::ConfirmMessageRange) /
+                            bmqp::Protocol::k_WORD_SIZE);
+
+    bdlbb::BlobUtil::append(blob,
+                            reinterpret_cast<const char*>(&ch),
+                            sizeof(bmqp::ConfirmHeader));
+
+    // Confirm Message Ranges
+    bmqp::ConfirmMessage message;
+    message.setQueueId(queueId).setMessageGUID(guid).setSubQueueId(
+        subQueueId);
+
+    for (int i = 0; i < numRanges; ++i) {
+        const bmqp::ConfirmMessageRange range(message, counts[i]);
+
+        bdlbb::BlobUtil::append(blob,
+                                reinterpret_cast<const char*>(&range),
+                                sizeof(bmqp::ConfirmMessageRange));
+    }
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -555,6 +609,176 @@ static void test5_dumpBlob()
         ASSERT_EQ(str1, str2);
     }
 }
+static void test6_rangeEncodedEvent()
+{
+    // --------------------------------------------------------------------
+    // RANGE ENCODED EVENT
+    //
+    // Concerns:
+    //   1. Each 'ConfirmMessageRange' of a range encoded event is
+    //      expanded by 'next' into as many messages as its count, having
+    //      consecutive GUIDs.
+    //   2. 'nextRange' skips the remaining messages of the current range,
+    //      and 'rangeLength' returns the number of messages of the range
+    //      starting with the current message.
+    //   3. Iterating over a range having an invalid count fails.
+    //   4. An event declaring ranges smaller than 'ConfirmMessageRange' is
+    //      invalid.
+    //
+    // Plan:
+    //   1. Create a blob containing two ranges and iterate over it, using
+    //      'next' and 'nextRange'.
+    //   2. Create blobs containing a range of zero message, and a range
+    //      of more than 'ConfirmMessageRange::k_MAX_COUNT' messages, and
+    //      iterate over them.
+    //   3. Create a blob with the 'e_RANGES' flag, but containing
+    //      'ConfirmMessage' and initialize an iterator with it.
+    //
+    // Testing:
+    //   bool isRangeEncoded() const;
+    //   int rangeLength() const;
+    //   int next();
+    //   int nextRange();
+    // --------------------------------------------------------------------
+    mwctst::TestHelper::printTestName("RANGE ENCODED EVENT");
+
+    const int k_QUEUE_ID     = 9876;
+    const int k_SUB_QUEUE_ID = 1234;
+    const int k_COUNTS[]     = {10, 3};
+    const int k_NUM_RANGES   = sizeof(k_COUNTS) / sizeof(*k_COUNTS);
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    bmqp::EventHeader              eventHeader;
+    bmqt::MessageGUID              guid;
+    guid.fromHex("0000000000003039CD8101000000270F");
+
+    {
+        PVV("Valid ranges, expanded");
+        bdlbb::Blob blob(&bufferFactory, s_allocator_p);
+        populateRangeBlob(&blob,
+                          &eventHeader,
+                          k_QUEUE_ID,
+                          guid,
+                          k_SUB_QUEUE_ID,
+                          k_COUNTS,
+                          k_NUM_RANGES);
+
+        bmqp::ConfirmMessageIterator iter(&blob, eventHeader);
+        ASSERT(iter.isValid());
+        ASSERT(iter.isRangeEncoded());
+
+        for (int r = 0; r < k_NUM_RANGES; ++r) {
+            bmqt::MessageGUID expectedGUID = guid;
+            for (int i = 0; i < k_COUNTS[r]; ++i) {
+                ASSERT_EQ_D(i, iter.next(), 1);
+                ASSERT_EQ_D(i, iter.rangeLength(), k_COUNTS[r] - i);
+                ASSERT_EQ_D(i, iter.message().queueId(), k_QUEUE_ID);
+                ASSERT_EQ_D(i, iter.message().messageGUID(), expectedGUID);
+                ASSERT_EQ_D(i, iter.message().subQueueId(), k_SUB_QUEUE_ID);
+
+                bmqt::MessageGUID next;
+                bmqp::MessageGUIDGenerator::loadNextGUID(&next,
+                                                         expectedGUID);
+                expectedGUID = next;
+            }
+        }
+        ASSERT_EQ(iter.next(), 0);
+        ASSERT_EQ(iter.isValid(), false);
+    }
+
+    {
+        PVV("Valid ranges, by range");
+        bdlbb::Blob blob(&bufferFactory, s_allocator_p);
+        populateRangeBlob(&blob,
+                          &eventHeader,
+                          k_QUEUE_ID,
+                          guid,
+                          k_SUB_QUEUE_ID,
+                          k_COUNTS,
+                          k_NUM_RANGES);
+
+        bmqp::ConfirmMessageIterator iter(&blob, eventHeader);
+        ASSERT(iter.isValid());
+
+        ASSERT_EQ(iter.nextRange(), 1);
+        ASSERT_EQ(iter.rangeLength(), k_COUNTS[0]);
+        ASSERT_EQ(iter.message().messageGUID(), guid);
+
+        // Skip the rest of the current range from its second message
+        ASSERT_EQ(iter.next(), 1);
+        ASSERT_EQ(iter.rangeLength(), k_COUNTS[0] - 1);
+        ASSERT_EQ(iter.nextRange(), 1);
+        ASSERT_EQ(iter.rangeLength(), k_COUNTS[1]);
+        ASSERT_EQ(iter.message().messageGUID(), guid);
+        ASSERT_EQ(iter.message().queueId(), k_QUEUE_ID);
+        ASSERT_EQ(iter.message().subQueueId(), k_SUB_QUEUE_ID);
+
+        ASSERT_EQ(iter.nextRange(), 0);
+        ASSERT_EQ(iter.isValid(), false);
+    }
+
+    {
+        PVV("Not range encoded event");
+        bdlbb::Blob blob(&bufferFactory, s_allocator_p);
+        populateBlob(&blob, &eventHeader, k_QUEUE_ID, guid, k_SUB_QUEUE_ID);
+
+        bmqp::ConfirmMessageIterator iter(&blob, eventHeader);
+        ASSERT(iter.isValid());
+        ASSERT(!iter.isRangeEncoded());
+        ASSERT_EQ(iter.nextRange(), 1);
+        ASSERT_EQ(iter.rangeLength(), 1);
+        ASSERT_EQ(iter.message().messageGUID(), guid);
+        ASSERT_EQ(iter.nextRange(), 0);
+    }
+
+    {
+        PVV("Empty range");
+        const int   k_EMPTY = 0;
+        bdlbb::Blob blob(&bufferFactory, s_allocator_p);
+        populateRangeBlob(&blob,
+                          &eventHeader,
+                          k_QUEUE_ID,
+                          guid,
+                          k_SUB_QUEUE_ID,
+                          &k_EMPTY,
+                          1);
+
+        bmqp::ConfirmMessageIterator iter(&blob, eventHeader);
+        ASSERT(iter.isValid());
+        ASSERT_LT(iter.next(), 0);  // rc_INVALID_RANGE
+    }
+
+    {
+        PVV("Range of too many messages");
+        const int   k_TOO_MANY = bmqp::ConfirmMessageRange::k_MAX_COUNT + 1;
+        bdlbb::Blob blob(&bufferFactory, s_allocator_p);
+        populateRangeBlob(&blob,
+                          &eventHeader,
+                          k_QUEUE_ID,
+                          guid,
+                          k_SUB_QUEUE_ID,
+                          &k_TOO_MANY,
+                          1);
+
+        bmqp::ConfirmMessageIterator iter(&blob, eventHeader);
+        ASSERT(iter.isValid());
+        ASSERT_LT(iter.next(), 0);  // rc_INVALID_RANGE
+    }
+
+    {
+        PVV("Ranges smaller than ConfirmMessageRange");
+        bdlbb::Blob blob(&bufferFactory, s_allocator_p);
+        populateBlob(&blob, &eventHeader, k_QUEUE_ID, guid, k_SUB_QUEUE_ID);
+
+        bmqp::ConfirmHeader* ch = reinterpret_cast<bmqp::ConfirmHeader*>(
+            blob.buffer(0).data() + sizeof(bmqp::EventHeader));
+        ch->setFlags(bmqp::ConfirmHeaderFlags::e_RANGES);
+
+        bmqp::ConfirmMessageIterator iter(&blob, eventHeader);
+        ASSERT(!iter.isValid());
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -565,6 +789,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 6: test6_rangeEncodedEvent(); break;
     case 5: test5_dumpBlob(); break;
     case 4: test4_resetMethod(); break;
     case 3: test3_nextMethod(); break;
@@ -52,6 +52,21 @@
 //: o sparc: runtime check is detected by the 'is_sparc_crc32c_avail' system
 //:   call
 //
+// On 64-bit x86, buffers of at least 64 bytes are additionally processed by a
+// carry-less multiplication "folding" implementation when the running
+// platform supports the PCLMULQDQ instruction, and buffers of at least 256
+// bytes by a 512-bit wide flavor of it when the running platform supports
+// the AVX-512F and VPCLMULQDQ instructions (and the compiler is recent
+// enough to generate them).  These are selected at runtime by 'initialize()'
+// and require no specific compilation flags.
+//
+// The CRC32-C values of many independent small buffers (e.g., the messages of
+// an event) can be calculated at once with 'calculateMultiple'.  On 64-bit
+// x86, the buffers smaller than 1 KiB are processed three at a time, by
+// interleaving three independent chains of 'crc32q' instructions, which keeps
+// the CRC unit busy where a single small buffer uses a third of its
+// throughput.
+//
 /// Performance
 ///-----------
 // Below are performance comparisons of the hardware-accelerated and software
@@ -91,6 +106,12 @@
 //  Software                       | 1.582   GB per second
 //  BDE 'bdlde::crc32'             | 374.265 MB per second
 //..
+// On a more recent CPU supporting AVX-512 and VPCLMULQDQ, for 1 MiB buffers:
+//..
+//  Triplet  (SSE4.2)              | 18.2    GB per second
+//  Folding  (PCLMULQDQ)           | 21.9    GB per second
+//  Folding  (AVX-512 VPCLMULQDQ)  | 62.1    GB per second
+//..
 //
 /// Calculation Time
 ///  - - - - - - - -
@@ -215,6 +236,7 @@
 
 // BDE
 #include <bdlbb_blob.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 namespace bmqp {
@@ -235,6 +257,14 @@ struct Crc32c {
                                      unsigned int         length,
                                      unsigned int         crc);
 
+    /// Contiguous buffer, for which `calculateMultiple` calculates a
+    /// CRC32-C value.
+    struct Buffer {
+        const void* d_data;  // address of the data, 0 if 'd_length' is 0
+
+        unsigned int d_length;  // number of bytes of the data
+    };
+
     // CONSTANTS
 
     /// CRC32-C value for a 0 length input.  Note that a buffer with this
@@ -268,6 +298,30 @@ struct Crc32c {
     /// at least once.
     static unsigned int calculate(const bdlbb::Blob& blob,
                                   unsigned int       crc = k_NULL_CRC32C);
+
+    /// Load into each of the specified `numBuffers` elements of the
+    /// specified `crcs` array the CRC32-C value calculated for the
+    /// corresponding element of the specified `buffers` array, starting
+    /// from `k_NULL_CRC32C`.  This utilizes the default implementation as
+    /// set by `initialize()`, interleaving the calculations for small
+    /// buffers when supported by the running platform.  The behavior is
+    /// undefined unless `initialize()` has been called prior to calling
+    /// this method at least once, and `crcs` and `buffers` have at least
+    /// `numBuffers` elements.  Note that the result is the same as calling
+    /// `calculate` for each buffer, only faster.
+    static void calculateMultiple(unsigned int* crcs,
+                                  const Buffer* buffers,
+                                  int           numBuffers);
+
+    /// Return the CRC32-C value of the concatenation of a first buffer
+    /// having the specified `crc1` CRC32-C value, and of a second buffer
+    /// having the specified `crc2` CRC32-C value and the specified
+    /// `length2` number of bytes.  This allows CRC32-C values of adjacent
+    /// parts of a dataset to be calculated independently (e.g., in parallel)
+    /// and be combined afterwards.  Note that `crc2` must have been
+    /// calculated starting from `k_NULL_CRC32C`.
+    static unsigned int
+    combine(unsigned int crc1, unsigned int crc2, bsls::Types::Uint64 length2);
 };
 
 // ==================
@@ -313,6 +367,43 @@ struct Crc32c_Impl {
     calculateHardwareSerial(const void*  data,
                             unsigned int length,
                             unsigned int crc = Crc32c::k_NULL_CRC32C);
+
+    /// Return the CRC32-C value calculated for the specified `data` over
+    /// the specified `length` number of bytes, using the optionally
+    /// specified `crc` value as the starting point for the calculation.
+    /// This utilizes the PCLMULQDQ folding implementation to perform the
+    /// calculation.  Note that this function will fall back to
+    /// `calculateHardwareSerial` when running on unsupported platforms.
+    /// The behavior is undefined unless `Crc32c::initialize()` has been
+    /// called prior to calling this method at least once.  Note that if
+    /// `data` is 0, then `length` must also be 0.
+    static unsigned int
+    calculateHardwareClmul(const void*  data,
+                           unsigned int length,
+                           unsigned int crc = Crc32c::k_NULL_CRC32C);
+
+    /// Return the CRC32-C value calculated for the specified `data` over
+    /// the specified `length` number of bytes, using the optionally
+    /// specified `crc` value as the starting point for the calculation.
+    /// This utilizes the AVX-512 VPCLMULQDQ folding implementation to
+    /// perform the calculation.  Note that this function will fall back to
+    /// `calculateHardwareClmul` when running on unsupported platforms.  The
+    /// behavior is undefined unless `Crc32c::initialize()` has been called
+    /// prior to calling this method at least once.  Note that if `data` is
+    /// 0, then `length` must also be 0.
+    static unsigned int
+    calculateHardwareAvx512(const void*  data,
+                            unsigned int length,
+                            unsigned int crc = Crc32c::k_NULL_CRC32C);
+
+    /// Return true if the `calculateHardwareClmul` (respectively
+    /// `calculateHardwareAvx512`) implementation is supported by the
+    /// running platform, and false if it falls back to another
+    /// implementation.  The behavior is undefined unless
+    /// `Crc32c::initialize()` has been called prior to calling this method
+    /// at least once.
+    static bool isHardwareClmulAvailable();
+    static bool isHardwareAvx512Available();
 };
 
 }  // close package namespace
@@ -89,6 +89,40 @@ static void threadFunction(bsl::vector<unsigned int>* out,
     }
 }
 
+/// Signature of a function calculating a CRC32-C value, used to compare
+/// the various implementations.
+typedef unsigned int (*CalculateFn)(const void*  data,
+                                    unsigned int length,
+                                    unsigned int crc);
+
+/// Return the CRC32-C value calculated for the specified `data` over the
+/// specified `length` number of bytes using `bdlde::crc32`.  Note that the
+/// specified `crc` is ignored.
+static unsigned int
+calculateBdlde(const void* data, unsigned int length, unsigned int crc)
+{
+    static_cast<void>(crc);
+
+    bdlde::Crc32 crcBde(data, length);
+    return crcBde.checksum();
+}
+
+/// Struct describing an implementation of CRC32-C calculation to compare.
+struct Backend {
+    const char* d_name;
+    CalculateFn d_calculateFn;
+};
+
+const Backend k_BACKENDS[] = {
+    {"Default", &bmqp::Crc32c::calculate},
+    {"Software", &bmqp::Crc32c_Impl::calculateSoftware},
+    {"HW Serial", &bmqp::Crc32c_Impl::calculateHardwareSerial},
+    {"HW PCLMULQDQ", &bmqp::Crc32c_Impl::calculateHardwareClmul},
+    {"HW AVX-512", &bmqp::Crc32c_Impl::calculateHardwareAvx512},
+    {"bdlde::crc32", &calculateBdlde}};
+
+const int k_NUM_BACKENDS = sizeof(k_BACKENDS) / sizeof(*k_BACKENDS);
+
 /// Populate the specified `bufferLengths` with various lengths in
 /// increasing sorted order.  Return the maximum length populated.  Note
 /// that `bufferLengths` will be cleared.
@@ -195,6 +229,45 @@ static void populateBufferLengthsSorted_GoogleBenchmark_Large(
         b->Args({i});
     }
 }
+
+/// Apply to the specified Google Benchmark `b` the arguments pairs
+/// `{backend, length}` for every index in `k_BACKENDS` and various lengths
+/// up to 4 Mi.
+static void populateBackendsAndLengths_GoogleBenchmark(
+    benchmark::internal::Benchmark* b)
+{
+    std::vector<long int> buffLens;
+    buffLens.push_back(64);
+    buffLens.push_back(256);
+    buffLens.push_back(1024);     // 1 Ki
+    buffLens.push_back(4096);     // 4 Ki
+    buffLens.push_back(65536);    // 64 Ki
+    buffLens.push_back(1048576);  // 1 Mi
+    buffLens.push_back(4194304);  // 4 Mi
+    for (int backend = 0; backend < k_NUM_BACKENDS; ++backend) {
+        for (auto i : buffLens) {
+            b->Args({backend, i});
+        }
+    }
+}
+
+/// Apply to the specified Google Benchmark `b` the arguments pairs
+/// `{multiple, length}` for the serial and the interleaved calculations
+/// of multiple buffers, and various lengths up to 4 Ki.
+static void populateMultipleAndLengths_GoogleBenchmark(
+    benchmark::internal::Benchmark* b)
+{
+    std::vector<long int> buffLens;
+    buffLens.push_back(64);
+    buffLens.push_back(256);
+    buffLens.push_back(1024);  // 1 Ki
+    buffLens.push_back(4096);  // 4 Ki
+    for (int multiple = 0; multiple < 2; ++multiple) {
+        for (auto i : buffLens) {
+            b->Args({multiple, i});
+        }
+    }
+}
 #endif
 
 /// Print the specified `headers` to the specified `out` in the following
@@ -1287,6 +1360,286 @@ static void test8_calculateOnBlobWithPreviousCrc()
         ASSERT_EQ(crc32cSoftware, expectedCrc32c);
     }
 }
+static void test9_calculateHardwareFolding()
+// ------------------------------------------------------------------------
+// CALCULATE CRC32-C USING HARDWARE FOLDING
+//
+// Concerns:
+//   Verify the correctness of calculating CRC32-C using the PCLMULQDQ and
+//   AVX-512 VPCLMULQDQ folding implementations (or their fallbacks on
+//   unsupported platforms), for buffers of all sizes around the folding
+//   thresholds and block sizes, at any alignment, with and without a
+//   previous CRC.
+//
+// Plan:
+//   - For every length in [0 .. 2100] and a sample of larger lengths, and
+//     for every offset in [0 .. 7] from an alignment boundary, calculate
+//     CRC32-C using the folding implementations and the default
+//     implementation, and compare the result to the one calculated using
+//     the software implementation.
+//
+// Testing:
+//   - bmqp::Crc32c_Impl::calculateHardwareClmul(
+//                                      const void   *data,
+//                                      unsigned int  length,
+//                                      unsigned int  crc = k_NULL_CRC32C);
+//   - bmqp::Crc32c_Impl::calculateHardwareAvx512(
+//                                      const void   *data,
+//                                      unsigned int  length,
+//                                      unsigned int  crc = k_NULL_CRC32C);
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName(
+        "CALCULATE CRC32-C USING HARDWARE FOLDING");
+
+    PV("PCLMULQDQ available: "
+       << bmqp::Crc32c_Impl::isHardwareClmulAvailable());
+    PV("AVX-512 VPCLMULQDQ available: "
+       << bmqp::Crc32c_Impl::isHardwareAvx512Available());
+
+    const unsigned int k_MAX_SIZE = 262144 + 137;  // 256 Ki + 137
+    const unsigned int k_PREV_CRC = 0xA0EA6901;
+
+    bsl::vector<unsigned int> lengths(s_allocator_p);
+    for (unsigned int length = 0; length <= 2100; ++length) {
+        lengths.push_back(length);
+    }
+    lengths.push_back(4091);
+    lengths.push_back(4096);  // 4 Ki
+    lengths.push_back(4101);
+    lengths.push_back(65536);  // 64 Ki
+    lengths.push_back(65536 + 255);
+    lengths.push_back(262144);  // 256 Ki
+    lengths.push_back(k_MAX_SIZE - 8);
+
+    char* buffer = static_cast<char*>(s_allocator_p->allocate(k_MAX_SIZE));
+    bsl::generate_n(buffer, k_MAX_SIZE, bsl::rand);
+
+    for (unsigned int i = 0; i < lengths.size(); ++i) {
+        const unsigned int length = lengths[i];
+
+        for (unsigned int offset = 0; offset < 8; ++offset) {
+            const char* data = buffer + offset;
+
+            // No previous CRC
+            const unsigned int expected =
+                bmqp::Crc32c_Impl::calculateSoftware(data, length);
+
+            ASSERT_EQ_D(length << " @" << offset << " (Default)",
+                        bmqp::Crc32c::calculate(data, length),
+                        expected);
+            ASSERT_EQ_D(
+                length << " @" << offset << " (HW PCLMULQDQ)",
+                bmqp::Crc32c_Impl::calculateHardwareClmul(data, length),
+                expected);
+            ASSERT_EQ_D(
+                length << " @" << offset << " (HW AVX-512)",
+                bmqp::Crc32c_Impl::calculateHardwareAvx512(data, length),
+                expected);
+
+            // With previous CRC
+            const unsigned int expectedWithPrev =
+                bmqp::Crc32c_Impl::calculateSoftware(data, length, k_PREV_CRC);
+
+            ASSERT_EQ_D(length << " @" << offset << " (Default, prev)",
+                        bmqp::Crc32c::calculate(data, length, k_PREV_CRC),
+                        expectedWithPrev);
+            ASSERT_EQ_D(length << " @" << offset << " (HW PCLMULQDQ, prev)",
+                        bmqp::Crc32c_Impl::calculateHardwareClmul(data,
+                                                                  length,
+                                                                  k_PREV_CRC),
+                        expectedWithPrev);
+            ASSERT_EQ_D(length << " @" << offset << " (HW AVX-512, prev)",
+                        bmqp::Crc32c_Impl::calculateHardwareAvx512(
+                            data,
+                            length,
+                            k_PREV_CRC),
+                        expectedWithPrev);
+        }
+    }
+
+    s_allocator_p->deallocate(buffer);
+}
+
+static void test10_combine()
+// ------------------------------------------------------------------------
+// COMBINE
+//
+// Concerns:
+//   Verify that combining the CRC32-C values of two adjacent parts of a
+//   buffer yields the CRC32-C value of the whole buffer.
+//
+// Plan:
+//   - Combining with a second part of length 0 returns the first CRC.
+//   - For various buffer lengths and split points, calculate the CRC32-C
+//     of both parts independently, combine them and compare the result to
+//     the CRC32-C of the whole buffer.
+//   - Calculate the CRC32-C of a blob by combining the CRC32-C values of
+//     each of its buffers, calculated independently, and compare the
+//     result to 'bmqp::Crc32c::calculate(blob)'.
+//
+// Testing:
+//   - bmqp::Crc32c::combine(unsigned int        crc1,
+//                           unsigned int        crc2,
+//                           bsls::Types::Uint64 length2);
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("COMBINE");
+
+    {
+        // Empty second part
+        ASSERT_EQ(bmqp::Crc32c::combine(0xA0EA6901, 0, 0), 0xA0EA6901U);
+        ASSERT_EQ(bmqp::Crc32c::combine(bmqp::Crc32c::k_NULL_CRC32C,
+                                        bmqp::Crc32c::k_NULL_CRC32C,
+                                        0),
+                  bmqp::Crc32c::k_NULL_CRC32C);
+    }
+
+    const unsigned int k_MAX_SIZE = 65536 + 29;
+
+    char* buffer = static_cast<char*>(s_allocator_p->allocate(k_MAX_SIZE));
+    bsl::generate_n(buffer, k_MAX_SIZE, bsl::rand);
+
+    {
+        // Two adjacent parts
+        const unsigned int k_LENGTHS[] = {1, 2, 7, 64, 1000, 4096, k_MAX_SIZE};
+        const int          k_NUM_LENGTHS = sizeof(k_LENGTHS) /
+                                  sizeof(*k_LENGTHS);
+
+        for (int i = 0; i < k_NUM_LENGTHS; ++i) {
+            const unsigned int length   = k_LENGTHS[i];
+            const unsigned int expected = bmqp::Crc32c::calculate(buffer,
+                                                                  length);
+
+            const unsigned int k_SPLITS[] = {0,
+                                             1,
+                                             length / 3,
+                                             length / 2,
+                                             length - 1,
+                                             length};
+            const int k_NUM_SPLITS = sizeof(k_SPLITS) / sizeof(*k_SPLITS);
+
+            for (int j = 0; j < k_NUM_SPLITS; ++j) {
+                const unsigned int split = k_SPLITS[j];
+                const unsigned int crc1  = bmqp::Crc32c::calculate(buffer,
+                                                                  split);
+                const unsigned int crc2  = bmqp::Crc32c::calculate(
+                    buffer + split,
+                    length - split);
+
+                ASSERT_EQ_D(length << " split at " << split,
+                            bmqp::Crc32c::combine(crc1, crc2, length - split),
+                            expected);
+            }
+        }
+    }
+
+    {
+        // Blob buffers calculated independently
+        bdlbb::Blob        blob(s_allocator_p);
+        const unsigned int k_BUFFER_LENGTHS[] = {100, 1024, 3, 20000, 777};
+        const int          k_NUM_BUFFERS      = sizeof(k_BUFFER_LENGTHS) /
+                                      sizeof(*k_BUFFER_LENGTHS);
+
+        unsigned int offset   = 0;
+        unsigned int combined = bmqp::Crc32c::k_NULL_CRC32C;
+        for (int i = 0; i < k_NUM_BUFFERS; ++i) {
+            const unsigned int    length = k_BUFFER_LENGTHS[i];
+            bsl::shared_ptr<char> dataSp;
+            dataSp.reset(buffer + offset,
+                         bslstl::SharedPtrNilDeleter(),
+                         s_allocator_p);
+            blob.appendDataBuffer(bdlbb::BlobBuffer(dataSp, length));
+
+            combined = bmqp::Crc32c::combine(
+                combined,
+                bmqp::Crc32c::calculate(buffer + offset, length),
+                length);
+            offset += length;
+        }
+
+        ASSERT_EQ(combined, bmqp::Crc32c::calculate(blob));
+    }
+
+    s_allocator_p->deallocate(buffer);
+}
+
+static void test11_calculateMultiple()
+// ------------------------------------------------------------------------
+// CALCULATE MULTIPLE
+//
+// Concerns:
+//   Verify that calculating the CRC32-C values of multiple buffers at once
+//   yields the same values as calculating them one by one, whatever the
+//   number of buffers, their lengths (including 0, and around the
+//   interleaving threshold) and their alignments.
+//
+// Plan:
+//   - For various numbers of buffers, pick random lengths and offsets in a
+//     random buffer, calculate the CRC32-C values of all the buffers at
+//     once, and compare each of them to the one calculated using the
+//     software implementation.
+//
+// Testing:
+//   - bmqp::Crc32c::calculateMultiple(unsigned int                *crcs,
+//                                     const bmqp::Crc32c::Buffer  *buffers,
+//                                     int                          num);
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("CALCULATE MULTIPLE");
+
+    const unsigned int k_MAX_LENGTH  = 2100;
+    const unsigned int k_MAX_OFFSET  = 64;
+    const int          k_MAX_NUM     = 20;
+    const int          k_NUM_ROUNDS  = 200;
+    const unsigned int k_BUFFER_SIZE = k_MAX_LENGTH + k_MAX_OFFSET;
+
+    char* buffer = static_cast<char*>(s_allocator_p->allocate(k_BUFFER_SIZE));
+    bsl::generate_n(buffer, k_BUFFER_SIZE, bsl::rand);
+
+    {
+        // No buffers
+        bmqp::Crc32c::calculateMultiple(0, 0, 0);
+    }
+
+    bsl::vector<bmqp::Crc32c::Buffer> buffers(s_allocator_p);
+    bsl::vector<unsigned int>         crcs(s_allocator_p);
+
+    for (int num = 1; num <= k_MAX_NUM; ++num) {
+        buffers.resize(num);
+        crcs.resize(num);
+
+        for (int round = 0; round < k_NUM_ROUNDS; ++round) {
+            for (int i = 0; i < num; ++i) {
+                // Favor small buffers, which are interleaved
+                const unsigned int length = round % 4 == 0
+                                                ? bsl::rand() % k_MAX_LENGTH
+                                                : bsl::rand() % 300;
+
+                buffers[i].d_length = length;
+                buffers[i].d_data   = length == 0
+                                          ? 0
+                                          : buffer +
+                                              bsl::rand() % k_MAX_OFFSET;
+            }
+
+            bmqp::Crc32c::calculateMultiple(crcs.data(),
+                                            buffers.data(),
+                                            num);
+
+            for (int i = 0; i < num; ++i) {
+                ASSERT_EQ_D(num << ", " << round << ", " << i,
+                            crcs[i],
+                            bmqp::Crc32c_Impl::calculateSoftware(
+                                buffers[i].d_data,
+                                buffers[i].d_length));
+            }
+        }
+    }
+
+    s_allocator_p->deallocate(buffer);
+}
+
 // ============================================================================
 //                              PERFORMANCE TESTS
 // ----------------------------------------------------------------------------
@@ -2174,6 +2527,171 @@ static void testN6_bdldPerformanceDefault()
     s_allocator_p->deallocate(buffer);
 }
 
+BSLA_MAYBE_UNUSED
+static void testN7_calculateThroughputAllBackends()
+// ------------------------------------------------------------------------
+// BENCHMARK: CALCULATE CRC32-C THROUGHPUT OF ALL BACKENDS
+//
+// Concerns:
+//   Compare the throughput (GB/s) of CRC32-C calculation of all the
+//   implementations (default, software, hardware serial, PCLMULQDQ
+//   folding, AVX-512 VPCLMULQDQ folding, and 'bdlde::crc32') for buffers of
+//   various sizes, in a single thread environment.
+//
+// Plan:
+//   - For each buffer size, time enough CRC32-C calculations using each
+//     implementation to process about 1 GiB, and report the throughput.
+//
+// Testing:
+//   Throughput (GB/s) of CRC32-C calculation of all the implementations.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName(
+        "BENCHMARK: CALCULATE CRC32-C THROUGHPUT OF ALL BACKENDS");
+
+    const bsls::Types::Int64 k_TOTAL_BYTES = 1024 * 1024 * 1024;  // 1 Gi
+    const int                k_LENGTHS[]   = {64,
+                                              256,
+                                              1024,
+                                              4096,
+                                              65536,
+                                              1048576,
+                                              4194304};
+    const int k_NUM_LENGTHS = sizeof(k_LENGTHS) / sizeof(*k_LENGTHS);
+    const int k_MAX_SIZE    = k_LENGTHS[k_NUM_LENGTHS - 1];
+
+    char* buffer = static_cast<char*>(s_allocator_p->allocate(k_MAX_SIZE));
+    bsl::generate_n(buffer, k_MAX_SIZE, bsl::rand);
+
+    PV("PCLMULQDQ available: "
+       << bmqp::Crc32c_Impl::isHardwareClmulAvailable());
+    PV("AVX-512 VPCLMULQDQ available: "
+       << bmqp::Crc32c_Impl::isHardwareAvx512Available());
+
+    // Header
+    bsl::cout << bsl::setw(10) << "Size(B)";
+    for (int b = 0; b < k_NUM_BACKENDS; ++b) {
+        bsl::cout << " | " << bsl::setw(14) << k_BACKENDS[b].d_name;
+    }
+    bsl::cout << '\n';
+
+    for (int i = 0; i < k_NUM_LENGTHS; ++i) {
+        const int                length   = k_LENGTHS[i];
+        const bsls::Types::Int64 numIters = k_TOTAL_BYTES / length;
+
+        bsl::cout << bsl::setw(10) << length;
+        for (int b = 0; b < k_NUM_BACKENDS; ++b) {
+            const CalculateFn calculateFn = k_BACKENDS[b].d_calculateFn;
+            unsigned int      crc         = 0;
+
+            // <time>
+            const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+            for (bsls::Types::Int64 k = 0; k < numIters; ++k) {
+                crc = calculateFn(buffer, length, crc);
+            }
+            const bsls::Types::Int64 diff = bsls::TimeUtil::getTimer() -
+                                            start;
+            // </time>
+            static_cast<void>(crc);
+
+            mwcu::MemOutStream throughput(s_allocator_p);
+            throughput << mwcu::PrintUtil::prettyBytes(
+                              (numIters * length *
+                               bdlt::TimeUnitRatio::k_NS_PER_S) /
+                              diff)
+                       << "/s";
+            bsl::cout << " | " << bsl::setw(14) << throughput.str();
+        }
+        bsl::cout << '\n';
+    }
+    bsl::cout << bsl::endl;
+
+    s_allocator_p->deallocate(buffer);
+}
+
+static void testN8_calculateMultipleThroughput()
+// ------------------------------------------------------------------------
+// BENCHMARK: CALCULATE CRC32-C OF MULTIPLE BUFFERS THROUGHPUT
+//
+// Concerns:
+//   Compare the throughput (GB/s) of the CRC32-C calculation of
+//   'k_NUM_BUFFERS' buffers of the same size using
+//   'bmqp::Crc32c::calculateMultiple' and using 'bmqp::Crc32c::calculate'
+//   on each buffer, for buffers of various sizes.
+//
+// Plan:
+//   - For each buffer size, time enough CRC32-C calculations using each
+//     method to process about 1 GiB, and report the throughput.
+//
+// Testing:
+//   Throughput (GB/s) of bmqp::Crc32c::calculateMultiple.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName(
+        "BENCHMARK: CALCULATE CRC32-C OF MULTIPLE BUFFERS THROUGHPUT");
+
+    const bsls::Types::Int64 k_TOTAL_BYTES = 1024 * 1024 * 1024;  // 1 Gi
+    const int                k_NUM_BUFFERS = 12;
+    const int                k_LENGTHS[]   = {64, 256, 1024, 4096};
+    const int k_NUM_LENGTHS = sizeof(k_LENGTHS) / sizeof(*k_LENGTHS);
+    const int k_MAX_SIZE    = k_NUM_BUFFERS * k_LENGTHS[k_NUM_LENGTHS - 1];
+
+    char* buffer = static_cast<char*>(s_allocator_p->allocate(k_MAX_SIZE));
+    bsl::generate_n(buffer, k_MAX_SIZE, bsl::rand);
+
+    bmqp::Crc32c::Buffer buffers[k_NUM_BUFFERS];
+    unsigned int         crcs[k_NUM_BUFFERS];
+
+    bsl::cout << bsl::setw(10) << "Size(B)" << " | " << bsl::setw(14)
+              << "serial" << " | " << bsl::setw(14) << "multiple" << '\n';
+
+    for (int i = 0; i < k_NUM_LENGTHS; ++i) {
+        const int                length   = k_LENGTHS[i];
+        const bsls::Types::Int64 numIters = k_TOTAL_BYTES /
+                                            (k_NUM_BUFFERS * length);
+
+        for (int b = 0; b < k_NUM_BUFFERS; ++b) {
+            buffers[b].d_data   = buffer + b * length;
+            buffers[b].d_length = length;
+        }
+
+        bsl::cout << bsl::setw(10) << length;
+        for (int multiple = 0; multiple < 2; ++multiple) {
+            // <time>
+            const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+            for (bsls::Types::Int64 k = 0; k < numIters; ++k) {
+                if (multiple) {
+                    bmqp::Crc32c::calculateMultiple(crcs,
+                                                    buffers,
+                                                    k_NUM_BUFFERS);
+                }
+                else {
+                    for (int b = 0; b < k_NUM_BUFFERS; ++b) {
+                        crcs[b] = bmqp::Crc32c::calculate(
+                            buffers[b].d_data,
+                            buffers[b].d_length);
+                    }
+                }
+            }
+            const bsls::Types::Int64 diff = bsls::TimeUtil::getTimer() -
+                                            start;
+            // </time>
+
+            mwcu::MemOutStream throughput(s_allocator_p);
+            throughput << mwcu::PrintUtil::prettyBytes(
+                              (numIters * k_NUM_BUFFERS * length *
+                               bdlt::TimeUnitRatio::k_NS_PER_S) /
+                              diff)
+                       << "/s";
+            bsl::cout << " | " << bsl::setw(14) << throughput.str();
+        }
+        bsl::cout << '\n';
+    }
+    bsl::cout << bsl::endl;
+
+    s_allocator_p->deallocate(buffer);
+}
+
 #ifdef BSLS_PLATFORM_OS_LINUX
 
 static void
@@ -2533,6 +3051,90 @@ testN6_bdldPerformanceDefault_GoogleBenchmark(benchmark::State& state)
     s_allocator_p->deallocate(buffer);
 }
 
+static void
+testN7_calculateThroughputAllBackends_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// BENCHMARK: CALCULATE CRC32-C THROUGHPUT OF ALL BACKENDS
+//
+// Concerns:
+//   Compare the throughput (GB/s) of CRC32-C calculation of all the
+//   implementations for buffers of various sizes.  'state.range(0)' is the
+//   index of the implementation in 'k_BACKENDS', and 'state.range(1)' the
+//   size of the buffer.
+// ------------------------------------------------------------------------
+{
+    const Backend& backend = k_BACKENDS[state.range(0)];
+    const int      length  = state.range(1);
+
+    state.SetLabel(backend.d_name);
+
+    char* buffer = static_cast<char*>(s_allocator_p->allocate(length));
+    bsl::generate_n(buffer, length, bsl::rand);
+
+    unsigned int crc = 0;
+
+    // <time>
+    for (auto _ : state) {
+        crc = backend.d_calculateFn(buffer, length, crc);
+        benchmark::DoNotOptimize(crc);
+    }
+    // </time>
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            length);
+    s_allocator_p->deallocate(buffer);
+}
+
+static void
+testN8_calculateMultipleThroughput_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// BENCHMARK: CALCULATE CRC32-C OF MULTIPLE BUFFERS THROUGHPUT
+//
+// Concerns:
+//   Compare the throughput (GB/s) of the CRC32-C calculation of 12 buffers
+//   of the same size using 'bmqp::Crc32c::calculateMultiple' and using
+//   'bmqp::Crc32c::calculate' on each buffer.  'state.range(0)' is
+//   non-zero for 'calculateMultiple', and 'state.range(1)' is the size of
+//   the buffers.
+// ------------------------------------------------------------------------
+{
+    const int  k_NUM_BUFFERS = 12;
+    const bool multiple      = state.range(0) != 0;
+    const int  length        = state.range(1);
+
+    state.SetLabel(multiple ? "multiple" : "serial");
+
+    char* buffer = static_cast<char*>(
+        s_allocator_p->allocate(k_NUM_BUFFERS * length));
+    bsl::generate_n(buffer, k_NUM_BUFFERS * length, bsl::rand);
+
+    bmqp::Crc32c::Buffer buffers[k_NUM_BUFFERS];
+    unsigned int         crcs[k_NUM_BUFFERS];
+    for (int b = 0; b < k_NUM_BUFFERS; ++b) {
+        buffers[b].d_data   = buffer + b * length;
+        buffers[b].d_length = length;
+    }
+
+    // <time>
+    for (auto _ : state) {
+        if (multiple) {
+            bmqp::Crc32c::calculateMultiple(crcs, buffers, k_NUM_BUFFERS);
+        }
+        else {
+            for (int b = 0; b < k_NUM_BUFFERS; ++b) {
+                crcs[b] = bmqp::Crc32c::calculate(buffers[b].d_data,
+                                                  buffers[b].d_length);
+            }
+        }
+        benchmark::DoNotOptimize(crcs);
+    }
+    // </time>
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            k_NUM_BUFFERS * length);
+    s_allocator_p->deallocate(buffer);
+}
+
 #endif  // BSLS_PLATFORM_OS_LINUX
 
 // ============================================================================
@@ -2554,6 +3156,9 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 11: test11_calculateMultiple(); break;
+    case 10: test10_combine(); break;
+    case 9: test9_calculateHardwareFolding(); break;
     case 8: test8_calculateOnBlobWithPreviousCrc(); break;
     case 7: test7_calculateOnBlob(); break;
     case 6: test6_multithreadedCrc32cSoftware(); break;
@@ -2602,6 +3207,16 @@ int main(int argc, char* argv[])
             testN6_bdldPerformanceDefault,
             Apply(populateBufferLengthsSorted_GoogleBenchmark_Large));
         break;
+    case -7:
+        MWC_BENCHMARK_WITH_ARGS(
+            testN7_calculateThroughputAllBackends,
+            Apply(populateBackendsAndLengths_GoogleBenchmark));
+        break;
+    case -8:
+        MWC_BENCHMARK_WITH_ARGS(
+            testN8_calculateMultipleThroughput,
+            Apply(populateMultipleAndLengths_GoogleBenchmark));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
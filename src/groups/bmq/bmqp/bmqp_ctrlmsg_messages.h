@@ -19289,8 +19289,11 @@ namespace bmqp_ctrlmsg {
 /// downstream node to distribute messages to consumers attached to it
 /// deduplicationTimeMs........: timeout, in milliseconds, to keep GUID of
 /// PUT message for the purpose of detecting duplicate PUTs.
+/// compressionDictionary: content of the ZSTD dictionary trained by the
+/// primary for the queue, empty if none.
 class OpenQueueResponse {
     // INSTANCE DATA
+    bsl::vector<char>    d_compressionDictionary;
     RoutingConfiguration d_routingConfiguration;
     OpenQueue            d_originalRequest;
     int                  d_deduplicationTimeMs;
@@ -19300,15 +19303,17 @@ class OpenQueueResponse {
     enum {
         ATTRIBUTE_ID_ORIGINAL_REQUEST      = 0,
         ATTRIBUTE_ID_ROUTING_CONFIGURATION = 1,
-        ATTRIBUTE_ID_DEDUPLICATION_TIME_MS = 2
+        ATTRIBUTE_ID_DEDUPLICATION_TIME_MS = 2,
+        ATTRIBUTE_ID_COMPRESSION_DICTIONARY = 3
     };
 
-    enum { NUM_ATTRIBUTES = 3 };
+    enum { NUM_ATTRIBUTES = 4 };
 
     enum {
         ATTRIBUTE_INDEX_ORIGINAL_REQUEST      = 0,
         ATTRIBUTE_INDEX_ROUTING_CONFIGURATION = 1,
-        ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS = 2
+        ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS = 2,
+        ATTRIBUTE_INDEX_COMPRESSION_DICTIONARY = 3
     };
 
     // CONSTANTS
@@ -19424,6 +19429,10 @@ class OpenQueueResponse {
     /// of this object.
     int& deduplicationTimeMs();
 
+    /// Return a reference to the modifiable "CompressionDictionary"
+    /// attribute of this object.
+    bsl::vector<char>& compressionDictionary();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -19479,6 +19488,10 @@ class OpenQueueResponse {
     /// Return a reference to the non-modifiable "DeduplicationTimeMs"
     /// attribute of this object.
     int deduplicationTimeMs() const;
+
+    /// Return a reference to the non-modifiable "CompressionDictionary"
+    /// attribute of this object.
+    const bsl::vector<char>& compressionDictionary() const;
 };
 
 // FREE OPERATORS
@@ -36153,6 +36166,13 @@ int OpenQueueResponse::manipulateAttributes(MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_compressionDictionary,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARY]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -36177,6 +36197,11 @@ int OpenQueueResponse::manipulateAttribute(MANIPULATOR& manipulator, int id)
             &d_deduplicationTimeMs,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS]);
     }
+    case ATTRIBUTE_ID_COMPRESSION_DICTIONARY: {
+        return manipulator(
+            &d_compressionDictionary,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARY]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -36212,6 +36237,11 @@ inline int& OpenQueueResponse::deduplicationTimeMs()
     return d_deduplicationTimeMs;
 }
 
+inline bsl::vector<char>& OpenQueueResponse::compressionDictionary()
+{
+    return d_compressionDictionary;
+}
+
 // ACCESSORS
 template <class ACCESSOR>
 int OpenQueueResponse::accessAttributes(ACCESSOR& accessor) const
@@ -36238,6 +36268,13 @@ int OpenQueueResponse::accessAttributes(ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(
+        d_compressionDictionary,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARY]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -36262,6 +36299,11 @@ int OpenQueueResponse::accessAttribute(ACCESSOR& accessor, int id) const
             d_deduplicationTimeMs,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS]);
     }
+    case ATTRIBUTE_ID_COMPRESSION_DICTIONARY: {
+        return accessor(
+            d_compressionDictionary,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARY]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -36298,6 +36340,12 @@ inline int OpenQueueResponse::deduplicationTimeMs() const
     return d_deduplicationTimeMs;
 }
 
+inline const bsl::vector<char>&
+OpenQueueResponse::compressionDictionary() const
+{
+    return d_compressionDictionary;
+}
+
 template <typename HASH_ALGORITHM>
 void hashAppend(HASH_ALGORITHM&                        hashAlg,
                 const bmqp_ctrlmsg::OpenQueueResponse& object)
@@ -36308,6 +36356,7 @@ void hashAppend(HASH_ALGORITHM&                        hashAlg,
     hashAppend(hashAlg, object.originalRequest());
     hashAppend(hashAlg, object.routingConfiguration());
     hashAppend(hashAlg, object.deduplicationTimeMs());
+    hashAppend(hashAlg, object.compressionDictionary());
 }
 
 // ----------------------
@@ -40786,7 +40835,8 @@ bmqp_ctrlmsg::operator==(const bmqp_ctrlmsg::OpenQueueResponse& lhs,
 {
     return lhs.originalRequest() == rhs.originalRequest() &&
            lhs.routingConfiguration() == rhs.routingConfiguration() &&
-           lhs.deduplicationTimeMs() == rhs.deduplicationTimeMs();
+           lhs.deduplicationTimeMs() == rhs.deduplicationTimeMs() &&
+           lhs.compressionDictionary() == rhs.compressionDictionary();
 }
 
 inline bool
@@ -144,6 +144,12 @@ class Event {
     /// internal shared pointer.
     void reset(const bdlbb::Blob* blob, bool clone = false);
 
+    /// Reset this Event to use the specified `blob`, sharing its ownership
+    /// as if it was cloned (`isCloned()` returns true).  This allows the
+    /// caller to provide a blob recycled from a pool rather than having
+    /// this object allocate a copy.
+    void reset(const bsl::shared_ptr<const bdlbb::Blob>& blob);
+
     /// Set internal state of this instance as if it is default constructed.
     void clear();
 
@@ -184,6 +190,14 @@ class Event {
     /// behavior is undefined unless `isValid()` returns true.
     bool isReceiptEvent() const;
 
+    /// Return true if this event is a put event whose messages are in the
+    /// compact encoding (see `bmqp::EventUtil::compactPutEvent`), and false
+    /// otherwise.  The behavior is undefined unless `isValid()` returns
+    /// true.  Note that the messages of such an event can not be iterated
+    /// over until the event is expanded (see
+    /// `bmqp::EventUtil::expandPutEvent`).
+    bool isCompactPutEvent() const;
+
     /// Load into the specified `message`, the decoded message contained in
     /// this event.  The behavior is undefined unless `isControlEvent()`
     /// returns true.  Return 0 on success, and a non-zero return code on
@@ -396,6 +410,15 @@ inline void Event::reset(const bdlbb::Blob* blob, bool clone)
     initialize(blob, clone);
 }
 
+inline void Event::reset(const bsl::shared_ptr<const bdlbb::Blob>& blob)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(blob);
+
+    d_clonedBlob_sp = blob;
+    initialize(d_clonedBlob_sp.get(), false);
+}
+
 inline void Event::clear()
 {
     d_clonedBlob_sp.reset();
@@ -541,6 +564,15 @@ inline bool Event::isReceiptEvent() const
     return d_header->type() == EventType::e_REPLICATION_RECEIPT;
 }
 
+inline bool Event::isCompactPutEvent() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isValid());
+
+    return d_header->type() == EventType::e_PUT &&
+           EventHeaderUtil::isCompactPutEvent(*d_header);
+}
+
 template <class TYPE>
 int Event::loadControlEvent(TYPE* message) const
 {
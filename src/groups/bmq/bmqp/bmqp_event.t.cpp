@@ -29,6 +29,7 @@
 #include <bdlbb_blobutil.h>
 #include <bdlbb_pooledblobbufferfactory.h>
 #include <bsl_ios.h>
+#include <bsl_memory.h>
 #include <bslmf_assert.h>
 #include <bsls_assert.h>
 
@@ -109,6 +110,28 @@ static void test1_breathingTest()
     ASSERT_EQ(event6.isCloned(), true);
     ASSERT_EQ(&blob == event6.blob(), false);
 
+    // Reset with a shared blob
+    {
+        bsl::shared_ptr<bdlbb::Blob> sharedBlob;
+        sharedBlob.createInplace(s_allocator_p, s_allocator_p);
+
+        event6.reset(sharedBlob);
+        ASSERT_EQ(event6.isValid(), false);
+        ASSERT_EQ(event6.isCloned(), true);
+        ASSERT_EQ(event6.blob(), sharedBlob.get());
+        ASSERT_EQ(sharedBlob.use_count(), 2);
+
+        // Copies share the blob
+        bmqp::Event event8(event6, s_allocator_p);
+        ASSERT_EQ(event8.isCloned(), true);
+        ASSERT_EQ(event8.blob(), sharedBlob.get());
+        ASSERT_EQ(sharedBlob.use_count(), 3);
+
+        event8.clear();
+        event6.reset(&blob);
+        ASSERT_EQ(sharedBlob.use_count(), 1);
+    }
+
     // Clear
     event1.clear();
     ASSERT_EQ(event1.isValid(), false);
@@ -21,15 +21,21 @@
 #include <bmqp_event.h>
 #include <bmqp_optionsview.h>
 #include <bmqp_protocol.h>
+#include <bmqp_protocolutil.h>
 #include <bmqp_pusheventbuilder.h>
 #include <bmqp_pushmessageiterator.h>
 #include <bmqt_resultcode.h>
 
 // MWC
 #include <mwcc_array.h>
+#include <mwcu_blob.h>
 
 // BDE
+#include <bdlb_bigendian.h>
+#include <bdlbb_blobutil.h>
 #include <bdlma_localsequentialallocator.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
 #include <bsl_utility.h>
 #include <bsl_vector.h>
 #include <bslma_allocator.h>
@@ -181,10 +187,13 @@ class Flattener {
     // CREATORS
 
     /// Create a `Flattener` using the specified `eventInfos`, `event`,
-    /// `bufferFactory` and `allocator`
+    /// `bufferFactory` and `allocator`, sharing the payloads of the
+    /// messages of `event` with the flattened events if the specified
+    /// `zeroCopy` is `true`, or copying them otherwise.
     Flattener(bsl::vector<EventUtilEventInfo>* eventInfos,
               const Event&                     event,
               bdlbb::BlobBufferFactory*        bufferFactory,
+              bool                             zeroCopy,
               bslma::Allocator*                allocator);
 
     // MANIPULATORS
@@ -401,6 +410,7 @@ void Flattener::advanceEvent()
 Flattener::Flattener(bsl::vector<EventUtilEventInfo>* eventInfos,
                      const Event&                     event,
                      bdlbb::BlobBufferFactory*        bufferFactory,
+                     bool                             zeroCopy,
                      bslma::Allocator*                allocator)
 : d_eventInfos_p(eventInfos)
 , d_allocator_p(allocator)
@@ -410,6 +420,10 @@ Flattener::Flattener(bsl::vector<EventUtilEventInfo>* eventInfos,
 , d_appData(bufferFactory, allocator)
 , d_optionsView(allocator)
 {
+    // The application data loaded into 'd_appData' refers to the buffers of
+    // 'event': in zero-copy mode, the builder keeps referring to them.
+    d_builder.setZeroCopy(zeroCopy);
+
     event.loadPushMessageIterator(&d_msgIterator);
     BSLS_ASSERT_SAFE(d_msgIterator.isValid());
 }
@@ -479,6 +493,153 @@ int Flattener::flattenPushEvent()
     return rc_SUCCESS;
 }
 
+// ==========================
+// Compact PUT event encoding
+// ==========================
+
+/// Maximum number of bytes of an unsigned int encoded as a varint.
+const int k_MAX_VARINT_SIZE = 5;
+
+/// Maximum number of bytes of the fields preceding the options of a message
+/// in the compact encoding, including its length.
+const int k_MAX_COMPACT_HEADER_SIZE = 1 + 3 * k_MAX_VARINT_SIZE +
+                                      bmqt::MessageGUID::e_SIZE_BINARY + 4 +
+                                      2;
+
+/// Bit of the flags byte of a message in the compact encoding indicating
+/// that it has a full MessageGUID, rather than a correlationId.
+const unsigned char k_COMPACT_GUID_BIT = 1 << 3;
+
+/// Bits of the flags byte of a message in the compact encoding holding the
+/// compression algorithm type.
+const unsigned char k_COMPACT_CAT_MASK = 0x07;
+
+/// Encode the specified `value` as a varint into the specified `buffer`,
+/// and return the number of bytes written.
+int encodeVarint(char* buffer, unsigned int value)
+{
+    int length = 0;
+    while (value >= 0x80) {
+        buffer[length++] = static_cast<char>((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    buffer[length++] = static_cast<char>(value);
+
+    return length;
+}
+
+/// Append to the specified `destination` the specified `length` bytes of
+/// the specified `source` starting at the specified `start`, copying them
+/// if `length` is smaller than `Protocol::k_ZERO_COPY_MIN_APPDATA_SIZE`, and
+/// referring to them otherwise.  Return 0 on
+/// success and a non-zero value if `source` is too short.
+int appendData(bdlbb::Blob*              destination,
+               const bdlbb::Blob&        source,
+               const mwcu::BlobPosition& start,
+               int                       length)
+{
+    if (length >= Protocol::k_ZERO_COPY_MIN_APPDATA_SIZE) {
+        return mwcu::BlobUtil::appendToBlob(destination,
+                                            source,
+                                            start,
+                                            length);  // RETURN
+    }
+
+    int buffer = start.buffer();
+    int byte   = start.byte();
+    while (length > 0) {
+        if (buffer >= source.numDataBuffers()) {
+            return -1;  // RETURN
+        }
+
+        const int size = bsl::min(length,
+                                  mwcu::BlobUtil::bufferSize(source, buffer) -
+                                      byte);
+        bdlbb::BlobUtil::append(destination,
+                                source.buffer(buffer).data() + byte,
+                                size);
+        length -= size;
+        ++buffer;
+        byte = 0;
+    }
+
+    return 0;
+}
+
+// ==================
+// class CompactReader
+// ==================
+
+/// Reader of the fields of a message in the compact encoding.
+class CompactReader {
+  private:
+    // DATA
+    const char* d_buffer_p;
+
+    int d_length;
+
+    int d_offset;
+
+  public:
+    // CREATORS
+
+    /// Create a reader of the specified `length` bytes at the specified
+    /// `buffer`.
+    CompactReader(const char* buffer, int length)
+    : d_buffer_p(buffer)
+    , d_length(length)
+    , d_offset(0)
+    {
+        // NOTHING
+    }
+
+    // MANIPULATORS
+
+    /// Prevent reading past the specified `length` bytes from the beginning
+    /// of the buffer.
+    void truncate(int length) { d_length = bsl::min(d_length, length); }
+
+    /// Load into the specified `value` the next varint.  Return true on
+    /// success and false otherwise.
+    bool readVarint(unsigned int* value)
+    {
+        unsigned int result = 0;
+        for (int i = 0; i < k_MAX_VARINT_SIZE && d_offset < d_length; ++i) {
+            const unsigned char byte = static_cast<unsigned char>(
+                d_buffer_p[d_offset++]);
+            if (i == k_MAX_VARINT_SIZE - 1 && byte > 0x0F) {
+                return false;  // RETURN
+            }
+
+            result |= static_cast<unsigned int>(byte & 0x7F) << (7 * i);
+            if (0 == (byte & 0x80)) {
+                *value = result;
+                return true;  // RETURN
+            }
+        }
+
+        return false;
+    }
+
+    /// Load into the specified `buffer` the next specified `length` bytes.
+    /// Return true on success and false otherwise.
+    bool readBytes(void* buffer, int length)
+    {
+        if (d_length - d_offset < length) {
+            return false;  // RETURN
+        }
+
+        bsl::memcpy(buffer, d_buffer_p + d_offset, length);
+        d_offset += length;
+        return true;
+    }
+
+    // ACCESSORS
+
+    /// Return the number of bytes read so far.
+    int offset() const { return d_offset; }
+};
+
 }  // close unnamed namespace
 
 // ----------------
@@ -487,7 +648,8 @@ int Flattener::flattenPushEvent()
 int EventUtil::flattenPushEvent(bsl::vector<EventUtilEventInfo>* eventInfos,
                                 const Event&                     event,
                                 bdlbb::BlobBufferFactory*        bufferFactory,
-                                bslma::Allocator*                allocator)
+                                bslma::Allocator*                allocator,
+                                bool                             zeroCopy)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(eventInfos);
@@ -496,9 +658,385 @@ int EventUtil::flattenPushEvent(bsl::vector<EventUtilEventInfo>* eventInfos,
     BSLS_ASSERT_SAFE(bufferFactory);
     BSLS_ASSERT_SAFE(allocator);
 
-    Flattener flattener(eventInfos, event, bufferFactory, allocator);
+    Flattener flattener(eventInfos,
+                        event,
+                        bufferFactory,
+                        zeroCopy,
+                        allocator);
     return flattener.flattenPushEvent();
 }
 
+int EventUtil::compactPutEvent(bdlbb::Blob*       compactEvent,
+                               const bdlbb::Blob& putEvent)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(compactEvent);
+    BSLS_ASSERT_SAFE(compactEvent->length() == 0);
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS             = 0,
+        rc_INVALID_EVENT       = -1,
+        rc_INVALID_MESSAGE     = -2,
+        rc_UNSUPPORTED_MESSAGE = -3
+    };
+
+    EventHeader        eventHeader;
+    mwcu::BlobPosition position;
+    if (0 != mwcu::BlobUtil::readNBytes(reinterpret_cast<char*>(&eventHeader),
+                                        putEvent,
+                                        position,
+                                        sizeof(EventHeader)) ||
+        eventHeader.type() != EventType::e_PUT ||
+        EventHeaderUtil::isCompactPutEvent(eventHeader) ||
+        eventHeader.length() != putEvent.length()) {
+        return rc_INVALID_EVENT;  // RETURN
+    }
+
+    const int eventHeaderSize = eventHeader.headerWords() *
+                                Protocol::k_WORD_SIZE;
+    if (eventHeaderSize < static_cast<int>(sizeof(EventHeader)) ||
+        0 != appendData(compactEvent, putEvent, position, eventHeaderSize)) {
+        return rc_INVALID_EVENT;  // RETURN
+    }
+
+    int offset = eventHeaderSize;
+    while (offset < putEvent.length()) {
+        // Load the header.  The fields missing from an older (i.e.,
+        // shorter) one are left to zero.
+        PutHeader header;
+        int       rc = mwcu::BlobUtil::findOffsetSafe(&position,
+                                                putEvent,
+                                                offset);
+        if (0 == rc) {
+            rc = mwcu::BlobUtil::readNBytes(reinterpret_cast<char*>(&header),
+                                            putEvent,
+                                            position,
+                                            PutHeader::k_MIN_HEADER_SIZE);
+        }
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            return rc_INVALID_MESSAGE;  // RETURN
+        }
+
+        const int headerSize  = header.headerWords() * Protocol::k_WORD_SIZE;
+        const int optionsSize = header.optionsWords() * Protocol::k_WORD_SIZE;
+        const int messageSize = header.messageWords() * Protocol::k_WORD_SIZE;
+        if (headerSize > static_cast<int>(sizeof(PutHeader))) {
+            // Newer header, with fields we don't know of.
+            return rc_UNSUPPORTED_MESSAGE;  // RETURN
+        }
+        if (headerSize < PutHeader::k_MIN_HEADER_SIZE ||
+            headerSize + optionsSize >= messageSize ||
+            messageSize > putEvent.length() - offset) {
+            return rc_INVALID_MESSAGE;  // RETURN
+        }
+
+        mwcu::BlobPosition lastBytePosition;
+        char               padding = 0;
+        if (0 != mwcu::BlobUtil::readNBytes(reinterpret_cast<char*>(&header),
+                                            putEvent,
+                                            position,
+                                            headerSize) ||
+            0 != mwcu::BlobUtil::findOffsetSafe(&lastBytePosition,
+                                                putEvent,
+                                                offset + messageSize - 1) ||
+            0 != mwcu::BlobUtil::readNBytes(&padding,
+                                            putEvent,
+                                            lastBytePosition,
+                                            1) ||
+            !ProtocolUtil::isValidWordPaddingByte(padding)) {
+            return rc_INVALID_MESSAGE;  // RETURN
+        }
+
+        const int dataLength = messageSize - headerSize - optionsSize -
+                               padding;
+        if (dataLength < 0) {
+            return rc_INVALID_MESSAGE;  // RETURN
+        }
+
+        // A message GUID is carried only when it isn't a correlationId.
+        PutHeader corrIdHeader;
+        corrIdHeader.setCorrelationId(header.correlationId());
+        const bool hasGUID = corrIdHeader.messageGUID() !=
+                             header.messageGUID();
+
+        char buffer[k_MAX_COMPACT_HEADER_SIZE];
+        int  length = k_MAX_VARINT_SIZE;  // room for the length, see below
+
+        buffer[length++] = static_cast<char>(
+            (header.flags() << 4) | (hasGUID ? k_COMPACT_GUID_BIT : 0) |
+            header.compressionAlgorithmType());
+        length += encodeVarint(buffer + length,
+                               static_cast<unsigned int>(header.queueId()));
+        if (hasGUID) {
+            header.messageGUID().toBinary(
+                reinterpret_cast<unsigned char*>(buffer + length));
+            length += bmqt::MessageGUID::e_SIZE_BINARY;
+        }
+        else {
+            length += encodeVarint(
+                buffer + length,
+                static_cast<unsigned int>(header.correlationId()));
+        }
+        const bdlb::BigEndianUint32 crc32c = bdlb::BigEndianUint32::make(
+            header.crc32c());
+        bsl::memcpy(buffer + length, &crc32c, sizeof(crc32c));
+        length += sizeof(crc32c);
+        const bdlb::BigEndianUint16 schemaId = bdlb::BigEndianUint16::make(
+            static_cast<unsigned short>(header.schemaId().value()));
+        bsl::memcpy(buffer + length, &schemaId, sizeof(schemaId));
+        length += sizeof(schemaId);
+        length += encodeVarint(
+            buffer + length,
+            static_cast<unsigned int>(header.optionsWords()));
+
+        // Now that the size of the fields is known, prepend the length.
+        char      lengthBuffer[k_MAX_VARINT_SIZE];
+        const int lengthSize = encodeVarint(
+            lengthBuffer,
+            static_cast<unsigned int>(length - k_MAX_VARINT_SIZE +
+                                      optionsSize + dataLength));
+        bsl::memcpy(buffer + k_MAX_VARINT_SIZE - lengthSize,
+                    lengthBuffer,
+                    lengthSize);
+        bdlbb::BlobUtil::append(compactEvent,
+                                buffer + k_MAX_VARINT_SIZE - lengthSize,
+                                length - k_MAX_VARINT_SIZE + lengthSize);
+
+        mwcu::BlobPosition dataPosition;
+        if (0 != mwcu::BlobUtil::findOffsetSafe(&dataPosition,
+                                                putEvent,
+                                                offset + headerSize) ||
+            0 != appendData(compactEvent,
+                            putEvent,
+                            dataPosition,
+                            optionsSize + dataLength)) {
+            return rc_INVALID_MESSAGE;  // RETURN
+        }
+
+        offset += messageSize;
+    }
+
+    eventHeader.setLength(compactEvent->length());
+    EventHeaderUtil::setCompactPutEvent(&eventHeader, true);
+    mwcu::BlobUtil::writeBytes(compactEvent,
+                               mwcu::BlobPosition(),
+                               reinterpret_cast<const char*>(&eventHeader),
+                               sizeof(EventHeader));
+
+    return rc_SUCCESS;
+}
+
+int EventUtil::expandPutEvent(bdlbb::Blob*       putEvent,
+                              const bdlbb::Blob& compactEvent)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(putEvent);
+    BSLS_ASSERT_SAFE(putEvent->length() == 0);
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS         = 0,
+        rc_INVALID_EVENT   = -1,
+        rc_INVALID_MESSAGE = -2
+    };
+
+    EventHeader        eventHeader;
+    mwcu::BlobPosition position;
+    if (0 != mwcu::BlobUtil::readNBytes(reinterpret_cast<char*>(&eventHeader),
+                                        compactEvent,
+                                        position,
+                                        sizeof(EventHeader)) ||
+        eventHeader.type() != EventType::e_PUT ||
+        !EventHeaderUtil::isCompactPutEvent(eventHeader) ||
+        eventHeader.length() != compactEvent.length()) {
+        return rc_INVALID_EVENT;  // RETURN
+    }
+
+    const int eventHeaderSize = eventHeader.headerWords() *
+                                Protocol::k_WORD_SIZE;
+    if (eventHeaderSize < static_cast<int>(sizeof(EventHeader)) ||
+        0 != appendData(putEvent, compactEvent, position, eventHeaderSize)) {
+        return rc_INVALID_EVENT;  // RETURN
+    }
+
+    int offset = eventHeaderSize;
+    while (offset < compactEvent.length()) {
+        char      buffer[k_MAX_COMPACT_HEADER_SIZE];
+        const int available = bsl::min(k_MAX_COMPACT_HEADER_SIZE,
+                                       compactEvent.length() - offset);
+        if (0 != mwcu::BlobUtil::findOffsetSafe(&position,
+                                                compactEvent,
+                                                offset) ||
+            0 != mwcu::BlobUtil::readNBytes(buffer,
+                                            compactEvent,
+                                            position,
+                                            available)) {
+            return rc_INVALID_MESSAGE;  // RETURN
+        }
+
+        CompactReader reader(buffer, available);
+        unsigned int  bodyLength = 0;
+        if (!reader.readVarint(&bodyLength) ||
+            bodyLength > static_cast<unsigned int>(compactEvent.length() -
+                                                   offset - reader.offset())) {
+            return rc_INVALID_MESSAGE;  // RETURN
+        }
+
+        const int messageSize = reader.offset() +
+                                static_cast<int>(bodyLength);
+
+        unsigned char         flags         = 0;
+        unsigned int          queueId       = 0;
+        unsigned int          correlationId = 0;
+        unsigned int          optionsWords  = 0;
+        unsigned char         guid[bmqt::MessageGUID::e_SIZE_BINARY];
+        bdlb::BigEndianUint32 crc32c;
+        bdlb::BigEndianUint16 schemaId;
+
+        reader.truncate(messageSize);
+        if (!reader.readBytes(&flags, 1) || !reader.readVarint(&queueId)) {
+            return rc_INVALID_MESSAGE;  // RETURN
+        }
+        const bool hasGUID = 0 != (flags & k_COMPACT_GUID_BIT);
+        if (!(hasGUID ? reader.readBytes(guid, sizeof(guid))
+                      : reader.readVarint(&correlationId)) ||
+            !reader.readBytes(&crc32c, sizeof(crc32c)) ||
+            !reader.readBytes(&schemaId, sizeof(schemaId)) ||
+            !reader.readVarint(&optionsWords) ||
+            optionsWords > static_cast<unsigned int>(
+                               PutHeader::k_MAX_OPTIONS_SIZE /
+                               Protocol::k_WORD_SIZE)) {
+            return rc_INVALID_MESSAGE;  // RETURN
+        }
+
+        const int optionsSize = optionsWords * Protocol::k_WORD_SIZE;
+        const int dataLength  = messageSize - reader.offset() - optionsSize;
+        if (dataLength < 0) {
+            return rc_INVALID_MESSAGE;  // RETURN
+        }
+
+        int       padding   = 0;
+        const int dataWords = ProtocolUtil::calcNumWordsAndPadding(&padding,
+                                                                   dataLength);
+
+        PutHeader header;
+        header.setFlags(flags >> 4)
+            .setOptionsWords(optionsWords)
+            .setCompressionAlgorithmType(
+                static_cast<bmqt::CompressionAlgorithmType::Enum>(
+                    flags & k_COMPACT_CAT_MASK))
+            .setQueueId(static_cast<int>(queueId))
+            .setCrc32c(crc32c)
+            .setMessageWords(header.headerWords() + optionsWords + dataWords);
+        if (hasGUID) {
+            bmqt::MessageGUID messageGUID;
+            header.setMessageGUID(messageGUID.fromBinary(guid));
+        }
+        else {
+            header.setCorrelationId(static_cast<int>(correlationId));
+        }
+        header.schemaId().set(schemaId);
+
+        bdlbb::BlobUtil::append(putEvent,
+                                reinterpret_cast<const char*>(&header),
+                                sizeof(PutHeader));
+
+        mwcu::BlobPosition dataPosition;
+        if (0 != mwcu::BlobUtil::findOffsetSafe(&dataPosition,
+                                                compactEvent,
+                                                offset + reader.offset()) ||
+            0 != appendData(putEvent,
+                            compactEvent,
+                            dataPosition,
+                            optionsSize + dataLength)) {
+            return rc_INVALID_MESSAGE;  // RETURN
+        }
+        ProtocolUtil::appendPaddingRaw(putEvent, padding);
+
+        offset += messageSize;
+    }
+
+    eventHeader.setLength(putEvent->length());
+    EventHeaderUtil::setCompactPutEvent(&eventHeader, false);
+    mwcu::BlobUtil::writeBytes(putEvent,
+                               mwcu::BlobPosition(),
+                               reinterpret_cast<const char*>(&eventHeader),
+                               sizeof(EventHeader));
+
+    return rc_SUCCESS;
+}
+
+int EventUtil::appendPutEvent(bdlbb::Blob*       batchEvent,
+                              const bdlbb::Blob& putEvent)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(batchEvent);
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS             = 0,
+        rc_INVALID_EVENT       = -1,
+        rc_INVALID_BATCH_EVENT = -2
+    };
+
+    EventHeader        eventHeader;
+    mwcu::BlobPosition position;
+    if (0 != mwcu::BlobUtil::readNBytes(reinterpret_cast<char*>(&eventHeader),
+                                        putEvent,
+                                        position,
+                                        sizeof(EventHeader)) ||
+        eventHeader.type() != EventType::e_PUT ||
+        EventHeaderUtil::isCompactPutEvent(eventHeader) ||
+        eventHeader.length() != putEvent.length()) {
+        return rc_INVALID_EVENT;  // RETURN
+    }
+
+    const int eventHeaderSize = eventHeader.headerWords() *
+                                Protocol::k_WORD_SIZE;
+    if (eventHeaderSize < static_cast<int>(sizeof(EventHeader)) ||
+        eventHeaderSize > putEvent.length()) {
+        return rc_INVALID_EVENT;  // RETURN
+    }
+
+    const int initialLength = batchEvent->length();
+    if (initialLength == 0) {
+        if (0 != appendData(batchEvent, putEvent, position, eventHeaderSize)) {
+            batchEvent->removeAll();
+            return rc_INVALID_EVENT;  // RETURN
+        }
+    }
+    else if (0 != mwcu::BlobUtil::readNBytes(
+                      reinterpret_cast<char*>(&eventHeader),
+                      *batchEvent,
+                      mwcu::BlobPosition(),
+                      sizeof(EventHeader)) ||
+             eventHeader.type() != EventType::e_PUT ||
+             EventHeaderUtil::isCompactPutEvent(eventHeader) ||
+             eventHeader.length() != initialLength) {
+        return rc_INVALID_BATCH_EVENT;  // RETURN
+    }
+
+    const int messagesSize = putEvent.length() - eventHeaderSize;
+    if (messagesSize > 0) {
+        if (0 != mwcu::BlobUtil::findOffsetSafe(&position,
+                                                putEvent,
+                                                eventHeaderSize) ||
+            0 != appendData(batchEvent, putEvent, position, messagesSize)) {
+            batchEvent->setLength(initialLength);
+            return rc_INVALID_EVENT;  // RETURN
+        }
+    }
+
+    eventHeader.setLength(batchEvent->length());
+    mwcu::BlobUtil::writeBytes(batchEvent,
+                               mwcu::BlobPosition(),
+                               reinterpret_cast<const char*>(&eventHeader),
+                               sizeof(EventHeader));
+
+    return rc_SUCCESS;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -25,6 +25,34 @@
 //@DESCRIPTION: 'bmqp::EventUtil' provides a set of utility methods to be used
 // to manipulate BlazingMQ protocol events.
 //
+/// Compact PUT events
+///------------------
+// When negotiated with the broker (see 'bmqp::PutFeatures::k_COMPACT'), a
+// client may send PUT events in a compact encoding, which removes the fixed
+// per-message cost of the 36 bytes 'PutHeader' and of the padding of the
+// application data.  Such an event has its 'EventHeader' unchanged, except
+// for the compact bit of its type-specific content (see
+// 'bmqp::EventHeaderUtil::isCompactPutEvent'), and is followed by messages
+// having the following layout, where 'varint' is an unsigned integer encoded
+// in groups of 7 bits, least significant group first, the most significant
+// bit of each byte indicating whether another byte follows:
+//..
+//  varint   Length ..........: Length (bytes) of the message, excluding
+//                              this field
+//  1 byte   F|G|CAT .........: PutHeader flags (4 bits), 'G' flag (1 bit)
+//                              and compression algorithm type (3 bits)
+//  varint   QueueId
+//  16 bytes MessageGUID .....: If 'G' is set, else:
+//  varint   CorrelationId
+//  4 bytes  CRC32-C .........: Big endian
+//  2 bytes  SchemaId ........: Big endian
+//  varint   OptionsWords
+//  N bytes  Options .........: As in the 'PutHeader' encoding
+//  M bytes  ApplicationData .: Without padding
+//..
+// The broker expands such an event to the 'PutHeader' encoding upon
+// reception, so that nothing beyond the first hop has to know about it.
+//
 /// Thread Safety
 ///-------------
 // Thread safe.
@@ -125,11 +153,56 @@ struct EventUtil {
     /// case of failure.  The behavior is undefined unless the `event` is a
     /// valid push event.  Note that this function is exclusively used by
     /// the SDK and thus we can assume that the messages will only contain
-    /// old flavor of SubQueueIdsArray (i.e. SubQueueIdsArrayOld).
-    static int flattenPushEvent(bsl::vector<EventUtilEventInfo>* eventInfos,
-                                const Event&                     event,
-                                bdlbb::BlobBufferFactory*        bufferFactory,
-                                bslma::Allocator*                allocator);
+    /// old flavor of SubQueueIdsArray (i.e. SubQueueIdsArrayOld).  If the
+    /// optionally specified `zeroCopy` is `true`, the flattened events
+    /// share the blob buffers of the payloads of the messages of `event`
+    /// (see `PushEventBuilder::setZeroCopy`) instead of copying them, so
+    /// that only their headers and options are written; the data of
+    /// `event` must then not be modified while the flattened events are in
+    /// use.
+    static int
+    flattenPushEvent(bsl::vector<EventUtilEventInfo>* eventInfos,
+                     const Event&                     event,
+                     bdlbb::BlobBufferFactory*        bufferFactory,
+                     bslma::Allocator*                allocator,
+                     bool                             zeroCopy = false);
+
+    /// PutEvent Utilities
+    ///------------------
+
+    /// Load into the specified `compactEvent` the compact encoding of the
+    /// specified `putEvent`.  Return 0 on success, or a non-zero error code
+    /// if `putEvent` is not a valid put event in the `PutHeader` encoding
+    /// or has a message which can not be represented in the compact
+    /// encoding, in which case `compactEvent` is left in an unspecified
+    /// state.  The behavior is undefined unless `compactEvent` is empty.
+    /// Note that small application data is copied, while larger one is
+    /// referred to by `compactEvent`.
+    static int compactPutEvent(bdlbb::Blob*       compactEvent,
+                               const bdlbb::Blob& putEvent);
+
+    /// Load into the specified `putEvent` the `PutHeader` encoding of the
+    /// specified `compactEvent`.  Return 0 on success, or a non-zero error
+    /// code if `compactEvent` is not a valid put event in the compact
+    /// encoding, in which case `putEvent` is left in an unspecified state.
+    /// The behavior is undefined unless `putEvent` is empty.  Note that
+    /// small application data is copied, while larger one is referred to
+    /// by `putEvent`.
+    static int expandPutEvent(bdlbb::Blob*       putEvent,
+                              const bdlbb::Blob& compactEvent);
+
+    /// Append the messages of the specified `putEvent` to the specified
+    /// `batchEvent`, updating the length in its header, so that
+    /// `batchEvent` is a single PUT event carrying the messages of all the
+    /// events appended to it, in order.  If `batchEvent` is empty, it is
+    /// first initialized with the header of `putEvent`.  Return 0 on
+    /// success, or a non-zero error code if `putEvent` or `batchEvent` is
+    /// not a valid put event in the `PutHeader` encoding, in which case
+    /// `batchEvent` is left unchanged.  Note that the header of `batchEvent`
+    /// and small application data are copied, while larger one is referred
+    /// to by `batchEvent`.
+    static int appendPutEvent(bdlbb::Blob*       batchEvent,
+                              const bdlbb::Blob& putEvent);
 };
 
 // ============================================================================
@@ -18,9 +18,12 @@
 
 // BMQ
 #include <bmqp_event.h>
+#include <bmqp_messageguidgenerator.h>
 #include <bmqp_messageproperties.h>
 #include <bmqp_protocol.h>
 #include <bmqp_protocolutil.h>
+#include <bmqp_puteventbuilder.h>
+#include <bmqp_putmessageiterator.h>
 #include <bmqp_pusheventbuilder.h>
 #include <bmqp_pushmessageiterator.h>
 #include <bmqp_queueid.h>
@@ -37,6 +40,9 @@
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bsls_assert.h>
 
+// MWC
+#include <mwcu_blob.h>
+
 // TEST DRIVER
 #include <mwctst_testhelper.h>
 
@@ -218,6 +224,25 @@ bool find(bmqp::EventUtilEventInfo& eventInfo,
     return (i < eventInfo.d_ids.size());
 }
 
+/// Return the number of data buffers of the specified `blob` referring to
+/// memory of the data buffers of the specified `source` blob.
+int numSharedBuffers(const bdlbb::Blob& blob, const bdlbb::Blob& source)
+{
+    int result = 0;
+    for (int i = 0; i < blob.numDataBuffers(); ++i) {
+        const char* data = blob.buffer(i).data();
+        for (int j = 0; j < source.numDataBuffers(); ++j) {
+            const bdlbb::BlobBuffer& buffer = source.buffer(j);
+            if (buffer.data() <= data &&
+                data < buffer.data() + buffer.size()) {
+                ++result;
+                break;  // BREAK
+            }
+        }
+    }
+    return result;
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -807,6 +832,272 @@ static void test3_flattenWithMessageProperties()
     }
 }
 
+static void test4_compactPutEvent()
+// ------------------------------------------------------------------------
+// COMPACT PUT EVENT
+//
+// Concerns:
+//   Compacting a PUT event results in a smaller event flagged as compact,
+//   and expanding it restores the original event byte for byte, for
+//   messages with and without a MessageGUID, and with small (copied) and
+//   large (referred to) application data.  Invalid input is rejected.
+//
+// Plan:
+//   1) Build a PUT event with messages of various sizes and flags.
+//   2) Compact it, and verify the resulting event.
+//   3) Expand the compact event, and verify that it is identical to the
+//      original one, and that its messages can be iterated over.
+//   4) Verify that a compact event can not be compacted again, that a
+//      regular event can not be expanded, and that a truncated compact
+//      event can not be expanded.
+//
+// Testing:
+//   - 'compactPutEvent(...)'
+//   - 'expandPutEvent(...)'
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("COMPACT PUT EVENT");
+
+    const int k_PAYLOAD_SIZES[] = {1, 4, 37, 600, 2000};
+    const int k_NUM_MESSAGES    = sizeof(k_PAYLOAD_SIZES) /
+                                  sizeof(*k_PAYLOAD_SIZES);
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(256, s_allocator_p);
+    bmqp::PutEventBuilder builder(&bufferFactory, s_allocator_p);
+    bsl::vector<char>     payload(2000, 'a', s_allocator_p);
+
+    // 1) Build a PUT event with messages of various sizes and flags.
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        bmqt::MessageGUID guid;
+        if (i % 2 == 0) {
+            guid.fromHex("0000000000003039CD8101000000270F");
+        }
+
+        int flags = 0;
+        if (i % 3 == 0) {
+            bmqp::PutHeaderFlagUtil::setFlag(
+                &flags,
+                bmqp::PutHeaderFlags::e_ACK_REQUESTED);
+        }
+
+        builder.startMessage();
+        builder.setMessagePayload(payload.data(), k_PAYLOAD_SIZES[i]);
+        builder.setMessageGUID(guid);
+        builder.setFlags(flags);
+        ASSERT_EQ_D(i,
+                    builder.packMessage(100000 * i),
+                    bmqt::EventBuilderResult::e_SUCCESS);
+    }
+    const bdlbb::Blob& putEvent = builder.blob();
+
+    // 2) Compact it, and verify the resulting event.
+    bdlbb::Blob compactEvent(&bufferFactory, s_allocator_p);
+    ASSERT_EQ(bmqp::EventUtil::compactPutEvent(&compactEvent, putEvent), 0);
+    PVV(putEvent.length() << " bytes compacted to " << compactEvent.length());
+    ASSERT_LT(compactEvent.length(), putEvent.length());
+
+    bmqp::Event event(&compactEvent, s_allocator_p);
+    ASSERT(event.isValid());
+    ASSERT(event.isPutEvent());
+    ASSERT(event.isCompactPutEvent());
+
+    // 3) Expand the compact event, and verify that it is identical to the
+    //    original one, and that its messages can be iterated over.
+    bdlbb::Blob expandedEvent(&bufferFactory, s_allocator_p);
+    ASSERT_EQ(bmqp::EventUtil::expandPutEvent(&expandedEvent, compactEvent),
+              0);
+    ASSERT_EQ(bdlbb::BlobUtil::compare(expandedEvent, putEvent), 0);
+
+    bmqp::Event expanded(&expandedEvent, s_allocator_p);
+    ASSERT(expanded.isPutEvent());
+    ASSERT(!expanded.isCompactPutEvent());
+
+    bmqp::PutMessageIterator iter(&bufferFactory, s_allocator_p);
+    expanded.loadPutMessageIterator(&iter, true);
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        ASSERT_EQ_D(i, iter.next(), 1);
+        ASSERT_EQ_D(i, iter.header().queueId(), 100000 * i);
+        ASSERT_EQ_D(i, iter.applicationDataSize(), k_PAYLOAD_SIZES[i]);
+    }
+    ASSERT_EQ(iter.next(), 0);
+
+    // 4) Verify that invalid input is rejected.
+    bdlbb::Blob blob(&bufferFactory, s_allocator_p);
+    ASSERT_NE(bmqp::EventUtil::compactPutEvent(&blob, compactEvent), 0);
+
+    blob.removeAll();
+    ASSERT_NE(bmqp::EventUtil::expandPutEvent(&blob, putEvent), 0);
+
+    // Note that 'truncated' shares its first buffer with 'compactEvent',
+    // which is not used anymore.
+    bdlbb::Blob truncated(compactEvent, s_allocator_p);
+    truncated.setLength(compactEvent.length() - 1);
+    bmqp::EventHeader eventHeader;
+    mwcu::BlobUtil::readNBytes(reinterpret_cast<char*>(&eventHeader),
+                               truncated,
+                               mwcu::BlobPosition(),
+                               sizeof(eventHeader));
+    eventHeader.setLength(truncated.length());
+    mwcu::BlobUtil::writeBytes(&truncated,
+                               mwcu::BlobPosition(),
+                               reinterpret_cast<const char*>(&eventHeader),
+                               sizeof(eventHeader));
+    blob.removeAll();
+    ASSERT_NE(bmqp::EventUtil::expandPutEvent(&blob, truncated), 0);
+}
+
+static void test5_appendPutEvent()
+// ------------------------------------------------------------------------
+// APPEND PUT EVENT
+//
+// Concerns:
+//   Appending PUT events to a batch results in a single valid PUT event
+//   carrying all the messages, in order.  Invalid input is rejected and
+//   leaves the batch unchanged.
+//
+// Plan:
+//   1) Build two PUT events having messages of various sizes.
+//   2) Append them to an empty batch, and verify that the batch is a valid
+//      PUT event whose messages are those of both events, in order.
+//   3) Verify that a compact event can not be appended.
+//
+// Testing:
+//   - 'appendPutEvent(...)'
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("APPEND PUT EVENT");
+
+    const int k_PAYLOAD_SIZES[] = {1, 37, 600, 4, 2000};
+    const int k_NUM_MESSAGES    = sizeof(k_PAYLOAD_SIZES) /
+                                  sizeof(*k_PAYLOAD_SIZES);
+    const int k_FIRST_EVENT_MESSAGES = 2;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(256, s_allocator_p);
+    bmqp::PutEventBuilder builder1(&bufferFactory, s_allocator_p);
+    bmqp::PutEventBuilder builder2(&bufferFactory, s_allocator_p);
+    bsl::vector<char>     payload(2000, 'a', s_allocator_p);
+
+    // 1) Build two PUT events having messages of various sizes.
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        bmqp::PutEventBuilder& builder = i < k_FIRST_EVENT_MESSAGES
+                                             ? builder1
+                                             : builder2;
+        builder.startMessage();
+        builder.setMessagePayload(payload.data(), k_PAYLOAD_SIZES[i]);
+        builder.setMessageGUID(bmqp::MessageGUIDGenerator::testGUID());
+        ASSERT_EQ_D(i,
+                    builder.packMessage(1000 * i),
+                    bmqt::EventBuilderResult::e_SUCCESS);
+    }
+
+    // 2) Append them to an empty batch, and verify the batch.
+    bdlbb::Blob batch(&bufferFactory, s_allocator_p);
+    ASSERT_EQ(bmqp::EventUtil::appendPutEvent(&batch, builder1.blob()), 0);
+    ASSERT_EQ(bdlbb::BlobUtil::compare(batch, builder1.blob()), 0);
+    ASSERT_EQ(bmqp::EventUtil::appendPutEvent(&batch, builder2.blob()), 0);
+    ASSERT_EQ(batch.length(),
+              builder1.blob().length() + builder2.blob().length() -
+                  static_cast<int>(sizeof(bmqp::EventHeader)));
+
+    bmqp::Event event(&batch, s_allocator_p);
+    ASSERT(event.isValid());
+    ASSERT(event.isPutEvent());
+
+    bmqp::PutMessageIterator iter(&bufferFactory, s_allocator_p);
+    event.loadPutMessageIterator(&iter, true);
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        ASSERT_EQ_D(i, iter.next(), 1);
+        ASSERT_EQ_D(i, iter.header().queueId(), 1000 * i);
+        ASSERT_EQ_D(i, iter.applicationDataSize(), k_PAYLOAD_SIZES[i]);
+    }
+    ASSERT_EQ(iter.next(), 0);
+
+    // 3) Verify that invalid input is rejected.
+    bdlbb::Blob compactEvent(&bufferFactory, s_allocator_p);
+    ASSERT_EQ(bmqp::EventUtil::compactPutEvent(&compactEvent,
+                                               builder1.blob()),
+              0);
+    const int length = batch.length();
+    ASSERT_NE(bmqp::EventUtil::appendPutEvent(&batch, compactEvent), 0);
+    ASSERT_EQ(batch.length(), length);
+}
+
+static void test6_flattenZeroCopy()
+// ------------------------------------------------------------------------
+// FLATTEN ZERO COPY
+//
+// Concerns:
+//   1. In zero-copy mode, the flattened event refers to the payloads of the
+//      messages of the source event instead of copying them.
+//   2. The messages of the flattened event are the same as in copy mode.
+//
+// Plan:
+//   1. Flatten, in both modes, an event having a message with a payload
+//      large enough to be shared and three SubQueueInfos.
+//
+// Testing:
+//   Flattening in zero-copy mode.
+//     - 'flattenPushEvent(...)'
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("FLATTEN ZERO COPY");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    bmqp::PushEventBuilder pushEventBuilder(&bufferFactory, s_allocator_p);
+    bsl::vector<Data>      data(s_allocator_p);
+
+    appendDatum(&data,
+                3,  // numSubQueueInfos
+                4 * bmqp::Protocol::k_ZERO_COPY_MIN_APPDATA_SIZE,
+                &bufferFactory,
+                s_allocator_p);
+    appendMessages(&pushEventBuilder, data);
+    bmqp::Event event(&(pushEventBuilder.blob()), s_allocator_p);
+
+    const Data& D = data[0];
+
+    for (int zeroCopy = 0; zeroCopy < 2; ++zeroCopy) {
+        PV("zeroCopy: " << zeroCopy);
+
+        bsl::vector<bmqp::EventUtilEventInfo> eventInfos(s_allocator_p);
+        int rc = bmqp::EventUtil::flattenPushEvent(&eventInfos,
+                                                   event,
+                                                   &bufferFactory,
+                                                   s_allocator_p,
+                                                   zeroCopy);
+        ASSERT_EQ(rc, 0);
+        ASSERT_EQ(eventInfos.size(), 1u);
+        ASSERT_EQ(eventInfos[0].d_ids.size(), D.d_subQueueInfos.size());
+
+        const int numShared = numSharedBuffers(eventInfos[0].d_blob,
+                                               pushEventBuilder.blob());
+        if (zeroCopy) {
+            ASSERT_GE(numShared, static_cast<int>(D.d_subQueueInfos.size()));
+        }
+        else {
+            ASSERT_EQ(numShared, 0);
+        }
+
+        bmqp::Event flattenedEvent(&(eventInfos[0].d_blob), s_allocator_p);
+        bmqp::PushMessageIterator msgIterator(&bufferFactory, s_allocator_p);
+        flattenedEvent.loadPushMessageIterator(&msgIterator, true);
+        BSLS_ASSERT_OPT(msgIterator.isValid());
+
+        for (size_t j = 0; j < D.d_subQueueInfos.size(); ++j) {
+            rc = msgIterator.next();
+            BSLS_ASSERT_OPT(rc == 1);
+
+            bdlbb::Blob payload(&bufferFactory, s_allocator_p);
+            rc = msgIterator.loadMessagePayload(&payload);
+            BSLS_ASSERT_OPT(rc == 0);
+            ASSERT_EQ(bdlbb::BlobUtil::compare(D.d_payload, payload), 0);
+
+            ASSERT(find(eventInfos[0], D.d_qid, D.d_subQueueInfos[j].id()));
+        }
+        ASSERT_EQ(msgIterator.next(), 0);
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -823,6 +1114,9 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 6: test6_flattenZeroCopy(); break;
+    case 5: test5_appendPutEvent(); break;
+    case 4: test4_compactPutEvent(); break;
     case 3: test3_flattenWithMessageProperties(); break;
     case 2: test2_flattenExplodesEvent(); break;
     case 1: test1_breathingTest(); break;
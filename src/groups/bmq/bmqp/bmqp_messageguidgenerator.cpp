@@ -70,6 +70,49 @@ const int k_TIMERTICK_BYTES = 7;
 // class MessageGUIDGenerator
 // --------------------------
 
+// PRIVATE CLASS METHODS
+void MessageGUIDGenerator::populateGUID(bmqt::MessageGUID* guid,
+                                        unsigned int       counter,
+                                        bsls::Types::Int64 timerTickDiff,
+                                        const char*        clientId)
+{
+    // NOTE: 'BE' suffix in variable name implies that variable's value is
+    //       big-endian (network byte order)
+
+    // Below, we use our knowledge of internal memory layout of
+    // bmqt::MessageGUID to populate its data member.  Alternatives are:
+    //: o having setters in bmqt::MessageGUID, which is not ideal given that it
+    //:   should be completely opaque to clients.
+    //: o using friendship
+    char* buffer = reinterpret_cast<char*>(guid);
+
+    // Populate GUIDVersionAndCounter
+    const unsigned int versionAndCounter = (k_GUID_VERSION
+                                            << k_GUID_VERSION_START_IDX) |
+                                           ((counter << k_COUNTER_START_IDX) &
+                                            k_COUNTER_MASK);
+
+    const bdlb::BigEndianUint32 versionAndCounterBE =
+        bdlb::BigEndianUint32::make(versionAndCounter);
+    // Populate VersionAndCounter (MSB 3 bytes from versionAndCounterBE)
+    bsl::memcpy(buffer,
+                reinterpret_cast<const char*>(&versionAndCounterBE),
+                k_GUID_VERSION_AND_COUNTER_BYTES);
+    buffer += k_GUID_VERSION_AND_COUNTER_BYTES;
+
+    // Populate TimerTick
+    const bdlb::BigEndianInt64 timerTickDiffBE = bdlb::BigEndianInt64::make(
+        timerTickDiff);
+    bsl::memcpy(buffer,
+                reinterpret_cast<const char*>(&timerTickDiffBE) +
+                    1,  // skip MSB
+                k_TIMERTICK_BYTES);
+    buffer += k_TIMERTICK_BYTES;
+
+    // Populate ClientId hash
+    bsl::memcpy(buffer, clientId, k_CLIENT_ID_LEN_BINARY);
+}
+
 // CREATORS
 MessageGUIDGenerator::MessageGUIDGenerator(int sessionId, bool doIpResolving)
 : d_clientId()     // init array with zeros
@@ -166,46 +209,34 @@ void MessageGUIDGenerator::generateGUID(bmqt::MessageGUID* guid)
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(guid);
 
-    // NOTE: 'BE' suffix in variable name implies that variable's value is
-    //       big-endian (network byte order)
-
     // Get a snapshot of timer tick and counter values
     const bsls::Types::Int64 timerTickDiff = bsls::TimeUtil::getTimer() -
                                              d_timerBaseOffset;
     const unsigned int counter = ++d_counter;
 
-    // Below, we use our knowledge of internal memory layout of
-    // bmqt::MessageGUID to populate its data member.  Alternatives are:
-    //: o having setters in bmqt::MessageGUID, which is not ideal given that it
-    //:   should be completely opaque to clients.
-    //: o using friendship
-    char* buffer = reinterpret_cast<char*>(guid);
+    populateGUID(guid, counter, timerTickDiff, d_clientId);
+}
 
-    // Populate GUIDVersionAndCounter
-    const unsigned int versionAndCounter = (k_GUID_VERSION
-                                            << k_GUID_VERSION_START_IDX) |
-                                           ((counter << k_COUNTER_START_IDX) &
-                                            k_COUNTER_MASK);
+void MessageGUIDGenerator::generateGUIDs(bmqt::MessageGUID* guids, int count)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(guids);
+    BSLS_ASSERT_SAFE(0 <= count && count <= k_MAX_BULK_COUNT);
 
-    const bdlb::BigEndianUint32 versionAndCounterBE =
-        bdlb::BigEndianUint32::make(versionAndCounter);
-    // Populate VersionAndCounter (MSB 3 bytes from versionAndCounterBE)
-    bsl::memcpy(buffer,
-                reinterpret_cast<const char*>(&versionAndCounterBE),
-                k_GUID_VERSION_AND_COUNTER_BYTES);
-    buffer += k_GUID_VERSION_AND_COUNTER_BYTES;
+    if (count == 0) {
+        return;  // RETURN
+    }
 
-    // Populate TimerTick
-    const bdlb::BigEndianInt64 timerTickDiffBE = bdlb::BigEndianInt64::make(
-        timerTickDiff);
-    bsl::memcpy(buffer,
-                reinterpret_cast<const char*>(&timerTickDiffBE) +
-                    1,  // skip MSB
-                k_TIMERTICK_BYTES);
-    buffer += k_TIMERTICK_BYTES;
+    // Reserve a range of 'count' counter values, and get a snapshot of the
+    // timer tick shared by all the GUIDs of the range.
+    const bsls::Types::Int64 timerTickDiff = bsls::TimeUtil::getTimer() -
+                                             d_timerBaseOffset;
+    const unsigned int numGUIDs     = static_cast<unsigned int>(count);
+    const unsigned int firstCounter = d_counter.add(numGUIDs) - numGUIDs + 1;
 
-    // Populate ClientId hash
-    bsl::memcpy(buffer, d_clientId, k_CLIENT_ID_LEN_BINARY);
+    for (int i = 0; i < count; ++i) {
+        populateGUID(guids + i, firstCounter + i, timerTickDiff, d_clientId);
+    }
 }
 
 int MessageGUIDGenerator::extractFields(int*                     version,
@@ -260,6 +291,30 @@ int MessageGUIDGenerator::extractFields(int*                     version,
     return 0;  // RETURN
 }
 
+void MessageGUIDGenerator::loadNextGUID(bmqt::MessageGUID*       next,
+                                        const bmqt::MessageGUID& guid)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(next);
+
+    unsigned char buffer[bmqt::MessageGUID::e_SIZE_BINARY];
+    guid.toBinary(buffer);
+
+    // The counter is stored in the first word, along with the version and
+    // the MSB of the timer tick.
+    bdlb::BigEndianUint32 firstWordBE;
+    bsl::memcpy(&firstWordBE, buffer, sizeof(firstWordBE));
+
+    const unsigned int firstWord = firstWordBE;
+    const unsigned int counter   = (firstWord & k_COUNTER_MASK) >>
+                                 k_COUNTER_START_IDX;
+    firstWordBE = (firstWord & ~k_COUNTER_MASK) |
+                  (((counter + 1) << k_COUNTER_START_IDX) & k_COUNTER_MASK);
+    bsl::memcpy(buffer, &firstWordBE, sizeof(firstWordBE));
+
+    next->fromBinary(buffer);
+}
+
 bmqt::MessageGUID MessageGUIDGenerator::testGUID()
 {
     static bsls::AtomicUint s_counter(0);
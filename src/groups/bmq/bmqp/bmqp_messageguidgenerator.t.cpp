@@ -691,6 +691,119 @@ static void test7_customHashUniqueness()
     }
 }
 
+static void test8_generateGUIDs()
+// ------------------------------------------------------------------------
+// GENERATE GUIDS
+//
+// Concerns:
+//   1. 'generateGUIDs' generates consecutive counters sharing the same
+//      timer tick and client id.
+//   2. GUIDs generated in bulk, possibly interleaved with GUIDs generated
+//      one by one, are unique.
+//
+// Plan:
+//   - Generate a batch of GUIDs and verify their fields.
+//   - Generate GUIDs alternating 'generateGUID' and 'generateGUIDs', and
+//     verify all of them are unique.
+//
+// Testing:
+//   generateGUIDs
+//   loadNextGUID
+// ------------------------------------------------------------------------
+{
+    s_ignoreCheckDefAlloc = true;  // Implicit string conversion in ASSERT_EQ
+
+    mwctst::TestHelper::printTestName("GENERATE GUIDS");
+
+    bmqp::MessageGUIDGenerator generator(0);
+
+    {
+        PVV("Fields of a batch");
+        const int         k_NUM_GUIDS = 512;
+        bmqt::MessageGUID guids[k_NUM_GUIDS];
+
+        generator.generateGUIDs(guids, k_NUM_GUIDS);
+
+        int                firstVersion;
+        unsigned int       firstCounter;
+        bsls::Types::Int64 firstTimerTick;
+        bsl::string        firstClientId(s_allocator_p);
+
+        int rc = bmqp::MessageGUIDGenerator::extractFields(&firstVersion,
+                                                           &firstCounter,
+                                                           &firstTimerTick,
+                                                           &firstClientId,
+                                                           guids[0]);
+        ASSERT_EQ(rc, 0);
+        ASSERT_EQ(firstVersion, 1);
+        ASSERT_EQ(firstClientId, generator.clientIdHex());
+
+        for (int i = 1; i < k_NUM_GUIDS; ++i) {
+            int                version;
+            unsigned int       counter;
+            bsls::Types::Int64 timerTick;
+            bsl::string        clientId(s_allocator_p);
+
+            rc = bmqp::MessageGUIDGenerator::extractFields(&version,
+                                                           &counter,
+                                                           &timerTick,
+                                                           &clientId,
+                                                           guids[i]);
+            ASSERT_EQ_D(i, rc, 0);
+            ASSERT_EQ_D(i, version, 1);
+            ASSERT_EQ_D(i, counter, firstCounter + i);
+            ASSERT_EQ_D(i, timerTick, firstTimerTick);
+            ASSERT_EQ_D(i, clientId, firstClientId);
+
+            bmqt::MessageGUID next;
+            bmqp::MessageGUIDGenerator::loadNextGUID(&next, guids[i - 1]);
+            ASSERT_EQ_D(i, next, guids[i]);
+        }
+
+        // The counter wraps around
+        const char k_MAX_COUNTER_HEX[] = "7FFFFF01020304050607080910111213";
+        const char k_MIN_COUNTER_HEX[] = "40000001020304050607080910111213";
+
+        bmqt::MessageGUID guid;
+        guid.fromHex(k_MAX_COUNTER_HEX);
+        bmqp::MessageGUIDGenerator::loadNextGUID(&guid, guid);
+
+        bmqt::MessageGUID expected;
+        expected.fromHex(k_MIN_COUNTER_HEX);
+        ASSERT_EQ(guid, expected);
+
+        // Nothing is generated for an empty batch
+        bmqt::MessageGUID unset;
+        generator.generateGUIDs(&unset, 0);
+        ASSERT(unset.isUnset());
+    }
+
+    {
+        PVV("Uniqueness");
+        const int k_NUM_ITERATIONS = 1000;
+        const int k_BATCH_SIZE     = 37;
+
+        bsl::set<bmqt::MessageGUID> guids(s_allocator_p);
+        bmqt::MessageGUID           batch[k_BATCH_SIZE];
+
+        for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+            bmqt::MessageGUID guid;
+            generator.generateGUID(&guid);
+            ASSERT_EQ_D(i, guids.insert(guid).second, true);
+
+            generator.generateGUIDs(batch, k_BATCH_SIZE);
+            for (int j = 0; j < k_BATCH_SIZE; ++j) {
+                ASSERT_EQ_D(i << ", " << j,
+                            guids.insert(batch[j]).second,
+                            true);
+            }
+        }
+
+        ASSERT_EQ(guids.size(),
+                  static_cast<size_t>(k_NUM_ITERATIONS * (k_BATCH_SIZE + 1)));
+    }
+}
+
 // ============================================================================
 //                              PERFORMANCE TESTS
 // ----------------------------------------------------------------------------
@@ -1615,6 +1728,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 8: test8_generateGUIDs(); break;
     case 7: test7_customHashUniqueness(); break;
     case 6: test6_defaultHashUniqueness(); break;
     case 5: test5_print(); break;
@@ -18,6 +18,7 @@
 
 #include <bmqscm_version.h>
 // BMQ
+#include <bmqp_messagepropertiesview.h>
 #include <bmqp_protocolutil.h>
 
 // MWC
@@ -184,6 +185,19 @@ MessageProperties_Schema::MessageProperties_Schema(
     }
 }
 
+MessageProperties_Schema::MessageProperties_Schema(
+    const MessagePropertiesView& view,
+    bslma::Allocator*            basicAllocator)
+: d_indices(basicAllocator)
+{
+    bsl::string name(basicAllocator);
+
+    for (int index = 0; index < view.numProperties(); ++index) {
+        view.loadPropertyName(&name, index);
+        d_indices.emplace(name, index);
+    }
+}
+
 MessageProperties_Schema::MessageProperties_Schema(
     const MessageProperties_Schema& other)
 : d_indices(other.d_indices)
@@ -58,6 +58,7 @@ namespace bmqp {
 // FORWARD DECLARATION
 class MessageProperties;
 class MessagePropertiesIterator;
+class MessagePropertiesView;
 
 // ==============================
 // class MessageProperties_Schema
@@ -97,6 +98,12 @@ class MessageProperties_Schema {
     /// change
     MessageProperties_Schema(const MessageProperties& mps,
                              bslma::Allocator*        basicAllocator);
+
+    /// Create Schema from the properties in the specified `view`, in their
+    /// order of encoding.  If multiple properties have the same name, the
+    /// first one is indexed.  Once created, it cannot change.
+    MessageProperties_Schema(const MessagePropertiesView& view,
+                             bslma::Allocator*            basicAllocator);
     MessageProperties_Schema(const MessageProperties_Schema& other);
 
     // PUBLIC ACCESSORS
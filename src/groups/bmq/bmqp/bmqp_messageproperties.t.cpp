@@ -37,11 +37,18 @@
 #include <bsl_utility.h>
 #include <bsl_vector.h>
 #include <bslmf_assert.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
 #include <bsls_types.h>
 
 // TEST DRIVER
 #include <mwctst_testhelper.h>
 
+// BENCHMARKING LIBRARY
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <benchmark/benchmark.h>
+#endif
+
 // CONVENIENCE
 using namespace BloombergLP;
 using namespace bsl;
@@ -445,6 +452,17 @@ void encode(bdlbb::Blob* blob, const PropertyMap& pmap)
     mpsh->setMessagePropertiesAreaWords(numWords);
 }
 
+#ifdef BSLS_PLATFORM_OS_LINUX
+/// Apply to the specified Google Benchmark `b` various numbers of
+/// properties, up to 64.
+void populateNumProperties_GoogleBenchmark(benchmark::internal::Benchmark* b)
+{
+    for (int numProps = 1; numProps <= 64; numProps *= 4) {
+        b->Arg(numProps);
+    }
+}
+#endif
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -1167,6 +1185,173 @@ static void test10_empty()
     ASSERT(!p.hasProperty("z"));
 }
 
+static void testN1_streamOut()
+// ------------------------------------------------------------------------
+// BENCHMARK: STREAM OUT
+//
+// Concerns:
+//   Measure the cost of encoding message properties, as done by a producer
+//   setting a property before posting each message, for various numbers
+//   of properties.
+//
+// Plan:
+//   - For each number of properties, time a large number of updates of a
+//     property followed by a 'streamOut', and report the average time.
+//
+// Testing:
+//   Performance of streamOut.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BENCHMARK: STREAM OUT");
+
+    const int                   k_NUM_ITERS = 100000;
+    bmqp::MessagePropertiesInfo logic =
+        bmqp::MessagePropertiesInfo::makeInvalidSchema();
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+
+    for (int numProps = 1; numProps <= 64; numProps *= 4) {
+        bmqp::MessageProperties p(s_allocator_p);
+        PropertyMap             pmap(s_allocator_p);
+
+        populateProperties(&p, &pmap, numProps);
+
+        bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+        for (int i = 0; i < k_NUM_ITERS; ++i) {
+            p.setPropertyAsInt32("counter", i);
+            p.streamOut(&bufferFactory, logic);
+        }
+        bsls::Types::Int64 endTime = bsls::TimeUtil::getTimer();
+
+        cout << "Properties: " << numProps + 1
+             << ", encoded size: " << p.totalSize() << " bytes"
+             << ", average time (ns): "
+             << (endTime - startTime) / k_NUM_ITERS << '\n';
+    }
+}
+
+static void testN2_streamIn()
+// ------------------------------------------------------------------------
+// BENCHMARK: STREAM IN
+//
+// Concerns:
+//   Measure the cost of decoding message properties and reading one of
+//   them, as done by a consumer, for various numbers of properties.
+//
+// Plan:
+//   - For each number of properties, time a large number of 'streamIn' of
+//     the same wire representation followed by the read of a property,
+//     and report the average time.
+//
+// Testing:
+//   Performance of streamIn.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BENCHMARK: STREAM IN");
+
+    const int                   k_NUM_ITERS = 100000;
+    bmqp::MessagePropertiesInfo logic =
+        bmqp::MessagePropertiesInfo::makeInvalidSchema();
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+
+    for (int numProps = 1; numProps <= 64; numProps *= 4) {
+        bmqp::MessageProperties p(s_allocator_p);
+        PropertyMap             pmap(s_allocator_p);
+
+        populateProperties(&p, &pmap, numProps);
+        ASSERT_EQ(0, p.setPropertyAsInt32("counter", numProps));
+
+        const bdlbb::Blob wireRep(p.streamOut(&bufferFactory, logic),
+                                  s_allocator_p);
+
+        bmqp::MessageProperties obj(s_allocator_p);
+        int                     value     = 0;
+        bsls::Types::Int64      startTime = bsls::TimeUtil::getTimer();
+        for (int i = 0; i < k_NUM_ITERS; ++i) {
+            obj.streamIn(wireRep, logic.isExtended());
+            value += obj.getPropertyAsInt32("counter");
+        }
+        bsls::Types::Int64 endTime = bsls::TimeUtil::getTimer();
+
+        ASSERT_EQ(k_NUM_ITERS * numProps, value);
+
+        cout << "Properties: " << numProps + 1
+             << ", encoded size: " << wireRep.length() << " bytes"
+             << ", average time (ns): "
+             << (endTime - startTime) / k_NUM_ITERS << '\n';
+    }
+}
+
+// Begin Benchmarking Tests
+#ifdef BSLS_PLATFORM_OS_LINUX
+static void testN1_streamOut_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// BENCHMARK: STREAM OUT
+//
+// Concerns:
+//   Measure the cost of updating a property and encoding message
+//   properties.  'state.range(0)' is the number of the other properties.
+// ------------------------------------------------------------------------
+{
+    bmqp::MessagePropertiesInfo logic =
+        bmqp::MessagePropertiesInfo::makeInvalidSchema();
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    bmqp::MessageProperties        p(s_allocator_p);
+    PropertyMap                    pmap(s_allocator_p);
+
+    populateProperties(&p, &pmap, state.range(0));
+
+    int counter = 0;
+
+    // <time>
+    for (auto _ : state) {
+        p.setPropertyAsInt32("counter", ++counter);
+        benchmark::DoNotOptimize(p.streamOut(&bufferFactory, logic));
+    }
+    // </time>
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            p.totalSize());
+}
+
+static void testN2_streamIn_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// BENCHMARK: STREAM IN
+//
+// Concerns:
+//   Measure the cost of decoding message properties and reading one of
+//   them.  'state.range(0)' is the number of the other properties.
+// ------------------------------------------------------------------------
+{
+    bmqp::MessagePropertiesInfo logic =
+        bmqp::MessagePropertiesInfo::makeInvalidSchema();
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    bmqp::MessageProperties        p(s_allocator_p);
+    PropertyMap                    pmap(s_allocator_p);
+
+    populateProperties(&p, &pmap, state.range(0));
+    p.setPropertyAsInt32("counter", 1);
+
+    const bdlbb::Blob wireRep(p.streamOut(&bufferFactory, logic),
+                              s_allocator_p);
+
+    bmqp::MessageProperties obj(s_allocator_p);
+
+    // <time>
+    for (auto _ : state) {
+        obj.streamIn(wireRep, logic.isExtended());
+        benchmark::DoNotOptimize(obj.getPropertyAsInt32("counter"));
+    }
+    // </time>
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            wireRep.length());
+}
+#endif  // BSLS_PLATFORM_OS_LINUX
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1189,11 +1374,25 @@ int main(int argc, char* argv[])
     case 3: test3_binaryPropertyTest(); break;
     case 2: test2_setPropertyTest(); break;
     case 1: test1_breathingTest(); break;
+    case -1:
+        MWC_BENCHMARK_WITH_ARGS(testN1_streamOut,
+                                Apply(populateNumProperties_GoogleBenchmark));
+        break;
+    case -2:
+        MWC_BENCHMARK_WITH_ARGS(testN2_streamIn,
+                                Apply(populateNumProperties_GoogleBenchmark));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
     } break;
     }
+#ifdef BSLS_PLATFORM_OS_LINUX
+    if (_testCase < 0) {
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+    }
+#endif
 
     bmqp::ProtocolUtil::shutdown();
 
@@ -0,0 +1,640 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqp_messagepropertiesview.cpp                                     -*-C++-*-
+#include <bmqp_messagepropertiesview.h>
+
+#include <bmqscm_version.h>
+// BMQ
+#include <bmqp_messageproperties.h>
+#include <bmqp_protocol.h>
+#include <bmqp_protocolutil.h>
+
+// MWC
+#include <mwcu_blob.h>
+#include <mwcu_blobobjectproxy.h>
+
+// BDE
+#include <bdlb_bigendian.h>
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+
+namespace BloombergLP {
+namespace bmqp {
+
+namespace {
+
+/// Return true if the specified `length` is valid for a property value of
+/// the specified `type`, and false otherwise.
+bool isValidValueLength(int length, bmqt::PropertyType::Enum type)
+{
+    if (length < 0 ||
+        length > MessageProperties::k_MAX_PROPERTY_VALUE_LENGTH) {
+        return false;  // RETURN
+    }
+
+    switch (type) {
+    case bmqt::PropertyType::e_BOOL:
+    case bmqt::PropertyType::e_CHAR: return length == sizeof(char);
+    case bmqt::PropertyType::e_SHORT:
+        return length == sizeof(bdlb::BigEndianInt16);
+    case bmqt::PropertyType::e_INT32:
+        return length == sizeof(bdlb::BigEndianInt32);
+    case bmqt::PropertyType::e_INT64:
+        return length == sizeof(bdlb::BigEndianInt64);
+    case bmqt::PropertyType::e_STRING:
+    case bmqt::PropertyType::e_BINARY: return true;
+    case bmqt::PropertyType::e_UNDEFINED:
+    default: return false;
+    }
+}
+
+}  // close unnamed namespace
+
+// ---------------------------
+// class MessagePropertiesView
+// ---------------------------
+
+// PRIVATE ACCESSORS
+int MessagePropertiesView::readValue(char* buffer, int index, int length) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_blob_p);
+    BSLS_ASSERT_SAFE(0 <= index && index < numProperties());
+    BSLS_ASSERT_SAFE(length <= d_properties[index].d_valueLength);
+
+    const Property&    property = d_properties[index];
+    mwcu::BlobPosition position;
+    int                rc = mwcu::BlobUtil::findOffsetSafe(
+        &position,
+        *d_blob_p,
+        property.d_nameOffset + property.d_nameLength);
+    if (rc != 0) {
+        return rc;  // RETURN
+    }
+
+    return mwcu::BlobUtil::readNBytes(buffer, *d_blob_p, position, length);
+}
+
+bdld::Datum
+MessagePropertiesView::getPropertyRefAt(int               index,
+                                        bslma::Allocator* basicAllocator) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= index && index < numProperties());
+
+    const Property& property = d_properties[index];
+
+    switch (property.d_type) {
+    case bmqt::PropertyType::e_BOOL: {
+        char value;
+        if (readValue(&value, index, sizeof(value)) == 0) {
+            return bdld::Datum::createBoolean(value == 1);  // RETURN
+        }
+    } break;
+    case bmqt::PropertyType::e_CHAR: {
+        char value;
+        if (readValue(&value, index, sizeof(value)) == 0) {
+            return bdld::Datum::createInteger(value);  // RETURN
+        }
+    } break;
+    case bmqt::PropertyType::e_SHORT: {
+        bdlb::BigEndianInt16 nboValue;
+        if (readValue(reinterpret_cast<char*>(&nboValue),
+                      index,
+                      sizeof(nboValue)) == 0) {
+            return bdld::Datum::createInteger(
+                static_cast<short>(nboValue));  // RETURN
+        }
+    } break;
+    case bmqt::PropertyType::e_INT32: {
+        bdlb::BigEndianInt32 nboValue;
+        if (readValue(reinterpret_cast<char*>(&nboValue),
+                      index,
+                      sizeof(nboValue)) == 0) {
+            return bdld::Datum::createInteger(
+                static_cast<int>(nboValue));  // RETURN
+        }
+    } break;
+    case bmqt::PropertyType::e_INT64: {
+        bdlb::BigEndianInt64 nboValue;
+        if (readValue(reinterpret_cast<char*>(&nboValue),
+                      index,
+                      sizeof(nboValue)) == 0) {
+            return bdld::Datum::createInteger64(
+                static_cast<bsls::Types::Int64>(nboValue),
+                basicAllocator);  // RETURN
+        }
+    } break;
+    case bmqt::PropertyType::e_STRING: {
+        const int          valueOffset = property.d_nameOffset +
+                                property.d_nameLength;
+        mwcu::BlobPosition position;
+        if (0 != mwcu::BlobUtil::findOffsetSafe(&position,
+                                                *d_blob_p,
+                                                valueOffset)) {
+            break;  // BREAK
+        }
+
+        const int length = property.d_valueLength;
+        if (length == 0) {
+            return bdld::Datum::createStringRef("", 0, basicAllocator);
+            // RETURN
+        }
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                position.byte() + length <=
+                mwcu::BlobUtil::bufferSize(*d_blob_p, position.buffer()))) {
+            // The value is contiguous: refer to it.
+            return bdld::Datum::createStringRef(
+                d_blob_p->buffer(position.buffer()).data() + position.byte(),
+                length,
+                basicAllocator);  // RETURN
+        }
+
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // The value spans multiple buffers: copy it.
+        char*             buffer;
+        const bdld::Datum result = bdld::Datum::createUninitializedString(
+            &buffer,
+            length,
+            basicAllocator);
+        if (0 == mwcu::BlobUtil::readNBytes(buffer,
+                                            *d_blob_p,
+                                            position,
+                                            length)) {
+            return result;  // RETURN
+        }
+        bdld::Datum::destroy(result, basicAllocator);
+    } break;
+    case bmqt::PropertyType::e_BINARY:
+        // do not want to use binary
+        return bdld::Datum::createError(-2);  // RETURN
+    case bmqt::PropertyType::e_UNDEFINED:
+    default: break;
+    }
+
+    return bdld::Datum::createError(-3);
+}
+
+bool MessagePropertiesView::isNamed(int                      index,
+                                    const bslstl::StringRef& name) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= index && index < numProperties());
+
+    const Property& property   = d_properties[index];
+    const int       nameLength = static_cast<int>(name.length());
+    if (property.d_nameLength != nameLength) {
+        return false;  // RETURN
+    }
+
+    mwcu::BlobPosition position;
+    int                result = 0;
+    return 0 == mwcu::BlobUtil::findOffsetSafe(&position,
+                                               *d_blob_p,
+                                               property.d_nameOffset) &&
+           0 == mwcu::BlobUtil::compareSection(&result,
+                                               *d_blob_p,
+                                               position,
+                                               name.data(),
+                                               nameLength) &&
+           0 == result;
+}
+
+int MessagePropertiesView::lookup(int*                     index,
+                                  const bslstl::StringRef& name,
+                                  bmqt::PropertyType::Enum type) const
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS       = 0,
+        rc_NOT_FOUND     = -1,
+        rc_TYPE_MISMATCH = -2
+    };
+
+    *index = findProperty(name);
+    if (*index < 0) {
+        return rc_NOT_FOUND;  // RETURN
+    }
+
+    if (d_properties[*index].d_type != type) {
+        return rc_TYPE_MISMATCH;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+// CREATORS
+MessagePropertiesView::MessagePropertiesView(bslma::Allocator* basicAllocator)
+: d_blob_p(0)
+, d_properties(basicAllocator)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+int MessagePropertiesView::reset(const bdlbb::Blob& blob,
+                                 bool               isNewStyleProperties)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS                          = 0,
+        rc_NO_MSG_PROPERTIES_HEADER         = -1,
+        rc_INCOMPLETE_MSG_PROPERTIES_HEADER = -2,
+        rc_INCORRECT_LENGTH                 = -3,
+        rc_INVALID_MPH_SIZE                 = -4,
+        rc_INVALID_NUM_PROPERTIES           = -5,
+        rc_INCOMPLETE_MSG_PROPERTY_HEADER   = -6,
+        rc_INVALID_PROPERTY_TYPE            = -7,
+        rc_INVALID_PROPERTY_NAME_LENGTH     = -8,
+        rc_INVALID_PROPERTY_VALUE_LENGTH    = -9
+    };
+
+    clear();
+
+    if (0 == blob.length()) {
+        // No message properties.
+        d_blob_p = &blob;
+        return rc_SUCCESS;  // RETURN
+    }
+
+    // Read 'MessagePropertiesHeader'.
+    mwcu::BlobObjectProxy<MessagePropertiesHeader> msgPropsHeader(
+        &blob,
+        -MessagePropertiesHeader::k_MIN_HEADER_SIZE,
+        true,    // read flag
+        false);  // write flag
+    if (!msgPropsHeader.isSet()) {
+        return rc_NO_MSG_PROPERTIES_HEADER;  // RETURN
+    }
+
+    msgPropsHeader.resize(msgPropsHeader->headerSize());
+    if (!msgPropsHeader.isSet()) {
+        return rc_INCOMPLETE_MSG_PROPERTIES_HEADER;  // RETURN
+    }
+
+    const int msgPropsAreaSize = msgPropsHeader->messagePropertiesAreaWords() *
+                                 Protocol::k_WORD_SIZE;
+    if (msgPropsAreaSize > blob.length()) {
+        return rc_INCORRECT_LENGTH;  // RETURN
+    }
+
+    const int mphSize    = msgPropsHeader->messagePropertyHeaderSize();
+    const int numProps   = msgPropsHeader->numProperties();
+    const int dataOffset = msgPropsHeader->headerSize() + numProps * mphSize;
+    if (0 >= mphSize) {
+        return rc_INVALID_MPH_SIZE;  // RETURN
+    }
+
+    if (0 >= numProps ||
+        MessageProperties::k_MAX_NUM_PROPERTIES < numProps) {
+        return rc_INVALID_NUM_PROPERTIES;  // RETURN
+    }
+
+    // Length of the properties area, excluding the word-aligned padding.
+    const int totalSize = ProtocolUtil::calcUnpaddedLength(blob,
+                                                           msgPropsAreaSize);
+    if (totalSize > blob.length() || totalSize < dataOffset) {
+        return rc_INCORRECT_LENGTH;  // RETURN
+    }
+
+    mwcu::BlobPosition position;
+    if (mwcu::BlobUtil::findOffsetSafe(&position,
+                                       blob,
+                                       msgPropsHeader->headerSize())) {
+        return rc_INCOMPLETE_MSG_PROPERTY_HEADER;  // RETURN
+    }
+
+    d_properties.resize(numProps);
+
+    // Offset of the name of the next property, for the old style.
+    int offset = dataOffset;
+
+    for (int i = 0; i < numProps; ++i) {
+        // Note that we use the size specified in 'MessagePropertiesHeader',
+        // not sizeof(MessagePropertyHeader).
+        mwcu::BlobObjectProxy<MessagePropertyHeader> mpHeader(
+            &blob,
+            position,
+            mphSize,
+            true,    // read flag
+            false);  // write flag
+        if (!mpHeader.isSet()) {
+            clear();
+            return rc_INCOMPLETE_MSG_PROPERTY_HEADER;  // RETURN
+        }
+
+        Property& property = d_properties[i];
+        property.d_type    = static_cast<bmqt::PropertyType::Enum>(
+            mpHeader->propertyType());
+        property.d_nameLength = mpHeader->propertyNameLength();
+
+        if (bmqt::PropertyType::e_BOOL > property.d_type ||
+            bmqt::PropertyType::e_BINARY < property.d_type) {
+            clear();
+            return rc_INVALID_PROPERTY_TYPE;  // RETURN
+        }
+
+        if (MessageProperties::k_MAX_PROPERTY_NAME_LENGTH <
+            property.d_nameLength) {
+            clear();
+            return rc_INVALID_PROPERTY_NAME_LENGTH;  // RETURN
+        }
+
+        if (isNewStyleProperties) {
+            // New style: each header carries the offset of the name, and the
+            // length of a value is the delta between two offsets.
+            property.d_nameOffset = dataOffset +
+                                    mpHeader->propertyValueLength();
+            if (i == 0) {
+                if (property.d_nameOffset != dataOffset) {
+                    // The first property's offset must be '0'.
+                    clear();
+                    return rc_INVALID_PROPERTY_VALUE_LENGTH;  // RETURN
+                }
+            }
+            else {
+                Property& previous     = d_properties[i - 1];
+                previous.d_valueLength = property.d_nameOffset -
+                                         previous.d_nameOffset -
+                                         previous.d_nameLength;
+            }
+        }
+        else {
+            // Old style: each header carries the length of the value, and the
+            // (name, value) pairs follow each other.
+            property.d_nameOffset  = offset;
+            property.d_valueLength = mpHeader->propertyValueLength();
+            offset += property.d_nameLength + property.d_valueLength;
+        }
+
+        if (i + 1 < numProps &&
+            mwcu::BlobUtil::findOffsetSafe(&position,
+                                           blob,
+                                           position,
+                                           mphSize)) {
+            clear();
+            return rc_INCOMPLETE_MSG_PROPERTY_HEADER;  // RETURN
+        }
+    }
+
+    Property& last = d_properties.back();
+    if (isNewStyleProperties) {
+        last.d_valueLength = totalSize - last.d_nameOffset - last.d_nameLength;
+    }
+    else if (offset != totalSize) {
+        clear();
+        return rc_INCORRECT_LENGTH;  // RETURN
+    }
+
+    for (int i = 0; i < numProps; ++i) {
+        const Property& property = d_properties[i];
+        if (!isValidValueLength(property.d_valueLength, property.d_type)) {
+            clear();
+            return rc_INVALID_PROPERTY_VALUE_LENGTH;  // RETURN
+        }
+    }
+
+    d_blob_p = &blob;
+
+    return rc_SUCCESS;
+}
+
+// ACCESSORS
+int MessagePropertiesView::findProperty(const bslstl::StringRef& name) const
+{
+    for (int i = 0; i < numProperties(); ++i) {
+        if (isNamed(i, name)) {
+            return i;  // RETURN
+        }
+    }
+
+    return -1;
+}
+
+int MessagePropertiesView::findProperty(const bslstl::StringRef& name,
+                                        int                      hint) const
+{
+    if (0 <= hint && hint < numProperties() && isNamed(hint, name)) {
+        // Note that, if multiple properties have the same name, a schema
+        // hints at the first one.
+        return hint;  // RETURN
+    }
+
+    return findProperty(name);
+}
+
+bool MessagePropertiesView::hasProperty(const bslstl::StringRef&  name,
+                                        bmqt::PropertyType::Enum* type) const
+{
+    const int index = findProperty(name);
+    if (index < 0) {
+        return false;  // RETURN
+    }
+
+    if (type) {
+        *type = d_properties[index].d_type;
+    }
+
+    return true;
+}
+
+void MessagePropertiesView::loadPropertyName(bsl::string* name,
+                                             int          index) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(name);
+    BSLS_ASSERT_SAFE(0 <= index && index < numProperties());
+
+    const Property& property = d_properties[index];
+    name->assign(property.d_nameLength, ' ');
+    if (0 == property.d_nameLength) {
+        return;  // RETURN
+    }
+
+    mwcu::BlobPosition position;
+    int                rc = mwcu::BlobUtil::findOffsetSafe(&position,
+                                            *d_blob_p,
+                                            property.d_nameOffset);
+    BSLS_ASSERT_SAFE(rc == 0);
+    // Offsets have been validated by 'reset'.
+
+    rc = mwcu::BlobUtil::readNBytes(&(*name)[0],
+                                    *d_blob_p,
+                                    position,
+                                    property.d_nameLength);
+    BSLS_ASSERT_SAFE(rc == 0);
+    (void)rc;  // compiler happiness
+}
+
+int MessagePropertiesView::loadPropertyAsBool(
+    bool*                    value,
+    const bslstl::StringRef& name) const
+{
+    int index;
+    int rc = lookup(&index, name, bmqt::PropertyType::e_BOOL);
+    if (rc != 0) {
+        return rc;  // RETURN
+    }
+
+    char ch;
+    rc = readValue(&ch, index, sizeof(ch));
+    if (rc == 0) {
+        *value = ch == 1;
+    }
+
+    return rc;
+}
+
+int MessagePropertiesView::loadPropertyAsChar(
+    char*                    value,
+    const bslstl::StringRef& name) const
+{
+    int index;
+    int rc = lookup(&index, name, bmqt::PropertyType::e_CHAR);
+    if (rc == 0) {
+        rc = readValue(value, index, sizeof(*value));
+    }
+
+    return rc;
+}
+
+int MessagePropertiesView::loadPropertyAsShort(
+    short*                   value,
+    const bslstl::StringRef& name) const
+{
+    int index;
+    int rc = lookup(&index, name, bmqt::PropertyType::e_SHORT);
+    if (rc != 0) {
+        return rc;  // RETURN
+    }
+
+    bdlb::BigEndianInt16 nboValue;
+    rc = readValue(reinterpret_cast<char*>(&nboValue),
+                   index,
+                   sizeof(nboValue));
+    if (rc == 0) {
+        *value = static_cast<short>(nboValue);
+    }
+
+    return rc;
+}
+
+int MessagePropertiesView::loadPropertyAsInt32(
+    int*                     value,
+    const bslstl::StringRef& name) const
+{
+    int index;
+    int rc = lookup(&index, name, bmqt::PropertyType::e_INT32);
+    if (rc != 0) {
+        return rc;  // RETURN
+    }
+
+    bdlb::BigEndianInt32 nboValue;
+    rc = readValue(reinterpret_cast<char*>(&nboValue),
+                   index,
+                   sizeof(nboValue));
+    if (rc == 0) {
+        *value = static_cast<int>(nboValue);
+    }
+
+    return rc;
+}
+
+int MessagePropertiesView::loadPropertyAsInt64(
+    bsls::Types::Int64*      value,
+    const bslstl::StringRef& name) const
+{
+    int index;
+    int rc = lookup(&index, name, bmqt::PropertyType::e_INT64);
+    if (rc != 0) {
+        return rc;  // RETURN
+    }
+
+    bdlb::BigEndianInt64 nboValue;
+    rc = readValue(reinterpret_cast<char*>(&nboValue),
+                   index,
+                   sizeof(nboValue));
+    if (rc == 0) {
+        *value = static_cast<bsls::Types::Int64>(nboValue);
+    }
+
+    return rc;
+}
+
+int MessagePropertiesView::loadPropertyAsString(
+    bsl::string*             value,
+    const bslstl::StringRef& name) const
+{
+    int index;
+    int rc = lookup(&index, name, bmqt::PropertyType::e_STRING);
+    if (rc != 0) {
+        return rc;  // RETURN
+    }
+
+    const int   length = d_properties[index].d_valueLength;
+    bsl::string result(length, ' ', value->get_allocator());
+    if (length != 0 && (rc = readValue(&result[0], index, length)) != 0) {
+        return rc;  // RETURN
+    }
+
+    value->swap(result);
+    return 0;
+}
+
+int MessagePropertiesView::loadPropertyAsBinary(
+    bsl::vector<char>*       value,
+    const bslstl::StringRef& name) const
+{
+    int index;
+    int rc = lookup(&index, name, bmqt::PropertyType::e_BINARY);
+    if (rc != 0) {
+        return rc;  // RETURN
+    }
+
+    const int         length = d_properties[index].d_valueLength;
+    bsl::vector<char> result(length, value->get_allocator());
+    if (length != 0 && (rc = readValue(&result[0], index, length)) != 0) {
+        return rc;  // RETURN
+    }
+
+    value->swap(result);
+    return 0;
+}
+
+bdld::Datum
+MessagePropertiesView::getPropertyRef(const bslstl::StringRef& name,
+                                      bslma::Allocator* basicAllocator) const
+{
+    return getPropertyRef(name, -1, basicAllocator);
+}
+
+bdld::Datum
+MessagePropertiesView::getPropertyRef(const bslstl::StringRef& name,
+                                      int                      hint,
+                                      bslma::Allocator* basicAllocator) const
+{
+    const int index = findProperty(name, hint);
+    if (index < 0) {
+        return bdld::Datum::createError(-1);  // RETURN
+    }
+
+    return getPropertyRefAt(index, basicAllocator);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,281 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqp_messagepropertiesview.h                                       -*-C++-*-
+#ifndef INCLUDED_BMQP_MESSAGEPROPERTIESVIEW
+#define INCLUDED_BMQP_MESSAGEPROPERTIESVIEW
+
+//@PURPOSE: Provide a read-only view over encoded message properties.
+//
+//@CLASSES:
+//  bmqp::MessagePropertiesView: lazy view over encoded message properties.
+//
+//@SEE_ALSO: bmqp_messageproperties
+//
+//@DESCRIPTION: 'bmqp::MessagePropertiesView' is a mechanism providing
+// read-only access to message properties in their BlazingMQ wire protocol
+// representation (see 'bmqp::MessagePropertiesHeader'), without decoding them
+// into a 'bmqp::MessageProperties' object.  When associated with a blob, the
+// view validates and indexes the array of 'MessagePropertyHeader' in place,
+// and only decodes the names and values of the properties which are asked
+// for.  This is much cheaper than 'bmqp::MessageProperties::streamIn' when
+// only a few properties are read, such as when evaluating subscription
+// expressions.  Note that both the old (lengths) and the new (offsets)
+// style of encoding are supported, and that no schema is needed.
+//
+// The view does not copy the blob it is associated with: the behavior is
+// undefined if that blob is modified or destroyed while the view refers to
+// it.  Also note that, once its internal index has grown to the number of
+// properties of a message, resetting a view to another message does not
+// allocate memory.
+//
+// If multiple properties have the same name, the first one is found.
+//
+// Looking a property up by name compares it with the names of the properties
+// preceding it.  When the index of a property is likely known, e.g. from a
+// schema learned from a previous message (see 'bmqp::SchemaLearner::learn'),
+// it can be supplied as a hint: the property at that index is checked first,
+// and the others only if it does not have the expected name.
+//
+/// Thread Safety
+///-------------
+// NOT thread safe.
+//
+/// Usage
+///-----
+//..
+//  bmqp::MessagePropertiesView view(allocator);
+//
+//  int rc = view.reset(propertiesBlob, info.isExtended());
+//  if (rc != 0) {
+//      // Invalid properties ...
+//  }
+//
+//  int value;
+//  if (view.loadPropertyAsInt32(&value, "myInt") == 0) {
+//      // Use 'value' ...
+//  }
+//
+//  int hint;
+//  if (schema && schema->loadIndex(&hint, "myString")) {
+//      bdld::Datum datum = view.getPropertyRef("myString", hint, allocator);
+//      // Use 'datum' ...
+//  }
+//..
+
+// BMQ
+#include <bmqt_propertytype.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bdld_datum.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_types.h>
+#include <bslstl_stringref.h>
+
+namespace BloombergLP {
+
+namespace bmqp {
+
+// ===========================
+// class MessagePropertiesView
+// ===========================
+
+/// Read-only view over message properties in their wire representation.
+class MessagePropertiesView {
+  private:
+    // PRIVATE TYPES
+
+    /// Location and type of one property in the viewed blob.
+    struct Property {
+        int d_nameOffset;
+        // Offset of the name (which is directly followed
+        // by the value) from the beginning of the blob.
+
+        int d_nameLength;
+
+        int d_valueLength;
+
+        bmqt::PropertyType::Enum d_type;
+    };
+
+    typedef bsl::vector<Property> Properties;
+
+  private:
+    // DATA
+    const bdlbb::Blob* d_blob_p;  // viewed blob, if any
+
+    Properties d_properties;  // index of the properties
+
+  private:
+    // NOT IMPLEMENTED
+    MessagePropertiesView(const MessagePropertiesView&);
+    MessagePropertiesView& operator=(const MessagePropertiesView&);
+
+  private:
+    // PRIVATE ACCESSORS
+
+    /// Load into the specified `buffer` the `length` bytes of the value of
+    /// the property at the specified `index`.  Return 0 on success, and
+    /// non-zero otherwise.
+    int readValue(char* buffer, int index, int length) const;
+
+    /// Return the value of the property at the specified `index`, as
+    /// described in `getPropertyRef`.  The behavior is undefined unless
+    /// `0 <= index < numProperties()`.
+    bdld::Datum getPropertyRefAt(int               index,
+                                 bslma::Allocator* basicAllocator) const;
+
+    /// Return true if the property at the specified `index` has the
+    /// specified `name`, and false otherwise.  The behavior is undefined
+    /// unless `0 <= index < numProperties()`.
+    bool isNamed(int index, const bslstl::StringRef& name) const;
+
+    /// Load into the specified `index` the index of the property having the
+    /// specified `name` and `type`.  Return 0 on success, and non-zero if
+    /// there is no such property, or if it has a different type.
+    int lookup(int*                     index,
+               const bslstl::StringRef& name,
+               bmqt::PropertyType::Enum type) const;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(MessagePropertiesView,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty view, not referring to any blob.  Optionally
+    /// specify a `basicAllocator` used to supply memory.
+    explicit MessagePropertiesView(bslma::Allocator* basicAllocator = 0);
+
+    // MANIPULATORS
+
+    /// Associate this view with the message properties in their wire
+    /// representation at the beginning of the specified `blob`, using the
+    /// specified `isNewStyleProperties` as an indicator of encoding style
+    /// (offsets instead of lengths in each `MessagePropertyHeader`).
+    /// Return 0 on success, and a non-zero value otherwise, in which case
+    /// this view is empty.  Note that an empty `blob` is a valid
+    /// representation of no properties, and that `blob` may contain data
+    /// (e.g., the message payload) after the properties.
+    int reset(const bdlbb::Blob& blob, bool isNewStyleProperties);
+
+    /// Make this view empty, not referring to any blob.
+    void clear();
+
+    // ACCESSORS
+
+    /// Return the number of properties in this view.
+    int numProperties() const;
+
+    /// Return the index, in the range `[0 .. numProperties() - 1]`, of the
+    /// property having the specified `name`, or -1 if there is no such
+    /// property.
+    int findProperty(const bslstl::StringRef& name) const;
+
+    /// Return the index of the property having the specified `name`, as
+    /// `findProperty(name)` does, checking first the property at the
+    /// specified `hint` index, if it is in the range
+    /// `[0 .. numProperties() - 1]`.  Note that the result is the same
+    /// whatever the `hint`, only the cost of the lookup depends on it.
+    int findProperty(const bslstl::StringRef& name, int hint) const;
+
+    /// Return true if a property with the specified `name` exists and load
+    /// into the optionally specified `type` the type of the property.
+    /// Return false otherwise.
+    bool hasProperty(const bslstl::StringRef&  name,
+                     bmqt::PropertyType::Enum* type = 0) const;
+
+    /// Return the type of the property at the specified `index`.  The
+    /// behavior is undefined unless `0 <= index < numProperties()`.
+    bmqt::PropertyType::Enum propertyType(int index) const;
+
+    /// Load into the specified `name` the name of the property at the
+    /// specified `index`.  The behavior is undefined unless
+    /// `0 <= index < numProperties()`.
+    void loadPropertyName(bsl::string* name, int index) const;
+
+    int loadPropertyAsBool(bool* value, const bslstl::StringRef& name) const;
+    int loadPropertyAsChar(char* value, const bslstl::StringRef& name) const;
+    int loadPropertyAsShort(short*                   value,
+                            const bslstl::StringRef& name) const;
+    int loadPropertyAsInt32(int* value, const bslstl::StringRef& name) const;
+    int loadPropertyAsInt64(bsls::Types::Int64*      value,
+                            const bslstl::StringRef& name) const;
+    int loadPropertyAsString(bsl::string*             value,
+                             const bslstl::StringRef& name) const;
+
+    /// Load into the specified `value` the value of the property having the
+    /// specified `name` and the corresponding type.  Return 0 on success,
+    /// and a non-zero value if there is no such property, or if it has a
+    /// different type, in which case `value` is unchanged.
+    int loadPropertyAsBinary(bsl::vector<char>*       value,
+                             const bslstl::StringRef& name) const;
+
+    /// Return a `bdld::Datum` holding the value of the property having the
+    /// specified `name`, using the specified `basicAllocator` to supply
+    /// memory, if needed.  Return `bdld::Datum::createError` if there is no
+    /// such property, or if it is of the binary type.  Note that a string
+    /// value held in a single buffer of the viewed blob is referred to, and
+    /// not copied: the behavior is undefined if the returned datum is
+    /// accessed after the viewed blob is modified or destroyed.
+    bdld::Datum getPropertyRef(const bslstl::StringRef& name,
+                               bslma::Allocator*        basicAllocator) const;
+
+    /// Return a `bdld::Datum` holding the value of the property having the
+    /// specified `name`, as `getPropertyRef(name, basicAllocator)` does,
+    /// checking first the property at the specified `hint` index (see
+    /// `findProperty`).
+    bdld::Datum getPropertyRef(const bslstl::StringRef& name,
+                               int                      hint,
+                               bslma::Allocator*        basicAllocator) const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ---------------------------
+// class MessagePropertiesView
+// ---------------------------
+
+// MANIPULATORS
+inline void MessagePropertiesView::clear()
+{
+    d_blob_p = 0;
+    d_properties.clear();
+}
+
+// ACCESSORS
+inline int MessagePropertiesView::numProperties() const
+{
+    return static_cast<int>(d_properties.size());
+}
+
+inline bmqt::PropertyType::Enum
+MessagePropertiesView::propertyType(int index) const
+{
+    return d_properties[index].d_type;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
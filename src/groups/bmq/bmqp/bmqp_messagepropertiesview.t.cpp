@@ -0,0 +1,473 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqp_messagepropertiesview.t.cpp                                   -*-C++-*-
+#include <bmqp_messagepropertiesview.h>
+
+// BMQ
+#include <bmqp_messageproperties.h>
+#include <bmqp_protocol.h>
+#include <bmqp_protocolutil.h>
+#include <bmqt_compressionalgorithmtype.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bdld_datum.h>
+#include <bdlma_localsequentialallocator.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// Populate the specified `properties` with one property of each type.
+void populateProperties(bmqp::MessageProperties* properties)
+{
+    const bsl::vector<char> binary(300, 'B', s_allocator_p);
+
+    ASSERT_EQ(0, properties->setPropertyAsBool("bool", true));
+    ASSERT_EQ(0, properties->setPropertyAsChar("char", 'Q'));
+    ASSERT_EQ(0, properties->setPropertyAsShort("short", -17));
+    ASSERT_EQ(0, properties->setPropertyAsInt32("int32", 123456));
+    ASSERT_EQ(0, properties->setPropertyAsInt64("int64", 123456789012LL));
+    ASSERT_EQ(0, properties->setPropertyAsString("string", "value"));
+    ASSERT_EQ(0, properties->setPropertyAsString("empty", ""));
+    ASSERT_EQ(0, properties->setPropertyAsBinary("binary", binary));
+}
+
+/// Verify that the specified `view` exposes the properties populated by
+/// `populateProperties`.
+void verifyProperties(const bmqp::MessagePropertiesView& view)
+{
+    ASSERT_EQ(8, view.numProperties());
+
+    bool               boolValue  = false;
+    char               charValue  = 0;
+    short              shortValue = 0;
+    int                int32Value = 0;
+    bsls::Types::Int64 int64Value = 0;
+    bsl::string        stringValue(s_allocator_p);
+    bsl::vector<char>  binaryValue(s_allocator_p);
+
+    ASSERT_EQ(0, view.loadPropertyAsBool(&boolValue, "bool"));
+    ASSERT_EQ(true, boolValue);
+    ASSERT_EQ(0, view.loadPropertyAsChar(&charValue, "char"));
+    ASSERT_EQ('Q', charValue);
+    ASSERT_EQ(0, view.loadPropertyAsShort(&shortValue, "short"));
+    ASSERT_EQ(-17, shortValue);
+    ASSERT_EQ(0, view.loadPropertyAsInt32(&int32Value, "int32"));
+    ASSERT_EQ(123456, int32Value);
+    ASSERT_EQ(0, view.loadPropertyAsInt64(&int64Value, "int64"));
+    ASSERT_EQ(123456789012LL, int64Value);
+    ASSERT_EQ(0, view.loadPropertyAsString(&stringValue, "string"));
+    ASSERT_EQ("value", stringValue);
+    ASSERT_EQ(0, view.loadPropertyAsString(&stringValue, "empty"));
+    ASSERT_EQ("", stringValue);
+    ASSERT_EQ(0, view.loadPropertyAsBinary(&binaryValue, "binary"));
+    ASSERT_EQ(bsl::vector<char>(300, 'B', s_allocator_p), binaryValue);
+
+    bmqt::PropertyType::Enum type = bmqt::PropertyType::e_UNDEFINED;
+    ASSERT(view.hasProperty("int64", &type));
+    ASSERT_EQ(bmqt::PropertyType::e_INT64, type);
+    ASSERT(!view.hasProperty("none"));
+    ASSERT(!view.hasProperty("int6"));
+
+    for (int i = 0; i < view.numProperties(); ++i) {
+        bsl::string name(s_allocator_p);
+        view.loadPropertyName(&name, i);
+        ASSERT_EQ_D(name, i, view.findProperty(name));
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise the basic functionality of the component.
+//
+// Testing:
+//   Basic functionality
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(128, s_allocator_p);
+    bmqp::MessageProperties        properties(s_allocator_p);
+    bmqp::MessagePropertiesView    view(s_allocator_p);
+
+    // Empty view
+    ASSERT_EQ(0, view.numProperties());
+    ASSERT_EQ(-1, view.findProperty("none"));
+
+    // One property
+    ASSERT_EQ(0, properties.setPropertyAsInt32("answer", 42));
+
+    const bdlbb::Blob& wireRep = properties.streamOut(
+        &bufferFactory,
+        bmqp::MessagePropertiesInfo::makeInvalidSchema());
+
+    ASSERT_EQ(0, view.reset(wireRep, true));
+    ASSERT_EQ(1, view.numProperties());
+    ASSERT_EQ(0, view.findProperty("answer"));
+    ASSERT_EQ(bmqt::PropertyType::e_INT32, view.propertyType(0));
+
+    int value = 0;
+    ASSERT_EQ(0, view.loadPropertyAsInt32(&value, "answer"));
+    ASSERT_EQ(42, value);
+
+    view.clear();
+    ASSERT_EQ(0, view.numProperties());
+    ASSERT_EQ(-1, view.findProperty("answer"));
+}
+
+static void test2_newStyleTest()
+// ------------------------------------------------------------------------
+// NEW STYLE TEST
+//
+// Concerns:
+//   1. All types of properties encoded in the new style (offsets) can be
+//      read, including properties spanning multiple blob buffers.
+//
+// Plan:
+//   1. Encode properties of each type using 'bmqp::MessageProperties',
+//      with a small buffer size, and read them through the view.
+//
+// Testing:
+//   reset
+//   loadPropertyAs*
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("NEW STYLE TEST");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(32, s_allocator_p);
+    bmqp::MessageProperties        properties(s_allocator_p);
+    bmqp::MessagePropertiesView    view(s_allocator_p);
+
+    populateProperties(&properties);
+
+    const bdlbb::Blob& wireRep = properties.streamOut(
+        &bufferFactory,
+        bmqp::MessagePropertiesInfo::makeInvalidSchema());
+
+    ASSERT_EQ(0, view.reset(wireRep, true));
+    verifyProperties(view);
+}
+
+static void test3_oldStyleTest()
+// ------------------------------------------------------------------------
+// OLD STYLE TEST
+//
+// Concerns:
+//   1. All types of properties encoded in the old style (lengths) can be
+//      read.
+//
+// Plan:
+//   1. Encode properties of each type using 'bmqp::MessageProperties',
+//      convert them to the old style, and read them through the view.
+//
+// Testing:
+//   reset
+//   loadPropertyAs*
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("OLD STYLE TEST");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(32, s_allocator_p);
+    bdlbb::Blob                    oldWireRep(&bufferFactory, s_allocator_p);
+    bmqp::MessageProperties        properties(s_allocator_p);
+    bmqp::MessagePropertiesView    view(s_allocator_p);
+
+    populateProperties(&properties);
+
+    const bdlbb::Blob& wireRep = properties.streamOut(
+        &bufferFactory,
+        bmqp::MessagePropertiesInfo::makeInvalidSchema());
+
+    ASSERT_EQ(0,
+              bmqp::ProtocolUtil::convertToOld(
+                  &oldWireRep,
+                  &wireRep,
+                  bmqt::CompressionAlgorithmType::e_NONE,
+                  &bufferFactory,
+                  s_allocator_p));
+
+    ASSERT_EQ(0, view.reset(oldWireRep, false));
+    verifyProperties(view);
+
+    // Data following the properties (e.g., the payload) is ignored.
+    bdlbb::BlobUtil::append(&oldWireRep, "payload", 7);
+
+    ASSERT_EQ(0, view.reset(oldWireRep, false));
+    verifyProperties(view);
+}
+
+static void test4_typeMismatchTest()
+// ------------------------------------------------------------------------
+// TYPE MISMATCH TEST
+//
+// Concerns:
+//   1. Loading a property as a type other than its own, or loading a
+//      missing property, fails and leaves the output unchanged.
+//
+// Testing:
+//   loadPropertyAs*
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("TYPE MISMATCH TEST");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(128, s_allocator_p);
+    bmqp::MessageProperties        properties(s_allocator_p);
+    bmqp::MessagePropertiesView    view(s_allocator_p);
+
+    populateProperties(&properties);
+
+    const bdlbb::Blob& wireRep = properties.streamOut(
+        &bufferFactory,
+        bmqp::MessagePropertiesInfo::makeInvalidSchema());
+
+    ASSERT_EQ(0, view.reset(wireRep, true));
+
+    int         int32Value = 7;
+    bsl::string stringValue("unchanged", s_allocator_p);
+
+    ASSERT_EQ(-2, view.loadPropertyAsInt32(&int32Value, "int64"));
+    ASSERT_EQ(7, int32Value);
+    ASSERT_EQ(-1, view.loadPropertyAsInt32(&int32Value, "none"));
+    ASSERT_EQ(7, int32Value);
+    ASSERT_EQ(-2, view.loadPropertyAsString(&stringValue, "binary"));
+    ASSERT_EQ("unchanged", stringValue);
+}
+
+static void test5_getPropertyRefTest()
+// ------------------------------------------------------------------------
+// GET PROPERTY REF TEST
+//
+// Concerns:
+//   1. 'getPropertyRef' returns the same values as
+//      'bmqp::MessageProperties::getPropertyRef'.
+//
+// Testing:
+//   getPropertyRef
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("GET PROPERTY REF TEST");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(32, s_allocator_p);
+    bmqp::MessageProperties        properties(s_allocator_p);
+    bmqp::MessagePropertiesView    view(s_allocator_p);
+
+    populateProperties(&properties);
+    ASSERT_EQ(0,
+              properties.setPropertyAsString("long",
+                                             bsl::string(100,
+                                                         'L',
+                                                         s_allocator_p)));
+
+    const bdlbb::Blob& wireRep = properties.streamOut(
+        &bufferFactory,
+        bmqp::MessagePropertiesInfo::makeInvalidSchema());
+
+    ASSERT_EQ(0, view.reset(wireRep, true));
+
+    bdlma::LocalSequentialAllocator<1024> arena(s_allocator_p);
+
+    const char* names[] = {
+        "bool", "char", "short", "int32", "int64", "string", "empty", "long"};
+
+    for (size_t i = 0; i < sizeof(names) / sizeof(*names); ++i) {
+        const bdld::Datum expected = properties.getPropertyRef(names[i],
+                                                               &arena);
+        const bdld::Datum actual   = view.getPropertyRef(names[i], &arena);
+
+        ASSERT_EQ_D(names[i], expected, actual);
+    }
+
+    ASSERT(view.getPropertyRef("binary", &arena).isError());
+    ASSERT(view.getPropertyRef("none", &arena).isError());
+}
+
+static void test6_invalidTest()
+// ------------------------------------------------------------------------
+// INVALID TEST
+//
+// Concerns:
+//   1. An empty blob is a valid representation of no properties.
+//   2. A truncated or corrupted blob is rejected, and leaves the view
+//      empty.
+//
+// Testing:
+//   reset
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("INVALID TEST");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(128, s_allocator_p);
+    bdlbb::Blob                    empty(&bufferFactory, s_allocator_p);
+    bmqp::MessageProperties        properties(s_allocator_p);
+    bmqp::MessagePropertiesView    view(s_allocator_p);
+
+    PV("Empty blob");
+    ASSERT_EQ(0, view.reset(empty, true));
+    ASSERT_EQ(0, view.numProperties());
+    ASSERT(!view.hasProperty("z"));
+
+    populateProperties(&properties);
+
+    const bdlbb::Blob& wireRep = properties.streamOut(
+        &bufferFactory,
+        bmqp::MessagePropertiesInfo::makeInvalidSchema());
+
+    PV("Truncated blob");
+    {
+        bdlbb::Blob truncated(wireRep, s_allocator_p);
+        bdlbb::BlobUtil::erase(&truncated,
+                               truncated.length() / 2,
+                               truncated.length() - truncated.length() / 2);
+
+        ASSERT_NE(0, view.reset(truncated, true));
+        ASSERT_EQ(0, view.numProperties());
+    }
+
+    PV("Blob shorter than the header");
+    {
+        bdlbb::Blob truncated(&bufferFactory, s_allocator_p);
+        bdlbb::BlobUtil::append(&truncated, wireRep, 0, 1);
+
+        ASSERT_NE(0, view.reset(truncated, true));
+        ASSERT_EQ(0, view.numProperties());
+    }
+
+    PV("Old style blob read as new style");
+    {
+        bdlbb::Blob oldWireRep(&bufferFactory, s_allocator_p);
+        ASSERT_EQ(0,
+                  bmqp::ProtocolUtil::convertToOld(
+                      &oldWireRep,
+                      &wireRep,
+                      bmqt::CompressionAlgorithmType::e_NONE,
+                      &bufferFactory,
+                      s_allocator_p));
+
+        ASSERT_NE(0, view.reset(oldWireRep, true));
+        ASSERT_EQ(0, view.numProperties());
+    }
+}
+
+static void test7_hintTest()
+// ------------------------------------------------------------------------
+// HINT TEST
+//
+// Concerns:
+//   1. Looking a property up with a hint returns the same index as without
+//      one, whether the hint is right, wrong, or out of range.
+//   2. A schema created from a view hints at the right indices.
+//
+// Testing:
+//   findProperty(name, hint)
+//   getPropertyRef(name, hint, allocator)
+//   MessageProperties_Schema(view, allocator)
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("HINT TEST");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(32, s_allocator_p);
+    bmqp::MessageProperties        properties(s_allocator_p);
+    bmqp::MessagePropertiesView    view(s_allocator_p);
+
+    populateProperties(&properties);
+
+    const bdlbb::Blob& wireRep = properties.streamOut(
+        &bufferFactory,
+        bmqp::MessagePropertiesInfo::makeInvalidSchema());
+
+    ASSERT_EQ(0, view.reset(wireRep, true));
+
+    const bmqp::MessageProperties::Schema schema(view, s_allocator_p);
+
+    bdlma::LocalSequentialAllocator<1024> arena(s_allocator_p);
+
+    for (int i = 0; i < view.numProperties(); ++i) {
+        bsl::string name(s_allocator_p);
+        view.loadPropertyName(&name, i);
+
+        int hint = -1;
+        ASSERT_D(name, schema.loadIndex(&hint, name));
+        ASSERT_EQ_D(name, i, hint);
+
+        ASSERT_EQ_D(name, i, view.findProperty(name, hint));
+        ASSERT_EQ_D(name, i, view.findProperty(name, -1));
+        ASSERT_EQ_D(name, i, view.findProperty(name, (i + 1) % 8));
+        ASSERT_EQ_D(name, i, view.findProperty(name, 100));
+
+        ASSERT_EQ_D(name,
+                    view.getPropertyRef(name, &arena),
+                    view.getPropertyRef(name, (i + 1) % 8, &arena));
+    }
+
+    int index = -1;
+    ASSERT(!schema.loadIndex(&index, "none"));
+    ASSERT_EQ(-1, view.findProperty("none", 0));
+    ASSERT(view.getPropertyRef("none", 0, &arena).isError());
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    bmqp::ProtocolUtil::initialize(s_allocator_p);
+
+    switch (_testCase) {
+    case 0:
+    case 7: test7_hintTest(); break;
+    case 6: test6_invalidTest(); break;
+    case 5: test5_getPropertyRefTest(); break;
+    case 4: test4_typeMismatchTest(); break;
+    case 3: test3_oldStyleTest(); break;
+    case 2: test2_newStyleTest(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    bmqp::ProtocolUtil::shutdown();
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_GBL_ALLOC);
+}
@@ -46,8 +46,10 @@ BSLMF_ASSERT(4 == bsls::AlignmentFromType<EventHeader>::VALUE);
 BSLMF_ASSERT(4 == bsls::AlignmentFromType<OptionHeader>::VALUE);
 BSLMF_ASSERT(4 == bsls::AlignmentFromType<PutHeader>::VALUE);
 BSLMF_ASSERT(4 == bsls::AlignmentFromType<AckMessage>::VALUE);
+BSLMF_ASSERT(4 == bsls::AlignmentFromType<AckMessageRange>::VALUE);
 BSLMF_ASSERT(4 == bsls::AlignmentFromType<PushHeader>::VALUE);
 BSLMF_ASSERT(4 == bsls::AlignmentFromType<ConfirmMessage>::VALUE);
+BSLMF_ASSERT(4 == bsls::AlignmentFromType<ConfirmMessageRange>::VALUE);
 BSLMF_ASSERT(4 == bsls::AlignmentFromType<RejectMessage>::VALUE);
 BSLMF_ASSERT(4 == bsls::AlignmentFromType<StorageHeader>::VALUE);
 BSLMF_ASSERT(4 == bsls::AlignmentFromType<RecoveryHeader>::VALUE);
@@ -273,6 +275,42 @@ const char MessagePropertiesFeatures::k_FIELD_NAME[] = "MPS";
 const char MessagePropertiesFeatures::k_MESSAGE_PROPERTIES_EX[] =
     "MESSAGE_PROPERTIES_EX";
 
+// --------------------------
+// struct CompressionFeatures
+// --------------------------
+
+const char CompressionFeatures::k_FIELD_NAME[] = "COMPRESSION";
+const char CompressionFeatures::k_LZ4[]        = "LZ4";
+const char CompressionFeatures::k_ZSTD[]       = "ZSTD";
+
+// ------------------
+// struct AckFeatures
+// ------------------
+
+const char AckFeatures::k_FIELD_NAME[] = "ACK";
+const char AckFeatures::k_RANGES[]     = "RANGES";
+
+// ----------------------
+// struct ConfirmFeatures
+// ----------------------
+
+const char ConfirmFeatures::k_FIELD_NAME[] = "CONFIRM";
+const char ConfirmFeatures::k_RANGES[]     = "RANGES";
+
+// ------------------
+// struct PutFeatures
+// ------------------
+
+const char PutFeatures::k_FIELD_NAME[] = "PUT";
+const char PutFeatures::k_COMPACT[]    = "COMPACT";
+
+// --------------------
+// struct QueueFeatures
+// --------------------
+
+const char QueueFeatures::k_FIELD_NAME[]          = "QUEUE";
+const char QueueFeatures::k_PIPELINED_CONFIGURE[] = "PIPELINED_CONFIGURE";
+
 // -----------------
 // struct OptionType
 // -----------------
@@ -336,6 +374,10 @@ const int EventHeaderUtil::k_CONTROL_EVENT_ENCODING_MASK =
     bdlb::BitMaskUtil::one(EventHeaderUtil::k_CONTROL_EVENT_ENCODING_START_IDX,
                            EventHeaderUtil::k_CONTROL_EVENT_ENCODING_NUM_BITS);
 
+const int EventHeaderUtil::k_PUT_EVENT_COMPACT_MASK =
+    bdlb::BitMaskUtil::one(EventHeaderUtil::k_PUT_EVENT_COMPACT_START_IDX,
+                           EventHeaderUtil::k_PUT_EVENT_COMPACT_NUM_BITS);
+
 // -------------------
 // struct OptionHeader
 // -------------------
@@ -551,6 +593,7 @@ const int AckHeader::k_PER_MSG_WORDS_MASK = bdlb::BitMaskUtil::one(
 // -----------------
 
 const int AckMessage::k_NULL_CORRELATION_ID;
+const int AckMessage::k_MAX_CORRELATION_ID;
 
 const int AckMessage::k_STATUS_MASK = bdlb::BitMaskUtil::one(
     AckMessage::k_STATUS_START_IDX,
@@ -720,6 +763,12 @@ const int ConfirmHeader::k_PER_MSG_WORDS_MASK = bdlb::BitMaskUtil::one(
     ConfirmHeader::k_PER_MSG_WORDS_START_IDX,
     ConfirmHeader::k_PER_MSG_WORDS_NUM_BITS);
 
+// --------------------------
+// struct ConfirmMessageRange
+// --------------------------
+
+const int ConfirmMessageRange::k_MAX_COUNT;
+
 // -------------------
 // struct RejectHeader
 // -------------------
@@ -44,12 +44,21 @@
 //  bmqp::AckHeader      : Header for messages in ACK event packet.
 //  bmqp::AckHeaderFlags : Meanings of each bit in flags field of 'AckHeader'.
 //  bmqp::AckMessage     : Structure of an ack msg (AckHeader payload).
+//  bmqp::AckMessageRange: Structure of a range of ack msgs (AckHeader payload
+//                         when 'AckHeaderFlags::e_RANGES' is set).
 //  bmqp::PushHeader     : Header for messages in PUSH event packet.
 //  bmqp::PushHeaderFlags: Meanings of each bit in flags field of 'PushHeader'.
 //  bmqp::PushHeaderFlagUtil
 //                       : Utility methods for 'bmqp::PushHeaderFlags'.
 //  bmqp::ConfirmHeader  : Header for messages in CONFIRM event packet.
+//  bmqp::ConfirmHeaderFlags
+//                       : Meanings of each bit in flags field of
+//                         'ConfirmHeader'.
 //  bmqp::ConfirmMessage : Structure of a confirm msg (ConfirmHeader payload).
+//  bmqp::ConfirmMessageRange
+//                       : Structure of a range of confirm msgs (ConfirmHeader
+//                         payload when 'ConfirmHeaderFlags::e_RANGES' is
+//                         set).
 //  bmqp::RejectHeader   : Header for messages in REJECT event packet.
 //  bmqp::RejectMessage  : Structure of a reject msg (RejectHeader payload).
 //  bmqp::StorageMessageType
@@ -384,6 +393,17 @@ struct Protocol {
     // will not be compressed regardless of the compression
     // algorithm type set to the PutEventBuilder.
 
+    static const int k_COMPRESSION_DICTIONARY_MIN_APPDATA_SIZE = 64;
+    // Same as 'k_COMPRESSION_MIN_APPDATA_SIZE', for PUT's
+    // message payload compressed as per ZSTD using a
+    // dictionary trained for the queue.
+
+    static const int k_ZERO_COPY_MIN_APPDATA_SIZE = 512;
+    // Threshold below which message application data is
+    // copied into the event being built, even by a builder
+    // in zero-copy mode, because referring to it would cost
+    // more than copying it.
+
     static const int k_CONSUMER_PRIORITY_INVALID;
     // Constant representing the invalid consumer priority
     // (e.g. of a non-consumer client).
@@ -643,6 +663,69 @@ struct MessagePropertiesFeatures {
     static const char k_MESSAGE_PROPERTIES_EX[];
 };
 
+/// This struct defines feature names related to the compression algorithms
+/// supported by a peer in addition to `ZLIB`.
+struct CompressionFeatures {
+    /// Field name of the compression features
+    static const char k_FIELD_NAME[];
+
+    // CONSTANTS
+    static const char k_LZ4[];
+
+    static const char k_ZSTD[];
+};
+
+/// This struct defines feature names related to the encoding of `ACK`
+/// events supported by a peer.
+struct AckFeatures {
+    /// Field name of the ACK features
+    static const char k_FIELD_NAME[];
+
+    // CONSTANTS
+
+    /// Support for `ACK` events made of `AckMessageRange`s.
+    static const char k_RANGES[];
+};
+
+/// This struct defines feature names related to the encoding of `CONFIRM`
+/// events supported by a peer.
+struct ConfirmFeatures {
+    /// Field name of the CONFIRM features
+    static const char k_FIELD_NAME[];
+
+    // CONSTANTS
+
+    /// Support for `CONFIRM` events made of `ConfirmMessageRange`s.
+    static const char k_RANGES[];
+};
+
+/// This struct defines feature names related to the encoding of `PUT`
+/// events supported by a peer.
+struct PutFeatures {
+    /// Field name of the PUT features
+    static const char k_FIELD_NAME[];
+
+    // CONSTANTS
+
+    /// Support for `PUT` events in the compact encoding (see
+    /// `bmqp::EventUtil::compactPutEvent`).
+    static const char k_COMPACT[];
+};
+
+/// This struct defines feature names related to the queue requests
+/// supported by a peer.
+struct QueueFeatures {
+    /// Field name of the queue features
+    static const char k_FIELD_NAME[];
+
+    // CONSTANTS
+
+    /// Support for a `configureQueue` request sent before the response to
+    /// the `openQueue` request of the queue, and processed once the queue
+    /// is opened.
+    static const char k_PIPELINED_CONFIGURE[];
+};
+
 // =================
 // struct OptionType
 // =================
@@ -752,6 +835,12 @@ struct EventHeader {
     //      +---------------+
     //      |CODEC| Reserved|
     //
+    //: o PutMessage: indicate whether the messages of the event are in the
+    //:   compact encoding (see 'bmqp::EventUtil::compactPutEvent')
+    //      |0|1|2|3|4|5|6|7|
+    //      +---------------+
+    //      |C|  Reserved   |
+    //
     // NOTE: The HeaderWords allows to eventually put event level options
     //       (either by extending the EventHeader struct, or putting new struct
     //       after the EventHeader).  For now, this is left up for future
@@ -901,6 +990,10 @@ struct EventHeaderUtil {
     static const int k_CONTROL_EVENT_ENCODING_START_IDX = 5;
     static const int k_CONTROL_EVENT_ENCODING_MASK;
 
+    static const int k_PUT_EVENT_COMPACT_NUM_BITS  = 1;
+    static const int k_PUT_EVENT_COMPACT_START_IDX = 7;
+    static const int k_PUT_EVENT_COMPACT_MASK;
+
   public:
     // CLASS METHODS
 
@@ -913,6 +1006,16 @@ struct EventHeaderUtil {
     /// appropriate bits in the specified `eventHeader`.
     static EncodingType::Enum
     controlEventEncodingType(const EventHeader& eventHeader);
+
+    /// Set the appropriate bit in the specified `eventHeader` of a put
+    /// event to indicate whether its messages are in the compact encoding,
+    /// according to the specified `value`.
+    static void setCompactPutEvent(EventHeader* eventHeader, bool value);
+
+    /// Return true if the appropriate bit in the specified `eventHeader` of
+    /// a put event indicates that its messages are in the compact encoding,
+    /// and false otherwise.
+    static bool isCompactPutEvent(const EventHeader& eventHeader);
 };
 
 // ===================
@@ -1736,7 +1839,8 @@ struct AckHeader {
     //       R...: Reserved
     //
     //  HeaderWords (HW)......: Total size (words) of this AckHeader
-    //  PerMessageWords (PMW).: Size (words) used for each AckMessage in the
+    //  PerMessageWords (PMW).: Size (words) used for each AckMessage (or
+    //                          AckMessageRange, see AckHeaderFlags) in the
     //                          payload following this AckHeader
     //  Flags.................: bitmask of flags specifying this header
     //                          see AckHeaderFlags struct
@@ -1836,7 +1940,8 @@ struct AckHeaderFlags {
         e_UNUSED5 = (1 << 4),
         e_UNUSED6 = (1 << 5),
         e_UNUSED7 = (1 << 6),
-        e_UNUSED8 = (1 << 7)
+        e_RANGES  = (1 << 7)  // The payload is made of 'AckMessageRange'
+                              // instead of 'AckMessage'
     };
 };
 
@@ -1906,6 +2011,9 @@ struct AckMessage {
     /// Constant to indicate no correlation Id.
     static const int k_NULL_CORRELATION_ID = 0;
 
+    /// Highest possible value for the correlation Id.
+    static const int k_MAX_CORRELATION_ID = (1 << k_CORRID_NUM_BITS) - 1;
+
   public:
     // CREATORS
 
@@ -1952,6 +2060,69 @@ struct AckMessage {
     int queueId() const;
 };
 
+// ======================
+// struct AckMessageRange
+// ======================
+
+/// This struct defines the (repeated) payload following the `AckHeader`
+/// struct when its `AckHeaderFlags::e_RANGES` flag is set.  A range stands
+/// for `count` consecutive acknowledgements for the same queue and with the
+/// same status, where the correlation Id of each message is the one of the
+/// previous message plus one, and the MessageGUID of each message is the
+/// one following the MessageGUID of the previous message, as generated in
+/// bulk by `MessageGUIDGenerator::generateGUIDs` (see
+/// `MessageGUIDGenerator::loadNextGUID`).
+struct AckMessageRange {
+    // AckMessageRange structure datagram [28 bytes]:
+    //..
+    //   +---------------+---------------+---------------+---------------+
+    //   |0|1|2|3|4|5|6|7|0|1|2|3|4|5|6|7|0|1|2|3|4|5|6|7|0|1|2|3|4|5|6|7|
+    //   +---------------+---------------+---------------+---------------+
+    //   |           First AckMessage of the range (6 words)             |
+    //   +---------------+---------------+---------------+---------------+
+    //   |                             Count                             |
+    //   +---------------+---------------+---------------+---------------+
+    //
+    //  First AckMessage..: The first message of the range
+    //  Count.............: Number of messages in the range (at least 1)
+    //..
+
+  private:
+    // DATA
+    AckMessage d_firstMessage;
+    // First message of the range.
+
+    bdlb::BigEndianInt32 d_count;
+    // Number of messages in the range.
+
+  public:
+    // CREATORS
+
+    /// Create this object where all fields are set to zero.
+    AckMessageRange();
+
+    /// Create an instance with the specified `firstMessage` and `count`.
+    AckMessageRange(const AckMessage& firstMessage, int count);
+
+    // MANIPULATORS
+
+    /// Set the first message of this range to the specified `value` and
+    /// return a reference offering modifiable access to this object.
+    AckMessageRange& setFirstMessage(const AckMessage& value);
+
+    /// Set the number of messages in this range to the specified `value`
+    /// and return a reference offering modifiable access to this object.
+    AckMessageRange& setCount(int value);
+
+    // ACCESSORS
+
+    /// Return the first message of this range.
+    const AckMessage& firstMessage() const;
+
+    /// Return the number of messages in this range.
+    int count() const;
+};
+
 // =================
 // struct PushHeader
 // =================
@@ -2300,15 +2471,18 @@ struct ConfirmHeader {
     //   +---------------+---------------+---------------+---------------+
     //   |0|1|2|3|4|5|6|7|0|1|2|3|4|5|6|7|0|1|2|3|4|5|6|7|0|1|2|3|4|5|6|7|
     //   +---------------+---------------+---------------+---------------+
-    //   |  HW   |  PMW  |                   Reserved                    |
+    //   |  HW   |  PMW  |     Flags     |           Reserved            |
     //   +---------------+---------------+---------------+---------------+
     //       HW..: HeaderWords
     //       PMW.: PerMessageWords
     //       R...: Reserved
     //
     //  HeaderWords (HW)......: Total size (words) of this ConfirmHeader
-    //  PerMessageWords (PMW).: Size (words) used for each ConfirmMessage in
-    //                          the payload following this ConfirmHeader
+    //  PerMessageWords (PMW).: Size (words) used for each ConfirmMessage (or
+    //                          ConfirmMessageRange, see ConfirmHeaderFlags)
+    //                          in the payload following this ConfirmHeader
+    //  Flags.................: bitmask of flags specifying this header
+    //                          see ConfirmHeaderFlags struct
     //  Reserved (R)..........: For alignment and extension ~ must be 0
     //..
 
@@ -2328,7 +2502,10 @@ struct ConfirmHeader {
     // Total size (words) of this header and number of words of
     // each ConfirmMessage in the payload that follows.
 
-    unsigned char d_reserved[3];
+    unsigned char d_flags;
+    // Bitmask of flags.
+
+    unsigned char d_reserved[2];
     // Reserved
 
   public:
@@ -2368,6 +2545,10 @@ struct ConfirmHeader {
     /// offering modifiable access to this object.
     ConfirmHeader& setPerMessageWords(int value);
 
+    /// Set the flags mask of this header to the specified `value` and
+    /// return a reference offering modifiable access to this object.
+    ConfirmHeader& setFlags(int value);
+
     // ACCESSORS
 
     /// Return the number of words of this header.
@@ -2376,6 +2557,31 @@ struct ConfirmHeader {
     /// Return the number of words of each ConfirmMessage in the payload
     /// that follows.
     int perMessageWords() const;
+
+    /// Return the flags mask of this header.
+    int flags() const;
+};
+
+// =========================
+// struct ConfirmHeaderFlags
+// =========================
+
+/// This struct defines the meanings of each bits of the flags field of the
+/// `ConfirmHeader` structure.
+struct ConfirmHeaderFlags {
+    // TYPES
+    enum Enum {
+        e_RANGES  = (1 << 0),  // The payload is made of
+                               // 'ConfirmMessageRange' instead of
+                               // 'ConfirmMessage'
+        e_UNUSED2 = (1 << 1),
+        e_UNUSED3 = (1 << 2),
+        e_UNUSED4 = (1 << 3),
+        e_UNUSED5 = (1 << 4),
+        e_UNUSED6 = (1 << 5),
+        e_UNUSED7 = (1 << 6),
+        e_UNUSED8 = (1 << 7)
+    };
 };
 
 // =====================
@@ -2455,6 +2661,73 @@ struct ConfirmMessage {
     int subQueueId() const;
 };
 
+// ==========================
+// struct ConfirmMessageRange
+// ==========================
+
+/// This struct defines the (repeated) payload following the
+/// `ConfirmHeader` struct when its `ConfirmHeaderFlags::e_RANGES` flag is
+/// set.  A range stands for `count` consecutive confirmations for the same
+/// queue and subQueue, where the MessageGUID of each message is the one
+/// following the MessageGUID of the previous message (see
+/// `MessageGUIDGenerator::loadNextGUID`).
+struct ConfirmMessageRange {
+    // ConfirmMessageRange structure datagram [28 bytes]:
+    //..
+    //   +---------------+---------------+---------------+---------------+
+    //   |0|1|2|3|4|5|6|7|0|1|2|3|4|5|6|7|0|1|2|3|4|5|6|7|0|1|2|3|4|5|6|7|
+    //   +---------------+---------------+---------------+---------------+
+    //   |         First ConfirmMessage of the range (6 words)           |
+    //   +---------------+---------------+---------------+---------------+
+    //   |                             Count                             |
+    //   +---------------+---------------+---------------+---------------+
+    //
+    //  First ConfirmMessage..: The first message of the range
+    //  Count.................: Number of messages in the range (at least 1)
+    //..
+
+  private:
+    // DATA
+    ConfirmMessage d_firstMessage;
+    // First message of the range.
+
+    bdlb::BigEndianInt32 d_count;
+    // Number of messages in the range.
+
+  public:
+    // PUBLIC CLASS DATA
+
+    /// Maximum number of messages in a range, bounding the work a single
+    /// range can request from its receiver.
+    static const int k_MAX_COUNT = 1 << 16;
+
+    // CREATORS
+
+    /// Create this object where all fields are set to zero.
+    ConfirmMessageRange();
+
+    /// Create an instance with the specified `firstMessage` and `count`.
+    ConfirmMessageRange(const ConfirmMessage& firstMessage, int count);
+
+    // MANIPULATORS
+
+    /// Set the first message of this range to the specified `value` and
+    /// return a reference offering modifiable access to this object.
+    ConfirmMessageRange& setFirstMessage(const ConfirmMessage& value);
+
+    /// Set the number of messages in this range to the specified `value`
+    /// and return a reference offering modifiable access to this object.
+    ConfirmMessageRange& setCount(int value);
+
+    // ACCESSORS
+
+    /// Return the first message of this range.
+    const ConfirmMessage& firstMessage() const;
+
+    /// Return the number of messages in this range.
+    int count() const;
+};
+
 // ===================
 // struct RejectHeader
 // ===================
@@ -3854,6 +4127,32 @@ EventHeaderUtil::controlEventEncodingType(const EventHeader& eventHeader)
     return static_cast<EncodingType::Enum>(encodingType);
 }
 
+inline void EventHeaderUtil::setCompactPutEvent(EventHeader* eventHeader,
+                                                bool         value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(eventHeader->type() == EventType::e_PUT);
+
+    unsigned char typeSpecific = eventHeader->typeSpecific();
+
+    if (value) {
+        typeSpecific |= k_PUT_EVENT_COMPACT_MASK;
+    }
+    else {
+        typeSpecific &= ~k_PUT_EVENT_COMPACT_MASK;
+    }
+
+    eventHeader->setTypeSpecific(typeSpecific);
+}
+
+inline bool EventHeaderUtil::isCompactPutEvent(const EventHeader& eventHeader)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(eventHeader.type() == EventType::e_PUT);
+
+    return 0 != (eventHeader.typeSpecific() & k_PUT_EVENT_COMPACT_MASK);
+}
+
 // -------------------
 // struct OptionHeader
 // -------------------
@@ -4468,6 +4767,49 @@ inline int AckMessage::queueId() const
     return d_queueId;
 }
 
+// ----------------------
+// struct AckMessageRange
+// ----------------------
+
+// CREATORS
+inline AckMessageRange::AckMessageRange()
+: d_firstMessage()
+{
+    d_count = 0;
+}
+
+inline AckMessageRange::AckMessageRange(const AckMessage& firstMessage,
+                                        int               count)
+: d_firstMessage(firstMessage)
+{
+    d_count = count;
+}
+
+// MANIPULATORS
+inline AckMessageRange&
+AckMessageRange::setFirstMessage(const AckMessage& value)
+{
+    d_firstMessage = value;
+    return *this;
+}
+
+inline AckMessageRange& AckMessageRange::setCount(int value)
+{
+    d_count = value;
+    return *this;
+}
+
+// ACCESSORS
+inline const AckMessage& AckMessageRange::firstMessage() const
+{
+    return d_firstMessage;
+}
+
+inline int AckMessageRange::count() const
+{
+    return d_count;
+}
+
 // -----------------
 // struct PushHeader
 // -----------------
@@ -4672,6 +5014,12 @@ inline ConfirmHeader& ConfirmHeader::setPerMessageWords(int value)
     return *this;
 }
 
+inline ConfirmHeader& ConfirmHeader::setFlags(int value)
+{
+    d_flags = static_cast<unsigned char>(value);
+    return *this;
+}
+
 // ACCESSORS
 inline int ConfirmHeader::headerWords() const
 {
@@ -4684,6 +5032,11 @@ inline int ConfirmHeader::perMessageWords() const
     return d_headerWordsAndPerMsgWords & k_PER_MSG_WORDS_MASK;
 }
 
+inline int ConfirmHeader::flags() const
+{
+    return d_flags;
+}
+
 // ---------------------
 // struct ConfirmMessage
 // ---------------------
@@ -4729,6 +5082,50 @@ inline int ConfirmMessage::subQueueId() const
     return d_subQueueId;
 }
 
+// --------------------------
+// struct ConfirmMessageRange
+// --------------------------
+
+// CREATORS
+inline ConfirmMessageRange::ConfirmMessageRange()
+: d_firstMessage()
+{
+    d_count = 0;
+}
+
+inline ConfirmMessageRange::ConfirmMessageRange(
+    const ConfirmMessage& firstMessage,
+    int                   count)
+: d_firstMessage(firstMessage)
+{
+    d_count = count;
+}
+
+// MANIPULATORS
+inline ConfirmMessageRange&
+ConfirmMessageRange::setFirstMessage(const ConfirmMessage& value)
+{
+    d_firstMessage = value;
+    return *this;
+}
+
+inline ConfirmMessageRange& ConfirmMessageRange::setCount(int value)
+{
+    d_count = value;
+    return *this;
+}
+
+// ACCESSORS
+inline const ConfirmMessage& ConfirmMessageRange::firstMessage() const
+{
+    return d_firstMessage;
+}
+
+inline int ConfirmMessageRange::count() const
+{
+    return d_count;
+}
+
 // -------------------
 // struct RejectHeader
 // -------------------
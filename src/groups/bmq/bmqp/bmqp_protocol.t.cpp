@@ -571,6 +571,28 @@ static void test1_breathingTest()
         ASSERT_EQ(status, am2.status());
         ASSERT_EQ(corrId, am2.correlationId());
         ASSERT_EQ(onesGuid, am2.messageGUID());
+
+        // ------------------------------
+        // AckMessageRange Breathing Test
+        // ------------------------------
+        bmqp::AckMessageRange range;
+
+        ASSERT_EQ(sizeof(range), sizeof(bmqp::AckMessage) + 4);
+        ASSERT_EQ(range.count(), 0);
+        ASSERT_EQ(range.firstMessage().queueId(), 0);
+        ASSERT_EQ(range.firstMessage().messageGUID(), zeroGuid);
+
+        range.setFirstMessage(am2).setCount(42);
+
+        ASSERT_EQ(range.count(), 42);
+        ASSERT_EQ(range.firstMessage().queueId(), queueId);
+        ASSERT_EQ(range.firstMessage().status(), status);
+        ASSERT_EQ(range.firstMessage().correlationId(), corrId);
+        ASSERT_EQ(range.firstMessage().messageGUID(), onesGuid);
+
+        bmqp::AckMessageRange range2(am2, 7);
+        ASSERT_EQ(range2.count(), 7);
+        ASSERT_EQ(range2.firstMessage().correlationId(), corrId);
     }
 
     {
@@ -587,10 +609,14 @@ static void test1_breathingTest()
         // Set some values
         const int msgNumWords = 5;
 
+        ASSERT_EQ(ch.flags(), 0);
+
         ch.setPerMessageWords(msgNumWords);
+        ch.setFlags(bmqp::ConfirmHeaderFlags::e_RANGES);
 
         ASSERT_EQ(ch.perMessageWords(), msgNumWords);
         ASSERT_EQ(ch.headerWords(), numWords);
+        ASSERT_EQ(ch.flags(), bmqp::ConfirmHeaderFlags::e_RANGES);
     }
 
     {
@@ -624,6 +650,27 @@ static void test1_breathingTest()
         ASSERT_EQ(cm.queueId(), queueId);
         ASSERT_EQ(cm.messageGUID(), onesGuid);
         ASSERT_EQ(cm.subQueueId(), subQueueId);
+
+        // ----------------------------------
+        // ConfirmMessageRange Breathing Test
+        // ----------------------------------
+        bmqp::ConfirmMessageRange range;
+
+        ASSERT_EQ(sizeof(range), sizeof(bmqp::ConfirmMessage) + 4);
+        ASSERT_EQ(range.count(), 0);
+        ASSERT_EQ(range.firstMessage().queueId(), 0);
+        ASSERT_EQ(range.firstMessage().messageGUID(), zeroGuid);
+
+        range.setFirstMessage(cm).setCount(42);
+
+        ASSERT_EQ(range.count(), 42);
+        ASSERT_EQ(range.firstMessage().queueId(), queueId);
+        ASSERT_EQ(range.firstMessage().messageGUID(), onesGuid);
+        ASSERT_EQ(range.firstMessage().subQueueId(), subQueueId);
+
+        bmqp::ConfirmMessageRange range2(cm, 7);
+        ASSERT_EQ(range2.count(), 7);
+        ASSERT_EQ(range2.firstMessage().subQueueId(), subQueueId);
     }
 
     {
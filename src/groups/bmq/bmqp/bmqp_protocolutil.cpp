@@ -24,6 +24,7 @@
 
 // MWC
 #include <mwcc_array.h>
+#include <mwcu_blob.h>
 #include <mwcu_blobiterator.h>
 #include <mwcu_blobobjectproxy.h>
 #include <mwcu_memoutstream.h>
@@ -234,6 +235,48 @@ void ProtocolUtil::appendPaddingRaw(bdlbb::Blob* destination,
     }
 }
 
+void ProtocolUtil::appendByReference(bdlbb::Blob*       destination,
+                                     const bdlbb::Blob& source,
+                                     int                numPaddingBytes)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(g_initialized && "Not initialized");
+    BSLS_ASSERT_SAFE(numPaddingBytes >= 1 && numPaddingBytes <= 8);
+    BSLS_ASSERT_SAFE(destination->numDataBuffers() >= 1);
+    BSLS_ASSERT_SAFE(source.length() > 0);
+
+    // Appending by reference trims the last data buffer of 'destination';
+    // keep a buffer aliasing its unused capacity, to give it back once the
+    // 'source' buffers have been appended (unless 'source' directly follows
+    // in that same capacity, in which case the buffer is extended instead).
+    const bdlbb::BlobBuffer& lastBuffer = destination->buffer(
+        destination->numDataBuffers() - 1);
+    const int   lastBufferDataLength = destination->lastDataBufferLength();
+    char* const unused = lastBuffer.data() + lastBufferDataLength;
+
+    bdlbb::BlobBuffer remainder;
+    if (lastBuffer.size() > lastBufferDataLength &&
+        source.buffer(0).data() != unused) {
+        remainder.reset(bsl::shared_ptr<char>(lastBuffer.buffer(), unused),
+                        lastBuffer.size() - lastBufferDataLength);
+    }
+
+    const int rc = mwcu::BlobUtil::appendToBlob(destination,
+                                                source,
+                                                mwcu::BlobPosition());
+    BSLS_ASSERT_SAFE(rc == 0);
+    (void)rc;  // compiler happiness
+
+    // The last data buffer is now one of 'source', which must not be written
+    // to: always use the pre-formatted padding buffer.
+    destination->appendDataBuffer(
+        g_paddingBlobBuffer[numPaddingBytes].object());
+
+    if (remainder.size() > 0) {
+        destination->appendBuffer(remainder);
+    }
+}
+
 void ProtocolUtil::appendPaddingRaw(char* destination, int numPaddingBytes)
 {
     // PRECONDITIONS
@@ -654,6 +697,60 @@ int ProtocolUtil::convertToOld(bdlbb::Blob*                         dst,
     return rc;
 }
 
+int ProtocolUtil::convertCompression(
+    bdlbb::Blob*                         dst,
+    const bdlbb::Blob&                   src,
+    bmqt::CompressionAlgorithmType::Enum fromCat,
+    bmqt::CompressionAlgorithmType::Enum toCat,
+    bool                                 haveNewMessageProperties,
+    bdlbb::BlobBufferFactory*            factory,
+    bslma::Allocator*                    allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dst);
+    BSLS_ASSERT_SAFE(dst->length() == 0);
+    BSLS_ASSERT_SAFE(dst != &src);
+
+    enum RcEnum {
+        rc_SUCCESS                       = 0,
+        rc_INVALID_MSG_PROPERTIES_HEADER = -1,
+        rc_DECOMPRESSION_FAILURE         = -2,
+        rc_COMPRESSION_FAILURE           = -3
+    };
+
+    int mpsSize = 0;
+    if (haveNewMessageProperties &&
+        readPropertiesSize(&mpsSize, src, mwcu::BlobPosition()) != 0) {
+        return rc_INVALID_MSG_PROPERTIES_HEADER;  // RETURN
+    }
+
+    bdlbb::Blob compressed(factory, allocator);
+    bdlbb::Blob data(factory, allocator);
+    bdlbb::BlobUtil::append(&compressed, src, mpsSize);
+
+    mwcu::MemOutStream error(allocator);
+    if (Compression::decompress(&data,
+                                factory,
+                                fromCat,
+                                compressed,
+                                &error,
+                                allocator) != 0) {
+        return rc_DECOMPRESSION_FAILURE;  // RETURN
+    }
+
+    if (mpsSize) {
+        // New style Message Properties are not compressed.
+        bdlbb::BlobUtil::append(dst, src, 0, mpsSize);
+    }
+
+    if (Compression::compress(dst, factory, toCat, data, &error, allocator) !=
+        0) {
+        return rc_COMPRESSION_FAILURE;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
 int ProtocolUtil::readPropertiesSize(int*                      size,
                                      const bdlbb::Blob&        blob,
                                      const mwcu::BlobPosition& position)
@@ -261,6 +261,20 @@ struct ProtocolUtil {
                                  int          numPaddingBytes);
     static void appendPaddingRaw(char* destination, int numPaddingBytes);
 
+    /// Append to the specified `destination` blob the buffers of the
+    /// specified `source` blob by reference (i.e., without copying their
+    /// data), followed by the specified `numPaddingBytes` of padding,
+    /// using the shared pre-formatted padding blob buffers.  The unused
+    /// capacity of the last data buffer of `destination` is preserved, so
+    /// that subsequent writes to `destination` (e.g., the next message
+    /// header) do not require a new buffer.  The behavior is undefined
+    /// unless `destination` is not empty, `source` is not empty, and
+    /// `numPaddingBytes >= 1` and `numPaddingBytes <= 8`.  Note that any
+    /// later change to the data of `source` is visible in `destination`.
+    static void appendByReference(bdlbb::Blob*       destination,
+                                  const bdlbb::Blob& source,
+                                  int                numPaddingBytes);
+
     /// Append the specified `numPaddingBytes` of padding to the specified
     /// `destination` for 4-byte alignment (or 8 in the `dword` flavor).
     /// The behavior is undefined unless `numPaddingBytes >= 1` and
@@ -421,6 +435,23 @@ struct ProtocolUtil {
                              unsigned int        primaryLeaseId,
                              bsls::Types::Uint64 sequenceNumber);
 
+    /// Scan, in one pass, the messages starting at the specified `position`
+    /// in the specified `blob` and spanning its specified `length` bytes,
+    /// each message starting with a header of the (template parameter)
+    /// type `HEADER` (i.e., `PutHeader` or `PushHeader`), and load into the
+    /// specified `headerSizes` the size of the header of each message.
+    /// Return 0 if each header is complete and declares a header size and a
+    /// non-zero message size fitting in the remaining bytes, or a negative
+    /// value otherwise, in which case `headerSizes` holds the header sizes
+    /// of the valid messages preceding the first invalid one.  Note that
+    /// only the size fields of the headers are read, and that a header
+    /// which does not span buffers of `blob` is read in place.
+    template <class HEADER>
+    static int scanMessageHeaders(bsl::vector<int>*         headerSizes,
+                                  const bdlbb::Blob&        blob,
+                                  const mwcu::BlobPosition& position,
+                                  int                       length);
+
     /// If the specified `src` has MessageProperties encoded in the new
     /// style (schema > 0), re-write `propertyValueLength` for each property
     /// to represent length (old style) instead of offset (new style).
@@ -439,6 +470,23 @@ struct ProtocolUtil {
                             bdlbb::BlobBufferFactory*            factory,
                             bslma::Allocator*                    allocator);
 
+    /// Load into the specified `dst` the payload in the specified `src`,
+    /// compressed with the specified `fromCat`, re-compressed with the
+    /// specified `toCat`.  If the specified `haveNewMessageProperties` is
+    /// true, `src` starts with (uncompressed) Message Properties in the new
+    /// style which are copied unchanged to `dst`; otherwise the entire
+    /// `src` is compressed.  Use the specified `factory` and `allocator` to
+    /// supply memory.  Return `0` on success.  The behavior is undefined
+    /// unless `dst` is empty and `dst != src`.
+    static int
+    convertCompression(bdlbb::Blob*                         dst,
+                       const bdlbb::Blob&                   src,
+                       bmqt::CompressionAlgorithmType::Enum fromCat,
+                       bmqt::CompressionAlgorithmType::Enum toCat,
+                       bool                      haveNewMessageProperties,
+                       bdlbb::BlobBufferFactory* factory,
+                       bslma::Allocator*         allocator);
+
     /// Parse `MesasgePropertiesHeader` out of the specified `blob` at the
     /// specified `position` and load the size of message properties
     /// (messagePropertiesAreaWords * WORD_SIZE) into the specified `size`.
@@ -741,6 +789,82 @@ inline void ProtocolUtil::buildReceipt(bdlbb::Blob*        blob,
         .setSequenceNum(sequenceNumber);
 }
 
+template <class HEADER>
+int ProtocolUtil::scanMessageHeaders(bsl::vector<int>*         headerSizes,
+                                     const bdlbb::Blob&        blob,
+                                     const mwcu::BlobPosition& position,
+                                     int                       length)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(headerSizes);
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS              = 0,
+        rc_NO_HEADER            = -1,
+        rc_INVALID_HEADER_SIZE  = -2,
+        rc_INVALID_MESSAGE_SIZE = -3
+    };
+
+    headerSizes->clear();
+
+    HEADER scratch;  // copy of a header spanning buffers
+    int    buffer    = position.buffer();
+    int    byte      = position.byte();
+    int    remaining = length;
+
+    while (remaining > 0) {
+        // Move to the buffer holding the current message
+        int bufferSize = mwcu::BlobUtil::bufferSize(blob, buffer);
+        while (byte >= bufferSize) {
+            byte -= bufferSize;
+            bufferSize = mwcu::BlobUtil::bufferSize(blob, ++buffer);
+        }
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                remaining < HEADER::k_MIN_HEADER_SIZE)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            return rc_NO_HEADER;  // RETURN
+        }
+
+        const HEADER* header = &scratch;
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                bufferSize - byte >= HEADER::k_MIN_HEADER_SIZE)) {
+            header = reinterpret_cast<const HEADER*>(
+                blob.buffer(buffer).data() + byte);
+        }
+        else {
+            mwcu::BlobUtil::readNBytes(reinterpret_cast<char*>(&scratch),
+                                       blob,
+                                       mwcu::BlobPosition(buffer, byte),
+                                       HEADER::k_MIN_HEADER_SIZE);
+        }
+
+        const int headerSize  = header->headerWords() * Protocol::k_WORD_SIZE;
+        const int messageSize = header->messageWords() *
+                                Protocol::k_WORD_SIZE;
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                headerSize < HEADER::k_MIN_HEADER_SIZE ||
+                headerSize > remaining)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            return rc_INVALID_HEADER_SIZE;  // RETURN
+        }
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(messageSize == 0 ||
+                                                  messageSize > remaining)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            return rc_INVALID_MESSAGE_SIZE;  // RETURN
+        }
+
+        headerSizes->push_back(headerSize);
+        remaining -= messageSize;
+        byte += messageSize;
+    }
+
+    return rc_SUCCESS;
+}
+
 inline bdlb::NullableValue<bmqp_ctrlmsg::SubQueueIdInfo>
 ProtocolUtil::makeSubQueueIdInfo(const bsl::string& appId, unsigned int subId)
 {
@@ -941,6 +941,92 @@ static void test12_parseMessageProperties()
     bmqp::ProtocolUtil::shutdown();
 }
 
+static void test13_convertCompression()
+// ------------------------------------------------------------------------
+// TESTS CONVERTING COMPRESSION ALGORITHM
+//
+// Concerns:
+//   - Verify ProtocolUtil::convertCompression keeps new style Message
+//     Properties and re-compresses the data.
+//
+// Plan:
+//   Pack a message compressed with ZSTD, convert it to ZLIB, and call
+//   ProtocolUtil::parse with ZLIB.
+//
+// ------------------------------------------------------------------------
+{
+    bmqp::ProtocolUtil::initialize(s_allocator_p);
+
+    mwctst::TestHelper::printTestName("TEST CONVERTING COMPRESSION");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    bmqp::MessageProperties        in(s_allocator_p);
+    encode(&in);
+    const int             queueId = 4;
+    bmqp::PutEventBuilder peb(&bufferFactory, s_allocator_p);
+    bdlbb::Blob           payload(&bufferFactory, s_allocator_p);
+
+    populateBlob(&payload, 2 * bmqp::Protocol::k_COMPRESSION_MIN_APPDATA_SIZE);
+
+    peb.startMessage();
+    peb.setMessagePayload(&payload);
+    peb.setMessageProperties(&in);
+    peb.setCompressionAlgorithmType(bmqt::CompressionAlgorithmType::e_ZSTD);
+    peb.setMessageGUID(bmqp::MessageGUIDGenerator::testGUID());
+
+    bmqt::EventBuilderResult::Enum builderResult = peb.packMessage(queueId);
+
+    ASSERT_EQ(bmqt::EventBuilderResult::e_SUCCESS, builderResult);
+
+    bmqp::PutMessageIterator putIt(&bufferFactory, s_allocator_p, true);
+    bmqp::Event              rawEvent(&peb.blob(), s_allocator_p);
+
+    BSLS_ASSERT_SAFE(rawEvent.isPutEvent());
+    rawEvent.loadPutMessageIterator(&putIt);
+
+    ASSERT_EQ(1, putIt.next());
+
+    bdlbb::Blob payloadIn(&bufferFactory, s_allocator_p);
+
+    putIt.loadApplicationData(&payloadIn);
+
+    bdlbb::Blob converted(&bufferFactory, s_allocator_p);
+    int         rc = bmqp::ProtocolUtil::convertCompression(
+        &converted,
+        payloadIn,
+        bmqt::CompressionAlgorithmType::e_ZSTD,
+        bmqt::CompressionAlgorithmType::e_ZLIB,
+        true,  // new style MPs
+        &bufferFactory,
+        s_allocator_p);
+    ASSERT_EQ(0, rc);
+
+    bdlbb::Blob msgPropertiesBlob(&bufferFactory, s_allocator_p);
+    int         messagePropertiesSize = 0;
+    bdlbb::Blob payloadOut(&bufferFactory, s_allocator_p);
+    rc = bmqp::ProtocolUtil::parse(&msgPropertiesBlob,
+                                   &messagePropertiesSize,
+                                   &payloadOut,
+                                   converted,
+                                   converted.length(),
+                                   true,  // decompress
+                                   mwcu::BlobPosition(),
+                                   true,  // MPs
+                                   true,  // new style
+                                   bmqt::CompressionAlgorithmType::e_ZLIB,
+                                   &bufferFactory,
+                                   s_allocator_p);
+    ASSERT_EQ(0, rc);
+    bmqp::MessageProperties out(s_allocator_p);
+    out.streamIn(msgPropertiesBlob, true);
+
+    verify(out);
+
+    ASSERT_EQ(0, bdlbb::BlobUtil::compare(payloadOut, payload));
+
+    bmqp::ProtocolUtil::shutdown();
+}
+
 // ============================================================================
 //                                MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -953,6 +1039,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 13: test13_convertCompression(); break;
     case 12: test12_parseMessageProperties(); break;
     case 11: test11_encodeDecodeMessage(); break;
     case 10: test10_loadFieldValues(); break;
@@ -113,11 +113,17 @@ bmqt::EventBuilderResult::Enum PushEventBuilder::packMessageImp(
 
     d_currPushHeader.reset();  // i.e., flush writing to blob..
 
-    // Add the payload
-    bdlbb::BlobUtil::append(&d_blob, payload);
+    if (d_zeroCopy && payloadLen >= Protocol::k_ZERO_COPY_MIN_APPDATA_SIZE) {
+        // Add the payload, by reference, and padding
+        ProtocolUtil::appendByReference(&d_blob, payload, numPaddingBytes);
+    }
+    else {
+        // Add the payload
+        bdlbb::BlobUtil::append(&d_blob, payload);
 
-    // Add padding
-    ProtocolUtil::appendPadding(&d_blob, payloadLen);
+        // Add padding
+        ProtocolUtil::appendPaddingRaw(&d_blob, numPaddingBytes);
+    }
 
     d_options.reset();
     ++d_msgCount;
@@ -152,6 +158,7 @@ PushEventBuilder::PushEventBuilder(bdlbb::BlobBufferFactory* bufferFactory,
 , d_blob(bufferFactory, allocator)
 , d_msgCount(0)
 , d_options()
+, d_zeroCopy(false)
 {
     reset();
 }
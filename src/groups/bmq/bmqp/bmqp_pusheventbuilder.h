@@ -33,6 +33,16 @@
 // Each message added to the PushEvent is padded, so that multiple messages can
 // be added in the same event, without impacting the alignment of the headers.
 //
+/// Zero-Copy
+///---------
+// By default, the payload of each message is copied into the event being
+// built.  In zero-copy mode (see 'setZeroCopy'), the payload blob buffers are
+// instead appended by reference, followed by a shared padding buffer, so that
+// the same payload can be part of many events (e.g., when delivering a message
+// to multiple consumers) without any copy.  The payload must then not be
+// modified while any of these events is in use.  Small payloads are always
+// copied.
+//
 /// Thread Safety
 ///-------------
 // NOT thread safe
@@ -109,6 +119,11 @@ class PushEventBuilder {
     // Push Header associated with the
     // current (to-be-packed) message.
 
+    bool d_zeroCopy;
+    // Whether payloads are appended by
+    // reference to the event being built
+    // (see 'setZeroCopy').
+
   private:
     // PRIVATE MANIPULATORS
 
@@ -165,6 +180,16 @@ class PushEventBuilder {
     /// success, or non-zero on error.
     int reset();
 
+    /// Set the zero-copy mode of this builder to the specified `value`.
+    /// In zero-copy mode, the buffers of the payload of each subsequently
+    /// packed message are appended by reference to the event being built,
+    /// instead of being copied, unless that payload is smaller than
+    /// `Protocol::k_ZERO_COPY_MIN_APPDATA_SIZE`.  The behavior is undefined
+    /// if, in zero-copy mode, the data of a packed payload is modified
+    /// while the built event is in use.  Note that zero-copy mode is off
+    /// by default, and that it persists across calls to `reset`.
+    void setZeroCopy(bool value);
+
     /// Add a message to the event being built, having the specified
     /// `queueId`, `msgId`, `payload`, `flags` and
     /// `compressionAlgorithmType`.  Use the specified `propertiesLogic` to
@@ -241,6 +266,10 @@ class PushEventBuilder {
     /// Return the number of messages currently in the event being built.
     int messageCount() const;
 
+    /// Return true if this builder is in zero-copy mode, and false
+    /// otherwise.
+    bool isZeroCopy() const;
+
     /// Return a reference not offering modifiable access to the blob built
     /// by this event.  If no messages were added, this will return a blob
     /// composed only of an `EventHeader`.
@@ -286,6 +315,11 @@ inline int PushEventBuilder::eraseCurrentMessage()
 }
 
 // MANIPULATORS
+inline void PushEventBuilder::setZeroCopy(bool value)
+{
+    d_zeroCopy = value;
+}
+
 inline bmqt::EventBuilderResult::Enum
 PushEventBuilder::packMessage(const bdlbb::Blob& payload,
                               const PushHeader&  header)
@@ -351,6 +385,11 @@ inline int PushEventBuilder::messageCount() const
     return d_msgCount;
 }
 
+inline bool PushEventBuilder::isZeroCopy() const
+{
+    return d_zeroCopy;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
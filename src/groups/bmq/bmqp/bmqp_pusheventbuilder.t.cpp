@@ -19,6 +19,7 @@
 // BMQ
 #include <bmqp_event.h>
 #include <bmqp_messageproperties.h>
+#include <bmqp_optionsview.h>
 #include <bmqp_protocolutil.h>
 #include <bmqp_pushmessageiterator.h>
 #include <bmqt_compressionalgorithmtype.h>
@@ -27,6 +28,7 @@
 // MWC
 #include <mwcu_blob.h>
 #include <mwcu_memoutstream.h>
+#include <mwcu_printutil.h>
 
 // BDE
 #include <bdlb_guidutil.h>
@@ -36,19 +38,30 @@
 #include <bdlbb_blobutil.h>
 #include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlf_bind.h>
+#include <bdlt_timeunitratio.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>  // for bsl::strlen
 #include <bsl_ctime.h>
 #include <bsl_fstream.h>
+#include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
+#include <bsl_string.h>
 #include <bsl_vector.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
 
 // TEST DRIVER
 #include <mwctst_testhelper.h>
 
+// BENCHMARKING LIBRARY
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <benchmark/benchmark.h>
+#endif
+
 // CONVENIENCE
 using namespace BloombergLP;
 using namespace bsl;
@@ -233,6 +246,70 @@ bool isDefaultSubscription(
             bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID);
 }
 
+/// Reset the specified `builder`, pack into it the specified `numMsgs`
+/// messages having the specified `payload` and, unless the specified
+/// `subQueueInfos` is empty, a SubQueueInfos option holding them, and
+/// iterate over the messages of the resulting event with the specified
+/// `iter`, loading their payloads and options.  Return the total length of
+/// the payloads iterated over.
+int packAndIterate(bmqp::PushEventBuilder*                   builder,
+                   bmqp::PushMessageIterator*                iter,
+                   const bdlbb::Blob&                        payload,
+                   const bmqp::Protocol::SubQueueInfosArray& subQueueInfos,
+                   int                                       numMsgs)
+{
+    bmqt::MessageGUID guid;
+    guid.fromHex(HEX_REP);
+
+    builder->reset();
+    for (int i = 0; i < numMsgs; ++i) {
+        if (!subQueueInfos.empty()) {
+            builder->addSubQueueInfosOption(subQueueInfos);
+        }
+        builder->packMessage(payload,
+                             i,
+                             guid,
+                             0,
+                             bmqt::CompressionAlgorithmType::e_NONE);
+    }
+
+    bmqp::Event event(&builder->blob(), s_allocator_p);
+    event.loadPushMessageIterator(iter, true);
+
+    int               totalLength = 0;
+    bdlbb::Blob       messagePayload(s_allocator_p);
+    bmqp::OptionsView optionsView(s_allocator_p);
+    while (iter->next() == 1) {
+        messagePayload.removeAll();
+        iter->loadMessagePayload(&messagePayload);
+        iter->loadOptionsView(&optionsView);
+        totalLength += messagePayload.length();
+    }
+
+    return totalLength;
+}
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+/// Apply to the specified Google Benchmark `b` the arguments pairs
+/// `{numSubQueueInfos, length}` for messages without and with a
+/// SubQueueInfos option and various payload lengths up to 64 Ki.
+void populateSubQueueInfosAndLengths_GoogleBenchmark(
+    benchmark::internal::Benchmark* b)
+{
+    std::vector<long int> lengths;
+    lengths.push_back(64);
+    lengths.push_back(1024);   // 1 Ki
+    lengths.push_back(16384);  // 16 Ki
+    lengths.push_back(65536);  // 64 Ki
+    for (int numSubQueueInfos = 0; numSubQueueInfos <= 4;
+         numSubQueueInfos += 4) {
+        for (auto i : lengths) {
+            b->Args({numSubQueueInfos, i});
+        }
+    }
+}
+#endif
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -1088,6 +1165,129 @@ static void test8_buildEventTooBig()
     ASSERT_EQ(1, peb.messageCount());
 }
 
+static void test9_buildEventZeroCopy()
+// ------------------------------------------------------------------------
+// BUILD EVENT ZERO COPY
+//
+// Concerns:
+//   In zero-copy mode, the payload of a message is appended by reference
+//   to the event, so that the same payload buffers can be shared between
+//   multiple events, and the events are still valid.
+//
+// Plan:
+//   - Pack a big and a small payload in two zero-copy builders and in a
+//     regular builder.
+//   - Verify that the big payload buffers are referred to by the events of
+//     the zero-copy builders only, and that all events iterate over the
+//     expected messages.
+//
+// Testing:
+//   setZeroCopy
+//   isZeroCopy
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BUILD EVENT ZERO COPY");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+
+    const int         k_BIG_PAYLOAD_SIZE = 3 * 1024 + 5;
+    const bsl::string bigPayload(k_BIG_PAYLOAD_SIZE, 'x', s_allocator_p);
+    const char*       k_SMALL_PAYLOAD = "abcdefghijklmnopqrstuvwxyz";
+
+    bdlbb::Blob bigBlob(&bufferFactory, s_allocator_p);
+    bdlbb::Blob smallBlob(&bufferFactory, s_allocator_p);
+    bdlbb::BlobUtil::append(&bigBlob, bigPayload.c_str(), k_BIG_PAYLOAD_SIZE);
+    bdlbb::BlobUtil::append(&smallBlob,
+                            k_SMALL_PAYLOAD,
+                            bsl::strlen(k_SMALL_PAYLOAD));
+    BSLS_ASSERT_OPT(bigBlob.length() >=
+                    bmqp::Protocol::k_ZERO_COPY_MIN_APPDATA_SIZE);
+    BSLS_ASSERT_OPT(smallBlob.length() <
+                    bmqp::Protocol::k_ZERO_COPY_MIN_APPDATA_SIZE);
+
+    bmqp::PushEventBuilder builder1(&bufferFactory, s_allocator_p);
+    bmqp::PushEventBuilder builder2(&bufferFactory, s_allocator_p);
+    bmqp::PushEventBuilder regularBuilder(&bufferFactory, s_allocator_p);
+
+    ASSERT_EQ(false, builder1.isZeroCopy());
+    builder1.setZeroCopy(true);
+    builder2.setZeroCopy(true);
+    ASSERT_EQ(true, builder1.isZeroCopy());
+
+    // Zero-copy mode persists across 'reset'
+    builder1.reset();
+    ASSERT_EQ(true, builder1.isZeroCopy());
+
+    bmqp::PushEventBuilder* builders[] = {&builder1,
+                                          &builder2,
+                                          &regularBuilder};
+    const int               k_NUM_BUILDERS = sizeof(builders) /
+                                              sizeof(*builders);
+
+    bmqt::MessageGUID guids[2];
+    guids[0].fromHex("ABCDEF0123456789ABCDEF0123456789");
+    guids[1].fromHex("0123456789ABCDEF0123456789ABCDEF");
+    const bdlbb::Blob* payloads[] = {&bigBlob, &smallBlob};
+
+    for (int i = 0; i < k_NUM_BUILDERS; ++i) {
+        for (int j = 0; j < 2; ++j) {
+            ASSERT_EQ_D(i << ", " << j,
+                        bmqt::EventBuilderResult::e_SUCCESS,
+                        builders[i]->packMessage(
+                            *payloads[j],
+                            j + 1,  // queueId
+                            guids[j],
+                            0,  // flags
+                            bmqt::CompressionAlgorithmType::e_NONE));
+        }
+    }
+
+    for (int i = 0; i < k_NUM_BUILDERS; ++i) {
+        const bdlbb::Blob& eventBlob = builders[i]->blob();
+
+        // Check whether the big payload buffers are referred to
+        int numSharedBuffers = 0;
+        for (int k = 0; k < eventBlob.numDataBuffers(); ++k) {
+            for (int l = 0; l < bigBlob.numDataBuffers(); ++l) {
+                if (eventBlob.buffer(k).data() == bigBlob.buffer(l).data()) {
+                    ++numSharedBuffers;
+                }
+            }
+        }
+        const bool isZeroCopy = builders[i]->isZeroCopy();
+        ASSERT_EQ_D(i,
+                    isZeroCopy ? bigBlob.numDataBuffers() : 0,
+                    numSharedBuffers);
+
+        // Iterate and check
+        bmqp::Event rawEvent(&eventBlob, s_allocator_p);
+        ASSERT_EQ_D(i, true, rawEvent.isValid());
+        ASSERT_EQ_D(i, true, rawEvent.isPushEvent());
+        ASSERT_EQ_D(i, 0, eventBlob.length() % bmqp::Protocol::k_WORD_SIZE);
+
+        bmqp::PushMessageIterator pushIter(&bufferFactory, s_allocator_p);
+        rawEvent.loadPushMessageIterator(&pushIter, true);
+        ASSERT_EQ_D(i, true, pushIter.isValid());
+
+        for (int j = 0; j < 2; ++j) {
+            ASSERT_EQ_D(i << ", " << j, 1, pushIter.next());
+            ASSERT_EQ_D(i << ", " << j, j + 1, pushIter.header().queueId());
+            ASSERT_EQ_D(i << ", " << j,
+                        guids[j],
+                        pushIter.header().messageGUID());
+
+            bdlbb::Blob payloadBlob(s_allocator_p);
+            ASSERT_EQ_D(i << ", " << j,
+                        0,
+                        pushIter.loadMessagePayload(&payloadBlob));
+            ASSERT_EQ_D(i << ", " << j,
+                        0,
+                        bdlbb::BlobUtil::compare(payloadBlob, *payloads[j]));
+        }
+        ASSERT_EQ_D(i, 0, pushIter.next());
+    }
+}
+
 static void testN1_decodeFromFile()
 // --------------------------------------------------------------------
 // DECODE FROM FILE
@@ -1205,6 +1405,122 @@ static void testN1_decodeFromFile()
     ASSERT_EQ(0, pushIter.next());  // we added only 1 msg
     ASSERT_EQ(false, pushIter.isValid());
 }
+static void testN2_packAndIterate()
+// ------------------------------------------------------------------------
+// BENCHMARK: PACK AND ITERATE
+//
+// Concerns:
+//   Measure the throughput of building a PUSH event, with and without
+//   SubQueueInfos option, and of iterating over its messages, for payloads
+//   of various sizes.
+//
+// Plan:
+//   - For each number of SubQueueInfos and payload size, time the building
+//     and iteration of enough events of 'k_NUM_MSGS' messages to process
+//     about 256 MiB of payloads, and report the throughput.
+//
+// Testing:
+//   Performance of packMessage and PushMessageIterator::next.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BENCHMARK: PACK AND ITERATE");
+
+    const bsls::Types::Int64 k_TOTAL_BYTES = 256 * 1024 * 1024;  // 256 Mi
+    const int                k_NUM_MSGS    = 100;
+    const int                k_LENGTHS[]   = {64, 1024, 16384, 65536};
+    const int k_NUM_LENGTHS = sizeof(k_LENGTHS) / sizeof(*k_LENGTHS);
+
+    bdlbb::PooledBlobBufferFactory     bufferFactory(4096, s_allocator_p);
+    bmqp::PushEventBuilder             builder(&bufferFactory, s_allocator_p);
+    bmqp::PushMessageIterator          iter(&bufferFactory, s_allocator_p);
+    bmqp::Protocol::SubQueueInfosArray subQueueInfos(s_allocator_p);
+
+    for (int numSubQueueInfos = 0; numSubQueueInfos <= 4;
+         numSubQueueInfos += 4) {
+        generateSubQueueInfos(&subQueueInfos, numSubQueueInfos);
+
+        for (int i = 0; i < k_NUM_LENGTHS; ++i) {
+            const int length   = k_LENGTHS[i];
+            const int numIters = static_cast<int>(k_TOTAL_BYTES /
+                                                  (k_NUM_MSGS * length));
+
+            bdlbb::Blob       payload(&bufferFactory, s_allocator_p);
+            const bsl::string str(length, 'x', s_allocator_p);
+            bdlbb::BlobUtil::append(&payload, str.c_str(), length);
+
+            // Warm up
+            ASSERT_EQ_D(numSubQueueInfos << ", " << length,
+                        k_NUM_MSGS * length,
+                        packAndIterate(&builder,
+                                       &iter,
+                                       payload,
+                                       subQueueInfos,
+                                       k_NUM_MSGS));
+
+            bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+            for (int j = 0; j < numIters; ++j) {
+                packAndIterate(&builder,
+                               &iter,
+                               payload,
+                               subQueueInfos,
+                               k_NUM_MSGS);
+            }
+            bsls::Types::Int64 endTime = bsls::TimeUtil::getTimer();
+
+            const bsls::Types::Int64 numBytes =
+                static_cast<bsls::Types::Int64>(numIters) * k_NUM_MSGS *
+                length;
+
+            cout << numSubQueueInfos << " SubQueueInfos | " << setw(6)
+                 << length << " bytes | "
+                 << mwcu::PrintUtil::prettyBytes(
+                        numBytes * bdlt::TimeUnitRatio::k_NS_PER_S /
+                        (endTime - startTime))
+                 << "/s\n";
+        }
+    }
+}
+
+// Begin Benchmarking Tests
+#ifdef BSLS_PLATFORM_OS_LINUX
+static void testN2_packAndIterate_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// BENCHMARK: PACK AND ITERATE
+//
+// Concerns:
+//   Measure the throughput of building a PUSH event and of iterating over
+//   its messages.  'state.range(0)' is the number of SubQueueInfos of the
+//   messages, and 'state.range(1)' the size of their payloads.
+// ------------------------------------------------------------------------
+{
+    const int length  = state.range(1);
+    const int numMsgs = 100;
+
+    bdlbb::PooledBlobBufferFactory     bufferFactory(4096, s_allocator_p);
+    bmqp::PushEventBuilder             builder(&bufferFactory, s_allocator_p);
+    bmqp::PushMessageIterator          iter(&bufferFactory, s_allocator_p);
+    bmqp::Protocol::SubQueueInfosArray subQueueInfos(s_allocator_p);
+    bdlbb::Blob                        payload(&bufferFactory, s_allocator_p);
+    const bsl::string                  str(length, 'x', s_allocator_p);
+
+    generateSubQueueInfos(&subQueueInfos, static_cast<int>(state.range(0)));
+    bdlbb::BlobUtil::append(&payload, str.c_str(), length);
+
+    // <time>
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(packAndIterate(&builder,
+                                                &iter,
+                                                payload,
+                                                subQueueInfos,
+                                                numMsgs));
+    }
+    // </time>
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            numMsgs * length);
+}
+#endif  // BSLS_PLATFORM_OS_LINUX
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1232,6 +1548,7 @@ int main(int argc, char* argv[])
     //                  encoding RDA counters.
     switch (_testCase) {
     case 0:
+    case 9: test9_buildEventZeroCopy(); break;
     case 8: test8_buildEventTooBig(); break;
     case 7: test7_buildEventOptionTooBig(); break;
     case 6: test6_buildEventWithImplicitPayload(); break;
@@ -1241,11 +1558,22 @@ int main(int argc, char* argv[])
     case 2: test2_buildEventBackwardsCompatibility(); break;
     case 1: test1_breathingTest(); break;
     case -1: testN1_decodeFromFile(); break;
+    case -2:
+        MWC_BENCHMARK_WITH_ARGS(
+            testN2_packAndIterate,
+            Apply(populateSubQueueInfosAndLengths_GoogleBenchmark));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
     } break;
     }
+#ifdef BSLS_PLATFORM_OS_LINUX
+    if (_testCase < 0) {
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+    }
+#endif
 
     bmqp::ProtocolUtil::shutdown();
 
@@ -51,6 +51,8 @@ void PushMessageIterator::copyFrom(const PushMessageIterator& src)
     d_messagePropertiesSize      = src.d_messagePropertiesSize;
     d_applicationDataPosition    = src.d_applicationDataPosition;
     d_advanceLength              = src.d_advanceLength;
+    d_headerSizes                = src.d_headerSizes;
+    d_headerIndex                = src.d_headerIndex;
     d_optionsSize                = src.d_optionsSize;
     d_optionsPosition            = src.d_optionsPosition;
     d_decompressFlag             = src.d_decompressFlag;
@@ -400,6 +402,51 @@ int PushMessageIterator::loadMessagePayload(bdlbb::Blob* blob) const
     return rc_SUCCESS;
 }
 
+int PushMessageIterator::loadMessagePayloadBuffers(
+    bsl::vector<bdlbb::BlobBuffer>* buffers) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isValid());
+    BSLS_ASSERT_SAFE(d_decompressFlag);
+    BSLS_ASSERT_SAFE(buffers);
+
+    enum RcEnum {
+        rc_SUCCESS                = 0,
+        rc_IMPLICIT_APP_DATA      = -1,
+        rc_INVALID_PAYLOAD_OFFSET = -2,
+        rc_INVALID_PAYLOAD_LENGTH = -3
+    };
+
+    if (isApplicationDataImplicit()) {
+        buffers->clear();
+        return rc_IMPLICIT_APP_DATA;  // RETURN
+    }
+
+    if (hasMessageProperties() &&
+        (d_lazyMessagePayloadPosition == mwcu::BlobPosition())) {
+        // See comment in 'loadMessagePayload'.
+
+        int rc = loadMessagePayloadPosition();
+        if (0 != rc) {
+            buffers->clear();
+            return rc * 10 + rc_INVALID_PAYLOAD_OFFSET;  // RETURN
+        }
+
+        BSLS_ASSERT_SAFE(d_lazyMessagePayloadPosition != mwcu::BlobPosition());
+    }
+
+    int rc = mwcu::BlobUtil::loadBuffers(buffers,
+                                         d_applicationData,
+                                         d_lazyMessagePayloadPosition,
+                                         messagePayloadSize());
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return (rc * 10 + rc_INVALID_PAYLOAD_LENGTH);  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
 void PushMessageIterator::extractQueueInfo(int*          queueId,
                                            unsigned int* subscriptionId,
                                            RdaInfo*      rdaInfo) const
@@ -530,52 +577,71 @@ int PushMessageIterator::next()
 
     d_advanceLength = -1;
 
-    // Read PushHeader, supporting protocol evolution by reading as many bytes
-    // as the header declares (and not as many as the size of the struct)
-    mwcu::BlobObjectProxy<PushHeader> header(d_blobIter.blob(),
-                                             d_blobIter.position(),
-                                             -PushHeader::k_MIN_HEADER_SIZE,
-                                             true,
-                                             false);
+    mwcu::BlobObjectProxy<PushHeader> header;
+    int                               messageSize;
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!header.isSet())) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        // We couldn't read a PushHeader.. set the state of this iterator to
-        // invalid
-        return rc_NO_PUSH_HEADER;  // RETURN
-    }
+    if (d_headerIndex < d_headerSizes.size()) {
+        // The sizes declared by this header were validated by 'prescan'.
+        header.resetRaw(d_blobIter.blob(),
+                        d_blobIter.position(),
+                        d_headerSizes[d_headerIndex++],
+                        true,
+                        false);
+        BSLS_ASSERT_SAFE(header.isSet());
 
-    const int headerSize = header->headerWords() * Protocol::k_WORD_SIZE;
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(headerSize <
-                                              PushHeader::k_MIN_HEADER_SIZE)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        // Header is declaring less bytes than expected, probably this is
-        // because header is malformed
-        return rc_NO_PUSH_HEADER;  // RETURN
+        d_header    = *header;
+        messageSize = d_header.messageWords() * Protocol::k_WORD_SIZE;
     }
+    else {
+        // Read PushHeader, supporting protocol evolution by reading as many
+        // bytes as the header declares (and not as many as the size of the
+        // struct)
+        header.reset(d_blobIter.blob(),
+                     d_blobIter.position(),
+                     -PushHeader::k_MIN_HEADER_SIZE,
+                     true,
+                     false);
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!header.isSet())) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            // We couldn't read a PushHeader.. set the state of this iterator
+            // to invalid
+            return rc_NO_PUSH_HEADER;  // RETURN
+        }
 
-    header.resize(headerSize);
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!header.isSet())) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return rc_NO_PUSH_HEADER;  // RETURN
-    }
+        const int headerSize = header->headerWords() * Protocol::k_WORD_SIZE;
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                headerSize < PushHeader::k_MIN_HEADER_SIZE)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            // Header is declaring less bytes than expected, probably this is
+            // because header is malformed
+            return rc_NO_PUSH_HEADER;  // RETURN
+        }
 
-    d_header              = *header;
-    const int messageSize = d_header.messageWords() * Protocol::k_WORD_SIZE;
-    // Validation: must ensure that 'messageSize > 0', or iteration process
-    // via 'next()' might be infinite
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(messageSize == 0)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        // Set the state of this iterator to invalid
-        return rc_INVALID_MESSAGE_SIZE;  // RETURN
-    }
+        header.resize(headerSize);
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!header.isSet())) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            return rc_NO_PUSH_HEADER;  // RETURN
+        }
 
-    // Validation: make sure blob has enough data as indicated by PushHeader
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_blobIter.remaining() <
-                                              messageSize)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        // Set the state of this iterator to invalid
-        return rc_NOT_ENOUGH_BYTES;  // RETURN
+        d_header    = *header;
+        messageSize = d_header.messageWords() * Protocol::k_WORD_SIZE;
+        // Validation: must ensure that 'messageSize > 0', or iteration
+        // process via 'next()' might be infinite
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(messageSize == 0)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            // Set the state of this iterator to invalid
+            return rc_INVALID_MESSAGE_SIZE;  // RETURN
+        }
+
+        // Validation: make sure blob has enough data as indicated by
+        // PushHeader
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_blobIter.remaining() <
+                                                  messageSize)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            // Set the state of this iterator to invalid
+            return rc_NOT_ENOUGH_BYTES;  // RETURN
+        }
     }
 
     const bool loadOptionsPosition = OptionUtil::loadOptionsPosition(
@@ -618,8 +684,34 @@ int PushMessageIterator::next()
     const bool haveMPs = PushHeaderFlagUtil::isSet(
         d_header.flags(),
         PushHeaderFlags::e_MESSAGE_PROPERTIES);
+    int length = compressedApplicationDataSize();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+            !haveMPs && 0 <= length &&
+            d_header.compressionAlgorithmType() ==
+                bmqt::CompressionAlgorithmType::e_NONE)) {
+        // Fast path for the most common shape of message, having neither
+        // properties nor compressed data: append the application data from
+        // its position.  'ProtocolUtil::parse' below dispatches on both
+        // properties and compression, and converts that position to an
+        // offset by walking the blob from its first buffer, which makes
+        // iterating an event quadratic in its number of buffers.
+        rc = mwcu::BlobUtil::appendToBlob(&d_applicationData,
+                                          *d_blobIter.blob(),
+                                          d_applicationDataPosition,
+                                          length);
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            d_applicationData.removeAll();
+            return rc * 100 + rc_PARSING_ERROR;  // RETURN
+        }
+
+        d_applicationDataSize = length;
+        d_advanceLength       = messageSize;
+        return rc_HAS_NEXT;  // RETURN
+    }
+
     const bool haveNewMPs = MessagePropertiesInfo::hasSchema(d_header);
-    int        length     = compressedApplicationDataSize();
 
     rc = ProtocolUtil::parse(0,  // do not separate MPs from data
                              &d_messagePropertiesSize,
@@ -653,6 +745,20 @@ int PushMessageIterator::next()
     return rc_HAS_NEXT;
 }
 
+int PushMessageIterator::prescan()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isValid());
+    BSLS_ASSERT_SAFE(d_advanceLength == 0);
+
+    d_headerIndex = 0;
+    return ProtocolUtil::scanMessageHeaders<PushHeader>(
+        &d_headerSizes,
+        *d_blobIter.blob(),
+        d_blobIter.position(),
+        d_blobIter.remaining());
+}
+
 int PushMessageIterator::reset(const bdlbb::Blob* blob,
                                const EventHeader& eventHeader,
                                bool               decompressFlag)
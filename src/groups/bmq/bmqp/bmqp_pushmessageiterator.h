@@ -67,6 +67,7 @@
 #include <bdlb_nullablevalue.h>
 #include <bdlbb_blob.h>
 #include <bsl_ostream.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bsls_assert.h>
 
@@ -137,6 +138,14 @@ class PushMessageIterator {
     // iterator is considered in invalid
     // state if this value is == -1.
 
+    bsl::vector<int> d_headerSizes;
+    // Sizes of the headers of the messages
+    // validated by 'prescan', if any.
+
+    size_t d_headerIndex;
+    // Index in 'd_headerSizes' of the size
+    // of the header of the next message.
+
     mutable NullableOptionsView d_optionsView;
     // The OptionsView for this iterator.
 
@@ -226,6 +235,17 @@ class PushMessageIterator {
     /// and `isValid`.
     int next();
 
+    /// Validate, in one pass, the sizes declared by the headers of all the
+    /// messages of the event, so that subsequent calls to `next` do not
+    /// have to.  Return 0 on success, or a negative value if a header is
+    /// invalid, in which case `next` validates the headers from the invalid
+    /// one on as if this method was not called.  The behavior is undefined
+    /// unless `isValid` returns true and `next` was not called since the
+    /// last call to `reset`.  Note that this costs an extra pass over the
+    /// headers and the allocation of a table of their sizes, and is only
+    /// beneficial to events made of many small messages: callers opt in.
+    int prescan();
+
     /// Reset this instance using the specified `blob` and `eventHeader` and
     /// the specified `decompressFlag`. The behaviour is undefined if the
     /// `blob` pointer is null, or the pointed-to blob does not contain
@@ -354,6 +374,16 @@ class PushMessageIterator {
     /// `d_decompressFlag` is true.
     int loadMessagePayload(bdlbb::Blob* blob) const;
 
+    /// Load into the specified `buffers` the blob buffers holding the
+    /// payload for the message currently pointed to by this iterator,
+    /// aliasing (and sharing ownership of) the underlying memory instead of
+    /// copying it.  Return zero on success, and a non-zero value in case of
+    /// failure or if application data is implicit.  Behavior is undefined
+    /// unless latest call to `next()` returned 1 and `d_decompressFlag` is
+    /// true.  See `mwcu::BlobUtil::loadBuffers`.
+    int
+    loadMessagePayloadBuffers(bsl::vector<bdlbb::BlobBuffer>* buffers) const;
+
     /// Return the size (in bytes) of options for the message currently
     /// pointed to by this iterator.  Behavior is undefined unless latest
     /// call to `next()` returned 1.  Note that this length includes
@@ -406,6 +436,8 @@ inline PushMessageIterator::PushMessageIterator(
 , d_optionsSize(0)
 , d_optionsPosition()
 , d_advanceLength(-1)
+, d_headerSizes(allocator)
+, d_headerIndex(0)
 , d_optionsView(allocator)
 , d_decompressFlag(false)
 , d_applicationData(bufferFactory, allocator)
@@ -422,6 +454,8 @@ inline PushMessageIterator::PushMessageIterator(
     bdlbb::BlobBufferFactory* bufferFactory,
     bslma::Allocator*         allocator)
 : d_blobIter(0, mwcu::BlobPosition(), 0, true)  // no def ctor - set in reset
+, d_headerSizes(allocator)
+, d_headerIndex(0)
 , d_optionsView(allocator)
 , d_decompressFlag(decompressFlag)
 , d_applicationData(bufferFactory, allocator)
@@ -437,6 +471,7 @@ inline PushMessageIterator::PushMessageIterator(const PushMessageIterator& src,
              mwcu::BlobPosition(),
              0,
              true)  // no def ctor - set in copyFrom
+, d_headerSizes(allocator)
 , d_applicationData(src.d_bufferFactory_p, allocator)
 , d_bufferFactory_p(src.d_bufferFactory_p)
 , d_allocator_p(allocator)
@@ -467,6 +502,8 @@ inline void PushMessageIterator::clear()
     d_optionsSize                = 0;
     d_optionsPosition            = mwcu::BlobPosition();
     d_advanceLength              = -1;
+    d_headerIndex                = 0;
+    d_headerSizes.clear();
     d_applicationData.removeAll();
     d_optionsView.reset();
 }
@@ -22,6 +22,7 @@
 #include <bmqp_optionutil.h>
 #include <bmqp_protocol.h>
 #include <bmqp_protocolutil.h>
+#include <bmqp_pusheventbuilder.h>
 #include <bmqp_queueid.h>
 #include <bmqt_messageguid.h>
 
@@ -40,12 +41,22 @@
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
 #include <bsl_unordered_set.h>
+#include <bsl_vector.h>
+#include <bsla_maybeunused.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
 
 // TEST DRIVER
 #include <mwctst_testhelper.h>
 
+// BENCHMARKING LIBRARY
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <benchmark/benchmark.h>
+#endif
+
 // CONVENIENCE
 using namespace BloombergLP;
 using namespace bsl;
@@ -772,6 +783,15 @@ void breathingTestHelper(
         ASSERT_EQ(0,
                   bdlbb::BlobUtil::compare(retrievedPayloadBlob,
                                            expectedBlob));
+
+        bsl::vector<bdlbb::BlobBuffer> payloadBuffers(s_allocator_p);
+        ASSERT_EQ(0, iter.loadMessagePayloadBuffers(&payloadBuffers));
+        bdlbb::Blob payloadFromBuffers(s_allocator_p);
+        for (size_t i = 0; i < payloadBuffers.size(); ++i) {
+            payloadFromBuffers.appendDataBuffer(payloadBuffers[i]);
+        }
+        ASSERT_EQ(0,
+                  bdlbb::BlobUtil::compare(payloadFromBuffers, expectedBlob));
     }
 
     bmqp::OptionsView emptyOptionsView(s_allocator_p);
@@ -880,6 +900,64 @@ void breathingTestHelper(
     ASSERT_EQ(false, iter.next());
     ASSERT_EQ(false, iter.isValid());
 }
+
+/// Build, using the specified `builder`, a PUSH event of the specified
+/// `numMsgs` messages having neither properties nor compressed data, each
+/// having a payload of the specified `payloadSize` bytes.
+void buildPlainEvent(bmqp::PushEventBuilder*   builder,
+                     int                       numMsgs,
+                     int                       payloadSize,
+                     bdlbb::BlobBufferFactory* bufferFactory)
+{
+    bmqt::MessageGUID guid;
+    guid.fromHex("0000000000003039CD8101000000270F");
+
+    bdlbb::Blob       payload(bufferFactory, s_allocator_p);
+    bsl::vector<char> payloadData(payloadSize, 'x', s_allocator_p);
+    bdlbb::BlobUtil::append(&payload, payloadData.data(), payloadSize);
+
+    builder->reset();
+    for (int i = 0; i < numMsgs; ++i) {
+        bmqt::EventBuilderResult::Enum rc = builder->packMessage(
+            payload,
+            i,
+            guid,
+            0,
+            bmqt::CompressionAlgorithmType::e_NONE);
+        BSLS_ASSERT_OPT(rc == bmqt::EventBuilderResult::e_SUCCESS);
+        (void)rc;
+    }
+}
+
+/// Iterate over the messages of the PUSH event held by the specified
+/// `blob`, loading the application data of each of them, using the
+/// specified `bufferFactory`, and return the number of messages.
+int iterateEvent(const bdlbb::Blob&        blob,
+                 bdlbb::BlobBufferFactory* bufferFactory)
+{
+    bmqp::EventHeader eventHeader;
+    bdlbb::BlobUtil::copy(reinterpret_cast<char*>(&eventHeader),
+                          blob,
+                          0,
+                          sizeof(eventHeader));
+
+    bmqp::PushMessageIterator iter(&blob,
+                                   eventHeader,
+                                   true,  // decompress flag
+                                   bufferFactory,
+                                   s_allocator_p);
+    bdlbb::Blob               appData(bufferFactory, s_allocator_p);
+
+    int numMsgs = 0;
+    while (iter.next() == 1) {
+        iter.loadApplicationData(&appData);
+        appData.removeAll();
+        ++numMsgs;
+    }
+
+    return numMsgs;
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -1530,6 +1608,289 @@ static void test7_extractOptions()
     }
 }
 
+/// Test that `prescan` succeeds over a valid PUSH event, in which case
+/// iterating yields the same messages as without it, and that it fails over
+/// an invalid PUSH event, in which case `next` still iterates over the valid
+/// messages, and then fails.
+static void test8_prescan()
+{
+    mwctst::TestHelper::printTestName("PRESCAN");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(128, s_allocator_p);
+
+    {
+        PVV("VALID PUSH EVENT");
+        bdlbb::Blob       eventBlob(&bufferFactory, s_allocator_p);
+        bsl::vector<Data> data(s_allocator_p);
+        bmqp::EventHeader eventHeader;
+        const size_t      k_NUM_MSGS = 500;
+
+        populateBlob(&eventBlob,
+                     &eventHeader,
+                     &data,
+                     k_NUM_MSGS,
+                     &bufferFactory,
+                     false,  // No zero-length PUSH msgs.
+                     true,   // make some PUSH msgs w/ implicit app data
+                     s_allocator_p);
+
+        bmqp::PushMessageIterator iter(&eventBlob,
+                                       eventHeader,
+                                       true,  // decompress flag
+                                       &bufferFactory,
+                                       s_allocator_p);
+        ASSERT_EQ(true, iter.isValid());
+        ASSERT_EQ(0, iter.prescan());
+
+        size_t index = 0;
+        while ((1 == iter.next()) && index < data.size()) {
+            const Data& D = data[index];
+            ASSERT_EQ_D(index, D.d_queueId, iter.header().queueId());
+            ASSERT_EQ_D(index, D.d_guid, iter.header().messageGUID());
+            ASSERT_EQ_D(index, D.d_optionsSize, iter.optionsSize());
+
+            bdlbb::Blob appData(s_allocator_p);
+            ASSERT_EQ_D(index,
+                        iter.isApplicationDataImplicit() ? -1 : 0,
+                        iter.loadApplicationData(&appData));
+            ASSERT_EQ_D(index,
+                        0,
+                        bdlbb::BlobUtil::compare(appData, D.d_appData));
+            ++index;
+        }
+
+        ASSERT_EQ(index, data.size());
+        ASSERT_EQ(false, iter.isValid());
+    }
+
+    {
+        PVV("INVALID PUSH EVENT");
+        bdlbb::Blob       eventBlob(&bufferFactory, s_allocator_p);
+        bsl::vector<Data> data(s_allocator_p);
+        bmqp::EventHeader eventHeader;
+        const size_t      k_NUM_MSGS = 10;
+
+        populateBlob(&eventBlob,
+                     &eventHeader,
+                     &data,
+                     k_NUM_MSGS,
+                     &bufferFactory,
+                     false,  // No zero-length msgs
+                     false,  // No implicit app data
+                     s_allocator_p);
+
+        // Render the last message invalid by removing the last byte
+        bdlbb::BlobUtil::erase(&eventBlob, eventBlob.length() - 1, 1);
+
+        bmqp::PushMessageIterator iter(&eventBlob,
+                                       eventHeader,
+                                       true,  // decompress flag
+                                       &bufferFactory,
+                                       s_allocator_p);
+        ASSERT_EQ(true, iter.isValid());
+        ASSERT_LT(iter.prescan(), 0);
+
+        for (size_t i = 0; i < k_NUM_MSGS - 1; ++i) {
+            ASSERT_EQ_D(i, 1, iter.next());
+            ASSERT_EQ_D(i, data[i].d_guid, iter.header().messageGUID());
+        }
+
+        ASSERT_LT(iter.next(), 0);
+        ASSERT_EQ(false, iter.isValid());
+    }
+}
+
+static void test9_iteratePlainMessages()
+// ------------------------------------------------------------------------
+// ITERATE PLAIN MESSAGES
+//
+// Concerns:
+//   1. The application data of messages having neither properties nor
+//      compressed data, which are loaded without parsing them, is the
+//      payload they were packed with, also when it spans several buffers.
+//   2. Messages having properties, interleaved with such messages, are
+//      still parsed.
+//
+// Plan:
+//   - Build, with small buffers, a PUSH event of messages of various
+//     sizes, one in three of them having properties, and verify the
+//     application data, properties and payload of each message.
+//
+// Testing:
+//   next()
+//   loadApplicationData()
+//   loadMessagePayload()
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("ITERATE PLAIN MESSAGES");
+
+    const int k_NUM_MSGS = 100;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(64, s_allocator_p);
+    bmqp::PushEventBuilder         builder(&bufferFactory, s_allocator_p);
+    bsl::vector<bdlbb::Blob>       payloads(s_allocator_p);
+    bmqt::MessageGUID              guid;
+    guid.fromHex("0000000000003039CD8101000000270F");
+
+    for (int i = 0; i < k_NUM_MSGS; ++i) {
+        bdlbb::Blob       payload(&bufferFactory, s_allocator_p);
+        bsl::vector<char> payloadData(i % 150 + 1,
+                                      'a' + i % 26,
+                                      s_allocator_p);
+        bdlbb::BlobUtil::append(&payload,
+                                payloadData.data(),
+                                payloadData.size());
+        payloads.push_back(payload);
+
+        bdlbb::Blob                 appData(&bufferFactory, s_allocator_p);
+        bmqp::MessagePropertiesInfo info;
+        if (i % 3 == 0) {
+            bmqp::MessageProperties properties(s_allocator_p);
+            properties.setPropertyAsInt32("index", i);
+            info = bmqp::MessagePropertiesInfo::makeNoSchema();
+            bdlbb::BlobUtil::append(&appData,
+                                    properties.streamOut(&bufferFactory,
+                                                         info));
+        }
+        bdlbb::BlobUtil::append(&appData, payload);
+
+        ASSERT_EQ_D(i,
+                    bmqt::EventBuilderResult::e_SUCCESS,
+                    builder.packMessage(appData,
+                                        i,
+                                        guid,
+                                        0,
+                                        bmqt::CompressionAlgorithmType::e_NONE,
+                                        info));
+    }
+
+    bmqp::EventHeader eventHeader;
+    bdlbb::BlobUtil::copy(reinterpret_cast<char*>(&eventHeader),
+                          builder.blob(),
+                          0,
+                          sizeof(eventHeader));
+
+    bmqp::PushMessageIterator iter(&builder.blob(),
+                                   eventHeader,
+                                   true,  // decompress flag
+                                   &bufferFactory,
+                                   s_allocator_p);
+    ASSERT_EQ(true, iter.isValid());
+
+    int index = 0;
+    while (iter.next() == 1 && index < k_NUM_MSGS) {
+        const bdlbb::Blob& payload = payloads[index];
+        ASSERT_EQ_D(index, index, iter.header().queueId());
+        ASSERT_EQ_D(index, index % 3 == 0, iter.hasMessageProperties());
+
+        bdlbb::Blob appData(&bufferFactory, s_allocator_p);
+        ASSERT_EQ_D(index, 0, iter.loadApplicationData(&appData));
+        ASSERT_EQ_D(index,
+                    iter.messagePropertiesSize() + payload.length(),
+                    appData.length());
+
+        if (index % 3 == 0) {
+            bmqp::MessageProperties properties(s_allocator_p);
+            ASSERT_EQ_D(index, 0, iter.loadMessageProperties(&properties));
+            ASSERT_EQ_D(index, index, properties.getPropertyAsInt32("index"));
+        }
+        else {
+            ASSERT_EQ_D(index, 0, iter.messagePropertiesSize());
+            ASSERT_EQ_D(index, 0, bdlbb::BlobUtil::compare(appData, payload));
+        }
+
+        bdlbb::Blob messagePayload(&bufferFactory, s_allocator_p);
+        ASSERT_EQ_D(index, 0, iter.loadMessagePayload(&messagePayload));
+        ASSERT_EQ_D(index,
+                    0,
+                    bdlbb::BlobUtil::compare(messagePayload, payload));
+        ++index;
+    }
+
+    ASSERT_EQ(k_NUM_MSGS, index);
+    ASSERT_EQ(false, iter.isValid());
+}
+
+BSLA_MAYBE_UNUSED
+static void testN1_iteratePlainMessages()
+// ------------------------------------------------------------------------
+// BENCHMARK: ITERATE PLAIN MESSAGES
+//
+// Concerns:
+//   Measure the cost of iterating over a PUSH event of messages having
+//   neither properties nor compressed data, which grows with the number
+//   of buffers of the event if locating the application data of a message
+//   requires walking the event from its start.
+//
+// Plan:
+//   - For events of various numbers of messages, time a large number of
+//     iterations over the event, loading the application data of each
+//     message, and report the average time per message.
+//
+// Testing:
+//   Performance of PushMessageIterator::next.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BENCHMARK: ITERATE PLAIN MESSAGES");
+
+    const int k_PAYLOAD_SIZE = 256;
+    const int k_NUM_ITERS    = 100;
+    const int k_NUM_MSGS[]   = {100, 1000, 10000};
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(4096, s_allocator_p);
+    bmqp::PushEventBuilder         builder(&bufferFactory, s_allocator_p);
+
+    for (size_t i = 0; i < sizeof(k_NUM_MSGS) / sizeof(*k_NUM_MSGS); ++i) {
+        const int numMsgs = k_NUM_MSGS[i];
+        buildPlainEvent(&builder, numMsgs, k_PAYLOAD_SIZE, &bufferFactory);
+
+        // Warm up
+        ASSERT_EQ(numMsgs, iterateEvent(builder.blob(), &bufferFactory));
+
+        bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+        for (int j = 0; j < k_NUM_ITERS; ++j) {
+            iterateEvent(builder.blob(), &bufferFactory);
+        }
+        bsls::Types::Int64 endTime = bsls::TimeUtil::getTimer();
+
+        cout << "Messages: " << numMsgs
+             << ", buffers: " << builder.blob().numDataBuffers()
+             << ", average time per message (ns): "
+             << (endTime - startTime) / (k_NUM_ITERS * numMsgs) << '\n';
+    }
+}
+
+// Begin Benchmarking Tests
+#ifdef BSLS_PLATFORM_OS_LINUX
+static void
+testN1_iteratePlainMessages_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// BENCHMARK: ITERATE PLAIN MESSAGES
+//
+// Concerns:
+//   Measure the cost of iterating over a PUSH event of 'state.range(0)'
+//   messages having neither properties nor compressed data.
+// ------------------------------------------------------------------------
+{
+    const int numMsgs = state.range(0);
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(4096, s_allocator_p);
+    bmqp::PushEventBuilder         builder(&bufferFactory, s_allocator_p);
+
+    buildPlainEvent(&builder, numMsgs, 256, &bufferFactory);
+
+    // <time>
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            iterateEvent(builder.blob(), &bufferFactory));
+    }
+    // </time>
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            numMsgs);
+}
+#endif  // BSLS_PLATFORM_OS_LINUX
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1560,6 +1921,8 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 9: test9_iteratePlainMessages(); break;
+    case 8: test8_prescan(); break;
     case 7: test7_extractOptions(); break;
     case 6: test6_iteratePushEventHavingZeroLengthMessages(); break;
     case 5: test5_iteratePushEventHavingMultipleMessages(); break;
@@ -1567,11 +1930,21 @@ int main(int argc, char* argv[])
     case 3: test3_iteratePushEventHavingNoMessages(); break;
     case 2: test2_iteratorReset(); break;
     case 1: test1_breathingTest(); break;
+    case -1:
+        MWC_BENCHMARK_WITH_ARGS(testN1_iteratePlainMessages,
+                                Arg(100)->Arg(1000)->Arg(10000));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
     } break;
     }
+#ifdef BSLS_PLATFORM_OS_LINUX
+    if (_testCase < 0) {
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+    }
+#endif
 
     bmqp::ProtocolUtil::shutdown();
 
@@ -25,16 +25,17 @@
 
 // MWC
 #include <mwcu_blob.h>
-#include <mwcu_blobobjectproxy.h>
 #include <mwcu_memoutstream.h>
 
 // BDE
 #include <bdlb_scopeexit.h>
 #include <bdlbb_blobutil.h>
 #include <bdlf_bind.h>
+#include <bdlmt_fixedthreadpool.h>
 #include <bsl_cstring.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
+#include <bslmt_semaphore.h>
 #include <bsls_annotation.h>
 #include <bsls_performancehint.h>
 
@@ -48,8 +49,239 @@ bool isWordAligned(const bdlbb::Blob& blob)
     return (blob.length() % Protocol::k_WORD_SIZE) == 0;
 }
 #endif
+
+/// Return the application data made of the content of the specified
+/// `properties` blob, which may be empty, followed by the specified
+/// `payload`, appending `payload` to `properties` if needed.  Append the
+/// buffers of `payload` by reference if the specified `byReference` is
+/// true, and copy them otherwise.
+const bdlbb::Blob& makeApplicationData(bdlbb::Blob*       properties,
+                                       const bdlbb::Blob& payload,
+                                       bool               byReference)
+{
+    if (0 == properties->length()) {
+        // No properties: the payload is the entire application data.
+        return payload;  // RETURN
+    }
+
+    if (0 == payload.length()) {
+        return *properties;  // RETURN
+    }
+
+    if (byReference) {
+        mwcu::BlobUtil::appendToBlob(properties,
+                                     payload,
+                                     mwcu::BlobPosition());
+    }
+    else {
+        bdlbb::BlobUtil::append(properties, payload);
+    }
+
+    return *properties;
+}
+
+/// Append to the specified `event` a message made of the specified
+/// `header`, whose sizes are set by this function, the MsgGroupId option
+/// for the specified `msgGroupId`, if not null, and the specified `appData`
+/// followed by its padding.  Append `appData` by reference if the specified
+/// `zeroCopy` is true and it is large enough, and copy it otherwise.  The
+/// behavior is undefined unless the message is valid.
+void appendMessage(bdlbb::Blob*                               event,
+                   PutHeader                                  header,
+                   const PutEventBuilder::NullableMsgGroupId& msgGroupId,
+                   const bdlbb::Blob&                         appData,
+                   bool                                       zeroCopy)
+{
+    typedef OptionUtil::OptionMeta OptionMeta;
+
+    const int appDataLength   = appData.length();
+    int       numPaddingBytes = 0;
+    const int numWords = ProtocolUtil::calcNumWordsAndPadding(&numPaddingBytes,
+                                                              appDataLength);
+
+    // Reserve the PutHeader, which is written once the size of the options
+    // is known.
+    mwcu::BlobPosition headerPosition;
+    mwcu::BlobUtil::reserve(&headerPosition, event, sizeof(PutHeader));
+
+    OptionUtil::OptionsBox optionBox;
+    if (!msgGroupId.isNull()) {
+        const OptionMeta meta = OptionMeta::forOptionWithPadding(
+            OptionType::e_MSG_GROUP_ID,
+            msgGroupId.value().length());
+        optionBox.add(event,
+                      reinterpret_cast<const char*>(msgGroupId.value().data()),
+                      meta);
+    }
+
+    const int headerWords = sizeof(PutHeader) / Protocol::k_WORD_SIZE;
+    const int optionsSize = optionBox.size();
+    BSLS_ASSERT_SAFE(0 == optionsSize % Protocol::k_WORD_SIZE);
+    const int optionsWords = optionsSize / Protocol::k_WORD_SIZE;
+
+    header.setHeaderWords(headerWords)
+        .setOptionsWords(optionsWords)
+        .setMessageWords(headerWords + optionsWords + numWords);
+    mwcu::BlobUtil::writeBytes(event,
+                               headerPosition,
+                               reinterpret_cast<const char*>(&header),
+                               sizeof(PutHeader));
+
+    if (zeroCopy && appDataLength >= Protocol::k_ZERO_COPY_MIN_APPDATA_SIZE) {
+        // Add the application data, by reference, and padding
+        ProtocolUtil::appendByReference(event, appData, numPaddingBytes);
+    }
+    else {
+        bdlbb::BlobUtil::append(event, appData);
+
+        // Add padding
+        ProtocolUtil::appendPaddingRaw(event, numPaddingBytes);
+    }
+}
+
 }  // close unnamed namespace
 
+// ====================================
+// class PutEventBuilder_PendingMessage
+// ====================================
+
+/// A message whose payload is being compressed by a thread of the
+/// compression thread pool of a `PutEventBuilder`.
+class PutEventBuilder_PendingMessage {
+  private:
+    // DATA
+    int d_offset;
+    // Offset, in the event being built, at which
+    // this message is to be spliced.
+
+    PutHeader d_header;
+    // Header of this message, but the sizes and the
+    // CRC32-C.
+
+    PutEventBuilder::NullableMsgGroupId d_msgGroupId;
+
+    const CompressionDictionary* d_dictionary_p;
+
+    int d_zstdLevel;
+
+    bdlbb::Blob d_properties;
+
+    bdlbb::Blob d_payload;
+
+    bdlbb::Blob d_message;
+    // This message, once its payload is compressed.
+
+    bslmt::Semaphore d_done;
+    // Posted once 'd_message' is built.
+
+    bdlbb::BlobBufferFactory* d_bufferFactory_p;
+
+    bslma::Allocator* d_allocator_p;
+
+  private:
+    // NOT IMPLEMENTED
+    PutEventBuilder_PendingMessage(const PutEventBuilder_PendingMessage&);
+    PutEventBuilder_PendingMessage&
+    operator=(const PutEventBuilder_PendingMessage&);
+
+  public:
+    // CREATORS
+
+    /// Create a message to be spliced at the specified `offset`, made of
+    /// the specified `header`, `msgGroupId`, `properties` and `payload`,
+    /// the latter to be compressed using the specified `dictionary` if not
+    /// 0, and the compression algorithm type of `header`, at the specified
+    /// `zstdLevel` if it is `e_ZSTD`, otherwise.  Use
+    /// the specified `bufferFactory` and `allocator` to supply memory.
+    /// Note that the buffers of `properties` and `payload` are referred to,
+    /// not copied.
+    PutEventBuilder_PendingMessage(
+        int                                        offset,
+        const PutHeader&                           header,
+        const PutEventBuilder::NullableMsgGroupId& msgGroupId,
+        const CompressionDictionary*               dictionary,
+        int                                        zstdLevel,
+        const bdlbb::Blob&                         properties,
+        const bdlbb::Blob&                         payload,
+        bdlbb::BlobBufferFactory*                  bufferFactory,
+        bslma::Allocator*                          allocator)
+    : d_offset(offset)
+    , d_header(header)
+    , d_msgGroupId(msgGroupId, allocator)
+    , d_dictionary_p(dictionary)
+    , d_zstdLevel(zstdLevel)
+    , d_properties(properties, allocator)
+    , d_payload(payload, allocator)
+    , d_message(bufferFactory, allocator)
+    , d_done()
+    , d_bufferFactory_p(bufferFactory)
+    , d_allocator_p(allocator)
+    {
+        // NOTHING
+    }
+
+    // MANIPULATORS
+
+    /// Compress the payload of this message and build it.
+    void build()
+    {
+        // executed by a thread of the compression thread pool
+
+        bdlbb::Blob        compressed(d_bufferFactory_p, d_allocator_p);
+        mwcu::MemOutStream error(d_allocator_p);
+
+        const int rc = d_dictionary_p
+                           ? Compression::compress(&compressed,
+                                                   d_bufferFactory_p,
+                                                   *d_dictionary_p,
+                                                   d_payload,
+                                                   &error,
+                                                   d_allocator_p)
+                           : Compression::compress(
+                                 &compressed,
+                                 d_bufferFactory_p,
+                                 d_header.compressionAlgorithmType(),
+                                 d_zstdLevel,
+                                 d_payload,
+                                 &error,
+                                 d_allocator_p);
+
+        const bdlbb::Blob* payload = &compressed;
+        if (rc != 0 || compressed.length() >= d_payload.length()) {
+            // Not worth using, fall back to the original payload.
+            payload = &d_payload;
+            d_header.setCompressionAlgorithmType(
+                bmqt::CompressionAlgorithmType::e_NONE);
+        }
+
+        // The blobs are owned by this object, so they can always be referred
+        // to.
+        const bdlbb::Blob& appData = makeApplicationData(&d_properties,
+                                                         *payload,
+                                                         true);  // byRef
+        d_header.setCrc32c(Crc32c::calculate(appData));
+        appendMessage(&d_message,
+                      d_header,
+                      d_msgGroupId,
+                      appData,
+                      true);  // zeroCopy
+
+        d_done.post();
+    }
+
+    /// Wait for this message to be built.
+    void wait() { d_done.wait(); }
+
+    // ACCESSORS
+
+    /// Return the offset at which this message is to be spliced.
+    int offset() const { return d_offset; }
+
+    /// Return this message.  The behavior is undefined unless `wait` has
+    /// returned.
+    const bdlbb::Blob& message() const { return d_message; }
+};
+
 // ---------------------
 // class PutEventBuilder
 // ---------------------
@@ -64,11 +296,104 @@ void PutEventBuilder::resetFields(void* ptr)
 
 bmqt::EventBuilderResult::Enum
 PutEventBuilder::packMessageInternal(const bdlbb::Blob& appData, int queueId)
+{
+    typedef bmqt::EventBuilderResult Result;
+
+    int          messageSize = 0;
+    Result::Enum res         = validateMessage(&messageSize, appData.length());
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(res != Result::e_SUCCESS)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return res;  // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(!d_messageGUID.isUnset());
+
+    appendMessage(&d_blob,
+                  makeHeader(queueId),
+                  d_msgGroupId,
+                  appData,
+                  d_zeroCopy);
+
+    // Just a sanity test.  Should still be word aligned.
+    BSLS_ASSERT_SAFE(isWordAligned(d_blob));
+
+    ++d_msgCount;
+
+    return Result::e_SUCCESS;
+}
+
+bool PutEventBuilder::packMessageAsync(
+    bmqt::EventBuilderResult::Enum* result,
+    const bdlbb::Blob&              properties,
+    const bdlbb::Blob&              payload,
+    const CompressionDictionary*    dictionary,
+    int                             queueId)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_compressionThreadPool_p);
+
+    typedef bmqt::EventBuilderResult Result;
+
+    // Validate the message as if it was not compressed, which is the worst
+    // case.
+    int messageSize = 0;
+    *result         = validateMessage(&messageSize,
+                              properties.length() + payload.length());
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(*result != Result::e_SUCCESS)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return true;  // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(!d_messageGUID.isUnset());
+
+    // Unless in zero-copy mode, the payload of the application may be
+    // modified once this method returns: copy it.
+    bdlbb::Blob payloadCopy(d_bufferFactory_p, d_allocator_p);
+    if (d_zeroCopy || d_rawPayload_p) {
+        // Raw payloads were already copied by the caller.
+        payloadCopy = payload;
+    }
+    else {
+        bdlbb::BlobUtil::append(&payloadCopy, payload);
+    }
+
+    bsl::shared_ptr<PutEventBuilder_PendingMessage> message;
+    message.createInplace(d_allocator_p,
+                          d_blob.length(),
+                          makeHeader(queueId),
+                          d_msgGroupId,
+                          dictionary,
+                          d_zstdCompressionLevel,
+                          properties,
+                          payloadCopy,
+                          d_bufferFactory_p,
+                          d_allocator_p);
+
+    const int rc = d_compressionThreadPool_p->tryEnqueueJob(
+        bdlf::BindUtil::bind(&PutEventBuilder_PendingMessage::build,
+                             message));
+    if (rc != 0) {
+        // Likely the thread pool is stopped.
+        return false;  // RETURN
+    }
+
+    d_pendingMessages.push_back(message);
+    d_pendingMessagesSize += messageSize;
+
+    ++d_msgCount;
+
+    // The compression ratio is not known yet.
+    d_lastPackedMessageCompressionRatio = 1;
+
+    return true;
+}
+
+bmqt::EventBuilderResult::Enum
+PutEventBuilder::validateMessage(int* messageSize, int appDataLength) const
 {
     typedef bmqt::EventBuilderResult Result;
     typedef OptionUtil::OptionMeta   OptionMeta;
 
-    int       appDataLength   = appData.length();
     int       numPaddingBytes = 0;
     const int numWords = ProtocolUtil::calcNumWordsAndPadding(&numPaddingBytes,
                                                               appDataLength);
@@ -80,8 +405,8 @@ PutEventBuilder::packMessageInternal(const bdlbb::Blob& appData, int queueId)
         return Result::e_PAYLOAD_TOO_BIG;  // RETURN
     }
 
-    const int sizeNoOptions = eventSize() + sizeof(PutHeader) + appDataLength +
-                              numPaddingBytes;
+    const int sizeNoOptions = eventSize() + sizeof(PutHeader) +
+                              numWords * Protocol::k_WORD_SIZE;
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(sizeNoOptions >
                                               EventHeader::k_MAX_SIZE_SOFT)) {
@@ -89,20 +414,8 @@ PutEventBuilder::packMessageInternal(const bdlbb::Blob& appData, int queueId)
         return Result::e_EVENT_TOO_BIG;  // RETURN
     }
 
-    // Add the PutHeader
-    mwcu::BlobPosition offset;
-    mwcu::BlobUtil::reserve(&offset, &d_blob, sizeof(PutHeader));
-    mwcu::BlobObjectProxy<PutHeader> putHeader(&d_blob,
-                                               offset,
-                                               false,  // no read
-                                               true);  // write mode
-    // Make sure memory is reset
-    bsl::memset(static_cast<void*>(putHeader.object()),
-                0,
-                sizeof(bmqp::PutHeader));
-
-    // Add option(s) if they fit.
-    OptionUtil::OptionsBox optionBox;
+    // Check option(s) fit.
+    int optionsSize = 0;
     if (!d_msgGroupId.isNull()) {
         const OptionMeta msgGroupId = OptionMeta::forOptionWithPadding(
             OptionType::e_MSG_GROUP_ID,
@@ -112,49 +425,70 @@ PutEventBuilder::packMessageInternal(const bdlbb::Blob& appData, int queueId)
             BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
             return res;  // RETURN
         }
+        OptionUtil::OptionsBox optionBox;
         res = optionBox.canAdd(sizeNoOptions, msgGroupId);
         if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(res != Result::e_SUCCESS)) {
             BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
             return res;  // RETURN
         }
-        optionBox.add(
-            &d_blob,
-            reinterpret_cast<const char*>(d_msgGroupId.value().data()),
-            msgGroupId);
+        optionsSize = msgGroupId.size();
     }
 
-    const int headerWords = sizeof(bmqp::PutHeader) / Protocol::k_WORD_SIZE;
-    const int optionsSize = optionBox.size();
-    BSLS_ASSERT_SAFE(0 == optionsSize % Protocol::k_WORD_SIZE);
-    const int optionsWords = optionsSize / Protocol::k_WORD_SIZE;
+    *messageSize = sizeNoOptions - eventSize() + optionsSize;
 
-    (*putHeader)
-        .setHeaderWords(headerWords)
-        .setOptionsWords(optionsWords)
-        .setQueueId(queueId)
-        .setMessageWords(headerWords + optionsWords + numWords)
+    return Result::e_SUCCESS;
+}
+
+PutHeader PutEventBuilder::makeHeader(int queueId) const
+{
+    PutHeader header;
+    header.setQueueId(queueId)
         .setFlags(d_flags)
         .setCompressionAlgorithmType(d_compressionAlgorithmType)
-        .setCrc32c(d_crc32c);
-
-    d_messagePropertiesInfo.applyTo(putHeader.object());
+        .setCrc32c(d_crc32c)
+        .setMessageGUID(d_messageGUID);
+    d_messagePropertiesInfo.applyTo(&header);
 
-    BSLS_ASSERT_SAFE(!d_messageGUID.isUnset());
-
-    putHeader->setMessageGUID(d_messageGUID);
-    putHeader.reset();  // i.e., flush writing to blob..
-
-    // Just a sanity test.  Should still be word aligned.
-    BSLS_ASSERT_SAFE(isWordAligned(d_blob));
+    return header;
+}
 
-    bdlbb::BlobUtil::append(&d_blob, appData);
+void PutEventBuilder::splicePendingMessages() const
+{
+    bdlbb::Blob        event(d_bufferFactory_p, d_allocator_p);
+    mwcu::BlobPosition start;
+    int                offset = 0;
+
+    for (PendingMessages::const_iterator it = d_pendingMessages.begin();
+         it != d_pendingMessages.end();
+         ++it) {
+        PutEventBuilder_PendingMessage& message = **it;
+
+        // Messages packed synchronously before this one, followed by it.
+        const int length = message.offset() - offset;
+        if (length > 0) {
+            mwcu::BlobPosition end;
+            mwcu::BlobUtil::appendToBlob(&event, d_blob, start, length);
+            mwcu::BlobUtil::findOffset(&end, d_blob, start, length);
+            start  = end;
+            offset = message.offset();
+        }
 
-    // Add padding
-    ProtocolUtil::appendPaddingRaw(&d_blob, numPaddingBytes);
+        message.wait();
+        mwcu::BlobUtil::appendToBlob(&event,
+                                     message.message(),
+                                     mwcu::BlobPosition());
+    }
 
-    ++d_msgCount;
+    if (offset < d_blob.length()) {
+        mwcu::BlobUtil::appendToBlob(&event,
+                                     d_blob,
+                                     start,
+                                     d_blob.length() - offset);
+    }
 
-    return Result::e_SUCCESS;
+    d_blob = event;
+    d_pendingMessages.clear();
+    d_pendingMessagesSize = 0;
 }
 
 PutEventBuilder::PutEventBuilder(bdlbb::BlobBufferFactory* bufferFactory,
@@ -172,15 +506,39 @@ PutEventBuilder::PutEventBuilder(bdlbb::BlobBufferFactory* bufferFactory,
 , d_msgCount(0)
 , d_crc32c(0)
 , d_compressionAlgorithmType(bmqt::CompressionAlgorithmType::e_NONE)
+, d_compressionDictionary_p(0)
 , d_lastPackedMessageCompressionRatio(-1)
 , d_messagePropertiesInfo()
+, d_zeroCopy(false)
+, d_zstdCompressionLevel(Compression::k_ZSTD_DEFAULT_LEVEL)
+, d_compressionThreadPool_p(0)
+, d_pendingMessages(allocator)
+, d_pendingMessagesSize(0)
 , d_allocator_p(allocator)
 {
     reset();
 }
 
+PutEventBuilder::~PutEventBuilder()
+{
+    // The pending messages may refer to this builder's buffer factory.
+    for (PendingMessages::iterator it = d_pendingMessages.begin();
+         it != d_pendingMessages.end();
+         ++it) {
+        (*it)->wait();
+    }
+}
+
 int PutEventBuilder::reset()
 {
+    for (PendingMessages::iterator it = d_pendingMessages.begin();
+         it != d_pendingMessages.end();
+         ++it) {
+        (*it)->wait();
+    }
+    d_pendingMessages.clear();
+    d_pendingMessagesSize = 0;
+
     d_blob.removeAll();
     d_msgStarted       = false;
     d_blobPayload_p    = 0;
@@ -267,6 +625,7 @@ PutEventBuilder::packMessageInOldStyle(int queueId)
         int rc = Compression::compress(&compressedApplicationData,
                                        d_bufferFactory_p,
                                        d_compressionAlgorithmType,
+                                       d_zstdCompressionLevel,
                                        applicationData,
                                        &error,
                                        d_allocator_p);
@@ -351,18 +710,45 @@ bmqt::EventBuilderResult::Enum PutEventBuilder::packMessage(int queueId)
         payloadBlob = d_blobPayload_p;
     }
 
-    // Compress
-    if (payloadBlob->length() >= Protocol::k_COMPRESSION_MIN_APPDATA_SIZE &&
+    // Compress.  Small payloads are only worth compressing using a
+    // dictionary.
+    const CompressionDictionary* dictionary =
+        d_compressionAlgorithmType == bmqt::CompressionAlgorithmType::e_ZSTD
+            ? d_compressionDictionary_p
+            : 0;
+    const int minPayloadSize =
+        dictionary ? Protocol::k_COMPRESSION_DICTIONARY_MIN_APPDATA_SIZE
+                   : Protocol::k_COMPRESSION_MIN_APPDATA_SIZE;
+
+    if (payloadBlob->length() >= minPayloadSize &&
         d_compressionAlgorithmType != bmqt::CompressionAlgorithmType::e_NONE) {
+        Result::Enum result;
+        if (d_compressionThreadPool_p &&
+            packMessageAsync(&result,
+                             resultBlob,
+                             *payloadBlob,
+                             dictionary,
+                             queueId)) {
+            return result;  // RETURN
+        }
+
         bdlbb::Blob compressedPayloadBlob(d_bufferFactory_p, d_allocator_p);
         mwcu::MemOutStream error(d_allocator_p);
 
-        int rc = Compression::compress(&compressedPayloadBlob,
-                                       d_bufferFactory_p,
-                                       d_compressionAlgorithmType,
-                                       *payloadBlob,
-                                       &error,
-                                       d_allocator_p);
+        int rc = dictionary
+                     ? Compression::compress(&compressedPayloadBlob,
+                                             d_bufferFactory_p,
+                                             *dictionary,
+                                             *payloadBlob,
+                                             &error,
+                                             d_allocator_p)
+                     : Compression::compress(&compressedPayloadBlob,
+                                             d_bufferFactory_p,
+                                             d_compressionAlgorithmType,
+                                             d_zstdCompressionLevel,
+                                             *payloadBlob,
+                                             &error,
+                                             d_allocator_p);
         if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
                 rc == Result::e_SUCCESS &&
                 compressedPayloadBlob.length() < payloadBlob->length())) {
@@ -372,10 +758,16 @@ bmqt::EventBuilderResult::Enum PutEventBuilder::packMessage(int queueId)
             d_lastPackedMessageCompressionRatio =
                 static_cast<double>(payloadBlob->length()) /
                 compressedPayloadBlob.length();
-            bdlbb::BlobUtil::append(&resultBlob, compressedPayloadBlob);
-            d_crc32c = Crc32c::calculate(resultBlob);
 
-            return packMessageInternal(resultBlob, queueId);  // RETURN
+            // 'compressedPayloadBlob' is owned by this method, so it can
+            // always be referred to.
+            const bdlbb::Blob& appData = makeApplicationData(
+                &resultBlob,
+                compressedPayloadBlob,
+                true);  // byReference
+            d_crc32c = Crc32c::calculate(appData);
+
+            return packMessageInternal(appData, queueId);  // RETURN
         }
     }
 
@@ -383,13 +775,15 @@ bmqt::EventBuilderResult::Enum PutEventBuilder::packMessage(int queueId)
     // was bigger and not worth using. In either way, we fall back to using the
     // original blob. Explicitly set the 'd_compressionAlgorithmType' to
     // 'NONE'.
-    bdlbb::BlobUtil::append(&resultBlob, *payloadBlob);
+    const bdlbb::Blob& appData = makeApplicationData(&resultBlob,
+                                                     *payloadBlob,
+                                                     d_zeroCopy);
 
     d_compressionAlgorithmType = bmqt::CompressionAlgorithmType::e_NONE;
-    d_crc32c                   = Crc32c::calculate(resultBlob);
+    d_crc32c                   = Crc32c::calculate(appData);
     d_lastPackedMessageCompressionRatio = 1;
 
-    return packMessageInternal(resultBlob, queueId);
+    return packMessageInternal(appData, queueId);
 }
 
 bmqt::EventBuilderResult::Enum PutEventBuilder::packMessageRaw(int queueId)
@@ -409,6 +803,10 @@ bmqt::EventBuilderResult::Enum PutEventBuilder::packMessageRaw(int queueId)
 
 const bdlbb::Blob& PutEventBuilder::blob() const
 {
+    if (!d_pendingMessages.empty()) {
+        splicePendingMessages();
+    }
+
     // Fix packet's length in header now that we know it ..  Following is valid
     // (see comment in reset)
     EventHeader& eh = *reinterpret_cast<EventHeader*>(d_blob.buffer(0).data());
@@ -33,6 +33,14 @@
 // Each message added to the PutEvent is padded, so that multiple messages can
 // be added in the same event, without impacting the alignment of the headers.
 //
+/// Zero-Copy
+///---------
+// By default, the application data of each message is copied into the event
+// being built.  In zero-copy mode (see 'setZeroCopy'), its blob buffers are
+// instead appended by reference, followed by a shared padding buffer.  Note
+// that payloads specified as raw data, as well as small application data, are
+// always copied.
+//
 /// Thread Safety
 ///-------------
 // NOT thread safe
@@ -62,6 +70,7 @@
 
 // BMQ
 
+#include <bmqp_compressiondictionary.h>
 #include <bmqp_messageproperties.h>
 #include <bmqp_protocol.h>
 #include <bmqt_compressionalgorithmtype.h>
@@ -71,6 +80,8 @@
 // BDE
 #include <bdlb_nullablevalue.h>
 #include <bdlbb_blob.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
@@ -79,8 +90,16 @@
 
 namespace BloombergLP {
 
+// FORWARD DECLARATION
+namespace bdlmt {
+class FixedThreadPool;
+}
+
 namespace bmqp {
 
+// FORWARD DECLARATION
+class PutEventBuilder_PendingMessage;
+
 // =====================
 // class PutEventBuilder
 // =====================
@@ -91,6 +110,11 @@ class PutEventBuilder {
     // TYPES
     typedef bdlb::NullableValue<bmqp::Protocol::MsgGroupId> NullableMsgGroupId;
 
+  private:
+    // PRIVATE TYPES
+    typedef bsl::vector<bsl::shared_ptr<PutEventBuilder_PendingMessage> >
+        PendingMessages;
+
   private:
     // DATA
     bdlbb::BlobBufferFactory* d_bufferFactory_p;
@@ -150,6 +174,12 @@ class PutEventBuilder {
     // current message's payload (the
     // user sets it explicitly)
 
+    const CompressionDictionary* d_compressionDictionary_p;
+    // ZSTD dictionary to compress the
+    // current message's payload with,
+    // if any (the user sets it
+    // explicitly)
+
     double d_lastPackedMessageCompressionRatio;
     // Compression ratio of the last
     // packed message, or -1 if no
@@ -159,6 +189,33 @@ class PutEventBuilder {
 
     MessagePropertiesInfo d_messagePropertiesInfo;
 
+    bool d_zeroCopy;
+    // Whether application data is
+    // appended by reference to the event
+    // being built (see 'setZeroCopy').
+
+    int d_zstdCompressionLevel;
+    // Level at which payloads are
+    // compressed with the 'e_ZSTD'
+    // algorithm (see
+    // 'setZstdCompressionLevel').
+
+    bdlmt::FixedThreadPool* d_compressionThreadPool_p;
+    // Thread pool compressing payloads
+    // asynchronously, if any (see
+    // 'setCompressionThreadPool').
+
+    mutable PendingMessages d_pendingMessages;
+    // Messages whose payload is being
+    // compressed asynchronously, in
+    // order.  They are spliced into
+    // 'd_blob' when it is retrieved.
+
+    mutable int d_pendingMessagesSize;
+    // Sum of the sizes of the messages in
+    // 'd_pendingMessages', as if their
+    // payload was not compressed.
+
     bslma::Allocator* d_allocator_p;
 
   private:
@@ -179,6 +236,36 @@ class PutEventBuilder {
     bmqt::EventBuilderResult::Enum
     packMessageInternal(const bdlbb::Blob& appData, int queueId);
 
+    /// Add the current message, having the specified `properties` (which
+    /// may be empty) and the specified `payload`, to pack with the
+    /// specified `queueId`, to the messages whose payload is compressed,
+    /// using the specified `dictionary` if not 0, by the compression thread
+    /// pool.  Return true and load the result into the specified `result`
+    /// if the message was added or is invalid, and false if the compression
+    /// could not be enqueued, in which case the message has to be packed
+    /// synchronously.
+    bool packMessageAsync(bmqt::EventBuilderResult::Enum* result,
+                          const bdlbb::Blob&              properties,
+                          const bdlbb::Blob&              payload,
+                          const CompressionDictionary*    dictionary,
+                          int                             queueId);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the result of adding to the event the current message, with
+    /// application data of the specified `appDataLength`, and load into
+    /// the specified `messageSize` the size of that message.
+    bmqt::EventBuilderResult::Enum validateMessage(int* messageSize,
+                                                   int  appDataLength) const;
+
+    /// Return a `PutHeader` for the current message to pack with the
+    /// specified `queueId`, having all fields set but the sizes.
+    PutHeader makeHeader(int queueId) const;
+
+    /// Wait for the compression of the messages in `d_pendingMessages` to
+    /// complete, and splice them into `d_blob`.
+    void splicePendingMessages() const;
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(PutEventBuilder, bslma::UsesBslmaAllocator)
@@ -191,6 +278,10 @@ class PutEventBuilder {
     PutEventBuilder(bdlbb::BlobBufferFactory* bufferFactory,
                     bslma::Allocator*         allocator);
 
+    /// Destroy this object, after waiting for the compression of the
+    /// payloads of the messages it packed, if any, to complete.
+    ~PutEventBuilder();
+
     // MANIPULATORS
 
     /// Reset this builder to an initial state so that it can be used to
@@ -199,6 +290,41 @@ class PutEventBuilder {
     /// success, or non-zero on error.
     int reset();
 
+    /// Set the zero-copy mode of this builder to the specified `value`.
+    /// In zero-copy mode, the buffers of the application data of each
+    /// subsequently packed message are appended by reference to the event
+    /// being built, instead of being copied, unless that application data
+    /// is smaller than `Protocol::k_ZERO_COPY_MIN_APPDATA_SIZE`.  The
+    /// behavior is undefined if, in zero-copy mode, the data of a payload
+    /// blob set with `setMessagePayload` is modified while the built event
+    /// is in use.  Note that zero-copy mode is off by default, and that it
+    /// persists across calls to `reset`.
+    void setZeroCopy(bool value);
+
+    /// Set the level at which the payloads of the subsequently packed
+    /// messages are compressed with the `e_ZSTD` algorithm, without
+    /// dictionary, to the specified `value`.  The behavior is undefined
+    /// unless `value` is a level supported by the ZSTD library (typically,
+    /// in the range `[1 .. 22]`).  Note that the level defaults to
+    /// `Compression::k_ZSTD_DEFAULT_LEVEL`, and that this setting persists
+    /// across calls to `reset`.
+    void setZstdCompressionLevel(int value);
+
+    /// Set the thread pool compressing, asynchronously and in parallel, the
+    /// payloads of the subsequently packed messages to the specified
+    /// `threadPool`, or compress them synchronously if `threadPool` is 0.
+    /// A message whose payload is compressed asynchronously is spliced, at
+    /// its place, into the event when the latter is retrieved with `blob`,
+    /// which waits for that compression to complete.  The behavior is
+    /// undefined unless `threadPool` is 0 or started, and outlives the
+    /// next call to `reset` or the destruction of this builder.  Note that
+    /// the compression ratio of such a message (see
+    /// `lastPackedMesageCompressionRatio`) is reported as 1, and that it is
+    /// accounted for at its uncompressed size in `eventSize` until `blob`
+    /// is called.  Also note that this setting persists across calls to
+    /// `reset`.
+    void setCompressionThreadPool(bdlmt::FixedThreadPool* threadPool);
+
     /// Reset the current message being built and start a new one.
     void startMessage();
 
@@ -246,6 +372,17 @@ class PutEventBuilder {
     PutEventBuilder&
     setCompressionAlgorithmType(bmqt::CompressionAlgorithmType::Enum value);
 
+    /// Set the ZSTD dictionary to compress the payload of the current
+    /// message with to the specified `value` and return a reference
+    /// offering modifiable access to this object.  The dictionary is only
+    /// used if the compression algorithm type of the current message is
+    /// `e_ZSTD`, in which case payloads as small as
+    /// `Protocol::k_COMPRESSION_DICTIONARY_MIN_APPDATA_SIZE` are
+    /// compressed.  The behavior is undefined unless `value` is 0 or
+    /// valid, and outlives the call to `packMessage`.
+    PutEventBuilder&
+    setCompressionDictionary(const CompressionDictionary* value);
+
     /// Set the knowledge about MessageProperties presence and their Schema
     /// Id in the current message to the specified `value` and return a
     /// reference offering modifiable access to this object.
@@ -300,7 +437,10 @@ class PutEventBuilder {
     /// call to packMessage().
     const bmqt::MessageGUID& messageGUID() const;
 
-    /// Return the size in bytes of the event under construction.
+    /// Return the size in bytes of the event under construction.  Note
+    /// that a message whose payload is being compressed asynchronously (see
+    /// `setCompressionThreadPool`) is accounted for at its uncompressed
+    /// size.
     int eventSize() const;
 
     /// Return the size in bytes of the current unpacked message, or 0 if
@@ -313,6 +453,14 @@ class PutEventBuilder {
     /// builder sets this number to zero.
     int messageCount() const;
 
+    /// Return true if this builder is in zero-copy mode, and false
+    /// otherwise.
+    bool isZeroCopy() const;
+
+    /// Return the level at which payloads are compressed with the `e_ZSTD`
+    /// algorithm.
+    int zstdCompressionLevel() const;
+
     /// Return CRC32C of the current message.  Note that if `setCrc32c` has
     /// not been invoked, then zero will be returned.
     unsigned int crc32c() const;
@@ -344,6 +492,22 @@ class PutEventBuilder {
 // class PutEventBuilder
 // ---------------------
 
+inline void PutEventBuilder::setZeroCopy(bool value)
+{
+    d_zeroCopy = value;
+}
+
+inline void PutEventBuilder::setZstdCompressionLevel(int value)
+{
+    d_zstdCompressionLevel = value;
+}
+
+inline void
+PutEventBuilder::setCompressionThreadPool(bdlmt::FixedThreadPool* threadPool)
+{
+    d_compressionThreadPool_p = threadPool;
+}
+
 inline PutEventBuilder& PutEventBuilder::setFlag(PutHeaderFlags::Enum flag)
 {
     PutHeaderFlagUtil::setFlag(&d_flags, flag);
@@ -436,6 +600,13 @@ inline PutEventBuilder& PutEventBuilder::setCompressionAlgorithmType(
     return *this;
 }
 
+inline PutEventBuilder&
+PutEventBuilder::setCompressionDictionary(const CompressionDictionary* value)
+{
+    d_compressionDictionary_p = value;
+    return *this;
+}
+
 inline PutEventBuilder&
 PutEventBuilder::setMessagePropertiesInfo(const MessagePropertiesInfo& value)
 {
@@ -467,6 +638,7 @@ inline void PutEventBuilder::startMessage()
     d_properties_p             = 0;
     d_flags                    = 0;
     d_compressionAlgorithmType = bmqt::CompressionAlgorithmType::e_NONE;
+    d_compressionDictionary_p  = 0;
     d_messageGUID              = bmqt::MessageGUID();
     d_msgGroupId.reset();
     d_crc32c                = 0;
@@ -492,7 +664,7 @@ inline const bmqt::MessageGUID& PutEventBuilder::messageGUID() const
 
 inline int PutEventBuilder::eventSize() const
 {
-    return d_blob.length();
+    return d_blob.length() + d_pendingMessagesSize;
 }
 
 inline int PutEventBuilder::unpackedMessageSize() const
@@ -509,6 +681,16 @@ inline int PutEventBuilder::messageCount() const
     return d_msgCount;
 }
 
+inline bool PutEventBuilder::isZeroCopy() const
+{
+    return d_zeroCopy;
+}
+
+inline int PutEventBuilder::zstdCompressionLevel() const
+{
+    return d_zstdCompressionLevel;
+}
+
 inline unsigned int PutEventBuilder::crc32c() const
 {
     return d_crc32c;
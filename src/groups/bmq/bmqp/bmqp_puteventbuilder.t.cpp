@@ -25,11 +25,13 @@
 #include <bmqp_protocolutil.h>
 #include <bmqp_putmessageiterator.h>
 #include <bmqp_puttester.h>
+#include <bmqt_compressionalgorithmtype.h>
 #include <bmqt_messageguid.h>
 
 // MWC
 #include <mwcu_blob.h>
 #include <mwcu_memoutstream.h>
+#include <mwcu_printutil.h>
 
 // BDE
 #include <bdlb_guid.h>
@@ -39,21 +41,33 @@
 #include <bdlbb_blobutil.h>
 #include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlf_bind.h>
+#include <bdlmt_fixedthreadpool.h>
+#include <bdlt_timeunitratio.h>
 #include <bsl_algorithm.h>
 #include <bsl_cstring.h>  // for bsl::strlen
 #include <bsl_fstream.h>
+#include <bsl_iomanip.h>
 #include <bsl_ios.h>
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
+#include <bsl_string.h>
 #include <bslma_default.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_assert.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
 
 // TEST DRIVER
 #include <mwctst_testhelper.h>
 
+// BENCHMARKING LIBRARY
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <benchmark/benchmark.h>
+#endif
+
 // CONVENIENCE
 using namespace BloombergLP;
 using namespace bsl;
@@ -176,6 +190,79 @@ unsigned int findExpectedCrc32(
     return expectedCrc32;
 }
 
+/// Reset the specified `builder`, pack into it the specified `numMsgs`
+/// messages having the specified `payload`, compressed using the specified
+/// `algorithm`, and iterate over the messages of the resulting event with
+/// the specified `iter`, loading their decompressed payloads.  Return the
+/// total length of the payloads iterated over.
+int packAndIterate(bmqp::PutEventBuilder*               builder,
+                   bmqp::PutMessageIterator*            iter,
+                   const bsl::string&                   payload,
+                   int                                  numMsgs,
+                   bmqt::CompressionAlgorithmType::Enum algorithm)
+{
+    bmqt::MessageGUID guid;
+    guid.fromHex("40000000000000000000000000000001");
+
+    builder->reset();
+    for (int i = 0; i < numMsgs; ++i) {
+        builder->startMessage();
+        builder->setMessagePayload(payload.c_str(), payload.length());
+        builder->setMessageGUID(guid);
+        builder->setCompressionAlgorithmType(algorithm);
+        builder->packMessage(i);
+    }
+
+    bmqp::Event event(&builder->blob(), s_allocator_p);
+    event.loadPutMessageIterator(iter, true);
+
+    int         totalLength = 0;
+    bdlbb::Blob messagePayload(s_allocator_p);
+    while (iter->next() == 1) {
+        messagePayload.removeAll();
+        iter->loadMessagePayload(&messagePayload);
+        totalLength += messagePayload.length();
+    }
+
+    return totalLength;
+}
+
+/// Load into the specified `payload` a payload of the specified `length`,
+/// made of random characters of a small alphabet, so that it is about as
+/// compressible as typical application data.
+void generatePayload(bsl::string* payload, int length)
+{
+    payload->resize(length);
+    for (int i = 0; i < length; ++i) {
+        (*payload)[i] = static_cast<char>(
+            'a' + bdlb::Random::generate15(&s_seed) % 16);
+    }
+}
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+/// Apply to the specified Google Benchmark `b` the arguments pairs
+/// `{algorithm, length}` for every compression algorithm and various
+/// payload lengths up to 64 Ki.
+void populateAlgorithmsAndLengths_GoogleBenchmark(
+    benchmark::internal::Benchmark* b)
+{
+    typedef bmqt::CompressionAlgorithmType Type;
+
+    std::vector<long int> lengths;
+    lengths.push_back(64);
+    lengths.push_back(1024);   // 1 Ki
+    lengths.push_back(16384);  // 16 Ki
+    lengths.push_back(65536);  // 64 Ki
+    for (int algorithm = Type::k_LOWEST_SUPPORTED_TYPE;
+         algorithm <= Type::k_HIGHEST_SUPPORTED_TYPE;
+         ++algorithm) {
+        for (auto i : lengths) {
+            b->Args({algorithm, i});
+        }
+    }
+}
+#endif
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -2247,6 +2334,240 @@ static void test7_multiplePackMessage()
     ASSERT_EQ(false, putIter.isValid());
 }
 
+static void test8_zeroCopy()
+// ------------------------------------------------------------------------
+// ZERO COPY
+//
+// Concerns:
+//   In zero-copy mode, the payload of a message is appended by reference
+//   to the event, with or without message properties, and the event is
+//   still valid.
+//
+// Plan:
+//   - Pack a big payload, with and without message properties, in a
+//     zero-copy builder and in a regular builder.
+//   - Verify that the payload buffers are referred to by the event of the
+//     zero-copy builder only, and that both events iterate over the
+//     expected messages, with the expected CRC32-C.
+//
+// Testing:
+//   setZeroCopy
+//   isZeroCopy
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("ZERO COPY");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+
+    const int         k_PAYLOAD_SIZE = 4 * 1024 + 3;
+    const bsl::string payload(k_PAYLOAD_SIZE, 'x', s_allocator_p);
+    const char*       k_HEX_GUIDS[] = {"40000000000000000000000000000001",
+                                       "40000000000000000000000000000002"};
+
+    bdlbb::Blob payloadBlob(&bufferFactory, s_allocator_p);
+    bdlbb::BlobUtil::append(&payloadBlob, payload.c_str(), k_PAYLOAD_SIZE);
+
+    bmqp::MessageProperties msgProps(s_allocator_p);
+    ASSERT_EQ(0, msgProps.setPropertyAsString("id", "myCoolId"));
+
+    bmqp::PutEventBuilder zeroCopyBuilder(&bufferFactory, s_allocator_p);
+    bmqp::PutEventBuilder regularBuilder(&bufferFactory, s_allocator_p);
+
+    ASSERT_EQ(false, zeroCopyBuilder.isZeroCopy());
+    zeroCopyBuilder.setZeroCopy(true);
+    ASSERT_EQ(true, zeroCopyBuilder.isZeroCopy());
+
+    bmqp::PutEventBuilder* builders[] = {&zeroCopyBuilder, &regularBuilder};
+
+    for (int i = 0; i < 2; ++i) {
+        bmqp::PutEventBuilder& obj = *builders[i];
+
+        // Without, then with, message properties
+        for (int j = 0; j < 2; ++j) {
+            bmqt::MessageGUID guid;
+            guid.fromHex(k_HEX_GUIDS[j]);
+
+            obj.startMessage();
+            obj.setMessagePayload(&payloadBlob);
+            obj.setMessageGUID(guid);
+            if (j == 1) {
+                obj.setMessageProperties(&msgProps);
+            }
+
+            ASSERT_EQ_D(i << ", " << j,
+                        bmqt::EventBuilderResult::e_SUCCESS,
+                        obj.packMessage(j + 1));
+        }
+
+        const bdlbb::Blob& eventBlob = obj.blob();
+
+        // Check whether the payload buffers are referred to, by both messages
+        int numSharedBuffers = 0;
+        for (int k = 0; k < eventBlob.numDataBuffers(); ++k) {
+            for (int l = 0; l < payloadBlob.numDataBuffers(); ++l) {
+                if (eventBlob.buffer(k).data() ==
+                    payloadBlob.buffer(l).data()) {
+                    ++numSharedBuffers;
+                }
+            }
+        }
+        ASSERT_EQ_D(i,
+                    obj.isZeroCopy() ? 2 * payloadBlob.numDataBuffers() : 0,
+                    numSharedBuffers);
+
+        // Iterate and check
+        bmqp::Event rawEvent(&eventBlob, s_allocator_p);
+        ASSERT_EQ_D(i, true, rawEvent.isValid());
+        ASSERT_EQ_D(i, true, rawEvent.isPutEvent());
+
+        bmqp::PutMessageIterator putIter(&bufferFactory, s_allocator_p);
+        rawEvent.loadPutMessageIterator(&putIter, true);
+        ASSERT_EQ_D(i, true, putIter.isValid());
+
+        for (int j = 0; j < 2; ++j) {
+            ASSERT_EQ_D(i << ", " << j, 1, putIter.next());
+            ASSERT_EQ_D(i << ", " << j, j + 1, putIter.header().queueId());
+            ASSERT_EQ_D(i << ", " << j,
+                        j == 1,
+                        putIter.hasMessageProperties());
+
+            bdlbb::Blob appData(s_allocator_p);
+            ASSERT_EQ_D(i << ", " << j,
+                        0,
+                        putIter.loadApplicationData(&appData));
+            ASSERT_EQ_D(i << ", " << j,
+                        bmqp::Crc32c::calculate(appData),
+                        putIter.header().crc32c());
+
+            bdlbb::Blob messagePayload(s_allocator_p);
+            ASSERT_EQ_D(i << ", " << j,
+                        0,
+                        putIter.loadMessagePayload(&messagePayload));
+            ASSERT_EQ_D(i << ", " << j,
+                        0,
+                        bdlbb::BlobUtil::compare(messagePayload, payloadBlob));
+        }
+        ASSERT_EQ_D(i, 0, putIter.next());
+    }
+}
+
+static void test9_compressionThreadPool()
+// ------------------------------------------------------------------------
+// COMPRESSION THREAD POOL
+//
+// Concerns:
+//   Compressing the payloads of the messages on a thread pool yields the
+//   same event as compressing them synchronously, whether a message is
+//   compressed, is not worth compressing, or is too small to be compressed.
+//
+// Plan:
+//   - Pack the same messages, with and without message properties and
+//     MsgGroupId, in a builder using a thread pool and in a regular one.
+//   - Verify that both events are identical, before and after a reset.
+//
+// Testing:
+//   setCompressionThreadPool
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("COMPRESSION THREAD POOL");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+
+    const int k_NUM_MESSAGES = 12;
+    const int k_PAYLOAD_SIZE = 8 * 1024 + 3;
+
+    // Compressible, incompressible and small payloads
+    bsl::string compressible(k_PAYLOAD_SIZE, 'x', s_allocator_p);
+    bsl::string incompressible(k_PAYLOAD_SIZE, 'x', s_allocator_p);
+    for (int i = 0; i < k_PAYLOAD_SIZE; ++i) {
+        incompressible[i] = static_cast<char>(bdlb::Random::generate15(
+            &s_seed));
+    }
+    const bsl::string small(100, 'y', s_allocator_p);
+
+    const bsl::string* payloads[] = {&compressible, &incompressible, &small};
+
+    bmqp::MessageProperties msgProps(s_allocator_p);
+    ASSERT_EQ(0, msgProps.setPropertyAsString("id", "myCoolId"));
+
+    bdlmt::FixedThreadPool threadPool(4, 100, s_allocator_p);
+    ASSERT_EQ(0, threadPool.start());
+
+    bmqp::PutEventBuilder asyncBuilder(&bufferFactory, s_allocator_p);
+    bmqp::PutEventBuilder syncBuilder(&bufferFactory, s_allocator_p);
+    asyncBuilder.setCompressionThreadPool(&threadPool);
+
+    bmqp::PutEventBuilder* builders[] = {&asyncBuilder, &syncBuilder};
+
+    for (int iteration = 0; iteration < 2; ++iteration) {
+        for (int i = 0; i < 2; ++i) {
+            bmqp::PutEventBuilder& obj = *builders[i];
+
+            for (int j = 0; j < k_NUM_MESSAGES; ++j) {
+                const bsl::string& payload = *payloads[j % 3];
+
+                bmqt::MessageGUID guid;
+                guid.fromHex("40000000000000000000000000000001");
+
+                obj.startMessage();
+                obj.setMessagePayload(payload.c_str(), payload.length());
+                obj.setMessageGUID(guid);
+                obj.setCompressionAlgorithmType(
+                    bmqt::CompressionAlgorithmType::e_ZLIB);
+                if (j % 2) {
+                    obj.setMessageProperties(&msgProps);
+                }
+                if (j % 4 == 3) {
+                    obj.setMsgGroupId("gid");
+                }
+
+                ASSERT_EQ_D(i << ", " << j,
+                            bmqt::EventBuilderResult::e_SUCCESS,
+                            obj.packMessage(j + 1));
+            }
+            ASSERT_EQ_D(i, k_NUM_MESSAGES, obj.messageCount());
+        }
+
+        const bdlbb::Blob& asyncBlob = asyncBuilder.blob();
+        const bdlbb::Blob& syncBlob  = syncBuilder.blob();
+
+        ASSERT_EQ(asyncBlob.length(), asyncBuilder.eventSize());
+        ASSERT_EQ(syncBlob.length(), asyncBlob.length());
+        ASSERT_EQ(0, bdlbb::BlobUtil::compare(syncBlob, asyncBlob));
+
+        // The messages are compressed, or not, as expected
+        bmqp::Event rawEvent(&asyncBlob, s_allocator_p);
+        ASSERT_EQ(true, rawEvent.isValid());
+
+        bmqp::PutMessageIterator putIter(&bufferFactory, s_allocator_p);
+        rawEvent.loadPutMessageIterator(&putIter, true);
+        ASSERT_EQ(true, putIter.isValid());
+
+        for (int j = 0; j < k_NUM_MESSAGES; ++j) {
+            ASSERT_EQ_D(j, 1, putIter.next());
+            ASSERT_EQ_D(j,
+                        j % 3 == 0 ? bmqt::CompressionAlgorithmType::e_ZLIB
+                                   : bmqt::CompressionAlgorithmType::e_NONE,
+                        putIter.header().compressionAlgorithmType());
+
+            bdlbb::Blob messagePayload(s_allocator_p);
+            ASSERT_EQ_D(j, 0, putIter.loadMessagePayload(&messagePayload));
+
+            const bsl::string& payload = *payloads[j % 3];
+            ASSERT_EQ_D(j,
+                        static_cast<int>(payload.length()),
+                        messagePayload.length());
+        }
+        ASSERT_EQ(0, putIter.next());
+
+        asyncBuilder.reset();
+        syncBuilder.reset();
+    }
+
+    threadPool.stop();
+}
+
+
 static void testN1_decodeFromFile()
 // --------------------------------------------------------------------
 // DECODE FROM FILE
@@ -2411,6 +2732,177 @@ static void testN1_decodeFromFile()
     ASSERT_EQ(false, putIter.isValid());
 }
 
+static void testN2_packAndIterate()
+// ------------------------------------------------------------------------
+// BENCHMARK: PACK AND ITERATE
+//
+// Concerns:
+//   Measure the throughput of building a PUT event with each compression
+//   algorithm, and of iterating over its messages and decompressing their
+//   payloads, for payloads of various sizes.
+//
+// Plan:
+//   - For each compression algorithm and payload size, time the building
+//     and iteration of enough events of 'k_NUM_MSGS' messages to process
+//     about 256 MiB of payloads, and report the throughput.
+//
+// Testing:
+//   Performance of packMessage and PutMessageIterator::loadMessagePayload.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BENCHMARK: PACK AND ITERATE");
+
+    typedef bmqt::CompressionAlgorithmType Type;
+
+    const bsls::Types::Int64 k_TOTAL_BYTES = 256 * 1024 * 1024;  // 256 Mi
+    const int                k_NUM_MSGS    = 100;
+    const int                k_LENGTHS[]   = {64, 1024, 16384, 65536};
+    const int k_NUM_LENGTHS = sizeof(k_LENGTHS) / sizeof(*k_LENGTHS);
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(4096, s_allocator_p);
+    bmqp::PutEventBuilder          builder(&bufferFactory, s_allocator_p);
+    bmqp::PutMessageIterator       iter(&bufferFactory, s_allocator_p);
+    bsl::string                    payload(s_allocator_p);
+
+    for (int algorithm = Type::k_LOWEST_SUPPORTED_TYPE;
+         algorithm <= Type::k_HIGHEST_SUPPORTED_TYPE;
+         ++algorithm) {
+        const Type::Enum type = static_cast<Type::Enum>(algorithm);
+
+        for (int i = 0; i < k_NUM_LENGTHS; ++i) {
+            const int length   = k_LENGTHS[i];
+            const int numIters = static_cast<int>(k_TOTAL_BYTES /
+                                                  (k_NUM_MSGS * length));
+
+            generatePayload(&payload, length);
+
+            // Warm up
+            ASSERT_EQ_D(algorithm << ", " << length,
+                        k_NUM_MSGS * length,
+                        packAndIterate(&builder,
+                                       &iter,
+                                       payload,
+                                       k_NUM_MSGS,
+                                       type));
+
+            bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+            for (int j = 0; j < numIters; ++j) {
+                packAndIterate(&builder, &iter, payload, k_NUM_MSGS, type);
+            }
+            bsls::Types::Int64 endTime = bsls::TimeUtil::getTimer();
+
+            const bsls::Types::Int64 numBytes =
+                static_cast<bsls::Types::Int64>(numIters) * k_NUM_MSGS *
+                length;
+
+            cout << setw(5) << Type::toAscii(type) << " | " << setw(6)
+                 << length << " bytes | "
+                 << mwcu::PrintUtil::prettyBytes(
+                        numBytes * bdlt::TimeUnitRatio::k_NS_PER_S /
+                        (endTime - startTime))
+                 << "/s\n";
+        }
+    }
+}
+
+// Begin Benchmarking Tests
+#ifdef BSLS_PLATFORM_OS_LINUX
+static void testN2_packAndIterate_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// BENCHMARK: PACK AND ITERATE
+//
+// Concerns:
+//   Measure the throughput of building a PUT event, and of iterating over
+//   its messages and decompressing their payloads.  'state.range(0)' is
+//   the compression algorithm, and 'state.range(1)' the size of the
+//   payloads.
+// ------------------------------------------------------------------------
+{
+    const bmqt::CompressionAlgorithmType::Enum algorithm =
+        static_cast<bmqt::CompressionAlgorithmType::Enum>(state.range(0));
+    const int length  = state.range(1);
+    const int numMsgs = 100;
+
+    state.SetLabel(bmqt::CompressionAlgorithmType::toAscii(algorithm));
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(4096, s_allocator_p);
+    bmqp::PutEventBuilder          builder(&bufferFactory, s_allocator_p);
+    bmqp::PutMessageIterator       iter(&bufferFactory, s_allocator_p);
+    bsl::string                    payload(s_allocator_p);
+
+    generatePayload(&payload, length);
+
+    // <time>
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            packAndIterate(&builder, &iter, payload, numMsgs, algorithm));
+    }
+    // </time>
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            numMsgs * length);
+}
+#endif  // BSLS_PLATFORM_OS_LINUX
+
+static void test10_zstdCompressionLevel()
+// ------------------------------------------------------------------------
+// ZSTD COMPRESSION LEVEL
+//
+// Concerns:
+//   1. The ZSTD compression level of a builder defaults to
+//      'Compression::k_ZSTD_DEFAULT_LEVEL', and persists across calls to
+//      'reset'.
+//   2. A payload compressed with 'e_ZSTD' at the configured level is
+//      decompressed back to the original payload.
+//
+// Testing:
+//   setZstdCompressionLevel
+//   zstdCompressionLevel
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("ZSTD COMPRESSION LEVEL");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    bmqp::PutEventBuilder          obj(&bufferFactory, s_allocator_p);
+
+    ASSERT_EQ(bmqp::Compression::k_ZSTD_DEFAULT_LEVEL,
+              obj.zstdCompressionLevel());
+
+    obj.setZstdCompressionLevel(19);
+    ASSERT_EQ(0, obj.reset());
+    ASSERT_EQ(19, obj.zstdCompressionLevel());
+
+    bsl::string payload(s_allocator_p);
+    for (int i = 0; i < 512; ++i) {
+        payload.append("compressible payload ");
+    }
+
+    bmqt::MessageGUID guid;
+    guid.fromHex("40000000000000000000000000000001");
+
+    obj.startMessage();
+    obj.setMessagePayload(payload.data(), payload.length());
+    obj.setMessageGUID(guid);
+    obj.setCompressionAlgorithmType(bmqt::CompressionAlgorithmType::e_ZSTD);
+    ASSERT_EQ(bmqt::EventBuilderResult::e_SUCCESS, obj.packMessage(1));
+    ASSERT_GT(obj.lastPackedMesageCompressionRatio(), 1);
+
+    bmqp::Event rawEvent(&obj.blob(), s_allocator_p);
+    ASSERT_EQ(true, rawEvent.isPutEvent());
+
+    bmqp::PutMessageIterator putIter(&bufferFactory, s_allocator_p);
+    rawEvent.loadPutMessageIterator(&putIter, true);
+    ASSERT_EQ(1, putIter.next());
+
+    bdlbb::Blob messagePayload(s_allocator_p);
+    ASSERT_EQ(0, putIter.loadMessagePayload(&messagePayload));
+
+    bdlbb::Blob expected(&bufferFactory, s_allocator_p);
+    bdlbb::BlobUtil::append(&expected, payload.data(), payload.length());
+    ASSERT_EQ(0, bdlbb::BlobUtil::compare(messagePayload, expected));
+    ASSERT_EQ(0, putIter.next());
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -2442,6 +2934,9 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 10: test10_zstdCompressionLevel(); break;
+    case 9: test9_compressionThreadPool(); break;
+    case 8: test8_zeroCopy(); break;
     case 7: test7_multiplePackMessage(); break;
     case 6: test6_emptyBuilder(); break;
     case 5: test5_putEventWithZeroLengthMessage(); break;
@@ -2450,11 +2945,22 @@ int main(int argc, char* argv[])
     case 2: test2_manipulators_one(); break;
     case 1: test1_breathingTest(); break;
     case -1: testN1_decodeFromFile(); break;
+    case -2:
+        MWC_BENCHMARK_WITH_ARGS(
+            testN2_packAndIterate,
+            Apply(populateAlgorithmsAndLengths_GoogleBenchmark));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
     } break;
     }
+#ifdef BSLS_PLATFORM_OS_LINUX
+    if (_testCase < 0) {
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+    }
+#endif
 
     bmqp::ProtocolUtil::shutdown();
 
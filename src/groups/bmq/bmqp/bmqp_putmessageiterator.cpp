@@ -51,6 +51,8 @@ void PutMessageIterator::copyFrom(const PutMessageIterator& src)
     d_messagePropertiesSize      = src.d_messagePropertiesSize;
     d_applicationDataPosition    = src.d_applicationDataPosition;
     d_advanceLength              = src.d_advanceLength;
+    d_headerSizes                = src.d_headerSizes;
+    d_headerIndex                = src.d_headerIndex;
     d_optionsSize                = src.d_optionsSize;
     d_optionsPosition            = src.d_optionsPosition;
     d_decompressFlag             = src.d_decompressFlag;
@@ -411,6 +413,46 @@ int PutMessageIterator::loadMessagePayload(bdlbb::Blob* blob) const
     return rc_SUCCESS;
 }
 
+int PutMessageIterator::loadMessagePayloadBuffers(
+    bsl::vector<bdlbb::BlobBuffer>* buffers) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isValid());
+    BSLS_ASSERT_SAFE(d_decompressFlag);
+    BSLS_ASSERT_SAFE(buffers);
+
+    enum RcEnum {
+        rc_SUCCESS                = 0,
+        rc_INVALID_PAYLOAD_OFFSET = -1,
+        rc_INVALID_PAYLOAD_LENGTH = -2
+    };
+
+    if (d_lazyMessagePayloadPosition == mwcu::BlobPosition()) {
+        // See comment in 'loadMessagePayload'.
+
+        mwcu::BlobPosition payloadPos;
+        int                rc = loadMessagePayloadPosition(&payloadPos);
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            buffers->clear();
+            return rc * 10 + rc_INVALID_PAYLOAD_OFFSET;  // RETURN
+        }
+
+        BSLS_ASSERT_SAFE(d_lazyMessagePayloadPosition == payloadPos);
+    }
+
+    int rc = mwcu::BlobUtil::loadBuffers(buffers,
+                                         d_applicationData,
+                                         d_lazyMessagePayloadPosition,
+                                         messagePayloadSize());
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return (rc * 10 + rc_INVALID_PAYLOAD_LENGTH);  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
 bool PutMessageIterator::extractMsgGroupId(
     bmqp::Protocol::MsgGroupId* msgGroupId) const
 {
@@ -493,60 +535,78 @@ int PutMessageIterator::next()
         return rc_AT_END;  // RETURN
     }
 
-    // Read PutHeader, supporting protocol evolution by reading as many bytes
-    // as the header declares (and not as many as the size of the struct)
-    mwcu::BlobObjectProxy<PutHeader> header(d_blobIter.blob(),
-                                            d_blobIter.position(),
-                                            -PutHeader::k_MIN_HEADER_SIZE,
-                                            true,
-                                            false);
+    mwcu::BlobObjectProxy<PutHeader> header;
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!header.isSet())) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        // We couldn't read a PutHeader.. set the state of this iterator to
-        // invalid
-        d_advanceLength = -1;
-        return rc_NO_PUTHEADER;  // RETURN
-    }
+    if (d_headerIndex < d_headerSizes.size()) {
+        // The sizes declared by this header were validated by 'prescan'.
+        header.resetRaw(d_blobIter.blob(),
+                        d_blobIter.position(),
+                        d_headerSizes[d_headerIndex++],
+                        true,
+                        false);
+        BSLS_ASSERT_SAFE(header.isSet());
 
-    const int headerSize = header->headerWords() * Protocol::k_WORD_SIZE;
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(headerSize <
-                                              PutHeader::k_MIN_HEADER_SIZE)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        // Header is declaring less bytes than expected, probably this is
-        // because header is malformed
-        d_advanceLength = -1;
-        return rc_NO_PUTHEADER;  // RETURN
+        d_header        = *header;
+        d_advanceLength = d_header.messageWords() * Protocol::k_WORD_SIZE;
     }
+    else {
+        // Read PutHeader, supporting protocol evolution by reading as many
+        // bytes as the header declares (and not as many as the size of the
+        // struct)
+        header.reset(d_blobIter.blob(),
+                     d_blobIter.position(),
+                     -PutHeader::k_MIN_HEADER_SIZE,
+                     true,
+                     false);
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!header.isSet())) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            // We couldn't read a PutHeader.. set the state of this iterator
+            // to invalid
+            d_advanceLength = -1;
+            return rc_NO_PUTHEADER;  // RETURN
+        }
 
-    header.resize(headerSize);
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!header.isSet())) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        d_advanceLength = -1;
-        return rc_NO_PUTHEADER;  // RETURN
-    }
+        const int headerSize = header->headerWords() * Protocol::k_WORD_SIZE;
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                headerSize < PutHeader::k_MIN_HEADER_SIZE)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            // Header is declaring less bytes than expected, probably this is
+            // because header is malformed
+            d_advanceLength = -1;
+            return rc_NO_PUTHEADER;  // RETURN
+        }
 
-    d_header = *header;
+        header.resize(headerSize);
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!header.isSet())) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            d_advanceLength = -1;
+            return rc_NO_PUTHEADER;  // RETURN
+        }
 
-    // Update 'advanceLength' for the next message.
-    d_advanceLength = d_header.messageWords() * Protocol::k_WORD_SIZE;
+        d_header = *header;
 
-    // Validation: must ensure that 'd_advanceLength > 0' after update, or
-    // iteration process via 'next()' might be infinite
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_advanceLength == 0)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        // Set the state of this iterator to invalid
-        d_advanceLength = -1;
-        return rc_INVALID_ADVANCE_LENGTH;  // RETURN
-    }
+        // Update 'advanceLength' for the next message.
+        d_advanceLength = d_header.messageWords() * Protocol::k_WORD_SIZE;
 
-    // Validation: make sure blob has enough data as indicated by PutHeader
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_blobIter.remaining() <
-                                              d_advanceLength)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        // Set the state of this iterator to invalid
-        d_advanceLength = -1;
-        return rc_NOT_ENOUGH_BYTES;  // RETURN
+        // Validation: must ensure that 'd_advanceLength > 0' after update, or
+        // iteration process via 'next()' might be infinite
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_advanceLength == 0)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            // Set the state of this iterator to invalid
+            d_advanceLength = -1;
+            return rc_INVALID_ADVANCE_LENGTH;  // RETURN
+        }
+
+        // Validation: make sure blob has enough data as indicated by
+        // PutHeader
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_blobIter.remaining() <
+                                                  d_advanceLength)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            // Set the state of this iterator to invalid
+            d_advanceLength = -1;
+            return rc_NOT_ENOUGH_BYTES;  // RETURN
+        }
     }
 
     const bool loadOptionsPosition = OptionUtil::loadOptionsPosition(
@@ -647,6 +707,20 @@ int PutMessageIterator::next()
     return rc_HAS_NEXT;
 }
 
+int PutMessageIterator::prescan()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isValid());
+    BSLS_ASSERT_SAFE(d_advanceLength == 0);
+
+    d_headerIndex = 0;
+    return ProtocolUtil::scanMessageHeaders<PutHeader>(
+        &d_headerSizes,
+        *d_blobIter.blob(),
+        d_blobIter.position(),
+        d_blobIter.remaining());
+}
+
 int PutMessageIterator::reset(const bdlbb::Blob* blob,
                               const EventHeader& eventHeader,
                               bool               decompressFlag)
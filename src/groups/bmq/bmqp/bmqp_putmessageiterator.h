@@ -67,6 +67,7 @@
 #include <bdlma_localsequentialallocator.h>
 #include <bsl_iterator.h>
 #include <bsl_ostream.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bsls_assert.h>
 
@@ -149,6 +150,14 @@ class PutMessageIterator {
     // iterator is considered in invalid
     // state if this value is == -1.
 
+    bsl::vector<int> d_headerSizes;
+    // Sizes of the headers of the messages
+    // validated by 'prescan', if any.
+
+    size_t d_headerIndex;
+    // Index in 'd_headerSizes' of the size
+    // of the header of the next message.
+
     mutable NullableOptionsView d_optionsView;
     // The OptionsView for this iterator.
 
@@ -259,6 +268,17 @@ class PutMessageIterator {
     /// and `isValid`.
     int next();
 
+    /// Validate, in one pass, the sizes declared by the headers of all the
+    /// messages of the event, so that subsequent calls to `next` do not
+    /// have to.  Return 0 on success, or a negative value if a header is
+    /// invalid, in which case `next` validates the headers from the invalid
+    /// one on as if this method was not called.  The behavior is undefined
+    /// unless `isValid` returns true and `next` was not called since the
+    /// last call to `reset`.  Note that this costs an extra pass over the
+    /// headers and the allocation of a table of their sizes, and is only
+    /// beneficial to events made of many small messages: callers opt in.
+    int prescan();
+
     /// Reset this instance using the specified `blob` and `eventHeader` and
     /// the specified `decompressFlag`. The behaviour is undefined if the
     /// `blob` pointer is null, or the pointed-to blob does not contain
@@ -398,6 +418,15 @@ class PutMessageIterator {
     /// `next()` returned 1.
     int loadMessagePayload(bdlbb::Blob* blob) const;
 
+    /// Load into the specified `buffers` the blob buffers holding the
+    /// payload for the message currently pointed to by this iterator,
+    /// aliasing (and sharing ownership of) the underlying memory instead of
+    /// copying it.  Return zero on success, and a non-zero value otherwise.
+    /// Behavior is undefined unless latest call to `next()` returned 1.
+    /// See `mwcu::BlobUtil::loadBuffers`.
+    int
+    loadMessagePayloadBuffers(bsl::vector<bdlbb::BlobBuffer>* buffers) const;
+
     /// Load into the specified `msgGroupId` the Group Id associated with
     /// the message currently pointed to by this iterator.  Return `true` if
     /// the load was successfully or `false` otherwise.  Behavior is
@@ -427,6 +456,8 @@ inline PutMessageIterator::PutMessageIterator(
 , d_optionsSize(0)
 , d_optionsPosition()
 , d_advanceLength(-1)
+, d_headerSizes(allocator)
+, d_headerIndex(0)
 , d_optionsView(allocator)
 , d_decompressFlag(false)
 , d_applicationData(bufferFactory, allocator)
@@ -444,6 +475,8 @@ inline PutMessageIterator::PutMessageIterator(
     bdlbb::BlobBufferFactory* bufferFactory,
     bslma::Allocator*         allocator)
 : d_blobIter(0, mwcu::BlobPosition(), 0, true)  // no def ctor - set in reset
+, d_headerSizes(allocator)
+, d_headerIndex(0)
 , d_optionsView(allocator)
 , d_decompressFlag(decompressFlag)
 , d_applicationData(bufferFactory, allocator)
@@ -460,6 +493,7 @@ inline PutMessageIterator::PutMessageIterator(const PutMessageIterator& src,
              mwcu::BlobPosition(),
              0,
              true)  // no def ctor - set in copyFrom
+, d_headerSizes(allocator)
 , d_applicationData(src.d_bufferFactory_p, allocator)
 , d_bufferFactory_p(src.d_bufferFactory_p)
 , d_allocator_p(allocator)
@@ -490,6 +524,8 @@ inline void PutMessageIterator::clear()
     d_optionsSize                = 0;
     d_optionsPosition            = mwcu::BlobPosition();
     d_advanceLength              = -1;
+    d_headerIndex                = 0;
+    d_headerSizes.clear();
     d_applicationData.removeAll();
     d_optionsView.reset();
 }
@@ -31,6 +31,7 @@
 #include <bdlbb_pooledblobbufferfactory.h>
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
+#include <bsl_vector.h>
 #include <bslma_default.h>
 
 // TEST DRIVER
@@ -361,6 +362,15 @@ static void test1_breathingTest()
                   bdlbb::BlobUtil::compare(retrievedPayloadBlob,
                                            expectedBlob));
 
+        bsl::vector<bdlbb::BlobBuffer> payloadBuffers(s_allocator_p);
+        ASSERT_EQ(0, iter.loadMessagePayloadBuffers(&payloadBuffers));
+        bdlbb::Blob payloadFromBuffers(s_allocator_p);
+        for (size_t i = 0; i < payloadBuffers.size(); ++i) {
+            payloadFromBuffers.appendDataBuffer(payloadBuffers[i]);
+        }
+        ASSERT_EQ(0,
+                  bdlbb::BlobUtil::compare(payloadFromBuffers, expectedBlob));
+
         ASSERT_EQ(0, iter.loadApplicationDataPosition(&retrievedPayloadPos));
         ASSERT_EQ(retrievedPayloadPos, expectedPayloadPos);
 
@@ -1131,6 +1141,120 @@ static void test6_putEventWithZeroLengthPutMessages()
     }
 }
 
+static void test7_prescan()
+// ------------------------------------------------------------------------
+// PRESCAN
+//
+// Concerns:
+//   - 'prescan' succeeds on a valid PUT event having many messages, and
+//     iterating over the event after 'prescan' yields the same messages
+//     as without it.
+//   - 'prescan' fails on an invalid PUT event, in which case 'next' still
+//     iterates over the valid messages, and then fails.
+//   - 'reset' discards the result of 'prescan'.
+//
+// Testing:
+//   prescan
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("PRESCAN");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(128, s_allocator_p);
+
+    {
+        PVV("VALID PUT EVENT");
+        bdlbb::Blob eventBlob(&bufferFactory, s_allocator_p);
+        bsl::vector<bmqp::PutTester::Data> data(s_allocator_p);
+        bmqp::EventHeader                  eventHeader;
+        const size_t                       k_NUM_MSGS = 500;
+
+        bmqp::PutTester::populateBlob(&eventBlob,
+                                      &eventHeader,
+                                      &data,
+                                      k_NUM_MSGS,
+                                      &bufferFactory,
+                                      false,  // No zero-length PUT msgs.
+                                      s_allocator_p);
+
+        bmqp::PutMessageIterator iter(&eventBlob,
+                                      eventHeader,
+                                      true,
+                                      &bufferFactory,
+                                      s_allocator_p);
+        ASSERT_EQ(true, iter.isValid());
+        ASSERT_EQ(0, iter.prescan());
+
+        size_t index = 0;
+        while (iter.next() == 1 && index < data.size()) {
+            const bmqp::PutTester::Data& D = data[index];
+
+            ASSERT_EQ_D(index, D.d_queueId, iter.header().queueId());
+            ASSERT_EQ_D(index, D.d_propLen, iter.messagePropertiesSize());
+            ASSERT_EQ_D(index, D.d_msgLen, iter.messagePayloadSize());
+
+            bdlbb::Blob payload(s_allocator_p);
+            ASSERT_EQ_D(index, 0, iter.loadMessagePayload(&payload));
+            ASSERT_EQ_D(index,
+                        0,
+                        bdlbb::BlobUtil::compare(payload, D.d_payload));
+
+            ++index;
+        }
+
+        ASSERT_EQ(index, data.size());
+        ASSERT_EQ(false, iter.isValid());
+
+        // Reset, and iterate without prescan
+        ASSERT_EQ(0, iter.reset(&eventBlob, eventHeader, true));
+
+        index = 0;
+        while (iter.next() == 1 && index < data.size()) {
+            ASSERT_EQ_D(index,
+                        data[index].d_queueId,
+                        iter.header().queueId());
+            ++index;
+        }
+
+        ASSERT_EQ(index, data.size());
+        ASSERT_EQ(false, iter.isValid());
+    }
+
+    {
+        PVV("INVALID PUT EVENT");
+        bdlbb::Blob eventBlob(&bufferFactory, s_allocator_p);
+        bsl::vector<bmqp::PutTester::Data> data(s_allocator_p);
+        bmqp::EventHeader                  eventHeader;
+        const size_t                       k_NUM_MSGS = 10;
+
+        bmqp::PutTester::populateBlob(&eventBlob,
+                                      &eventHeader,
+                                      &data,
+                                      k_NUM_MSGS,
+                                      &bufferFactory,
+                                      false,  // No zero-length PUT msgs.
+                                      s_allocator_p);
+
+        // Render the last message invalid by removing the last byte
+        bdlbb::BlobUtil::erase(&eventBlob, eventBlob.length() - 1, 1);
+
+        bmqp::PutMessageIterator iter(&eventBlob,
+                                      eventHeader,
+                                      false,
+                                      &bufferFactory,
+                                      s_allocator_p);
+        ASSERT_EQ(true, iter.isValid());
+        ASSERT_LT(iter.prescan(), 0);
+
+        for (size_t i = 0; i < k_NUM_MSGS - 1; ++i) {
+            ASSERT_EQ_D(i, 1, iter.next());
+            ASSERT_EQ_D(i, data[i].d_queueId, iter.header().queueId());
+        }
+
+        ASSERT_LT(iter.next(), 0);
+        ASSERT_EQ(false, iter.isValid());
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1143,6 +1267,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 7: test7_prescan(); break;
     case 6: test6_putEventWithZeroLengthPutMessages(); break;
     case 5: test5_putEventWithMultipleMessages(); break;
     case 4: test4_invalidPutEvent(); break;
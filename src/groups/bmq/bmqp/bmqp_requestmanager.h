@@ -54,6 +54,19 @@
 // 'SystemExector' will be used by default and invoke the response processing
 // inline from within the scheduler thread.
 //
+/// Request timeout
+///---------------
+// Rather than scheduling one event per request, the 'RequestManager' tracks
+// the timeout of outstanding requests in a hashed timing wheel, which is
+// advanced by a single event scheduled on the provided scheduler every
+// 'k_TIMER_WHEEL_TICK_MS' milliseconds, and only for as long as there are
+// requests pending a timeout.  This keeps the scheduler events count
+// independent of the number of outstanding requests (which can be very
+// large, e.g., when re-opening queues after a failover), and makes arming
+// and cancelling the timeout of a request a constant time operation.  The
+// trade-off is that a request times out up to one tick after its timeout
+// expired.
+//
 /// Late response mode
 ///------------------
 // A late response is a response received after the request has been locally
@@ -331,8 +344,8 @@
 
 // MWC
 #include <mwcc_orderedhashmap.h>
-#include <mwcex_bindutil.h>
 #include <mwcex_executionpolicy.h>
+#include <mwcex_executionutil.h>
 #include <mwcex_executor.h>
 #include <mwcex_systemexecutor.h>
 #include <mwcio_channel.h>
@@ -354,6 +367,7 @@
 #include <bsl_memory.h>
 #include <bsl_string.h>
 #include <bsl_utility.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
@@ -424,9 +438,22 @@ class RequestManagerRequest {
     // Semaphore associated to this request,
     // used for synchronous calls wait.
 
-    bdlmt::EventScheduler::EventHandle d_timeoutSchedulerHandle;
-    // Scheduler handle for the timeout
-    // associated to this request.
+    bsls::TimeInterval d_timeoutDeadline;
+    // Absolute (monotonic) time at which
+    // this request times out.
+
+    int d_timerSlot;
+    // Slot of the timing wheel of the
+    // RequestManager this request belongs
+    // to, or -1 if its timeout is not armed.
+
+    SelfType* d_timerPrev_p;
+    // Previous request in the same slot of
+    // the timing wheel, if any.
+
+    SelfType* d_timerNext_p;
+    // Next request in the same slot of the
+    // timing wheel, if any.
 
     ResponseCb d_responseCb;
     // Response callback, if any, to invoke
@@ -584,6 +611,10 @@ class RequestManagerRequest {
     /// Return the associated group id (`NO_GROUP_ID` by default).
     int groupId() const;
 
+    /// Return the time, as reported by `mwcsys::Time::highResolutionTimer`,
+    /// at which the request was sent, or 0 if it has not been sent.
+    bsls::Types::Int64 sendTime() const;
+
     /// Return the associated user data.
     const bdld::Datum& userData() const;
 };
@@ -627,6 +658,14 @@ class RequestManager {
     /// remote-peer.
     static const int k_CODE_TIMEOUT_REMOTE = -2;
 
+    /// Resolution, in milliseconds, of the timing wheel tracking the
+    /// timeout of the outstanding requests.
+    static const int k_TIMER_WHEEL_TICK_MS = 100;
+
+    /// Number of slots of the timing wheel tracking the timeout of the
+    /// outstanding requests.
+    static const int k_TIMER_WHEEL_NUM_SLOTS = 512;
+
   private:
     // CLASS-SCOPE CATEGORY
     BALL_LOG_SET_CLASS_CATEGORY("BMQP.REQUESTMANAGER");
@@ -647,6 +686,10 @@ class RequestManager {
 
     typedef typename RequestMap::const_iterator RequestMapConstIter;
 
+    /// Timing wheel: each slot is the head of the intrusive list of
+    /// requests whose timeout expires at a tick mapping to that slot.
+    typedef bsl::vector<RequestType*> TimerWheel;
+
     // DATA
     bslma::Allocator* d_allocator_p;
     // Allocator to use.
@@ -694,6 +737,29 @@ class RequestManager {
     // whenever a callback for the request is
     // invoked.
 
+    TimerWheel d_timerWheel;
+    // Timing wheel of the requests pending a
+    // timeout.
+
+    int d_timerSlot;
+    // Slot of 'd_timerWheel' corresponding to the
+    // last tick processed.
+
+    bsls::TimeInterval d_timerTime;
+    // Time of the last tick processed.
+
+    int d_numTimers;
+    // Number of requests in 'd_timerWheel'.
+
+    unsigned int d_timerGeneration;
+    // Incremented each time 'd_timerWheel' is
+    // restarted, so that a tick of a previous
+    // generation is ignored.
+
+    bdlmt::EventScheduler::EventHandle d_timerEventHandle;
+    // Scheduler handle for the next tick of
+    // 'd_timerWheel', if one is scheduled.
+
   private:
     // PRIVATE MANIPULATORS
 
@@ -704,10 +770,26 @@ class RequestManager {
                                                 const bdlbb::Blob& blob,
                                                 bsls::Types::Int64 watermark);
 
-    /// Callback invoked by the scheduler when the request identified by the
-    /// specified `requestId` has timedout.
+    /// Callback invoked when the request identified by the specified
+    /// `requestId` has timedout.
     void onRequestTimeout(int requestId);
 
+    /// Callback invoked by the scheduler at each tick of the timing wheel
+    /// started at the specified `generation`: process the ticks elapsed
+    /// since the last one, timing out the requests whose timeout expired,
+    /// and schedule the next tick if any request is still pending a
+    /// timeout.  Do nothing if the wheel was restarted since `generation`.
+    void onTimerTick(unsigned int generation);
+
+    /// Arm the timeout of the specified `request` to expire at the
+    /// specified absolute `deadline`.  The behavior is undefined unless
+    /// `d_mutex` is locked and the timeout of `request` is not armed.
+    void armTimer(RequestType* request, const bsls::TimeInterval& deadline);
+
+    /// Disarm the timeout of the specified `request`, if it is armed.  The
+    /// behavior is undefined unless `d_mutex` is locked.
+    void disarmTimer(RequestType* request);
+
     /// Apply the specified `response` to the specified `request`.
     void applyResponse(const RequestSp& request, const RESPONSE& response);
 
@@ -830,7 +912,10 @@ RequestManagerRequest<REQUEST, RESPONSE>::RequestManagerRequest(
 : d_requestMessage(allocator)
 , d_responseMessage(allocator)
 , d_semaphore()
-, d_timeoutSchedulerHandle()
+, d_timeoutDeadline()
+, d_timerSlot(-1)
+, d_timerPrev_p(0)
+, d_timerNext_p(0)
 , d_responseCb(bsl::allocator_arg, allocator)
 , d_asyncNotifierCb(bsl::allocator_arg, allocator)
 , d_sendTime(0)
@@ -855,7 +940,7 @@ template <class REQUEST, class RESPONSE>
 void RequestManagerRequest<REQUEST, RESPONSE>::clear()
 {
     // PRECONDITIONS
-    BSLS_ASSERT_SAFE(!d_timeoutSchedulerHandle);
+    BSLS_ASSERT_SAFE(d_timerSlot == -1);
 
     // Reset the semaphore
     while (d_semaphore.tryWait() == 0) {
@@ -1032,6 +1117,12 @@ int RequestManagerRequest<REQUEST, RESPONSE>::groupId() const
     return d_groupId;
 }
 
+template <class REQUEST, class RESPONSE>
+bsls::Types::Int64 RequestManagerRequest<REQUEST, RESPONSE>::sendTime() const
+{
+    return d_sendTime;
+}
+
 template <class REQUEST, class RESPONSE>
 const bdld::Datum& RequestManagerRequest<REQUEST, RESPONSE>::userData() const
 {
@@ -1089,8 +1180,6 @@ void RequestManager<REQUEST, RESPONSE>::onRequestTimeout(int requestId)
         // Do not remove the request from the map yet (a response will
         // eventually be received, or the request be canceled).
 
-        // Explicitly invalidate the timeout since we processed it
-        request->d_timeoutSchedulerHandle.release();
     }  // close guard scope
 
     BALL_LOG_ERROR << "Request with '" << request->nodeDescription()
@@ -1138,15 +1227,164 @@ void RequestManager<REQUEST, RESPONSE>::onRequestTimeout(int requestId)
     }
 }
 
+template <class REQUEST, class RESPONSE>
+void RequestManager<REQUEST, RESPONSE>::onTimerTick(unsigned int generation)
+{
+    // executed by the *SCHEDULER* thread
+
+    bsls::TimeInterval tick;
+    tick.addMilliseconds(k_TIMER_WHEEL_TICK_MS);
+
+    bsl::vector<int> expiredRequestIds(d_allocator_p);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // MUTEX LOCKED
+
+        if (generation != d_timerGeneration) {
+            // The wheel was restarted, and this tick is stale.
+            return;  // RETURN
+        }
+
+        const bsls::TimeInterval now = mwcsys::Time::nowMonotonicClock();
+
+        // Visit the slots of the ticks elapsed since the last one processed,
+        // up to one revolution of the wheel (after which all slots have been
+        // visited).  A slot may hold requests expiring at a later revolution,
+        // hence the comparison with the deadline of each request.
+        int numTicks = 0;
+        while (d_timerTime + tick <= now) {
+            d_timerTime += tick;
+            if (numTicks++ >= k_TIMER_WHEEL_NUM_SLOTS) {
+                continue;  // CONTINUE
+            }
+
+            d_timerSlot = (d_timerSlot + 1) % k_TIMER_WHEEL_NUM_SLOTS;
+
+            RequestType* request = d_timerWheel[d_timerSlot];
+            while (request) {
+                RequestType* next = request->d_timerNext_p;
+                if (request->d_timeoutDeadline <= now) {
+                    expiredRequestIds.push_back(
+                        request->request().rId().value());
+                    disarmTimer(request);
+                }
+                request = next;
+            }
+        }
+
+        if (d_numTimers != 0) {
+            d_scheduler_p->scheduleEvent(
+                &d_timerEventHandle,
+                d_timerTime + tick,
+                bdlf::BindUtil::bind(&RequestManager::onTimerTick,
+                                     this,
+                                     generation));
+        }
+        else {
+            d_timerEventHandle.release();
+        }
+    }  // close guard scope
+
+    // Time out the expired requests outside the mutex, in the order in which
+    // they were found.
+    for (bsl::vector<int>::const_iterator it = expiredRequestIds.begin();
+         it != expiredRequestIds.end();
+         ++it) {
+        mwcex::ExecutionUtil::execute(
+            mwcex::ExecutionPolicyUtil::oneWay()
+                .possiblyBlocking()
+                .useExecutor(d_executor)
+                .useAllocator(d_allocator_p),
+            bdlf::BindUtil::bind(&RequestManager::onRequestTimeout,
+                                 this,
+                                 *it));
+    }
+}
+
+template <class REQUEST, class RESPONSE>
+void RequestManager<REQUEST, RESPONSE>::armTimer(
+    RequestType*              request,
+    const bsls::TimeInterval& deadline)
+{
+    // mutex LOCKED
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(request->d_timerSlot == -1);
+
+    bsls::TimeInterval tick;
+    tick.addMilliseconds(k_TIMER_WHEEL_TICK_MS);
+
+    if (d_numTimers == 0) {
+        // The wheel is idle: restart it from now.  Note that the tick of the
+        // previous generation, if any, may still be scheduled or running.
+        d_scheduler_p->cancelEvent(&d_timerEventHandle);
+
+        ++d_timerGeneration;
+        d_timerTime = mwcsys::Time::nowMonotonicClock();
+        d_scheduler_p->scheduleEvent(
+            &d_timerEventHandle,
+            d_timerTime + tick,
+            bdlf::BindUtil::bind(&RequestManager::onTimerTick,
+                                 this,
+                                 d_timerGeneration));
+    }
+
+    // Number of ticks, rounded up, until the deadline
+    bsls::Types::Int64 numTicks = 1;
+    if (deadline > d_timerTime) {
+        const bsls::Types::Int64 tickNs = tick.totalNanoseconds();
+        numTicks = ((deadline - d_timerTime).totalNanoseconds() + tickNs -
+                    1) /
+                   tickNs;
+    }
+
+    const int slot = static_cast<int>(
+        (d_timerSlot + numTicks) % k_TIMER_WHEEL_NUM_SLOTS);
+
+    request->d_timeoutDeadline = deadline;
+    request->d_timerSlot       = slot;
+    request->d_timerPrev_p     = 0;
+    request->d_timerNext_p     = d_timerWheel[slot];
+    if (d_timerWheel[slot]) {
+        d_timerWheel[slot]->d_timerPrev_p = request;
+    }
+    d_timerWheel[slot] = request;
+
+    ++d_numTimers;
+}
+
+template <class REQUEST, class RESPONSE>
+void RequestManager<REQUEST, RESPONSE>::disarmTimer(RequestType* request)
+{
+    // mutex LOCKED
+
+    if (request->d_timerSlot == -1) {
+        return;  // RETURN
+    }
+
+    if (request->d_timerPrev_p) {
+        request->d_timerPrev_p->d_timerNext_p = request->d_timerNext_p;
+    }
+    else {
+        d_timerWheel[request->d_timerSlot] = request->d_timerNext_p;
+    }
+    if (request->d_timerNext_p) {
+        request->d_timerNext_p->d_timerPrev_p = request->d_timerPrev_p;
+    }
+
+    request->d_timerSlot   = -1;
+    request->d_timerPrev_p = 0;
+    request->d_timerNext_p = 0;
+
+    --d_numTimers;
+}
+
 template <class REQUEST, class RESPONSE>
 void RequestManager<REQUEST, RESPONSE>::applyResponse(const RequestSp& request,
                                                       const RESPONSE& response)
 {
     // mutex *NOT* locked
 
-    // Cancel the timeout event
-    d_scheduler_p->cancelEvent(&(request->d_timeoutSchedulerHandle));
-
     // Populate response field.
 
     // The lateResponseMode assumes that 'onRequestTimeout' is serialized with
@@ -1207,6 +1445,14 @@ RequestManager<REQUEST, RESPONSE>::RequestManager(
                                        // thread instead of spawning a new
                                        // thread every time.
 , d_dtContext_sp(NULL)
+, d_timerWheel(k_TIMER_WHEEL_NUM_SLOTS,
+               static_cast<RequestType*>(0),
+               allocator)
+, d_timerSlot(0)
+, d_timerTime()
+, d_numTimers(0)
+, d_timerGeneration(0)
+, d_timerEventHandle()
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(d_scheduler_p->clockType() ==
@@ -1230,6 +1476,14 @@ RequestManager<REQUEST, RESPONSE>::RequestManager(
 , d_lateResponseMode(lateResponseMode)
 , d_executor(executor)
 , d_dtContext_sp(NULL)
+, d_timerWheel(k_TIMER_WHEEL_NUM_SLOTS,
+               static_cast<RequestType*>(0),
+               allocator)
+, d_timerSlot(0)
+, d_timerTime()
+, d_numTimers(0)
+, d_timerGeneration(0)
+, d_timerEventHandle()
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(d_scheduler_p->clockType() ==
@@ -1255,6 +1509,14 @@ RequestManager<REQUEST, RESPONSE>::RequestManager(
 , d_lateResponseMode(lateResponseMode)
 , d_executor(executor)
 , d_dtContext_sp(dtContext)
+, d_timerWheel(k_TIMER_WHEEL_NUM_SLOTS,
+               static_cast<RequestType*>(0),
+               allocator)
+, d_timerSlot(0)
+, d_timerTime()
+, d_numTimers(0)
+, d_timerGeneration(0)
+, d_timerEventHandle()
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(d_scheduler_p->clockType() ==
@@ -1270,6 +1532,9 @@ RequestManager<REQUEST, RESPONSE>::~RequestManager()
                      "There are still outstanding requests, "
                      "'cancelAllRequests()' must be called before destroying "
                      "this object");
+    BSLS_ASSERT_SAFE(d_numTimers == 0);
+
+    d_scheduler_p->cancelEvent(&d_timerEventHandle);
 }
 
 template <class REQUEST, class RESPONSE>
@@ -1374,18 +1639,8 @@ bmqt::GenericResult::Enum RequestManager<REQUEST, RESPONSE>::sendRequest(
         return sendRc;  // RETURN
     }
 
-    // Schedule a timeout
-    d_scheduler_p->scheduleEvent(
-        &(request->d_timeoutSchedulerHandle),
-        mwcsys::Time::nowMonotonicClock() + timeout,
-        mwcex::BindUtil::bindExecute(
-            mwcex::ExecutionPolicyUtil::oneWay()
-                .possiblyBlocking()
-                .useExecutor(d_executor)
-                .useAllocator(d_allocator_p),
-            bdlf::BindUtil::bind(&RequestManager::onRequestTimeout,
-                                 this,
-                                 requestId)));
+    // Arm the timeout
+    armTimer(request.get(), mwcsys::Time::nowMonotonicClock() + timeout);
 
     // Insert the request in the map
     bsl::pair<RequestMapIter, bool> insertRC = d_requests.insert(
@@ -1423,6 +1678,7 @@ int RequestManager<REQUEST, RESPONSE>::processResponse(
 
         request = it->second;
         d_requests.erase(it);
+        disarmTimer(request.get());
 
         if (request->d_haveTimeout && !d_lateResponseMode) {
             // Ignore late response
@@ -1484,6 +1740,7 @@ void RequestManager<REQUEST, RESPONSE>::cancelAllRequestsImpl(
                     BSLS_ASSERT_SAFE(insertRC.second);
                     (void)insertRC;  // Compiler happiness
                 }
+                disarmTimer(it->second.get());
                 d_requests.erase(it++);
             }
             else {
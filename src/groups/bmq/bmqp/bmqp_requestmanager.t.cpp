@@ -1036,6 +1036,78 @@ static void test8_requestSignalWaitTest()
     }
 }
 
+static void test9_requestTimeoutTest()
+// ------------------------------------------------------------------------
+// Testing:
+//   Timeout of requests having different timeouts, including timeouts
+//   longer than one revolution of the timing wheel, and responses
+//   received before the timeout.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("REQUEST TIMEOUT TEST");
+
+    struct Sender {
+        static bmqt::GenericResult::Enum sendFn(const bdlbb::Blob&)
+        {
+            return bmqt::GenericResult::e_SUCCESS;
+        }
+    };
+
+    TestContext context(false, s_allocator_p);
+
+    const bsls::TimeInterval k_TIMEOUTS[] = {bsls::TimeInterval(1),
+                                             bsls::TimeInterval(10),
+                                             bsls::TimeInterval(100),
+                                             bsls::TimeInterval(60)};
+    const bsl::size_t        k_NUM_REQUESTS = sizeof(k_TIMEOUTS) /
+                                       sizeof(*k_TIMEOUTS);
+
+    ReqVec requests(s_allocator_p);
+    for (bsl::size_t i = 0; i < k_NUM_REQUESTS; ++i) {
+        ReqSp request = context.createRequest();
+        context.populateRequest(request);
+
+        bmqt::GenericResult::Enum rc = context.manager().sendRequest(
+            request,
+            &Sender::sendFn,
+            bsl::string("foo", s_allocator_p),
+            k_TIMEOUTS[i]);
+        ASSERT_EQ(rc, bmqt::GenericResult::e_SUCCESS);
+        requests.push_back(request);
+    }
+
+    // Respond to the last request before its timeout
+    ASSERT_EQ(0,
+              context.manager().processResponse(context.createResponse(
+                  requests[3]->request().rId().value())));
+    ASSERT_EQ(requests[3]->result(), bmqt::GenericResult::e_SUCCESS);
+
+    context.advanceTime(bsls::TimeInterval(0.5));
+    ASSERT(!requests[0]->isLocalTimeout());
+
+    context.advanceTime(bsls::TimeInterval(0.5));
+    ASSERT(requests[0]->isLocalTimeout());
+    ASSERT_EQ(requests[0]->result(), bmqt::GenericResult::e_TIMEOUT);
+    ASSERT(!requests[1]->isLocalTimeout());
+    ASSERT(!requests[2]->isLocalTimeout());
+
+    context.advanceTime(bsls::TimeInterval(9));
+    ASSERT(requests[1]->isLocalTimeout());
+    ASSERT(!requests[2]->isLocalTimeout());
+
+    // One revolution of the wheel later than the slot of the third request
+    context.advanceTime(bsls::TimeInterval(50));
+    ASSERT(!requests[2]->isLocalTimeout());
+
+    context.advanceTime(bsls::TimeInterval(40));
+    ASSERT(requests[2]->isLocalTimeout());
+    ASSERT_EQ(requests[2]->result(), bmqt::GenericResult::e_TIMEOUT);
+
+    // The responded request did not time out
+    ASSERT(!requests[3]->isLocalTimeout());
+    ASSERT_EQ(requests[3]->result(), bmqt::GenericResult::e_SUCCESS);
+}
+
 // ============================================================================
 //                                MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1049,6 +1121,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 9: test9_requestTimeoutTest(); break;
     case 8: test8_requestSignalWaitTest(); break;
     case 7: test7_requestBreathingTest(); break;
     case 6: test6_cancelAllRequestsTest(); break;
@@ -392,6 +392,42 @@ int SchemaLearner::read(Context&                     context,
     return rc;
 }
 
+SchemaLearner::SchemaPtr
+SchemaLearner::learn(Context&                     context,
+                     const MessagePropertiesInfo& messagePropertiesInfo,
+                     const MessagePropertiesView& view)
+{
+    SchemaIdType inputSchemaId = messagePropertiesInfo.schemaId();
+
+    if (!isPresentAndValid(inputSchemaId)) {
+        // Invalid schema or old style
+        return SchemaPtr();  // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(context);
+
+    // Lookup the schema within this source
+    HandlePtr& schemaHandle = context->d_handles[inputSchemaId];
+
+    if (!schemaHandle) {
+        schemaHandle.load(new (*d_allocator_p) SchemaHandle(inputSchemaId),
+                          d_allocator_p);
+    }
+    else if (messagePropertiesInfo.isRecycled()) {
+        // forget the schema
+        schemaHandle->d_schema_sp.reset();
+    }
+
+    if (!schemaHandle->d_schema_sp) {
+        // Learn new schema.
+        bsl::shared_ptr<MessageProperties::Schema> schema;
+        schema.createInplace(d_allocator_p, view, d_allocator_p);
+        schemaHandle->d_schema_sp = schema;
+    }
+
+    return schemaHandle->d_schema_sp;
+}
+
 // CLASS METHODS
 bool SchemaLearner::isPresentAndValid(SchemaIdType schemaId)
 {
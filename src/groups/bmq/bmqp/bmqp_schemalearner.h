@@ -52,6 +52,12 @@
 // 4. When receiving messages as a single target, 'observe' makes sure
 //    previously learned 'Schema' is reset upon recycling indication.
 //    Caller is 'bmqimp::BrokerSession'
+// 5. When reading properties in place with a 'MessagePropertiesView', such as
+//    when evaluating subscription expressions, 'learn' returns the index of
+//    each property name in the known Schema, learning it from the view if it
+//    is unknown.  The index is a hint to the view, so that looking a property
+//    up does not involve comparing names with all the preceding ones.
+//    Caller is 'mqbblp::Routers'.
 //
 /// Thread Safety
 ///-------------
@@ -87,6 +93,7 @@
 // BMQ
 
 #include <bmqp_messageproperties.h>
+#include <bmqp_messagepropertiesview.h>
 #include <bmqp_protocol.h>
 
 // BDE
@@ -213,6 +220,21 @@ class SchemaLearner {
              const MessagePropertiesInfo& messagePropertiesInfo,
              const bdlbb::Blob&           blob);
 
+    /// Return the Schema of the properties denoted by the specified
+    /// `messagePropertiesInfo` within the specified `context`, learning it
+    /// from the specified `view` if it is unknown or if
+    /// `messagePropertiesInfo` indicates recycling.  Return an empty
+    /// pointer if `messagePropertiesInfo` does not have a valid Schema id.
+    /// The behavior is undefined unless `view` is associated with the
+    /// properties of the message having `messagePropertiesInfo`.  Note
+    /// that the indices of the returned Schema are hints for `view` (see
+    /// `MessagePropertiesView::findProperty`), and may be stale if the
+    /// sequence of properties denoted by the id changes without recycling
+    /// indication.
+    SchemaPtr learn(Context&                     context,
+                    const MessagePropertiesInfo& messagePropertiesInfo,
+                    const MessagePropertiesView& view);
+
     /// Reset previously learned schema accumulated with the specified
     /// `context` and associated with the id in specified `input` if the
     /// `input` indicates recycling.
@@ -17,6 +17,7 @@
 
 // BMQ
 #include <bmqp_messageproperties.h>
+#include <bmqp_messagepropertiesview.h>
 #include <bmqp_protocolutil.h>
 #include <bmqp_schemalearner.h>
 
@@ -442,6 +443,61 @@ static void test7_removeBeforeRead()
     }
 }
 
+static void test8_learnTest()
+{
+    // Simulate Routers reading MPs in place, in Broker's context.
+    // The learned schema must be the same until recycling is indicated, and
+    // its indices must be those of the properties in the view.
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(128, s_allocator_p);
+    bmqp::SchemaLearner            theLearner(s_allocator_p);
+    bmqp::SchemaLearner::Context   context(theLearner.createContext());
+    bmqp::MessageProperties        in(s_allocator_p);
+    bmqp::MessagePropertiesInfo    input(true, 1, false);
+    bmqp::MessagePropertiesInfo    recycledInput(true, 1, true);
+    bmqp::MessagePropertiesView    view(s_allocator_p);
+
+    const int num = 16;
+
+    for (int i = 0; i < num; ++i) {
+        bsl::string name = bsl::to_string(i);
+        ASSERT_EQ(0, in.setPropertyAsString(name, name));
+    }
+
+    const bdlbb::Blob blob = in.streamOut(&bufferFactory, input);
+    ASSERT_EQ(0, view.reset(blob, true));
+
+    bmqp::MessageProperties::SchemaPtr schema1 =
+        theLearner.learn(context, input, view);
+    ASSERT(schema1);
+
+    ASSERT_EQ(schema1, theLearner.learn(context, input, view));
+    // subsequent call returns the same Schema
+
+    for (int i = 0; i < view.numProperties(); ++i) {
+        bsl::string name(s_allocator_p);
+        view.loadPropertyName(&name, i);
+
+        int index = -1;
+        ASSERT(schema1->loadIndex(&index, name));
+        ASSERT_EQ(i, index);
+    }
+
+    bmqp::MessageProperties::SchemaPtr schema2 =
+        theLearner.learn(context, recycledInput, view);
+    ASSERT(schema2);
+    ASSERT_NE(schema1, schema2);
+    // ...unless the input is recycled
+
+    ASSERT(!theLearner.learn(context,
+                             bmqp::MessagePropertiesInfo::makeNoSchema(),
+                             view));
+    ASSERT(!theLearner.learn(context,
+                             bmqp::MessagePropertiesInfo::makeInvalidSchema(),
+                             view));
+    // no Schema without valid id
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -453,6 +509,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 8: test8_learnTest(); break;
     case 7: test7_removeBeforeRead(); break;
     case 6: test6_partialRead(); break;
     case 5: test5_emptyMPs(); break;
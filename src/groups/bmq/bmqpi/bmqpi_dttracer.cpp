@@ -17,6 +17,9 @@
 #include <bmqpi_dttracer.h>
 
 #include <bmqscm_version.h>
+// BDE
+#include <bsls_annotation.h>
+
 namespace BloombergLP {
 namespace bmqpi {
 
@@ -29,5 +32,12 @@ DTTracer::~DTTracer()
     // NOTHING
 }
 
+bool DTTracer::isSampled(
+    BSLS_ANNOTATION_UNUSED const bsl::shared_ptr<DTSpan>& parent,
+    BSLS_ANNOTATION_UNUSED const bsl::string_view&        operation) const
+{
+    return true;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -24,6 +24,18 @@
 //
 //@DESCRIPTION:
 // 'bmqpi::DTTracer' is a pure interface for creators of new 'DTSpan' objects.
+//
+/// Sampling
+///--------
+// Before creating a span for an operation, the BlazingMQ SDK asks the tracer,
+// through 'isSampled', whether the operation is traced at all.  When it is
+// not, no span is created, no baggage is built and no span is made active, so
+// that an operation not sampled costs close to nothing.  This lets a tracer
+// implement head-based sampling: the decision is taken once, when the root
+// span of a trace is created by the application, and 'isSampled' propagates
+// it to the children by inspecting the specified 'parent' (for instance,
+// returning whether 'parent' is non-null and sampled).  The default
+// implementation samples all the operations.
 
 // BMQ
 
@@ -50,6 +62,12 @@ class DTTracer {
 
     // PUBLIC METHODS
 
+    /// Return `true` if a span should be created for the specified
+    /// `operation` as a child of the specified `parent`, and `false`
+    /// otherwise.  The default implementation returns `true`.
+    virtual bool isSampled(const bsl::shared_ptr<DTSpan>& parent,
+                           const bsl::string_view&        operation) const;
+
     /// Creates and returns a new `DTSpan` representing `operation` as a
     /// child of `parent`, having the key-value tags defined by `baggage`.
     virtual bsl::shared_ptr<DTSpan> createChildSpan(
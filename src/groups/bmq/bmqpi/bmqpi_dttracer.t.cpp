@@ -35,6 +35,12 @@ struct DTTracerTestImp : public bsls::ProtocolTestImp<bmqpi::DTTracer> {
         const bsl::shared_ptr<bmqpi::DTSpan>& parent,
         const bsl::string_view&               operation,
         const bmqpi::DTSpan::Baggage& baggage) const BSLS_KEYWORD_OVERRIDE;
+
+    bool isSampled(const bsl::shared_ptr<bmqpi::DTSpan>&,
+                   const bsl::string_view&) const BSLS_KEYWORD_OVERRIDE
+    {
+        return markDone();
+    }
 };
 
 // Define one of DTTracerTestImp methods out-of-line, to instruct the
@@ -102,6 +108,7 @@ static void test1_breathingTest()
     PV("Verify that all methods are public and virtual");
     bmqpi::DTSpan::Baggage empty;
     BSLS_PROTOCOLTEST_ASSERT(tracer, createChildSpan(NULL, "", empty));
+    BSLS_PROTOCOLTEST_ASSERT(tracer, isSampled(NULL, ""));
 }
 
 // ============================================================================
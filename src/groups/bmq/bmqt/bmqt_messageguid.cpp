@@ -152,5 +152,11 @@ MessageGUID::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     return stream;
 }
 
+// -------------------------
+// class MessageGUIDHashAlgo
+// -------------------------
+
+const char MessageGUIDHashAlgo::s_seedAnchor = 0;
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -82,6 +82,7 @@
 #include <bslmf_istriviallycopyable.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bsls_annotation.h>
+#include <bsls_assert.h>
 #include <bsls_types.h>
 
 namespace BloombergLP {
@@ -251,12 +252,24 @@ struct MessageGUIDLess {
 /// time of writing, this algorithm was found to be approximately 4x faster
 /// than the default hashing algorithm that comes with `bslh` package.
 /// Performance-critical applications may want to use this hashing algorithm
-/// instead of the default one.
+/// instead of the default one.  Note that the hash of a GUID is seeded with
+/// a value which differs across processes (when the address space layout is
+/// randomized), so that colliding GUIDs cannot be crafted in advance; the
+/// hash must therefore never be persisted or exchanged between processes.
 class MessageGUIDHashAlgo {
   private:
+    // CLASS DATA
+    static const char s_seedAnchor;
+    // Object whose address seeds the hash.
+
     // DATA
     bsls::Types::Uint64 d_result;
 
+    // PRIVATE CLASS METHODS
+
+    /// Return the seed of the hash in this process.
+    static bsls::Types::Uint64 seed();
+
   public:
     // TYPES
     typedef bsls::Types::Uint64 result_type;
@@ -323,6 +336,13 @@ inline bool MessageGUIDLess::operator()(const MessageGUID& lhs,
 // class MessageGUIDHashAlgo
 // -------------------------
 
+// PRIVATE CLASS METHODS
+inline bsls::Types::Uint64 MessageGUIDHashAlgo::seed()
+{
+    return static_cast<bsls::Types::Uint64>(
+        reinterpret_cast<bsls::Types::UintPtr>(&s_seedAnchor));
+}
+
 // CREATORS
 inline MessageGUIDHashAlgo::MessageGUIDHashAlgo()
 : d_result(0)
@@ -334,53 +354,31 @@ inline void
 MessageGUIDHashAlgo::operator()(const void*                   data,
                                 BSLS_ANNOTATION_UNUSED size_t numBytes)
 {
-    // Implementation note: we implement the 'djb2' hash algorithm (more
-    // details at http://www.cse.yorku.ca/~oz/hash.html).
-
-    // At the time of writing, this algorithm came out to be about 400% faster
-    // than 'bslh::SpookyHashAlgorithm', which is the default hashing algorithm
-    // in 'bslh' hashing framework.  Note that while
-    // 'bslh::SpookyHashAlgorithm' is slower, it may have a better uniform
-    // distribution than this algorithm (although some literature claims djb2
-    // to have a very good distribution as well).  Both algorithms were found
-    // to be collision free in testing (see mqbu_messageguidtutil.t).
-
-    // We have slightly modified the djb2 algorithm by unrolling djb2 'while'
-    // loop, by using our knowledge that 'numBytes' is always 16 for
-    // 'bmqt::MessageGUID'.  For reference, the unmodified djb2 algorithm has
-    // been specified at the end of this method.  Our unrolled version comes
-    // out to be about 25% faster than the looped version.  The unrolled
-    // version has data dependency, so its not the ILP but probably the absence
-    // of branching which makes it faster than the looped version.
-
-    d_result = 5381ULL;
-
-    const char* start = reinterpret_cast<const char*>(data);
-    d_result          = (d_result << 5) + d_result + start[0];
-    d_result          = (d_result << 5) + d_result + start[1];
-    d_result          = (d_result << 5) + d_result + start[2];
-    d_result          = (d_result << 5) + d_result + start[3];
-    d_result          = (d_result << 5) + d_result + start[4];
-    d_result          = (d_result << 5) + d_result + start[5];
-    d_result          = (d_result << 5) + d_result + start[6];
-    d_result          = (d_result << 5) + d_result + start[7];
-    d_result          = (d_result << 5) + d_result + start[8];
-    d_result          = (d_result << 5) + d_result + start[9];
-    d_result          = (d_result << 5) + d_result + start[10];
-    d_result          = (d_result << 5) + d_result + start[11];
-    d_result          = (d_result << 5) + d_result + start[12];
-    d_result          = (d_result << 5) + d_result + start[13];
-    d_result          = (d_result << 5) + d_result + start[14];
-    d_result          = (d_result << 5) + d_result + start[15];
-
-    // For reference, 'loop' version of djb2 algorithm:
-    //..
-    //  size_t index = 0;
-    //  while (index++ < numBytes) {
-    //      d_result = (d_result << 5) + d_result +  // same as 'd_result * 33'
-    //                 (reinterpret_cast<const char*>(data))[index];
-    //  }
-    //..
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(numBytes == MessageGUID::e_SIZE_BINARY);
+
+    // Implementation note: the 16 bytes of the GUID are folded as two 64-bit
+    // words, each one being mixed in with a multiplication by a large odd
+    // constant (the 64-bit golden ratio) and a xor-shift, which spreads the
+    // entropy of every byte to the high and low bits of the result.  This
+    // takes two multiplications, instead of a data dependent chain of 16
+    // multiply-adds with a byte-wise algorithm such as 'djb2', and the seed
+    // mixed in with the first word protects the hash tables keyed by GUIDs
+    // received from clients against deliberate collisions.  See the
+    // uniqueness test cases and benchmarks in mqbu_messageguidutil.t.
+
+    const bsls::Types::Uint64 k_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+    bsls::Types::Uint64 low;
+    bsls::Types::Uint64 high;
+    bsl::memcpy(&low, data, sizeof(low));
+    bsl::memcpy(&high,
+                static_cast<const char*>(data) + sizeof(low),
+                sizeof(high));
+
+    d_result = (low ^ seed()) * k_MULTIPLIER;
+    d_result = (d_result ^ (d_result >> 32) ^ high) * k_MULTIPLIER;
+    d_result ^= d_result >> 32;
 }
 
 inline MessageGUIDHashAlgo::result_type MessageGUIDHashAlgo::computeHash()
@@ -34,6 +34,8 @@ SessionOptions::SessionOptions(bslma::Allocator* allocator)
 : d_brokerUri(k_BROKER_DEFAULT_URI, allocator)
 , d_processNameOverride(allocator)
 , d_numProcessingThreads(1)
+, d_numCompressionThreads(0)
+, d_zstdCompressionLevel(3)
 , d_blobBufferSize(4 * 1024)
 , d_channelHighWatermark(128 * 1024 * 1024)
 , d_statsDumpInterval(5 * 60.0)
@@ -45,6 +47,12 @@ SessionOptions::SessionOptions(bslma::Allocator* allocator)
 , d_eventQueueLowWatermark(50)
 , d_eventQueueHighWatermark(2 * 1000)
 , d_eventQueueSize(-1)  // DEPRECATED: will be removed in future release
+, d_eventQueueLockFree(false)
+, d_eventQueueSpinCount(0)
+, d_ioThreadCpu(-1)
+, d_putBatchMaxBytes(0)
+, d_putBatchLinger(0)
+, d_flowControlAdaptationInterval(0)
 , d_hostHealthMonitor_sp(NULL)
 , d_dtContext_sp(NULL)
 , d_dtTracer_sp(NULL)
@@ -57,6 +65,8 @@ SessionOptions::SessionOptions(const SessionOptions& other,
 : d_brokerUri(other.brokerUri(), allocator)
 , d_processNameOverride(other.processNameOverride(), allocator)
 , d_numProcessingThreads(other.numProcessingThreads())
+, d_numCompressionThreads(other.numCompressionThreads())
+, d_zstdCompressionLevel(other.zstdCompressionLevel())
 , d_blobBufferSize(other.blobBufferSize())
 , d_channelHighWatermark(other.channelHighWatermark())
 , d_statsDumpInterval(other.statsDumpInterval())
@@ -68,6 +78,12 @@ SessionOptions::SessionOptions(const SessionOptions& other,
 , d_eventQueueLowWatermark(other.eventQueueLowWatermark())
 , d_eventQueueHighWatermark(other.eventQueueHighWatermark())
 , d_eventQueueSize(-1)  // DEPRECATED: will be removed in future release
+, d_eventQueueLockFree(other.eventQueueLockFree())
+, d_eventQueueSpinCount(other.eventQueueSpinCount())
+, d_ioThreadCpu(other.ioThreadCpu())
+, d_putBatchMaxBytes(other.putBatchMaxBytes())
+, d_putBatchLinger(other.putBatchLinger())
+, d_flowControlAdaptationInterval(other.flowControlAdaptationInterval())
 , d_hostHealthMonitor_sp(other.hostHealthMonitor())
 , d_dtContext_sp(other.traceContext())
 , d_dtTracer_sp(other.tracer())
@@ -88,6 +104,8 @@ bsl::ostream& SessionOptions::print(bsl::ostream& stream,
     printer.printAttribute("brokerUri", d_brokerUri);
     printer.printAttribute("processNameOverride", d_processNameOverride);
     printer.printAttribute("numProcessingThreads", d_numProcessingThreads);
+    printer.printAttribute("numCompressionThreads", d_numCompressionThreads);
+    printer.printAttribute("zstdCompressionLevel", d_zstdCompressionLevel);
     printer.printAttribute("blobBufferSize", d_blobBufferSize);
     printer.printAttribute("channelHighWatermark", d_channelHighWatermark);
     printer.printAttribute("statsDumpInterval",
@@ -105,6 +123,15 @@ bsl::ostream& SessionOptions::print(bsl::ostream& stream,
     printer.printAttribute("eventQueueLowWatermark", d_eventQueueLowWatermark);
     printer.printAttribute("eventQueueHighWatermark",
                            d_eventQueueHighWatermark);
+    printer.printAttribute("eventQueueLockFree", d_eventQueueLockFree);
+    printer.printAttribute("eventQueueSpinCount", d_eventQueueSpinCount);
+    printer.printAttribute("ioThreadCpu", d_ioThreadCpu);
+    printer.printAttribute("putBatchMaxBytes", d_putBatchMaxBytes);
+    printer.printAttribute("putBatchLinger",
+                           d_putBatchLinger.totalSecondsAsDouble());
+    printer.printAttribute(
+        "flowControlAdaptationInterval",
+        d_flowControlAdaptationInterval.totalSecondsAsDouble());
     printer.printAttribute("hasHostHealthMonitor",
                            d_hostHealthMonitor_sp != NULL);
     printer.printAttribute("hasDistributedTracing", d_dtTracer_sp != NULL);
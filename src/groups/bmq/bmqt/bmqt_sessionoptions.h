@@ -41,6 +41,9 @@
 //:        When the connection with the host goes down, it will automatically
 //:        immediately failover and reconnects to another entry from the
 //:        address list.
+//:      A broker running on the same host and listening on a local socket
+//:      can also be reached with 'unix://<path>' (e.g.
+//:      'unix:///var/run/bmq.sock'), which bypasses the TCP/IP stack.
 //:      If the environment variable 'BMQ_BROKER_URI' is set, then instances of
 //:      'bmqa::Session' will ignore the 'brokerUri' field from the provided
 //:      'SessionOptions' and use the value from this environment variable
@@ -56,6 +59,19 @@
 //:      that this setting has an effect only if providing a
 //:      'SessionEventHandler' to the session.
 //:
+//: o !numCompressionThreads!:
+//:      Number of threads to use for compressing, in parallel, the payloads
+//:      of the messages of an event being built.  Default is 0, meaning that
+//:      each payload is compressed by the thread packing the message into
+//:      the event.  This is only worth setting when posting events made of
+//:      several large messages with compression enabled.
+//:
+//: o !zstdCompressionLevel!:
+//:      Level at which the payloads of the messages posted with the 'ZSTD'
+//:      compression algorithm, without dictionary, are compressed.  Default
+//:      is 3.  Higher levels (up to 22) trade CPU for a better compression
+//:      ratio, and lower ones the opposite.
+//:
 //: o !blobBufferSize!:
 //:      Size (in bytes) of the blob buffers to use. Default value is 4k.
 //:
@@ -101,6 +117,58 @@
 //:      'lowWatermark' values to avoid a constant back and forth toggling of
 //:      state resulting from push pop of events.
 //:
+//: o !eventQueueLockFree!:
+//:      Whether the EventQueue should use a bounded lock-free queue instead of
+//:      the default unbounded queue serializing producers with a spin lock.
+//:      This reduces contention when many threads (the IO thread, the
+//:      processing threads and the application threads) enqueue events at
+//:      the same time.  The bounded queue has a fixed capacity derived from
+//:      the 'eventQueueHighWatermark', and a message event is dropped (and an
+//:      error is logged) if the queue is full; session events are never
+//:      dropped.  Default is false.
+//:
+//: o !eventQueueSpinCount!:
+//:      Number of attempts at popping an event from the EventQueue without
+//:      blocking, before waiting for an event to be enqueued, in
+//:      'Session::nextEvent' and in the processing threads.  Spinning avoids
+//:      the latency of waking up a blocked thread, at the cost of keeping a
+//:      CPU busy while the queue is empty, and is intended for applications
+//:      dedicating cores to the reception of messages.  Default is 0 (block
+//:      immediately if the queue is empty).
+//:
+//: o !ioThreadCpu!:
+//:      Index of the CPU to bind the IO thread of the session to, or -1 to
+//:      let the operating system schedule it.  This is only supported on
+//:      Linux.  Default is -1.
+//:
+//: o !putBatchMaxBytes!:
+//:      Maximum size, in bytes, of the PUT events built by the session by
+//:      coalescing the events posted by the application, or 0 to disable
+//:      coalescing.  When enabled, posted PUT events are held until either
+//:      their combined size reaches 'putBatchMaxBytes' or 'putBatchLinger'
+//:      elapsed, and are then written to the broker as a single event.  This
+//:      increases throughput for applications posting many small events, at
+//:      the cost of a latency bounded by 'putBatchLinger'.  Default is 0.
+//:
+//: o !putBatchLinger!:
+//:      Maximum time a posted PUT event is held, waiting for more events to
+//:      coalesce with, before being written to the broker.  This is only
+//:      relevant if 'putBatchMaxBytes' is not 0.  A linger of 0 only
+//:      coalesces events already pending in the session.  Default is 0.
+//:
+//: o !flowControlAdaptationInterval!:
+//:      Interval at which the session adapts the 'maxUnconfirmedMessages'
+//:      and 'maxUnconfirmedBytes' of each reader queue, or 0 to disable
+//:      adaptive flow control.  When enabled, the session observes the
+//:      messages received and confirmed on each queue, and reconfigures the
+//:      queue so that its window of unconfirmed messages stays close to what
+//:      the consumer needs to never be idle, without hoarding messages that
+//:      could be delivered to other consumers.  The values configured by the
+//:      application (at open or with 'configureQueue') are the initial and
+//:      highest windows, and should therefore be generous; note that the
+//:      queue options reported by the session reflect the adapted values.
+//:      Default is 0.
+//:
 //: o !hostHealthMonitor!:
 //:      Optional instance of a class derived from 'bmqpi::HostHealthMonitor',
 //:      responsible for notifying the 'Session' when the health of the host
@@ -185,6 +253,16 @@ class SessionOptions {
     // Number of processing threads.
     // Default is 1 thread.
 
+    int d_numCompressionThreads;
+    // Number of threads compressing the
+    // payloads of messages being packed.
+    // Default is 0 (compress inline).
+
+    int d_zstdCompressionLevel;
+    // Level of the ZSTD compression of
+    // the payloads of messages being
+    // packed.  Default is 3.
+
     int d_blobBufferSize;
     // Size of the blobs buffer.
 
@@ -219,6 +297,31 @@ class SessionOptions {
     // longer relevant and will be removed
     // in future release of libbmq.
 
+    bool d_eventQueueLockFree;
+    // Whether the EventQueue uses a
+    // bounded lock-free queue.
+
+    int d_eventQueueSpinCount;
+    // Number of non-blocking attempts at
+    // popping an event before waiting.
+
+    int d_ioThreadCpu;
+    // CPU to bind the IO thread to, or
+    // -1.
+
+    int d_putBatchMaxBytes;
+    // Maximum size of coalesced PUT
+    // events, or 0 to disable coalescing.
+
+    bsls::TimeInterval d_putBatchLinger;
+    // Maximum time a PUT event is held
+    // for coalescing.
+
+    bsls::TimeInterval d_flowControlAdaptationInterval;
+    // Interval at which the unconfirmed
+    // windows of reader queues are
+    // adapted, or 0 to disable adaptation.
+
     bsl::shared_ptr<bmqpi::HostHealthMonitor> d_hostHealthMonitor_sp;
 
     bsl::shared_ptr<bmqpi::DTContext> d_dtContext_sp;
@@ -250,6 +353,15 @@ class SessionOptions {
     /// Set the number of processing threads to the specified `value`.
     SessionOptions& setNumProcessingThreads(int value);
 
+    /// Set the number of compression threads to the specified `value`.  The
+    /// behavior is undefined unless `0 <= value`.
+    SessionOptions& setNumCompressionThreads(int value);
+
+    /// Set the level of the ZSTD compression of the payloads of messages
+    /// to the specified `value`.  The behavior is undefined unless
+    /// `1 <= value <= 22`.
+    SessionOptions& setZstdCompressionLevel(int value);
+
     /// Set the specified `value` for the size of blobs buffers.
     SessionOptions& setBlobBufferSize(int value);
 
@@ -299,6 +411,42 @@ class SessionOptions {
     /// The behavior is undefined unless `lowWatermark < highWatermark`.
     SessionOptions& configureEventQueue(int lowWatermark, int highWatermark);
 
+    /// Set whether the EventQueue uses a bounded lock-free queue to the
+    /// specified `value`.  Refer to the component level documentation for
+    /// explanation of this option.
+    SessionOptions& setEventQueueLockFree(bool value);
+
+    /// Set the number of attempts at popping an event from the EventQueue
+    /// without blocking to the specified `value`.  Refer to the component
+    /// level documentation for explanation of this option.  The behavior is
+    /// undefined unless `0 <= value`.
+    SessionOptions& setEventQueueSpinCount(int value);
+
+    /// Bind the IO thread to the CPU having the specified `value` index,
+    /// or do not bind it if `value` is -1.  The behavior is undefined
+    /// unless `-1 <= value`.
+    SessionOptions& setIoThreadCpu(int value);
+
+    /// Set the maximum size of coalesced PUT events to the specified
+    /// `value`, or disable coalescing if `value` is 0.  Refer to the
+    /// component level documentation for explanation of this option.  The
+    /// behavior is undefined unless `0 <= value`.
+    SessionOptions& setPutBatchMaxBytes(int value);
+
+    /// Set the maximum time a PUT event is held for coalescing to the
+    /// specified `value`.  Refer to the component level documentation for
+    /// explanation of this option.  The behavior is undefined unless
+    /// `value` is not negative.
+    SessionOptions& setPutBatchLinger(const bsls::TimeInterval& value);
+
+    /// Set the interval at which the unconfirmed windows of reader queues
+    /// are adapted to the specified `value`, or disable adaptive flow
+    /// control if `value` is 0.  Refer to the component level documentation
+    /// for explanation of this option.  The behavior is undefined unless
+    /// `value` is not negative.
+    SessionOptions&
+    setFlowControlAdaptationInterval(const bsls::TimeInterval& value);
+
     // ACCESSORS
 
     /// Get the broker URI.
@@ -310,6 +458,12 @@ class SessionOptions {
     /// Get the number of processing threads.
     int numProcessingThreads() const;
 
+    /// Get the number of compression threads.
+    int numCompressionThreads() const;
+
+    /// Get the level of the ZSTD compression of the payloads of messages.
+    int zstdCompressionLevel() const;
+
     /// Get the size of the blobs buffer.
     int blobBufferSize() const;
 
@@ -342,6 +496,27 @@ class SessionOptions {
     /// in future release of libbmq.
     int eventQueueSize() const;
 
+    /// Return whether the EventQueue uses a bounded lock-free queue.
+    bool eventQueueLockFree() const;
+
+    /// Return the number of attempts at popping an event from the
+    /// EventQueue without blocking.
+    int eventQueueSpinCount() const;
+
+    /// Return the CPU to bind the IO thread to, or -1.
+    int ioThreadCpu() const;
+
+    /// Return the maximum size of coalesced PUT events, or 0 if coalescing
+    /// is disabled.
+    int putBatchMaxBytes() const;
+
+    /// Return the maximum time a PUT event is held for coalescing.
+    const bsls::TimeInterval& putBatchLinger() const;
+
+    /// Return the interval at which the unconfirmed windows of reader queues
+    /// are adapted, or 0 if adaptive flow control is disabled.
+    const bsls::TimeInterval& flowControlAdaptationInterval() const;
+
     /// Format this object to the specified output `stream` at the (absolute
     /// value of) the optionally specified indentation `level` and return a
     /// reference to `stream`.  If `level` is specified, optionally specify
@@ -400,6 +575,24 @@ inline SessionOptions& SessionOptions::setNumProcessingThreads(int value)
     return *this;
 }
 
+inline SessionOptions& SessionOptions::setNumCompressionThreads(int value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= value);
+
+    d_numCompressionThreads = value;
+    return *this;
+}
+
+inline SessionOptions& SessionOptions::setZstdCompressionLevel(int value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(1 <= value && value <= 22);
+
+    d_zstdCompressionLevel = value;
+    return *this;
+}
+
 inline SessionOptions& SessionOptions::setBlobBufferSize(int value)
 {
     d_blobBufferSize = value;
@@ -506,6 +699,59 @@ inline SessionOptions& SessionOptions::configureEventQueue(int lowWatermark,
     return *this;
 }
 
+inline SessionOptions& SessionOptions::setEventQueueLockFree(bool value)
+{
+    d_eventQueueLockFree = value;
+    return *this;
+}
+
+inline SessionOptions& SessionOptions::setEventQueueSpinCount(int value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(0 <= value);
+
+    d_eventQueueSpinCount = value;
+    return *this;
+}
+
+inline SessionOptions& SessionOptions::setIoThreadCpu(int value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(-1 <= value);
+
+    d_ioThreadCpu = value;
+    return *this;
+}
+
+inline SessionOptions& SessionOptions::setPutBatchMaxBytes(int value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(0 <= value);
+
+    d_putBatchMaxBytes = value;
+    return *this;
+}
+
+inline SessionOptions&
+SessionOptions::setPutBatchLinger(const bsls::TimeInterval& value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(value >= bsls::TimeInterval(0));
+
+    d_putBatchLinger = value;
+    return *this;
+}
+
+inline SessionOptions& SessionOptions::setFlowControlAdaptationInterval(
+    const bsls::TimeInterval& value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(value >= bsls::TimeInterval(0));
+
+    d_flowControlAdaptationInterval = value;
+    return *this;
+}
+
 // ACCESSORS
 inline const bsl::string& SessionOptions::brokerUri() const
 {
@@ -522,6 +768,16 @@ inline int SessionOptions::numProcessingThreads() const
     return d_numProcessingThreads;
 }
 
+inline int SessionOptions::numCompressionThreads() const
+{
+    return d_numCompressionThreads;
+}
+
+inline int SessionOptions::zstdCompressionLevel() const
+{
+    return d_zstdCompressionLevel;
+}
+
 inline int SessionOptions::blobBufferSize() const
 {
     return d_blobBufferSize;
@@ -594,6 +850,37 @@ inline int SessionOptions::eventQueueSize() const
     return d_eventQueueSize;
 }
 
+inline bool SessionOptions::eventQueueLockFree() const
+{
+    return d_eventQueueLockFree;
+}
+
+inline int SessionOptions::eventQueueSpinCount() const
+{
+    return d_eventQueueSpinCount;
+}
+
+inline int SessionOptions::ioThreadCpu() const
+{
+    return d_ioThreadCpu;
+}
+
+inline int SessionOptions::putBatchMaxBytes() const
+{
+    return d_putBatchMaxBytes;
+}
+
+inline const bsls::TimeInterval& SessionOptions::putBatchLinger() const
+{
+    return d_putBatchLinger;
+}
+
+inline const bsls::TimeInterval&
+SessionOptions::flowControlAdaptationInterval() const
+{
+    return d_flowControlAdaptationInterval;
+}
+
 }  // close package namespace
 
 // --------------------
@@ -605,6 +892,8 @@ inline bool bmqt::operator==(const bmqt::SessionOptions& lhs,
 {
     return lhs.brokerUri() == rhs.brokerUri() &&
            lhs.numProcessingThreads() == rhs.numProcessingThreads() &&
+           lhs.numCompressionThreads() == rhs.numCompressionThreads() &&
+           lhs.zstdCompressionLevel() == rhs.zstdCompressionLevel() &&
            lhs.blobBufferSize() == rhs.blobBufferSize() &&
            lhs.channelHighWatermark() == rhs.channelHighWatermark() &&
            lhs.statsDumpInterval() == rhs.statsDumpInterval() &&
@@ -614,6 +903,13 @@ inline bool bmqt::operator==(const bmqt::SessionOptions& lhs,
            lhs.closeQueueTimeout() == rhs.closeQueueTimeout() &&
            lhs.eventQueueLowWatermark() == rhs.eventQueueLowWatermark() &&
            lhs.eventQueueHighWatermark() == rhs.eventQueueHighWatermark() &&
+           lhs.eventQueueLockFree() == rhs.eventQueueLockFree() &&
+           lhs.eventQueueSpinCount() == rhs.eventQueueSpinCount() &&
+           lhs.ioThreadCpu() == rhs.ioThreadCpu() &&
+           lhs.putBatchMaxBytes() == rhs.putBatchMaxBytes() &&
+           lhs.putBatchLinger() == rhs.putBatchLinger() &&
+           lhs.flowControlAdaptationInterval() ==
+               rhs.flowControlAdaptationInterval() &&
            lhs.hostHealthMonitor() == rhs.hostHealthMonitor() &&
            lhs.traceContext() == rhs.traceContext() &&
            lhs.tracer() == rhs.tracer();
@@ -624,6 +920,8 @@ inline bool bmqt::operator!=(const bmqt::SessionOptions& lhs,
 {
     return lhs.brokerUri() != rhs.brokerUri() ||
            lhs.numProcessingThreads() != rhs.numProcessingThreads() ||
+           lhs.numCompressionThreads() != rhs.numCompressionThreads() ||
+           lhs.zstdCompressionLevel() != rhs.zstdCompressionLevel() ||
            lhs.blobBufferSize() != rhs.blobBufferSize() ||
            lhs.channelHighWatermark() != rhs.channelHighWatermark() ||
            lhs.statsDumpInterval() != rhs.statsDumpInterval() ||
@@ -633,6 +931,13 @@ inline bool bmqt::operator!=(const bmqt::SessionOptions& lhs,
            lhs.closeQueueTimeout() != rhs.closeQueueTimeout() ||
            lhs.eventQueueLowWatermark() != rhs.eventQueueLowWatermark() ||
            lhs.eventQueueHighWatermark() != rhs.eventQueueHighWatermark() ||
+           lhs.eventQueueLockFree() != rhs.eventQueueLockFree() ||
+           lhs.eventQueueSpinCount() != rhs.eventQueueSpinCount() ||
+           lhs.ioThreadCpu() != rhs.ioThreadCpu() ||
+           lhs.putBatchMaxBytes() != rhs.putBatchMaxBytes() ||
+           lhs.putBatchLinger() != rhs.putBatchLinger() ||
+           lhs.flowControlAdaptationInterval() !=
+               rhs.flowControlAdaptationInterval() ||
            lhs.hostHealthMonitor() != rhs.hostHealthMonitor() ||
            lhs.traceContext() != rhs.traceContext() ||
            lhs.tracer() != rhs.tracer();
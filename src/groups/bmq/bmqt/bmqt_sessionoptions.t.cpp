@@ -55,12 +55,17 @@ static void test2_printTest()
 {
     const char* const sampleSessionOptionsLayout =
         "[ brokerUri = \"tcp://localhost:30114\" processNameOverride = \"\" "
-        "numProcessingThreads = 1 "
+        "numProcessingThreads = 1 numCompressionThreads = 0 "
+        "zstdCompressionLevel = 3 "
         "blobBufferSize = 4096 channelHighWatermark = 134217728 "
         "statsDumpInterval = 300 connectTimeout = 60 disconnectTimeout = 30 "
         "openQueueTimeout = 300 configureQueueTimeout = 300 "
         "closeQueueTimeout = 300 eventQueueLowWatermark = 50 "
-        "eventQueueHighWatermark = 2000 hasHostHealthMonitor = false "
+        "eventQueueHighWatermark = 2000 eventQueueLockFree = false "
+        "eventQueueSpinCount = 0 ioThreadCpu = -1 "
+        "putBatchMaxBytes = 0 putBatchLinger = 0 "
+        "flowControlAdaptationInterval = 0 "
+        "hasHostHealthMonitor = false "
         "hasDistributedTracing = false ]";
     mwctst::TestHelper::printTestName("PRINT");
     PV("Testing print");
@@ -96,6 +101,18 @@ static void test3_setterGetterAndCopyTest()
     obj.setNumProcessingThreads(numProcessingThreads);
     ASSERT_EQ(obj.numProcessingThreads(), numProcessingThreads);
 
+    PVV("Checking setter and getter for numCompressionThreads");
+    const int numCompressionThreads = 3;
+    ASSERT_NE(obj.numCompressionThreads(), numCompressionThreads);
+    obj.setNumCompressionThreads(numCompressionThreads);
+    ASSERT_EQ(obj.numCompressionThreads(), numCompressionThreads);
+
+    PVV("Checking setter and getter for zstdCompressionLevel");
+    const int zstdCompressionLevel = 9;
+    ASSERT_NE(obj.zstdCompressionLevel(), zstdCompressionLevel);
+    obj.setZstdCompressionLevel(zstdCompressionLevel);
+    ASSERT_EQ(obj.zstdCompressionLevel(), zstdCompressionLevel);
+
     PVV("Checking setter and getter for blobBufferSize");
     const int blobBufferSize = 8 * 1024;
     ASSERT_NE(obj.blobBufferSize(), blobBufferSize);
@@ -150,10 +167,49 @@ static void test3_setterGetterAndCopyTest()
     ASSERT_EQ(obj.eventQueueLowWatermark(), eventQueueLowWatermark);
     ASSERT_EQ(obj.eventQueueHighWatermark(), eventQueueHighWatermark);
 
+    PVV("Checking setter and getter for eventQueueLockFree");
+    ASSERT_EQ(obj.eventQueueLockFree(), false);
+    obj.setEventQueueLockFree(true);
+    ASSERT_EQ(obj.eventQueueLockFree(), true);
+
+    PVV("Checking setter and getter for eventQueueSpinCount");
+    const int eventQueueSpinCount = 1000;
+    ASSERT_NE(obj.eventQueueSpinCount(), eventQueueSpinCount);
+    obj.setEventQueueSpinCount(eventQueueSpinCount);
+    ASSERT_EQ(obj.eventQueueSpinCount(), eventQueueSpinCount);
+
+    PVV("Checking setter and getter for ioThreadCpu");
+    const int ioThreadCpu = 3;
+    ASSERT_NE(obj.ioThreadCpu(), ioThreadCpu);
+    obj.setIoThreadCpu(ioThreadCpu);
+    ASSERT_EQ(obj.ioThreadCpu(), ioThreadCpu);
+
+    PVV("Checking setter and getter for putBatchMaxBytes");
+    const int putBatchMaxBytes = 64 * 1024;
+    ASSERT_NE(obj.putBatchMaxBytes(), putBatchMaxBytes);
+    obj.setPutBatchMaxBytes(putBatchMaxBytes);
+    ASSERT_EQ(obj.putBatchMaxBytes(), putBatchMaxBytes);
+
+    PVV("Checking setter and getter for putBatchLinger");
+    const bsls::TimeInterval putBatchLinger(0, 500 * 1000);
+    ASSERT_NE(obj.putBatchLinger(), putBatchLinger);
+    obj.setPutBatchLinger(putBatchLinger);
+    ASSERT_EQ(obj.putBatchLinger(), putBatchLinger);
+
+    PVV("Checking setter and getter for flowControlAdaptationInterval");
+    const bsls::TimeInterval flowControlAdaptationInterval(2);
+    ASSERT_NE(obj.flowControlAdaptationInterval(),
+              flowControlAdaptationInterval);
+    obj.setFlowControlAdaptationInterval(flowControlAdaptationInterval);
+    ASSERT_EQ(obj.flowControlAdaptationInterval(),
+              flowControlAdaptationInterval);
+
     PVV("Copy constructor test");
     bmqt::SessionOptions objCopy(obj);
     ASSERT_EQ(objCopy.brokerUri(), brokerUri);
     ASSERT_EQ(objCopy.numProcessingThreads(), numProcessingThreads);
+    ASSERT_EQ(objCopy.numCompressionThreads(), numCompressionThreads);
+    ASSERT_EQ(objCopy.zstdCompressionLevel(), zstdCompressionLevel);
     ASSERT_EQ(objCopy.blobBufferSize(), blobBufferSize);
     ASSERT_EQ(objCopy.channelHighWatermark(), channelHighWatermark);
     ASSERT_EQ(objCopy.statsDumpInterval(), statsDumpInterval);
@@ -163,6 +219,13 @@ static void test3_setterGetterAndCopyTest()
     ASSERT_EQ(objCopy.closeQueueTimeout(), closeQueueTimeout);
     ASSERT_EQ(objCopy.eventQueueLowWatermark(), eventQueueLowWatermark);
     ASSERT_EQ(objCopy.eventQueueHighWatermark(), eventQueueHighWatermark);
+    ASSERT_EQ(objCopy.eventQueueLockFree(), true);
+    ASSERT_EQ(objCopy.eventQueueSpinCount(), eventQueueSpinCount);
+    ASSERT_EQ(objCopy.ioThreadCpu(), ioThreadCpu);
+    ASSERT_EQ(objCopy.putBatchMaxBytes(), putBatchMaxBytes);
+    ASSERT_EQ(objCopy.putBatchLinger(), putBatchLinger);
+    ASSERT_EQ(objCopy.flowControlAdaptationInterval(),
+              flowControlAdaptationInterval);
 }
 // ============================================================================
 //                                 MAIN PROGRAM
@@ -44,16 +44,23 @@ namespace {
 const char k_SCHEME[]        = "bmq";
 const char k_TIER_PREFIX[]   = ".~";
 const char k_QUERY_ID[]      = "id";
-const int  k_QUERY_ID_LENGTH = sizeof(k_QUERY_ID) - 1;
 
+const char k_SCHEME_PREFIX[]        = "bmq://";
+const int  k_SCHEME_PREFIX_LENGTH   = sizeof(k_SCHEME_PREFIX) - 1;
+const char k_QUERY_ID_PREFIX[]      = "?id=";
+const int  k_QUERY_ID_PREFIX_LENGTH = sizeof(k_QUERY_ID_PREFIX) - 1;
+
+#ifdef BSLS_ASSERT_SAFE_IS_ACTIVE
 bsls::ObjectBuffer<bdlpcre::RegEx> s_regex;
-// Regular expression to validate and
-// extract components of the URI.  Use an
-// object buffer so we can allocate in the
-// 'initialize' method, and destroy in the
-// 'shutdown' instead of relying on
-// 'random' ordering for creation of static
-// objects by the compiler.
+// Regular expression validating the
+// result of the hand-written parser in
+// safe builds.  Use an object buffer so
+// we can allocate in the 'initialize'
+// method, and destroy in the 'shutdown'
+// instead of relying on 'random' ordering
+// for creation of static objects by the
+// compiler.
+#endif
 
 int s_initialized = 0;
 // Integer to keep track of the number of
@@ -72,6 +79,36 @@ bslmt::QLock s_initLock = BSLMT_QLOCK_INITIALIZER;
 // Lock used to provide thread-safe
 // protection for accessing the
 // 's_initialized' counter.
+
+/// Return `true` if the specified `c` is an ASCII letter or digit, or the
+/// `-` character, i.e. may appear in the tier of a URI.
+inline bool isTierChar(char c)
+{
+    return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') ||
+           ('0' <= c && c <= '9') || c == '-';
+}
+
+/// Return `true` if the specified `c` may appear in the domain, the queue
+/// name or the id of a URI.
+inline bool isNameChar(char c)
+{
+    return isTierChar(c) || c == '_' || c == '.';
+}
+
+#ifdef BSLS_ASSERT_SAFE_IS_ACTIVE
+/// Return `true` if the specified `uri` is entirely matched by the regular
+/// expression of the URIs, and `false` otherwise.
+bool matchesRegex(const bsl::string& uri)
+{
+    bdlma::LocalSequentialAllocator<2048> localAllocator(
+        bslma::Default::allocator());
+    bsl::vector<bsl::pair<size_t, size_t> > matches(&localAllocator);
+
+    // Note that '$' also matches before a trailing newline.
+    return s_regex.object().match(&matches, uri.data(), uri.length()) == 0 &&
+           matches[0].second == uri.length();
+}
+#endif
 }  // close unnamed namespace
 
 // ---------
@@ -197,6 +234,9 @@ void UriParser::initialize(bslma::Allocator* allocator)
         return;  // RETURN
     }
 
+#ifdef BSLS_ASSERT_SAFE_IS_ACTIVE
+    // The regular expression is only used to validate the hand-written
+    // parser in safe builds, and must match exactly the same URIs.
     const char k_PATTERN[] = "^bmq:\\/\\/"
                              "(?P<authority>"
                              "(?P<domain>[-a-zA-Z0-9\\._]*)"
@@ -236,6 +276,9 @@ void UriParser::initialize(bslma::Allocator* allocator)
                        << error << "', offset: " << errorOffset << "]";
     }
     BSLS_ASSERT_OPT(rc == 0 && "Failed to compile URI regular expression");
+#else
+    (void)allocator;
+#endif
 }
 
 void UriParser::shutdown()
@@ -247,7 +290,9 @@ void UriParser::shutdown()
         return;  // RETURN
     }
 
+#ifdef BSLS_ASSERT_SAFE_IS_ACTIVE
     s_regex.object().~RegEx();
+#endif
 }
 
 int UriParser::parse(Uri*                     result,
@@ -264,89 +309,102 @@ int UriParser::parse(Uri*                     result,
         rc_MISSING_TIER   = -5
     };
 
-    enum {
-        // Enum representing the index of the matching parts of the URI regexp
-        k_AUTHORITY_IDX = 1,
-        k_DOMAIN_IDX,
-        k_TIER_IDX,
-        k_PATH_IDX,
-        k_Q1_IDX
-    };
-
-    BSLS_ASSERT_SAFE(s_regex.object().isPrepared() &&
-                     "'initialize' was not called");
-
-    bdlma::LocalSequentialAllocator<2048> localAllocator(
-        bslma::Default::allocator());
+    BSLS_ASSERT_SAFE(s_initialized > 0 && "'initialize' was not called");
 
     result->reset();
     result->d_uri.assign(uriString.data(), uriString.length());
 
-    // RegExp matching
-    // ---------------
-    bsl::vector<bsl::pair<size_t, size_t> > matches(&localAllocator);
+    // Single pass matching of:
+    //   bmq://<domain>[.~<tier>]/<path>[?id=<id>]
+    // where <domain>, <path> and <id> are made of '[-a-zA-Z0-9_.]', and
+    // <tier> of '[-a-zA-Z0-9]'.  Note that <domain> and <path> may be empty
+    // at this point so that a more detailed error can be reported below.
+    const char* const begin = result->d_uri.data();
+    const char* const end   = begin + result->d_uri.length();
+    const char*       p     = begin;
+
+    bool isValidFormat = end - begin >= k_SCHEME_PREFIX_LENGTH &&
+                         0 == bsl::strncmp(p,
+                                           k_SCHEME_PREFIX,
+                                           k_SCHEME_PREFIX_LENGTH);
+
+    const char* authority = 0;
+    const char* domainEnd = 0;
+    const char* tier      = 0;
+    const char* tierEnd   = 0;
+    const char* path      = 0;
+    const char* pathEnd   = 0;
+    const char* id        = 0;
+
+    if (isValidFormat) {
+        // Domain
+        authority = p + k_SCHEME_PREFIX_LENGTH;
+        p         = authority;
+        while (p != end && isNameChar(*p)) {
+            ++p;
+        }
+        domainEnd = p;
+
+        // Tier: the '.' of the '.~' prefix was consumed with the domain
+        if (p != end && *p == '~' && p != authority && *(p - 1) == '.') {
+            domainEnd = p - 1;
+            tier      = ++p;
+            while (p != end && isTierChar(*p)) {
+                ++p;
+            }
+            tierEnd = p;
+        }
 
-    int rc = s_regex.object().match(&matches,
-                                    result->d_uri.data(),
-                                    result->d_uri.length());
-    if (rc != 0) {
+        isValidFormat = p != end && *p == '/';
+    }
+
+    if (isValidFormat) {
+        // Authority
+        result->d_authority.assign(authority, p - authority);
+
+        // Path
+        path = ++p;
+        while (p != end && isNameChar(*p)) {
+            ++p;
+        }
+        pathEnd = p;
+
+        // Query
+        if (p != end) {
+            isValidFormat = end - p > k_QUERY_ID_PREFIX_LENGTH &&
+                            0 == bsl::strncmp(p,
+                                              k_QUERY_ID_PREFIX,
+                                              k_QUERY_ID_PREFIX_LENGTH);
+            if (isValidFormat) {
+                id = p + k_QUERY_ID_PREFIX_LENGTH;
+                for (p = id; p != end && isNameChar(*p); ++p) {
+                    // NOTHING
+                }
+                isValidFormat = p == end;
+            }
+        }
+    }
+
+#ifdef BSLS_ASSERT_SAFE_IS_ACTIVE
+    BSLS_ASSERT_SAFE(isValidFormat == matchesRegex(result->d_uri));
+#endif
+
+    if (!isValidFormat) {
         if (errorDescription) {
-            mwcu::MemOutStream os(&localAllocator);
-            os << "invalid format (" << rc << ")";
-            errorDescription->assign(os.str().data(), os.str().length());
+            *errorDescription = "invalid format";
         }
         result->reset();
         return rc_INVALID_FORMAT;  // RETURN
     }
 
     result->d_scheme.assign(k_SCHEME);
-
-    // Populate from captured groups
-    // -----------------------------
-    typedef bsl::pair<size_t, size_t> RegExpCapture;
-
-    // Authority
-    const RegExpCapture& capturedAuthority = matches[k_AUTHORITY_IDX];
-    result->d_authority.assign(result->d_uri.data() + capturedAuthority.first,
-                               capturedAuthority.second);
-
-    // Domain
-    const RegExpCapture& capturedDomain = matches[k_DOMAIN_IDX];
-    result->d_domain.assign(result->d_uri.data() + capturedDomain.first,
-                            capturedDomain.second);
-
-    // Tier
-    const RegExpCapture& capturedTier = matches[k_TIER_IDX];
-    if (capturedTier.second != 0) {
-        // Dropping the .~ prefix from the tier
-        result->d_tier.assign(result->d_uri.data() + capturedTier.first + 2,
-                              capturedTier.second - 2);
+    result->d_domain.assign(authority, domainEnd - authority);
+    if (tier) {
+        result->d_tier.assign(tier, tierEnd - tier);
     }
-
-    // Path
-    const RegExpCapture& capturedPath = matches[k_PATH_IDX];
-    result->d_path.assign(result->d_uri.data() + capturedPath.first,
-                          capturedPath.second);
-
-    // Query
-    const RegExpCapture& query1 = matches[k_Q1_IDX];
-    if (query1.second > 0) {
-        // Query1 is present
-        bslstl::StringRef q1(result->d_uri.data() + query1.first + 1,
-                             query1.second - 1);  // + -1 to skip '?'
-
-        if (0 == bsl::strncmp(q1.data(), k_QUERY_ID, k_QUERY_ID_LENGTH)) {
-            result->d_query_id.assign(q1.data() + k_QUERY_ID_LENGTH + 1,
-                                      q1.length() - k_QUERY_ID_LENGTH - 1);
-            // +1 -1 to skip '='
-        }
-        else {
-            if (errorDescription) {
-                *errorDescription = "bad query";
-            }
-            result->reset();
-            return rc_BAD_QUERY;  // RETURN
-        }
+    result->d_path.assign(path, pathEnd - path);
+    if (id) {
+        result->d_query_id.assign(id, end - id);
     }
 
     // Validate mandatory fields
@@ -359,7 +417,7 @@ int UriParser::parse(Uri*                     result,
         return rc_MISSING_DOMAIN;  // RETURN
     }
 
-    if (capturedTier.second > 0 && result->d_tier.isEmpty()) {
+    if (tier && result->d_tier.isEmpty()) {
         if (errorDescription) {
             *errorDescription = "missing tier";
         }
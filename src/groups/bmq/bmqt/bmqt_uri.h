@@ -305,15 +305,15 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Uri& rhs);
 struct UriParser {
     // CLASS METHODS
 
-    /// Initialize the `UriParser`.  Note that this will compile the regular
-    /// expression used by `parseUri`.  This method only needs to be called
-    /// once before any other method, but can be called multiple times
-    /// provided that for each call to `initialize` there is a corresponding
-    /// call to `shutdown`.  Use the optionally specified `allocator` for
-    /// any memory allocation, or the `global` allocator if none is
-    /// provided.  Note that specifying the allocator is provided for test
-    /// drivers only, and therefore users should let it default to the
-    /// global allocator.
+    /// Initialize the `UriParser`.  Note that, in safe builds only, this
+    /// will compile the regular expression used to validate the results of
+    /// `parse`.  This method only needs to be called once before any other
+    /// method, but can be called multiple times provided that for each
+    /// call to `initialize` there is a corresponding call to `shutdown`.
+    /// Use the optionally specified `allocator` for any memory allocation,
+    /// or the `global` allocator if none is provided.  Note that specifying
+    /// the allocator is provided for test drivers only, and therefore users
+    /// should let it default to the global allocator.
     static void initialize(bslma::Allocator* allocator = 0);
 
     /// Pendant operation of the `initialize` one.  Note that behaviour
@@ -331,7 +331,9 @@ struct UriParser {
     /// `errorDescription` with a description of the syntax error present in
     /// `uriString`.  Return 0 on success and non-zero if `uriString` does
     /// not have a valid syntax.  Note that `errorDescription` may be null
-    /// if the caller does not care about getting error messages.  The
+    /// if the caller does not care about getting error messages.  Note
+    /// that `uriString` is parsed in a single pass, without allocating
+    /// memory other than for the copy of `uriString` held by `result`.  The
     /// behavior is undefined unless `initialize` has been called
     /// previously.
     static int parse(Uri*                     result,
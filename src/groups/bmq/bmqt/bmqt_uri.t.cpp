@@ -19,10 +19,12 @@
 // MWC
 #include <mwctst_scopedlogobserver.h>
 #include <mwcu_memoutstream.h>
+#include <mwcu_printutil.h>
 
 // BDE
 #include <ball_log.h>
 #include <bdlf_bind.h>
+#include <bdlpcre_regex.h>
 #include <bsl_string.h>
 #include <bsl_utility.h>
 #include <bsl_vector.h>
@@ -30,6 +32,8 @@
 #include <bslh_hash.h>
 #include <bslmt_barrier.h>
 #include <bslmt_threadgroup.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
 
 // TEST DRIVER
 #include <mwctst_testhelper.h>
@@ -291,6 +295,9 @@ static void test1_breathingTest()
             {L_, "bmq://ts.trades.myapp.~/queue", -5},
             {L_, "bmq://ts.trades~myapp/queue", -1},
             {L_, "bmq://ts.trades.myapp.~a_b/queue", -1},
+            {L_, "bmq://ts.trades.myapp.~a.~b/queue", -1},
+            {L_, "bmq://ts.trades.myapp/queue\n", -1},
+            {L_, "bmq://ts.trades.myapp/queue?id=foo\n", -1},
         };
 
         const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
@@ -657,6 +664,93 @@ static void test7_testLongUri()
     bmqt::UriParser::shutdown();
 }
 
+// ============================================================================
+//                              PERFORMANCE TESTS
+// ----------------------------------------------------------------------------
+
+static void testN1_performance()
+// ------------------------------------------------------------------------
+// PERFORMANCE
+//
+// Concerns:
+//   Compare the performance of the hand-written 'UriParser' with the
+//   regular expression it replaced.
+//
+// Plan:
+//   1. Parse a set of URIs a number of times with 'UriParser::parse'.
+//   2. Match and capture the same URIs, the same number of times, with the
+//      JIT compiled regular expression previously used by 'UriParser'.
+//
+// Testing:
+//   Performance of 'UriParser::parse'.
+// ------------------------------------------------------------------------
+{
+    s_ignoreCheckDefAlloc = true;
+    // The regular expression uses the default allocator.
+
+    mwctst::TestHelper::printTestName("PERFORMANCE");
+
+    bmqt::UriParser::initialize(s_allocator_p);
+
+    const char* k_URIS[] = {"bmq://my.domain/queue-foo-bar",
+                            "bmq://ts.trades.myapp.~lcl-fooBar/my.queue",
+                            "bmq://ts.trades.myapp/my.queue?id=my.app",
+                            "bmq://ts.trades.myapp/queue?pid=foo"};
+
+    const int k_NUM_URIS       = sizeof(k_URIS) / sizeof(*k_URIS);
+    const int k_NUM_ITERATIONS = 1000000;
+
+    bsls::Types::Int64 timeParser = 0;
+    {
+        bmqt::Uri uri(s_allocator_p);
+
+        bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+        for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+            bmqt::UriParser::parse(&uri, 0, k_URIS[i % k_NUM_URIS]);
+        }
+        timeParser = bsls::TimeUtil::getTimer() - start;
+    }
+
+    bsls::Types::Int64 timeRegex = 0;
+    {
+        const char k_PATTERN[] = "^bmq:\\/\\/"
+                                 "(?P<authority>"
+                                 "(?P<domain>[-a-zA-Z0-9\\._]*)"
+                                 "(?P<tier>\\.~[-a-zA-Z0-9]*)?"
+                                 ")/"
+                                 "(?P<path>[-a-zA-Z0-9_\\.]*)"
+                                 "(?P<q1>\\?(id=)[-a-zA-Z0-9_\\.]+)?$";
+
+        bdlpcre::RegEx regex(s_allocator_p);
+        bsl::string    error(s_allocator_p);
+        size_t         errorOffset;
+        int            rc = regex.prepare(&error,
+                                          &errorOffset,
+                                          k_PATTERN,
+                                          bdlpcre::RegEx::k_FLAG_JIT);
+        ASSERT_EQ(rc, 0);
+
+        bsl::string                             uri(s_allocator_p);
+        bsl::vector<bsl::pair<size_t, size_t> > matches(s_allocator_p);
+
+        bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+        for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+            uri.assign(k_URIS[i % k_NUM_URIS]);
+            regex.match(&matches, uri.data(), uri.length());
+        }
+        timeRegex = bsls::TimeUtil::getTimer() - start;
+    }
+
+    cout << "UriParser::parse: "
+         << mwcu::PrintUtil::prettyTimeInterval(timeParser) << " ("
+         << timeParser / k_NUM_ITERATIONS << " ns per URI)\n"
+         << "RegEx::match    : "
+         << mwcu::PrintUtil::prettyTimeInterval(timeRegex) << " ("
+         << timeRegex / k_NUM_ITERATIONS << " ns per URI)\n";
+
+    bmqt::UriParser::shutdown();
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -674,6 +768,7 @@ int main(int argc, char* argv[])
     case 3: test3_URIBuilderMultiThreaded(); break;
     case 2: test2_URIBuilder(); break;
     case 1: test1_breathingTest(); break;
+    case -1: testN1_performance(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
@@ -457,8 +457,8 @@ void AdminSession::onDispatcherEvent(const mqbi::DispatcherEvent& event)
         const mqbi::DispatcherCallbackEvent* realEvent =
             event.asCallbackEvent();
 
-        BSLS_ASSERT_SAFE(realEvent->callback());
-        realEvent->callback()(dispatcherClientData().processorHandle());
+        BSLS_ASSERT_SAFE(realEvent->hasCallback());
+        realEvent->invokeCallback(dispatcherClientData().processorHandle());
     } break;
 
     case mqbi::DispatcherEventType::e_ACK:
@@ -33,6 +33,7 @@
 #include <mqbnet_cluster.h>
 #include <mqbnet_transportmanager.h>
 #include <mqbplug_pluginmanager.h>
+#include <mqbs_storageengine.h>
 #include <mqbstat_statcontroller.h>
 #include <mqbu_exit.h>
 #include <mqbu_messageguidutil.h>
@@ -44,6 +45,7 @@
 // MWC
 #include <mwcscm_version.h>
 #include <mwcst_statcontext.h>
+#include <mwcsys_profilerutil.h>
 #include <mwcsys_time.h>
 #include <mwcu_memoutstream.h>
 
@@ -61,6 +63,7 @@
 #include <bsl_ctime.h>
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
+#include <bsl_unordered_set.h>
 #include <bslma_allocator.h>
 #include <bslmt_latch.h>
 #include <bslmt_lockguard.h>
@@ -76,6 +79,11 @@ namespace {
 const int k_BLOBBUFFER_SIZE           = 4 * 1024;
 const int k_BLOB_POOL_GROWTH_STRATEGY = 1024;
 
+/// Maximum duration of a profile taken by the PROFILE command.  The admin
+/// commands are executed one at a time, so that a profile delays the
+/// processing of the next commands.
+const int k_MAX_PROFILE_DURATION_SEC = 60;
+
 /// Create a new blob at the specified `arena` address, using the specified
 /// `bufferFactory` and `allocator`.
 void createBlob(bdlbb::BlobBufferFactory* bufferFactory,
@@ -96,8 +104,12 @@ void Application::oneTimeInit()
 {
     BSLMT_ONCE_DO
     {
-        // Initialize Time with platform-specific clocks/timers
-        mwcsys::Time::initialize();
+        // Initialize Time with platform-specific clocks/timers, using the
+        // timestamp counter as high resolution timer if so configured (and
+        // usable on this host).
+        mwcsys::Time::initialize(mqbcfg::BrokerConfig::get().useTscTimer()
+                                     ? mwcsys::Time::e_TSC_TIMER
+                                     : mwcsys::Time::e_SYSTEM_TIMER);
 
         // Initialize pseudo-random number generator.  We add some
         // machine-specific (high resolution timer) and task-specific (pid)
@@ -150,6 +162,7 @@ Application::Application(bdlmt::EventScheduler* scheduler,
                d_allocators.get("BlobSpPool"))
 , d_allocatorsStatContext_p(allocatorsStatContext)
 , d_pluginManager_mp()
+, d_storageEngines(allocator)
 , d_statController_mp()
 , d_configProvider_mp()
 , d_dispatcher_mp()
@@ -203,6 +216,8 @@ Application::Application(bdlmt::EventScheduler* scheduler,
         << "\n    OS version............: " << osVersion
         << "\n    OS patch..............: " << osPatch
         << "\n    OS page size (bytes)..: " << bdls::MemoryUtil::pageSize()
+        << "\n    High res. timer.......: "
+        << (mwcsys::Time::isTscHighResolutionTimer() ? "TSC" : "system")
         << "\n    BrokerId..............: "
         << mqbu::MessageGUIDUtil::brokerIdHex() << "\n";
 
@@ -241,7 +256,8 @@ int Application::start(bsl::ostream& errorDescription)
         rc_TRANSPORTMANAGER_LISTEN            = -9,
         rc_CLUSTER_REVERSECONNECTIONS_FAILURE = -10,
         rc_ADMIN_POOL_START_FAILURE           = -11,
-        rc_PLUGINMANAGER                      = -12
+        rc_PLUGINMANAGER                      = -12,
+        rc_STORAGEENGINE                      = -13
     };
 
     int rc = rc_SUCCESS;
@@ -258,6 +274,44 @@ int Application::start(bsl::ostream& errorDescription)
         }
     }
 
+    // Start and register the StorageEngines, before the clusters referring
+    // to them by name are created
+    {
+        bsl::unordered_set<mqbplug::PluginFactory*> pluginFactories(
+            d_allocator_p);
+        d_pluginManager_mp->get(mqbplug::PluginType::e_STORAGE_ENGINE,
+                                &pluginFactories);
+
+        bsl::unordered_set<mqbplug::PluginFactory*>::const_iterator it =
+            pluginFactories.cbegin();
+        for (; it != pluginFactories.cend(); ++it) {
+            mqbs::StorageEnginePluginFactory* factory =
+                dynamic_cast<mqbs::StorageEnginePluginFactory*>(*it);
+            StorageEngineSp engine(factory->create(d_allocator_p));
+
+            rc = engine->start(errorDescription);
+            if (rc != 0) {
+                errorDescription << " [StorageEngine: '" << engine->name()
+                                 << "']";
+                return (rc * 100) + rc_STORAGEENGINE;  // RETURN
+            }
+
+            d_storageEngines.push_back(engine);
+            rc = mqbs::StorageEngineRegistry::registerEngine(engine.get());
+            if (rc != 0) {
+                errorDescription << "Failed to register StorageEngine '"
+                                 << engine->name() << "', a StorageEngine "
+                                 << "having the same name is already "
+                                 << "registered, or too many StorageEngines "
+                                 << "are registered";
+                return (rc * 100) + rc_STORAGEENGINE;  // RETURN
+            }
+
+            BALL_LOG_INFO << "Started StorageEngine '" << engine->name()
+                          << "'";
+        }
+    }
+
     // Start the StatController
     d_statController_mp.load(
         new (*d_allocator_p) mqbstat::StatController(
@@ -290,6 +344,7 @@ int Application::start(bsl::ostream& errorDescription)
     d_dispatcher_mp.load(new (*d_allocator_p) Dispatcher(
                              mqbcfg::BrokerConfig::get().dispatcherConfig(),
                              d_scheduler_p,
+                             d_statController_mp->dispatcherStatContext(),
                              d_allocators.get("Dispatcher")),
                          d_allocator_p);
     rc = d_dispatcher_mp->start(errorDescription);
@@ -479,7 +534,6 @@ void Application::stop()
     STOP_OBJ(d_dispatcher_mp, "Dispatcher");
     STOP_OBJ(d_configProvider_mp, "ConfigProvider");
     STOP_OBJ(d_statController_mp, "StatController");
-    STOP_OBJ(d_pluginManager_mp, "PluginManager");
 
     // and now DESTROY everything
     DESTROY_OBJ(d_domainManager_mp, "DomainManager");
@@ -488,6 +542,20 @@ void Application::stop()
     DESTROY_OBJ(d_dispatcher_mp, "Dispatcher");
     DESTROY_OBJ(d_configProvider_mp, "ConfigProvider");
     DESTROY_OBJ(d_statController_mp, "StatController");
+
+    // The storages created by the StorageEngines were destroyed along with
+    // the clusters; the StorageEngines must be destroyed before the
+    // PluginManager unloads the libraries providing them.
+    for (size_t i = 0; i < d_storageEngines.size(); ++i) {
+        BALL_LOG_INFO << "Stopping StorageEngine '"
+                      << d_storageEngines[i]->name() << "'...";
+        mqbs::StorageEngineRegistry::unregisterEngine(
+            d_storageEngines[i].get());
+        d_storageEngines[i]->stop();
+    }
+    d_storageEngines.clear();
+
+    STOP_OBJ(d_pluginManager_mp, "PluginManager");
     DESTROY_OBJ(d_pluginManager_mp, "PluginManager");
 
     BALL_LOG_INFO << "BMQbrkr stopped";
@@ -603,6 +671,28 @@ int Application::processCommand(const bslstl::StringRef& source,
             }
         }
     }
+    else if (command.isProfileValue()) {
+        mwcu::MemOutStream errorOs;
+        if (command.profile() > k_MAX_PROFILE_DURATION_SEC) {
+            errorOs << "Profile duration must not exceed "
+                    << k_MAX_PROFILE_DURATION_SEC << " seconds";
+            cmdResult.makeError().message() = errorOs.str();
+        }
+        else {
+            mwcu::MemOutStream profileOs;
+            rc = mwcsys::ProfilerUtil::profile(
+                profileOs,
+                errorOs,
+                bsls::TimeInterval(command.profile(), 0));
+            if (rc != 0) {
+                cmdResult.makeError().message() = "Failed to profile: " +
+                                                  errorOs.str();
+            }
+            else {
+                cmdResult.makeProfile(profileOs.str());
+            }
+        }
+    }
     else {
         mwcu::MemOutStream errorOs;
         errorOs << "Unknown command '" << command << "'";
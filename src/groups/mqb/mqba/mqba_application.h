@@ -32,14 +32,15 @@
 
 // MWC
 #include <mwcma_countingallocatorstore.h>
+#include <mwcma_threadcachedblobbufferfactory.h>
 
 // BDE
 #include <ball_log.h>
 #include <bdlbb_blob.h>
-#include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlcc_objectpool.h>
 #include <bdlcc_sharedobjectpool.h>
 #include <bdlmt_threadpool.h>
+#include <bsl_memory.h>
 #include <bsl_ostream.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
@@ -65,6 +66,9 @@ class TransportManager;
 namespace mqbplug {
 class PluginManager;
 }
+namespace mqbs {
+class StorageEngine;
+}
 namespace mqbstat {
 class StatController;
 }
@@ -102,6 +106,7 @@ class Application {
     typedef bslma::ManagedPtr<DomainManager>            DomainManagerMp;
     typedef bslma::ManagedPtr<mqbstat::StatController>  StatControllerMp;
     typedef bslma::ManagedPtr<mqbnet::TransportManager> TransportManagerMp;
+    typedef bsl::shared_ptr<mqbs::StorageEngine>        StorageEngineSp;
     typedef bdlcc::SharedObjectPool<
         bdlbb::Blob,
         bdlcc::ObjectPoolFunctors::DefaultCreator,
@@ -121,7 +126,7 @@ class Application {
     // Thread pool for admin commands
     // execution.
 
-    bdlbb::PooledBlobBufferFactory d_bufferFactory;
+    mwcma::ThreadCachedBlobBufferFactory d_bufferFactory;
 
     BlobSpPool d_blobSpPool;
 
@@ -131,6 +136,11 @@ class Application {
 
     PluginManagerMp d_pluginManager_mp;
 
+    bsl::vector<StorageEngineSp> d_storageEngines;
+    // Storage engines created by the
+    // plugins, started and registered
+    // with 'mqbs::StorageEngineRegistry'
+
     StatControllerMp d_statController_mp;
     // Statistics controller component
 
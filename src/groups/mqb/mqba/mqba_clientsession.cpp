@@ -151,6 +151,7 @@
 #include <mqbblp_clustercatalog.h>
 #include <mqbblp_queueengineutil.h>
 #include <mqbcfg_brokerconfig.h>
+#include <mqbcfg_messages.h>
 #include <mqbi_cluster.h>
 #include <mqbi_queue.h>
 #include <mqbstat_brokerstats.h>
@@ -158,9 +159,11 @@
 
 // BMQ
 #include <bmqp_compression.h>
+#include <bmqp_compressiondictionary.h>
 #include <bmqp_confirmmessageiterator.h>
 #include <bmqp_controlmessageutil.h>
 #include <bmqp_event.h>
+#include <bmqp_eventutil.h>
 #include <bmqp_messageproperties.h>
 #include <bmqp_protocolutil.h>
 #include <bmqp_putmessageiterator.h>
@@ -189,7 +192,9 @@
 #include <bdlf_bind.h>
 #include <bdlf_placeholder.h>
 #include <bdlma_localsequentialallocator.h>
+#include <bdlmt_eventscheduler.h>
 #include <bdlt_timeunitratio.h>
+#include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
 #include <bsl_memory.h>
@@ -199,6 +204,7 @@
 #include <bsls_annotation.h>
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
+#include <bsls_timeinterval.h>
 
 namespace BloombergLP {
 namespace mqba {
@@ -290,13 +296,27 @@ ClientSessionState::ClientSessionState(
 , d_blobSpPool_p(blobSpPool)
 , d_schemaEventBuilder(bufferFactory, allocator, encodingType)
 , d_pushBuilder(bufferFactory, allocator)
+, d_pushBatchPolicy()
+, d_isPushFlushScheduled(false)
 , d_ackBuilder(bufferFactory, allocator)
 , d_throttledFailedAckMessages()
 , d_throttledFailedPutMessages()
+, d_putRateLimiter()
+, d_supportsMessagePropertiesEx(false)
+, d_supportsLz4(false)
+, d_supportsZstd(false)
+, d_compressionDictionaryIds(allocator)
+, d_putBatch_sp()
+, d_numOpeningQueues(allocator)
+, d_deferredConfigures(allocator)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(encodingType != bmqp::EncodingType::e_UNKNOWN);
 
+    // Messages delivered to the client are immutable once stored, so that
+    // their payload can be shared between all the PUSH events carrying them.
+    d_pushBuilder.setZeroCopy(true);
+
     d_throttledFailedAckMessages.initialize(
         1,
         5 * bdlt::TimeUnitRatio::k_NS_PER_S);
@@ -305,6 +325,31 @@ ClientSessionState::ClientSessionState(
         1,
         5 * bdlt::TimeUnitRatio::k_NS_PER_S);
     // One maximum log per 5 seconds
+
+    const mqbcfg::AppConfig& brkrCfg = mqbcfg::BrokerConfig::get();
+    if (!brkrCfg.networkInterfaces().tcpInterface().isNull()) {
+        const int rate =
+            brkrCfg.networkInterfaces().tcpInterface().value().putRateLimit();
+        if (rate > 0) {
+            // Allow bursts of up to one second worth of messages
+            d_putRateLimiter.initialize(rate, rate);
+        }
+
+        const mqbcfg::TcpInterfaceConfig& tcpConfig =
+            brkrCfg.networkInterfaces().tcpInterface().value();
+        if (tcpConfig.pushBatchMaxDelayUs() > 0 &&
+            tcpConfig.pushBatchTargetSize() > 0) {
+            // A PUSH event is sent anyway once it reaches
+            // 'k_NAGLE_PACKET_SIZE'.
+            d_pushBatchPolicy.initialize(
+                bsl::min(tcpConfig.pushBatchTargetSize(), k_NAGLE_PACKET_SIZE),
+                static_cast<bsls::Types::Int64>(
+                    tcpConfig.pushBatchMaxDelayUs()) *
+                    bdlt::TimeUnitRatio::k_NS_PER_US);
+        }
+    }
+
+    d_putBatch_sp.createInplace(allocator, allocator);
 }
 
 // -------------------
@@ -375,8 +420,10 @@ void ClientSession::sendPacket(const bdlbb::Blob& blob, bool flushBuilders)
     //       is to smooth out the send of huge burst of data, with respect to
     //       the Channel watermarks limits and the rate at which data can be
     //       written to the channel.  Messages should never be staying more
-    //       than a couple milliseconds (or eventually seconds if there are
-    //       gigabytes of data) in this buffer queue.
+    //       than a couple milliseconds in this buffer queue: as long as it is
+    //       not empty, the queue handles are throttled so that no more
+    //       messages are delivered to this session, and the buffer queue only
+    //       holds the messages which were in flight.
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
             !d_state.d_channelBufferQueue.empty())) {
@@ -392,7 +439,7 @@ void ClientSession::sendPacket(const bdlbb::Blob& blob, bool flushBuilders)
         // 'flushBuilders' should only be used when sending control messages,
         // so not on the likely path.
 
-        flush();
+        forceFlush();
         // If 'flush' wasn't able to send all the data, some might now be
         // buffered in the 'channelBufferQueue', so check for it again.
         if (!d_state.d_channelBufferQueue.empty()) {
@@ -420,7 +467,14 @@ void ClientSession::sendPacket(const bdlbb::Blob& blob, bool flushBuilders)
                           << mwcu::PrintUtil::prettyNumber(blob.length())
                           << " bytes] to client due to channel watermark limit"
                           << "; enqueuing to the ChannelBufferQueue.";
+            const bool wasEmpty = d_state.d_channelBufferQueue.empty();
             d_state.d_channelBufferQueue.push_back(blob);
+
+            if (wasEmpty) {
+                // Stop the delivery of messages until the buffer queue is
+                // flushed.
+                setQueueHandlesThrottled(true);
+            }
         }
         else {
             BALL_LOG_INFO << "#CLIENT_SEND_FAILURE " << description()
@@ -443,6 +497,11 @@ void ClientSession::flushChannelBufferQueue()
         return;  // RETURN
     }
 
+    if (d_state.d_channelBufferQueue.empty()) {
+        // Nothing was buffered, so the queue handles are not throttled.
+        return;  // RETURN
+    }
+
     BALL_LOG_INFO << description() << ": Flushing ChannelBufferQueue ("
                   << d_state.d_channelBufferQueue.size() << " items)";
 
@@ -464,6 +523,148 @@ void ClientSession::flushChannelBufferQueue()
         }
         d_state.d_channelBufferQueue.pop_front();
     }
+
+    if (d_state.d_channelBufferQueue.empty()) {
+        // Resume the delivery of the messages left in the queues.
+        setQueueHandlesThrottled(false);
+    }
+}
+
+void ClientSession::forceFlush()
+{
+    // executed by the *CLIENT* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
+
+    if (d_state.d_pushBuilder.messageCount() != 0) {
+        sendPushEvent();
+    }
+
+    if (d_state.d_ackBuilder.messageCount() != 0) {
+        BALL_LOG_TRACE << description() << ": Flushing "
+                       << d_state.d_ackBuilder.messageCount()
+                       << " ACK messages";
+        sendPacket(d_state.d_ackBuilder.blob(), false);
+        d_state.d_ackBuilder.reset();
+    }
+}
+
+void ClientSession::flushPushBuilder()
+{
+    // executed by the *CLIENT* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
+
+    if (d_state.d_pushBuilder.messageCount() == 0) {
+        return;  // RETURN
+    }
+
+    if (!d_state.d_pushBatchPolicy.isEnabled()) {
+        sendPushEvent();
+        return;  // RETURN
+    }
+
+    const bsls::Types::Int64 delay = d_state.d_pushBatchPolicy.deferral(
+        d_state.d_pushBuilder.eventSize(),
+        mwcsys::Time::highResolutionTimer());
+    if (delay == 0) {
+        sendPushEvent();
+        return;  // RETURN
+    }
+
+    BALL_LOG_TRACE << description() << ": Holding "
+                   << d_state.d_pushBuilder.messageCount()
+                   << " PUSH messages for up to " << delay << " ns";
+
+    // The event already scheduled, if any, fires no later than this one
+    // would, since the PUSH event being built was not held before it was
+    // scheduled.
+    if (d_state.d_isPushFlushScheduled) {
+        return;  // RETURN
+    }
+
+    d_state.d_isPushFlushScheduled = true;
+
+    // The timer wheel is too coarse for delays of the order of the
+    // microsecond, so schedule the event on its scheduler directly.
+    bdlmt::EventScheduler* scheduler = d_timerWheel_p->scheduler();
+    scheduler->scheduleEvent(
+        scheduler->now() + bsls::TimeInterval().addNanoseconds(delay),
+        mwcu::WeakMemFnUtil::weakMemFn(&ClientSession::onPushFlushTimer,
+                                       d_self.acquireWeak()));
+}
+
+void ClientSession::sendPushEvent()
+{
+    // executed by the *CLIENT* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
+    BSLS_ASSERT_SAFE(d_state.d_pushBuilder.messageCount() != 0);
+
+    const int numMessages = d_state.d_pushBuilder.messageCount();
+
+    BALL_LOG_TRACE << description() << ": Flushing " << numMessages
+                   << " PUSH messages";
+
+    sendPacket(d_state.d_pushBuilder.blob(), false);
+    d_state.d_pushBuilder.reset();
+
+    if (d_state.d_pushBatchPolicy.isEnabled()) {
+        d_state.d_pushBatchPolicy.onSent(mwcsys::Time::highResolutionTimer());
+    }
+
+    mqbstat::QueueStatsClient::onPushEvent(d_state.d_statContext_mp.get(),
+                                           numMessages);
+}
+
+void ClientSession::onPushFlushTimer()
+{
+    // executed by the *SCHEDULER* thread
+
+    dispatcher()->execute(
+        bdlf::BindUtil::bind(&ClientSession::onPushFlushTimerDispatched,
+                             this),
+        this);
+}
+
+void ClientSession::onPushFlushTimerDispatched()
+{
+    // executed by the *CLIENT* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
+
+    d_state.d_isPushFlushScheduled = false;
+
+    if (isDisconnected()) {
+        return;  // RETURN
+    }
+
+    // Note that the builders are flushed before invoking any callback event
+    // (see 'onDispatcherEvent'), so that this is only a safety net.
+    flushPushBuilder();
+}
+
+void ClientSession::setQueueHandlesThrottled(bool value)
+{
+    // executed by the *CLIENT* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
+
+    const ClientSessionState::QueueStateMap& queues =
+        d_queueSessionManager.queues();
+    for (ClientSessionState::QueueStateMap::const_iterator cit =
+             queues.begin();
+         cit != queues.end();
+         ++cit) {
+        if (cit->second.d_handle_p) {
+            cit->second.d_handle_p->setClientThrottled(value);
+        }
+    }
 }
 
 void ClientSession::sendAck(bmqt::AckResult::Enum    status,
@@ -548,7 +749,7 @@ void ClientSession::sendAck(bmqt::AckResult::Enum    status,
     }
 
     if (d_state.d_ackBuilder.eventSize() >= k_NAGLE_PACKET_SIZE) {
-        flush();
+        forceFlush();
     }
 
     mqbstat::QueueStatsClient* queueStats = 0;
@@ -604,10 +805,9 @@ void ClientSession::tearDownImpl(bslmt::Semaphore*            semaphore,
     d_operationState         = e_DISCONNECTED;
 
     // If stop request handling is in progress cancel checking for the
-    // unconfirmed messages.
-    if (d_periodicUnconfirmedCheckHandler) {
-        d_scheduler_p->cancelEventAndWait(d_periodicUnconfirmedCheckHandler);
-    }
+    // unconfirmed messages.  Note that a check which already fired is
+    // synchronized with by invalidating 'd_self' below.
+    d_timerWheel_p->disarm(&d_unconfirmedCheckTimer);
 
     d_self.invalidate();
     // Invalidating this CS in CS thread for the sake of synchronization
@@ -912,7 +1112,6 @@ void ClientSession::checkUnconfirmedDispatched(
                                          : ": shutdown timeout has expired.")
                       << " Skip checking unconfirmed messages";
 
-        d_periodicUnconfirmedCheckHandler.release();
         return;  // RETURN
     }
 
@@ -1021,7 +1220,6 @@ void ClientSession::finishCheckUnconfirmedDispatched(
                       << shutdownCtx->d_numUnconfirmedTotal
                       << " unconfirmed messages";
 
-        d_periodicUnconfirmedCheckHandler.release();
         return;  // RETURN
     }
 
@@ -1031,8 +1229,8 @@ void ClientSession::finishCheckUnconfirmedDispatched(
                   << "]. Timeout at: [" << shutdownCtx->d_stopTime << "]";
 
     // Schedule one more check for unconfirmed messages.
-    d_scheduler_p->scheduleEvent(
-        &d_periodicUnconfirmedCheckHandler,
+    d_timerWheel_p->arm(
+        &d_unconfirmedCheckTimer,
         nextCheckTime,
         bdlf::BindUtil::bind(
             mwcu::WeakMemFnUtil::weakMemFn(&ClientSession::checkUnconfirmed,
@@ -1059,10 +1257,9 @@ void ClientSession::processDisconnectAllQueues(
     d_operationState         = e_DISCONNECTING;
 
     // If stop request handling is in progress cancel checking for the
-    // unconfirmed messages.
-    if (d_periodicUnconfirmedCheckHandler) {
-        d_scheduler_p->cancelEventAndWait(d_periodicUnconfirmedCheckHandler);
-    }
+    // unconfirmed messages.  Note that a check which already fired finds the
+    // session disconnecting, and does nothing.
+    d_timerWheel_p->disarm(&d_unconfirmedCheckTimer);
 
     // Step 1/3 of disconnect request processing: executed following an enqueue
     // to the client dispatcher from the IO thread.  Drops all applicable
@@ -1188,6 +1385,13 @@ void ClientSession::processOpenQueue(
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
 
+    // Until the request completes, configureQueue requests for the queue
+    // are deferred (see 'processConfigureStream').
+    ++d_state.d_numOpeningQueues[handleParamsCtrlMsg.choice()
+                                     .openQueue()
+                                     .handleParameters()
+                                     .qId()];
+
     d_queueSessionManager.processOpenQueue(
         handleParamsCtrlMsg,
         bdlf::BindUtil::bind(&ClientSession::openQueueCb,
@@ -1196,7 +1400,7 @@ void ClientSession::processOpenQueue(
                              bdlf::PlaceHolders::_2,  // handle
                              bdlf::PlaceHolders::_3,  // response
                              handleParamsCtrlMsg),
-        bdlf::BindUtil::bind(&ClientSession::sendErrorResponse,
+        bdlf::BindUtil::bind(&ClientSession::openQueueErrorCb,
                              this,
                              bdlf::PlaceHolders::_1,  // failureCategory
                              bdlf::PlaceHolders::_2,  // errorDescription
@@ -1216,6 +1420,9 @@ void ClientSession::openQueueCb(
     BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
     BSLS_ASSERT_SAFE(handleParamsCtrlMsg.choice().isOpenQueueValue());
 
+    const unsigned int queueId =
+        handleParamsCtrlMsg.choice().openQueue().handleParameters().qId();
+
     // Send success/error response to client
     bdlma::LocalSequentialAllocator<2048> localAllocator(
         d_state.d_allocator_p);
@@ -1235,6 +1442,15 @@ void ClientSession::openQueueCb(
         bmqp_ctrlmsg::OpenQueueResponse& res =
             response.choice().makeOpenQueueResponse(openQueueResponse);
         res.originalRequest() = handleParamsCtrlMsg.choice().openQueue();
+
+        if (!res.compressionDictionary().empty()) {
+            // The client registers the dictionary upon receiving the
+            // response.
+            d_state.d_compressionDictionaryIds.insert(
+                bmqp::CompressionDictionary::idFromData(
+                    res.compressionDictionary().data(),
+                    static_cast<int>(res.compressionDictionary().size())));
+        }
     }
 
     d_state.d_schemaEventBuilder.reset();
@@ -1247,6 +1463,7 @@ void ClientSession::openQueueCb(
             << ": Unable to send openQueue response [reason: ENCODING_FAILED, "
             << "rc: " << rc << ", request: " << handleParamsCtrlMsg
             << "]: " << response;
+        onOpenQueueCompleted(queueId);
         return;  // RETURN
     }
 
@@ -1256,6 +1473,62 @@ void ClientSession::openQueueCb(
 
     // Send the response
     sendPacket(d_state.d_schemaEventBuilder.blob(), true);
+
+    onOpenQueueCompleted(queueId);
+}
+
+void ClientSession::openQueueErrorCb(
+    bmqp_ctrlmsg::StatusCategory::Value failureCategory,
+    const bslstl::StringRef&            errorDescription,
+    const int                           code,
+    const bmqp_ctrlmsg::ControlMessage& handleParamsCtrlMsg)
+{
+    // executed by the *CLIENT* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
+    BSLS_ASSERT_SAFE(handleParamsCtrlMsg.choice().isOpenQueueValue());
+
+    sendErrorResponse(failureCategory,
+                      errorDescription,
+                      code,
+                      handleParamsCtrlMsg);
+
+    onOpenQueueCompleted(
+        handleParamsCtrlMsg.choice().openQueue().handleParameters().qId());
+}
+
+void ClientSession::onOpenQueueCompleted(unsigned int queueId)
+{
+    // executed by the *CLIENT* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
+
+    ClientSessionState::NumOpeningQueuesMap::iterator openingIt =
+        d_state.d_numOpeningQueues.find(queueId);
+    BSLS_ASSERT_SAFE(openingIt != d_state.d_numOpeningQueues.end());
+
+    if (--openingIt->second != 0) {
+        return;  // RETURN
+    }
+    d_state.d_numOpeningQueues.erase(openingIt);
+
+    ClientSessionState::DeferredConfiguresMap::iterator deferredIt =
+        d_state.d_deferredConfigures.find(queueId);
+    if (deferredIt == d_state.d_deferredConfigures.end()) {
+        return;  // RETURN
+    }
+
+    bsl::vector<bmqp_ctrlmsg::ControlMessage> deferred(d_state.d_allocator_p);
+    deferred.swap(deferredIt->second);
+    d_state.d_deferredConfigures.erase(deferredIt);
+
+    // If the queue failed to open, each deferred request is rejected as
+    // configuring an unknown queue.
+    for (size_t i = 0; i < deferred.size(); ++i) {
+        processConfigureStream(deferred[i]);
+    }
 }
 
 void ClientSession::processCloseQueue(
@@ -1371,6 +1644,19 @@ void ClientSession::processConfigureStream(
         req = streamParamsCtrlMsg.choice().configureStream();
     }
 
+    if (d_state.d_numOpeningQueues.find(req.qId()) !=
+        d_state.d_numOpeningQueues.end()) {
+        // The queue is being opened, e.g. the client reopens it and sent
+        // the configure request without waiting for the openQueue response.
+        BALL_LOG_INFO << description() << ": Deferring the configure "
+                      << "request of queue with Id (" << req.qId()
+                      << ") until it is opened: " << streamParamsCtrlMsg;
+
+        d_state.d_deferredConfigures[req.qId()].push_back(
+            streamParamsCtrlMsg);
+        return;  // RETURN
+    }
+
     ClientSessionState::QueueStateMap::iterator queueStateIter =
         d_queueSessionManager.queues().find(req.qId());
     if (queueStateIter == d_queueSessionManager.queues().end()) {
@@ -1573,12 +1859,16 @@ void ClientSession::onConfirmEvent(const mqbi::DispatcherConfirmEvent& event)
     bdlma::LocalSequentialAllocator<256> localAllocator(d_state.d_allocator_p);
     mwcu::MemOutStream                   errorStream(&localAllocator);
 
-    while ((rc = confIt.next()) == 1) {
+    // Process each range of consecutive messages (see 'Range encoding' in
+    // 'bmqp_confirmmessageiterator') at once, validating the queue only once
+    // and confirming all of its messages in a single dispatch.
+    while ((rc = confIt.nextRange()) == 1) {
         const int          id    = confIt.message().queueId();
         const unsigned int subId = static_cast<unsigned int>(
             confIt.message().subQueueId());
         const bmqp::QueueId queueId(id, subId);
         mqbi::QueueHandle*  queueHandle = 0;
+        const int           count       = confIt.rangeLength();
 
         bool isValid = validateMessage(&queueHandle,
                                        &errorStream,
@@ -1592,9 +1882,19 @@ void ClientSession::onConfirmEvent(const mqbi::DispatcherConfirmEvent& event)
                            << ++msgNum << " [queue: '"
                            << queueHandle->queue()->uri()
                            << "' GUID: " << confIt.message().messageGUID()
-                           << "]";
+                           << ", count: " << count << "]";
 
-            queueHandle->confirmMessage(confIt.message().messageGUID(), subId);
+            if (count == 1) {
+                queueHandle->confirmMessage(confIt.message().messageGUID(),
+                                            subId);
+            }
+            else {
+                queueHandle->confirmMessageRange(
+                    confIt.message().messageGUID(),
+                    count,
+                    subId);
+                msgNum += count - 1;
+            }
         }
         else {
             BALL_LOG_WARN << "#CLIENT_IMPROPER_BEHAVIOR " << description()
@@ -1806,6 +2106,73 @@ bool ClientSession::validateMessage(mqbi::QueueHandle**   queueHandle,
     return true;
 }
 
+int ClientSession::convertPushPayload(
+    bsl::shared_ptr<bdlbb::Blob>*        payload,
+    const bdlbb::Blob&                   blob,
+    const bmqt::MessageGUID&             guid,
+    PushPayloadCache::Conversion::Enum   conversion,
+    bmqt::CompressionAlgorithmType::Enum cat,
+    bool                                 haveNewMessageProperties)
+{
+    // executed by the *CLIENT* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
+    BSLS_ASSERT_SAFE(payload);
+
+    if (d_pushPayloadCache_p &&
+        d_pushPayloadCache_p->lookup(payload, guid, conversion)) {
+        // Already re-encoded for the client of another session (typically,
+        // the message is broadcast to all the consumers of the queue).
+        return 0;  // RETURN
+    }
+
+    *payload = d_state.d_blobSpPool_p->getObject();
+
+    int rc = 0;
+    switch (conversion) {
+    case PushPayloadCache::Conversion::e_OLD_PROPERTIES: {
+        rc = bmqp::ProtocolUtil::convertToOld(payload->get(),
+                                              &blob,
+                                              cat,
+                                              d_state.d_bufferFactory_p,
+                                              d_state.d_allocator_p);
+    } break;
+    case PushPayloadCache::Conversion::e_ZLIB: {
+        rc = bmqp::ProtocolUtil::convertCompression(
+            payload->get(),
+            blob,
+            cat,
+            bmqt::CompressionAlgorithmType::e_ZLIB,
+            haveNewMessageProperties,
+            d_state.d_bufferFactory_p,
+            d_state.d_allocator_p);
+    } break;
+    case PushPayloadCache::Conversion::e_NO_DICTIONARY: {
+        rc = bmqp::ProtocolUtil::convertCompression(
+            payload->get(),
+            blob,
+            cat,
+            cat,
+            haveNewMessageProperties,
+            d_state.d_bufferFactory_p,
+            d_state.d_allocator_p);
+    } break;
+    default: {
+        BSLS_ASSERT_SAFE(false && "Unknown conversion");
+        rc = -1;
+    }
+    }
+
+    if (rc == 0 && d_pushPayloadCache_p) {
+        // The payload is never modified once packed in a PUSH event (see
+        // 'ClientSessionState'), and can therefore be shared.
+        d_pushPayloadCache_p->insert(guid, conversion, *payload);
+    }
+
+    return rc;
+}
+
 void ClientSession::onPushEvent(const mqbi::DispatcherPushEvent& event)
 {
     // executed by the *CLIENT* dispatcher thread
@@ -1863,34 +2230,89 @@ void ClientSession::onPushEvent(const mqbi::DispatcherPushEvent& event)
         event.subQueueInfos(),
         !handleRequesterContext()->isFirstHop());
 
-    bdlbb::Blob buffer(d_state.d_bufferFactory_p, d_state.d_allocator_p);
+    bsl::shared_ptr<bdlbb::Blob>         converted;
     bmqt::CompressionAlgorithmType::Enum cat =
         event.compressionAlgorithmType();
     int convertingRc = 0;
 
     // Append the message to the builder
     if (pushProperties.isExtended()) {
-        if (!bmqp::ProtocolUtil::hasFeature(
-                bmqp::MessagePropertiesFeatures::k_FIELD_NAME,
-                bmqp::MessagePropertiesFeatures::k_MESSAGE_PROPERTIES_EX,
-                d_clientIdentity_p->features())) {
+        if (!d_state.d_supportsMessagePropertiesEx) {
             // Re-encode 'payload'
             // Convert MessageProperties into the old style
             // 1. Copy MPHs (if needed)
             // 2. Overwrite MPHs
             // 3. Decompress (if needed)
-            convertingRc = bmqp::ProtocolUtil::convertToOld(
-                &buffer,
-                blob,
+            convertingRc = convertPushPayload(
+                &converted,
+                *blob,
+                event.guid(),
+                PushPayloadCache::Conversion::e_OLD_PROPERTIES,
                 cat,
-                d_state.d_bufferFactory_p,
-                d_state.d_allocator_p);
+                true);
 
             pushProperties = bmqp::MessagePropertiesInfo::makeNoSchema();
 
             cat = bmqt::CompressionAlgorithmType::e_NONE;
-            if (buffer.length()) {
-                blob = &buffer;
+            if (converted->length()) {
+                blob = converted.get();
+            }
+        }
+    }
+
+    if (cat == bmqt::CompressionAlgorithmType::e_LZ4 ||
+        cat == bmqt::CompressionAlgorithmType::e_ZSTD) {
+        const bool isSupported = cat ==
+                                         bmqt::CompressionAlgorithmType::e_LZ4
+                                     ? d_state.d_supportsLz4
+                                     : d_state.d_supportsZstd;
+        if (!isSupported) {
+            // The client does not support the algorithm used by the
+            // producer; re-compress the data with ZLIB.
+            BSLS_ASSERT_SAFE(!converted);
+
+            convertingRc = convertPushPayload(
+                &converted,
+                *blob,
+                event.guid(),
+                PushPayloadCache::Conversion::e_ZLIB,
+                cat,
+                pushProperties.isPresent() && pushProperties.isExtended());
+
+            cat  = bmqt::CompressionAlgorithmType::e_ZLIB;
+            blob = converted.get();
+        }
+        else if (cat == bmqt::CompressionAlgorithmType::e_ZSTD) {
+            const bool haveNewMessageProperties = pushProperties.isPresent() &&
+                                                  pushProperties.isExtended();
+            int        mpsSize                  = 0;
+            if (haveNewMessageProperties) {
+                bmqp::ProtocolUtil::readPropertiesSize(&mpsSize,
+                                                       *blob,
+                                                       mwcu::BlobPosition());
+            }
+
+            const unsigned int dictionaryId =
+                bmqp::CompressionDictionary::frameDictionaryId(*blob,
+                                                               mpsSize);
+            if (dictionaryId != 0 &&
+                d_state.d_compressionDictionaryIds.find(dictionaryId) ==
+                    d_state.d_compressionDictionaryIds.end()) {
+                // The producer used a dictionary which was not advertised
+                // to this client (e.g., the client opened the queue before
+                // the dictionary was trained); re-compress the data without
+                // dictionary.
+                BSLS_ASSERT_SAFE(!converted);
+
+                convertingRc = convertPushPayload(
+                    &converted,
+                    *blob,
+                    event.guid(),
+                    PushPayloadCache::Conversion::e_NO_DICTIONARY,
+                    cat,
+                    haveNewMessageProperties);
+
+                blob = converted.get();
             }
         }
     }
@@ -1905,7 +2327,7 @@ void ClientSession::onPushEvent(const mqbi::DispatcherPushEvent& event)
 
         // Flush if the builder is 'full'
         if (d_state.d_pushBuilder.eventSize() >= k_NAGLE_PACKET_SIZE) {
-            flush();
+            forceFlush();
         }
 
         // Finally, Update stats
@@ -2053,9 +2475,19 @@ void ClientSession::onPutEvent(const mqbi::DispatcherPutEvent& event)
         return;  // RETURN
     }
 
-    int        rc         = 0;
-    int        msgNum     = 0;
-    const bool isFirstHop = handleRequesterContext()->isFirstHop();
+    // Consecutive PUT messages for the same queue are accumulated in
+    // 'd_state.d_putBatch_sp' and handed over to the queue together, instead
+    // of paying a dispatcher event per message.
+    BSLS_ASSERT_SAFE(d_state.d_putBatch_sp->empty());
+
+    int                rc          = 0;
+    int                msgNum      = 0;
+    const bool         isFirstHop  = handleRequesterContext()->isFirstHop();
+    mqbi::QueueHandle* batchHandle = 0;
+
+    // One clock read for all the messages of the event, used by the rate
+    // limiters
+    const bsls::Types::Int64 now = mwcsys::Time::highResolutionTimer();
     while ((rc = putIt.next()) == 1) {
         bmqp::PutHeader& putHeader = const_cast<bmqp::PutHeader&>(
             putIt.header());
@@ -2084,10 +2516,47 @@ void ClientSession::onPutEvent(const mqbi::DispatcherPutEvent& event)
             continue;  // CONTINUE
         }
 
-        // Update stats for the queue (or subStream of the queue)
         BSLS_ASSERT_SAFE(queueStatePtr && subQueueInfoPtr);
         BSLS_ASSERT_SAFE(queueStatePtr->d_handle_p);
 
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                !consumePutToken(queueStatePtr, now))) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            if (d_state.d_throttledFailedPutMessages.requestPermission()) {
+                BALL_LOG_WARN << "#CLIENT_PUT_RATE_LIMITED " << description()
+                              << ": PUT message rate limit exceeded "
+                              << "[queue: "
+                              << queueStatePtr->d_handle_p->queue()->uri()
+                              << "]";
+            }
+
+            if (isFirstHop && !d_isClientGeneratingGUIDs) {
+                sendAck(bmqt::AckResult::e_LIMIT_MESSAGES,
+                        putIt.header().correlationId(),
+                        bmqt::MessageGUID(),
+                        queueStatePtr,
+                        putHeader.queueId(),
+                        true,  // isSelfGenerated
+                        "putEvent::rateLimited");
+            }
+            else {
+                sendAck(bmqt::AckResult::e_LIMIT_MESSAGES,
+                        bmqp::AckMessage::k_NULL_CORRELATION_ID,
+                        putIt.header().messageGUID(),
+                        queueStatePtr,
+                        putHeader.queueId(),
+                        true,  // isSelfGenerated
+                        "putEvent::rateLimited");
+            }
+
+            invalidQueueStats()->onEvent(
+                mqbstat::QueueStatsClient::EventType::e_PUT,
+                appDataSp->length());
+            continue;  // CONTINUE
+        }
+
+        // Update stats for the queue (or subStream of the queue)
         subQueueInfoPtr->d_stats->onEvent(
             mqbstat::QueueStatsClient::EventType::e_PUT,
             appDataSp->length());
@@ -2222,11 +2691,18 @@ void ClientSession::onPutEvent(const mqbi::DispatcherPutEvent& event)
                        << "]:\n"
                        << mwcu::BlobStartHexDumper(appDataSp.get(), 64);
 
-        queueStatePtr->d_handle_p->postMessage(putIt.header(),
-                                               appDataSp,
-                                               optionsSp);
+        if (queueStatePtr->d_handle_p != batchHandle) {
+            flushPutBatch(batchHandle);
+            batchHandle = queueStatePtr->d_handle_p;
+        }
+        d_state.d_putBatch_sp->push_back(
+            mqbi::QueueHandle::PutMessage(putIt.header(),
+                                          appDataSp,
+                                          optionsSp));
     }
 
+    flushPutBatch(batchHandle);
+
     // Check if the PUT event was valid
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc < 0)) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
@@ -2243,6 +2719,59 @@ void ClientSession::onPutEvent(const mqbi::DispatcherPutEvent& event)
     }
 }
 
+void ClientSession::flushPutBatch(mqbi::QueueHandle* handle)
+{
+    // executed by the *CLIENT* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
+
+    mqbi::QueueHandle::PutMessages& batch = *d_state.d_putBatch_sp;
+    if (batch.empty()) {
+        return;  // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(handle);
+
+    if (batch.size() == 1) {
+        // No need to hand over the batch for a single message
+        const mqbi::QueueHandle::PutMessage& message = batch.front();
+        handle->postMessage(message.d_header,
+                            message.d_appData,
+                            message.d_options);
+        batch.clear();
+        return;  // RETURN
+    }
+
+    handle->postMessages(d_state.d_putBatch_sp);
+
+    // The batch now belongs to the queue; use a new one for the next messages
+    d_state.d_putBatch_sp.createInplace(d_state.d_allocator_p,
+                                        d_state.d_allocator_p);
+}
+
+bool ClientSession::consumePutToken(QueueState*        queueState,
+                                    bsls::Types::Int64 now)
+{
+    // executed by the *CLIENT* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
+    BSLS_ASSERT_SAFE(queueState);
+
+    if (!queueState->d_putRateLimiter.consume(1, now)) {
+        return false;  // RETURN
+    }
+
+    if (!d_state.d_putRateLimiter.consume(1, now)) {
+        // Give back the token of the queue, since the message is refused
+        queueState->d_putRateLimiter.release(1);
+        return false;  // RETURN
+    }
+
+    return true;
+}
+
 mqbstat::QueueStatsClient* ClientSession::invalidQueueStats()
 {
     // executed by the *CLIENT* dispatcher thread
@@ -2469,7 +2998,8 @@ ClientSession::ClientSession(
     bslma::ManagedPtr<mwcst::StatContext>&  clientStatContext,
     ClientSessionState::BlobSpPool*         blobSpPool,
     bdlbb::BlobBufferFactory*               bufferFactory,
-    bdlmt::EventScheduler*                  scheduler,
+    mqbu::TimerWheel*                       timerWheel,
+    PushPayloadCache*                       pushPayloadCache,
     bslma::Allocator*                       allocator)
 : d_self(this)  // use default allocator
 , d_operationState(e_RUNNING)
@@ -2491,8 +3021,9 @@ ClientSession::ClientSession(
                         domainFactory,
                         allocator)
 , d_clusterCatalog_p(clusterCatalog)
-, d_scheduler_p(scheduler)
-, d_periodicUnconfirmedCheckHandler()
+, d_timerWheel_p(timerWheel)
+, d_pushPayloadCache_p(pushPayloadCache)
+, d_unconfirmedCheckTimer(allocator)
 , d_shutdownChain(allocator)
 {
     // Register this client to the dispatcher
@@ -2508,6 +3039,28 @@ ClientSession::ClientSession(
                              this,
                              bdlf::PlaceHolders::_1));  // type
 
+    // Collapse runs of ACKs into ranges if the client can decode them.
+    if (bmqp::ProtocolUtil::hasFeature(bmqp::AckFeatures::k_FIELD_NAME,
+                                       bmqp::AckFeatures::k_RANGES,
+                                       d_clientIdentity_p->features())) {
+        d_state.d_ackBuilder.setRangeEncoding(true);
+    }
+
+    // Resolve once the features needed to deliver each PUSH message.
+    const bsl::string& features = d_clientIdentity_p->features();
+    d_state.d_supportsMessagePropertiesEx = bmqp::ProtocolUtil::hasFeature(
+        bmqp::MessagePropertiesFeatures::k_FIELD_NAME,
+        bmqp::MessagePropertiesFeatures::k_MESSAGE_PROPERTIES_EX,
+        features);
+    d_state.d_supportsLz4 = bmqp::ProtocolUtil::hasFeature(
+        bmqp::CompressionFeatures::k_FIELD_NAME,
+        bmqp::CompressionFeatures::k_LZ4,
+        features);
+    d_state.d_supportsZstd = bmqp::ProtocolUtil::hasFeature(
+        bmqp::CompressionFeatures::k_FIELD_NAME,
+        bmqp::CompressionFeatures::k_ZSTD,
+        features);
+
     mqbstat::BrokerStats::instance().onEvent(
         mqbstat::BrokerStats::EventType::e_CLIENT_CREATED);
 
@@ -2529,6 +3082,10 @@ ClientSession::~ClientSession()
 
     BALL_LOG_INFO << description() << ": destructor";
 
+    // No-op unless the session is destroyed while checking for the
+    // unconfirmed messages.
+    d_timerWheel_p->disarm(&d_unconfirmedCheckTimer);
+
     mqbstat::BrokerStats::instance().onEvent(
         mqbstat::BrokerStats::EventType::e_CLIENT_DESTROYED);
 
@@ -2705,11 +3262,27 @@ void ClientSession::processEvent(
             return;  // RETURN
         }
 
-        // Dispatch the event
-        mqbi::DispatcherEvent*       dispEvent = dispatcher()->getEvent(this);
         bsl::shared_ptr<bdlbb::Blob> blobSp =
             d_state.d_blobSpPool_p->getObject();
-        *blobSp = *(event.blob());
+        if (event.isCompactPutEvent()) {
+            // Expand the event, so that nothing past this point has to know
+            // about the compact encoding.
+            blobSp->removeAll();
+            const int rc = bmqp::EventUtil::expandPutEvent(blobSp.get(),
+                                                           *(event.blob()));
+            if (rc != 0) {
+                BALL_LOG_ERROR << "#CLIENT_IMPROPER_BEHAVIOR " << description()
+                               << ": Dropping invalid compact PUT event "
+                               << "[rc: " << rc << "]: " << event;
+                return;  // RETURN
+            }
+        }
+        else {
+            *blobSp = *(event.blob());
+        }
+
+        // Dispatch the event
+        mqbi::DispatcherEvent* dispEvent = dispatcher()->getEvent(this);
         (*dispEvent).setType(eventType).setSource(this).setBlob(blobSp);
         dispatcher()->dispatchEvent(dispEvent, this);
     }
@@ -2865,9 +3438,10 @@ void ClientSession::onDispatcherEvent(const mqbi::DispatcherEvent& event)
         const mqbi::DispatcherCallbackEvent* realEvent =
             event.asCallbackEvent();
 
-        BSLS_ASSERT_SAFE(realEvent->callback());
-        flush();  // Flush any pending messages to guarantee ordering of events
-        realEvent->callback()(dispatcherClientData().processorHandle());
+        BSLS_ASSERT_SAFE(realEvent->hasCallback());
+        // Flush any pending messages to guarantee ordering of events
+        forceFlush();
+        realEvent->invokeCallback(dispatcherClientData().processorHandle());
     } break;
     case mqbi::DispatcherEventType::e_CONTROL_MSG: {
         BSLS_ASSERT_OPT(false &&
@@ -2918,14 +3492,9 @@ void ClientSession::flush()
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
 
-    // Start by flushing the data ('PUSH') messages.
-    if (d_state.d_pushBuilder.messageCount() != 0) {
-        BALL_LOG_TRACE << description() << ": Flushing "
-                       << d_state.d_pushBuilder.messageCount()
-                       << " PUSH messages";
-        sendPacket(d_state.d_pushBuilder.blob(), false);
-        d_state.d_pushBuilder.reset();
-    }
+    // Start by flushing the data ('PUSH') messages, unless the batching
+    // policy holds them to send a larger event.
+    flushPushBuilder();
 
     // Then flush the 'ACK' messages.
     if (d_state.d_ackBuilder.messageCount() != 0) {
@@ -31,6 +31,7 @@
 
 // MQB
 
+#include <mqba_pushpayloadcache.h>
 #include <mqbblp_queuesessionmanager.h>
 #include <mqbconfm_messages.h>
 #include <mqbi_dispatcher.h>
@@ -38,6 +39,9 @@
 #include <mqbi_queue.h>
 #include <mqbnet_session.h>
 #include <mqbstat_queuestats.h>
+#include <mqbu_adaptivebatchpolicy.h>
+#include <mqbu_timerwheel.h>
+#include <mqbu_tokenbucket.h>
 
 // BMQ
 #include <bmqp_ackeventbuilder.h>
@@ -46,6 +50,8 @@
 #include <bmqp_pusheventbuilder.h>
 #include <bmqp_queueid.h>
 #include <bmqp_schemaeventbuilder.h>
+#include <bmqt_compressionalgorithmtype.h>
+#include <bmqt_messageguid.h>
 #include <bmqt_uri.h>
 
 // MWC
@@ -60,14 +66,15 @@
 #include <bdlbb_blob.h>
 #include <bdlcc_objectpool.h>
 #include <bdlcc_sharedobjectpool.h>
-#include <bdlmt_eventscheduler.h>
 #include <bdlmt_throttle.h>
 #include <bsl_deque.h>
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
+#include <bsl_unordered_set.h>
 #include <bsl_utility.h>
+#include <bsl_vector.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bsls_atomic.h>
@@ -151,6 +158,17 @@ struct ClientSessionState {
 
     typedef bslma::ManagedPtr<mwcst::StatContext> StatContextMp;
 
+    /// Map of queueId to the number of openQueue requests in progress for
+    /// that queue
+    typedef bsl::unordered_map<unsigned int, int> NumOpeningQueuesMap;
+
+    /// Map of queueId to the configureQueue requests deferred until the
+    /// openQueue requests in progress for that queue complete, in the order
+    /// they were received
+    typedef bsl::unordered_map<unsigned int,
+                               bsl::vector<bmqp_ctrlmsg::ControlMessage> >
+        DeferredConfiguresMap;
+
   public:
     // PUBLIC DATA
     bslma::Allocator* d_allocator_p;
@@ -169,6 +187,13 @@ struct ClientSessionState {
     // thread. Note that it really should
     // be a queue and not a deque, but
     // queue doesn't have a 'clear' method.
+    // Note also that the queue handles of
+    // the session are throttled while it
+    // is not empty, so that the messages
+    // of a slow consumer are kept in the
+    // queue (and read again from storage
+    // once it is flushed) rather than
+    // accumulated in it.
 
     UnackedMessageInfoMap d_unackedMessageInfos;
     // Map containing the
@@ -201,6 +226,20 @@ struct ClientSessionState {
     // used only in client dispatcher
     // thread.
 
+    mqbu::AdaptiveBatchPolicy d_pushBatchPolicy;
+    // Policy deciding whether the PUSH
+    // event being built is sent when the
+    // session is flushed, or held so that
+    // it grows closer to the configured
+    // 'pushBatchTargetSize'.  Disabled
+    // unless configured with a
+    // 'pushBatchMaxDelayUs'.
+
+    bool d_isPushFlushScheduled;
+    // Whether an event is scheduled to
+    // flush the PUSH event held by
+    // 'd_pushBatchPolicy'.
+
     bmqp::AckEventBuilder d_ackBuilder;
     // Builder for ack messages.  To be
     // used only in client dispatcher
@@ -212,12 +251,60 @@ struct ClientSessionState {
     bdlmt::Throttle d_throttledFailedPutMessages;
     // Throttler for failed PUT messages.
 
+    mqbu::TokenBucket d_putRateLimiter;
+    // Limiter of the rate of PUT messages
+    // posted by this session, disabled
+    // unless configured with a
+    // 'putRateLimit'.
+
     bdlb::NullableValue<mqbstat::QueueStatsClient> d_invalidQueueStats;
     // Stats associated with an unknown
     // queue, lazily created when the first
     // usage of an unknown queue is
     // encountered
 
+    bool d_supportsMessagePropertiesEx;
+    // Whether the client supports the new
+    // style of message properties, as
+    // negotiated when the session was
+    // created.
+
+    bool d_supportsLz4;
+    // Whether the client supports LZ4
+    // compression, as negotiated when the
+    // session was created.
+
+    bool d_supportsZstd;
+    // Whether the client supports ZSTD
+    // compression, as negotiated when the
+    // session was created.
+
+    bsl::unordered_set<unsigned int> d_compressionDictionaryIds;
+    // Ids of the ZSTD dictionaries
+    // advertised to the client,
+    // which it can therefore use to
+    // decompress PUSH messages.
+
+    bsl::shared_ptr<mqbi::QueueHandle::PutMessages> d_putBatch_sp;
+    // PUT messages of the PUT event being
+    // processed, for the same queue,
+    // which are yet to be posted.  Reused
+    // across events, unless handed over
+    // to the queue.
+
+    NumOpeningQueuesMap d_numOpeningQueues;
+    // Number of openQueue requests in
+    // progress, by queue id.
+
+    DeferredConfiguresMap d_deferredConfigures;
+    // configureQueue requests received for
+    // a queue while an openQueue request
+    // for it is in progress, e.g. sent by
+    // a client reopening the queue without
+    // waiting for the openQueue response.
+    // They are processed once the queue is
+    // opened.
+
   private:
     // NOT IMPLEMENTED
 
@@ -371,14 +458,20 @@ class ClientSession : public mqbnet::Session,
     // Cluster catalog to query for cluster
     // information
 
-    bdlmt::EventScheduler* d_scheduler_p;
-    // Pointer to the event scheduler to
-    // use (held, not owned)
+    mqbu::TimerWheel* d_timerWheel_p;
+    // Timer wheel, shared with the other
+    // sessions, to arm the timers of this
+    // session on (held, not owned)
 
-    bdlmt::EventSchedulerEventHandle d_periodicUnconfirmedCheckHandler;
-    // Handler to manage the scheduled
-    // event that triggers the checking of
-    // the unconfirmed messages during the
+    PushPayloadCache* d_pushPayloadCache_p;
+    // Cache of the PUSH payloads re-encoded
+    // for the clients, shared with the
+    // other sessions (held, not owned).
+    // Optional.
+
+    mqbu::TimerWheel::Timer d_unconfirmedCheckTimer;
+    // Timer triggering the checking of the
+    // unconfirmed messages during the
     // session shutdown.
 
     mwcu::OperationChain d_shutdownChain;
@@ -418,6 +511,35 @@ class ClientSession : public mqbnet::Session,
     /// `channelBufferQueue`.
     void flushChannelBufferQueue();
 
+    /// Send the PUSH and the ACK events being built, regardless of the
+    /// PUSH batching policy.
+    void forceFlush();
+
+    /// Send the PUSH event being built, if any, unless the PUSH batching
+    /// policy advises to hold it, in which case schedule an event to
+    /// consider sending it again once the maximum delay of the policy
+    /// expires.
+    void flushPushBuilder();
+
+    /// Send the PUSH event being built, and update the PUSH batching policy
+    /// and the statistics of the session accordingly.  The behavior is
+    /// undefined unless the event has at least one message.
+    void sendPushEvent();
+
+    /// Callback invoked by the scheduler when the maximum delay of a PUSH
+    /// event held by the PUSH batching policy expired.
+    void onPushFlushTimer();
+
+    /// Dispatched from `onPushFlushTimer` to the client dispatcher thread.
+    void onPushFlushTimerDispatched();
+
+    /// Set whether the client is throttled to the specified `value` on all
+    /// the queue handles of this session (see
+    /// `mqbi::QueueHandle::setClientThrottled`).  This is called only when
+    /// the `channelBufferQueue` goes from empty to non-empty (`true`) and
+    /// back (`false`), not on every buffered or flushed blob.
+    void setQueueHandlesThrottled(bool value);
+
     /// Append an ack message to the session's ack builder, with the
     /// specified `status`, and the specified `correlationId`, `messageGUID`
     /// and `queueId`, associated with the queue having the specified
@@ -546,6 +668,20 @@ class ClientSession : public mqbnet::Session,
     /// Process the specified reject `event`.
     void onRejectEvent(const mqbi::DispatcherRejectEvent& event);
 
+    /// Load into the specified `payload` the specified `blob`, payload of
+    /// the PUSH message having the specified `guid` and compressed with the
+    /// specified `cat`, re-encoded with the specified `conversion`, taking
+    /// it from the `d_pushPayloadCache_p` if another session already
+    /// re-encoded it.  The specified `haveNewMessageProperties` indicates
+    /// whether `blob` starts with message properties in the new style.
+    /// Return 0 on success, or a non-zero value otherwise.
+    int convertPushPayload(bsl::shared_ptr<bdlbb::Blob>*        payload,
+                           const bdlbb::Blob&                   blob,
+                           const bmqt::MessageGUID&             guid,
+                           PushPayloadCache::Conversion::Enum   conversion,
+                           bmqt::CompressionAlgorithmType::Enum cat,
+                           bool haveNewMessageProperties);
+
     /// Process the specified push `event` received from the dispatcher.
     void onPushEvent(const mqbi::DispatcherPushEvent& event);
 
@@ -567,6 +703,21 @@ class ClientSession : public mqbnet::Session,
                      const bmqp_ctrlmsg::OpenQueueResponse& openQueueResponse,
                      const bmqp_ctrlmsg::ControlMessage& handleParamsCtrlMsg);
 
+    /// Send an error response having the specified `failureCategory`,
+    /// `errorDescription` and `code` to the openQueue request in the
+    /// specified `handleParamsCtrlMsg`.
+    void
+    openQueueErrorCb(bmqp_ctrlmsg::StatusCategory::Value failureCategory,
+                     const bslstl::StringRef&            errorDescription,
+                     const int                           code,
+                     const bmqp_ctrlmsg::ControlMessage& handleParamsCtrlMsg);
+
+    /// Record the completion of an openQueue request for the queue having
+    /// the specified `queueId`, and process the configureQueue requests
+    /// deferred until then if no other openQueue request is in progress
+    /// for that queue.
+    void onOpenQueueCompleted(unsigned int queueId);
+
     void closeQueueCb(const bsl::shared_ptr<mqbi::QueueHandle>& handle,
                       const bmqp_ctrlmsg::ControlMessage& handleParamsCtrlMsg);
 
@@ -597,6 +748,22 @@ class ClientSession : public mqbnet::Session,
                             bsl::shared_ptr<bdlbb::Blob>*   optionsSp,
                             const bmqp::PutMessageIterator& putIt);
 
+    /// Post the PUT messages accumulated in `d_state.d_putBatch_sp`, if
+    /// any, to the specified `handle`: as a single message if there is only
+    /// one, or as a batch handed over to the queue with a single event
+    /// otherwise.
+    ///
+    /// THREAD: This method is called from the Client's dispatcher thread.
+    void flushPutBatch(mqbi::QueueHandle* handle);
+
+    /// Consume, at the specified `now` time, one token from the PUT rate
+    /// limiters of this session and of the queue having the specified
+    /// `queueState`, and return true if both granted it, or return false,
+    /// leaving both limiters unchanged, otherwise.
+    ///
+    /// THREAD: This method is called from the Client's dispatcher thread.
+    bool consumePutToken(QueueState* queueState, bsls::Types::Int64 now);
+
     // PRIVATE ACCESSORS
 
     /// Return true if the session is `e_DISCONNECTED` or worse (`e_DEAD`).
@@ -611,12 +778,15 @@ class ClientSession : public mqbnet::Session,
 
     /// Constructor of a new session associated to the specified `channel`
     /// and using the specified `dispatcher`, `domainFactory`, `blobSpPool`,
-    /// `bufferFactory` and `scheduler`.  The specified `clientStatContext`
+    /// `bufferFactory` and `timerWheel`.  The specified `clientStatContext`
     /// should be used as the top level for statistics associated to this
     /// session.  The specified `negotiationMessage` represents the identity
     /// received from the peer during negotiation, and the specified
     /// `sessionDescription` is the short form description of the session.
-    /// Memory allocations are performed using the specified `allocator`.
+    /// The PUSH payloads re-encoded for the client are shared with the
+    /// other sessions through the specified `pushPayloadCache`, unless it
+    /// is 0.  Memory allocations are performed using the specified
+    /// `allocator`.
     ClientSession(const bsl::shared_ptr<mwcio::Channel>&  channel,
                   const bmqp_ctrlmsg::NegotiationMessage& negotiationMessage,
                   const bsl::string&                      sessionDescription,
@@ -626,7 +796,8 @@ class ClientSession : public mqbnet::Session,
                   bslma::ManagedPtr<mwcst::StatContext>&  clientStatContext,
                   ClientSessionState::BlobSpPool*         blobSpPool,
                   bdlbb::BlobBufferFactory*               bufferFactory,
-                  bdlmt::EventScheduler*                  scheduler,
+                  mqbu::TimerWheel*                       timerWheel,
+                  PushPayloadCache*                       pushPayloadCache,
                   bslma::Allocator*                       allocator);
 
     /// Destructor
@@ -29,6 +29,7 @@
 #include <mqbstat_brokerstats.h>
 #include <mqbstat_queuestats.h>
 #include <mqbu_messageguidutil.h>
+#include <mqbu_timerwheel.h>
 
 // BMQ
 #include <bmqp_crc32c.h>
@@ -56,6 +57,8 @@
 #include <bdlcc_objectpool.h>
 #include <bdlcc_sharedobjectpool.h>
 #include <bdlf_bind.h>
+#include <bdlmt_eventscheduler.h>
+#include <bsl_functional.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
 #include <bsl_vector.h>
@@ -558,6 +561,9 @@ class MyMockDomain : public mqbmock::Domain {
     bsl::shared_ptr<MyMockQueueHandle> d_queueHandle;
     MyQueueEngine                      d_mockQueueEngine;
     const bool                         d_atMostOnce;
+    bool                               d_isOpenQueueDeferred;
+    bsl::function<void()>              d_pendingOpenQueue;
+    OpenQueueCallback                  d_pendingOpenQueueCb;
     bslma::Allocator*                  d_allocator_p;
 
     // CREATORS
@@ -572,6 +578,9 @@ class MyMockDomain : public mqbmock::Domain {
     , d_queueHandle()
     , d_mockQueueEngine(allocator)
     , d_atMostOnce(atMostOnce)
+    , d_isOpenQueueDeferred(false)
+    , d_pendingOpenQueue(bsl::allocator_arg, allocator)
+    , d_pendingOpenQueueCb(bsl::allocator_arg, allocator)
     , d_allocator_p(allocator)
     {
     }
@@ -583,7 +592,9 @@ class MyMockDomain : public mqbmock::Domain {
 
     /// Implements the required for this test behavior for `OpenQueue`.  It
     /// calls the specified `callback` with a new queue handle created
-    /// using the specified `handleParameters`.  The specified `uri` and
+    /// using the specified `handleParameters`, or keeps that call in
+    /// `d_pendingOpenQueue` and `callback` in `d_pendingOpenQueueCb` if
+    /// `d_isOpenQueueDeferred` is set.  The specified `uri` and
     /// `clientContext` are ignored.
     void openQueue(BSLS_ANNOTATION_UNUSED const bmqt::Uri& uri,
                    const bsl::shared_ptr<mqbi::QueueHandleRequesterContext>&
@@ -614,6 +625,16 @@ class MyMockDomain : public mqbmock::Domain {
         bmqp_ctrlmsg::OpenQueueResponse openQueueResponse(s_allocator_p);
         openQueueResponse.routingConfiguration() = d_routingConfiguration;
 
+        if (d_isOpenQueueDeferred) {
+            d_pendingOpenQueue = bdlf::BindUtil::bind(callback,
+                                                      status,
+                                                      d_queueHandle.get(),
+                                                      openQueueResponse,
+                                                      confirmationCookie);
+            d_pendingOpenQueueCb = callback;
+            return;  // RETURN
+        }
+
         callback(status,
                  d_queueHandle.get(),
                  openQueueResponse,
@@ -657,6 +678,7 @@ class TestBench {
     bslma::ManagedPtr<mwcst::StatContext> d_clientStatContext_mp;
     bdlmt::EventScheduler                 d_scheduler;
     TestClock                             d_testClock;
+    mqbu::TimerWheel                      d_timerWheel;
     mqba::ClientSession                   d_cs;
     bslma::Allocator*                     d_allocator_p;
 
@@ -686,6 +708,7 @@ class TestBench {
               .managedPtr())
     , d_scheduler(bsls::SystemClockType::e_MONOTONIC, allocator)
     , d_testClock(d_scheduler)
+    , d_timerWheel(&d_scheduler, allocator)
     , d_cs(d_channel,
            negotiationMessage,
            "sessionDescription",
@@ -695,7 +718,8 @@ class TestBench {
            d_clientStatContext_mp,
            &d_blobSpPool,
            &d_bufferFactory,
-           &d_scheduler,
+           &d_timerWheel,
+           0,  // PushPayloadCache
            allocator)
     , d_allocator_p(allocator)
     {
@@ -781,6 +805,36 @@ class TestBench {
         d_cs.processEvent(event);
     }
 
+    /// Sends a `ConfigureStream` event for the specified `queueId`, with
+    /// the specified `consumerPriority`, to this testbench's
+    /// `ClientSession`.
+    void configureQueue(const int queueId, const int consumerPriority)
+    {
+        bmqp::SchemaEventBuilder      obj(&d_bufferFactory, d_allocator_p);
+        bmqp_ctrlmsg::ControlMessage  controlMessage(d_allocator_p);
+        bmqp_ctrlmsg::ConfigureStream& configureStream =
+            controlMessage.choice().makeConfigureStream();
+        configureStream.qId() = queueId;
+
+        bmqp_ctrlmsg::Subscription subscription(d_allocator_p);
+        subscription.sId() = bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID;
+        bmqp_ctrlmsg::ConsumerInfo consumerInfo;
+        consumerInfo.consumerPriority()      = consumerPriority;
+        consumerInfo.consumerPriorityCount() = 1;
+        subscription.consumers().push_back(consumerInfo);
+        configureStream.streamParameters().subscriptions().push_back(
+            subscription);
+        controlMessage.rId().makeValue(queueId + 1);
+
+        // Encode the message
+        int rc = obj.setMessage(controlMessage, bmqp::EventType::e_CONTROL);
+        ASSERT_EQ(rc, 0);
+
+        bmqp::Event event(&obj.blob(), d_allocator_p);
+
+        d_cs.processEvent(event);
+    }
+
     /// Sends an `CloseQueue` event for the specified `uri` and `queuId`, to
     /// this testbench's `ClientSession`.
     void closeQueue(const bsl::string& uri, const int queueId)
@@ -927,6 +981,19 @@ class TestBench {
         return 0 == bdlbb::BlobUtil::compare(in, out);
     }
 
+    /// Load into the specified `controlMessage` the control message written
+    /// to the channel in the event specified by `eventIndex`.
+    void loadControlMessage(bmqp_ctrlmsg::ControlMessage* controlMessage,
+                            int                           eventIndex)
+    {
+        ASSERT(d_channel->waitFor(eventIndex + 1, false));  // isFinal = false
+        ConstWriteCall& call = d_channel->writeCalls()[eventIndex];
+        bmqp::Event     event(&call.d_blob, s_allocator_p);
+        PVV("Event " << eventIndex + 1 << ": " << event);
+        ASSERT(event.isControlEvent());
+        ASSERT_EQ(0, event.loadControlEvent(controlMessage));
+    }
+
     /// Asserts that the first event written is an Open Queue Control Event.
     void assertOpenQueueResponse()
     {
@@ -2532,6 +2599,116 @@ static void testN3_guidCollisionConfiguration()
                       static_cast<AckRequested>(ackRequested));
 }
 
+static void test12_configureDeferredUntilOpened()
+// ------------------------------------------------------------------------
+// CONFIGURE DEFERRED UNTIL OPENED
+//
+// Concerns:
+//   - A configure request received while the queue is being opened, as
+//     sent by a client reopening the queue without waiting for the
+//     openQueue response, is processed once the queue is opened, and its
+//     response is sent after the openQueue response.
+//   - If the queue fails to open, the deferred configure request fails.
+//
+// Plan:
+//   Instantiate a testbench deferring the completion of the openQueue
+//   requests, send an openQueue and a configure request, verify that no
+//   response is sent, complete the openQueue request and verify the order
+//   and contents of the responses.
+//
+// Testing:
+//   configure request pipelined with the openQueue request
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("CONFIGURE DEFERRED UNTIL OPENED");
+
+    const bsl::string uri("bmq://my.domain/queue-foo-bar", s_allocator_p);
+    const int         queueId = 4;  // A queue number
+
+    PV("Open succeeds");
+    {
+        TestBench tb(client(e_FirstHop), false, s_allocator_p);
+        tb.d_domain.d_isOpenQueueDeferred = true;
+
+        tb.openQueue(uri, queueId);
+        tb.configureQueue(queueId, 2);
+
+        // Neither request is responded to before the queue is opened.
+        tb.d_cs.flush();
+        ASSERT(tb.d_channel->writeCalls().empty());
+        ASSERT(tb.d_domain.d_pendingOpenQueue);
+
+        tb.d_domain.d_pendingOpenQueue();
+        tb.d_cs.flush();
+
+        bmqp_ctrlmsg::ControlMessage openResponse(s_allocator_p);
+        tb.loadControlMessage(&openResponse, 0);
+        ASSERT(openResponse.choice().isOpenQueueResponseValue());
+        ASSERT_EQ(queueId, openResponse.rId().value());
+
+        bmqp_ctrlmsg::ControlMessage configureResponse(s_allocator_p);
+        tb.loadControlMessage(&configureResponse, 1);
+        ASSERT(configureResponse.choice().isConfigureStreamResponseValue());
+        ASSERT_EQ(queueId + 1, configureResponse.rId().value());
+
+        const bmqp_ctrlmsg::StreamParameters& streamParameters =
+            configureResponse.choice()
+                .configureStreamResponse()
+                .request()
+                .streamParameters();
+        ASSERT_EQ(1U, streamParameters.subscriptions().size());
+        ASSERT_EQ(2,
+                  streamParameters.subscriptions()[0]
+                      .consumers()[0]
+                      .consumerPriority());
+
+        // Once the queue is opened, a configure request is processed
+        // immediately.
+        tb.d_domain.d_isOpenQueueDeferred = false;
+        tb.configureQueue(queueId, 3);
+        tb.d_cs.flush();
+
+        bmqp_ctrlmsg::ControlMessage reconfigureResponse(s_allocator_p);
+        tb.loadControlMessage(&reconfigureResponse, 2);
+        ASSERT(reconfigureResponse.choice().isConfigureStreamResponseValue());
+    }
+
+    PV("Open fails");
+    {
+        TestBench tb(client(e_FirstHop), false, s_allocator_p);
+        tb.d_domain.d_isOpenQueueDeferred = true;
+
+        tb.openQueue(uri, queueId);
+        tb.configureQueue(queueId, 2);
+
+        tb.d_cs.flush();
+        ASSERT(tb.d_channel->writeCalls().empty());
+        ASSERT(tb.d_domain.d_pendingOpenQueueCb);
+
+        // Fail the open queue request.
+        bmqp_ctrlmsg::Status status(s_allocator_p);
+        status.category() = bmqp_ctrlmsg::StatusCategory::E_REFUSED;
+        status.message()  = "refused";
+
+        tb.d_domain.d_pendingOpenQueueCb(
+            status,
+            0,
+            bmqp_ctrlmsg::OpenQueueResponse(s_allocator_p),
+            mqbi::Domain::OpenQueueConfirmationCookie());
+        tb.d_cs.flush();
+
+        bmqp_ctrlmsg::ControlMessage openResponse(s_allocator_p);
+        tb.loadControlMessage(&openResponse, 0);
+        ASSERT(openResponse.choice().isStatusValue());
+        ASSERT_EQ(queueId, openResponse.rId().value());
+
+        bmqp_ctrlmsg::ControlMessage configureResponse(s_allocator_p);
+        tb.loadControlMessage(&configureResponse, 1);
+        ASSERT(configureResponse.choice().isStatusValue());
+        ASSERT_EQ(queueId + 1, configureResponse.rId().value());
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -2560,6 +2737,7 @@ int main(int argc, char* argv[])
 
         switch (_testCase) {
         case 0:
+        case 12: test12_configureDeferredUntilOpened(); break;
         case 11: test11_initiateShutdown(); break;
         case 10: test10_newStyleCompressedPush(); break;
         case 9: test9_newStylePush(); break;
@@ -148,7 +148,12 @@ void ConfigProvider::getDomainConfig(const bslstl::StringRef& domainName,
         return;  // RETURN
     }
 
-    // We don't have the config in the small cache ..
+    // We don't have the config in the small cache ..  Read it from its file
+    // without holding the mutex, so that the configs of several domains can
+    // be retrieved in parallel (e.g., when recovering the queues of many
+    // domains at startup).
+    guard.release()->unlock();  // mutex UNLOCK
+
     int         rc = 0;
     bsl::string config;
 
@@ -191,7 +196,6 @@ void ConfigProvider::getDomainConfig(const bslstl::StringRef& domainName,
         response.domainConfig().config()     = config;
         response.domainConfig().domainName() = domainName;
     }
-    guard.release()->unlock();  // unlock
 
     BALL_LOG_INFO << "Config for domain '" << domainName << "' retrieved "
                   << "from file '" << filePath << "'";
@@ -27,15 +27,19 @@
 #include <bdlf_bind.h>
 #include <bdlf_placeholder.h>
 #include <bdlmt_eventscheduler.h>
+#include <bdlt_timeunitratio.h>
 #include <bsl_cstddef.h>
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
 #include <bsl_string.h>
 #include <bslma_managedptr.h>
+#include <bslmt_lockguard.h>
 #include <bslmt_semaphore.h>
 #include <bsls_annotation.h>
+#include <bsls_performancehint.h>
 #include <bsls_systemclocktype.h>
 #include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
 
 namespace BloombergLP {
 namespace mqba {
@@ -92,7 +96,7 @@ void Dispatcher_Executor::post(const bsl::function<void()>& f) const
 
     event->object()
         .setType(mqbi::DispatcherEventType::e_DISPATCHER)
-        .setCallback(mqbi::Dispatcher::voidToProcessorFunctor(f));
+        .setVoidCallback(f);
 
     // submit the event
     int rc = d_processorPool_p->enqueueEvent(event, d_processorHandle);
@@ -184,11 +188,25 @@ void Dispatcher_ClientExecutor::post(const bsl::function<void()>& f) const
 
     event->object()
         .setType(mqbi::DispatcherEventType::e_CALLBACK)
-        .setCallback(mqbi::Dispatcher::voidToProcessorFunctor(f))
+        .setVoidCallback(f)
         .setDestination(const_cast<mqbi::DispatcherClient*>(d_client_p));
 
     // submit the event
-    int rc = processorPool()->enqueueEvent(event, processorHandle());
+    mqba::Dispatcher* dispatcher = static_cast<mqba::Dispatcher*>(
+        d_client_p->dispatcher());
+    const Dispatcher::DispatcherContext& context = *dispatcher->d_contexts.at(
+        d_client_p->dispatcherClientData().clientType());
+    if (!context.d_stats.empty()) {
+        event->object().setEnqueueTime(bsls::TimeUtil::getTimer());
+    }
+
+    int rc = 0;
+    if (context.d_isWorkStealingEnabled) {
+        rc = dispatcher->routeEvent(&event->object(), d_client_p);
+    }
+    else {
+        rc = processorPool()->enqueueEvent(event, processorHandle());
+    }
     BSLS_ASSERT_OPT(rc == 0);
 
     // TODO: We should call 'releaseUnmanagedEvent' on the
@@ -216,6 +234,35 @@ void Dispatcher_ClientExecutor::dispatch(const bsl::function<void()>& f) const
     }
 }
 
+// --------------------------------
+// struct Dispatcher::ProcessorLoad
+// --------------------------------
+
+Dispatcher::ProcessorLoad::ProcessorLoad(bslma::Allocator* allocator)
+: d_busyTime(0)
+, d_clientTimes(allocator)
+, d_lastBusyTime(0)
+, d_lastClientTimes(allocator)
+, d_outgoingClient_p(0)
+, d_incomingClient_p(0)
+, d_pendingEvents(allocator)
+{
+    // NOTHING
+}
+
+Dispatcher::ProcessorLoad::ProcessorLoad(const ProcessorLoad& other,
+                                         bslma::Allocator*    allocator)
+: d_busyTime(other.d_busyTime)
+, d_clientTimes(other.d_clientTimes, allocator)
+, d_lastBusyTime(other.d_lastBusyTime)
+, d_lastClientTimes(other.d_lastClientTimes, allocator)
+, d_outgoingClient_p(other.d_outgoingClient_p)
+, d_incomingClient_p(other.d_incomingClient_p)
+, d_pendingEvents(other.d_pendingEvents, allocator)
+{
+    // NOTHING
+}
+
 // ------------------------------------
 // struct Dispatcher::DispatcherContext
 // ------------------------------------
@@ -226,11 +273,25 @@ Dispatcher::DispatcherContext::DispatcherContext(
 : d_threadPool_mp()
 , d_processorPool_mp()
 , d_loadBalancer(config.numProcessors(), allocator)
+, d_maxBatchSize(config.maxBatchSize())
+, d_numEventsSinceFlush(config.numProcessors(), 0, allocator)
 , d_flushList(config.numProcessors(),
               DispatcherClientPtrVector(allocator),
               allocator)
+, d_isLoadSampled(false)
+, d_isWorkStealingEnabled(false)
+, d_sampleInterval(0)
+, d_loads(allocator)
+, d_workStealingHandle()
+, d_isStealing(false)
+, d_routingEpoch(0)
+, d_stealableClientsMutex()
+, d_stealableClients(allocator)
+, d_numBroadcasts(0)
+, d_stats(allocator)
 {
-    // NOTHING
+    d_numRoutings[0] = 0;
+    d_numRoutings[1] = 0;
 }
 
 // ----------------
@@ -256,6 +317,24 @@ int Dispatcher::startContext(bsl::ostream&                    errorDescription,
                       DispatcherContext(config, d_allocator_p),
                   d_allocator_p);
 
+    if (config.workStealingIntervalMs() > 0 && config.numProcessors() > 1) {
+        context->d_isLoadSampled  = true;
+        context->d_sampleInterval =
+            bdlt::TimeUnitRatio::k_NANOSECONDS_PER_MILLISECOND *
+            config.workStealingIntervalMs();
+        context->d_loads.resize(config.numProcessors(),
+                                ProcessorLoad(d_allocator_p));
+
+        if (type == mqbi::DispatcherClientType::e_QUEUE) {
+            context->d_isWorkStealingEnabled = true;
+        }
+        else {
+            BALL_LOG_INFO << "Work stealing is only supported by the 'queues'"
+                          << " processors, the load of the '" << type
+                          << "' processors is only used to place new clients";
+        }
+    }
+
     // Create and start the threadPool
     context->d_threadPool_mp.load(
         new (*d_allocator_p)
@@ -298,9 +377,18 @@ int Dispatcher::startContext(bsl::ostream&                    errorDescription,
         .setFinalizeEvents(ProcessorPool::Config::MWCC_FINALIZE_MULTI_QUEUE)
         .setMonitorAlarm("ALARM [DISPATCHER_QUEUE_STUCK] ",
                          bsls::TimeInterval(k_QUEUE_STUCK_INTERVAL));
-    // TBD: .statContext(...) / .createSubcontext(true)
-    //      We should have subcontext per each type of event (PUSH, PUT,
-    //      CALLBACK, ACK, ...)
+
+    // Instrument the processors *before* starting them, since they read
+    // their statistics without synchronization.
+    if (d_statContext_p) {
+        context->d_stats.reserve(config.numProcessors());
+        for (int i = 0; i < config.numProcessors(); ++i) {
+            DispatcherStatsSp stats;
+            stats.createInplace(d_allocator_p, d_allocator_p);
+            stats->initialize(type, i, d_statContext_p);
+            context->d_stats.push_back(stats);
+        }
+    }
 
     context->d_processorPool_mp.load(
         new (*d_allocator_p) ProcessorPool(processorPoolConfig, d_allocator_p),
@@ -317,6 +405,16 @@ int Dispatcher::startContext(bsl::ostream&                    errorDescription,
         return rc_PROCESSOR_POOL_START_FAILED;  // RETURN
     }
 
+    if (context->d_isLoadSampled) {
+        d_scheduler_p->scheduleRecurringEvent(
+            &context->d_workStealingHandle,
+            bsls::TimeInterval().addMilliseconds(
+                config.workStealingIntervalMs()),
+            bdlf::BindUtil::bind(&Dispatcher::onWorkStealingTimer,
+                                 this,
+                                 type));
+    }
+
     return rc_SUCCESS;
 }
 
@@ -358,38 +456,58 @@ void Dispatcher::queueEventCb(mqbi::DispatcherClientType::Enum type,
     case ProcessorPool::Event::MWCC_USER: {
         BALL_LOG_TRACE << "Dispatching Event to queue " << processorId
                        << " of " << type << " dispatcher: " << event->object();
-        if (event->object().type() ==
-            mqbi::DispatcherEventType::e_DISPATCHER) {
-            const mqbi::DispatcherDispatcherEvent* realEvent =
-                event->object().asDispatcherEvent();
 
-            // We must flush now (and irrespective of a callback actually being
-            // set on the event) to ensure the flushList is empty before
-            // executing the callback: this dispatcher event may correspond to
-            // the destruction of the Client, and guaranteeing this client is
-            // not (and will not be added) to the flushList is actually the
-            // whole purpose of the 'e_DISPATCHER' event type.
-            flushClients(type, processorId);
+        DispatcherContext& dispatcherContext = *(d_contexts[type]);
+        mqbstat::DispatcherStats* stats =
+            dispatcherContext.d_stats.empty()
+                ? 0
+                : dispatcherContext.d_stats[processorId].get();
+        if (!dispatcherContext.d_isLoadSampled && !stats) {
+            processUserEvent(type, processorId, event->object());
+            break;  // BREAK
+        }
 
-            if (realEvent->callback()) {
-                // A callback may not have been set if all we wanted was to
-                // execute the 'finalizeCallback' of the event.
-                realEvent->callback()(processorId);
+        mqbi::DispatcherClient* destination = event->object().destination();
+        if (dispatcherContext.d_isLoadSampled) {
+            ProcessorLoad& load = dispatcherContext.d_loads[processorId];
+            if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                    destination != 0 &&
+                    (destination == load.d_outgoingClient_p ||
+                     destination == load.d_incomingClient_p))) {
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+                // The destination is being stolen: keep the event until its
+                // new processor can process it (see "Work stealing" in the
+                // component documentation).
+                DispatcherEventSp copy;
+                copy.createInplace(d_allocator_p, d_allocator_p);
+                *copy = event->object();
+                load.d_pendingEvents.push_back(copy);
+                break;  // BREAK
             }
         }
-        else {
-            DispatcherContext& dispatcherContext = *(d_contexts[type]);
-            event->object().destination()->onDispatcherEvent(event->object());
-            if (!event->object()
-                     .destination()
-                     ->dispatcherClientData()
-                     .addedToFlushList()) {
-                dispatcherContext.d_flushList[processorId].emplace_back(
-                    event->object().destination());
-                event->object()
-                    .destination()
-                    ->dispatcherClientData()
-                    .setAddedToFlushList(true);
+
+        const mqbi::DispatcherEventType::Enum eventType =
+            event->object().type();
+        const bsls::Types::Int64 enqueueTime = event->object().enqueueTime();
+
+        const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+        processUserEvent(type, processorId, event->object());
+        const bsls::Types::Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+        if (stats) {
+            stats->onEvent(eventType, elapsed);
+            if (enqueueTime != 0) {
+                stats->onQueueTime(start - enqueueTime);
+            }
+        }
+
+        if (dispatcherContext.d_isLoadSampled) {
+            ProcessorLoad& load = dispatcherContext.d_loads[processorId];
+            load.d_busyTime += elapsed;
+            if (destination != 0 &&
+                eventType != mqbi::DispatcherEventType::e_DISPATCHER) {
+                load.d_clientTimes[destination] += elapsed;
             }
         }
     } break;
@@ -414,12 +532,404 @@ void Dispatcher::queueEventCb(mqbi::DispatcherClientType::Enum type,
     }
 }
 
+void Dispatcher::processUserEvent(mqbi::DispatcherClientType::Enum type,
+                                  int                              processorId,
+                                  const mqbi::DispatcherEvent&     event)
+{
+    // executed by the *DISPATCHER* thread
+
+    if (event.type() == mqbi::DispatcherEventType::e_DISPATCHER) {
+        const mqbi::DispatcherDispatcherEvent* realEvent =
+            event.asDispatcherEvent();
+
+        // We must flush now (and irrespective of a callback actually being
+        // set on the event) to ensure the flushList is empty before executing
+        // the callback: this dispatcher event may correspond to the
+        // destruction of the Client, and guaranteeing this client is not (and
+        // will not be added) to the flushList is actually the whole purpose of
+        // the 'e_DISPATCHER' event type.
+        flushClients(type, processorId);
+
+        if (realEvent->hasCallback()) {
+            // A callback may not have been set if all we wanted was to
+            // execute the 'finalizeCallback' of the event.
+            realEvent->invokeCallback(processorId);
+        }
+    }
+    else {
+        DispatcherContext& dispatcherContext = *(d_contexts[type]);
+        event.destination()->onDispatcherEvent(event);
+        if (!event.destination()->dispatcherClientData().addedToFlushList()) {
+            dispatcherContext.d_flushList[processorId].emplace_back(
+                event.destination());
+            event.destination()->dispatcherClientData().setAddedToFlushList(
+                true);
+        }
+
+        if (dispatcherContext.d_maxBatchSize > 0 &&
+            ++dispatcherContext.d_numEventsSinceFlush[processorId] >=
+                dispatcherContext.d_maxBatchSize) {
+            // End of the batch, even though more events may be pending
+            flushClients(type, processorId);
+        }
+    }
+}
+
+int Dispatcher::routeEvent(mqbi::DispatcherEvent*        event,
+                           const mqbi::DispatcherClient* client)
+{
+    DispatcherContext& context =
+        *(d_contexts[client->dispatcherClientData().clientType()]);
+
+    // Register this event in the current routing epoch, *before* reading the
+    // processor of the client: a move of the client starts a new epoch after
+    // updating its processor, and waits for all the events of the previous
+    // epoch to be enqueued before completing.
+    int epoch = context.d_routingEpoch.load();
+    while (true) {
+        context.d_numRoutings[epoch & 1].add(1);
+        const int currentEpoch = context.d_routingEpoch.load();
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(currentEpoch == epoch)) {
+            break;  // BREAK
+        }
+        context.d_numRoutings[epoch & 1].add(-1);
+        epoch = currentEpoch;
+    }
+
+    if (!context.d_stats.empty() && event->enqueueTime() == 0) {
+        event->setEnqueueTime(bsls::TimeUtil::getTimer());
+    }
+
+    const int rc = context.d_processorPool_mp->enqueueEvent(
+        event,
+        client->dispatcherClientData().processorHandle());
+
+    context.d_numRoutings[epoch & 1].add(-1);
+
+    return rc;
+}
+
+void Dispatcher::enqueueCallback(
+    mqbi::DispatcherClientType::Enum          type,
+    int                                       processorId,
+    const mqbi::Dispatcher::ProcessorFunctor& callback)
+{
+    mqbi::DispatcherEvent* event = getEvent(type);
+    (*event)
+        .setType(mqbi::DispatcherEventType::e_DISPATCHER)
+        .setCallback(callback);
+    dispatchEvent(event, type, processorId);
+}
+
+void Dispatcher::onWorkStealingTimer(mqbi::DispatcherClientType::Enum type)
+{
+    // executed by the *SCHEDULER* thread
+
+    DispatcherContext& context = *(d_contexts[type]);
+    if (context.d_isStealing.testAndSwap(false, true)) {
+        // The previous sample, or the move of a client, is still in progress
+        return;  // RETURN
+    }
+
+    execute(bdlf::BindUtil::bind(&Dispatcher::sampleLoad,
+                                 this,
+                                 type,
+                                 bdlf::PlaceHolders::_1),  // processor
+            type,
+            bdlf::BindUtil::bind(&Dispatcher::balanceLoad, this, type));
+}
+
+void Dispatcher::sampleLoad(mqbi::DispatcherClientType::Enum type,
+                            int                              processorId)
+{
+    // executed by the *DISPATCHER* thread
+
+    ProcessorLoad& load = d_contexts[type]->d_loads[processorId];
+
+    load.d_lastBusyTime = load.d_busyTime;
+    load.d_busyTime     = 0;
+    load.d_lastClientTimes.swap(load.d_clientTimes);
+    load.d_clientTimes.clear();
+}
+
+void Dispatcher::balanceLoad(mqbi::DispatcherClientType::Enum type)
+{
+    // executed by the *DISPATCHER* thread, once all processors were sampled
+
+    DispatcherContext& context = *(d_contexts[type]);
+
+    for (int i = 0; i < static_cast<int>(context.d_loads.size()); ++i) {
+        context.d_loadBalancer.setProcessorLoad(
+            i,
+            context.d_loads[i].d_lastBusyTime);
+    }
+
+    if (!context.d_isWorkStealingEnabled) {
+        context.d_isStealing = false;
+        return;  // RETURN
+    }
+
+    int busiest = 0;
+    int idlest  = 0;
+    for (int i = 1; i < static_cast<int>(context.d_loads.size()); ++i) {
+        if (context.d_loads[i].d_lastBusyTime >
+            context.d_loads[busiest].d_lastBusyTime) {
+            busiest = i;
+        }
+        if (context.d_loads[i].d_lastBusyTime <
+            context.d_loads[idlest].d_lastBusyTime) {
+            idlest = i;
+        }
+    }
+
+    const bsls::Types::Int64 interval = context.d_sampleInterval;
+    const bsls::Types::Int64 busyTime =
+        context.d_loads[busiest].d_lastBusyTime;
+    const bsls::Types::Int64 idleTime = context.d_loads[idlest].d_lastBusyTime;
+
+    if (busyTime * 100 < interval * k_WORK_STEALING_MIN_BUSY_PERCENT ||
+        idleTime * 2 > busyTime) {
+        // The busiest processor is not overloaded, or the load is already
+        // balanced enough.
+        context.d_isStealing = false;
+        return;  // RETURN
+    }
+
+    // Find the client whose move makes the load of both processors the
+    // closest, i.e. whose time is the closest to half the gap between them.
+    const bsls::Types::Int64 gap      = busyTime - idleTime;
+    mqbi::DispatcherClient*  client   = 0;
+    bsls::Types::Int64       distance = gap;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(
+            &context.d_stealableClientsMutex);  // LOCKED
+
+        const ClientTimesMap& times =
+            context.d_loads[busiest].d_lastClientTimes;
+        for (ClientTimesMap::const_iterator it = times.begin();
+             it != times.end();
+             ++it) {
+            if (it->second <= 0 || it->second >= gap ||
+                context.d_stealableClients.find(it->first) ==
+                    context.d_stealableClients.end()) {
+                continue;  // CONTINUE
+            }
+
+            bsls::Types::Int64 current = 2 * it->second - gap;
+            if (current < 0) {
+                current = -current;
+            }
+            if (current < distance) {
+                distance = current;
+                client   = it->first;
+            }
+        }
+
+        if (client == 0) {
+            context.d_isStealing = false;
+            return;  // RETURN
+        }
+
+        BALL_LOG_INFO << "Processor " << idlest << " of " << type
+                      << " dispatcher (busy " << idleTime << " ns) steals '"
+                      << client->description() << "' (busy "
+                      << times.find(client)->second << " ns) from processor "
+                      << busiest << " (busy " << busyTime << " ns)";
+    }
+
+    // Hold the events of the client on its new processor *before* moving it,
+    // so that they are only processed once all the events enqueued to its
+    // previous processor have been.
+    enqueueCallback(type,
+                    idlest,
+                    bdlf::BindUtil::bind(&Dispatcher::onMigrationHold,
+                                         this,
+                                         type,
+                                         client,
+                                         bdlf::PlaceHolders::_1));
+    enqueueCallback(type,
+                    busiest,
+                    bdlf::BindUtil::bind(&Dispatcher::onMigrationSwitch,
+                                         this,
+                                         type,
+                                         client,
+                                         idlest,
+                                         bdlf::PlaceHolders::_1));
+}
+
+void Dispatcher::onMigrationHold(mqbi::DispatcherClientType::Enum type,
+                                 mqbi::DispatcherClient*          client,
+                                 int                              processorId)
+{
+    // executed by the *DISPATCHER* thread
+
+    ProcessorLoad& load = d_contexts[type]->d_loads[processorId];
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(load.d_incomingClient_p == 0);
+    BSLS_ASSERT_SAFE(load.d_pendingEvents.empty());
+
+    load.d_incomingClient_p = client;
+}
+
+void Dispatcher::onBroadcastDone(
+    mqbi::DispatcherClientType::Enum     type,
+    const mqbi::Dispatcher::VoidFunctor& doneCallback)
+{
+    // executed by the *DISPATCHER* thread
+
+    DispatcherContext& context = *(d_contexts[type]);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(
+            &context.d_stealableClientsMutex);  // LOCKED
+
+        BSLS_ASSERT_SAFE(context.d_numBroadcasts > 0);
+        --context.d_numBroadcasts;
+    }
+
+    if (doneCallback) {
+        doneCallback();
+    }
+}
+
+void Dispatcher::onMigrationSwitch(
+    mqbi::DispatcherClientType::Enum type,
+    mqbi::DispatcherClient*          client,
+    int                              target,
+    int                              processorId)
+{
+    // executed by the *DISPATCHER* thread
+
+    DispatcherContext& context = *(d_contexts[type]);
+
+    // The client must not be left in the flush list of this processor.
+    flushClients(type, processorId);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(
+            &context.d_stealableClientsMutex);  // LOCKED
+
+        if (context.d_stealableClients.find(client) ==
+                context.d_stealableClients.end() ||
+            client->dispatcherClientData().processorHandle() != processorId ||
+            context.d_numBroadcasts != 0) {
+            // The client was unregistered in the meantime, or the processors
+            // are processing an event selecting the clients by processor
+            // (such as a domain purge), which would skip or visit twice a
+            // client moving meanwhile: release the (empty) held events of the
+            // target processor.
+            enqueueCallback(
+                type,
+                target,
+                bdlf::BindUtil::bind(&Dispatcher::onMigrationRelease,
+                                     this,
+                                     type,
+                                     client,
+                                     DispatcherEventSpVector(d_allocator_p),
+                                     bdlf::PlaceHolders::_1));
+            return;  // RETURN
+        }
+
+        context.d_loadBalancer.removeClient(client);
+        context.d_loadBalancer.setProcessorForClient(client, target);
+        client->dispatcherClientData().migrateProcessorHandle(target);
+    }
+
+    context.d_loads[processorId].d_outgoingClient_p = client;
+
+    // Start a new routing epoch: the events routed from now on are enqueued
+    // to the target processor.
+    const int epoch = context.d_routingEpoch.add(1) - 1;
+
+    onMigrationDrain(type, client, target, epoch, false, processorId);
+}
+
+void Dispatcher::onMigrationDrain(mqbi::DispatcherClientType::Enum type,
+                                  mqbi::DispatcherClient*          client,
+                                  int                              target,
+                                  int                              epoch,
+                                  bool                             isDrained,
+                                  int                              processorId)
+{
+    // executed by the *DISPATCHER* thread
+
+    DispatcherContext& context = *(d_contexts[type]);
+
+    if (!isDrained) {
+        // Once all the events routed during 'epoch' have been enqueued,
+        // enqueue ourself one last time, behind them.
+        enqueueCallback(type,
+                        processorId,
+                        bdlf::BindUtil::bind(
+                            &Dispatcher::onMigrationDrain,
+                            this,
+                            type,
+                            client,
+                            target,
+                            epoch,
+                            context.d_numRoutings[epoch & 1].load() == 0,
+                            bdlf::PlaceHolders::_1));
+        return;  // RETURN
+    }
+
+    ProcessorLoad&          load = context.d_loads[processorId];
+    DispatcherEventSpVector stashedEvents(d_allocator_p);
+    stashedEvents.swap(load.d_pendingEvents);
+    load.d_outgoingClient_p = 0;
+
+    enqueueCallback(type,
+                    target,
+                    bdlf::BindUtil::bind(&Dispatcher::onMigrationRelease,
+                                         this,
+                                         type,
+                                         client,
+                                         stashedEvents,
+                                         bdlf::PlaceHolders::_1));
+}
+
+void Dispatcher::onMigrationRelease(
+    mqbi::DispatcherClientType::Enum type,
+    BSLS_ANNOTATION_UNUSED mqbi::DispatcherClient* client,
+    const DispatcherEventSpVector&                 stashedEvents,
+    int                                            processorId)
+{
+    // executed by the *DISPATCHER* thread
+
+    DispatcherContext& context = *(d_contexts[type]);
+    ProcessorLoad&     load    = context.d_loads[processorId];
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(load.d_incomingClient_p == client);
+
+    DispatcherEventSpVector heldEvents(d_allocator_p);
+    heldEvents.swap(load.d_pendingEvents);
+    load.d_incomingClient_p = 0;
+
+    onNewClient(type, processorId);
+
+    for (size_t i = 0; i < stashedEvents.size(); ++i) {
+        processUserEvent(type, processorId, *stashedEvents[i]);
+    }
+    for (size_t i = 0; i < heldEvents.size(); ++i) {
+        processUserEvent(type, processorId, *heldEvents[i]);
+    }
+
+    context.d_isStealing = false;
+}
+
 void Dispatcher::flushClients(mqbi::DispatcherClientType::Enum type,
                               int                              processorId)
 {
     // executed by the *DISPATCHER* thread
 
     DispatcherContext& context = *(d_contexts[type]);
+    if (!context.d_stats.empty() &&
+        !context.d_flushList[processorId].empty()) {
+        context.d_stats[processorId]->onFlush();
+    }
+
     for (size_t i = 0; i < context.d_flushList[processorId].size(); ++i) {
         context.d_flushList[processorId][i]->flush();
         context.d_flushList[processorId][i]
@@ -427,6 +937,7 @@ void Dispatcher::flushClients(mqbi::DispatcherClientType::Enum type,
             .setAddedToFlushList(false);
     }
     context.d_flushList[processorId].clear();
+    context.d_numEventsSinceFlush[processorId] = 0;
 }
 
 void Dispatcher::onNewClient(mqbi::DispatcherClientType::Enum type,
@@ -446,14 +957,73 @@ void Dispatcher::onNewClient(mqbi::DispatcherClientType::Enum type,
     }
 }
 
+void Dispatcher::bindProcessorThread(
+    mqbi::DispatcherClientType::Enum         type,
+    const mqbcfg::DispatcherProcessorConfig& config,
+    int                                      processorId)
+{
+    // executed by the *DISPATCHER* thread
+
+    int rc = 0;
+    if (config.numaNodes() > 0) {
+        const int        node = processorId % config.numaNodes();
+        bsl::vector<int> cpus(d_allocator_p);
+        rc = mwcsys::ThreadUtil::loadNumaNodeCpus(&cpus, node);
+        if (rc == 0) {
+            rc = mwcsys::ThreadUtil::setCurrentThreadCpuSet(cpus);
+        }
+
+        if (rc != 0) {
+            BALL_LOG_WARN << "Failed to bind processor " << processorId
+                          << " of " << type << " dispatcher to NUMA node "
+                          << node << " [rc: " << rc << "]";
+            return;  // RETURN
+        }
+
+        BALL_LOG_INFO << "Bound processor " << processorId << " of " << type
+                      << " dispatcher to NUMA node " << node << " ("
+                      << cpus.size() << " CPUs)";
+        return;  // RETURN
+    }
+
+    const int cpu = config.firstCpu() + processorId;
+    rc            = mwcsys::ThreadUtil::setCurrentThreadAffinity(cpu);
+    if (rc != 0) {
+        BALL_LOG_WARN << "Failed to bind processor " << processorId << " of "
+                      << type << " dispatcher to CPU " << cpu
+                      << " [rc: " << rc << "]";
+        return;  // RETURN
+    }
+
+    BALL_LOG_INFO << "Bound processor " << processorId << " of " << type
+                  << " dispatcher to CPU " << cpu;
+}
+
+Dispatcher::Dispatcher(const mqbcfg::DispatcherConfig& config,
+                       bdlmt::EventScheduler*          scheduler,
+                       bslma::Allocator*               allocator)
+: d_allocator_p(allocator)
+, d_isStarted(false)
+, d_config(config)
+, d_scheduler_p(scheduler)
+, d_contexts(allocator)
+, d_statContext_p(0)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(scheduler->clockType() ==
+                     bsls::SystemClockType::e_MONOTONIC);
+}
+
 Dispatcher::Dispatcher(const mqbcfg::DispatcherConfig& config,
                        bdlmt::EventScheduler*          scheduler,
+                       mwcst::StatContext*             statContext,
                        bslma::Allocator*               allocator)
 : d_allocator_p(allocator)
 , d_isStarted(false)
 , d_config(config)
 , d_scheduler_p(scheduler)
 , d_contexts(allocator)
+, d_statContext_p(statContext)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(scheduler->clockType() ==
@@ -515,6 +1085,32 @@ int Dispatcher::start(bsl::ostream& errorDescription)
                 mqbi::DispatcherClientType::e_CLUSTER);
     }
 
+    // Bind the processors threads, if requested
+    const mqbcfg::DispatcherProcessorConfig* configs[] = {
+        &d_config.sessions(),
+        &d_config.queues(),
+        &d_config.clusters()};
+    for (int i = 0; i < mqbi::DispatcherClientType::k_COUNT; ++i) {
+        if (configs[i]->numaNodes() <= 0 && configs[i]->firstCpu() < 0) {
+            continue;  // CONTINUE
+        }
+
+        if (!mwcsys::ThreadUtil::k_SUPPORT_THREAD_AFFINITY) {
+            BALL_LOG_WARN << "Ignoring the thread placement of the '"
+                          << static_cast<mqbi::DispatcherClientType::Enum>(i)
+                          << "' processors, not supported on this platform";
+            continue;  // CONTINUE
+        }
+
+        execute(bdlf::BindUtil::bind(
+                    &Dispatcher::bindProcessorThread,
+                    this,
+                    static_cast<mqbi::DispatcherClientType::Enum>(i),
+                    *configs[i],
+                    bdlf::PlaceHolders::_1),  // processor
+                static_cast<mqbi::DispatcherClientType::Enum>(i));
+    }
+
     d_isStarted = true;
 
     return 0;
@@ -536,6 +1132,19 @@ void Dispatcher::stop()
 
     DispatcherContext* context = 0;
 
+    // Stop sampling the load of the processors
+    for (size_t i = 0; i < d_contexts.size(); ++i) {
+        context = d_contexts[i].get();
+        if (context && context->d_isLoadSampled) {
+            d_scheduler_p->cancelEventAndWait(&context->d_workStealingHandle);
+
+            // Let the sample, or the move of a client, in progress complete
+            while (context->d_isStealing) {
+                bslmt::ThreadUtil::yield();
+            }
+        }
+    }
+
     // Shutdown the queue dispatcher before the session one
     // After the application stops and invalidates sessions, they are not
     // source of events for queues anymore.  The reverse is not true, a queue
@@ -571,6 +1180,12 @@ Dispatcher::registerClient(mqbi::DispatcherClient*           client,
         int processor = static_cast<int>(handle);
         if (handle == mqbi::Dispatcher::k_INVALID_PROCESSOR_HANDLE) {
             processor = context.d_loadBalancer.getProcessorForClient(client);
+
+            if (context.d_isWorkStealingEnabled) {
+                bslmt::LockGuard<bslmt::Mutex> guard(
+                    &context.d_stealableClientsMutex);  // LOCKED
+                context.d_stealableClients.insert(client);
+            }
         }
         else {
             context.d_loadBalancer.setProcessorForClient(client, processor);
@@ -600,6 +1215,9 @@ Dispatcher::registerClient(mqbi::DispatcherClient*           client,
                                      type,
                                      bdlf::PlaceHolders::_1))  // processor
             .setDestination(client);                           // not needed
+        if (!context.d_stats.empty()) {
+            event->setEnqueueTime(bsls::TimeUtil::getTimer());
+        }
         context.d_processorPool_mp->enqueueEvent(event, processor);
         return processor;  // RETURN
     }                      // break;
@@ -625,7 +1243,17 @@ void Dispatcher::unregisterClient(mqbi::DispatcherClient* client)
     case mqbi::DispatcherClientType::e_SESSION:
     case mqbi::DispatcherClientType::e_QUEUE:
     case mqbi::DispatcherClientType::e_CLUSTER: {
-        d_contexts[type]->d_loadBalancer.removeClient(client);
+        DispatcherContext& context = *(d_contexts[type]);
+        if (context.d_isWorkStealingEnabled) {
+            // Prevent a concurrent move of the client to another processor
+            bslmt::LockGuard<bslmt::Mutex> guard(
+                &context.d_stealableClientsMutex);  // LOCKED
+            context.d_stealableClients.erase(client);
+            context.d_loadBalancer.removeClient(client);
+        }
+        else {
+            context.d_loadBalancer.removeClient(client);
+        }
     } break;
     case mqbi::DispatcherClientType::e_UNDEFINED:
     case mqbi::DispatcherClientType::e_ALL:
@@ -688,11 +1316,29 @@ void Dispatcher::execute(const mqbi::Dispatcher::ProcessorFunctor& functor,
 
     for (size_t i = 0; i < mqbi::DispatcherClientType::k_COUNT; ++i) {
         if (processorPool[i] != 0) {
+            mqbi::Dispatcher::VoidFunctor finalizeCallback(doneCallback);
+            if (d_contexts[i]->d_isWorkStealingEnabled) {
+                // Keep the clients from moving until all the processors
+                // have processed the event (see 'onMigrationSwitch').
+                bslmt::LockGuard<bslmt::Mutex> guard(
+                    &d_contexts[i]->d_stealableClientsMutex);  // LOCKED
+
+                ++d_contexts[i]->d_numBroadcasts;
+                finalizeCallback = bdlf::BindUtil::bind(
+                    &Dispatcher::onBroadcastDone,
+                    this,
+                    static_cast<mqbi::DispatcherClientType::Enum>(i),
+                    doneCallback);
+            }
+
             mqbi::DispatcherEvent* qEvent =
                 &processorPool[i]->getUnmanagedEvent()->object();
             qEvent->setType(mqbi::DispatcherEventType::e_DISPATCHER)
                 .setCallback(functor)
-                .setFinalizeCallback(doneCallback);
+                .setFinalizeCallback(finalizeCallback);
+            if (!d_contexts[i]->d_stats.empty()) {
+                qEvent->setEnqueueTime(bsls::TimeUtil::getTimer());
+            }
             processorPool[i]->enqueueEventOnAllQueues(qEvent);
         }
     }
@@ -700,8 +1346,23 @@ void Dispatcher::execute(const mqbi::Dispatcher::ProcessorFunctor& functor,
 
 void Dispatcher::synchronize(mqbi::DispatcherClient* client)
 {
-    synchronize(client->dispatcherClientData().clientType(),
-                client->dispatcherClientData().processorHandle());
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!inDispatcherThread(client));  // Deadlock detection
+
+    typedef void (bslmt::Semaphore::*PostFn)();
+
+    // Target the client (and not only its processor), so that the event is
+    // processed after all the events previously enqueued to the client, even
+    // if it is being stolen by another processor.
+    bslmt::Semaphore       semaphore;
+    mqbi::DispatcherEvent* event = getEvent(client);
+    (*event)
+        .setType(mqbi::DispatcherEventType::e_DISPATCHER)
+        .setCallback(
+            bdlf::BindUtil::bind(static_cast<PostFn>(&bslmt::Semaphore::post),
+                                 &semaphore));
+    dispatchEvent(event, client);
+    semaphore.wait();
 }
 
 void Dispatcher::synchronize(mqbi::DispatcherClientType::Enum  type,
@@ -47,37 +47,117 @@
 // the submitted functor to be executed in-place.  A call to 'dispatch' from
 // outside of the executor's associated processor thread is equivalent to a
 // call to 'post'.
+//
+/// Flushing
+///--------
+// Clients receiving events (other than 'e_DISPATCHER' events) are added to
+// the flush list of their processor, and their 'flush' method is invoked
+// once the processor has no more events to process, or before processing an
+// 'e_DISPATCHER' event, so that the output generated by consecutive events is
+// coalesced (e.g., into a single 'PUSH' or 'ACK' event written to a channel).
+// Under high load, the queue of a processor may never become empty: if the
+// 'maxBatchSize' of a processors configuration is not 0, the processor also
+// flushes its clients once it processed that many events since the last
+// flush, bounding the latency added by the coalescing.
+//
+/// Thread placement
+///----------------
+// By default, the threads of the processors are scheduled by the operating
+// system on any CPU.  If the 'numaNodes' of a processors configuration is not
+// 0, the thread of the processor having the index 'i' is bound to the CPUs of
+// the NUMA node 'i % numaNodes'.  Otherwise, if its 'firstCpu' is not -1, the
+// thread of the processor having the index 'i' is bound to the CPU
+// 'firstCpu + i'.  Since the partitions of a cluster are assigned in a
+// round-robin manner to the 'queues' processors (see 'mqbc::StorageUtil'),
+// binding the 'queues' processors to the NUMA nodes keeps each partition, and
+// the memory first touched by its processor (such as the blob buffers it
+// allocates), on the same node.  Thread placement is only supported on Linux;
+// failing to bind a thread is logged and is not fatal.
+//
+/// Work stealing
+///-------------
+// Clients are statically assigned to a processor when they are registered,
+// so that a few busy clients may saturate a processor while the other ones
+// are idle.  If the 'workStealingIntervalMs' of the 'queues' processors
+// configuration is not 0, the dispatcher samples, every such interval, the
+// time each processor spent processing events.  If the busiest processor was
+// busy more than 'k_WORK_STEALING_MIN_BUSY_PERCENT' percent of the interval
+// and the least busy one less than half of it, the least busy processor
+// steals from the busiest one the client whose move best evens their loads,
+// and the client is rebound to it in the load balancer.  Only the clients
+// registered without an explicit processor handle can be stolen; the other
+// ones (e.g., the queues bound to the processor of their partition) never
+// move.  Work stealing is not supported for the 'sessions' and 'clusters'
+// processors.
+//
+// The sampled time of each processor is also reported to the load balancer
+// of its processors (see 'mqbu::LoadBalancer'), so that new clients are
+// registered to the least loaded processor rather than to the one having the
+// fewest clients.  This load-aware placement is enabled for any type of
+// processors having a non-zero 'workStealingIntervalMs'.
+//
+// A stolen client keeps the ordering of its events, and is never executed by
+// two processors at the same time: the events enqueued to its previous
+// processor after the move (by threads having read the previous processor
+// handle of the client) are stashed by that processor, the events enqueued to
+// its new processor are held by it, and once no event can be enqueued to the
+// previous processor anymore, the new processor replays the stashed events
+// and then the held ones.  This is only guaranteed for the events sent to the
+// client itself ('dispatchEvent' with a destination, 'execute' with a client,
+// 'synchronize' with a client, and the executors returned by
+// 'clientExecutor').  Note that the executors returned by 'executor' keep
+// referring to the processor the client was assigned to when they were
+// created.
+//
+/// Instrumentation
+///---------------
+// If the dispatcher is created with a stat context (see
+// 'mqbstat::DispatcherStats'), each processor keeps track, per type of event,
+// of the number of events it processed and of the distribution of the time it
+// spent processing them, of the time the events waited in its queue, and of
+// the number of times it flushed clients.  These statistics are printed with
+// the other statistics of the broker (e.g., in response to the 'STAT SHOW'
+// command), and published to the stat consumers.  Keeping them costs, per
+// event, reading the timer when the event is enqueued and around its
+// processing (the latter being shared with the sampling of the load of the
+// processors, see "Work stealing"), and a few relaxed atomic updates.  Note
+// that the events submitted through the executors returned by 'executor' are
+// not timestamped, so that the time they waited in the queue is not recorded.
 
 // MQB
 
 #include <mqbcfg_messages.h>
 #include <mqbi_dispatcher.h>
+#include <mqbstat_dispatcherstats.h>
 #include <mqbu_loadbalancer.h>
 
 // MWC
 #include <mwcc_multiqueuethreadpool.h>
 #include <mwcex_executor.h>
+#include <mwcst_statcontext.h>
 
 // BDE
 #include <ball_log.h>
+#include <bdlmt_eventscheduler.h>
 #include <bdlmt_threadpool.h>
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
+#include <bsl_unordered_map.h>
+#include <bsl_unordered_set.h>
 #include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_mutex.h>
 #include <bslmt_threadutil.h>
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 
-// FORWARD DECLARATION
-namespace bdlmt {
-class EventScheduler;
-}
-
 namespace mqba {
 
 // FORWARD DECLARATION
@@ -99,6 +179,10 @@ class Dispatcher;
 /// Note also that this executor can be used to submit work event after the
 /// dispatcher client used to initialize the executor has been unregistered
 /// from the executor's associated dispatcher.
+///
+/// Note also that this executor keeps referring to the same processor if its
+/// associated client is stolen by another processor (see "Work stealing" in
+/// the component documentation).
 class Dispatcher_Executor {
   private:
     // PRIVATE DATA
@@ -222,6 +306,70 @@ class Dispatcher BSLS_CPP11_FINAL : public mqbi::Dispatcher {
 
     typedef bsl::vector<mqbi::DispatcherClient*> DispatcherClientPtrVector;
 
+    typedef bsl::shared_ptr<mqbi::DispatcherEvent> DispatcherEventSp;
+
+    typedef bsl::vector<DispatcherEventSp> DispatcherEventSpVector;
+
+    /// Map of a client to the time (in nanoseconds) spent processing its
+    /// events.
+    typedef bsl::unordered_map<mqbi::DispatcherClient*, bsls::Types::Int64>
+        ClientTimesMap;
+
+    typedef bsl::unordered_set<mqbi::DispatcherClient*> ClientSet;
+
+    typedef bsl::shared_ptr<mqbstat::DispatcherStats> DispatcherStatsSp;
+
+    /// Load of a processor, and state of the migration of a stolen client
+    /// from or to it.  This is only manipulated from the thread of the
+    /// processor, except for the `d_last...` members which are read once
+    /// all the processors have been sampled.
+    struct ProcessorLoad {
+        // PUBLIC DATA
+        bsls::Types::Int64 d_busyTime;
+        // Time spent processing events since the
+        // last sample, in nanoseconds
+
+        ClientTimesMap d_clientTimes;
+        // Time spent processing the events of
+        // each client since the last sample
+
+        bsls::Types::Int64 d_lastBusyTime;
+        // Value of 'd_busyTime' at the last
+        // sample
+
+        ClientTimesMap d_lastClientTimes;
+        // Value of 'd_clientTimes' at the last
+        // sample
+
+        mqbi::DispatcherClient* d_outgoingClient_p;
+        // Client being stolen from this
+        // processor, if any, whose events are
+        // stashed in 'd_pendingEvents'
+
+        mqbi::DispatcherClient* d_incomingClient_p;
+        // Client being stolen by this processor,
+        // if any, whose events are held in
+        // 'd_pendingEvents'
+
+        DispatcherEventSpVector d_pendingEvents;
+        // Events stashed or held for the client
+        // being stolen
+
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(ProcessorLoad,
+                                       bslma::UsesBslmaAllocator)
+
+        // CREATORS
+
+        /// Create a new object using the specified `allocator`.
+        explicit ProcessorLoad(bslma::Allocator* allocator);
+
+        /// Create a new object having the value of the specified `other`,
+        /// using the specified `allocator`.
+        ProcessorLoad(const ProcessorLoad& other,
+                      bslma::Allocator*    allocator);
+    };
+
     /// Context for a dispatcher, with threads and pools
     struct DispatcherContext {
       private:
@@ -245,6 +393,19 @@ class Dispatcher BSLS_CPP11_FINAL : public mqbi::Dispatcher {
         // for distributing clients
         // across processors
 
+        int d_maxBatchSize;
+        // Maximum number of events
+        // processed by a processor
+        // between two flushes of its
+        // clients, or 0 for
+        // unbounded
+
+        bsl::vector<int> d_numEventsSinceFlush;
+        // Number of events
+        // processed by each
+        // processor since the last
+        // flush of its clients
+
         bsl::vector<DispatcherClientPtrVector> d_flushList;
         // Vector of vector of
         // pointers to
@@ -256,6 +417,72 @@ class Dispatcher BSLS_CPP11_FINAL : public mqbi::Dispatcher {
         // corresponds to the
         // processor.
 
+        bool d_isLoadSampled;
+        // Whether the load of the processors
+        // of this context is periodically
+        // sampled
+
+        bool d_isWorkStealingEnabled;
+        // Whether the processors of this
+        // context steal clients from each
+        // other
+
+        bsls::Types::Int64 d_sampleInterval;
+        // Interval between two samples of the
+        // load of the processors, in
+        // nanoseconds
+
+        bsl::vector<ProcessorLoad> d_loads;
+        // Load of each processor, only
+        // maintained if 'd_isLoadSampled'
+
+        bdlmt::EventScheduler::RecurringEventHandle d_workStealingHandle;
+        // Handle of the recurring event
+        // sampling the load of the
+        // processors
+
+        bsls::AtomicBool d_isStealing;
+        // Whether a sample of the load of the
+        // processors, or a migration of a
+        // stolen client, is in progress
+
+        bsls::AtomicInt d_routingEpoch;
+        // Epoch of the events being routed to
+        // a client, incremented whenever a
+        // client is moved to another
+        // processor
+
+        bsls::AtomicInt d_numRoutings[2];
+        // Number of events being routed to a
+        // client at each epoch (indexed by the
+        // parity of the epoch)
+
+        bslmt::Mutex d_stealableClientsMutex;
+        // Mutex protecting
+        // 'd_stealableClients',
+        // 'd_numBroadcasts', and the move of
+        // one of them to another processor
+
+        ClientSet d_stealableClients;
+        // Clients which can be stolen, i.e.,
+        // which were registered without an
+        // explicit processor handle
+
+        int d_numBroadcasts;
+        // Number of events enqueued to all the
+        // processors which have not been
+        // processed by all of them yet, only
+        // maintained if
+        // 'd_isWorkStealingEnabled'.  No
+        // client is moved while non-zero, so
+        // that each processor observes the
+        // same clients bound to it
+
+        bsl::vector<DispatcherStatsSp> d_stats;
+        // Statistics of each processor, empty
+        // if the dispatcher is not
+        // instrumented
+
         // TRAITS
         BSLMF_NESTED_TRAIT_DECLARATION(DispatcherContext,
                                        bslma::UsesBslmaAllocator)
@@ -293,6 +520,20 @@ class Dispatcher BSLS_CPP11_FINAL : public mqbi::Dispatcher {
     // The various context, one for each
     // ClientType
 
+    mwcst::StatContext* d_statContext_p;
+    // Dispatcher stat context under which
+    // the statistics of the processors
+    // are kept, or null if the dispatcher
+    // is not instrumented
+
+  public:
+    // PUBLIC CONSTANTS
+    static const int k_WORK_STEALING_MIN_BUSY_PERCENT = 50;
+    // Percentage of the sampling interval the
+    // busiest processor must have been busy
+    // for a client to be stolen from it
+
+  private:
     // FRIENDS
     friend class Dispatcher_ClientExecutor;
     friend class Dispatcher_Executor;
@@ -338,6 +579,95 @@ class Dispatcher BSLS_CPP11_FINAL : public mqbi::Dispatcher {
     /// client that is mapped to the specified `processorId`.
     void onNewClient(mqbi::DispatcherClientType::Enum type, int processorId);
 
+    /// Bind the thread of the processor having the specified `processorId`
+    /// of clients of the specified `type` to the CPUs resulting from the
+    /// specified `config` (see "Thread placement" in the component
+    /// documentation).
+    void bindProcessorThread(mqbi::DispatcherClientType::Enum         type,
+                             const mqbcfg::DispatcherProcessorConfig& config,
+                             int processorId);
+
+    /// Process the specified user `event` for clients of the specified
+    /// `type` on the processor having the specified `processorId`.
+    void processUserEvent(mqbi::DispatcherClientType::Enum type,
+                          int                              processorId,
+                          const mqbi::DispatcherEvent&     event);
+
+    /// Enqueue the specified `event` to the processor in charge of the
+    /// specified `client`, whose processors steal clients from each other,
+    /// and return the result of the enqueue operation.  A concurrent move
+    /// of `client` to another processor waits for `event` to be enqueued
+    /// before completing.
+    int routeEvent(mqbi::DispatcherEvent*        event,
+                   const mqbi::DispatcherClient* client);
+
+    /// Enqueue, to the processor having the specified `processorId` of the
+    /// clients of the specified `type`, an event invoking the specified
+    /// `callback`.
+    void enqueueCallback(mqbi::DispatcherClientType::Enum          type,
+                         int                                       processorId,
+                         const mqbi::Dispatcher::ProcessorFunctor& callback);
+
+    /// Invoked by the scheduler every work stealing interval of the
+    /// processors of clients of the specified `type`, to sample their load.
+    void onWorkStealingTimer(mqbi::DispatcherClientType::Enum type);
+
+    /// Record, as the last sample of the processor having the specified
+    /// `processorId` of clients of the specified `type`, its load since the
+    /// previous sample.
+    void sampleLoad(mqbi::DispatcherClientType::Enum type, int processorId);
+
+    /// Once all the processors of clients of the specified `type` have been
+    /// sampled, report their load to the load balancer and, if work
+    /// stealing is enabled, steal a client from the busiest one, if it is
+    /// overloaded, to the least busy one.
+    void balanceLoad(mqbi::DispatcherClientType::Enum type);
+
+    /// Start holding the events of the specified `client`, of the specified
+    /// `type`, which is being stolen by the processor having the specified
+    /// `processorId`.
+    void onMigrationHold(mqbi::DispatcherClientType::Enum type,
+                         mqbi::DispatcherClient*          client,
+                         int                              processorId);
+
+    /// Record that an event enqueued to all the processors of clients of
+    /// the specified `type` has been processed by all of them, and invoke
+    /// the specified `doneCallback`, if any.
+    void onBroadcastDone(mqbi::DispatcherClientType::Enum     type,
+                         const mqbi::Dispatcher::VoidFunctor& doneCallback);
+
+    /// Move the specified `client`, of the specified `type`, from the
+    /// processor having the specified `processorId` to the one having the
+    /// specified `target` id, unless it was unregistered or an event
+    /// enqueued to all the processors is being processed, in which case
+    /// the move is abandoned until the next work stealing interval.
+    void onMigrationSwitch(mqbi::DispatcherClientType::Enum type,
+                           mqbi::DispatcherClient*          client,
+                           int                              target,
+                           int                              processorId);
+
+    /// Wait, from the processor having the specified `processorId` that
+    /// the specified `client` of the specified `type` was moved from, for
+    /// all the events routed to it before the specified `epoch` ended to be
+    /// enqueued, and then (the specified `isDrained` being `true`) for them
+    /// to be stashed, before handing the stashed events over to the
+    /// processor having the specified `target` id.
+    void onMigrationDrain(mqbi::DispatcherClientType::Enum type,
+                          mqbi::DispatcherClient*          client,
+                          int                              target,
+                          int                              epoch,
+                          bool                             isDrained,
+                          int                              processorId);
+
+    /// Complete, from the processor having the specified `processorId`, the
+    /// move of the specified `client` of the specified `type`, by
+    /// processing the specified `stashedEvents` and then the events held by
+    /// this processor.
+    void onMigrationRelease(mqbi::DispatcherClientType::Enum type,
+                            mqbi::DispatcherClient*          client,
+                            const DispatcherEventSpVector&   stashedEvents,
+                            int                              processorId);
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(Dispatcher, bslma::UsesBslmaAllocator)
@@ -351,6 +681,16 @@ class Dispatcher BSLS_CPP11_FINAL : public mqbi::Dispatcher {
                bdlmt::EventScheduler*          scheduler,
                bslma::Allocator*               allocator);
 
+    /// Create a dispatcher using the specified `config` and `scheduler`,
+    /// keeping the statistics of its processors under the specified
+    /// `statContext` (see "Instrumentation" in the component
+    /// documentation).  All memory allocation will be performed using the
+    /// specified `allocator`.
+    Dispatcher(const mqbcfg::DispatcherConfig& config,
+               bdlmt::EventScheduler*          scheduler,
+               mwcst::StatContext*             statContext,
+               bslma::Allocator*               allocator);
+
     /// Destructor
     ~Dispatcher() BSLS_KEYWORD_OVERRIDE;
 
@@ -529,8 +869,16 @@ inline void Dispatcher::dispatchEvent(mqbi::DispatcherEvent*  event,
 
     event->setDestination(destination);
 
+    const mqbi::DispatcherClientType::Enum type =
+        destination->dispatcherClientData().clientType();
+    if (type == mqbi::DispatcherClientType::e_QUEUE &&
+        d_contexts[type]->d_isWorkStealingEnabled) {
+        routeEvent(event, destination);
+        return;  // RETURN
+    }
+
     dispatchEvent(event,
-                  destination->dispatcherClientData().clientType(),
+                  type,
                   destination->dispatcherClientData().processorHandle());
 }
 
@@ -548,7 +896,11 @@ inline void Dispatcher::dispatchEvent(mqbi::DispatcherEvent*            event,
     case mqbi::DispatcherClientType::e_SESSION:
     case mqbi::DispatcherClientType::e_QUEUE:
     case mqbi::DispatcherClientType::e_CLUSTER: {
-        d_contexts[type]->d_processorPool_mp->enqueueEvent(event, handle);
+        DispatcherContext& context = *(d_contexts[type]);
+        if (!context.d_stats.empty()) {
+            event->setEnqueueTime(bsls::TimeUtil::getTimer());
+        }
+        context.d_processorPool_mp->enqueueEvent(event, handle);
     } break;
     case mqbi::DispatcherClientType::e_UNDEFINED:
     case mqbi::DispatcherClientType::e_ALL:
@@ -570,8 +922,7 @@ inline void Dispatcher::execute(const mqbi::Dispatcher::VoidFunctor& functor,
 
     mqbi::DispatcherEvent* event = getEvent(client);
 
-    (*event).setType(type).setCallback(
-        mqbi::Dispatcher::voidToProcessorFunctor(functor));
+    (*event).setType(type).setVoidCallback(functor);
 
     dispatchEvent(event, client);
 }
@@ -586,7 +937,7 @@ inline void Dispatcher::execute(const mqbi::Dispatcher::VoidFunctor& functor,
 
     (*event)
         .setType(mqbi::DispatcherEventType::e_DISPATCHER)
-        .setCallback(mqbi::Dispatcher::voidToProcessorFunctor(functor));
+        .setVoidCallback(functor);
 
     dispatchEvent(event, client.clientType(), client.processorHandle());
 }
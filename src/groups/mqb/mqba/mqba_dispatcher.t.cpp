@@ -19,21 +19,30 @@
 // MQB
 #include <mqbcfg_messages.h>
 #include <mqbmock_dispatcher.h>
+#include <mqbstat_dispatcherstats.h>
 
 // MWC
 #include <mwcex_bindutil.h>
 #include <mwcex_executionpolicy.h>
 #include <mwcex_executionutil.h>
 #include <mwcex_executor.h>
+#include <mwcst_statcontext.h>
+#include <mwcst_statutil.h>
+#include <mwcst_statvalue.h>
 #include <mwcsys_time.h>
 
 // BDE
 #include <bdlf_bind.h>
+#include <bdlf_memfn.h>
 #include <bdlmt_eventscheduler.h>
+#include <bsl_memory.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 #include <bslmt_semaphore.h>
 #include <bslmt_threadutil.h>
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
 #include <bsls_systemclocktype.h>
 
 // TEST DRIVER
@@ -89,6 +98,100 @@ struct LoadSelfThreadId {
     }
 };
 
+// =====================
+// struct RecordSequence
+// =====================
+
+/// Provides a functor that simulates some processing for the specified
+/// `client` of the specified `dispatcher`, and then records the specified
+/// `sequence` number into the specified `sequences`, and into the specified
+/// `misplaced` counter whether it is not executed by the processor of
+/// `client`.
+struct RecordSequence {
+    // TYPES
+
+    /// Defines the result type of the call operator.
+    typedef void ResultType;
+
+    // ACCESSORS
+    void operator()(const mqba::Dispatcher*       dispatcher,
+                    const mqbi::DispatcherClient* client,
+                    int                           sequence,
+                    bsl::vector<int>*             sequences,
+                    int*                          misplaced) const
+    {
+        bslmt::ThreadUtil::microSleep(200);
+
+        if (!dispatcher->inDispatcherThread(client)) {
+            ++(*misplaced);
+        }
+        sequences->push_back(sequence);
+    }
+};
+
+// ========================
+// struct CountBoundClients
+// ========================
+
+/// Provides a functor, executed on each processor, that simulates some
+/// processing and then increments, for each of the specified `numClients`
+/// `clients` that is bound to the specified `processorId`, the
+/// corresponding element of the specified `counts`.
+struct CountBoundClients {
+    // TYPES
+
+    /// Defines the result type of the call operator.
+    typedef void ResultType;
+
+    // ACCESSORS
+    void operator()(mqbi::DispatcherClient* const* clients,
+                    int                            numClients,
+                    bsls::AtomicInt*               counts,
+                    int                            processorId) const
+    {
+        bslmt::ThreadUtil::microSleep(200);
+
+        for (int i = 0; i < numClients; ++i) {
+            if (clients[i]->dispatcherClientData().processorHandle() ==
+                processorId) {
+                ++counts[i];
+            }
+        }
+    }
+};
+
+// =========================
+// class FlushCountingClient
+// =========================
+
+/// Mock dispatcher client counting the number of times it is flushed.
+class FlushCountingClient : public mqbmock::DispatcherClient {
+  public:
+    // PUBLIC DATA
+    int d_numFlushes;
+    // Number of calls to 'flush'
+
+    int d_numEvents;
+    // Number of events processed
+
+    // CREATORS
+    explicit FlushCountingClient(bslma::Allocator* allocator)
+    : mqbmock::DispatcherClient(allocator)
+    , d_numFlushes(0)
+    , d_numEvents(0)
+    {
+    }
+
+    // MANIPULATORS
+    void flush() BSLS_KEYWORD_OVERRIDE { ++d_numFlushes; }
+};
+
+/// Increment the specified `value`.
+void increment(int* value)
+{
+    ++(*value);
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -484,6 +587,541 @@ static void test3_executorsSupport()
     eventScheduler.stop();
 }
 
+static void test4_workStealing()
+// ------------------------------------------------------------------------
+// WORK STEALING
+//
+// Concerns:
+//   1. When work stealing is enabled, an idle processor steals a client
+//      from an overloaded one.
+//   2. The events of a stolen client are all processed, in order, and each
+//      of them by the processor the client is assigned to at that time.
+//
+// Plan:
+//   - Create and start a dispatcher having two 'queues' processors, with
+//     work stealing enabled.
+//   - Register clients until two of them are assigned to the same
+//     processor, and enqueue to both of them many sequenced events
+//     simulating some processing.
+//   - Check that one of them is moved to the other processor, and that the
+//     events of both clients were processed in order, on the processor of
+//     their client.
+//
+// Testing:
+//   Work stealing
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("WORK STEALING");
+
+    const int k_NUM_EVENTS = 2000;
+
+    // create / start a scheduler
+    bdlmt::EventScheduler eventScheduler(bsls::SystemClockType::e_MONOTONIC,
+                                         s_allocator_p);
+    int                   rc = eventScheduler.start();
+    BSLS_ASSERT_OPT(rc == 0);
+
+    // create the dispatcher, with two queues processors stealing clients
+    // from each other
+    mqbcfg::DispatcherConfig dispatcherConfig;
+
+    dispatcherConfig.sessions().numProcessors()               = 1;
+    dispatcherConfig.sessions().processorConfig().queueSize() = 100;
+    dispatcherConfig.sessions().processorConfig().queueSizeLowWatermark() = 0;
+    dispatcherConfig.sessions().processorConfig().queueSizeHighWatermark() =
+        100;
+
+    dispatcherConfig.queues().numProcessors()                 = 2;
+    dispatcherConfig.queues().workStealingIntervalMs()        = 20;
+    dispatcherConfig.queues().processorConfig().queueSize()   = 100000;
+    dispatcherConfig.queues().processorConfig().queueSizeLowWatermark() = 0;
+    dispatcherConfig.queues().processorConfig().queueSizeHighWatermark() =
+        100000;
+
+    dispatcherConfig.clusters().numProcessors()               = 1;
+    dispatcherConfig.clusters().processorConfig().queueSize() = 100;
+    dispatcherConfig.clusters().processorConfig().queueSizeLowWatermark() = 0;
+    dispatcherConfig.clusters().processorConfig().queueSizeHighWatermark() =
+        100;
+
+    mqba::Dispatcher dispatcher(dispatcherConfig,
+                                &eventScheduler,
+                                s_allocator_p);
+
+    bsl::stringstream startErr(s_allocator_p);
+    rc = dispatcher.start(startErr);
+    ASSERT_EQ(rc, 0);
+
+    // register three clients: two of them are assigned to the same processor
+    mqbmock::DispatcherClient client1(s_allocator_p);
+    mqbmock::DispatcherClient client2(s_allocator_p);
+    mqbmock::DispatcherClient client3(s_allocator_p);
+    dispatcher.registerClient(&client1, mqbi::DispatcherClientType::e_QUEUE);
+    dispatcher.registerClient(&client2, mqbi::DispatcherClientType::e_QUEUE);
+    dispatcher.registerClient(&client3, mqbi::DispatcherClientType::e_QUEUE);
+
+    mqbmock::DispatcherClient* clients[] = {&client1, &client2, &client3};
+    mqbmock::DispatcherClient* busy[2]   = {0, 0};
+    for (int i = 0; i < 3 && busy[1] == 0; ++i) {
+        for (int j = i + 1; j < 3; ++j) {
+            if (clients[i]->dispatcherClientData().processorHandle() ==
+                clients[j]->dispatcherClientData().processorHandle()) {
+                busy[0] = clients[i];
+                busy[1] = clients[j];
+                break;  // BREAK
+            }
+        }
+    }
+    BSLS_ASSERT_OPT(busy[1] != 0);
+
+    const mqbi::Dispatcher::ProcessorHandle initialProcessor =
+        busy[0]->dispatcherClientData().processorHandle();
+
+    // overload their processor
+    bsl::vector<int> sequences[2] = {bsl::vector<int>(s_allocator_p),
+                                     bsl::vector<int>(s_allocator_p)};
+    int              misplaced[2] = {0, 0};
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        for (int j = 0; j < 2; ++j) {
+            dispatcher.execute(bdlf::BindUtil::bind(RecordSequence(),
+                                                    &dispatcher,
+                                                    busy[j],
+                                                    i,
+                                                    &sequences[j],
+                                                    &misplaced[j]),
+                               busy[j],
+                               mqbi::DispatcherEventType::e_CALLBACK);
+        }
+    }
+
+    // wait (for at most 5 seconds) for one of them to be stolen
+    bool isStolen = false;
+    for (int i = 0; i < 500 && !isStolen; ++i) {
+        isStolen = busy[0]->dispatcherClientData().processorHandle() !=
+                       initialProcessor ||
+                   busy[1]->dispatcherClientData().processorHandle() !=
+                       initialProcessor;
+        if (!isStolen) {
+            bslmt::ThreadUtil::microSleep(10000);
+        }
+    }
+    ASSERT(isStolen);
+
+    // wait for all the events to be processed, and check their ordering
+    for (int j = 0; j < 2; ++j) {
+        dispatcher.synchronize(busy[j]);
+
+        PVV("Client " << j << " processor "
+                      << busy[j]->dispatcherClientData().processorHandle());
+
+        ASSERT_EQ(misplaced[j], 0);
+        ASSERT_EQ(static_cast<int>(sequences[j].size()), k_NUM_EVENTS);
+        for (int i = 0; i < static_cast<int>(sequences[j].size()); ++i) {
+            ASSERT_EQ_D(i, sequences[j][i], i);
+        }
+    }
+
+    for (int i = 0; i < 3; ++i) {
+        dispatcher.unregisterClient(clients[i]);
+    }
+
+    // stop the dispatcher
+    dispatcher.stop();
+
+    // stop the scheduler
+    eventScheduler.stop();
+}
+
+static void test5_batchFlush()
+// ------------------------------------------------------------------------
+// BATCH FLUSH
+//
+// Concerns:
+//   When a 'maxBatchSize' is configured, a processor flushes its clients
+//   every 'maxBatchSize' events, even though its queue is not empty.
+//
+// Plan:
+//   - Create and start a dispatcher having one 'queues' processor, with a
+//     'maxBatchSize' of 10.
+//   - Block the processor, enqueue 100 events to a client, and unblock the
+//     processor.
+//   - Check that the client was flushed once per batch of 10 events, and
+//     once for the remaining event.
+//
+// Testing:
+//   Batch flush
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BATCH FLUSH");
+
+    const int k_NUM_EVENTS     = 100;
+    const int k_MAX_BATCH_SIZE = 10;
+
+    // create / start a scheduler
+    bdlmt::EventScheduler eventScheduler(bsls::SystemClockType::e_MONOTONIC,
+                                         s_allocator_p);
+    int                   rc = eventScheduler.start();
+    BSLS_ASSERT_OPT(rc == 0);
+
+    mqbcfg::DispatcherConfig dispatcherConfig;
+
+    dispatcherConfig.sessions().numProcessors()               = 1;
+    dispatcherConfig.sessions().processorConfig().queueSize() = 100;
+    dispatcherConfig.sessions().processorConfig().queueSizeLowWatermark() = 0;
+    dispatcherConfig.sessions().processorConfig().queueSizeHighWatermark() =
+        100;
+
+    dispatcherConfig.queues().numProcessors()               = 1;
+    dispatcherConfig.queues().maxBatchSize()                = k_MAX_BATCH_SIZE;
+    dispatcherConfig.queues().processorConfig().queueSize() = 1000;
+    dispatcherConfig.queues().processorConfig().queueSizeLowWatermark() = 0;
+    dispatcherConfig.queues().processorConfig().queueSizeHighWatermark() =
+        1000;
+
+    dispatcherConfig.clusters().numProcessors()               = 1;
+    dispatcherConfig.clusters().processorConfig().queueSize() = 100;
+    dispatcherConfig.clusters().processorConfig().queueSizeLowWatermark() = 0;
+    dispatcherConfig.clusters().processorConfig().queueSizeHighWatermark() =
+        100;
+
+    mqba::Dispatcher dispatcher(dispatcherConfig,
+                                &eventScheduler,
+                                s_allocator_p);
+
+    bsl::stringstream startErr(s_allocator_p);
+    rc = dispatcher.start(startErr);
+    ASSERT_EQ(rc, 0);
+
+    FlushCountingClient client(s_allocator_p);
+    dispatcher.registerClient(&client, mqbi::DispatcherClientType::e_QUEUE);
+
+    // block the processor, so that all the events are pending when it starts
+    // processing them
+    bslmt::Semaphore startedSignal;
+    bslmt::Semaphore continueSignal;
+    dispatcher.execute(
+        bdlf::BindUtil::bind(Synchronize(), &startedSignal, &continueSignal),
+        &client,
+        mqbi::DispatcherEventType::e_CALLBACK);
+    startedSignal.wait();
+
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        dispatcher.execute(bdlf::BindUtil::bind(&increment,
+                                                &client.d_numEvents),
+                           &client,
+                           mqbi::DispatcherEventType::e_CALLBACK);
+    }
+    continueSignal.post();
+
+    dispatcher.synchronize(&client);
+
+    // One flush per batch of 'k_MAX_BATCH_SIZE' events (including the one
+    // blocking the processor), and one for the last event
+    ASSERT_EQ(client.d_numEvents, k_NUM_EVENTS);
+    ASSERT_EQ(client.d_numFlushes,
+              (k_NUM_EVENTS + 1) / k_MAX_BATCH_SIZE + 1);
+
+    dispatcher.unregisterClient(&client);
+
+    // stop the dispatcher
+    dispatcher.stop();
+
+    // stop the scheduler
+    eventScheduler.stop();
+}
+
+static void test6_instrumentation()
+// ------------------------------------------------------------------------
+// INSTRUMENTATION
+//
+// Concerns:
+//   When created with a stat context, each processor keeps track, per type
+//   of event, of the number of events it processed and of the time it spent
+//   processing them, of the time they waited in its queue, and of the
+//   number of times it flushed clients.
+//
+// Plan:
+//   - Create and start a dispatcher having one 'queues' processor, with a
+//     dispatcher stat context.
+//   - Block the processor, enqueue 100 events to a client, unblock the
+//     processor, and stop the dispatcher once they are processed.
+//   - Check the statistics of the processor, and of the 'CALLBACK' events.
+//
+// Testing:
+//   Dispatcher(config, scheduler, statContext, allocator)
+//   Instrumentation
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("INSTRUMENTATION");
+
+    const int k_NUM_EVENTS = 100;
+
+    bsl::shared_ptr<mwcst::StatContext> statContext =
+        mqbstat::DispatcherStatsUtil::initializeStatContext(2, s_allocator_p);
+
+    // create / start a scheduler
+    bdlmt::EventScheduler eventScheduler(bsls::SystemClockType::e_MONOTONIC,
+                                         s_allocator_p);
+    int                   rc = eventScheduler.start();
+    BSLS_ASSERT_OPT(rc == 0);
+
+    mqbcfg::DispatcherConfig dispatcherConfig;
+
+    dispatcherConfig.sessions().numProcessors()               = 1;
+    dispatcherConfig.sessions().processorConfig().queueSize() = 100;
+    dispatcherConfig.sessions().processorConfig().queueSizeLowWatermark() = 0;
+    dispatcherConfig.sessions().processorConfig().queueSizeHighWatermark() =
+        100;
+
+    dispatcherConfig.queues().numProcessors()               = 1;
+    dispatcherConfig.queues().processorConfig().queueSize() = 1000;
+    dispatcherConfig.queues().processorConfig().queueSizeLowWatermark() = 0;
+    dispatcherConfig.queues().processorConfig().queueSizeHighWatermark() =
+        1000;
+
+    dispatcherConfig.clusters().numProcessors()               = 1;
+    dispatcherConfig.clusters().processorConfig().queueSize() = 100;
+    dispatcherConfig.clusters().processorConfig().queueSizeLowWatermark() = 0;
+    dispatcherConfig.clusters().processorConfig().queueSizeHighWatermark() =
+        100;
+
+    mqba::Dispatcher dispatcher(dispatcherConfig,
+                                &eventScheduler,
+                                statContext.get(),
+                                s_allocator_p);
+
+    bsl::stringstream startErr(s_allocator_p);
+    rc = dispatcher.start(startErr);
+    ASSERT_EQ(rc, 0);
+
+    FlushCountingClient client(s_allocator_p);
+    dispatcher.registerClient(&client, mqbi::DispatcherClientType::e_QUEUE);
+
+    // block the processor, so that the events wait in its queue
+    bslmt::Semaphore startedSignal;
+    bslmt::Semaphore continueSignal;
+    dispatcher.execute(
+        bdlf::BindUtil::bind(Synchronize(), &startedSignal, &continueSignal),
+        &client,
+        mqbi::DispatcherEventType::e_CALLBACK);
+    startedSignal.wait();
+
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        dispatcher.execute(bdlf::BindUtil::bind(&increment,
+                                                &client.d_numEvents),
+                           &client,
+                           mqbi::DispatcherEventType::e_CALLBACK);
+    }
+    bslmt::ThreadUtil::microSleep(1000);
+    continueSignal.post();
+
+    dispatcher.synchronize(&client);
+    dispatcher.unregisterClient(&client);
+
+    // stop the dispatcher, so that the statistics are not updated anymore
+    dispatcher.stop();
+
+    statContext->snapshot();
+
+    const int processingTimeIndex = statContext->valueIndex(
+        "processing_time");
+    const int queueTimeIndex = statContext->valueIndex("queue_time");
+    const int flushIndex     = statContext->valueIndex("flush");
+
+    const mwcst::StatValue::SnapshotLocation latest(0, 0);
+
+    const mwcst::StatContext* processorContext = statContext->getSubcontext(
+        "QUEUE-0");
+    ASSERT(processorContext);
+
+    const mwcst::StatContext* callbackContext =
+        processorContext->getSubcontext("CALLBACK");
+    ASSERT(callbackContext);
+
+    // All the callbacks, including the one blocking the processor
+    const mwcst::StatValue& processingTime = callbackContext->value(
+        mwcst::StatContext::DMCST_DIRECT_VALUE,
+        processingTimeIndex);
+    ASSERT_EQ(mwcst::StatUtil::events(processingTime, latest),
+              k_NUM_EVENTS + 1);
+    ASSERT_GE(mwcst::StatUtil::percentile99(processingTime, latest), 0);
+
+    // The callbacks waited at least as long as the processor was blocked
+    const mwcst::StatValue& queueTime = processorContext->value(
+        mwcst::StatContext::DMCST_DIRECT_VALUE,
+        queueTimeIndex);
+    ASSERT_GE(mwcst::StatUtil::events(queueTime, latest), k_NUM_EVENTS + 1);
+    ASSERT_GE(mwcst::StatUtil::max(queueTime, latest), 1000 * 1000);
+
+    // Each flush flushed the only client
+    ASSERT_EQ(client.d_numEvents, k_NUM_EVENTS);
+    ASSERT_EQ(mwcst::StatUtil::value(
+                  processorContext->value(
+                      mwcst::StatContext::DMCST_DIRECT_VALUE,
+                      flushIndex),
+                  latest),
+              client.d_numFlushes);
+
+    // stop the scheduler
+    eventScheduler.stop();
+}
+
+static void test7_workStealingBroadcast()
+// ------------------------------------------------------------------------
+// WORK STEALING BROADCAST
+//
+// Concerns:
+//   When work stealing is enabled, no client moves to another processor
+//   while an event enqueued to all the processors is being processed, so
+//   that a function selecting the clients bound to the processor it is
+//   executed on (such as a domain purge) selects each client exactly once.
+//
+// Plan:
+//   - Create and start a dispatcher having two 'queues' processors, with
+//     work stealing enabled.
+//   - Register clients until two of them are assigned to the same
+//     processor, and enqueue to both of them many events simulating some
+//     processing, interleaved with events enqueued to all the processors
+//     counting, on each processor, the clients bound to it.
+//   - Check that each of these events counted each client exactly once.
+//
+// Testing:
+//   Work stealing
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("WORK STEALING BROADCAST");
+
+    const int k_NUM_EVENTS     = 2000;
+    const int k_NUM_BROADCASTS = 20;
+
+    // create / start a scheduler
+    bdlmt::EventScheduler eventScheduler(bsls::SystemClockType::e_MONOTONIC,
+                                         s_allocator_p);
+    int                   rc = eventScheduler.start();
+    BSLS_ASSERT_OPT(rc == 0);
+
+    // create the dispatcher, with two queues processors stealing clients
+    // from each other
+    mqbcfg::DispatcherConfig dispatcherConfig;
+
+    dispatcherConfig.sessions().numProcessors()               = 1;
+    dispatcherConfig.sessions().processorConfig().queueSize() = 100;
+    dispatcherConfig.sessions().processorConfig().queueSizeLowWatermark() = 0;
+    dispatcherConfig.sessions().processorConfig().queueSizeHighWatermark() =
+        100;
+
+    dispatcherConfig.queues().numProcessors()                 = 2;
+    dispatcherConfig.queues().workStealingIntervalMs()        = 20;
+    dispatcherConfig.queues().processorConfig().queueSize()   = 100000;
+    dispatcherConfig.queues().processorConfig().queueSizeLowWatermark() = 0;
+    dispatcherConfig.queues().processorConfig().queueSizeHighWatermark() =
+        100000;
+
+    dispatcherConfig.clusters().numProcessors()               = 1;
+    dispatcherConfig.clusters().processorConfig().queueSize() = 100;
+    dispatcherConfig.clusters().processorConfig().queueSizeLowWatermark() = 0;
+    dispatcherConfig.clusters().processorConfig().queueSizeHighWatermark() =
+        100;
+
+    mqba::Dispatcher dispatcher(dispatcherConfig,
+                                &eventScheduler,
+                                s_allocator_p);
+
+    bsl::stringstream startErr(s_allocator_p);
+    rc = dispatcher.start(startErr);
+    ASSERT_EQ(rc, 0);
+
+    // register three clients: two of them are assigned to the same processor
+    mqbmock::DispatcherClient client1(s_allocator_p);
+    mqbmock::DispatcherClient client2(s_allocator_p);
+    mqbmock::DispatcherClient client3(s_allocator_p);
+    dispatcher.registerClient(&client1, mqbi::DispatcherClientType::e_QUEUE);
+    dispatcher.registerClient(&client2, mqbi::DispatcherClientType::e_QUEUE);
+    dispatcher.registerClient(&client3, mqbi::DispatcherClientType::e_QUEUE);
+
+    mqbmock::DispatcherClient* clients[] = {&client1, &client2, &client3};
+    mqbi::DispatcherClient*    busy[2]   = {0, 0};
+    for (int i = 0; i < 3 && busy[1] == 0; ++i) {
+        for (int j = i + 1; j < 3; ++j) {
+            if (clients[i]->dispatcherClientData().processorHandle() ==
+                clients[j]->dispatcherClientData().processorHandle()) {
+                busy[0] = clients[i];
+                busy[1] = clients[j];
+                break;  // BREAK
+            }
+        }
+    }
+    BSLS_ASSERT_OPT(busy[1] != 0);
+
+    // overload their processor, while counting the clients bound to each
+    // processor from time to time
+    typedef void (bslmt::Semaphore::*PostFn)();
+
+    bsls::AtomicInt  counts[k_NUM_BROADCASTS][2];
+    bslmt::Semaphore broadcastsDone;
+    bsl::vector<int> sequences[2] = {bsl::vector<int>(s_allocator_p),
+                                     bsl::vector<int>(s_allocator_p)};
+    int              misplaced[2] = {0, 0};
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        for (int j = 0; j < 2; ++j) {
+            dispatcher.execute(bdlf::BindUtil::bind(RecordSequence(),
+                                                    &dispatcher,
+                                                    busy[j],
+                                                    i,
+                                                    &sequences[j],
+                                                    &misplaced[j]),
+                               busy[j],
+                               mqbi::DispatcherEventType::e_CALLBACK);
+        }
+
+        if (i % (k_NUM_EVENTS / k_NUM_BROADCASTS) == 0) {
+            const int k = i / (k_NUM_EVENTS / k_NUM_BROADCASTS);
+            dispatcher.execute(
+                bdlf::BindUtil::bind(CountBoundClients(),
+                                     busy,
+                                     2,
+                                     counts[k],
+                                     bdlf::PlaceHolders::_1),  // processor
+                mqbi::DispatcherClientType::e_QUEUE,
+                bdlf::MemFnUtil::memFn(
+                    static_cast<PostFn>(&bslmt::Semaphore::post),
+                    &broadcastsDone));
+        }
+    }
+
+    // wait for all the counts to complete, and check them
+    for (int k = 0; k < k_NUM_BROADCASTS; ++k) {
+        broadcastsDone.wait();
+    }
+
+    for (int k = 0; k < k_NUM_BROADCASTS; ++k) {
+        for (int j = 0; j < 2; ++j) {
+            ASSERT_EQ_D(k, counts[k][j].load(), 1);
+        }
+    }
+
+    // wait for all the events to be processed, and check their ordering
+    for (int j = 0; j < 2; ++j) {
+        dispatcher.synchronize(busy[j]);
+
+        ASSERT_EQ(misplaced[j], 0);
+        ASSERT_EQ(static_cast<int>(sequences[j].size()), k_NUM_EVENTS);
+        for (int i = 0; i < static_cast<int>(sequences[j].size()); ++i) {
+            ASSERT_EQ_D(i, sequences[j][i], i);
+        }
+    }
+
+    for (int i = 0; i < 3; ++i) {
+        dispatcher.unregisterClient(clients[i]);
+    }
+
+    // stop the dispatcher
+    dispatcher.stop();
+
+    // stop the scheduler
+    eventScheduler.stop();
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -496,6 +1134,10 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 7: test7_workStealingBroadcast(); break;
+    case 6: test6_instrumentation(); break;
+    case 5: test5_batchFlush(); break;
+    case 4: test4_workStealing(); break;
     case 3: test3_executorsSupport(); break;
     case 2: test2_clientTypeEnumValues(); break;
     case 1: test1_breathingTest(); break;
@@ -51,8 +51,28 @@ const bsls::TimeInterval k_DIR_CHECK_TTL = bsls::TimeInterval(60.0);
 // Minimum interval between checking the last
 // modification time of the script or config
 // directory.
+
+const bsls::TimeInterval k_NEGATIVE_CACHE_TTL = bsls::TimeInterval(5.0);
+// Time during which a failure to resolve a
+// domain is cached.
 }  // close unnamed namespace
 
+// ----------------------------------
+// struct DomainResolver::CacheEntry
+// ----------------------------------
+
+DomainResolver::CacheEntry::CacheEntry()
+: d_isPending(false)
+, d_rc(0)
+, d_errorDescription()
+, d_expirationTime()
+, d_data()
+, d_scriptTimestamp()
+, d_cfgDirTimestamp()
+{
+    // NOTHING
+}
+
 // --------------------
 // class DomainResolver
 // --------------------
@@ -82,50 +102,46 @@ void DomainResolver::updateTimestamps()
     d_timestampsValidUntil = now + k_DIR_CHECK_TTL;
 }
 
-bool DomainResolver::cacheLookup(mqbconfm::DomainResolver* out,
-                                 const bslstl::StringRef&  domainName)
+const DomainResolver::CacheEntry*
+DomainResolver::cacheLookup(const bslstl::StringRef& domainName)
 {
     BSLMT_MUTEXASSERT_IS_LOCKED_SAFE(&d_mutex);  // mutex LOCKED
 
-    CacheMap::const_iterator it = d_cache.find(domainName);
+    CacheMap::iterator it = d_cache.find(domainName);
+
+    while (it != d_cache.end() && it->second.d_isPending) {
+        // Another thread is resolving this domain, wait for its result.  Note
+        // that the entry may be erased (by 'clearCache') while waiting.
+        d_pendingCondition.wait(&d_mutex);
+        it = d_cache.find(domainName);
+    }
 
     if (it == d_cache.end()) {
         // Entry not found
-        return false;  // RETURN
+        return 0;  // RETURN
     }
 
     // Check if entry is stale: the entry is stale if its 'd_cfgDirTimestamp'
-    // member is different than the 'd_lastCfgDirTimestamp'.
+    // member is different than the 'd_lastCfgDirTimestamp', or if it is a
+    // negative entry which has expired.
     //
     // NOTE: the caller must call 'updateTimestamps()' to update the
     //       d_lastCfgDirTimestamp' prior to calling this method.
-    if (it->second.d_cfgDirTimestamp != d_lastCfgDirTimestamp) {
+    if (it->second.d_cfgDirTimestamp != d_lastCfgDirTimestamp ||
+        (it->second.d_rc != 0 &&
+         it->second.d_expirationTime < mwcsys::Time::nowMonotonicClock())) {
         // Stale entry, clear from the map
         d_cache.erase(it);
-        return false;  // RETURN
+        return 0;  // RETURN
     }
 
-    *out = it->second.d_data;  // Assign a copy of the object
-    return true;
+    return &it->second;
 }
 
-int DomainResolver::getOrRead(bsl::ostream&             errorDescription,
-                              mqbconfm::DomainResolver* out,
-                              const bslstl::StringRef&  domainName)
+int DomainResolver::readDomain(bsl::ostream&             errorDescription,
+                               mqbconfm::DomainResolver* out,
+                               const bslstl::StringRef&  domainName)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // mutex LOCKED
-
-    // Make sure we have the latest script timestamp
-    updateTimestamps();
-
-    // First, check in the cache
-    if (cacheLookup(out, domainName)) {
-        BALL_LOG_INFO << "Domain '" << domainName << "' resolved from cache";
-        return 0;  // RETURN
-    }
-
-    // We don't have the config in the cache, or the config was stale and got
-    // erased.
     enum RcEnum {
         // Value for the various RC error categories
         rc_SUCCESS           = 0,
@@ -233,18 +249,9 @@ int DomainResolver::getOrRead(bsl::ostream&             errorDescription,
             continue;
         }
 
-        // Add to cache
-        CacheEntry cacheEntry;
-        cacheEntry.d_data.name()    = resolvedDomainName;
-        cacheEntry.d_data.cluster() = domainVariant.definition().location();
-        *out                        = cacheEntry.d_data;
+        out->name()    = resolvedDomainName;
+        out->cluster() = domainVariant.definition().location();
         // REVIEW: suggestion: s/location/cluster/
-        cacheEntry.d_cfgDirTimestamp = d_lastCfgDirTimestamp;
-        // This is fine, because we updated
-        // them by calling
-        // 'updateTimestamps()'.
-
-        d_cache[domainName] = cacheEntry;
 
         return rc_SUCCESS;  // RETURN
     }
@@ -254,8 +261,79 @@ int DomainResolver::getOrRead(bsl::ostream&             errorDescription,
     return rc_REDIRECTION_ERROR;
 }
 
+int DomainResolver::getOrRead(bsl::ostream&             errorDescription,
+                              mqbconfm::DomainResolver* out,
+                              const bslstl::StringRef&  domainName)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // mutex LOCKED
+
+    // Make sure we have the latest script timestamp
+    updateTimestamps();
+
+    // First, check in the cache
+    const CacheEntry* cachedEntry = cacheLookup(domainName);
+    if (cachedEntry) {
+        if (cachedEntry->d_rc != 0) {
+            BALL_LOG_INFO << "Domain '" << domainName << "' failed to "
+                          << "resolve from cache [rc: " << cachedEntry->d_rc
+                          << "]";
+            errorDescription << cachedEntry->d_errorDescription;
+            return cachedEntry->d_rc;  // RETURN
+        }
+
+        BALL_LOG_INFO << "Domain '" << domainName << "' resolved from cache";
+        *out = cachedEntry->d_data;  // Assign a copy of the object
+        return 0;  // RETURN
+    }
+
+    // We don't have the config in the cache, or the config was stale and got
+    // erased.  Insert a pending entry, so that concurrent resolutions of that
+    // domain wait for this one, and read the config without holding the
+    // mutex, so that resolutions of other domains are not blocked.
+    const bsl::string    domainNameStr(domainName, d_allocator_p);
+    const bdlt::Datetime cfgDirTimestamp = d_lastCfgDirTimestamp;
+    // This is fine, because we updated
+    // them by calling 'updateTimestamps()'.
+
+    CacheEntry& pendingEntry       = d_cache[domainNameStr];
+    pendingEntry.d_isPending       = true;
+    pendingEntry.d_cfgDirTimestamp = cfgDirTimestamp;
+
+    mwcu::MemOutStream readErrorDescription(d_allocator_p);
+    int                rc = 0;
+    {
+        bslmt::UnLockGuard<bslmt::Mutex> unlockGuard(&d_mutex);
+        // mutex UNLOCKED
+        rc = readDomain(readErrorDescription, out, domainName);
+    }
+
+    // Add to cache.  Note that the pending entry may have been erased while
+    // the mutex was unlocked.
+    CacheEntry& cacheEntry       = d_cache[domainNameStr];
+    cacheEntry.d_isPending       = false;
+    cacheEntry.d_rc              = rc;
+    cacheEntry.d_cfgDirTimestamp = cfgDirTimestamp;
+    if (rc == 0) {
+        cacheEntry.d_data = *out;
+    }
+    else {
+        cacheEntry.d_errorDescription.assign(
+            readErrorDescription.str().data(),
+            readErrorDescription.str().length());
+        cacheEntry.d_expirationTime = mwcsys::Time::nowMonotonicClock() +
+                                      k_NEGATIVE_CACHE_TTL;
+        errorDescription << cacheEntry.d_errorDescription;
+    }
+
+    d_pendingCondition.broadcast();
+
+    return rc;
+}
+
 DomainResolver::DomainResolver(bslma::Allocator* allocator)
-: d_cache(allocator)
+: d_mutex()
+, d_pendingCondition()
+, d_cache(allocator)
 , d_lastCfgDirTimestamp()
 , d_timestampsValidUntil()
 , d_allocator_p(allocator)
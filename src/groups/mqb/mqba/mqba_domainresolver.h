@@ -40,7 +40,20 @@
 // stored value in the cache for that entry.  This means that we need to verify
 // those timestampseverytime before checking the cache.  In order to minimize
 // filesystem overhead, we don't look up the timestamps more than once per
-// minute (see 'k_SCRIPT_CHECK_TTL' value in the cpp file).
+// minute (see 'k_DIR_CHECK_TTL' value in the cpp file).
+//
+// Failures to resolve a domain are cached as well (*negative* entries), but
+// only for a short time (see 'k_NEGATIVE_CACHE_TTL' value in the cpp file),
+// so that a broker receiving many requests for a misconfigured domain doesn't
+// read its configuration for each of them, while still picking up a fixed
+// configuration quickly.
+//
+// Concurrent resolutions of the same domain are deduplicated: the first one
+// reads the configuration, without holding the lock of the cache, while the
+// other ones wait for and reuse its result.  This ensures that resolutions of
+// different domains don't serialize each other, and that a burst of requests
+// for the same domain (such as when many clients reconnect at the same time)
+// only reads the configuration once.
 //
 /// Thread-safety
 ///-------------
@@ -71,6 +84,7 @@
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_condition.h>
 #include <bslmt_mutex.h>
 #include <bsls_cpp11.h>
 #include <bsls_timeinterval.h>
@@ -111,6 +125,24 @@ class DomainResolver {
     /// map.
     struct CacheEntry {
         // PUBLIC DATA
+        bool d_isPending;
+        // True if the domain is being resolved,
+        // in which case the other members are not
+        // yet set.
+
+        int d_rc;
+        // Result of the resolution: 0 on success,
+        // or the non-zero error code of a
+        // negative entry.
+
+        bsl::string d_errorDescription;
+        // Description of the error of a negative
+        // entry.
+
+        bsls::TimeInterval d_expirationTime;
+        // Time (from the monotonic clock) after
+        // which a negative entry is stale.
+
         mqbconfm::DomainResolver d_data;
         // Cached response data.
 
@@ -122,6 +154,11 @@ class DomainResolver {
         // Last modification timestamp of the config
         // directory at the time this data was
         // generated.
+
+        // CREATORS
+
+        /// Create a resolved and empty entry.
+        CacheEntry();
     };
 
     typedef bsl::unordered_map<bsl::string, CacheEntry> CacheMap;
@@ -132,6 +169,10 @@ class DomainResolver {
     bslmt::Mutex d_mutex;
     // Protecting the CacheMap
 
+    bslmt::Condition d_pendingCondition;
+    // Condition signaled when a pending entry
+    // of the cache is resolved.
+
     CacheMap d_cache;
     // Cache map
 
@@ -149,35 +190,37 @@ class DomainResolver {
   private:
     // PRIVATE MANIPULATORS
 
-    /// Execute the script to resolve the specified `domainName`.  On
-    /// success, return 0 and store the result in the specified `out`;
-    /// return non-zero on error and populate the specified
-    /// `errorDescription` with a description of the error.
-    int executeScript(bsl::ostream&             errorDescription,
-                      mqbconfm::DomainResolver* out,
-                      const bslstl::StringRef&  domainName);
+    /// Read the configuration of the specified `domainName`.  On success,
+    /// return 0 and store the result in the specified `out`; return
+    /// non-zero on error and populate the specified `errorDescription` with
+    /// a description of the error.  Note that this method doesn't use the
+    /// cache, and must be called *without* `d_mutex` locked.
+    int readDomain(bsl::ostream&             errorDescription,
+                   mqbconfm::DomainResolver* out,
+                   const bslstl::StringRef&  domainName);
 
     /// Update the `d_lastCfgDirTimestamp` if the check happened longer
     /// than the TTL time ago.
     void updateTimestamps();
 
-    /// Lookup entry for the specified `domainName` in the cache, and fill
-    /// the data in the specified `out` if found and not stale; otherwise
-    /// return false and leave `out` untouched.  Note that if the entry is
-    /// found but has expired, this will erase it from the cache.
+    /// Lookup entry for the specified `domainName` in the cache, waiting
+    /// for it to be resolved if it is pending, and return a pointer to it
+    /// if found and not stale; otherwise return 0.  Note that if the entry
+    /// is found but has expired, this will erase it from the cache.
     ///
     /// NOTE:
-    /// * `d_mutex` *MUST* be locked prior to calling this function,
-    /// * the caller must call `updateScriptTimestamp()` to update the
+    /// * `d_mutex` *MUST* be locked prior to calling this function, and
+    ///   may be temporarily released by it,
+    /// * the caller must call `updateTimestamps()` to update the
     ///   timestamps prior to calling this method.
-    bool cacheLookup(mqbconfm::DomainResolver* out,
-                     const bslstl::StringRef&  domainName);
+    const CacheEntry* cacheLookup(const bslstl::StringRef& domainName);
 
     /// Get the data corresponding to the specified `domainName` from the
-    /// cache, or query it from the script storing the result in the cache.
-    /// Return 0 on success, populating the specified `out` with the result,
-    /// or return a non-zero value otherwise, populating the specified
-    /// `errorDescription` with a description of the error otherwise.
+    /// cache, or read it from the configuration storing the result in the
+    /// cache.  Return 0 on success, populating the specified `out` with the
+    /// result, or return a non-zero value otherwise, populating the
+    /// specified `errorDescription` with a description of the error
+    /// otherwise.
     int getOrRead(bsl::ostream&             errorDescription,
                   mqbconfm::DomainResolver* out,
                   const bslstl::StringRef&  domainName);
@@ -0,0 +1,89 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqba_pushpayloadcache.cpp                                          -*-C++-*-
+#include <mqba_pushpayloadcache.h>
+
+#include <mqbscm_version.h>
+// BDE
+#include <bslmt_lockguard.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace mqba {
+
+// ----------------------
+// class PushPayloadCache
+// ----------------------
+
+// CREATORS
+PushPayloadCache::PushPayloadCache(int capacity, bslma::Allocator* allocator)
+: d_mutex()
+, d_capacity(capacity)
+, d_entries(allocator)
+, d_next(0)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(capacity > 0);
+
+    d_entries.reserve(d_capacity);
+}
+
+// MANIPULATORS
+void PushPayloadCache::insert(const bmqt::MessageGUID&            guid,
+                              Conversion::Enum                    conversion,
+                              const bsl::shared_ptr<bdlbb::Blob>& payload)
+{
+    Entry entry;
+    entry.d_guid       = guid;
+    entry.d_conversion = conversion;
+    entry.d_payload    = payload;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    if (d_entries.size() < d_capacity) {
+        d_entries.push_back(entry);
+        return;  // RETURN
+    }
+
+    // Replace the least recently inserted entry.
+    d_entries[d_next] = entry;
+    d_next            = (d_next + 1) % d_entries.size();
+}
+
+// ACCESSORS
+bool PushPayloadCache::lookup(bsl::shared_ptr<bdlbb::Blob>* payload,
+                              const bmqt::MessageGUID&      guid,
+                              Conversion::Enum              conversion) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(payload);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    for (bsl::vector<Entry>::const_iterator it = d_entries.begin();
+         it != d_entries.end();
+         ++it) {
+        if (it->d_conversion == conversion && it->d_guid == guid) {
+            *payload = it->d_payload;
+            return true;  // RETURN
+        }
+    }
+
+    return false;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
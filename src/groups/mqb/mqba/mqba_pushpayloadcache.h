@@ -0,0 +1,153 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqba_pushpayloadcache.h                                            -*-C++-*-
+#ifndef INCLUDED_MQBA_PUSHPAYLOADCACHE
+#define INCLUDED_MQBA_PUSHPAYLOADCACHE
+
+//@PURPOSE: Provide a cache of the PUSH payloads re-encoded for the clients.
+//
+//@CLASSES:
+//  mqba::PushPayloadCache: cache of re-encoded PUSH payloads
+//
+//@DESCRIPTION: 'mqba::PushPayloadCache' is a small, bounded, cache of the
+// payloads of the PUSH messages which a client session had to re-encode
+// because its client does not support the encoding of the message (message
+// properties in the old style, compression algorithm, or compression
+// dictionary), shared between all the client sessions.
+//
+// In broadcast (and fanout) domains, the same message is delivered to many
+// consumers at once, each through its own session; without the cache, each
+// session whose client has the same limitations would re-encode the same
+// payload again.  With the cache, the payload is re-encoded once, and the
+// resulting blob is shared by the PUSH events of all the sessions, which
+// only encode their own PUSH header (queueId, subQueueInfos, ...).
+//
+// A payload is identified by the GUID of its message and the kind of
+// conversion it went through.  The cache holds the 'capacity' most recently
+// inserted payloads, which is enough for all the sessions to find the
+// payload of a message delivered to all of them during the same delivery
+// pass of the queue.
+//
+/// Thread Safety
+///-------------
+// This component is thread-safe.  Note that the cached blobs must not be
+// modified once inserted.
+
+// BMQ
+#include <bmqt_messageguid.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_mutex.h>
+
+namespace BloombergLP {
+namespace mqba {
+
+// ======================
+// class PushPayloadCache
+// ======================
+
+/// Bounded cache of the re-encoded PUSH payloads, shared by the sessions.
+class PushPayloadCache {
+  public:
+    // TYPES
+
+    /// Conversion a payload went through.
+    struct Conversion {
+        enum Enum {
+            e_OLD_PROPERTIES = 0  // Message properties in the old style
+            ,
+            e_ZLIB = 1  // Re-compressed with ZLIB
+            ,
+            e_NO_DICTIONARY = 2  // Re-compressed without dictionary
+        };
+    };
+
+    // CONSTANTS
+
+    /// Default number of payloads held by the cache.
+    static const int k_DEFAULT_CAPACITY = 64;
+
+  private:
+    // PRIVATE TYPES
+    struct Entry {
+        bmqt::MessageGUID            d_guid;
+        Conversion::Enum             d_conversion;
+        bsl::shared_ptr<bdlbb::Blob> d_payload;
+    };
+
+    // DATA
+    mutable bslmt::Mutex d_mutex;
+    // Mutex protecting the entries.
+
+    const size_t d_capacity;
+    // Maximum number of cached payloads.
+
+    bsl::vector<Entry> d_entries;
+    // Cached payloads.
+
+    size_t d_next;
+    // Index, in 'd_entries', of the entry
+    // replaced by the next insertion.
+
+  private:
+    // NOT IMPLEMENTED
+    PushPayloadCache(const PushPayloadCache&);             // = delete;
+    PushPayloadCache& operator=(const PushPayloadCache&);  // = delete;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(PushPayloadCache,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a cache holding at most the optionally specified `capacity`
+    /// payloads.  Use the optionally specified `allocator` to supply
+    /// memory.  The behavior is undefined unless `capacity` is positive.
+    explicit PushPayloadCache(int               capacity  = k_DEFAULT_CAPACITY,
+                              bslma::Allocator* allocator = 0);
+
+    // MANIPULATORS
+
+    /// Insert the specified `payload` of the message having the specified
+    /// `guid`, re-encoded with the specified `conversion`, replacing the
+    /// least recently inserted payload if the cache is full.  The behavior
+    /// is undefined unless `payload` is not modified after this call.
+    void insert(const bmqt::MessageGUID&            guid,
+                Conversion::Enum                    conversion,
+                const bsl::shared_ptr<bdlbb::Blob>& payload);
+
+    // ACCESSORS
+
+    /// Load into the specified `payload` the payload of the message having
+    /// the specified `guid`, re-encoded with the specified `conversion`,
+    /// and return `true` if it is cached.  Return `false` otherwise, in
+    /// which case `payload` is not modified.
+    bool lookup(bsl::shared_ptr<bdlbb::Blob>* payload,
+                const bmqt::MessageGUID&      guid,
+                Conversion::Enum              conversion) const;
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,134 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqba_pushpayloadcache.t.cpp                                        -*-C++-*-
+#include <mqba_pushpayloadcache.h>
+
+// BMQ
+#include <bmqt_messageguid.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bsl_memory.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+typedef mqba::PushPayloadCache::Conversion Conversion;
+
+/// Return a GUID built from the specified `hex` representation.
+bmqt::MessageGUID makeGuid(const char* hex)
+{
+    bmqt::MessageGUID guid;
+    guid.fromHex(hex);
+    return guid;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   1. A payload is found by the GUID of its message and its conversion,
+//      and only by them.
+//   2. Once full, the cache replaces the least recently inserted payload.
+//
+// Testing:
+//   insert
+//   lookup
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    const bmqt::MessageGUID guid1 = makeGuid(
+        "00000000000000000000000000000001");
+    const bmqt::MessageGUID guid2 = makeGuid(
+        "00000000000000000000000000000002");
+    const bmqt::MessageGUID guid3 = makeGuid(
+        "00000000000000000000000000000003");
+
+    bsl::shared_ptr<bdlbb::Blob> payload1 =
+        bsl::allocate_shared<bdlbb::Blob>(s_allocator_p);
+    bsl::shared_ptr<bdlbb::Blob> payload2 =
+        bsl::allocate_shared<bdlbb::Blob>(s_allocator_p);
+    bsl::shared_ptr<bdlbb::Blob> payload3 =
+        bsl::allocate_shared<bdlbb::Blob>(s_allocator_p);
+
+    mqba::PushPayloadCache       cache(2, s_allocator_p);
+    bsl::shared_ptr<bdlbb::Blob> payload;
+
+    ASSERT(!cache.lookup(&payload, guid1, Conversion::e_ZLIB));
+
+    cache.insert(guid1, Conversion::e_ZLIB, payload1);
+    ASSERT(cache.lookup(&payload, guid1, Conversion::e_ZLIB));
+    ASSERT(payload == payload1);
+    ASSERT(!cache.lookup(&payload, guid1, Conversion::e_OLD_PROPERTIES));
+    ASSERT(!cache.lookup(&payload, guid2, Conversion::e_ZLIB));
+
+    cache.insert(guid2, Conversion::e_NO_DICTIONARY, payload2);
+    ASSERT(cache.lookup(&payload, guid1, Conversion::e_ZLIB));
+    ASSERT(payload == payload1);
+    ASSERT(cache.lookup(&payload, guid2, Conversion::e_NO_DICTIONARY));
+    ASSERT(payload == payload2);
+
+    // Full: replaces 'payload1'
+    cache.insert(guid3, Conversion::e_OLD_PROPERTIES, payload3);
+    ASSERT(!cache.lookup(&payload, guid1, Conversion::e_ZLIB));
+    ASSERT(cache.lookup(&payload, guid2, Conversion::e_NO_DICTIONARY));
+    ASSERT(payload == payload2);
+    ASSERT(cache.lookup(&payload, guid3, Conversion::e_OLD_PROPERTIES));
+    ASSERT(payload == payload3);
+
+    // Then replaces 'payload2'
+    cache.insert(guid1, Conversion::e_ZLIB, payload1);
+    ASSERT(!cache.lookup(&payload, guid2, Conversion::e_NO_DICTIONARY));
+    ASSERT(cache.lookup(&payload, guid1, Conversion::e_ZLIB));
+    ASSERT(payload == payload1);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -148,6 +148,25 @@ void loadBrokerIdentity(bmqp_ctrlmsg::ClientIdentity* identity,
             .append(bmqp::MessagePropertiesFeatures::k_MESSAGE_PROPERTIES_EX);
     }
 
+    features.append(";")
+        .append(bmqp::CompressionFeatures::k_FIELD_NAME)
+        .append(":")
+        .append(bmqp::CompressionFeatures::k_LZ4)
+        .append(",")
+        .append(bmqp::CompressionFeatures::k_ZSTD)
+        .append(";")
+        .append(bmqp::ConfirmFeatures::k_FIELD_NAME)
+        .append(":")
+        .append(bmqp::ConfirmFeatures::k_RANGES)
+        .append(";")
+        .append(bmqp::PutFeatures::k_FIELD_NAME)
+        .append(":")
+        .append(bmqp::PutFeatures::k_COMPACT)
+        .append(";")
+        .append(bmqp::QueueFeatures::k_FIELD_NAME)
+        .append(":")
+        .append(bmqp::QueueFeatures::k_PIPELINED_CONFIGURE);
+
     identity->protocolVersion() = bmqp::Protocol::k_VERSION;
     identity->sdkVersion()      = bmqscm::Version::versionAsInt();
     identity->clientType()      = bmqp_ctrlmsg::ClientType::E_TCPBROKER;
@@ -740,7 +759,8 @@ void SessionNegotiator::createSession(bsl::ostream& errorDescription,
                           statContext,
                           d_blobSpPool_p,
                           d_bufferFactory_p,
-                          d_scheduler_p,
+                          &d_sessionTimerWheel,
+                          &d_pushPayloadCache,
                           d_allocator_p);
 
         out->reset(session, d_allocator_p);
@@ -879,6 +899,8 @@ SessionNegotiator::SessionNegotiator(bdlbb::BlobBufferFactory* bufferFactory,
 , d_blobSpPool_p(blobSpPool)
 , d_clusterCatalog_p(0)
 , d_scheduler_p(scheduler)
+, d_sessionTimerWheel(scheduler, allocator)
+, d_pushPayloadCache(PushPayloadCache::k_DEFAULT_CAPACITY, allocator)
 {
     // NOTHING
 }
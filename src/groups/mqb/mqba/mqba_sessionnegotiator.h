@@ -35,9 +35,11 @@
 
 // MQB
 
+#include <mqba_pushpayloadcache.h>
 #include <mqbconfm_messages.h>
 #include <mqbnet_negotiator.h>
 #include <mqbnet_session.h>
+#include <mqbu_timerwheel.h>
 
 // BMQ
 #include <bmqp_ctrlmsg_messages.h>
@@ -179,6 +181,17 @@ class SessionNegotiator : public mqbnet::Negotiator {
     // Pointer to the event scheduler to
     // use (held, not owned)
 
+    mqbu::TimerWheel d_sessionTimerWheel;
+    // Timers of the client sessions, all
+    // ticked by a single event of
+    // 'd_scheduler_p'.  Note that the
+    // sessions are destroyed before this
+    // object.
+
+    PushPayloadCache d_pushPayloadCache;
+    // PUSH payloads re-encoded by a client
+    // session, shared with the others.
+
     mqbnet::Session::AdminCommandEnqueueCb d_adminCb;
     // The callback to invoke on received
     // admin command.
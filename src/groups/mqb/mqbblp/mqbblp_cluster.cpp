@@ -71,6 +71,7 @@
 #include <bsl_string.h>
 #include <bsl_utility.h>
 #include <bslmt_latch.h>
+#include <bslmt_lockguard.h>
 #include <bsls_annotation.h>
 #include <bsls_performancehint.h>
 #include <bsls_systemclocktype.h>
@@ -530,7 +531,8 @@ void Cluster::generateNack(bmqt::AckResult::Enum               status,
     // Report locally generated NACK
     queue->stats()->onEvent(mqbstat::QueueStatsDomain::EventType::e_NACK, 1);
 
-    mwcu::MemOutStream os;
+    mwcu::MemOutStreamPoolGuard streamGuard(&d_streamPool);
+    mwcu::MemOutStream&         os = streamGuard.stream();
     os << description() << ": Failed to relay PUT message "
        << "[queueId: " << putHeader.queueId()
        << ", GUID: " << putHeader.messageGUID() << "]. "
@@ -556,7 +558,8 @@ void Cluster::processCommandDispatched(mqbcmd::ClusterResult*        result,
     }
     else if (command.isQueueHelperValue()) {
         d_clusterOrchestrator.queueHelper().loadState(
-            &result->makeClusterQueueHelper());
+            &result->makeClusterQueueHelper(),
+            command.queueHelper());
         return;  // RETURN
     }
     else if (command.isForceGcQueuesValue()) {
@@ -1969,6 +1972,11 @@ void Cluster::onRelayPushEvent(const mqbi::DispatcherEvent& event)
     rawEvent.loadPushMessageIterator(&pushIt, false);
     BSLS_ASSERT_SAFE(pushIt.isValid());
 
+    // Consecutive messages for the same queue are pushed to it as a single
+    // batch, so that the queue delivers them downstream at once.
+    mqbi::Queue*                               batchQueue = 0;
+    bsl::shared_ptr<mqbi::Queue::PushMessages> batch;
+
     int rc = 0;
     while (1 == (rc = pushIt.next())) {
         const bmqp::PushHeader& pushHeader = pushIt.header();
@@ -2035,16 +2043,33 @@ void Cluster::onRelayPushEvent(const mqbi::DispatcherEvent& event)
         // TBD: groupId: conditionally load 'optionsSp' using something like
         // 'PushMessageIterator::loadOptions(&options.get()).
 
-        queue->onPushMessage(pushHeader.messageGUID(),
-                             appDataSp,
-                             optionsSp,
-                             bmqp::MessagePropertiesInfo(pushHeader),
-                             pushHeader.compressionAlgorithmType());
+        if (queue != batchQueue) {
+            if (batch) {
+                batchQueue->onPushMessages(batch);
+                batch.reset();
+            }
+            batchQueue = queue;
+        }
+
+        if (!batch) {
+            batch.createInplace(d_allocator_p, d_allocator_p);
+        }
+
+        batch->push_back(mqbi::Queue::PushMessage(
+            pushHeader.messageGUID(),
+            appDataSp,
+            optionsSp,
+            bmqp::MessagePropertiesInfo(pushHeader),
+            pushHeader.compressionAlgorithmType()));
         // Note that passing the correct value of MessageProperties flag
         // above is not really needed, because self node (replica) will
         // retrieve the value of this flag from the storage when forwarding
         // this PUSH message downstream.
     }
+
+    if (batch) {
+        batchQueue->onPushMessages(batch);
+    }
 }
 
 void Cluster::onRecoveryStatus(
@@ -2333,6 +2358,74 @@ void Cluster::onProxyConnectionUpDispatched(
     }
 }
 
+void Cluster::enqueueOpenQueueRequest(
+    const bmqp_ctrlmsg::ControlMessage& request,
+    mqbc::ClusterNodeSession*           node)
+{
+    // executed by the *IO* thread
+
+    OpenQueueRequestsSp batch;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(
+            &d_pendingOpenQueueRequestsMutex);  // LOCK
+
+        if (d_pendingOpenQueueRequests_sp) {
+            d_pendingOpenQueueRequests_sp->push_back(
+                bsl::make_pair(request, node));
+            return;  // RETURN
+        }
+
+        batch.createInplace(d_allocator_p, d_allocator_p);
+        batch->push_back(bsl::make_pair(request, node));
+        d_pendingOpenQueueRequests_sp = batch;
+    }  // UNLOCK
+
+    dispatcher()->execute(
+        bdlf::BindUtil::bind(&Cluster::processOpenQueueRequestsDispatched,
+                             this,
+                             batch),
+        this);
+}
+
+void Cluster::sealOpenQueueRequests()
+{
+    // executed by the *IO* thread
+
+    bslmt::LockGuard<bslmt::Mutex> guard(
+        &d_pendingOpenQueueRequestsMutex);  // LOCK
+
+    d_pendingOpenQueueRequests_sp.reset();
+}
+
+void Cluster::processOpenQueueRequestsDispatched(
+    const OpenQueueRequestsSp& batch)
+{
+    // executed by the cluster *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
+
+    OpenQueueRequests requests(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(
+            &d_pendingOpenQueueRequestsMutex);  // LOCK
+
+        if (d_pendingOpenQueueRequests_sp == batch) {
+            // No request can be appended to this batch anymore.
+            d_pendingOpenQueueRequests_sp.reset();
+        }
+        requests.swap(*batch);
+    }  // UNLOCK
+
+    for (OpenQueueRequests::const_iterator cit = requests.begin();
+         cit != requests.end();
+         ++cit) {
+        d_clusterOrchestrator.queueHelper().processPeerOpenQueueRequest(
+            cit->first,
+            cit->second);
+    }
+}
+
 void Cluster::processResponseDispatched(
     const bmqp_ctrlmsg::ControlMessage& response,
     mqbnet::ClusterNode*                source)
@@ -2520,10 +2613,13 @@ Cluster::Cluster(const bslstl::StringRef&           name,
 , d_throttledDroppedConfirmMessages(5000, 5)  // 5 logs per 5s interval
 , d_throttledFailedPushMessages(5000, 5)      // 5 logs per 5s interval
 , d_throttledDroppedPushMessages(5000, 5)     // 5 logs per 5s interval
+, d_streamPool(256, 2, allocator)
 , d_logSummarySchedulerHandle()
 , d_queueGcSchedulerHandle()
 , d_stopRequestsManager(&d_clusterData.requestManager(), allocator)
 , d_shutdownChain(allocator)
+, d_pendingOpenQueueRequestsMutex()
+, d_pendingOpenQueueRequests_sp()
 {
     // PRECONDITIONS
     BSLS_ASSERT(d_allocator_p);
@@ -2858,6 +2954,12 @@ void Cluster::processControlMessage(
     // executed by the *IO* thread
     typedef bmqp_ctrlmsg::ControlMessageChoice MsgChoice;  // shortcut
 
+    if (!message.choice().isOpenQueueValue()) {
+        // Open-queue requests received after this message must not be
+        // processed before it.
+        sealOpenQueueRequests();
+    }
+
     switch (message.choice().selectionId()) {
     case MsgChoice::SELECTION_ID_STATUS:
     case MsgChoice::SELECTION_ID_OPEN_QUEUE_RESPONSE:
@@ -2877,13 +2979,7 @@ void Cluster::processControlMessage(
         mqbc::ClusterNodeSession* node =
             d_clusterData.membership().getClusterNodeSession(source);
         BSLS_ASSERT_SAFE(node);
-        dispatcher()->execute(
-            bdlf::BindUtil::bind(
-                &ClusterQueueHelper::processPeerOpenQueueRequest,
-                &d_clusterOrchestrator.queueHelper(),
-                message,
-                node),
-            this);
+        enqueueOpenQueueRequest(message, node);
     } break;  // BREAK
     case MsgChoice::SELECTION_ID_CONFIGURE_STREAM:
     case MsgChoice::SELECTION_ID_CONFIGURE_QUEUE_STREAM: {
@@ -3320,8 +3416,8 @@ void Cluster::onDispatcherEvent(const mqbi::DispatcherEvent& event)
     case mqbi::DispatcherEventType::e_CALLBACK: {
         const mqbi::DispatcherCallbackEvent* realEvent =
             event.asCallbackEvent();
-        BSLS_ASSERT_SAFE(realEvent->callback());
-        realEvent->callback()(dispatcherClientData().processorHandle());
+        BSLS_ASSERT_SAFE(realEvent->hasCallback());
+        realEvent->invokeCallback(dispatcherClientData().processorHandle());
     } break;  // BREAK
     case mqbi::DispatcherEventType::e_PUT: {
         const mqbi::DispatcherPutEvent* realEvent = event.asPutEvent();
@@ -58,6 +58,7 @@
 #include <mwcma_countingallocatorstore.h>
 #include <mwcst_statcontextuserdata.h>
 #include <mwcsys_statmonitorsnapshotrecorder.h>
+#include <mwcu_memoutstreampool.h>
 #include <mwcu_operationchain.h>
 #include <mwcu_throttledaction.h>
 
@@ -70,11 +71,13 @@
 #include <bsl_memory.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
+#include <bsl_utility.h>
 #include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_mutex.h>
 #include <bsls_assert.h>
 #include <bsls_cpp11.h>
 
@@ -217,6 +220,14 @@ class Cluster : public mqbi::Cluster,
         const StopRequestManagerType::RequestContextSp& contextSp)>
         StopRequestCompletionCallback;
 
+    /// Open-queue requests received from peer nodes, along with the session
+    /// of the requesting node.
+    typedef bsl::vector<
+        bsl::pair<bmqp_ctrlmsg::ControlMessage, mqbc::ClusterNodeSession*> >
+        OpenQueueRequests;
+
+    typedef bsl::shared_ptr<OpenQueueRequests> OpenQueueRequestsSp;
+
   private:
     // DATA
     bslma::Allocator* d_allocator_p;
@@ -291,6 +302,10 @@ class Cluster : public mqbi::Cluster,
     // Throttling parameters for dropped
     // PUSH messages.
 
+    mwcu::MemOutStreamPool d_streamPool;
+    // Streams used to format the
+    // descriptions of NACKs.
+
     RecurringEventHandle d_logSummarySchedulerHandle;
     // Scheduler handle for the recurring
     // cluster summary log.
@@ -309,6 +324,23 @@ class Cluster : public mqbi::Cluster,
     // responses from proxies and nodes,
     // and the cluster's shutdown callback.
 
+    bslmt::Mutex d_pendingOpenQueueRequestsMutex;
+    // Mutex protecting
+    // 'd_pendingOpenQueueRequests_sp'.
+
+    OpenQueueRequestsSp d_pendingOpenQueueRequests_sp;
+    // Batch of open-queue requests
+    // received from peer nodes which
+    // further requests can be appended
+    // to, if any.  A single dispatcher
+    // event is enqueued per batch, so
+    // that a peer reopening many queues
+    // does not enqueue one event per
+    // queue.  The batch is sealed (reset)
+    // upon receiving any other control
+    // message, in order to preserve the
+    // processing order of the messages.
+
   private:
     // NOT IMPLEMENTED
     Cluster(const Cluster&) BSLS_CPP11_DELETED;
@@ -473,6 +505,22 @@ class Cluster : public mqbi::Cluster,
     processResponseDispatched(const bmqp_ctrlmsg::ControlMessage& response,
                               mqbnet::ClusterNode*                source);
 
+    /// Append the specified open-queue `request` from the specified peer
+    /// `node` to the pending batch, creating the batch and enqueuing the
+    /// dispatcher event processing it if there is none.  This method is
+    /// invoked in the IO thread.
+    void enqueueOpenQueueRequest(const bmqp_ctrlmsg::ControlMessage& request,
+                                 mqbc::ClusterNodeSession*           node);
+
+    /// Seal the pending batch of open-queue requests, if any, so that
+    /// open-queue requests received from now on are processed after the
+    /// events enqueued from now on.
+    void sealOpenQueueRequests();
+
+    /// Process all the open-queue requests of the specified `batch`.  This
+    /// method is invoked in the cluster-dispatcher thread.
+    void processOpenQueueRequestsDispatched(const OpenQueueRequestsSp& batch);
+
     // PRIVATE ACCESSORS
 
     /// Log a short summary of the core vital information about this
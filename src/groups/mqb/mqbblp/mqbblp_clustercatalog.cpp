@@ -505,6 +505,14 @@ int ClusterCatalog::loadBrokerClusterConfig(bsl::ostream& errorDescription)
             }
         }
 
+        if (!d_clustersDefinition.myProxyClusters().empty()) {
+            mwcu::Printer<bsl::vector<bsl::string> > printer(
+                &d_clustersDefinition.myProxyClusters());
+            BALL_LOG_OUTPUT_STREAM
+                << "\n  I will connect upfront to the following proxy "
+                << "clusters: " << printer << ".";
+        }
+
         if (!d_myVirtualClusters.empty()) {
             mwcu::Printer<bsl::unordered_map<bsl::string, int> > printer(
                 &d_myVirtualClusters);
@@ -537,6 +545,14 @@ int ClusterCatalog::start(bsl::ostream& errorDescription)
     bsl::unordered_set<bsl::string> allClusters(d_myClusters);
     allClusters.insert(d_myReverseClusters.begin(), d_myReverseClusters.end());
 
+    // Also include the proxy clusters which should be connected to upfront,
+    // so that the first queue opened in one of their domains doesn't have to
+    // wait for the connections to be established and negotiated.  Those are
+    // regular proxy clusters, whose nodes are connected to with automatic
+    // reconnection, and which are kept alive by the usual heartbeats.
+    allClusters.insert(d_clustersDefinition.myProxyClusters().begin(),
+                       d_clustersDefinition.myProxyClusters().end());
+
     // Create any cluster this broker is member of
     bsl::unordered_set<bsl::string>::const_iterator it;
     for (it = allClusters.begin(); it != allClusters.end(); ++it) {
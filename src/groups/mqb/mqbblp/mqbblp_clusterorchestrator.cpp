@@ -535,6 +535,20 @@ void ClusterOrchestrator::timerCbDispatched()
     }
 }
 
+void ClusterOrchestrator::processPendingQueueAssignmentRequests()
+{
+    // executed by the cluster *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(d_cluster_p));
+
+    mqbi::ClusterStateManager::QueueAssignmentRequests requests(
+        d_allocator_p);
+    requests.swap(d_pendingQueueAssignmentRequests);
+
+    d_stateManager_mp->processQueueAssignmentRequests(requests);
+}
+
 void ClusterOrchestrator::onQueueActivityTimer(bsls::Types::Int64 timer,
                                                int                partitionId)
 {
@@ -619,6 +633,8 @@ ClusterOrchestrator::ClusterOrchestrator(
                 allocator)
 , d_elector_mp()
 , d_storageManager_p(0)
+, d_consumptionMonitorEventHandle()
+, d_pendingQueueAssignmentRequests(allocator)
 {
     // executed by *ANY* thread
 
@@ -1213,7 +1229,21 @@ void ClusterOrchestrator::processQueueAssignmentRequest(
     BSLS_ASSERT_SAFE(
         d_cluster_p->dispatcher()->inDispatcherThread(d_cluster_p));
 
-    d_stateManager_mp->processQueueAssignmentRequest(request, requester);
+    // Requests received while this one is pending are processed together
+    // with it, in order to assign their queues with a single advisory.
+    d_pendingQueueAssignmentRequests.resize(
+        d_pendingQueueAssignmentRequests.size() + 1);
+    d_pendingQueueAssignmentRequests.back().first  = request;
+    d_pendingQueueAssignmentRequests.back().second = requester;
+    if (d_pendingQueueAssignmentRequests.size() > 1) {
+        return;  // RETURN
+    }
+
+    dispatcher()->execute(
+        bdlf::BindUtil::bind(
+            &ClusterOrchestrator::processPendingQueueAssignmentRequests,
+            this),
+        d_cluster_p);
 }
 
 void ClusterOrchestrator::processQueueAssignmentAdvisory(
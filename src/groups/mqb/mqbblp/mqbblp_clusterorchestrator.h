@@ -150,6 +150,17 @@ class ClusterOrchestrator {
 
     RecurringEventHandle d_consumptionMonitorEventHandle;
 
+    mqbi::ClusterStateManager::QueueAssignmentRequests
+        d_pendingQueueAssignmentRequests;
+    // Queue assignment requests received
+    // from peer nodes and not processed
+    // yet.  They are processed together
+    // by the dispatcher event enqueued
+    // upon receiving the first one, so
+    // that requests received in the
+    // meantime are assigned with a single
+    // advisory.
+
   private:
     // NOT IMPLEMENTED
     ClusterOrchestrator(const ClusterOrchestrator&);             // = delete;
@@ -209,6 +220,12 @@ class ClusterOrchestrator {
 
     void timerCbDispatched();
 
+    /// Process all the pending queue assignment requests.
+    ///
+    /// THREAD: This method is invoked in the associated cluster's
+    ///         dispatcher thread.
+    void processPendingQueueAssignmentRequests();
+
     /// THREAD: Executed by the dispatcher thread for the specified
     ///         `partitionId`.
     void onQueueActivityTimer(bsls::Types::Int64 timer, int partitionId);
@@ -349,7 +366,8 @@ class ClusterOrchestrator {
     void processBufferedQueueAdvisories();
 
     /// Process the queue assignment in the specified `request`, received
-    /// from the specified `requester`.
+    /// from the specified `requester`.  Note that the request is processed
+    /// asynchronously, along with the other requests received until then.
     ///
     /// THREAD: This method is invoked in the associated cluster's
     ///         dispatcher thread.
@@ -34,6 +34,7 @@
 #include <bmqt_messageguid.h>
 
 // MWC
+#include <mwcsys_time.h>
 #include <mwctsk_alarmlog.h>
 #include <mwcu_blob.h>
 #include <mwcu_outstreamformatsaver.h>
@@ -284,7 +285,8 @@ void ClusterProxy::processCommandDispatched(
         return;  // RETURN
     }
     else if (command.isQueueHelperValue()) {
-        d_queueHelper.loadState(&result->makeClusterQueueHelper());
+        d_queueHelper.loadState(&result->makeClusterQueueHelper(),
+                                command.queueHelper());
         return;  // RETURN
     }
 
@@ -446,6 +448,12 @@ void ClusterProxy::onPushEvent(const mqbi::DispatcherPushEvent& event)
     rawEvent.loadPushMessageIterator(&iter, false);
 
     BSLS_ASSERT_SAFE(iter.isValid());
+
+    // Consecutive messages for the same queue are pushed to it as a single
+    // batch, so that the queue delivers them downstream at once.
+    mqbi::Queue*                               batchQueue = 0;
+    bsl::shared_ptr<mqbi::Queue::PushMessages> batch;
+
     int rc = 0;
     while ((rc = iter.next()) == 1) {
         mqbi::Queue* queue = d_queueHelper.lookupQueue(
@@ -468,12 +476,28 @@ void ClusterProxy::onPushEvent(const mqbi::DispatcherPushEvent& event)
             BSLS_ASSERT_SAFE(0 == rc);
         }
 
-        bmqp::MessagePropertiesInfo logic(iter.header());
-        queue->onPushMessage(iter.header().messageGUID(),
-                             appDataSp,
-                             optionsSp,
-                             logic,
-                             iter.header().compressionAlgorithmType());
+        if (queue != batchQueue) {
+            if (batch) {
+                batchQueue->onPushMessages(batch);
+                batch.reset();
+            }
+            batchQueue = queue;
+        }
+
+        if (!batch) {
+            batch.createInplace(d_allocator_p, d_allocator_p);
+        }
+
+        batch->push_back(mqbi::Queue::PushMessage(
+            iter.header().messageGUID(),
+            appDataSp,
+            optionsSp,
+            bmqp::MessagePropertiesInfo(iter.header()),
+            iter.header().compressionAlgorithmType()));
+    }
+
+    if (batch) {
+        batchQueue->onPushMessages(batch);
     }
 }
 
@@ -808,6 +832,19 @@ ClusterProxy::sendRequest(const RequestManagerType::RequestSp& request,
 
     request->setGroupId(activeNode->nodeId());
 
+    if (request->responseCb()) {
+        // Intercept the response to measure the round-trip time with the
+        // active node.
+        const RequestManagerType::RequestType::ResponseCb responseCb =
+            request->responseCb();
+        request->setResponseCb(
+            bdlf::BindUtil::bind(&ClusterProxy::onActiveNodeResponse,
+                                 this,
+                                 bdlf::PlaceHolders::_1,  // request
+                                 activeNode,
+                                 responseCb));
+    }
+
     return d_clusterData.requestManager().sendRequest(
         request,
         bdlf::BindUtil::bind(&mqbnet::ClusterNode::write,
@@ -927,6 +964,28 @@ void ClusterProxy::processNodeStatusAdvisory(
     processActiveNodeManagerResult(result, source);
 }
 
+void ClusterProxy::onActiveNodeResponse(
+    const RequestManagerType::RequestSp&               request,
+    mqbnet::ClusterNode*                               node,
+    const RequestManagerType::RequestType::ResponseCb& responseCb)
+{
+    // executed by *ANY* thread
+
+    // Only successful responses are processed in the dispatcher thread (see
+    // 'processResponseDispatched'); timeouts may be reported from the
+    // scheduler thread, and don't measure a round-trip anyway.
+    if (request->result() == bmqt::GenericResult::e_SUCCESS &&
+        !request->isLateResponse() && request->sendTime() != 0) {
+        BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
+
+        d_activeNodeManager.onNodeRoundTripTime(
+            node,
+            mwcsys::Time::highResolutionTimer() - request->sendTime());
+    }
+
+    responseCb(request);
+}
+
 void ClusterProxy::processResponseDispatched(
     const bmqp_ctrlmsg::ControlMessage& response)
 {
@@ -1354,8 +1413,8 @@ void ClusterProxy::onDispatcherEvent(const mqbi::DispatcherEvent& event)
     case mqbi::DispatcherEventType::e_CALLBACK: {
         const mqbi::DispatcherCallbackEvent* realEvent =
             event.asCallbackEvent();
-        BSLS_ASSERT_SAFE(realEvent->callback());
-        realEvent->callback()(dispatcherClientData().processorHandle());
+        BSLS_ASSERT_SAFE(realEvent->hasCallback());
+        realEvent->invokeCallback(dispatcherClientData().processorHandle());
     } break;
     case mqbi::DispatcherEventType::e_PUSH: {
         onPushEvent(*(event.asPushEvent()));
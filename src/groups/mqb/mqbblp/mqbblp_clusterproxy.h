@@ -404,6 +404,14 @@ class ClusterProxy : public mqbc::ClusterStateObserver,
     void
     processResponseDispatched(const bmqp_ctrlmsg::ControlMessage& response);
 
+    /// Report the round-trip time of the specified `request`, sent to the
+    /// specified `node`, to the active node manager if it succeeded, and
+    /// invoke the specified `responseCb`.
+    void onActiveNodeResponse(
+        const RequestManagerType::RequestSp&               request,
+        mqbnet::ClusterNode*                               node,
+        const RequestManagerType::RequestType::ResponseCb& responseCb);
+
     /// Send stop request to proxies specified in `sessions` using the
     /// specified `stopCb` as a callback to be called once all the requests
     /// get responses.
@@ -49,6 +49,7 @@
 
 // BMQ
 #include <bmqimp_queuemanager.h>
+#include <bmqp_compressiondictionary.h>
 #include <bmqp_protocol.h>
 #include <bmqp_protocolutil.h>
 #include <bmqp_queueid.h>
@@ -92,6 +93,10 @@ const char k_MAXIMUM_NUMBER_OF_QUEUES_REACHED[] =
     "maximum number of queues reached";
 const char k_SELF_NODE_IS_STOPPING[] = "self node is stopping";
 
+/// Maximum number of queues assigned by a single queue assignment advisory
+/// when the leader assigns queues in batches.
+const size_t k_MAX_QUEUES_PER_ASSIGNMENT_ADVISORY = 1000;
+
 /// This function is a simple wrapper around the specified `callback`, to
 /// ensure that the specified `refCount` is decremented after it gets
 /// invoked with the specified `status`, `queue` and `confirmationCookie`.
@@ -404,6 +409,63 @@ ClusterQueueHelper::assignQueue(const QueueContextSp& queueContext)
     return QueueAssignmentResult::k_ASSIGNMENT_OK;
 }
 
+void ClusterQueueHelper::assignQueues(
+    bsl::vector<QueueContext*>*        rejected,
+    const bsl::vector<QueueContextSp>& queueContexts)
+{
+    // executed by the cluster *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(
+        d_cluster_p->dispatcher()->inDispatcherThread(d_cluster_p));
+    BSLS_ASSERT_SAFE(rejected);
+
+    if (d_cluster_p->isRemote() ||
+        !d_clusterData_p->electorInfo().hasActiveLeader() ||
+        !d_clusterData_p->electorInfo().isSelfLeader()) {
+        // Only the leader assigns queues by itself, and therefore is able to
+        // assign several queues at once.
+        for (size_t i = 0; i < queueContexts.size(); ++i) {
+            if (QueueAssignmentResult::k_ASSIGNMENT_REJECTED ==
+                assignQueue(queueContexts[i])) {
+                rejected->push_back(queueContexts[i].get());
+            }
+        }
+        return;  // RETURN
+    }
+
+    bsl::vector<bmqt::Uri>                   uris(d_allocator_p);
+    bsl::vector<QueueAssignmentResult::Enum> results(d_allocator_p);
+    uris.reserve(bsl::min(queueContexts.size(),
+                          k_MAX_QUEUES_PER_ASSIGNMENT_ADVISORY));
+
+    for (size_t begin = 0; begin < queueContexts.size();
+         begin += k_MAX_QUEUES_PER_ASSIGNMENT_ADVISORY) {
+        const size_t end = bsl::min(queueContexts.size(),
+                                    begin +
+                                        k_MAX_QUEUES_PER_ASSIGNMENT_ADVISORY);
+
+        uris.clear();
+        for (size_t i = begin; i < end; ++i) {
+            BSLS_ASSERT_SAFE(
+                !isQueueAssigned(*(queueContexts[i].get())) ||
+                ((d_cluster_p->isCSLModeEnabled() &&
+                  queueContexts[i]->d_stateQInfo_sp->pendingUnassignment())));
+
+            uris.push_back(queueContexts[i]->uri());
+        }
+
+        d_clusterStateManager_p->assignQueues(&results, uris);
+        BSLS_ASSERT_SAFE(results.size() == uris.size());
+
+        for (size_t i = 0; i < results.size(); ++i) {
+            if (results[i] == QueueAssignmentResult::k_ASSIGNMENT_REJECTED) {
+                rejected->push_back(queueContexts[begin + i].get());
+            }
+        }
+    }
+}
+
 void ClusterQueueHelper::onQueueAssigning(const bmqt::Uri& uri,
                                           bool processingPendingRequests)
 {
@@ -985,6 +1047,17 @@ void ClusterQueueHelper::processOpenQueueRequest(
             openQueueResp.originalRequest().handleParameters().qId() =
                 bmqp::QueueId::k_PRIMARY_QUEUE_ID;
 
+            // Advertise the compression dictionary of the queue, if trained.
+            const bsl::shared_ptr<mqbi::Queue>& queueSp =
+                context.d_queueContext_p->d_liveQInfo.d_queue_sp;
+            if (queueSp) {
+                const bmqp::CompressionDictionary* dictionary =
+                    queueSp->compressionDictionaryTrainer()->dictionary();
+                if (dictionary) {
+                    openQueueResp.compressionDictionary() = dictionary->data();
+                }
+            }
+
             createQueue(context,
                         openQueueResp,
                         0);  // upstream == self == null
@@ -1325,6 +1398,19 @@ void ClusterQueueHelper::onOpenQueueResponse(
     BSLS_ASSERT_SAFE(
         requestContext->response().choice().isOpenQueueResponseValue());
 
+    // Register the compression dictionary trained by the primary, if any, so
+    // that this node can convert messages compressed with it.
+    const bsl::vector<char>& dictionary =
+        requestContext->response()
+            .choice()
+            .openQueueResponse()
+            .compressionDictionary();
+    if (!dictionary.empty()) {
+        bmqp::CompressionDictionaryRegistry::add(
+            dictionary.data(),
+            static_cast<int>(dictionary.size()));
+    }
+
     // Received a success openQueue, proceed with the next step.
     if (createQueue(context,
                     requestContext->response().choice().openQueueResponse(),
@@ -2089,10 +2175,13 @@ bsl::shared_ptr<mqbi::Queue> ClusterQueueHelper::createQueueFactory(
         d_allocator_p);
 
     if (!isPrimary) {
-        queueSp->createRemote(
-            openQueueResponse.deduplicationTimeMs(),
-            d_clusterData_p->clusterConfig().queueOperations().ackWindowSize(),
-            d_clusterData_p->stateSpPool());
+        const mqbcfg::QueueOperationsConfig& queueOperations =
+            d_clusterData_p->clusterConfig().queueOperations();
+
+        queueSp->createRemote(openQueueResponse.deduplicationTimeMs(),
+                              queueOperations.ackWindowSize(),
+                              queueOperations.pendingPutsMaxBytes(),
+                              d_clusterData_p->stateSpPool());
 
         if (context.d_domain_p->registerQueue(errorDescription, queueSp) !=
             0) {
@@ -3409,15 +3498,18 @@ void ClusterQueueHelper::restoreStateRemote()
         return;  // RETURN
     }
 
-    // Attempt to re-issue open-queue requests for all applicable queues.
+    // Attempt to re-issue open-queue requests for all applicable queues, the
+    // ones with consumers first.
     bdlma::LocalSequentialAllocator<1024> localAllocator(d_allocator_p);
     bsl::vector<QueueContext*>            rejected(&localAllocator);
+    bsl::vector<QueueContextSp>           queues(d_allocator_p);
     rejected.reserve(d_queues.size());
+    loadQueuesInRestoreOrder(&queues);
 
-    for (QueueContextMapConstIter cit = d_queues.cbegin();
-         cit != d_queues.cend();
+    for (bsl::vector<QueueContextSp>::const_iterator cit = queues.begin();
+         cit != queues.end();
          ++cit) {
-        const QueueContextSp& queueContext = cit->second;
+        const QueueContextSp& queueContext = *cit;
         QueueLiveState&       liveQInfo    = queueContext->d_liveQInfo;
 
         if (!liveQInfo.d_queue_sp && liveQInfo.d_inFlight == 0) {
@@ -3555,14 +3647,20 @@ void ClusterQueueHelper::restoreStateCluster(int partitionId)
                         d_clusterData_p->membership().selfNode();
     }
 
+    // Visit the queues with consumers first, so that their reopen-queue
+    // requests are sent, and data starts flowing to them, before the ones of
+    // the other queues.
     bdlma::LocalSequentialAllocator<1024> localAllocator(d_allocator_p);
     bsl::vector<QueueContext*>            rejected(&localAllocator);
+    bsl::vector<QueueContextSp>           unassigned(d_allocator_p);
+    bsl::vector<QueueContextSp>           queues(d_allocator_p);
     rejected.reserve(d_queues.size());
+    loadQueuesInRestoreOrder(&queues);
 
-    for (QueueContextMapConstIter cit = d_queues.cbegin();
-         cit != d_queues.cend();
+    for (bsl::vector<QueueContextSp>::const_iterator cit = queues.begin();
+         cit != queues.end();
          ++cit) {
-        const QueueContextSp& queueContext = cit->second;
+        const QueueContextSp& queueContext = *cit;
 
         if (allPartitions) {
             // Attempt to re-issue open-queue requests for all appropriate
@@ -3584,13 +3682,11 @@ void ClusterQueueHelper::restoreStateCluster(int partitionId)
             }
 
             if (!isQueueAssigned(*queueContext.get())) {
-                // Queue is not assigned to a partition; get it assigned.  If
-                // self is leader, it will assign it locally, if not it will
-                // send a request to the leader, etc.
-                if (QueueAssignmentResult::k_ASSIGNMENT_REJECTED ==
-                    assignQueue(queueContext)) {
-                    rejected.push_back(queueContext.get());
-                }
+                // Queue is not assigned to a partition; get it assigned once
+                // all queues have been visited, so that a leader can assign
+                // them in batches.  If self is leader, it will assign it
+                // locally, if not it will send a request to the leader, etc.
+                unassigned.push_back(queueContext);
                 continue;  // CONTINUE
             }
         }
@@ -3726,6 +3822,8 @@ void ClusterQueueHelper::restoreStateCluster(int partitionId)
         }
     }
 
+    assignQueues(&rejected, unassigned);
+
     processRejectedQueueAssignments(rejected);
 }
 
@@ -5330,6 +5428,48 @@ bool ClusterQueueHelper::setStopContext(
     return result;
 }
 
+int ClusterQueueHelper::restorePriority(const QueueLiveState& queueInfo) const
+{
+    bool hasProducers = false;
+
+    for (StreamsMap::const_iterator cit = queueInfo.d_subQueueIds.begin();
+         cit != queueInfo.d_subQueueIds.end();
+         ++cit) {
+        const bmqp_ctrlmsg::QueueHandleParameters& params =
+            cit->value().d_parameters;
+        if (params.readCount() > 0) {
+            return 0;  // RETURN
+        }
+        hasProducers = hasProducers || params.writeCount() > 0;
+    }
+
+    return hasProducers ? 1 : 2;
+}
+
+void ClusterQueueHelper::loadQueuesInRestoreOrder(
+    bsl::vector<QueueContextSp>* queues) const
+{
+    // executed by the cluster *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(queues);
+
+    const int k_NUM_PRIORITIES = 3;
+
+    queues->clear();
+    queues->reserve(d_queues.size());
+
+    for (int priority = 0; priority < k_NUM_PRIORITIES; ++priority) {
+        for (QueueContextMapConstIter cit = d_queues.cbegin();
+             cit != d_queues.cend();
+             ++cit) {
+            if (restorePriority(cit->second->d_liveQInfo) == priority) {
+                queues->push_back(cit->second);
+            }
+        }
+    }
+}
+
 void ClusterQueueHelper::finishStopSequence(StopContext* context)
 {
     // executed by *ANY* thread
@@ -6116,7 +6256,8 @@ void ClusterQueueHelper::loadQueuesInfo(mqbcmd::StorageContent* out) const
 }
 
 void ClusterQueueHelper::loadState(
-    mqbcmd::ClusterQueueHelper* clusterQueueHelper) const
+    mqbcmd::ClusterQueueHelper* clusterQueueHelper,
+    const mqbcmd::ListQueues&   listQueues) const
 {
     // executed by the cluster *DISPATCHER* thread
 
@@ -6147,20 +6288,40 @@ void ClusterQueueHelper::loadState(
         clusterDomain.loaded()            = cit->second->domain() != 0;
     }
 
-    // Queues
-    clusterQueueHelper->queues().resize(d_queues.size());
-    int qIdx = 0;
-    for (QueueContextMapConstIter it = d_queues.begin(); it != d_queues.end();
-         ++it, ++qIdx) {
+    // Queues.  Only the selected page of the queues matching the filter is
+    // dumped, so that the result stays bounded on a cluster having a large
+    // number of queues.
+    const bool   hasFilter   = !listQueues.uriFilter().isNull();
+    const size_t offset      = bsl::max(listQueues.offset(), 0);
+    const size_t count       = listQueues.count() > 0 ? listQueues.count()
+                                                      : d_queues.size();
+    size_t       numMatching = 0;
+
+    clusterQueueHelper->queues().reserve(bsl::min(count, d_queues.size()));
+    for (QueueContextMapConstIter it = d_queues.begin();
+         it != d_queues.end() && clusterQueueHelper->queues().size() < count;
+         ++it) {
+        const bsl::string& uri = it->first.asString();
+        if (hasFilter &&
+            uri.find(listQueues.uriFilter().value()) == bsl::string::npos) {
+            continue;  // CONTINUE
+        }
+
+        if (numMatching++ < offset) {
+            continue;  // CONTINUE
+        }
+
         const QueueLiveState&                info = it->second->d_liveQInfo;
         const bsl::vector<OpenQueueContext>& contexts =
             it->second->d_liveQInfo.d_pending;
         const int pid = it->second->partitionId();
 
         // Queue URI
+        clusterQueueHelper->queues().resize(
+            clusterQueueHelper->queues().size() + 1);
         mqbcmd::ClusterQueue& clusterQueue =
-            clusterQueueHelper->queues()[qIdx];
-        clusterQueue.uri() = it->first.asString();
+            clusterQueueHelper->queues().back();
+        clusterQueue.uri() = uri;
         clusterQueue.id()  = info.d_id;
 
         // Info
@@ -81,6 +81,7 @@ namespace BloombergLP {
 // FORWARD DECLARATION
 namespace mqbcmd {
 class ClusterQueueHelper;
+class ListQueues;
 }
 namespace mqbcmd {
 class StorageContent;
@@ -522,6 +523,14 @@ class ClusterQueueHelper : public mqbc::ClusterStateObserver,
     QueueAssignmentResult::Enum
     assignQueue(const QueueContextSp& queueContext);
 
+    /// Assign the queues represented by the specified `queueContexts`, as
+    /// per `assignQueue`, and append to the specified `rejected` the ones
+    /// whose assignment was definitively rejected.  If self is the leader,
+    /// assign the queues in batches, each with a single queue assignment
+    /// advisory.
+    void assignQueues(bsl::vector<QueueContext*>*        rejected,
+                      const bsl::vector<QueueContextSp>& queueContexts);
+
     /// Called when the specified `uri` is in the process of being assigned.
     /// If the specified `processingPendingRequests` is true, we will
     /// process pending requests on this machine.
@@ -939,6 +948,19 @@ class ClusterQueueHelper : public mqbc::ClusterStateObserver,
     bool setStopContext(const mqbnet::ClusterNode*          clusterNode,
                         const bsl::shared_ptr<StopContext>& contextSp);
 
+    /// Return the priority with which the queue having the specified
+    /// `queueInfo` should be restored (i.e., reopened upstream) when the
+    /// state is restored, the lower the value the higher the priority: 0 if
+    /// the queue has consumers, 1 if it only has producers, and 2
+    /// otherwise.
+    int restorePriority(const QueueLiveState& queueInfo) const;
+
+    /// Load into the specified `queues` all the known queues, in the order
+    /// in which they should be restored: queues with consumers first, so
+    /// that data starts flowing to them before the other queues are
+    /// reopened, then queues with producers, then all other queues.
+    void loadQueuesInRestoreOrder(bsl::vector<QueueContextSp>* queues) const;
+
     // PRIVATE MANIPULATORS
     //   (virtual: mqbc::ClusterMembershipObserver)
 
@@ -1146,8 +1168,14 @@ class ClusterQueueHelper : public mqbc::ClusterStateObserver,
     int numPendingReopenQueueRequests() const;
 
     /// Dump the internal state of this object to the specified
-    /// `clusterQueueHelper` object.
-    void loadState(mqbcmd::ClusterQueueHelper* clusterQueueHelper) const;
+    /// `clusterQueueHelper` object, listing only the queues selected by the
+    /// specified `listQueues`: the queues whose URI contains its
+    /// `uriFilter` (if any), skipping the first `offset` of them and
+    /// keeping at most `count` of them (or all of them if `count` is 0).
+    /// Note that the total number of queues is reported regardless of the
+    /// selection.
+    void loadState(mqbcmd::ClusterQueueHelper* clusterQueueHelper,
+                   const mqbcmd::ListQueues&   listQueues) const;
 };
 
 // ============================================================================
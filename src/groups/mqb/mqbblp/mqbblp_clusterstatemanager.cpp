@@ -1177,6 +1177,25 @@ ClusterStateManager::assignQueue(const bmqt::Uri&      uri,
                                           status);
 }
 
+void ClusterStateManager::assignQueues(
+    bsl::vector<QueueAssignmentResult::Enum>* results,
+    const bsl::vector<bmqt::Uri>&             uris)
+{
+    // executed by the cluster *DISPATCHER* thread
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(
+        d_cluster_p->dispatcher()->inDispatcherThread(d_cluster_p));
+
+    mqbc::ClusterUtil::assignQueues(results,
+                                    d_state_p,
+                                    d_clusterData_p,
+                                    d_clusterStateLedger_mp.get(),
+                                    d_cluster_p,
+                                    uris,
+                                    d_queueAssigningCb,
+                                    d_allocator_p);
+}
+
 void ClusterStateManager::registerQueueInfo(const bmqt::Uri& uri,
                                             int              partitionId,
                                             const mqbu::StorageKey& queueKey,
@@ -1471,6 +1490,24 @@ void ClusterStateManager::processQueueAssignmentRequest(
         d_allocator_p);
 }
 
+void ClusterStateManager::processQueueAssignmentRequests(
+    const QueueAssignmentRequests& requests)
+{
+    // executed by the cluster *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(d_cluster_p));
+
+    mqbc::ClusterUtil::processQueueAssignmentRequests(
+        d_state_p,
+        d_clusterData_p,
+        d_clusterStateLedger_mp.get(),
+        d_cluster_p,
+        requests,
+        d_queueAssigningCb,
+        d_allocator_p);
+}
+
 void ClusterStateManager::processQueueAssignmentAdvisory(
     const bmqp_ctrlmsg::ControlMessage& message,
     mqbnet::ClusterNode*                source,
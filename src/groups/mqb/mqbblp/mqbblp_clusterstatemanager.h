@@ -371,6 +371,19 @@ class ClusterStateManager : public mqbc::ClusterStateObserver,
     assignQueue(const bmqt::Uri&      uri,
                 bmqp_ctrlmsg::Status* status = 0) BSLS_KEYWORD_OVERRIDE;
 
+    /// Perform the actual assignment of the queues represented by the
+    /// specified `uris`, as per `assignQueue`, but applying a single queue
+    /// assignment advisory for all of them whenever possible.  Load into
+    /// the specified `results` the result of the assignment of each queue,
+    /// in the order of `uris`.  This method is called only on the leader
+    /// node.
+    ///
+    /// THREAD: This method is invoked in the associated cluster's
+    ///         dispatcher thread.
+    virtual void
+    assignQueues(bsl::vector<QueueAssignmentResult::Enum>* results,
+                 const bsl::vector<bmqt::Uri>& uris) BSLS_KEYWORD_OVERRIDE;
+
     /// Register a queue info for the queue with the specified `uri`,
     /// `partitionId`, `queueKey` and `appIdInfos`.  If the specified
     /// `forceUpdate` flag is true, update queue info even if it is valid
@@ -504,6 +517,16 @@ class ClusterStateManager : public mqbc::ClusterStateObserver,
         const bmqp_ctrlmsg::ControlMessage& request,
         mqbnet::ClusterNode*                requester) BSLS_KEYWORD_OVERRIDE;
 
+    /// Process the queue assignments in the specified `requests`, each
+    /// received from its associated requester, as per
+    /// `processQueueAssignmentRequest`, but assigning the queues with a
+    /// single queue assignment advisory whenever possible.
+    ///
+    /// THREAD: This method is invoked in the associated cluster's
+    ///         dispatcher thread.
+    virtual void processQueueAssignmentRequests(
+        const QueueAssignmentRequests& requests) BSLS_KEYWORD_OVERRIDE;
+
     /// Process the specified queue assignment advisory `message` from the
     /// specified `source`.  If the specified `delayed` is true, the
     /// advisory has previously been delayed for processing.
@@ -23,6 +23,7 @@
 #include <mqbcmd_messages.h>
 #include <mqbi_dispatcher.h>
 #include <mqbi_queue.h>
+#include <mqbs_virtualstoragecatalog.h>
 #include <mqbu_storagekey.h>
 
 // BMQ
@@ -106,9 +107,24 @@ int validateConfig(bsl::ostream& errorDescription,
         rc_SUCCESS              = 0,
         rc_NON_BLOOMBERG_CFG    = -1,
         rc_CHANGED_DOMAIN_MODE  = -2,
-        rc_CHANGED_STORAGE_TYPE = -3
+        rc_CHANGED_STORAGE_TYPE = -3,
+        rc_TOO_MANY_APP_IDS     = -4
     };
 
+    // A queue holds one virtual storage per appId, and a storage holds at
+    // most 'k_MAX_NUM_VIRTUAL_STORAGES' of them.
+    if (newConfig.mode().isFanoutValue() &&
+        newConfig.mode().fanout().appIDs().size() >
+            static_cast<size_t>(
+                mqbs::VirtualStorageCatalog::k_MAX_NUM_VIRTUAL_STORAGES)) {
+        errorDescription << "Too many appIds in fanout mode ("
+                         << newConfig.mode().fanout().appIDs().size()
+                         << "), maximum is "
+                         << mqbs::VirtualStorageCatalog::
+                                k_MAX_NUM_VIRTUAL_STORAGES;
+        return rc_TOO_MANY_APP_IDS;  // RETURN
+    }
+
     if (previousDefn.isNull()) {
         // First time configure, nothing more to validate
         return 0;  // RETURN
@@ -765,7 +781,10 @@ void Domain::purgeAllQueues(
     // don't want to invoke 'purge' on queue objects while hold 'd_mutex' lock
     // as purging can be a long operation if a lot of messages need to be
     // merged.  Doing so while holding the lock will lead to contention across
-    // all queue-dispatcher threads attempting to purge queues.
+    // all queue-dispatcher threads attempting to purge queues.  Note that the
+    // dispatcher does not move queues to another processor until all of them
+    // have executed this function, so that each queue is selected by exactly
+    // one of them.
     bsl::vector<bsl::shared_ptr<mqbi::Queue> > queues;
 
     {
@@ -0,0 +1,187 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbblp_expressionindex.cpp                                         -*-C++-*-
+#include <mqbblp_expressionindex.h>
+
+#include <mqbscm_version.h>
+// BDE
+#include <bdld_datum.h>
+#include <bdlma_localsequentialallocator.h>
+#include <bsl_algorithm.h>
+#include <bslma_default.h>
+#include <bsls_assert.h>
+#include <bslstl_stringref.h>
+
+namespace BloombergLP {
+namespace mqbblp {
+
+namespace {
+
+/// Size of the buffer used to read the indexed properties of a message
+/// without using the heap, in the most common cases.
+const int k_PROPERTIES_BUFFER_SIZE = 512;
+
+}  // close unnamed namespace
+
+// -------------------------------
+// struct ExpressionIndex::Property
+// -------------------------------
+
+// CREATORS
+ExpressionIndex::Property::Property(bslma::Allocator* allocator)
+: d_strings(allocator)
+, d_integers(allocator)
+{
+    // NOTHING
+}
+
+ExpressionIndex::Property::Property(const Property&   other,
+                                    bslma::Allocator* allocator)
+: d_strings(other.d_strings, allocator)
+, d_integers(other.d_integers, allocator)
+{
+    // NOTHING
+}
+
+// ---------------------
+// class ExpressionIndex
+// ---------------------
+
+// CREATORS
+ExpressionIndex::ExpressionIndex(bslma::Allocator* basicAllocator)
+: d_properties(basicAllocator)
+, d_unindexed(basicAllocator)
+, d_isExact(basicAllocator)
+, d_size(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    // NOTHING
+}
+
+ExpressionIndex::ExpressionIndex(const ExpressionIndex& other,
+                                 bslma::Allocator*      basicAllocator)
+: d_properties(other.d_properties, basicAllocator)
+, d_unindexed(other.d_unindexed, basicAllocator)
+, d_isExact(other.d_isExact, basicAllocator)
+, d_size(other.d_size)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+void ExpressionIndex::add(const bmqeval::SimpleEvaluator& evaluator)
+{
+    const int position = d_size++;
+
+    bmqeval::SimpleEvaluator::Equality equality;
+
+    if (!evaluator.isValid() || !evaluator.loadEquality(&equality)) {
+        // Not compiled, invalid, or without equality: the routing considers
+        // the expression as 'true', or must evaluate it.
+        d_unindexed.push_back(position);
+        d_isExact.push_back(false);
+        return;  // RETURN
+    }
+
+    d_isExact.push_back(equality.d_isComplete);
+
+    Property& property =
+        d_properties[bsl::string(equality.d_property, d_allocator_p)];
+
+    if (equality.d_isString) {
+        property.d_strings[bsl::string(equality.d_string, d_allocator_p)]
+            .push_back(position);
+    }
+    else {
+        property.d_integers[equality.d_integer].push_back(position);
+    }
+}
+
+void ExpressionIndex::clear()
+{
+    d_properties.clear();
+    d_unindexed.clear();
+    d_isExact.clear();
+    d_size = 0;
+}
+
+// ACCESSORS
+void ExpressionIndex::loadCandidates(Positions*                 positions,
+                                     bmqeval::PropertiesReader* reader) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(positions);
+    BSLS_ASSERT_SAFE(reader);
+
+    positions->assign(d_unindexed.begin(), d_unindexed.end());
+
+    if (d_properties.empty()) {
+        return;  // RETURN
+    }
+
+    bdlma::LocalSequentialAllocator<k_PROPERTIES_BUFFER_SIZE> allocator(
+        d_allocator_p);
+
+    // Each list of positions is sorted: sort the result only if it is the
+    // concatenation of several lists.
+    int numLists = d_unindexed.empty() ? 0 : 1;
+
+    for (Properties::const_iterator it = d_properties.begin();
+         it != d_properties.end();
+         ++it) {
+        const Property&  property = it->second;
+        const Positions* matches  = 0;
+        bdld::Datum      value    = reader->get(it->first, &allocator);
+
+        if (value.isString()) {
+            PositionsByString::const_iterator itString =
+                property.d_strings.find(
+                    bsl::string(value.theString(), &allocator));
+            if (itString != property.d_strings.end()) {
+                matches = &itString->second;
+            }
+        }
+        else if (value.isInteger64() || value.isInteger()) {
+            const bsls::Types::Int64 integer = value.isInteger64()
+                                                   ? value.theInteger64()
+                                                   : value.theInteger();
+
+            PositionsByInteger::const_iterator itInteger =
+                property.d_integers.find(integer);
+            if (itInteger != property.d_integers.end()) {
+                matches = &itInteger->second;
+            }
+        }
+
+        // Otherwise, the property is missing or has another type: comparing
+        // it with a literal is an error, and the expressions are 'false'.
+
+        if (matches) {
+            positions->insert(positions->end(),
+                              matches->begin(),
+                              matches->end());
+            ++numLists;
+        }
+    }
+
+    if (numLists > 1) {
+        bsl::sort(positions->begin(), positions->end());
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
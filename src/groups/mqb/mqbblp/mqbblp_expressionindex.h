@@ -0,0 +1,213 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbblp_expressionindex.h                                           -*-C++-*-
+#ifndef INCLUDED_MQBBLP_EXPRESSIONINDEX
+#define INCLUDED_MQBBLP_EXPRESSIONINDEX
+
+//@PURPOSE: Provide an index of subscription expressions by property equality.
+//
+//@CLASSES:
+//  mqbblp::ExpressionIndex: index of expressions by required equality
+//
+//@SEE_ALSO: bmqeval_simpleevaluator, mqbblp_routers
+//
+//@DESCRIPTION: 'mqbblp::ExpressionIndex' is a mechanism selecting, among a
+// sequence of compiled subscription expressions, the ones which may evaluate
+// to 'true' for a message, without evaluating all of them.  Typical
+// subscription expressions are conjunctions requiring a property to be equal
+// to a literal, such as 'region == "X" && type == 2' (see
+// 'bmqeval::SimpleEvaluator::loadEquality').  Such expressions are indexed by
+// the name of the property and the value of the literal, so that selecting
+// the candidate expressions for a message reads each indexed property once,
+// and costs one hash lookup per property, whatever the number of expressions.
+// Expressions which do not require any equality, or which are not valid, are
+// always candidates.
+//
+// Note that the index only rules out expressions which cannot evaluate to
+// 'true': the candidates must still be evaluated, unless they are exact (see
+// 'isExact'), such as 'shard == 3', in which case they are known to evaluate
+// to 'true'.
+//
+/// Thread Safety
+///-------------
+// NOT thread safe.
+//
+/// Usage
+///-----
+//..
+//  mqbblp::ExpressionIndex index(allocator);
+//
+//  for (int i = 0; i < numExpressions; ++i) {
+//      index.add(evaluators[i]);  // position 'i'
+//  }
+//
+//  mqbblp::ExpressionIndex::Positions candidates(allocator);
+//  index.loadCandidates(&candidates, &reader);
+//
+//  for (size_t i = 0; i < candidates.size(); ++i) {
+//      if (index.isExact(candidates[i]) ||
+//          evaluators[candidates[i]].evaluate(evaluationContext)) {
+//          // ...
+//      }
+//  }
+//..
+
+// BMQ
+#include <bmqeval_simpleevaluator.h>
+
+// BDE
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+
+namespace mqbblp {
+
+// =====================
+// class ExpressionIndex
+// =====================
+
+/// Index of expressions by the property equality they require.
+class ExpressionIndex {
+  public:
+    // PUBLIC TYPES
+
+    /// Positions of expressions, in the order of their addition.
+    typedef bsl::vector<int> Positions;
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::unordered_map<bsl::string, Positions> PositionsByString;
+
+    typedef bsl::unordered_map<bsls::Types::Int64, Positions>
+        PositionsByInteger;
+
+    /// Expressions requiring one property to be equal to a literal, by
+    /// value of the literal.
+    struct Property {
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(Property, bslma::UsesBslmaAllocator)
+
+        // DATA
+        PositionsByString d_strings;
+
+        PositionsByInteger d_integers;
+
+        // CREATORS
+        explicit Property(bslma::Allocator* allocator = 0);
+
+        Property(const Property& other, bslma::Allocator* allocator = 0);
+    };
+
+    typedef bsl::unordered_map<bsl::string, Property> Properties;
+
+  private:
+    // DATA
+    Properties d_properties;  // indexed expressions, by property
+
+    Positions d_unindexed;  // expressions always candidates
+
+    bsl::vector<bool> d_isExact;  // whether each expression is exact
+
+    int d_size;  // number of expressions
+
+    bslma::Allocator* d_allocator_p;  // allocator to use
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ExpressionIndex, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty index.  Optionally specify a `basicAllocator` used
+    /// to supply memory.
+    explicit ExpressionIndex(bslma::Allocator* basicAllocator = 0);
+
+    /// Create an index having the same expressions as the specified
+    /// `other`.  Optionally specify a `basicAllocator` used to supply
+    /// memory.
+    ExpressionIndex(const ExpressionIndex& other,
+                    bslma::Allocator*      basicAllocator = 0);
+
+    // MANIPULATORS
+
+    /// Add the expression compiled by the specified `evaluator` at the
+    /// position `size()` of this index.
+    void add(const bmqeval::SimpleEvaluator& evaluator);
+
+    /// Remove all expressions from this index.
+    void clear();
+
+    // ACCESSORS
+
+    /// Return the number of expressions in this index.
+    int size() const;
+
+    /// Return the number of distinct properties the expressions of this
+    /// index are indexed by.
+    int numProperties() const;
+
+    /// Return `true` if the expression at the specified `position`
+    /// consists only of the equality it is indexed by, so that it
+    /// evaluates to `true` for any message it is a candidate for.  The
+    /// behavior is undefined unless `0 <= position < size()`.
+    bool isExact(int position) const;
+
+    /// Load into the specified `positions`, in increasing order, the
+    /// positions of the expressions of this index which may evaluate to
+    /// `true` for the message which properties are read from the specified
+    /// `reader`.  Note that each indexed property is read once.
+    void loadCandidates(Positions*                 positions,
+                        bmqeval::PropertiesReader* reader) const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ---------------------
+// class ExpressionIndex
+// ---------------------
+
+// ACCESSORS
+inline int ExpressionIndex::size() const
+{
+    return d_size;
+}
+
+inline int ExpressionIndex::numProperties() const
+{
+    return static_cast<int>(d_properties.size());
+}
+
+inline bool ExpressionIndex::isExact(int position) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= position && position < d_size);
+
+    return d_isExact[position];
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
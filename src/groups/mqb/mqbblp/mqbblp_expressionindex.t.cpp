@@ -0,0 +1,358 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbblp_expressionindex.t.cpp                                       -*-C++-*-
+#include <mqbblp_expressionindex.h>
+
+// BMQ
+#include <bmqeval_simpleevaluator.h>
+
+// MWC
+#include <mwcu_memoutstream.h>
+
+// BDE
+#include <bdld_datum.h>
+#include <bsl_algorithm.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+using namespace mqbblp;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// PropertiesReader reading properties from a map, and counting reads.
+class MockPropertiesReader : public bmqeval::PropertiesReader {
+  public:
+    // PUBLIC DATA
+    bsl::unordered_map<bsl::string, bdld::Datum> d_map;
+
+    int d_numReads;
+
+    // CREATORS
+    explicit MockPropertiesReader(bslma::Allocator* allocator)
+    : d_map(allocator)
+    , d_numReads(0)
+    {
+        // NOTHING
+    }
+
+    // MANIPULATORS
+    bdld::Datum get(const bsl::string& name,
+                    bslma::Allocator*  allocator) BSLS_KEYWORD_OVERRIDE
+    {
+        (void)allocator;
+
+        ++d_numReads;
+
+        bsl::unordered_map<bsl::string, bdld::Datum>::const_iterator iter =
+            d_map.find(name);
+
+        if (iter == d_map.end()) {
+            return bdld::Datum::createError(-1);  // RETURN
+        }
+
+        return iter->second;
+    }
+};
+
+/// Compile each of the specified `expressions` into the specified
+/// `evaluators`, and add them to the specified `index`.
+void compileAndIndex(bsl::vector<bmqeval::SimpleEvaluator>* evaluators,
+                     ExpressionIndex*                       index,
+                     const char**                           expressions,
+                     int                                    numExpressions)
+{
+    bmqeval::CompilationContext compilationContext(s_allocator_p);
+
+    evaluators->resize(numExpressions);
+
+    for (int i = 0; i < numExpressions; ++i) {
+        if (expressions[i][0] != '\0') {
+            ASSERT_EQ(
+                (*evaluators)[i].compile(expressions[i], compilationContext),
+                0);
+        }
+        index->add((*evaluators)[i]);
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise the basic functionality of the component.
+//
+// Plan:
+//   Index expressions with and without equalities, and check the
+//   candidates for a few messages.
+//
+// Testing:
+//   add
+//   clear
+//   size
+//   numProperties
+//   isExact
+//   loadCandidates
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    const char* k_EXPRESSIONS[] = {
+        "region == \"X\" && type == 1",  // 0
+        "region == \"Y\"",               // 1
+        "type == 2",                     // 2
+        "type > 2",                      // 3
+        "",                              // 4, not compiled
+        "region == \"X\" || type == 3",  // 5
+        "type == 1 && region == \"Y\"",  // 6
+    };
+    const int k_NUM_EXPRESSIONS = sizeof(k_EXPRESSIONS) /
+                                  sizeof(*k_EXPRESSIONS);
+
+    ExpressionIndex                       index(s_allocator_p);
+    bsl::vector<bmqeval::SimpleEvaluator> evaluators(s_allocator_p);
+
+    ASSERT_EQ(index.size(), 0);
+    ASSERT_EQ(index.numProperties(), 0);
+
+    compileAndIndex(&evaluators, &index, k_EXPRESSIONS, k_NUM_EXPRESSIONS);
+
+    ASSERT_EQ(index.size(), k_NUM_EXPRESSIONS);
+    ASSERT_EQ(index.numProperties(), 2);
+
+    const bool k_IS_EXACT[] = {false, true, true, false, false, false, false};
+    for (int i = 0; i < k_NUM_EXPRESSIONS; ++i) {
+        ASSERT_EQ_D(i, index.isExact(i), k_IS_EXACT[i]);
+    }
+
+    MockPropertiesReader       reader(s_allocator_p);
+    ExpressionIndex::Positions candidates(s_allocator_p);
+
+    PV("No properties");
+    {
+        index.loadCandidates(&candidates, &reader);
+
+        const int k_EXPECTED[] = {3, 4, 5};
+        ASSERT(candidates == ExpressionIndex::Positions(
+                                 k_EXPECTED,
+                                 k_EXPECTED + 3,
+                                 s_allocator_p));
+        ASSERT_EQ(reader.d_numReads, index.numProperties());
+    }
+
+    PV("region == \"X\", type == 1");
+    {
+        reader.d_map["region"] = bdld::Datum::createStringRef("X",
+                                                              s_allocator_p);
+        reader.d_map["type"]   = bdld::Datum::createInteger(1);
+
+        index.loadCandidates(&candidates, &reader);
+
+        const int k_EXPECTED[] = {0, 3, 4, 5, 6};
+        ASSERT(candidates == ExpressionIndex::Positions(
+                                 k_EXPECTED,
+                                 k_EXPECTED + 5,
+                                 s_allocator_p));
+    }
+
+    PV("region == \"Y\", type == 2 (Int64)");
+    {
+        reader.d_map["region"] = bdld::Datum::createStringRef("Y",
+                                                              s_allocator_p);
+        reader.d_map["type"]   = bdld::Datum::createInteger64(2,
+                                                            s_allocator_p);
+
+        index.loadCandidates(&candidates, &reader);
+
+        const int k_EXPECTED[] = {1, 2, 3, 4, 5};
+        ASSERT(candidates == ExpressionIndex::Positions(
+                                 k_EXPECTED,
+                                 k_EXPECTED + 5,
+                                 s_allocator_p));
+    }
+
+    PV("Properties of the wrong type");
+    {
+        reader.d_map["region"] = bdld::Datum::createInteger(1);
+        reader.d_map["type"]   = bdld::Datum::createStringRef("X",
+                                                            s_allocator_p);
+
+        index.loadCandidates(&candidates, &reader);
+
+        const int k_EXPECTED[] = {3, 4, 5};
+        ASSERT(candidates == ExpressionIndex::Positions(
+                                 k_EXPECTED,
+                                 k_EXPECTED + 3,
+                                 s_allocator_p));
+    }
+
+    PV("Copy");
+    {
+        ExpressionIndex copy(index, s_allocator_p);
+
+        ASSERT_EQ(copy.size(), index.size());
+        ASSERT_EQ(copy.numProperties(), index.numProperties());
+    }
+
+    PV("clear");
+    {
+        index.clear();
+
+        ASSERT_EQ(index.size(), 0);
+        ASSERT_EQ(index.numProperties(), 0);
+
+        index.loadCandidates(&candidates, &reader);
+        ASSERT(candidates.empty());
+    }
+}
+
+static void test2_candidatesIncludeMatches()
+// ------------------------------------------------------------------------
+// CANDIDATES INCLUDE MATCHES
+//
+// Concerns:
+//   Every expression evaluating to 'true' for a message is a candidate,
+//   and expressions requiring an equality which does not hold are not.
+//   Exact candidates evaluate to 'true'.
+//
+// Plan:
+//   Index many expressions over a few properties, and compare the
+//   candidates with the result of evaluating all expressions, for
+//   messages with all combinations of property values.
+//
+// Testing:
+//   loadCandidates
+//   isExact
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("CANDIDATES INCLUDE MATCHES");
+
+    const char* k_REGIONS[] = {"A", "B", "C"};
+    const int   k_NUM_REGIONS = 3;
+    const int   k_NUM_TYPES   = 4;
+
+    bsl::vector<bsl::string> expressions(s_allocator_p);
+    for (int r = 0; r < k_NUM_REGIONS; ++r) {
+        for (int t = 0; t < k_NUM_TYPES; ++t) {
+            mwcu::MemOutStream os(s_allocator_p);
+            os << "region == \"" << k_REGIONS[r] << "\" && type == " << t;
+            expressions.push_back(os.str());
+        }
+    }
+    for (int t = 0; t < k_NUM_TYPES; ++t) {
+        mwcu::MemOutStream os(s_allocator_p);
+        os << "type == " << t;
+        expressions.push_back(os.str());
+    }
+    expressions.push_back("type >= 2");
+    expressions.push_back("region != \"A\" && flag");
+    expressions.push_back("flag && type == 3");
+
+    bsl::vector<const char*> texts(s_allocator_p);
+    for (size_t i = 0; i < expressions.size(); ++i) {
+        texts.push_back(expressions[i].c_str());
+    }
+
+    ExpressionIndex                       index(s_allocator_p);
+    bsl::vector<bmqeval::SimpleEvaluator> evaluators(s_allocator_p);
+
+    compileAndIndex(&evaluators,
+                    &index,
+                    texts.data(),
+                    static_cast<int>(texts.size()));
+
+    ASSERT_EQ(index.numProperties(), 2);
+
+    MockPropertiesReader       reader(s_allocator_p);
+    bmqeval::EvaluationContext evaluationContext(&reader, s_allocator_p);
+    ExpressionIndex::Positions candidates(s_allocator_p);
+
+    for (int r = 0; r < k_NUM_REGIONS; ++r) {
+        for (int t = 0; t < k_NUM_TYPES; ++t) {
+            for (int flag = 0; flag < 2; ++flag) {
+                reader.d_map["region"] = bdld::Datum::createStringRef(
+                    k_REGIONS[r],
+                    s_allocator_p);
+                reader.d_map["type"]   = bdld::Datum::createInteger(t);
+                reader.d_map["flag"]   = bdld::Datum::createBoolean(flag);
+
+                index.loadCandidates(&candidates, &reader);
+
+                ASSERT(bsl::is_sorted(candidates.begin(), candidates.end()));
+
+                // The expressions on the region, the exact one on the
+                // type, the 2 unindexed ones, and 'flag && type == 3'
+                // indexed on the type.
+                ASSERT_EQ(candidates.size(), t == 3 ? 8u : 7u);
+
+                for (size_t i = 0; i < evaluators.size(); ++i) {
+                    const bool isCandidate = bsl::binary_search(
+                        candidates.begin(),
+                        candidates.end(),
+                        static_cast<int>(i));
+
+                    const bool result = evaluators[i].evaluate(
+                        evaluationContext);
+
+                    if (result) {
+                        ASSERT_EQ_D(expressions[i], isCandidate, true);
+                    }
+                    if (isCandidate && index.isExact(static_cast<int>(i))) {
+                        ASSERT_EQ_D(expressions[i], result, true);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 2: test2_candidatesIncludeMatches(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
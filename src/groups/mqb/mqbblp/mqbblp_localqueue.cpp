@@ -30,6 +30,7 @@
 #include <mqbu_storagekey.h>
 
 // BMQ
+#include <bmqp_compressiondictionary.h>
 #include <bmqp_protocolutil.h>
 #include <bmqt_queueflags.h>
 #include <bmqt_resultcode.h>
@@ -37,18 +38,23 @@
 
 // MWC
 #include <mwcsys_time.h>
+#include <mwcu_blob.h>
 #include <mwcu_memoutstream.h>
 
 // BDE
 #include <bdlb_nullablevalue.h>
 #include <bdlb_print.h>
+#include <bdlbb_blobutil.h>
+#include <bdlf_bind.h>
 #include <bdlma_localsequentialallocator.h>
+#include <bdlmt_fixedthreadpool.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_epochutil.h>
 #include <bsl_algorithm.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bsls_annotation.h>
 #include <bsls_performancehint.h>
@@ -61,6 +67,68 @@ namespace mqbblp {
 // class LocalQueue
 // ----------------
 
+// PRIVATE CLASS METHODS
+void LocalQueue::trainCompressionDictionary(
+    const bsl::shared_ptr<bmqp::CompressionDictionaryTrainer>& trainer,
+    const bsl::string&                                          uri)
+{
+    // executed by a thread of the *MISC WORK* thread pool
+
+    const int rc = trainer->train();
+    if (rc != 0) {
+        BALL_LOG_WARN << uri << ": failed to train compression dictionary "
+                      << "[rc: " << rc << "]";
+        return;  // RETURN
+    }
+
+    BALL_LOG_INFO << uri << ": trained compression dictionary [id: "
+                  << trainer->dictionary()->id()
+                  << ", size: " << trainer->dictionary()->data().size()
+                  << "]";
+}
+
+// PRIVATE MANIPULATORS
+void LocalQueue::observeCompressionSample(
+    const bdlbb::Blob&                 appData,
+    const bmqp::MessagePropertiesInfo& mpsInfo)
+{
+    // executed by the *DISPATCHER* thread
+
+    const bsl::shared_ptr<bmqp::CompressionDictionaryTrainer>& trainer =
+        d_state_p->queue()->compressionDictionaryTrainer();
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(!trainer->isCollecting())) {
+        return;  // RETURN
+    }
+
+    // Only sample the payload: that is what producers compress.  Note that
+    // old style message properties are compressed along with the payload.
+    int mpsSize = 0;
+    if (mpsInfo.isPresent() && mpsInfo.isExtended() &&
+        bmqp::ProtocolUtil::readPropertiesSize(&mpsSize,
+                                               appData,
+                                               mwcu::BlobPosition()) != 0) {
+        return;  // RETURN
+    }
+
+    bdlbb::Blob sample(d_allocator_p);
+    bdlbb::BlobUtil::append(&sample, appData, mpsSize);
+
+    if (!trainer->observe(sample)) {
+        return;  // RETURN
+    }
+
+    // Enough samples were collected.  Training is too expensive for the
+    // dispatcher thread.
+    bdlmt::FixedThreadPool* threadPool = d_state_p->miscWorkThreadPool();
+    if (!threadPool ||
+        threadPool->enqueueJob(
+            bdlf::BindUtil::bind(&LocalQueue::trainCompressionDictionary,
+                                 trainer,
+                                 d_state_p->uri().asString())) != 0) {
+        trainCompressionDictionary(trainer, d_state_p->uri().asString());
+    }
+}
+
 // CREATORS
 LocalQueue::LocalQueue(QueueState* state, bslma::Allocator* allocator)
 : d_allocator_p(allocator)
@@ -70,6 +138,8 @@ LocalQueue::LocalQueue(QueueState* state, bslma::Allocator* allocator)
 , d_hasNewMessages(false)
 , d_throttledDuplicateMessages()
 , d_haveStrongConsistency(false)
+, d_tracedGUID()
+, d_tracedStoredTimepoint(0)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(d_state_p->id() == bmqp::QueueId::k_PRIMARY_QUEUE_ID);
@@ -323,13 +393,14 @@ void LocalQueue::onDispatcherEvent(const mqbi::DispatcherEvent& event)
         postMessage(realEvent->putHeader(),
                     realEvent->blob(),
                     realEvent->options(),
-                    realEvent->queueHandle());
+                    realEvent->queueHandle(),
+                    realEvent->traceTimepoint());
     } break;  // BREAK
     case mqbi::DispatcherEventType::e_CALLBACK: {
         const mqbi::DispatcherCallbackEvent* realEvent =
             event.asCallbackEvent();
-        BSLS_ASSERT_SAFE(realEvent->callback());
-        realEvent->callback()(
+        BSLS_ASSERT_SAFE(realEvent->hasCallback());
+        realEvent->invokeCallback(
             d_state_p->queue()->dispatcherClientData().processorHandle());
     } break;  // BREAK
     case mqbi::DispatcherEventType::e_ACK: {
@@ -380,7 +451,8 @@ void LocalQueue::flush()
 void LocalQueue::postMessage(const bmqp::PutHeader&              putHeader,
                              const bsl::shared_ptr<bdlbb::Blob>& appData,
                              const bsl::shared_ptr<bdlbb::Blob>& options,
-                             mqbi::QueueHandle*                  source)
+                             mqbi::QueueHandle*                  source,
+                             bsls::Types::Int64 traceTimepoint)
 {
     // executed by the *DISPATCHER* thread
 
@@ -451,6 +523,29 @@ void LocalQueue::postMessage(const bmqp::PutHeader&              putHeader,
         appData,
         options);
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(traceTimepoint != 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // The message was sampled for latency tracing: report the time it
+        // waited to be dispatched to this queue and the time it took to be
+        // written to the storage.  Only one traced message at a time waits
+        // for its replication receipt, so that no state is kept per message.
+        const bsls::Types::Int64 storedTimepoint =
+            mwcsys::Time::highResolutionTimer();
+        d_state_p->stats().onEvent(
+            mqbstat::QueueStatsDomain::EventType::e_TRACE_DISPATCH_TIME,
+            timeStamp - traceTimepoint);
+        d_state_p->stats().onEvent(
+            mqbstat::QueueStatsDomain::EventType::e_TRACE_STORAGE_TIME,
+            storedTimepoint - timeStamp);
+
+        if (res == mqbi::StorageResult::e_SUCCESS &&
+            !attributes.hasReceipt() && d_tracedGUID.isUnset()) {
+            d_tracedGUID            = putHeader.messageGUID();
+            d_tracedStoredTimepoint = storedTimepoint;
+        }
+    }
+
     // Send acknowledgement if post failed or if ack was requested (both could
     // be true as well).
     if (res != mqbi::StorageResult::e_SUCCESS || attributes.hasReceipt()) {
@@ -488,6 +583,11 @@ void LocalQueue::postMessage(const bmqp::PutHeader&              putHeader,
         d_state_p->stats().onEvent(mqbstat::QueueStatsDomain::EventType::e_PUT,
                                    appData->length());
 
+        if (putHeader.compressionAlgorithmType() ==
+            bmqt::CompressionAlgorithmType::e_NONE) {
+            observeCompressionSample(*appData, translation);
+        }
+
         if (attributes.hasReceipt()) {
             d_hasNewMessages = true;
         }
@@ -528,13 +628,22 @@ void LocalQueue::onReceipt(const bmqt::MessageGUID&  msgGUID,
                            const bsls::Types::Int64& arrivalTimepoint)
 {
     // Calculate time delta between PUT and ACK
-    const bsls::Types::Int64 timeDelta = mwcsys::Time::highResolutionTimer() -
-                                         arrivalTimepoint;
+    const bsls::Types::Int64 now       = mwcsys::Time::highResolutionTimer();
+    const bsls::Types::Int64 timeDelta = now - arrivalTimepoint;
 
     d_state_p->stats().onEvent(
         mqbstat::QueueStatsDomain::EventType::e_ACK_TIME,
         timeDelta);
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_tracedGUID == msgGUID)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        d_state_p->stats().onEvent(
+            mqbstat::QueueStatsDomain::EventType::e_TRACE_REPLICATION_TIME,
+            now - d_tracedStoredTimepoint);
+        d_tracedGUID = bmqt::MessageGUID();
+    }
+
     if (d_state_p->handleCatalog().hasHandle(qH)) {
         // Send acknowledgement
         bmqp::AckMessage ackMessage;
@@ -560,6 +669,11 @@ void LocalQueue::onRemoval(const bmqt::MessageGUID& msgGUID,
     d_state_p->stats().onEvent(mqbstat::QueueStatsDomain::EventType::e_NACK,
                                1);
 
+    if (d_tracedGUID == msgGUID) {
+        // The traced message will never be replicated
+        d_tracedGUID = bmqt::MessageGUID();
+    }
+
     if (d_state_p->handleCatalog().hasHandle(qH)) {
         // Send negative acknowledgement
         bmqp::AckMessage ackMessage;
@@ -640,6 +754,57 @@ void LocalQueue::confirmMessage(const bmqt::MessageGUID& msgGUID,
     }
 }
 
+void LocalQueue::confirmMessageRange(const bmqt::MessageGUID& msgGUID,
+                                     int                      count,
+                                     unsigned int       upstreamSubQueueId,
+                                     mqbi::QueueHandle* source)
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_state_p->queue()->dispatcher()->inDispatcherThread(
+        d_state_p->queue()));
+    BSLS_ASSERT_SAFE(0 < count);
+
+    BALL_LOG_TRACE << "OnConfirm [queue: '" << d_state_p->description()
+                   << "', client: '" << *(source->client()) << "', GUID: '"
+                   << msgGUID << "', count: " << count << "]";
+
+    bdlma::LocalSequentialAllocator<64 * sizeof(bmqt::MessageGUID)>
+                                   localAllocator(d_allocator_p);
+    bsl::vector<bmqt::MessageGUID> removableGUIDs(&localAllocator);
+
+    // As in 'confirmMessage', the messages which failed to be confirmed are
+    // simply skipped.
+    d_queueEngine_mp->onConfirmMessageRange(source,
+                                            msgGUID,
+                                            count,
+                                            upstreamSubQueueId,
+                                            &removableGUIDs);
+
+    // Since there are no references, there should be no app holding any of
+    // those GUIDs and no need to call `beforeMessageRemoved`
+
+    for (size_t i = 0; i < removableGUIDs.size(); ++i) {
+        int                       msgSize = 0;
+        mqbi::StorageResult::Enum res     = d_state_p->storage()->remove(
+            removableGUIDs[i],
+            &msgSize);
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                res != mqbi::StorageResult::e_SUCCESS)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            BALL_LOG_WARN << "#QUEUE_CONFIRM_FAILURE "
+                          << "Error '" << res
+                          << "' while writing deletion record for queue:"
+                          << " '" << d_state_p->description()
+                          << "', client: '" << *(source->client())
+                          << "', GUID: '" << removableGUIDs[i] << "']";
+        }
+    }
+}
+
 int LocalQueue::rejectMessage(const bmqt::MessageGUID& msgGUID,
                               unsigned int             upstreamSubQueueId,
                               mqbi::QueueHandle*       source)
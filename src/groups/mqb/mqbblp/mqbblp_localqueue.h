@@ -44,12 +44,14 @@
 #include <bdlmt_throttle.h>
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
+#include <bsl_string.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bsls_assert.h>
 #include <bsls_cpp11.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 
@@ -91,6 +93,17 @@ class LocalQueue BSLS_CPP11_FINAL {
     // Throttler for duplicates.
     bool d_haveStrongConsistency;
 
+    bmqt::MessageGUID d_tracedGUID;
+    // GUID of the PUT message sampled for
+    // latency tracing which is waiting for
+    // its replication receipt, or unset if
+    // none.
+
+    bsls::Types::Int64 d_tracedStoredTimepoint;
+    // High resolution timepoint at which
+    // the message 'd_tracedGUID' was
+    // written to the storage.
+
   private:
     // NOT IMPLEMENTED
     LocalQueue(const LocalQueue& other) BSLS_CPP11_DELETED;
@@ -98,6 +111,25 @@ class LocalQueue BSLS_CPP11_FINAL {
     /// Copy constructor and assignment operator are not implemented
     LocalQueue& operator=(const LocalQueue& other) BSLS_CPP11_DELETED;
 
+  private:
+    // PRIVATE CLASS METHODS
+
+    /// Train the compression dictionary of the queue having the specified
+    /// `uri` using the specified `trainer`.  This method is executed by a
+    /// thread of the misc work thread pool.
+    static void trainCompressionDictionary(
+        const bsl::shared_ptr<bmqp::CompressionDictionaryTrainer>& trainer,
+        const bsl::string&                                          uri);
+
+    // PRIVATE MANIPULATORS
+
+    /// Collect the payload of the specified uncompressed `appData`, having
+    /// message properties as indicated by the specified `mpsInfo`, as a
+    /// sample for the compression dictionary of this queue, if the
+    /// dictionary is not trained yet.
+    void observeCompressionSample(const bdlbb::Blob&                 appData,
+                                  const bmqp::MessagePropertiesInfo& mpsInfo);
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(LocalQueue, bslma::UsesBslmaAllocator)
@@ -172,11 +204,15 @@ class LocalQueue BSLS_CPP11_FINAL {
     /// posted (the time at which a success confirm is generated depends on
     /// the configuration and the SLA, whether it's when the message is
     /// locally saved, or when one, multiple or all remove member of the
-    /// cluster have received it).
+    /// cluster have received it).  If the specified `traceTimepoint` is not
+    /// 0, the message was sampled for latency tracing when it was posted at
+    /// that high resolution timepoint, and the time it spends in each stage
+    /// is reported to the stats of this queue.
     void postMessage(const bmqp::PutHeader&              putHeader,
                      const bsl::shared_ptr<bdlbb::Blob>& appData,
                      const bsl::shared_ptr<bdlbb::Blob>& options,
-                     mqbi::QueueHandle*                  source);
+                     mqbi::QueueHandle*                  source,
+                     bsls::Types::Int64                  traceTimepoint);
 
     /// Called when a message with the specified `msgGUID` and `blob`
     /// associated payload is pushed to this queue.  Note that depending
@@ -221,6 +257,20 @@ class LocalQueue BSLS_CPP11_FINAL {
                         unsigned int             upstreamSubQueueId,
                         mqbi::QueueHandle*       source);
 
+    /// Confirm the specified `count` messages starting with the one having
+    /// the specified `msgGUID`, each subsequent message having the GUID
+    /// following the one of the previous message, for the specified
+    /// `upstreamSubQueueId` stream of the queue on behalf of the client
+    /// identified by the specified `source`.  This has the same effect as
+    /// calling `confirmMessage` for each message, but lets the queue engine
+    /// process the whole range at once.
+    ///
+    /// THREAD: This method is called from the Queue's dispatcher thread.
+    void confirmMessageRange(const bmqt::MessageGUID& msgGUID,
+                             int                      count,
+                             unsigned int             upstreamSubQueueId,
+                             mqbi::QueueHandle*       source);
+
     /// Reject the message with the specified `msgGUID` for the specified
     /// `upstreamSubQueueId` stream of the queue on the specified `source`.
     ///  Return resulting RDA counter.
@@ -43,14 +43,24 @@
 //     retrieve Message Group Ids that are old and can get Garbage Collected.
 // c)  A map ('HandleToGroups') from Handles to a set of
 //     'MsgGroupIdInfo::iterator's that correspond to the Message Group Ids
-//     assigned to this Handle.  This allows use to remove handles efficiently
-//     as well as know how many and which Message Group Ids to rebalance if
-//     required.
+//     assigned to this Handle, ordered like b).  This allows use to remove
+//     handles efficiently as well as know how many and which Message Group
+//     Ids to rebalance if required: the least recently used ones of the
+//     Handle, which are the least likely to have messages in flight.
 // d)  A set ('LeastLoadedHandleFirst') with 'HandleToGroups::iterator's
 //     ordered in such a way that the Handle with the least Message Group Ids
 //     is always at the beginning of the set.  This allows use to quickly map
 //     the least mapped Handle when a new unmapped Message Group Id arrives.
 //
+// Mapping new Message Group Ids to the least loaded Handle keeps every Handle
+// within one Message Group Id of the average.  When a Handle is added, the
+// rebalance only moves the Message Group Ids in excess of the (rounded-up)
+// average, so that its cost is proportional to the number of Handles plus
+// the number of Message Group Ids moved, and all the other mappings are
+// left untouched.  When a Handle is removed, only its Message Group Ids are
+// discarded, and they are mapped again, to the least loaded Handles, when
+// they are next seen.
+//
 //                                +-----------------------------+
 //                                | b) LeastUsedMsgGroupIdFirst |
 //                                +---+---------------+---------+
@@ -137,30 +147,9 @@ bool GroupLruComparator::operator()(const MsgGroupIdInfo::iterator& lhs,
     return lhs->first < rhs->first;
 }
 
-// -------------------------------
-// struct DirectMsgGroupComparator
-// -------------------------------
-
-/// Returns `true` if the specified `lhs` is considered less than the
-/// specified `rhs` or `false` otherwise.
-struct DirectMsgGroupComparator {
-    bool operator()(const MsgGroupIdInfo::iterator& lhs,
-                    const MsgGroupIdInfo::iterator& rhs) const;
-};
-
-bool DirectMsgGroupComparator::operator()(
-    const MsgGroupIdInfo::iterator& lhs,
-    const MsgGroupIdInfo::iterator& rhs) const
-{
-    // Compares Message Group Ids in a way that prioritizes the one with the
-    // lexicographically smallest id.
-    return lhs->first < rhs->first;
-}
-
-/// A set of `MsgGroupIdInfo::iterator`s.  Note that the order is not
-/// important so reuse the age order.
-typedef bsl::set<MsgGroupIdInfo::iterator, DirectMsgGroupComparator>
-    MsgGroupIdSet;
+/// A set of `MsgGroupIdInfo::iterator`s ordered in a way that the least
+/// recently used is at the beginning.
+typedef bsl::set<MsgGroupIdInfo::iterator, GroupLruComparator> MsgGroupIdSet;
 
 /// A mapping from `Handle`s to sets of Message Group Ids.  This can't be an
 /// `unordered_set` because if we used that instead, iterators might become
@@ -281,9 +270,9 @@ class MessageGroupIdManager::Index {
                     const Time&                     lastSeen);
 
     /// Limit the number of Message Group Ids per Handle to the specified
-    /// `size` limit.  Any excessive Message Group Ids will be removed, and
-    /// get added to the specified `tax` vector, to enable follow-up
-    /// actions.
+    /// `size` limit.  Any excessive Message Group Ids, the least recently
+    /// used first, will be removed, and get added to the specified `tax`
+    /// vector, to enable follow-up actions.
     void fixSize(bsl::vector<MsgGroupIdInfo::value_type>* tax, const int size);
 
     /// Erases the specified `iterator` from all the data structures.  It
@@ -429,15 +418,25 @@ void MessageGroupIdManager::Index::updateTime(
     const MsgGroupIdInfo::iterator& target,
     const Time&                     lastSeen)
 {
-    // This does a remove and re-add to the data structure b) and a
-    // modification in data structure a).  All the others should be unaffected.
+    // This does a remove and re-add to the data structures b) and c) and a
+    // modification in data structure a).  Data structure d) is unaffected,
+    // since the number of Message Group Ids of the Handle does not change.
+    const HandleToGroups::iterator it = d_handleToGroups.find(
+        handleFor(*target));
+    BSLS_ASSERT_SAFE(it != d_handleToGroups.end());
+
     const int erased = d_leastUsedMsgGroupIdFirst.erase(target);
     BSLS_ASSERT_SAFE(erased == 1);
     (void)erased;
 
+    const int count = it->second.erase(target);
+    BSLS_ASSERT_SAFE(count == 1);
+    (void)count;
+
     target->second.second = lastSeen;
 
     (void)d_leastUsedMsgGroupIdFirst.insert(target);
+    (void)it->second.insert(target);
 }
 
 void MessageGroupIdManager::Index::fixSize(
@@ -39,6 +39,9 @@
 // Message Group Ids from one Handle to another and occurs when a new Handle is
 // added.  This will get excessive Message Group Ids from Handles with more
 // than average Message Group Ids and re-distribute them to the other Handles.
+// Only the excess is moved, the least recently used Message Group Ids of each
+// Handle first, so that the most active groups stay on their Handle and the
+// cost of a rebalance is proportional to the number of groups moved.
 
 // MQB
 
@@ -887,6 +887,71 @@ static void test13_largeMessageGroupIdsUseAllocator()
     }
 }
 
+static void test14_rebalanceMovesLeastRecentlyUsedTest()
+// ------------------------------------------------------------------------
+// REBALANCE MOVES LEAST RECENTLY USED TEST
+//
+// Concerns:
+//   When we add a handle with 'addHandle()' and if rebalance is on, only
+//   the excess Message Group Ids are moved, and those are the least
+//   recently used ones of their handle.
+//
+// Plan:
+//   Start with 1 handle and map 6 Message Group Ids to it, the first ones
+//   being the most recently used.  Refresh one of the 3 least recently
+//   used ones.  Then add one extra handle and confirm that the 3 least
+//   recently used Message Group Ids, and only them, moved to it.
+//
+// Testing:
+//   getHandle, addHandle
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName(
+        "REBALANCE MOVES LEAST RECENTLY USED TEST");
+
+    typedef MessageGroupIdManager::IdsForHandle IdsForHandle;
+
+    const int k_MSG_GROUP_IDS_COUNT = 6;
+
+    MessageGroupIdManager obj(k_TIMEOUT,
+                              k_MAX_NUMBER_OF_MAPPINGS,
+                              MessageGroupIdManager::k_REBALANCE_ON,
+                              s_allocator_p);
+    obj.addHandle(_(0), k_T0);
+
+    // Group 'i' is last seen at 'k_T0 + 5 - i': group 5 is the least
+    // recently used one.
+    for (int i = 0; i < k_MSG_GROUP_IDS_COUNT; ++i) {
+        ASSERT_EQ(obj.getHandle(msgGroupIdFromInt(i),
+                                k_T0 + k_MSG_GROUP_IDS_COUNT - 1 - i),
+                  _(0));
+    }
+
+    // Group 3 becomes the most recently used one.
+    ASSERT_EQ(obj.getHandle(msgGroupIdFromInt(3), k_T0 + 10), _(0));
+
+    // A new handle arrives
+    obj.addHandle(_(1), k_T0 + 10);
+
+    IdsForHandle expected(s_allocator_p);
+    expected.insert(msgGroupIdFromInt(2));
+    expected.insert(msgGroupIdFromInt(4));
+    expected.insert(msgGroupIdFromInt(5));
+
+    IdsForHandle gids(s_allocator_p);
+    obj.idsForHandle(&gids, _(1));
+    ASSERT(gids == expected);
+
+    gids.clear();
+    obj.idsForHandle(&gids, _(0));
+    ASSERT_EQ(3U, gids.size());
+    ASSERT_EQ(1U, gids.count(msgGroupIdFromInt(3)));
+
+    // The mappings of the groups which did not move are unchanged.
+    ASSERT_EQ(obj.getHandle(msgGroupIdFromInt(0), k_T0 + 10), _(0));
+    ASSERT_EQ(obj.getHandle(msgGroupIdFromInt(5), k_T0 + 10), _(1));
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -909,6 +974,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 14: test14_rebalanceMovesLeastRecentlyUsedTest(); break;
     case 13: test13_largeMessageGroupIdsUseAllocator(); break;
     case 12: test12_printerTest(); break;
     case 11: test11_stronglyUnbalancedChainOnRebalanceTest(); break;
@@ -39,9 +39,11 @@
 #include <mqbstat_queuestats.h>
 
 // BMQ
+#include <bmqp_messageguidgenerator.h>
 #include <bmqt_queueflags.h>
 
 // MWC
+#include <mwcsys_time.h>
 #include <mwcu_memoutstream.h>
 #include <mwcu_printutil.h>
 
@@ -50,6 +52,7 @@
 #include <bdlb_string.h>
 #include <bdlf_bind.h>
 #include <bdlma_localsequentialallocator.h>
+#include <bdlt_timeunitratio.h>
 #include <bsl_functional.h>  // for bsl::ref()
 #include <bsl_iostream.h>
 #include <bsls_annotation.h>
@@ -61,6 +64,11 @@ namespace mqbblp {
 namespace {
 const char k_LOG_CATEGORY[] = "MQBBLP.QUEUE";
 
+const bsls::Types::Int64 k_INTERNALS_SNAPSHOT_MAX_AGE =
+    bdlt::TimeUnitRatio::k_NS_PER_S;
+// Maximum age of a snapshot of the internals of a queue to be reused by the
+// 'INTERNALS' admin command.
+
 /// This method performs the actual drop. It dispatches to the templated
 /// (local or remote) specified `queue`.  The specified `handle` will be
 /// released.
@@ -318,6 +326,36 @@ void Queue::closeDispatched()
     updateStats();
 }
 
+void Queue::onPushMessagesDispatched(
+    const bsl::shared_ptr<mqbi::Queue::PushMessages>& messages)
+{
+    // executed by the *QUEUE* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
+
+    // Feed the queue with the very events 'onPushMessage' would have
+    // dispatched.  The queue delivers them downstream upon 'flush', which the
+    // dispatcher calls once done with this event, so that all the messages of
+    // the batch are delivered in a single pass.  A single event is reused for
+    // the whole batch.
+    mqbi::DispatcherEvent event(d_allocator_p);
+    event.setType(mqbi::DispatcherEventType::e_PUSH)
+        .setSource(this)
+        .setDestination(this);
+
+    for (PushMessages::const_iterator it = messages->begin();
+         it != messages->end();
+         ++it) {
+        event.setBlob(it->d_appData)
+            .setOptions(it->d_options)
+            .setGuid(it->d_guid)
+            .setMessagePropertiesInfo(it->d_messagePropertiesInfo)
+            .setCompressionAlgorithmType(it->d_compressionAlgorithmType);
+        onDispatcherEvent(event);
+    }
+}
+
 void Queue::convertToLocalDispatched()
 {
     // executed by the *QUEUE* dispatcher thread
@@ -369,8 +407,9 @@ void Queue::convertToLocalDispatched()
                              d_localQueue_mp.get(),
                              bdlf::PlaceHolders::_1,    // putHeader
                              bdlf::PlaceHolders::_2,    // appData
-                             bdlf::PlaceHolders::_3,    // options
-                             bdlf::PlaceHolders::_4));  // source
+                             bdlf::PlaceHolders::_3,  // options
+                             bdlf::PlaceHolders::_4,  // source
+                             0));                     // traceTimepoint
 
     remoteQueue->iteratePendingConfirms(
         bdlf::BindUtil::bind(&LocalQueue::confirmMessage,
@@ -450,6 +489,31 @@ void Queue::loadInternals(mqbcmd::QueueInternals* out)
     }
 }
 
+void Queue::publishInternalsDispatched(
+    bsl::shared_ptr<const mqbcmd::QueueInternals>* snapshot)
+{
+    // executed by the *QUEUE* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
+    BSLS_ASSERT_SAFE(snapshot);
+
+    const bsls::Types::Int64 now = mwcsys::Time::highResolutionTimer();
+
+    *snapshot = d_internalsSnapshot.get(k_INTERNALS_SNAPSHOT_MAX_AGE, now);
+    if (*snapshot) {
+        // Another command published a snapshot while this one was queued
+        return;  // RETURN
+    }
+
+    bsl::shared_ptr<mqbcmd::QueueInternals> internals;
+    internals.createInplace(d_allocator_p, d_allocator_p);
+    loadInternals(internals.get());
+
+    d_internalsSnapshot.publish(internals, now);
+    *snapshot = internals;
+}
+
 Queue::Queue(const bmqt::Uri&                          uri,
              unsigned int                              id,
              const mqbu::StorageKey&                   key,
@@ -466,9 +530,13 @@ Queue::Queue(const bmqt::Uri&                          uri,
 , d_state(this, uri, id, key, partitionId, domain, allocator)
 , d_localQueue_mp(0)
 , d_remoteQueue_mp(0)
+, d_compressionDictionaryTrainer_sp()
+, d_internalsSnapshot()
 {
     BALL_LOG_INFO << d_state.uri() << ": constructor (" << this << ")";
 
+    d_compressionDictionaryTrainer_sp.createInplace(allocator, allocator);
+
     const mqbcfg::MessageThrottleConfig& messageThrottleConfig =
         domain->cluster()->isClusterMember()
             ? domain->cluster()->clusterConfig()->messageThrottleConfig()
@@ -516,6 +584,7 @@ void Queue::createLocal()
 
 void Queue::createRemote(int                       deduplicationTimeoutMs,
                          int                       ackWindowSize,
+                         int                       pendingPutsMaxBytes,
                          RemoteQueue::StateSpPool* statePool)
 {
     // PRECONDITIONS
@@ -526,6 +595,7 @@ void Queue::createRemote(int                       deduplicationTimeoutMs,
                               RemoteQueue(&d_state,
                                           deduplicationTimeoutMs,
                                           ackWindowSize,
+                                          pendingPutsMaxBytes,
                                           statePool,
                                           d_allocator_p),
                           d_allocator_p);
@@ -778,6 +848,30 @@ void Queue::onPushMessage(
     dispatcher()->dispatchEvent(dispEvent, this);
 }
 
+void Queue::onPushMessages(const bsl::shared_ptr<PushMessages>& messages)
+{
+    // executed by the *CLUSTER* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(domain()->cluster()));
+
+    if (messages->size() == 1) {
+        const PushMessage& message = messages->front();
+        onPushMessage(message.d_guid,
+                      message.d_appData,
+                      message.d_options,
+                      message.d_messagePropertiesInfo,
+                      message.d_compressionAlgorithmType);
+        return;  // RETURN
+    }
+
+    dispatcher()->execute(
+        bdlf::BindUtil::bind(&Queue::onPushMessagesDispatched,
+                             this,
+                             messages),
+        this);
+}
+
 void Queue::confirmMessage(const bmqt::MessageGUID& msgGUID,
                            unsigned int             upstreamSubQueueId,
                            mqbi::QueueHandle*       source)
@@ -798,6 +892,38 @@ void Queue::confirmMessage(const bmqt::MessageGUID& msgGUID,
     }
 }
 
+void Queue::confirmMessageRange(const bmqt::MessageGUID& msgGUID,
+                                int                      count,
+                                unsigned int             upstreamSubQueueId,
+                                mqbi::QueueHandle*       source)
+{
+    // executed by the *QUEUE* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
+    BSLS_ASSERT_SAFE(0 < count);
+
+    if (d_localQueue_mp) {
+        d_localQueue_mp->confirmMessageRange(msgGUID,
+                                             count,
+                                             upstreamSubQueueId,
+                                             source);
+    }
+    else if (d_remoteQueue_mp) {
+        // Confirms are relayed upstream individually.
+        bmqt::MessageGUID guid = msgGUID;
+        for (int i = 0; i < count; ++i) {
+            if (i != 0) {
+                bmqp::MessageGUIDGenerator::loadNextGUID(&guid, guid);
+            }
+            d_remoteQueue_mp->confirmMessage(guid, upstreamSubQueueId, source);
+        }
+    }
+    else {
+        BSLS_ASSERT_OPT(false && "Uninitialized queue");
+    }
+}
+
 int Queue::rejectMessage(const bmqt::MessageGUID& msgGUID,
                          unsigned int             upstreamSubQueueId,
                          mqbi::QueueHandle*       source)
@@ -879,11 +1005,23 @@ int Queue::processCommand(mqbcmd::QueueResult*        result,
         return 0;  // RETURN
     }
     else if (command.isInternalsValue()) {
-        mqbcmd::QueueInternals& queueInternals = result->makeQueueInternals();
-        dispatcher()->execute(
-            bdlf::BindUtil::bind(&Queue::loadInternals, this, &queueInternals),
-            this);
-        dispatcher()->synchronize(this);
+        // Building the internals is expensive for the queue dispatcher
+        // thread, so reuse a recent snapshot, if any, and only ask the queue
+        // for a new one otherwise.
+        bsl::shared_ptr<const mqbcmd::QueueInternals> snapshot =
+            d_internalsSnapshot.get(k_INTERNALS_SNAPSHOT_MAX_AGE,
+                                    mwcsys::Time::highResolutionTimer());
+        if (!snapshot) {
+            dispatcher()->execute(
+                bdlf::BindUtil::bind(&Queue::publishInternalsDispatched,
+                                     this,
+                                     &snapshot),
+                this);
+            dispatcher()->synchronize(this);
+            BSLS_ASSERT_SAFE(snapshot);
+        }
+
+        result->makeQueueInternals(*snapshot);
         return 0;  // RETURN
     }
     else if (command.isMessagesValue()) {
@@ -35,6 +35,7 @@
 #include <mqbi_cluster.h>
 #include <mqbi_dispatcher.h>
 #include <mqbi_queue.h>
+#include <mqbu_snapshotholder.h>
 #include <mqbu_storagekey.h>
 
 // BMQ
@@ -115,6 +116,15 @@ class Queue BSLS_CPP11_FINAL : public mqbi::Queue {
     bslma::ManagedPtr<LocalQueue>  d_localQueue_mp;
     bslma::ManagedPtr<RemoteQueue> d_remoteQueue_mp;
 
+    bsl::shared_ptr<bmqp::CompressionDictionaryTrainer>
+        d_compressionDictionaryTrainer_sp;
+
+    mqbu::SnapshotHolder<mqbcmd::QueueInternals> d_internalsSnapshot;
+    // Latest snapshot of the internals of this
+    // queue, published by the queue dispatcher
+    // thread, and read by the threads executing
+    // the 'INTERNALS' admin command.
+
   private:
     // NOT IMPLEMENTED
     Queue(const Queue& other) BSLS_CPP11_DELETED;
@@ -145,6 +155,13 @@ class Queue BSLS_CPP11_FINAL : public mqbi::Queue {
 
     void closeDispatched();
 
+    /// Process the specified `messages` as the `e_PUSH` events
+    /// `onPushMessage` would have dispatched for each of them.
+    ///
+    /// THREAD: this method must be called from the Queue dispatcher thread.
+    void onPushMessagesDispatched(
+        const bsl::shared_ptr<mqbi::Queue::PushMessages>& messages);
+
     void convertToLocalDispatched();
 
     void updateStats();
@@ -158,6 +175,12 @@ class Queue BSLS_CPP11_FINAL : public mqbi::Queue {
     /// queue.
     void loadInternals(mqbcmd::QueueInternals* out);
 
+    /// Load into the specified `snapshot` a recent snapshot of the internal
+    /// details about this queue, publishing a new one to
+    /// `d_internalsSnapshot` unless the current one is still recent enough.
+    void publishInternalsDispatched(
+        bsl::shared_ptr<const mqbcmd::QueueInternals>* snapshot);
+
   public:
     // CREATORS
     Queue(const bmqt::Uri&                          uri,
@@ -179,6 +202,7 @@ class Queue BSLS_CPP11_FINAL : public mqbi::Queue {
     void createLocal();
     void createRemote(int                       deduplicationTimeoutMs,
                       int                       ackWindowSize,
+                      int                       pendingPutsMaxBytes,
                       RemoteQueue::StateSpPool* statePool);
 
     void convertToLocal();
@@ -273,6 +297,15 @@ class Queue BSLS_CPP11_FINAL : public mqbi::Queue {
         bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Called when the specified `messages` are pushed to this queue, to
+    /// process them as a single dispatcher event on the queue dispatcher
+    /// thread, so that they are delivered downstream in the same delivery
+    /// pass.
+    ///
+    /// THREAD: This method is called from the Cluster's dispatcher thread.
+    void onPushMessages(const bsl::shared_ptr<PushMessages>& messages)
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Confirm the message with the specified `msgGUID` for the specified
     /// `upstreamSubQueueId` stream of the queue on behalf of the client
     /// identified by the specified `source`.  Also note that since there
@@ -284,6 +317,18 @@ class Queue BSLS_CPP11_FINAL : public mqbi::Queue {
                         unsigned int             upstreamSubQueueId,
                         mqbi::QueueHandle*       source) BSLS_KEYWORD_OVERRIDE;
 
+    /// Confirm the specified `count` messages starting with the one having
+    /// the specified `msgGUID`, each subsequent message having the GUID
+    /// following the one of the previous message, for the specified
+    /// `upstreamSubQueueId` stream of the queue on behalf of the client
+    /// identified by the specified `source`.
+    ///
+    /// THREAD: This method is called from the Queue's dispatcher thread.
+    void confirmMessageRange(const bmqt::MessageGUID& msgGUID,
+                             int                      count,
+                             unsigned int             upstreamSubQueueId,
+                             mqbi::QueueHandle* source) BSLS_KEYWORD_OVERRIDE;
+
     /// Reject the message with the specified `msgGUID` for the specified
     /// `upstreamSubQueueId` stream of the queue on the specified `source`.
     ///  Return resulting RDA counter.
@@ -443,6 +488,11 @@ class Queue BSLS_CPP11_FINAL : public mqbi::Queue {
 
     /// Return the Schema Leaner associated with this queue.
     bmqp::SchemaLearner& schemaLearner() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the trainer of the ZSTD compression dictionary associated
+    /// with this queue.
+    const bsl::shared_ptr<bmqp::CompressionDictionaryTrainer>&
+    compressionDictionaryTrainer() const BSLS_KEYWORD_OVERRIDE;
 };
 
 // ============================================================================
@@ -588,6 +638,12 @@ inline bmqp::SchemaLearner& Queue::schemaLearner() const
     return d_schemaLearner;
 }
 
+inline const bsl::shared_ptr<bmqp::CompressionDictionaryTrainer>&
+Queue::compressionDictionaryTrainer() const
+{
+    return d_compressionDictionaryTrainer_sp;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
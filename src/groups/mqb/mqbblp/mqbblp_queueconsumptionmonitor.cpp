@@ -39,6 +39,8 @@
 // BDE
 #include <ball_record.h>
 #include <bdlma_localsequentialallocator.h>
+#include <bsl_algorithm.h>
+#include <bsl_functional.h>
 #include <bsl_iomanip.h>
 #include <bsl_ostream.h>
 #include <bsl_string.h>
@@ -50,6 +52,17 @@
 namespace BloombergLP {
 namespace mqbblp {
 
+namespace {
+
+/// Return `true` if the specified `head` is null or at the end of the
+/// storage, i.e. if there is no message left to deliver.
+bool isAtEnd(const bslma::ManagedPtr<mqbi::StorageIterator>& head)
+{
+    return !head || head->atEnd();
+}
+
+}  // close unnamed namespace
+
 // -------------------------------------
 // struct QueueConsumptionMonitor::State
 // -------------------------------------
@@ -128,6 +141,8 @@ const char* QueueConsumptionMonitor::Transition::toAscii(
 QueueConsumptionMonitor::SubStreamInfo::SubStreamInfo(const HeadCb& headCb)
 : d_lastKnownGoodTimer(0)
 , d_messageSent(true)
+, d_isEmpty(false)
+, d_isScheduled(false)
 , d_state(State::e_ALIVE)
 , d_headCb(headCb)
 {
@@ -138,6 +153,8 @@ QueueConsumptionMonitor::SubStreamInfo::SubStreamInfo(
     const SubStreamInfo& other)
 : d_lastKnownGoodTimer(other.d_lastKnownGoodTimer)
 , d_messageSent(other.d_messageSent)
+, d_isEmpty(other.d_isEmpty)
+, d_isScheduled(other.d_isScheduled)
 , d_state(other.d_state)
 , d_headCb(other.d_headCb)
 {
@@ -155,6 +172,10 @@ QueueConsumptionMonitor::QueueConsumptionMonitor(QueueState*       queueState,
 , d_maxIdleTime(0)
 , d_currentTimer(0)
 , d_subStreamInfos(allocator)
+, d_deadlines(allocator)
+, d_sentKeys(allocator)
+, d_emptyKeys(allocator)
+, d_idleKeys(allocator)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(d_queueState_p);
@@ -172,11 +193,19 @@ QueueConsumptionMonitor::setMaxIdleTime(bsls::Types::Int64 value)
 
     d_maxIdleTime = value;
 
+    d_deadlines.clear();
+    d_sentKeys.clear();
+    d_emptyKeys.clear();
+    d_idleKeys.clear();
+
     for (SubStreamInfoMapIter iter = d_subStreamInfos.begin(),
                               last = d_subStreamInfos.end();
          iter != last;
          ++iter) {
+        // A new 'SubStreamInfo' is checked at the next call to 'onTimer', as
+        // if a message was sent.
         iter->second = SubStreamInfo(iter->second.d_headCb);
+        d_sentKeys.push_back(iter->first);
     }
 
     return *this;
@@ -197,6 +226,7 @@ void QueueConsumptionMonitor::registerSubStream(const mqbu::StorageKey& key,
     BSLS_ASSERT_SAFE(d_subStreamInfos.find(key) == d_subStreamInfos.end());
 
     d_subStreamInfos.insert(bsl::make_pair(key, SubStreamInfo(headCb)));
+    d_sentKeys.push_back(key);
 }
 
 void QueueConsumptionMonitor::unregisterSubStream(const mqbu::StorageKey& key)
@@ -210,6 +240,9 @@ void QueueConsumptionMonitor::unregisterSubStream(const mqbu::StorageKey& key)
     SubStreamInfoMapConstIter iter = d_subStreamInfos.find(key);
     BSLS_ASSERT_SAFE(iter != d_subStreamInfos.end());
     d_subStreamInfos.erase(iter);
+
+    // The deadline and keys of the substream, if any, are discarded once
+    // they are found not to be registered anymore.
 }
 
 void QueueConsumptionMonitor::reset()
@@ -220,6 +253,10 @@ void QueueConsumptionMonitor::reset()
     d_maxIdleTime  = 0;
     d_currentTimer = 0;
     d_subStreamInfos.clear();
+    d_deadlines.clear();
+    d_sentKeys.clear();
+    d_emptyKeys.clear();
+    d_idleKeys.clear();
 }
 
 void QueueConsumptionMonitor::onTimer(bsls::Types::Int64 currentTimer)
@@ -248,49 +285,146 @@ void QueueConsumptionMonitor::onTimer(bsls::Types::Int64 currentTimer)
     // via a new method on this component. Not implemented yet because Engines
     // are about to undergo overhaul.
 
-    for (SubStreamInfoMapIter iter = d_subStreamInfos.begin(),
-                              last = d_subStreamInfos.end();
-         iter != last;
-         ++iter) {
+    // First, the substreams which were sent messages since the last call are
+    // 'alive'.
+    for (Keys::const_iterator cit = d_sentKeys.begin();
+         cit != d_sentKeys.end();
+         ++cit) {
+        SubStreamInfoMapIter iter = d_subStreamInfos.find(*cit);
+        if (iter == d_subStreamInfos.end()) {
+            // Unregistered since
+            continue;  // CONTINUE
+        }
+
         SubStreamInfo& info = iter->second;
         BSLS_ASSERT_SAFE(info.d_headCb);
-        bslma::ManagedPtr<mqbi::StorageIterator> head = info.d_headCb();
-        if (head) {
-            if (head->atEnd()) {
-                head.reset();
-            }
-        }
-        if (info.d_messageSent || !head) {
-            // Queue is 'alive' either because at least one message was sent
-            // since the last 'timer', or the queue is at its head (no more
-            // messages to deliver to this substream).
 
-            info.d_messageSent        = false;
-            info.d_lastKnownGoodTimer = d_currentTimer;
+        info.d_messageSent        = false;
+        info.d_lastKnownGoodTimer = d_currentTimer;
+        if (isAtEnd(info.d_headCb())) {
+            markEmpty(&info, iter->first);
+        }
+        else {
+            info.d_isEmpty = false;
+        }
 
-            if (info.d_state == State::e_IDLE) {
-                // object was in idle state
-                onTransitionToAlive(&(iter->second), iter->first);
-                continue;  // CONTINUE
-            }
+        if (info.d_state == State::e_IDLE) {
+            // object was in idle state
+            onTransitionToAlive(&info, iter->first);
+        }
 
-            BSLS_ASSERT_SAFE(info.d_state == State::e_ALIVE);
+        schedule(&info, iter->first);
+    }
+    d_sentKeys.clear();
+
+    // Then, the 'idle' substreams are 'alive' again once empty.
+    for (size_t i = 0; i < d_idleKeys.size();) {
+        SubStreamInfoMapIter iter = d_subStreamInfos.find(d_idleKeys[i]);
+        if (iter == d_subStreamInfos.end() ||
+            iter->second.d_state != State::e_IDLE) {
+            // Unregistered, or alive again since
+            d_idleKeys[i] = d_idleKeys.back();
+            d_idleKeys.pop_back();
             continue;  // CONTINUE
         }
 
-        if (info.d_state == State::e_IDLE) {
+        SubStreamInfo& info = iter->second;
+        BSLS_ASSERT_SAFE(info.d_headCb);
+
+        if (!isAtEnd(info.d_headCb())) {
             // state was already idle, nothing more to do
+            ++i;
+            continue;  // CONTINUE
+        }
+
+        info.d_lastKnownGoodTimer = d_currentTimer;
+        markEmpty(&info, iter->first);
+        onTransitionToAlive(&info, iter->first);
+        schedule(&info, iter->first);
+
+        d_idleKeys[i] = d_idleKeys.back();
+        d_idleKeys.pop_back();
+    }
+
+    // Finally, check the 'alive' substreams whose deadline has passed.
+    while (!d_deadlines.empty() &&
+           d_deadlines.front().first < d_currentTimer) {
+        const mqbu::StorageKey key = d_deadlines.front().second;
+        bsl::pop_heap(d_deadlines.begin(),
+                      d_deadlines.end(),
+                      bsl::greater<Deadline>());
+        d_deadlines.pop_back();
+
+        SubStreamInfoMapIter iter = d_subStreamInfos.find(key);
+        if (iter == d_subStreamInfos.end()) {
+            // Unregistered since
             continue;  // CONTINUE
         }
 
+        SubStreamInfo& info = iter->second;
+        BSLS_ASSERT_SAFE(info.d_headCb);
         BSLS_ASSERT_SAFE(info.d_state == State::e_ALIVE);
 
-        if (d_currentTimer - info.d_lastKnownGoodTimer > d_maxIdleTime) {
-            // No delivered messages in the last 'maxIdleTime'.
-            onTransitionToIdle(&(iter->second), iter->first, head);
+        info.d_isScheduled = false;
+
+        if (d_currentTimer - info.d_lastKnownGoodTimer <= d_maxIdleTime) {
+            // Stale deadline: the substream was good since it was pushed.
+            schedule(&info, key);
+            continue;  // CONTINUE
+        }
+
+        bslma::ManagedPtr<mqbi::StorageIterator> head = info.d_headCb();
+        if (isAtEnd(head)) {
+            // The queue is at its head (no more messages to deliver to this
+            // substream).
+            info.d_lastKnownGoodTimer = d_currentTimer;
+            markEmpty(&info, key);
+            schedule(&info, key);
+            continue;  // CONTINUE
+        }
+
+        if (info.d_isEmpty) {
+            // The substream was empty when last checked, and was not posted
+            // messages since (e.g., messages are redelivered): it is not
+            // known for how long it has not been empty, so the substream is
+            // considered good now.
+            info.d_isEmpty            = false;
+            info.d_lastKnownGoodTimer = d_currentTimer;
+            schedule(&info, key);
             continue;  // CONTINUE
         }
+
+        // No delivered messages in the last 'maxIdleTime'.
+        onTransitionToIdle(&info, key, head);
+        d_idleKeys.push_back(key);
+    }
+}
+
+void QueueConsumptionMonitor::schedule(SubStreamInfo*          subStreamInfo,
+                                       const mqbu::StorageKey& appKey)
+{
+    if (subStreamInfo->d_isScheduled) {
+        return;  // RETURN
     }
+
+    subStreamInfo->d_isScheduled = true;
+    d_deadlines.push_back(bsl::make_pair(
+        subStreamInfo->d_lastKnownGoodTimer + d_maxIdleTime,
+        appKey));
+    bsl::push_heap(d_deadlines.begin(),
+                   d_deadlines.end(),
+                   bsl::greater<Deadline>());
+}
+
+void QueueConsumptionMonitor::markEmpty(SubStreamInfo*          subStreamInfo,
+                                        const mqbu::StorageKey& appKey)
+{
+    if (subStreamInfo->d_isEmpty) {
+        return;  // RETURN
+    }
+
+    subStreamInfo->d_isEmpty = true;
+    d_emptyKeys.push_back(appKey);
 }
 
 void QueueConsumptionMonitor::onTransitionToAlive(
@@ -49,6 +49,15 @@
 // between '[maxIdleTime, maxIdleTime + frequency[', where 'frequency'
 // represents the time period used between two consecutive calls to 'onTimer'.
 //
+// The component does not check every substream on each call to 'onTimer':
+// the deadline at which each 'active' substream may become 'idle' is kept in
+// a min-heap, and 'onTimer' only checks the substreams which were sent
+// messages since the last call, the 'idle' substreams, and the substreams
+// whose deadline has passed.  A substream found empty is considered 'active'
+// until a message is posted to the queue, which must be notified to the
+// component via 'onMessagePosted'.  Therefore, a call to 'onTimer' on a queue
+// whose substreams are all empty or consumed costs a few comparisons.
+//
 // NOTE: the component does not assume any specific units for "time" - the sole
 // constraint is that the values passed to 'onTimer' monotonically (but not
 // strictly) increase.  Typically, these values are obtained from
@@ -111,11 +120,13 @@
 #include <ball_log.h>
 #include <bsl_unordered_map.h>
 #include <bsl_utility.h>
+#include <bsl_vector.h>
 #include <bslh_hash.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bsls_assert.h>
 #include <bsls_cpp11.h>
+#include <bsls_performancehint.h>
 #include <bsls_types.h>
 
 namespace BloombergLP {
@@ -233,6 +244,15 @@ class QueueConsumptionMonitor {
         // Whether a message was sent during
         // the last time slice
 
+        bool d_isEmpty;
+        // Whether the substream was found
+        // empty when last checked, and no
+        // message was posted since then.
+
+        bool d_isScheduled;
+        // Whether the deadline of the
+        // substream is in the heap.
+
         State::Enum d_state;  // The current state.
 
         HeadCb d_headCb;
@@ -251,6 +271,12 @@ class QueueConsumptionMonitor {
 
     typedef SubStreamInfoMap::const_iterator SubStreamInfoMapConstIter;
 
+    /// Timer, in arbitrary unit, past which the substream identified by the
+    /// key may be idle.
+    typedef bsl::pair<bsls::Types::Int64, mqbu::StorageKey> Deadline;
+
+    typedef bsl::vector<mqbu::StorageKey> Keys;
+
     // DATA
     QueueState* d_queueState_p;
     // Object representing the state of the queue
@@ -265,6 +291,25 @@ class QueueConsumptionMonitor {
 
     SubStreamInfoMap d_subStreamInfos;
 
+    bsl::vector<Deadline> d_deadlines;
+    // Min-heap of the deadlines of the
+    // 'active' substreams.  Note that a
+    // deadline may be stale, i.e. earlier
+    // than the actual one, in which case
+    // it is pushed again once it expires.
+
+    Keys d_sentKeys;
+    // Substreams which were sent messages
+    // since the last call to 'onTimer'.
+
+    Keys d_emptyKeys;
+    // Substreams found empty, whose
+    // deadline is reset by
+    // 'onMessagePosted'.
+
+    Keys d_idleKeys;
+    // Substreams in 'idle' state.
+
     // NOT IMPLEMENTED
     QueueConsumptionMonitor(const QueueConsumptionMonitor&) BSLS_CPP11_DELETED;
     QueueConsumptionMonitor&
@@ -281,6 +326,17 @@ class QueueConsumptionMonitor {
     SubStreamInfo& subStreamInfo(const mqbu::StorageKey& key);
 
     // MANIPULATORS
+
+    /// Push the deadline of the specified `subStreamInfo`, associated to
+    /// the specified `appKey`, to the heap unless it is already there.
+    void schedule(SubStreamInfo*          subStreamInfo,
+                  const mqbu::StorageKey& appKey);
+
+    /// Record that the specified `subStreamInfo`, associated to the
+    /// specified `appKey`, was found empty.
+    void markEmpty(SubStreamInfo*          subStreamInfo,
+                   const mqbu::StorageKey& appKey);
+
     void onTransitionToAlive(SubStreamInfo*          subStreamInfo,
                              const mqbu::StorageKey& appKey);
 
@@ -347,6 +403,10 @@ class QueueConsumptionMonitor {
     /// `registerSubStream`.
     void onMessageSent(const mqbu::StorageKey& key);
 
+    /// Notify the monitor that one or more messages were posted to the
+    /// queue during the current time period.
+    void onMessagePosted();
+
     // ACCESSORS
 
     /// Return the current activity status for the monitored queue for the
@@ -429,7 +489,37 @@ inline void QueueConsumptionMonitor::onMessageSent(const mqbu::StorageKey& key)
         return;  // RETURN
     }
 
-    subStreamInfo(key).d_messageSent = true;
+    SubStreamInfo& info = subStreamInfo(key);
+    if (!info.d_messageSent) {
+        info.d_messageSent = true;
+        d_sentKeys.push_back(key);
+    }
+}
+
+inline void QueueConsumptionMonitor::onMessagePosted()
+{
+    // executed by the *QUEUE DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_queueState_p->queue()->dispatcher()->inDispatcherThread(
+        d_queueState_p->queue()));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_emptyKeys.empty())) {
+        return;  // RETURN
+    }
+
+    // The substreams which were empty at the last call to 'onTimer' may not
+    // be anymore: they were last known good then.
+    for (Keys::const_iterator cit = d_emptyKeys.begin();
+         cit != d_emptyKeys.end();
+         ++cit) {
+        SubStreamInfoMapIter iter = d_subStreamInfos.find(*cit);
+        if (iter != d_subStreamInfos.end() && iter->second.d_isEmpty) {
+            iter->second.d_isEmpty            = false;
+            iter->second.d_lastKnownGoodTimer = d_currentTimer;
+        }
+    }
+    d_emptyKeys.clear();
 }
 
 inline QueueConsumptionMonitor::State::Enum
@@ -552,6 +552,45 @@ TEST_F(Test, putAliveIdleEmptyAlive)
               QueueConsumptionMonitor::State::e_ALIVE);
 }
 
+TEST_F(Test, putEmptyAliveIdle)
+// ------------------------------------------------------------------------
+// Concerns: A substream found empty remains 'alive' until a message is
+// posted, and becomes 'idle' after set period from the last time it was
+// found empty.
+//
+// Plan: Start monitoring an empty queue, make time pass beyond the idle
+// period, put message in queue and notify the component, make time pass
+// and check that state flips to 'idle' according to specs.
+// ------------------------------------------------------------------------
+{
+    const bsls::Types::Int64 k_MAX_IDLE_TIME = 10;
+
+    d_monitor.setMaxIdleTime(k_MAX_IDLE_TIME);
+
+    d_monitor.registerSubStream(
+        mqbu::StorageKey::k_NULL_KEY,
+        bdlf::BindUtil::bind(&Test::head, this, mqbu::StorageKey::k_NULL_KEY));
+
+    d_monitor.onTimer(0);
+    ASSERT_EQ(d_monitor.state(mqbu::StorageKey::k_NULL_KEY),
+              QueueConsumptionMonitor::State::e_ALIVE);
+
+    d_monitor.onTimer(k_MAX_IDLE_TIME + 5);
+    ASSERT_EQ(d_monitor.state(mqbu::StorageKey::k_NULL_KEY),
+              QueueConsumptionMonitor::State::e_ALIVE);
+
+    putMessage();
+    d_monitor.onMessagePosted();
+
+    d_monitor.onTimer(2 * k_MAX_IDLE_TIME + 5);
+    ASSERT_EQ(d_monitor.state(mqbu::StorageKey::k_NULL_KEY),
+              QueueConsumptionMonitor::State::e_ALIVE);
+
+    d_monitor.onTimer(2 * k_MAX_IDLE_TIME + 6);
+    ASSERT_EQ(d_monitor.state(mqbu::StorageKey::k_NULL_KEY),
+              QueueConsumptionMonitor::State::e_IDLE);
+}
+
 TEST_F(Test, changeMaxIdleTime)
 // ------------------------------------------------------------------------
 // Concerns: setting max idle time to new value also resets monitoring.
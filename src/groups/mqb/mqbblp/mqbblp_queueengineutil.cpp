@@ -613,6 +613,7 @@ QueueEngineUtil_AppsDeliveryContext::QueueEngineUtil_AppsDeliveryContext(
 , d_doRepeat(true)
 , d_currentMessage(0)
 , d_queue_p(queue)
+, d_deliveredHandles(allocator)
 {
     // NOTHING
 }
@@ -756,11 +757,19 @@ void QueueEngineUtil_AppsDeliveryContext::deliverMessage()
     if (d_currentMessage) {
         const mqbi::StorageMessageAttributes& attributes =
             d_currentMessage->attributes();
+
+        // The storage may fail to read the payload of the message (e.g., if
+        // spilled to disk), in which case it raised an alarm and the message
+        // is skipped rather than delivered empty.
+        const bool hasAppData = 0 != d_currentMessage->appData().get();
+
         for (Consumers::const_iterator it = d_consumers.begin();
-             it != d_consumers.end();
+             hasAppData && it != d_consumers.end();
              ++it) {
             BSLS_ASSERT_SAFE(!it->second.empty());
 
+            d_deliveredHandles.insert(it->first);
+
             if (QueueEngineUtil::isBroadcastMode(d_queue_p)) {
                 it->first->deliverMessageNoTrack(d_currentMessage->appData(),
                                                  d_currentMessage->guid(),
@@ -777,7 +786,8 @@ void QueueEngineUtil_AppsDeliveryContext::deliverMessage()
             }
         }
 
-        if (bmqp::QueueId::k_PRIMARY_QUEUE_ID == d_queue_p->id()) {
+        if (hasAppData &&
+            bmqp::QueueId::k_PRIMARY_QUEUE_ID == d_queue_p->id()) {
             QueueEngineUtil::reportQueueTimeMetric(d_queue_p->stats(),
                                                    attributes);
         }
@@ -789,6 +799,16 @@ void QueueEngineUtil_AppsDeliveryContext::deliverMessage()
     }
 }
 
+void QueueEngineUtil_AppsDeliveryContext::flushDeliveries()
+{
+    for (Handles::const_iterator it = d_deliveredHandles.begin();
+         it != d_deliveredHandles.end();
+         ++it) {
+        (*it)->flushDeliveries();
+    }
+    d_deliveredHandles.clear();
+}
+
 // -------------------------
 // struct AppConsumers_State
 // -------------------------
@@ -817,6 +837,7 @@ QueueEngineUtil_AppState::QueueEngineUtil_AppState(
 , d_appId(appId)
 , d_upstreamSubQueueId(upstreamSubQueueId)
 , d_isScheduled(false)
+, d_deliveredHandles(allocator)
 {
     // Above, we retrieve domain config from 'queue' only if self node is a
     // cluster member, and pass a dummy config if self is proxy, because proxy
@@ -878,7 +899,8 @@ QueueEngineUtil_AppState::deliverMessages(bsls::TimeInterval*     delay,
                 // Do not block other Subscriptions. Continue.
             }
             else if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
-                         result != Routers::e_SUCCESS)) {
+                         result != Routers::e_SUCCESS &&
+                         result != Routers::e_NO_DATA)) {
                 break;
             }
         }
@@ -894,6 +916,9 @@ QueueEngineUtil_AppState::deliverMessages(bsls::TimeInterval*     delay,
 
         storageIter_p->advance();
     }
+
+    flushDeliveries();
+
     return numMessages;
 }
 
@@ -962,6 +987,13 @@ Routers::Result QueueEngineUtil_AppState::tryDeliverOneMessage(
 
     BSLS_ASSERT_SAFE(result == Routers::e_SUCCESS);
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!message->appData())) {
+        // The storage failed to read the payload of the message, and raised
+        // an alarm.  Skip the message rather than deliver it empty.
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return Routers::e_NO_DATA;  // RETURN
+    }
+
     const bmqp::Protocol::SubQueueInfosArray subQueueInfos(
         1,
         bmqp::SubQueueInfo(visitor.d_downstreamSubscriptionId,
@@ -971,6 +1003,7 @@ Routers::Result QueueEngineUtil_AppState::tryDeliverOneMessage(
                                      message->attributes(),
                                      "",  // msgGroupId
                                      subQueueInfos);
+    d_deliveredHandles.insert(visitor.d_handle);
 
     visitor.d_consumer->d_timeLastMessageSent = now;
     visitor.d_consumer->d_lastSentMessage     = message->guid();
@@ -999,6 +1032,13 @@ void QueueEngineUtil_AppState::beforeMessageRemoved(
 void QueueEngineUtil_AppState::broadcastOneMessage(
     const mqbi::StorageIterator* storageIter)
 {
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!storageIter->appData())) {
+        // The storage failed to read the payload of the message, and raised
+        // an alarm.  Skip the message rather than broadcast it empty.
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;  // RETURN
+    }
+
     d_routing_sp->iterateConsumers(
         bdlf::BindUtil::bind(&QueueEngineUtil_AppState::visitBroadcast,
                              this,
@@ -1020,6 +1060,7 @@ bool QueueEngineUtil_AppState::visitBroadcast(
         message->attributes(),
         "",  // msgGroupId
         bmqp::ProtocolUtil::defaultSubQueueInfoArray());
+    d_deliveredHandles.insert(handle);
     return false;
 }
 
@@ -1036,9 +1077,25 @@ QueueEngineUtil_AppState::processDeliveryLists(bsls::TimeInterval*     delay,
         numMessages =
             processDeliveryList(delay, appKey, storage, appId, d_putAsideList);
     }
+
+    flushDeliveries();
+
     return numMessages;
 }
 
+void QueueEngineUtil_AppState::flushDeliveries()
+{
+    // executed by the *QUEUE DISPATCHER* thread
+
+    for (bsl::unordered_set<mqbi::QueueHandle*>::const_iterator it =
+             d_deliveredHandles.begin();
+         it != d_deliveredHandles.end();
+         ++it) {
+        (*it)->flushDeliveries();
+    }
+    d_deliveredHandles.clear();
+}
+
 size_t
 QueueEngineUtil_AppState::processDeliveryList(bsls::TimeInterval*     delay,
                                               const mqbu::StorageKey& appKey,
@@ -1090,6 +1147,11 @@ QueueEngineUtil_AppState::processDeliveryList(bsls::TimeInterval*     delay,
         else if (result == Routers::e_DELAY) {
             break;  // BREAK
         }
+        else if (result == Routers::e_NO_DATA) {
+            // Couldn't send it, and the storage raised an alarm; just consider
+            // it as sent, like a message missing from the storage.
+            it = list.erase(it);
+        }
         else if (result == Routers::e_SUCCESS) {
             // Remove from the redeliveryList
             it = list.erase(it);
@@ -1277,7 +1339,12 @@ bool QueueEngineUtil_AppState::transferUnconfirmedMessages(
     }                  // else there are other consumers of the given appId
 
     // Redistribute messages: append all pending messages to
-    // the redelivery list.
+    // the redelivery list.  Size the list for all of them at once, rather
+    // than rehashing it repeatedly while transferring a large number of
+    // messages.
+
+    d_redeliveryList.reserve(static_cast<size_t>(
+        handle->countUnconfirmed(subQueue.subId())));
 
     int numMsgs = handle->transferUnconfirmedMessageGUID(
         bdlf::BindUtil::bind(&RedeliveryList::add,
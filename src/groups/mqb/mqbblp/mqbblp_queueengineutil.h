@@ -292,6 +292,10 @@ class RedeliveryList {
     /// Add the specified `guid` to the list.
     void add(const bmqt::MessageGUID& guid);
 
+    /// Make room in the list for the specified `numItems` more items, so
+    /// that adding them does not rehash the list.
+    void reserve(size_t numItems);
+
     /// Empty the list.
     void clear();
 
@@ -381,6 +385,11 @@ struct QueueEngineUtil_AppState {
 
     bsls::AtomicBool d_isScheduled;
 
+    bsl::unordered_set<mqbi::QueueHandle*> d_deliveredHandles;
+    // Handles delivered messages during
+    // the current delivery pass, to flush
+    // at the end of the pass.
+
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(QueueEngineUtil_AppState,
                                    bslma::UsesBslmaAllocator)
@@ -426,8 +435,9 @@ struct QueueEngineUtil_AppState {
     /// Return true if the message was successfully delivered, or false if
     /// all consumers were busy and no one could handle the message.  The
     /// algorithm will try to deliver to highest priority consumers in a
-    /// round-robin manner, respecting their `readCount`.  Behavior is
-    /// undefined unless `appData` is non-null.
+    /// round-robin manner, respecting their `readCount`.  Return
+    /// `Routers::e_NO_DATA`, without delivering the message, if a consumer
+    /// was found but the storage could not read the payload of the message.
     Routers::Result tryDeliverOneMessage(bsls::TimeInterval*          delay,
                                          const mqbi::StorageIterator* message);
 
@@ -438,6 +448,10 @@ struct QueueEngineUtil_AppState {
     bool visitBroadcast(const mqbi::StorageIterator* message,
                         const Routers::Subscription* subscription);
 
+    /// Process delivery of messages in the redelivery list, and then in the
+    /// put-aside list unless a delay was loaded into the specified `delay`
+    /// (see `processDeliveryList`).  Return number of re-delivered
+    /// messages.
     size_t processDeliveryLists(bsls::TimeInterval*     delay,
                                 const mqbu::StorageKey& appKey,
                                 mqbi::Storage&          storage,
@@ -453,6 +467,12 @@ struct QueueEngineUtil_AppState {
                                const bsl::string&      appId,
                                RedeliveryList&         list);
 
+    /// Flush the deliveries of all the handles which were delivered
+    /// messages since the last call to this method (see
+    /// `mqbi::QueueHandle::flushDeliveries`).  Note that `deliverMessages`
+    /// and `processDeliveryLists` call this method before returning.
+    void flushDeliveries();
+
     /// Load into the specified `out` object' internal information about
     /// this consumers group and associated queue handles.
     void loadInternals(mqbcmd::AppState* out) const;
@@ -527,10 +547,13 @@ struct QueueEngineUtil_AppsDeliveryContext {
                                bmqp::Protocol::SubQueueInfosArray>
         Consumers;
 
+    typedef bsl::unordered_set<mqbi::QueueHandle*> Handles;
+
     Consumers              d_consumers;
     bool                   d_doRepeat;
     mqbi::StorageIterator* d_currentMessage;
     mqbi::Queue*           d_queue_p;
+    Handles                d_deliveredHandles;
 
     QueueEngineUtil_AppsDeliveryContext(mqbi::Queue*      queue,
                                         bslma::Allocator* allocator);
@@ -545,8 +568,15 @@ struct QueueEngineUtil_AppsDeliveryContext {
                const mqbi::StorageIterator* message);
     bool visitBroadcast(const Routers::Subscription* subscription);
 
-    /// Deliver message to the previously processed handles.
+    /// Deliver message to the previously processed handles.  Note that the
+    /// messages reach the handles' clients only upon `flushDeliveries`.
     void deliverMessage();
+
+    /// Flush the deliveries of all the handles which were delivered
+    /// messages since the last call to this method (see
+    /// `mqbi::QueueHandle::flushDeliveries`).  This method must be called
+    /// once done delivering messages with this context.
+    void flushDeliveries();
 };
 
 // ============================================================================
@@ -596,6 +626,11 @@ inline void RedeliveryList::add(const bmqt::MessageGUID& guid)
     d_map.insert(bsl::make_pair(guid, Item()));
 }
 
+inline void RedeliveryList::reserve(size_t numItems)
+{
+    d_map.reserve(d_map.size() + numItems);
+}
+
 inline void RedeliveryList::clear()
 {
     d_map.clear();
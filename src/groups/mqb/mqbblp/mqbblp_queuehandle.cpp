@@ -25,6 +25,7 @@
 #include <mqbi_storage.h>
 
 // BMQ
+#include <bmqp_messageguidgenerator.h>
 #include <bmqp_protocol.h>
 #include <bmqp_queueid.h>
 #include <bmqp_queueutil.h>
@@ -61,6 +62,10 @@ namespace {
 const double k_WATERMARK_RATIO = 0.8;
 // Percentage of the 'capacity' to use for the 'lowWatermark'
 
+const bsls::Types::Uint64 k_PUT_TRACE_SAMPLING_INTERVAL = 1024;
+// One PUT message out of this many posted through a handle has its
+// latency traced through the broker.
+
 typedef bsl::function<void()> CompletionCallback;
 
 /// Utility function used in `mwcu::OperationChain` as the operation
@@ -95,11 +100,47 @@ const bsl::string& QueueHandle::Subscription::appId() const
     return d_downstream->d_appId;
 }
 
+// -------------------------------
+// struct QueueHandle::PushMessage
+// -------------------------------
+
+// CREATORS
+QueueHandle::PushMessage::PushMessage(
+    const bsl::shared_ptr<bdlbb::Blob>&       blob,
+    const bmqt::MessageGUID&                  guid,
+    const bmqp::MessagePropertiesInfo&        mpsInfo,
+    const bmqp::Protocol::SubQueueInfosArray& subQueueInfos,
+    const bmqp::Protocol::MsgGroupId&         msgGroupId,
+    bmqt::CompressionAlgorithmType::Enum      compressionType,
+    bslma::Allocator*                         allocator)
+: d_blob(blob)
+, d_guid(guid)
+, d_messagePropertiesInfo(mpsInfo)
+, d_subQueueInfos(subQueueInfos, allocator)
+, d_msgGroupId(msgGroupId, allocator)
+, d_compressionAlgorithmType(compressionType)
+{
+    // NOTHING
+}
+
+QueueHandle::PushMessage::PushMessage(const PushMessage& other,
+                                      bslma::Allocator*  allocator)
+: d_blob(other.d_blob)
+, d_guid(other.d_guid)
+, d_messagePropertiesInfo(other.d_messagePropertiesInfo)
+, d_subQueueInfos(other.d_subQueueInfos, allocator)
+, d_msgGroupId(other.d_msgGroupId, allocator)
+, d_compressionAlgorithmType(other.d_compressionAlgorithmType)
+{
+    // NOTHING
+}
+
 // -----------------
 // class QueueHandle
 // -----------------
 
 void QueueHandle::confirmMessageDispatched(const bmqt::MessageGUID& msgGUID,
+                                           int                      count,
                                            unsigned int downstreamSubQueueId)
 {
     // executed by the *QUEUE_DISPATCHER* thread
@@ -165,12 +206,106 @@ void QueueHandle::confirmMessageDispatched(const bmqt::MessageGUID& msgGUID,
     // occurs.
     // Update unconfirmed messages list and stats
 
-    updateMonitor(subStream, msgGUID, bmqp::EventType::e_CONFIRM);
+    bmqt::MessageGUID guid = msgGUID;
+    for (int i = 0; i < count; ++i) {
+        if (i != 0) {
+            bmqp::MessageGUIDGenerator::loadNextGUID(&guid, guid);
+        }
+        updateMonitor(subStream, guid, bmqp::EventType::e_CONFIRM);
+    }
 
     // Inform the queue about that confirm.
     // TBD: Consider doing these consistency checks at entry point (i.e. in
     // 'onConfirmEvent' in 'ClientSession' and 'Cluster')?
-    d_queue_sp->confirmMessage(msgGUID, upstreamSubQueueId, this);
+    if (count == 1) {
+        d_queue_sp->confirmMessage(msgGUID, upstreamSubQueueId, this);
+    }
+    else {
+        d_queue_sp->confirmMessageRange(msgGUID,
+                                        count,
+                                        upstreamSubQueueId,
+                                        this);
+    }
+}
+
+void QueueHandle::postMessagesDispatched(
+    const bsl::shared_ptr<mqbi::QueueHandle::PutMessages>& messages,
+    bsls::Types::Int64                                     traceTimepoint)
+{
+    // executed by the *QUEUE_DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(
+        d_queue_sp->dispatcher()->inDispatcherThread(d_queue_sp.get()));
+
+    // Feed the queue with the very events 'postMessage' would have
+    // dispatched, so that batched messages are processed exactly like
+    // individual ones.  A single event is reused for the whole batch.
+    mqbi::DispatcherEvent event(d_allocator_p);
+    event.setType(mqbi::DispatcherEventType::e_PUT)
+        .setSource(d_clientContext_sp->client())
+        .setDestination(d_queue_sp.get())
+        .setQueueHandle(this)
+        .setTraceTimepoint(traceTimepoint);
+
+    for (PutMessages::const_iterator it = messages->begin();
+         it != messages->end();
+         ++it) {
+        event.setBlob(it->d_appData)
+            .setOptions(it->d_options)
+            .setPutHeader(it->d_header);
+        d_queue_sp->onDispatcherEvent(event);
+        event.setTraceTimepoint(0);
+    }
+}
+
+bsls::Types::Int64 QueueHandle::samplePostedMessages(int numMessages)
+{
+    // executed by the *CLUSTER_DISPATCHER* or *CLIENT_DISPATCHER* thread
+
+    const bsls::Types::Uint64 previous = d_numPostedMessages;
+    d_numPostedMessages += numMessages;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+            previous / k_PUT_TRACE_SAMPLING_INTERVAL ==
+            d_numPostedMessages / k_PUT_TRACE_SAMPLING_INTERVAL)) {
+        return 0;  // RETURN
+    }
+
+    return mwcsys::Time::highResolutionTimer();
+}
+
+void QueueHandle::pushMessagesDispatched(
+    mqbi::DispatcherClient*              client,
+    mqbi::Queue*                         queue,
+    int                                  queueId,
+    const bsl::shared_ptr<PushMessages>& messages)
+{
+    // executed by the *CLIENT* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(client->dispatcher()->inDispatcherThread(client));
+
+    // Feed the client with the very events 'flushDeliveries' would have
+    // dispatched, so that batched messages are processed exactly like
+    // individual ones.  A single event is reused for the whole batch.
+    mqbi::DispatcherEvent event(messages->get_allocator().mechanism());
+    event.setType(mqbi::DispatcherEventType::e_PUSH)
+        .setSource(queue)
+        .setDestination(client)
+        .setQueueId(queueId);
+
+    for (PushMessages::const_iterator it = messages->begin();
+         it != messages->end();
+         ++it) {
+        event.setBlob(it->d_blob)
+            .setGuid(it->d_guid)
+            .setMessagePropertiesInfo(it->d_messagePropertiesInfo)
+            .setSubQueueInfos(it->d_subQueueInfos)
+            .setMsgGroupId(it->d_msgGroupId)
+            .setCompressionAlgorithmType(it->d_compressionAlgorithmType);
+        client->onDispatcherEvent(event);
+    }
 }
 
 void QueueHandle::rejectMessageDispatched(const bmqt::MessageGUID& msgGUID,
@@ -460,6 +595,32 @@ void QueueHandle::clearClientDispatched(bool hasLostClient)
     }
 }
 
+void QueueHandle::onClientUnthrottledDispatched()
+{
+    // executed by the *QUEUE_DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(
+        d_queue_sp->dispatcher()->inDispatcherThread(d_queue_sp.get()));
+
+    if (!d_clientContext_sp || d_isClientThrottled) {
+        // The client is gone, or was throttled again in the meantime.
+        return;  // RETURN
+    }
+
+    // Messages which were not delivered while the client was throttled are
+    // still in the queue: resume delivering them from where the queue left.
+    for (Subscriptions::const_iterator cit = d_subscriptions.begin();
+         cit != d_subscriptions.end();
+         ++cit) {
+        if (canDeliver(cit->first)) {
+            d_queue_sp->queueEngine()->onHandleUsable(
+                this,
+                cit->second->d_upstreamId);
+        }
+    }
+}
+
 void QueueHandle::deliverMessageImpl(
     const bsl::shared_ptr<bdlbb::Blob>&       message,
     const int                                 msgSize,
@@ -481,26 +642,23 @@ void QueueHandle::deliverMessageImpl(
     d_domainStats_p->onEvent(mqbstat::QueueStatsDomain::EventType::e_PUSH,
                              msgSize);
 
-    // Create an event to dispatch delivery of the message to the client
-    mqbi::DispatcherClient* client = d_clientContext_sp->client();
-    mqbi::DispatcherEvent*  event  = client->dispatcher()->getEvent(client);
-    (*event)
-        .setType(mqbi::DispatcherEventType::e_PUSH)
-        .setSource(d_queue_sp.get())
-        .setGuid(msgGUID)
-        .setQueueId(id())
-        .setMessagePropertiesInfo(d_queue_sp->schemaLearner().demultiplex(
-            d_schemaLearnerPushContext,
-            attributes.messagePropertiesInfo()))
-        .setSubQueueInfos(subQueueInfos)
-        .setMsgGroupId(msgGroupId)
-        .setCompressionAlgorithmType(attributes.compressionAlgorithmType());
-
-    if (message) {
-        event->setBlob(message);
+    // Keep the message until 'flushDeliveries', so that all the messages
+    // delivered to this handle during a delivery pass of the queue reach the
+    // client at once.
+    if (!d_pushMessages_sp) {
+        d_pushMessages_sp.createInplace(d_allocator_p, d_allocator_p);
     }
 
-    client->dispatcher()->dispatchEvent(event, client);
+    d_pushMessages_sp->push_back(PushMessage(
+        message,
+        msgGUID,
+        d_queue_sp->schemaLearner().demultiplex(
+            d_schemaLearnerPushContext,
+            attributes.messagePropertiesInfo()),
+        subQueueInfos,
+        msgGroupId,
+        attributes.compressionAlgorithmType(),
+        d_allocator_p));
 }
 
 QueueHandle::QueueHandle(
@@ -523,6 +681,9 @@ QueueHandle::QueueHandle(
       d_queue_sp ? d_queue_sp->schemaLearner().createContext() : 0)
 , d_schemaLearnerPushContext(
       d_queue_sp ? d_queue_sp->schemaLearner().createContext() : 0)
+, d_pushMessages_sp()
+, d_isClientThrottled(false)
+, d_numPostedMessages(0)
 , d_allocator_p(allocator)
 {
     // PRECONDITIONS
@@ -751,7 +912,22 @@ void QueueHandle::confirmMessage(const bmqt::MessageGUID& msgGUID,
     // A more generic approach would be to maintain a queue of CONFIRMs per
     // queue (outside of the dispatcher) and process it separately (on idle?).
 
-    QueueHandle::ConfirmFunctor f(this, msgGUID, downstreamSubQueueId);
+    QueueHandle::ConfirmFunctor f(this, msgGUID, 1, downstreamSubQueueId);
+
+    d_queue_sp->dispatcher()->execute(f, d_queue_sp.get());
+}
+
+void QueueHandle::confirmMessageRange(const bmqt::MessageGUID& msgGUID,
+                                      int                      count,
+                                      unsigned int downstreamSubQueueId)
+{
+    // executed by *ANY* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 < count);
+
+    // Enqueue a single event to process the whole range on the queue thread
+    QueueHandle::ConfirmFunctor f(this, msgGUID, count, downstreamSubQueueId);
 
     d_queue_sp->dispatcher()->execute(f, d_queue_sp.get());
 }
@@ -911,6 +1087,55 @@ void QueueHandle::deliverMessage(
                        targetSubscriptions);
 }
 
+void QueueHandle::flushDeliveries()
+{
+    // executed by the *QUEUE_DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(
+        d_queue_sp->dispatcher()->inDispatcherThread(d_queue_sp.get()));
+
+    if (!d_pushMessages_sp || d_pushMessages_sp->empty()) {
+        return;  // RETURN
+    }
+
+    mqbi::DispatcherClient* client = d_clientContext_sp->client();
+
+    if (d_pushMessages_sp->size() > 1) {
+        // Hand the whole batch over to the client in a single event, and
+        // start a new batch: the client owns this one from now on.
+        client->dispatcher()->execute(
+            bdlf::BindUtil::bind(&QueueHandle::pushMessagesDispatched,
+                                 client,
+                                 d_queue_sp.get(),
+                                 id(),
+                                 d_pushMessages_sp),
+            client);
+        d_pushMessages_sp.reset();
+        return;  // RETURN
+    }
+
+    // Create an event to dispatch delivery of the message to the client
+    const PushMessage&     message = d_pushMessages_sp->front();
+    mqbi::DispatcherEvent* event   = client->dispatcher()->getEvent(client);
+    (*event)
+        .setType(mqbi::DispatcherEventType::e_PUSH)
+        .setSource(d_queue_sp.get())
+        .setGuid(message.d_guid)
+        .setQueueId(id())
+        .setMessagePropertiesInfo(message.d_messagePropertiesInfo)
+        .setSubQueueInfos(message.d_subQueueInfos)
+        .setMsgGroupId(message.d_msgGroupId)
+        .setCompressionAlgorithmType(message.d_compressionAlgorithmType);
+
+    if (message.d_blob) {
+        event->setBlob(message.d_blob);
+    }
+
+    client->dispatcher()->dispatchEvent(event, client);
+    d_pushMessages_sp->clear();
+}
+
 void QueueHandle::postMessage(const bmqp::PutHeader&              putHeader,
                               const bsl::shared_ptr<bdlbb::Blob>& appData,
                               const bsl::shared_ptr<bdlbb::Blob>& options)
@@ -933,11 +1158,32 @@ void QueueHandle::postMessage(const bmqp::PutHeader&              putHeader,
         .setBlob(appData)
         .setOptions(options)
         .setPutHeader(putHeader)
-        .setQueueHandle(this);
+        .setQueueHandle(this)
+        .setTraceTimepoint(samplePostedMessages(1));
 
     d_queue_sp->dispatcher()->dispatchEvent(event, d_queue_sp.get());
 }
 
+void QueueHandle::postMessages(const bsl::shared_ptr<PutMessages>& messages)
+{
+    // executed by the *CLUSTER_DISPATCHER* or *CLIENT_DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(
+        d_clientContext_sp->client()->dispatcher()->inDispatcherThread(
+            d_clientContext_sp->client()));
+    BSLS_ASSERT_SAFE(messages && !messages->empty());
+
+    // Enqueue a single event to post the whole batch on the queue thread
+    d_queue_sp->dispatcher()->execute(
+        bdlf::BindUtil::bind(
+            &QueueHandle::postMessagesDispatched,
+            this,
+            messages,
+            samplePostedMessages(static_cast<int>(messages->size()))),
+        d_queue_sp.get());
+}
+
 void QueueHandle::configure(
     const bmqp_ctrlmsg::StreamParameters&              streamParameters,
     const mqbi::QueueHandle::HandleConfiguredCallback& configuredCb)
@@ -1059,6 +1305,23 @@ void QueueHandle::clearClient(bool hasLostClient)
         d_queue_sp.get());
 }
 
+void QueueHandle::setClientThrottled(bool value)
+{
+    // executed by *ANY* thread
+
+    if (d_isClientThrottled.swap(value) == value || value) {
+        // No change, or the client is now throttled: 'canDeliver' returns
+        // 'false' from now on.
+        return;  // RETURN
+    }
+
+    // Enqueue an event to resume the delivery in the queue thread.
+    d_queue_sp->dispatcher()->execute(
+        bdlf::BindUtil::bind(&QueueHandle::onClientUnthrottledDispatched,
+                             this),
+        d_queue_sp.get());
+}
+
 int QueueHandle::transferUnconfirmedMessageGUID(
     const mqbi::RedeliveryVisitor& out,
     unsigned int                   subQueueId)
@@ -1200,7 +1463,7 @@ bool QueueHandle::canDeliver(unsigned int downstreamSubscriptionId) const
 
     BSLS_ASSERT_SAFE(cit != d_subscriptions.end());
 
-    return d_clientContext_sp &&
+    return d_clientContext_sp && !d_isClientThrottled &&
            (cit->second->d_unconfirmedMonitor.state() !=
             mqbu::ResourceUsageMonitorState::e_STATE_FULL);
 }
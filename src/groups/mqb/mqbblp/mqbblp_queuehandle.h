@@ -33,6 +33,8 @@
 
 // BMQ
 #include <bmqp_ctrlmsg_messages.h>
+#include <bmqp_protocol.h>
+#include <bmqt_compressionalgorithmtype.h>
 #include <bmqt_messageguid.h>
 
 // MWC
@@ -45,10 +47,13 @@
 #include <bsl_list.h>
 #include <bsl_memory.h>
 #include <bsl_unordered_map.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_atomic.h>
 #include <bsls_performancehint.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 
@@ -137,12 +142,14 @@ class QueueHandle : public mqbi::QueueHandle {
         // PRIVATE DATA
         QueueHandle*      d_owner_p;
         bmqt::MessageGUID d_guid;
+        int               d_count;
         unsigned int      d_downstreamSubQueueId;
 
       public:
         // CREATORS
         ConfirmFunctor(QueueHandle*      owner_p,
                        bmqt::MessageGUID guid,
+                       int               count,
                        unsigned int      downstreamSubQueueId);
 
         void operator()();
@@ -154,6 +161,39 @@ class QueueHandle : public mqbi::QueueHandle {
     /// subQueueId -> subStreamContext
     typedef bsl::unordered_map<unsigned int, SubscriptionSp> Subscriptions;
 
+  private:
+    // PRIVATE TYPES
+
+    /// PUSH message delivered to this handle by the queue, pending dispatch
+    /// to the client (see `flushDeliveries`).
+    struct PushMessage {
+        // DATA
+        bsl::shared_ptr<bdlbb::Blob>         d_blob;
+        bmqt::MessageGUID                    d_guid;
+        bmqp::MessagePropertiesInfo          d_messagePropertiesInfo;
+        bmqp::Protocol::SubQueueInfosArray   d_subQueueInfos;
+        bmqp::Protocol::MsgGroupId           d_msgGroupId;
+        bmqt::CompressionAlgorithmType::Enum d_compressionAlgorithmType;
+
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(PushMessage,
+                                       bslma::UsesBslmaAllocator)
+
+        // CREATORS
+        PushMessage(const bsl::shared_ptr<bdlbb::Blob>&       blob,
+                    const bmqt::MessageGUID&                  guid,
+                    const bmqp::MessagePropertiesInfo&        mpsInfo,
+                    const bmqp::Protocol::SubQueueInfosArray& subQueueInfos,
+                    const bmqp::Protocol::MsgGroupId&         msgGroupId,
+                    bmqt::CompressionAlgorithmType::Enum      compressionType,
+                    bslma::Allocator*                         allocator);
+
+        PushMessage(const PushMessage& other, bslma::Allocator* allocator);
+    };
+
+    /// Batch of PUSH messages, in the order they were delivered.
+    typedef bsl::vector<PushMessage> PushMessages;
+
   private:
     // DATA
     bsl::shared_ptr<mqbi::Queue> d_queue_sp;
@@ -208,17 +248,67 @@ class QueueHandle : public mqbi::QueueHandle {
 
     bmqp::SchemaLearner::Context d_schemaLearnerPushContext;
 
+    bsl::shared_ptr<PushMessages> d_pushMessages_sp;
+    // PUSH messages delivered by the queue
+    // since the last 'flushDeliveries' and
+    // not yet dispatched to the client.
+
+    bsls::AtomicBool d_isClientThrottled;
+    // Flag indicating whether the client
+    // is currently unable to write the
+    // messages delivered to it (see
+    // 'setClientThrottled').
+
+    bsls::Types::Uint64 d_numPostedMessages;
+    // Number of PUT messages posted through
+    // this handle, used to sample the
+    // messages traced through the broker.
+    // Only accessed from the client
+    // dispatcher thread.
+
     bslma::Allocator* d_allocator_p;
     // Allocator to use.
 
   private:
     // PRIVATE MANIPULATORS
+    /// Confirm the specified `count` messages starting with the one having
+    /// the specified `msgGUID`, each subsequent message having the GUID
+    /// following the one of the previous message, for the specified
+    /// `downstreamSubQueueId` stream of the queue.
     void confirmMessageDispatched(const bmqt::MessageGUID& msgGUID,
+                                  int                      count,
                                   unsigned int downstreamSubQueueId);
 
     void rejectMessageDispatched(const bmqt::MessageGUID& msgGUID,
                                  unsigned int downstreamSubQueueId);
 
+    /// Post the specified `messages` to the queue, each as the `e_PUT`
+    /// event `postMessage` would have dispatched for it.  If the specified
+    /// `traceTimepoint` is not 0, the first message is traced through the
+    /// broker as posted at that high resolution timepoint.
+    ///
+    /// THREAD: this method must be called from the Queue dispatcher thread.
+    void postMessagesDispatched(
+        const bsl::shared_ptr<mqbi::QueueHandle::PutMessages>& messages,
+        bsls::Types::Int64                                     traceTimepoint);
+
+    /// Return the high resolution timepoint at which the specified
+    /// `numMessages` messages about to be posted are sampled for latency
+    /// tracing, or 0 if they are not.
+    bsls::Types::Int64 samplePostedMessages(int numMessages);
+
+    /// Process the specified `messages`, delivered by the specified `queue`
+    /// for the specified `queueId`, on the specified `client`, each as the
+    /// `e_PUSH` event `flushDeliveries` would have dispatched for it.
+    ///
+    /// THREAD: this method must be called from the client dispatcher
+    ///         thread.
+    static void
+    pushMessagesDispatched(mqbi::DispatcherClient*              client,
+                           mqbi::Queue*                         queue,
+                           int                                  queueId,
+                           const bsl::shared_ptr<PushMessages>& messages);
+
     mqbu::ResourceUsageMonitorStateTransition::Enum
     updateMonitor(const bsl::shared_ptr<Downstream>& subStream,
                   const bmqt::MessageGUID&           msgGUID,
@@ -241,12 +331,20 @@ class QueueHandle : public mqbi::QueueHandle {
     /// THREAD: this method is invoked only from queue dispatcher thread.
     void clearClientDispatched(bool hasLostClient);
 
+    /// Schedule a delivery for all the subscriptions which can be delivered
+    /// to, now that the client is no longer throttled.
+    ///
+    /// THREAD: this method is invoked only from queue dispatcher thread.
+    void onClientUnthrottledDispatched();
+
     /// Called by the `Queue` to deliver the specified `message` with the
     /// specified `msgSize`, `msgGUID`, `attributes` and `msgGroupId` for
     /// the specified `subQueueInfos` streams of the queue.  The behavior is
     /// undefined unless the queueHandle can send a message at this time for
     /// all of the `subQueueInfos` streams (see 'canDeliver(unsigned int
     /// subQueueId)' for more information).
+    /// The message is dispatched to the client on the next call to
+    /// `flushDeliveries`.
     ///
     /// THREAD: This method is called from the Queue's dispatcher thread.
     void deliverMessageImpl(
@@ -400,6 +498,14 @@ class QueueHandle : public mqbi::QueueHandle {
         const bmqp::Protocol::SubQueueInfosArray& subQueueInfos)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Dispatch to the client the messages delivered to this handle since
+    /// the last call to this method: as a single `e_PUSH` event if only one
+    /// message was delivered, or as a single event processing the whole
+    /// batch on the client dispatcher thread otherwise.
+    ///
+    /// THREAD: This method is called from the Queue's dispatcher thread.
+    void flushDeliveries() BSLS_KEYWORD_OVERRIDE;
+
     /// Post the message with the specified PUT `header`, `appData` and
     /// `options` to the queue.
     ///
@@ -411,6 +517,15 @@ class QueueHandle : public mqbi::QueueHandle {
                      const bsl::shared_ptr<bdlbb::Blob>& options)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Post the specified `messages` to the queue, in order, handing them
+    /// over to the Queue's dispatcher thread with a single event.
+    ///
+    /// THREAD: this method can be called from any thread and is responsible
+    ///         for calling the corresponding method on the `Queue`, on the
+    ///         Queue's dispatcher thread.
+    void postMessages(const bsl::shared_ptr<PutMessages>& messages)
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Used by the client to configure a given queue handle with the
     /// specified `streamParameters`.  Invoke the specified `configuredCb`
     /// when done.
@@ -443,6 +558,13 @@ class QueueHandle : public mqbi::QueueHandle {
     /// Clear the client associated with this queue handle.
     void clearClient(bool hasLostClient) BSLS_KEYWORD_OVERRIDE;
 
+    /// Set whether the client is throttled to the specified `value`.  No
+    /// message is delivered to a throttled client, and a delivery is
+    /// scheduled once it is no longer throttled.
+    ///
+    /// THREAD: this method can be called from any thread.
+    void setClientThrottled(bool value) BSLS_KEYWORD_OVERRIDE;
+
     /// Transfer into the specified `out`, the GUID of all messages
     /// associated with the specified `subQueueId` which were delivered to
     /// the client, but that haven't yet been confirmed by it (i.e. the
@@ -493,6 +615,19 @@ class QueueHandle : public mqbi::QueueHandle {
     confirmMessage(const bmqt::MessageGUID& msgGUID,
                    unsigned int downstreamSubQueueId) BSLS_KEYWORD_OVERRIDE;
 
+    /// Confirm the specified `count` messages starting with the one having
+    /// the specified `msgGUID`, each subsequent message having the GUID
+    /// following the one of the previous message, for the specified
+    /// `downstreamSubQueueId` stream of the queue.
+    ///
+    /// THREAD: this method can be called from any thread and is responsible
+    ///         for calling the corresponding method on the `Queue`, on the
+    ///         Queue's dispatcher thread.
+    void confirmMessageRange(const bmqt::MessageGUID& msgGUID,
+                             int                      count,
+                             unsigned int downstreamSubQueueId)
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Reject the message with the specified `msgGUID` for the specified
     /// `subscriptionId` subscription of the queue.
     ///
@@ -675,9 +810,11 @@ inline QueueHandle::Downstream::Downstream(const bsl::string& appId,
 inline QueueHandle::ConfirmFunctor::ConfirmFunctor(
     QueueHandle*      owner,
     bmqt::MessageGUID guid,
+    int               count,
     unsigned int      downstreamSubQueueId)
 : d_owner_p(owner)
 , d_guid(guid)
+, d_count(count)
 , d_downstreamSubQueueId(downstreamSubQueueId)
 {
     // NOTHING
@@ -685,7 +822,9 @@ inline QueueHandle::ConfirmFunctor::ConfirmFunctor(
 
 inline void QueueHandle::ConfirmFunctor::operator()()
 {
-    d_owner_p->confirmMessageDispatched(d_guid, d_downstreamSubQueueId);
+    d_owner_p->confirmMessageDispatched(d_guid,
+                                        d_count,
+                                        d_downstreamSubQueueId);
 }
 
 }  // close package namespace
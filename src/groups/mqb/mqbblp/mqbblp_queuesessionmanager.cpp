@@ -22,6 +22,8 @@
 // See notes in mqba_clientsession.cpp with regards to shutdown handling.
 
 // MQB
+#include <mqbcfg_brokerconfig.h>
+#include <mqbcfg_messages.h>
 #include <mqbconfm_messages.h>
 #include <mqbi_cluster.h>
 #include <mqbi_dispatcher.h>
@@ -309,6 +311,18 @@ void QueueSessionManager::onQueueOpenCbDispatched(
         if (ins.second) {
             // First time we use this queue
             qs.d_handle_p = queueHandle;
+
+            const mqbcfg::AppConfig& brkrCfg = mqbcfg::BrokerConfig::get();
+            if (!brkrCfg.networkInterfaces().tcpInterface().isNull()) {
+                const int rate = brkrCfg.networkInterfaces()
+                                     .tcpInterface()
+                                     .value()
+                                     .queuePutRateLimit();
+                if (rate > 0) {
+                    // Allow bursts of up to one second worth of messages
+                    qs.d_putRateLimiter.initialize(rate, rate);
+                }
+            }
         }
         else {
             // We've used this queue before.  Search for the subId in the
@@ -30,6 +30,7 @@
 
 #include <mqbi_domain.h>
 #include <mqbi_queue.h>
+#include <mqbu_tokenbucket.h>
 
 // BMQ
 #include <bmqp_ctrlmsg_messages.h>
@@ -136,6 +137,12 @@ class QueueSessionManager {
         StreamsMap d_subQueueInfosMap;
         // Map of subQueueId to information associated to
         // a substream of a queue opened in this session
+
+        mqbu::TokenBucket d_putRateLimiter;
+        // Limiter of the rate of PUT messages posted to
+        // this queue by this session, disabled unless
+        // configured with a 'queuePutRateLimit'.
+
         // TRAITS
         BSLMF_NESTED_TRAIT_DECLARATION(QueueState, bslma::UsesBslmaAllocator)
 
@@ -377,6 +384,7 @@ inline QueueSessionManager::QueueState::QueueState(bslma::Allocator* allocator)
 : d_handle_p(0)
 , d_hasReceivedFinalCloseQueue(false)
 , d_subQueueInfosMap(allocator)
+, d_putRateLimiter()
 {
     // NOTHING
 }
@@ -386,6 +394,7 @@ inline QueueSessionManager::QueueState::QueueState(const QueueState& original,
 : d_handle_p(original.d_handle_p)
 , d_hasReceivedFinalCloseQueue(original.d_hasReceivedFinalCloseQueue)
 , d_subQueueInfosMap(original.d_subQueueInfosMap, allocator)
+, d_putRateLimiter(original.d_putRateLimiter)
 {
     // NOTHING
 }
@@ -70,7 +70,7 @@ QueueState::QueueState(mqbi::Queue*            queue,
 , d_stats()
 , d_messageThrottleConfig()
 , d_handleCatalog(queue, allocator)
-, d_context(queue->schemaLearner(), allocator)
+, d_context(allocator)
 , d_subStreams(allocator)
 {
     setKey(key);
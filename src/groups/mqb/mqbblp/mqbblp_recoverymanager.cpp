@@ -3449,18 +3449,45 @@ void RecoveryManager::processRecoveryEvent(
                                   header.headerWords()) *
                                  bmqp::Protocol::k_WORD_SIZE;
 
-        // Perform md5 digest check only if chunk is of non-zero size.  Note
-        // that if chunkSize is zero,
+        mqbs::MappedFileDescriptor* mfd    = 0;
+        bsls::Types::Uint64         offset = 0;
+
+        if (isData) {
+            mfd    = &recoveryCtx.dataFd();
+            offset = recoveryCtx.dataFileOffset();
+        }
+        else if (isQlist) {
+            mfd    = &recoveryCtx.qlistFd();
+            offset = recoveryCtx.qlistFileOffset();
+        }
+        else {
+            BSLS_ASSERT_SAFE(isJournal);
+            mfd    = &recoveryCtx.journalFd();
+            offset = recoveryCtx.journalFileOffset();
+        }
+
+        // 'offset' can be zero if we are writing from the beginning of the
+        // file.
+
+        BSLS_ASSERT_SAFE(mfd);
+
+        // Copy the chunk to the file and perform md5 digest check only if
+        // chunk is of non-zero size.  Note that if chunkSize is zero,
         // 'RecoveryMessageIterator::loadChunkPosition' will still return
         // success, but 'chunkPosition' will point to an invalid position (the
-        // buffer index will be invalid).
+        // buffer index will be invalid).  The chunk is copied while its
+        // digest is calculated, so that it is read only once.  In case of a
+        // digest mismatch, the copied bytes are beyond the current offset of
+        // the file and the recovery is stopped, so they are never used.
 
         if (0 != chunkSize) {
             bdlde::Md5::Md5Digest md5Digest;
-            rc = mqbs::FileStoreProtocolUtil::calculateMd5Digest(&md5Digest,
-                                                                 *blob,
-                                                                 chunkPosition,
-                                                                 chunkSize);
+            rc = mqbs::FileStoreProtocolUtil::copyAndCalculateMd5Digest(
+                &md5Digest,
+                mfd->block().base() + offset,
+                *blob,
+                chunkPosition,
+                chunkSize);
             if (0 != rc) {
                 MWCTSK_ALARMLOG_ALARM("RECOVERY")
                     << d_clusterData_p->identity().description()
@@ -3525,35 +3552,7 @@ void RecoveryManager::processRecoveryEvent(
             }
         }
 
-        mqbs::MappedFileDescriptor* mfd    = 0;
-        bsls::Types::Uint64         offset = 0;
-
-        if (isData) {
-            mfd    = &recoveryCtx.dataFd();
-            offset = recoveryCtx.dataFileOffset();
-        }
-        else if (isQlist) {
-            mfd    = &recoveryCtx.qlistFd();
-            offset = recoveryCtx.qlistFileOffset();
-        }
-        else {
-            BSLS_ASSERT_SAFE(isJournal);
-            mfd    = &recoveryCtx.journalFd();
-            offset = recoveryCtx.journalFileOffset();
-        }
-
-        // 'offset' can be zero if we are writing from the beginning of the
-        // file.
-
-        BSLS_ASSERT_SAFE(mfd);
-
         if (0 != chunkSize) {
-            mwcu::BlobUtil::copyToRawBufferFromIndex(mfd->block().base() +
-                                                         offset,
-                                                     *blob,
-                                                     chunkPosition.buffer(),
-                                                     chunkPosition.byte(),
-                                                     chunkSize);
             // Update offset.
 
             if (isData) {
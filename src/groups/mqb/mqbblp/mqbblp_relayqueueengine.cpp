@@ -602,6 +602,7 @@ void RelayQueueEngine::deliverMessages()
         }
         context.deliverMessage();
     }
+    context.flushDeliveries();
 }
 
 void RelayQueueEngine::processAppRedelivery(App_State&         state,
@@ -846,6 +847,9 @@ RelayQueueEngine::RelayQueueEngine(
     BSLS_ASSERT_SAFE(queueState->storage());
     BSLS_ASSERT_SAFE(subStreamMessages);
 
+    d_queueState_p->routingContext().d_isLeastOutstanding =
+        domainConfig.leastOutstandingDelivery();
+
     d_throttledRejectedMessages.initialize(
         1,
         5 * bdlt::TimeUnitRatio::k_NS_PER_S);
@@ -65,6 +65,14 @@
 namespace BloombergLP {
 namespace mqbblp {
 
+namespace {
+
+/// Maximum number of bytes of data of the pending PUTs relayed upstream in
+/// one batch when retransmitting, so that each batch fills a PUT event.
+const int k_RETRANSMIT_BATCH_MAX_BYTES = bmqp::EventHeader::k_MAX_SIZE_SOFT;
+
+}  // close unnamed namespace
+
 // -----------------
 // class RemoteQueue
 // -----------------
@@ -506,6 +514,7 @@ void RemoteQueue::pushMessage(
 RemoteQueue::RemoteQueue(QueueState*       state,
                          int               deduplicationTimeMs,
                          int               ackWindowSize,
+                         int               pendingPutsMaxBytes,
                          StateSpPool*      statePool,
                          bslma::Allocator* allocator)
 : d_state_p(state)
@@ -516,6 +525,8 @@ RemoteQueue::RemoteQueue(QueueState*       state,
 , d_optionsView(allocator)
 , d_pendingPutsTimeoutNs(deduplicationTimeMs *
                          bdlt::TimeUnitRatio::k_NANOSECONDS_PER_MILLISECOND)
+, d_pendingPutsMaxBytes(pendingPutsMaxBytes)
+, d_pendingPutsBytes(0)
 , d_scheduler_p(state->scheduler())
 , d_pendingMessagesTimerEventHandle()
 , d_ackWindowSize(ackWindowSize)
@@ -556,6 +567,7 @@ RemoteQueue::RemoteQueue(QueueState*       state,
 RemoteQueue::~RemoteQueue()
 {
     BSLS_ASSERT_SAFE(d_pendingMessages.empty());
+    BSLS_ASSERT_SAFE(d_pendingPutsBytes == 0);
     BSLS_ASSERT_SAFE(!d_pendingMessagesTimerEventHandle);
 }
 
@@ -804,8 +816,8 @@ void RemoteQueue::onDispatcherEvent(const mqbi::DispatcherEvent& event)
     case mqbi::DispatcherEventType::e_CALLBACK: {
         const mqbi::DispatcherCallbackEvent* realEvent =
             event.asCallbackEvent();
-        BSLS_ASSERT_SAFE(realEvent->callback());
-        realEvent->callback()(
+        BSLS_ASSERT_SAFE(realEvent->hasCallback());
+        realEvent->invokeCallback(
             d_state_p->queue()->dispatcherClientData().processorHandle());
     } break;
     case mqbi::DispatcherEventType::e_PUSH: {
@@ -962,6 +974,50 @@ void RemoteQueue::postMessage(const bmqp::PutHeader&              putHeaderIn,
         }
         return;  // RETURN
     }
+
+    // Broadcast PUTs sent upstream right away are kept without their data.
+    const bool keepData = ctx.d_state != SubStreamContext::e_OPENED ||
+                          !d_state_p->isAtMostOnce();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            keepData && d_pendingPutsMaxBytes != 0 &&
+            d_pendingPutsBytes + appData->length() > d_pendingPutsMaxBytes)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Too much data is already pending upstream (typically because the
+        // upstream is unavailable).  Push back on the client instead of
+        // buffering more.
+
+        if (d_throttledFailedPutMessages.requestPermission()) {
+            BALL_LOG_WARN << d_state_p->uri() << ": rejecting PUT [GUID: '"
+                          << putHeader.messageGUID() << "'] from client ["
+                          << source->client()->description()
+                          << "] because "
+                          << mwcu::PrintUtil::prettyBytes(d_pendingPutsBytes)
+                          << " of PUTs are pending upstream (limit: "
+                          << mwcu::PrintUtil::prettyBytes(
+                                 d_pendingPutsMaxBytes)
+                          << ").";
+        }
+
+        if (!d_state_p->isAtMostOnce()) {
+            bmqp::AckMessage ackMessage;
+
+            ackMessage.setStatus(bmqp::ProtocolUtil::ackResultToCode(
+                bmqt::AckResult::e_LIMIT_BYTES));
+            ackMessage.setMessageGUID(putHeader.messageGUID());
+
+            d_state_p->stats().onEvent(
+                mqbstat::QueueStatsDomain::EventType::e_NACK,
+                1);
+
+            // CorrelationId & QueueId are left unset as those fields will be
+            // filled downstream.
+            source->onAckMessage(ackMessage);
+        }
+        return;  // RETURN
+    }
+
     // Always add to the 'd_pendingMessages':
     //  - if this is broadcast PUT, just GUID unless there is no upstream
     //  - else, also keep 'appData' and 'options'
@@ -1006,8 +1062,7 @@ void RemoteQueue::postMessage(const bmqp::PutHeader&              putHeaderIn,
         }
     }
 
-    if (ctx.d_state == SubStreamContext::e_OPENED &&
-        d_state_p->isAtMostOnce()) {
+    if (!keepData) {
         d_pendingMessages.insert(
             bsl::make_pair(putHeader.messageGUID(),
                            PutMessage(source, putHeader, 0, 0, 0, state)));
@@ -1016,6 +1071,7 @@ void RemoteQueue::postMessage(const bmqp::PutHeader&              putHeaderIn,
         d_pendingMessages.insert(bsl::make_pair(
             putHeader.messageGUID(),
             PutMessage(source, putHeader, appData, options, now, state)));
+        d_pendingPutsBytes += appData->length();
     }
 
     if (ctx.d_state == SubStreamContext::e_OPENED) {
@@ -1223,6 +1279,7 @@ void RemoteQueue::onAckMessageDispatched(const mqbi::DispatcherAckEvent& event)
             BSLS_ASSERT_SAFE(!it->second.d_appData && !it->second.d_options);
             it->second.d_appData = event.blob();
             it->second.d_options = event.options();
+            d_pendingPutsBytes += it->second.d_appData->length();
         }
         return;  // RETURN
     }
@@ -1307,6 +1364,9 @@ RemoteQueue::erasePendingMessage(Puts::iterator& it)
     if (it->second.d_state_sp) {
         it->second.d_state_sp->cancel();
     }
+    if (it->second.d_appData) {
+        d_pendingPutsBytes -= it->second.d_appData->length();
+    }
     return d_pendingMessages.erase(it);
 }
 
@@ -1409,10 +1469,17 @@ void RemoteQueue::retransmitPendingMessagesDispatched(
 
     if (!d_pendingMessages.empty()) {
         size_t                  numTransmitted = 0;
+        size_t                  numBatches     = 0;
         size_t                  numMessages    = d_pendingMessages.size();
         const bmqt::MessageGUID firstGUID =
             d_pendingMessages.begin()->second.d_header.messageGUID();
 
+        // Relay the pending messages to the cluster in batches rather than
+        // one dispatcher event per message, so that the cluster fills its
+        // PUT events and flushes them once per batch.
+        bsl::shared_ptr<RelayedPuts> batch;
+        int                          batchBytes = 0;
+
         for (Puts::iterator it = d_pendingMessages.begin();
              it != d_pendingMessages.end();) {
             if (it->second.d_appData) {
@@ -1421,16 +1488,37 @@ void RemoteQueue::retransmitPendingMessagesDispatched(
                     it->second.d_state_sp->cancel();
                     it->second.d_state_sp = d_statePool_p->getObject();
                 }
-                sendPutMessage(it->second.d_header,
-                               it->second.d_appData,
-                               it->second.d_options,
-                               it->second.d_state_sp,
-                               genCount);
+
+                if (batch &&
+                    batchBytes + it->second.d_appData->length() >
+                        k_RETRANSMIT_BATCH_MAX_BYTES) {
+                    sendPutMessages(batch, genCount);
+                    batch.reset();
+                    batchBytes = 0;
+                    ++numBatches;
+                }
+                if (!batch) {
+                    batch.createInplace(d_allocator_p, d_allocator_p);
+                }
+
+                // Replica or Proxy.  Update queueId to the one known
+                // upstream.
+                bmqp::PutHeader& ph = const_cast<bmqp::PutHeader&>(
+                    it->second.d_header);
+                ph.setQueueId(d_state_p->id());
+
+                batch->push_back(RelayedPut(ph,
+                                            it->second.d_appData,
+                                            it->second.d_options,
+                                            it->second.d_state_sp));
+                batchBytes += it->second.d_appData->length();
                 ++numTransmitted;
+
                 if (0 == it->second.d_timeReceived) {
                     // This is broadcast (not time-controlled); no more
                     // retransmission unless NOT_READY NACK is received in
                     // which case NACK will supply the data.
+                    d_pendingPutsBytes -= it->second.d_appData->length();
                     it->second.d_appData.clear();
                     it->second.d_options.clear();
                 }
@@ -1444,9 +1532,15 @@ void RemoteQueue::retransmitPendingMessagesDispatched(
             }
         }
 
+        if (batch) {
+            sendPutMessages(batch, genCount);
+            ++numBatches;
+        }
+
         BALL_LOG_INFO << d_state_p->uri() << ": processed " << numMessages
                       << " pending message(s); " << numTransmitted
-                      << " (re)transmitted starting from " << firstGUID;
+                      << " (re)transmitted in " << numBatches
+                      << " batch(es) starting from " << firstGUID;
     }
 }
 
@@ -1563,6 +1657,58 @@ void RemoteQueue::sendPutMessage(
     dispatcher->dispatchEvent(dispEvent, cluster);
 }
 
+void RemoteQueue::sendPutMessages(const bsl::shared_ptr<RelayedPuts>& puts,
+                                  bsls::Types::Uint64                 genCount)
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(puts && !puts->empty());
+
+    mqbi::Cluster* cluster = d_state_p->domain()->cluster();
+
+    d_state_p->queue()->dispatcher()->execute(
+        bdlf::BindUtil::bind(&RemoteQueue::sendPutMessagesDispatched,
+                             cluster,
+                             d_state_p->queue(),
+                             d_state_p->partitionId(),
+                             genCount,
+                             puts),
+        cluster);
+}
+
+void RemoteQueue::sendPutMessagesDispatched(
+    mqbi::DispatcherClient*             cluster,
+    mqbi::DispatcherClient*             source,
+    int                                 partitionId,
+    bsls::Types::Uint64                 genCount,
+    const bsl::shared_ptr<RelayedPuts>& puts)
+{
+    // executed by the *CLUSTER* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(cluster->dispatcher()->inDispatcherThread(cluster));
+
+    // Feed the cluster with the very events 'sendPutMessage' would have
+    // dispatched, so that batched PUTs are processed exactly like individual
+    // ones.  A single event is reused for the whole batch.
+    mqbi::DispatcherEvent event(puts->get_allocator().mechanism());
+    event.setType(mqbi::DispatcherEventType::e_PUT)
+        .setIsRelay(true)  // Relay message
+        .setSource(source)
+        .setPartitionId(partitionId)  // Only replica uses
+        .setGenCount(genCount);
+
+    for (RelayedPuts::const_iterator it = puts->begin(); it != puts->end();
+         ++it) {
+        event.setPutHeader(it->d_header)
+            .setBlob(it->d_appData)
+            .setOptions(it->d_options)
+            .setState(it->d_state_sp);
+        cluster->onDispatcherEvent(event);
+    }
+}
+
 void RemoteQueue::onOpenFailure(unsigned int upstreamSubQueueId)
 {
     // executed by the *DISPATCHER* thread
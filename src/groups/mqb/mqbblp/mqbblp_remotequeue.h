@@ -55,6 +55,7 @@
 #include <bdlt_timeunitratio.h>
 #include <bsl_memory.h>
 #include <bsl_unordered_map.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
@@ -127,6 +128,21 @@ class RemoteQueue {
         ~PutMessage();
     };
 
+    /// PUT message relayed upstream as part of a batch.
+    struct RelayedPut {
+        bmqp::PutHeader                    d_header;
+        bsl::shared_ptr<bdlbb::Blob>       d_appData;
+        bsl::shared_ptr<bdlbb::Blob>       d_options;
+        bsl::shared_ptr<mwcu::AtomicState> d_state_sp;
+
+        RelayedPut(const bmqp::PutHeader&                    header,
+                   const bsl::shared_ptr<bdlbb::Blob>&       appData,
+                   const bsl::shared_ptr<bdlbb::Blob>&       options,
+                   const bsl::shared_ptr<mwcu::AtomicState>& state);
+    };
+
+    typedef bsl::vector<RelayedPut> RelayedPuts;
+
     struct ConfirmMessage {
         const bmqt::MessageGUID  d_guid;
         const unsigned int       d_upstreamSubQueueId;
@@ -226,6 +242,17 @@ class RemoteQueue {
     // stop. Must be Less or equal to
     // the deduplication timeout.
 
+    bsls::Types::Int64 d_pendingPutsMaxBytes;
+    // Maximum number of bytes of data
+    // held by 'd_pendingMessages',
+    // after which new PUTs are NACK'd
+    // with 'e_LIMIT_BYTES'.  Zero means
+    // unlimited.
+
+    bsls::Types::Int64 d_pendingPutsBytes;
+    // Number of bytes of data currently
+    // held by 'd_pendingMessages'.
+
     bdlmt::EventScheduler* d_scheduler_p;
     // Pointer, held not owned, to the
     // scheduler to use for pending
@@ -292,7 +319,8 @@ class RemoteQueue {
     /// only.
     void expirePendingMessagesDispatched();
 
-    /// Retransmit all pending (unACKed) messages.
+    /// Retransmit all pending (unACKed) messages, relaying them upstream
+    /// in batches.
     void retransmitPendingMessagesDispatched(bsls::Types::Uint64 genCount);
 
     /// Retransmit all pending CONFIRMS.
@@ -307,6 +335,23 @@ class RemoteQueue {
                         const bsl::shared_ptr<mwcu::AtomicState>& state,
                         bsls::Types::Uint64                       genCount);
 
+    /// Relay upstream the specified `puts` with the specified `genCount`,
+    /// in a single dispatcher event to the cluster.
+    void sendPutMessages(const bsl::shared_ptr<RelayedPuts>& puts,
+                         bsls::Types::Uint64                 genCount);
+
+    /// Feed the specified `cluster` with a relay PUT event from the
+    /// specified `source` queue, having the specified `partitionId` and
+    /// `genCount`, for each of the specified `puts`.
+    ///
+    /// THREAD: This method is called from the `cluster` dispatcher thread.
+    static void sendPutMessagesDispatched(
+        mqbi::DispatcherClient*             cluster,
+        mqbi::DispatcherClient*             source,
+        int                                 partitionId,
+        bsls::Types::Uint64                 genCount,
+        const bsl::shared_ptr<RelayedPuts>& puts);
+
     void sendConfirmMessage(const bmqt::MessageGUID& msgGUID,
                             unsigned int             upstreamSubQueueId,
                             mqbi::QueueHandle*       source);
@@ -337,6 +382,7 @@ class RemoteQueue {
     RemoteQueue(QueueState*       state,
                 int               deduplicationTimeMs,
                 int               ackWindowSize,
+                int               pendingPutsMaxBytes,
                 StateSpPool*      statePool,
                 bslma::Allocator* allocator);
 
@@ -535,6 +581,19 @@ inline RemoteQueue::PutMessage::~PutMessage()
     // NOTHING
 }
 
+inline RemoteQueue::RelayedPut::RelayedPut(
+    const bmqp::PutHeader&                    header,
+    const bsl::shared_ptr<bdlbb::Blob>&       appData,
+    const bsl::shared_ptr<bdlbb::Blob>&       options,
+    const bsl::shared_ptr<mwcu::AtomicState>& state)
+: d_header(header)
+, d_appData(appData)
+, d_options(options)
+, d_state_sp(state)
+{
+    // NOTHING
+}
+
 inline RemoteQueue::ConfirmMessage::ConfirmMessage(
     const bmqt::MessageGUID& guid,
     unsigned int             upstreamSubQueueId,
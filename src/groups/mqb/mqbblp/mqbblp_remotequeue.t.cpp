@@ -127,7 +127,8 @@ class TestBench {
                         bmqt::Uri&                          uri,
                         int                                 timeout,
                         int                                 ackWindowSize,
-                        bmqp_ctrlmsg::RoutingConfiguration& routingConfig);
+                        bmqp_ctrlmsg::RoutingConfiguration& routingConfig,
+                        int pendingPutsMaxBytes = 0);
     };
 
   public:
@@ -280,7 +281,8 @@ TestBench::TestRemoteQueue::TestRemoteQueue(
     bmqt::Uri&                          uri,
     int                                 timeout,
     int                                 ackWindowSize,
-    bmqp_ctrlmsg::RoutingConfiguration& routingConfig)
+    bmqp_ctrlmsg::RoutingConfiguration& routingConfig,
+    int                                 pendingPutsMaxBytes)
 : d_queue_sp(theBench.getQueue())
 , d_storageKey(mqbu::StorageKey::k_NULL_KEY)
 , d_queueState(d_queue_sp.get(),
@@ -293,6 +295,7 @@ TestBench::TestRemoteQueue::TestRemoteQueue(
 , d_remoteQueue(&d_queueState,
                 timeout,
                 ackWindowSize,
+                pendingPutsMaxBytes,
                 &theBench.d_stateSpPool,
                 theBench.d_allocator_p)
 {
@@ -1130,6 +1133,94 @@ static void test5_reopen_failure()
     theQueue.d_remoteQueue.close();
 }
 
+static void test6_pendingPutsLimit()
+// ------------------------------------------------------------------------
+// PENDING PUTS LIMIT
+//
+// Concerns:
+//   1. PUTs exceeding the limit of bytes pending upstream are NACK'd with
+//      'e_LIMIT_BYTES', and are not relayed.
+//   2. Bytes of ACK'd PUTs are released.
+//   3. PUTs buffered while the upstream is unavailable are all
+//      retransmitted, in order, once the upstream is back.
+//
+// Plan:
+//   Post messages until the limit is reached, with and without upstream.
+//
+// Testing:
+//   postMessage
+//   onOpenUpstream
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("PENDING PUTS LIMIT");
+
+    bmqt::UriParser::initialize(s_allocator_p);
+
+    bsl::shared_ptr<mwcst::StatContext> statContext =
+        mqbstat::BrokerStatsUtil::initializeStatContext(30, s_allocator_p);
+
+    TestBench theBench(s_allocator_p);
+
+    // Each message posted by 'TestQueueHandle' has 5 bytes of data, allow
+    // two of them.
+    bmqt::Uri uri("bmq://bmq.test.local/test_queue", s_allocator_p);
+    bmqp_ctrlmsg::RoutingConfiguration routingConfig;
+    size_t                             ackWindowSize = 1000;
+    int                                timeout       = 10;
+    TestBench::TestRemoteQueue         theQueue(theBench,
+                                        uri,
+                                        timeout,
+                                        ackWindowSize,
+                                        routingConfig,
+                                        10);
+
+    bsl::shared_ptr<mqbi::QueueHandleRequesterContext> clientContext_sp(
+        new (*s_allocator_p) mqbi::QueueHandleRequesterContext(s_allocator_p),
+        s_allocator_p);
+
+    TestQueueHandle x(theQueue.d_queue_sp, theBench, clientContext_sp);
+    TestQueueHandle y(theQueue.d_queue_sp, theBench, clientContext_sp);
+
+    x.d_status = bmqt::AckResult::e_SUCCESS;
+    y.d_status = bmqt::AckResult::e_LIMIT_BYTES;
+
+    PVV("Limit reached with an upstream");
+    x.postOneMessage(&theQueue.d_remoteQueue);
+    x.postOneMessage(&theQueue.d_remoteQueue);
+    y.postOneMessage(&theQueue.d_remoteQueue);
+
+    ASSERT_EQ(2U, theBench.d_puts.size());
+    ASSERT_EQ(2U, x.count());
+    ASSERT_EQ(0U, y.count());
+
+    PVV("ACKs release the limit");
+    theBench.ackPuts(bmqt::AckResult::e_SUCCESS);
+    ASSERT_EQ(0U, x.count());
+
+    PVV("Limit reached without an upstream");
+    theQueue.d_remoteQueue.onLostUpstream();
+
+    x.postOneMessage(&theQueue.d_remoteQueue);
+    x.postOneMessage(&theQueue.d_remoteQueue);
+    y.postOneMessage(&theQueue.d_remoteQueue);
+
+    ASSERT_EQ(0U, theBench.d_puts.size());
+    ASSERT_EQ(2U, x.count());
+    ASSERT_EQ(0U, y.count());
+
+    PVV("Retransmission");
+    theQueue.d_remoteQueue.onOpenUpstream(
+        2,
+        bmqp::QueueId::k_DEFAULT_SUBQUEUE_ID);
+
+    ASSERT_EQ(2U, theBench.d_puts.size());
+
+    theBench.ackPuts(bmqt::AckResult::e_SUCCESS);
+    ASSERT_EQ(0U, x.count());
+
+    theQueue.d_remoteQueue.close();
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1145,6 +1236,7 @@ int main(int argc, char* argv[])
     case 3: test3_close(); break;
     case 4: test4_buffering(); break;
     case 5: test5_reopen_failure(); break;
+    case 6: test6_pendingPutsLimit(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
@@ -32,6 +32,7 @@
 #include <mqbs_voidstorageiterator.h>
 
 // BMQ
+#include <bmqp_messageguidgenerator.h>
 #include <bmqp_protocol.h>
 #include <bmqp_protocolutil.h>
 #include <bmqp_queueid.h>
@@ -245,6 +246,9 @@ RootQueueEngine::RootQueueEngine(QueueState*             queueState,
     BSLS_ASSERT_SAFE(
         d_queueState_p->queue()->domain()->cluster()->isClusterMember());
 
+    d_queueState_p->routingContext().d_isLeastOutstanding =
+        domainConfig.leastOutstandingDelivery();
+
     d_throttledRejectedMessages.initialize(
         1,
         5 * bdlt::TimeUnitRatio::k_NS_PER_S);
@@ -1148,6 +1152,8 @@ void RootQueueEngine::afterNewMessage(
     BSLS_ASSERT_SAFE(d_queueState_p->queue()->dispatcher()->inDispatcherThread(
         d_queueState_p->queue()));
 
+    d_consumptionMonitor.onMessagePosted();
+
     // Deliver new messages to active (alive and capable to deliver) consumers
 
     QueueEngineUtil_AppsDeliveryContext context(d_queueState_p->queue(),
@@ -1167,6 +1173,7 @@ void RootQueueEngine::afterNewMessage(
         }
         context.deliverMessage();
     }
+    context.flushDeliveries();
 
     if (QueueEngineUtil::isBroadcastMode(d_queueState_p->queue())) {
         // Clear storage status
@@ -1252,6 +1259,97 @@ int RootQueueEngine::onConfirmMessage(mqbi::QueueHandle*       handle,
     return rc_ERROR;
 }
 
+int RootQueueEngine::onConfirmMessageRange(
+    mqbi::QueueHandle*              handle,
+    const bmqt::MessageGUID&        msgGUID,
+    int                             count,
+    unsigned int                    subQueueId,
+    bsl::vector<bmqt::MessageGUID>* removableGUIDs)
+{
+    // executed by the *QUEUE DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_queueState_p->queue()->dispatcher()->inDispatcherThread(
+        d_queueState_p->queue()));
+    BSLS_ASSERT_SAFE(
+        !QueueEngineUtil::isBroadcastMode(d_queueState_p->queue()) &&
+        "confirm isn't expected for this queue");
+    BSLS_ASSERT_SAFE(handle);
+    BSLS_ASSERT_SAFE(0 < count);
+    BSLS_ASSERT_SAFE(removableGUIDs);
+
+    // This is the same as 'onConfirmMessage' for each message of the range,
+    // except that everything but the release of the references is done once.
+
+    // TODO: handle missing SubQueue?
+    QueueEngineUtil_AppState& app = *subQueue(subQueueId);
+
+    const mqbu::StorageKey& appKey = app.d_appKey;
+    BSLS_ASSERT_SAFE(!appKey.isNull());
+
+    mqbi::Storage* storage = d_queueState_p->storage();
+    const bool     hasVirtualStorage = storage->hasVirtualStorage(appKey);
+
+    // Only the last message sent to the handle may have to cancel the
+    // throttling of its deliveries.
+    const Routers::Consumer* queueHandleContext = app.findQueueHandleContext(
+        handle);
+    const bmqt::MessageGUID lastSentMessage =
+        queueHandleContext ? queueHandleContext->d_lastSentMessage
+                           : bmqt::MessageGUID();
+
+    const bsls::Types::Int64 timestamp = bdlt::EpochUtil::convertToTimeT64(
+        bdlt::CurrentTime::utc());
+
+    int               numFailed = 0;
+    bmqt::MessageGUID guid      = msgGUID;
+    for (int i = 0; i < count; ++i) {
+        if (i != 0) {
+            bmqp::MessageGUIDGenerator::loadNextGUID(&guid, guid);
+        }
+
+        // Inform app that a message from its virtual storage is getting
+        // removed, so that it can advance its iterator etc if required.
+        app.beforeMessageRemoved(guid, false);
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!hasVirtualStorage)) {
+            // See 'onConfirmMessage'.
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            ++numFailed;
+            continue;  // CONTINUE
+        }
+
+        // Release from storage
+        mqbi::StorageResult::Enum rc = storage->releaseRef(guid,
+                                                           appKey,
+                                                           timestamp);
+
+        if (queueHandleContext && guid == lastSentMessage) {
+            app.tryCancelThrottle(handle, guid);
+        }
+
+        if (rc == mqbi::StorageResult::e_NON_ZERO_REFERENCES) {
+            continue;  // CONTINUE
+        }
+
+        if (rc == mqbi::StorageResult::e_ZERO_REFERENCES) {
+            removableGUIDs->push_back(guid);
+            continue;  // CONTINUE
+        }
+
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        BALL_LOG_INFO << "'" << d_queueState_p->queue()->description()
+                      << "', appId = '" << app.d_appId
+                      << "' failed to release references upon CONFIRM "
+                      << guid << "' [reason: "
+                      << mqbi::StorageResult::toAscii(rc) << "]";
+        ++numFailed;
+    }
+
+    return numFailed;
+}
+
 int RootQueueEngine::onRejectMessage(mqbi::QueueHandle*       handle,
                                      const bmqt::MessageGUID& msgGUID,
                                      unsigned int             subQueueId)
@@ -53,6 +53,7 @@
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
 #include <bsl_utility.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
@@ -339,6 +340,26 @@ class RootQueueEngine BSLS_KEYWORD_FINAL : public mqbi::QueueEngine {
                      const bmqt::MessageGUID& msgGUID,
                      unsigned int subQueueId) BSLS_KEYWORD_OVERRIDE;
 
+    /// Called by the `mqbi::Queue` when the specified `count` messages
+    /// starting with the one identified by the specified `msgGUID`, each
+    /// subsequent message having the GUID following the one of the previous
+    /// message, are confirmed for the specified `subQueueId` stream of the
+    /// queue on behalf of the client identified by the specified `handle`.
+    /// Append to the specified `removableGUIDs` the GUIDs of the messages
+    /// for which this confirm was the last reference, and which can be
+    /// deleted from the queue's associated storage.  Return the number of
+    /// messages which failed to be confirmed.  Note that the app, its
+    /// virtual storage and the context of `handle` are looked up once for
+    /// the whole range.
+    ///
+    /// THREAD: This method is called from the Queue's dispatcher thread.
+    virtual int onConfirmMessageRange(
+        mqbi::QueueHandle*              handle,
+        const bmqt::MessageGUID&        msgGUID,
+        int                             count,
+        unsigned int                    subQueueId,
+        bsl::vector<bmqt::MessageGUID>* removableGUIDs) BSLS_KEYWORD_OVERRIDE;
+
     /// Called by the `mqbi::Queue` when the message identified by the
     /// specified `msgGUID` is rejected for the specified
     /// `downstreamSubQueueId` stream of the queue on behalf of the client
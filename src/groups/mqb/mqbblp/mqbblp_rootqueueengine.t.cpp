@@ -5202,6 +5202,68 @@ static void test46_throttleRedeliveryNoMoreHandles()
     ASSERT_EQ(C3->_numMessages(), 2);
 }
 
+static void test47_clientThrottled()
+// ------------------------------------------------------------------------
+// CLIENT THROTTLED
+//
+// Concerns:
+//   a) No message is delivered to a handle whose client is throttled
+//      (i.e., whose channel reached its high watermark), and the messages
+//      posted meanwhile remain in the queue.
+//   b) Once the client is no longer throttled, the delivery resumes from
+//      the queue, in order.
+//
+// Plan:
+//   1) Configure a handle C1.  Post 2 messages and verify C1 received
+//      them.
+//   2) Throttle the client of C1.  Post 2 messages and verify C1 received
+//      none.
+//   3) Unthrottle the client of C1, and verify that C1 received the 2
+//      pending messages.
+//
+// Testing:
+//   Queue Engine delivery to a throttled client.
+// ------------------------------------------------------------------------
+{
+    s_ignoreCheckDefAlloc = true;
+    // Can't check the default allocator: 'mqbblp::QueueEngine' and mocks from
+    // 'mqbi' methods print with ball, which allocates.
+
+    mwctst::TestHelper::printTestName("CLIENT THROTTLED");
+
+    mqbblp::QueueEngineTester tester(priorityDomainConfig(),
+                                     false,  // start scheduler
+                                     s_allocator_p);
+
+    mqbblp::QueueEngineTesterGuard<mqbblp::RootQueueEngine> guard(&tester);
+
+    // 1)
+    mqbmock::QueueHandle* C1 = tester.getHandle("C1 readCount=1");
+    tester.configureHandle("C1 consumerPriority=1 consumerPriorityCount=1");
+
+    tester.post("1,2");
+    tester.afterNewMessage(2);
+
+    ASSERT_EQ(C1->_messages(), "1,2");
+
+    // 2) C1: Throttled
+    C1->setClientThrottled(true);
+
+    tester.post("3,4");
+    tester.afterNewMessage(2);
+
+    ASSERT_EQ(C1->_messages(), "1,2");
+
+    // Throttling again changes nothing
+    C1->setClientThrottled(true);
+    ASSERT_EQ(C1->_messages(), "1,2");
+
+    // 3) C1: Unthrottled
+    C1->setClientThrottled(false);
+
+    ASSERT_EQ(C1->_messages(), "1,2,3,4");
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -5222,6 +5284,7 @@ int main(int argc, char* argv[])
 
         switch (_testCase) {
         case 0:
+        case 47: test47_clientThrottled(); break;
         case 46: test46_throttleRedeliveryNoMoreHandles(); break;
         case 45: test45_throttleRedeliveryNewHandle(); break;
         case 44: test44_throttleRedeliveryCancelledDelay(); break;
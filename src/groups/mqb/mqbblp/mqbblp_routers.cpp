@@ -34,15 +34,21 @@
 #include <mwcu_printutil.h>
 
 // BDE
+#include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_string.h>
 #include <bsls_performancehint.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 namespace mqbblp {
 
 namespace {
 
+/// Minimum number of `PriorityGroup`s at one priority for their
+/// `Expression`s to be indexed: below, evaluating all of them is cheaper.
+const size_t k_MIN_INDEXED_GROUPS = 8;
+
 /// VST to control the scope of Resolver
 class ScopeExit {
     mqbblp::Routers::QueueRoutingContext& d_queue;
@@ -91,11 +97,11 @@ void Routers::Consumer::registerSubscriptions(mqbi::QueueHandle* handle)
 // =======================================
 
 Routers::MessagePropertiesReader::MessagePropertiesReader(
-    bmqp::SchemaLearner& schemaLearner,
-    bslma::Allocator*    allocator)
-: d_schemaLearner(schemaLearner)
-, d_schemaLearnerContext(schemaLearner.createContext())
-, d_properties(allocator)
+    bslma::Allocator* allocator)
+: d_view(allocator)
+, d_schemaLearner(allocator)
+, d_schemaLearnerContext(d_schemaLearner.createContext())
+, d_schema_sp()
 , d_currentMessage_p(0)
 , d_isDirty(false)
 {
@@ -107,31 +113,38 @@ Routers::MessagePropertiesReader::~MessagePropertiesReader()
     // NOTHING
 }
 
-void Routers::MessagePropertiesReader::_set(
-    bmqp::MessageProperties& properties)
-{
-    d_properties = properties;
-}
-
 bdld::Datum Routers::MessagePropertiesReader::get(const bsl::string& name,
                                                   bslma::Allocator*  allocator)
 {
     if (d_isDirty) {
         if (d_currentMessage_p && d_currentMessage_p->appData()) {
-            int rc = d_schemaLearner.read(
-                d_schemaLearnerContext,
-                &d_properties,
-                d_currentMessage_p->attributes().messagePropertiesInfo(),
-                *d_currentMessage_p->appData());
+            // Index the properties in place, without decoding them: only the
+            // ones referred to by the expressions get decoded.  Note that
+            // schemas are not needed to read the encoded properties, they
+            // only speed up the lookups.
+            const bmqp::MessagePropertiesInfo& info =
+                d_currentMessage_p->attributes().messagePropertiesInfo();
+            int rc = d_view.reset(*d_currentMessage_p->appData(),
+                                  info.isExtended());
             if (rc != 0) {
-                BALL_LOG_TRACE << "Failed to read message schema [rc: " << rc
-                               << "]";
+                BALL_LOG_TRACE << "Failed to read message properties [rc: "
+                               << rc << "]";
+            }
+            else {
+                d_schema_sp = d_schemaLearner.learn(d_schemaLearnerContext,
+                                                    info,
+                                                    d_view);
             }
         }
         d_isDirty = false;
     }
 
-    return d_properties.getPropertyRef(name, allocator);
+    int hint = -1;
+    if (d_schema_sp) {
+        d_schema_sp->loadIndex(&hint, name);
+    }
+
+    return d_view.getPropertyRef(name, hint, allocator);
 }
 
 void Routers::MessagePropertiesReader::next(
@@ -141,7 +154,8 @@ void Routers::MessagePropertiesReader::next(
         return;  // RETURN
     }
 
-    d_properties.clear();
+    d_view.clear();
+    d_schema_sp.reset();
 
     d_currentMessage_p = currentMessage;
     d_isDirty          = true;
@@ -186,6 +200,35 @@ unsigned int Routers::PriorityGroup::sId() const
     return d_itId->key();
 }
 
+// ========================
+// struct Routers::Priority
+// ========================
+
+void Routers::Priority::buildIndex()
+{
+    d_index.clear();
+    d_indexedGroups.clear();
+
+    if (d_highestGroups.size() < k_MIN_INDEXED_GROUPS) {
+        return;  // RETURN
+    }
+
+    for (PriorityGroupList::iterator itGroup = d_highestGroups.begin();
+         itGroup != d_highestGroups.end();
+         ++itGroup) {
+        PriorityGroup& group = (*itGroup)->value();
+
+        d_index.add(group.d_itId->value().d_itExpression->value().d_evaluator);
+        d_indexedGroups.push_back(&group);
+    }
+
+    if (d_index.numProperties() == 0) {
+        // No 'Expression' requires any equality, all are candidates.
+        d_index.clear();
+        d_indexedGroups.clear();
+    }
+}
+
 void Routers::AppContext::loadApp(const char*        appId,
                                   mqbi::QueueHandle* handle,
                                   bsl::ostream*      errorStream,
@@ -429,6 +472,7 @@ size_t Routers::AppContext::finalize()
             itPriority = d_priorities.erase(itPriority);
         }
         else {
+            level.buildIndex();
             ++itPriority;
         }
     }
@@ -620,30 +664,55 @@ Routers::RoundRobin::iterateGroups(const Visitor&               visitor,
     for (Priorities::iterator itPriority = d_priorities.begin();
          itPriority != d_priorities.end() && !haveMatch;
          ++itPriority) {
-        Priority::PriorityGroupList& groups =
-            itPriority->second.d_highestGroups;
+        Priority& level = itPriority->second;
+
+        if (d_reader_p && !level.d_indexedGroups.empty()) {
+            // Evaluate only the 'Expression's which may match, in the order
+            // of 'd_highestGroups'.  The exact ones, such as 'shard == 3',
+            // do match.
+            ExpressionIndex::Positions& candidates = level.d_candidates;
+
+            level.d_index.loadCandidates(&candidates, d_reader_p);
+
+            for (ExpressionIndex::Positions::const_iterator itCandidate =
+                     candidates.begin();
+                 itCandidate != candidates.end();
+                 ++itCandidate) {
+                if (visitGroup(visitor,
+                               *level.d_indexedGroups[*itCandidate],
+                               message,
+                               level.d_index.isExact(*itCandidate),
+                               &haveMatch,
+                               &noneHaveCapacity)) {
+                    return e_SUCCESS;  // RETURN
+                }
+            }
+
+            if (noneHaveCapacity) {
+                // Groups which are not candidates do not match, but they
+                // still count when telling if none has capacity.
+                for (size_t i = 0; i < level.d_indexedGroups.size(); ++i) {
+                    if (level.d_indexedGroups[i]->d_canDeliver) {
+                        noneHaveCapacity = false;
+                        break;  // BREAK
+                    }
+                }
+            }
+            continue;  // CONTINUE
+        }
+
+        Priority::PriorityGroupList& groups = level.d_highestGroups;
 
         for (Priority::PriorityGroupList::iterator itGroup = groups.begin();
              itGroup != groups.end();
              ++itGroup) {
-            PriorityGroup& group = (*itGroup)->value();
-
-            BSLS_ASSERT_SAFE(!group.d_highestSubscriptions.empty());
-
-            if (group.d_canDeliver) {
-                if (group.evaluate(message->appData())) {
-                    if (iterateSubscriptions(visitor, group)) {
-                        return e_SUCCESS;  // RETURN
-                    }
-                    group.d_canDeliver = false;
-                    haveMatch          = true;
-                    // Assume, no handle 'canDeliver' or delay is engaged.
-                    // Do not "spill over" to lower priorities if there is a
-                    // match at a higher priority.
-                }
-                else {
-                    noneHaveCapacity = false;
-                }
+            if (visitGroup(visitor,
+                           (*itGroup)->value(),
+                           message,
+                           false,
+                           &haveMatch,
+                           &noneHaveCapacity)) {
+                return e_SUCCESS;  // RETURN
             }
         }
     }
@@ -659,10 +728,100 @@ Routers::RoundRobin::iterateGroups(const Visitor&               visitor,
     }
 }
 
+bool Routers::RoundRobin::visitGroup(
+    const Visitor&               visitor,
+    PriorityGroup&               group,
+    const mqbi::StorageIterator* message,
+    bool                         isMatch,
+    bool*                        haveMatch,
+    bool*                        noneHaveCapacity)
+{
+    BSLS_ASSERT_SAFE(!group.d_highestSubscriptions.empty());
+
+    if (group.d_canDeliver) {
+        if (isMatch || group.evaluate(message->appData())) {
+            if (iterateSubscriptions(visitor, group)) {
+                return true;  // RETURN
+            }
+            group.d_canDeliver = false;
+            *haveMatch         = true;
+            // Assume, no handle 'canDeliver' or delay is engaged.  Do not
+            // "spill over" to lower priorities if there is a match at a
+            // higher priority.
+        }
+        else {
+            *noneHaveCapacity = false;
+        }
+    }
+
+    return false;
+}
+
+bool Routers::RoundRobin::visitLeastOutstanding(
+    const Visitor&       visitor,
+    SubscriptionList&    subscriptions,
+    const Subscription** tried)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(tried);
+
+    SubscriptionList::iterator itBest          = subscriptions.end();
+    bsls::Types::Int64         bestUnconfirmed = 0;
+    bsls::Types::Int64         bestMax         = 1;
+
+    for (SubscriptionList::iterator itSubscription = subscriptions.begin();
+         itSubscription != subscriptions.end();
+         ++itSubscription) {
+        const Subscription* subscription = *itSubscription;
+        mqbi::QueueHandle*  handle       = subscription->handle();
+        BSLS_ASSERT_SAFE(handle);
+
+        if (!handle->canDeliver(subscription->d_downstreamSubscriptionId)) {
+            continue;  // CONTINUE
+        }
+
+        const bsls::Types::Int64 unconfirmed = handle->countUnconfirmed(
+            subscription->subQueueId());
+        const bsls::Types::Int64 max = bsl::max(
+            subscription->d_ci.maxUnconfirmedMessages(),
+            static_cast<bsls::Types::Int64>(1));
+
+        // Compare 'unconfirmed / max' ratios without dividing.
+        if (itBest == subscriptions.end() ||
+            unconfirmed * bestMax < bestUnconfirmed * max) {
+            itBest          = itSubscription;
+            bestUnconfirmed = unconfirmed;
+            bestMax         = max;
+        }
+    }
+
+    if (itBest == subscriptions.end()) {
+        return false;  // RETURN
+    }
+
+    *tried = *itBest;
+    if (!visitor(*itBest)) {
+        return false;  // RETURN
+    }
+
+    // Move the subscription to the end so that, all else being equal, the
+    // next message goes to another subscription.
+    subscriptions.splice(subscriptions.end(), subscriptions, itBest);
+
+    return true;
+}
+
 bool Routers::RoundRobin::iterateSubscriptions(const Visitor& visitor,
                                                PriorityGroup& group)
 {
-    SubscriptionList& subscriptions = group.d_highestSubscriptions;
+    SubscriptionList&   subscriptions = group.d_highestSubscriptions;
+    const Subscription* tried         = 0;
+
+    if (d_isLeastOutstanding) {
+        if (visitLeastOutstanding(visitor, subscriptions, &tried)) {
+            return true;  // RETURN
+        }
+    }
 
     for (SubscriptionList::iterator itSubscription = subscriptions.begin();
          itSubscription != subscriptions.end();
@@ -671,6 +830,11 @@ bool Routers::RoundRobin::iterateSubscriptions(const Visitor& visitor,
         mqbi::QueueHandle*  handle       = subscription->handle();
         BSLS_ASSERT_SAFE(handle);
 
+        if (subscription == tried) {
+            // Already rejected by the 'visitor'.
+            continue;  // CONTINUE
+        }
+
         if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(handle->canDeliver(
                 subscription->d_downstreamSubscriptionId))) {
             if (visitor(subscription)) {
@@ -127,6 +127,14 @@
 //  The order of ['group1', 'group2'] evaluation is implementation-specific
 //  (influenced by optimizations).
 //
+//  Expressions are evaluated one message at a time, and only until the
+//  message is routed: which groups the next message is evaluated against
+//  depends on the routing of the current one (through the capacity of the
+//  consumers and the round-robin among them), even when draining a backlog.
+//  Evaluating the expressions of all the groups over a batch of messages
+//  upfront would therefore mostly evaluate expressions whose result is never
+//  used.
+//
 //  Another order is by highest-priority subscribers:
 //  [consumer1: 'subscription2'], consumer2: ['subscription3', 'subscription4',
 //  'subscription5']].  This order is for broadcast queues.  Another usage is
@@ -139,6 +147,7 @@
 
 // MQB
 
+#include <mqbblp_expressionindex.h>
 #include <mqbblp_messagegroupidhelper.h>
 #include <mqbcmd_messages.h>
 #include <mqbi_queue.h>
@@ -146,6 +155,8 @@
 
 // BMQ
 #include <bmqeval_simpleevaluator.h>
+#include <bmqp_messagepropertiesview.h>
+#include <bmqp_schemalearner.h>
 #include <bmqt_messageguid.h>
 
 // BDE
@@ -155,6 +166,7 @@
 #include <bsl_map.h>
 #include <bsl_ostream.h>
 #include <bsl_unordered_map.h>
+#include <bsl_vector.h>
 #include <bslma_managedptr.h>
 #include <bsls_annotation.h>
 #include <bsls_assert.h>
@@ -527,10 +539,27 @@ class Routers {
         // Sum of those priorityCounts which
         // Subscription's highest priority is this one.
 
+        ExpressionIndex d_index;
+        // Expressions of the 'd_highestGroups', by
+        // the property equality they require.
+
+        bsl::vector<PriorityGroup*> d_indexedGroups;
+        // 'd_highestGroups' by position in
+        // 'd_index', or empty if not indexed.
+
+        ExpressionIndex::Positions d_candidates;
+        // Transient candidates of the current
+        // message, kept to avoid reallocations.
+
         explicit Priority(bslma::Allocator* allocator);
         Priority(const Priority& other, bslma::Allocator* allocator);
 
         ~Priority();
+
+        /// Index the `Expression`s of the `d_highestGroups` if there are
+        /// enough of them, and if they require property equalities, so
+        /// that routing a message does not evaluate all of them.
+        void buildIndex();
     };
 
     typedef bsl::map<int, Priority, std::greater<int> > Priorities;
@@ -541,23 +570,32 @@ class Routers {
         BALL_LOG_SET_CLASS_CATEGORY("MQBBLP.MESSAGEPROPERTIESREADER");
 
         // DATA
-        bmqp::SchemaLearner& d_schemaLearner;
-        // Use own context;
+        bmqp::MessagePropertiesView d_view;
+        // Lazy view over the properties of
+        // the current message, decoding only
+        // the properties which are read.
+
+        bmqp::SchemaLearner d_schemaLearner;
+        // Learns, by schema id, the index of
+        // each property, so that looking a
+        // property up by name does not
+        // compare it with all the preceding
+        // ones.
 
         bmqp::SchemaLearner::Context d_schemaLearnerContext;
 
-        bmqp::MessageProperties      d_properties;
+        bmqp::SchemaLearner::SchemaPtr d_schema_sp;
+        // Schema of the current message, if
+        // known.
+
         const mqbi::StorageIterator* d_currentMessage_p;
         bool                         d_isDirty;
 
       public:
-        MessagePropertiesReader(bmqp::SchemaLearner& schemaLearner,
-                                bslma::Allocator*    allocator);
+        explicit MessagePropertiesReader(bslma::Allocator* allocator);
 
         ~MessagePropertiesReader() BSLS_KEYWORD_OVERRIDE;
 
-        void _set(bmqp::MessageProperties& properties);
-
         bdld::Datum get(const bsl::string& name,
                         bslma::Allocator*  allocator) BSLS_KEYWORD_OVERRIDE;
 
@@ -587,10 +625,15 @@ class Routers {
 
         bmqeval::EvaluationContext d_evaluationContext;
 
+        bool d_isLeastOutstanding;
+        // Whether the 'RoundRobin' of each
+        // 'AppContext' selects the least
+        // outstanding consumer, as configured
+        // by the domain.
+
         bslma::Allocator* d_allocator_p;
 
-        QueueRoutingContext(bmqp::SchemaLearner& schemaLearner,
-                            bslma::Allocator*    allocator);
+        explicit QueueRoutingContext(bslma::Allocator* allocator);
         ~QueueRoutingContext();
 
         /// Generate `Subscription`s Id for upstream.
@@ -614,6 +657,8 @@ class Routers {
         e_NO_CAPACITY_ALL = 3  // All Subscription(s) are without capacity
         ,
         e_DELAY = 4  // Delay due to Potentially Poisonous data
+        ,
+        e_NO_DATA = 5  // Payload could not be read from the storage
     };
 
     /// Class that implements round-robin routing policy.
@@ -622,13 +667,63 @@ class Routers {
         // PRIVATE DATA
         Priorities& d_priorities;
 
+        bmqeval::PropertiesReader* d_reader_p;
+        // Reader of the properties of the current
+        // message, used to look the indexed
+        // 'Expression's up.  Optional.
+
+        bool d_isLeastOutstanding;
+        // Whether to select the 'Subscription'
+        // having the fewest unconfirmed messages
+        // relative to its
+        // 'maxUnconfirmedMessages' instead of
+        // the next one in round-robin order.
+
+      private:
+        // PRIVATE MANIPULATORS
+
+        /// Call the specified `visitor` for the `Subscription` of the
+        /// specified `subscriptions` which has `canDeliver` consumer and
+        /// the lowest ratio of unconfirmed messages to
+        /// `maxUnconfirmedMessages`, the first one in round-robin order
+        /// winning ties.  If the `visitor` returns `true`, move the
+        /// subscription to the end of the list and return `true`.
+        /// Otherwise, load into the specified `tried` the visited
+        /// subscription, if any, and return `false`.
+        bool visitLeastOutstanding(const Visitor&       visitor,
+                                   SubscriptionList&    subscriptions,
+                                   const Subscription** tried);
+
+        /// Call the specified `visitor` for the highest priority
+        /// `Subscription`s of the specified `group` if it has `canDeliver`
+        /// consumer and if its `Expression` matches the specified
+        /// `message`, which is not evaluated if the specified `isMatch` is
+        /// `true`.  Set the specified `haveMatch` to `true` if the
+        /// `Expression` matches, and the specified `noneHaveCapacity` to
+        /// `false` if the group has `canDeliver` consumer but does not
+        /// match.  Return `true` if the `visitor` returns `true`.
+        bool visitGroup(const Visitor&               visitor,
+                        PriorityGroup&               group,
+                        const mqbi::StorageIterator* message,
+                        bool                         isMatch,
+                        bool*                        haveMatch,
+                        bool*                        noneHaveCapacity);
+
       public:
         // CREATORS
 
         /// Creates a new `RoundRobin` using the specified `consumers`. See
         /// `d_context` for further information regarding the ownership
-        /// semantics for `consumers`.
-        explicit RoundRobin(Priorities& priorities);
+        /// semantics for `consumers`.  Optionally specify a `reader` of
+        /// the properties of the current message, in which case the
+        /// indexed `Expression`s are looked up instead of being all
+        /// evaluated.  Optionally specify `isLeastOutstanding` to select,
+        /// within each group, the subscription having the fewest
+        /// unconfirmed messages relative to its `maxUnconfirmedMessages`
+        /// instead of rotating evenly among the subscriptions.
+        explicit RoundRobin(Priorities&                priorities,
+                            bmqeval::PropertiesReader* reader = 0,
+                            bool isLeastOutstanding           = false);
 
         // MANIPULATORS
 
@@ -648,6 +743,9 @@ class Routers {
         /// `visitor` returns `true`, stop iterating, move the subscription
         /// to the end of round-robind selection list if it has been
         /// selected `d_consumerPriorityCount` times, and return `true`.
+        /// If `d_isLeastOutstanding` is `true`, first call the `visitor`
+        /// for the least outstanding `Subscription` (see
+        /// `visitLeastOutstanding`) before iterating the others.
         bool iterateSubscriptions(const Visitor& visitor,
                                   PriorityGroup& group);
 
@@ -804,7 +902,9 @@ inline Routers::AppContext::AppContext(QueueRoutingContext& queue,
 , d_priorities(allocator)
 , d_consumers(allocator)
 , d_queue(queue)
-, d_router(d_priorities)
+, d_router(d_priorities,
+           queue.d_preader.get(),
+           queue.d_isLeastOutstanding)
 , d_compilationContext(allocator)
 , d_allocator_p(allocator)
 {
@@ -827,14 +927,13 @@ inline bool Routers::AppContext::hasHandle(mqbi::QueueHandle* handle) const
 // -----------------------------------
 
 inline Routers::QueueRoutingContext::QueueRoutingContext(
-    bmqp::SchemaLearner& schemaLearner,
-    bslma::Allocator*    allocator)
+    bslma::Allocator* allocator)
 : d_expressions(allocator)
 , d_nextSubscriptionId(0)
 , d_groupIds(allocator)
-, d_preader(new (*allocator) MessagePropertiesReader(schemaLearner, allocator),
-            allocator)
+, d_preader(new (*allocator) MessagePropertiesReader(allocator), allocator)
 , d_evaluationContext(0, allocator)
+, d_isLeastOutstanding(false)
 , d_allocator_p(allocator)
 {
 }
@@ -1076,6 +1175,9 @@ inline Routers::Priority::Priority(bslma::Allocator* allocator)
 : d_subscribers(allocator)
 , d_highestGroups(allocator)
 , d_count(0)
+, d_index(allocator)
+, d_indexedGroups(allocator)
+, d_candidates(allocator)
 {
     // NOTHING
 }
@@ -1085,6 +1187,9 @@ inline Routers::Priority::Priority(const Priority&   other,
 : d_subscribers(other.d_subscribers, allocator)
 , d_highestGroups(other.d_highestGroups, allocator)
 , d_count(other.d_count)
+, d_index(other.d_index, allocator)
+, d_indexedGroups(other.d_indexedGroups, allocator)
+, d_candidates(allocator)
 {
     // NOTHING
 }
@@ -1097,8 +1202,12 @@ inline Routers::Priority::~Priority()
 // struct Routers::RoundRobin
 // -----------------------------
 
-inline Routers::RoundRobin::RoundRobin(Priorities& priorities)
+inline Routers::RoundRobin::RoundRobin(Priorities&                priorities,
+                                       bmqeval::PropertiesReader* reader,
+                                       bool isLeastOutstanding)
 : d_priorities(priorities)
+, d_reader_p(reader)
+, d_isLeastOutstanding(isLeastOutstanding)
 {
     // NOTHING
 }
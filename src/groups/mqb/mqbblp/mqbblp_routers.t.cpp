@@ -236,9 +236,7 @@ static void test3_parse()
 // ------------------------------------------------------------------------
 {
     bmqp_ctrlmsg::StreamParameters       streamParams(s_allocator_p);
-    bmqp::SchemaLearner                  schemaLearner(s_allocator_p);
-    mqbblp::Routers::QueueRoutingContext queueContext(schemaLearner,
-                                                      s_allocator_p);
+    mqbblp::Routers::QueueRoutingContext queueContext(s_allocator_p);
     unsigned int                         subQueueId = 13;
     TestStorage                          storage(subQueueId, s_allocator_p);
 
@@ -443,9 +441,7 @@ static void test4_generate()
 // ------------------------------------------------------------------------
 {
     bmqp_ctrlmsg::StreamParameters       in(s_allocator_p);
-    bmqp::SchemaLearner                  schemaLearner(s_allocator_p);
-    mqbblp::Routers::QueueRoutingContext queueContext(schemaLearner,
-                                                      s_allocator_p);
+    mqbblp::Routers::QueueRoutingContext queueContext(s_allocator_p);
     unsigned int                         upstreamSubQueueId = 1;
     mqbblp::Routers::AppContext appContext(queueContext, s_allocator_p);
     mwcu::MemOutStream          errorStream(s_allocator_p);
@@ -510,6 +506,114 @@ static void test4_generate()
     }
 }
 
+static void test5_leastOutstanding()
+// ------------------------------------------------------------------------
+// Testing mqbblp::Routers::RoundRobin::iterateGroups method when
+// selecting the least outstanding consumer.
+//
+//  Two handles each with one subscription with one consumer having a
+//  'consumerPriorityCount' of 2, and no unconfirmed messages.  Unlike
+//  round-robin, which selects the same consumer twice in a row, each
+//  message goes to the consumer selected the longest time ago.
+// ------------------------------------------------------------------------
+{
+    bmqp_ctrlmsg::StreamParameters       streamParams(s_allocator_p);
+    mqbblp::Routers::QueueRoutingContext queueContext(s_allocator_p);
+    unsigned int                         subQueueId = 13;
+    TestStorage                          storage(subQueueId, s_allocator_p);
+    bsl::string                          appId("foo", s_allocator_p);
+    unsigned int                         upstreamSubQueueId = 1;
+
+    queueContext.d_isLeastOutstanding = true;
+
+    mqbmock::QueueHandle         handle1 = storage.getHandle();
+    mqbmock::QueueHandle         handle2 = storage.getHandle();
+    bmqp_ctrlmsg::SubQueueIdInfo subStreamInfo1(s_allocator_p);
+    bmqp_ctrlmsg::SubQueueIdInfo subStreamInfo2(s_allocator_p);
+
+    subStreamInfo1.appId() = appId;
+    subStreamInfo1.subId() = subQueueId;
+    subStreamInfo2.appId() = appId;
+    subStreamInfo2.subId() = subQueueId + 1;
+
+    handle1.registerSubStream(subStreamInfo1,
+                              upstreamSubQueueId,
+                              mqbi::QueueCounts(1, 0));
+    handle2.registerSubStream(subStreamInfo2,
+                              upstreamSubQueueId,
+                              mqbi::QueueCounts(1, 0));
+
+    streamParams.appId() = appId;
+    streamParams.subscriptions().resize(1);
+    streamParams.subscriptions()[0].consumers().resize(1);
+    {
+        bmqp_ctrlmsg::ConsumerInfo& ci =
+            streamParams.subscriptions()[0].consumers()[0];
+
+        ci.consumerPriority()       = 1;
+        ci.consumerPriorityCount()  = 2;
+        ci.maxUnconfirmedMessages() = 1024;
+        ci.maxUnconfirmedBytes()    = 1024;
+    }
+    handle1.setStreamParameters(streamParams);
+    handle2.setStreamParameters(streamParams);
+
+    {
+        mqbblp::Routers::AppContext appContext(queueContext, s_allocator_p);
+        mwcu::MemOutStream          errorStream(s_allocator_p);
+
+        appContext.load(&handle1,
+                        &errorStream,
+                        subStreamInfo1.subId(),
+                        upstreamSubQueueId,
+                        streamParams,
+                        0);
+        ASSERT_EQ(errorStream.str(), "");
+        appContext.load(&handle2,
+                        &errorStream,
+                        subStreamInfo2.subId(),
+                        upstreamSubQueueId,
+                        streamParams,
+                        0);
+        ASSERT_EQ(errorStream.str(), "");
+        appContext.finalize();
+        appContext.registerSubscriptions();
+
+        Visitor visitor1, visitor2, visitor3;
+
+        ASSERT_EQ(appContext.d_router.iterateGroups(
+                      bdlf::BindUtil::bind(&Visitor::visit,
+                                           &visitor1,
+                                           bdlf::PlaceHolders::_1),
+                      storage.d_iterator.get()),
+                  mqbblp::Routers::e_SUCCESS);
+        ASSERT_EQ(appContext.d_router.iterateGroups(
+                      bdlf::BindUtil::bind(&Visitor::visit,
+                                           &visitor2,
+                                           bdlf::PlaceHolders::_1),
+                      storage.d_iterator.get()),
+                  mqbblp::Routers::e_SUCCESS);
+        ASSERT_EQ(appContext.d_router.iterateGroups(
+                      bdlf::BindUtil::bind(&Visitor::visit,
+                                           &visitor3,
+                                           bdlf::PlaceHolders::_1),
+                      storage.d_iterator.get()),
+                  mqbblp::Routers::e_SUCCESS);
+
+        ASSERT_NE(visitor1.d_handle, visitor2.d_handle);
+        ASSERT_EQ(visitor1.d_handle, visitor3.d_handle);
+    }
+
+    ASSERT_EQ(handle1.unregisterSubStream(subStreamInfo1,
+                                          mqbi::QueueCounts(1, 0),
+                                          false),
+              true);
+    ASSERT_EQ(handle2.unregisterSubStream(subStreamInfo2,
+                                          mqbi::QueueCounts(1, 0),
+                                          false),
+              true);
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -533,6 +637,7 @@ int main(int argc, char* argv[])
     case 2: test2_priority(); break;
     case 3: test3_parse(); break;
     case 4: test4_generate(); break;
+    case 5: test5_leastOutstanding(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
@@ -83,6 +83,12 @@ namespace mqbblp {
 namespace {
 const int k_GC_MESSAGES_INTERVAL_SECONDS = 60;
 
+const size_t k_DOMAINS_PER_BATCH = 16;
+// Number of recovered domains created by a
+// single job of the misc work thread pool.
+
+typedef bsl::map<bsl::string, mqbi::Domain*>::iterator DomainMapIter;
+
 bsl::ostream& printRecoveryBanner(bsl::ostream&      out,
                                   const bsl::string& lastLineSuffix)
 {
@@ -100,6 +106,37 @@ bsl::ostream& printRecoveryBanner(bsl::ostream&      out,
     return out;
 }
 
+/// Request the specified `domainFactory` to create the domain of each
+/// element of the range [`begin`, `end`), loading it into the value of the
+/// element, and arriving on the specified `latch` once per domain.  Use the
+/// specified `clusterDescription` and `partitionId` for logging.
+void createDomainBatch(DomainMapIter        begin,
+                       DomainMapIter        end,
+                       mqbi::DomainFactory* domainFactory,
+                       bslmt::Latch*        latch,
+                       const bsl::string&   clusterDescription,
+                       int                  partitionId)
+{
+    BALL_LOG_SET_CATEGORY("MQBBLP.STORAGEMANAGER");
+
+    for (DomainMapIter dit = begin; dit != end; ++dit) {
+        BALL_LOG_INFO << clusterDescription << ": PartitionId ["
+                      << partitionId << "]: requesting domain for ["
+                      << dit->first << "].";
+
+        domainFactory->createDomain(
+            dit->first,
+            bdlf::BindUtil::bind(&mqbc::StorageUtil::onDomain,
+                                 bdlf::PlaceHolders::_1,  // status
+                                 bdlf::PlaceHolders::_2,  // domain*
+                                 &(dit->second),
+                                 latch,
+                                 clusterDescription,
+                                 dit->first,
+                                 partitionId));
+    }
+}
+
 /// Return true if the leader message sequence number in the specified `lms`
 /// is zero, false otherwise.
 bool isZero(const bmqp_ctrlmsg::LeaderMessageSequence& lms)
@@ -544,8 +581,6 @@ void StorageManager::recoveredQueuesCbImpl(
                   << ": PartitionId [" << partitionId << "] recovered ["
                   << queueKeyInfoMap.size() << "] queues";
 
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_storagesLock);  // LOCK
-
     mqbs::FileStore* fs = d_fileStores[partitionId].get();
     BSLS_ASSERT_SAFE(fs);
 
@@ -665,27 +700,63 @@ void StorageManager::recoveredQueuesCbImpl(
     // which itself is executed by each partition.  Blocking is not ideal, but
     // the broker is starting at this point, so its ok to do so.  Note that we
     // first issue all domain creation requests, and then block, instead of
-    // issuing and blocking on one request at a time.
-    bslmt::Latch latch(domainMap.size());
-
-    for (DomainMapIter dit = domainMap.begin(); dit != domainMap.end();
-         ++dit) {
-        BALL_LOG_INFO << d_clusterData_p->identity().description()
-                      << ": PartitionId [" << partitionId
-                      << "]: requesting domain for [" << dit->first << "].";
+    // issuing and blocking on one request at a time.  Also note that
+    // 'd_storagesLock' is not held while blocking, so that partitions
+    // recovered in different threads don't wait for each other's domains.
+    //
+    // Resolving the location and the configuration of a domain may be slow,
+    // and a domain factory usually does it in the thread issuing the request,
+    // so the requests are issued in batches of 'k_DOMAINS_PER_BATCH' domains,
+    // all but the first of which are issued by the threads of the misc work
+    // thread pool.
+    bslmt::Latch       latch(domainMap.size());
+    const bsl::string& clusterDescription =
+        d_clusterData_p->identity().description();
+
+    DomainMapIter firstBatchEnd = domainMap.begin();
+    for (size_t i = 0;
+         i < k_DOMAINS_PER_BATCH && firstBatchEnd != domainMap.end();
+         ++i) {
+        ++firstBatchEnd;
+    }
+
+    DomainMapIter batchBegin = firstBatchEnd;
+    while (batchBegin != domainMap.end()) {
+        DomainMapIter batchEnd = batchBegin;
+        for (size_t i = 0;
+             i < k_DOMAINS_PER_BATCH && batchEnd != domainMap.end();
+             ++i) {
+            ++batchEnd;
+        }
 
-        d_domainFactory_p->createDomain(
-            dit->first,
-            bdlf::BindUtil::bind(&mqbc::StorageUtil::onDomain,
-                                 bdlf::PlaceHolders::_1,  // status
-                                 bdlf::PlaceHolders::_2,  // domain*
-                                 &(dit->second),
+        int rc = d_miscWorkThreadPool_p->enqueueJob(
+            bdlf::BindUtil::bind(&createDomainBatch,
+                                 batchBegin,
+                                 batchEnd,
+                                 d_domainFactory_p,
                                  &latch,
-                                 d_clusterData_p->identity().description(),
-                                 dit->first,
+                                 clusterDescription,
                                  partitionId));
+        if (0 != rc) {
+            // Thread pool is stopped, issue the requests from this thread.
+            createDomainBatch(batchBegin,
+                              batchEnd,
+                              d_domainFactory_p,
+                              &latch,
+                              clusterDescription,
+                              partitionId);
+        }
+
+        batchBegin = batchEnd;
     }
 
+    createDomainBatch(domainMap.begin(),
+                      firstBatchEnd,
+                      d_domainFactory_p,
+                      &latch,
+                      clusterDescription,
+                      partitionId);
+
     BALL_LOG_INFO << d_clusterData_p->identity().description()
                   << ": PartitionId [" << partitionId
                   << "]: about to wait for [" << domainMap.size()
@@ -697,6 +768,8 @@ void StorageManager::recoveredQueuesCbImpl(
                   << "]: domain creation step complete. Checking if all "
                   << "domains were created successfully.";
 
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_storagesLock);  // LOCK
+
     mqbs::StorageUtil::DomainQueueMessagesCountMap& unrecognizedDomains =
         d_unrecognizedDomains[partitionId];
     for (DomainMapIter dit = domainMap.begin(); dit != domainMap.end();
@@ -1335,13 +1408,24 @@ void StorageManager::processStorageEventDispatched(
     BSLS_ASSERT_SAFE(fs);
 
     const PartitionInfo& pinfo = d_partitionInfoVec[partitionId];
-    BSLS_ASSERT_SAFE(pinfo.primary() == source);
+    BSLS_ASSERT_SAFE(pinfo.primary() == source ||
+                     d_clusterConfig.partitionConfig().chainReplication());
     BSLS_ASSERT_SAFE(pinfo.primaryStatus() ==
                      bmqp_ctrlmsg::PrimaryStatus::E_ACTIVE);
-    (void)pinfo;  // silence compiler warning
+
+    // The event may have been relayed by another replica if storage records
+    // are replicated along a chain; it still originates from the primary,
+    // which is the node recovery and receipts are concerned with.
+    mqbnet::ClusterNode* primary = pinfo.primary();
+    (void)source;  // silence compiler warning
+    if (0 == primary) {
+        // Primary has been cleared since the event was received.
+
+        return;  // RETURN
+    }
 
     if (d_recoveryManager_mp->isRecoveryInProgress(partitionId)) {
-        d_recoveryManager_mp->processStorageEvent(partitionId, blob, source);
+        d_recoveryManager_mp->processStorageEvent(partitionId, blob, primary);
         return;  // RETURN
     }
 
@@ -1354,7 +1438,7 @@ void StorageManager::processStorageEventDispatched(
         return;  // RETURN
     }
 
-    fs->processStorageEvent(blob, false /* isPartitionSyncEvent */, source);
+    fs->processStorageEvent(blob, false /* isPartitionSyncEvent */, primary);
 }
 
 void StorageManager::processPartitionSyncEvent(
@@ -2121,7 +2205,8 @@ int StorageManager::start(bsl::ostream& errorDescription)
                              &d_isStarted,
                              d_minimumRequiredDiskSpace,
                              d_clusterData_p->identity().description(),
-                             d_clusterConfig.partitionConfig()));
+                             d_clusterConfig.partitionConfig(),
+                             d_miscWorkThreadPool_p));
 
     rc = mqbc::StorageUtil::assignPartitionDispatcherThreads(
         d_miscWorkThreadPool_p,
@@ -2457,6 +2542,11 @@ void StorageManager::processStorageEvent(
         return;  // RETURN
     }
 
+    mqbc::StorageUtil::relayStorageEvent(*event.blob(),
+                                         pid,
+                                         d_clusterState,
+                                         d_clusterData_p);
+
     mqbs::FileStore* fs = d_fileStores[pid].get();
     BSLS_ASSERT_SAFE(fs);
 
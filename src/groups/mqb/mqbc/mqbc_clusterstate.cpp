@@ -323,43 +323,36 @@ bool ClusterState::assignQueue(const bmqt::Uri&        uri,
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(cluster()->dispatcher()->inDispatcherThread(cluster()));
 
-    bool                   isNewAssignment = true;
-    const DomainStatesIter domIt = d_domainStates.find(uri.qualifiedDomain());
+    bool isNewAssignment = true;
 
-    if (domIt == d_domainStates.end()) {
-        d_domainStates[uri.qualifiedDomain()].createInplace(d_allocator_p,
-                                                            d_allocator_p);
-        d_domainStates.at(uri.qualifiedDomain())
-            ->queuesInfo()[uri]
-            .createInplace(d_allocator_p,
-                           uri,
-                           key,
-                           partitionId,
-                           appIdInfos,
-                           d_allocator_p);
+    DomainStateSp& domainState = d_domainStates[uri.qualifiedDomain()];
+    if (!domainState) {
+        domainState.createInplace(d_allocator_p, d_allocator_p);
+    }
+
+    QueueInfoSp& queueInfo = domainState->queuesInfo()[uri];
+    if (!queueInfo) {
+        queueInfo.createInplace(d_allocator_p,
+                                uri,
+                                key,
+                                partitionId,
+                                appIdInfos,
+                                d_allocator_p);
     }
     else {
-        const UriToQueueInfoMapIter iter = domIt->second->queuesInfo().find(
-            uri);
-        if (iter == domIt->second->queuesInfo().end()) {
-            domIt->second->queuesInfo()[uri].createInplace(d_allocator_p,
-                                                           uri,
-                                                           key,
-                                                           partitionId,
-                                                           appIdInfos,
-                                                           d_allocator_p);
-        }
-        else {
-            isNewAssignment = false;
+        isNewAssignment = false;
 
-            updatePartitionQueueMapped(iter->second->partitionId(), -1);
-            iter->second->setKey(key).setPartitionId(partitionId);
-            iter->second->appIdInfos() = appIdInfos;
-            iter->second->setPendingUnassignment(false);
-        }
+        const int previousPartitionId = queueInfo->partitionId();
+        updatePartitionQueueMapped(previousPartitionId, -1);
+        d_queuesInfoPerPartition[previousPartitionId].erase(uri);
+
+        queueInfo->setKey(key).setPartitionId(partitionId);
+        queueInfo->appIdInfos() = appIdInfos;
+        queueInfo->setPendingUnassignment(false);
     }
 
     updatePartitionQueueMapped(partitionId, 1);
+    d_queuesInfoPerPartition[partitionId][uri] = queueInfo;
 
     mwcu::Printer<AppIdInfos> printer(&appIdInfos);
     BALL_LOG_INFO << "Cluster [" << d_cluster_p->name() << "]: "
@@ -368,13 +361,19 @@ bool ClusterState::assignQueue(const bmqt::Uri&        uri,
                   << "] with appIdInfos: [" << printer
                   << "], isNewAssignment: " << isNewAssignment << ".";
 
-    for (ObserversSetIter it = d_observers.begin(); it != d_observers.end();
-         ++it) {
-        (*it)->onQueueAssigned(ClusterStateQueueInfo(uri,
-                                                     key,
-                                                     partitionId,
-                                                     appIdInfos,
-                                                     d_allocator_p));
+    if (!d_observers.empty()) {
+        // Build the information passed to the observers only once, rather
+        // than once per observer.
+        const ClusterStateQueueInfo info(uri,
+                                         key,
+                                         partitionId,
+                                         appIdInfos,
+                                         d_allocator_p);
+        for (ObserversSetIter it = d_observers.begin();
+             it != d_observers.end();
+             ++it) {
+            (*it)->onQueueAssigned(info);
+        }
     }
 
     // POSTCONDITIONS
@@ -417,6 +416,7 @@ bool ClusterState::unassignQueue(const bmqt::Uri& uri)
         (*it)->onQueueUnassigned(*cit->second);
     }
 
+    d_queuesInfoPerPartition[partitionId].erase(uri);
     domIt->second->queuesInfo().erase(cit);
 
     // POSTCONDITIONS
@@ -441,14 +441,13 @@ void ClusterState::clearQueues()
                   << " domain states from state.";
 
     for (DomainStatesCIter domCit = d_domainStates.cbegin();
-         domCit != d_domainStates.cend();
-         ++domCit) {
+         domCit != d_domainStates.cend();) {
         for (UriToQueueInfoMapCIter cit =
                  domCit->second->queuesInfo().cbegin();
              cit != domCit->second->queuesInfo().cend();) {
             unassignQueue((cit++)->first);
         }
-        d_domainStates.erase(domCit);
+        domCit = d_domainStates.erase(domCit);
     }
 }
 
@@ -537,6 +536,7 @@ void ClusterState::clear()
     d_observers.clear();
     d_queueKeys.clear();
     d_domainStates.clear();
+    d_queuesInfoPerPartition.clear();
     d_partitionsInfo.clear();
     d_cluster_p = 0;
 }
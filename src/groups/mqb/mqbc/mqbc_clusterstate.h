@@ -50,6 +50,7 @@
 #include <bsl_unordered_map.h>
 #include <bsl_unordered_set.h>
 #include <bsl_utility.h>
+#include <bsl_vector.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bsls_assert.h>
@@ -379,6 +380,9 @@ class ClusterState {
     typedef UriToQueueInfoMap::iterator                UriToQueueInfoMapIter;
     typedef UriToQueueInfoMap::const_iterator          UriToQueueInfoMapCIter;
 
+    /// partitionId -> <canonicalURI> -> <queueInformation>
+    typedef bsl::vector<UriToQueueInfoMap> QueuesInfoPerPartition;
+
     struct DomainState {
       private:
         // DATA
@@ -478,6 +482,13 @@ class ClusterState {
     DomainStates d_domainStates;
     // Domains information
 
+    QueuesInfoPerPartition d_queuesInfoPerPartition;
+    // Information of the queues assigned to
+    // each partition, indexed by partitionId.
+    // This is a secondary index of the queues
+    // held in 'd_domainStates', sharing the
+    // same queue information objects.
+
     QueueKeys d_queueKeys;
     // Set of all existing queue keys.
 
@@ -608,6 +619,12 @@ class ClusterState {
     /// Return the value of the corresponding member of this object.
     const ObserversSet& observers() const;
 
+    /// Return a reference not offering modifiable access to the information
+    /// of the queues currently assigned to the specified `partitionId`.
+    /// The behavior is undefined unless `partitionId >= 0` and
+    /// `partitionId < partitionsCount()`.
+    const UriToQueueInfoMap& queuesInfoPerPartition(int partitionId) const;
+
     // Partition-related
     // -----------------
 
@@ -864,6 +881,7 @@ inline ClusterState::ClusterState(mqbi::Cluster*    cluster,
 , d_cluster_p(cluster)
 , d_partitionsInfo(allocator)
 , d_domainStates(allocator)
+, d_queuesInfoPerPartition(allocator)
 , d_queueKeys(allocator)
 , d_observers(allocator)
 , d_partitionIdExtractor(allocator)
@@ -878,6 +896,7 @@ inline ClusterState::ClusterState(mqbi::Cluster*    cluster,
     for (int i = 0; i < partitionsCount; ++i) {
         d_partitionsInfo[i].setPartitionId(i);
     }
+    d_queuesInfoPerPartition.resize(partitionsCount);
 }
 
 // MANIPULATORS
@@ -922,6 +941,17 @@ inline const ClusterState::ObserversSet& ClusterState::observers() const
     return d_observers;
 }
 
+inline const ClusterState::UriToQueueInfoMap&
+ClusterState::queuesInfoPerPartition(int partitionId) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(partitionId >= 0);
+    BSLS_ASSERT_SAFE(partitionId <
+                     static_cast<int>(d_queuesInfoPerPartition.size()));
+
+    return d_queuesInfoPerPartition[partitionId];
+}
+
 inline int ClusterState::extractPartitionId(const bsl::string& queueName) const
 {
     return d_partitionIdExtractor.extract(queueName);
@@ -469,6 +469,19 @@ class ClusterStateManager
     assignQueue(const bmqt::Uri&      uri,
                 bmqp_ctrlmsg::Status* status = 0) BSLS_KEYWORD_OVERRIDE;
 
+    /// Perform the actual assignment of the queues represented by the
+    /// specified `uris`, as per `assignQueue`, but applying a single queue
+    /// assignment advisory for all of them whenever possible.  Load into
+    /// the specified `results` the result of the assignment of each queue,
+    /// in the order of `uris`.  This method is called only on the leader
+    /// node.
+    ///
+    /// THREAD: This method is invoked in the associated cluster's
+    ///         dispatcher thread.
+    virtual void
+    assignQueues(bsl::vector<QueueAssignmentResult::Enum>* results,
+                 const bsl::vector<bmqt::Uri>& uris) BSLS_KEYWORD_OVERRIDE;
+
     /// Register a queue info for the queue with the specified `uri`,
     /// `partitionId`, `queueKey` and the optionally specified `appIdInfos`.
     /// If no `appIdInfos` is specified, use the appId infos from the domain
@@ -604,6 +617,16 @@ class ClusterStateManager
         const bmqp_ctrlmsg::ControlMessage& request,
         mqbnet::ClusterNode*                requester) BSLS_KEYWORD_OVERRIDE;
 
+    /// Process the queue assignments in the specified `requests`, each
+    /// received from its associated requester, as per
+    /// `processQueueAssignmentRequest`, but assigning the queues with a
+    /// single queue assignment advisory whenever possible.
+    ///
+    /// THREAD: This method is invoked in the associated cluster's
+    ///         dispatcher thread.
+    virtual void processQueueAssignmentRequests(
+        const QueueAssignmentRequests& requests) BSLS_KEYWORD_OVERRIDE;
+
     /// Process the specified queue assignment advisory `message` from the
     /// specified `source`.  If the specified `delayed` is true, the
     /// advisory has previously been delayed for processing.
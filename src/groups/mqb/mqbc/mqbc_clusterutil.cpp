@@ -48,8 +48,11 @@
 #include <bdlb_print.h>
 #include <bdlde_md5.h>
 #include <bdlma_localsequentialallocator.h>
+#include <bsl_limits.h>
+#include <bsl_unordered_map.h>
 #include <bsl_unordered_set.h>
 #include <bsl_utility.h>
+#include <bsl_vector.h>
 #include <bslma_managedptr.h>
 
 namespace BloombergLP {
@@ -355,6 +358,188 @@ void createDomainCb(const bmqp_ctrlmsg::Status& status,
     domainState->setDomain(domain);
 }
 
+/// Prepare the assignment of the queue represented by the specified `uri`
+/// in the specified `clusterState` of the specified `cluster` having the
+/// specified `clusterData`, that is create the domain of the queue if
+/// needed and check that this domain has not reached its maximum number of
+/// queues.  Load into the specified `domainState` the state of the domain
+/// of the queue.  Return a value indicating whether the assignment can
+/// proceed or was definitively rejected, and populate the optionally
+/// specified `status` with a human readable error code and string in case
+/// of rejection.  Use the specified `allocator` for memory allocations.
+ClusterUtil::QueueAssignmentResult::Enum
+prepareQueueAssignment(ClusterState::DomainStateSp* domainState,
+                       ClusterState*                clusterState,
+                       ClusterData*                 clusterData,
+                       const mqbi::Cluster*         cluster,
+                       const bmqt::Uri&             uri,
+                       bslma::Allocator*            allocator,
+                       bmqp_ctrlmsg::Status*        status)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(domainState);
+
+    BALL_LOG_SET_CATEGORY(k_LOG_CATEGORY);
+
+    ClusterUtil::DomainStatesIter domIt = clusterState->domainStates().find(
+        uri.qualifiedDomain());
+    if (domIt == clusterState->domainStates().end()) {
+        clusterState->domainStates()[uri.qualifiedDomain()].createInplace(
+            allocator,
+            allocator);
+        domIt = clusterState->domainStates().find(uri.qualifiedDomain());
+    }
+    *domainState = domIt->second;
+
+    if (domIt->second->domain() == 0) {
+        clusterData->domainFactory()->createDomain(
+            uri.qualifiedDomain(),
+            bdlf::BindUtil::bind(&createDomainCb,
+                                 bdlf::PlaceHolders::_1,  // status
+                                 bdlf::PlaceHolders::_2,  // domain
+                                 domIt->second));
+
+        if (domIt->second->domain() == 0) {
+            BALL_LOG_ERROR << cluster->description()
+                           << ": Unable to create domain '"
+                           << uri.qualifiedDomain() << "'";
+
+            if (status) {
+                status->category() = bmqp_ctrlmsg::StatusCategory::E_REFUSED;
+                status->code()     = mqbi::ClusterErrorCode::e_UNKNOWN;
+                status->message()  = k_DOMAIN_CREATION_FAILURE;
+            }
+
+            return ClusterUtil::QueueAssignmentResult::
+                k_ASSIGNMENT_REJECTED;  // RETURN
+        }
+    }
+
+    struct local {
+        static void panic(mqbi::Domain* domain)
+        {
+            MWCTSK_ALARMLOG_PANIC("DOMAIN_QUEUE_LIMIT_FULL")
+                << "domain '" << domain->name()
+                << "' has reached the maximum number of queues (limit: "
+                << domain->config().maxQueues() << ")." << MWCTSK_ALARMLOG_END;
+        }
+
+        static void alarm(mqbi::Domain* domain, int queues)
+        {
+            MWCTSK_ALARMLOG_ALARM("DOMAIN_QUEUE_LIMIT_HIGH_WATERMARK")
+                << "domain '" << domain->name() << "' has reached the "
+                << (k_MAX_QUEUES_HIGH_WATERMARK * 100)
+                << "% watermark limit for the number of queues "
+                   "(current: "
+                << queues << ", limit: " << domain->config().maxQueues()
+                << ")." << MWCTSK_ALARMLOG_END;
+        }
+    };
+
+    const int registeredQueues = domIt->second->numAssignedQueues();
+    const int maxQueues        = domIt->second->domain()->config().maxQueues();
+    if (maxQueues != 0) {
+        const int requestedQueues = registeredQueues + 1;
+        if (requestedQueues > maxQueues) {
+            local::panic(domIt->second->domain());
+        }
+        else {
+            const int watermark = static_cast<int>(
+                maxQueues * k_MAX_QUEUES_HIGH_WATERMARK);
+            if (registeredQueues < watermark && requestedQueues >= watermark) {
+                local::alarm(domIt->second->domain(), requestedQueues);
+            }
+        }
+
+        if (requestedQueues > maxQueues) {
+            if (status) {
+                status->category() = bmqp_ctrlmsg::StatusCategory::E_REFUSED;
+                status->code()     = mqbi::ClusterErrorCode::e_LIMIT;
+                status->message()  = k_MAXIMUM_NUMBER_OF_QUEUES_REACHED;
+            }
+
+            return ClusterUtil::QueueAssignmentResult::
+                k_ASSIGNMENT_REJECTED;  // RETURN
+        }
+    }
+
+    // Queue is no longer pending unassignment
+    ClusterUtil::UriToQueueInfoMapCIter qcit =
+        domIt->second->queuesInfo().find(uri);
+    if (qcit != domIt->second->queuesInfo().cend()) {
+        BSLS_ASSERT_SAFE(cluster->isCSLModeEnabled() &&
+                         qcit->second->pendingUnassignment());
+        qcit->second->setPendingUnassignment(false);
+    }
+
+    return ClusterUtil::QueueAssignmentResult::k_ASSIGNMENT_OK;
+}
+
+/// Return true if self node, as per the specified `clusterData`, is able to
+/// process queue assignment requests, i.e. is the active leader and is not
+/// stopping.  Otherwise, populate the specified `failure` with the reason
+/// and return false.
+bool canProcessQueueAssignmentRequests(bmqp_ctrlmsg::Status* failure,
+                                       ClusterData*          clusterData)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(failure);
+    BSLS_ASSERT_SAFE(clusterData);
+
+    if (!clusterData->electorInfo().isSelfLeader()) {
+        // We are no longer the leader, reply with a clear failure so that the
+        // sender will know to retry/wait for a new leader.
+
+        failure->category() = bmqp_ctrlmsg::StatusCategory::E_REFUSED;
+        failure->code()     = mqbi::ClusterErrorCode::e_NOT_LEADER;
+        failure->message()  = "No longer leader";
+        return false;  // RETURN
+    }
+
+    if (!clusterData->electorInfo().isSelfActiveLeader()) {
+        // We are not ACTIVE leader, reply with a clear failure so that the
+        // sender will know to retry/wait for a new leader.
+
+        failure->category() = bmqp_ctrlmsg::StatusCategory::E_REFUSED;
+        failure->code()     = mqbi::ClusterErrorCode::e_NOT_LEADER;
+        failure->message()  = "Not an active leader";
+        return false;  // RETURN
+    }
+
+    if (bmqp_ctrlmsg::NodeStatus::E_STOPPING ==
+        clusterData->membership().selfNodeStatus()) {
+        // We are the ACTIVE leader, but we are stopping. Reply with a clear
+        // failure so that the sender will know to retry/wait for a new leader.
+
+        failure->category() = bmqp_ctrlmsg::StatusCategory::E_REFUSED;
+        failure->code()     = mqbi::ClusterErrorCode::e_STOPPING;
+        failure->message()  = "Leader is stopping";
+        return false;  // RETURN
+    }
+
+    return true;
+}
+
+/// Return true if the queue with the specified `uri` is assigned in the
+/// specified `clusterState` of the specified `cluster`, and is not pending
+/// unassignment.
+bool isQueueAssigned(const ClusterState& clusterState,
+                     const mqbi::Cluster& cluster,
+                     const bmqt::Uri&     uri)
+{
+    const ClusterUtil::DomainStatesCIter cit =
+        clusterState.domainStates().find(uri.qualifiedDomain());
+    if (cit == clusterState.domainStates().cend()) {
+        return false;  // RETURN
+    }
+
+    ClusterUtil::UriToQueueInfoMapCIter qcit = cit->second->queuesInfo().find(
+        uri);
+    return qcit != cit->second->queuesInfo().cend() &&
+           !(cluster.isCSLModeEnabled() &&
+             qcit->second->pendingUnassignment());
+}
+
 }  // close anonymous namespace
 
 // ------------------
@@ -693,42 +878,8 @@ void ClusterUtil::processQueueAssignmentRequest(
     bmqp_ctrlmsg::ControlMessage          response(&localAllocator);
     response.rId() = request.rId();
 
-    if (!clusterData->electorInfo().isSelfLeader()) {
-        // We are no longer the leader, reply with a clear failure so that the
-        // sender will know to retry/wait for a new leader.
-
-        bmqp_ctrlmsg::Status& failure = response.choice().makeStatus();
-        failure.category() = bmqp_ctrlmsg::StatusCategory::E_REFUSED;
-        failure.code()     = mqbi::ClusterErrorCode::e_NOT_LEADER;
-        failure.message()  = "No longer leader";
-
-        clusterData->messageTransmitter().sendMessage(response, requester);
-        return;  // RETURN
-    }
-
-    if (!clusterData->electorInfo().isSelfActiveLeader()) {
-        // We are not ACTIVE leader, reply with a clear failure so that the
-        // sender will know to retry/wait for a new leader.
-
-        bmqp_ctrlmsg::Status& failure = response.choice().makeStatus();
-        failure.category() = bmqp_ctrlmsg::StatusCategory::E_REFUSED;
-        failure.code()     = mqbi::ClusterErrorCode::e_NOT_LEADER;
-        failure.message()  = "Not an active leader";
-
-        clusterData->messageTransmitter().sendMessage(response, requester);
-        return;  // RETURN
-    }
-
-    if (bmqp_ctrlmsg::NodeStatus::E_STOPPING ==
-        clusterData->membership().selfNodeStatus()) {
-        // We are the ACTIVE leader, but we are stopping. Reply with a clear
-        // failure so that the sender will know to retry/wait for a new leader.
-
-        bmqp_ctrlmsg::Status& failure = response.choice().makeStatus();
-        failure.category() = bmqp_ctrlmsg::StatusCategory::E_REFUSED;
-        failure.code()     = mqbi::ClusterErrorCode::e_STOPPING;
-        failure.message()  = "Leader is stopping";
-
+    bmqp_ctrlmsg::Status& status = response.choice().makeStatus();
+    if (!canProcessQueueAssignmentRequests(&status, clusterData)) {
         clusterData->messageTransmitter().sendMessage(response, requester);
         return;  // RETURN
     }
@@ -737,22 +888,14 @@ void ClusterUtil::processQueueAssignmentRequest(
         request.choice().clusterMessage().choice().queueAssignmentRequest();
     bmqt::Uri uri(assignment.queueUri(), &localAllocator);
 
-    bmqp_ctrlmsg::Status& status = response.choice().makeStatus();
-    status.category()            = bmqp_ctrlmsg::StatusCategory::E_SUCCESS;
-    status.code()                = 0;
-    status.message()             = "";
+    status.category() = bmqp_ctrlmsg::StatusCategory::E_SUCCESS;
+    status.code()     = 0;
+    status.message()  = "";
 
-    const DomainStatesCIter cit = clusterState->domainStates().find(
-        uri.qualifiedDomain());
-    if (cit != clusterState->domainStates().cend()) {
-        UriToQueueInfoMapCIter qcit = cit->second->queuesInfo().find(uri);
-        if (qcit != cit->second->queuesInfo().cend() &&
-            !(cluster->isCSLModeEnabled() &&
-              qcit->second->pendingUnassignment())) {
-            // Queue is already assigned
-            clusterData->messageTransmitter().sendMessage(response, requester);
-            return;  // RETURN
-        }
+    if (isQueueAssigned(*clusterState, *cluster, uri)) {
+        // Queue is already assigned
+        clusterData->messageTransmitter().sendMessage(response, requester);
+        return;  // RETURN
     }
 
     assignQueue(clusterState,
@@ -767,6 +910,127 @@ void ClusterUtil::processQueueAssignmentRequest(
     clusterData->messageTransmitter().sendMessage(response, requester);
 }
 
+void ClusterUtil::processQueueAssignmentRequests(
+    ClusterState*                  clusterState,
+    ClusterData*                   clusterData,
+    ClusterStateLedger*            ledger,
+    const mqbi::Cluster*           cluster,
+    const QueueAssignmentRequests& requests,
+    const QueueAssigningCb&        queueAssigningCb,
+    bslma::Allocator*              allocator)
+{
+    // executed by the cluster *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(cluster->dispatcher()->inDispatcherThread(cluster));
+    BSLS_ASSERT_SAFE(!cluster->isRemote());
+    BSLS_ASSERT_SAFE(clusterState);
+    BSLS_ASSERT_SAFE(clusterData);
+    BSLS_ASSERT_SAFE(ledger && ledger->isOpen());
+    BSLS_ASSERT_SAFE(allocator);
+
+    if (requests.size() == 1 || cluster->isCSLModeEnabled()) {
+        // Nothing to batch (see 'assignQueues' for CSL mode)
+        for (size_t i = 0; i < requests.size(); ++i) {
+            processQueueAssignmentRequest(clusterState,
+                                          clusterData,
+                                          ledger,
+                                          cluster,
+                                          requests[i].first,
+                                          requests[i].second,
+                                          queueAssigningCb,
+                                          allocator);
+        }
+        return;  // RETURN
+    }
+
+    BALL_LOG_INFO << cluster->description() << ": Processing "
+                  << requests.size() << " queueAssignment requests";
+
+    typedef bsl::unordered_map<bmqt::Uri, size_t> UriToIndexMap;
+
+    const size_t k_NO_INDEX = bsl::numeric_limits<size_t>::max();
+
+    bmqp_ctrlmsg::Status failure(allocator);
+    const bool           canProcess = canProcessQueueAssignmentRequests(
+        &failure,
+        clusterData);
+
+    // Responses to send, in the order of 'requests', along with the index in
+    // 'uris' of the queue each request is waiting for, if any.  Requests for
+    // the same queue are served by a single assignment.
+    bsl::vector<bmqp_ctrlmsg::ControlMessage> responses(requests.size(),
+                                                        allocator);
+    bsl::vector<size_t>    uriIndices(requests.size(), k_NO_INDEX, allocator);
+    bsl::vector<bmqt::Uri> uris(allocator);
+    UriToIndexMap          uriToIndex(allocator);
+    uris.reserve(requests.size());
+
+    for (size_t i = 0; i < requests.size(); ++i) {
+        const bmqp_ctrlmsg::ControlMessage& request = requests[i].first;
+        BSLS_ASSERT_SAFE(request.choice()
+                             .clusterMessage()
+                             .choice()
+                             .isQueueAssignmentRequestValue());
+
+        bmqp_ctrlmsg::ControlMessage& response = responses[i];
+        response.rId()                         = request.rId();
+
+        bmqp_ctrlmsg::Status& status = response.choice().makeStatus();
+        if (!canProcess) {
+            status = failure;
+            continue;  // CONTINUE
+        }
+
+        status.category() = bmqp_ctrlmsg::StatusCategory::E_SUCCESS;
+        status.code()     = 0;
+
+        bmqt::Uri uri(request.choice()
+                          .clusterMessage()
+                          .choice()
+                          .queueAssignmentRequest()
+                          .queueUri(),
+                      allocator);
+        if (isQueueAssigned(*clusterState, *cluster, uri)) {
+            // Queue is already assigned
+            continue;  // CONTINUE
+        }
+
+        bsl::pair<UriToIndexMap::iterator, bool> insertRc = uriToIndex.insert(
+            bsl::make_pair(uri, uris.size()));
+        if (insertRc.second) {
+            uris.push_back(uri);
+        }
+        uriIndices[i] = insertRc.first->second;
+    }
+
+    if (!uris.empty()) {
+        bsl::vector<QueueAssignmentResult::Enum> results(allocator);
+        bsl::vector<bmqp_ctrlmsg::Status>        statuses(allocator);
+        assignQueues(&results,
+                     clusterState,
+                     clusterData,
+                     ledger,
+                     cluster,
+                     uris,
+                     queueAssigningCb,
+                     allocator,
+                     &statuses);
+        BSLS_ASSERT_SAFE(statuses.size() == uris.size());
+
+        for (size_t i = 0; i < requests.size(); ++i) {
+            if (uriIndices[i] != k_NO_INDEX) {
+                responses[i].choice().status() = statuses[uriIndices[i]];
+            }
+        }
+    }
+
+    for (size_t i = 0; i < requests.size(); ++i) {
+        clusterData->messageTransmitter().sendMessage(responses[i],
+                                                      requests[i].second);
+    }
+}
+
 void ClusterUtil::populateQueueAssignmentAdvisory(
     bmqp_ctrlmsg::QueueAssignmentAdvisory* advisory,
     mqbu::StorageKey*                      key,
@@ -881,95 +1145,17 @@ ClusterUtil::assignQueue(ClusterState*           clusterState,
             k_ASSIGNMENT_WHILE_UNAVAILABLE;  // RETURN
     }
 
-    DomainStatesIter domIt = clusterState->domainStates().find(
-        uri.qualifiedDomain());
-    if (domIt == clusterState->domainStates().end()) {
-        clusterState->domainStates()[uri.qualifiedDomain()].createInplace(
-            allocator,
-            allocator);
-        domIt = clusterState->domainStates().find(uri.qualifiedDomain());
-    }
-
-    if (domIt->second->domain() == 0) {
-        clusterData->domainFactory()->createDomain(
-            uri.qualifiedDomain(),
-            bdlf::BindUtil::bind(&createDomainCb,
-                                 bdlf::PlaceHolders::_1,  // status
-                                 bdlf::PlaceHolders::_2,  // domain
-                                 domIt->second));
-
-        if (domIt->second->domain() == 0) {
-            BALL_LOG_ERROR << cluster->description()
-                           << ": Unable to create domain '"
-                           << uri.qualifiedDomain() << "'";
-
-            if (status) {
-                status->category() = bmqp_ctrlmsg::StatusCategory::E_REFUSED;
-                status->code()     = mqbi::ClusterErrorCode::e_UNKNOWN;
-                status->message()  = k_DOMAIN_CREATION_FAILURE;
-            }
-
-            return QueueAssignmentResult::k_ASSIGNMENT_REJECTED;  // RETURN
-        }
-    }
-
-    struct local {
-        static void panic(mqbi::Domain* domain)
-        {
-            MWCTSK_ALARMLOG_PANIC("DOMAIN_QUEUE_LIMIT_FULL")
-                << "domain '" << domain->name()
-                << "' has reached the maximum number of queues (limit: "
-                << domain->config().maxQueues() << ")." << MWCTSK_ALARMLOG_END;
-        }
-
-        static void alarm(mqbi::Domain* domain, int queues)
-        {
-            MWCTSK_ALARMLOG_ALARM("DOMAIN_QUEUE_LIMIT_HIGH_WATERMARK")
-                << "domain '" << domain->name() << "' has reached the "
-                << (k_MAX_QUEUES_HIGH_WATERMARK * 100)
-                << "% watermark limit for the number of queues "
-                   "(current: "
-                << queues << ", limit: " << domain->config().maxQueues()
-                << ")." << MWCTSK_ALARMLOG_END;
-        }
-    };
-
-    const int registeredQueues = domIt->second->numAssignedQueues();
-    const int maxQueues        = domIt->second->domain()->config().maxQueues();
-    if (maxQueues != 0) {
-        const int requestedQueues = registeredQueues + 1;
-        if (requestedQueues > maxQueues) {
-            local::panic(domIt->second->domain());
-        }
-        else {
-            const int watermark = static_cast<int>(
-                maxQueues * k_MAX_QUEUES_HIGH_WATERMARK);
-            if (registeredQueues < watermark && requestedQueues >= watermark) {
-                local::alarm(domIt->second->domain(), requestedQueues);
-            }
-        }
-
-        if (requestedQueues > maxQueues) {
-            if (status) {
-                status->category() = bmqp_ctrlmsg::StatusCategory::E_REFUSED;
-                status->code()     = mqbi::ClusterErrorCode::e_LIMIT;
-                status->message()  = k_MAXIMUM_NUMBER_OF_QUEUES_REACHED;
-            }
-
-            return QueueAssignmentResult::k_ASSIGNMENT_REJECTED;  // RETURN
-        }
-    }
-
-    // Queue is no longer pending unassignment
-    const DomainStatesCIter cit = clusterState->domainStates().find(
-        uri.qualifiedDomain());
-    if (cit != clusterState->domainStates().cend()) {
-        UriToQueueInfoMapCIter qcit = cit->second->queuesInfo().find(uri);
-        if (qcit != cit->second->queuesInfo().cend()) {
-            BSLS_ASSERT_SAFE(cluster->isCSLModeEnabled() &&
-                             qcit->second->pendingUnassignment());
-            qcit->second->setPendingUnassignment(false);
-        }
+    ClusterState::DomainStateSp       domainState;
+    const QueueAssignmentResult::Enum result = prepareQueueAssignment(
+        &domainState,
+        clusterState,
+        clusterData,
+        cluster,
+        uri,
+        allocator,
+        status);
+    if (result != QueueAssignmentResult::k_ASSIGNMENT_OK) {
+        return result;  // RETURN
     }
 
     // Populate 'queueAssignmentAdvisory'
@@ -987,7 +1173,7 @@ ClusterUtil::assignQueue(ClusterState*           clusterState,
                                     clusterState,
                                     clusterData,
                                     uri,
-                                    domIt->second->domain(),
+                                    domainState->domain(),
                                     cluster->isCSLModeEnabled());
     if (cluster->isCSLModeEnabled()) {
         // In CSL mode, we delay the insertion to queueKeys until
@@ -1022,7 +1208,7 @@ ClusterUtil::assignQueue(ClusterState*           clusterState,
             AppIdInfos());
         BSLS_ASSERT_SAFE(assignRc);
 
-        domIt->second->adjustQueueCount(1);
+        domainState->adjustQueueCount(1);
 
         BALL_LOG_INFO << cluster->description()
                       << ": Queue assigned: " << queueAdvisory;
@@ -1036,6 +1222,163 @@ ClusterUtil::assignQueue(ClusterState*           clusterState,
     return QueueAssignmentResult::k_ASSIGNMENT_OK;
 }
 
+void ClusterUtil::assignQueues(
+    bsl::vector<QueueAssignmentResult::Enum>* results,
+    ClusterState*                             clusterState,
+    ClusterData*                              clusterData,
+    ClusterStateLedger*                       ledger,
+    const mqbi::Cluster*                      cluster,
+    const bsl::vector<bmqt::Uri>&             uris,
+    const QueueAssigningCb&                   queueAssigningCb,
+    bslma::Allocator*                         allocator,
+    bsl::vector<bmqp_ctrlmsg::Status>*        statuses)
+{
+    // executed by the cluster *DISPATCHER* thread
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(cluster->dispatcher()->inDispatcherThread(cluster));
+    BSLS_ASSERT_SAFE(!cluster->isRemote());
+    BSLS_ASSERT_SAFE(results);
+    BSLS_ASSERT_SAFE(clusterState);
+    BSLS_ASSERT_SAFE(clusterData);
+    BSLS_ASSERT_SAFE(clusterData->electorInfo().isSelfActiveLeader());
+    BSLS_ASSERT_SAFE(ledger && ledger->isOpen());
+    BSLS_ASSERT_SAFE(allocator);
+
+    results->clear();
+    results->reserve(uris.size());
+
+    if (statuses) {
+        bmqp_ctrlmsg::Status success;
+        success.category() = bmqp_ctrlmsg::StatusCategory::E_SUCCESS;
+        success.code()     = 0;
+
+        statuses->clear();
+        statuses->resize(uris.size(), success);
+    }
+
+    if (cluster->isCSLModeEnabled() || uris.size() == 1) {
+        // In CSL mode, queues are assigned to the cluster state only upon
+        // commit of their advisory, so that assigning several queues with a
+        // single advisory would map all of them to the same partition.
+        // Assign them one by one instead.
+
+        for (size_t i = 0; i < uris.size(); ++i) {
+            results->push_back(assignQueue(clusterState,
+                                           clusterData,
+                                           ledger,
+                                           cluster,
+                                           uris[i],
+                                           queueAssigningCb,
+                                           allocator,
+                                           statuses ? &(*statuses)[i] : 0));
+        }
+        return;  // RETURN
+    }
+
+    const bmqp_ctrlmsg::NodeStatus::Value nodeStatus =
+        clusterData->membership().selfNodeStatus();
+    if (bmqp_ctrlmsg::NodeStatus::E_AVAILABLE != nodeStatus) {
+        BALL_LOG_INFO << cluster->description()
+                      << " Cannot proceed with queueAssignment of "
+                      << uris.size() << " queues because self is "
+                      << nodeStatus;
+
+        results->resize(uris.size(),
+                        QueueAssignmentResult::k_ASSIGNMENT_WHILE_UNAVAILABLE);
+        if (statuses) {
+            for (size_t i = 0; i < statuses->size(); ++i) {
+                bmqp_ctrlmsg::Status& status = (*statuses)[i];
+                status.category() = bmqp_ctrlmsg::StatusCategory::E_REFUSED;
+                status.code()     = mqbi::ClusterErrorCode::e_STOPPING;
+                status.message()  = k_SELF_NODE_IS_STOPPING;
+            }
+        }
+        return;  // RETURN
+    }
+
+    // Populate a single 'queueAssignmentAdvisory' for all the queues.  Each
+    // queue is assigned to the cluster state right away, so that the next
+    // queue of the batch is mapped to the least loaded partition taking it
+    // into account.
+    bmqp_ctrlmsg::ControlMessage           controlMsg(allocator);
+    bmqp_ctrlmsg::QueueAssignmentAdvisory& queueAdvisory =
+        controlMsg.choice()
+            .makeClusterMessage()
+            .choice()
+            .makeQueueAssignmentAdvisory();
+    queueAdvisory.queues().reserve(uris.size());
+
+    for (size_t i = 0; i < uris.size(); ++i) {
+        const bmqt::Uri& uri = uris[i];
+        BSLS_ASSERT_SAFE(uri.isCanonical());
+
+        ClusterState::DomainStateSp       domainState;
+        const QueueAssignmentResult::Enum result = prepareQueueAssignment(
+            &domainState,
+            clusterState,
+            clusterData,
+            cluster,
+            uri,
+            allocator,
+            statuses ? &(*statuses)[i] : 0);
+        results->push_back(result);
+        if (result != QueueAssignmentResult::k_ASSIGNMENT_OK) {
+            continue;  // CONTINUE
+        }
+
+        queueAdvisory.queues().resize(queueAdvisory.queues().size() + 1);
+        bmqp_ctrlmsg::QueueInfo& queueInfo = queueAdvisory.queues().back();
+        queueInfo.uri()                    = uri.asString();
+        queueInfo.partitionId() = getNextPartitionId(*clusterState, uri);
+
+        mqbu::StorageKey key;
+        mqbs::StorageUtil::generateStorageKey(&key,
+                                              &clusterState->queueKeys(),
+                                              uri.asString());
+        key.loadBinary(&queueInfo.key());
+
+        const bool assignRc = clusterState->assignQueue(
+            uri,
+            key,
+            queueInfo.partitionId(),
+            AppIdInfos());
+        BSLS_ASSERT_SAFE(assignRc);
+
+        domainState->adjustQueueCount(1);
+    }
+
+    if (queueAdvisory.queues().empty()) {
+        return;  // RETURN
+    }
+
+    clusterData->electorInfo().nextLeaderMessageSequence(
+        &queueAdvisory.sequenceNumber());
+
+    // Apply 'queueAssignmentAdvisory' to CSL
+    const int rc = ledger->apply(queueAdvisory);
+    if (rc != 0) {
+        BALL_LOG_ERROR << clusterData->identity().description()
+                       << ": Failed to apply queue assignment advisory for "
+                       << queueAdvisory.queues().size() << " queues, with "
+                       << "sequenceNumber: " << queueAdvisory.sequenceNumber()
+                       << ", rc: " << rc;
+    }
+
+    BALL_LOG_INFO << cluster->description() << ": "
+                  << queueAdvisory.queues().size()
+                  << " queues assigned with a single advisory, with "
+                  << "sequenceNumber: " << queueAdvisory.sequenceNumber();
+
+    // Broadcast 'queueAssignmentAdvisory' to all followers
+    clusterData->messageTransmitter().broadcastMessage(controlMsg);
+
+    for (size_t i = 0; i < uris.size(); ++i) {
+        if ((*results)[i] == QueueAssignmentResult::k_ASSIGNMENT_OK) {
+            queueAssigningCb(uris[i], true);  // processingPendingRequests
+        }
+    }
+}
+
 void ClusterUtil::registerQueueInfo(ClusterState*           clusterState,
                                     const mqbi::Cluster*    cluster,
                                     const bmqt::Uri&        uri,
@@ -101,6 +101,9 @@ struct ClusterUtil {
 
     typedef mqbi::ClusterStateManager::QueueAssigningCb QueueAssigningCb;
 
+    typedef mqbi::ClusterStateManager::QueueAssignmentRequests
+        QueueAssignmentRequests;
+
     /// Map of NodeSession -> number of new partitions to assign to it
     typedef bsl::unordered_map<ClusterNodeSession*, unsigned int>
                                                 NumNewPartitionsMap;
@@ -200,6 +203,24 @@ struct ClusterUtil {
                                   const QueueAssigningCb& queueAssigningCb,
                                   bslma::Allocator*       allocator);
 
+    /// Process the queue assignments in the specified `requests`, each
+    /// received from its associated requester, as per
+    /// `processQueueAssignmentRequest`, using the specified `clusterState`,
+    /// `clusterData`, `ledger`, `cluster`, `queueAssigningCb` and
+    /// `allocator`, but assign all the queues not assigned yet with a
+    /// single queue assignment advisory (see `assignQueues`).
+    ///
+    /// THREAD: This method is invoked in the associated cluster's
+    ///         dispatcher thread.
+    static void
+    processQueueAssignmentRequests(ClusterState*                  clusterState,
+                                   ClusterData*                   clusterData,
+                                   ClusterStateLedger*            ledger,
+                                   const mqbi::Cluster*           cluster,
+                                   const QueueAssignmentRequests& requests,
+                                   const QueueAssigningCb& queueAssigningCb,
+                                   bslma::Allocator*       allocator);
+
     /// Populate the specified `advisory` with information describing a
     /// queue assignment of the specified `uri` living in the specified
     /// `domain`, using the specified `clusterState`, `clusterData` and
@@ -250,6 +271,30 @@ struct ClusterUtil {
                 bslma::Allocator*       allocator,
                 bmqp_ctrlmsg::Status*   status = 0);
 
+    /// Perform the actual assignment of the queues represented by the
+    /// specified `uris`, as per `assignQueue`, using the specified
+    /// `clusterState`, `clusterData`, `ledger`, `cluster`,
+    /// `queueAssigningCb` and `allocator`, but apply and broadcast a single
+    /// queue assignment advisory for all of them.  Load into the specified
+    /// `results` the result of the assignment of each queue, in the order
+    /// of `uris`, and into the optionally specified `statuses` the
+    /// associated human readable error codes and strings.  Note that in CSL
+    /// mode, the queues are assigned one by one.  This method is called
+    /// only on the leader node.
+    ///
+    /// THREAD: This method is invoked in the associated cluster's
+    ///         dispatcher thread.
+    static void
+    assignQueues(bsl::vector<QueueAssignmentResult::Enum>* results,
+                 ClusterState*                             clusterState,
+                 ClusterData*                              clusterData,
+                 ClusterStateLedger*                       ledger,
+                 const mqbi::Cluster*                      cluster,
+                 const bsl::vector<bmqt::Uri>&             uris,
+                 const QueueAssigningCb&                   queueAssigningCb,
+                 bslma::Allocator*                         allocator,
+                 bsl::vector<bmqp_ctrlmsg::Status>*        statuses = 0);
+
     /// Register a queue info for the queue with the specified `uri`,
     /// `partitionId`, `queueKey` and the optionally specified `appIdInfos`
     /// to the specified `clusterState` of the specified `cluster`.  Also
@@ -75,6 +75,11 @@ namespace {
 
 const char k_FILE_PATTERN[] = "bmq_csl_*.bmq_csl";
 
+/// Number of records written to the ledger since the last cluster state
+/// snapshot after which the ledger is compacted, even if its current log is
+/// not full.
+const int k_MAX_RECORDS_BETWEEN_SNAPSHOTS = 10000;
+
 /// Append the current date and time to the specified `result` in
 /// YYYYMMDD_HHMMSS format.
 void appendFormattedDatetime(bsl::string* result)
@@ -209,10 +214,24 @@ void IncoreClusterStateLeger_LogIdGenerator::generateLogId(
 // ------------------------------
 
 // PRIVATE MANIPULATORS
-int IncoreClusterStateLedger::cleanupLog(
-    BSLS_ANNOTATION_UNUSED const bsl::string& logPath)
+int IncoreClusterStateLedger::cleanupLog(const bsl::string& logPath)
 {
-    // TODO: Implement
+    // The log has been closed, and the new log starts with a snapshot of the
+    // cluster state (see 'onLogRolloverCb'), so the old log is no longer
+    // needed.  Note that 'd_ledgerConfig.keepOldLogs()' is false, so the
+    // ledger only ever opens the latest log.
+    if (!bdls::FilesystemUtil::exists(logPath)) {
+        return 0;  // RETURN
+    }
+
+    const int rc = bdls::FilesystemUtil::remove(logPath);
+    if (rc != 0) {
+        BALL_LOG_WARN << description() << "Failed to remove log '" << logPath
+                      << "', rc: " << rc;
+        return rc;  // RETURN
+    }
+
+    BALL_LOG_INFO << description() << "Removed log '" << logPath << "'";
 
     return 0;
 }
@@ -239,6 +258,8 @@ int IncoreClusterStateLedger::onLogRolloverCb(const mqbu::StorageKey& oldLogId,
                   << oldLogId << "] to new log with logId [" << newLogId
                   << "]";
 
+    d_numRecordsSinceSnapshot = 0;
+
     int rc = ClusterStateLedgerUtil::writeFileHeader(d_ledger_mp.get(),
                                                      newLogId);
     if (rc != 0) {
@@ -366,6 +387,56 @@ int IncoreClusterStateLedger::onLogRolloverCb(const mqbu::StorageKey& oldLogId,
     return rc_SUCCESS;
 }
 
+void IncoreClusterStateLedger::compactIfNeeded()
+{
+    if (d_numRecordsSinceSnapshot < k_MAX_RECORDS_BETWEEN_SNAPSHOTS) {
+        return;  // RETURN
+    }
+
+    if (bmqp_ctrlmsg::NodeStatus::E_AVAILABLE !=
+        d_clusterData_p->membership().selfNodeStatus()) {
+        // No snapshot would be written upon rollover (see 'onLogRolloverCb'),
+        // so do not drop the current log.
+        return;  // RETURN
+    }
+
+    BALL_LOG_INFO << description() << "Compacting ledger after "
+                  << d_numRecordsSinceSnapshot
+                  << " records since the last cluster state snapshot";
+
+    const int rc = d_ledger_mp->rollOver();
+    if (rc != 0) {
+        BALL_LOG_ERROR << description()
+                       << "Failed to compact ledger, rc: " << rc;
+    }
+}
+
+void IncoreClusterStateLedger::flushAsync()
+{
+    const int rc = d_ledger_mp->currentLog()->flushAsync(
+        0,
+        bdlf::BindUtil::bind(&IncoreClusterStateLedger::onLogFlushed,
+                             this,
+                             bdlf::PlaceHolders::_1,    // status
+                             bdlf::PlaceHolders::_2));  // durableOffset
+    if (rc != 0) {
+        BALL_LOG_WARN << description()
+                      << "Failed to request flush of the ledger, rc: " << rc;
+    }
+}
+
+void IncoreClusterStateLedger::onLogFlushed(int                status,
+                                            mqbsi::Log::Offset durableOffset)
+{
+    // executed by *ANY* thread
+
+    if (status != 0) {
+        BALL_LOG_WARN << description()
+                      << "Failed to flush the ledger, rc: " << status
+                      << ", durable offset: " << durableOffset;
+    }
+}
+
 int IncoreClusterStateLedger::applyAdvisoryInternal(
     const bmqp_ctrlmsg::ClusterMessage&        clusterMessage,
     const bmqp_ctrlmsg::LeaderMessageSequence& sequenceNumber,
@@ -485,6 +556,8 @@ int IncoreClusterStateLedger::applyRecordInternal(
                            << ", rc: " << rc << "]";
             return rc * 10 + rc_WRITE_FAILURE;  // RETURN
         }
+        ++d_numRecordsSinceSnapshot;
+        flushAsync();
 
         ClusterMessageInfo info;
         info.d_clusterMessage = clusterMessage;
@@ -605,6 +678,8 @@ int IncoreClusterStateLedger::applyRecordInternal(
                            << ", rc: " << rc << "]";
             return rc * 10 + rc_WRITE_FAILURE;  // RETURN
         }
+        ++d_numRecordsSinceSnapshot;
+        flushAsync();
 
         if (isSelfLeader()) {
             bdlbb::Blob commitEvent(d_bufferFactory_p, d_allocator_p);
@@ -632,6 +707,10 @@ int IncoreClusterStateLedger::applyRecordInternal(
                    ClusterStateLedgerCommitStatus::e_SUCCESS);
 
         d_uncommittedAdvisories.erase(commit.sequenceNumberCommitted());
+
+        // The committed advisory is now reflected in the cluster state, which
+        // makes this a good time to write a new snapshot if needed.
+        compactIfNeeded();
     } break;  // BREAK
     case (ClusterStateRecordType::e_ACK): {
         // PRECONDITIONS
@@ -1162,6 +1241,7 @@ IncoreClusterStateLedger::IncoreClusterStateLedger(
 , d_ledgerConfig(allocator)
 , d_ledger_mp(0)
 , d_uncommittedAdvisories(allocator)
+, d_numRecordsSinceSnapshot(0)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(clusterState);
@@ -37,6 +37,13 @@
 // maintained by BlazingMQ cluster nodes themselves instead of being offloaded
 // to an external meta data server (e.g., ZooKeeper).
 //
+// Upon rolling over to a new log, the ledger writes a snapshot of the cluster
+// state (followed by the uncommitted advisories) at the beginning of the new
+// log and removes the old one, so that opening the ledger only requires to
+// replay the latest snapshot and the records written after it.  Besides when
+// the current log is full, the ledger is rolled over (i.e., compacted) once a
+// large number of records has been written since the last snapshot.
+//
 /// Thread Safety
 ///-------------
 // The 'mqbc::IncoreClusterStateLedger' object is not thread safe and should
@@ -203,6 +210,12 @@ class IncoreClusterStateLedger BSLS_KEYWORD_FINAL : public ClusterStateLedger {
     // record id from leader message
     // sequence number.
 
+    int d_numRecordsSinceSnapshot;
+    // Number of records written to the
+    // ledger since the last rollover, i.e.
+    // since the last cluster state
+    // snapshot.
+
   private:
     // NOT IMPLEMENTED
     IncoreClusterStateLedger(const IncoreClusterStateLedger&)
@@ -226,6 +239,24 @@ class IncoreClusterStateLedger BSLS_KEYWORD_FINAL : public ClusterStateLedger {
     int onLogRolloverCb(const mqbu::StorageKey& oldLogId,
                         const mqbu::StorageKey& newLogId);
 
+    /// Roll over the ledger if enough records were written since the last
+    /// cluster state snapshot and self is available, so that the new log
+    /// starts with a snapshot of the cluster state and the old log is
+    /// removed.  This bounds the number of records to replay when opening
+    /// the ledger, e.g. upon leader election or node startup.
+    void compactIfNeeded();
+
+    /// Request the current log of the ledger to be flushed asynchronously,
+    /// so that further records can be appended while the ones written so
+    /// far become durable.
+    void flushAsync();
+
+    /// Callback invoked, possibly from a thread other than the cluster
+    /// dispatcher thread, once the current log of the ledger is durable up
+    /// to the specified `durableOffset` or failed to be flushed as
+    /// indicated by the specified non-zero `status`.
+    void onLogFlushed(int status, mqbsi::Log::Offset durableOffset);
+
     /// Internal helper method to apply the advisory in the specified
     /// `clusterMessage`, of the specified `recordType` and identified by
     /// the specified `sequenceNumber`.  The behavior is undefined unless
@@ -53,13 +53,16 @@
 #include <mwctsk_alarmlog.h>
 #include <mwcu_blob.h>
 #include <mwcu_blobobjectproxy.h>
+#include <mwcsys_time.h>
 #include <mwcu_memoutstream.h>
 
 // BDE
 #include <bdlb_scopeexit.h>
 #include <bdlf_bind.h>
 #include <bdls_filesystemutil.h>
+#include <bdlt_timeunitratio.h>
 #include <bsl_algorithm.h>
+#include <bslmt_threadutil.h>
 
 namespace BloombergLP {
 namespace mqbc {
@@ -73,6 +76,16 @@ const unsigned int k_REQUESTED_JOURNAL_SPACE =
 //             1 journal sync point if self needs to issue another sync point
 //             in 'setPrimary' with old values
 
+const int k_SYNC_FLOW_CONTROL_SLEEP_US = 1000;
+// Time, in microseconds, to wait before checking again whether a partition
+// is back within its share of outstanding partition sync records.
+
+/// Decrement the specified `counter`.
+void decrementCounter(bsls::AtomicInt* counter)
+{
+    --(*counter);
+}
+
 }  // close unnamed namespace
 
 void RecoveryManager::ChunkDeleter::operator()(
@@ -133,6 +146,7 @@ RecoveryManager::RecoveryManager(
 , d_dataStoreConfig(dataStoreConfig)
 , d_clusterData_p(clusterData)
 , d_receiveDataContextVec(allocator)
+, d_numSendingPartitions(0)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(clusterData);
@@ -366,6 +380,46 @@ void RecoveryManager::resetReceiveDataCtx(int partitionId)
     d_receiveDataContextVec[partitionId].reset();
 }
 
+int RecoveryManager::waitForSendBudget(
+    int                        partitionId,
+    const bsls::AtomicInt&     numOutstandingRecords,
+    const mqbnet::ClusterNode& destination)
+{
+    // executed by the *STORAGE (QUEUE) DISPATCHER* thread
+
+    const bsls::Types::Int64 timeoutNs =
+        static_cast<bsls::Types::Int64>(d_clusterConfig.partitionConfig()
+                                            .syncConfig()
+                                            .partitionSyncDataReqTimeoutMs()) *
+        bdlt::TimeUnitRatio::k_NS_PER_MS;
+    const bsls::Types::Int64 startTime = mwcsys::Time::highResolutionTimer();
+
+    while (true) {
+        const int share = d_clusterConfig.partitionConfig()
+                              .syncConfig()
+                              .partitionSyncMaxOutstandingRecords() /
+                          bsl::max(1, d_numSendingPartitions.load());
+        if (numOutstandingRecords.load() < share) {
+            return 0;  // RETURN
+        }
+
+        if (timeoutNs < mwcsys::Time::highResolutionTimer() - startTime) {
+            BALL_LOG_WARN << d_clusterData_p->identity().description()
+                          << " Partition [" << partitionId << "]: "
+                          << numOutstandingRecords.load()
+                          << " data chunks still not written to node: "
+                          << destination.nodeDescription() << " after "
+                          << d_clusterConfig.partitionConfig()
+                                 .syncConfig()
+                                 .partitionSyncDataReqTimeoutMs()
+                          << " ms, giving up.";
+            return -1;  // RETURN
+        }
+
+        bslmt::ThreadUtil::microSleep(k_SYNC_FLOW_CONTROL_SLEEP_US);
+    }
+}
+
 int RecoveryManager::processSendDataChunks(
     int                                          partitionId,
     mqbnet::ClusterNode*                         destination,
@@ -384,7 +438,8 @@ int RecoveryManager::processSendDataChunks(
         rc_INVALID_SEQUENCE_NUMBER  = -3,
         rc_BUILDER_FAILURE          = -4,
         rc_WRITE_FAILURE            = -5,
-        rc_INCOMPLETE_REPLAY        = -6
+        rc_INCOMPLETE_REPLAY        = -6,
+        rc_FLOW_CONTROL_TIMEOUT     = -7
     };
 
     int rc = rc_SUCCESS;
@@ -396,6 +451,13 @@ int RecoveryManager::processSendDataChunks(
         return rc_SUCCESS;  // RETURN
     }
 
+    // Register this partition as being sent, so that its share of the
+    // outstanding sync records, and the one of the partitions being sent
+    // concurrently, is adjusted.
+    ++d_numSendingPartitions;
+    bdlb::ScopeExitAny guardNumSendingPartitions(
+        bdlf::BindUtil::bind(&decrementCounter, &d_numSendingPartitions));
+
     mqbs::FileStoreSet fileSet;
 
     fs.loadCurrentFiles(&fileSet);
@@ -530,6 +592,13 @@ int RecoveryManager::processSendDataChunks(
         if (d_clusterConfig.partitionConfig()
                 .syncConfig()
                 .partitionSyncEventSize() <= builder.eventSize()) {
+            rc = waitForSendBudget(partitionId,
+                                   *journalChunkDeleterCounter,
+                                   *destination);
+            if (rc != 0) {
+                return rc * 10 + rc_FLOW_CONTROL_TIMEOUT;  // RETURN
+            }
+
             const bmqt::GenericResult::Enum writeRc = destination->write(
                 builder.blob(),
                 bmqp::EventType::e_PARTITION_SYNC);
@@ -244,11 +244,34 @@ class RecoveryManager {
     // information about
     // ReceiveDataContext.
 
+    bsls::AtomicInt d_numSendingPartitions;
+    // Number of partitions currently
+    // sending data chunks to a peer, which
+    // share the budget of outstanding
+    // partition sync records.
+
   private:
     // NOT IMPLEMENTED
     RecoveryManager(const RecoveryManager&) BSLS_KEYWORD_DELETED;
     RecoveryManager& operator=(const RecoveryManager&) BSLS_KEYWORD_DELETED;
 
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Wait until the specified `numOutstandingRecords` records of the
+    /// specified `partitionId` not yet written to the network by the
+    /// channel to the specified `destination` fall below the fair share of
+    /// that partition in the `partitionSyncMaxOutstandingRecords` budget of
+    /// the cluster configuration.
+    /// Return 0 on success, and non-zero if the records were not written
+    /// in time.
+    ///
+    /// THREAD: Executed in the dispatcher thread associated with the
+    /// specified `partitionId`.
+    int waitForSendBudget(int                        partitionId,
+                          const bsls::AtomicInt&     numOutstandingRecords,
+                          const mqbnet::ClusterNode& destination);
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(RecoveryManager, bslma::UsesBslmaAllocator)
@@ -306,8 +329,11 @@ class RecoveryManager {
     /// `destination` starting from specified `beginSeqNum` upto specified
     /// `endSeqNum` using data from specified `fs`. Send the status of this
     /// operation back to the caller using the specified `doneDataChunksCb`.
-    /// Note, we mmap the files for every call to this function. Return 0 on
-    /// success and non-zero otherwise.
+    /// Note, we mmap the files for every call to this function.  Note that
+    /// partitions being sent concurrently share a budget of records not
+    /// yet written to the network, so that this function waits for the
+    /// channel to drain whenever `partitionId` exceeds its share. Return 0
+    /// on success and non-zero otherwise.
     ///
     /// THREAD: Executed in the dispatcher thread associated with the
     /// specified `partitionId`.
@@ -36,6 +36,70 @@
 namespace BloombergLP {
 namespace mqbc {
 
+namespace {
+
+/// Load into the specified `offset` the offset of the record having the
+/// specified `seqNum` in the journal iterated by the specified `journalIt`,
+/// searching from the record currently pointed to by `journalIt` up to the
+/// last record of the journal.  Return true if such a record was found, and
+/// false otherwise.  This relies on the journal records having a fixed size
+/// and being sorted by increasing sequence number.
+bool findRecordOffset(bsls::Types::Uint64*                         offset,
+                      const mqbs::JournalFileIterator&             journalIt,
+                      const bmqp_ctrlmsg::PartitionSequenceNumber& seqNum)
+{
+    typedef bsls::Types::Uint64 Uint64;
+
+    const Uint64 firstOffset = journalIt.firstRecordPosition();
+    const Uint64 lastOffset  = journalIt.lastRecordPosition();
+    if (0 == firstOffset || 0 == lastOffset) {
+        return false;  // RETURN
+    }
+
+    const Uint64 recordSize = journalIt.header().recordWords() *
+                              bmqp::Protocol::k_WORD_SIZE;
+    BSLS_ASSERT_SAFE(0 == (lastOffset - firstOffset) % recordSize);
+
+    const mqbs::MappedFileDescriptor& mfd = *journalIt.mappedFileDescriptor();
+
+    // Search among the records [low, high], identified by their index
+    // relative to the first record of the journal.
+    Uint64 low  = journalIt.recordOffset() < firstOffset
+                      ? 0
+                      : (journalIt.recordOffset() - firstOffset) / recordSize;
+    Uint64 high = (lastOffset - firstOffset) / recordSize;
+
+    while (low <= high) {
+        const Uint64 mid       = low + (high - low) / 2;
+        const Uint64 midOffset = firstOffset + mid * recordSize;
+
+        const mqbs::OffsetPtr<const mqbs::RecordHeader> recHeader(mfd.block(),
+                                                                  midOffset);
+        bmqp_ctrlmsg::PartitionSequenceNumber midSeqNum;
+        midSeqNum.primaryLeaseId() = recHeader->primaryLeaseId();
+        midSeqNum.sequenceNumber() = recHeader->sequenceNumber();
+
+        if (midSeqNum == seqNum) {
+            *offset = midOffset;
+            return true;  // RETURN
+        }
+
+        if (midSeqNum < seqNum) {
+            low = mid + 1;
+        }
+        else {
+            if (mid == 0) {
+                break;  // BREAK
+            }
+            high = mid - 1;
+        }
+    }
+
+    return false;
+}
+
+}  // close unnamed namespace
+
 // ===================
 // struct RecoveryUtil
 // ===================
@@ -221,6 +285,37 @@ int RecoveryUtil::bootstrapCurrentSeqNum(
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(currentSeqNum);
 
+    // Records have a fixed size and are sorted by sequence number, so first
+    // try to locate the record with 'beginSeqNum' with a binary search and
+    // jump directly to it, instead of visiting every preceding record.
+    bsls::Types::Uint64 beginOffset = 0;
+    if (findRecordOffset(&beginOffset, journalIt, beginSeqNum)) {
+        const bsls::Types::Uint64 currentOffset = journalIt.recordOffset();
+        const bsls::Types::Uint64 recordSize =
+            journalIt.header().recordWords() * bmqp::Protocol::k_WORD_SIZE;
+
+        int rc = 1;
+        if (currentOffset < journalIt.firstRecordPosition()) {
+            // 'journalIt' has not been advanced to the first record yet.
+            rc = journalIt.advance(
+                (beginOffset - journalIt.firstRecordPosition()) / recordSize +
+                1);
+        }
+        else if (currentOffset < beginOffset) {
+            rc = journalIt.advance((beginOffset - currentOffset) /
+                                   recordSize);
+        }
+
+        if (1 == rc) {
+            BSLS_ASSERT_SAFE(journalIt.recordOffset() == beginOffset);
+
+            *currentSeqNum = beginSeqNum;
+            return 0;  // RETURN
+        }
+
+        return -1;  // RETURN
+    }
+
     const mqbs::RecordHeader& recordHeader = journalIt.recordHeader();
     currentSeqNum->primaryLeaseId()        = recordHeader.primaryLeaseId();
     currentSeqNum->sequenceNumber()        = recordHeader.sequenceNumber();
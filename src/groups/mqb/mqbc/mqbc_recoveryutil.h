@@ -99,9 +99,11 @@ struct RecoveryUtil {
                  const bmqp_ctrlmsg::PartitionSequenceNumber& endSeqNum,
                  mqbnet::ClusterNode*                         destination);
 
-    /// Get the current sequence number by iterating through `journalIt`
-    /// until we reach the specified `beginSeqNum`. Load this value onto the
-    /// specified `currentSeqNum`.
+    /// Get the current sequence number by advancing `journalIt` to the
+    /// record having the specified `beginSeqNum`, which is located with a
+    /// binary search over the (fixed size) records remaining in the
+    /// journal, falling back to iterating record by record if it cannot be
+    /// found that way. Load this value onto the specified `currentSeqNum`.
     /// The function return zero if successful and non-zero for failure
     /// scenarios.
     static int bootstrapCurrentSeqNum(
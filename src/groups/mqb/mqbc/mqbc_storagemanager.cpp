@@ -1641,14 +1641,16 @@ void StorageManager::do_bufferLiveData(const PartitionFSMArgsSp& args)
     }
 
     const PartitionInfo& pinfo = d_partitionInfoVec[partitionId];
-    BSLS_ASSERT_SAFE(pinfo.primary() == source);
+    BSLS_ASSERT_SAFE(pinfo.primary() == source ||
+                     d_clusterConfig.partitionConfig().chainReplication());
     BSLS_ASSERT_SAFE(pinfo.primaryStatus() ==
                      bmqp_ctrlmsg::PrimaryStatus::E_ACTIVE);
-    (void)pinfo;  // silence compiler warning
 
+    // The event may have been relayed by another replica if storage records
+    // are replicated along a chain; it still originates from the primary.
     d_recoveryManager_mp->bufferStorageEvent(partitionId,
                                              eventData.storageEvent(),
-                                             source);
+                                             pinfo.primary());
 }
 
 void StorageManager::do_processBufferedLiveData(const PartitionFSMArgsSp& args)
@@ -1743,17 +1745,20 @@ void StorageManager::do_processLiveData(const PartitionFSMArgsSp& args)
     }
 
     const PartitionInfo& pinfo = d_partitionInfoVec[partitionId];
-    BSLS_ASSERT_SAFE(pinfo.primary() == source);
+    BSLS_ASSERT_SAFE(pinfo.primary() == source ||
+                     d_clusterConfig.partitionConfig().chainReplication());
     BSLS_ASSERT_SAFE(pinfo.primaryStatus() ==
                      bmqp_ctrlmsg::PrimaryStatus::E_ACTIVE);
-    (void)pinfo;  // silence compiler warning
 
     mqbs::FileStore* fs = d_fileStores[static_cast<size_t>(partitionId)].get();
     BSLS_ASSERT_SAFE(fs && fs->isOpen());
 
+    // The event may have been relayed by another replica if storage records
+    // are replicated along a chain; it still originates from the primary,
+    // which receipts must be sent to.
     fs->processStorageEvent(eventData.storageEvent(),
                             false /* isPartitionSyncEvent */,
-                            source);
+                            pinfo.primary());
 }
 
 void StorageManager::do_processPut(
@@ -2618,7 +2623,8 @@ int StorageManager::start(bsl::ostream& errorDescription)
                              &d_isStarted,
                              d_minimumRequiredDiskSpace,
                              d_clusterData_p->identity().description(),
-                             d_clusterConfig.partitionConfig()));
+                             d_clusterConfig.partitionConfig(),
+                             &d_miscWorkThreadPool));
 
     rc = StorageUtil::assignPartitionDispatcherThreads(&d_miscWorkThreadPool,
                                                        d_clusterData_p,
@@ -3424,6 +3430,11 @@ void StorageManager::processStorageEvent(
     BSLS_ASSERT_SAFE(fs);
 
     if (rawEvent.isStorageEvent()) {
+        StorageUtil::relayStorageEvent(*event.blob(),
+                                       pid,
+                                       d_clusterState,
+                                       d_clusterData_p);
+
         dispatchEventToPartition(fs,
                                  PartitionFSM::Event::e_LIVE_DATA,
                                  eventDataVec);
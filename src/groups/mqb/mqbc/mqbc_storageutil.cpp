@@ -24,6 +24,7 @@
 #include <mqbs_filestoreutil.h>
 #include <mqbs_filesystemutil.h>
 #include <mqbs_storagecollectionutil.h>
+#include <mqbs_storageengine.h>
 #include <mqbs_storageutil.h>
 #include <mqbstat_clusterstats.h>
 
@@ -49,6 +50,7 @@
 #include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
 #include <bsls_annotation.h>
+#include <bsls_performancehint.h>
 #include <bsls_types.h>
 
 namespace BloombergLP {
@@ -565,7 +567,7 @@ void StorageUtil::getStoragesDispatched(StorageLists*         storageLists,
 
 void StorageUtil::loadStorages(bsl::vector<mqbcmd::StorageQueueInfo>* storages,
                                const bsl::string& domainName,
-                               const FileStores&  fileStores)
+                               const FileStores& fileStores)
 {
     // executed by cluster *DISPATCHER* thread
     // PRECONDITIONS
@@ -634,24 +636,25 @@ void StorageUtil::loadPartitionStorageSummary(
     mqbcmd::ClusterStorageSummary& summary =
         result->makeClusterStorageSummary();
     summary.clusterFileStoreLocation() = partitionLocation;
-    summary.fileStores().resize(fileStores->size());
-
-    bslmt::Latch latch(1);
-    fileStores->at(partitionId)
-        ->execute(bdlf::BindUtil::bind(&loadStorageSummaryDispatched,
-                                       &summary,
-                                       &latch,
-                                       partitionId,
-                                       *fileStores));
-    // Wait
-    latch.wait();
 
-    // As we loaded information about only one partition (with 'partitionId'),
-    // the 'summary.fileStores()' in general contains incomplete information
-    // about all the partitions.  So we make sure that only meaningful
-    // information will stay in the end.
-    bsl::swap(summary.fileStores()[0], summary.fileStores()[partitionId]);
-    summary.fileStores().resize(1);
+    // Reuse a recent snapshot of the summary, if any, so that frequent admin
+    // commands don't stall the partition (and this) dispatcher thread.
+    SummarySnapshots snapshots(fileStores->size());
+    snapshots[partitionId] = fileStores->at(partitionId)->summarySnapshot();
+    if (!snapshots[partitionId]) {
+        bslmt::Latch latch(1);
+        fileStores->at(partitionId)
+            ->execute(bdlf::BindUtil::bind(&loadStorageSummaryDispatched,
+                                           &snapshots,
+                                           &latch,
+                                           partitionId,
+                                           *fileStores));
+        // Wait
+        latch.wait();
+    }
+
+    // Only load information about the partition with 'partitionId'
+    summary.fileStores().push_back(*snapshots[partitionId]);
 }
 
 void StorageUtil::loadStorageSummary(mqbcmd::StorageResult*  result,
@@ -660,42 +663,58 @@ void StorageUtil::loadStorageSummary(mqbcmd::StorageResult*  result,
 {
     // executed by cluster *DISPATCHER* thread
 
-    // This command needs to forward the 'SUMMARY' command to all partitions,
-    // wait for all of them to finish executing it, and then aggregate the
-    // output.
+    // This command needs to forward the 'SUMMARY' command to all partitions
+    // not having a recent snapshot of their summary, wait for all of them to
+    // finish executing it, and then aggregate the output.
 
     mqbcmd::ClusterStorageSummary& summary =
         result->makeClusterStorageSummary();
 
     summary.clusterFileStoreLocation() = location;
-    summary.fileStores().resize(fileStores.size());
 
-    executeForEachPartitions(
-        bdlf::BindUtil::bind(&loadStorageSummaryDispatched,
-                             &summary,
-                             bdlf::PlaceHolders::_2,  // latch
-                             bdlf::PlaceHolders::_1,  // partitionId
-                             fileStores),
-        fileStores);
+    SummarySnapshots snapshots(fileStores.size());
+    bool             hasAllSnapshots = true;
+    for (unsigned int i = 0; i < fileStores.size(); ++i) {
+        snapshots[i]    = fileStores[i]->summarySnapshot();
+        hasAllSnapshots = hasAllSnapshots && snapshots[i];
+    }
+
+    if (!hasAllSnapshots) {
+        executeForEachPartitions(
+            bdlf::BindUtil::bind(&loadStorageSummaryDispatched,
+                                 &snapshots,
+                                 bdlf::PlaceHolders::_2,  // latch
+                                 bdlf::PlaceHolders::_1,  // partitionId
+                                 fileStores),
+            fileStores);
+    }
+
+    summary.fileStores().reserve(snapshots.size());
+    for (unsigned int i = 0; i < snapshots.size(); ++i) {
+        summary.fileStores().push_back(*snapshots[i]);
+    }
 }
 
-void StorageUtil::loadStorageSummaryDispatched(
-    mqbcmd::ClusterStorageSummary* summary,
-    bslmt::Latch*                  latch,
-    int                            partitionId,
-    const FileStores&              fileStores)
+void StorageUtil::loadStorageSummaryDispatched(SummarySnapshots* snapshots,
+                                               bslmt::Latch*     latch,
+                                               int               partitionId,
+                                               const FileStores& fileStores)
 {
     // executed by *QUEUE_DISPATCHER* thread with the specified 'partitionId'
 
     // PRECONDITIONS
-    BSLS_ASSERT_SAFE(summary);
+    BSLS_ASSERT_SAFE(snapshots);
     BSLS_ASSERT_SAFE(latch);
     BSLS_ASSERT_SAFE(0 <= partitionId);
     BSLS_ASSERT_SAFE(fileStores.size() >
                      static_cast<unsigned int>(partitionId));
     BSLS_ASSERT_SAFE(fileStores[partitionId]->inDispatcherThread());
 
-    fileStores[partitionId]->loadSummary(&summary->fileStores()[partitionId]);
+    bsl::shared_ptr<const mqbcmd::FileStore>& snapshot =
+        (*snapshots)[partitionId];
+    if (!snapshot) {
+        snapshot = fileStores[partitionId]->publishSummarySnapshot();
+    }
 
     latch->arrive();
 }
@@ -829,22 +848,36 @@ void StorageUtil::storageMonitorCb(
     const bsls::AtomicBool*        isManagerStarted,
     bsls::Types::Uint64            minimumRequiredDiskSpace,
     const bslstl::StringRef&       clusterDescription,
-    const mqbcfg::PartitionConfig& partitionConfig)
+    const mqbcfg::PartitionConfig& partitionConfig,
+    bdlmt::FixedThreadPool*        threadPool)
 {
     // executed by the scheduler's *DISPATCHER* thread
 
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(lowDiskspaceWarning);
     BSLS_ASSERT_SAFE(isManagerStarted);
+    BSLS_ASSERT_SAFE(threadPool);
 
     if (!*isManagerStarted) {
         return;  // RETURN
     }
 
-    // Delete archived files.
+    // Delete archived files, off this thread which also drives the sync
+    // points and group commits of the partitions.  The job holds copies of
+    // its arguments.
+
+    typedef void (*DeleteArchiveFilesFn)(const mqbcfg::PartitionConfig&,
+                                         const bsl::string&);
 
-    mqbs::FileStoreUtil::deleteArchiveFiles(partitionConfig,
-                                            clusterDescription);
+    int rc = threadPool->enqueueJob(bdlf::BindUtil::bind(
+        static_cast<DeleteArchiveFilesFn>(
+            &mqbs::FileStoreUtil::deleteArchiveFiles),
+        partitionConfig,
+        bsl::string(clusterDescription)));
+    if (0 != rc) {
+        BALL_LOG_WARN << clusterDescription << ": Failed to enqueue the "
+                      << "clean up of archived files, rc: " << rc << ".";
+    }
 
     // Check available diskspace.
 
@@ -852,7 +885,7 @@ void StorageUtil::storageMonitorCb(
     bsls::Types::Int64 totalSpace     = 0;
     mwcu::MemOutStream errorDesc;
     const bsl::string& clusterFileStoreLocation = partitionConfig.location();
-    int                rc = mqbs::FileSystemUtil::loadFileSystemSpace(
+    rc = mqbs::FileSystemUtil::loadFileSystemSpace(
         errorDesc,
         &availableSpace,
         &totalSpace,
@@ -953,6 +986,18 @@ int StorageUtil::validatePartitionDirectory(
         return rc_PARTITION_LOCATION_NONEXISTENT;  // RETURN
     }
 
+    // Ensure partition's tier directory, if any, exist
+    const bsl::string& clusterFileStoreTierLocation = config.tierLocation();
+
+    if (!clusterFileStoreTierLocation.empty() &&
+        !bdls::FilesystemUtil::isDirectory(clusterFileStoreTierLocation,
+                                           true)) {
+        errorDescription << "Cluster's tier partition location ('"
+                         << clusterFileStoreTierLocation
+                         << "') doesn't exist !";
+        return rc_PARTITION_LOCATION_NONEXISTENT;  // RETURN
+    }
+
     return rc_SUCCESS;
 }
 
@@ -1072,7 +1117,12 @@ bool StorageUtil::validateStorageEvent(const bmqp::Event&         event,
         return false;  // RETURN
     }
 
-    if (source != pinfo.primaryNode()) {
+    // When storage records are replicated along a chain, the event may have
+    // been relayed by another replica rather than sent by the primary.
+    // Sequence numbers are still validated by the partition.
+    const bool isChainReplication =
+        clusterData.clusterConfig().partitionConfig().chainReplication();
+    if (source != pinfo.primaryNode() && !isChainReplication) {
         if (skipAlarm) {
             return false;  // RETURN
         }
@@ -1131,6 +1181,37 @@ bool StorageUtil::validateStorageEvent(const bmqp::Event&         event,
     return true;
 }
 
+void StorageUtil::relayStorageEvent(const bdlbb::Blob&        event,
+                                    int                       partitionId,
+                                    const mqbc::ClusterState& clusterState,
+                                    mqbc::ClusterData*        clusterData)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(clusterData);
+
+    if (!clusterData->clusterConfig().partitionConfig().chainReplication()) {
+        return;  // RETURN
+    }
+
+    const mqbnet::ClusterNode* primary =
+        clusterState.partition(partitionId).primaryNode();
+    mqbnet::Cluster* netCluster = clusterData->membership().netCluster();
+    if (0 == primary || primary->nodeId() == netCluster->selfNodeId()) {
+        return;  // RETURN
+    }
+
+    // A node which cannot be written to is skipped, and the event relayed to
+    // the node after it in the chain, so that the nodes after a broken link
+    // still receive the event.  Nothing is relayed if self node is the last
+    // node of the chain.
+
+    int numItems = 0;
+    mqbs::StorageUtil::writeToReplicationChain(&numItems,
+                                               netCluster,
+                                               primary->nodeId(),
+                                               event);
+}
+
 bool StorageUtil::validatePartitionSyncEvent(
     const bmqp::Event&         event,
     int                        partitionId,
@@ -1227,9 +1308,23 @@ int StorageUtil::assignPartitionDispatcherThreads(
     enum RcEnum {
         // Value for the various RC error categories
         rc_SUCCESS                   = 0,
-        rc_THREAD_POOL_START_FAILURE = -1
+        rc_THREAD_POOL_START_FAILURE = -1,
+        rc_UNKNOWN_STORAGE_ENGINE    = -2
     };
 
+    // Resolve the storage engine, if any, creating the storages of the queues
+    mqbs::StorageEngine* storageEngine = 0;
+    if (!config.storageEngine().empty()) {
+        storageEngine = mqbs::StorageEngineRegistry::lookup(
+            config.storageEngine());
+        if (!storageEngine) {
+            errorDescription << clusterData->identity().description()
+                             << ": Unknown storage engine '"
+                             << config.storageEngine() << "'.";
+            return rc_UNKNOWN_STORAGE_ENGINE;  // RETURN
+        }
+    }
+
     // Start the misc work thread pool
     int rc = threadPool->start();
     if (rc != 0) {
@@ -1252,14 +1347,29 @@ int StorageUtil::assignPartitionDispatcherThreads(
             .setBufferFactory(clusterData->bufferFactory())
             .setPreallocate(config.preallocate())
             .setPrefaultPages(config.prefaultPages())
+            .setChainReplication(config.chainReplication())
+            .setIncrementalWriteBack(config.incrementalWriteBack())
+            .setHugePages(config.hugePages())
+            .setPersistentMemory(config.persistentMemory())
+            .setGroupCommitWindowUs(config.groupCommitWindowUs())
+            .setGroupCommitMaxBytes(config.groupCommitMaxBytes())
+            .setRecoveryIndexIntervalSec(config.recoveryIndexIntervalSec())
+            .setCompactionIntervalSec(config.compactionIntervalSec())
+            .setReadAheadMaxBytes(config.readAheadMaxBytes())
+            .setReplicationBatchMaxBytes(config.replicationBatchMaxBytes())
+            .setReplicationBatchMaxLatencyUs(
+                config.replicationBatchMaxLatencyUs())
             .setLocation(config.location())
             .setArchiveLocation(config.archiveLocation())
+            .setTierLocation(config.tierLocation())
+            .setSpillLocation(config.spillLocation())
             .setNodeId(clusterData->membership().selfNode()->nodeId())
             .setPartitionId(i)
             .setMaxDataFileSize(config.maxDataFileSize())
             .setMaxJournalFileSize(config.maxJournalFileSize())
             .setMaxQlistFileSize(config.maxQlistFileSize())
-            .setMaxArchivedFileSets(config.maxArchivedFileSets());
+            .setMaxArchivedFileSets(config.maxArchivedFileSets())
+            .setStorageEngine(storageEngine);
 
         if (!queueCreationCb.isNull()) {
             dsCfg.setQueueCreationCb(queueCreationCb.value());
@@ -1688,12 +1798,24 @@ void StorageUtil::registerQueue(
             for (AppIdKeyPairsCIter citer = appIdKeyPairs.begin();
                  citer != appIdKeyPairs.end();
                  ++citer) {
+                errorDesc.reset();
                 rc = storageSp->addVirtualStorage(errorDesc,
                                                   citer->first,
                                                   citer->second);
-            }
+                if (rc != 0) {
+                    MWCTSK_ALARMLOG_ALARM("STORAGE")
+                        << clusterDescription << ": PartitionId ["
+                        << partitionId << "]: failed to add virtual storage "
+                        << "for appId [" << citer->first << "], appKey ["
+                        << citer->second << "] of queue '" << uri
+                        << "', queueKey '" << queueKey << "', the app is "
+                        << "not registered. Reason: [" << errorDesc.str()
+                        << "], rc: " << rc << "." << MWCTSK_ALARMLOG_END;
+                    continue;  // CONTINUE
+                }
 
-            appIdKeyPairsToUse = appIdKeyPairs;
+                appIdKeyPairsToUse.push_back(*citer);
+            }
         }
         else {
             // If fanout queue, generate unique appKeys for the configured
@@ -1711,7 +1833,19 @@ void StorageUtil::registerQueue(
                                                          appKeysLock,
                                                          *citer);
 
+                errorDesc.reset();
                 rc = storageSp->addVirtualStorage(errorDesc, *citer, appKey);
+                if (rc != 0) {
+                    MWCTSK_ALARMLOG_ALARM("STORAGE")
+                        << clusterDescription << ": PartitionId ["
+                        << partitionId << "]: failed to add virtual storage "
+                        << "for appId [" << *citer << "], appKey [" << appKey
+                        << "] of queue '" << uri << "', queueKey '"
+                        << queueKey << "', the app is not registered. "
+                        << "Reason: [" << errorDesc.str() << "], rc: " << rc
+                        << "." << MWCTSK_ALARMLOG_END;
+                    continue;  // CONTINUE
+                }
 
                 appIdKeyPairsToUse.push_back(bsl::make_pair(*citer, appKey));
             }
@@ -1728,9 +1862,8 @@ void StorageUtil::registerQueue(
             errorDesc,
             bmqp::ProtocolUtil::k_DEFAULT_APP_ID,
             mqbi::QueueEngine::k_DEFAULT_APP_KEY);
+        BSLS_ASSERT_SAFE(rc == 0);
     }
-
-    BSLS_ASSERT_SAFE(rc == 0);
     static_cast<void>(rc);
 
     // Dispatch the registration of storage with the partition in appropriate
@@ -2377,7 +2510,7 @@ void StorageUtil::setQueueDispatched(
     bslmt::Mutex*                storagesLock,
     BSLS_ANNOTATION_UNUSED const mqbi::Dispatcher::ProcessorHandle& processor,
     const bsl::string& clusterDescription,
-    int                partitionId,
+    int               partitionId,
     const bmqt::Uri&   uri,
     mqbi::Queue*       queue)
 {
@@ -128,6 +128,11 @@ struct StorageUtil {
 
     typedef mqbs::FileStore::StorageFilters StorageFilters;
 
+    /// Vector of snapshots of the summaries of the partitions, indexed by
+    /// partitionId.
+    typedef bsl::vector<bsl::shared_ptr<const mqbcmd::FileStore> >
+        SummarySnapshots;
+
   public:
     // TYPES
     typedef bsl::shared_ptr<mqbs::FileStore> FileStoreSp;
@@ -282,18 +287,18 @@ struct StorageUtil {
                                    const FileStores&       fileStores,
                                    const bslstl::StringRef location);
 
-    /// Load the summary of the partition out of the specified `fileStores`
-    /// having the specified `partitionId` into an element of the specified
-    /// `summary` object, and arrive on the specified `latch` upon
+    /// Load a new snapshot of the summary of the partition out of the
+    /// specified `fileStores` having the specified `partitionId` into the
+    /// corresponding element of the specified `snapshots`, unless that
+    /// element is already set, and arrive on the specified `latch` upon
     /// completion.
     ///
     /// THREAD: Executed by the Queue's dispatcher thread for the specified
     ///         `partitionId`.
-    static void
-    loadStorageSummaryDispatched(mqbcmd::ClusterStorageSummary* summary,
-                                 bslmt::Latch*                  latch,
-                                 int                            partitionId,
-                                 const FileStores&              fileStores);
+    static void loadStorageSummaryDispatched(SummarySnapshots* snapshots,
+                                             bslmt::Latch*     latch,
+                                             int               partitionId,
+                                             const FileStores& fileStores);
 
     /// Execute the specified `job` for each partition in the specified
     /// `fileStores`.  Each partition will receive its partitionId and a
@@ -345,7 +350,8 @@ struct StorageUtil {
     /// monitors storage (disk space, archive clean up, etc), using the
     /// specified `lowDiskspaceWarning`, `isManagerStarted`,
     /// `minimumRequiredDiskSpace`, `clusterDescription`, and
-    /// `partitionConfig`.
+    /// `partitionConfig`.  The clean up of archived files is enqueued in
+    /// the specified `threadPool`, since removing large files may block.
     ///
     /// THREAD: Executed by the scheduler's dispatcher thread.
     static void
@@ -353,7 +359,8 @@ struct StorageUtil {
                      const bsls::AtomicBool*        isManagerStarted,
                      bsls::Types::Uint64            minimumRequiredDiskSpace,
                      const bslstl::StringRef&       clusterDescription,
-                     const mqbcfg::PartitionConfig& partitionConfig);
+                     const mqbcfg::PartitionConfig& partitionConfig,
+                     bdlmt::FixedThreadPool*        threadPool);
 
     /// Print Log Banner indicating Recovery Phase One for the specified
     /// `clusterDescription` and the specified `partitionId`. Use the
@@ -386,8 +393,10 @@ struct StorageUtil {
 
     /// Validate that every storage message in the specified `event` have
     /// the same specified `partitionId`, and that the specified event
-    /// `source` is the active primary node in the specified `clusterState`.
-    /// Use the specified `clusterData` to help with validation.  The
+    /// `source` is the active primary node in the specified `clusterState`,
+    /// or any peer if storage records are replicated along a chain, in
+    /// which case `event` may have been relayed by another replica.  Use
+    /// the specified `clusterData` to help with validation.  The
     /// specified `skipAlarm` flag determines whether to skip alarming if
     /// `source` is not active primary.  Return true if valid, false
     /// otherwise.
@@ -398,6 +407,18 @@ struct StorageUtil {
                                      const mqbc::ClusterData&   clusterData,
                                      bool                       skipAlarm);
 
+    /// Relay the specified storage `event` of the specified `partitionId` to
+    /// the next node of the replication chain of that partition to which it
+    /// can be written (see `mqbs::StorageUtil::writeToReplicationChain`),
+    /// if storage records are replicated along a chain in the cluster
+    /// having the specified `clusterData`, self node is not the primary of
+    /// `partitionId` in the specified `clusterState`, and self node is not
+    /// the last node of the chain.
+    static void relayStorageEvent(const bdlbb::Blob&        event,
+                                  int                       partitionId,
+                                  const mqbc::ClusterState& clusterState,
+                                  mqbc::ClusterData*        clusterData);
+
     /// Validate that every partition sync message in the specified `event`
     /// have the same specified `partitionId`, and that ether self or the
     /// specified event `source` is the primary node in the specified
@@ -572,7 +593,7 @@ struct StorageUtil {
                                      AppKeys*           appKeys,
                                      bslmt::Mutex*      appKeysLock,
                                      const bsl::string& clusterDescription,
-                                     int                partitionId,
+                                     int               partitionId,
                                      const bmqt::Uri&   uri,
                                      const mqbu::StorageKey& queueKey,
                                      const mqbu::StorageKey& appKey,
@@ -601,7 +622,7 @@ struct StorageUtil {
                        bslmt::Mutex*                            storagesLock,
                        const mqbi::Dispatcher::ProcessorHandle& processor,
                        const bsl::string& clusterDescription,
-                       int                partitionId,
+                       int               partitionId,
                        const bmqt::Uri&   uri,
                        mqbi::Queue*       queue);
 
@@ -1567,6 +1567,9 @@ const int QueueOperationsConfig::DEFAULT_INITIALIZER_SHUTDOWN_TIMEOUT_MS =
 
 const int QueueOperationsConfig::DEFAULT_INITIALIZER_ACK_WINDOW_SIZE = 500;
 
+const int QueueOperationsConfig::DEFAULT_INITIALIZER_PENDING_PUTS_MAX_BYTES =
+    268435456;
+
 const bdlat_AttributeInfo QueueOperationsConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_OPEN_TIMEOUT_MS,
      "openTimeoutMs",
@@ -1627,6 +1630,11 @@ const bdlat_AttributeInfo QueueOperationsConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "ackWindowSize",
      sizeof("ackWindowSize") - 1,
      "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_PENDING_PUTS_MAX_BYTES,
+     "pendingPutsMaxBytes",
+     sizeof("pendingPutsMaxBytes") - 1,
+     "",
      bdlat_FormattingMode::e_DEC}};
 
 // CLASS METHODS
@@ -1634,7 +1642,7 @@ const bdlat_AttributeInfo QueueOperationsConfig::ATTRIBUTE_INFO_ARRAY[] = {
 const bdlat_AttributeInfo*
 QueueOperationsConfig::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 12; ++i) {
+    for (int i = 0; i < 13; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             QueueOperationsConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -1675,6 +1683,8 @@ const bdlat_AttributeInfo* QueueOperationsConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SHUTDOWN_TIMEOUT_MS];
     case ATTRIBUTE_ID_ACK_WINDOW_SIZE:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ACK_WINDOW_SIZE];
+    case ATTRIBUTE_ID_PENDING_PUTS_MAX_BYTES:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PENDING_PUTS_MAX_BYTES];
     default: return 0;
     }
 }
@@ -1695,6 +1705,7 @@ QueueOperationsConfig::QueueOperationsConfig()
 , d_stopTimeoutMs(DEFAULT_INITIALIZER_STOP_TIMEOUT_MS)
 , d_shutdownTimeoutMs(DEFAULT_INITIALIZER_SHUTDOWN_TIMEOUT_MS)
 , d_ackWindowSize(DEFAULT_INITIALIZER_ACK_WINDOW_SIZE)
+, d_pendingPutsMaxBytes(DEFAULT_INITIALIZER_PENDING_PUTS_MAX_BYTES)
 {
 }
 
@@ -1712,6 +1723,7 @@ QueueOperationsConfig::QueueOperationsConfig(
 , d_stopTimeoutMs(original.d_stopTimeoutMs)
 , d_shutdownTimeoutMs(original.d_shutdownTimeoutMs)
 , d_ackWindowSize(original.d_ackWindowSize)
+, d_pendingPutsMaxBytes(original.d_pendingPutsMaxBytes)
 {
 }
 
@@ -1737,6 +1749,7 @@ QueueOperationsConfig::operator=(const QueueOperationsConfig& rhs)
         d_stopTimeoutMs              = rhs.d_stopTimeoutMs;
         d_shutdownTimeoutMs          = rhs.d_shutdownTimeoutMs;
         d_ackWindowSize              = rhs.d_ackWindowSize;
+        d_pendingPutsMaxBytes        = rhs.d_pendingPutsMaxBytes;
     }
 
     return *this;
@@ -1758,9 +1771,10 @@ QueueOperationsConfig::operator=(QueueOperationsConfig&& rhs)
         d_keepaliveDurationMs        = bsl::move(rhs.d_keepaliveDurationMs);
         d_consumptionMonitorPeriodMs = bsl::move(
             rhs.d_consumptionMonitorPeriodMs);
-        d_stopTimeoutMs     = bsl::move(rhs.d_stopTimeoutMs);
-        d_shutdownTimeoutMs = bsl::move(rhs.d_shutdownTimeoutMs);
-        d_ackWindowSize     = bsl::move(rhs.d_ackWindowSize);
+        d_stopTimeoutMs       = bsl::move(rhs.d_stopTimeoutMs);
+        d_shutdownTimeoutMs   = bsl::move(rhs.d_shutdownTimeoutMs);
+        d_ackWindowSize       = bsl::move(rhs.d_ackWindowSize);
+        d_pendingPutsMaxBytes = bsl::move(rhs.d_pendingPutsMaxBytes);
     }
 
     return *this;
@@ -1779,9 +1793,10 @@ void QueueOperationsConfig::reset()
     d_keepaliveDurationMs   = DEFAULT_INITIALIZER_KEEPALIVE_DURATION_MS;
     d_consumptionMonitorPeriodMs =
         DEFAULT_INITIALIZER_CONSUMPTION_MONITOR_PERIOD_MS;
-    d_stopTimeoutMs     = DEFAULT_INITIALIZER_STOP_TIMEOUT_MS;
-    d_shutdownTimeoutMs = DEFAULT_INITIALIZER_SHUTDOWN_TIMEOUT_MS;
-    d_ackWindowSize     = DEFAULT_INITIALIZER_ACK_WINDOW_SIZE;
+    d_stopTimeoutMs       = DEFAULT_INITIALIZER_STOP_TIMEOUT_MS;
+    d_shutdownTimeoutMs   = DEFAULT_INITIALIZER_SHUTDOWN_TIMEOUT_MS;
+    d_ackWindowSize       = DEFAULT_INITIALIZER_ACK_WINDOW_SIZE;
+    d_pendingPutsMaxBytes = DEFAULT_INITIALIZER_PENDING_PUTS_MAX_BYTES;
 }
 
 // ACCESSORS
@@ -1806,6 +1821,7 @@ bsl::ostream& QueueOperationsConfig::print(bsl::ostream& stream,
     printer.printAttribute("stopTimeoutMs", this->stopTimeoutMs());
     printer.printAttribute("shutdownTimeoutMs", this->shutdownTimeoutMs());
     printer.printAttribute("ackWindowSize", this->ackWindowSize());
+    printer.printAttribute("pendingPutsMaxBytes", this->pendingPutsMaxBytes());
     printer.end();
     return stream;
 }
@@ -2386,6 +2402,9 @@ const int StorageSyncConfig::DEFAULT_INITIALIZER_FILE_CHUNK_SIZE = 4194304;
 const int StorageSyncConfig::DEFAULT_INITIALIZER_PARTITION_SYNC_EVENT_SIZE =
     4194304;
 
+const int StorageSyncConfig::
+    DEFAULT_INITIALIZER_PARTITION_SYNC_MAX_OUTSTANDING_RECORDS = 262144;
+
 const bdlat_AttributeInfo StorageSyncConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_STARTUP_RECOVERY_MAX_DURATION_MS,
      "startupRecoveryMaxDurationMs",
@@ -2431,6 +2450,11 @@ const bdlat_AttributeInfo StorageSyncConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "partitionSyncEventSize",
      sizeof("partitionSyncEventSize") - 1,
      "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_PARTITION_SYNC_MAX_OUTSTANDING_RECORDS,
+     "partitionSyncMaxOutstandingRecords",
+     sizeof("partitionSyncMaxOutstandingRecords") - 1,
+     "",
      bdlat_FormattingMode::e_DEC}};
 
 // CLASS METHODS
@@ -2438,7 +2462,7 @@ const bdlat_AttributeInfo StorageSyncConfig::ATTRIBUTE_INFO_ARRAY[] = {
 const bdlat_AttributeInfo*
 StorageSyncConfig::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 9; ++i) {
+    for (int i = 0; i < 10; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             StorageSyncConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -2479,6 +2503,9 @@ const bdlat_AttributeInfo* StorageSyncConfig::lookupAttributeInfo(int id)
     case ATTRIBUTE_ID_PARTITION_SYNC_EVENT_SIZE:
         return &ATTRIBUTE_INFO_ARRAY
             [ATTRIBUTE_INDEX_PARTITION_SYNC_EVENT_SIZE];
+    case ATTRIBUTE_ID_PARTITION_SYNC_MAX_OUTSTANDING_RECORDS:
+        return &ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_PARTITION_SYNC_MAX_OUTSTANDING_RECORDS];
     default: return 0;
     }
 }
@@ -2498,6 +2525,8 @@ StorageSyncConfig::StorageSyncConfig()
 , d_startupWaitDurationMs(DEFAULT_INITIALIZER_STARTUP_WAIT_DURATION_MS)
 , d_fileChunkSize(DEFAULT_INITIALIZER_FILE_CHUNK_SIZE)
 , d_partitionSyncEventSize(DEFAULT_INITIALIZER_PARTITION_SYNC_EVENT_SIZE)
+, d_partitionSyncMaxOutstandingRecords(
+      DEFAULT_INITIALIZER_PARTITION_SYNC_MAX_OUTSTANDING_RECORDS)
 {
 }
 
@@ -2511,6 +2540,8 @@ StorageSyncConfig::StorageSyncConfig(const StorageSyncConfig& original)
 , d_startupWaitDurationMs(original.d_startupWaitDurationMs)
 , d_fileChunkSize(original.d_fileChunkSize)
 , d_partitionSyncEventSize(original.d_partitionSyncEventSize)
+, d_partitionSyncMaxOutstandingRecords(
+      original.d_partitionSyncMaxOutstandingRecords)
 {
 }
 
@@ -2533,6 +2564,8 @@ StorageSyncConfig& StorageSyncConfig::operator=(const StorageSyncConfig& rhs)
         d_startupWaitDurationMs         = rhs.d_startupWaitDurationMs;
         d_fileChunkSize                 = rhs.d_fileChunkSize;
         d_partitionSyncEventSize        = rhs.d_partitionSyncEventSize;
+        d_partitionSyncMaxOutstandingRecords =
+            rhs.d_partitionSyncMaxOutstandingRecords;
     }
 
     return *this;
@@ -2555,6 +2588,8 @@ StorageSyncConfig& StorageSyncConfig::operator=(StorageSyncConfig&& rhs)
         d_startupWaitDurationMs  = bsl::move(rhs.d_startupWaitDurationMs);
         d_fileChunkSize          = bsl::move(rhs.d_fileChunkSize);
         d_partitionSyncEventSize = bsl::move(rhs.d_partitionSyncEventSize);
+        d_partitionSyncMaxOutstandingRecords = bsl::move(
+            rhs.d_partitionSyncMaxOutstandingRecords);
     }
 
     return *this;
@@ -2577,6 +2612,8 @@ void StorageSyncConfig::reset()
     d_startupWaitDurationMs  = DEFAULT_INITIALIZER_STARTUP_WAIT_DURATION_MS;
     d_fileChunkSize          = DEFAULT_INITIALIZER_FILE_CHUNK_SIZE;
     d_partitionSyncEventSize = DEFAULT_INITIALIZER_PARTITION_SYNC_EVENT_SIZE;
+    d_partitionSyncMaxOutstandingRecords =
+        DEFAULT_INITIALIZER_PARTITION_SYNC_MAX_OUTSTANDING_RECORDS;
 }
 
 // ACCESSORS
@@ -2604,6 +2641,8 @@ bsl::ostream& StorageSyncConfig::print(bsl::ostream& stream,
     printer.printAttribute("fileChunkSize", this->fileChunkSize());
     printer.printAttribute("partitionSyncEventSize",
                            this->partitionSyncEventSize());
+    printer.printAttribute("partitionSyncMaxOutstandingRecords",
+                           this->partitionSyncMaxOutstandingRecords());
     printer.end();
     return stream;
 }
@@ -2909,6 +2948,21 @@ const int TcpInterfaceConfig::DEFAULT_INITIALIZER_HEARTBEAT_INTERVAL_MS = 3000;
 
 const bool TcpInterfaceConfig::DEFAULT_INITIALIZER_USE_NTF = false;
 
+const int TcpInterfaceConfig::DEFAULT_INITIALIZER_PUT_RATE_LIMIT = 0;
+
+const int TcpInterfaceConfig::DEFAULT_INITIALIZER_QUEUE_PUT_RATE_LIMIT = 0;
+
+const int TcpInterfaceConfig::DEFAULT_INITIALIZER_NUM_LISTENERS = 1;
+
+const int TcpInterfaceConfig::DEFAULT_INITIALIZER_ZERO_COPY_THRESHOLD = 0;
+
+const char TcpInterfaceConfig::DEFAULT_INITIALIZER_LOCAL_SOCKET_PATH[] = "";
+
+const int TcpInterfaceConfig::DEFAULT_INITIALIZER_PUSH_BATCH_TARGET_SIZE =
+    65536;
+
+const int TcpInterfaceConfig::DEFAULT_INITIALIZER_PUSH_BATCH_MAX_DELAY_US = 0;
+
 const bdlat_AttributeInfo TcpInterfaceConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_NAME,
      "name",
@@ -2959,14 +3013,49 @@ const bdlat_AttributeInfo TcpInterfaceConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "useNtf",
      sizeof("useNtf") - 1,
      "",
-     bdlat_FormattingMode::e_TEXT}};
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_PUT_RATE_LIMIT,
+     "putRateLimit",
+     sizeof("putRateLimit") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_QUEUE_PUT_RATE_LIMIT,
+     "queuePutRateLimit",
+     sizeof("queuePutRateLimit") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_NUM_LISTENERS,
+     "numListeners",
+     sizeof("numListeners") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_ZERO_COPY_THRESHOLD,
+     "zeroCopyThreshold",
+     sizeof("zeroCopyThreshold") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_LOCAL_SOCKET_PATH,
+     "localSocketPath",
+     sizeof("localSocketPath") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_PUSH_BATCH_TARGET_SIZE,
+     "pushBatchTargetSize",
+     sizeof("pushBatchTargetSize") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_PUSH_BATCH_MAX_DELAY_US,
+     "pushBatchMaxDelayUs",
+     sizeof("pushBatchMaxDelayUs") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 TcpInterfaceConfig::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 10; ++i) {
+    for (int i = 0; i < 17; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             TcpInterfaceConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -3000,6 +3089,20 @@ const bdlat_AttributeInfo* TcpInterfaceConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_HEARTBEAT_INTERVAL_MS];
     case ATTRIBUTE_ID_USE_NTF:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_USE_NTF];
+    case ATTRIBUTE_ID_PUT_RATE_LIMIT:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PUT_RATE_LIMIT];
+    case ATTRIBUTE_ID_QUEUE_PUT_RATE_LIMIT:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUE_PUT_RATE_LIMIT];
+    case ATTRIBUTE_ID_NUM_LISTENERS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_LISTENERS];
+    case ATTRIBUTE_ID_ZERO_COPY_THRESHOLD:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD];
+    case ATTRIBUTE_ID_LOCAL_SOCKET_PATH:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_LOCAL_SOCKET_PATH];
+    case ATTRIBUTE_ID_PUSH_BATCH_TARGET_SIZE:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PUSH_BATCH_TARGET_SIZE];
+    case ATTRIBUTE_ID_PUSH_BATCH_MAX_DELAY_US:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PUSH_BATCH_MAX_DELAY_US];
     default: return 0;
     }
 }
@@ -3012,10 +3115,17 @@ TcpInterfaceConfig::TcpInterfaceConfig(bslma::Allocator* basicAllocator)
 , d_nodeLowWatermark(DEFAULT_INITIALIZER_NODE_LOW_WATERMARK)
 , d_nodeHighWatermark(DEFAULT_INITIALIZER_NODE_HIGH_WATERMARK)
 , d_name(basicAllocator)
+, d_localSocketPath(DEFAULT_INITIALIZER_LOCAL_SOCKET_PATH, basicAllocator)
 , d_port()
 , d_ioThreads()
 , d_maxConnections(DEFAULT_INITIALIZER_MAX_CONNECTIONS)
 , d_heartbeatIntervalMs(DEFAULT_INITIALIZER_HEARTBEAT_INTERVAL_MS)
+, d_pushBatchMaxDelayUs(DEFAULT_INITIALIZER_PUSH_BATCH_MAX_DELAY_US)
+, d_pushBatchTargetSize(DEFAULT_INITIALIZER_PUSH_BATCH_TARGET_SIZE)
+, d_zeroCopyThreshold(DEFAULT_INITIALIZER_ZERO_COPY_THRESHOLD)
+, d_numListeners(DEFAULT_INITIALIZER_NUM_LISTENERS)
+, d_queuePutRateLimit(DEFAULT_INITIALIZER_QUEUE_PUT_RATE_LIMIT)
+, d_putRateLimit(DEFAULT_INITIALIZER_PUT_RATE_LIMIT)
 , d_useNtf(DEFAULT_INITIALIZER_USE_NTF)
 {
 }
@@ -3027,10 +3137,17 @@ TcpInterfaceConfig::TcpInterfaceConfig(const TcpInterfaceConfig& original,
 , d_nodeLowWatermark(original.d_nodeLowWatermark)
 , d_nodeHighWatermark(original.d_nodeHighWatermark)
 , d_name(original.d_name, basicAllocator)
+, d_localSocketPath(original.d_localSocketPath, basicAllocator)
 , d_port(original.d_port)
 , d_ioThreads(original.d_ioThreads)
 , d_maxConnections(original.d_maxConnections)
 , d_heartbeatIntervalMs(original.d_heartbeatIntervalMs)
+, d_pushBatchMaxDelayUs(original.d_pushBatchMaxDelayUs)
+, d_pushBatchTargetSize(original.d_pushBatchTargetSize)
+, d_zeroCopyThreshold(original.d_zeroCopyThreshold)
+, d_numListeners(original.d_numListeners)
+, d_queuePutRateLimit(original.d_queuePutRateLimit)
+, d_putRateLimit(original.d_putRateLimit)
 , d_useNtf(original.d_useNtf)
 {
 }
@@ -3043,10 +3160,17 @@ TcpInterfaceConfig::TcpInterfaceConfig(TcpInterfaceConfig&& original) noexcept
   d_nodeLowWatermark(bsl::move(original.d_nodeLowWatermark)),
   d_nodeHighWatermark(bsl::move(original.d_nodeHighWatermark)),
   d_name(bsl::move(original.d_name)),
+  d_localSocketPath(bsl::move(original.d_localSocketPath)),
   d_port(bsl::move(original.d_port)),
   d_ioThreads(bsl::move(original.d_ioThreads)),
   d_maxConnections(bsl::move(original.d_maxConnections)),
   d_heartbeatIntervalMs(bsl::move(original.d_heartbeatIntervalMs)),
+  d_pushBatchMaxDelayUs(bsl::move(original.d_pushBatchMaxDelayUs)),
+  d_pushBatchTargetSize(bsl::move(original.d_pushBatchTargetSize)),
+  d_zeroCopyThreshold(bsl::move(original.d_zeroCopyThreshold)),
+  d_numListeners(bsl::move(original.d_numListeners)),
+  d_queuePutRateLimit(bsl::move(original.d_queuePutRateLimit)),
+  d_putRateLimit(bsl::move(original.d_putRateLimit)),
   d_useNtf(bsl::move(original.d_useNtf))
 {
 }
@@ -3058,10 +3182,17 @@ TcpInterfaceConfig::TcpInterfaceConfig(TcpInterfaceConfig&& original,
 , d_nodeLowWatermark(bsl::move(original.d_nodeLowWatermark))
 , d_nodeHighWatermark(bsl::move(original.d_nodeHighWatermark))
 , d_name(bsl::move(original.d_name), basicAllocator)
+, d_localSocketPath(bsl::move(original.d_localSocketPath), basicAllocator)
 , d_port(bsl::move(original.d_port))
 , d_ioThreads(bsl::move(original.d_ioThreads))
 , d_maxConnections(bsl::move(original.d_maxConnections))
 , d_heartbeatIntervalMs(bsl::move(original.d_heartbeatIntervalMs))
+, d_pushBatchMaxDelayUs(bsl::move(original.d_pushBatchMaxDelayUs))
+, d_pushBatchTargetSize(bsl::move(original.d_pushBatchTargetSize))
+, d_zeroCopyThreshold(bsl::move(original.d_zeroCopyThreshold))
+, d_numListeners(bsl::move(original.d_numListeners))
+, d_queuePutRateLimit(bsl::move(original.d_queuePutRateLimit))
+, d_putRateLimit(bsl::move(original.d_putRateLimit))
 , d_useNtf(bsl::move(original.d_useNtf))
 {
 }
@@ -3087,6 +3218,13 @@ TcpInterfaceConfig::operator=(const TcpInterfaceConfig& rhs)
         d_nodeHighWatermark   = rhs.d_nodeHighWatermark;
         d_heartbeatIntervalMs = rhs.d_heartbeatIntervalMs;
         d_useNtf              = rhs.d_useNtf;
+        d_putRateLimit        = rhs.d_putRateLimit;
+        d_queuePutRateLimit   = rhs.d_queuePutRateLimit;
+        d_numListeners        = rhs.d_numListeners;
+        d_zeroCopyThreshold   = rhs.d_zeroCopyThreshold;
+        d_localSocketPath     = rhs.d_localSocketPath;
+        d_pushBatchTargetSize = rhs.d_pushBatchTargetSize;
+        d_pushBatchMaxDelayUs = rhs.d_pushBatchMaxDelayUs;
     }
 
     return *this;
@@ -3107,6 +3245,13 @@ TcpInterfaceConfig& TcpInterfaceConfig::operator=(TcpInterfaceConfig&& rhs)
         d_nodeHighWatermark   = bsl::move(rhs.d_nodeHighWatermark);
         d_heartbeatIntervalMs = bsl::move(rhs.d_heartbeatIntervalMs);
         d_useNtf              = bsl::move(rhs.d_useNtf);
+        d_putRateLimit        = bsl::move(rhs.d_putRateLimit);
+        d_queuePutRateLimit   = bsl::move(rhs.d_queuePutRateLimit);
+        d_numListeners        = bsl::move(rhs.d_numListeners);
+        d_zeroCopyThreshold   = bsl::move(rhs.d_zeroCopyThreshold);
+        d_localSocketPath     = bsl::move(rhs.d_localSocketPath);
+        d_pushBatchTargetSize = bsl::move(rhs.d_pushBatchTargetSize);
+        d_pushBatchMaxDelayUs = bsl::move(rhs.d_pushBatchMaxDelayUs);
     }
 
     return *this;
@@ -3125,6 +3270,13 @@ void TcpInterfaceConfig::reset()
     d_nodeHighWatermark   = DEFAULT_INITIALIZER_NODE_HIGH_WATERMARK;
     d_heartbeatIntervalMs = DEFAULT_INITIALIZER_HEARTBEAT_INTERVAL_MS;
     d_useNtf              = DEFAULT_INITIALIZER_USE_NTF;
+    d_putRateLimit        = DEFAULT_INITIALIZER_PUT_RATE_LIMIT;
+    d_queuePutRateLimit   = DEFAULT_INITIALIZER_QUEUE_PUT_RATE_LIMIT;
+    d_numListeners        = DEFAULT_INITIALIZER_NUM_LISTENERS;
+    d_zeroCopyThreshold   = DEFAULT_INITIALIZER_ZERO_COPY_THRESHOLD;
+    d_localSocketPath     = DEFAULT_INITIALIZER_LOCAL_SOCKET_PATH;
+    d_pushBatchTargetSize = DEFAULT_INITIALIZER_PUSH_BATCH_TARGET_SIZE;
+    d_pushBatchMaxDelayUs = DEFAULT_INITIALIZER_PUSH_BATCH_MAX_DELAY_US;
 }
 
 // ACCESSORS
@@ -3145,6 +3297,13 @@ bsl::ostream& TcpInterfaceConfig::print(bsl::ostream& stream,
     printer.printAttribute("nodeHighWatermark", this->nodeHighWatermark());
     printer.printAttribute("heartbeatIntervalMs", this->heartbeatIntervalMs());
     printer.printAttribute("useNtf", this->useNtf());
+    printer.printAttribute("putRateLimit", this->putRateLimit());
+    printer.printAttribute("queuePutRateLimit", this->queuePutRateLimit());
+    printer.printAttribute("numListeners", this->numListeners());
+    printer.printAttribute("zeroCopyThreshold", this->zeroCopyThreshold());
+    printer.printAttribute("localSocketPath", this->localSocketPath());
+    printer.printAttribute("pushBatchTargetSize", this->pushBatchTargetSize());
+    printer.printAttribute("pushBatchMaxDelayUs", this->pushBatchMaxDelayUs());
     printer.end();
     return stream;
 }
@@ -3538,6 +3697,15 @@ const char* ClusterNodeConnection::selectionName() const
 const char DispatcherProcessorConfig::CLASS_NAME[] =
     "DispatcherProcessorConfig";
 
+const int DispatcherProcessorConfig::
+    DEFAULT_INITIALIZER_WORK_STEALING_INTERVAL_MS = 0;
+
+const int DispatcherProcessorConfig::DEFAULT_INITIALIZER_NUMA_NODES = 0;
+
+const int DispatcherProcessorConfig::DEFAULT_INITIALIZER_FIRST_CPU = -1;
+
+const int DispatcherProcessorConfig::DEFAULT_INITIALIZER_MAX_BATCH_SIZE = 0;
+
 const bdlat_AttributeInfo DispatcherProcessorConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_NUM_PROCESSORS,
      "numProcessors",
@@ -3548,7 +3716,27 @@ const bdlat_AttributeInfo DispatcherProcessorConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "processorConfig",
      sizeof("processorConfig") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_WORK_STEALING_INTERVAL_MS,
+     "workStealingIntervalMs",
+     sizeof("workStealingIntervalMs") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_NUMA_NODES,
+     "numaNodes",
+     sizeof("numaNodes") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_FIRST_CPU,
+     "firstCpu",
+     sizeof("firstCpu") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_MAX_BATCH_SIZE,
+     "maxBatchSize",
+     sizeof("maxBatchSize") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC}};
 
 // CLASS METHODS
 
@@ -3556,7 +3744,7 @@ const bdlat_AttributeInfo*
 DispatcherProcessorConfig::lookupAttributeInfo(const char* name,
                                                int         nameLength)
 {
-    for (int i = 0; i < 2; ++i) {
+    for (int i = 0; i < 6; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             DispatcherProcessorConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -3577,6 +3765,15 @@ DispatcherProcessorConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_PROCESSORS];
     case ATTRIBUTE_ID_PROCESSOR_CONFIG:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PROCESSOR_CONFIG];
+    case ATTRIBUTE_ID_WORK_STEALING_INTERVAL_MS:
+        return &ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_WORK_STEALING_INTERVAL_MS];
+    case ATTRIBUTE_ID_NUMA_NODES:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUMA_NODES];
+    case ATTRIBUTE_ID_FIRST_CPU:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FIRST_CPU];
+    case ATTRIBUTE_ID_MAX_BATCH_SIZE:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_BATCH_SIZE];
     default: return 0;
     }
 }
@@ -3586,6 +3783,10 @@ DispatcherProcessorConfig::lookupAttributeInfo(int id)
 DispatcherProcessorConfig::DispatcherProcessorConfig()
 : d_processorConfig()
 , d_numProcessors()
+, d_workStealingIntervalMs(DEFAULT_INITIALIZER_WORK_STEALING_INTERVAL_MS)
+, d_numaNodes(DEFAULT_INITIALIZER_NUMA_NODES)
+, d_firstCpu(DEFAULT_INITIALIZER_FIRST_CPU)
+, d_maxBatchSize(DEFAULT_INITIALIZER_MAX_BATCH_SIZE)
 {
 }
 
@@ -3593,6 +3794,10 @@ DispatcherProcessorConfig::DispatcherProcessorConfig(
     const DispatcherProcessorConfig& original)
 : d_processorConfig(original.d_processorConfig)
 , d_numProcessors(original.d_numProcessors)
+, d_workStealingIntervalMs(original.d_workStealingIntervalMs)
+, d_numaNodes(original.d_numaNodes)
+, d_firstCpu(original.d_firstCpu)
+, d_maxBatchSize(original.d_maxBatchSize)
 {
 }
 
@@ -3606,8 +3811,12 @@ DispatcherProcessorConfig&
 DispatcherProcessorConfig::operator=(const DispatcherProcessorConfig& rhs)
 {
     if (this != &rhs) {
-        d_numProcessors   = rhs.d_numProcessors;
-        d_processorConfig = rhs.d_processorConfig;
+        d_numProcessors          = rhs.d_numProcessors;
+        d_processorConfig        = rhs.d_processorConfig;
+        d_workStealingIntervalMs = rhs.d_workStealingIntervalMs;
+        d_numaNodes              = rhs.d_numaNodes;
+        d_firstCpu               = rhs.d_firstCpu;
+        d_maxBatchSize           = rhs.d_maxBatchSize;
     }
 
     return *this;
@@ -3619,8 +3828,12 @@ DispatcherProcessorConfig&
 DispatcherProcessorConfig::operator=(DispatcherProcessorConfig&& rhs)
 {
     if (this != &rhs) {
-        d_numProcessors   = bsl::move(rhs.d_numProcessors);
-        d_processorConfig = bsl::move(rhs.d_processorConfig);
+        d_numProcessors          = bsl::move(rhs.d_numProcessors);
+        d_processorConfig        = bsl::move(rhs.d_processorConfig);
+        d_workStealingIntervalMs = bsl::move(rhs.d_workStealingIntervalMs);
+        d_numaNodes              = bsl::move(rhs.d_numaNodes);
+        d_firstCpu               = bsl::move(rhs.d_firstCpu);
+        d_maxBatchSize           = bsl::move(rhs.d_maxBatchSize);
     }
 
     return *this;
@@ -3631,6 +3844,10 @@ void DispatcherProcessorConfig::reset()
 {
     bdlat_ValueTypeFunctions::reset(&d_numProcessors);
     bdlat_ValueTypeFunctions::reset(&d_processorConfig);
+    d_workStealingIntervalMs = DEFAULT_INITIALIZER_WORK_STEALING_INTERVAL_MS;
+    d_numaNodes              = DEFAULT_INITIALIZER_NUMA_NODES;
+    d_firstCpu               = DEFAULT_INITIALIZER_FIRST_CPU;
+    d_maxBatchSize           = DEFAULT_INITIALIZER_MAX_BATCH_SIZE;
 }
 
 // ACCESSORS
@@ -3643,6 +3860,11 @@ bsl::ostream& DispatcherProcessorConfig::print(bsl::ostream& stream,
     printer.start();
     printer.printAttribute("numProcessors", this->numProcessors());
     printer.printAttribute("processorConfig", this->processorConfig());
+    printer.printAttribute("workStealingIntervalMs",
+                           this->workStealingIntervalMs());
+    printer.printAttribute("numaNodes", this->numaNodes());
+    printer.printAttribute("firstCpu", this->firstCpu());
+    printer.printAttribute("maxBatchSize", this->maxBatchSize());
     printer.end();
     return stream;
 }
@@ -4051,6 +4273,36 @@ const bool PartitionConfig::DEFAULT_INITIALIZER_PREFAULT_PAGES = false;
 
 const bool PartitionConfig::DEFAULT_INITIALIZER_FLUSH_AT_SHUTDOWN = true;
 
+const bool PartitionConfig::DEFAULT_INITIALIZER_CHAIN_REPLICATION = false;
+
+const bool PartitionConfig::DEFAULT_INITIALIZER_INCREMENTAL_WRITE_BACK = false;
+
+const int PartitionConfig::DEFAULT_INITIALIZER_GROUP_COMMIT_WINDOW_US = 0;
+
+const int PartitionConfig::DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_BYTES =
+    1048576;
+
+const bool PartitionConfig::DEFAULT_INITIALIZER_HUGE_PAGES = false;
+
+const int PartitionConfig::DEFAULT_INITIALIZER_RECOVERY_INDEX_INTERVAL_SEC = 0;
+
+const int PartitionConfig::DEFAULT_INITIALIZER_COMPACTION_INTERVAL_SEC = 0;
+
+const int PartitionConfig::DEFAULT_INITIALIZER_READ_AHEAD_MAX_BYTES = 0;
+
+const int PartitionConfig::DEFAULT_INITIALIZER_REPLICATION_BATCH_MAX_BYTES = 0;
+
+const int
+    PartitionConfig::DEFAULT_INITIALIZER_REPLICATION_BATCH_MAX_LATENCY_US = 0;
+
+const char PartitionConfig::DEFAULT_INITIALIZER_TIER_LOCATION[] = "";
+
+const char PartitionConfig::DEFAULT_INITIALIZER_STORAGE_ENGINE[] = "";
+
+const bool PartitionConfig::DEFAULT_INITIALIZER_PERSISTENT_MEMORY = false;
+
+const char PartitionConfig::DEFAULT_INITIALIZER_SPILL_LOCATION[] = "";
+
 const bdlat_AttributeInfo PartitionConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_NUM_PARTITIONS,
      "numPartitions",
@@ -4106,14 +4358,84 @@ const bdlat_AttributeInfo PartitionConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "syncConfig",
      sizeof("syncConfig") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_CHAIN_REPLICATION,
+     "chainReplication",
+     sizeof("chainReplication") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_INCREMENTAL_WRITE_BACK,
+     "incrementalWriteBack",
+     sizeof("incrementalWriteBack") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_GROUP_COMMIT_WINDOW_US,
+     "groupCommitWindowUs",
+     sizeof("groupCommitWindowUs") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_GROUP_COMMIT_MAX_BYTES,
+     "groupCommitMaxBytes",
+     sizeof("groupCommitMaxBytes") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_HUGE_PAGES,
+     "hugePages",
+     sizeof("hugePages") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_RECOVERY_INDEX_INTERVAL_SEC,
+     "recoveryIndexIntervalSec",
+     sizeof("recoveryIndexIntervalSec") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_COMPACTION_INTERVAL_SEC,
+     "compactionIntervalSec",
+     sizeof("compactionIntervalSec") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_READ_AHEAD_MAX_BYTES,
+     "readAheadMaxBytes",
+     sizeof("readAheadMaxBytes") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_REPLICATION_BATCH_MAX_BYTES,
+     "replicationBatchMaxBytes",
+     sizeof("replicationBatchMaxBytes") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_REPLICATION_BATCH_MAX_LATENCY_US,
+     "replicationBatchMaxLatencyUs",
+     sizeof("replicationBatchMaxLatencyUs") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_TIER_LOCATION,
+     "tierLocation",
+     sizeof("tierLocation") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_STORAGE_ENGINE,
+     "storageEngine",
+     sizeof("storageEngine") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_PERSISTENT_MEMORY,
+     "persistentMemory",
+     sizeof("persistentMemory") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_SPILL_LOCATION,
+     "spillLocation",
+     sizeof("spillLocation") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 PartitionConfig::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 11; ++i) {
+    for (int i = 0; i < 25; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             PartitionConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -4151,6 +4473,37 @@ const bdlat_AttributeInfo* PartitionConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_AT_SHUTDOWN];
     case ATTRIBUTE_ID_SYNC_CONFIG:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_CONFIG];
+    case ATTRIBUTE_ID_CHAIN_REPLICATION:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CHAIN_REPLICATION];
+    case ATTRIBUTE_ID_INCREMENTAL_WRITE_BACK:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_INCREMENTAL_WRITE_BACK];
+    case ATTRIBUTE_ID_GROUP_COMMIT_WINDOW_US:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_WINDOW_US];
+    case ATTRIBUTE_ID_GROUP_COMMIT_MAX_BYTES:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES];
+    case ATTRIBUTE_ID_HUGE_PAGES:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_HUGE_PAGES];
+    case ATTRIBUTE_ID_RECOVERY_INDEX_INTERVAL_SEC:
+        return &ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_RECOVERY_INDEX_INTERVAL_SEC];
+    case ATTRIBUTE_ID_COMPACTION_INTERVAL_SEC:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPACTION_INTERVAL_SEC];
+    case ATTRIBUTE_ID_READ_AHEAD_MAX_BYTES:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_READ_AHEAD_MAX_BYTES];
+    case ATTRIBUTE_ID_REPLICATION_BATCH_MAX_BYTES:
+        return &ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_REPLICATION_BATCH_MAX_BYTES];
+    case ATTRIBUTE_ID_REPLICATION_BATCH_MAX_LATENCY_US:
+        return &ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_REPLICATION_BATCH_MAX_LATENCY_US];
+    case ATTRIBUTE_ID_TIER_LOCATION:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_TIER_LOCATION];
+    case ATTRIBUTE_ID_STORAGE_ENGINE:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_STORAGE_ENGINE];
+    case ATTRIBUTE_ID_PERSISTENT_MEMORY:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PERSISTENT_MEMORY];
+    case ATTRIBUTE_ID_SPILL_LOCATION:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SPILL_LOCATION];
     default: return 0;
     }
 }
@@ -4163,12 +4516,27 @@ PartitionConfig::PartitionConfig(bslma::Allocator* basicAllocator)
 , d_maxQlistFileSize()
 , d_location(basicAllocator)
 , d_archiveLocation(basicAllocator)
+, d_tierLocation(DEFAULT_INITIALIZER_TIER_LOCATION, basicAllocator)
+, d_storageEngine(DEFAULT_INITIALIZER_STORAGE_ENGINE, basicAllocator)
+, d_spillLocation(DEFAULT_INITIALIZER_SPILL_LOCATION, basicAllocator)
 , d_syncConfig()
 , d_numPartitions()
 , d_maxArchivedFileSets()
 , d_preallocate(DEFAULT_INITIALIZER_PREALLOCATE)
 , d_prefaultPages(DEFAULT_INITIALIZER_PREFAULT_PAGES)
 , d_flushAtShutdown(DEFAULT_INITIALIZER_FLUSH_AT_SHUTDOWN)
+, d_chainReplication(DEFAULT_INITIALIZER_CHAIN_REPLICATION)
+, d_incrementalWriteBack(DEFAULT_INITIALIZER_INCREMENTAL_WRITE_BACK)
+, d_groupCommitWindowUs(DEFAULT_INITIALIZER_GROUP_COMMIT_WINDOW_US)
+, d_groupCommitMaxBytes(DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_BYTES)
+, d_hugePages(DEFAULT_INITIALIZER_HUGE_PAGES)
+, d_recoveryIndexIntervalSec(DEFAULT_INITIALIZER_RECOVERY_INDEX_INTERVAL_SEC)
+, d_compactionIntervalSec(DEFAULT_INITIALIZER_COMPACTION_INTERVAL_SEC)
+, d_readAheadMaxBytes(DEFAULT_INITIALIZER_READ_AHEAD_MAX_BYTES)
+, d_replicationBatchMaxBytes(DEFAULT_INITIALIZER_REPLICATION_BATCH_MAX_BYTES)
+, d_replicationBatchMaxLatencyUs(
+      DEFAULT_INITIALIZER_REPLICATION_BATCH_MAX_LATENCY_US)
+, d_persistentMemory(DEFAULT_INITIALIZER_PERSISTENT_MEMORY)
 {
 }
 
@@ -4179,12 +4547,26 @@ PartitionConfig::PartitionConfig(const PartitionConfig& original,
 , d_maxQlistFileSize(original.d_maxQlistFileSize)
 , d_location(original.d_location, basicAllocator)
 , d_archiveLocation(original.d_archiveLocation, basicAllocator)
+, d_tierLocation(original.d_tierLocation, basicAllocator)
+, d_storageEngine(original.d_storageEngine, basicAllocator)
+, d_spillLocation(original.d_spillLocation, basicAllocator)
 , d_syncConfig(original.d_syncConfig)
 , d_numPartitions(original.d_numPartitions)
 , d_maxArchivedFileSets(original.d_maxArchivedFileSets)
 , d_preallocate(original.d_preallocate)
 , d_prefaultPages(original.d_prefaultPages)
 , d_flushAtShutdown(original.d_flushAtShutdown)
+, d_chainReplication(original.d_chainReplication)
+, d_incrementalWriteBack(original.d_incrementalWriteBack)
+, d_groupCommitWindowUs(original.d_groupCommitWindowUs)
+, d_groupCommitMaxBytes(original.d_groupCommitMaxBytes)
+, d_hugePages(original.d_hugePages)
+, d_recoveryIndexIntervalSec(original.d_recoveryIndexIntervalSec)
+, d_compactionIntervalSec(original.d_compactionIntervalSec)
+, d_readAheadMaxBytes(original.d_readAheadMaxBytes)
+, d_replicationBatchMaxBytes(original.d_replicationBatchMaxBytes)
+, d_replicationBatchMaxLatencyUs(original.d_replicationBatchMaxLatencyUs)
+, d_persistentMemory(original.d_persistentMemory)
 {
 }
 
@@ -4196,12 +4578,27 @@ PartitionConfig::PartitionConfig(PartitionConfig&& original) noexcept
   d_maxQlistFileSize(bsl::move(original.d_maxQlistFileSize)),
   d_location(bsl::move(original.d_location)),
   d_archiveLocation(bsl::move(original.d_archiveLocation)),
+  d_tierLocation(bsl::move(original.d_tierLocation)),
+  d_storageEngine(bsl::move(original.d_storageEngine)),
+  d_spillLocation(bsl::move(original.d_spillLocation)),
   d_syncConfig(bsl::move(original.d_syncConfig)),
   d_numPartitions(bsl::move(original.d_numPartitions)),
   d_maxArchivedFileSets(bsl::move(original.d_maxArchivedFileSets)),
   d_preallocate(bsl::move(original.d_preallocate)),
   d_prefaultPages(bsl::move(original.d_prefaultPages)),
-  d_flushAtShutdown(bsl::move(original.d_flushAtShutdown))
+  d_flushAtShutdown(bsl::move(original.d_flushAtShutdown)),
+  d_chainReplication(bsl::move(original.d_chainReplication)),
+  d_incrementalWriteBack(bsl::move(original.d_incrementalWriteBack)),
+  d_groupCommitWindowUs(bsl::move(original.d_groupCommitWindowUs)),
+  d_groupCommitMaxBytes(bsl::move(original.d_groupCommitMaxBytes)),
+  d_hugePages(bsl::move(original.d_hugePages)),
+  d_recoveryIndexIntervalSec(bsl::move(original.d_recoveryIndexIntervalSec)),
+  d_compactionIntervalSec(bsl::move(original.d_compactionIntervalSec)),
+  d_readAheadMaxBytes(bsl::move(original.d_readAheadMaxBytes)),
+  d_replicationBatchMaxBytes(bsl::move(original.d_replicationBatchMaxBytes)),
+  d_replicationBatchMaxLatencyUs(
+      bsl::move(original.d_replicationBatchMaxLatencyUs)),
+  d_persistentMemory(bsl::move(original.d_persistentMemory))
 {
 }
 
@@ -4212,12 +4609,27 @@ PartitionConfig::PartitionConfig(PartitionConfig&& original,
 , d_maxQlistFileSize(bsl::move(original.d_maxQlistFileSize))
 , d_location(bsl::move(original.d_location), basicAllocator)
 , d_archiveLocation(bsl::move(original.d_archiveLocation), basicAllocator)
+, d_tierLocation(bsl::move(original.d_tierLocation), basicAllocator)
+, d_storageEngine(bsl::move(original.d_storageEngine), basicAllocator)
+, d_spillLocation(bsl::move(original.d_spillLocation), basicAllocator)
 , d_syncConfig(bsl::move(original.d_syncConfig))
 , d_numPartitions(bsl::move(original.d_numPartitions))
 , d_maxArchivedFileSets(bsl::move(original.d_maxArchivedFileSets))
 , d_preallocate(bsl::move(original.d_preallocate))
 , d_prefaultPages(bsl::move(original.d_prefaultPages))
 , d_flushAtShutdown(bsl::move(original.d_flushAtShutdown))
+, d_chainReplication(bsl::move(original.d_chainReplication))
+, d_incrementalWriteBack(bsl::move(original.d_incrementalWriteBack))
+, d_groupCommitWindowUs(bsl::move(original.d_groupCommitWindowUs))
+, d_groupCommitMaxBytes(bsl::move(original.d_groupCommitMaxBytes))
+, d_hugePages(bsl::move(original.d_hugePages))
+, d_recoveryIndexIntervalSec(bsl::move(original.d_recoveryIndexIntervalSec))
+, d_compactionIntervalSec(bsl::move(original.d_compactionIntervalSec))
+, d_readAheadMaxBytes(bsl::move(original.d_readAheadMaxBytes))
+, d_replicationBatchMaxBytes(bsl::move(original.d_replicationBatchMaxBytes))
+, d_replicationBatchMaxLatencyUs(
+      bsl::move(original.d_replicationBatchMaxLatencyUs))
+, d_persistentMemory(bsl::move(original.d_persistentMemory))
 {
 }
 #endif
@@ -4231,17 +4643,31 @@ PartitionConfig::~PartitionConfig()
 PartitionConfig& PartitionConfig::operator=(const PartitionConfig& rhs)
 {
     if (this != &rhs) {
-        d_numPartitions       = rhs.d_numPartitions;
-        d_location            = rhs.d_location;
-        d_archiveLocation     = rhs.d_archiveLocation;
-        d_maxDataFileSize     = rhs.d_maxDataFileSize;
-        d_maxJournalFileSize  = rhs.d_maxJournalFileSize;
-        d_maxQlistFileSize    = rhs.d_maxQlistFileSize;
-        d_preallocate         = rhs.d_preallocate;
-        d_maxArchivedFileSets = rhs.d_maxArchivedFileSets;
-        d_prefaultPages       = rhs.d_prefaultPages;
-        d_flushAtShutdown     = rhs.d_flushAtShutdown;
-        d_syncConfig          = rhs.d_syncConfig;
+        d_numPartitions            = rhs.d_numPartitions;
+        d_location                 = rhs.d_location;
+        d_archiveLocation          = rhs.d_archiveLocation;
+        d_maxDataFileSize          = rhs.d_maxDataFileSize;
+        d_maxJournalFileSize       = rhs.d_maxJournalFileSize;
+        d_maxQlistFileSize         = rhs.d_maxQlistFileSize;
+        d_preallocate              = rhs.d_preallocate;
+        d_maxArchivedFileSets      = rhs.d_maxArchivedFileSets;
+        d_prefaultPages            = rhs.d_prefaultPages;
+        d_flushAtShutdown          = rhs.d_flushAtShutdown;
+        d_syncConfig               = rhs.d_syncConfig;
+        d_chainReplication         = rhs.d_chainReplication;
+        d_incrementalWriteBack     = rhs.d_incrementalWriteBack;
+        d_groupCommitWindowUs      = rhs.d_groupCommitWindowUs;
+        d_groupCommitMaxBytes      = rhs.d_groupCommitMaxBytes;
+        d_hugePages                = rhs.d_hugePages;
+        d_recoveryIndexIntervalSec = rhs.d_recoveryIndexIntervalSec;
+        d_compactionIntervalSec    = rhs.d_compactionIntervalSec;
+        d_readAheadMaxBytes        = rhs.d_readAheadMaxBytes;
+        d_replicationBatchMaxBytes = rhs.d_replicationBatchMaxBytes;
+        d_replicationBatchMaxLatencyUs = rhs.d_replicationBatchMaxLatencyUs;
+        d_tierLocation                 = rhs.d_tierLocation;
+        d_storageEngine                = rhs.d_storageEngine;
+        d_persistentMemory             = rhs.d_persistentMemory;
+        d_spillLocation                = rhs.d_spillLocation;
     }
 
     return *this;
@@ -4252,17 +4678,32 @@ PartitionConfig& PartitionConfig::operator=(const PartitionConfig& rhs)
 PartitionConfig& PartitionConfig::operator=(PartitionConfig&& rhs)
 {
     if (this != &rhs) {
-        d_numPartitions       = bsl::move(rhs.d_numPartitions);
-        d_location            = bsl::move(rhs.d_location);
-        d_archiveLocation     = bsl::move(rhs.d_archiveLocation);
-        d_maxDataFileSize     = bsl::move(rhs.d_maxDataFileSize);
-        d_maxJournalFileSize  = bsl::move(rhs.d_maxJournalFileSize);
-        d_maxQlistFileSize    = bsl::move(rhs.d_maxQlistFileSize);
-        d_preallocate         = bsl::move(rhs.d_preallocate);
-        d_maxArchivedFileSets = bsl::move(rhs.d_maxArchivedFileSets);
-        d_prefaultPages       = bsl::move(rhs.d_prefaultPages);
-        d_flushAtShutdown     = bsl::move(rhs.d_flushAtShutdown);
-        d_syncConfig          = bsl::move(rhs.d_syncConfig);
+        d_numPartitions            = bsl::move(rhs.d_numPartitions);
+        d_location                 = bsl::move(rhs.d_location);
+        d_archiveLocation          = bsl::move(rhs.d_archiveLocation);
+        d_maxDataFileSize          = bsl::move(rhs.d_maxDataFileSize);
+        d_maxJournalFileSize       = bsl::move(rhs.d_maxJournalFileSize);
+        d_maxQlistFileSize         = bsl::move(rhs.d_maxQlistFileSize);
+        d_preallocate              = bsl::move(rhs.d_preallocate);
+        d_maxArchivedFileSets      = bsl::move(rhs.d_maxArchivedFileSets);
+        d_prefaultPages            = bsl::move(rhs.d_prefaultPages);
+        d_flushAtShutdown          = bsl::move(rhs.d_flushAtShutdown);
+        d_syncConfig               = bsl::move(rhs.d_syncConfig);
+        d_chainReplication         = bsl::move(rhs.d_chainReplication);
+        d_incrementalWriteBack     = bsl::move(rhs.d_incrementalWriteBack);
+        d_groupCommitWindowUs      = bsl::move(rhs.d_groupCommitWindowUs);
+        d_groupCommitMaxBytes      = bsl::move(rhs.d_groupCommitMaxBytes);
+        d_hugePages                = bsl::move(rhs.d_hugePages);
+        d_recoveryIndexIntervalSec = bsl::move(rhs.d_recoveryIndexIntervalSec);
+        d_compactionIntervalSec    = bsl::move(rhs.d_compactionIntervalSec);
+        d_readAheadMaxBytes        = bsl::move(rhs.d_readAheadMaxBytes);
+        d_replicationBatchMaxBytes = bsl::move(rhs.d_replicationBatchMaxBytes);
+        d_replicationBatchMaxLatencyUs = bsl::move(
+            rhs.d_replicationBatchMaxLatencyUs);
+        d_tierLocation     = bsl::move(rhs.d_tierLocation);
+        d_storageEngine    = bsl::move(rhs.d_storageEngine);
+        d_persistentMemory = bsl::move(rhs.d_persistentMemory);
+        d_spillLocation    = bsl::move(rhs.d_spillLocation);
     }
 
     return *this;
@@ -4282,6 +4723,23 @@ void PartitionConfig::reset()
     d_prefaultPages   = DEFAULT_INITIALIZER_PREFAULT_PAGES;
     d_flushAtShutdown = DEFAULT_INITIALIZER_FLUSH_AT_SHUTDOWN;
     bdlat_ValueTypeFunctions::reset(&d_syncConfig);
+    d_chainReplication         = DEFAULT_INITIALIZER_CHAIN_REPLICATION;
+    d_incrementalWriteBack     = DEFAULT_INITIALIZER_INCREMENTAL_WRITE_BACK;
+    d_groupCommitWindowUs      = DEFAULT_INITIALIZER_GROUP_COMMIT_WINDOW_US;
+    d_groupCommitMaxBytes      = DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_BYTES;
+    d_hugePages                = DEFAULT_INITIALIZER_HUGE_PAGES;
+    d_recoveryIndexIntervalSec =
+        DEFAULT_INITIALIZER_RECOVERY_INDEX_INTERVAL_SEC;
+    d_compactionIntervalSec    = DEFAULT_INITIALIZER_COMPACTION_INTERVAL_SEC;
+    d_readAheadMaxBytes        = DEFAULT_INITIALIZER_READ_AHEAD_MAX_BYTES;
+    d_replicationBatchMaxBytes =
+        DEFAULT_INITIALIZER_REPLICATION_BATCH_MAX_BYTES;
+    d_replicationBatchMaxLatencyUs =
+        DEFAULT_INITIALIZER_REPLICATION_BATCH_MAX_LATENCY_US;
+    d_tierLocation     = DEFAULT_INITIALIZER_TIER_LOCATION;
+    d_storageEngine    = DEFAULT_INITIALIZER_STORAGE_ENGINE;
+    d_persistentMemory = DEFAULT_INITIALIZER_PERSISTENT_MEMORY;
+    d_spillLocation    = DEFAULT_INITIALIZER_SPILL_LOCATION;
 }
 
 // ACCESSORS
@@ -4303,6 +4761,25 @@ bsl::ostream& PartitionConfig::print(bsl::ostream& stream,
     printer.printAttribute("prefaultPages", this->prefaultPages());
     printer.printAttribute("flushAtShutdown", this->flushAtShutdown());
     printer.printAttribute("syncConfig", this->syncConfig());
+    printer.printAttribute("chainReplication", this->chainReplication());
+    printer.printAttribute("incrementalWriteBack",
+                           this->incrementalWriteBack());
+    printer.printAttribute("groupCommitWindowUs", this->groupCommitWindowUs());
+    printer.printAttribute("groupCommitMaxBytes", this->groupCommitMaxBytes());
+    printer.printAttribute("hugePages", this->hugePages());
+    printer.printAttribute("recoveryIndexIntervalSec",
+                           this->recoveryIndexIntervalSec());
+    printer.printAttribute("compactionIntervalSec",
+                           this->compactionIntervalSec());
+    printer.printAttribute("readAheadMaxBytes", this->readAheadMaxBytes());
+    printer.printAttribute("replicationBatchMaxBytes",
+                           this->replicationBatchMaxBytes());
+    printer.printAttribute("replicationBatchMaxLatencyUs",
+                           this->replicationBatchMaxLatencyUs());
+    printer.printAttribute("tierLocation", this->tierLocation());
+    printer.printAttribute("storageEngine", this->storageEngine());
+    printer.printAttribute("persistentMemory", this->persistentMemory());
+    printer.printAttribute("spillLocation", this->spillLocation());
     printer.end();
     return stream;
 }
@@ -5019,6 +5496,8 @@ const char AppConfig::CLASS_NAME[] = "AppConfig";
 const char AppConfig::DEFAULT_INITIALIZER_LATENCY_MONITOR_DOMAIN[] =
     "bmq.sys.latemon.latency";
 
+const bool AppConfig::DEFAULT_INITIALIZER_USE_TSC_TIMER = false;
+
 const bdlat_AttributeInfo AppConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_BROKER_INSTANCE_NAME,
      "brokerInstanceName",
@@ -5099,14 +5578,19 @@ const bdlat_AttributeInfo AppConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "messagePropertiesV2",
      sizeof("messagePropertiesV2") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_USE_TSC_TIMER,
+     "useTscTimer",
+     sizeof("useTscTimer") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo* AppConfig::lookupAttributeInfo(const char* name,
                                                           int nameLength)
 {
-    for (int i = 0; i < 16; ++i) {
+    for (int i = 0; i < 17; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             AppConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -5154,6 +5638,8 @@ const bdlat_AttributeInfo* AppConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PLUGINS];
     case ATTRIBUTE_ID_MESSAGE_PROPERTIES_V2:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MESSAGE_PROPERTIES_V2];
+    case ATTRIBUTE_ID_USE_TSC_TIMER:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_USE_TSC_TIMER];
     default: return 0;
     }
 }
@@ -5178,6 +5664,7 @@ AppConfig::AppConfig(bslma::Allocator* basicAllocator)
 , d_configVersion()
 , d_logsObserverMaxSize()
 , d_isRunningOnDev()
+, d_useTscTimer(DEFAULT_INITIALIZER_USE_TSC_TIMER)
 {
 }
 
@@ -5199,6 +5686,7 @@ AppConfig::AppConfig(const AppConfig&  original,
 , d_configVersion(original.d_configVersion)
 , d_logsObserverMaxSize(original.d_logsObserverMaxSize)
 , d_isRunningOnDev(original.d_isRunningOnDev)
+, d_useTscTimer(original.d_useTscTimer)
 {
 }
 
@@ -5220,7 +5708,8 @@ AppConfig::AppConfig(AppConfig&& original) noexcept
   d_brokerVersion(bsl::move(original.d_brokerVersion)),
   d_configVersion(bsl::move(original.d_configVersion)),
   d_logsObserverMaxSize(bsl::move(original.d_logsObserverMaxSize)),
-  d_isRunningOnDev(bsl::move(original.d_isRunningOnDev))
+  d_isRunningOnDev(bsl::move(original.d_isRunningOnDev)),
+  d_useTscTimer(bsl::move(original.d_useTscTimer))
 {
 }
 
@@ -5243,6 +5732,7 @@ AppConfig::AppConfig(AppConfig&& original, bslma::Allocator* basicAllocator)
 , d_configVersion(bsl::move(original.d_configVersion))
 , d_logsObserverMaxSize(bsl::move(original.d_logsObserverMaxSize))
 , d_isRunningOnDev(bsl::move(original.d_isRunningOnDev))
+, d_useTscTimer(bsl::move(original.d_useTscTimer))
 {
 }
 #endif
@@ -5272,6 +5762,7 @@ AppConfig& AppConfig::operator=(const AppConfig& rhs)
         d_bmqconfConfig        = rhs.d_bmqconfConfig;
         d_plugins              = rhs.d_plugins;
         d_messagePropertiesV2  = rhs.d_messagePropertiesV2;
+        d_useTscTimer          = rhs.d_useTscTimer;
     }
 
     return *this;
@@ -5298,6 +5789,7 @@ AppConfig& AppConfig::operator=(AppConfig&& rhs)
         d_bmqconfConfig        = bsl::move(rhs.d_bmqconfConfig);
         d_plugins              = bsl::move(rhs.d_plugins);
         d_messagePropertiesV2  = bsl::move(rhs.d_messagePropertiesV2);
+        d_useTscTimer          = bsl::move(rhs.d_useTscTimer);
     }
 
     return *this;
@@ -5322,6 +5814,7 @@ void AppConfig::reset()
     bdlat_ValueTypeFunctions::reset(&d_bmqconfConfig);
     bdlat_ValueTypeFunctions::reset(&d_plugins);
     bdlat_ValueTypeFunctions::reset(&d_messagePropertiesV2);
+    d_useTscTimer = DEFAULT_INITIALIZER_USE_TSC_TIMER;
 }
 
 // ACCESSORS
@@ -5348,6 +5841,7 @@ AppConfig::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("bmqconfConfig", this->bmqconfConfig());
     printer.printAttribute("plugins", this->plugins());
     printer.printAttribute("messagePropertiesV2", this->messagePropertiesV2());
+    printer.printAttribute("useTscTimer", this->useTscTimer());
     printer.end();
     return stream;
 }
@@ -5801,14 +6295,19 @@ const bdlat_AttributeInfo ClustersDefinition::ATTRIBUTE_INFO_ARRAY[] = {
      "reversedClusterConnections",
      sizeof("reversedClusterConnections") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_MY_PROXY_CLUSTERS,
+     "myProxyClusters",
+     sizeof("myProxyClusters") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 ClustersDefinition::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 5; ++i) {
+    for (int i = 0; i < 6; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             ClustersDefinition::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -5835,6 +6334,8 @@ const bdlat_AttributeInfo* ClustersDefinition::lookupAttributeInfo(int id)
     case ATTRIBUTE_ID_REVERSED_CLUSTER_CONNECTIONS:
         return &ATTRIBUTE_INFO_ARRAY
             [ATTRIBUTE_INDEX_REVERSED_CLUSTER_CONNECTIONS];
+    case ATTRIBUTE_ID_MY_PROXY_CLUSTERS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MY_PROXY_CLUSTERS];
     default: return 0;
     }
 }
@@ -5843,6 +6344,7 @@ const bdlat_AttributeInfo* ClustersDefinition::lookupAttributeInfo(int id)
 
 ClustersDefinition::ClustersDefinition(bslma::Allocator* basicAllocator)
 : d_myReverseClusters(basicAllocator)
+, d_myProxyClusters(basicAllocator)
 , d_myVirtualClusters(basicAllocator)
 , d_reversedClusterConnections(basicAllocator)
 , d_proxyClusters(basicAllocator)
@@ -5853,6 +6355,7 @@ ClustersDefinition::ClustersDefinition(bslma::Allocator* basicAllocator)
 ClustersDefinition::ClustersDefinition(const ClustersDefinition& original,
                                        bslma::Allocator* basicAllocator)
 : d_myReverseClusters(original.d_myReverseClusters, basicAllocator)
+, d_myProxyClusters(original.d_myProxyClusters, basicAllocator)
 , d_myVirtualClusters(original.d_myVirtualClusters, basicAllocator)
 , d_reversedClusterConnections(original.d_reversedClusterConnections,
                                basicAllocator)
@@ -5865,6 +6368,7 @@ ClustersDefinition::ClustersDefinition(const ClustersDefinition& original,
     defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
 ClustersDefinition::ClustersDefinition(ClustersDefinition&& original) noexcept
 : d_myReverseClusters(bsl::move(original.d_myReverseClusters)),
+  d_myProxyClusters(bsl::move(original.d_myProxyClusters)),
   d_myVirtualClusters(bsl::move(original.d_myVirtualClusters)),
   d_reversedClusterConnections(
       bsl::move(original.d_reversedClusterConnections)),
@@ -5876,6 +6380,7 @@ ClustersDefinition::ClustersDefinition(ClustersDefinition&& original) noexcept
 ClustersDefinition::ClustersDefinition(ClustersDefinition&& original,
                                        bslma::Allocator*    basicAllocator)
 : d_myReverseClusters(bsl::move(original.d_myReverseClusters), basicAllocator)
+, d_myProxyClusters(bsl::move(original.d_myProxyClusters), basicAllocator)
 , d_myVirtualClusters(bsl::move(original.d_myVirtualClusters), basicAllocator)
 , d_reversedClusterConnections(
       bsl::move(original.d_reversedClusterConnections),
@@ -5901,6 +6406,7 @@ ClustersDefinition::operator=(const ClustersDefinition& rhs)
         d_myVirtualClusters          = rhs.d_myVirtualClusters;
         d_proxyClusters              = rhs.d_proxyClusters;
         d_reversedClusterConnections = rhs.d_reversedClusterConnections;
+        d_myProxyClusters            = rhs.d_myProxyClusters;
     }
 
     return *this;
@@ -5917,6 +6423,7 @@ ClustersDefinition& ClustersDefinition::operator=(ClustersDefinition&& rhs)
         d_proxyClusters              = bsl::move(rhs.d_proxyClusters);
         d_reversedClusterConnections = bsl::move(
             rhs.d_reversedClusterConnections);
+        d_myProxyClusters            = bsl::move(rhs.d_myProxyClusters);
     }
 
     return *this;
@@ -5930,6 +6437,7 @@ void ClustersDefinition::reset()
     bdlat_ValueTypeFunctions::reset(&d_myVirtualClusters);
     bdlat_ValueTypeFunctions::reset(&d_proxyClusters);
     bdlat_ValueTypeFunctions::reset(&d_reversedClusterConnections);
+    bdlat_ValueTypeFunctions::reset(&d_myProxyClusters);
 }
 
 // ACCESSORS
@@ -5946,6 +6454,7 @@ bsl::ostream& ClustersDefinition::print(bsl::ostream& stream,
     printer.printAttribute("proxyClusters", this->proxyClusters());
     printer.printAttribute("reversedClusterConnections",
                            this->reversedClusterConnections());
+    printer.printAttribute("myProxyClusters", this->myProxyClusters());
     printer.end();
     return stream;
 }
@@ -2426,6 +2426,10 @@ class QueueOperationsConfig {
     // (otherwise, this timeout is not expected to be reached).
     // ackWindowSize..............: number of PUTs without ACK requested after
     // which we request an ACK.  This is to remove pending broadcast PUTs.
+    // pendingPutsMaxBytes........: maximum number of bytes of PUTs pending
+    // upstream (awaiting ACK or buffered while the upstream is unavailable)
+    // for a remote queue, after which new PUTs are NACK'd.  0 means
+    // unlimited.
 
     // INSTANCE DATA
     int d_openTimeoutMs;
@@ -2440,6 +2444,7 @@ class QueueOperationsConfig {
     int d_stopTimeoutMs;
     int d_shutdownTimeoutMs;
     int d_ackWindowSize;
+    int d_pendingPutsMaxBytes;
 
   public:
     // TYPES
@@ -2455,10 +2460,11 @@ class QueueOperationsConfig {
         ATTRIBUTE_ID_CONSUMPTION_MONITOR_PERIOD_MS = 8,
         ATTRIBUTE_ID_STOP_TIMEOUT_MS               = 9,
         ATTRIBUTE_ID_SHUTDOWN_TIMEOUT_MS           = 10,
-        ATTRIBUTE_ID_ACK_WINDOW_SIZE               = 11
+        ATTRIBUTE_ID_ACK_WINDOW_SIZE               = 11,
+        ATTRIBUTE_ID_PENDING_PUTS_MAX_BYTES        = 12
     };
 
-    enum { NUM_ATTRIBUTES = 12 };
+    enum { NUM_ATTRIBUTES = 13 };
 
     enum {
         ATTRIBUTE_INDEX_OPEN_TIMEOUT_MS               = 0,
@@ -2472,7 +2478,8 @@ class QueueOperationsConfig {
         ATTRIBUTE_INDEX_CONSUMPTION_MONITOR_PERIOD_MS = 8,
         ATTRIBUTE_INDEX_STOP_TIMEOUT_MS               = 9,
         ATTRIBUTE_INDEX_SHUTDOWN_TIMEOUT_MS           = 10,
-        ATTRIBUTE_INDEX_ACK_WINDOW_SIZE               = 11
+        ATTRIBUTE_INDEX_ACK_WINDOW_SIZE               = 11,
+        ATTRIBUTE_INDEX_PENDING_PUTS_MAX_BYTES        = 12
     };
 
     // CONSTANTS
@@ -2502,6 +2509,8 @@ class QueueOperationsConfig {
 
     static const int DEFAULT_INITIALIZER_ACK_WINDOW_SIZE;
 
+    static const int DEFAULT_INITIALIZER_PENDING_PUTS_MAX_BYTES;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -2629,6 +2638,10 @@ class QueueOperationsConfig {
     // Return a reference to the modifiable "AckWindowSize" attribute of
     // this object.
 
+    int& pendingPutsMaxBytes();
+    // Return a reference to the modifiable "PendingPutsMaxBytes" attribute
+    // of this object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -2714,6 +2727,10 @@ class QueueOperationsConfig {
 
     int ackWindowSize() const;
     // Return the value of the "AckWindowSize" attribute of this object.
+
+    int pendingPutsMaxBytes() const;
+    // Return the value of the "PendingPutsMaxBytes" attribute of this
+    // object.
 };
 
 // FREE OPERATORS
@@ -3556,6 +3573,11 @@ class StorageSyncConfig {
     // to send in one go to the peer when serving a storage sync request from
     // it partitionSyncEventSize.........: maximum size, in bytes, of
     // bmqp::EventType::PARTITION_SYNC before we send it to the peer
+    // partitionSyncMaxOutstandingRecords: maximum number of journal records
+    // sent as part of partition sync and not yet written to the network,
+    // across all the partitions being sent to peers.  Each partition being
+    // sent gets an equal share of this budget, so that one partition cannot
+    // fill the channel and starve the others
 
     // INSTANCE DATA
     int d_startupRecoveryMaxDurationMs;
@@ -3567,33 +3589,36 @@ class StorageSyncConfig {
     int d_startupWaitDurationMs;
     int d_fileChunkSize;
     int d_partitionSyncEventSize;
+    int d_partitionSyncMaxOutstandingRecords;
 
   public:
     // TYPES
     enum {
-        ATTRIBUTE_ID_STARTUP_RECOVERY_MAX_DURATION_MS    = 0,
-        ATTRIBUTE_ID_MAX_ATTEMPTS_STORAGE_SYNC           = 1,
-        ATTRIBUTE_ID_STORAGE_SYNC_REQ_TIMEOUT_MS         = 2,
-        ATTRIBUTE_ID_MASTER_SYNC_MAX_DURATION_MS         = 3,
-        ATTRIBUTE_ID_PARTITION_SYNC_STATE_REQ_TIMEOUT_MS = 4,
-        ATTRIBUTE_ID_PARTITION_SYNC_DATA_REQ_TIMEOUT_MS  = 5,
-        ATTRIBUTE_ID_STARTUP_WAIT_DURATION_MS            = 6,
-        ATTRIBUTE_ID_FILE_CHUNK_SIZE                     = 7,
-        ATTRIBUTE_ID_PARTITION_SYNC_EVENT_SIZE           = 8
+        ATTRIBUTE_ID_STARTUP_RECOVERY_MAX_DURATION_MS       = 0,
+        ATTRIBUTE_ID_MAX_ATTEMPTS_STORAGE_SYNC              = 1,
+        ATTRIBUTE_ID_STORAGE_SYNC_REQ_TIMEOUT_MS            = 2,
+        ATTRIBUTE_ID_MASTER_SYNC_MAX_DURATION_MS            = 3,
+        ATTRIBUTE_ID_PARTITION_SYNC_STATE_REQ_TIMEOUT_MS    = 4,
+        ATTRIBUTE_ID_PARTITION_SYNC_DATA_REQ_TIMEOUT_MS     = 5,
+        ATTRIBUTE_ID_STARTUP_WAIT_DURATION_MS               = 6,
+        ATTRIBUTE_ID_FILE_CHUNK_SIZE                        = 7,
+        ATTRIBUTE_ID_PARTITION_SYNC_EVENT_SIZE              = 8,
+        ATTRIBUTE_ID_PARTITION_SYNC_MAX_OUTSTANDING_RECORDS = 9
     };
 
-    enum { NUM_ATTRIBUTES = 9 };
+    enum { NUM_ATTRIBUTES = 10 };
 
     enum {
-        ATTRIBUTE_INDEX_STARTUP_RECOVERY_MAX_DURATION_MS    = 0,
-        ATTRIBUTE_INDEX_MAX_ATTEMPTS_STORAGE_SYNC           = 1,
-        ATTRIBUTE_INDEX_STORAGE_SYNC_REQ_TIMEOUT_MS         = 2,
-        ATTRIBUTE_INDEX_MASTER_SYNC_MAX_DURATION_MS         = 3,
-        ATTRIBUTE_INDEX_PARTITION_SYNC_STATE_REQ_TIMEOUT_MS = 4,
-        ATTRIBUTE_INDEX_PARTITION_SYNC_DATA_REQ_TIMEOUT_MS  = 5,
-        ATTRIBUTE_INDEX_STARTUP_WAIT_DURATION_MS            = 6,
-        ATTRIBUTE_INDEX_FILE_CHUNK_SIZE                     = 7,
-        ATTRIBUTE_INDEX_PARTITION_SYNC_EVENT_SIZE           = 8
+        ATTRIBUTE_INDEX_STARTUP_RECOVERY_MAX_DURATION_MS       = 0,
+        ATTRIBUTE_INDEX_MAX_ATTEMPTS_STORAGE_SYNC              = 1,
+        ATTRIBUTE_INDEX_STORAGE_SYNC_REQ_TIMEOUT_MS            = 2,
+        ATTRIBUTE_INDEX_MASTER_SYNC_MAX_DURATION_MS            = 3,
+        ATTRIBUTE_INDEX_PARTITION_SYNC_STATE_REQ_TIMEOUT_MS    = 4,
+        ATTRIBUTE_INDEX_PARTITION_SYNC_DATA_REQ_TIMEOUT_MS     = 5,
+        ATTRIBUTE_INDEX_STARTUP_WAIT_DURATION_MS               = 6,
+        ATTRIBUTE_INDEX_FILE_CHUNK_SIZE                        = 7,
+        ATTRIBUTE_INDEX_PARTITION_SYNC_EVENT_SIZE              = 8,
+        ATTRIBUTE_INDEX_PARTITION_SYNC_MAX_OUTSTANDING_RECORDS = 9
     };
 
     // CONSTANTS
@@ -3617,6 +3642,9 @@ class StorageSyncConfig {
 
     static const int DEFAULT_INITIALIZER_PARTITION_SYNC_EVENT_SIZE;
 
+    static const int
+        DEFAULT_INITIALIZER_PARTITION_SYNC_MAX_OUTSTANDING_RECORDS;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -3732,6 +3760,10 @@ class StorageSyncConfig {
     // Return a reference to the modifiable "PartitionSyncEventSize"
     // attribute of this object.
 
+    int& partitionSyncMaxOutstandingRecords();
+    // Return a reference to the modifiable
+    // "PartitionSyncMaxOutstandingRecords" attribute of this object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -3809,6 +3841,10 @@ class StorageSyncConfig {
     int partitionSyncEventSize() const;
     // Return the value of the "PartitionSyncEventSize" attribute of this
     // object.
+
+    int partitionSyncMaxOutstandingRecords() const;
+    // Return the value of the "PartitionSyncMaxOutstandingRecords"
+    // attribute of this object.
 };
 
 // FREE OPERATORS
@@ -4290,7 +4326,27 @@ class TcpInterfaceConfig {
     // heartbeatIntervalMs..: How often (in milliseconds) to check if the
     // channel received data, and emit heartbeat.  0 to globally disable.
     // useNtf...............: Use the new NTF based TCP transport library
-    // instead of the existing one based on BTE
+    // instead of the existing one based on BTE putRateLimit.........: Maximum
+    // number of PUT messages per second accepted from one client session.
+    // PUT messages in excess are NACKed with a 'LIMIT_MESSAGES' status.  0 to
+    // disable.  queuePutRateLimit....: Maximum number of PUT messages per
+    // second accepted from one client session for one queue.  0 to disable.
+    // numListeners.........: Number of sockets listening on 'port', sharing
+    // it with SO_REUSEPORT so that the kernel spreads incoming connections
+    // across them.  zeroCopyThreshold....: Minimum size, in bytes, of a write
+    // for it to be sent without copying into the kernel (MSG_ZEROCOPY), the
+    // blob buffers being held until the kernel reports completion.  0 to
+    // disable.  localSocketPath......: Path of a local (Unix domain) socket on
+    // which to also listen, so that clients running on the same host can
+    // connect without going through the TCP/IP stack.  Empty to disable.
+    // pushBatchTargetSize..: Size, in bytes, the PUSH events sent to a client
+    // session aim for when 'pushBatchMaxDelayUs' is not 0.
+    // pushBatchMaxDelayUs..: Maximum time, in microseconds, a PUSH message is
+    // held by a client session so that it is sent in a larger PUSH event,
+    // when the rate of messages observed for the session predicts that the
+    // event will reach 'pushBatchTargetSize' within that time.  0 to disable,
+    // in which case the PUSH messages are sent at the end of each batch of the
+    // dispatcher.
 
     // INSTANCE DATA
     bsls::Types::Int64 d_lowWatermark;
@@ -4298,40 +4354,61 @@ class TcpInterfaceConfig {
     bsls::Types::Int64 d_nodeLowWatermark;
     bsls::Types::Int64 d_nodeHighWatermark;
     bsl::string        d_name;
+    bsl::string        d_localSocketPath;
     int                d_port;
     int                d_ioThreads;
     int                d_maxConnections;
     int                d_heartbeatIntervalMs;
+    int                d_pushBatchMaxDelayUs;
+    int                d_pushBatchTargetSize;
+    int                d_zeroCopyThreshold;
+    int                d_numListeners;
+    int                d_queuePutRateLimit;
+    int                d_putRateLimit;
     bool               d_useNtf;
 
   public:
     // TYPES
     enum {
-        ATTRIBUTE_ID_NAME                  = 0,
-        ATTRIBUTE_ID_PORT                  = 1,
-        ATTRIBUTE_ID_IO_THREADS            = 2,
-        ATTRIBUTE_ID_MAX_CONNECTIONS       = 3,
-        ATTRIBUTE_ID_LOW_WATERMARK         = 4,
-        ATTRIBUTE_ID_HIGH_WATERMARK        = 5,
-        ATTRIBUTE_ID_NODE_LOW_WATERMARK    = 6,
-        ATTRIBUTE_ID_NODE_HIGH_WATERMARK   = 7,
-        ATTRIBUTE_ID_HEARTBEAT_INTERVAL_MS = 8,
-        ATTRIBUTE_ID_USE_NTF               = 9
+        ATTRIBUTE_ID_NAME                    = 0,
+        ATTRIBUTE_ID_PORT                    = 1,
+        ATTRIBUTE_ID_IO_THREADS              = 2,
+        ATTRIBUTE_ID_MAX_CONNECTIONS         = 3,
+        ATTRIBUTE_ID_LOW_WATERMARK           = 4,
+        ATTRIBUTE_ID_HIGH_WATERMARK          = 5,
+        ATTRIBUTE_ID_NODE_LOW_WATERMARK      = 6,
+        ATTRIBUTE_ID_NODE_HIGH_WATERMARK     = 7,
+        ATTRIBUTE_ID_HEARTBEAT_INTERVAL_MS   = 8,
+        ATTRIBUTE_ID_USE_NTF                 = 9,
+        ATTRIBUTE_ID_PUT_RATE_LIMIT          = 10,
+        ATTRIBUTE_ID_QUEUE_PUT_RATE_LIMIT    = 11,
+        ATTRIBUTE_ID_NUM_LISTENERS           = 12,
+        ATTRIBUTE_ID_ZERO_COPY_THRESHOLD     = 13,
+        ATTRIBUTE_ID_LOCAL_SOCKET_PATH       = 14,
+        ATTRIBUTE_ID_PUSH_BATCH_TARGET_SIZE  = 15,
+        ATTRIBUTE_ID_PUSH_BATCH_MAX_DELAY_US = 16
     };
 
-    enum { NUM_ATTRIBUTES = 10 };
+    enum { NUM_ATTRIBUTES = 17 };
 
     enum {
-        ATTRIBUTE_INDEX_NAME                  = 0,
-        ATTRIBUTE_INDEX_PORT                  = 1,
-        ATTRIBUTE_INDEX_IO_THREADS            = 2,
-        ATTRIBUTE_INDEX_MAX_CONNECTIONS       = 3,
-        ATTRIBUTE_INDEX_LOW_WATERMARK         = 4,
-        ATTRIBUTE_INDEX_HIGH_WATERMARK        = 5,
-        ATTRIBUTE_INDEX_NODE_LOW_WATERMARK    = 6,
-        ATTRIBUTE_INDEX_NODE_HIGH_WATERMARK   = 7,
-        ATTRIBUTE_INDEX_HEARTBEAT_INTERVAL_MS = 8,
-        ATTRIBUTE_INDEX_USE_NTF               = 9
+        ATTRIBUTE_INDEX_NAME                    = 0,
+        ATTRIBUTE_INDEX_PORT                    = 1,
+        ATTRIBUTE_INDEX_IO_THREADS              = 2,
+        ATTRIBUTE_INDEX_MAX_CONNECTIONS         = 3,
+        ATTRIBUTE_INDEX_LOW_WATERMARK           = 4,
+        ATTRIBUTE_INDEX_HIGH_WATERMARK          = 5,
+        ATTRIBUTE_INDEX_NODE_LOW_WATERMARK      = 6,
+        ATTRIBUTE_INDEX_NODE_HIGH_WATERMARK     = 7,
+        ATTRIBUTE_INDEX_HEARTBEAT_INTERVAL_MS   = 8,
+        ATTRIBUTE_INDEX_USE_NTF                 = 9,
+        ATTRIBUTE_INDEX_PUT_RATE_LIMIT          = 10,
+        ATTRIBUTE_INDEX_QUEUE_PUT_RATE_LIMIT    = 11,
+        ATTRIBUTE_INDEX_NUM_LISTENERS           = 12,
+        ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD     = 13,
+        ATTRIBUTE_INDEX_LOCAL_SOCKET_PATH       = 14,
+        ATTRIBUTE_INDEX_PUSH_BATCH_TARGET_SIZE  = 15,
+        ATTRIBUTE_INDEX_PUSH_BATCH_MAX_DELAY_US = 16
     };
 
     // CONSTANTS
@@ -4345,6 +4422,20 @@ class TcpInterfaceConfig {
 
     static const int DEFAULT_INITIALIZER_HEARTBEAT_INTERVAL_MS;
 
+    static const int DEFAULT_INITIALIZER_QUEUE_PUT_RATE_LIMIT;
+
+    static const int DEFAULT_INITIALIZER_NUM_LISTENERS;
+
+    static const int DEFAULT_INITIALIZER_ZERO_COPY_THRESHOLD;
+
+    static const char DEFAULT_INITIALIZER_LOCAL_SOCKET_PATH[];
+
+    static const int DEFAULT_INITIALIZER_PUSH_BATCH_TARGET_SIZE;
+
+    static const int DEFAULT_INITIALIZER_PUSH_BATCH_MAX_DELAY_US;
+
+    static const int DEFAULT_INITIALIZER_PUT_RATE_LIMIT;
+
     static const bool DEFAULT_INITIALIZER_USE_NTF;
 
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
@@ -4480,6 +4571,34 @@ class TcpInterfaceConfig {
     // Return a reference to the modifiable "UseNtf" attribute of this
     // object.
 
+    int& putRateLimit();
+    // Return a reference to the modifiable "PutRateLimit" attribute of this
+    // object.
+
+    int& queuePutRateLimit();
+    // Return a reference to the modifiable "QueuePutRateLimit" attribute of
+    // this object.
+
+    int& numListeners();
+    // Return a reference to the modifiable "NumListeners" attribute of this
+    // object.
+
+    int& zeroCopyThreshold();
+    // Return a reference to the modifiable "ZeroCopyThreshold" attribute of
+    // this object.
+
+    bsl::string& localSocketPath();
+    // Return a reference to the modifiable "LocalSocketPath" attribute of
+    // this object.
+
+    int& pushBatchTargetSize();
+    // Return a reference to the modifiable "PushBatchTargetSize" attribute
+    // of this object.
+
+    int& pushBatchMaxDelayUs();
+    // Return a reference to the modifiable "PushBatchMaxDelayUs" attribute
+    // of this object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -4555,6 +4674,30 @@ class TcpInterfaceConfig {
 
     bool useNtf() const;
     // Return the value of the "UseNtf" attribute of this object.
+
+    int putRateLimit() const;
+    // Return the value of the "PutRateLimit" attribute of this object.
+
+    int queuePutRateLimit() const;
+    // Return the value of the "QueuePutRateLimit" attribute of this object.
+
+    int numListeners() const;
+    // Return the value of the "NumListeners" attribute of this object.
+
+    int zeroCopyThreshold() const;
+    // Return the value of the "ZeroCopyThreshold" attribute of this object.
+
+    const bsl::string& localSocketPath() const;
+    // Return a reference offering non-modifiable access to the
+    // "LocalSocketPath" attribute of this object.
+
+    int pushBatchTargetSize() const;
+    // Return the value of the "PushBatchTargetSize" attribute of this
+    // object.
+
+    int pushBatchMaxDelayUs() const;
+    // Return the value of the "PushBatchMaxDelayUs" attribute of this
+    // object.
 };
 
 // FREE OPERATORS
@@ -5015,24 +5158,44 @@ class DispatcherProcessorConfig {
     // INSTANCE DATA
     DispatcherProcessorParameters d_processorConfig;
     int                           d_numProcessors;
+    int                           d_workStealingIntervalMs;
+    int                           d_numaNodes;
+    int                           d_firstCpu;
+    int                           d_maxBatchSize;
 
   public:
     // TYPES
     enum {
-        ATTRIBUTE_ID_NUM_PROCESSORS   = 0,
-        ATTRIBUTE_ID_PROCESSOR_CONFIG = 1
+        ATTRIBUTE_ID_NUM_PROCESSORS            = 0,
+        ATTRIBUTE_ID_PROCESSOR_CONFIG          = 1,
+        ATTRIBUTE_ID_WORK_STEALING_INTERVAL_MS = 2,
+        ATTRIBUTE_ID_NUMA_NODES                = 3,
+        ATTRIBUTE_ID_FIRST_CPU                 = 4,
+        ATTRIBUTE_ID_MAX_BATCH_SIZE            = 5
     };
 
-    enum { NUM_ATTRIBUTES = 2 };
+    enum { NUM_ATTRIBUTES = 6 };
 
     enum {
-        ATTRIBUTE_INDEX_NUM_PROCESSORS   = 0,
-        ATTRIBUTE_INDEX_PROCESSOR_CONFIG = 1
+        ATTRIBUTE_INDEX_NUM_PROCESSORS            = 0,
+        ATTRIBUTE_INDEX_PROCESSOR_CONFIG          = 1,
+        ATTRIBUTE_INDEX_WORK_STEALING_INTERVAL_MS = 2,
+        ATTRIBUTE_INDEX_NUMA_NODES                = 3,
+        ATTRIBUTE_INDEX_FIRST_CPU                 = 4,
+        ATTRIBUTE_INDEX_MAX_BATCH_SIZE            = 5
     };
 
     // CONSTANTS
     static const char CLASS_NAME[];
 
+    static const int DEFAULT_INITIALIZER_WORK_STEALING_INTERVAL_MS;
+
+    static const int DEFAULT_INITIALIZER_NUMA_NODES;
+
+    static const int DEFAULT_INITIALIZER_FIRST_CPU;
+
+    static const int DEFAULT_INITIALIZER_MAX_BATCH_SIZE;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -5121,6 +5284,22 @@ class DispatcherProcessorConfig {
     // Return a reference to the modifiable "ProcessorConfig" attribute of
     // this object.
 
+    int& workStealingIntervalMs();
+    // Return a reference to the modifiable "WorkStealingIntervalMs"
+    // attribute of this object.
+
+    int& numaNodes();
+    // Return a reference to the modifiable "NumaNodes" attribute of this
+    // object.
+
+    int& firstCpu();
+    // Return a reference to the modifiable "FirstCpu" attribute of this
+    // object.
+
+    int& maxBatchSize();
+    // Return a reference to the modifiable "MaxBatchSize" attribute of this
+    // object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -5170,6 +5349,19 @@ class DispatcherProcessorConfig {
     const DispatcherProcessorParameters& processorConfig() const;
     // Return a reference offering non-modifiable access to the
     // "ProcessorConfig" attribute of this object.
+
+    int workStealingIntervalMs() const;
+    // Return the value of the "WorkStealingIntervalMs" attribute of this
+    // object.
+
+    int numaNodes() const;
+    // Return the value of the "NumaNodes" attribute of this object.
+
+    int firstCpu() const;
+    // Return the value of the "FirstCpu" attribute of this object.
+
+    int maxBatchSize() const;
+    // Return the value of the "MaxBatchSize" attribute of this object.
 };
 
 // FREE OPERATORS
@@ -5731,7 +5923,66 @@ class PartitionConfig {
     // whether to populate (prefault) page tables for a mapping.
     // flushAtShutdown......: flag to indicate whether broker should flush
     // storage files to disk at shutdown syncConfig...........: configuration
-    // for storage synchronization and recovery
+    // for storage synchronization and recovery chainReplication.....: flag to
+    // indicate whether the primary of a partition should replicate storage
+    // records to the first replica only, each replica relaying them to the
+    // next one, instead of replicating them to each replica
+    // incrementalWriteBack.: flag to indicate whether the broker should start
+    // the write back to disk of the storage files as they are being written,
+    // instead of leaving it entirely to the kernel
+    // groupCommitWindowUs..: maximum time, in microseconds, between the write
+    // of a message by the primary of a partition and the sync to disk
+    // covering it, a group commit covering all the messages written in the
+    // meantime, and the message being acknowledged only once synced; 0
+    // disables group commit
+    // groupCommitMaxBytes..: number of bytes written since the last group
+    // commit after which a new one is started without waiting for the window
+    // to elapse
+    // hugePages............: flag to indicate whether the broker should
+    // advise the OS to back the mappings of the data and journal files with
+    // (transparent) huge pages
+    // recoveryIndexIntervalSec: minimum interval, in seconds, between two
+    // checkpoints of the live records of the journal into a recovery index,
+    // used at startup to skip the records which were no longer needed; 0
+    // disables the recovery index
+    // compactionIntervalSec: minimum interval, in seconds, between two
+    //                        compactions of the active data file, which
+    //                        deallocate the disk space of the regions of
+    //                        deleted messages; 0 disables the compaction
+    // readAheadMaxBytes....: maximum number of bytes of the active data file
+    //                        which the broker asks the OS to read ahead of
+    //                        the messages being delivered, the read-ahead
+    //                        window growing up to this size while messages
+    //                        are read sequentially; 0 disables the
+    //                        read-ahead
+    // replicationBatchMaxBytes: maximum number of bytes of storage records
+    //                        accumulated by the primary of a partition
+    //                        before replicating them as one storage event; 0
+    //                        leaves the batch bounded only by the adaptive
+    //                        record count
+    // replicationBatchMaxLatencyUs: maximum time, in microseconds, between
+    //                        the first storage record added to a batch by
+    //                        the primary of a partition and the replication
+    //                        of the batch; 0 leaves the batch to be
+    //                        replicated when the partition dispatcher becomes
+    //                        idle
+    // tierLocation.........: location, typically a mount of an object store,
+    //                        to which the archived files pruned beyond
+    //                        maxArchivedFileSets are offloaded instead of
+    //                        being deleted; empty deletes them
+    // storageEngine........: name of the storage engine plugin creating the
+    //                        storages of the queues of the cluster; empty
+    //                        uses the built-in storages
+    // persistentMemory.....: flag to indicate whether the location of the
+    //                        partitions is a DAX mount of persistent memory,
+    //                        in which case the files are mapped synchronously
+    //                        and each message is made durable by flushing
+    //                        the CPU caches when it is written, instead of
+    //                        being synced to disk by a group commit
+    // spillLocation........: directory of the scratch files to which the
+    //                        in-memory queues of the cluster spill the
+    //                        payloads of their new messages under memory
+    //                        pressure; empty (the default) never spills
 
     // INSTANCE DATA
     bsls::Types::Uint64 d_maxDataFileSize;
@@ -5739,12 +5990,26 @@ class PartitionConfig {
     bsls::Types::Uint64 d_maxQlistFileSize;
     bsl::string         d_location;
     bsl::string         d_archiveLocation;
+    bsl::string         d_tierLocation;
+    bsl::string         d_storageEngine;
+    bsl::string         d_spillLocation;
     StorageSyncConfig   d_syncConfig;
     int                 d_numPartitions;
     int                 d_maxArchivedFileSets;
     bool                d_preallocate;
     bool                d_prefaultPages;
     bool                d_flushAtShutdown;
+    bool                d_chainReplication;
+    bool                d_incrementalWriteBack;
+    int                 d_groupCommitWindowUs;
+    int                 d_groupCommitMaxBytes;
+    bool                d_hugePages;
+    int                 d_recoveryIndexIntervalSec;
+    int                 d_compactionIntervalSec;
+    int                 d_readAheadMaxBytes;
+    int                 d_replicationBatchMaxBytes;
+    int                 d_replicationBatchMaxLatencyUs;
+    bool                d_persistentMemory;
 
   public:
     // TYPES
@@ -5759,10 +6024,24 @@ class PartitionConfig {
         ATTRIBUTE_ID_MAX_ARCHIVED_FILE_SETS = 7,
         ATTRIBUTE_ID_PREFAULT_PAGES         = 8,
         ATTRIBUTE_ID_FLUSH_AT_SHUTDOWN      = 9,
-        ATTRIBUTE_ID_SYNC_CONFIG            = 10
+        ATTRIBUTE_ID_SYNC_CONFIG            = 10,
+        ATTRIBUTE_ID_CHAIN_REPLICATION      = 11,
+        ATTRIBUTE_ID_INCREMENTAL_WRITE_BACK = 12,
+        ATTRIBUTE_ID_GROUP_COMMIT_WINDOW_US = 13,
+        ATTRIBUTE_ID_GROUP_COMMIT_MAX_BYTES = 14,
+        ATTRIBUTE_ID_HUGE_PAGES             = 15,
+        ATTRIBUTE_ID_RECOVERY_INDEX_INTERVAL_SEC = 16,
+        ATTRIBUTE_ID_COMPACTION_INTERVAL_SEC     = 17,
+        ATTRIBUTE_ID_READ_AHEAD_MAX_BYTES        = 18,
+        ATTRIBUTE_ID_REPLICATION_BATCH_MAX_BYTES = 19,
+        ATTRIBUTE_ID_REPLICATION_BATCH_MAX_LATENCY_US = 20,
+        ATTRIBUTE_ID_TIER_LOCATION                     = 21,
+        ATTRIBUTE_ID_STORAGE_ENGINE                    = 22,
+        ATTRIBUTE_ID_PERSISTENT_MEMORY                 = 23,
+        ATTRIBUTE_ID_SPILL_LOCATION                    = 24
     };
 
-    enum { NUM_ATTRIBUTES = 11 };
+    enum { NUM_ATTRIBUTES = 25 };
 
     enum {
         ATTRIBUTE_INDEX_NUM_PARTITIONS         = 0,
@@ -5775,7 +6054,21 @@ class PartitionConfig {
         ATTRIBUTE_INDEX_MAX_ARCHIVED_FILE_SETS = 7,
         ATTRIBUTE_INDEX_PREFAULT_PAGES         = 8,
         ATTRIBUTE_INDEX_FLUSH_AT_SHUTDOWN      = 9,
-        ATTRIBUTE_INDEX_SYNC_CONFIG            = 10
+        ATTRIBUTE_INDEX_SYNC_CONFIG            = 10,
+        ATTRIBUTE_INDEX_CHAIN_REPLICATION      = 11,
+        ATTRIBUTE_INDEX_INCREMENTAL_WRITE_BACK = 12,
+        ATTRIBUTE_INDEX_GROUP_COMMIT_WINDOW_US = 13,
+        ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES = 14,
+        ATTRIBUTE_INDEX_HUGE_PAGES             = 15,
+        ATTRIBUTE_INDEX_RECOVERY_INDEX_INTERVAL_SEC = 16,
+        ATTRIBUTE_INDEX_COMPACTION_INTERVAL_SEC     = 17,
+        ATTRIBUTE_INDEX_READ_AHEAD_MAX_BYTES        = 18,
+        ATTRIBUTE_INDEX_REPLICATION_BATCH_MAX_BYTES = 19,
+        ATTRIBUTE_INDEX_REPLICATION_BATCH_MAX_LATENCY_US = 20,
+        ATTRIBUTE_INDEX_TIER_LOCATION                     = 21,
+        ATTRIBUTE_INDEX_STORAGE_ENGINE                    = 22,
+        ATTRIBUTE_INDEX_PERSISTENT_MEMORY                 = 23,
+        ATTRIBUTE_INDEX_SPILL_LOCATION                    = 24
     };
 
     // CONSTANTS
@@ -5787,6 +6080,34 @@ class PartitionConfig {
 
     static const bool DEFAULT_INITIALIZER_FLUSH_AT_SHUTDOWN;
 
+    static const bool DEFAULT_INITIALIZER_CHAIN_REPLICATION;
+
+    static const bool DEFAULT_INITIALIZER_INCREMENTAL_WRITE_BACK;
+
+    static const int DEFAULT_INITIALIZER_GROUP_COMMIT_WINDOW_US;
+
+    static const int DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_BYTES;
+
+    static const bool DEFAULT_INITIALIZER_HUGE_PAGES;
+
+    static const int DEFAULT_INITIALIZER_RECOVERY_INDEX_INTERVAL_SEC;
+
+    static const int DEFAULT_INITIALIZER_COMPACTION_INTERVAL_SEC;
+
+    static const int DEFAULT_INITIALIZER_READ_AHEAD_MAX_BYTES;
+
+    static const int DEFAULT_INITIALIZER_REPLICATION_BATCH_MAX_BYTES;
+
+    static const int DEFAULT_INITIALIZER_REPLICATION_BATCH_MAX_LATENCY_US;
+
+    static const char DEFAULT_INITIALIZER_TIER_LOCATION[];
+
+    static const char DEFAULT_INITIALIZER_STORAGE_ENGINE[];
+
+    static const bool DEFAULT_INITIALIZER_PERSISTENT_MEMORY;
+
+    static const char DEFAULT_INITIALIZER_SPILL_LOCATION[];
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -5924,6 +6245,62 @@ class PartitionConfig {
     // Return a reference to the modifiable "SyncConfig" attribute of this
     // object.
 
+    bool& chainReplication();
+    // Return a reference to the modifiable "ChainReplication" attribute of
+    // this object.
+
+    bool& incrementalWriteBack();
+    // Return a reference to the modifiable "IncrementalWriteBack" attribute
+    // of this object.
+
+    int& groupCommitWindowUs();
+    // Return a reference to the modifiable "GroupCommitWindowUs" attribute of
+    // this object.
+
+    int& groupCommitMaxBytes();
+    // Return a reference to the modifiable "GroupCommitMaxBytes" attribute of
+    // this object.
+
+    bool& hugePages();
+    // Return a reference to the modifiable "HugePages" attribute of this
+    // object.
+
+    int& recoveryIndexIntervalSec();
+    // Return a reference to the modifiable "RecoveryIndexIntervalSec"
+    // attribute of this object.
+
+    int& compactionIntervalSec();
+    // Return a reference to the modifiable "CompactionIntervalSec" attribute
+    // of this object.
+
+    int& readAheadMaxBytes();
+    // Return a reference to the modifiable "ReadAheadMaxBytes" attribute of
+    // this object.
+
+    int& replicationBatchMaxBytes();
+    // Return a reference to the modifiable "ReplicationBatchMaxBytes"
+    // attribute of this object.
+
+    int& replicationBatchMaxLatencyUs();
+    // Return a reference to the modifiable "ReplicationBatchMaxLatencyUs"
+    // attribute of this object.
+
+    bsl::string& tierLocation();
+    // Return a reference to the modifiable "TierLocation" attribute of this
+    // object.
+
+    bsl::string& storageEngine();
+    // Return a reference to the modifiable "StorageEngine" attribute of this
+    // object.
+
+    bool& persistentMemory();
+    // Return a reference to the modifiable "PersistentMemory" attribute of
+    // this object.
+
+    bsl::string& spillLocation();
+    // Return a reference to the modifiable "SpillLocation" attribute of
+    // this object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -6004,6 +6381,56 @@ class PartitionConfig {
     const StorageSyncConfig& syncConfig() const;
     // Return a reference offering non-modifiable access to the
     // "SyncConfig" attribute of this object.
+
+    bool chainReplication() const;
+    // Return the value of the "ChainReplication" attribute of this object.
+
+    bool incrementalWriteBack() const;
+    // Return the value of the "IncrementalWriteBack" attribute of this
+    // object.
+
+    int groupCommitWindowUs() const;
+    // Return the value of the "GroupCommitWindowUs" attribute of this object.
+
+    int groupCommitMaxBytes() const;
+    // Return the value of the "GroupCommitMaxBytes" attribute of this object.
+
+    bool hugePages() const;
+    // Return the value of the "HugePages" attribute of this object.
+
+    int recoveryIndexIntervalSec() const;
+    // Return the value of the "RecoveryIndexIntervalSec" attribute of this
+    // object.
+
+    int compactionIntervalSec() const;
+    // Return the value of the "CompactionIntervalSec" attribute of this
+    // object.
+
+    int readAheadMaxBytes() const;
+    // Return the value of the "ReadAheadMaxBytes" attribute of this object.
+
+    int replicationBatchMaxBytes() const;
+    // Return the value of the "ReplicationBatchMaxBytes" attribute of this
+    // object.
+
+    int replicationBatchMaxLatencyUs() const;
+    // Return the value of the "ReplicationBatchMaxLatencyUs" attribute of this
+    // object.
+
+    const bsl::string& tierLocation() const;
+    // Return a reference offering non-modifiable access to the
+    // "TierLocation" attribute of this object.
+
+    const bsl::string& storageEngine() const;
+    // Return a reference offering non-modifiable access to the
+    // "StorageEngine" attribute of this object.
+
+    bool persistentMemory() const;
+    // Return the value of the "PersistentMemory" attribute of this object.
+
+    const bsl::string& spillLocation() const;
+    // Return a reference offering non-modifiable access to the
+    // "SpillLocation" attribute of this object.
 };
 
 // FREE OPERATORS
@@ -7151,6 +7578,8 @@ class AppConfig {
     // bmqconfConfig........: configuration for bmqconf plugins..............:
     // configuration for the plugins msgPropertiesSupport.: information about
     // if/how to advertise support for v2 message properties
+    // useTscTimer..........: whether to use the timestamp counter of the CPU
+    // as high resolution timer, if it is invariant on the host
 
     // INSTANCE DATA
     bsl::string         d_brokerInstanceName;
@@ -7169,6 +7598,7 @@ class AppConfig {
     int                 d_configVersion;
     int                 d_logsObserverMaxSize;
     bool                d_isRunningOnDev;
+    bool                d_useTscTimer;
 
   public:
     // TYPES
@@ -7188,10 +7618,11 @@ class AppConfig {
         ATTRIBUTE_ID_NETWORK_INTERFACES     = 12,
         ATTRIBUTE_ID_BMQCONF_CONFIG         = 13,
         ATTRIBUTE_ID_PLUGINS                = 14,
-        ATTRIBUTE_ID_MESSAGE_PROPERTIES_V2  = 15
+        ATTRIBUTE_ID_MESSAGE_PROPERTIES_V2  = 15,
+        ATTRIBUTE_ID_USE_TSC_TIMER          = 16
     };
 
-    enum { NUM_ATTRIBUTES = 16 };
+    enum { NUM_ATTRIBUTES = 17 };
 
     enum {
         ATTRIBUTE_INDEX_BROKER_INSTANCE_NAME   = 0,
@@ -7209,7 +7640,8 @@ class AppConfig {
         ATTRIBUTE_INDEX_NETWORK_INTERFACES     = 12,
         ATTRIBUTE_INDEX_BMQCONF_CONFIG         = 13,
         ATTRIBUTE_INDEX_PLUGINS                = 14,
-        ATTRIBUTE_INDEX_MESSAGE_PROPERTIES_V2  = 15
+        ATTRIBUTE_INDEX_MESSAGE_PROPERTIES_V2  = 15,
+        ATTRIBUTE_INDEX_USE_TSC_TIMER          = 16
     };
 
     // CONSTANTS
@@ -7217,6 +7649,8 @@ class AppConfig {
 
     static const char DEFAULT_INITIALIZER_LATENCY_MONITOR_DOMAIN[];
 
+    static const bool DEFAULT_INITIALIZER_USE_TSC_TIMER;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -7372,6 +7806,10 @@ class AppConfig {
     // Return a reference to the modifiable "MessagePropertiesV2" attribute
     // of this object.
 
+    bool& useTscTimer();
+    // Return a reference to the modifiable "UseTscTimer" attribute of this
+    // object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -7475,6 +7913,9 @@ class AppConfig {
     const MessagePropertiesV2& messagePropertiesV2() const;
     // Return a reference offering non-modifiable access to the
     // "MessagePropertiesV2" attribute of this object.
+
+    bool useTscTimer() const;
+    // Return the value of the "UseTscTimer" attribute of this object.
 };
 
 // FREE OPERATORS
@@ -8077,10 +8518,14 @@ class ClustersDefinition {
     // the current machine is considered to belong to (if any)
     // clusters...................: array of cluster definition
     // reversedClusterConnections.: cluster and associated remote connections
-    // that should be established
+    // that should be established myProxyClusters............: name of the
+    // proxy clusters (if any) the current machine should pro-actively create
+    // and connect to at startup, instead of on the first queue opened in one
+    // of their domains
 
     // INSTANCE DATA
     bsl::vector<bsl::string>               d_myReverseClusters;
+    bsl::vector<bsl::string>               d_myProxyClusters;
     bsl::vector<VirtualClusterInformation> d_myVirtualClusters;
     bsl::vector<ReversedClusterConnection> d_reversedClusterConnections;
     bsl::vector<ClusterProxyDefinition>    d_proxyClusters;
@@ -8093,17 +8538,19 @@ class ClustersDefinition {
         ATTRIBUTE_ID_MY_REVERSE_CLUSTERS          = 1,
         ATTRIBUTE_ID_MY_VIRTUAL_CLUSTERS          = 2,
         ATTRIBUTE_ID_PROXY_CLUSTERS               = 3,
-        ATTRIBUTE_ID_REVERSED_CLUSTER_CONNECTIONS = 4
+        ATTRIBUTE_ID_REVERSED_CLUSTER_CONNECTIONS = 4,
+        ATTRIBUTE_ID_MY_PROXY_CLUSTERS            = 5
     };
 
-    enum { NUM_ATTRIBUTES = 5 };
+    enum { NUM_ATTRIBUTES = 6 };
 
     enum {
         ATTRIBUTE_INDEX_MY_CLUSTERS                  = 0,
         ATTRIBUTE_INDEX_MY_REVERSE_CLUSTERS          = 1,
         ATTRIBUTE_INDEX_MY_VIRTUAL_CLUSTERS          = 2,
         ATTRIBUTE_INDEX_PROXY_CLUSTERS               = 3,
-        ATTRIBUTE_INDEX_REVERSED_CLUSTER_CONNECTIONS = 4
+        ATTRIBUTE_INDEX_REVERSED_CLUSTER_CONNECTIONS = 4,
+        ATTRIBUTE_INDEX_MY_PROXY_CLUSTERS            = 5
     };
 
     // CONSTANTS
@@ -8222,6 +8669,10 @@ class ClustersDefinition {
     // Return a reference to the modifiable "ReversedClusterConnections"
     // attribute of this object.
 
+    bsl::vector<bsl::string>& myProxyClusters();
+    // Return a reference to the modifiable "MyProxyClusters" attribute of
+    // this object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -8285,6 +8736,10 @@ class ClustersDefinition {
     reversedClusterConnections() const;
     // Return a reference offering non-modifiable access to the
     // "ReversedClusterConnections" attribute of this object.
+
+    const bsl::vector<bsl::string>& myProxyClusters() const;
+    // Return a reference offering non-modifiable access to the
+    // "MyProxyClusters" attribute of this object.
 };
 
 // FREE OPERATORS
@@ -10491,6 +10946,13 @@ int QueueOperationsConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_pendingPutsMaxBytes,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PENDING_PUTS_MAX_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -10562,6 +11024,11 @@ int QueueOperationsConfig::manipulateAttribute(t_MANIPULATOR& manipulator,
             &d_ackWindowSize,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ACK_WINDOW_SIZE]);
     }
+    case ATTRIBUTE_ID_PENDING_PUTS_MAX_BYTES: {
+        return manipulator(
+            &d_pendingPutsMaxBytes,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PENDING_PUTS_MAX_BYTES]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -10642,6 +11109,11 @@ inline int& QueueOperationsConfig::ackWindowSize()
     return d_ackWindowSize;
 }
 
+inline int& QueueOperationsConfig::pendingPutsMaxBytes()
+{
+    return d_pendingPutsMaxBytes;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int QueueOperationsConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -10724,6 +11196,13 @@ int QueueOperationsConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(
+        d_pendingPutsMaxBytes,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PENDING_PUTS_MAX_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -10790,6 +11269,11 @@ int QueueOperationsConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_ackWindowSize,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ACK_WINDOW_SIZE]);
     }
+    case ATTRIBUTE_ID_PENDING_PUTS_MAX_BYTES: {
+        return accessor(
+            d_pendingPutsMaxBytes,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PENDING_PUTS_MAX_BYTES]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -10870,6 +11354,11 @@ inline int QueueOperationsConfig::ackWindowSize() const
     return d_ackWindowSize;
 }
 
+inline int QueueOperationsConfig::pendingPutsMaxBytes() const
+{
+    return d_pendingPutsMaxBytes;
+}
+
 // --------------------
 // class ResolvedDomain
 // --------------------
@@ -11623,6 +12112,14 @@ int StorageSyncConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_partitionSyncMaxOutstandingRecords,
+        ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_PARTITION_SYNC_MAX_OUTSTANDING_RECORDS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -11680,6 +12177,12 @@ int StorageSyncConfig::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
             &d_partitionSyncEventSize,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PARTITION_SYNC_EVENT_SIZE]);
     }
+    case ATTRIBUTE_ID_PARTITION_SYNC_MAX_OUTSTANDING_RECORDS: {
+        return manipulator(
+            &d_partitionSyncMaxOutstandingRecords,
+            ATTRIBUTE_INFO_ARRAY
+                [ATTRIBUTE_INDEX_PARTITION_SYNC_MAX_OUTSTANDING_RECORDS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -11745,6 +12248,11 @@ inline int& StorageSyncConfig::partitionSyncEventSize()
     return d_partitionSyncEventSize;
 }
 
+inline int& StorageSyncConfig::partitionSyncMaxOutstandingRecords()
+{
+    return d_partitionSyncMaxOutstandingRecords;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int StorageSyncConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -11813,6 +12321,14 @@ int StorageSyncConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(
+        d_partitionSyncMaxOutstandingRecords,
+        ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_PARTITION_SYNC_MAX_OUTSTANDING_RECORDS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -11869,6 +12385,12 @@ int StorageSyncConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
             d_partitionSyncEventSize,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PARTITION_SYNC_EVENT_SIZE]);
     }
+    case ATTRIBUTE_ID_PARTITION_SYNC_MAX_OUTSTANDING_RECORDS: {
+        return accessor(
+            d_partitionSyncMaxOutstandingRecords,
+            ATTRIBUTE_INFO_ARRAY
+                [ATTRIBUTE_INDEX_PARTITION_SYNC_MAX_OUTSTANDING_RECORDS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -11934,6 +12456,11 @@ inline int StorageSyncConfig::partitionSyncEventSize() const
     return d_partitionSyncEventSize;
 }
 
+inline int StorageSyncConfig::partitionSyncMaxOutstandingRecords() const
+{
+    return d_partitionSyncMaxOutstandingRecords;
+}
+
 // ------------------
 // class SyslogConfig
 // ------------------
@@ -12305,6 +12832,52 @@ int TcpInterfaceConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_putRateLimit,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PUT_RATE_LIMIT]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_queuePutRateLimit,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUE_PUT_RATE_LIMIT]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_numListeners,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_LISTENERS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_zeroCopyThreshold,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_localSocketPath,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_LOCAL_SOCKET_PATH]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_pushBatchTargetSize,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PUSH_BATCH_TARGET_SIZE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_pushBatchMaxDelayUs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PUSH_BATCH_MAX_DELAY_US]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -12360,6 +12933,41 @@ int TcpInterfaceConfig::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
         return manipulator(&d_useNtf,
                            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_USE_NTF]);
     }
+    case ATTRIBUTE_ID_PUT_RATE_LIMIT: {
+        return manipulator(
+            &d_putRateLimit,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PUT_RATE_LIMIT]);
+    }
+    case ATTRIBUTE_ID_QUEUE_PUT_RATE_LIMIT: {
+        return manipulator(
+            &d_queuePutRateLimit,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUE_PUT_RATE_LIMIT]);
+    }
+    case ATTRIBUTE_ID_NUM_LISTENERS: {
+        return manipulator(
+            &d_numListeners,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_LISTENERS]);
+    }
+    case ATTRIBUTE_ID_ZERO_COPY_THRESHOLD: {
+        return manipulator(
+            &d_zeroCopyThreshold,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD]);
+    }
+    case ATTRIBUTE_ID_LOCAL_SOCKET_PATH: {
+        return manipulator(
+            &d_localSocketPath,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_LOCAL_SOCKET_PATH]);
+    }
+    case ATTRIBUTE_ID_PUSH_BATCH_TARGET_SIZE: {
+        return manipulator(
+            &d_pushBatchTargetSize,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PUSH_BATCH_TARGET_SIZE]);
+    }
+    case ATTRIBUTE_ID_PUSH_BATCH_MAX_DELAY_US: {
+        return manipulator(
+            &d_pushBatchMaxDelayUs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PUSH_BATCH_MAX_DELAY_US]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -12430,6 +13038,41 @@ inline bool& TcpInterfaceConfig::useNtf()
     return d_useNtf;
 }
 
+inline int& TcpInterfaceConfig::putRateLimit()
+{
+    return d_putRateLimit;
+}
+
+inline int& TcpInterfaceConfig::queuePutRateLimit()
+{
+    return d_queuePutRateLimit;
+}
+
+inline int& TcpInterfaceConfig::numListeners()
+{
+    return d_numListeners;
+}
+
+inline int& TcpInterfaceConfig::zeroCopyThreshold()
+{
+    return d_zeroCopyThreshold;
+}
+
+inline bsl::string& TcpInterfaceConfig::localSocketPath()
+{
+    return d_localSocketPath;
+}
+
+inline int& TcpInterfaceConfig::pushBatchTargetSize()
+{
+    return d_pushBatchTargetSize;
+}
+
+inline int& TcpInterfaceConfig::pushBatchMaxDelayUs()
+{
+    return d_pushBatchMaxDelayUs;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int TcpInterfaceConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -12494,12 +13137,56 @@ int TcpInterfaceConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
-    return 0;
-}
+    ret = accessor(d_putRateLimit,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PUT_RATE_LIMIT]);
+    if (ret) {
+        return ret;
+    }
 
-template <typename t_ACCESSOR>
-int TcpInterfaceConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
-{
+    ret = accessor(d_queuePutRateLimit,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUE_PUT_RATE_LIMIT]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_numListeners,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_LISTENERS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_zeroCopyThreshold,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_localSocketPath,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_LOCAL_SOCKET_PATH]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_pushBatchTargetSize,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PUSH_BATCH_TARGET_SIZE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_pushBatchMaxDelayUs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PUSH_BATCH_MAX_DELAY_US]);
+    if (ret) {
+        return ret;
+    }
+
+    return 0;
+}
+
+template <typename t_ACCESSOR>
+int TcpInterfaceConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
+{
     enum { NOT_FOUND = -1 };
 
     switch (id) {
@@ -12544,6 +13231,39 @@ int TcpInterfaceConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_useNtf,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_USE_NTF]);
     }
+    case ATTRIBUTE_ID_PUT_RATE_LIMIT: {
+        return accessor(d_putRateLimit,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PUT_RATE_LIMIT]);
+    }
+    case ATTRIBUTE_ID_QUEUE_PUT_RATE_LIMIT: {
+        return accessor(
+            d_queuePutRateLimit,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUE_PUT_RATE_LIMIT]);
+    }
+    case ATTRIBUTE_ID_NUM_LISTENERS: {
+        return accessor(d_numListeners,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_LISTENERS]);
+    }
+    case ATTRIBUTE_ID_ZERO_COPY_THRESHOLD: {
+        return accessor(
+            d_zeroCopyThreshold,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD]);
+    }
+    case ATTRIBUTE_ID_LOCAL_SOCKET_PATH: {
+        return accessor(
+            d_localSocketPath,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_LOCAL_SOCKET_PATH]);
+    }
+    case ATTRIBUTE_ID_PUSH_BATCH_TARGET_SIZE: {
+        return accessor(
+            d_pushBatchTargetSize,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PUSH_BATCH_TARGET_SIZE]);
+    }
+    case ATTRIBUTE_ID_PUSH_BATCH_MAX_DELAY_US: {
+        return accessor(
+            d_pushBatchMaxDelayUs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PUSH_BATCH_MAX_DELAY_US]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -12614,6 +13334,41 @@ inline bool TcpInterfaceConfig::useNtf() const
     return d_useNtf;
 }
 
+inline int TcpInterfaceConfig::putRateLimit() const
+{
+    return d_putRateLimit;
+}
+
+inline int TcpInterfaceConfig::queuePutRateLimit() const
+{
+    return d_queuePutRateLimit;
+}
+
+inline int TcpInterfaceConfig::numListeners() const
+{
+    return d_numListeners;
+}
+
+inline int TcpInterfaceConfig::zeroCopyThreshold() const
+{
+    return d_zeroCopyThreshold;
+}
+
+inline const bsl::string& TcpInterfaceConfig::localSocketPath() const
+{
+    return d_localSocketPath;
+}
+
+inline int TcpInterfaceConfig::pushBatchTargetSize() const
+{
+    return d_pushBatchTargetSize;
+}
+
+inline int TcpInterfaceConfig::pushBatchMaxDelayUs() const
+{
+    return d_pushBatchMaxDelayUs;
+}
+
 // -------------------------------
 // class VirtualClusterInformation
 // -------------------------------
@@ -12843,6 +13598,31 @@ int DispatcherProcessorConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_workStealingIntervalMs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WORK_STEALING_INTERVAL_MS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_numaNodes,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUMA_NODES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_firstCpu,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FIRST_CPU]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_maxBatchSize,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_BATCH_SIZE]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -12863,6 +13643,24 @@ int DispatcherProcessorConfig::manipulateAttribute(t_MANIPULATOR& manipulator,
             &d_processorConfig,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PROCESSOR_CONFIG]);
     }
+    case ATTRIBUTE_ID_WORK_STEALING_INTERVAL_MS: {
+        return manipulator(
+            &d_workStealingIntervalMs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WORK_STEALING_INTERVAL_MS]);
+    }
+    case ATTRIBUTE_ID_NUMA_NODES: {
+        return manipulator(&d_numaNodes,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUMA_NODES]);
+    }
+    case ATTRIBUTE_ID_FIRST_CPU: {
+        return manipulator(&d_firstCpu,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FIRST_CPU]);
+    }
+    case ATTRIBUTE_ID_MAX_BATCH_SIZE: {
+        return manipulator(
+            &d_maxBatchSize,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_BATCH_SIZE]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -12894,6 +13692,26 @@ DispatcherProcessorConfig::processorConfig()
     return d_processorConfig;
 }
 
+inline int& DispatcherProcessorConfig::workStealingIntervalMs()
+{
+    return d_workStealingIntervalMs;
+}
+
+inline int& DispatcherProcessorConfig::numaNodes()
+{
+    return d_numaNodes;
+}
+
+inline int& DispatcherProcessorConfig::firstCpu()
+{
+    return d_firstCpu;
+}
+
+inline int& DispatcherProcessorConfig::maxBatchSize()
+{
+    return d_maxBatchSize;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int DispatcherProcessorConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -12912,6 +13730,31 @@ int DispatcherProcessorConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(
+        d_workStealingIntervalMs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WORK_STEALING_INTERVAL_MS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_numaNodes,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUMA_NODES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_firstCpu,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FIRST_CPU]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_maxBatchSize,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_BATCH_SIZE]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -12931,6 +13774,23 @@ int DispatcherProcessorConfig::accessAttribute(t_ACCESSOR& accessor,
             d_processorConfig,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PROCESSOR_CONFIG]);
     }
+    case ATTRIBUTE_ID_WORK_STEALING_INTERVAL_MS: {
+        return accessor(
+            d_workStealingIntervalMs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WORK_STEALING_INTERVAL_MS]);
+    }
+    case ATTRIBUTE_ID_NUMA_NODES: {
+        return accessor(d_numaNodes,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUMA_NODES]);
+    }
+    case ATTRIBUTE_ID_FIRST_CPU: {
+        return accessor(d_firstCpu,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FIRST_CPU]);
+    }
+    case ATTRIBUTE_ID_MAX_BATCH_SIZE: {
+        return accessor(d_maxBatchSize,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_BATCH_SIZE]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -12962,6 +13822,26 @@ DispatcherProcessorConfig::processorConfig() const
     return d_processorConfig;
 }
 
+inline int DispatcherProcessorConfig::workStealingIntervalMs() const
+{
+    return d_workStealingIntervalMs;
+}
+
+inline int DispatcherProcessorConfig::numaNodes() const
+{
+    return d_numaNodes;
+}
+
+inline int DispatcherProcessorConfig::firstCpu() const
+{
+    return d_firstCpu;
+}
+
+inline int DispatcherProcessorConfig::maxBatchSize() const
+{
+    return d_maxBatchSize;
+}
+
 // -------------------
 // class LogController
 // -------------------
@@ -13569,6 +14449,99 @@ int PartitionConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_chainReplication,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CHAIN_REPLICATION]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_incrementalWriteBack,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_INCREMENTAL_WRITE_BACK]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_groupCommitWindowUs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_WINDOW_US]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_groupCommitMaxBytes,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_hugePages,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_HUGE_PAGES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_recoveryIndexIntervalSec,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_INDEX_INTERVAL_SEC]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_compactionIntervalSec,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPACTION_INTERVAL_SEC]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_readAheadMaxBytes,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_READ_AHEAD_MAX_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_replicationBatchMaxBytes,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLICATION_BATCH_MAX_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_replicationBatchMaxLatencyUs,
+        ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_REPLICATION_BATCH_MAX_LATENCY_US]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_tierLocation,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_TIER_LOCATION]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_storageEngine,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_STORAGE_ENGINE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_persistentMemory,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PERSISTENT_MEMORY]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_spillLocation,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SPILL_LOCATION]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -13630,6 +14603,76 @@ int PartitionConfig::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
         return manipulator(&d_syncConfig,
                            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_CONFIG]);
     }
+    case ATTRIBUTE_ID_CHAIN_REPLICATION: {
+        return manipulator(
+            &d_chainReplication,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CHAIN_REPLICATION]);
+    }
+    case ATTRIBUTE_ID_INCREMENTAL_WRITE_BACK: {
+        return manipulator(
+            &d_incrementalWriteBack,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_INCREMENTAL_WRITE_BACK]);
+    }
+    case ATTRIBUTE_ID_GROUP_COMMIT_WINDOW_US: {
+        return manipulator(
+            &d_groupCommitWindowUs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_WINDOW_US]);
+    }
+    case ATTRIBUTE_ID_GROUP_COMMIT_MAX_BYTES: {
+        return manipulator(
+            &d_groupCommitMaxBytes,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES]);
+    }
+    case ATTRIBUTE_ID_HUGE_PAGES: {
+        return manipulator(&d_hugePages,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_HUGE_PAGES]);
+    }
+    case ATTRIBUTE_ID_RECOVERY_INDEX_INTERVAL_SEC: {
+        return manipulator(
+            &d_recoveryIndexIntervalSec,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_INDEX_INTERVAL_SEC]);
+    }
+    case ATTRIBUTE_ID_COMPACTION_INTERVAL_SEC: {
+        return manipulator(
+            &d_compactionIntervalSec,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPACTION_INTERVAL_SEC]);
+    }
+    case ATTRIBUTE_ID_READ_AHEAD_MAX_BYTES: {
+        return manipulator(
+            &d_readAheadMaxBytes,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_READ_AHEAD_MAX_BYTES]);
+    }
+    case ATTRIBUTE_ID_REPLICATION_BATCH_MAX_BYTES: {
+        return manipulator(
+            &d_replicationBatchMaxBytes,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLICATION_BATCH_MAX_BYTES]);
+    }
+    case ATTRIBUTE_ID_REPLICATION_BATCH_MAX_LATENCY_US: {
+        return manipulator(
+            &d_replicationBatchMaxLatencyUs,
+            ATTRIBUTE_INFO_ARRAY
+                [ATTRIBUTE_INDEX_REPLICATION_BATCH_MAX_LATENCY_US]);
+    }
+    case ATTRIBUTE_ID_TIER_LOCATION: {
+        return manipulator(
+            &d_tierLocation,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_TIER_LOCATION]);
+    }
+    case ATTRIBUTE_ID_STORAGE_ENGINE: {
+        return manipulator(
+            &d_storageEngine,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_STORAGE_ENGINE]);
+    }
+    case ATTRIBUTE_ID_PERSISTENT_MEMORY: {
+        return manipulator(
+            &d_persistentMemory,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PERSISTENT_MEMORY]);
+    }
+    case ATTRIBUTE_ID_SPILL_LOCATION: {
+        return manipulator(
+            &d_spillLocation,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SPILL_LOCATION]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -13705,6 +14748,76 @@ inline StorageSyncConfig& PartitionConfig::syncConfig()
     return d_syncConfig;
 }
 
+inline bool& PartitionConfig::chainReplication()
+{
+    return d_chainReplication;
+}
+
+inline bool& PartitionConfig::incrementalWriteBack()
+{
+    return d_incrementalWriteBack;
+}
+
+inline int& PartitionConfig::groupCommitWindowUs()
+{
+    return d_groupCommitWindowUs;
+}
+
+inline int& PartitionConfig::groupCommitMaxBytes()
+{
+    return d_groupCommitMaxBytes;
+}
+
+inline bool& PartitionConfig::hugePages()
+{
+    return d_hugePages;
+}
+
+inline int& PartitionConfig::recoveryIndexIntervalSec()
+{
+    return d_recoveryIndexIntervalSec;
+}
+
+inline int& PartitionConfig::compactionIntervalSec()
+{
+    return d_compactionIntervalSec;
+}
+
+inline int& PartitionConfig::readAheadMaxBytes()
+{
+    return d_readAheadMaxBytes;
+}
+
+inline int& PartitionConfig::replicationBatchMaxBytes()
+{
+    return d_replicationBatchMaxBytes;
+}
+
+inline int& PartitionConfig::replicationBatchMaxLatencyUs()
+{
+    return d_replicationBatchMaxLatencyUs;
+}
+
+inline bsl::string& PartitionConfig::tierLocation()
+{
+    return d_tierLocation;
+}
+
+inline bsl::string& PartitionConfig::storageEngine()
+{
+    return d_storageEngine;
+}
+
+inline bool& PartitionConfig::persistentMemory()
+{
+    return d_persistentMemory;
+}
+
+inline bsl::string& PartitionConfig::spillLocation()
+{
+    return d_spillLocation;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int PartitionConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -13778,6 +14891,98 @@ int PartitionConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_chainReplication,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CHAIN_REPLICATION]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_incrementalWriteBack,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_INCREMENTAL_WRITE_BACK]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_groupCommitWindowUs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_WINDOW_US]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_groupCommitMaxBytes,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_hugePages,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_HUGE_PAGES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_recoveryIndexIntervalSec,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_INDEX_INTERVAL_SEC]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_compactionIntervalSec,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPACTION_INTERVAL_SEC]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_readAheadMaxBytes,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_READ_AHEAD_MAX_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_replicationBatchMaxBytes,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLICATION_BATCH_MAX_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_replicationBatchMaxLatencyUs,
+        ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_REPLICATION_BATCH_MAX_LATENCY_US]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_tierLocation,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_TIER_LOCATION]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_storageEngine,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_STORAGE_ENGINE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_persistentMemory,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PERSISTENT_MEMORY]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_spillLocation,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SPILL_LOCATION]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -13837,6 +15042,73 @@ int PartitionConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_syncConfig,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_CONFIG]);
     }
+    case ATTRIBUTE_ID_CHAIN_REPLICATION: {
+        return accessor(
+            d_chainReplication,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CHAIN_REPLICATION]);
+    }
+    case ATTRIBUTE_ID_INCREMENTAL_WRITE_BACK: {
+        return accessor(
+            d_incrementalWriteBack,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_INCREMENTAL_WRITE_BACK]);
+    }
+    case ATTRIBUTE_ID_GROUP_COMMIT_WINDOW_US: {
+        return accessor(
+            d_groupCommitWindowUs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_WINDOW_US]);
+    }
+    case ATTRIBUTE_ID_GROUP_COMMIT_MAX_BYTES: {
+        return accessor(
+            d_groupCommitMaxBytes,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES]);
+    }
+    case ATTRIBUTE_ID_HUGE_PAGES: {
+        return accessor(d_hugePages,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_HUGE_PAGES]);
+    }
+    case ATTRIBUTE_ID_RECOVERY_INDEX_INTERVAL_SEC: {
+        return accessor(
+            d_recoveryIndexIntervalSec,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_INDEX_INTERVAL_SEC]);
+    }
+    case ATTRIBUTE_ID_COMPACTION_INTERVAL_SEC: {
+        return accessor(
+            d_compactionIntervalSec,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPACTION_INTERVAL_SEC]);
+    }
+    case ATTRIBUTE_ID_READ_AHEAD_MAX_BYTES: {
+        return accessor(
+            d_readAheadMaxBytes,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_READ_AHEAD_MAX_BYTES]);
+    }
+    case ATTRIBUTE_ID_REPLICATION_BATCH_MAX_BYTES: {
+        return accessor(
+            d_replicationBatchMaxBytes,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLICATION_BATCH_MAX_BYTES]);
+    }
+    case ATTRIBUTE_ID_REPLICATION_BATCH_MAX_LATENCY_US: {
+        return accessor(
+            d_replicationBatchMaxLatencyUs,
+            ATTRIBUTE_INFO_ARRAY
+                [ATTRIBUTE_INDEX_REPLICATION_BATCH_MAX_LATENCY_US]);
+    }
+    case ATTRIBUTE_ID_TIER_LOCATION: {
+        return accessor(d_tierLocation,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_TIER_LOCATION]);
+    }
+    case ATTRIBUTE_ID_STORAGE_ENGINE: {
+        return accessor(d_storageEngine,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_STORAGE_ENGINE]);
+    }
+    case ATTRIBUTE_ID_PERSISTENT_MEMORY: {
+        return accessor(
+            d_persistentMemory,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PERSISTENT_MEMORY]);
+    }
+    case ATTRIBUTE_ID_SPILL_LOCATION: {
+        return accessor(d_spillLocation,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SPILL_LOCATION]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -13912,6 +15184,76 @@ inline const StorageSyncConfig& PartitionConfig::syncConfig() const
     return d_syncConfig;
 }
 
+inline bool PartitionConfig::chainReplication() const
+{
+    return d_chainReplication;
+}
+
+inline bool PartitionConfig::incrementalWriteBack() const
+{
+    return d_incrementalWriteBack;
+}
+
+inline int PartitionConfig::groupCommitWindowUs() const
+{
+    return d_groupCommitWindowUs;
+}
+
+inline int PartitionConfig::groupCommitMaxBytes() const
+{
+    return d_groupCommitMaxBytes;
+}
+
+inline bool PartitionConfig::hugePages() const
+{
+    return d_hugePages;
+}
+
+inline int PartitionConfig::recoveryIndexIntervalSec() const
+{
+    return d_recoveryIndexIntervalSec;
+}
+
+inline int PartitionConfig::compactionIntervalSec() const
+{
+    return d_compactionIntervalSec;
+}
+
+inline int PartitionConfig::readAheadMaxBytes() const
+{
+    return d_readAheadMaxBytes;
+}
+
+inline int PartitionConfig::replicationBatchMaxBytes() const
+{
+    return d_replicationBatchMaxBytes;
+}
+
+inline int PartitionConfig::replicationBatchMaxLatencyUs() const
+{
+    return d_replicationBatchMaxLatencyUs;
+}
+
+inline const bsl::string& PartitionConfig::tierLocation() const
+{
+    return d_tierLocation;
+}
+
+inline const bsl::string& PartitionConfig::storageEngine() const
+{
+    return d_storageEngine;
+}
+
+inline bool PartitionConfig::persistentMemory() const
+{
+    return d_persistentMemory;
+}
+
+inline const bsl::string& PartitionConfig::spillLocation() const
+{
+    return d_spillLocation;
+}
+
 // -----------------
 // class StatsConfig
 // -----------------
@@ -14842,6 +16184,12 @@ int AppConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_useTscTimer,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_USE_TSC_TIMER]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -14926,6 +16274,11 @@ int AppConfig::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
             &d_messagePropertiesV2,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MESSAGE_PROPERTIES_V2]);
     }
+    case ATTRIBUTE_ID_USE_TSC_TIMER: {
+        return manipulator(
+            &d_useTscTimer,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_USE_TSC_TIMER]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -15026,6 +16379,11 @@ inline MessagePropertiesV2& AppConfig::messagePropertiesV2()
     return d_messagePropertiesV2;
 }
 
+inline bool& AppConfig::useTscTimer()
+{
+    return d_useTscTimer;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int AppConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -15128,6 +16486,12 @@ int AppConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_useTscTimer,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_USE_TSC_TIMER]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -15208,6 +16572,10 @@ int AppConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
             d_messagePropertiesV2,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MESSAGE_PROPERTIES_V2]);
     }
+    case ATTRIBUTE_ID_USE_TSC_TIMER: {
+        return accessor(d_useTscTimer,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_USE_TSC_TIMER]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -15308,6 +16676,11 @@ inline const MessagePropertiesV2& AppConfig::messagePropertiesV2() const
     return d_messagePropertiesV2;
 }
 
+inline bool AppConfig::useTscTimer() const
+{
+    return d_useTscTimer;
+}
+
 // -----------------------
 // class ClusterDefinition
 // -----------------------
@@ -15943,6 +17316,12 @@ int ClustersDefinition::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_myProxyClusters,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MY_PROXY_CLUSTERS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -15976,6 +17355,11 @@ int ClustersDefinition::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
                            ATTRIBUTE_INFO_ARRAY
                                [ATTRIBUTE_INDEX_REVERSED_CLUSTER_CONNECTIONS]);
     }
+    case ATTRIBUTE_ID_MY_PROXY_CLUSTERS: {
+        return manipulator(
+            &d_myProxyClusters,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MY_PROXY_CLUSTERS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -16023,6 +17407,11 @@ ClustersDefinition::reversedClusterConnections()
     return d_reversedClusterConnections;
 }
 
+inline bsl::vector<bsl::string>& ClustersDefinition::myProxyClusters()
+{
+    return d_myProxyClusters;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int ClustersDefinition::accessAttributes(t_ACCESSOR& accessor) const
@@ -16060,6 +17449,12 @@ int ClustersDefinition::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_myProxyClusters,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MY_PROXY_CLUSTERS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -16092,6 +17487,11 @@ int ClustersDefinition::accessAttribute(t_ACCESSOR& accessor, int id) const
                         ATTRIBUTE_INFO_ARRAY
                             [ATTRIBUTE_INDEX_REVERSED_CLUSTER_CONNECTIONS]);
     }
+    case ATTRIBUTE_ID_MY_PROXY_CLUSTERS: {
+        return accessor(
+            d_myProxyClusters,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MY_PROXY_CLUSTERS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -16142,6 +17542,12 @@ ClustersDefinition::reversedClusterConnections() const
     return d_reversedClusterConnections;
 }
 
+inline const bsl::vector<bsl::string>&
+ClustersDefinition::myProxyClusters() const
+{
+    return d_myProxyClusters;
+}
+
 // -------------------
 // class Configuration
 // -------------------
@@ -16603,7 +18009,8 @@ inline bool mqbcfg::operator==(const mqbcfg::QueueOperationsConfig& lhs,
                rhs.consumptionMonitorPeriodMs() &&
            lhs.stopTimeoutMs() == rhs.stopTimeoutMs() &&
            lhs.shutdownTimeoutMs() == rhs.shutdownTimeoutMs() &&
-           lhs.ackWindowSize() == rhs.ackWindowSize();
+           lhs.ackWindowSize() == rhs.ackWindowSize() &&
+           lhs.pendingPutsMaxBytes() == rhs.pendingPutsMaxBytes();
 }
 
 inline bool mqbcfg::operator!=(const mqbcfg::QueueOperationsConfig& lhs,
@@ -16636,6 +18043,7 @@ void mqbcfg::hashAppend(t_HASH_ALGORITHM&                    hashAlg,
     hashAppend(hashAlg, object.stopTimeoutMs());
     hashAppend(hashAlg, object.shutdownTimeoutMs());
     hashAppend(hashAlg, object.ackWindowSize());
+    hashAppend(hashAlg, object.pendingPutsMaxBytes());
 }
 
 inline bool mqbcfg::operator==(const mqbcfg::ResolvedDomain& lhs,
@@ -16751,7 +18159,9 @@ inline bool mqbcfg::operator==(const mqbcfg::StorageSyncConfig& lhs,
                rhs.partitionSyncDataReqTimeoutMs() &&
            lhs.startupWaitDurationMs() == rhs.startupWaitDurationMs() &&
            lhs.fileChunkSize() == rhs.fileChunkSize() &&
-           lhs.partitionSyncEventSize() == rhs.partitionSyncEventSize();
+           lhs.partitionSyncEventSize() == rhs.partitionSyncEventSize() &&
+           lhs.partitionSyncMaxOutstandingRecords() ==
+               rhs.partitionSyncMaxOutstandingRecords();
 }
 
 inline bool mqbcfg::operator!=(const mqbcfg::StorageSyncConfig& lhs,
@@ -16780,6 +18190,7 @@ void mqbcfg::hashAppend(t_HASH_ALGORITHM&                hashAlg,
     hashAppend(hashAlg, object.startupWaitDurationMs());
     hashAppend(hashAlg, object.fileChunkSize());
     hashAppend(hashAlg, object.partitionSyncEventSize());
+    hashAppend(hashAlg, object.partitionSyncMaxOutstandingRecords());
 }
 
 inline bool mqbcfg::operator==(const mqbcfg::SyslogConfig& lhs,
@@ -16851,7 +18262,14 @@ inline bool mqbcfg::operator==(const mqbcfg::TcpInterfaceConfig& lhs,
            lhs.nodeLowWatermark() == rhs.nodeLowWatermark() &&
            lhs.nodeHighWatermark() == rhs.nodeHighWatermark() &&
            lhs.heartbeatIntervalMs() == rhs.heartbeatIntervalMs() &&
-           lhs.useNtf() == rhs.useNtf();
+           lhs.useNtf() == rhs.useNtf() &&
+           lhs.putRateLimit() == rhs.putRateLimit() &&
+           lhs.queuePutRateLimit() == rhs.queuePutRateLimit() &&
+           lhs.numListeners() == rhs.numListeners() &&
+           lhs.zeroCopyThreshold() == rhs.zeroCopyThreshold() &&
+           lhs.localSocketPath() == rhs.localSocketPath() &&
+           lhs.pushBatchTargetSize() == rhs.pushBatchTargetSize() &&
+           lhs.pushBatchMaxDelayUs() == rhs.pushBatchMaxDelayUs();
 }
 
 inline bool mqbcfg::operator!=(const mqbcfg::TcpInterfaceConfig& lhs,
@@ -16881,6 +18299,13 @@ void mqbcfg::hashAppend(t_HASH_ALGORITHM&                 hashAlg,
     hashAppend(hashAlg, object.nodeHighWatermark());
     hashAppend(hashAlg, object.heartbeatIntervalMs());
     hashAppend(hashAlg, object.useNtf());
+    hashAppend(hashAlg, object.putRateLimit());
+    hashAppend(hashAlg, object.queuePutRateLimit());
+    hashAppend(hashAlg, object.numListeners());
+    hashAppend(hashAlg, object.zeroCopyThreshold());
+    hashAppend(hashAlg, object.localSocketPath());
+    hashAppend(hashAlg, object.pushBatchTargetSize());
+    hashAppend(hashAlg, object.pushBatchMaxDelayUs());
 }
 
 inline bool mqbcfg::operator==(const mqbcfg::VirtualClusterInformation& lhs,
@@ -16959,7 +18384,11 @@ inline bool mqbcfg::operator==(const mqbcfg::DispatcherProcessorConfig& lhs,
                                const mqbcfg::DispatcherProcessorConfig& rhs)
 {
     return lhs.numProcessors() == rhs.numProcessors() &&
-           lhs.processorConfig() == rhs.processorConfig();
+           lhs.processorConfig() == rhs.processorConfig() &&
+           lhs.workStealingIntervalMs() == rhs.workStealingIntervalMs() &&
+           lhs.numaNodes() == rhs.numaNodes() &&
+           lhs.firstCpu() == rhs.firstCpu() &&
+           lhs.maxBatchSize() == rhs.maxBatchSize();
 }
 
 inline bool mqbcfg::operator!=(const mqbcfg::DispatcherProcessorConfig& lhs,
@@ -16982,6 +18411,10 @@ void mqbcfg::hashAppend(t_HASH_ALGORITHM&                        hashAlg,
     using bslh::hashAppend;
     hashAppend(hashAlg, object.numProcessors());
     hashAppend(hashAlg, object.processorConfig());
+    hashAppend(hashAlg, object.workStealingIntervalMs());
+    hashAppend(hashAlg, object.numaNodes());
+    hashAppend(hashAlg, object.firstCpu());
+    hashAppend(hashAlg, object.maxBatchSize());
 }
 
 inline bool mqbcfg::operator==(const mqbcfg::LogController& lhs,
@@ -17069,7 +18502,22 @@ inline bool mqbcfg::operator==(const mqbcfg::PartitionConfig& lhs,
            lhs.maxArchivedFileSets() == rhs.maxArchivedFileSets() &&
            lhs.prefaultPages() == rhs.prefaultPages() &&
            lhs.flushAtShutdown() == rhs.flushAtShutdown() &&
-           lhs.syncConfig() == rhs.syncConfig();
+           lhs.syncConfig() == rhs.syncConfig() &&
+           lhs.chainReplication() == rhs.chainReplication() &&
+           lhs.incrementalWriteBack() == rhs.incrementalWriteBack() &&
+           lhs.groupCommitWindowUs() == rhs.groupCommitWindowUs() &&
+           lhs.groupCommitMaxBytes() == rhs.groupCommitMaxBytes() &&
+           lhs.hugePages() == rhs.hugePages() &&
+           lhs.recoveryIndexIntervalSec() == rhs.recoveryIndexIntervalSec() &&
+           lhs.compactionIntervalSec() == rhs.compactionIntervalSec() &&
+           lhs.readAheadMaxBytes() == rhs.readAheadMaxBytes() &&
+           lhs.replicationBatchMaxBytes() == rhs.replicationBatchMaxBytes() &&
+           lhs.replicationBatchMaxLatencyUs() ==
+               rhs.replicationBatchMaxLatencyUs() &&
+           lhs.tierLocation() == rhs.tierLocation() &&
+           lhs.storageEngine() == rhs.storageEngine() &&
+           lhs.persistentMemory() == rhs.persistentMemory() &&
+           lhs.spillLocation() == rhs.spillLocation();
 }
 
 inline bool mqbcfg::operator!=(const mqbcfg::PartitionConfig& lhs,
@@ -17100,6 +18548,20 @@ void mqbcfg::hashAppend(t_HASH_ALGORITHM&              hashAlg,
     hashAppend(hashAlg, object.prefaultPages());
     hashAppend(hashAlg, object.flushAtShutdown());
     hashAppend(hashAlg, object.syncConfig());
+    hashAppend(hashAlg, object.chainReplication());
+    hashAppend(hashAlg, object.incrementalWriteBack());
+    hashAppend(hashAlg, object.groupCommitWindowUs());
+    hashAppend(hashAlg, object.groupCommitMaxBytes());
+    hashAppend(hashAlg, object.hugePages());
+    hashAppend(hashAlg, object.recoveryIndexIntervalSec());
+    hashAppend(hashAlg, object.compactionIntervalSec());
+    hashAppend(hashAlg, object.readAheadMaxBytes());
+    hashAppend(hashAlg, object.replicationBatchMaxBytes());
+    hashAppend(hashAlg, object.replicationBatchMaxLatencyUs());
+    hashAppend(hashAlg, object.tierLocation());
+    hashAppend(hashAlg, object.storageEngine());
+    hashAppend(hashAlg, object.persistentMemory());
+    hashAppend(hashAlg, object.spillLocation());
 }
 
 inline bool mqbcfg::operator==(const mqbcfg::StatsConfig& lhs,
@@ -17266,7 +18728,8 @@ inline bool mqbcfg::operator==(const mqbcfg::AppConfig& lhs,
            lhs.networkInterfaces() == rhs.networkInterfaces() &&
            lhs.bmqconfConfig() == rhs.bmqconfConfig() &&
            lhs.plugins() == rhs.plugins() &&
-           lhs.messagePropertiesV2() == rhs.messagePropertiesV2();
+           lhs.messagePropertiesV2() == rhs.messagePropertiesV2() &&
+           lhs.useTscTimer() == rhs.useTscTimer();
 }
 
 inline bool mqbcfg::operator!=(const mqbcfg::AppConfig& lhs,
@@ -17302,6 +18765,7 @@ void mqbcfg::hashAppend(t_HASH_ALGORITHM&        hashAlg,
     hashAppend(hashAlg, object.bmqconfConfig());
     hashAppend(hashAlg, object.plugins());
     hashAppend(hashAlg, object.messagePropertiesV2());
+    hashAppend(hashAlg, object.useTscTimer());
 }
 
 inline bool mqbcfg::operator==(const mqbcfg::ClusterDefinition& lhs,
@@ -17387,7 +18851,8 @@ inline bool mqbcfg::operator==(const mqbcfg::ClustersDefinition& lhs,
            lhs.myVirtualClusters() == rhs.myVirtualClusters() &&
            lhs.proxyClusters() == rhs.proxyClusters() &&
            lhs.reversedClusterConnections() ==
-               rhs.reversedClusterConnections();
+               rhs.reversedClusterConnections() &&
+           lhs.myProxyClusters() == rhs.myProxyClusters();
 }
 
 inline bool mqbcfg::operator!=(const mqbcfg::ClustersDefinition& lhs,
@@ -17412,6 +18877,7 @@ void mqbcfg::hashAppend(t_HASH_ALGORITHM&                 hashAlg,
     hashAppend(hashAlg, object.myVirtualClusters());
     hashAppend(hashAlg, object.proxyClusters());
     hashAppend(hashAlg, object.reversedClusterConnections());
+    hashAppend(hashAlg, object.myProxyClusters());
 }
 
 inline bool mqbcfg::operator==(const mqbcfg::Configuration& lhs,
@@ -0,0 +1,170 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbcfg_messages.t.cpp                                              -*-C++-*-
+#include <mqbcfg_messages.h>
+
+// MWC
+#include <mwcu_memoutstream.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// BDE
+#include <baljsn_decoder.h>
+#include <baljsn_decoderoptions.h>
+#include <baljsn_encoder.h>
+#include <baljsn_encoderoptions.h>
+#include <bdlsb_fixedmeminstreambuf.h>
+#include <bslstl_stringref.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Decode the specified `json` into the specified `config`, the way the
+/// broker decodes its configuration, and return the result of the decoder.
+template <class CONFIG>
+int decode(CONFIG* config, const bslstl::StringRef& json)
+{
+    bdlsb::FixedMemInStreamBuf streamBuf(json.data(), json.length());
+    baljsn::Decoder            decoder(s_allocator_p);
+    baljsn::DecoderOptions     options;
+    options.setSkipUnknownElements(true);
+
+    const int rc = decoder.decode(&streamBuf, config, options);
+    PVV("decode rc: " << rc << ", error: " << decoder.loggedMessages());
+    return rc;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+TEST(tcpInterfaceConfig_numListenersDefault)
+// ------------------------------------------------------------------------
+// TCP INTERFACE CONFIG NUM LISTENERS DEFAULT
+//
+// Concerns:
+//   A TCP interface configuration not specifying 'numListeners' listens
+//   with a single socket, as before the setting was introduced.
+//
+// Testing:
+//   TcpInterfaceConfig::numListeners
+// ------------------------------------------------------------------------
+{
+    mqbcfg::TcpInterfaceConfig config(s_allocator_p);
+    ASSERT_EQ(1, config.numListeners());
+
+    config.numListeners() = 4;
+    ASSERT_EQ(0,
+              decode(&config,
+                     "{ \"name\": \"TCPInterface\", \"port\": 30114 }"));
+    ASSERT_EQ(1, config.numListeners());
+    ASSERT_EQ(30114, config.port());
+}
+
+TEST(tcpInterfaceConfig_numListenersRoundTrip)
+// ------------------------------------------------------------------------
+// TCP INTERFACE CONFIG NUM LISTENERS ROUND TRIP
+//
+// Concerns:
+//   1. 'numListeners' is decoded from the JSON configuration of the
+//      broker.
+//   2. A configuration encoded to JSON, e.g. when the broker dumps its
+//      configuration, decodes to the same configuration.
+//
+// Testing:
+//   TcpInterfaceConfig::numListeners
+//   TcpInterfaceConfig::operator==
+// ------------------------------------------------------------------------
+{
+    // 1. Decode
+    mqbcfg::TcpInterfaceConfig config(s_allocator_p);
+    ASSERT_EQ(0,
+              decode(&config,
+                     "{ \"name\": \"TCPInterface\", \"port\": 30114,"
+                     " \"numListeners\": 4 }"));
+    ASSERT_EQ(4, config.numListeners());
+
+    // 2. Round trip
+    mwcu::MemOutStream     os(s_allocator_p);
+    baljsn::Encoder        encoder(s_allocator_p);
+    baljsn::EncoderOptions options;
+    ASSERT_EQ(0, encoder.encode(os, config, options));
+
+    mqbcfg::TcpInterfaceConfig decoded(s_allocator_p);
+    ASSERT_EQ(0, decode(&decoded, os.str()));
+    ASSERT_EQ(4, decoded.numListeners());
+    ASSERT_EQ(config, decoded);
+}
+
+TEST(storageSyncConfig_partitionSyncMaxOutstandingRecords)
+// ------------------------------------------------------------------------
+// STORAGE SYNC CONFIG PARTITION SYNC MAX OUTSTANDING RECORDS
+//
+// Concerns:
+//   1. A storage sync configuration not specifying
+//      'partitionSyncMaxOutstandingRecords' uses the default budget.
+//   2. 'partitionSyncMaxOutstandingRecords' is decoded from the JSON
+//      configuration of the broker, and takes part in the comparison of
+//      configurations.
+//
+// Testing:
+//   StorageSyncConfig::partitionSyncMaxOutstandingRecords
+//   StorageSyncConfig::operator==
+// ------------------------------------------------------------------------
+{
+    // 1. Default
+    mqbcfg::StorageSyncConfig config;
+    ASSERT_EQ(256 * 1024, config.partitionSyncMaxOutstandingRecords());
+
+    config.partitionSyncMaxOutstandingRecords() = 1;
+    ASSERT_EQ(0, decode(&config, "{ \"fileChunkSize\": 1024 }"));
+    ASSERT_EQ(256 * 1024, config.partitionSyncMaxOutstandingRecords());
+    ASSERT_EQ(1024, config.fileChunkSize());
+
+    // 2. Decode
+    mqbcfg::StorageSyncConfig decoded;
+    ASSERT_EQ(0,
+              decode(&decoded,
+                     "{ \"fileChunkSize\": 1024,"
+                     " \"partitionSyncMaxOutstandingRecords\": 4096 }"));
+    ASSERT_EQ(4096, decoded.partitionSyncMaxOutstandingRecords());
+    ASSERT_NE(config, decoded);
+
+    decoded.partitionSyncMaxOutstandingRecords() =
+        config.partitionSyncMaxOutstandingRecords();
+    ASSERT_EQ(config, decoded);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    mwctst::runTest(_testCase);
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_GBL_ALLOC);
+}
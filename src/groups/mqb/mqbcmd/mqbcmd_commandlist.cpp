@@ -41,6 +41,14 @@ struct CommandDefinition {
     {"BROKERCONFIG DUMP",
      "Dump the broker's configuration",
      "Dump the broker's configuration"},
+    // Profile
+    {"PROFILE <seconds>",
+     "Profile the CPU usage of the broker's threads for 'seconds'",
+     "Sample the call stacks of the broker's threads consuming CPU during "
+     "'seconds', and dump them in the folded stacks format, one line per "
+     "distinct stack prefixed by the name of its thread, which can be "
+     "rendered as a flame graph.  Only supported on Linux, and only one "
+     "profile can be taken at a time"},
     // DomainManager
     {"DOMAINS DOMAIN <name> PURGE",
      "Purge all queues in domain 'name'",
@@ -100,9 +108,12 @@ struct CommandDefinition {
         "Show status of cluster 'name'",
         "Show status of cluster 'name'",
     },
-    {"CLUSTERS CLUSTER <name> QUEUEHELPER",
+    {"CLUSTERS CLUSTER <name> QUEUEHELPER [<uriFilter>] [<offset> <count>]",
      "Show queueHelper's internal state of cluster 'name'",
-     "Show queueHelper's internal state of cluster 'name'"},
+     "Show queueHelper's internal state of cluster 'name'.  Only the queues "
+     "whose URI contains 'uriFilter', if specified, are listed, and only "
+     "'count' of them (or all of them if 'count' is 0 or \"unlimited\"), "
+     "starting from the 'offset'-th matching queue."},
     {"CLUSTERS CLUSTER <name> FORCE_GC_QUEUES",
      "Force GC all queues matching GC criteria",
      "Force GC all queues matching GC criteria"},
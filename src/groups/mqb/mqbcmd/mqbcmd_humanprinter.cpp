@@ -1365,6 +1365,9 @@ bsl::ostream& HumanPrinter::print(bsl::ostream& os,
     else if (result.isStatsValue()) {
         os << result.stats();
     }
+    else if (result.isProfileValue()) {
+        os << result.profile();
+    }
     else if (result.isPurgedQueuesValue()) {
         printPurgedQueues(os, result.purgedQueues());
     }
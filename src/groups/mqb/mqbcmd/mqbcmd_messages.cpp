@@ -2688,6 +2688,149 @@ ListMessages::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     return stream;
 }
 
+// ----------------
+// class ListQueues
+// ----------------
+
+// CONSTANTS
+
+const char ListQueues::CLASS_NAME[] = "ListQueues";
+
+const bdlat_AttributeInfo ListQueues::ATTRIBUTE_INFO_ARRAY[] = {
+    {ATTRIBUTE_ID_URI_FILTER,
+     "uriFilter",
+     sizeof("uriFilter") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_OFFSET,
+     "offset",
+     sizeof("offset") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_COUNT,
+     "count",
+     sizeof("count") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC}};
+
+// CLASS METHODS
+
+const bdlat_AttributeInfo* ListQueues::lookupAttributeInfo(const char* name,
+                                                           int nameLength)
+{
+    for (int i = 0; i < 3; ++i) {
+        const bdlat_AttributeInfo& attributeInfo =
+            ListQueues::ATTRIBUTE_INFO_ARRAY[i];
+
+        if (nameLength == attributeInfo.d_nameLength &&
+            0 == bsl::memcmp(attributeInfo.d_name_p, name, nameLength)) {
+            return &attributeInfo;
+        }
+    }
+
+    return 0;
+}
+
+const bdlat_AttributeInfo* ListQueues::lookupAttributeInfo(int id)
+{
+    switch (id) {
+    case ATTRIBUTE_ID_URI_FILTER:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_URI_FILTER];
+    case ATTRIBUTE_ID_OFFSET:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_OFFSET];
+    case ATTRIBUTE_ID_COUNT:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COUNT];
+    default: return 0;
+    }
+}
+
+// CREATORS
+
+ListQueues::ListQueues(bslma::Allocator* basicAllocator)
+: d_uriFilter(basicAllocator)
+, d_offset()
+, d_count()
+{
+}
+
+ListQueues::ListQueues(const ListQueues& original,
+                       bslma::Allocator* basicAllocator)
+: d_uriFilter(original.d_uriFilter, basicAllocator)
+, d_offset(original.d_offset)
+, d_count(original.d_count)
+{
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+ListQueues::ListQueues(ListQueues&& original) noexcept
+: d_uriFilter(bsl::move(original.d_uriFilter)),
+  d_offset(bsl::move(original.d_offset)),
+  d_count(bsl::move(original.d_count))
+{
+}
+
+ListQueues::ListQueues(ListQueues&&      original,
+                       bslma::Allocator* basicAllocator)
+: d_uriFilter(bsl::move(original.d_uriFilter), basicAllocator)
+, d_offset(bsl::move(original.d_offset))
+, d_count(bsl::move(original.d_count))
+{
+}
+#endif
+
+ListQueues::~ListQueues()
+{
+}
+
+// MANIPULATORS
+
+ListQueues& ListQueues::operator=(const ListQueues& rhs)
+{
+    if (this != &rhs) {
+        d_uriFilter = rhs.d_uriFilter;
+        d_offset    = rhs.d_offset;
+        d_count     = rhs.d_count;
+    }
+
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+ListQueues& ListQueues::operator=(ListQueues&& rhs)
+{
+    if (this != &rhs) {
+        d_uriFilter = bsl::move(rhs.d_uriFilter);
+        d_offset    = bsl::move(rhs.d_offset);
+        d_count     = bsl::move(rhs.d_count);
+    }
+
+    return *this;
+}
+#endif
+
+void ListQueues::reset()
+{
+    bdlat_ValueTypeFunctions::reset(&d_uriFilter);
+    bdlat_ValueTypeFunctions::reset(&d_offset);
+    bdlat_ValueTypeFunctions::reset(&d_count);
+}
+
+// ACCESSORS
+
+bsl::ostream&
+ListQueues::print(bsl::ostream& stream, int level, int spacesPerLevel) const
+{
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("uriFilter", this->uriFilter());
+    printer.printAttribute("offset", this->offset());
+    printer.printAttribute("count", this->count());
+    printer.end();
+    return stream;
+}
+
 // --------------
 // class Locality
 // --------------
@@ -17877,7 +18020,8 @@ ClusterCommand::ClusterCommand(const ClusterCommand& original,
         new (d_status.buffer()) Void(original.d_status.object());
     } break;
     case SELECTION_ID_QUEUE_HELPER: {
-        new (d_queueHelper.buffer()) Void(original.d_queueHelper.object());
+        new (d_queueHelper.buffer())
+            ListQueues(original.d_queueHelper.object(), d_allocator_p);
     } break;
     case SELECTION_ID_FORCE_GC_QUEUES: {
         new (d_forceGcQueues.buffer()) Void(original.d_forceGcQueues.object());
@@ -17906,7 +18050,8 @@ ClusterCommand::ClusterCommand(ClusterCommand&& original) noexcept
     } break;
     case SELECTION_ID_QUEUE_HELPER: {
         new (d_queueHelper.buffer())
-            Void(bsl::move(original.d_queueHelper.object()));
+            ListQueues(bsl::move(original.d_queueHelper.object()),
+                       d_allocator_p);
     } break;
     case SELECTION_ID_FORCE_GC_QUEUES: {
         new (d_forceGcQueues.buffer())
@@ -17937,7 +18082,8 @@ ClusterCommand::ClusterCommand(ClusterCommand&&  original,
     } break;
     case SELECTION_ID_QUEUE_HELPER: {
         new (d_queueHelper.buffer())
-            Void(bsl::move(original.d_queueHelper.object()));
+            ListQueues(bsl::move(original.d_queueHelper.object()),
+                       d_allocator_p);
     } break;
     case SELECTION_ID_FORCE_GC_QUEUES: {
         new (d_forceGcQueues.buffer())
@@ -18026,7 +18172,7 @@ void ClusterCommand::reset()
         d_status.object().~Void();
     } break;
     case SELECTION_ID_QUEUE_HELPER: {
-        d_queueHelper.object().~Void();
+        d_queueHelper.object().~ListQueues();
     } break;
     case SELECTION_ID_FORCE_GC_QUEUES: {
         d_forceGcQueues.object().~Void();
@@ -18125,28 +18271,28 @@ Void& ClusterCommand::makeStatus(Void&& value)
 }
 #endif
 
-Void& ClusterCommand::makeQueueHelper()
+ListQueues& ClusterCommand::makeQueueHelper()
 {
     if (SELECTION_ID_QUEUE_HELPER == d_selectionId) {
         bdlat_ValueTypeFunctions::reset(&d_queueHelper.object());
     }
     else {
         reset();
-        new (d_queueHelper.buffer()) Void();
+        new (d_queueHelper.buffer()) ListQueues(d_allocator_p);
         d_selectionId = SELECTION_ID_QUEUE_HELPER;
     }
 
     return d_queueHelper.object();
 }
 
-Void& ClusterCommand::makeQueueHelper(const Void& value)
+ListQueues& ClusterCommand::makeQueueHelper(const ListQueues& value)
 {
     if (SELECTION_ID_QUEUE_HELPER == d_selectionId) {
         d_queueHelper.object() = value;
     }
     else {
         reset();
-        new (d_queueHelper.buffer()) Void(value);
+        new (d_queueHelper.buffer()) ListQueues(value, d_allocator_p);
         d_selectionId = SELECTION_ID_QUEUE_HELPER;
     }
 
@@ -18155,14 +18301,15 @@ Void& ClusterCommand::makeQueueHelper(const Void& value)
 
 #if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
     defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
-Void& ClusterCommand::makeQueueHelper(Void&& value)
+ListQueues& ClusterCommand::makeQueueHelper(ListQueues&& value)
 {
     if (SELECTION_ID_QUEUE_HELPER == d_selectionId) {
         d_queueHelper.object() = bsl::move(value);
     }
     else {
         reset();
-        new (d_queueHelper.buffer()) Void(bsl::move(value));
+        new (d_queueHelper.buffer())
+            ListQueues(bsl::move(value), d_allocator_p);
         d_selectionId = SELECTION_ID_QUEUE_HELPER;
     }
 
@@ -21958,14 +22105,19 @@ const bdlat_SelectionInfo Command::SELECTION_INFO_ARRAY[] = {
      "brokerConfig",
      sizeof("brokerConfig") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {SELECTION_ID_PROFILE,
+     "profile",
+     sizeof("profile") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC}};
 
 // CLASS METHODS
 
 const bdlat_SelectionInfo* Command::lookupSelectionInfo(const char* name,
                                                         int         nameLength)
 {
-    for (int i = 0; i < 7; ++i) {
+    for (int i = 0; i < 8; ++i) {
         const bdlat_SelectionInfo& selectionInfo =
             Command::SELECTION_INFO_ARRAY[i];
 
@@ -21993,6 +22145,8 @@ const bdlat_SelectionInfo* Command::lookupSelectionInfo(int id)
         return &SELECTION_INFO_ARRAY[SELECTION_INDEX_DANGER];
     case SELECTION_ID_BROKER_CONFIG:
         return &SELECTION_INFO_ARRAY[SELECTION_INDEX_BROKER_CONFIG];
+    case SELECTION_ID_PROFILE:
+        return &SELECTION_INFO_ARRAY[SELECTION_INDEX_PROFILE];
     default: return 0;
     }
 }
@@ -22031,6 +22185,9 @@ Command::Command(const Command& original, bslma::Allocator* basicAllocator)
         new (d_brokerConfig.buffer())
             BrokerConfigCommand(original.d_brokerConfig.object());
     } break;
+    case SELECTION_ID_PROFILE: {
+        new (d_profile.buffer()) int(original.d_profile.object());
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 }
@@ -22072,6 +22229,9 @@ Command::Command(Command&& original) noexcept
         new (d_brokerConfig.buffer())
             BrokerConfigCommand(bsl::move(original.d_brokerConfig.object()));
     } break;
+    case SELECTION_ID_PROFILE: {
+        new (d_profile.buffer()) int(bsl::move(original.d_profile.object()));
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 }
@@ -22111,6 +22271,9 @@ Command::Command(Command&& original, bslma::Allocator* basicAllocator)
         new (d_brokerConfig.buffer())
             BrokerConfigCommand(bsl::move(original.d_brokerConfig.object()));
     } break;
+    case SELECTION_ID_PROFILE: {
+        new (d_profile.buffer()) int(bsl::move(original.d_profile.object()));
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 }
@@ -22143,6 +22306,9 @@ Command& Command::operator=(const Command& rhs)
         case SELECTION_ID_BROKER_CONFIG: {
             makeBrokerConfig(rhs.d_brokerConfig.object());
         } break;
+        case SELECTION_ID_PROFILE: {
+            makeProfile(rhs.d_profile.object());
+        } break;
         default:
             BSLS_ASSERT(SELECTION_ID_UNDEFINED == rhs.d_selectionId);
             reset();
@@ -22179,6 +22345,9 @@ Command& Command::operator=(Command&& rhs)
         case SELECTION_ID_BROKER_CONFIG: {
             makeBrokerConfig(bsl::move(rhs.d_brokerConfig.object()));
         } break;
+        case SELECTION_ID_PROFILE: {
+            makeProfile(bsl::move(rhs.d_profile.object()));
+        } break;
         default:
             BSLS_ASSERT(SELECTION_ID_UNDEFINED == rhs.d_selectionId);
             reset();
@@ -22213,6 +22382,9 @@ void Command::reset()
     case SELECTION_ID_BROKER_CONFIG: {
         d_brokerConfig.object().~BrokerConfigCommand();
     } break;
+    case SELECTION_ID_PROFILE: {
+        // no destruction required
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 
@@ -22243,6 +22415,9 @@ int Command::makeSelection(int selectionId)
     case SELECTION_ID_BROKER_CONFIG: {
         makeBrokerConfig();
     } break;
+    case SELECTION_ID_PROFILE: {
+        makeProfile();
+    } break;
     case SELECTION_ID_UNDEFINED: {
         reset();
     } break;
@@ -22584,6 +22759,34 @@ BrokerConfigCommand& Command::makeBrokerConfig(BrokerConfigCommand&& value)
 }
 #endif
 
+int& Command::makeProfile()
+{
+    if (SELECTION_ID_PROFILE == d_selectionId) {
+        bdlat_ValueTypeFunctions::reset(&d_profile.object());
+    }
+    else {
+        reset();
+        new (d_profile.buffer()) int();
+        d_selectionId = SELECTION_ID_PROFILE;
+    }
+
+    return d_profile.object();
+}
+
+int& Command::makeProfile(int value)
+{
+    if (SELECTION_ID_PROFILE == d_selectionId) {
+        d_profile.object() = value;
+    }
+    else {
+        reset();
+        new (d_profile.buffer()) int(value);
+        d_selectionId = SELECTION_ID_PROFILE;
+    }
+
+    return d_profile.object();
+}
+
 // ACCESSORS
 
 bsl::ostream&
@@ -22613,6 +22816,9 @@ Command::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     case SELECTION_ID_BROKER_CONFIG: {
         printer.printAttribute("brokerConfig", d_brokerConfig.object());
     } break;
+    case SELECTION_ID_PROFILE: {
+        printer.printAttribute("profile", d_profile.object());
+    } break;
     default: stream << "SELECTION UNDEFINED\n";
     }
     printer.end();
@@ -22636,6 +22842,8 @@ const char* Command::selectionName() const
         return SELECTION_INFO_ARRAY[SELECTION_INDEX_DANGER].name();
     case SELECTION_ID_BROKER_CONFIG:
         return SELECTION_INFO_ARRAY[SELECTION_INDEX_BROKER_CONFIG].name();
+    case SELECTION_ID_PROFILE:
+        return SELECTION_INFO_ARRAY[SELECTION_INDEX_PROFILE].name();
     default:
         BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
         return "(* UNDEFINED *)";
@@ -24583,14 +24791,19 @@ const bdlat_SelectionInfo Result::SELECTION_INFO_ARRAY[] = {
      "brokerConfig",
      sizeof("brokerConfig") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {SELECTION_ID_PROFILE,
+     "profile",
+     sizeof("profile") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT}};
 
 // CLASS METHODS
 
 const bdlat_SelectionInfo* Result::lookupSelectionInfo(const char* name,
                                                        int         nameLength)
 {
-    for (int i = 0; i < 25; ++i) {
+    for (int i = 0; i < 26; ++i) {
         const bdlat_SelectionInfo& selectionInfo =
             Result::SELECTION_INFO_ARRAY[i];
 
@@ -24656,6 +24869,8 @@ const bdlat_SelectionInfo* Result::lookupSelectionInfo(int id)
             [SELECTION_INDEX_CLUSTER_DOMAIN_QUEUE_STATUSES];
     case SELECTION_ID_BROKER_CONFIG:
         return &SELECTION_INFO_ARRAY[SELECTION_INDEX_BROKER_CONFIG];
+    case SELECTION_ID_PROFILE:
+        return &SELECTION_INFO_ARRAY[SELECTION_INDEX_PROFILE];
     default: return 0;
     }
 }
@@ -24769,6 +24984,10 @@ Result::Result(const Result& original, bslma::Allocator* basicAllocator)
         new (d_brokerConfig.buffer())
             BrokerConfig(original.d_brokerConfig.object(), d_allocator_p);
     } break;
+    case SELECTION_ID_PROFILE: {
+        new (d_profile.buffer())
+            bsl::string(original.d_profile.object(), d_allocator_p);
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 }
@@ -24896,6 +25115,11 @@ Result::Result(Result&& original) noexcept
             BrokerConfig(bsl::move(original.d_brokerConfig.object()),
                          d_allocator_p);
     } break;
+    case SELECTION_ID_PROFILE: {
+        new (d_profile.buffer())
+            bsl::string(bsl::move(original.d_profile.object()),
+                        d_allocator_p);
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 }
@@ -25021,6 +25245,11 @@ Result::Result(Result&& original, bslma::Allocator* basicAllocator)
             BrokerConfig(bsl::move(original.d_brokerConfig.object()),
                          d_allocator_p);
     } break;
+    case SELECTION_ID_PROFILE: {
+        new (d_profile.buffer())
+            bsl::string(bsl::move(original.d_profile.object()),
+                        d_allocator_p);
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 }
@@ -25108,6 +25337,9 @@ Result& Result::operator=(const Result& rhs)
         case SELECTION_ID_BROKER_CONFIG: {
             makeBrokerConfig(rhs.d_brokerConfig.object());
         } break;
+        case SELECTION_ID_PROFILE: {
+            makeProfile(rhs.d_profile.object());
+        } break;
         default:
             BSLS_ASSERT(SELECTION_ID_UNDEFINED == rhs.d_selectionId);
             reset();
@@ -25204,6 +25436,9 @@ Result& Result::operator=(Result&& rhs)
         case SELECTION_ID_BROKER_CONFIG: {
             makeBrokerConfig(bsl::move(rhs.d_brokerConfig.object()));
         } break;
+        case SELECTION_ID_PROFILE: {
+            makeProfile(bsl::move(rhs.d_profile.object()));
+        } break;
         default:
             BSLS_ASSERT(SELECTION_ID_UNDEFINED == rhs.d_selectionId);
             reset();
@@ -25293,6 +25528,10 @@ void Result::reset()
     case SELECTION_ID_BROKER_CONFIG: {
         d_brokerConfig.object().~BrokerConfig();
     } break;
+    case SELECTION_ID_PROFILE: {
+        typedef bsl::string Type;
+        d_profile.object().~Type();
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 
@@ -25377,6 +25616,9 @@ int Result::makeSelection(int selectionId)
     case SELECTION_ID_BROKER_CONFIG: {
         makeBrokerConfig();
     } break;
+    case SELECTION_ID_PROFILE: {
+        makeProfile();
+    } break;
     case SELECTION_ID_UNDEFINED: {
         reset();
     } break;
@@ -26559,6 +26801,51 @@ BrokerConfig& Result::makeBrokerConfig(BrokerConfig&& value)
 }
 #endif
 
+bsl::string& Result::makeProfile()
+{
+    if (SELECTION_ID_PROFILE == d_selectionId) {
+        bdlat_ValueTypeFunctions::reset(&d_profile.object());
+    }
+    else {
+        reset();
+        new (d_profile.buffer()) bsl::string(d_allocator_p);
+        d_selectionId = SELECTION_ID_PROFILE;
+    }
+
+    return d_profile.object();
+}
+
+bsl::string& Result::makeProfile(const bsl::string& value)
+{
+    if (SELECTION_ID_PROFILE == d_selectionId) {
+        d_profile.object() = value;
+    }
+    else {
+        reset();
+        new (d_profile.buffer()) bsl::string(value, d_allocator_p);
+        d_selectionId = SELECTION_ID_PROFILE;
+    }
+
+    return d_profile.object();
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+bsl::string& Result::makeProfile(bsl::string&& value)
+{
+    if (SELECTION_ID_PROFILE == d_selectionId) {
+        d_profile.object() = bsl::move(value);
+    }
+    else {
+        reset();
+        new (d_profile.buffer()) bsl::string(bsl::move(value), d_allocator_p);
+        d_selectionId = SELECTION_ID_PROFILE;
+    }
+
+    return d_profile.object();
+}
+#endif
+
 // ACCESSORS
 
 bsl::ostream&
@@ -26648,6 +26935,9 @@ Result::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     case SELECTION_ID_BROKER_CONFIG: {
         printer.printAttribute("brokerConfig", d_brokerConfig.object());
     } break;
+    case SELECTION_ID_PROFILE: {
+        printer.printAttribute("profile", d_profile.object());
+    } break;
     default: stream << "SELECTION UNDEFINED\n";
     }
     printer.end();
@@ -26714,6 +27004,8 @@ const char* Result::selectionName() const
                 .name();
     case SELECTION_ID_BROKER_CONFIG:
         return SELECTION_INFO_ARRAY[SELECTION_INDEX_BROKER_CONFIG].name();
+    case SELECTION_ID_PROFILE:
+        return SELECTION_INFO_ARRAY[SELECTION_INDEX_PROFILE].name();
     default:
         BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
         return "(* UNDEFINED *)";
@@ -27748,14 +28040,19 @@ const bdlat_SelectionInfo InternalResult::SELECTION_INFO_ARRAY[] = {
      "brokerConfig",
      sizeof("brokerConfig") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {SELECTION_ID_PROFILE,
+     "profile",
+     sizeof("profile") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT}};
 
 // CLASS METHODS
 
 const bdlat_SelectionInfo*
 InternalResult::lookupSelectionInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 12; ++i) {
+    for (int i = 0; i < 13; ++i) {
         const bdlat_SelectionInfo& selectionInfo =
             InternalResult::SELECTION_INFO_ARRAY[i];
 
@@ -27795,6 +28092,8 @@ const bdlat_SelectionInfo* InternalResult::lookupSelectionInfo(int id)
             [SELECTION_INDEX_CLUSTER_DOMAIN_QUEUE_STATUSES];
     case SELECTION_ID_BROKER_CONFIG:
         return &SELECTION_INFO_ARRAY[SELECTION_INDEX_BROKER_CONFIG];
+    case SELECTION_ID_PROFILE:
+        return &SELECTION_INFO_ARRAY[SELECTION_INDEX_PROFILE];
     default: return 0;
     }
 }
@@ -27855,6 +28154,10 @@ InternalResult::InternalResult(const InternalResult& original,
         new (d_brokerConfig.buffer())
             BrokerConfig(original.d_brokerConfig.object(), d_allocator_p);
     } break;
+    case SELECTION_ID_PROFILE: {
+        new (d_profile.buffer())
+            bsl::string(original.d_profile.object(), d_allocator_p);
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 }
@@ -27922,6 +28225,11 @@ InternalResult::InternalResult(InternalResult&& original) noexcept
             BrokerConfig(bsl::move(original.d_brokerConfig.object()),
                          d_allocator_p);
     } break;
+    case SELECTION_ID_PROFILE: {
+        new (d_profile.buffer())
+            bsl::string(bsl::move(original.d_profile.object()),
+                        d_allocator_p);
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 }
@@ -27988,6 +28296,11 @@ InternalResult::InternalResult(InternalResult&&  original,
             BrokerConfig(bsl::move(original.d_brokerConfig.object()),
                          d_allocator_p);
     } break;
+    case SELECTION_ID_PROFILE: {
+        new (d_profile.buffer())
+            bsl::string(bsl::move(original.d_profile.object()),
+                        d_allocator_p);
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 }
@@ -28036,6 +28349,9 @@ InternalResult& InternalResult::operator=(const InternalResult& rhs)
         case SELECTION_ID_BROKER_CONFIG: {
             makeBrokerConfig(rhs.d_brokerConfig.object());
         } break;
+        case SELECTION_ID_PROFILE: {
+            makeProfile(rhs.d_profile.object());
+        } break;
         default:
             BSLS_ASSERT(SELECTION_ID_UNDEFINED == rhs.d_selectionId);
             reset();
@@ -28090,6 +28406,9 @@ InternalResult& InternalResult::operator=(InternalResult&& rhs)
         case SELECTION_ID_BROKER_CONFIG: {
             makeBrokerConfig(bsl::move(rhs.d_brokerConfig.object()));
         } break;
+        case SELECTION_ID_PROFILE: {
+            makeProfile(bsl::move(rhs.d_profile.object()));
+        } break;
         default:
             BSLS_ASSERT(SELECTION_ID_UNDEFINED == rhs.d_selectionId);
             reset();
@@ -28139,6 +28458,10 @@ void InternalResult::reset()
     case SELECTION_ID_BROKER_CONFIG: {
         d_brokerConfig.object().~BrokerConfig();
     } break;
+    case SELECTION_ID_PROFILE: {
+        typedef bsl::string Type;
+        d_profile.object().~Type();
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 
@@ -28184,6 +28507,9 @@ int InternalResult::makeSelection(int selectionId)
     case SELECTION_ID_BROKER_CONFIG: {
         makeBrokerConfig();
     } break;
+    case SELECTION_ID_PROFILE: {
+        makeProfile();
+    } break;
     case SELECTION_ID_UNDEFINED: {
         reset();
     } break;
@@ -28764,6 +29090,51 @@ BrokerConfig& InternalResult::makeBrokerConfig(BrokerConfig&& value)
 }
 #endif
 
+bsl::string& InternalResult::makeProfile()
+{
+    if (SELECTION_ID_PROFILE == d_selectionId) {
+        bdlat_ValueTypeFunctions::reset(&d_profile.object());
+    }
+    else {
+        reset();
+        new (d_profile.buffer()) bsl::string(d_allocator_p);
+        d_selectionId = SELECTION_ID_PROFILE;
+    }
+
+    return d_profile.object();
+}
+
+bsl::string& InternalResult::makeProfile(const bsl::string& value)
+{
+    if (SELECTION_ID_PROFILE == d_selectionId) {
+        d_profile.object() = value;
+    }
+    else {
+        reset();
+        new (d_profile.buffer()) bsl::string(value, d_allocator_p);
+        d_selectionId = SELECTION_ID_PROFILE;
+    }
+
+    return d_profile.object();
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+bsl::string& InternalResult::makeProfile(bsl::string&& value)
+{
+    if (SELECTION_ID_PROFILE == d_selectionId) {
+        d_profile.object() = bsl::move(value);
+    }
+    else {
+        reset();
+        new (d_profile.buffer()) bsl::string(bsl::move(value), d_allocator_p);
+        d_selectionId = SELECTION_ID_PROFILE;
+    }
+
+    return d_profile.object();
+}
+#endif
+
 // ACCESSORS
 
 bsl::ostream& InternalResult::print(bsl::ostream& stream,
@@ -28812,6 +29183,9 @@ bsl::ostream& InternalResult::print(bsl::ostream& stream,
     case SELECTION_ID_BROKER_CONFIG: {
         printer.printAttribute("brokerConfig", d_brokerConfig.object());
     } break;
+    case SELECTION_ID_PROFILE: {
+        printer.printAttribute("profile", d_profile.object());
+    } break;
     default: stream << "SELECTION UNDEFINED\n";
     }
     printer.end();
@@ -28849,6 +29223,8 @@ const char* InternalResult::selectionName() const
                 .name();
     case SELECTION_ID_BROKER_CONFIG:
         return SELECTION_INFO_ARRAY[SELECTION_INDEX_BROKER_CONFIG].name();
+    case SELECTION_ID_PROFILE:
+        return SELECTION_INFO_ARRAY[SELECTION_INDEX_PROFILE].name();
     default:
         BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
         return "(* UNDEFINED *)";
@@ -114,6 +114,7 @@ class LeastRecentlyUsedGroupId;
 }
 namespace mqbcmd {
 class ListMessages;
+class ListQueues;
 }
 namespace mqbcmd {
 class Message;
@@ -4301,6 +4302,230 @@ BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(mqbcmd::ListMessages)
 
 namespace mqbcmd {
 
+// ================
+// class ListQueues
+// ================
+
+class ListQueues {
+    // INSTANCE DATA
+    bdlb::NullableValue<bsl::string> d_uriFilter;
+    int                              d_offset;
+    int                              d_count;
+
+  public:
+    // TYPES
+    enum {
+        ATTRIBUTE_ID_URI_FILTER = 0,
+        ATTRIBUTE_ID_OFFSET     = 1,
+        ATTRIBUTE_ID_COUNT      = 2
+    };
+
+    enum { NUM_ATTRIBUTES = 3 };
+
+    enum {
+        ATTRIBUTE_INDEX_URI_FILTER = 0,
+        ATTRIBUTE_INDEX_OFFSET     = 1,
+        ATTRIBUTE_INDEX_COUNT      = 2
+    };
+
+    // CONSTANTS
+    static const char CLASS_NAME[];
+
+    static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+
+  public:
+    // CLASS METHODS
+
+    /// Return attribute information for the attribute indicated by the
+    /// specified `id` if the attribute exists, and 0 otherwise.
+    static const bdlat_AttributeInfo* lookupAttributeInfo(int id);
+
+    /// Return attribute information for the attribute indicated by the
+    /// specified `name` of the specified `nameLength` if the attribute
+    /// exists, and 0 otherwise.
+    static const bdlat_AttributeInfo* lookupAttributeInfo(const char* name,
+                                                          int nameLength);
+
+    // CREATORS
+
+    /// Create an object of type `ListQueues` having the default value.
+    /// Use the optionally specified `basicAllocator` to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.
+    explicit ListQueues(bslma::Allocator* basicAllocator = 0);
+
+    /// Create an object of type `ListQueues` having the value of the
+    /// specified `original` object.  Use the optionally specified
+    /// `basicAllocator` to supply memory.  If `basicAllocator` is 0, the
+    /// currently installed default allocator is used.
+    ListQueues(const ListQueues& original,
+               bslma::Allocator* basicAllocator = 0);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+    /// Create an object of type `ListQueues` having the value of the
+    /// specified `original` object.  After performing this action, the
+    /// `original` object will be left in a valid, but unspecified state.
+    ListQueues(ListQueues&& original) noexcept;
+
+    /// Create an object of type `ListQueues` having the value of the
+    /// specified `original` object.  After performing this action, the
+    /// `original` object will be left in a valid, but unspecified state.
+    /// Use the optionally specified `basicAllocator` to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.
+    ListQueues(ListQueues&& original, bslma::Allocator* basicAllocator);
+#endif
+
+    /// Destroy this object.
+    ~ListQueues();
+
+    // MANIPULATORS
+
+    /// Assign to this object the value of the specified `rhs` object.
+    ListQueues& operator=(const ListQueues& rhs);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+    /// Assign to this object the value of the specified `rhs` object.
+    /// After performing this action, the `rhs` object will be left in a
+    /// valid, but unspecified state.
+    ListQueues& operator=(ListQueues&& rhs);
+#endif
+
+    /// Reset this object to the default value (i.e., its value upon
+    /// default construction).
+    void reset();
+
+    /// Invoke the specified `manipulator` sequentially on the address of
+    /// each (modifiable) attribute of this object, supplying `manipulator`
+    /// with the corresponding attribute information structure until such
+    /// invocation returns a non-zero value.  Return the value from the
+    /// last invocation of `manipulator` (i.e., the invocation that
+    /// terminated the sequence).
+    template <class MANIPULATOR>
+    int manipulateAttributes(MANIPULATOR& manipulator);
+
+    /// Invoke the specified `manipulator` on the address of
+    /// the (modifiable) attribute indicated by the specified `id`,
+    /// supplying `manipulator` with the corresponding attribute
+    /// information structure.  Return the value returned from the
+    /// invocation of `manipulator` if `id` identifies an attribute of this
+    /// class, and -1 otherwise.
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR& manipulator, int id);
+
+    /// Invoke the specified `manipulator` on the address of
+    /// the (modifiable) attribute indicated by the specified `name` of the
+    /// specified `nameLength`, supplying `manipulator` with the
+    /// corresponding attribute information structure.  Return the value
+    /// returned from the invocation of `manipulator` if `name` identifies
+    /// an attribute of this class, and -1 otherwise.
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR& manipulator,
+                            const char*  name,
+                            int          nameLength);
+
+    /// Return a reference to the modifiable "UriFilter" attribute of this
+    /// object.
+    bdlb::NullableValue<bsl::string>& uriFilter();
+
+    /// Return a reference to the modifiable "Offset" attribute of this
+    /// object.
+    int& offset();
+
+    /// Return a reference to the modifiable "Count" attribute of this
+    /// object.
+    int& count();
+
+    // ACCESSORS
+
+    /// Format this object to the specified output `stream` at the
+    /// optionally specified indentation `level` and return a reference to
+    /// the modifiable `stream`.  If `level` is specified, optionally
+    /// specify `spacesPerLevel`, the number of spaces per indentation level
+    /// for this and all of its nested objects.  Each line is indented by
+    /// the absolute value of `level * spacesPerLevel`.  If `level` is
+    /// negative, suppress indentation of the first line.  If
+    /// `spacesPerLevel` is negative, suppress line breaks and format the
+    /// entire output on one line.  If `stream` is initially invalid, this
+    /// operation has no effect.  Note that a trailing newline is provided
+    /// in multiline mode only.
+    bsl::ostream&
+    print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
+
+    /// Invoke the specified `accessor` sequentially on each
+    /// (non-modifiable) attribute of this object, supplying `accessor`
+    /// with the corresponding attribute information structure until such
+    /// invocation returns a non-zero value.  Return the value from the
+    /// last invocation of `accessor` (i.e., the invocation that terminated
+    /// the sequence).
+    template <class ACCESSOR>
+    int accessAttributes(ACCESSOR& accessor) const;
+
+    /// Invoke the specified `accessor` on the (non-modifiable) attribute
+    /// of this object indicated by the specified `id`, supplying `accessor`
+    /// with the corresponding attribute information structure.  Return the
+    /// value returned from the invocation of `accessor` if `id` identifies
+    /// an attribute of this class, and -1 otherwise.
+    template <class ACCESSOR>
+    int accessAttribute(ACCESSOR& accessor, int id) const;
+
+    /// Invoke the specified `accessor` on the (non-modifiable) attribute
+    /// of this object indicated by the specified `name` of the specified
+    /// `nameLength`, supplying `accessor` with the corresponding attribute
+    /// information structure.  Return the value returned from the
+    /// invocation of `accessor` if `name` identifies an attribute of this
+    /// class, and -1 otherwise.
+    template <class ACCESSOR>
+    int accessAttribute(ACCESSOR&   accessor,
+                        const char* name,
+                        int         nameLength) const;
+
+    /// Return a reference to the non-modifiable "UriFilter" attribute of this
+    /// object.
+    const bdlb::NullableValue<bsl::string>& uriFilter() const;
+
+    /// Return a reference to the non-modifiable "Offset" attribute of this
+    /// object.
+    int offset() const;
+
+    /// Return a reference to the non-modifiable "Count" attribute of this
+    /// object.
+    int count() const;
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified `lhs` and `rhs` attribute objects have
+/// the same value, and `false` otherwise.  Two attribute objects have the
+/// same value if each respective attribute has the same value.
+inline bool operator==(const ListQueues& lhs, const ListQueues& rhs);
+
+/// Return `true` if the specified `lhs` and `rhs` attribute objects do not
+/// have the same value, and `false` otherwise.  Two attribute objects do
+/// not have the same value if one or more respective attributes differ in
+/// values.
+inline bool operator!=(const ListQueues& lhs, const ListQueues& rhs);
+
+/// Format the specified `rhs` to the specified output `stream` and
+/// return a reference to the modifiable `stream`.
+inline bsl::ostream& operator<<(bsl::ostream& stream, const ListQueues& rhs);
+
+/// Pass the specified `object` to the specified `hashAlg`.  This function
+/// integrates with the `bslh` modular hashing system and effectively
+/// provides a `bsl::hash` specialization for `ListQueues`.
+template <typename HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& hashAlg, const mqbcmd::ListQueues& object);
+
+}  // close package namespace
+
+// TRAITS
+
+BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(mqbcmd::ListQueues)
+
+namespace mqbcmd {
+
 // ==============
 // class Locality
 // ==============
@@ -20909,7 +21134,7 @@ class ClusterCommand {
     // INSTANCE DATA
     union {
         bsls::ObjectBuffer<Void>                d_status;
-        bsls::ObjectBuffer<Void>                d_queueHelper;
+        bsls::ObjectBuffer<ListQueues>          d_queueHelper;
         bsls::ObjectBuffer<Void>                d_forceGcQueues;
         bsls::ObjectBuffer<StorageCommand>      d_storage;
         bsls::ObjectBuffer<ClusterStateCommand> d_state;
@@ -21030,11 +21255,11 @@ class ClusterCommand {
     // specify the 'value' of the "Status".  If 'value' is not specified,
     // the default "Status" value is used.
 
-    Void& makeQueueHelper();
-    Void& makeQueueHelper(const Void& value);
+    ListQueues& makeQueueHelper();
+    ListQueues& makeQueueHelper(const ListQueues& value);
 #if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
     defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
-    Void& makeQueueHelper(Void&& value);
+    ListQueues& makeQueueHelper(ListQueues&& value);
 #endif
     // Set the value of this object to be a "QueueHelper" value.
     // Optionally specify the 'value' of the "QueueHelper".  If 'value' is
@@ -21086,7 +21311,7 @@ class ClusterCommand {
     /// Return a reference to the modifiable "QueueHelper" selection of this
     /// object if "QueueHelper" is the current selection.  The behavior is
     /// undefined unless "QueueHelper" is the selection of this object.
-    Void& queueHelper();
+    ListQueues& queueHelper();
 
     /// Return a reference to the modifiable "ForceGcQueues" selection of
     /// this object if "ForceGcQueues" is the current selection.  The
@@ -21139,7 +21364,7 @@ class ClusterCommand {
     /// Return a reference to the non-modifiable "QueueHelper" selection of
     /// this object if "QueueHelper" is the current selection.  The behavior
     /// is undefined unless "QueueHelper" is the selection of this object.
-    const Void& queueHelper() const;
+    const ListQueues& queueHelper() const;
 
     /// Return a reference to the non-modifiable "ForceGcQueues" selection
     /// of this object if "ForceGcQueues" is the current selection.  The
@@ -24156,6 +24381,7 @@ class Command {
         bsls::ObjectBuffer<ClustersCommand>       d_clusters;
         bsls::ObjectBuffer<DangerCommand>         d_danger;
         bsls::ObjectBuffer<BrokerConfigCommand>   d_brokerConfig;
+        bsls::ObjectBuffer<int>                   d_profile;
     };
 
     int               d_selectionId;
@@ -24172,10 +24398,11 @@ class Command {
         SELECTION_ID_STAT            = 3,
         SELECTION_ID_CLUSTERS        = 4,
         SELECTION_ID_DANGER          = 5,
-        SELECTION_ID_BROKER_CONFIG   = 6
+        SELECTION_ID_BROKER_CONFIG   = 6,
+        SELECTION_ID_PROFILE         = 7
     };
 
-    enum { NUM_SELECTIONS = 7 };
+    enum { NUM_SELECTIONS = 8 };
 
     enum {
         SELECTION_INDEX_HELP            = 0,
@@ -24184,7 +24411,8 @@ class Command {
         SELECTION_INDEX_STAT            = 3,
         SELECTION_INDEX_CLUSTERS        = 4,
         SELECTION_INDEX_DANGER          = 5,
-        SELECTION_INDEX_BROKER_CONFIG   = 6
+        SELECTION_INDEX_BROKER_CONFIG   = 6,
+        SELECTION_INDEX_PROFILE         = 7
     };
 
     // CONSTANTS
@@ -24336,6 +24564,12 @@ class Command {
     // Optionally specify the 'value' of the "BrokerConfig".  If 'value' is
     // not specified, the default "BrokerConfig" value is used.
 
+    /// Set the value of this object to be a "Profile" value.  Optionally
+    /// specify the `value` of the "Profile".  If `value` is not specified,
+    /// the default "Profile" value is used.
+    int& makeProfile();
+    int& makeProfile(int value);
+
     /// Invoke the specified `manipulator` on the address of the modifiable
     /// selection, supplying `manipulator` with the corresponding selection
     /// information structure.  Return the value returned from the
@@ -24381,6 +24615,11 @@ class Command {
     /// object.
     BrokerConfigCommand& brokerConfig();
 
+    /// Return a reference to the modifiable "Profile" selection of this
+    /// object if "Profile" is the current selection.  The behavior is
+    /// undefined unless "Profile" is the selection of this object.
+    int& profile();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -24445,6 +24684,11 @@ class Command {
     /// object.
     const BrokerConfigCommand& brokerConfig() const;
 
+    /// Return a reference to the non-modifiable "Profile" selection of this
+    /// object if "Profile" is the current selection.  The behavior is
+    /// undefined unless "Profile" is the selection of this object.
+    const int& profile() const;
+
     /// Return `true` if the value of this object is a "Help" value, and
     /// return `false` otherwise.
     bool isHelpValue() const;
@@ -24473,6 +24717,10 @@ class Command {
     /// and return `false` otherwise.
     bool isBrokerConfigValue() const;
 
+    /// Return `true` if the value of this object is a "Profile" value, and
+    /// return `false` otherwise.
+    bool isProfileValue() const;
+
     /// Return `true` if the value of this object is undefined, and `false`
     /// otherwise.
     bool isUndefinedValue() const;
@@ -26227,6 +26475,7 @@ class Result {
         bsls::ObjectBuffer<ClusterDomainQueueStatuses>
                                          d_clusterDomainQueueStatuses;
         bsls::ObjectBuffer<BrokerConfig> d_brokerConfig;
+        bsls::ObjectBuffer<bsl::string>  d_profile;
     };
 
     int               d_selectionId;
@@ -26261,10 +26510,11 @@ class Result {
         SELECTION_ID_STORAGE_CONTENT               = 21,
         SELECTION_ID_CLUSTER_STORAGE_SUMMARY       = 22,
         SELECTION_ID_CLUSTER_DOMAIN_QUEUE_STATUSES = 23,
-        SELECTION_ID_BROKER_CONFIG                 = 24
+        SELECTION_ID_BROKER_CONFIG                 = 24,
+        SELECTION_ID_PROFILE                       = 25
     };
 
-    enum { NUM_SELECTIONS = 25 };
+    enum { NUM_SELECTIONS = 26 };
 
     enum {
         SELECTION_INDEX_ERROR                         = 0,
@@ -26291,7 +26541,8 @@ class Result {
         SELECTION_INDEX_STORAGE_CONTENT               = 21,
         SELECTION_INDEX_CLUSTER_STORAGE_SUMMARY       = 22,
         SELECTION_INDEX_CLUSTER_DOMAIN_QUEUE_STATUSES = 23,
-        SELECTION_INDEX_BROKER_CONFIG                 = 24
+        SELECTION_INDEX_BROKER_CONFIG                 = 24,
+        SELECTION_INDEX_PROFILE                       = 25
     };
 
     // CONSTANTS
@@ -26637,6 +26888,16 @@ class Result {
     // Optionally specify the 'value' of the "BrokerConfig".  If 'value' is
     // not specified, the default "BrokerConfig" value is used.
 
+    bsl::string& makeProfile();
+    bsl::string& makeProfile(const bsl::string& value);
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+    bsl::string& makeProfile(bsl::string&& value);
+#endif
+    // Set the value of this object to be a "Profile" value.  Optionally
+    // specify the 'value' of the "Profile".  If 'value' is not specified,
+    // the default "Profile" value is used.
+
     /// Invoke the specified `manipulator` on the address of the modifiable
     /// selection, supplying `manipulator` with the corresponding selection
     /// information structure.  Return the value returned from the
@@ -26784,6 +27045,11 @@ class Result {
     /// object.
     BrokerConfig& brokerConfig();
 
+    /// Return a reference to the modifiable "Profile" selection of this
+    /// object if "Profile" is the current selection.  The behavior is
+    /// undefined unless "Profile" is the selection of this object.
+    bsl::string& profile();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -26951,6 +27217,11 @@ class Result {
     /// object.
     const BrokerConfig& brokerConfig() const;
 
+    /// Return a reference to the non-modifiable "Profile" selection of this
+    /// object if "Profile" is the current selection.  The behavior is
+    /// undefined unless "Profile" is the selection of this object.
+    const bsl::string& profile() const;
+
     /// Return `true` if the value of this object is a "Error" value, and
     /// return `false` otherwise.
     bool isErrorValue() const;
@@ -27051,6 +27322,10 @@ class Result {
     /// and return `false` otherwise.
     bool isBrokerConfigValue() const;
 
+    /// Return `true` if the value of this object is a "Profile" value, and
+    /// return `false` otherwise.
+    bool isProfileValue() const;
+
     /// Return `true` if the value of this object is undefined, and `false`
     /// otherwise.
     bool isUndefinedValue() const;
@@ -27682,6 +27957,7 @@ class InternalResult {
         bsls::ObjectBuffer<ClusterDomainQueueStatuses>
                                          d_clusterDomainQueueStatuses;
         bsls::ObjectBuffer<BrokerConfig> d_brokerConfig;
+        bsls::ObjectBuffer<bsl::string>  d_profile;
     };
 
     int               d_selectionId;
@@ -27703,10 +27979,11 @@ class InternalResult {
         SELECTION_ID_CLUSTER_QUEUE_HELPER          = 8,
         SELECTION_ID_CLUSTER_STORAGE_SUMMARY       = 9,
         SELECTION_ID_CLUSTER_DOMAIN_QUEUE_STATUSES = 10,
-        SELECTION_ID_BROKER_CONFIG                 = 11
+        SELECTION_ID_BROKER_CONFIG                 = 11,
+        SELECTION_ID_PROFILE                       = 12
     };
 
-    enum { NUM_SELECTIONS = 12 };
+    enum { NUM_SELECTIONS = 13 };
 
     enum {
         SELECTION_INDEX_ERROR                         = 0,
@@ -27720,7 +27997,8 @@ class InternalResult {
         SELECTION_INDEX_CLUSTER_QUEUE_HELPER          = 8,
         SELECTION_INDEX_CLUSTER_STORAGE_SUMMARY       = 9,
         SELECTION_INDEX_CLUSTER_DOMAIN_QUEUE_STATUSES = 10,
-        SELECTION_INDEX_BROKER_CONFIG                 = 11
+        SELECTION_INDEX_BROKER_CONFIG                 = 11,
+        SELECTION_INDEX_PROFILE                       = 12
     };
 
     // CONSTANTS
@@ -27931,6 +28209,16 @@ class InternalResult {
     // Optionally specify the 'value' of the "BrokerConfig".  If 'value' is
     // not specified, the default "BrokerConfig" value is used.
 
+    bsl::string& makeProfile();
+    bsl::string& makeProfile(const bsl::string& value);
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+    bsl::string& makeProfile(bsl::string&& value);
+#endif
+    // Set the value of this object to be a "Profile" value.  Optionally
+    // specify the 'value' of the "Profile".  If 'value' is not specified,
+    // the default "Profile" value is used.
+
     /// Invoke the specified `manipulator` on the address of the modifiable
     /// selection, supplying `manipulator` with the corresponding selection
     /// information structure.  Return the value returned from the
@@ -28006,6 +28294,11 @@ class InternalResult {
     /// object.
     BrokerConfig& brokerConfig();
 
+    /// Return a reference to the modifiable "Profile" selection of this
+    /// object if "Profile" is the current selection.  The behavior is
+    /// undefined unless "Profile" is the selection of this object.
+    bsl::string& profile();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -28101,6 +28394,11 @@ class InternalResult {
     /// object.
     const BrokerConfig& brokerConfig() const;
 
+    /// Return a reference to the non-modifiable "Profile" selection of this
+    /// object if "Profile" is the current selection.  The behavior is
+    /// undefined unless "Profile" is the selection of this object.
+    const bsl::string& profile() const;
+
     /// Return `true` if the value of this object is a "Error" value, and
     /// return `false` otherwise.
     bool isErrorValue() const;
@@ -28149,6 +28447,10 @@ class InternalResult {
     /// and return `false` otherwise.
     bool isBrokerConfigValue() const;
 
+    /// Return `true` if the value of this object is a "Profile" value, and
+    /// return `false` otherwise.
+    bool isProfileValue() const;
+
     /// Return `true` if the value of this object is undefined, and `false`
     /// otherwise.
     bool isUndefinedValue() const;
@@ -31017,6 +31319,177 @@ void hashAppend(HASH_ALGORITHM& hashAlg, const mqbcmd::ListMessages& object)
     hashAppend(hashAlg, object.count());
 }
 
+// ----------------
+// class ListQueues
+// ----------------
+
+// CLASS METHODS
+// MANIPULATORS
+template <class MANIPULATOR>
+int ListQueues::manipulateAttributes(MANIPULATOR& manipulator)
+{
+    int ret;
+
+    ret = manipulator(&d_uriFilter,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_URI_FILTER]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_offset, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_OFFSET]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_count, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COUNT]);
+    if (ret) {
+        return ret;
+    }
+
+    return ret;
+}
+
+template <class MANIPULATOR>
+int ListQueues::manipulateAttribute(MANIPULATOR& manipulator, int id)
+{
+    enum { NOT_FOUND = -1 };
+
+    switch (id) {
+    case ATTRIBUTE_ID_URI_FILTER: {
+        return manipulator(&d_uriFilter,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_URI_FILTER]);
+    }
+    case ATTRIBUTE_ID_OFFSET: {
+        return manipulator(&d_offset,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_OFFSET]);
+    }
+    case ATTRIBUTE_ID_COUNT: {
+        return manipulator(&d_count,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COUNT]);
+    }
+    default: return NOT_FOUND;
+    }
+}
+
+template <class MANIPULATOR>
+int ListQueues::manipulateAttribute(MANIPULATOR& manipulator,
+                                    const char*  name,
+                                    int          nameLength)
+{
+    enum { NOT_FOUND = -1 };
+
+    const bdlat_AttributeInfo* attributeInfo = lookupAttributeInfo(name,
+                                                                   nameLength);
+    if (0 == attributeInfo) {
+        return NOT_FOUND;
+    }
+
+    return manipulateAttribute(manipulator, attributeInfo->d_id);
+}
+
+inline bdlb::NullableValue<bsl::string>& ListQueues::uriFilter()
+{
+    return d_uriFilter;
+}
+
+inline int& ListQueues::offset()
+{
+    return d_offset;
+}
+
+inline int& ListQueues::count()
+{
+    return d_count;
+}
+
+// ACCESSORS
+template <class ACCESSOR>
+int ListQueues::accessAttributes(ACCESSOR& accessor) const
+{
+    int ret;
+
+    ret = accessor(d_uriFilter,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_URI_FILTER]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_offset, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_OFFSET]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_count, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COUNT]);
+    if (ret) {
+        return ret;
+    }
+
+    return ret;
+}
+
+template <class ACCESSOR>
+int ListQueues::accessAttribute(ACCESSOR& accessor, int id) const
+{
+    enum { NOT_FOUND = -1 };
+
+    switch (id) {
+    case ATTRIBUTE_ID_URI_FILTER: {
+        return accessor(d_uriFilter,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_URI_FILTER]);
+    }
+    case ATTRIBUTE_ID_OFFSET: {
+        return accessor(d_offset,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_OFFSET]);
+    }
+    case ATTRIBUTE_ID_COUNT: {
+        return accessor(d_count, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COUNT]);
+    }
+    default: return NOT_FOUND;
+    }
+}
+
+template <class ACCESSOR>
+int ListQueues::accessAttribute(ACCESSOR&   accessor,
+                                const char* name,
+                                int         nameLength) const
+{
+    enum { NOT_FOUND = -1 };
+
+    const bdlat_AttributeInfo* attributeInfo = lookupAttributeInfo(name,
+                                                                   nameLength);
+    if (0 == attributeInfo) {
+        return NOT_FOUND;
+    }
+
+    return accessAttribute(accessor, attributeInfo->d_id);
+}
+
+inline const bdlb::NullableValue<bsl::string>& ListQueues::uriFilter() const
+{
+    return d_uriFilter;
+}
+
+inline int ListQueues::offset() const
+{
+    return d_offset;
+}
+
+inline int ListQueues::count() const
+{
+    return d_count;
+}
+
+template <typename HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& hashAlg, const mqbcmd::ListQueues& object)
+{
+    (void)hashAlg;
+    (void)object;
+    using bslh::hashAppend;
+    hashAppend(hashAlg, object.uriFilter());
+    hashAppend(hashAlg, object.offset());
+    hashAppend(hashAlg, object.count());
+}
+
 // --------------
 // class Locality
 // --------------
@@ -43345,7 +43818,7 @@ inline Void& ClusterCommand::status()
     return d_status.object();
 }
 
-inline Void& ClusterCommand::queueHelper()
+inline ListQueues& ClusterCommand::queueHelper()
 {
     BSLS_ASSERT(SELECTION_ID_QUEUE_HELPER == d_selectionId);
     return d_queueHelper.object();
@@ -43404,7 +43877,7 @@ inline const Void& ClusterCommand::status() const
     return d_status.object();
 }
 
-inline const Void& ClusterCommand::queueHelper() const
+inline const ListQueues& ClusterCommand::queueHelper() const
 {
     BSLS_ASSERT(SELECTION_ID_QUEUE_HELPER == d_selectionId);
     return d_queueHelper.object();
@@ -45655,6 +46128,9 @@ int Command::manipulateSelection(MANIPULATOR& manipulator)
         return manipulator(
             &d_brokerConfig.object(),
             SELECTION_INFO_ARRAY[SELECTION_INDEX_BROKER_CONFIG]);
+    case Command::SELECTION_ID_PROFILE:
+        return manipulator(&d_profile.object(),
+                           SELECTION_INFO_ARRAY[SELECTION_INDEX_PROFILE]);
     default:
         BSLS_ASSERT(Command::SELECTION_ID_UNDEFINED == d_selectionId);
         return -1;
@@ -45703,6 +46179,12 @@ inline BrokerConfigCommand& Command::brokerConfig()
     return d_brokerConfig.object();
 }
 
+inline int& Command::profile()
+{
+    BSLS_ASSERT(SELECTION_ID_PROFILE == d_selectionId);
+    return d_profile.object();
+}
+
 // ACCESSORS
 inline int Command::selectionId() const
 {
@@ -45734,6 +46216,9 @@ int Command::accessSelection(ACCESSOR& accessor) const
     case SELECTION_ID_BROKER_CONFIG:
         return accessor(d_brokerConfig.object(),
                         SELECTION_INFO_ARRAY[SELECTION_INDEX_BROKER_CONFIG]);
+    case SELECTION_ID_PROFILE:
+        return accessor(d_profile.object(),
+                        SELECTION_INFO_ARRAY[SELECTION_INDEX_PROFILE]);
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId); return -1;
     }
 }
@@ -45780,6 +46265,12 @@ inline const BrokerConfigCommand& Command::brokerConfig() const
     return d_brokerConfig.object();
 }
 
+inline const int& Command::profile() const
+{
+    BSLS_ASSERT(SELECTION_ID_PROFILE == d_selectionId);
+    return d_profile.object();
+}
+
 inline bool Command::isHelpValue() const
 {
     return SELECTION_ID_HELP == d_selectionId;
@@ -45815,6 +46306,11 @@ inline bool Command::isBrokerConfigValue() const
     return SELECTION_ID_BROKER_CONFIG == d_selectionId;
 }
 
+inline bool Command::isProfileValue() const
+{
+    return SELECTION_ID_PROFILE == d_selectionId;
+}
+
 inline bool Command::isUndefinedValue() const
 {
     return SELECTION_ID_UNDEFINED == d_selectionId;
@@ -45844,6 +46340,9 @@ void hashAppend(HASH_ALGORITHM& hashAlg, const mqbcmd::Command& object)
     case Class::SELECTION_ID_BROKER_CONFIG:
         hashAppend(hashAlg, object.brokerConfig());
         break;
+    case Class::SELECTION_ID_PROFILE:
+        hashAppend(hashAlg, object.profile());
+        break;
     default:
         BSLS_ASSERT(Class::SELECTION_ID_UNDEFINED == object.selectionId());
     }
@@ -47117,6 +47616,9 @@ int Result::manipulateSelection(MANIPULATOR& manipulator)
         return manipulator(
             &d_brokerConfig.object(),
             SELECTION_INFO_ARRAY[SELECTION_INDEX_BROKER_CONFIG]);
+    case Result::SELECTION_ID_PROFILE:
+        return manipulator(&d_profile.object(),
+                           SELECTION_INFO_ARRAY[SELECTION_INDEX_PROFILE]);
     default:
         BSLS_ASSERT(Result::SELECTION_ID_UNDEFINED == d_selectionId);
         return -1;
@@ -47273,6 +47775,12 @@ inline BrokerConfig& Result::brokerConfig()
     return d_brokerConfig.object();
 }
 
+inline bsl::string& Result::profile()
+{
+    BSLS_ASSERT(SELECTION_ID_PROFILE == d_selectionId);
+    return d_profile.object();
+}
+
 // ACCESSORS
 inline int Result::selectionId() const
 {
@@ -47364,6 +47872,9 @@ int Result::accessSelection(ACCESSOR& accessor) const
     case SELECTION_ID_BROKER_CONFIG:
         return accessor(d_brokerConfig.object(),
                         SELECTION_INFO_ARRAY[SELECTION_INDEX_BROKER_CONFIG]);
+    case SELECTION_ID_PROFILE:
+        return accessor(d_profile.object(),
+                        SELECTION_INFO_ARRAY[SELECTION_INDEX_PROFILE]);
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId); return -1;
     }
 }
@@ -47519,6 +48030,12 @@ inline const BrokerConfig& Result::brokerConfig() const
     return d_brokerConfig.object();
 }
 
+inline const bsl::string& Result::profile() const
+{
+    BSLS_ASSERT(SELECTION_ID_PROFILE == d_selectionId);
+    return d_profile.object();
+}
+
 inline bool Result::isErrorValue() const
 {
     return SELECTION_ID_ERROR == d_selectionId;
@@ -47644,6 +48161,11 @@ inline bool Result::isBrokerConfigValue() const
     return SELECTION_ID_BROKER_CONFIG == d_selectionId;
 }
 
+inline bool Result::isProfileValue() const
+{
+    return SELECTION_ID_PROFILE == d_selectionId;
+}
+
 inline bool Result::isUndefinedValue() const
 {
     return SELECTION_ID_UNDEFINED == d_selectionId;
@@ -47723,6 +48245,9 @@ void hashAppend(HASH_ALGORITHM& hashAlg, const mqbcmd::Result& object)
     case Class::SELECTION_ID_BROKER_CONFIG:
         hashAppend(hashAlg, object.brokerConfig());
         break;
+    case Class::SELECTION_ID_PROFILE:
+        hashAppend(hashAlg, object.profile());
+        break;
     default:
         BSLS_ASSERT(Class::SELECTION_ID_UNDEFINED == object.selectionId());
     }
@@ -48118,6 +48643,9 @@ int InternalResult::manipulateSelection(MANIPULATOR& manipulator)
         return manipulator(
             &d_brokerConfig.object(),
             SELECTION_INFO_ARRAY[SELECTION_INDEX_BROKER_CONFIG]);
+    case InternalResult::SELECTION_ID_PROFILE:
+        return manipulator(&d_profile.object(),
+                           SELECTION_INFO_ARRAY[SELECTION_INDEX_PROFILE]);
     default:
         BSLS_ASSERT(InternalResult::SELECTION_ID_UNDEFINED == d_selectionId);
         return -1;
@@ -48196,6 +48724,12 @@ inline BrokerConfig& InternalResult::brokerConfig()
     return d_brokerConfig.object();
 }
 
+inline bsl::string& InternalResult::profile()
+{
+    BSLS_ASSERT(SELECTION_ID_PROFILE == d_selectionId);
+    return d_profile.object();
+}
+
 // ACCESSORS
 inline int InternalResult::selectionId() const
 {
@@ -48245,6 +48779,9 @@ int InternalResult::accessSelection(ACCESSOR& accessor) const
     case SELECTION_ID_BROKER_CONFIG:
         return accessor(d_brokerConfig.object(),
                         SELECTION_INFO_ARRAY[SELECTION_INDEX_BROKER_CONFIG]);
+    case SELECTION_ID_PROFILE:
+        return accessor(d_profile.object(),
+                        SELECTION_INFO_ARRAY[SELECTION_INDEX_PROFILE]);
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId); return -1;
     }
 }
@@ -48323,6 +48860,12 @@ inline const BrokerConfig& InternalResult::brokerConfig() const
     return d_brokerConfig.object();
 }
 
+inline const bsl::string& InternalResult::profile() const
+{
+    BSLS_ASSERT(SELECTION_ID_PROFILE == d_selectionId);
+    return d_profile.object();
+}
+
 inline bool InternalResult::isErrorValue() const
 {
     return SELECTION_ID_ERROR == d_selectionId;
@@ -48383,6 +48926,11 @@ inline bool InternalResult::isBrokerConfigValue() const
     return SELECTION_ID_BROKER_CONFIG == d_selectionId;
 }
 
+inline bool InternalResult::isProfileValue() const
+{
+    return SELECTION_ID_PROFILE == d_selectionId;
+}
+
 inline bool InternalResult::isUndefinedValue() const
 {
     return SELECTION_ID_UNDEFINED == d_selectionId;
@@ -48427,6 +48975,9 @@ void hashAppend(HASH_ALGORITHM& hashAlg, const mqbcmd::InternalResult& object)
     case Class::SELECTION_ID_BROKER_CONFIG:
         hashAppend(hashAlg, object.brokerConfig());
         break;
+    case Class::SELECTION_ID_PROFILE:
+        hashAppend(hashAlg, object.profile());
+        break;
     default:
         BSLS_ASSERT(Class::SELECTION_ID_UNDEFINED == object.selectionId());
     }
@@ -48802,6 +49353,25 @@ inline bsl::ostream& mqbcmd::operator<<(bsl::ostream&               stream,
     return rhs.print(stream, 0, -1);
 }
 
+inline bool mqbcmd::operator==(const mqbcmd::ListQueues& lhs,
+                               const mqbcmd::ListQueues& rhs)
+{
+    return lhs.uriFilter() == rhs.uriFilter() &&
+           lhs.offset() == rhs.offset() && lhs.count() == rhs.count();
+}
+
+inline bool mqbcmd::operator!=(const mqbcmd::ListQueues& lhs,
+                               const mqbcmd::ListQueues& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline bsl::ostream& mqbcmd::operator<<(bsl::ostream&             stream,
+                                        const mqbcmd::ListQueues& rhs)
+{
+    return rhs.print(stream, 0, -1);
+}
+
 inline bsl::ostream& mqbcmd::operator<<(bsl::ostream&           stream,
                                         mqbcmd::Locality::Value rhs)
 {
@@ -50841,6 +51411,8 @@ inline bool mqbcmd::operator==(const mqbcmd::Command& lhs,
         case Class::SELECTION_ID_DANGER: return lhs.danger() == rhs.danger();
         case Class::SELECTION_ID_BROKER_CONFIG:
             return lhs.brokerConfig() == rhs.brokerConfig();
+        case Class::SELECTION_ID_PROFILE:
+            return lhs.profile() == rhs.profile();
         default:
             BSLS_ASSERT(Class::SELECTION_ID_UNDEFINED == rhs.selectionId());
             return true;
@@ -51096,6 +51668,8 @@ inline bool mqbcmd::operator==(const mqbcmd::Result& lhs,
                    rhs.clusterDomainQueueStatuses();
         case Class::SELECTION_ID_BROKER_CONFIG:
             return lhs.brokerConfig() == rhs.brokerConfig();
+        case Class::SELECTION_ID_PROFILE:
+            return lhs.profile() == rhs.profile();
         default:
             BSLS_ASSERT(Class::SELECTION_ID_UNDEFINED == rhs.selectionId());
             return true;
@@ -51217,6 +51791,8 @@ inline bool mqbcmd::operator==(const mqbcmd::InternalResult& lhs,
                    rhs.clusterDomainQueueStatuses();
         case Class::SELECTION_ID_BROKER_CONFIG:
             return lhs.brokerConfig() == rhs.brokerConfig();
+        case Class::SELECTION_ID_PROFILE:
+            return lhs.profile() == rhs.profile();
         default:
             BSLS_ASSERT(Class::SELECTION_ID_UNDEFINED == rhs.selectionId());
             return true;
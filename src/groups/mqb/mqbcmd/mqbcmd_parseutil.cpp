@@ -201,9 +201,11 @@ DEF_FUNC(DomainResolver, DomainResolverCommand);
 DEF_FUNC(ConfigProvider, ConfigProviderCommand);
 DEF_FUNC(Stat, StatCommand);
 DEF_FUNC(BrokerConfig, BrokerConfigCommand);
+DEF_FUNC(Profile, int);
 DEF_FUNC(ClustersCommand, ClustersCommand);
 DEF_FUNC(AddReverseProxy, AddReverseProxy);
 DEF_FUNC(Cluster, Cluster);
+DEF_FUNC(ClusterQueueHelper, ListQueues);
 DEF_FUNC(Storage, ClusterCommand);
 DEF_FUNC(StoragePartition, StoragePartition);
 DEF_FUNC(StorageDomain, StorageDomain);
@@ -260,6 +262,9 @@ int parseCommand(Command* command, bsl::string* error, WordGenerator next)
                                  error,
                                  next);  // RETURN
     }
+    else if (equalCaseless(word, "PROFILE")) {
+        return parseProfile(&command->makeProfile(), error, next);  // RETURN
+    }
 
     *error = "Invalid command. Send \"HELP\" for list of commands. Invalid "
              "command word: " +
@@ -633,6 +638,26 @@ int parseBrokerConfig(BrokerConfigCommand* brokerConfig,
     return -1;
 }
 
+/// PROFILE ...
+int parseProfile(int* durationSeconds, bsl::string* error, WordGenerator next)
+{
+    const bslstl::StringRef durationString = next();
+
+    if (durationString.empty()) {
+        *error = "PROFILE command must be followed by a duration, in "
+                 "seconds.";
+        return -1;  // RETURN
+    }
+
+    if (parseInt(durationSeconds, durationString) || *durationSeconds <= 0) {
+        *error = "Invalid <seconds> for PROFILE <seconds>: " +
+                 durationString;
+        return -1;  // RETURN
+    }
+
+    return expectEnd(error, next);
+}
+
 /// CLUSTERS ...
 int parseClustersCommand(ClustersCommand* clusters,
                          bsl::string*     error,
@@ -701,8 +726,9 @@ int parseCluster(Cluster* cluster, bsl::string* error, WordGenerator next)
         return expectEnd(error, next);  // RETURN
     }
     else if (equalCaseless(subcommand, "QUEUEHELPER")) {
-        cluster->command().makeQueueHelper();
-        return expectEnd(error, next);  // RETURN
+        return parseClusterQueueHelper(&cluster->command().makeQueueHelper(),
+                                       error,
+                                       next);  // RETURN
     }
     else if (equalCaseless(subcommand, "FORCE_GC_QUEUES")) {
         cluster->command().makeForceGcQueues();
@@ -719,6 +745,62 @@ int parseCluster(Cluster* cluster, bsl::string* error, WordGenerator next)
     return -1;
 }
 
+/// CLUSTERS CLUSTER <name> QUEUEHELPER ...
+int parseClusterQueueHelper(ListQueues*   command,
+                            bsl::string*  error,
+                            WordGenerator next)
+{
+    // [<uriFilter>] [<offset> <count>]
+    // Since both the filter and the page are optional, we don't know how to
+    // interpret the arguments until we know how many there are.
+    const bslstl::StringRef word1 = next();
+    const bslstl::StringRef word2 = next();
+    const bslstl::StringRef word3 = next();
+
+    bslstl::StringRef offsetString, countString;
+
+    if (word1.empty()) {
+        // neither the filter nor the page are specified
+        return 0;  // RETURN
+    }
+    else if (word2.empty()) {
+        // only the filter is specified
+        command->uriFilter() = word1;
+        return 0;  // RETURN
+    }
+    else if (word3.empty()) {
+        // only the page is specified
+        offsetString = word1;
+        countString  = word2;
+    }
+    else {
+        command->uriFilter() = word1;
+        offsetString         = word2;
+        countString          = word3;
+    }
+
+    if (parseInt(&command->offset(), offsetString) ||
+        command->offset() < 0) {
+        *error = "Invalid <offset> for CLUSTERS CLUSTER <name> QUEUEHELPER "
+                 "[<uriFilter>] [<offset> <count>]: " +
+                 offsetString;
+        return -1;  // RETURN
+    }
+
+    if (equalCaseless(countString, "unlimited")) {
+        command->count() = 0;
+    }
+    else if (parseInt(&command->count(), countString) ||
+             command->count() < 0) {
+        *error = "Invalid <count> for CLUSTERS CLUSTER <name> QUEUEHELPER "
+                 "[<uriFilter>] [<offset> <count>]: " +
+                 countString;
+        return -1;  // RETURN
+    }
+
+    return expectEnd(error, next);
+}
+
 /// CLUSTERS CLUSTER <name> STORAGE ...
 int parseStorage(ClusterCommand* command,
                  bsl::string*    error,
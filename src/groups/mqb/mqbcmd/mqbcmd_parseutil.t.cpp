@@ -238,6 +238,34 @@ const Test k_TESTS[] = {
      "CLUSTERS CLUSTER cloister QUEUEHELPER",
      "{\"clusters\": {\"cluster\": {\"name\": \"cloister\", \"command\": {"
      "\"queueHelper\": {}}}}}"},
+    {__LINE__,
+     "filter the queues of a cluster's queue helper",
+     "CLUSTERS CLUSTER cloister QUEUEHELPER bmq.test",
+     "{\"clusters\": {\"cluster\": {\"name\": \"cloister\", \"command\": {"
+     "\"queueHelper\": {\"uriFilter\": \"bmq.test\"}}}}}"},
+    {__LINE__,
+     "page through the queues of a cluster's queue helper",
+     "CLUSTERS CLUSTER cloister QUEUEHELPER 100 50",
+     "{\"clusters\": {\"cluster\": {\"name\": \"cloister\", \"command\": {"
+     "\"queueHelper\": {\"offset\": 100, \"count\": 50}}}}}"},
+    {__LINE__,
+     "filter and page through the queues of a cluster's queue helper",
+     "CLUSTERS CLUSTER cloister QUEUEHELPER bmq.test 100 unlimited",
+     "{\"clusters\": {\"cluster\": {\"name\": \"cloister\", \"command\": {"
+     "\"queueHelper\": {\"uriFilter\": \"bmq.test\", \"offset\": 100, "
+     "\"count\": 0}}}}}"},
+    {__LINE__,
+     "queue helper <offset> must not be negative",
+     "CLUSTERS CLUSTER cloister QUEUEHELPER -1 50",
+     0},
+    {__LINE__,
+     "queue helper <count> must be a number",
+     "CLUSTERS CLUSTER cloister QUEUEHELPER bmq.test 0 many",
+     0},
+    {__LINE__,
+     "queue helper accepts at most three arguments",
+     "CLUSTERS CLUSTER cloister QUEUEHELPER bmq.test 0 10 20",
+     0},
     {__LINE__,
      "run garbage collection on a cluster's queues",
      "CLUSTERS CLUSTER cloister FORCE_GC_QUEUES",
@@ -333,7 +361,11 @@ const Test k_TESTS[] = {
     {__LINE__,
      "Broker Config command",
      "BROKERCONFIG DUMP",
-     "{\"brokerConfig\": {\"dump\": {}}}"}};
+     "{\"brokerConfig\": {\"dump\": {}}}"},
+    {__LINE__, "the profile command requires a duration", "PROFILE", 0},
+    {__LINE__, "the profile duration must be an integer", "PROFILE ten", 0},
+    {__LINE__, "the profile duration must be positive", "PROFILE 0", 0},
+    {__LINE__, "profile the broker", "PROFILE 10", "{\"profile\": 10}"}};
 
 void test1_parseExpected()
 {
@@ -153,6 +153,10 @@ void Util::flatten(Result* result, const InternalResult& cmdResult)
         result->makeBrokerConfig(cmdResult.brokerConfig());
         return;  // RETURN
     }
+    else if (cmdResult.isProfileValue()) {
+        result->makeProfile(cmdResult.profile());
+        return;  // RETURN
+    }
     else if (cmdResult.isStatResultValue()) {
         const StatResult& statResult = cmdResult.statResult();
 
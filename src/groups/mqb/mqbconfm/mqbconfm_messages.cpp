@@ -575,19 +575,61 @@ Failure::print(bsl::ostream& stream, int level, int spacesPerLevel) const
 
 const char FileBackedStorage::CLASS_NAME[] = "FileBackedStorage";
 
+const int FileBackedStorage::DEFAULT_INITIALIZER_COMPRESSION_ALGORITHM_TYPE =
+    0;
+
+const int FileBackedStorage::DEFAULT_INITIALIZER_GROUP_COMMIT_WINDOW_US = -1;
+
+const int
+    FileBackedStorage::DEFAULT_INITIALIZER_REPLICATION_BATCH_MAX_LATENCY_US =
+        -1;
+
+const bdlat_AttributeInfo FileBackedStorage::ATTRIBUTE_INFO_ARRAY[] = {
+    {ATTRIBUTE_ID_COMPRESSION_ALGORITHM_TYPE,
+     "compressionAlgorithmType",
+     sizeof("compressionAlgorithmType") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_GROUP_COMMIT_WINDOW_US,
+     "groupCommitWindowUs",
+     sizeof("groupCommitWindowUs") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_REPLICATION_BATCH_MAX_LATENCY_US,
+     "replicationBatchMaxLatencyUs",
+     sizeof("replicationBatchMaxLatencyUs") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC}};
+
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 FileBackedStorage::lookupAttributeInfo(const char* name, int nameLength)
 {
-    (void)name;
-    (void)nameLength;
+    for (int i = 0; i < 3; ++i) {
+        const bdlat_AttributeInfo& attributeInfo =
+            FileBackedStorage::ATTRIBUTE_INFO_ARRAY[i];
+
+        if (nameLength == attributeInfo.d_nameLength &&
+            0 == bsl::memcmp(attributeInfo.d_name_p, name, nameLength)) {
+            return &attributeInfo;
+        }
+    }
+
     return 0;
 }
 
 const bdlat_AttributeInfo* FileBackedStorage::lookupAttributeInfo(int id)
 {
     switch (id) {
+    case ATTRIBUTE_ID_COMPRESSION_ALGORITHM_TYPE:
+        return &ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_COMPRESSION_ALGORITHM_TYPE];
+    case ATTRIBUTE_ID_GROUP_COMMIT_WINDOW_US:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_WINDOW_US];
+    case ATTRIBUTE_ID_REPLICATION_BATCH_MAX_LATENCY_US:
+        return &ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_REPLICATION_BATCH_MAX_LATENCY_US];
     default: return 0;
     }
 }
@@ -595,12 +637,18 @@ const bdlat_AttributeInfo* FileBackedStorage::lookupAttributeInfo(int id)
 // CREATORS
 
 FileBackedStorage::FileBackedStorage()
+: d_compressionAlgorithmType(DEFAULT_INITIALIZER_COMPRESSION_ALGORITHM_TYPE)
+, d_groupCommitWindowUs(DEFAULT_INITIALIZER_GROUP_COMMIT_WINDOW_US)
+, d_replicationBatchMaxLatencyUs(
+      DEFAULT_INITIALIZER_REPLICATION_BATCH_MAX_LATENCY_US)
 {
 }
 
 FileBackedStorage::FileBackedStorage(const FileBackedStorage& original)
+: d_compressionAlgorithmType(original.d_compressionAlgorithmType)
+, d_groupCommitWindowUs(original.d_groupCommitWindowUs)
+, d_replicationBatchMaxLatencyUs(original.d_replicationBatchMaxLatencyUs)
 {
-    (void)original;
 }
 
 FileBackedStorage::~FileBackedStorage()
@@ -611,7 +659,12 @@ FileBackedStorage::~FileBackedStorage()
 
 FileBackedStorage& FileBackedStorage::operator=(const FileBackedStorage& rhs)
 {
-    (void)rhs;
+    if (this != &rhs) {
+        d_compressionAlgorithmType     = rhs.d_compressionAlgorithmType;
+        d_groupCommitWindowUs          = rhs.d_groupCommitWindowUs;
+        d_replicationBatchMaxLatencyUs = rhs.d_replicationBatchMaxLatencyUs;
+    }
+
     return *this;
 }
 
@@ -619,13 +672,24 @@ FileBackedStorage& FileBackedStorage::operator=(const FileBackedStorage& rhs)
     defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
 FileBackedStorage& FileBackedStorage::operator=(FileBackedStorage&& rhs)
 {
-    (void)rhs;
+    if (this != &rhs) {
+        d_compressionAlgorithmType = bsl::move(rhs.d_compressionAlgorithmType);
+        d_groupCommitWindowUs      = bsl::move(rhs.d_groupCommitWindowUs);
+        d_replicationBatchMaxLatencyUs = bsl::move(
+            rhs.d_replicationBatchMaxLatencyUs);
+    }
+
     return *this;
 }
 #endif
 
 void FileBackedStorage::reset()
 {
+    d_compressionAlgorithmType =
+        DEFAULT_INITIALIZER_COMPRESSION_ALGORITHM_TYPE;
+    d_groupCommitWindowUs = DEFAULT_INITIALIZER_GROUP_COMMIT_WINDOW_US;
+    d_replicationBatchMaxLatencyUs =
+        DEFAULT_INITIALIZER_REPLICATION_BATCH_MAX_LATENCY_US;
 }
 
 // ACCESSORS
@@ -634,8 +698,14 @@ bsl::ostream& FileBackedStorage::print(bsl::ostream& stream,
                                        int           level,
                                        int           spacesPerLevel) const
 {
-    (void)level;
-    (void)spacesPerLevel;
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("compressionAlgorithmType",
+                           this->compressionAlgorithmType());
+    printer.printAttribute("groupCommitWindowUs", this->groupCommitWindowUs());
+    printer.printAttribute("replicationBatchMaxLatencyUs",
+                           this->replicationBatchMaxLatencyUs());
+    printer.end();
     return stream;
 }
 
@@ -647,19 +717,38 @@ bsl::ostream& FileBackedStorage::print(bsl::ostream& stream,
 
 const char InMemoryStorage::CLASS_NAME[] = "InMemoryStorage";
 
+const int InMemoryStorage::DEFAULT_INITIALIZER_SEGMENT_SIZE = 0;
+
+const bdlat_AttributeInfo InMemoryStorage::ATTRIBUTE_INFO_ARRAY[] = {
+    {ATTRIBUTE_ID_SEGMENT_SIZE,
+     "segmentSize",
+     sizeof("segmentSize") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC}};
+
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 InMemoryStorage::lookupAttributeInfo(const char* name, int nameLength)
 {
-    (void)name;
-    (void)nameLength;
+    for (int i = 0; i < 1; ++i) {
+        const bdlat_AttributeInfo& attributeInfo =
+            InMemoryStorage::ATTRIBUTE_INFO_ARRAY[i];
+
+        if (nameLength == attributeInfo.d_nameLength &&
+            0 == bsl::memcmp(attributeInfo.d_name_p, name, nameLength)) {
+            return &attributeInfo;
+        }
+    }
+
     return 0;
 }
 
 const bdlat_AttributeInfo* InMemoryStorage::lookupAttributeInfo(int id)
 {
     switch (id) {
+    case ATTRIBUTE_ID_SEGMENT_SIZE:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SEGMENT_SIZE];
     default: return 0;
     }
 }
@@ -667,12 +756,13 @@ const bdlat_AttributeInfo* InMemoryStorage::lookupAttributeInfo(int id)
 // CREATORS
 
 InMemoryStorage::InMemoryStorage()
+: d_segmentSize(DEFAULT_INITIALIZER_SEGMENT_SIZE)
 {
 }
 
 InMemoryStorage::InMemoryStorage(const InMemoryStorage& original)
+: d_segmentSize(original.d_segmentSize)
 {
-    (void)original;
 }
 
 InMemoryStorage::~InMemoryStorage()
@@ -683,7 +773,10 @@ InMemoryStorage::~InMemoryStorage()
 
 InMemoryStorage& InMemoryStorage::operator=(const InMemoryStorage& rhs)
 {
-    (void)rhs;
+    if (this != &rhs) {
+        d_segmentSize = rhs.d_segmentSize;
+    }
+
     return *this;
 }
 
@@ -691,13 +784,17 @@ InMemoryStorage& InMemoryStorage::operator=(const InMemoryStorage& rhs)
     defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
 InMemoryStorage& InMemoryStorage::operator=(InMemoryStorage&& rhs)
 {
-    (void)rhs;
+    if (this != &rhs) {
+        d_segmentSize = bsl::move(rhs.d_segmentSize);
+    }
+
     return *this;
 }
 #endif
 
 void InMemoryStorage::reset()
 {
+    d_segmentSize = DEFAULT_INITIALIZER_SEGMENT_SIZE;
 }
 
 // ACCESSORS
@@ -706,8 +803,10 @@ bsl::ostream& InMemoryStorage::print(bsl::ostream& stream,
                                      int           level,
                                      int           spacesPerLevel) const
 {
-    (void)level;
-    (void)spacesPerLevel;
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("segmentSize", this->segmentSize());
+    printer.end();
     return stream;
 }
 
@@ -3217,6 +3316,8 @@ const int Domain::DEFAULT_INITIALIZER_MAX_DELIVERY_ATTEMPTS = 0;
 
 const int Domain::DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS = 300000;
 
+const bool Domain::DEFAULT_INITIALIZER_LEAST_OUTSTANDING_DELIVERY = false;
+
 const bdlat_AttributeInfo Domain::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_NAME,
      "name",
@@ -3277,14 +3378,19 @@ const bdlat_AttributeInfo Domain::ATTRIBUTE_INFO_ARRAY[] = {
      "consistency",
      sizeof("consistency") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_LEAST_OUTSTANDING_DELIVERY,
+     "leastOutstandingDelivery",
+     sizeof("leastOutstandingDelivery") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo* Domain::lookupAttributeInfo(const char* name,
                                                        int         nameLength)
 {
-    for (int i = 0; i < 12; ++i) {
+    for (int i = 0; i < 13; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             Domain::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -3322,6 +3428,9 @@ const bdlat_AttributeInfo* Domain::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS];
     case ATTRIBUTE_ID_CONSISTENCY:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSISTENCY];
+    case ATTRIBUTE_ID_LEAST_OUTSTANDING_DELIVERY:
+        return &ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_LEAST_OUTSTANDING_DELIVERY];
     default: return 0;
     }
 }
@@ -3341,6 +3450,7 @@ Domain::Domain(bslma::Allocator* basicAllocator)
 , d_maxIdleTime(DEFAULT_INITIALIZER_MAX_IDLE_TIME)
 , d_maxDeliveryAttempts(DEFAULT_INITIALIZER_MAX_DELIVERY_ATTEMPTS)
 , d_deduplicationTimeMs(DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS)
+, d_leastOutstandingDelivery(DEFAULT_INITIALIZER_LEAST_OUTSTANDING_DELIVERY)
 {
 }
 
@@ -3357,6 +3467,7 @@ Domain::Domain(const Domain& original, bslma::Allocator* basicAllocator)
 , d_maxIdleTime(original.d_maxIdleTime)
 , d_maxDeliveryAttempts(original.d_maxDeliveryAttempts)
 , d_deduplicationTimeMs(original.d_deduplicationTimeMs)
+, d_leastOutstandingDelivery(original.d_leastOutstandingDelivery)
 {
 }
 
@@ -3374,7 +3485,8 @@ Domain::Domain(Domain&& original) noexcept
   d_maxQueues(bsl::move(original.d_maxQueues)),
   d_maxIdleTime(bsl::move(original.d_maxIdleTime)),
   d_maxDeliveryAttempts(bsl::move(original.d_maxDeliveryAttempts)),
-  d_deduplicationTimeMs(bsl::move(original.d_deduplicationTimeMs))
+  d_deduplicationTimeMs(bsl::move(original.d_deduplicationTimeMs)),
+  d_leastOutstandingDelivery(bsl::move(original.d_leastOutstandingDelivery))
 {
 }
 
@@ -3391,6 +3503,7 @@ Domain::Domain(Domain&& original, bslma::Allocator* basicAllocator)
 , d_maxIdleTime(bsl::move(original.d_maxIdleTime))
 , d_maxDeliveryAttempts(bsl::move(original.d_maxDeliveryAttempts))
 , d_deduplicationTimeMs(bsl::move(original.d_deduplicationTimeMs))
+, d_leastOutstandingDelivery(bsl::move(original.d_leastOutstandingDelivery))
 {
 }
 #endif
@@ -3414,8 +3527,9 @@ Domain& Domain::operator=(const Domain& rhs)
         d_maxIdleTime         = rhs.d_maxIdleTime;
         d_messageTtl          = rhs.d_messageTtl;
         d_maxDeliveryAttempts = rhs.d_maxDeliveryAttempts;
-        d_deduplicationTimeMs = rhs.d_deduplicationTimeMs;
-        d_consistency         = rhs.d_consistency;
+        d_deduplicationTimeMs      = rhs.d_deduplicationTimeMs;
+        d_consistency              = rhs.d_consistency;
+        d_leastOutstandingDelivery = rhs.d_leastOutstandingDelivery;
     }
 
     return *this;
@@ -3438,6 +3552,7 @@ Domain& Domain::operator=(Domain&& rhs)
         d_maxDeliveryAttempts = bsl::move(rhs.d_maxDeliveryAttempts);
         d_deduplicationTimeMs = bsl::move(rhs.d_deduplicationTimeMs);
         d_consistency         = bsl::move(rhs.d_consistency);
+        d_leastOutstandingDelivery = bsl::move(rhs.d_leastOutstandingDelivery);
     }
 
     return *this;
@@ -3458,6 +3573,8 @@ void Domain::reset()
     d_maxDeliveryAttempts = DEFAULT_INITIALIZER_MAX_DELIVERY_ATTEMPTS;
     d_deduplicationTimeMs = DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS;
     bdlat_ValueTypeFunctions::reset(&d_consistency);
+    d_leastOutstandingDelivery =
+        DEFAULT_INITIALIZER_LEAST_OUTSTANDING_DELIVERY;
 }
 
 // ACCESSORS
@@ -3479,6 +3596,8 @@ Domain::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("maxDeliveryAttempts", this->maxDeliveryAttempts());
     printer.printAttribute("deduplicationTimeMs", this->deduplicationTimeMs());
     printer.printAttribute("consistency", this->consistency());
+    printer.printAttribute("leastOutstandingDelivery",
+                           this->leastOutstandingDelivery());
     printer.end();
     return stream;
 }
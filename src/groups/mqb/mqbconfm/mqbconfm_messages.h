@@ -991,16 +991,54 @@ namespace mqbconfm {
 // =======================
 
 /// Configuration for storage using a file on disk.
+/// compressionAlgorithmType..: compression algorithm applied by the primary
+/// to uncompressed message payloads before writing them to the data file,
+/// as a 'bmqt::CompressionAlgorithmType' value (0: none, 1: ZLIB, 2: LZ4,
+/// 3: ZSTD).  Payloads compressed by their producer are stored as they
+/// are.  0 (the default) disables compression at rest
+/// groupCommitWindowUs.......: flush policy of the messages of the domain,
+/// when group commit is enabled in the partition: maximum time, in
+/// microseconds, between the write of a message and the sync to disk
+/// covering it, instead of the window of the partition, or 0 to not wait for
+/// the sync to disk before receipting the messages.  -1 (the default) uses
+/// the window of the partition
+/// replicationBatchMaxLatencyUs: maximum time, in microseconds, a message of
+/// the domain waits in a replication batch before the batch is replicated,
+/// or 0 to replicate the batch as soon as a message of the domain is added
+/// to it.  -1 (the default) uses the latency of the partition
 class FileBackedStorage {
     // INSTANCE DATA
+    int d_compressionAlgorithmType;
+    int d_groupCommitWindowUs;
+    int d_replicationBatchMaxLatencyUs;
 
   public:
     // TYPES
-    enum { NUM_ATTRIBUTES = 0 };
+    enum {
+        ATTRIBUTE_ID_COMPRESSION_ALGORITHM_TYPE       = 0,
+        ATTRIBUTE_ID_GROUP_COMMIT_WINDOW_US           = 1,
+        ATTRIBUTE_ID_REPLICATION_BATCH_MAX_LATENCY_US = 2
+    };
+
+    enum { NUM_ATTRIBUTES = 3 };
+
+    enum {
+        ATTRIBUTE_INDEX_COMPRESSION_ALGORITHM_TYPE       = 0,
+        ATTRIBUTE_INDEX_GROUP_COMMIT_WINDOW_US           = 1,
+        ATTRIBUTE_INDEX_REPLICATION_BATCH_MAX_LATENCY_US = 2
+    };
 
     // CONSTANTS
     static const char CLASS_NAME[];
 
+    static const int DEFAULT_INITIALIZER_COMPRESSION_ALGORITHM_TYPE;
+
+    static const int DEFAULT_INITIALIZER_GROUP_COMMIT_WINDOW_US;
+
+    static const int DEFAULT_INITIALIZER_REPLICATION_BATCH_MAX_LATENCY_US;
+
+    static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+
   public:
     // CLASS METHODS
 
@@ -1081,6 +1119,18 @@ class FileBackedStorage {
                             const char*    name,
                             int            nameLength);
 
+    /// Return a reference to the modifiable "CompressionAlgorithmType"
+    /// attribute of this object.
+    int& compressionAlgorithmType();
+
+    /// Return a reference to the modifiable "GroupCommitWindowUs" attribute
+    /// of this object.
+    int& groupCommitWindowUs();
+
+    /// Return a reference to the modifiable "ReplicationBatchMaxLatencyUs"
+    /// attribute of this object.
+    int& replicationBatchMaxLatencyUs();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -1124,6 +1174,18 @@ class FileBackedStorage {
     int accessAttribute(t_ACCESSOR& accessor,
                         const char* name,
                         int         nameLength) const;
+
+    /// Return the value of the "CompressionAlgorithmType" attribute of this
+    /// object.
+    int compressionAlgorithmType() const;
+
+    /// Return the value of the "GroupCommitWindowUs" attribute of this
+    /// object.
+    int groupCommitWindowUs() const;
+
+    /// Return the value of the "ReplicationBatchMaxLatencyUs" attribute of
+    /// this object.
+    int replicationBatchMaxLatencyUs() const;
 };
 
 // FREE OPERATORS
@@ -1165,16 +1227,29 @@ namespace mqbconfm {
 // =====================
 
 /// Configuration for storage using an in-memory map.
+/// segmentSize..: size, in bytes, of the segments into which the payloads
+/// of messages, up to a quarter of that size, are copied, so that the
+/// memory of a segment is freed at once when all its messages are gone.  0
+/// (the default) keeps the payloads as received
 class InMemoryStorage {
     // INSTANCE DATA
+    int d_segmentSize;
 
   public:
     // TYPES
-    enum { NUM_ATTRIBUTES = 0 };
+    enum { ATTRIBUTE_ID_SEGMENT_SIZE = 0 };
+
+    enum { NUM_ATTRIBUTES = 1 };
+
+    enum { ATTRIBUTE_INDEX_SEGMENT_SIZE = 0 };
 
     // CONSTANTS
     static const char CLASS_NAME[];
 
+    static const int DEFAULT_INITIALIZER_SEGMENT_SIZE;
+
+    static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+
   public:
     // CLASS METHODS
 
@@ -1254,6 +1329,10 @@ class InMemoryStorage {
                             const char*    name,
                             int            nameLength);
 
+    /// Return a reference to the modifiable "SegmentSize" attribute of this
+    /// object.
+    int& segmentSize();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -1297,6 +1376,9 @@ class InMemoryStorage {
     int accessAttribute(t_ACCESSOR& accessor,
                         const char* name,
                         int         nameLength) const;
+
+    /// Return the value of the "SegmentSize" attribute of this object.
+    int segmentSize() const;
 };
 
 // FREE OPERATORS
@@ -4278,6 +4360,10 @@ namespace mqbconfm {
 /// Zero (the default) means unlimited deduplicationTimeMs.: timeout, in
 /// milliseconds, to keep GUID of PUT message for the purpose of detecting
 /// duplicate PUTs.  consistency.........: optional consistency mode.
+/// leastOutstandingDelivery: flag to indicate whether each message is
+/// delivered to the consumer having the fewest unconfirmed messages
+/// relative to its maxUnconfirmedMessages, instead of rotating evenly among
+/// the consumers having capacity
 class Domain {
     // INSTANCE DATA
     bsls::Types::Int64                    d_messageTtl;
@@ -4292,6 +4378,7 @@ class Domain {
     int                                   d_maxIdleTime;
     int                                   d_maxDeliveryAttempts;
     int                                   d_deduplicationTimeMs;
+    bool                                  d_leastOutstandingDelivery;
 
   public:
     // TYPES
@@ -4307,10 +4394,11 @@ class Domain {
         ATTRIBUTE_ID_MESSAGE_TTL           = 8,
         ATTRIBUTE_ID_MAX_DELIVERY_ATTEMPTS = 9,
         ATTRIBUTE_ID_DEDUPLICATION_TIME_MS = 10,
-        ATTRIBUTE_ID_CONSISTENCY           = 11
+        ATTRIBUTE_ID_CONSISTENCY           = 11,
+        ATTRIBUTE_ID_LEAST_OUTSTANDING_DELIVERY = 12
     };
 
-    enum { NUM_ATTRIBUTES = 12 };
+    enum { NUM_ATTRIBUTES = 13 };
 
     enum {
         ATTRIBUTE_INDEX_NAME                  = 0,
@@ -4324,7 +4412,8 @@ class Domain {
         ATTRIBUTE_INDEX_MESSAGE_TTL           = 8,
         ATTRIBUTE_INDEX_MAX_DELIVERY_ATTEMPTS = 9,
         ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS = 10,
-        ATTRIBUTE_INDEX_CONSISTENCY           = 11
+        ATTRIBUTE_INDEX_CONSISTENCY           = 11,
+        ATTRIBUTE_INDEX_LEAST_OUTSTANDING_DELIVERY = 12
     };
 
     // CONSTANTS
@@ -4342,6 +4431,8 @@ class Domain {
 
     static const int DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS;
 
+    static const bool DEFAULT_INITIALIZER_LEAST_OUTSTANDING_DELIVERY;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -4484,6 +4575,10 @@ class Domain {
     /// object.
     Consistency& consistency();
 
+    /// Return a reference to the modifiable "LeastOutstandingDelivery"
+    /// attribute of this object.
+    bool& leastOutstandingDelivery();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -4570,6 +4665,10 @@ class Domain {
     /// Return a reference offering non-modifiable access to the
     /// "Consistency" attribute of this object.
     const Consistency& consistency() const;
+
+    /// Return the value of the "LeastOutstandingDelivery" attribute of this
+    /// object.
+    bool leastOutstandingDelivery() const;
 };
 
 // FREE OPERATORS
@@ -5626,17 +5725,55 @@ inline const bsl::string& Failure::message() const
 template <typename t_MANIPULATOR>
 int FileBackedStorage::manipulateAttributes(t_MANIPULATOR& manipulator)
 {
-    (void)manipulator;
+    int ret;
+
+    ret = manipulator(
+        &d_compressionAlgorithmType,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_ALGORITHM_TYPE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_groupCommitWindowUs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_WINDOW_US]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_replicationBatchMaxLatencyUs,
+        ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_REPLICATION_BATCH_MAX_LATENCY_US]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
 template <typename t_MANIPULATOR>
 int FileBackedStorage::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
 {
-    (void)manipulator;
     enum { NOT_FOUND = -1 };
 
     switch (id) {
+    case ATTRIBUTE_ID_COMPRESSION_ALGORITHM_TYPE: {
+        return manipulator(
+            &d_compressionAlgorithmType,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_ALGORITHM_TYPE]);
+    }
+    case ATTRIBUTE_ID_GROUP_COMMIT_WINDOW_US: {
+        return manipulator(
+            &d_groupCommitWindowUs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_WINDOW_US]);
+    }
+    case ATTRIBUTE_ID_REPLICATION_BATCH_MAX_LATENCY_US: {
+        return manipulator(
+            &d_replicationBatchMaxLatencyUs,
+            ATTRIBUTE_INFO_ARRAY
+                [ATTRIBUTE_INDEX_REPLICATION_BATCH_MAX_LATENCY_US]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -5657,21 +5794,73 @@ int FileBackedStorage::manipulateAttribute(t_MANIPULATOR& manipulator,
     return manipulateAttribute(manipulator, attributeInfo->d_id);
 }
 
+inline int& FileBackedStorage::compressionAlgorithmType()
+{
+    return d_compressionAlgorithmType;
+}
+
+inline int& FileBackedStorage::groupCommitWindowUs()
+{
+    return d_groupCommitWindowUs;
+}
+
+inline int& FileBackedStorage::replicationBatchMaxLatencyUs()
+{
+    return d_replicationBatchMaxLatencyUs;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int FileBackedStorage::accessAttributes(t_ACCESSOR& accessor) const
 {
-    (void)accessor;
+    int ret;
+
+    ret = accessor(
+        d_compressionAlgorithmType,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_ALGORITHM_TYPE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_groupCommitWindowUs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_WINDOW_US]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_replicationBatchMaxLatencyUs,
+                   ATTRIBUTE_INFO_ARRAY
+                       [ATTRIBUTE_INDEX_REPLICATION_BATCH_MAX_LATENCY_US]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
 template <typename t_ACCESSOR>
 int FileBackedStorage::accessAttribute(t_ACCESSOR& accessor, int id) const
 {
-    (void)accessor;
     enum { NOT_FOUND = -1 };
 
     switch (id) {
+    case ATTRIBUTE_ID_COMPRESSION_ALGORITHM_TYPE: {
+        return accessor(
+            d_compressionAlgorithmType,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_ALGORITHM_TYPE]);
+    }
+    case ATTRIBUTE_ID_GROUP_COMMIT_WINDOW_US: {
+        return accessor(
+            d_groupCommitWindowUs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_WINDOW_US]);
+    }
+    case ATTRIBUTE_ID_REPLICATION_BATCH_MAX_LATENCY_US: {
+        return accessor(
+            d_replicationBatchMaxLatencyUs,
+            ATTRIBUTE_INFO_ARRAY
+                [ATTRIBUTE_INDEX_REPLICATION_BATCH_MAX_LATENCY_US]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -5692,6 +5881,21 @@ int FileBackedStorage::accessAttribute(t_ACCESSOR& accessor,
     return accessAttribute(accessor, attributeInfo->d_id);
 }
 
+inline int FileBackedStorage::compressionAlgorithmType() const
+{
+    return d_compressionAlgorithmType;
+}
+
+inline int FileBackedStorage::groupCommitWindowUs() const
+{
+    return d_groupCommitWindowUs;
+}
+
+inline int FileBackedStorage::replicationBatchMaxLatencyUs() const
+{
+    return d_replicationBatchMaxLatencyUs;
+}
+
 // ---------------------
 // class InMemoryStorage
 // ---------------------
@@ -5701,17 +5905,27 @@ int FileBackedStorage::accessAttribute(t_ACCESSOR& accessor,
 template <typename t_MANIPULATOR>
 int InMemoryStorage::manipulateAttributes(t_MANIPULATOR& manipulator)
 {
-    (void)manipulator;
+    int ret;
+
+    ret = manipulator(&d_segmentSize,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SEGMENT_SIZE]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
 template <typename t_MANIPULATOR>
 int InMemoryStorage::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
 {
-    (void)manipulator;
     enum { NOT_FOUND = -1 };
 
     switch (id) {
+    case ATTRIBUTE_ID_SEGMENT_SIZE: {
+        return manipulator(&d_segmentSize,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SEGMENT_SIZE]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -5732,21 +5946,36 @@ int InMemoryStorage::manipulateAttribute(t_MANIPULATOR& manipulator,
     return manipulateAttribute(manipulator, attributeInfo->d_id);
 }
 
+inline int& InMemoryStorage::segmentSize()
+{
+    return d_segmentSize;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int InMemoryStorage::accessAttributes(t_ACCESSOR& accessor) const
 {
-    (void)accessor;
+    int ret;
+
+    ret = accessor(d_segmentSize,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SEGMENT_SIZE]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
 template <typename t_ACCESSOR>
 int InMemoryStorage::accessAttribute(t_ACCESSOR& accessor, int id) const
 {
-    (void)accessor;
     enum { NOT_FOUND = -1 };
 
     switch (id) {
+    case ATTRIBUTE_ID_SEGMENT_SIZE: {
+        return accessor(d_segmentSize,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SEGMENT_SIZE]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -5767,6 +5996,11 @@ int InMemoryStorage::accessAttribute(t_ACCESSOR& accessor,
     return accessAttribute(accessor, attributeInfo->d_id);
 }
 
+inline int InMemoryStorage::segmentSize() const
+{
+    return d_segmentSize;
+}
+
 // ------------
 // class Limits
 // ------------
@@ -7388,6 +7622,13 @@ int Domain::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_leastOutstandingDelivery,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_LEAST_OUTSTANDING_DELIVERY]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -7451,6 +7692,11 @@ int Domain::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
         return manipulator(&d_consistency,
                            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSISTENCY]);
     }
+    case ATTRIBUTE_ID_LEAST_OUTSTANDING_DELIVERY: {
+        return manipulator(
+            &d_leastOutstandingDelivery,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_LEAST_OUTSTANDING_DELIVERY]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -7531,6 +7777,11 @@ inline Consistency& Domain::consistency()
     return d_consistency;
 }
 
+inline bool& Domain::leastOutstandingDelivery()
+{
+    return d_leastOutstandingDelivery;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int Domain::accessAttributes(t_ACCESSOR& accessor) const
@@ -7608,6 +7859,13 @@ int Domain::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(
+        d_leastOutstandingDelivery,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_LEAST_OUTSTANDING_DELIVERY]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -7666,6 +7924,11 @@ int Domain::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_consistency,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSISTENCY]);
     }
+    case ATTRIBUTE_ID_LEAST_OUTSTANDING_DELIVERY: {
+        return accessor(
+            d_leastOutstandingDelivery,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_LEAST_OUTSTANDING_DELIVERY]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -7747,6 +8010,11 @@ inline const Consistency& Domain::consistency() const
     return d_consistency;
 }
 
+inline bool Domain::leastOutstandingDelivery() const
+{
+    return d_leastOutstandingDelivery;
+}
+
 // ----------------------
 // class DomainDefinition
 // ----------------------
@@ -8089,16 +8357,19 @@ void mqbconfm::hashAppend(t_HASH_ALGORITHM&        hashAlg,
     hashAppend(hashAlg, object.message());
 }
 
-inline bool mqbconfm::operator==(const mqbconfm::FileBackedStorage&,
-                                 const mqbconfm::FileBackedStorage&)
+inline bool mqbconfm::operator==(const mqbconfm::FileBackedStorage& lhs,
+                                 const mqbconfm::FileBackedStorage& rhs)
 {
-    return true;
+    return lhs.compressionAlgorithmType() == rhs.compressionAlgorithmType() &&
+           lhs.groupCommitWindowUs() == rhs.groupCommitWindowUs() &&
+           lhs.replicationBatchMaxLatencyUs() ==
+               rhs.replicationBatchMaxLatencyUs();
 }
 
-inline bool mqbconfm::operator!=(const mqbconfm::FileBackedStorage&,
-                                 const mqbconfm::FileBackedStorage&)
+inline bool mqbconfm::operator!=(const mqbconfm::FileBackedStorage& lhs,
+                                 const mqbconfm::FileBackedStorage& rhs)
 {
-    return false;
+    return !(lhs == rhs);
 }
 
 inline bsl::ostream&
@@ -8112,20 +8383,22 @@ template <typename t_HASH_ALGORITHM>
 void mqbconfm::hashAppend(t_HASH_ALGORITHM&                  hashAlg,
                           const mqbconfm::FileBackedStorage& object)
 {
-    (void)hashAlg;
-    (void)object;
+    using bslh::hashAppend;
+    hashAppend(hashAlg, object.compressionAlgorithmType());
+    hashAppend(hashAlg, object.groupCommitWindowUs());
+    hashAppend(hashAlg, object.replicationBatchMaxLatencyUs());
 }
 
-inline bool mqbconfm::operator==(const mqbconfm::InMemoryStorage&,
-                                 const mqbconfm::InMemoryStorage&)
+inline bool mqbconfm::operator==(const mqbconfm::InMemoryStorage& lhs,
+                                 const mqbconfm::InMemoryStorage& rhs)
 {
-    return true;
+    return lhs.segmentSize() == rhs.segmentSize();
 }
 
-inline bool mqbconfm::operator!=(const mqbconfm::InMemoryStorage&,
-                                 const mqbconfm::InMemoryStorage&)
+inline bool mqbconfm::operator!=(const mqbconfm::InMemoryStorage& lhs,
+                                 const mqbconfm::InMemoryStorage& rhs)
 {
-    return false;
+    return !(lhs == rhs);
 }
 
 inline bsl::ostream& mqbconfm::operator<<(bsl::ostream& stream,
@@ -8138,8 +8411,8 @@ template <typename t_HASH_ALGORITHM>
 void mqbconfm::hashAppend(t_HASH_ALGORITHM&                hashAlg,
                           const mqbconfm::InMemoryStorage& object)
 {
-    (void)hashAlg;
-    (void)object;
+    using bslh::hashAppend;
+    hashAppend(hashAlg, object.segmentSize());
 }
 
 inline bool mqbconfm::operator==(const mqbconfm::Limits& lhs,
@@ -8665,7 +8938,8 @@ inline bool mqbconfm::operator==(const mqbconfm::Domain& lhs,
            lhs.messageTtl() == rhs.messageTtl() &&
            lhs.maxDeliveryAttempts() == rhs.maxDeliveryAttempts() &&
            lhs.deduplicationTimeMs() == rhs.deduplicationTimeMs() &&
-           lhs.consistency() == rhs.consistency();
+           lhs.consistency() == rhs.consistency() &&
+           lhs.leastOutstandingDelivery() == rhs.leastOutstandingDelivery();
 }
 
 inline bool mqbconfm::operator!=(const mqbconfm::Domain& lhs,
@@ -8697,6 +8971,7 @@ void mqbconfm::hashAppend(t_HASH_ALGORITHM&       hashAlg,
     hashAppend(hashAlg, object.maxDeliveryAttempts());
     hashAppend(hashAlg, object.deduplicationTimeMs());
     hashAppend(hashAlg, object.consistency());
+    hashAppend(hashAlg, object.leastOutstandingDelivery());
 }
 
 inline bool mqbconfm::operator==(const mqbconfm::DomainDefinition& lhs,
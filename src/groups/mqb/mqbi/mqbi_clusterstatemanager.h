@@ -106,6 +106,11 @@ class ClusterStateManager {
     typedef bsl::unordered_set<AppIdInfo>            AppIdInfos;
     typedef AppIdInfos::const_iterator               AppIdInfosCIter;
 
+    /// Pair of (queue assignment request, requester)
+    typedef bsl::pair<bmqp_ctrlmsg::ControlMessage, mqbnet::ClusterNode*>
+                                                QueueAssignmentRequest;
+    typedef bsl::vector<QueueAssignmentRequest> QueueAssignmentRequests;
+
     struct QueueAssignmentResult {
         enum Enum {
             // Return code for queue assignment operations.
@@ -214,6 +219,19 @@ class ClusterStateManager {
     virtual QueueAssignmentResult::Enum
     assignQueue(const bmqt::Uri& uri, bmqp_ctrlmsg::Status* status = 0) = 0;
 
+    /// Perform the actual assignment of the queues represented by the
+    /// specified `uris`, as per `assignQueue`, but applying a single queue
+    /// assignment advisory for all of them whenever possible.  Load into
+    /// the specified `results` the result of the assignment of each queue,
+    /// in the order of `uris`.  This method is called only on the leader
+    /// node.
+    ///
+    /// THREAD: This method is invoked in the associated cluster's
+    ///         dispatcher thread.
+    virtual void
+    assignQueues(bsl::vector<QueueAssignmentResult::Enum>* results,
+                 const bsl::vector<bmqt::Uri>&             uris) = 0;
+
     /// Register a queue info for the queue with the specified `uri`,
     /// `partitionId`, `queueKey` and the optionally specified `appIdInfos`.
     /// If no `appIdInfos` is specified, use the appId infos from the domain
@@ -345,6 +363,16 @@ class ClusterStateManager {
     processQueueAssignmentRequest(const bmqp_ctrlmsg::ControlMessage& request,
                                   mqbnet::ClusterNode* requester) = 0;
 
+    /// Process the queue assignments in the specified `requests`, each
+    /// received from its associated requester, as per
+    /// `processQueueAssignmentRequest`, but assigning the queues with a
+    /// single queue assignment advisory whenever possible.
+    ///
+    /// THREAD: This method is invoked in the associated cluster's
+    ///         dispatcher thread.
+    virtual void processQueueAssignmentRequests(
+        const QueueAssignmentRequests& requests) = 0;
+
     /// Process the specified queue assignment advisory `message` from the
     /// specified `source`.  If the specified `delayed` is true, the
     /// advisory has previously been delayed for processing.
@@ -129,7 +129,9 @@
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_nullptr.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 
@@ -342,7 +344,10 @@ class Dispatcher {
     // CLASS METHODS
 
     /// Convenient utility to convert the specified `functor` from a
-    /// `VoidFunctor` into a `ProcessorFunctor` type.
+    /// `VoidFunctor` into a `ProcessorFunctor` type.  Note that the
+    /// conversion wraps `functor` into a new function object, which
+    /// requires an allocation: `DispatcherEvent::setVoidCallback` should be
+    /// preferred when populating an event.
     static ProcessorFunctor voidToProcessorFunctor(const VoidFunctor& functor);
 
   public:
@@ -496,9 +501,14 @@ class DispatcherDispatcherEvent {
 
     // ACCESSORS
 
-    /// Return a reference not offering modifiable access to the callback
-    /// associated to this event.
-    virtual const Dispatcher::ProcessorFunctor& callback() const = 0;
+    /// Return true if a callback is associated to this event, and false
+    /// otherwise.
+    virtual bool hasCallback() const = 0;
+
+    /// Invoke the callback associated to this event with the specified
+    /// `processor`.  The behavior is undefined unless `hasCallback()`.
+    virtual void
+    invokeCallback(const Dispatcher::ProcessorHandle& processor) const = 0;
 
     /// Return a reference not offering modifiable access to the finalize
     /// callback, if any, associated to this event.
@@ -520,9 +530,14 @@ class DispatcherCallbackEvent {
 
     // ACCESSORS
 
-    /// Return a reference not offering modifiable access to the callback
-    /// associated to this event.
-    virtual const Dispatcher::ProcessorFunctor& callback() const = 0;
+    /// Return true if a callback is associated to this event, and false
+    /// otherwise.
+    virtual bool hasCallback() const = 0;
+
+    /// Invoke the callback associated to this event with the specified
+    /// `processor`.  The behavior is undefined unless `hasCallback()`.
+    virtual void
+    invokeCallback(const Dispatcher::ProcessorHandle& processor) const = 0;
 };
 
 // ===================================
@@ -736,6 +751,11 @@ class DispatcherPutEvent {
     virtual bsls::Types::Uint64 genCount() const = 0;
 
     virtual const bsl::shared_ptr<mwcu::AtomicState>& state() const = 0;
+
+    /// Return the high resolution timepoint at which the message of this
+    /// event was posted, if it was sampled for latency tracing, or 0
+    /// otherwise.
+    virtual bsls::Types::Int64 traceTimepoint() const = 0;
 };
 
 // ========================
@@ -935,6 +955,13 @@ class DispatcherEvent : public DispatcherDispatcherEvent,
     Dispatcher::ProcessorFunctor d_callback;
     // Callback embedded in this event.
 
+    Dispatcher::VoidFunctor d_voidCallback;
+    // Callback, not taking the processor
+    // as argument, embedded in this event.
+    // It is stored as is instead of being
+    // wrapped into a 'ProcessorFunctor',
+    // which would require an allocation.
+
     mqbnet::ClusterNode* d_clusterNode_p;
     // 'ClusterNode' associated to this
     // event.
@@ -1001,6 +1028,18 @@ class DispatcherEvent : public DispatcherDispatcherEvent,
 
     bsl::shared_ptr<mwcu::AtomicState> d_state;
 
+    bsls::Types::Int64 d_traceTimepoint;
+    // High resolution timepoint at which
+    // the message in this event was
+    // posted, if it was sampled for
+    // latency tracing, or 0 otherwise.
+
+    bsls::Types::Int64 d_enqueueTime;
+    // High resolution timepoint at which
+    // this event was enqueued to a
+    // processor of the dispatcher, if
+    // recorded, or 0 otherwise.
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(DispatcherEvent, bslma::UsesBslmaAllocator)
@@ -1027,7 +1066,9 @@ class DispatcherEvent : public DispatcherDispatcherEvent,
     const bmqp::AckMessage& ackMessage() const BSLS_KEYWORD_OVERRIDE;
     const bsl::shared_ptr<bdlbb::Blob>& blob() const BSLS_KEYWORD_OVERRIDE;
     const bsl::shared_ptr<bdlbb::Blob>& options() const BSLS_KEYWORD_OVERRIDE;
-    const Dispatcher::ProcessorFunctor& callback() const BSLS_KEYWORD_OVERRIDE;
+    bool hasCallback() const BSLS_KEYWORD_OVERRIDE;
+    void invokeCallback(const Dispatcher::ProcessorHandle& processor) const
+        BSLS_KEYWORD_OVERRIDE;
     mqbnet::ClusterNode*        clusterNode() const BSLS_KEYWORD_OVERRIDE;
     const bmqp::ConfirmMessage& confirmMessage() const BSLS_KEYWORD_OVERRIDE;
     const bmqp::RejectMessage&  rejectMessage() const BSLS_KEYWORD_OVERRIDE;
@@ -1053,7 +1094,8 @@ class DispatcherEvent : public DispatcherDispatcherEvent,
     // DispatcherEvent view interfaces for more specific information.
 
     const bsl::shared_ptr<mwcu::AtomicState>&
-    state() const BSLS_KEYWORD_OVERRIDE;
+                       state() const BSLS_KEYWORD_OVERRIDE;
+    bsls::Types::Int64 traceTimepoint() const BSLS_KEYWORD_OVERRIDE;
 
   public:
     // MANIPULATORS
@@ -1064,6 +1106,7 @@ class DispatcherEvent : public DispatcherDispatcherEvent,
     DispatcherEvent& setBlob(const bsl::shared_ptr<bdlbb::Blob>& value);
     DispatcherEvent& setOptions(const bsl::shared_ptr<bdlbb::Blob>& value);
     DispatcherEvent& setCallback(const Dispatcher::ProcessorFunctor& value);
+    DispatcherEvent& setVoidCallback(const Dispatcher::VoidFunctor& value);
     DispatcherEvent& setClusterNode(mqbnet::ClusterNode* value);
     DispatcherEvent& setConfirmMessage(const bmqp::ConfirmMessage& value);
     DispatcherEvent& setRejectMessage(const bmqp::RejectMessage& value);
@@ -1094,6 +1137,17 @@ class DispatcherEvent : public DispatcherDispatcherEvent,
 
     DispatcherEvent& setState(const bsl::shared_ptr<mwcu::AtomicState>& state);
 
+    /// Set the timepoint at which the message of this PUT event was posted
+    /// to the specified `value`, to trace its latency through the broker.
+    /// A `value` of 0 indicates that the message is not traced.
+    DispatcherEvent& setTraceTimepoint(bsls::Types::Int64 value);
+
+    /// Set the high resolution timepoint at which this event was enqueued
+    /// to a processor of the dispatcher to the specified `value`, to
+    /// measure the time it waited in the queue of the processor.  A `value`
+    /// of 0 indicates that the time is not recorded.
+    DispatcherEvent& setEnqueueTime(bsls::Types::Int64 value);
+
     /// Reset all members of this `DispatcherEvent` to a default value.
     void reset();
 
@@ -1110,6 +1164,11 @@ class DispatcherEvent : public DispatcherDispatcherEvent,
     /// event.
     DispatcherClient* destination() const;
 
+    /// Return the high resolution timepoint at which this event was
+    /// enqueued to a processor of the dispatcher, or 0 if it was not
+    /// recorded.
+    bsls::Types::Int64 enqueueTime() const;
+
     const DispatcherDispatcherEvent*     asDispatcherEvent() const;
     const DispatcherControlMessageEvent* asControlMessageEvent() const;
     const DispatcherCallbackEvent*       asCallbackEvent() const;
@@ -1157,9 +1216,12 @@ class DispatcherClientData {
     DispatcherClientType::Enum d_clientType;
     // Type of dispatcher client.
 
-    Dispatcher::ProcessorHandle d_processorHandle;
+    bsls::AtomicInt d_processorHandle;
     // Processor handle to which the client is
-    // associated with.
+    // associated with.  Atomic as it may be
+    // changed by the dispatcher moving the
+    // client to another processor, while read
+    // by other threads.
 
     bool d_addedToFlushList;
     // Flag indicating whether the dispatcher
@@ -1178,12 +1240,27 @@ class DispatcherClientData {
     /// Default constructor
     explicit DispatcherClientData();
 
+    /// Copy constructor
+    DispatcherClientData(const DispatcherClientData& other);
+
     // MANIPULATORS
+
+    /// Assignment operator
+    DispatcherClientData& operator=(const DispatcherClientData& rhs);
+
     DispatcherClientData& setClientType(DispatcherClientType::Enum value);
     DispatcherClientData&
     setProcessorHandle(Dispatcher::ProcessorHandle value);
     DispatcherClientData& setAddedToFlushList(bool value);
 
+    /// Move the client to the processor having the specified `value`
+    /// handle and return a reference offering modifiable access to this
+    /// object.  This is reserved to the dispatcher, when stealing the
+    /// client from its current processor.  The behavior is undefined unless
+    /// a valid processor handle was set.
+    DispatcherClientData&
+    migrateProcessorHandle(Dispatcher::ProcessorHandle value);
+
     /// Set the corresponding member to the specified `value` and return a
     /// reference offering modifiable access to this object.
     DispatcherClientData& setDispatcher(Dispatcher* value);
@@ -1284,6 +1361,7 @@ inline DispatcherEvent::DispatcherEvent(bslma::Allocator* allocator)
 , d_blob_sp(0, allocator)
 , d_options_sp(0, allocator)
 , d_callback(bsl::allocator_arg, allocator)
+, d_voidCallback(bsl::allocator_arg, allocator)
 , d_clusterNode_p(0)
 , d_confirmMessage()
 , d_rejectMessage()
@@ -1300,6 +1378,8 @@ inline DispatcherEvent::DispatcherEvent(bslma::Allocator* allocator)
 , d_messagePropertiesInfo()
 , d_compressionAlgorithmType(bmqt::CompressionAlgorithmType::e_NONE)
 , d_genCount(0)
+, d_traceTimepoint(0)
+, d_enqueueTime(0)
 {
     // NOTHING
 }
@@ -1319,9 +1399,24 @@ inline const bsl::shared_ptr<bdlbb::Blob>& DispatcherEvent::options() const
     return d_options_sp;
 }
 
-inline const Dispatcher::ProcessorFunctor& DispatcherEvent::callback() const
+inline bool DispatcherEvent::hasCallback() const
 {
-    return d_callback;
+    return d_callback || d_voidCallback;
+}
+
+inline void DispatcherEvent::invokeCallback(
+    const Dispatcher::ProcessorHandle& processor) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(hasCallback());
+    BSLS_ASSERT_SAFE(!(d_callback && d_voidCallback));
+
+    if (d_voidCallback) {
+        d_voidCallback();
+    }
+    else {
+        d_callback(processor);
+    }
 }
 
 inline mqbnet::ClusterNode* DispatcherEvent::clusterNode() const
@@ -1413,6 +1508,11 @@ inline const bsl::shared_ptr<mwcu::AtomicState>& DispatcherEvent::state() const
     return d_state;
 }
 
+inline bsls::Types::Int64 DispatcherEvent::traceTimepoint() const
+{
+    return d_traceTimepoint;
+}
+
 inline DispatcherEvent&
 DispatcherEvent::setType(DispatcherEventType::Enum value)
 {
@@ -1461,6 +1561,13 @@ DispatcherEvent::setCallback(const Dispatcher::ProcessorFunctor& value)
     return *this;
 }
 
+inline DispatcherEvent&
+DispatcherEvent::setVoidCallback(const Dispatcher::VoidFunctor& value)
+{
+    d_voidCallback = value;
+    return *this;
+}
+
 inline DispatcherEvent&
 DispatcherEvent::setClusterNode(mqbnet::ClusterNode* value)
 {
@@ -1576,6 +1683,20 @@ DispatcherEvent::setState(const bsl::shared_ptr<mwcu::AtomicState>& state)
     return *this;
 }
 
+inline DispatcherEvent&
+DispatcherEvent::setTraceTimepoint(bsls::Types::Int64 value)
+{
+    d_traceTimepoint = value;
+    return *this;
+}
+
+inline DispatcherEvent&
+DispatcherEvent::setEnqueueTime(bsls::Types::Int64 value)
+{
+    d_enqueueTime = value;
+    return *this;
+}
+
 inline void DispatcherEvent::reset()
 {
     d_type          = DispatcherEventType::e_UNDEFINED;
@@ -1585,6 +1706,7 @@ inline void DispatcherEvent::reset()
     d_blob_sp.reset();
     d_options_sp.reset();
     d_callback         = bsl::nullptr_t();
+    d_voidCallback     = bsl::nullptr_t();
     d_clusterNode_p    = 0;
     d_confirmMessage   = bmqp::ConfirmMessage();
     d_rejectMessage    = bmqp::RejectMessage();
@@ -1600,6 +1722,8 @@ inline void DispatcherEvent::reset()
     d_compressionAlgorithmType = bmqt::CompressionAlgorithmType::e_NONE;
     d_genCount                 = 0;
     d_state.reset();
+    d_traceTimepoint = 0;
+    d_enqueueTime    = 0;
 }
 
 inline DispatcherEventType::Enum DispatcherEvent::type() const
@@ -1617,6 +1741,11 @@ inline DispatcherClient* DispatcherEvent::destination() const
     return d_destination_p;
 }
 
+inline bsls::Types::Int64 DispatcherEvent::enqueueTime() const
+{
+    return d_enqueueTime;
+}
+
 inline const DispatcherDispatcherEvent*
 DispatcherEvent::asDispatcherEvent() const
 {
@@ -1729,6 +1858,29 @@ inline DispatcherClientData::DispatcherClientData()
     // NOTHING
 }
 
+inline DispatcherClientData::DispatcherClientData(
+    const DispatcherClientData& other)
+: d_clientType(other.d_clientType)
+, d_processorHandle(other.d_processorHandle.loadAcquire())
+, d_addedToFlushList(other.d_addedToFlushList)
+, d_dispatcher_p(other.d_dispatcher_p)
+{
+    // NOTHING
+}
+
+inline DispatcherClientData&
+DispatcherClientData::operator=(const DispatcherClientData& rhs)
+{
+    if (this != &rhs) {
+        d_clientType = rhs.d_clientType;
+        d_processorHandle.storeRelease(rhs.d_processorHandle.loadAcquire());
+        d_addedToFlushList = rhs.d_addedToFlushList;
+        d_dispatcher_p     = rhs.d_dispatcher_p;
+    }
+
+    return *this;
+}
+
 inline DispatcherClientData&
 DispatcherClientData::setClientType(DispatcherClientType::Enum value)
 {
@@ -1745,11 +1897,24 @@ DispatcherClientData::setProcessorHandle(Dispatcher::ProcessorHandle value)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(
-        (d_processorHandle == Dispatcher::k_INVALID_PROCESSOR_HANDLE ||
+        (d_processorHandle.loadRelaxed() ==
+             Dispatcher::k_INVALID_PROCESSOR_HANDLE ||
          value == Dispatcher::k_INVALID_PROCESSOR_HANDLE) &&
         "Processor handle can only be set once");
 
-    d_processorHandle = value;
+    d_processorHandle.storeRelease(value);
+    return *this;
+}
+
+inline DispatcherClientData&
+DispatcherClientData::migrateProcessorHandle(Dispatcher::ProcessorHandle value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_processorHandle.loadRelaxed() !=
+                     Dispatcher::k_INVALID_PROCESSOR_HANDLE);
+    BSLS_ASSERT_SAFE(value != Dispatcher::k_INVALID_PROCESSOR_HANDLE);
+
+    d_processorHandle.storeRelease(value);
     return *this;
 }
 
@@ -1780,7 +1945,7 @@ inline DispatcherClientType::Enum DispatcherClientData::clientType() const
 inline Dispatcher::ProcessorHandle
 DispatcherClientData::processorHandle() const
 {
-    return d_processorHandle;
+    return d_processorHandle.loadAcquire();
 }
 
 inline bool DispatcherClientData::addedToFlushList() const
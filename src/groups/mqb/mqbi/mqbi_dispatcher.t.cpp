@@ -0,0 +1,138 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbi_dispatcher.t.cpp                                              -*-C++-*-
+#include <mqbi_dispatcher.h>
+
+// BDE
+#include <bsl_functional.h>
+#include <bslma_testallocator.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Number of invocations of `voidCallback`.
+int s_numVoidCalls = 0;
+
+/// Processor the `processorCallback` was last invoked with.
+int s_lastProcessor = -1;
+
+void voidCallback()
+{
+    ++s_numVoidCalls;
+}
+
+void processorCallback(const mqbi::Dispatcher::ProcessorHandle& processor)
+{
+    s_lastProcessor = processor;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_eventCallback()
+// ------------------------------------------------------------------------
+// EVENT CALLBACK
+//
+// Concerns:
+//   1. A 'VoidFunctor' callback is invoked as is, ignoring the processor.
+//   2. A 'ProcessorFunctor' callback is invoked with the processor.
+//   3. Setting a 'VoidFunctor' callback on an event does not allocate
+//      when the target of the functor fits in its inline storage.
+//   4. 'reset' clears both callbacks.
+//
+// Testing:
+//   DispatcherEvent::setVoidCallback
+//   DispatcherEvent::setCallback
+//   DispatcherEvent::hasCallback
+//   DispatcherEvent::invokeCallback
+//   DispatcherEvent::reset
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("EVENT CALLBACK");
+
+    bslma::TestAllocator  ta("event", s_allocator_p);
+    mqbi::DispatcherEvent event(&ta);
+
+    ASSERT(!event.hasCallback());
+
+    {
+        PVV("VoidFunctor callback");
+
+        const mqbi::Dispatcher::VoidFunctor callback(bsl::allocator_arg,
+                                                     &ta,
+                                                     &voidCallback);
+
+        const bsls::Types::Int64 numAllocations = ta.numAllocations();
+        event.setType(mqbi::DispatcherEventType::e_CALLBACK)
+            .setVoidCallback(callback);
+        ASSERT_EQ(ta.numAllocations(), numAllocations);
+
+        ASSERT(event.asCallbackEvent()->hasCallback());
+        event.asCallbackEvent()->invokeCallback(3);
+        ASSERT_EQ(s_numVoidCalls, 1);
+        ASSERT_EQ(s_lastProcessor, -1);
+
+        event.reset();
+        ASSERT(!event.hasCallback());
+    }
+
+    {
+        PVV("ProcessorFunctor callback");
+
+        event.setType(mqbi::DispatcherEventType::e_DISPATCHER)
+            .setCallback(&processorCallback);
+
+        ASSERT(event.asDispatcherEvent()->hasCallback());
+        event.asDispatcherEvent()->invokeCallback(5);
+        ASSERT_EQ(s_numVoidCalls, 1);
+        ASSERT_EQ(s_lastProcessor, 5);
+
+        event.reset();
+        ASSERT(!event.hasCallback());
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 1: test1_eventCallback(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
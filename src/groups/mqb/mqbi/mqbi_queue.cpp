@@ -82,6 +82,22 @@ QueueHandle::StreamInfo::StreamInfo(const StreamInfo& other,
 {
     // NOTHING
 }
+
+// -----------------------------
+// class QueueHandle::PutMessage
+// -----------------------------
+
+QueueHandle::PutMessage::PutMessage(
+    const bmqp::PutHeader&              header,
+    const bsl::shared_ptr<bdlbb::Blob>& appData,
+    const bsl::shared_ptr<bdlbb::Blob>& options)
+: d_header(header)
+, d_appData(appData)
+, d_options(options)
+{
+    // NOTHING
+}
+
 // -----------------
 // class QueueHandle
 // -----------------
@@ -91,6 +107,25 @@ QueueHandle::~QueueHandle()
     // NOTHING
 }
 
+// ------------------------
+// class Queue::PushMessage
+// ------------------------
+
+Queue::PushMessage::PushMessage(
+    const bmqt::MessageGUID&             guid,
+    const bsl::shared_ptr<bdlbb::Blob>&  appData,
+    const bsl::shared_ptr<bdlbb::Blob>&  options,
+    const bmqp::MessagePropertiesInfo&   mpsInfo,
+    bmqt::CompressionAlgorithmType::Enum compressionType)
+: d_guid(guid)
+, d_appData(appData)
+, d_options(options)
+, d_messagePropertiesInfo(mpsInfo)
+, d_compressionAlgorithmType(compressionType)
+{
+    // NOTHING
+}
+
 // -----------
 // class Queue
 // -----------
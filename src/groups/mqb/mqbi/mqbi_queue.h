@@ -53,6 +53,7 @@
 #include <mqbi_storage.h>
 
 // BMQ
+#include <bmqp_compressiondictionary.h>
 #include <bmqp_ctrlmsg_messages.h>
 #include <bmqp_protocol.h>
 #include <bmqp_queueid.h>
@@ -72,6 +73,7 @@
 #include <bsl_ostream.h>
 #include <bsl_string.h>
 #include <bsl_unordered_set.h>
+#include <bsl_vector.h>
 #include <bslh_hash.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
@@ -364,20 +366,21 @@ bsl::ostream& operator<<(bsl::ostream&                   stream,
 // =============================
 
 /// VST containing information about a message that has been pushed but not
-/// yet confirmed.
+/// yet confirmed.  Note that a queue handle keeps one such object per
+/// unconfirmed message, so the members are ordered to avoid any padding.
 struct UnconfirmedMessageInfo {
     // DATA
+    bsls::Types::Int64 d_timeStamp;  // The time when the message was pushed
+                                     // to the downstream, in absolute
+                                     // nanoseconds referenced to an
+                                     // arbitrary but fixed origin.
+
     unsigned int d_size;  // The associated message size in bytes
                           // (using 'unsigned int' and not Int64
                           // since per bmqp protocol, an
                           // individual message size is limited
                           // to 1GB).
 
-    bsls::Types::Int64 d_timeStamp;  // The time when the message was pushed
-                                     // to the downstream, in absolute
-                                     // nanoseconds referenced to an
-                                     // arbitrary but fixed origin.
-
     unsigned int d_subscriptionId;
 
     // CREATORS
@@ -457,6 +460,21 @@ class QueueHandle {
     /// Map `appId` to downstream `subId` and read/write counts.
     typedef bsl::unordered_map<const bsl::string, StreamInfo> SubStreams;
 
+    /// PUT message posted to the queue as part of a batch (see
+    /// `postMessages`).
+    struct PutMessage {
+        bmqp::PutHeader              d_header;
+        bsl::shared_ptr<bdlbb::Blob> d_appData;
+        bsl::shared_ptr<bdlbb::Blob> d_options;
+
+        PutMessage(const bmqp::PutHeader&              header,
+                   const bsl::shared_ptr<bdlbb::Blob>& appData,
+                   const bsl::shared_ptr<bdlbb::Blob>& options);
+    };
+
+    /// Batch of PUT messages, in the order they must be posted.
+    typedef bsl::vector<PutMessage> PutMessages;
+
   public:
     // CREATORS
 
@@ -522,6 +540,18 @@ class QueueHandle {
                              const bsl::shared_ptr<bdlbb::Blob>& appData,
                              const bsl::shared_ptr<bdlbb::Blob>& options) = 0;
 
+    /// Post the specified `messages` to the queue, in order, as if by
+    /// calling `postMessage` for each of them, but using a single event to
+    /// hand them over to the Queue's dispatcher thread.  The behavior is
+    /// undefined unless `messages` is not empty and is not modified after
+    /// this call.
+    ///
+    /// THREAD: this method can be called from any thread and is responsible
+    ///         for calling the corresponding method on the `Queue`, on the
+    ///         Queue's dispatcher thread.
+    virtual void
+    postMessages(const bsl::shared_ptr<PutMessages>& messages) = 0;
+
     /// Confirm the message with the specified `msgGUID` for the specified
     /// `subQueueId` stream of the queue.
     ///
@@ -531,6 +561,20 @@ class QueueHandle {
     virtual void confirmMessage(const bmqt::MessageGUID& msgGUID,
                                 unsigned int             subQueueId) = 0;
 
+    /// Confirm the specified `count` messages starting with the one having
+    /// the specified `msgGUID`, each subsequent message having the GUID
+    /// following the one of the previous message (see
+    /// `bmqp::MessageGUIDGenerator::loadNextGUID`), for the specified
+    /// `subQueueId` stream of the queue.  The behavior is undefined unless
+    /// `0 < count`.
+    ///
+    /// THREAD: this method can be called from any thread and is responsible
+    ///         for calling the corresponding method on the `Queue`, on the
+    ///         Queue's dispatcher thread.
+    virtual void confirmMessageRange(const bmqt::MessageGUID& msgGUID,
+                                     int                      count,
+                                     unsigned int             subQueueId) = 0;
+
     /// Reject the message with the specified `msgGUID` for the specified
     /// `subQueueId` stream of the queue.
     ///
@@ -588,6 +632,16 @@ class QueueHandle {
         const bmqp::Protocol::MsgGroupId&         msgGroupId,
         const bmqp::Protocol::SubQueueInfosArray& subscriptions) = 0;
 
+    /// Dispatch to the client the messages delivered to this handle (see
+    /// `deliverMessage` and `deliverMessageNoTrack`) since the last call to
+    /// this method.  Implementations may accumulate delivered messages and
+    /// hand them over to the client at once, so the `Queue` must call this
+    /// method at the end of each delivery pass, before yielding its
+    /// dispatcher thread.
+    ///
+    /// THREAD: This method is called from the Queue's dispatcher thread.
+    virtual void flushDeliveries() = 0;
+
     /// Used by the client to configure a given queue handle with the
     /// specified `streamParameters`.  Invoke the specified `configuredCb`
     /// when done.
@@ -624,6 +678,16 @@ class QueueHandle {
     /// Clear the client associated with this queue handle.
     virtual void clearClient(bool hasLostClient) = 0;
 
+    /// Used by the client to indicate, per the specified `value`, whether
+    /// it is throttled, i.e. whether it is currently unable to write the
+    /// messages delivered to it to its channel.  No message is delivered to
+    /// a throttled client (see `canDeliver`), so that the messages remain
+    /// in the queue rather than in the client's memory, and a delivery is
+    /// scheduled once the client is no longer throttled.
+    ///
+    /// THREAD: this method can be called from any thread.
+    virtual void setClientThrottled(bool value) = 0;
+
     /// Transfer into the specified `out`, the GUID of all messages
     /// associated with the specified `subQueueId` which were delivered to
     /// the client, but that haven't yet been confirmed by it (i.e. the
@@ -723,6 +787,28 @@ class QueueHandle {
 
 /// Interface for a Queue.
 class Queue : public DispatcherClient {
+  public:
+    // PUBLIC TYPES
+
+    /// PUSH message received from upstream as part of a batch (see
+    /// `onPushMessages`).
+    struct PushMessage {
+        bmqt::MessageGUID                    d_guid;
+        bsl::shared_ptr<bdlbb::Blob>         d_appData;
+        bsl::shared_ptr<bdlbb::Blob>         d_options;
+        bmqp::MessagePropertiesInfo          d_messagePropertiesInfo;
+        bmqt::CompressionAlgorithmType::Enum d_compressionAlgorithmType;
+
+        PushMessage(const bmqt::MessageGUID&             guid,
+                    const bsl::shared_ptr<bdlbb::Blob>&  appData,
+                    const bsl::shared_ptr<bdlbb::Blob>&  options,
+                    const bmqp::MessagePropertiesInfo&   mpsInfo,
+                    bmqt::CompressionAlgorithmType::Enum compressionType);
+    };
+
+    /// Batch of PUSH messages, in the order they were received.
+    typedef bsl::vector<PushMessage> PushMessages;
+
   public:
     // CREATORS
 
@@ -813,6 +899,13 @@ class Queue : public DispatcherClient {
         const bmqp::MessagePropertiesInfo&   messagePropertiesInfo,
         bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType) = 0;
 
+    /// Called when the specified `messages` are pushed to this queue.  This
+    /// method has the same effect as calling `onPushMessage` for each of
+    /// the `messages`, in order, but implementations may process the whole
+    /// batch at once.
+    virtual void
+    onPushMessages(const bsl::shared_ptr<PushMessages>& messages) = 0;
+
     /// Confirm the message with the specified `msgGUID` for the specified
     /// `upstreamSubQueueId` stream of the queue on behalf of the client
     /// identified by the specified `source`.  Also note that since there
@@ -824,6 +917,20 @@ class Queue : public DispatcherClient {
                                 unsigned int             upstreamSubQueueId,
                                 QueueHandle*             source) = 0;
 
+    /// Confirm the specified `count` messages starting with the one having
+    /// the specified `msgGUID`, each subsequent message having the GUID
+    /// following the one of the previous message (see
+    /// `bmqp::MessageGUIDGenerator::loadNextGUID`), for the specified
+    /// `upstreamSubQueueId` stream of the queue on behalf of the client
+    /// identified by the specified `source`.  The behavior is undefined
+    /// unless `0 < count`.
+    ///
+    /// THREAD: This method is called from the Queue's dispatcher thread.
+    virtual void confirmMessageRange(const bmqt::MessageGUID& msgGUID,
+                                     int                      count,
+                                     unsigned int upstreamSubQueueId,
+                                     QueueHandle* source) = 0;
+
     /// Reject the message with the specified `msgGUID` for the specified
     /// `upstreamSubQueueId` stream of the queue on the specified `source`.
     ///  Return resulting RDA counter.
@@ -949,6 +1056,11 @@ class Queue : public DispatcherClient {
 
     /// Return the Schema Leaner associated with this queue.
     virtual bmqp::SchemaLearner& schemaLearner() const = 0;
+
+    /// Return the trainer of the ZSTD compression dictionary associated
+    /// with this queue.
+    virtual const bsl::shared_ptr<bmqp::CompressionDictionaryTrainer>&
+    compressionDictionaryTrainer() const = 0;
 };
 
 // ========================
@@ -1019,8 +1131,8 @@ inline UnconfirmedMessageInfo::UnconfirmedMessageInfo(
     unsigned int       size,
     bsls::Types::Int64 timeStamp,
     unsigned int       subscription)
-: d_size(size)
-, d_timeStamp(timeStamp)
+: d_timeStamp(timeStamp)
+, d_size(size)
 , d_subscriptionId(subscription)
 {
     // NOTHING
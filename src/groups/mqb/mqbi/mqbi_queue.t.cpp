@@ -18,15 +18,23 @@
 
 // BMQ
 #include <bmqp_ctrlmsg_messages.h>
+#include <bmqt_messageguid.h>
 
 // BDE
 #include <bsl_cstdlib.h>
 #include <bsl_ctime.h>
+#include <bsl_cstring.h>
 #include <bsl_functional.h>
+#include <bsl_iostream.h>
 #include <bsl_string.h>
+#include <bsl_unordered_map.h>  // for performance comparison test
 #include <bsl_unordered_set.h>
 #include <bsl_utility.h>
+#include <bsl_vector.h>
 #include <bslh_defaulthashalgorithm.h>
+#include <bslh_hash.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
 
 // TEST DRIVER
 #include <mwctst_testhelper.h>
@@ -52,6 +60,60 @@ int generateRandomInteger(int min, int max)
     return min + (bsl::rand() % (max - min + 1));
 }
 
+/// Load into the specified `guids` the specified `count` distinct GUIDs.
+void generateGuids(bsl::vector<bmqt::MessageGUID>* guids, int count)
+{
+    guids->reserve(count);
+    for (int i = 0; i < count; ++i) {
+        unsigned char buffer[bmqt::MessageGUID::e_SIZE_BINARY];
+        bsl::memset(buffer, 0, sizeof(buffer));
+        bsl::memcpy(buffer + 1, &i, sizeof(i));
+
+        bmqt::MessageGUID guid;
+        guid.fromBinary(buffer);
+        guids->push_back(guid);
+    }
+}
+
+/// Benchmark the specified `map` through the access pattern of the
+/// unconfirmed messages of a queue handle, using the specified `guids`:
+/// insert all messages as they are pushed, confirm (erase) every other
+/// message, and then redeliver (iterate over and clear) the remaining ones.
+/// Print the time taken by each phase, prefixed by the specified `name`.
+template <class MAP>
+void benchmarkUnconfirmedMessages(MAP*                                  map,
+                                  const bsl::vector<bmqt::MessageGUID>& guids,
+                                  const char*                           name)
+{
+    const int k_NUM_ELEMENTS = static_cast<int>(guids.size());
+
+    bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+    for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+        map->insert(bsl::make_pair(guids[i],
+                                   mqbi::UnconfirmedMessageInfo(1024, i, 0)));
+    }
+    bsls::Types::Int64 end = bsls::TimeUtil::getTimer();
+    cout << name << " insert   : " << (end - begin) << endl;
+
+    begin = bsls::TimeUtil::getTimer();
+    for (int i = 0; i < k_NUM_ELEMENTS; i += 2) {
+        map->erase(guids[i]);
+    }
+    end = bsls::TimeUtil::getTimer();
+    cout << name << " confirm  : " << (end - begin) << endl;
+
+    begin                    = bsls::TimeUtil::getTimer();
+    bsls::Types::Int64 total = 0;
+    for (typename MAP::const_iterator it = map->begin(); it != map->end();
+         ++it) {
+        total += it->second.d_size;
+    }
+    map->clear();
+    end = bsls::TimeUtil::getTimer();
+    cout << name << " redeliver: " << (end - begin) << " (" << total
+         << " bytes)" << endl;
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -143,12 +205,70 @@ static void test1_hashAppendSubQueueIdInfo()
     }
 }
 
+static void test2_unconfirmedMessageInfo()
+// ------------------------------------------------------------------------
+// UNCONFIRMED MESSAGE INFO
+//
+// Concerns:
+//   1. 'UnconfirmedMessageInfo', of which a queue handle keeps one per
+//      unconfirmed message, has no padding.
+//   2. The constructor sets all the members.
+//
+// Testing:
+//   UnconfirmedMessageInfo
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("UNCONFIRMED MESSAGE INFO");
+
+    ASSERT_EQ(sizeof(mqbi::UnconfirmedMessageInfo),
+              sizeof(bsls::Types::Int64) + 2 * sizeof(unsigned int));
+
+    const mqbi::UnconfirmedMessageInfo obj(1024, 123456789, 7);
+    ASSERT_EQ(obj.d_size, 1024U);
+    ASSERT_EQ(obj.d_timeStamp, 123456789);
+    ASSERT_EQ(obj.d_subscriptionId, 7U);
+}
+
+static void testN1_unconfirmedMessagesPerformance()
+// ------------------------------------------------------------------------
+// UNCONFIRMED MESSAGES PERFORMANCE
+//
+// Compare the insert, confirm and redeliver throughputs of the map used by
+// queue handles to track unconfirmed messages with 'bsl::unordered_map'.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("UNCONFIRMED MESSAGES PERFORMANCE");
+
+    const int k_NUM_ELEMENTS = 1000000;
+
+    bsl::vector<bmqt::MessageGUID> guids(s_allocator_p);
+    generateGuids(&guids, k_NUM_ELEMENTS);
+
+    {
+        mqbi::QueueHandle::UnconfirmedMessageInfoMap map(s_allocator_p);
+        benchmarkUnconfirmedMessages(&map, guids, "OrderedHashMap");
+    }
+
+    {
+        typedef bsl::unordered_map<bmqt::MessageGUID,
+                                   mqbi::UnconfirmedMessageInfo,
+                                   bslh::Hash<bmqt::MessageGUIDHashAlgo> >
+            MapType;
+
+        MapType map(s_allocator_p);
+        benchmarkUnconfirmedMessages(&map, guids, "unordered_map ");
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
 
 int main(int argc, char* argv[])
 {
+    // One time initialization
+    bsls::TimeUtil::initialize();
+
     TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
 
     unsigned int seed = bsl::time(NULL);
@@ -157,7 +277,9 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 2: test2_unconfirmedMessageInfo(); break;
     case 1: test1_hashAppendSubQueueIdInfo(); break;
+    case -1: testN1_unconfirmedMessagesPerformance(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
@@ -18,8 +18,12 @@
 
 #include <mqbscm_version.h>
 // BMQ
+#include <bmqp_messageguidgenerator.h>
 #include <bmqp_queueid.h>
 
+// BDE
+#include <bsls_assert.h>
+
 namespace BloombergLP {
 namespace mqbi {
 
@@ -35,6 +39,36 @@ QueueEngine::~QueueEngine()
     // NOTHING
 }
 
+int QueueEngine::onConfirmMessageRange(
+    mqbi::QueueHandle*              handle,
+    const bmqt::MessageGUID&        msgGUID,
+    int                             count,
+    unsigned int                    upstreamSubQueueId,
+    bsl::vector<bmqt::MessageGUID>* removableGUIDs)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 < count);
+    BSLS_ASSERT_SAFE(removableGUIDs);
+
+    int               numFailed = 0;
+    bmqt::MessageGUID guid      = msgGUID;
+    for (int i = 0; i < count; ++i) {
+        if (i != 0) {
+            bmqp::MessageGUIDGenerator::loadNextGUID(&guid, guid);
+        }
+
+        const int rc = onConfirmMessage(handle, guid, upstreamSubQueueId);
+        if (rc < 0) {
+            ++numFailed;
+        }
+        else if (rc == 0) {
+            removableGUIDs->push_back(guid);
+        }
+    }
+
+    return numFailed;
+}
+
 void QueueEngine::afterAppIdRegistered(
     BSLS_ANNOTATION_UNUSED const mqbi::Storage::AppIdKeyPair& appIdKeyPair)
 {
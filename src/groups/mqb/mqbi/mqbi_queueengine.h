@@ -154,6 +154,27 @@ class QueueEngine {
                                  const bmqt::MessageGUID& msgGUID,
                                  unsigned int upstreamSubQueueId) = 0;
 
+    /// Called by the `mqbi::Queue` when the specified `count` messages
+    /// starting with the one identified by the specified `msgGUID`, each
+    /// subsequent message having the GUID following the one of the previous
+    /// message (see `bmqp::MessageGUIDGenerator::loadNextGUID`), are
+    /// confirmed for the specified `upstreamSubQueueId` stream of the queue
+    /// on behalf of the client identified by the specified `handle`.
+    /// Append to the specified `removableGUIDs` the GUIDs of the messages
+    /// for which this confirm was the last reference, and which can be
+    /// deleted from the queue's associated storage.  Return the number of
+    /// messages which failed to be confirmed (GUID was not found, etc.).
+    /// The behavior is undefined unless `0 < count`.  Note that the default
+    /// implementation calls `onConfirmMessage` for each message.
+    ///
+    /// THREAD: This method is called from the Queue's dispatcher thread.
+    virtual int
+    onConfirmMessageRange(mqbi::QueueHandle*              handle,
+                          const bmqt::MessageGUID&        msgGUID,
+                          int                             count,
+                          unsigned int                    upstreamSubQueueId,
+                          bsl::vector<bmqt::MessageGUID>* removableGUIDs);
+
     /// Called by the `mqbi::Queue` when the message identified by the
     /// specified `msgGUID` is rejected for the specified
     /// `upstreamSubQueueId` stream of the queue on behalf of the client
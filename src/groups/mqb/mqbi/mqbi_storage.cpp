@@ -62,6 +62,7 @@ const char* StorageResult::toAscii(StorageResult::Enum value)
         CASE(WRITE_FAILURE)
         CASE(APPKEY_NOT_FOUND)
         CASE(DUPLICATE)
+        CASE(READ_FAILURE)
     default: return "(* UNKNOWN *)";
     }
 
@@ -90,6 +91,7 @@ bool StorageResult::fromAscii(StorageResult::Enum*     out,
     CHECKVALUE(WRITE_FAILURE)
     CHECKVALUE(APPKEY_NOT_FOUND)
     CHECKVALUE(DUPLICATE)
+    CHECKVALUE(READ_FAILURE)
 
     // Invalid string
     return false;
@@ -111,6 +113,7 @@ bmqt::AckResult::Enum StorageResult::toAckResult(StorageResult::Enum value)
         CASE(NON_ZERO_REFERENCES, UNKNOWN)
         CASE(APPKEY_NOT_FOUND, UNKNOWN)
         CASE(WRITE_FAILURE, STORAGE_FAILURE)
+        CASE(READ_FAILURE, STORAGE_FAILURE)
         CASE(LIMIT_MESSAGES, LIMIT_MESSAGES)
         CASE(LIMIT_BYTES, LIMIT_BYTES)
         CASE(DUPLICATE, SUCCESS)
@@ -94,7 +94,8 @@ struct StorageResult {
         ,
         e_WRITE_FAILURE    = -8,
         e_APPKEY_NOT_FOUND = -9,
-        e_DUPLICATE        = -10
+        e_DUPLICATE        = -10,
+        e_READ_FAILURE     = -11
     };
 
     // CLASS METHODS
@@ -183,6 +184,15 @@ class StorageMessageAttributes {
     // compress this message i.e. the
     // application data.
 
+    bsls::Types::Uint64 d_appStates;
+    // Bitmap of the virtual storages
+    // (apps) which still hold this
+    // message, one bit per app ordinal.
+    // Maintained by the storage which
+    // owns the message; zero unless the
+    // message is held by at least one
+    // virtual storage.
+
   public:
     // CLASS METHODS
 
@@ -223,6 +233,7 @@ class StorageMessageAttributes {
     StorageMessageAttributes&
     setCompressionAlgorithmType(bmqt::CompressionAlgorithmType::Enum value);
     StorageMessageAttributes& setReceipt(bool value);
+    StorageMessageAttributes& setAppStates(bsls::Types::Uint64 value);
 
     /// Set the corresponding attribute to the specified `value` and return
     /// a reference offering modifiable access to this object.
@@ -242,6 +253,11 @@ class StorageMessageAttributes {
     /// Return the CRC32-C associated with this object.
     unsigned int                         crc32c() const;
     bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType() const;
+
+    /// Return the bitmap of the virtual storages holding the message, in
+    /// which bit `n` is set if the virtual storage having the ordinal `n`
+    /// holds it.
+    bsls::Types::Uint64 appStates() const;
 };
 
 // FREE OPERATORS
@@ -308,8 +324,11 @@ class StorageIterator {
     virtual unsigned int subscriptionId() const = 0;
 
     /// Return a reference offering non-modifiable access to the application
-    /// data associated with the item currently pointed at by this iterator.
-    /// The behavior is undefined unless `atEnd` returns `false`.
+    /// data associated with the item currently pointed at by this iterator,
+    /// or to a null pointer if the storage failed to read it (see
+    /// `StorageResult::e_READ_FAILURE`), in which case the message should
+    /// be skipped.  The behavior is undefined unless `atEnd` returns
+    /// `false`.
     virtual const bsl::shared_ptr<bdlbb::Blob>& appData() const = 0;
 
     /// Return a reference offering non-modifiable access to the options
@@ -330,6 +349,13 @@ class StorageIterator {
     /// `items` collection and the message currently pointed at by this
     /// iterator has received replication factor Receipts.
     virtual bool hasReceipt() const = 0;
+
+    /// Return the bitmap of the virtual storages holding the message
+    /// currently pointed at by this iterator (see
+    /// `StorageMessageAttributes::appStates`).  Unlike `attributes`, this
+    /// never loads the message.  The behavior is undefined unless `atEnd`
+    /// returns `false`.
+    virtual bsls::Types::Uint64 appStates() const = 0;
 };
 
 // =============
@@ -490,6 +516,22 @@ class Storage {
     /// become invalid after this method returns.
     virtual bool removeVirtualStorage(const mqbu::StorageKey& appKey) = 0;
 
+    /// Set the app states of the message having the specified `msgGUID` to
+    /// its current value with the bits in the specified `clearMask` cleared
+    /// and then the bits in the specified `setMask` set, and load the
+    /// previous value into the specified `previous`.  Return `e_SUCCESS`,
+    /// or `e_GUID_NOT_FOUND` if no message with `msgGUID` exists in this
+    /// storage.
+    virtual StorageResult::Enum
+    updateAppStates(bsls::Types::Uint64*     previous,
+                    const bmqt::MessageGUID& msgGUID,
+                    bsls::Types::Uint64      setMask,
+                    bsls::Types::Uint64      clearMask) = 0;
+
+    /// Clear the bits in the specified `mask` from the app states of every
+    /// message in this storage.
+    virtual void clearAppStates(bsls::Types::Uint64 mask) = 0;
+
     // ACCESSORS
 
     /// Return the URI of the queue this storage is associated with.
@@ -589,6 +631,14 @@ class Storage {
     /// Load into the specified `buffer` the list of pairs of appId and
     /// appKey for all the virtual storages registered with this instance.
     virtual void loadVirtualStorageDetails(AppIdKeyPairs* buffer) const = 0;
+
+    /// Load into the specified `appStates` the app states of the message
+    /// having the specified `msgGUID`.  Return `e_SUCCESS`, or
+    /// `e_GUID_NOT_FOUND`, leaving `appStates` untouched, if no message with
+    /// `msgGUID` exists in this storage.
+    virtual StorageResult::Enum
+    getAppStates(bsls::Types::Uint64*     appStates,
+                 const bmqt::MessageGUID& msgGUID) const = 0;
 };
 
 // ============================================================================
@@ -609,6 +659,7 @@ inline StorageMessageAttributes::StorageMessageAttributes()
 , d_queueHandle(0)
 , d_crc32c(0)
 , d_compressionAlgorithmType(bmqt::CompressionAlgorithmType::e_NONE)
+, d_appStates(0)
 {
 }
 
@@ -629,6 +680,7 @@ inline StorageMessageAttributes::StorageMessageAttributes(
 , d_queueHandle(queueHandle)
 , d_crc32c(crc32c)
 , d_compressionAlgorithmType(compressionAlgorithmType)
+, d_appStates(0)
 {
     // NOTHING
 }
@@ -677,6 +729,13 @@ StorageMessageAttributes::setReceipt(bool value)
     return *this;
 }
 
+inline StorageMessageAttributes&
+StorageMessageAttributes::setAppStates(bsls::Types::Uint64 value)
+{
+    d_appStates = value;
+    return *this;
+}
+
 inline StorageMessageAttributes&
 StorageMessageAttributes::setMessagePropertiesInfo(
     const bmqp::MessagePropertiesInfo& value)
@@ -695,6 +754,7 @@ inline void StorageMessageAttributes::reset()
     d_hasReceipt               = true;
     d_crc32c                   = 0;
     d_compressionAlgorithmType = bmqt::CompressionAlgorithmType::e_NONE;
+    d_appStates                = 0;
 }
 
 // ACCESSORS
@@ -740,6 +800,11 @@ StorageMessageAttributes::compressionAlgorithmType() const
     return d_compressionAlgorithmType;
 }
 
+inline bsls::Types::Uint64 StorageMessageAttributes::appStates() const
+{
+    return d_appStates;
+}
+
 // FREE OPERATORS
 inline bsl::ostream& operator<<(bsl::ostream&                   stream,
                                 const StorageMessageAttributes& value)
@@ -26,6 +26,7 @@
 #include <mqbmock_queuehandle.h>
 
 // BMQ
+#include <bmqp_messageguidgenerator.h>
 #include <bmqp_protocolutil.h>
 #include <bmqp_queueid.h>
 #include <bmqt_queueflags.h>
@@ -59,9 +60,12 @@ Queue::Queue(mqbi::Domain* domain, bslma::Allocator* allocator)
 , d_queueEngine_p(0)
 , d_storage_p(0)
 , d_schemaLearner(allocator)
+, d_compressionDictionaryTrainer_sp()
 {
     BSLS_ASSERT_SAFE(d_uri.isValid());
 
+    d_compressionDictionaryTrainer_sp.createInplace(allocator, allocator);
+
     mwcu::MemOutStream ss(allocator);
     ss << "|mock-queue|" << d_uri.asString();
     d_description.assign(ss.str());
@@ -263,6 +267,12 @@ void Queue::onPushMessage(
     // NOTHING
 }
 
+void Queue::onPushMessages(
+    BSLS_ANNOTATION_UNUSED const bsl::shared_ptr<PushMessages>& messages)
+{
+    // NOTHING
+}
+
 void Queue::confirmMessage(const bmqt::MessageGUID& msgGUID,
                            unsigned int             upstreamSubQueueId,
                            mqbi::QueueHandle*       source)
@@ -311,6 +321,20 @@ void Queue::confirmMessage(const bmqt::MessageGUID& msgGUID,
     }
 }
 
+void Queue::confirmMessageRange(const bmqt::MessageGUID& msgGUID,
+                                int                      count,
+                                unsigned int             upstreamSubQueueId,
+                                mqbi::QueueHandle*       source)
+{
+    bmqt::MessageGUID guid = msgGUID;
+    for (int i = 0; i < count; ++i) {
+        if (i != 0) {
+            bmqp::MessageGUIDGenerator::loadNextGUID(&guid, guid);
+        }
+        confirmMessage(guid, upstreamSubQueueId, source);
+    }
+}
+
 int Queue::rejectMessage(const bmqt::MessageGUID& msgGUID,
                          unsigned int             upstreamSubQueueId,
                          mqbi::QueueHandle*       source)
@@ -519,6 +543,12 @@ bmqp::SchemaLearner& Queue::schemaLearner() const
     return d_schemaLearner;
 }
 
+const bsl::shared_ptr<bmqp::CompressionDictionaryTrainer>&
+Queue::compressionDictionaryTrainer() const
+{
+    return d_compressionDictionaryTrainer_sp;
+}
+
 // -------------------
 // class HandleFactory
 // -------------------
@@ -157,6 +157,9 @@ class Queue : public mqbi::Queue {
 
     mutable bmqp::SchemaLearner d_schemaLearner;
 
+    bsl::shared_ptr<bmqp::CompressionDictionaryTrainer>
+        d_compressionDictionaryTrainer_sp;
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(Queue, bslma::UsesBslmaAllocator)
@@ -261,6 +264,9 @@ class Queue : public mqbi::Queue {
         bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType)
         BSLS_KEYWORD_OVERRIDE;
 
+    void onPushMessages(const bsl::shared_ptr<PushMessages>& messages)
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Confirm the message with the specified `msgGUID` for the specified
     /// `upstreamSubQueueId` stream of the queue on behalf of the client
     /// identified by the specified `source`.  Also note that since there
@@ -272,6 +278,19 @@ class Queue : public mqbi::Queue {
                         unsigned int             upstreamSubQueueId,
                         mqbi::QueueHandle*       source) BSLS_KEYWORD_OVERRIDE;
 
+    /// Confirm the specified `count` messages starting with the one having
+    /// the specified `msgGUID`, each subsequent message having the GUID
+    /// following the one of the previous message, for the specified
+    /// `upstreamSubQueueId` stream of the queue on behalf of the client
+    /// identified by the specified `source`, by calling `confirmMessage`
+    /// for each of them.
+    ///
+    /// THREAD: This method is called from the Queue's dispatcher thread.
+    void confirmMessageRange(const bmqt::MessageGUID& msgGUID,
+                             int                      count,
+                             unsigned int             upstreamSubQueueId,
+                             mqbi::QueueHandle* source) BSLS_KEYWORD_OVERRIDE;
+
     /// Reject the message with the specified `msgGUID` for the specified
     /// `upstreamSubQueueId` stream of the queue on the specified `source`.
     ///  Return resulting RDA counter.
@@ -424,6 +443,11 @@ class Queue : public mqbi::Queue {
     /// Return the Schema Leaner associated with this queue.
     bmqp::SchemaLearner& schemaLearner() const BSLS_KEYWORD_OVERRIDE;
 
+    /// Return the trainer of the ZSTD compression dictionary associated
+    /// with this queue.
+    const bsl::shared_ptr<bmqp::CompressionDictionaryTrainer>&
+    compressionDictionaryTrainer() const BSLS_KEYWORD_OVERRIDE;
+
     // ACCESSORS
     //   (specific to mqbi::MockQueue)
 };
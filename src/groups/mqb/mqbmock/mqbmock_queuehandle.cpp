@@ -24,6 +24,7 @@
 #include <mqbu_storagekey.h>
 
 // BMQ
+#include <bmqp_messageguidgenerator.h>
 #include <bmqt_queueflags.h>
 
 // MWC
@@ -99,6 +100,7 @@ QueueHandle::QueueHandle(
 , d_unconfirmedMessageMonitor(0, 0, 0, 0, 0, 0)
 , d_schemaLearnerContext(
       d_queue_sp ? d_queue_sp->schemaLearner().createContext() : 0)
+, d_isClientThrottled(false)
 , d_allocator_p(allocator)
 {
     // PRECONDITIONS
@@ -211,6 +213,15 @@ void QueueHandle::postMessage(
     // NOTHING
 }
 
+void QueueHandle::postMessages(const bsl::shared_ptr<PutMessages>& messages)
+{
+    for (PutMessages::const_iterator it = messages->begin();
+         it != messages->end();
+         ++it) {
+        postMessage(it->d_header, it->d_appData, it->d_options);
+    }
+}
+
 void QueueHandle::confirmMessage(const bmqt::MessageGUID& msgGUID,
                                  unsigned int             downstreamSubQueueId)
 {
@@ -234,6 +245,19 @@ void QueueHandle::confirmMessage(const bmqt::MessageGUID& msgGUID,
     // end up having two threads working on the same redelivery list.
 }
 
+void QueueHandle::confirmMessageRange(const bmqt::MessageGUID& msgGUID,
+                                      int                      count,
+                                      unsigned int downstreamSubQueueId)
+{
+    bmqt::MessageGUID guid = msgGUID;
+    for (int i = 0; i < count; ++i) {
+        if (i != 0) {
+            bmqp::MessageGUIDGenerator::loadNextGUID(&guid, guid);
+        }
+        confirmMessage(guid, downstreamSubQueueId);
+    }
+}
+
 void QueueHandle::rejectMessage(const bmqt::MessageGUID& msgGUID,
                                 unsigned int             downstreamSubQueueId)
 {
@@ -255,7 +279,7 @@ void QueueHandle::rejectMessage(const bmqt::MessageGUID& msgGUID,
 
     // If can deliver, schedule a delivery by indicating to the associated
     // queue engine that this handle is now back to being usable.
-    if (downstream.d_canDeliver) {
+    if (!d_isClientThrottled && downstream.d_canDeliver) {
         // REVISIT: make _canDeliver apply to subscription and not subQueue
         // Iterate all subscriptions meanwhile
 
@@ -320,6 +344,11 @@ void QueueHandle::deliverMessageNoTrack(
     deliverMessage(message, msgGUID, attributes, msgGroupId, subscriptions);
 }
 
+void QueueHandle::flushDeliveries()
+{
+    // NOTHING
+}
+
 void QueueHandle::configure(
     const bmqp_ctrlmsg::StreamParameters&              streamParameters,
     const mqbi::QueueHandle::HandleConfiguredCallback& configuredCb)
@@ -381,6 +410,30 @@ void QueueHandle::clearClient(bool hasLostClient)
     d_client_p = 0;
 }
 
+void QueueHandle::setClientThrottled(bool value)
+{
+    if (d_isClientThrottled == value) {
+        return;  // RETURN
+    }
+
+    d_isClientThrottled = value;
+    if (value) {
+        return;  // RETURN
+    }
+
+    // Mimic 'mqbblp::QueueHandle': resume the delivery to the streams which
+    // can deliver.
+    for (Subscriptions::const_iterator cit = d_subscriptions.begin();
+         cit != d_subscriptions.end();
+         ++cit) {
+        if (canDeliver(cit->first)) {
+            d_queue_sp->queueEngine()->onHandleUsable(
+                this,
+                cit->second.d_upstreamSubscriptionId);
+        }
+    }
+}
+
 int QueueHandle::transferUnconfirmedMessageGUID(
     const mqbi::RedeliveryVisitor& out,
     unsigned int                   subQueueId)
@@ -456,7 +509,7 @@ QueueHandle& QueueHandle::_setCanDeliver(const bsl::string& appId, bool value)
     bool prevValue          = it->second.d_canDeliver;
     it->second.d_canDeliver = value;
 
-    if (prevValue == false && value == true) {
+    if (prevValue == false && value == true && !d_isClientThrottled) {
         // Mimic hitting low watermark for maxUnconfirmed
 
         // REVISIT: make _canDeliver apply to subscription and not subQueue
@@ -534,7 +587,7 @@ bool QueueHandle::canDeliver(unsigned int downstreamSubscriptionId) const
     Downstreams::const_iterator citDownstream = d_downstreams.find(
         downstreamSubQueueId);
     BSLS_ASSERT_OPT(citDownstream != d_downstreams.end());
-    return citDownstream->second.d_canDeliver;
+    return !d_isClientThrottled && citDownstream->second.d_canDeliver;
 }
 
 const bsl::vector<const mqbu::ResourceUsageMonitor*>
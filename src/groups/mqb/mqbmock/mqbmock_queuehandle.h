@@ -180,6 +180,11 @@ class QueueHandle : public mqbi::QueueHandle {
 
     bmqp::SchemaLearner::Context d_schemaLearnerContext;
 
+    bool d_isClientThrottled;
+    // Whether the client is throttled (see
+    // 'setClientThrottled'), in which case
+    // no stream can deliver.
+
     bslma::Allocator* d_allocator_p;
     // Allocator to use.
 
@@ -275,6 +280,14 @@ class QueueHandle : public mqbi::QueueHandle {
                      const bsl::shared_ptr<bdlbb::Blob>& options)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Post the specified `messages` to the queue, in order.
+    ///
+    /// THREAD: this method can be called from any thread and is responsible
+    ///         for calling the corresponding method on the `Queue`, on the
+    ///         Queue's dispatcher thread.
+    void postMessages(const bsl::shared_ptr<PutMessages>& messages)
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Confirm the message with the specified `msgGUID` for the specified
     /// `downstreamSubQueueId` stream of the queue.
     ///
@@ -285,6 +298,18 @@ class QueueHandle : public mqbi::QueueHandle {
     confirmMessage(const bmqt::MessageGUID& msgGUID,
                    unsigned int downstreamSubQueueId) BSLS_KEYWORD_OVERRIDE;
 
+    /// Confirm the specified `count` messages starting with the one having
+    /// the specified `msgGUID`, each subsequent message having the GUID
+    /// following the one of the previous message, for the specified
+    /// `downstreamSubQueueId` stream of the queue, by calling
+    /// `confirmMessage` for each of them.
+    ///
+    /// THREAD: this method can be called from any thread.
+    void confirmMessageRange(const bmqt::MessageGUID& msgGUID,
+                             int                      count,
+                             unsigned int downstreamSubQueueId)
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Reject the message with the specified `msgGUID` for the specified
     /// `downstreamSubQueueId` stream of the queue.
     ///
@@ -347,6 +372,10 @@ class QueueHandle : public mqbi::QueueHandle {
         const bmqp::Protocol::SubQueueInfosArray& subscriptions)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Do nothing: this mock records delivered messages as they are
+    /// delivered.
+    void flushDeliveries() BSLS_KEYWORD_OVERRIDE;
+
     /// Used by the client to configure a given queue handle with the
     /// specified `streamParameters`.  Invoke the specified `configuredCb`
     /// when done.
@@ -378,6 +407,13 @@ class QueueHandle : public mqbi::QueueHandle {
 
     void clearClient(bool hasLostClient) BSLS_KEYWORD_OVERRIDE;
 
+    /// Set whether the client is throttled to the specified `value`.  No
+    /// message can be delivered while the client is throttled, and, as with
+    /// `mqbblp::QueueHandle`, the queue engine is notified that the handle
+    /// is usable again once the client is no longer throttled (synchronously
+    /// here).
+    void setClientThrottled(bool value) BSLS_KEYWORD_OVERRIDE;
+
     /// Transfer into the specified `out`, the GUID of all messages
     /// associated with the specified `subQueueId` which were delivered to
     /// the client, but that haven't yet been confirmed by it (i.e. the
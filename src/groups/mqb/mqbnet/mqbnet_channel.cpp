@@ -77,12 +77,18 @@ Channel::Channel(bdlbb::BlobBufferFactory* blobBufferFactory,
 , d_itemPool_p(itemPool)
 , d_buffer(1024, allocator)
 , d_secondaryBuffer(1024, allocator)
+, d_priorityBuffer(1024, allocator)
 , d_doStop(false)
 , d_state(e_INITIAL)
 , d_description(name + " - ", d_allocator_p)
 , d_name(name, d_allocator_p)
 , d_stats()
 {
+    // Data of the messages written to a channel is never modified, so that
+    // it can be referred to by (rather than copied into) the events.
+    d_putBuilder.setZeroCopy(true);
+    d_pushBuilder.setZeroCopy(true);
+
     bslmt::ThreadAttributes attr = mwcsys::ThreadUtil::defaultAttributes();
     bsl::string             threadName("bmqNet-");
     attr.setThreadName(threadName + d_name);
@@ -322,6 +328,7 @@ void Channel::reset()
     }
 
     d_secondaryBuffer.reset();
+    d_priorityBuffer.reset();
 
     d_stats.reset();
     d_putBuilder.reset();
@@ -829,6 +836,10 @@ void Channel::threadFn()
             }
         }
         else if (!item) {  // UNLOCK
+            if (d_priorityBuffer.tryPopFront(&item) == 0) {
+                // Write heartbeat and elector items ahead of the data.
+                continue;  // CONTINUE
+            }
 
             switch (mode) {
             case e_BLOCK: {
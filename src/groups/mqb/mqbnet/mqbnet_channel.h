@@ -45,6 +45,11 @@
 // The 'control' type of messages requires that everything accumulated before
 // must be successfully flushed prior to writing the message.  There is no
 // 'control' builder.
+// Heartbeat and elector messages are latency sensitive and carry no ordering
+// requirement with respect to data: they are buffered in a separate priority
+// queue which the internal thread drains before the data queue, so that they
+// do not wait behind a backlog of data (and cause false failure detections or
+// elections).  Note that the priority queue does not bypass high watermark.
 // Internally, 'mqbnet::Channel' starts a new thread and unconditionally
 // buffers everything it needs to write into single consumer queue.  The thread
 // reads the channel state which can be
@@ -316,6 +321,8 @@ class Channel {
         const bsl::shared_ptr<bdlbb::Blob>& data();
 
         bool isSecondary();
+
+        bool isPriority();
     };
 
     enum Mode {
@@ -397,6 +404,10 @@ class Channel {
     ItemQueue d_buffer;
     ItemQueue d_secondaryBuffer;
 
+    ItemQueue d_priorityBuffer;
+    // Heartbeat and elector items, written
+    // ahead of the items in 'd_buffer'.
+
     bslmt::ThreadUtil::Handle d_threadHandle;
 
     bslmt::Condition d_stateCondition;
@@ -993,6 +1004,13 @@ inline bool Channel::Item::isSecondary()
     return d_type == bmqp::EventType::e_ACK;
 }
 
+inline bool Channel::Item::isPriority()
+{
+    return d_type == bmqp::EventType::e_HEARTBEAT_REQ ||
+           d_type == bmqp::EventType::e_HEARTBEAT_RSP ||
+           d_type == bmqp::EventType::e_ELECTOR;
+}
+
 // --------------------
 // class Channel::Stats
 // --------------------
@@ -1094,6 +1112,15 @@ Channel::enqueue(bslma::ManagedPtr<Item>& item)
 
     d_stats.addItem(item->d_type, item->d_numBytes);
 
+    if (item->isPriority()) {
+        d_priorityBuffer.pushBack(bslmf::MovableRefUtil::move(item));
+
+        // Wake up the writing thread in case it is blocked by 'popFront'.
+        item.load(new (d_itemPool_p->allocate()) Item(d_allocator_p),
+                  this,
+                  deleteItem);
+    }
+
     d_buffer.pushBack(bslmf::MovableRefUtil::move(item));
 
     return bmqt::GenericResult::e_SUCCESS;
@@ -1194,6 +1194,72 @@ static void test6_weakData()
     ASSERT_EQ(testChannel->writeCalls().size(), 1U);
 }
 
+static void test7_priority()
+// ------------------------------------------------------------------------
+//
+// Call writeBlob with control data under HWM causing the channel to buffer
+// it, then call writeBlob with a heartbeat.  Simulate LWM and verify that
+// the heartbeat is written ahead of the buffered control data.
+//
+// ------------------------------------------------------------------------
+{
+    const size_t k_NUM_CONTROLS = 10;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(k_BUFFER_SIZE, s_allocator_p);
+    mqbnet::Channel::ItemPool      itemPool(mqbnet::Channel::k_ITEM_SIZE,
+                                       s_allocator_p);
+    mqbnet::Channel channel(&bufferFactory, &itemPool, "test", s_allocator_p);
+
+    bsl::shared_ptr<mwcio::TestChannelEx> testChannel(
+        new (*s_allocator_p)
+            mwcio::TestChannelEx(channel, &bufferFactory, s_allocator_p),
+        s_allocator_p);
+
+    channel.setChannel(bsl::weak_ptr<mwcio::TestChannelEx>(testChannel));
+
+    // Saturate the channel causing it to buffer next writes
+    channel.onWatermark(mwcio::ChannelWatermarkType::e_HIGH_WATERMARK);
+
+    bdlbb::Blob       control(&bufferFactory, s_allocator_p);
+    bdlbb::Blob       heartbeat(&bufferFactory, s_allocator_p);
+    bdlbb::BlobBuffer blobBuffer;
+
+    bufferFactory.allocate(&blobBuffer);
+    bsl::memset(blobBuffer.data(), 1, blobBuffer.size());
+    control.appendDataBuffer(blobBuffer);
+
+    bufferFactory.allocate(&blobBuffer);
+    bsl::memset(blobBuffer.data(), 2, blobBuffer.size());
+    heartbeat.appendDataBuffer(blobBuffer);
+
+    for (size_t i = 0; i < k_NUM_CONTROLS; ++i) {
+        ASSERT_EQ(channel.writeBlob(control, bmqp::EventType::e_CONTROL),
+                  bmqt::GenericResult::e_SUCCESS);
+    }
+    ASSERT_EQ(channel.writeBlob(heartbeat, bmqp::EventType::e_HEARTBEAT_REQ),
+              bmqt::GenericResult::e_SUCCESS);
+
+    ASSERT_EQ(testChannel->writeCalls().size(), 0U);
+
+    channel.onWatermark(mwcio::ChannelWatermarkType::e_LOW_WATERMARK);
+
+    ASSERT_EQ(testChannel->waitForChannel(bsls::TimeInterval(1)), true);
+
+    // All the writes, and 'waitForChannel' data, make it to IO.
+    ASSERT_EQ(testChannel->writeCalls().size(), k_NUM_CONTROLS + 2);
+
+    // The writing thread may have picked the first control item before HWM,
+    // in which case that item is written first.  Either way, the heartbeat
+    // is written ahead of the rest of the control data.
+    const bsl::deque<mwcio::TestChannel::WriteCall>& writeCalls =
+        testChannel->writeCalls();
+    const bool isFirst =
+        bdlbb::BlobUtil::compare(heartbeat, writeCalls[0].d_blob) == 0;
+
+    ASSERT(isFirst ||
+           bdlbb::BlobUtil::compare(heartbeat, writeCalls[1].d_blob) == 0);
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1215,6 +1281,7 @@ int main(int argc, char* argv[])
     case 4: test4_controlBlob(); break;
     case 5: test5_reconnect(); break;
     case 6: test6_weakData(); break;
+    case 7: test7_priority(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
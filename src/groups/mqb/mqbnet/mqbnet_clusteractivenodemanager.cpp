@@ -27,6 +27,7 @@
 
 // BDE
 #include <bdlf_bind.h>
+#include <bsl_algorithm.h>
 #include <bsl_cstdlib.h>
 #include <bsl_list.h>
 #include <bsl_vector.h>
@@ -37,6 +38,30 @@
 namespace BloombergLP {
 namespace mqbnet {
 
+namespace {
+
+const int k_ROUND_TRIP_TIME_WEIGHT = 8;
+// Inverse of the weight of a new sample in the smoothed round-trip time of a
+// node, i.e. each sample accounts for 1/8th of the smoothed value.
+
+const int k_ROUND_TRIP_TIME_TOLERANCE_PERCENT = 50;
+// Percentage by which the smoothed round-trip time of a candidate may exceed
+// the best one and the candidate still be considered for active node.
+
+}  // close unnamed namespace
+
+// -------------------------------------------
+// struct ClusterActiveNodeManager::NodeContext
+// -------------------------------------------
+
+ClusterActiveNodeManager::NodeContext::NodeContext()
+: d_status(bmqp_ctrlmsg::NodeStatus::E_UNAVAILABLE)
+, d_sessionDescription()
+, d_roundTripTime(0)
+{
+    // NOTHING
+}
+
 // ------------------------------
 // class ClusterActiveNodeManager
 // ------------------------------
@@ -87,6 +112,25 @@ int ClusterActiveNodeManager::onNodeStatusChange(
     return processNodeStatus(node, context, oldStatus);
 }
 
+void ClusterActiveNodeManager::onNodeRoundTripTime(
+    ClusterNode*       node,
+    bsls::Types::Int64 roundTripTime)
+{
+    NodesMap::iterator nodeIt = d_nodes.find(node);
+
+    BSLS_ASSERT_SAFE(nodeIt != d_nodes.end());
+    BSLS_ASSERT_SAFE(roundTripTime >= 0);
+
+    bsls::Types::Int64& smoothed = nodeIt->second.d_roundTripTime;
+    if (smoothed == 0) {
+        smoothed = bsl::max(roundTripTime, bsls::Types::Int64(1));
+    }
+    else {
+        smoothed += (roundTripTime - smoothed) / k_ROUND_TRIP_TIME_WEIGHT;
+        smoothed = bsl::max(smoothed, bsls::Types::Int64(1));
+    }
+}
+
 int ClusterActiveNodeManager::onNodeDown(ClusterNode* node)
 {
     NodesMap::iterator nodeIt = d_nodes.find(node);
@@ -171,6 +215,7 @@ bool ClusterActiveNodeManager::findNewActiveNode()
     }
     // We found at least one 'perfect' candidate, use it.
     if (!candidates.empty()) {
+        discardSlowCandidates(&candidates);
         onNewActiveNode(candidates[bsl::rand() % candidates.size()]);
         return true;  // RETURN
     }
@@ -199,11 +244,53 @@ bool ClusterActiveNodeManager::findNewActiveNode()
         return false;  // RETURN
     }
     else {
+        discardSlowCandidates(&candidates);
         onNewActiveNode(candidates[bsl::rand() % candidates.size()]);
         return true;  // RETURN
     }
 }
 
+void ClusterActiveNodeManager::discardSlowCandidates(
+    bsl::vector<mqbnet::ClusterNode*>* candidates) const
+{
+    bsls::Types::Int64 best = 0;
+    for (size_t i = 0; i < candidates->size(); ++i) {
+        const bsls::Types::Int64 roundTripTime =
+            d_nodes.find((*candidates)[i])->second.d_roundTripTime;
+        if (roundTripTime != 0 && (best == 0 || roundTripTime < best)) {
+            best = roundTripTime;
+        }
+    }
+
+    if (best == 0) {
+        // No round-trip time observed for any candidate.
+        return;  // RETURN
+    }
+
+    const bsls::Types::Int64 threshold =
+        best + best * k_ROUND_TRIP_TIME_TOLERANCE_PERCENT / 100;
+
+    bsl::vector<mqbnet::ClusterNode*>::iterator it = candidates->begin();
+    while (it != candidates->end()) {
+        const bsls::Types::Int64 roundTripTime =
+            d_nodes.find(*it)->second.d_roundTripTime;
+        if (roundTripTime > threshold) {
+            BALL_LOG_INFO << d_description << ": not considering node '"
+                          << (*it)->nodeDescription() << "' as active, its "
+                          << "round-trip time (" << roundTripTime << " ns) "
+                          << "exceeds the best candidate's (" << best
+                          << " ns).";
+            it = candidates->erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    // The best candidate is never discarded.
+    BSLS_ASSERT_SAFE(!candidates->empty());
+}
+
 void ClusterActiveNodeManager::onNewActiveNode(ClusterNode* node)
 {
     // PRECONDITIONS
@@ -55,6 +55,16 @@
 // not choose the same node in the cluster, and those will have an evenly
 // distributed connection from the remotes.
 //
+// The round-trip times of the requests sent to a node while it is active are
+// reported through 'onNodeRoundTripTime()' and smoothed per node.  When
+// selecting a new active node, candidates whose smoothed round-trip time
+// exceeds the best one by more than a tolerance are discarded before the
+// randomized pick, so that a node which was observed to be slow is avoided on
+// the next failover.  The tolerance acts as an hysteresis: nodes with
+// comparable latencies, as well as nodes never measured, remain equally
+// likely to be picked.  Note that the active node is still never switched
+// while it is up, as this would leave the queues opened upstream on it.
+//
 /// Thread Safety
 ///-------------
 // The 'mqbnet::ClusterActiveNodeManager' object is not thread safe.  It
@@ -200,8 +210,11 @@
 #include <ball_log.h>
 #include <bdlmt_eventscheduler.h>
 #include <bsl_iostream.h>
+#include <bsl_map.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 #include <bsls_assert.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 
@@ -238,6 +251,13 @@ class ClusterActiveNodeManager {
 
         bsl::string d_sessionDescription;
         // Current session description
+
+        bsls::Types::Int64 d_roundTripTime;
+        // Smoothed round-trip time, in nanoseconds, of the requests sent
+        // to the node, or 0 if none was observed.
+
+        // CREATORS
+        NodeContext();
     };
 
     typedef bsl::map<mqbnet::ClusterNode*, NodeContext> NodesMap;
@@ -276,6 +296,12 @@ class ClusterActiveNodeManager {
     /// specified `node`.
     void onNewActiveNode(ClusterNode* node);
 
+    /// Remove from the specified `candidates` the nodes whose smoothed
+    /// round-trip time exceeds the best one among `candidates` by more than
+    /// the tolerance.  Nodes with no observed round-trip time are kept.
+    void
+    discardSlowCandidates(bsl::vector<mqbnet::ClusterNode*>* candidates) const;
+
     /// Process status change of the specified `context` associated with the
     /// specified `node`.  The specified `oldStatus` indicates previous
     /// status.  This can trigger searching for active node.  Return bitmask
@@ -326,6 +352,12 @@ class ClusterActiveNodeManager {
     int onNodeStatusChange(ClusterNode*                    node,
                            bmqp_ctrlmsg::NodeStatus::Value status);
 
+    /// Record the specified `roundTripTime`, in nanoseconds, observed for a
+    /// request to the specified `node`.  This is taken into account the
+    /// next time an active node is selected.
+    void onNodeRoundTripTime(ClusterNode*       node,
+                             bsls::Types::Int64 roundTripTime);
+
     // ACCESSORS
 
     /// Return the currently active node, or a null pointer if there are no
@@ -490,6 +490,11 @@ void ElectorStateMachine::applyLeaderHeartbeatEventToFollower(
             BSLS_ASSERT_SAFE(k_INVALID_NODE_ID == d_tentativeLeaderNodeId);
             d_lastLeaderHeartbeatTime = mwcsys::Time::highResolutionTimer();
 
+            // Acknowledge the heartbeat, so that the leader can renew its
+            // lease.
+            out->setIo(ElectorIOEventType::e_HEARTBEAT_RESPONSE);
+            out->setDestination(sourceNodeId);
+
             // No state change
             return;  // RETURN
         }
@@ -843,6 +848,7 @@ void ElectorStateMachine::applyElectionResponseEventToCandidate(
         d_tentativeLeaderNodeId = k_INVALID_NODE_ID;
         d_state                 = ElectorState::e_LEADER;
         d_reason                = ElectorTransitionReason::e_NONE;
+        initializeLeases();
 
         // Send heartbeat right away and schedule recurring heartbeat timer
         out->setIo(ElectorIOEventType::e_LEADER_HEARTBEAT);
@@ -880,6 +886,8 @@ void ElectorStateMachine::applyElectionResponseEventToLeader(
         }
         else {
             d_supporters.push_back(sourceNodeId);
+            d_heartbeatResponseTimes[sourceNodeId] =
+                mwcsys::Time::highResolutionTimer();
             BALL_LOG_INFO << "Elector:LEADER received ELECTION_RESPONSE from "
                           << "node [" << sourceNodeId << "] for term [" << term
                           << "] Current term [" << d_term
@@ -933,9 +941,17 @@ void ElectorStateMachine::applyHeartbeatResponseEventToLeader(
     bsls::Types::Uint64        term,
     int                        sourceNodeId)
 {
-    if (d_term >= term) {
-        // Leader has received a correct (d_term == term) or a stale (d_term >
-        // term) heartbeat response from a peer.  Nothing to do.
+    if (d_term == term) {
+        // Leader has received a correct heartbeat response from a peer, which
+        // renews the lease granted by that peer.
+        d_heartbeatResponseTimes[sourceNodeId] =
+            mwcsys::Time::highResolutionTimer();
+        return;  // RETURN
+    }
+
+    if (d_term > term) {
+        // Leader has received a stale heartbeat response from a peer.  Nothing
+        // to do.
         return;  // RETURN
     }
 
@@ -1390,6 +1406,7 @@ void ElectorStateMachine::applyElectionResultTimerEvent(
         d_tentativeLeaderNodeId = k_INVALID_NODE_ID;
         d_state                 = ElectorState::e_LEADER;
         d_reason                = ElectorTransitionReason::e_NONE;
+        initializeLeases();
 
         // Send heartbeat right away and schedule recurring heartbeat timer
         out->setIo(ElectorIOEventType::e_LEADER_HEARTBEAT);
@@ -1562,6 +1579,41 @@ void ElectorStateMachine::applyHeartbeatBroadcastTimerEvent(
     BSLS_ASSERT_SAFE(k_INVALID_NODE_ID == d_tentativeLeaderNodeId);
     BSLS_ASSERT_SAFE(0 < d_term);
 
+    const int numHolders = numLeaseHolders(
+        mwcsys::Time::highResolutionTimer());
+    if (numHolders < d_quorum) {
+        // Too many supporters did not acknowledge a heartbeat within the
+        // leader inactivity interval: they are about to elect a new leader,
+        // if they have not already.  Step down deterministically instead of
+        // waiting to be preempted.
+        BALL_LOG_WARN << "#ELECTOR_LEADER_LEASE "
+                      << "LEADER lease expired: only [" << numHolders
+                      << "] nodes acknowledged heartbeats within the leader "
+                      << "inactivity interval. Expected quorum [" << d_quorum
+                      << "]. Giving up leadership, will schedule election "
+                      << "after a random duration.";
+
+        d_state                   = ElectorState::e_FOLLOWER;
+        d_leaderNodeId            = k_INVALID_NODE_ID;
+        d_tentativeLeaderNodeId   = k_INVALID_NODE_ID;
+        d_lastLeaderHeartbeatTime = 0;
+        d_reason = ElectorTransitionReason::e_QUORUM_NOT_ACHIEVED;
+        d_supporters.clear();
+        d_heartbeatResponseTimes.clear();
+
+        out->setTimer(ElectorTimerEventType::e_RANDOM_WAIT_TIMER);
+        out->setCancelTimerEventsFlag(true);
+
+        // Proactively give up leadership by signaling to all the nodes.
+        out->setIo(ElectorIOEventType::e_LEADERSHIP_CESSION);
+        out->setDestination(k_ALL_NODES_ID);
+
+        // Indicate state change.
+        out->setStateChangedFlag(true);
+
+        return;  // RETURN
+    }
+
     out->setIo(ElectorIOEventType::e_LEADER_HEARTBEAT);
     out->setDestination(k_ALL_NODES_ID);
 
@@ -1593,6 +1645,43 @@ void ElectorStateMachine::applyScoutingResultTimerEvent(
     out->setTimer(ElectorTimerEventType::e_RANDOM_WAIT_TIMER);
 }
 
+void ElectorStateMachine::initializeLeases()
+{
+    const bsls::Types::Int64 now = mwcsys::Time::highResolutionTimer();
+
+    d_heartbeatResponseTimes.clear();
+    for (bsl::vector<int>::const_iterator cit = d_supporters.begin();
+         cit != d_supporters.end();
+         ++cit) {
+        if (d_selfId != *cit) {
+            d_heartbeatResponseTimes[*cit] = now;
+        }
+    }
+}
+
+// PRIVATE ACCESSORS
+int ElectorStateMachine::numLeaseHolders(bsls::Types::Int64 now) const
+{
+    int result = 0;
+    for (bsl::vector<int>::const_iterator cit = d_supporters.begin();
+         cit != d_supporters.end();
+         ++cit) {
+        if (d_selfId == *cit) {
+            ++result;
+            continue;  // CONTINUE
+        }
+
+        bsl::map<int, bsls::Types::Int64>::const_iterator timeCit =
+            d_heartbeatResponseTimes.find(*cit);
+        if (d_heartbeatResponseTimes.end() != timeCit &&
+            (now - timeCit->second) < d_leaderInactivityInterval) {
+            ++result;
+        }
+    }
+
+    return result;
+}
+
 // MANIPULATORS
 void ElectorStateMachine::enable(int selfId,
                                  int quorum,
@@ -1620,6 +1709,7 @@ void ElectorStateMachine::enable(int selfId,
     d_leaderInactivityInterval = leaderInactivityIntervalMs *
                                  bdlt::TimeUnitRatio::k_NS_PER_MS;
     d_supporters.clear();
+    d_heartbeatResponseTimes.clear();
     ++d_age;
 }
 
@@ -1640,6 +1730,7 @@ void ElectorStateMachine::disable()
     d_leaderInactivityInterval = 0;
     d_tentativeLeaderNodeId    = k_INVALID_NODE_ID;
     d_supporters.clear();
+    d_heartbeatResponseTimes.clear();
     ++d_age;
 }
 
@@ -37,6 +37,16 @@
 // one leader, even in case of network splits.  A typical value for quorum is
 // half the total number of participating nodes plus one.  A comprehensive
 // overview of the algorithm can be found at 'doc/proposal/election.md'.
+// Before proposing an election, a follower sends a pre-election scouting
+// request (pre-vote), so that a node which cannot reach the leader does not
+// disrupt the cluster by bumping the term.  Followers acknowledge every
+// heartbeat of their leader, and the leader holds a lease from each supporter
+// which voted for it, or acknowledged one of its heartbeats, within the
+// leader inactivity interval.  A
+// leader whose lease is held by fewer than quorum nodes steps down on its
+// own, approximately when its followers start electing a new leader, instead
+// of waiting to be preempted.  Failure detection time is driven by
+// 'heartbeatCheckPeriodMs' and 'heartbeatMissCount' of 'ElectorConfig'.
 // 'mqbnet::ElectorState', and 'mqbnet::ElectorTransitionReason' are public
 // classes.  'mqbnet::ElectorIOEventType', 'mqbnet::ElectorTimerEventType' and
 // 'mqbnet::ElectorStateMachine' are private classes and should not be used
@@ -523,6 +533,14 @@ class ElectorStateMachine {
     // after which an inactive leader is
     // assumed to be not a leader.
 
+    bsl::map<int, bsls::Types::Int64> d_heartbeatResponseTimes;
+    // Map of node ID to time stamp in nano
+    // seconds when the vote or the last
+    // heartbeat response with the current
+    // term was received from that node.
+    // Only maintained if this node is the
+    // leader.
+
     bsls::Types::Uint64 d_age;
     // Age of the state machine.  Age is
     // bumped up everytime a state
@@ -665,12 +683,24 @@ class ElectorStateMachine {
     /// non-null.
     void applyScoutingResultTimerEvent(ElectorStateMachineOutput* out);
 
+    /// Record that each supporter of this node, which just became leader,
+    /// grants it its lease as of now, as the vote of a supporter
+    /// acknowledges the leadership of this node for the current term.
+    void initializeLeases();
+
     // PRIVATE ACCESSORS
 
     /// Return true if the specified `sourceNodeId` is a valid ID for a
     /// source node and false otherwise.
     bool isValidSourceNode(int sourceNodeId) const;
 
+    /// Return the number of supporters of this leader which still grant it
+    /// its lease at the specified `now` time (in nano seconds), self
+    /// included.  A supporter grants the lease only if it voted for this
+    /// leader, or acknowledged one of its heartbeats, within the leader
+    /// inactivity interval.
+    int numLeaseHolders(bsls::Types::Int64 now) const;
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(ElectorStateMachine,
@@ -1294,6 +1324,7 @@ inline ElectorStateMachine::ElectorStateMachine(bslma::Allocator* allocator)
 , d_scoutingInfo(allocator)
 , d_lastLeaderHeartbeatTime(0)
 , d_leaderInactivityInterval(0)
+, d_heartbeatResponseTimes(allocator)
 , d_age(0)
 {
 }
@@ -1312,6 +1343,7 @@ inline ElectorStateMachine::ElectorStateMachine(
 , d_scoutingInfo(other.d_scoutingInfo, allocator)
 , d_lastLeaderHeartbeatTime(other.d_lastLeaderHeartbeatTime)
 , d_leaderInactivityInterval(other.d_leaderInactivityInterval)
+, d_heartbeatResponseTimes(other.d_heartbeatResponseTimes, allocator)
 , d_age(other.d_age)
 {
 }
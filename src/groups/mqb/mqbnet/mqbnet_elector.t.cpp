@@ -1779,9 +1779,9 @@ static void test11()
     ASSERT_EQ(k_INVALID_NODE, sm.tentativeLeaderNodeId());
     ASSERT_EQ(term, sm.term());
     ASSERT_EQ(ElectorTransitionReason::e_NONE, sm.reason());
-    ASSERT_EQ(ElectorIOEventType::e_NONE, output.io());
+    ASSERT_EQ(ElectorIOEventType::e_HEARTBEAT_RESPONSE, output.io());
     ASSERT_EQ(ElectorTimerEventType::e_NONE, output.timer());
-    ASSERT_EQ(k_INVALID_NODE, output.destination());
+    ASSERT_EQ(3, output.destination());
     ASSERT_EQ(false, output.cancelTimerEventsFlag());
     ASSERT_EQ(age, sm.age());
 
@@ -2660,6 +2660,386 @@ static void test20()
     ASSERT_EQ(age, sm.age());
 }
 
+static void test21()
+// ------------------------------------------------------------------------
+// Testing:
+//   * Dormant -D1-> Follower -F2-> Candidate -C4-> Leader -> Supporters
+//     stop acknowledging heartbeats -> Leader lease expires -> Follower.
+//   * This case tests the scenario where a leader steps down on its own
+//     once fewer than quorum nodes acknowledged its heartbeats within the
+//     leader inactivity interval.
+// ------------------------------------------------------------------------
+{
+    s_ignoreCheckDefAlloc = true;
+    // Logging infrastructure allocates using the default allocator, and
+    // that logging is beyond the control of this function.
+
+    mwctst::TestHelper::printTestName("TEST 21");
+
+    const int k_SELFID             = 0;
+    const int k_QUORUM             = 3;
+    const int k_TOTAL_NODES        = 4;
+    const int k_INVALID_NODE       = ElectorStateMachine::k_INVALID_NODE_ID;
+    const int k_ALL_NODES          = ElectorStateMachine::k_ALL_NODES_ID;
+    const int k_INACTIVITY_INTV_MS = 6 * bdlt::TimeUnitRatio::k_MS_PER_S;
+
+    const bsls::Types::Int64 k_NS_PER_S = bdlt::TimeUnitRatio::k_NS_PER_S;
+
+    // Reset the test clock as it will be used in this test case
+    s_electorClock->reset();
+
+    bsls::Types::Uint64 age = 0;
+    ElectorStateMachine sm(s_allocator_p);
+
+    ASSERT_EQ(ElectorState::e_DORMANT, sm.state());
+
+    // Dormant -D1-> Follower
+    sm.enable(k_SELFID, k_QUORUM, k_TOTAL_NODES, k_INACTIVITY_INTV_MS);
+    ASSERT_EQ(ElectorState::e_FOLLOWER, sm.state());
+    ASSERT_EQ(ElectorTransitionReason::e_STARTED, sm.reason());
+    ASSERT_EQ(k_INVALID_NODE, sm.leaderNodeId());
+    ASSERT_EQ(k_INVALID_NODE, sm.tentativeLeaderNodeId());
+    ASSERT_EQ(0ULL, sm.term());
+    ASSERT_EQ(++age, sm.age());
+
+    ElectorStateMachineOutput output;
+    bsls::Types::Uint64       term = 1;
+
+    // Apply INITIAL_WAIT_TIMER to follower.  It should emit scouting request.
+    sm.applyTimer(&output, ElectorTimerEventType::e_INITIAL_WAIT_TIMER);
+    ASSERT_EQ(false, output.stateChangedFlag());
+    ASSERT_EQ(ElectorState::e_FOLLOWER, sm.state());
+    ASSERT_EQ(ElectorTransitionReason::e_NONE, sm.reason());
+    ASSERT_EQ(k_INVALID_NODE, sm.leaderNodeId());
+    ASSERT_EQ(0ULL, sm.term());
+    ASSERT_EQ(ElectorIOEventType::e_SCOUTING_REQUEST, output.io());
+    ASSERT_EQ(ElectorTimerEventType::e_SCOUTING_RESULT_TIMER, output.timer());
+    ASSERT_EQ(ElectorStateMachine::k_ALL_NODES_ID, output.destination());
+    ASSERT_EQ(false, output.cancelTimerEventsFlag());
+    ASSERT_EQ(age, sm.age());
+
+    // Apply 2 scouting responses.
+
+    // Apply 1st scouting response.
+    sm.applyScout(&output,
+                  true,           // Will vote
+                  sm.term() + 1,  // Scouting happens with a higher term
+                  k_SELFID + 1);  // Peer node Id
+    ASSERT_EQ(false, output.stateChangedFlag());
+    ASSERT_EQ(ElectorState::e_FOLLOWER, sm.state());
+    ASSERT_EQ(ElectorTransitionReason::e_NONE, sm.reason());
+    ASSERT_EQ(k_INVALID_NODE, sm.leaderNodeId());
+    ASSERT_EQ(0ULL, sm.term());
+    ASSERT_EQ(ElectorIOEventType::e_NONE, output.io());
+    ASSERT_EQ(ElectorTimerEventType::e_NONE, output.timer());
+    ASSERT_EQ(k_INVALID_NODE, output.destination());
+    ASSERT_EQ(false, output.cancelTimerEventsFlag());
+    ASSERT_EQ(age, sm.age());
+
+    // Apply 2nd scouting response.  Quorum will be achieved, and elector will
+    // transition to candidate.
+    // Follower -F2-> Candidate
+    sm.applyScout(&output,
+                  true,           // Will vote
+                  sm.term() + 1,  // Scouting happens with a higher term
+                  k_SELFID + 2);  // Peer node Id
+    ASSERT_EQ(true, output.stateChangedFlag());
+    ASSERT_EQ(ElectorState::e_CANDIDATE, sm.state());
+    ASSERT_EQ(ElectorTransitionReason::e_NONE, sm.reason());
+    ASSERT_EQ(k_INVALID_NODE, sm.leaderNodeId());
+    ASSERT_EQ(term, sm.term());
+    ASSERT_EQ(ElectorIOEventType::e_ELECTION_PROPOSAL, output.io());
+    ASSERT_EQ(ElectorTimerEventType::e_ELECTION_RESULT_TIMER, output.timer());
+    ASSERT_EQ(ElectorStateMachine::k_ALL_NODES_ID, output.destination());
+    ASSERT_EQ(true, output.cancelTimerEventsFlag());
+    ASSERT_EQ(++age, sm.age());
+
+    // Apply 2 election responses
+
+    // 1st election response
+    sm.applyIOEvent(&output,
+                    ElectorIOEventType::e_ELECTION_RESPONSE,
+                    term,
+                    k_SELFID + 1);  // nodeId
+
+    ASSERT_EQ(false, output.stateChangedFlag());
+    ASSERT_EQ(ElectorState::e_CANDIDATE, sm.state());
+    ASSERT_EQ(ElectorTransitionReason::e_NONE, sm.reason());
+    ASSERT_EQ(k_INVALID_NODE, sm.leaderNodeId());
+    ASSERT_EQ(term, sm.term());
+    ASSERT_EQ(ElectorIOEventType::e_NONE, output.io());
+    ASSERT_EQ(ElectorTimerEventType::e_NONE, output.timer());
+    ASSERT_EQ(k_INVALID_NODE, output.destination());
+    ASSERT_EQ(false, output.cancelTimerEventsFlag());
+    ASSERT_EQ(age, sm.age());
+
+    // 2nd election response
+    // Candidate -C4-> Leader
+    sm.applyIOEvent(&output,
+                    ElectorIOEventType::e_ELECTION_RESPONSE,
+                    term,           // term
+                    k_SELFID + 2);  // nodeId
+
+    ASSERT_EQ(true, output.stateChangedFlag());
+    ASSERT_EQ(ElectorState::e_LEADER, sm.state());
+    ASSERT_EQ(ElectorTransitionReason::e_NONE, sm.reason());
+    ASSERT_EQ(k_SELFID, sm.leaderNodeId());
+    ASSERT_EQ(term, sm.term());
+    ASSERT_EQ(ElectorIOEventType::e_LEADER_HEARTBEAT, output.io());
+    ASSERT_EQ(ElectorTimerEventType::e_HEARTBEAT_BROADCAST_TIMER,
+              output.timer());
+    ASSERT_EQ(k_ALL_NODES, output.destination());
+    ASSERT_EQ(true, output.cancelTimerEventsFlag());
+    ASSERT_EQ(++age, sm.age());
+
+    // Both supporters acknowledge the heartbeat.
+    sm.applyIOEvent(&output,
+                    ElectorIOEventType::e_HEARTBEAT_RESPONSE,
+                    term,
+                    k_SELFID + 1);
+    ASSERT_EQ(false, output.stateChangedFlag());
+    ASSERT_EQ(ElectorIOEventType::e_NONE, output.io());
+
+    sm.applyIOEvent(&output,
+                    ElectorIOEventType::e_HEARTBEAT_RESPONSE,
+                    term,
+                    k_SELFID + 2);
+    ASSERT_EQ(false, output.stateChangedFlag());
+    ASSERT_EQ(ElectorIOEventType::e_NONE, output.io());
+
+    // 4 seconds elapse.  Lease is still granted by both supporters.
+    s_electorClock->advanceHighResTimer(4 * k_NS_PER_S);
+
+    sm.applyTimer(&output, ElectorTimerEventType::e_HEARTBEAT_BROADCAST_TIMER);
+    ASSERT_EQ(false, output.stateChangedFlag());
+    ASSERT_EQ(ElectorState::e_LEADER, sm.state());
+    ASSERT_EQ(k_SELFID, sm.leaderNodeId());
+    ASSERT_EQ(ElectorIOEventType::e_LEADER_HEARTBEAT, output.io());
+    ASSERT_EQ(k_ALL_NODES, output.destination());
+    ASSERT_EQ(age, sm.age());
+
+    // Only one supporter acknowledges this heartbeat.
+    sm.applyIOEvent(&output,
+                    ElectorIOEventType::e_HEARTBEAT_RESPONSE,
+                    term,
+                    k_SELFID + 1);
+    ASSERT_EQ(false, output.stateChangedFlag());
+    ASSERT_EQ(ElectorIOEventType::e_NONE, output.io());
+
+    // 3 more seconds elapse.  The other supporter did not acknowledge a
+    // heartbeat for more than the inactivity interval, so that the lease is
+    // only granted by self and one supporter, which is less than quorum.
+    // Leader -> Follower
+    s_electorClock->advanceHighResTimer(3 * k_NS_PER_S);
+
+    sm.applyTimer(&output, ElectorTimerEventType::e_HEARTBEAT_BROADCAST_TIMER);
+    ASSERT_EQ(true, output.stateChangedFlag());
+    ASSERT_EQ(ElectorState::e_FOLLOWER, sm.state());
+    ASSERT_EQ(ElectorTransitionReason::e_QUORUM_NOT_ACHIEVED, sm.reason());
+    ASSERT_EQ(k_INVALID_NODE, sm.leaderNodeId());
+    ASSERT_EQ(k_INVALID_NODE, sm.tentativeLeaderNodeId());
+    ASSERT_EQ(term, sm.term());
+    ASSERT_EQ(ElectorIOEventType::e_LEADERSHIP_CESSION, output.io());
+    ASSERT_EQ(ElectorTimerEventType::e_RANDOM_WAIT_TIMER, output.timer());
+    ASSERT_EQ(k_ALL_NODES, output.destination());
+    ASSERT_EQ(true, output.cancelTimerEventsFlag());
+    ASSERT_EQ(++age, sm.age());
+}
+
+static void test22()
+// ------------------------------------------------------------------------
+// Testing:
+//   * Dormant -D1-> Follower -F2-> Candidate -C4-> Leader -> Supporters
+//     never acknowledge heartbeats -> Leader lease expires -> Follower.
+//   * This case tests that the vote of a supporter grants the lease only
+//     for the leader inactivity interval, that a supporter joining an
+//     established leader grants it the lease, and that only the supporters
+//     which voted or acknowledged a heartbeat within the leader inactivity
+//     interval hold the lease.
+// ------------------------------------------------------------------------
+{
+    s_ignoreCheckDefAlloc = true;
+    // Logging infrastructure allocates using the default allocator, and
+    // that logging is beyond the control of this function.
+
+    mwctst::TestHelper::printTestName("TEST 22");
+
+    const int k_SELFID             = 0;
+    const int k_QUORUM             = 3;
+    const int k_TOTAL_NODES        = 4;
+    const int k_INVALID_NODE       = ElectorStateMachine::k_INVALID_NODE_ID;
+    const int k_ALL_NODES          = ElectorStateMachine::k_ALL_NODES_ID;
+    const int k_INACTIVITY_INTV_MS = 6 * bdlt::TimeUnitRatio::k_MS_PER_S;
+
+    const bsls::Types::Int64 k_NS_PER_S = bdlt::TimeUnitRatio::k_NS_PER_S;
+
+    // Reset the test clock as it will be used in this test case
+    s_electorClock->reset();
+
+    bsls::Types::Uint64 age = 0;
+    ElectorStateMachine sm(s_allocator_p);
+
+    ASSERT_EQ(ElectorState::e_DORMANT, sm.state());
+
+    // Dormant -D1-> Follower
+    sm.enable(k_SELFID, k_QUORUM, k_TOTAL_NODES, k_INACTIVITY_INTV_MS);
+    ASSERT_EQ(ElectorState::e_FOLLOWER, sm.state());
+    ASSERT_EQ(ElectorTransitionReason::e_STARTED, sm.reason());
+    ASSERT_EQ(k_INVALID_NODE, sm.leaderNodeId());
+    ASSERT_EQ(k_INVALID_NODE, sm.tentativeLeaderNodeId());
+    ASSERT_EQ(0ULL, sm.term());
+    ASSERT_EQ(++age, sm.age());
+
+    ElectorStateMachineOutput output;
+    bsls::Types::Uint64       term = 1;
+
+    // Apply INITIAL_WAIT_TIMER to follower.  It should emit scouting request.
+    sm.applyTimer(&output, ElectorTimerEventType::e_INITIAL_WAIT_TIMER);
+    ASSERT_EQ(false, output.stateChangedFlag());
+    ASSERT_EQ(ElectorState::e_FOLLOWER, sm.state());
+    ASSERT_EQ(ElectorTransitionReason::e_NONE, sm.reason());
+    ASSERT_EQ(k_INVALID_NODE, sm.leaderNodeId());
+    ASSERT_EQ(0ULL, sm.term());
+    ASSERT_EQ(ElectorIOEventType::e_SCOUTING_REQUEST, output.io());
+    ASSERT_EQ(ElectorTimerEventType::e_SCOUTING_RESULT_TIMER, output.timer());
+    ASSERT_EQ(ElectorStateMachine::k_ALL_NODES_ID, output.destination());
+    ASSERT_EQ(false, output.cancelTimerEventsFlag());
+    ASSERT_EQ(age, sm.age());
+
+    // Apply 2 scouting responses.
+
+    // Apply 1st scouting response.
+    sm.applyScout(&output,
+                  true,           // Will vote
+                  sm.term() + 1,  // Scouting happens with a higher term
+                  k_SELFID + 1);  // Peer node Id
+    ASSERT_EQ(false, output.stateChangedFlag());
+    ASSERT_EQ(ElectorState::e_FOLLOWER, sm.state());
+    ASSERT_EQ(ElectorTransitionReason::e_NONE, sm.reason());
+    ASSERT_EQ(k_INVALID_NODE, sm.leaderNodeId());
+    ASSERT_EQ(0ULL, sm.term());
+    ASSERT_EQ(ElectorIOEventType::e_NONE, output.io());
+    ASSERT_EQ(ElectorTimerEventType::e_NONE, output.timer());
+    ASSERT_EQ(k_INVALID_NODE, output.destination());
+    ASSERT_EQ(false, output.cancelTimerEventsFlag());
+    ASSERT_EQ(age, sm.age());
+
+    // Apply 2nd scouting response.  Quorum will be achieved, and elector will
+    // transition to candidate.
+    // Follower -F2-> Candidate
+    sm.applyScout(&output,
+                  true,           // Will vote
+                  sm.term() + 1,  // Scouting happens with a higher term
+                  k_SELFID + 2);  // Peer node Id
+    ASSERT_EQ(true, output.stateChangedFlag());
+    ASSERT_EQ(ElectorState::e_CANDIDATE, sm.state());
+    ASSERT_EQ(ElectorTransitionReason::e_NONE, sm.reason());
+    ASSERT_EQ(k_INVALID_NODE, sm.leaderNodeId());
+    ASSERT_EQ(term, sm.term());
+    ASSERT_EQ(ElectorIOEventType::e_ELECTION_PROPOSAL, output.io());
+    ASSERT_EQ(ElectorTimerEventType::e_ELECTION_RESULT_TIMER, output.timer());
+    ASSERT_EQ(ElectorStateMachine::k_ALL_NODES_ID, output.destination());
+    ASSERT_EQ(true, output.cancelTimerEventsFlag());
+    ASSERT_EQ(++age, sm.age());
+
+    // Apply 2 election responses
+
+    // 1st election response
+    sm.applyIOEvent(&output,
+                    ElectorIOEventType::e_ELECTION_RESPONSE,
+                    term,
+                    k_SELFID + 1);  // nodeId
+
+    ASSERT_EQ(false, output.stateChangedFlag());
+    ASSERT_EQ(ElectorState::e_CANDIDATE, sm.state());
+    ASSERT_EQ(ElectorTransitionReason::e_NONE, sm.reason());
+    ASSERT_EQ(k_INVALID_NODE, sm.leaderNodeId());
+    ASSERT_EQ(term, sm.term());
+    ASSERT_EQ(ElectorIOEventType::e_NONE, output.io());
+    ASSERT_EQ(ElectorTimerEventType::e_NONE, output.timer());
+    ASSERT_EQ(k_INVALID_NODE, output.destination());
+    ASSERT_EQ(false, output.cancelTimerEventsFlag());
+    ASSERT_EQ(age, sm.age());
+
+    // 2nd election response
+    // Candidate -C4-> Leader
+    sm.applyIOEvent(&output,
+                    ElectorIOEventType::e_ELECTION_RESPONSE,
+                    term,           // term
+                    k_SELFID + 2);  // nodeId
+
+    ASSERT_EQ(true, output.stateChangedFlag());
+    ASSERT_EQ(ElectorState::e_LEADER, sm.state());
+    ASSERT_EQ(ElectorTransitionReason::e_NONE, sm.reason());
+    ASSERT_EQ(k_SELFID, sm.leaderNodeId());
+    ASSERT_EQ(term, sm.term());
+    ASSERT_EQ(ElectorIOEventType::e_LEADER_HEARTBEAT, output.io());
+    ASSERT_EQ(ElectorTimerEventType::e_HEARTBEAT_BROADCAST_TIMER,
+              output.timer());
+    ASSERT_EQ(k_ALL_NODES, output.destination());
+    ASSERT_EQ(true, output.cancelTimerEventsFlag());
+    ASSERT_EQ(++age, sm.age());
+
+    // 5 seconds elapse without any heartbeat response.  The votes of both
+    // supporters still grant the lease.
+    s_electorClock->advanceHighResTimer(5 * k_NS_PER_S);
+
+    sm.applyTimer(&output, ElectorTimerEventType::e_HEARTBEAT_BROADCAST_TIMER);
+    ASSERT_EQ(false, output.stateChangedFlag());
+    ASSERT_EQ(ElectorState::e_LEADER, sm.state());
+    ASSERT_EQ(ElectorIOEventType::e_LEADER_HEARTBEAT, output.io());
+    ASSERT_EQ(k_ALL_NODES, output.destination());
+    ASSERT_EQ(age, sm.age());
+
+    // A 3rd node supports the established leader, and one of the original
+    // supporters acknowledges the heartbeat.
+    sm.applyIOEvent(&output,
+                    ElectorIOEventType::e_ELECTION_RESPONSE,
+                    term,
+                    k_SELFID + 3);
+    ASSERT_EQ(false, output.stateChangedFlag());
+    ASSERT_EQ(ElectorState::e_LEADER, sm.state());
+    ASSERT_EQ(ElectorIOEventType::e_NONE, output.io());
+
+    sm.applyIOEvent(&output,
+                    ElectorIOEventType::e_HEARTBEAT_RESPONSE,
+                    term,
+                    k_SELFID + 1);
+    ASSERT_EQ(false, output.stateChangedFlag());
+    ASSERT_EQ(ElectorIOEventType::e_NONE, output.io());
+
+    // 2 more seconds elapse.  The vote of the supporter which never
+    // acknowledged a heartbeat is older than the inactivity interval, but
+    // self, the supporter which acknowledged the heartbeat and the late
+    // supporter still hold the lease, which is quorum.
+    s_electorClock->advanceHighResTimer(2 * k_NS_PER_S);
+
+    sm.applyTimer(&output, ElectorTimerEventType::e_HEARTBEAT_BROADCAST_TIMER);
+    ASSERT_EQ(false, output.stateChangedFlag());
+    ASSERT_EQ(ElectorState::e_LEADER, sm.state());
+    ASSERT_EQ(k_SELFID, sm.leaderNodeId());
+    ASSERT_EQ(ElectorIOEventType::e_LEADER_HEARTBEAT, output.io());
+    ASSERT_EQ(age, sm.age());
+
+    // 5 more seconds elapse without any heartbeat response.  Only self holds
+    // the lease.
+    // Leader -> Follower
+    s_electorClock->advanceHighResTimer(5 * k_NS_PER_S);
+
+    sm.applyTimer(&output, ElectorTimerEventType::e_HEARTBEAT_BROADCAST_TIMER);
+    ASSERT_EQ(true, output.stateChangedFlag());
+    ASSERT_EQ(ElectorState::e_FOLLOWER, sm.state());
+    ASSERT_EQ(ElectorTransitionReason::e_QUORUM_NOT_ACHIEVED, sm.reason());
+    ASSERT_EQ(k_INVALID_NODE, sm.leaderNodeId());
+    ASSERT_EQ(k_INVALID_NODE, sm.tentativeLeaderNodeId());
+    ASSERT_EQ(term, sm.term());
+    ASSERT_EQ(ElectorIOEventType::e_LEADERSHIP_CESSION, output.io());
+    ASSERT_EQ(ElectorTimerEventType::e_RANDOM_WAIT_TIMER, output.timer());
+    ASSERT_EQ(k_ALL_NODES, output.destination());
+    ASSERT_EQ(true, output.cancelTimerEventsFlag());
+    ASSERT_EQ(++age, sm.age());
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -2675,6 +3055,8 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 22: test22(); break;
+    case 21: test21(); break;
     case 20: test20(); break;
     case 19: test19(); break;
     case 18: test18(); break;
@@ -102,6 +102,14 @@ class MultiRequestManagerRequestContext {
 
     typedef typename Nodes::const_iterator NodesConstIter;
 
+  private:
+    // PRIVATE CONSTANTS
+
+    /// Number of destination nodes for which storage is reserved upfront
+    /// in every context, covering the common cluster sizes so that a
+    /// pooled context never has to grow its `d_nodeResponsePairs`.
+    static const int k_NUM_RESERVED_NODES = 7;
+
   private:
     // DATA
     REQUEST d_request;
@@ -271,7 +279,7 @@ MultiRequestManagerRequestContext<REQUEST, RESPONSE, TARGET>::
 , d_numOutstandingRequests(0)
 , d_responseCb(bsl::allocator_arg, allocator)
 {
-    // NOTHING
+    d_nodeResponsePairs.reserve(k_NUM_RESERVED_NODES);
 }
 
 // MANIPULATORS
@@ -437,6 +445,9 @@ void MultiRequestManager<REQUEST, RESPONSE, TARGET>::sendRequest(
 {
     NodeResponsePairs& nodeResponsePairs = context->d_nodeResponsePairs;
     int                numRequests       = context->d_numOutstandingRequests;
+    bsl::string        errorDescription;
+    // Shared across all nodes so that its buffer is allocated at most once
+    // per broadcast.
 
     for (NodeResponsePairsIter it = nodeResponsePairs.begin();
          it != nodeResponsePairs.end();
@@ -452,7 +463,7 @@ void MultiRequestManager<REQUEST, RESPONSE, TARGET>::sendRequest(
                                  it->first));
         setGroupId(singleRequestCtx, it->first);
 
-        bsl::string               errorDescription;
+        errorDescription.clear();
         bmqt::GenericResult::Enum sendRc = d_requestManager_p->sendRequest(
             singleRequestCtx,
             sendFn(it->first),
@@ -475,7 +486,7 @@ void MultiRequestManager<REQUEST, RESPONSE, TARGET>::sendRequest(
             mwcu::MemOutStream errorMsg;
             errorMsg << "Unable to send request to '"
                      << targetDescription(it->first)
-                     << "' [reason: " << errorMsg.str()
+                     << "' [reason: " << errorDescription
                      << "]: " << singleRequestCtx->request();
             failure.message() = errorMsg.str();
         }
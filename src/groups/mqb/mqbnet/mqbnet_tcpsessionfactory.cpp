@@ -57,6 +57,7 @@
 #include <bdlb_scopeexit.h>
 #include <bdlb_string.h>
 #include <bdlf_bind.h>
+#include <bdlf_memfn.h>
 #include <bdlf_placeholder.h>
 #include <bdlma_localsequentialallocator.h>
 #include <bdlt_timeunitratio.h>
@@ -93,7 +94,12 @@ namespace {
 
 BALL_LOG_SET_NAMESPACE_CATEGORY("MQBNET.TCPSESSIONFACTORY");
 
-const int k_CONNECT_INTERVAL     = 2;
+const int k_CONNECT_INTERVAL = 2;
+const int k_DNS_CACHE_TTL    = 5 * 60;
+// Time (in seconds) during which the domain name of a peer is reused
+// rather than resolved again when the peer reconnects.
+const int k_DNS_CACHE_CAPACITY = 10 * 1024;
+// Maximum number of peers whose domain name is cached.
 const int k_SESSION_DESTROY_WAIT = 10;
 // Maximum time to wait (in seconds) for all session to be destroyed
 // during stop sequence.
@@ -101,6 +107,32 @@ const int k_CLIENT_CLOSE_WAIT = 10;
 // Time to wait incrementally (in seconds) for all clients and
 // proxies to be destroyed during stop sequence.
 
+const int k_MIN_INCOMING_TRANSFER_SIZE = 4 * 1024;
+// Minimum number of bytes received per read from a socket.  Idle and
+// small-message channels stay at this size, which bounds the memory they
+// pin for incoming data.
+
+const int k_MAX_INCOMING_TRANSFER_SIZE = 1024 * 1024;
+// Maximum number of bytes received per read from a socket.  Busy channels
+// grow toward this size, based on how much each previous read returned,
+// which reduces the number of receive system calls per MB.
+
+const int k_HEARTBEAT_WHEEL_MAX_NUM_SLOTS = 8;
+// Maximum number of slots of the heartbeat wheel.  Each slot is checked by
+// one occurrence of the recurring heartbeat scheduler event, so that the
+// heartbeat enabled channels are checked in batches spread over the heartbeat
+// interval.
+
+int calculateHeartbeatWheelNumSlots(const mqbcfg::TcpInterfaceConfig& config)
+{
+    // Return the number of slots of the heartbeat wheel for the specified
+    // 'config', so that the recurring heartbeat scheduler event fires at most
+    // every millisecond.
+
+    return bsl::min(k_HEARTBEAT_WHEEL_MAX_NUM_SLOTS,
+                    bsl::max(1, config.heartbeatIntervalMs()));
+}
+
 char calculateInitialMissedHbCounter(const mqbcfg::TcpInterfaceConfig& config)
 {
     // Calculate the value with which 'ChannelInfo.d_missedHeartbeatCounter'
@@ -188,6 +220,16 @@ ntcCreateInterfaceConfig(const mqbcfg::TcpInterfaceConfig& tcpConfig)
     config.setWriteQueueLowWatermark(tcpConfig.lowWatermark());
     config.setWriteQueueHighWatermark(tcpConfig.highWatermark());
 
+    if (tcpConfig.zeroCopyThreshold() > 0) {
+        // Writes of at least this size are sent with MSG_ZEROCOPY: NTF keeps
+        // a reference to the blob buffers until the kernel reports their
+        // transmission through the socket error queue.
+        config.setZeroCopyThreshold(tcpConfig.zeroCopyThreshold());
+    }
+
+    config.setMinIncomingStreamTransferSize(k_MIN_INCOMING_TRANSFER_SIZE);
+    config.setMaxIncomingStreamTransferSize(k_MAX_INCOMING_TRANSFER_SIZE);
+
     config.setAcceptGreedily(false);
     config.setSendGreedily(false);
     config.setReceiveGreedily(false);
@@ -200,19 +242,21 @@ ntcCreateInterfaceConfig(const mqbcfg::TcpInterfaceConfig& tcpConfig)
 }
 
 /// Load into the specified `resolvedUri` the reverse-DNS resolved URI of
-/// the remote peer represented by the specified `baseChannel`.  This is a
-/// thin wrapper around the default DNS resolution from
-/// `mwcio::ResolvingChannelFactoryUtil` that just adds final resolution
-/// logging with time instrumentation.
-void monitoredDNSResolution(bsl::string*          resolvedUri,
-                            const mwcio::Channel& baseChannel)
+/// the remote peer represented by the specified `baseChannel`, using the
+/// specified `cache` of domain names.  This is a thin wrapper around the
+/// default DNS resolution from `mwcio::ResolvingChannelFactoryUtil` that
+/// just adds final resolution logging with time instrumentation.
+void monitoredDNSResolution(bsl::string*            resolvedUri,
+                            const mwcio::Channel&   baseChannel,
+                            mwcio::DomainNameCache* cache)
 {
     const bsls::Types::Int64 start = mwcsys::Time::highResolutionTimer();
 
     mwcio::ResolvingChannelFactoryUtil::defaultResolutionFn(
         resolvedUri,
         baseChannel,
-        &mwcio::ResolveUtil::getDomainName,
+        bdlf::MemFnUtil::memFn(&mwcio::DomainNameCache::getDomainName,
+                               cache),
         true);
 
     const bsls::Types::Int64 end = mwcsys::Time::highResolutionTimer();
@@ -283,7 +327,8 @@ struct TCPSessionFactory_OperationContext {
 bslma::ManagedPtr<mwcst::StatContext>
 TCPSessionFactory::channelStatContextCreator(
     const bsl::shared_ptr<mwcio::Channel>&                  channel,
-    const bsl::shared_ptr<mwcio::StatChannelFactoryHandle>& handle)
+    const bsl::shared_ptr<mwcio::StatChannelFactoryHandle>& handle,
+    const mwcst::StatContext::SnapshotCallback& preSnapshotCallback)
 {
     mwcst::StatContext* parent = 0;
 
@@ -313,6 +358,7 @@ TCPSessionFactory::channelStatContextCreator(
 
     bdlma::LocalSequentialAllocator<2048> localAllocator(d_allocator_p);
     mwcst::StatContextConfiguration       statConfig(name, &localAllocator);
+    statConfig.preSnapshotCallback(preSnapshotCallback);
 
     return parent->addSubcontext(statConfig);
 }
@@ -559,6 +605,7 @@ void TCPSessionFactory::negotiationComplete(
         info->d_maxMissedHeartbeat = negotiatorContext->maxMissedHeartbeat();
         info->d_missedHeartbeatCounter = d_initialMissedHeartbeatCounter;
         // See comments in 'calculateInitialMissedHbCounter'.
+        info->d_heartbeatWheelSlot = -1;
 
         bsl::pair<mwcio::Channel*, ChannelInfoSp> toInsert(channel.get(),
                                                            info);
@@ -770,9 +817,12 @@ void TCPSessionFactory::onHeartbeatSchedulerEvent()
 {
     // executed by the *SCHEDULER* thread
 
-    bsl::unordered_map<mwcio::Channel*, ChannelInfo*>::const_iterator it;
-    for (it = d_heartbeatChannels.begin(); it != d_heartbeatChannels.end();
-         ++it) {
+    const HeartbeatChannels& channels = d_heartbeatWheel[d_heartbeatWheelSlot];
+    d_heartbeatWheelSlot = (d_heartbeatWheelSlot + 1) %
+                           static_cast<int>(d_heartbeatWheel.size());
+
+    HeartbeatChannels::const_iterator it;
+    for (it = channels.begin(); it != channels.end(); ++it) {
         ChannelInfo* info = it->second;
 
         // Always proactively send a sporadic heartbeat response message to
@@ -840,11 +890,34 @@ void TCPSessionFactory::onHeartbeatSchedulerEvent()
     }
 }
 
+void TCPSessionFactory::clearHeartbeatWheel()
+{
+    // executed by the *SCHEDULER* thread, or after the recurring heartbeat
+    // scheduler event has been cancelled
+
+    for (size_t i = 0; i < d_heartbeatWheel.size(); ++i) {
+        d_heartbeatWheel[i].clear();
+    }
+    d_heartbeatWheelSlot = 0;
+}
+
 void TCPSessionFactory::enableHeartbeat(ChannelInfo* channelInfo)
 {
     // executed by the *SCHEDULER* thread
 
-    d_heartbeatChannels[channelInfo->d_channel_p] = channelInfo;
+    BSLS_ASSERT_SAFE(!d_heartbeatWheel.empty());
+
+    // Add the channel to the least loaded slot, so that the channels are
+    // evenly spread over the heartbeat interval.
+    int slot = 0;
+    for (int i = 1; i < static_cast<int>(d_heartbeatWheel.size()); ++i) {
+        if (d_heartbeatWheel[i].size() < d_heartbeatWheel[slot].size()) {
+            slot = i;
+        }
+    }
+
+    channelInfo->d_heartbeatWheelSlot                = slot;
+    d_heartbeatWheel[slot][channelInfo->d_channel_p] = channelInfo;
 }
 
 void TCPSessionFactory::disableHeartbeat(
@@ -855,7 +928,13 @@ void TCPSessionFactory::disableHeartbeat(
     BALL_LOG_INFO << "Disabling TCPSessionFactory '" << d_config.name()
                   << "' Heartbeat";
 
-    d_heartbeatChannels.erase(channelInfo->d_channel_p);
+    if (channelInfo->d_heartbeatWheelSlot < 0) {
+        return;  // RETURN
+    }
+
+    d_heartbeatWheel[channelInfo->d_heartbeatWheelSlot].erase(
+        channelInfo->d_channel_p);
+    channelInfo->d_heartbeatWheelSlot = -1;
 }
 
 TCPSessionFactory::TCPSessionFactory(
@@ -874,6 +953,10 @@ TCPSessionFactory::TCPSessionFactory(
 , d_statController_p(statController)
 , d_tcpChannelFactory_mp()
 , d_resolutionContext(allocator)
+, d_domainNameCache(&mwcio::ResolveUtil::getDomainName,
+                    bsls::TimeInterval(k_DNS_CACHE_TTL),
+                    k_DNS_CACHE_CAPACITY,
+                    allocator)
 , d_resolvingChannelFactory_mp()
 , d_reconnectingChannelFactory_mp()
 , d_statChannelFactory_mp()
@@ -885,8 +968,10 @@ TCPSessionFactory::TCPSessionFactory(
 , d_noClientCondition(bsls::SystemClockType::e_MONOTONIC)
 , d_channels(allocator)
 , d_heartbeatSchedulerActive(false)
-, d_heartbeatChannels(allocator)
+, d_heartbeatWheel(calculateHeartbeatWheelNumSlots(config), allocator)
+, d_heartbeatWheelSlot(0)
 , d_initialMissedHeartbeatCounter(calculateInitialMissedHbCounter(config))
+, d_listeningHandles(allocator)
 , d_isListening(false)
 , d_allocator_p(allocator)
 {
@@ -996,8 +1081,9 @@ int TCPSessionFactory::start(bsl::ostream& errorDescription)
                 d_allocator_p)
                 .resolutionFn(bdlf::BindUtil::bind(
                     &monitoredDNSResolution,
-                    bdlf::PlaceHolders::_1,    // resolvedUri
-                    bdlf::PlaceHolders::_2)),  // channel
+                    bdlf::PlaceHolders::_1,  // resolvedUri
+                    bdlf::PlaceHolders::_2,  // channel
+                    &d_domainNameCache)),
             d_allocator_p),
         d_allocator_p);
 
@@ -1038,7 +1124,8 @@ int TCPSessionFactory::start(bsl::ostream& errorDescription)
                     &TCPSessionFactory::channelStatContextCreator,
                     this,
                     bdlf::PlaceHolders::_1,   // channel
-                    bdlf::PlaceHolders::_2),  // handle
+                    bdlf::PlaceHolders::_2,   // handle
+                    bdlf::PlaceHolders::_3),  // preSnapshotCallback
                 d_allocator_p),
             d_allocator_p),
         d_allocator_p);
@@ -1052,8 +1139,14 @@ int TCPSessionFactory::start(bsl::ostream& errorDescription)
                    bdlt::TimeUnitRatio::k_NANOSECONDS_PER_MILLISECOND)
             << ")";
 
+        // Each occurrence of the recurring event checks one slot of the
+        // heartbeat wheel, so that each channel is checked once per heartbeat
+        // interval.
         bsls::TimeInterval interval;
-        interval.addMilliseconds(d_config.heartbeatIntervalMs());
+        interval.addMicroseconds(
+            static_cast<bsls::Types::Int64>(d_config.heartbeatIntervalMs()) *
+            bdlt::TimeUnitRatio::k_US_PER_MS /
+            static_cast<int>(d_heartbeatWheel.size()));
 
         d_scheduler_p->scheduleRecurringEvent(
             &d_heartbeatSchedulerHandle,
@@ -1104,9 +1197,11 @@ void TCPSessionFactory::stopListening()
     }
     d_isListening = false;
 
-    BSLS_ASSERT_SAFE(d_listeningHandle_mp);
-    d_listeningHandle_mp->cancel();
-    d_listeningHandle_mp.reset();
+    BSLS_ASSERT_SAFE(!d_listeningHandles.empty());
+    for (size_t i = 0; i < d_listeningHandles.size(); ++i) {
+        d_listeningHandles[i]->cancel();
+    }
+    d_listeningHandles.clear();
 
     // NOTE: This is done here as a temporary workaround until channels are
     //       properly stopped (see 'mqba::Application::stop'), because in the
@@ -1117,7 +1212,7 @@ void TCPSessionFactory::stopListening()
     if (d_heartbeatSchedulerActive) {
         d_heartbeatSchedulerActive = false;
         d_scheduler_p->cancelEventAndWait(&d_heartbeatSchedulerHandle);
-        d_heartbeatChannels.clear();
+        clearHeartbeatWheel();
     }
 }
 
@@ -1194,7 +1289,7 @@ void TCPSessionFactory::stop()
     if (d_heartbeatSchedulerActive) {
         d_heartbeatSchedulerActive = false;
         d_scheduler_p->cancelEventAndWait(&d_heartbeatSchedulerHandle);
-        d_heartbeatChannels.clear();
+        clearHeartbeatWheel();
     }
 
     // NOTE: We don't need to manually call 'teardown' on any active session in
@@ -1282,31 +1377,100 @@ int TCPSessionFactory::listen(int port, const ResultCallback& resultCallback)
     mwcio::ListenOptions listenOptions;
     listenOptions.setEndpoint(endpoint.str());
 
+    // Each listening socket is attached to an IO thread of the channel
+    // factory, so several sockets sharing the port spread the accepts, and
+    // the negotiations they trigger, across the IO threads.
+    const int numListeners = bsl::max(1, d_config.numListeners());
+    if (numListeners > 1) {
+        listenOptions.properties().set(
+                             mwcio::NtcListenerUtil::listenReusePortProperty(),
+                             1);
+    }
+
     d_isListening = true;
 
-    mwcio::Status status;
-    d_statChannelFactory_mp->listen(
-        &status,
-        &d_listeningHandle_mp,
-        listenOptions,
-        bdlf::BindUtil::bind(&TCPSessionFactory::channelStateCallback,
-                             this,
-                             bdlf::PlaceHolders::_1,  // event
-                             bdlf::PlaceHolders::_2,  // status
-                             bdlf::PlaceHolders::_3,  // channel
-                             contextSp));
-    if (!status) {
-        BALL_LOG_ERROR << "#TCP_LISTEN_FAILED "
-                       << "TCPSessionFactory '" << d_config.name() << "' "
-                       << "failed listening to '" << endpoint.str()
-                       << "' [status: " << status << "]";
-        d_isListening = false;
-        return status.category();  // RETURN
+    for (int i = 0; i < numListeners; ++i) {
+        mwcio::Status status;
+        OpHandleMp    handle;
+        d_statChannelFactory_mp->listen(
+            &status,
+            &handle,
+            listenOptions,
+            bdlf::BindUtil::bind(&TCPSessionFactory::channelStateCallback,
+                                 this,
+                                 bdlf::PlaceHolders::_1,  // event
+                                 bdlf::PlaceHolders::_2,  // status
+                                 bdlf::PlaceHolders::_3,  // channel
+                                 contextSp));
+        if (!status) {
+            BALL_LOG_ERROR << "#TCP_LISTEN_FAILED "
+                           << "TCPSessionFactory '" << d_config.name() << "' "
+                           << "failed listening to '" << endpoint.str()
+                           << "' [listener: " << i << "/" << numListeners
+                           << ", status: " << status << "]";
+            for (size_t j = 0; j < d_listeningHandles.size(); ++j) {
+                d_listeningHandles[j]->cancel();
+            }
+            d_listeningHandles.clear();
+            d_isListening = false;
+            return status.category();  // RETURN
+        }
+
+        BSLS_ASSERT_SAFE(handle);
+        d_listeningHandles.push_back(
+            bsl::shared_ptr<mwcio::ChannelFactory::OpHandle>(handle,
+                                                             d_allocator_p));
     }
 
-    BSLS_ASSERT_SAFE(d_listeningHandle_mp);
     BALL_LOG_INFO << "TCPSessionFactory '" << d_config.name() << "' "
-                  << "successfully listening to '" << endpoint.str() << "'";
+                  << "successfully listening to '" << endpoint.str() << "'"
+                  << " [listeners: " << numListeners << "]";
+
+    if (!d_config.localSocketPath().empty()) {
+        // Also accept clients running on this host over a local socket,
+        // which spares them the loopback TCP/IP stack.  Sessions on either
+        // kind of socket are negotiated and served identically.
+        bsl::string localEndpoint(mwcio::NtcChannelUtil::localEndpointPrefix(),
+                                  d_allocator_p);
+        localEndpoint.append(d_config.localSocketPath());
+
+        mwcio::ListenOptions localListenOptions;
+        localListenOptions.setEndpoint(localEndpoint);
+
+        mwcio::Status status;
+        OpHandleMp    handle;
+        d_statChannelFactory_mp->listen(
+            &status,
+            &handle,
+            localListenOptions,
+            bdlf::BindUtil::bind(&TCPSessionFactory::channelStateCallback,
+                                 this,
+                                 bdlf::PlaceHolders::_1,  // event
+                                 bdlf::PlaceHolders::_2,  // status
+                                 bdlf::PlaceHolders::_3,  // channel
+                                 contextSp));
+        if (!status) {
+            BALL_LOG_ERROR << "#TCP_LISTEN_FAILED "
+                           << "TCPSessionFactory '" << d_config.name() << "' "
+                           << "failed listening to '" << localEndpoint
+                           << "' [status: " << status << "]";
+            for (size_t j = 0; j < d_listeningHandles.size(); ++j) {
+                d_listeningHandles[j]->cancel();
+            }
+            d_listeningHandles.clear();
+            d_isListening = false;
+            return status.category();  // RETURN
+        }
+
+        BSLS_ASSERT_SAFE(handle);
+        d_listeningHandles.push_back(
+            bsl::shared_ptr<mwcio::ChannelFactory::OpHandle>(handle,
+                                                             d_allocator_p));
+
+        BALL_LOG_INFO << "TCPSessionFactory '" << d_config.name() << "' "
+                      << "successfully listening to '" << localEndpoint
+                      << "'";
+    }
 
     return 0;
 }
@@ -57,12 +57,15 @@
 // work as the channel will be closed immediately, without allowing for the
 // 'HeartbeatRsp' to be received.
 //
-// It is implemented by keeping track of events received on the channel; and a
-// recurring scheduler event (default to every 3s, called the 'heartbeat
-// interval') checks received activity on all enabled channel, emitting
-// 'heartbeatReq' if no data was received, and resetting the channel if no
-// data is received after at least 'maxMissedHeartbeat' heartbeat intervals, as
-// explained below:
+// It is implemented by keeping track of events received on the channel; and
+// each enabled channel is checked once per 'heartbeat interval' (default to
+// 3s), emitting 'heartbeatReq' if no data was received, and resetting the
+// channel if no data is received after at least 'maxMissedHeartbeat'
+// heartbeat intervals.  Enabled channels are spread over the slots of a
+// heartbeat wheel, and a single recurring scheduler event checks the channels
+// of one slot at a time, so that the checks (and the resulting writes) of a
+// large number of channels are spread over the heartbeat interval instead of
+// being done in one burst.  This is explained below:
 //..
 //   |..........|..........|..........|..........|..........|.....>
 //   0          1          2          3          4          5
@@ -87,6 +90,7 @@
 #include <mwcex_sequentialcontext.h>
 #include <mwcio_channel.h>
 #include <mwcio_channelfactory.h>
+#include <mwcio_domainnamecache.h>
 #include <mwcio_reconnectingchannelfactory.h>
 #include <mwcio_resolvingchannelfactory.h>
 #include <mwcio_statchannelfactory.h>
@@ -102,6 +106,7 @@
 #include <bsl_ostream.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
@@ -212,6 +217,14 @@ class TCPSessionFactory {
         // channel.  This variable is entirely and
         // solely managed from within the event
         // scheduler thread.
+
+        int d_heartbeatWheelSlot;
+        // Index of the slot of the heartbeat wheel
+        // this channel belongs to, or -1 if
+        // heartbeat is not enabled for this
+        // channel.  This variable is entirely and
+        // solely managed from within the event
+        // scheduler thread.
     };
 
     typedef bsl::shared_ptr<ChannelInfo> ChannelInfoSp;
@@ -220,6 +233,11 @@ class TCPSessionFactory {
     /// shared_ptr because of the atomicInt which has no copy constructor).
     typedef bsl::unordered_map<mwcio::Channel*, ChannelInfoSp> ChannelMap;
 
+    /// Map associating a heartbeat enabled `Channel` to its corresponding
+    /// `ChannelInfo`, for one slot of the heartbeat wheel.
+    typedef bsl::unordered_map<mwcio::Channel*, ChannelInfo*>
+        HeartbeatChannels;
+
     /// Shortcut for a managedPtr to the `mwcio::TCPChannelFactory`
     typedef bslma::ManagedPtr<mwcio::ChannelFactory> TCPChannelFactoryMp;
 
@@ -273,6 +291,11 @@ class TCPSessionFactory {
     // Executor context used for
     // performing DNS resolution
 
+    mwcio::DomainNameCache d_domainNameCache;
+    // Domain names of the peers resolved
+    // recently, so that reconnecting
+    // peers are not resolved again
+
     ResolvingChannelFactoryMp d_resolvingChannelFactory_mp;
 
     ReconnectingChannelFactoryMp d_reconnectingChannelFactory_mp;
@@ -330,22 +353,34 @@ class TCPSessionFactory {
     // heartbeat monitor the
     // channels.
 
-    bsl::unordered_map<mwcio::Channel*, ChannelInfo*> d_heartbeatChannels;
-    // Map of all channels which are
-    // heartbeat enabled; only
+    bsl::vector<HeartbeatChannels> d_heartbeatWheel;
+    // Slots of the heartbeat wheel,
+    // each one being the map of the
+    // heartbeat enabled channels
+    // checked by the same recurring
+    // scheduler event; only
     // manipulated from the event
     // scheduler thread.
 
+    int d_heartbeatWheelSlot;
+    // Index, in 'd_heartbeatWheel',
+    // of the slot to check on the
+    // next heartbeat scheduler
+    // event; only manipulated from
+    // the event scheduler thread.
+
     const char d_initialMissedHeartbeatCounter;
     // Value for initializing
     // 'ChannelInfo.d_missedHeartbeatCounter'.
     // See comments in
     // 'calculateInitialMissedHbCounter'.
 
-    OpHandleMp d_listeningHandle_mp;
-    // Handle which can be used to
-    // stop listening.  Empty unless
-    // listening.
+    bsl::vector<bsl::shared_ptr<mwcio::ChannelFactory::OpHandle> >
+        d_listeningHandles;
+    // Handles which can be used to
+    // stop listening, one per
+    // listening socket.  Empty
+    // unless listening.
 
     bsls::AtomicBool d_isListening;
     // Set to 'true' before calling
@@ -373,10 +408,12 @@ class TCPSessionFactory {
     // PRIVATE MANIPULATORS
 
     /// Create and return the statContext to be used for tracking stats of
-    /// the specified `channel` obtained from the specified `handle`.
+    /// the specified `channel` obtained from the specified `handle`, and
+    /// configured with the specified `preSnapshotCallback`.
     bslma::ManagedPtr<mwcst::StatContext> channelStatContextCreator(
         const bsl::shared_ptr<mwcio::Channel>&                  channel,
-        const bsl::shared_ptr<mwcio::StatChannelFactoryHandle>& handle);
+        const bsl::shared_ptr<mwcio::StatChannelFactoryHandle>& handle,
+        const mwcst::StatContext::SnapshotCallback& preSnapshotCallback);
 
     /// Asynchronously negotiate on the specified `channel` using the
     /// specified `context`.
@@ -453,11 +490,15 @@ class TCPSessionFactory {
                          const mwcio::Status&                   status);
 
     /// Reccuring scheduler event to check for all `heartbeat-enabled`
-    /// channels : this will send a heartbeat if no data has been received
+    /// channels of the current slot of the heartbeat wheel, and move to the
+    /// next slot: this will send a heartbeat if no data has been received
     /// on a given channel, or proactively reset the channel if too many
     /// heartbeats have been missed.
     void onHeartbeatSchedulerEvent();
 
+    /// Remove all the channels from the heartbeat wheel.
+    void clearHeartbeatWheel();
+
     /// Enable heartbeat for the channel represented by the specified
     /// `channelInfo`.
     void enableHeartbeat(ChannelInfo* channelInfo);
@@ -527,7 +568,10 @@ class TCPSessionFactory {
 
     /// Listen to the specified `port` for incoming connection and invoke
     /// the specified `resultCallback` when a connection has been
-    /// negotiated.  Return 0 on success, or non-zero on error.
+    /// negotiated.  Return 0 on success, or non-zero on error.  If the
+    /// configuration requests more than one listener, that many sockets
+    /// share the `port` with SO_REUSEPORT, so that accepts and the
+    /// subsequent negotiations are spread across the IO threads.
     int listen(int port, const ResultCallback& resultCallback);
 
     /// Initiate a connection to the specified `endpoint` and return 0 if
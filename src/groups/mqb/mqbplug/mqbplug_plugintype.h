@@ -42,7 +42,7 @@ namespace mqbplug {
 /// authentication, ...)
 struct PluginType {
     // TYPES
-    enum Enum { e_STATS_CONSUMER };
+    enum Enum { e_STATS_CONSUMER, e_STORAGE_ENGINE };
 
     // CLASS METHODS
 
@@ -17,6 +17,9 @@
 #include <mqbplug_statconsumer.h>
 
 #include <mqbscm_version.h>
+// BDE
+#include <bsls_annotation.h>
+
 namespace BloombergLP {
 namespace mqbplug {
 
@@ -30,6 +33,19 @@ StatConsumer::~StatConsumer()
     // NOTHING
 }
 
+// ACCESSORS
+bool StatConsumer::usesSnapshotBuffers() const
+{
+    return false;
+}
+
+// MANIPULATORS
+void StatConsumer::onSnapshotBuffers(
+    BSLS_ANNOTATION_UNUSED const StatSnapshotBuffersSp& snapshotBuffers)
+{
+    // NOTHING
+}
+
 // -------------------------------
 // class StatConsumerPluginFactory
 // -------------------------------
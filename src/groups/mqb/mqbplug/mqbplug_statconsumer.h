@@ -27,6 +27,21 @@
 //@DESCRIPTION: This component provide definitions for classes
 // 'mqbplug::StatConsumer', 'mqbplug::StatConsumerPluginFactory' used as base
 // classes for plugins that publish statistics and for their factories.
+//
+/// Snapshot Buffers
+///----------------
+// A consumer is notified of each snapshot of the stat contexts in one of two
+// ways:
+//: o by default, 'onSnapshot' is invoked from the stat scheduler thread, and
+//:   the consumer walks the stat contexts it was given at creation;
+//: o if 'usesSnapshotBuffers' returns 'true', 'onSnapshotBuffers' is instead
+//:   invoked from a dedicated publication thread, with an immutable columnar
+//:   copy (see 'mwcst_statsnapshotbuffer') of each root stat context.
+//
+// The snapshot buffers are loaded once per snapshot, and shared by all the
+// consumers using them, so that adding such a consumer costs no additional
+// walk of the stat contexts, and its formatting and publication never delay
+// the snapshots.
 
 // MQB
 #include <mqbcfg_brokerconfig.h>
@@ -37,6 +52,7 @@
 #include <bdlbb_blob.h>
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
+#include <bsl_memory.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
 #include <bslma_managedptr.h>
@@ -50,6 +66,7 @@ namespace BloombergLP {
 // FORWARD DECLARATION
 namespace mwcst {
 class StatContext;
+class StatSnapshotBuffer;
 }
 
 namespace mqbplug {
@@ -66,6 +83,14 @@ class StatConsumer {
         StatContextsMap;
     // Map of StatContext names to StatContext
 
+    typedef bsl::unordered_map<bsl::string, const mwcst::StatSnapshotBuffer*>
+        StatSnapshotBuffersMap;
+    // Map of StatContext names to the snapshot buffer of the StatContext
+
+    typedef bsl::shared_ptr<const StatSnapshotBuffersMap>
+        StatSnapshotBuffersSp;
+    // Shared immutable snapshot buffers of the StatContexts
+
     typedef bsl::function<int(const bslstl::StringRef& source,
                               const bsl::string&       cmd,
                               bsl::ostream&            os)>
@@ -87,6 +112,13 @@ class StatConsumer {
     /// Return current value of publish interval.
     virtual bsls::TimeInterval publishInterval() const = 0;
 
+    /// Return `true` if this consumer publishes the stats from the snapshot
+    /// buffers given to `onSnapshotBuffers`, and `false` if it publishes
+    /// them from the stat contexts in `onSnapshot`.  The default
+    /// implementation returns `false`.  The behavior is undefined unless
+    /// the value returned does not change once the consumer is started.
+    virtual bool usesSnapshotBuffers() const;
+
     // MANIPULATORS
 
     /// Start the StatConsumer and return 0 on success, or return a non-zero
@@ -98,9 +130,25 @@ class StatConsumer {
     virtual void stop() = 0;
 
     /// Publish the stats if publishing at the intervals specified by the
-    /// config.
+    /// config.  Note that the queue stat contexts are snapshotted
+    /// incrementally, so that a consumer may publish only the stats of the
+    /// queues that changed since the previous snapshot, using
+    /// `mwcst::StatSnapshotBuffer::loadChanged` or
+    /// `mwcst::StatContext::isIdle`.
     virtual void onSnapshot() = 0;
 
+    /// Publish the stats from the specified `snapshotBuffers` if publishing
+    /// at the intervals specified by the config.  This is invoked after
+    /// each snapshot, instead of `onSnapshot`, if `usesSnapshotBuffers`
+    /// returns `true`, from the stat publication thread: the calls are
+    /// serialized, but may run concurrently with the other methods of this
+    /// object.  The `snapshotBuffers` are immutable and shared with the
+    /// other consumers; they may be retained, for instance to compute
+    /// deltas with the next snapshot.  The default implementation does
+    /// nothing.
+    virtual void
+    onSnapshotBuffers(const StatSnapshotBuffersSp& snapshotBuffers);
+
     /// Set the stats publish interval with the specified `interval`.
     /// Disable the stats publishing if `interval` is 0.  It is expected
     /// that specified `interval` is a multiple of the snapshot interval or
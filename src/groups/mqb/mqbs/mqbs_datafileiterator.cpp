@@ -212,6 +212,63 @@ int DataFileIterator::nextRecord()
     return rc_HAS_NEXT;
 }
 
+int DataFileIterator::advanceToRecord(bsls::Types::Uint64 offset)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_HAS_NEXT = 1  // The record exists
+        ,
+        rc_INVALID = -1  // The Iterator is an invalid state
+        ,
+        rc_NOT_ENOUGH_BYTES_FOR_HDR = -2  // Not enough bytes for DataHeader
+        ,
+        rc_NOT_ENOUGH_BYTES_FOR_MSG = -3  // Not enough bytes for the payload
+        ,
+        rc_CORRUPT_HEADER = -4  // Corrupt DataHeader
+        ,
+        rc_INVALID_OFFSET = -5  // Offset before the next record
+    };
+
+    if (!isValid() || isReverseMode()) {
+        return rc_INVALID;  // RETURN
+    }
+
+    const bsls::Types::Uint64 nextOffset = d_blockIter.position() +
+                                           d_advanceLength;
+    if (offset < nextOffset) {
+        clear();
+        return rc_INVALID_OFFSET;  // RETURN
+    }
+
+    if (false == d_blockIter.advance(offset - d_blockIter.position()) ||
+        d_blockIter.remaining() < DataHeader::k_MIN_HEADER_SIZE) {
+        clear();
+        return rc_NOT_ENOUGH_BYTES_FOR_HDR;  // RETURN
+    }
+
+    OffsetPtr<const DataHeader> dh(*d_blockIter.block(),
+                                   d_blockIter.position());
+
+    // `dataLen` represents len(DataHeader + ApplicationData)
+    const unsigned int dataLen = dh->messageWords() *
+                                 bmqp::Protocol::k_WORD_SIZE;
+
+    if (0 == dataLen) {
+        clear();
+        return rc_CORRUPT_HEADER;  // RETURN
+    }
+
+    if (d_blockIter.remaining() < dataLen) {
+        clear();
+        return rc_NOT_ENOUGH_BYTES_FOR_MSG;  // RETURN
+    }
+
+    ++d_dataRecordIndex;
+    d_advanceLength = dataLen;
+
+    return rc_HAS_NEXT;
+}
+
 void DataFileIterator::flipDirection()
 {
     d_blockIter.flipDirection();
@@ -89,6 +89,20 @@ class DataFileIterator {
     /// and `isValid`.
     int nextRecord();
 
+    /// Move this iterator to the record at the specified `offset` in the
+    /// file, without reading the data located between the current position
+    /// and `offset`.  Return 1 if `offset` is the position of a valid
+    /// record, or < 0 otherwise, in which case this instance goes in an
+    /// invalid state.  This is meant to follow the offsets of the message
+    /// records of the associated journal, so that the regions of the file
+    /// deallocated by a compaction, which read as zeroes and therefore stop
+    /// `nextRecord`, are skipped.  The behavior is undefined unless
+    /// `isValid()` returns true, this iterator is in forward mode, and
+    /// `offset` is not before the record following the current position.
+    /// Note that `recordIndex` then counts the records visited, rather than
+    /// the records located before the current one.
+    int advanceToRecord(bsls::Types::Uint64 offset);
+
     /// Changes the direction of the iterator.  Unlike calling reset,
     /// calling this function maintains the current file position within the
     /// journal.  Returns 0 if it was successful, otherwise < 0.  If the
@@ -384,6 +384,118 @@ static void test3_reverseIteration()
     s_allocator_p->deallocate(p);
 }
 
+static void test4_advanceToRecord()
+// ------------------------------------------------------------------------
+// ADVANCE TO RECORD
+//
+// Concerns:
+//   1. A region of the file deallocated by a compaction, which reads as
+//      zeroes, stops forward iteration with 'nextRecord'.
+//   2. 'advanceToRecord' moves to the record at an offset given by the
+//      journal, skipping such a region, and forward iteration can resume
+//      from there.
+//   3. 'advanceToRecord' fails, and invalidates the iterator, when the
+//      offset is before the next record or does not hold a valid record.
+//
+// Testing:
+//   advanceToRecord(bsls::Types::Uint64 offset)
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("ADVANCE TO RECORD");
+
+    const Message MESSAGES[] = {
+        {L_, "APP_DATA_APP_DATA_APP_DATA", "OPTIONS_OPTIONS_"},
+        {L_, "APP_DATA_APP_DATA_APP_DATA_APP_DATA_APP_DATA", ""},
+        {L_, "APP_DATA_APP_DATA", "OPTIONS_"},
+        {L_, "APP", ""},
+        {L_, "APP_DATA_APP_DATA_APP_DATA_APP_DATA", "OPTIONS_OPTIONS_"},
+    };
+
+    const unsigned int k_NUM_MSGS = sizeof(MESSAGES) / sizeof(*MESSAGES);
+
+    FileHeader           fileHeader;
+    MappedFileDescriptor mfd;
+    char*                p =
+        addRecords(s_allocator_p, &mfd, &fileHeader, MESSAGES, k_NUM_MSGS);
+
+    // Load the offsets of the records, as the journal would provide them.
+    bsls::Types::Uint64 offsets[k_NUM_MSGS];
+    {
+        DataFileIterator it(&mfd, fileHeader);
+        for (unsigned int i = 0; i < k_NUM_MSGS; ++i) {
+            ASSERT_EQ_D(i, 1, it.nextRecord());
+            offsets[i] = it.recordOffset();
+        }
+    }
+
+    // Deallocate the 2nd and 3rd records, which then read as zeroes.
+    bsl::memset(p + offsets[1], 0, offsets[3] - offsets[1]);
+
+    PV("Forward iteration stops at the deallocated region");
+    {
+        DataFileIterator it(&mfd, fileHeader);
+        ASSERT_EQ(1, it.nextRecord());
+        ASSERT_EQ(offsets[0], it.recordOffset());
+        ASSERT_LT(it.nextRecord(), 0);
+        ASSERT_EQ(false, it.isValid());
+    }
+
+    PV("Journal guided iteration skips the deallocated region");
+    {
+        DataFileIterator it(&mfd, fileHeader);
+        ASSERT_EQ(1, it.nextRecord());
+        ASSERT_EQ(1, it.advanceToRecord(offsets[3]));
+        ASSERT_EQ(offsets[3], it.recordOffset());
+
+        const char*  data   = 0;
+        unsigned int length = 0;
+        it.loadApplicationData(&data, &length);
+        ASSERT_EQ(bsl::strlen(MESSAGES[3].d_appData_p), length);
+        ASSERT_EQ(0, bsl::memcmp(data, MESSAGES[3].d_appData_p, length));
+
+        // Resume forward iteration.
+        ASSERT_EQ(1, it.nextRecord());
+        ASSERT_EQ(offsets[4], it.recordOffset());
+
+        it.loadApplicationData(&data, &length);
+        ASSERT_EQ(bsl::strlen(MESSAGES[4].d_appData_p), length);
+        ASSERT_EQ(0, bsl::memcmp(data, MESSAGES[4].d_appData_p, length));
+
+        ASSERT_NE(1, it.nextRecord());
+    }
+
+    PV("Journal guided iteration from the start of the file");
+    {
+        DataFileIterator it(&mfd, fileHeader);
+        ASSERT_EQ(1, it.advanceToRecord(offsets[0]));
+        ASSERT_EQ(offsets[0], it.recordOffset());
+    }
+
+    PV("Offset before the next record");
+    {
+        DataFileIterator it(&mfd, fileHeader);
+        ASSERT_EQ(1, it.advanceToRecord(offsets[3]));
+        ASSERT_LT(it.advanceToRecord(offsets[0]), 0);
+        ASSERT_EQ(false, it.isValid());
+    }
+
+    PV("Offset in the deallocated region");
+    {
+        DataFileIterator it(&mfd, fileHeader);
+        ASSERT_LT(it.advanceToRecord(offsets[2]), 0);
+        ASSERT_EQ(false, it.isValid());
+    }
+
+    PV("Offset beyond the end of the file");
+    {
+        DataFileIterator it(&mfd, fileHeader);
+        ASSERT_LT(it.advanceToRecord(mfd.fileSize()), 0);
+        ASSERT_EQ(false, it.isValid());
+    }
+
+    s_allocator_p->deallocate(p);
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -394,6 +506,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 4: test4_advanceToRecord(); break;
     case 3: test3_reverseIteration(); break;
     case 2: test2_forwardIteration(); break;
     case 1: test1_breathingTest(); break;
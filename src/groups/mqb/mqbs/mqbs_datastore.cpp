@@ -42,14 +42,28 @@ DataStoreConfig::DataStoreConfig()
 , d_scheduler_p(0)
 , d_preallocate(false)
 , d_prefaultPages(false)
+, d_chainReplication(false)
+, d_incrementalWriteBack(false)
+, d_hugePages(false)
+, d_persistentMemory(false)
 , d_location()
 , d_archiveLocation()
+, d_tierLocation()
+, d_spillLocation()
 , d_nodeId(-1)
 , d_partitionId(-1)
 , d_maxDataFileSize(0)
 , d_maxJournalFileSize(0)
 , d_maxQlistFileSize(0)
 , d_maxArchivedFileSets(0)
+, d_groupCommitWindowUs(0)
+, d_groupCommitMaxBytes(0)
+, d_recoveryIndexIntervalSec(0)
+, d_compactionIntervalSec(0)
+, d_readAheadMaxBytes(0)
+, d_replicationBatchMaxBytes(0)
+, d_replicationBatchMaxLatencyUs(0)
+, d_storageEngine_p(0)
 {
     // NOTHING
 }
@@ -70,17 +84,38 @@ bsl::ostream& DataStoreConfig::print(bsl::ostream& stream,
     printer.printAttribute("partitionId", partitionId());
     printer.printAttribute("location", location());
     printer.printAttribute("archiveLocation", archiveLocation());
+    printer.printAttribute("tierLocation", tierLocation());
+    printer.printAttribute("spillLocation", spillLocation());
     printer.printAttribute("clusterName", clusterName());
     printer.printAttribute("preallocate",
                            (hasPreallocate() ? "true" : "false"));
     printer.printAttribute("prefaultPages",
                            (hasPrefaultPages() ? "true" : "false"));
+    printer.printAttribute("chainReplication",
+                           (hasChainReplication() ? "true" : "false"));
+    printer.printAttribute("incrementalWriteBack",
+                           (hasIncrementalWriteBack() ? "true" : "false"));
+    printer.printAttribute("hugePages", (hasHugePages() ? "true" : "false"));
+    printer.printAttribute("persistentMemory",
+                           (hasPersistentMemory() ? "true" : "false"));
     printer.printAttribute("maxDataFileSize", maxDataFileSize());
     printer.printAttribute("maxQlistFileSize", maxQlistFileSize());
     printer.printAttribute("maxJournalFileSize", maxJournalFileSize());
     printer.printAttribute("hasRecoveredQueuesCb",
                            (recoveredQueuesCb() ? "yes" : "no"));
+    printer.printAttribute("hasStorageEngine",
+                           (storageEngine() ? "yes" : "no"));
     printer.printAttribute("maxArchiveFileSets", maxArchivedFileSets());
+    printer.printAttribute("groupCommitWindowUs", groupCommitWindowUs());
+    printer.printAttribute("groupCommitMaxBytes", groupCommitMaxBytes());
+    printer.printAttribute("recoveryIndexIntervalSec",
+                           recoveryIndexIntervalSec());
+    printer.printAttribute("compactionIntervalSec", compactionIntervalSec());
+    printer.printAttribute("readAheadMaxBytes", readAheadMaxBytes());
+    printer.printAttribute("replicationBatchMaxBytes",
+                           replicationBatchMaxBytes());
+    printer.printAttribute("replicationBatchMaxLatencyUs",
+                           replicationBatchMaxLatencyUs());
     printer.end();
     return stream;
 }
@@ -23,6 +23,7 @@
 //  mqbs::DataStoreRecordFlag:     Status of a record in data store.
 //  mqbs::DataStoreRecordFlagUtil: 'mqbs::DataStoreRecordFlag' utility
 //  mqbs::DataStoreRecord:         A record in data store.
+//  mqbs::DataStoreRecordProfile:  Profile of the records of a queue.
 //  mqbs::DataStoreConfig:         Configuration of a data store.
 //  mqbs::DataStoreRecordHandle:   VST handle to a 'mqbs::DataStoreRecord'
 //  mqbs::DataStore:               Interface for a BlazingMQ data store.
@@ -84,6 +85,7 @@ class ClusterNode;
 }
 namespace mqbs {
 class ReplicatedStorage;
+class StorageEngine;
 }
 
 namespace mqbs {
@@ -94,11 +96,11 @@ namespace mqbs {
 
 /// This component provides a VST representing a record in the in-memory
 /// queue of an instance of a concrete implementation of `mqbs::DataStore`.
+/// Note that the data members are declared in decreasing order of alignment
+/// to avoid padding, as there is one instance per outstanding record.
 struct DataStoreRecord {
   public:
     // PUBLIC DATA
-    RecordType::Enum d_recordType;  // Type of the journal record
-
     bsls::Types::Uint64 d_recordOffset;  // Offset of record in journal
 
     bsls::Types::Uint64 d_messageOffset;
@@ -109,6 +111,22 @@ struct DataStoreRecord {
     // `mqbs::DataHeader` struct for the
     // message.
 
+    bsls::Types::Int64 d_arrivalTimepoint;
+    // Arrival timepoint of the message, in
+    // nanoseconds from an arbitrary but
+    // fixed point in time.  Note that this
+    // field is meaningful only inside a
+    // process, and only at the primary
+    // node.  Also note that a zero
+    // represents an unset value.  Lastly,
+    // this field is used only if
+    // d_recordType == e_MESSAGE.
+
+    bsls::Types::Uint64 d_arrivalTimestamp;
+    // Arrival timestamp of the message,
+    // in seconds from epoch).  Used only
+    // if d_recordType == e_MESSAGE
+
     unsigned int d_appDataUnpaddedLen;
     // Length (unpadded) of the app
     // data.  Zero unless d_recordType =
@@ -140,25 +158,11 @@ struct DataStoreRecord {
     // Used only if d_recordType ==
     // e_MESSAGE
 
+    RecordType::Enum d_recordType;  // Type of the journal record
+
     bool d_hasReceipt;
     // Strong consistency receipt.
 
-    bsls::Types::Int64 d_arrivalTimepoint;
-    // Arrival timepoint of the message, in
-    // nanoseconds from an arbitrary but
-    // fixed point in time.  Note that this
-    // field is meaningful only inside a
-    // process, and only at the primary
-    // node.  Also note that a zero
-    // represents an unset value.  Lastly,
-    // this field is used only if
-    // d_recordType == e_MESSAGE.
-
-    bsls::Types::Uint64 d_arrivalTimestamp;
-    // Arrival timestamp of the message,
-    // in seconds from epoch).  Used only
-    // if d_recordType == e_MESSAGE
-
     // CREATORS
     DataStoreRecord();
     DataStoreRecord(RecordType::Enum    recordType,
@@ -311,6 +315,58 @@ class DataStoreConfigQueueInfo {
     const AppIdKeyPairs& appIdKeyPairs() const;
 };
 
+// ============================
+// class DataStoreRecordProfile
+// ============================
+
+/// This component provides a VST for the durability and latency profile of
+/// the message records of a queue, overriding the corresponding settings of
+/// the `mqbs::DataStoreConfig` of its partition for these records only.
+class DataStoreRecordProfile {
+  public:
+    // CONSTANTS
+
+    /// Value of a setting indicating that the setting of the partition
+    /// applies.
+    static const int k_PARTITION_DEFAULT = -1;
+
+  private:
+    // DATA
+    int d_groupCommitWindowUs;
+    // Maximum time, in microseconds,
+    // between the write of a record and the
+    // sync to disk covering it, 0 if the
+    // receipt of the record does not wait
+    // for the sync, or
+    // 'k_PARTITION_DEFAULT'.
+
+    int d_replicationBatchMaxLatencyUs;
+    // Maximum time, in microseconds, a
+    // record waits in a replication batch,
+    // 0 if the batch is replicated as soon
+    // as the record is added to it, or
+    // 'k_PARTITION_DEFAULT'.
+
+  public:
+    // CREATORS
+
+    /// Create a profile applying the settings of the partition.
+    DataStoreRecordProfile();
+
+    // MANIPULATORS
+
+    /// Set the corresponding member to the specified `value` and return a
+    /// reference offering modifiable access to this object.
+    DataStoreRecordProfile& setGroupCommitWindowUs(int value);
+    DataStoreRecordProfile& setReplicationBatchMaxLatencyUs(int value);
+
+    // ACCESSORS
+
+    /// Return the value of the corresponding member.
+    int groupCommitWindowUs() const;
+    int replicationBatchMaxLatencyUs() const;
+};
+
 // =====================
 // class DataStoreConfig
 // =====================
@@ -378,10 +434,48 @@ class DataStoreConfig {
     // (prefault) page tables for a
     // mapping.
 
+    bool d_chainReplication;
+    // Flag to indicate whether storage
+    // records are replicated along a chain
+    // of replicas, each one relaying them to
+    // the next one, instead of being sent by
+    // the primary to each replica.
+
+    bool d_incrementalWriteBack;
+    // Flag to indicate whether the write
+    // back to disk of the files is started
+    // as they are being written, instead of
+    // being left entirely to the kernel.
+
+    bool d_hugePages;
+    // Flag to indicate whether the OS is
+    // advised to back the mappings of the
+    // files with huge pages.
+
+    bool d_persistentMemory;
+    // Flag to indicate whether the files
+    // are on a DAX mount of persistent
+    // memory, and made durable by flushing
+    // the CPU caches instead of being
+    // synced to disk.
+
     bslstl::StringRef d_location;
 
     bslstl::StringRef d_archiveLocation;
 
+    bslstl::StringRef d_tierLocation;
+    // Location to which the archived files
+    // pruned beyond 'd_maxArchivedFileSets'
+    // are offloaded, or empty if they are
+    // deleted.
+
+    bslstl::StringRef d_spillLocation;
+    // Directory of the scratch files to
+    // which the in-memory storages of the
+    // partition spill payloads under memory
+    // pressure, or empty if they never
+    // spill.
+
     bslstl::StringRef d_clusterName;
 
     int d_nodeId;
@@ -402,6 +496,50 @@ class DataStoreConfig {
 
     int d_maxArchivedFileSets;
 
+    int d_groupCommitWindowUs;
+    // Maximum time, in microseconds,
+    // between the write of a message by
+    // the primary and the sync to disk
+    // covering it, or 0 if group commit is
+    // disabled.
+
+    int d_groupCommitMaxBytes;
+    // Number of bytes written after which
+    // a group commit is started without
+    // waiting for the window to elapse.
+
+    int d_recoveryIndexIntervalSec;
+    // Minimum interval, in seconds, between
+    // two checkpoints of the recovery index,
+    // or 0 if disabled.
+
+    int d_compactionIntervalSec;
+    // Minimum interval, in seconds, between
+    // two compactions of the active data
+    // file, or 0 if disabled.
+
+    int d_readAheadMaxBytes;
+    // Maximum size, in bytes, of the window
+    // read ahead of the messages delivered
+    // from the active data file, or 0 if
+    // disabled.
+
+    int d_replicationBatchMaxBytes;
+    // Maximum size, in bytes, of a batch of
+    // storage records replicated as one
+    // storage event, or 0 if unbounded.
+
+    int d_replicationBatchMaxLatencyUs;
+    // Maximum time, in microseconds, a
+    // storage record waits in a batch before
+    // the batch is replicated, or 0 if
+    // unbounded.
+
+    StorageEngine* d_storageEngine_p;
+    // Engine creating the storages of the
+    // queues of the partition, or 0 if
+    // they are created by the data store.
+
   public:
     // CREATORS
     DataStoreConfig();
@@ -411,8 +549,14 @@ class DataStoreConfig {
     DataStoreConfig& setScheduler(bdlmt::EventScheduler* value);
     DataStoreConfig& setPreallocate(bool value);
     DataStoreConfig& setPrefaultPages(bool value);
+    DataStoreConfig& setChainReplication(bool value);
+    DataStoreConfig& setIncrementalWriteBack(bool value);
+    DataStoreConfig& setHugePages(bool value);
+    DataStoreConfig& setPersistentMemory(bool value);
     DataStoreConfig& setLocation(const bslstl::StringRef& value);
     DataStoreConfig& setArchiveLocation(const bslstl::StringRef& value);
+    DataStoreConfig& setTierLocation(const bslstl::StringRef& value);
+    DataStoreConfig& setSpillLocation(const bslstl::StringRef& value);
     DataStoreConfig& setClusterName(const bslstl::StringRef& value);
     DataStoreConfig& setNodeId(int value);
     DataStoreConfig& setPartitionId(int value);
@@ -422,18 +566,32 @@ class DataStoreConfig {
     DataStoreConfig& setQueueCreationCb(const QueueCreationCb& value);
     DataStoreConfig& setQueueDeletionCb(const QueueDeletionCb& value);
     DataStoreConfig& setRecoveredQueuesCb(const RecoveredQueuesCb& value);
+    DataStoreConfig& setStorageEngine(StorageEngine* value);
 
     /// Set the corresponding member to the specified `value` and return a
     /// reference offering modifiable access to this object.
     DataStoreConfig& setMaxArchivedFileSets(int value);
+    DataStoreConfig& setGroupCommitWindowUs(int value);
+    DataStoreConfig& setGroupCommitMaxBytes(int value);
+    DataStoreConfig& setRecoveryIndexIntervalSec(int value);
+    DataStoreConfig& setCompactionIntervalSec(int value);
+    DataStoreConfig& setReadAheadMaxBytes(int value);
+    DataStoreConfig& setReplicationBatchMaxBytes(int value);
+    DataStoreConfig& setReplicationBatchMaxLatencyUs(int value);
 
     // ACCESSORS
     bdlbb::BlobBufferFactory* bufferFactory() const;
     bdlmt::EventScheduler*    scheduler() const;
     bool                      hasPreallocate() const;
     bool                      hasPrefaultPages() const;
+    bool                      hasChainReplication() const;
+    bool                      hasIncrementalWriteBack() const;
+    bool                      hasHugePages() const;
+    bool                      hasPersistentMemory() const;
     const bslstl::StringRef&  location() const;
     const bslstl::StringRef&  archiveLocation() const;
+    const bslstl::StringRef&  tierLocation() const;
+    const bslstl::StringRef&  spillLocation() const;
     const bslstl::StringRef&  clusterName() const;
     int                       nodeId() const;
     int                       partitionId() const;
@@ -443,9 +601,17 @@ class DataStoreConfig {
     const QueueCreationCb&    queueCreationCb() const;
     const QueueDeletionCb&    queueDeletionCb() const;
     const RecoveredQueuesCb&  recoveredQueuesCb() const;
+    StorageEngine*            storageEngine() const;
 
     /// Return the value of the corresponding member.
     int maxArchivedFileSets() const;
+    int groupCommitWindowUs() const;
+    int groupCommitMaxBytes() const;
+    int recoveryIndexIntervalSec() const;
+    int compactionIntervalSec() const;
+    int readAheadMaxBytes() const;
+    int replicationBatchMaxBytes() const;
+    int replicationBatchMaxLatencyUs() const;
 
     /// Format this object to the specified output `stream` at the (absolute
     /// value of) the optionally specified indentation `level` and return a
@@ -577,14 +743,18 @@ class DataStore : public mqbi::DispatcherClient {
     /// Write the specified `appData` and `options` belonging to specified
     /// `queueKey` and having specified `guid` and `attributes` to the data
     /// store, and update the specified `handle` with an identifier which
-    /// can be used to retrieve the message.  Return zero on success,
-    /// non-zero value otherwise.
-    virtual int writeMessageRecord(mqbi::StorageMessageAttributes* attributes,
-                                   DataStoreRecordHandle*          handle,
-                                   const bmqt::MessageGUID&        guid,
-                                   const bsl::shared_ptr<bdlbb::Blob>& appData,
-                                   const bsl::shared_ptr<bdlbb::Blob>& options,
-                                   const mqbu::StorageKey& queueKey) = 0;
+    /// can be used to retrieve the message.  Optionally specify a `profile`
+    /// overriding, for this record, the group commit and replication
+    /// settings of the data store.  Return zero on success, non-zero value
+    /// otherwise.
+    virtual int writeMessageRecord(
+        mqbi::StorageMessageAttributes*     attributes,
+        DataStoreRecordHandle*              handle,
+        const bmqt::MessageGUID&            guid,
+        const bsl::shared_ptr<bdlbb::Blob>& appData,
+        const bsl::shared_ptr<bdlbb::Blob>& options,
+        const mqbu::StorageKey&             queueKey,
+        const DataStoreRecordProfile& profile = DataStoreRecordProfile()) = 0;
 
     /// Queue List related
     /// -------------
@@ -644,6 +814,12 @@ class DataStore : public mqbi::DispatcherClient {
     /// data store.
     virtual void removeRecordRaw(const DataStoreRecordHandle& handle) = 0;
 
+    /// Notify this data store that the time at which the messages of the
+    /// storage associated with the specified `queueKey` expire may have
+    /// changed, e.g. because the TTL of that storage has been
+    /// reconfigured.
+    virtual void onStorageExpiryChanged(const mqbu::StorageKey& queueKey) = 0;
+
     /// Process the specified storage event `blob` containing one or more
     /// storage messages.  The behavior is undefined unless each message in
     /// the event belongs to this partition, and has same primary and
@@ -747,30 +923,30 @@ class DataStore : public mqbi::DispatcherClient {
 // ----------------------
 
 inline DataStoreRecord::DataStoreRecord()
-: d_recordType(RecordType::e_UNDEFINED)
-, d_recordOffset(0)
+: d_recordOffset(0)
 , d_messageOffset(0)
+, d_arrivalTimepoint(0LL)
+, d_arrivalTimestamp(0LL)
 , d_appDataUnpaddedLen(0)
 , d_dataOrQlistRecordPaddedLen(0)
 , d_messagePropertiesInfo()
+, d_recordType(RecordType::e_UNDEFINED)
 , d_hasReceipt(true)
-, d_arrivalTimepoint(0LL)
-, d_arrivalTimestamp(0LL)
 {
     // NOTHING
 }
 
 inline DataStoreRecord::DataStoreRecord(RecordType::Enum    recordType,
                                         bsls::Types::Uint64 recordOffset)
-: d_recordType(recordType)
-, d_recordOffset(recordOffset)
+: d_recordOffset(recordOffset)
 , d_messageOffset(0)
+, d_arrivalTimepoint(0LL)
+, d_arrivalTimestamp(0LL)
 , d_appDataUnpaddedLen(0)
 , d_dataOrQlistRecordPaddedLen(0)
 , d_messagePropertiesInfo()
+, d_recordType(recordType)
 , d_hasReceipt(true)
-, d_arrivalTimepoint(0LL)
-, d_arrivalTimestamp(0LL)
 {
     // NOTHING
 }
@@ -779,15 +955,15 @@ inline DataStoreRecord::DataStoreRecord(
     RecordType::Enum    recordType,
     bsls::Types::Uint64 recordOffset,
     unsigned int        dataOrQlistRecordPaddedLen)
-: d_recordType(recordType)
-, d_recordOffset(recordOffset)
+: d_recordOffset(recordOffset)
 , d_messageOffset(0)
+, d_arrivalTimepoint(0LL)
+, d_arrivalTimestamp(0LL)
 , d_appDataUnpaddedLen(0)
 , d_dataOrQlistRecordPaddedLen(dataOrQlistRecordPaddedLen)
 , d_messagePropertiesInfo()
+, d_recordType(recordType)
 , d_hasReceipt(true)
-, d_arrivalTimepoint(0LL)
-, d_arrivalTimestamp(0LL)
 {
     // NOTHING
 }
@@ -912,6 +1088,43 @@ DataStoreConfigQueueInfo::appIdKeyPairs() const
     return d_appIdKeyPairs;
 }
 
+// ----------------------------
+// class DataStoreRecordProfile
+// ----------------------------
+
+// CREATORS
+inline DataStoreRecordProfile::DataStoreRecordProfile()
+: d_groupCommitWindowUs(k_PARTITION_DEFAULT)
+, d_replicationBatchMaxLatencyUs(k_PARTITION_DEFAULT)
+{
+}
+
+// MANIPULATORS
+inline DataStoreRecordProfile&
+DataStoreRecordProfile::setGroupCommitWindowUs(int value)
+{
+    d_groupCommitWindowUs = value;
+    return *this;
+}
+
+inline DataStoreRecordProfile&
+DataStoreRecordProfile::setReplicationBatchMaxLatencyUs(int value)
+{
+    d_replicationBatchMaxLatencyUs = value;
+    return *this;
+}
+
+// ACCESSORS
+inline int DataStoreRecordProfile::groupCommitWindowUs() const
+{
+    return d_groupCommitWindowUs;
+}
+
+inline int DataStoreRecordProfile::replicationBatchMaxLatencyUs() const
+{
+    return d_replicationBatchMaxLatencyUs;
+}
+
 // ---------------------
 // class DataStoreConfig
 // ---------------------
@@ -946,6 +1159,30 @@ inline DataStoreConfig& DataStoreConfig::setPrefaultPages(bool value)
     return *this;
 }
 
+inline DataStoreConfig& DataStoreConfig::setChainReplication(bool value)
+{
+    d_chainReplication = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setIncrementalWriteBack(bool value)
+{
+    d_incrementalWriteBack = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setHugePages(bool value)
+{
+    d_hugePages = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setPersistentMemory(bool value)
+{
+    d_persistentMemory = value;
+    return *this;
+}
+
 inline DataStoreConfig&
 DataStoreConfig::setLocation(const bslstl::StringRef& value)
 {
@@ -960,6 +1197,20 @@ DataStoreConfig::setArchiveLocation(const bslstl::StringRef& value)
     return *this;
 }
 
+inline DataStoreConfig&
+DataStoreConfig::setTierLocation(const bslstl::StringRef& value)
+{
+    d_tierLocation = value;
+    return *this;
+}
+
+inline DataStoreConfig&
+DataStoreConfig::setSpillLocation(const bslstl::StringRef& value)
+{
+    d_spillLocation = value;
+    return *this;
+}
+
 inline DataStoreConfig&
 DataStoreConfig::setClusterName(const bslstl::StringRef& value)
 {
@@ -1021,12 +1272,63 @@ DataStoreConfig::setRecoveredQueuesCb(const RecoveredQueuesCb& value)
     return *this;
 }
 
+inline DataStoreConfig& DataStoreConfig::setStorageEngine(StorageEngine* value)
+{
+    d_storageEngine_p = value;
+    return *this;
+}
+
 inline DataStoreConfig& DataStoreConfig::setMaxArchivedFileSets(int value)
 {
     d_maxArchivedFileSets = value;
     return *this;
 }
 
+inline DataStoreConfig& DataStoreConfig::setGroupCommitWindowUs(int value)
+{
+    d_groupCommitWindowUs = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setGroupCommitMaxBytes(int value)
+{
+    d_groupCommitMaxBytes = value;
+    return *this;
+}
+
+inline DataStoreConfig&
+DataStoreConfig::setRecoveryIndexIntervalSec(int value)
+{
+    d_recoveryIndexIntervalSec = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setCompactionIntervalSec(int value)
+{
+    d_compactionIntervalSec = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setReadAheadMaxBytes(int value)
+{
+    d_readAheadMaxBytes = value;
+    return *this;
+}
+
+inline DataStoreConfig&
+DataStoreConfig::setReplicationBatchMaxBytes(int value)
+{
+    d_replicationBatchMaxBytes = value;
+    return *this;
+}
+
+inline DataStoreConfig&
+DataStoreConfig::setReplicationBatchMaxLatencyUs(int value)
+{
+    d_replicationBatchMaxLatencyUs = value;
+    return *this;
+}
+
 // ACCESSORS
 inline bdlbb::BlobBufferFactory* DataStoreConfig::bufferFactory() const
 {
@@ -1048,6 +1350,26 @@ inline bool DataStoreConfig::hasPrefaultPages() const
     return d_prefaultPages;
 }
 
+inline bool DataStoreConfig::hasChainReplication() const
+{
+    return d_chainReplication;
+}
+
+inline bool DataStoreConfig::hasIncrementalWriteBack() const
+{
+    return d_incrementalWriteBack;
+}
+
+inline bool DataStoreConfig::hasHugePages() const
+{
+    return d_hugePages;
+}
+
+inline bool DataStoreConfig::hasPersistentMemory() const
+{
+    return d_persistentMemory;
+}
+
 inline const bslstl::StringRef& DataStoreConfig::location() const
 {
     return d_location;
@@ -1058,6 +1380,16 @@ inline const bslstl::StringRef& DataStoreConfig::archiveLocation() const
     return d_archiveLocation;
 }
 
+inline const bslstl::StringRef& DataStoreConfig::tierLocation() const
+{
+    return d_tierLocation;
+}
+
+inline const bslstl::StringRef& DataStoreConfig::spillLocation() const
+{
+    return d_spillLocation;
+}
+
 inline const bslstl::StringRef& DataStoreConfig::clusterName() const
 {
     return d_clusterName;
@@ -1106,11 +1438,51 @@ DataStoreConfig::recoveredQueuesCb() const
     return d_recoveredQueuesCb;
 }
 
+inline StorageEngine* DataStoreConfig::storageEngine() const
+{
+    return d_storageEngine_p;
+}
+
 inline int DataStoreConfig::maxArchivedFileSets() const
 {
     return d_maxArchivedFileSets;
 }
 
+inline int DataStoreConfig::groupCommitWindowUs() const
+{
+    return d_groupCommitWindowUs;
+}
+
+inline int DataStoreConfig::groupCommitMaxBytes() const
+{
+    return d_groupCommitMaxBytes;
+}
+
+inline int DataStoreConfig::recoveryIndexIntervalSec() const
+{
+    return d_recoveryIndexIntervalSec;
+}
+
+inline int DataStoreConfig::compactionIntervalSec() const
+{
+    return d_compactionIntervalSec;
+}
+
+inline int DataStoreConfig::readAheadMaxBytes() const
+{
+    return d_readAheadMaxBytes;
+}
+
+inline int DataStoreConfig::replicationBatchMaxBytes() const
+{
+    return d_replicationBatchMaxBytes;
+}
+
+inline int DataStoreConfig::replicationBatchMaxLatencyUs() const
+{
+    return d_replicationBatchMaxLatencyUs;
+}
+
 // ---------------------------
 // class DataStoreRecordHandle
 // ---------------------------
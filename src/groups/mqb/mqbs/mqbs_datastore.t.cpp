@@ -23,7 +23,9 @@
 #include <mwcu_printutil.h>
 
 // BDE
+#include <bsl_unordered_map.h>
 #include <bsl_utility.h>
+#include <bslma_testallocator.h>
 #include <bsls_timeutil.h>
 #include <bsls_types.h>
 
@@ -108,6 +110,22 @@ static void test1_breathingTest()
         ASSERT_EQ(recordValued2.d_recordType, k_RECORD_TYPE);
         ASSERT_EQ(recordValued2.d_messagePropertiesInfo.isPresent(), false);
     }
+
+    {
+        PV("DataStoreRecordProfile");
+
+        // Default constructor
+        mqbs::DataStoreRecordProfile profile;
+        ASSERT_EQ(profile.groupCommitWindowUs(),
+                  mqbs::DataStoreRecordProfile::k_PARTITION_DEFAULT);
+        ASSERT_EQ(profile.replicationBatchMaxLatencyUs(),
+                  mqbs::DataStoreRecordProfile::k_PARTITION_DEFAULT);
+
+        // Manipulators
+        profile.setGroupCommitWindowUs(0).setReplicationBatchMaxLatencyUs(50);
+        ASSERT_EQ(profile.groupCommitWindowUs(), 0);
+        ASSERT_EQ(profile.replicationBatchMaxLatencyUs(), 50);
+    }
 }
 
 static void test2_defaultHashUniqueness()
@@ -420,6 +438,70 @@ static void testN4_orderedMapWithCustomHashBenchmark()
          << " insertions per second.\n";
 }
 
+BSLA_MAYBE_UNUSED
+static void testN5_recordsMemoryBenchmark()
+// ------------------------------------------------------------------------
+// RECORDS MEMORY BENCHMARK
+//
+// Concerns:
+//   Measure the memory used per record by the container of the outstanding
+//   records of a data store ('mqbs::DataStoreConfig::Records'), compared
+//   to a node-based unordered map with the same key, value and hash.
+//
+// Plan:
+//   - Insert a large number of records in each container, using a
+//     dedicated test allocator, and report the number of bytes in use
+//     divided by the number of records.
+//
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("RECORDS MEMORY BENCHMARK");
+
+    typedef bsl::unordered_map<mqbs::DataStoreRecordKey,
+                               mqbs::DataStoreRecord,
+                               mqbs::DataStoreRecordKeyHashAlgo>
+        UnorderedRecords;
+
+    const size_t                k_NUM_ELEMS = 10000000;  // 10M
+    const mqbs::DataStoreRecord record(mqbs::RecordType::e_MESSAGE, 0);
+
+    cout << "sizeof(DataStoreRecordKey): "
+         << sizeof(mqbs::DataStoreRecordKey)
+         << ", sizeof(DataStoreRecord): " << sizeof(mqbs::DataStoreRecord)
+         << ".\n";
+
+    {
+        bslma::TestAllocator           alloc("records");
+        mqbs::DataStoreConfig::Records records(k_NUM_ELEMS, &alloc);
+        for (size_t i = 1; i <= k_NUM_ELEMS; ++i) {
+            records.insert(
+                bsl::make_pair(mqbs::DataStoreRecordKey(i, 7), record));
+        }
+
+        cout << "DataStoreConfig::Records: "
+             << alloc.numBytesInUse() / k_NUM_ELEMS << " bytes per record ("
+             << mwcu::PrintUtil::prettyBytes(alloc.numBytesInUse())
+             << " for " << k_NUM_ELEMS << " records).\n";
+    }
+
+    {
+        bslma::TestAllocator alloc("unorderedRecords");
+        UnorderedRecords     records(k_NUM_ELEMS,
+                                 mqbs::DataStoreRecordKeyHashAlgo(),
+                                 bsl::equal_to<mqbs::DataStoreRecordKey>(),
+                                 &alloc);
+        for (size_t i = 1; i <= k_NUM_ELEMS; ++i) {
+            records.insert(
+                bsl::make_pair(mqbs::DataStoreRecordKey(i, 7), record));
+        }
+
+        cout << "bsl::unordered_map: "
+             << alloc.numBytesInUse() / k_NUM_ELEMS << " bytes per record ("
+             << mwcu::PrintUtil::prettyBytes(alloc.numBytesInUse())
+             << " for " << k_NUM_ELEMS << " records)." << endl;
+    }
+}
+
 #ifdef BSLS_PLATFORM_OS_LINUX
 static void
 testN1_defaultHashBenchmark_GoogleBenchmark(benchmark::State& state)
@@ -574,6 +656,7 @@ int main(int argc, char* argv[])
                                     ->Range(10, 10000000)
                                     ->Unit(benchmark::kMillisecond));
         break;
+    case -5: testN5_recordsMemoryBenchmark(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
@@ -32,12 +32,14 @@
 #include <mqbstat_queuestats.h>
 
 // BMQ
+#include <bmqp_crc32c.h>
 #include <bmqp_protocolutil.h>
 
 // MWC
 #include <mwcma_countingallocatorstore.h>
 #include <mwcsys_time.h>
 #include <mwctsk_alarmlog.h>
+#include <mwcu_blob.h>
 #include <mwcu_printutil.h>
 
 // BDE
@@ -98,6 +100,69 @@ void FileBackedStorage::purgeCommon(const mqbu::StorageKey& appKey)
     }
 }
 
+// PRIVATE ACCESSORS
+bool FileBackedStorage::compressAppData(
+    bsl::shared_ptr<bdlbb::Blob>*       compressed,
+    mqbi::StorageMessageAttributes*     attributes,
+    const bsl::shared_ptr<bdlbb::Blob>& appData) const
+{
+    if (d_compressionAlgorithmType == bmqt::CompressionAlgorithmType::e_NONE ||
+        attributes->compressionAlgorithmType() !=
+            bmqt::CompressionAlgorithmType::e_NONE) {
+        // Compression at rest is disabled, or the producer already compressed
+        // the payload, which is then stored as it is.
+        return false;  // RETURN
+    }
+
+    const bmqp::MessagePropertiesInfo& mpInfo =
+        attributes->messagePropertiesInfo();
+    if (mpInfo.isPresent() && !mpInfo.isExtended()) {
+        // Old style message properties would be compressed together with the
+        // payload, but they are read straight from the stored application
+        // data (e.g., by 'Routers::MessagePropertiesReader' when evaluating
+        // subscriptions, and by 'QueueEngineUtil::logRejectMessage').
+        return false;  // RETURN
+    }
+
+    // New style message properties are not compressed, consistently with
+    // 'bmqp::PutEventBuilder'.
+    const bool haveNewMessageProperties = mpInfo.isPresent() &&
+                                          mpInfo.isExtended();
+    int        mpsSize                  = 0;
+    if (haveNewMessageProperties &&
+        bmqp::ProtocolUtil::readPropertiesSize(&mpsSize,
+                                               *appData,
+                                               mwcu::BlobPosition()) != 0) {
+        return false;  // RETURN
+    }
+
+    if (appData->length() - mpsSize <
+        bmqp::Protocol::k_COMPRESSION_MIN_APPDATA_SIZE) {
+        return false;  // RETURN
+    }
+
+    bsl::shared_ptr<bdlbb::Blob> result;
+    result.createInplace(d_allocator_p, appData->factory(), d_allocator_p);
+
+    if (0 != bmqp::ProtocolUtil::convertCompression(
+                 result.get(),
+                 *appData,
+                 bmqt::CompressionAlgorithmType::e_NONE,
+                 d_compressionAlgorithmType,
+                 haveNewMessageProperties,
+                 appData->factory(),
+                 d_allocator_p) ||
+        result->length() >= appData->length()) {
+        // Compression failed or is not worth it.
+        return false;  // RETURN
+    }
+
+    attributes->setCompressionAlgorithmType(d_compressionAlgorithmType);
+    attributes->setCrc32c(bmqp::Crc32c::calculate(*result));
+    *compressed = result;
+    return true;
+}
+
 // CREATORS
 FileBackedStorage::FileBackedStorage(
     DataStore*                     dataStore,
@@ -116,6 +181,7 @@ FileBackedStorage::FileBackedStorage(
 , d_queueUri(queueUri, allocator)
 , d_virtualStorageCatalog(
       this,
+      VirtualStorageCatalog::AppStatesMode::e_STORAGE,
       allocatorStore ? allocatorStore->get("VirtualHandles") : d_allocator_p)
 , d_ttlSeconds(config.messageTtl())
 , d_capacityMeter("queue [" + queueUri.asString() + "]",
@@ -131,6 +197,8 @@ FileBackedStorage::FileBackedStorage(
 , d_isEmpty(1)
 , d_defaultRdaInfo(defaultRdaInfo)
 , d_hasReceipts(!config.consistency().isStrongValue())
+, d_compressionAlgorithmType(bmqt::CompressionAlgorithmType::e_NONE)
+, d_recordProfile()
 {
     BSLS_ASSERT(d_store_p);
 
@@ -140,6 +208,8 @@ FileBackedStorage::FileBackedStorage(
     else {
         d_defaultRdaInfo.setUnlimited();
     }
+    d_virtualStorageCatalog.setDefaultRdaInfo(d_defaultRdaInfo);
+
     // Note that the specified 'parentCapacityMeter' (and thus
     // 'd_capacityMeter.parent()') can be zero, so we can't assert on it being
     // non zero.  This is possible when a node comes up, recovers a queue,
@@ -171,6 +241,7 @@ FileBackedStorage::get(bsl::shared_ptr<bdlbb::Blob>*   appData,
     BSLS_ASSERT(!handles.empty());
 
     d_store_p->loadMessageRaw(appData, options, attributes, handles[0]);
+    attributes->setAppStates(it->second.d_appStates);
 
     if (handles[0].primaryLeaseId() < d_store_p->primaryLeaseId()) {
         // Consider this the past that needs translation
@@ -199,6 +270,7 @@ FileBackedStorage::get(mqbi::StorageMessageAttributes* attributes,
     const RecordHandlesArray& handles = it->second.d_array;
     BSLS_ASSERT(!handles.empty());
     d_store_p->loadMessageAttributesRaw(attributes, handles[0]);
+    attributes->setAppStates(it->second.d_appStates);
 
     if (handles[0].primaryLeaseId() < d_store_p->primaryLeaseId()) {
         // Consider this the past that needs translation
@@ -230,18 +302,63 @@ bool FileBackedStorage::hasReceipt(const bmqt::MessageGUID& msgGUID) const
     return d_store_p->hasReceipt(handles[0]);
 }
 
-int FileBackedStorage::configure(
-    BSLS_ANNOTATION_UNUSED bsl::ostream& errorDescription,
-    const mqbconfm::Storage&             config,
-    const mqbconfm::Limits&              limits,
-    const bsls::Types::Int64             messageTtl,
-    const int                            maxDeliveryAttempts)
+int FileBackedStorage::configure(bsl::ostream&            errorDescription,
+                                 const mqbconfm::Storage& config,
+                                 const mqbconfm::Limits&  limits,
+                                 const bsls::Types::Int64 messageTtl,
+                                 const int                maxDeliveryAttempts)
 {
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS                       = 0,
+        rc_INVALID_COMPRESSION_ALGORITHM = -1,
+        rc_INVALID_RECORD_PROFILE        = -2
+    };
+
+    if (config.isFileBackedValue()) {
+        const int cat = config.fileBacked().compressionAlgorithmType();
+        if (cat < bmqt::CompressionAlgorithmType::k_LOWEST_SUPPORTED_TYPE ||
+            cat > bmqt::CompressionAlgorithmType::k_HIGHEST_SUPPORTED_TYPE) {
+            errorDescription << "Invalid compressionAlgorithmType " << cat
+                             << " for storage of queue [" << d_queueUri
+                             << "]";
+            return rc_INVALID_COMPRESSION_ALGORITHM;  // RETURN
+        }
+
+        const mqbconfm::FileBackedStorage& fileBacked = config.fileBacked();
+        if (fileBacked.groupCommitWindowUs() <
+                DataStoreRecordProfile::k_PARTITION_DEFAULT ||
+            fileBacked.replicationBatchMaxLatencyUs() <
+                DataStoreRecordProfile::k_PARTITION_DEFAULT) {
+            errorDescription << "Invalid groupCommitWindowUs "
+                             << fileBacked.groupCommitWindowUs()
+                             << " or replicationBatchMaxLatencyUs "
+                             << fileBacked.replicationBatchMaxLatencyUs()
+                             << " for storage of queue [" << d_queueUri
+                             << "]";
+            return rc_INVALID_RECORD_PROFILE;  // RETURN
+        }
+
+        d_compressionAlgorithmType =
+            static_cast<bmqt::CompressionAlgorithmType::Enum>(cat);
+        d_recordProfile
+            .setGroupCommitWindowUs(fileBacked.groupCommitWindowUs())
+            .setReplicationBatchMaxLatencyUs(
+                fileBacked.replicationBatchMaxLatencyUs());
+    }
+
     d_config = config;
     d_capacityMeter.setLimits(limits.messages(), limits.bytes())
         .setWatermarkThresholds(limits.messagesWatermarkRatio(),
                                 limits.bytesWatermarkRatio());
-    d_ttlSeconds = messageTtl;
+    if (d_ttlSeconds != messageTtl) {
+        d_ttlSeconds = messageTtl;
+
+        // Let the partition recompute when messages of this storage expire,
+        // rather than on its next periodic check.
+
+        d_store_p->onStorageExpiryChanged(queueKey());
+    }
 
     if (maxDeliveryAttempts > 0) {
         d_defaultRdaInfo.setCounter(maxDeliveryAttempts);
@@ -249,7 +366,9 @@ int FileBackedStorage::configure(
     else {
         d_defaultRdaInfo.setUnlimited();
     }
-    return 0;
+    d_virtualStorageCatalog.setDefaultRdaInfo(d_defaultRdaInfo);
+
+    return rc_SUCCESS;
 }
 
 void FileBackedStorage::setQueue(mqbi::Queue* queue)
@@ -288,8 +407,6 @@ FileBackedStorage::put(mqbi::StorageMessageAttributes*     attributes,
                        const bsl::shared_ptr<bdlbb::Blob>& options,
                        const StorageKeys&                  storageKeys)
 {
-    const int msgSize = appData->length();
-
     if (storageKeys.empty()) {
         // Store the specified message in the 'physical' as well as *all*
         // virtual storages.
@@ -298,6 +415,16 @@ FileBackedStorage::put(mqbi::StorageMessageAttributes*     attributes,
             return mqbi::StorageResult::e_DUPLICATE;
         }
 
+        // Compress the payload, if so configured, so that it is written to
+        // the data file and replicated compressed.  Consumers decompress it
+        // as any payload compressed by its producer.
+        bsl::shared_ptr<bdlbb::Blob> compressedAppData;
+        const bsl::shared_ptr<bdlbb::Blob>& storedAppData =
+            compressAppData(&compressedAppData, attributes, appData)
+                ? compressedAppData
+                : appData;
+        const int msgSize = storedAppData->length();
+
         // Verify if we have enough capacity.
         mqbu::CapacityMeter::CommitResult capacity =
             d_capacityMeter.commitUnreserved(1, msgSize);
@@ -316,9 +443,10 @@ FileBackedStorage::put(mqbi::StorageMessageAttributes*     attributes,
         int                   rc = d_store_p->writeMessageRecord(attributes,
                                                &handle,
                                                msgGUID,
-                                               appData,
+                                               storedAppData,
                                                options,
-                                               d_queueKey);
+                                               d_queueKey,
+                                               d_recordProfile);
         if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
             BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
@@ -358,6 +486,9 @@ FileBackedStorage::put(mqbi::StorageMessageAttributes*     attributes,
     // etc variables.
     BSLS_ASSERT(hasMessage(msgGUID));
 
+    int msgSize = 0;
+    getMessageSize(&msgSize, msgGUID);
+
     for (size_t i = 0; i < storageKeys.size(); ++i) {
         d_virtualStorageCatalog.put(msgGUID,
                                     msgSize,
@@ -431,6 +562,16 @@ FileBackedStorage::releaseRef(const bmqt::MessageGUID& msgGUID,
     RecordHandlesArray& handles = it->second.d_array;
     BSLS_ASSERT_SAFE(!handles.empty());
 
+    if (1 == it->second.d_refCount && !onReject) {
+        // Last reference.  The caller removes the message next, and the
+        // deletion record written then supersedes a confirm record, both in
+        // the journal and on the replicas (as it already does for a purge),
+        // so skip writing one.
+
+        it->second.d_refCount = 0;
+        return mqbi::StorageResult::e_ZERO_REFERENCES;  // RETURN
+    }
+
     DataStoreRecordHandle handle;
     int                   rc = d_store_p->writeConfirmRecord(&handle,
                                            msgGUID,
@@ -543,13 +684,17 @@ FileBackedStorage::removeAll(const mqbu::StorageKey& appKey)
         return mqbi::StorageResult::e_SUCCESS;  // RETURN
     }
 
-    // A specific appKey is being purged.
+    // A specific appKey is being purged.  Note that the virtual storage
+    // iterates over the underlying storage, so it is advanced before the
+    // message it points to is deleted.
 
     bslma::ManagedPtr<mqbi::StorageIterator> iter =
         d_virtualStorageCatalog.getIterator(appKey);
     while (!iter->atEnd()) {
-        const bmqt::MessageGUID& guid = iter->guid();
-        RecordHandleMapIter      it   = d_handles.find(guid);
+        const bmqt::MessageGUID guid = iter->guid();
+        iter->advance();
+
+        RecordHandleMapIter it = d_handles.find(guid);
         if (it == d_handles.end()) {
             BALL_LOG_WARN
                 << "#STORAGE_PURGE_ERROR "
@@ -559,7 +704,6 @@ FileBackedStorage::removeAll(const mqbu::StorageKey& appKey)
                 << "' & appKey '" << appKey << "' for queue '" << queueUri()
                 << "' & queueKey '" << queueKey()
                 << "', but GUID does not exist in the underlying storage.";
-            iter->advance();
             continue;  // CONTINUE
         }
 
@@ -574,7 +718,6 @@ FileBackedStorage::removeAll(const mqbu::StorageKey& appKey)
                 << "' & queueKey '" << queueKey()
                 << "', for which refCount is already zero."
                 << MWCTSK_ALARMLOG_END;
-            iter->advance();
             continue;  // CONTINUE
         }
 
@@ -601,7 +744,6 @@ FileBackedStorage::removeAll(const mqbu::StorageKey& appKey)
                     << d_queueUri << "', queueKey '" << d_queueKey
                     << "' while attempting to purge the message, rc: " << rc
                     << MWCTSK_ALARMLOG_END;
-                iter->advance();
                 continue;  // CONTINUE
             }
 
@@ -629,8 +771,6 @@ FileBackedStorage::removeAll(const mqbu::StorageKey& appKey)
             d_capacityMeter.remove(1, msgLen);
             d_handles.erase(it);
         }
-
-        iter->advance();
     }
 
     purgeCommon(appKey);
@@ -772,6 +912,34 @@ bool FileBackedStorage::gcHistory()
                         k_GC_MESSAGES_BATCH_SIZE);
 }
 
+mqbi::StorageResult::Enum
+FileBackedStorage::updateAppStates(bsls::Types::Uint64*     previous,
+                                   const bmqt::MessageGUID& msgGUID,
+                                   bsls::Types::Uint64      setMask,
+                                   bsls::Types::Uint64      clearMask)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(previous);
+
+    RecordHandleMapIter it = d_handles.find(msgGUID);
+    if (it == d_handles.end()) {
+        return mqbi::StorageResult::e_GUID_NOT_FOUND;  // RETURN
+    }
+
+    *previous              = it->second.d_appStates;
+    it->second.d_appStates = (*previous & ~clearMask) | setMask;
+
+    return mqbi::StorageResult::e_SUCCESS;
+}
+
+void FileBackedStorage::clearAppStates(bsls::Types::Uint64 mask)
+{
+    for (RecordHandleMapIter it = d_handles.begin(); it != d_handles.end();
+         ++it) {
+        it->second.d_appStates &= ~mask;
+    }
+}
+
 void FileBackedStorage::processMessageRecord(
     const bmqt::MessageGUID&     guid,
     unsigned int                 msgLen,
@@ -993,6 +1161,7 @@ void FileBackedStorageIterator::loadMessageAndAttributes() const
                                                &d_options_sp,
                                                &d_attributes,
                                                array[0]);
+        d_attributes.setAppStates(d_iterator->second.d_appStates);
     }
 }
 
@@ -1086,5 +1255,13 @@ bool FileBackedStorageIterator::hasReceipt() const
     return atEnd() ? false : d_iterator->second.d_array[0].hasReceipt();
 }
 
+bsls::Types::Uint64 FileBackedStorageIterator::appStates() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!atEnd());
+
+    return d_iterator->second.d_appStates;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -41,6 +41,7 @@
 // BMQ
 #include <bmqp_protocol.h>
 #include <bmqp_schemalearner.h>
+#include <bmqt_compressionalgorithmtype.h>
 #include <bmqt_messageguid.h>
 #include <bmqt_uri.h>
 
@@ -107,8 +108,10 @@ class FileBackedStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
         RecordHandlesArray;
 
     struct Item {
-        RecordHandlesArray d_array;
-        unsigned int       d_refCount;  // Outstanding reference count
+        RecordHandlesArray  d_array;
+        bsls::Types::Uint64 d_appStates;  // Virtual storages holding the
+                                          // message, one bit per ordinal
+        unsigned int        d_refCount;   // Outstanding reference count
 
         void reset();
     };
@@ -206,6 +209,17 @@ class FileBackedStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
 
     const bool d_hasReceipts;
 
+    bmqt::CompressionAlgorithmType::Enum d_compressionAlgorithmType;
+    // Compression algorithm applied to
+    // uncompressed payloads before writing
+    // them to the data store, if not 'e_NONE'.
+
+    DataStoreRecordProfile d_recordProfile;
+    // Group commit window and replication
+    // batch latency of the message records
+    // written to the data store, as
+    // configured for the domain.
+
   private:
     // NOT IMPLEMENTED
     FileBackedStorage(const FileBackedStorage&) BSLS_KEYWORD_DELETED;
@@ -216,6 +230,19 @@ class FileBackedStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
     // PRIVATE MANIPULATORS
     void purgeCommon(const mqbu::StorageKey& appKey);
 
+    // PRIVATE ACCESSORS
+
+    /// Load into the specified `compressed` the specified `appData`
+    /// compressed with `d_compressionAlgorithmType`, and update the
+    /// compression algorithm and CRC32-C of the specified `attributes`
+    /// accordingly, if `appData` is uncompressed, carries no old style
+    /// message properties, is large enough and compresses to a smaller
+    /// size.  Return true if `compressed` was loaded, and false, leaving
+    /// `compressed` and `attributes` unchanged, otherwise.
+    bool compressAppData(bsl::shared_ptr<bdlbb::Blob>*       compressed,
+                         mqbi::StorageMessageAttributes*     attributes,
+                         const bsl::shared_ptr<bdlbb::Blob>& appData) const;
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(FileBackedStorage,
@@ -333,6 +360,13 @@ class FileBackedStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
     // Load into the specified 'buffer' the list of pairs of appId and
     // appKey for all the virtual storages registered with this instance.
 
+    /// Load into the specified `appStates` the app states of the message
+    /// having the specified `msgGUID`.  Return `e_SUCCESS`, or
+    /// `e_GUID_NOT_FOUND` if no message with `msgGUID` exists.
+    virtual mqbi::StorageResult::Enum
+    getAppStates(bsls::Types::Uint64*     appStates,
+                 const bmqt::MessageGUID& msgGUID) const BSLS_KEYWORD_OVERRIDE;
+
     virtual mqbi::StorageResult::Enum getMessageSize(
         int*                     msgSize,
         const bmqt::MessageGUID& msgGUID) const BSLS_KEYWORD_OVERRIDE;
@@ -403,7 +437,10 @@ class FileBackedStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
 
     /// Release the reference of the specified `appKey` on the message
     /// identified by the specified `msgGUID`, and record this event in the
-    /// storage.  Return one of the return codes from:
+    /// storage.  Note that the release of the last reference of a message
+    /// is not recorded, unless the optionally specified `onReject` is
+    /// `true`, because the deletion record written upon its subsequent
+    /// `remove` covers it.  Return one of the return codes from:
     /// * **e_GUID_NOT_FOUND**      : `msgGUID` was not found
     /// * **e_ZERO_REFERENCES**     : message refCount has become zero
     /// * **e_NON_ZERO_REFERENCES** : message refCount is still not zero
@@ -476,6 +513,22 @@ class FileBackedStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
     virtual bool
     removeVirtualStorage(const mqbu::StorageKey& appKey) BSLS_KEYWORD_OVERRIDE;
 
+    /// Set the app states of the message having the specified `msgGUID` to
+    /// its current value with the bits in the specified `clearMask` cleared
+    /// and then the bits in the specified `setMask` set, and load the
+    /// previous value into the specified `previous`.  Return `e_SUCCESS`,
+    /// or `e_GUID_NOT_FOUND` if no message with `msgGUID` exists.
+    virtual mqbi::StorageResult::Enum
+    updateAppStates(bsls::Types::Uint64*     previous,
+                    const bmqt::MessageGUID& msgGUID,
+                    bsls::Types::Uint64      setMask,
+                    bsls::Types::Uint64 clearMask) BSLS_KEYWORD_OVERRIDE;
+
+    /// Clear the bits in the specified `mask` from the app states of every
+    /// message in this storage.
+    virtual void
+    clearAppStates(bsls::Types::Uint64 mask) BSLS_KEYWORD_OVERRIDE;
+
     // MANIPULATORS (for mqbs::ReplicatedStorage)
     virtual void processMessageRecord(const bmqt::MessageGUID&     guid,
                                       unsigned int                 msgLen,
@@ -610,6 +663,12 @@ class FileBackedStorageIterator : public mqbi::StorageIterator {
     /// `items` collection and the message currently pointed at by this
     /// iterator has received replication factor Receipts.
     bool hasReceipt() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the bitmap of the virtual storages holding the message
+    /// currently pointed at by this iterator.  Note that this does not load
+    /// the message.  The behavior is undefined unless `atEnd` returns
+    /// `false`.
+    bsls::Types::Uint64 appStates() const BSLS_KEYWORD_OVERRIDE;
 };
 
 // ============================================================================
@@ -623,7 +682,8 @@ class FileBackedStorageIterator : public mqbi::StorageIterator {
 inline void FileBackedStorage::Item::reset()
 {
     d_array.clear();
-    d_refCount = 0;
+    d_appStates = 0;
+    d_refCount  = 0;
 }
 
 // -----------------
@@ -750,6 +810,20 @@ FileBackedStorage::queueOpRecordHandles() const
     return d_queueOpRecordHandles;
 }
 
+inline mqbi::StorageResult::Enum
+FileBackedStorage::getAppStates(bsls::Types::Uint64*     appStates,
+                                const bmqt::MessageGUID& msgGUID) const
+{
+    RecordHandleMapConstIter it = d_handles.find(msgGUID);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(it == d_handles.end())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return mqbi::StorageResult::e_GUID_NOT_FOUND;  // RETURN
+    }
+
+    *appStates = it->second.d_appStates;
+    return mqbi::StorageResult::e_SUCCESS;
+}
+
 inline int FileBackedStorage::numVirtualStorages() const
 {
     return d_virtualStorageCatalog.numVirtualStorages();
@@ -0,0 +1,934 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_filebackedstorage.t.cpp                                       -*-C++-*-
+#include <mqbs_filebackedstorage.h>
+
+// MQB
+#include <mqbcfg_messages.h>
+#include <mqbconfm_messages.h>
+#include <mqbi_storage.h>
+#include <mqbmock_cluster.h>
+#include <mqbmock_dispatcher.h>
+#include <mqbmock_domain.h>
+#include <mqbmock_queue.h>
+#include <mqbmock_queueengine.h>
+#include <mqbnet_mockcluster.h>
+#include <mqbs_datastore.h>
+#include <mqbs_filestore.h>
+#include <mqbs_filestoreprotocol.h>
+#include <mqbs_filestoreset.h>
+#include <mqbs_filestoreutil.h>
+#include <mqbs_filesystemutil.h>
+#include <mqbs_journalfileiterator.h>
+#include <mqbs_mappedfiledescriptor.h>
+#include <mqbstat_clusterstats.h>
+#include <mqbu_messageguidutil.h>
+#include <mqbu_storagekey.h>
+
+// BMQ
+#include <bmqp_crc32c.h>
+#include <bmqp_protocol.h>
+#include <bmqp_protocolutil.h>
+#include <bmqt_compressionalgorithmtype.h>
+#include <bmqt_messageguid.h>
+#include <bmqt_uri.h>
+
+// MWC
+#include <mwcsys_time.h>
+#include <mwcu_memoutstream.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bdlcc_sharedobjectpool.h>
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+#include <bdlmt_eventscheduler.h>
+#include <bdlmt_fixedthreadpool.h>
+#include <bdls_filesystemutil.h>
+#include <bdlt_currenttime.h>
+#include <bdlt_epochutil.h>
+#include <bsl_limits.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bslma_managedptr.h>
+#include <bsls_systemclocktype.h>
+#include <bsls_types.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+// CONSTANTS
+const int                k_NODE_ID      = 12345;
+const char               k_URI_STR[]    = "bmq://mydomain/testqueue";
+const char               k_HEX_QUEUE[]  = "ABCDEF1234";
+const int                k_PAYLOAD_SIZE = 4096;
+const bsls::Types::Int64 k_INT64_MAX =
+    bsl::numeric_limits<bsls::Types::Int64>::max();
+const mqbu::StorageKey k_QUEUE_KEY(mqbu::StorageKey::HexRepresentation(),
+                                   k_HEX_QUEUE);
+
+// ALIASES
+typedef bdlcc::SharedObjectPool<
+    bdlbb::Blob,
+    bdlcc::ObjectPoolFunctors::DefaultCreator,
+    bdlcc::ObjectPoolFunctors::RemoveAll<bdlbb::Blob> >
+    BlobSpPool;
+
+// FUNCTIONS
+
+/// Create a new blob at the specified `arena` address, using the specified
+/// `bufferFactory` and `allocator`.
+void createBlob(bdlbb::BlobBufferFactory* bufferFactory,
+                void*                     arena,
+                bslma::Allocator*         allocator)
+{
+    new (arena) bdlbb::Blob(bufferFactory, allocator);
+}
+
+void queueCreationCb(int*                    status,
+                     int                     partitionId,
+                     const bmqt::Uri&        uri,
+                     const mqbu::StorageKey& queueKey)
+{
+    static_cast<void>(status);
+    static_cast<void>(partitionId);
+    static_cast<void>(uri);
+    static_cast<void>(queueKey);
+}
+
+void queueDeletionCb(int*                    status,
+                     int                     partitionId,
+                     const bmqt::Uri&        uri,
+                     const mqbu::StorageKey& queueKey)
+{
+    static_cast<void>(status);
+    static_cast<void>(partitionId);
+    static_cast<void>(uri);
+    static_cast<void>(queueKey);
+}
+
+void recoveredQueuesCb(
+    int                                           partitionId,
+    const mqbs::DataStoreConfig::QueueKeyInfoMap& queueKeyInfoMap)
+{
+    static_cast<void>(partitionId);
+    static_cast<void>(queueKeyInfoMap);
+}
+
+/// Return the specified `blob` decompressed from the specified
+/// `compressionAlgorithmType`.
+bsl::string decompress(const bdlbb::Blob&                   blob,
+                       bmqt::CompressionAlgorithmType::Enum cat,
+                       bdlbb::BlobBufferFactory*            bufferFactory)
+{
+    bdlbb::Blob result(bufferFactory, s_allocator_p);
+    const int   rc = bmqp::ProtocolUtil::convertCompression(
+        &result,
+        blob,
+        cat,
+        bmqt::CompressionAlgorithmType::e_NONE,
+        false,  // haveNewMessageProperties
+        bufferFactory,
+        s_allocator_p);
+    ASSERT_EQ(0, rc);
+
+    bsl::string str(s_allocator_p);
+    str.resize(result.length());
+    bdlbb::BlobUtil::copy(str.data(), result, 0, result.length());
+    return str;
+}
+
+/// Load into the specified `types`, in order, the types of the records of
+/// the message having the specified `guid` found in the journal file of the
+/// most recent file set at the specified `location`.  Return 0 on success,
+/// and a non-zero value otherwise.
+int loadJournalRecordTypes(bsl::vector<mqbs::RecordType::Enum>* types,
+                           const bsl::string&                   location,
+                           const bmqt::MessageGUID&             guid)
+{
+    bsl::vector<mqbs::FileStoreSet> fileSets(s_allocator_p);
+    int rc = mqbs::FileStoreUtil::findFileSets(&fileSets,
+                                               location,
+                                               0,       // partitionId
+                                               false,   // withSize
+                                               false);  // needQList
+    if (rc != 0 || fileSets.empty()) {
+        return -1;  // RETURN
+    }
+
+    mwcu::MemOutStream         errorDesc(s_allocator_p);
+    mqbs::MappedFileDescriptor journalFd;
+    rc = mqbs::FileStoreUtil::openFileSetReadMode(errorDesc,
+                                                  fileSets.back(),
+                                                  &journalFd);
+    if (rc != 0) {
+        PV("Failed to open journal: " << errorDesc.str());
+        return -2;  // RETURN
+    }
+
+    mqbs::JournalFileIterator jit;
+    rc = mqbs::FileStoreUtil::loadIterators(errorDesc,
+                                            &jit,
+                                            0,  // dit
+                                            0,  // qit
+                                            journalFd,
+                                            mqbs::MappedFileDescriptor(),
+                                            mqbs::MappedFileDescriptor(),
+                                            fileSets.back(),
+                                            false,   // needQList
+                                            false);  // needData
+    if (rc == 0) {
+        // The journal is iterated backward
+        while (jit.nextRecord() == 1) {
+            const mqbs::RecordType::Enum type = jit.recordType();
+            if ((mqbs::RecordType::e_MESSAGE == type &&
+                 jit.asMessageRecord().messageGUID() == guid) ||
+                (mqbs::RecordType::e_CONFIRM == type &&
+                 jit.asConfirmRecord().messageGUID() == guid) ||
+                (mqbs::RecordType::e_DELETION == type &&
+                 jit.asDeletionRecord().messageGUID() == guid)) {
+                types->insert(types->begin(), type);
+            }
+        }
+    }
+    else {
+        PV("Failed to iterate journal: " << errorDesc.str());
+    }
+
+    mqbs::FileSystemUtil::close(&journalFd);
+    return rc == 0 ? 0 : -3;
+}
+
+// CLASSES
+// =============
+// struct Tester
+// =============
+
+/// Provide a `mqbs::FileBackedStorage` writing to a `mqbs::FileStore`
+/// opened, as primary, in the specified location.
+struct Tester {
+  private:
+    // DATA
+    bdlmt::EventScheduler                      d_scheduler;
+    bdlbb::PooledBlobBufferFactory             d_bufferFactory;
+    mqbnet::Channel::ItemPool                  d_itemPool;
+    bsl::string                                d_location;
+    BlobSpPool                                 d_blobSpPool;
+    mqbcfg::ClusterDefinition                  d_clusterCfg;
+    bslma::ManagedPtr<mqbnet::MockCluster>     d_netCluster_mp;
+    bsl::shared_ptr<mwcst::StatContext>        d_clusterStatsRootContext_sp;
+    mqbstat::ClusterStats                      d_clusterStats;
+    mqbs::DataStoreConfig                      d_dsCfg;
+    bdlmt::FixedThreadPool                     d_miscWorkThreadPool;
+    mqbmock::Dispatcher                        d_dispatcher;
+    mqbmock::Cluster                           d_mockCluster;
+    mqbmock::Domain                            d_mockDomain;
+    mqbmock::Queue                             d_mockQueue;
+    mqbmock::QueueEngine                       d_mockQueueEngine;
+    mqbs::FileStore::StateSpPool               d_statePool;
+    bslma::ManagedPtr<mqbs::FileStore>         d_fs_mp;
+    bslma::ManagedPtr<mqbs::FileBackedStorage> d_storage_mp;
+
+  public:
+    // CREATORS
+    Tester(const char* location)
+    : d_scheduler(bsls::SystemClockType::e_MONOTONIC, s_allocator_p)
+    , d_bufferFactory(1024, s_allocator_p)
+    , d_itemPool(mqbnet::Channel::k_ITEM_SIZE, s_allocator_p)
+    , d_location(location, s_allocator_p)
+    , d_blobSpPool(bdlf::BindUtil::bind(&createBlob,
+                                        &d_bufferFactory,
+                                        bdlf::PlaceHolders::_1,   // arena
+                                        bdlf::PlaceHolders::_2),  // alloc
+                   1024,  // blob pool growth strategy
+                   s_allocator_p)
+    , d_clusterCfg(s_allocator_p)
+    , d_clusterStatsRootContext_sp(
+          mqbstat::ClusterStatsUtil::initializeStatContextCluster(
+              2,
+              s_allocator_p))
+    , d_clusterStats(s_allocator_p)
+    , d_miscWorkThreadPool(1, 1, s_allocator_p)
+    , d_dispatcher(s_allocator_p)
+    , d_mockCluster(&d_bufferFactory, s_allocator_p)
+    , d_mockDomain(&d_mockCluster, s_allocator_p)
+    , d_mockQueue(&d_mockDomain, s_allocator_p)
+    , d_mockQueueEngine(s_allocator_p)
+    , d_statePool(1024, s_allocator_p)
+    {
+        bdls::FilesystemUtil::remove(d_location, true);
+        bdls::FilesystemUtil::createDirectories(d_location, true);
+
+        mqbcfg::ClusterNode nodeCfg(s_allocator_p);
+        nodeCfg.name().assign("foobar");
+        nodeCfg.id()         = k_NODE_ID;
+        nodeCfg.dataCenter() = "US-WEST";
+        nodeCfg.transport().makeTcp().endpoint().assign(
+            "tcp://localhost:34567");
+        d_clusterCfg.name().assign("mock-cluster");
+        d_clusterCfg.nodes().push_back(nodeCfg);
+
+        d_netCluster_mp.load(new (*s_allocator_p)
+                                 mqbnet::MockCluster(d_clusterCfg,
+                                                     &d_bufferFactory,
+                                                     &d_itemPool,
+                                                     s_allocator_p),
+                             s_allocator_p);
+
+        d_dsCfg.setScheduler(&d_scheduler)
+            .setBufferFactory(&d_bufferFactory)
+            .setPreallocate(false)
+            .setPrefaultPages(false)
+            .setLocation(d_location)
+            .setArchiveLocation(d_location)
+            .setNodeId(k_NODE_ID)
+            .setPartitionId(0)
+            .setMaxDataFileSize(10 * 1024 * 1024)
+            .setMaxJournalFileSize(1024 * 1024)
+            .setMaxQlistFileSize(1024 * 1024)
+            .setQueueCreationCb(
+                bdlf::BindUtil::bind(&queueCreationCb,
+                                     bdlf::PlaceHolders::_1,   // status
+                                     bdlf::PlaceHolders::_2,   // partitionId
+                                     bdlf::PlaceHolders::_3,   // QueueUri
+                                     bdlf::PlaceHolders::_4))  // QueueKey
+            .setQueueDeletionCb(
+                bdlf::BindUtil::bind(&queueDeletionCb,
+                                     bdlf::PlaceHolders::_1,   // status
+                                     bdlf::PlaceHolders::_2,   // partitionId
+                                     bdlf::PlaceHolders::_3,   // QueueUri
+                                     bdlf::PlaceHolders::_4))  // QueueKey
+            .setRecoveredQueuesCb(
+                bdlf::BindUtil::bind(&recoveredQueuesCb,
+                                     bdlf::PlaceHolders::_1,  // partitionId
+                                     bdlf::PlaceHolders::_2));
+        // queueKeyInfoMap
+
+        d_clusterStats.initialize("testCluster",
+                                  1,  // numPartitions
+                                  d_clusterStatsRootContext_sp.get(),
+                                  s_allocator_p);
+        d_fs_mp.load(new (*s_allocator_p)
+                         mqbs::FileStore(d_dsCfg,
+                                         0,  // processorId
+                                         &d_dispatcher,
+                                         d_netCluster_mp.get(),
+                                         &d_clusterStats,
+                                         &d_blobSpPool,
+                                         &d_statePool,
+                                         &d_miscWorkThreadPool,
+                                         false,  // isCSLModeEnabled
+                                         false,  // isFSMWorkflow
+                                         1,      // replicationFactor
+                                         s_allocator_p),
+                     s_allocator_p);
+
+        BSLS_ASSERT_OPT(d_fs_mp->open() == 0);
+        d_fs_mp->setPrimary(d_netCluster_mp->lookupNode(k_NODE_ID), 1);
+
+        const bmqt::Uri             uri(k_URI_STR, s_allocator_p);
+        mqbs::DataStoreRecordHandle handle;
+        BSLS_ASSERT_OPT(0 == d_fs_mp->writeQueueCreationRecord(
+                                 &handle,
+                                 uri,
+                                 k_QUEUE_KEY,
+                                 mqbs::DataStore::AppIdKeyPairs(),
+                                 bdlt::EpochUtil::convertToTimeT64(
+                                     bdlt::CurrentTime::utc()),
+                                 true));  // isNewQueue
+
+        d_mockDomain.capacityMeter()->setLimits(k_INT64_MAX, k_INT64_MAX);
+        d_mockQueue._setQueueEngine(&d_mockQueueEngine);
+
+        mqbconfm::Domain domainCfg(s_allocator_p);
+        domainCfg.deduplicationTimeMs() = 0;  // No history
+        domainCfg.messageTtl()          = k_INT64_MAX;
+
+        d_storage_mp.load(new (*s_allocator_p)
+                              mqbs::FileBackedStorage(
+                                  d_fs_mp.get(),
+                                  uri,
+                                  k_QUEUE_KEY,
+                                  domainCfg,
+                                  d_mockDomain.capacityMeter(),
+                                  bmqp::RdaInfo(),
+                                  s_allocator_p),
+                          s_allocator_p);
+        d_storage_mp->setQueue(&d_mockQueue);
+    }
+
+    ~Tester()
+    {
+        d_storage_mp.reset();
+        if (d_fs_mp->isOpen()) {
+            d_fs_mp->close();
+        }
+        bdls::FilesystemUtil::remove(d_location, true);
+    }
+
+    // MANIPULATORS
+
+    /// Configure the storage to compress payloads at rest with the
+    /// specified `compressionAlgorithmType`, and return the result of
+    /// `mqbs::FileBackedStorage::configure`.
+    int configure(int compressionAlgorithmType)
+    {
+        mqbconfm::Storage config(s_allocator_p);
+        mqbconfm::Limits  limits(s_allocator_p);
+
+        config.makeFileBacked().compressionAlgorithmType() =
+            compressionAlgorithmType;
+        limits.messages() = k_INT64_MAX;
+        limits.bytes()    = k_INT64_MAX;
+
+        mwcu::MemOutStream errorDescription(s_allocator_p);
+        const int          rc = d_storage_mp->configure(errorDescription,
+                                               config,
+                                               limits,
+                                               k_INT64_MAX,  // messageTtl
+                                               0);  // maxDeliveryAttempts
+        PVV("configure rc: " << rc << ", error: " << errorDescription.str());
+        return rc;
+    }
+
+    /// Put into the storage a message having the specified `guid`, a
+    /// compressible payload of `k_PAYLOAD_SIZE` bytes loaded into the
+    /// specified `payload`, and the specified `messagePropertiesInfo`, and
+    /// load the resulting attributes into the specified `attributes`.
+    /// Return the result of `mqbs::FileBackedStorage::put`.
+    mqbi::StorageResult::Enum
+    put(mqbi::StorageMessageAttributes*    attributes,
+        bsl::string*                       payload,
+        const bmqt::MessageGUID&           guid,
+        const bmqp::MessagePropertiesInfo& messagePropertiesInfo =
+            bmqp::MessagePropertiesInfo())
+    {
+        payload->assign(k_PAYLOAD_SIZE, 'x');
+
+        bsl::shared_ptr<bdlbb::Blob> appData;
+        appData.createInplace(s_allocator_p, &d_bufferFactory, s_allocator_p);
+        bdlbb::BlobUtil::append(appData.get(),
+                                payload->data(),
+                                static_cast<int>(payload->length()));
+
+        *attributes = mqbi::StorageMessageAttributes(
+            bdlt::EpochUtil::convertToTimeT64(bdlt::CurrentTime::utc()),
+            1,  // refCount
+            messagePropertiesInfo,
+            bmqt::CompressionAlgorithmType::e_NONE);
+        attributes->setCrc32c(bmqp::Crc32c::calculate(*appData));
+
+        return d_storage_mp->put(attributes,
+                                 guid,
+                                 appData,
+                                 bsl::shared_ptr<bdlbb::Blob>(),
+                                 mqbi::Storage::StorageKeys());
+    }
+
+    // ACCESSORS
+    mqbs::FileBackedStorage& storage() const { return *d_storage_mp; }
+
+    mqbs::FileStore& fileStore() const { return *d_fs_mp; }
+
+    bdlbb::BlobBufferFactory* bufferFactory()
+    {
+        return &d_bufferFactory;
+    }
+
+    const bsl::string& location() const { return d_location; }
+};
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise the basic functionality of the component: a message put into
+//   a storage not compressing at rest is stored as it is.
+//
+// Testing:
+//   configure
+//   put
+//   get
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    s_ignoreCheckDefAlloc = true;
+
+    Tester tester("./test-filebackedstorage-1");
+    ASSERT_EQ(0, tester.configure(bmqt::CompressionAlgorithmType::e_NONE));
+
+    bmqt::MessageGUID guid;
+    mqbu::MessageGUIDUtil::generateGUID(&guid);
+
+    mqbi::StorageMessageAttributes attributes;
+    bsl::string                    payload(s_allocator_p);
+    ASSERT_EQ(mqbi::StorageResult::e_SUCCESS,
+              tester.put(&attributes, &payload, guid));
+    ASSERT_EQ(bmqt::CompressionAlgorithmType::e_NONE,
+              attributes.compressionAlgorithmType());
+    ASSERT_EQ(static_cast<bsls::Types::Int64>(1),
+              tester.storage().numMessages(mqbu::StorageKey::k_NULL_KEY));
+    ASSERT_EQ(static_cast<bsls::Types::Int64>(k_PAYLOAD_SIZE),
+              tester.storage().numBytes(mqbu::StorageKey::k_NULL_KEY));
+
+    bsl::shared_ptr<bdlbb::Blob>   appData;
+    bsl::shared_ptr<bdlbb::Blob>   options;
+    mqbi::StorageMessageAttributes stored;
+    ASSERT_EQ(mqbi::StorageResult::e_SUCCESS,
+              tester.storage().get(&appData, &options, &stored, guid));
+    ASSERT_EQ(bmqt::CompressionAlgorithmType::e_NONE,
+              stored.compressionAlgorithmType());
+    ASSERT_EQ(payload,
+              decompress(*appData,
+                         bmqt::CompressionAlgorithmType::e_NONE,
+                         tester.bufferFactory()));
+}
+
+static void test2_configureInvalidCompressionAlgorithm()
+// ------------------------------------------------------------------------
+// CONFIGURE INVALID COMPRESSION ALGORITHM
+//
+// Concerns:
+//   'configure' rejects a compression algorithm at rest which is not a
+//   supported 'bmqt::CompressionAlgorithmType', and the storage keeps its
+//   previous configuration, storing payloads uncompressed.
+//
+// Testing:
+//   configure
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName(
+        "CONFIGURE INVALID COMPRESSION ALGORITHM");
+
+    s_ignoreCheckDefAlloc = true;
+
+    Tester tester("./test-filebackedstorage-2");
+    ASSERT_EQ(0, tester.configure(bmqt::CompressionAlgorithmType::e_NONE));
+
+    ASSERT_NE(0,
+              tester.configure(
+                  bmqt::CompressionAlgorithmType::k_LOWEST_SUPPORTED_TYPE -
+                  1));
+    ASSERT_NE(0,
+              tester.configure(
+                  bmqt::CompressionAlgorithmType::k_HIGHEST_SUPPORTED_TYPE +
+                  1));
+
+    bmqt::MessageGUID guid;
+    mqbu::MessageGUIDUtil::generateGUID(&guid);
+
+    mqbi::StorageMessageAttributes attributes;
+    bsl::string                    payload(s_allocator_p);
+    ASSERT_EQ(mqbi::StorageResult::e_SUCCESS,
+              tester.put(&attributes, &payload, guid));
+    ASSERT_EQ(bmqt::CompressionAlgorithmType::e_NONE,
+              attributes.compressionAlgorithmType());
+}
+
+static void test3_putCompressed()
+// ------------------------------------------------------------------------
+// PUT COMPRESSED
+//
+// Concerns:
+//   A message put into a storage compressing at rest:
+//   1. is written compressed, with the compression algorithm and the
+//      CRC32-C of the compressed payload in its attributes,
+//   2. is read back compressed through 'get' and the storage iterator, and
+//      decompresses to the original payload,
+//   3. is recovered compressed after the partition is closed and opened
+//      again.
+//
+// Testing:
+//   put
+//   get
+//   getIterator
+//   mqbs::FileStore::open (recovery)
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("PUT COMPRESSED");
+
+    s_ignoreCheckDefAlloc = true;
+
+    const bmqt::CompressionAlgorithmType::Enum k_CAT =
+        bmqt::CompressionAlgorithmType::e_ZLIB;
+
+    Tester tester("./test-filebackedstorage-3");
+    ASSERT_EQ(0, tester.configure(k_CAT));
+
+    bmqt::MessageGUID guid;
+    mqbu::MessageGUIDUtil::generateGUID(&guid);
+
+    // 1. Put
+    mqbi::StorageMessageAttributes attributes;
+    bsl::string                    payload(s_allocator_p);
+    ASSERT_EQ(mqbi::StorageResult::e_SUCCESS,
+              tester.put(&attributes, &payload, guid));
+    ASSERT_EQ(k_CAT, attributes.compressionAlgorithmType());
+    ASSERT_GT(static_cast<bsls::Types::Int64>(k_PAYLOAD_SIZE),
+              tester.storage().numBytes(mqbu::StorageKey::k_NULL_KEY));
+
+    // 2. Get and iterate
+    bsl::shared_ptr<bdlbb::Blob>   appData;
+    bsl::shared_ptr<bdlbb::Blob>   options;
+    mqbi::StorageMessageAttributes stored;
+    ASSERT_EQ(mqbi::StorageResult::e_SUCCESS,
+              tester.storage().get(&appData, &options, &stored, guid));
+    ASSERT_EQ(k_CAT, stored.compressionAlgorithmType());
+    ASSERT_EQ(bmqp::Crc32c::calculate(*appData), stored.crc32c());
+    ASSERT_EQ(payload, decompress(*appData, k_CAT, tester.bufferFactory()));
+
+    bslma::ManagedPtr<mqbi::StorageIterator> it =
+        tester.storage().getIterator(mqbu::StorageKey::k_NULL_KEY);
+    ASSERT_EQ(false, it->atEnd());
+    ASSERT_EQ(guid, it->guid());
+    ASSERT_EQ(k_CAT, it->attributes().compressionAlgorithmType());
+    ASSERT_EQ(payload,
+              decompress(*it->appData(), k_CAT, tester.bufferFactory()));
+    ASSERT_EQ(false, it->advance());
+    it.reset();
+
+    // 3. Recover
+    mqbs::FileStore& fs = tester.fileStore();
+    fs.close();
+    ASSERT_EQ(0, fs.open());
+
+    size_t                  numMessages = 0;
+    mqbs::FileStoreIterator fsIt(&fs);
+    while (fsIt.next()) {
+        if (mqbs::RecordType::e_MESSAGE != fsIt.type()) {
+            continue;  // CONTINUE
+        }
+        ++numMessages;
+
+        mqbs::MessageRecord record;
+        fsIt.loadMessageRecord(&record);
+        ASSERT_EQ(guid, record.messageGUID());
+        ASSERT_EQ(k_CAT, record.compressionAlgorithmType());
+
+        bsl::shared_ptr<bdlbb::Blob>   recoveredAppData;
+        bsl::shared_ptr<bdlbb::Blob>   recoveredOptions;
+        mqbi::StorageMessageAttributes recovered;
+        fs.loadMessageRaw(&recoveredAppData,
+                          &recoveredOptions,
+                          &recovered,
+                          fsIt.handle());
+        ASSERT_EQ(k_CAT, recovered.compressionAlgorithmType());
+        ASSERT_EQ(bmqp::Crc32c::calculate(*recoveredAppData),
+                  recovered.crc32c());
+        ASSERT_EQ(payload,
+                  decompress(*recoveredAppData,
+                             k_CAT,
+                             tester.bufferFactory()));
+    }
+    ASSERT_EQ(1U, numMessages);
+}
+
+static void test4_putOldStyleProperties()
+// ------------------------------------------------------------------------
+// PUT OLD STYLE PROPERTIES
+//
+// Concerns:
+//   A message with old style message properties is not compressed at
+//   rest, because its properties are read straight from the stored
+//   application data (e.g., to evaluate subscriptions).
+//
+// Testing:
+//   put
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("PUT OLD STYLE PROPERTIES");
+
+    s_ignoreCheckDefAlloc = true;
+
+    Tester tester("./test-filebackedstorage-4");
+    ASSERT_EQ(0, tester.configure(bmqt::CompressionAlgorithmType::e_ZLIB));
+
+    bmqt::MessageGUID guid;
+    mqbu::MessageGUIDUtil::generateGUID(&guid);
+
+    mqbi::StorageMessageAttributes attributes;
+    bsl::string                    payload(s_allocator_p);
+    ASSERT_EQ(mqbi::StorageResult::e_SUCCESS,
+              tester.put(&attributes,
+                         &payload,
+                         guid,
+                         bmqp::MessagePropertiesInfo::makeNoSchema()));
+    ASSERT_EQ(bmqt::CompressionAlgorithmType::e_NONE,
+              attributes.compressionAlgorithmType());
+    ASSERT_EQ(static_cast<bsls::Types::Int64>(k_PAYLOAD_SIZE),
+              tester.storage().numBytes(mqbu::StorageKey::k_NULL_KEY));
+
+    bsl::shared_ptr<bdlbb::Blob>   appData;
+    bsl::shared_ptr<bdlbb::Blob>   options;
+    mqbi::StorageMessageAttributes stored;
+    ASSERT_EQ(mqbi::StorageResult::e_SUCCESS,
+              tester.storage().get(&appData, &options, &stored, guid));
+    ASSERT_EQ(bmqt::CompressionAlgorithmType::e_NONE,
+              stored.compressionAlgorithmType());
+    ASSERT_EQ(k_PAYLOAD_SIZE, appData->length());
+}
+
+static void test5_releaseLastRef()
+// ------------------------------------------------------------------------
+// RELEASE LAST REF
+//
+// Concerns:
+//   1. Releasing the last reference to a message writes no CONFIRM record
+//      to the journal of the primary: the DELETION record written when
+//      the message is removed next supersedes it.
+//   2. Releasing the last reference on rejection still writes a CONFIRM
+//      record, which carries the rejection reason.
+//   3. Recovering from a journal in which a DELETION record is not
+//      preceded by a CONFIRM record does not recover the deleted message,
+//      and recovers the other messages.
+//
+// Testing:
+//   releaseRef
+//   remove
+//   mqbs::FileStore::open (recovery)
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("RELEASE LAST REF");
+
+    s_ignoreCheckDefAlloc = true;
+
+    Tester tester("./test-filebackedstorage-5");
+    ASSERT_EQ(0, tester.configure(bmqt::CompressionAlgorithmType::e_NONE));
+
+    bmqt::MessageGUID confirmedGuid;
+    bmqt::MessageGUID rejectedGuid;
+    bmqt::MessageGUID pendingGuid;
+    mqbu::MessageGUIDUtil::generateGUID(&confirmedGuid);
+    mqbu::MessageGUIDUtil::generateGUID(&rejectedGuid);
+    mqbu::MessageGUIDUtil::generateGUID(&pendingGuid);
+
+    mqbi::StorageMessageAttributes attributes;
+    bsl::string                    payload(s_allocator_p);
+    ASSERT_EQ(mqbi::StorageResult::e_SUCCESS,
+              tester.put(&attributes, &payload, confirmedGuid));
+    ASSERT_EQ(mqbi::StorageResult::e_SUCCESS,
+              tester.put(&attributes, &payload, rejectedGuid));
+    ASSERT_EQ(mqbi::StorageResult::e_SUCCESS,
+              tester.put(&attributes, &payload, pendingGuid));
+
+    const bsls::Types::Int64 timestamp = bdlt::EpochUtil::convertToTimeT64(
+        bdlt::CurrentTime::utc());
+
+    ASSERT_EQ(mqbi::StorageResult::e_ZERO_REFERENCES,
+              tester.storage().releaseRef(confirmedGuid,
+                                          mqbu::StorageKey::k_NULL_KEY,
+                                          timestamp));
+    ASSERT_EQ(mqbi::StorageResult::e_SUCCESS,
+              tester.storage().remove(confirmedGuid, 0, true));
+
+    ASSERT_EQ(mqbi::StorageResult::e_ZERO_REFERENCES,
+              tester.storage().releaseRef(rejectedGuid,
+                                          mqbu::StorageKey::k_NULL_KEY,
+                                          timestamp,
+                                          true));  // onReject
+    ASSERT_EQ(mqbi::StorageResult::e_SUCCESS,
+              tester.storage().remove(rejectedGuid, 0, true));
+
+    ASSERT_EQ(1, tester.storage().numMessages(mqbu::StorageKey::k_NULL_KEY));
+
+    mqbs::FileStore& fs = tester.fileStore();
+    fs.close();
+
+    PV("Journal of the primary");
+    {
+        bsl::vector<mqbs::RecordType::Enum> types(s_allocator_p);
+        ASSERT_EQ(0,
+                  loadJournalRecordTypes(&types,
+                                         tester.location(),
+                                         confirmedGuid));
+        ASSERT_EQ(2U, types.size());
+        if (types.size() == 2) {
+            ASSERT_EQ(mqbs::RecordType::e_MESSAGE, types[0]);
+            ASSERT_EQ(mqbs::RecordType::e_DELETION, types[1]);
+        }
+
+        types.clear();
+        ASSERT_EQ(0,
+                  loadJournalRecordTypes(&types,
+                                         tester.location(),
+                                         rejectedGuid));
+        ASSERT_EQ(3U, types.size());
+        if (types.size() == 3) {
+            ASSERT_EQ(mqbs::RecordType::e_MESSAGE, types[0]);
+            ASSERT_EQ(mqbs::RecordType::e_CONFIRM, types[1]);
+            ASSERT_EQ(mqbs::RecordType::e_DELETION, types[2]);
+        }
+    }
+
+    PV("Recovery");
+    {
+        ASSERT_EQ(0, fs.open());
+
+        size_t                  numMessages = 0;
+        size_t                  numConfirms = 0;
+        mqbs::FileStoreIterator fsIt(&fs);
+        while (fsIt.next()) {
+            if (mqbs::RecordType::e_CONFIRM == fsIt.type()) {
+                ++numConfirms;
+            }
+            if (mqbs::RecordType::e_MESSAGE != fsIt.type()) {
+                continue;  // CONTINUE
+            }
+            ++numMessages;
+
+            mqbs::MessageRecord record;
+            fsIt.loadMessageRecord(&record);
+            ASSERT_EQ(pendingGuid, record.messageGUID());
+        }
+        ASSERT_EQ(1U, numMessages);
+        ASSERT_EQ(0U, numConfirms);
+    }
+}
+
+static void test6_replicaDeletionWithoutConfirm()
+// ------------------------------------------------------------------------
+// REPLICA DELETION WITHOUT CONFIRM
+//
+// Concerns:
+//   A replica receiving the DELETION record of a message without having
+//   received a CONFIRM record for it (as the primary does not write one
+//   when releasing the last reference) removes the message, its records,
+//   and its contribution to the capacity meter.
+//
+// Testing:
+//   processMessageRecord
+//   processDeletionRecord
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("REPLICA DELETION WITHOUT CONFIRM");
+
+    s_ignoreCheckDefAlloc = true;
+
+    Tester tester("./test-filebackedstorage-6");
+    ASSERT_EQ(0, tester.configure(bmqt::CompressionAlgorithmType::e_NONE));
+
+    bmqt::MessageGUID guid;
+    mqbu::MessageGUIDUtil::generateGUID(&guid);
+
+    // Write the MESSAGE record replicated by the primary
+    bsl::shared_ptr<bdlbb::Blob> appData;
+    appData.createInplace(s_allocator_p,
+                          tester.bufferFactory(),
+                          s_allocator_p);
+    const bsl::string payload(k_PAYLOAD_SIZE, 'x', s_allocator_p);
+    bdlbb::BlobUtil::append(appData.get(),
+                            payload.data(),
+                            static_cast<int>(payload.length()));
+
+    mqbi::StorageMessageAttributes attributes(
+        bdlt::EpochUtil::convertToTimeT64(bdlt::CurrentTime::utc()),
+        1,  // refCount
+        bmqp::MessagePropertiesInfo(),
+        bmqt::CompressionAlgorithmType::e_NONE);
+    attributes.setCrc32c(bmqp::Crc32c::calculate(*appData));
+
+    mqbs::DataStoreRecordHandle handle;
+    ASSERT_EQ(0,
+              tester.fileStore().writeMessageRecord(
+                  &attributes,
+                  &handle,
+                  guid,
+                  appData,
+                  bsl::shared_ptr<bdlbb::Blob>(),
+                  k_QUEUE_KEY));
+
+    tester.storage().processMessageRecord(guid,
+                                          k_PAYLOAD_SIZE,
+                                          1,  // refCount
+                                          handle);
+    ASSERT_EQ(1, tester.storage().numMessages(mqbu::StorageKey::k_NULL_KEY));
+    ASSERT_EQ(static_cast<bsls::Types::Int64>(k_PAYLOAD_SIZE),
+              tester.storage().numBytes(mqbu::StorageKey::k_NULL_KEY));
+    ASSERT_EQ(false, tester.storage().isEmpty());
+
+    // Receive the DELETION record, with no CONFIRM record before it
+    tester.storage().processDeletionRecord(guid);
+
+    ASSERT_EQ(0, tester.storage().numMessages(mqbu::StorageKey::k_NULL_KEY));
+    ASSERT_EQ(0, tester.storage().numBytes(mqbu::StorageKey::k_NULL_KEY));
+    ASSERT_EQ(true, tester.storage().isEmpty());
+
+    bsl::shared_ptr<bdlbb::Blob>   storedAppData;
+    bsl::shared_ptr<bdlbb::Blob>   storedOptions;
+    mqbi::StorageMessageAttributes stored;
+    ASSERT_EQ(mqbi::StorageResult::e_GUID_NOT_FOUND,
+              tester.storage().get(&storedAppData,
+                                   &storedOptions,
+                                   &stored,
+                                   guid));
+
+    mqbs::FileStoreIterator fsIt(&tester.fileStore());
+    while (fsIt.next()) {
+        ASSERT_NE(mqbs::RecordType::e_MESSAGE, fsIt.type());
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    mwcsys::Time::initialize();
+    mqbu::MessageGUIDUtil::initialize();
+    bmqp::ProtocolUtil::initialize();
+
+    switch (_testCase) {
+    case 0:
+    case 6: test6_replicaDeletionWithoutConfirm(); break;
+    case 5: test5_releaseLastRef(); break;
+    case 4: test4_putOldStyleProperties(); break;
+    case 3: test3_putCompressed(); break;
+    case 2: test2_configureInvalidCompressionAlgorithm(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    bmqp::ProtocolUtil::shutdown();
+    mwcsys::Time::shutdown();
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_ALLOC);
+}
@@ -72,6 +72,26 @@ struct FileSet BSLS_CPP11_FINAL {
 
     bsls::Types::Uint64 d_qlistFilePosition;
 
+    bsls::Types::Uint64 d_dataFileWriteBackPosition;
+    // Position in the data file up to
+    // which the write back to disk has
+    // been started.
+
+    bsls::Types::Uint64 d_journalFileWriteBackPosition;
+    // Position in the journal file up to
+    // which the write back to disk has
+    // been started.
+
+    bsls::Types::Uint64 d_dataFileReadAheadPosition;
+    // Position in the data file up to
+    // which the read ahead of messages
+    // being delivered has been requested.
+
+    bsls::Types::Uint64 d_dataFileReadAheadSize;
+    // Size of the last read ahead of the
+    // data file, grown while messages are
+    // read sequentially.
+
     bsl::string d_dataFileName;
 
     bsl::string d_journalFileName;
@@ -128,6 +148,10 @@ inline FileSet::FileSet(FileStore* store, bslma::Allocator* allocator)
 , d_dataFilePosition(0)
 , d_journalFilePosition(0)
 , d_qlistFilePosition(0)
+, d_dataFileWriteBackPosition(0)
+, d_journalFileWriteBackPosition(0)
+, d_dataFileReadAheadPosition(0)
+, d_dataFileReadAheadSize(0)
 , d_dataFileName(allocator)
 , d_journalFileName(allocator)
 , d_qlistFileName(allocator)
@@ -35,7 +35,9 @@
 #include <mqbs_memoryblock.h>
 #include <mqbs_offsetptr.h>
 #include <mqbs_qlistfileiterator.h>
+#include <mqbs_recoveryindex.h>
 #include <mqbs_replicatedstorage.h>
+#include <mqbs_storageengine.h>
 #include <mqbs_storageutil.h>
 #include <mqbstat_clusterstats.h>
 #include <mqbu_exit.h>
@@ -66,6 +68,7 @@
 #include <bdlf_placeholder.h>
 #include <bdlma_localsequentialallocator.h>
 #include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_datetime.h>
 #include <bdlt_epochutil.h>
@@ -76,11 +79,16 @@
 #include <bsl_cstring.h>
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
+#include <bsl_limits.h>
 #include <bsl_map.h>
 #include <bsl_unordered_set.h>
 #include <bsl_utility.h>
+#include <bsl_vector.h>
 #include <bslim_printer.h>
+#include <bslmt_latch.h>
+#include <bslmt_lockguard.h>
 #include <bsls_annotation.h>
+#include <bsls_performancehint.h>
 #include <bsls_timeinterval.h>
 
 // SYS
@@ -104,6 +112,76 @@ const double k_PARTITION_AVAILABLESPACE_SECS = 20;
 
 const int k_NAGLE_PACKET_COUNT = 100;
 
+/// Value of 'd_replicationBatchDeadline' when the messages of the current
+/// replication batch have no latency limit.
+const bsls::Types::Int64 k_NO_REPLICATION_DEADLINE =
+    bsl::numeric_limits<bsls::Types::Int64>::max();
+
+/// Maximum number of messages a replica confirms with a single Replication
+/// Receipt before sending it, even if the current dispatcher batch is not
+/// over yet.
+const int k_MAX_COALESCED_RECEIPTS = 128;
+
+/// Percentage of the capacity of a file of the active file set from which
+/// the next file set is prepared in the background, so that it is ready by
+/// the time the partition rolls over.
+const bsls::Types::Uint64 k_PREPARE_NEXT_FILE_SET_PERCENT = 60;
+
+/// Interval, in milliseconds, after which a group commit which failed to
+/// sync the files to disk is retried.
+const int k_GROUP_COMMIT_RETRY_INTERVAL_MS = 500;
+
+/// Minimum interval, in nanoseconds, between two reports of the huge page
+/// backed size of the active file set, as it requires reading
+/// '/proc/self/smaps'.
+const bsls::Types::Int64 k_HUGE_PAGE_REPORT_INTERVAL_NS =
+    60 * bdlt::TimeUnitRatio::k_NANOSECONDS_PER_SECOND;
+
+/// Minimum number of CRC32-C checks of message payloads verified by a
+/// thread at recovery.
+const size_t k_CRC32C_CHECKS_PER_RANGE = 4096;
+
+/// Number of CRC32-C checks of message payloads computed at once, with
+/// `bmqp::Crc32c::calculateMultiple`, at recovery.
+const size_t k_CRC32C_CHECKS_PER_BATCH = 64;
+
+/// Alignment of the regions of the data file which are deallocated by a
+/// compaction.
+const bsls::Types::Uint64 k_COMPACTION_ALIGNMENT = 4096;
+
+/// Minimum size of a region of the data file deallocated by a compaction.
+const bsls::Types::Uint64 k_MIN_COMPACTION_REGION_SIZE = 1024 * 1024;
+
+/// Name of the sub-directory of the partition location in which the
+/// recovery index is checkpointed.
+const char k_RECOVERY_INDEX_DIRECTORY[] = "index";
+
+/// Name of the sub-directory of the partition location in which the next
+/// file set is prepared.
+const char k_NEXT_FILE_SET_DIRECTORY[] = "next";
+
+/// Minimum number of bytes written to a file of the active file set before
+/// their write back to disk is started, when incremental write back is
+/// enabled.
+const bsls::Types::Uint64 k_WRITE_BACK_THRESHOLD = 4 * 1024 * 1024;
+
+/// Initial size of the region of the active data file read ahead of the
+/// messages being delivered, and size to which it is reset when messages are
+/// not read in order.
+const bsls::Types::Uint64 k_READ_AHEAD_MIN_SIZE = 256 * 1024;
+
+/// Maximum delay, in seconds, before a storage is checked again for expired
+/// messages, even if the expiry index does not mark it as due yet.  This
+/// bounds the time it takes for a change of the deduplication time of a
+/// queue to be taken into account.  Note that a change of the TTL of a queue
+/// is notified through `onStorageExpiryChanged` instead.
+const bsls::Types::Uint64 k_GC_EXPIRY_CHECK_MAX_DELAY_SECONDS = 60;
+
+/// Maximum age, in nanoseconds, of a snapshot of the summary of a partition
+/// to be reused by the admin commands.
+const bsls::Types::Int64 k_SUMMARY_SNAPSHOT_MAX_AGE =
+    bdlt::TimeUnitRatio::k_NS_PER_S;
+
 const int k_KEY_LEN = FileStoreProtocol::k_KEY_LENGTH;
 
 const unsigned int k_REQUESTED_JOURNAL_SPACE =
@@ -113,6 +191,110 @@ const unsigned int k_REQUESTED_JOURNAL_SPACE =
 //             1 journal sync point if self needs to issue another sync point
 //             in 'setPrimary' with old values
 
+/// Number of JOURNAL records iterated during recovery between two checks of
+/// whether the recovery progress should be reported.
+const bsls::Types::Uint64 k_RECOVERY_PROGRESS_CHECK_RECORDS = 64 * 1024;
+
+/// Minimum interval, in nanoseconds, between two reports of the recovery
+/// progress of a partition.
+const bsls::Types::Int64 k_RECOVERY_PROGRESS_REPORT_INTERVAL =
+    10 * bdlt::TimeUnitRatio::k_NS_PER_S;
+
+// ==============================
+// class RecoveryProgressReporter
+// ==============================
+
+/// Mechanism periodically logging the progress of a reverse iteration over
+/// a JOURNAL file during recovery, along with an estimation of the time
+/// remaining, so that the recovery of large partitions can be monitored.
+class RecoveryProgressReporter {
+  private:
+    // CLASS-SCOPE CATEGORY
+    BALL_LOG_SET_CLASS_CATEGORY("MQBS.FILESTORE");
+
+  private:
+    // DATA
+    const bsl::string& d_partitionDesc;
+    // Description of the partition being recovered.
+
+    const char* d_passDesc;
+    // Description of the iteration being performed.
+
+    bsls::Types::Uint64 d_firstOffset;
+    // Offset of the first record of the JOURNAL.
+
+    bsls::Types::Uint64 d_lastOffset;
+    // Offset of the last record of the JOURNAL, where the reverse iteration
+    // starts.
+
+    bsls::Types::Uint64 d_numRecords;
+    // Number of records iterated so far.
+
+    bsls::Types::Int64 d_startTime;
+    // Time, in nanoseconds, of the start of the iteration.
+
+    bsls::Types::Int64 d_lastReportTime;
+    // Time, in nanoseconds, of the last report.
+
+  public:
+    // CREATORS
+
+    /// Create a reporter for the iteration described by the specified
+    /// `passDesc` over the JOURNAL of the partition described by the
+    /// specified `partitionDesc`, using the specified `journalIt`.
+    RecoveryProgressReporter(const bsl::string&         partitionDesc,
+                             const char*                passDesc,
+                             const JournalFileIterator& journalIt)
+    : d_partitionDesc(partitionDesc)
+    , d_passDesc(passDesc)
+    , d_firstOffset(journalIt.firstRecordPosition())
+    , d_lastOffset(journalIt.lastRecordPosition())
+    , d_numRecords(0)
+    , d_startTime(mwcsys::Time::highResolutionTimer())
+    , d_lastReportTime(d_startTime)
+    {
+        // NOTHING
+    }
+
+    // MANIPULATORS
+
+    /// Account for the record at the specified `recordOffset`, and report
+    /// the progress of the iteration if it has not been reported recently.
+    void onRecord(bsls::Types::Uint64 recordOffset)
+    {
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                ++d_numRecords % k_RECOVERY_PROGRESS_CHECK_RECORDS != 0)) {
+            return;  // RETURN
+        }
+
+        const bsls::Types::Int64 now = mwcsys::Time::highResolutionTimer();
+        if (now - d_lastReportTime < k_RECOVERY_PROGRESS_REPORT_INTERVAL ||
+            d_lastOffset <= d_firstOffset || recordOffset > d_lastOffset) {
+            return;  // RETURN
+        }
+        d_lastReportTime = now;
+
+        const double done = static_cast<double>(d_lastOffset -
+                                                recordOffset) /
+                            static_cast<double>(d_lastOffset - d_firstOffset);
+        const bsls::Types::Int64 elapsed = now - d_startTime;
+        const bsls::Types::Int64 eta =
+            done > 0 ? static_cast<bsls::Types::Int64>(elapsed *
+                                                       (1 - done) / done)
+                     : 0;
+
+        BALL_LOG_INFO << d_partitionDesc << "Recovery: " << d_passDesc
+                      << " pass over the JOURNAL is "
+                      << static_cast<int>(done * 100) << "% complete ("
+                      << mwcu::PrintUtil::prettyNumber(
+                             static_cast<bsls::Types::Int64>(d_numRecords))
+                      << " records), elapsed: "
+                      << mwcu::PrintUtil::prettyTimeInterval(elapsed)
+                      << ", estimated time remaining: "
+                      << mwcu::PrintUtil::prettyTimeInterval(eta) << ".";
+    }
+};
+
 void updateFileOffsets(bsls::Types::Uint64* journalOffset,
                        bsls::Types::Uint64* dataOffset,
                        JournalFileIterator* jit,
@@ -253,6 +435,156 @@ void noOp()
     // NOTHING
 }
 
+/// Move the specified reverse journal iterator `it` to the next record to
+/// recover and return the result of the move, as `nextRecord` does.  If the
+/// specified `recoveryIndex` is not null, the records located before its
+/// checkpoint position and which are not part of it are skipped without
+/// being read, using the specified `position` to keep track of the next
+/// indexed record.  The behavior is undefined unless `*position` is
+/// initially the number of records in `recoveryIndex`.
+int nextRecordToRecover(JournalFileIterator* it,
+                        const RecoveryIndex* recoveryIndex,
+                        bsls::Types::Uint64* position)
+{
+    int rc = it->nextRecord();
+    if (1 != rc || 0 == recoveryIndex ||
+        it->recordOffset() >= recoveryIndex->journalPosition()) {
+        return rc;  // RETURN
+    }
+
+    if (0 == *position) {
+        // No live records left before the checkpoint.
+        it->clear();
+        return 0;  // RETURN
+    }
+
+    // Records are visited backwards one by one, so the current record is
+    // never before the next indexed one.
+    const RecoveryIndex::RecordOffsets& offsets =
+        recoveryIndex->recordOffsets();
+    const bsls::Types::Uint64 target       = offsets[--(*position)];
+    const bsls::Types::Uint64 recordOffset = it->recordOffset();
+    BSLS_ASSERT_SAFE(target <= recordOffset);
+
+    if (target == recordOffset) {
+        return rc;  // RETURN
+    }
+
+    const bsls::Types::Uint64 recordSize = it->header().recordWords() *
+                                           bmqp::Protocol::k_WORD_SIZE;
+    return it->advance((recordOffset - target) / recordSize);
+}
+
+/// Message record recovered from the journal, of which the CRC32-C of the
+/// payload in the DATA file remains to be verified.
+struct PendingCrc32cCheck {
+    DataStoreRecordKey d_key;
+
+    bsls::Types::Uint64 d_recordOffset;
+
+    bsls::Types::Uint64 d_appDataOffset;
+
+    unsigned int d_appDataLen;
+
+    unsigned int d_crc32c;
+};
+
+typedef bsl::vector<PendingCrc32cCheck> PendingCrc32cChecks;
+
+/// Verify the CRC32-C of the payloads, located in the specified `base`, of
+/// the elements of the specified `checks` in the range [`begin`, `end`),
+/// set the corresponding elements of the specified `results` to whether
+/// they match, and arrive on the specified `latch` if it is not null.
+void verifyCrc32cRange(bsl::vector<char>*         results,
+                       const PendingCrc32cChecks* checks,
+                       const char*                base,
+                       size_t                     begin,
+                       size_t                     end,
+                       bslmt::Latch*              latch)
+{
+    // Compute the CRC32-Cs by batches, so that the payloads of small
+    // messages are interleaved by 'calculateMultiple'.
+
+    bmqp::Crc32c::Buffer buffers[k_CRC32C_CHECKS_PER_BATCH];
+    unsigned int         crcs[k_CRC32C_CHECKS_PER_BATCH];
+
+    for (size_t batchBegin = begin; batchBegin < end;
+         batchBegin += k_CRC32C_CHECKS_PER_BATCH) {
+        const int numBuffers = static_cast<int>(
+            bsl::min(end - batchBegin, k_CRC32C_CHECKS_PER_BATCH));
+
+        for (int i = 0; i < numBuffers; ++i) {
+            const PendingCrc32cCheck& check = (*checks)[batchBegin + i];
+            buffers[i].d_data   = check.d_appDataLen
+                                      ? base + check.d_appDataOffset
+                                      : 0;
+            buffers[i].d_length = check.d_appDataLen;
+        }
+
+        bmqp::Crc32c::calculateMultiple(crcs, buffers, numBuffers);
+
+        for (int i = 0; i < numBuffers; ++i) {
+            (*results)[batchBegin + i] = (*checks)[batchBegin + i].d_crc32c ==
+                                         crcs[i];
+        }
+    }
+
+    if (latch) {
+        latch->arrive();
+    }
+}
+
+/// Verify the CRC32-C of the payloads, located in the specified `base`, of
+/// all the specified `checks`, and load into the specified `results`
+/// whether each of them matches.  The checks are split into ranges which
+/// are verified in parallel by the threads of the specified `threadPool`
+/// (if not null) and by the calling thread, which blocks until all ranges
+/// have been verified.
+void verifyCrc32cs(bsl::vector<char>*         results,
+                   const PendingCrc32cChecks& checks,
+                   const char*                base,
+                   bdlmt::FixedThreadPool*    threadPool)
+{
+    results->assign(checks.size(), 0);
+
+    const size_t maxRanges =
+        threadPool ? static_cast<size_t>(threadPool->numThreads()) + 1 : 1;
+    const size_t numRanges = bsl::min(
+        (checks.size() + k_CRC32C_CHECKS_PER_RANGE - 1) /
+            k_CRC32C_CHECKS_PER_RANGE,
+        maxRanges);
+
+    if (numRanges <= 1) {
+        verifyCrc32cRange(results, &checks, base, 0, checks.size(), 0);
+        return;  // RETURN
+    }
+
+    // The calling thread verifies the first range, while the other ones are
+    // verified by the thread pool.
+
+    const size_t rangeSize = (checks.size() + numRanges - 1) / numRanges;
+    bslmt::Latch latch(static_cast<int>(numRanges - 1));
+    for (size_t i = 1; i < numRanges; ++i) {
+        const size_t begin = i * rangeSize;
+        const size_t end   = bsl::min(begin + rangeSize, checks.size());
+        int          rc    = threadPool->enqueueJob(
+            bdlf::BindUtil::bind(&verifyCrc32cRange,
+                                 results,
+                                 &checks,
+                                 base,
+                                 begin,
+                                 end,
+                                 &latch));
+        if (0 != rc) {
+            // Thread pool is stopped, verify the range in this thread.
+            verifyCrc32cRange(results, &checks, base, begin, end, &latch);
+        }
+    }
+
+    verifyCrc32cRange(results, &checks, base, 0, rangeSize, 0);
+    latch.wait();
+}
+
 }  // close unnamed namespace
 
 // -------------------------------------
@@ -783,6 +1115,12 @@ int FileStore::openInRecoveryMode(bsl::ostream&          errorDescription,
     BALL_LOG_INFO << partitionDesc()
                   << "Attempting to recover messages from the local storage.";
 
+    RecoveryIndex recoveryIndex(d_allocator_p);
+    const bool    hasRecoveryIndex = 0 == loadRecoveryIndex(
+                                               &recoveryIndex,
+                                               jit,
+                                               recoveryFileSet.journalFile());
+
     // jit, qit & dit may get invalidated after the call below.
 
     rc = recoverMessages(queueKeyInfoMap_p,
@@ -791,7 +1129,8 @@ int FileStore::openInRecoveryMode(bsl::ostream&          errorDescription,
                          &dataFileOffset,
                          &jit,
                          &qit,
-                         &dit);
+                         &dit,
+                         hasRecoveryIndex ? &recoveryIndex : 0);
     if (0 != rc) {
         BALL_LOG_ERROR << partitionDesc() << "Failed to recover messages from"
                        << " storage, rc: " << rc;
@@ -922,7 +1261,8 @@ int FileStore::openInRecoveryMode(bsl::ostream&          errorDescription,
         &fileSetSp->d_journalFile,
         &fileSetSp->d_dataFile,
         needQList ? &fileSetSp->d_qlistFile : 0,
-        d_config.hasPrefaultPages());
+        d_config.hasPrefaultPages(),
+        d_config.hasPersistentMemory());
 
     if (0 != rc) {
         BALL_LOG_ERROR << partitionDesc() << "Failed to open file set in write"
@@ -930,6 +1270,8 @@ int FileStore::openInRecoveryMode(bsl::ostream&          errorDescription,
         return rc * 100 + rc_OPEN_FAILURE;  // RETURN
     }
 
+    adviseHugePages(*fileSetSp);
+
     // Update file positions to point to the offsets retrieved in
     // 'recoverMessages' call above.
 
@@ -1014,7 +1356,8 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
                                bsls::Types::Uint64* dataOffset,
                                JournalFileIterator* jit,
                                QlistFileIterator*   qit,
-                               DataFileIterator*    dit)
+                               DataFileIterator*    dit,
+                               const RecoveryIndex* recoveryIndex)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(queueKeyInfoMap);
@@ -1108,9 +1451,31 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
     JournalFileIterator journalIt(*jit);
     BSLS_ASSERT_SAFE(journalIt.isReverseMode());
 
+    // If a recovery index is available, the records before its checkpoint
+    // position which are not part of it are skipped in both passes.  This is
+    // equivalent to recovering from a journal containing only those records,
+    // like the one produced by a rollover at the time of the checkpoint.
+
+    const bsls::Types::Uint64 numIndexedRecords =
+        recoveryIndex ? recoveryIndex->recordOffsets().size() : 0;
+    if (recoveryIndex) {
+        BALL_LOG_INFO << partitionDesc() << "Recovering with a recovery index "
+                      << "of " << numIndexedRecords << " records before "
+                      << "journal offset " << recoveryIndex->journalPosition()
+                      << ".";
+    }
+
     // First pass.
-    int rc = 0;
-    while ((rc = journalIt.nextRecord()) == 1) {
+    RecoveryProgressReporter firstPassProgress(partitionDesc(),
+                                               "first",
+                                               journalIt);
+    bsls::Types::Uint64      firstPassIndexPosition = numIndexedRecords;
+    int                      rc                     = 0;
+    while ((rc = nextRecordToRecover(&journalIt,
+                                     recoveryIndex,
+                                     &firstPassIndexPosition)) == 1) {
+        firstPassProgress.onRecord(journalIt.recordOffset());
+
         const RecordHeader& recHeader = journalIt.recordHeader();
         RecordType::Enum    rt        = recHeader.type();
         if (rt == RecordType::e_UNDEFINED) {
@@ -1449,7 +1814,16 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
     bsls::Types::Uint64 sequenceNum = d_sequenceNum + 1;
 
     // Second pass.
-    while (1 == (rc = jit->nextRecord())) {
+    RecoveryProgressReporter secondPassProgress(partitionDesc(),
+                                                "second",
+                                                *jit);
+    bsls::Types::Uint64      secondPassIndexPosition = numIndexedRecords;
+    PendingCrc32cChecks      pendingCrc32cChecks(d_allocator_p);
+    while (1 == (rc = nextRecordToRecover(jit,
+                                          recoveryIndex,
+                                          &secondPassIndexPosition))) {
+        secondPassProgress.onRecord(jit->recordOffset());
+
         const RecordHeader& recHeader = jit->recordHeader();
         RecordType::Enum    rt        = recHeader.type();
         BSLS_ASSERT_SAFE(RecordType::e_UNDEFINED != rt);
@@ -1474,8 +1848,14 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
         if (recHeader.primaryLeaseId() == primaryLeaseId) {
             bool invalidSeqNum = false;
 
-            if (jit->recordOffset() >= firstSyncPtOffset) {
-                // Not a rolled-over record.
+            const bool isIndexedRecord = recoveryIndex &&
+                                         jit->recordOffset() <
+                                             recoveryIndex->journalPosition();
+
+            if (jit->recordOffset() >= firstSyncPtOffset &&
+                !isIndexedRecord) {
+                // Not a rolled-over record, nor a record covered by the
+                // recovery index (which may skip records).
 
                 if (recHeader.sequenceNumber() != (sequenceNum - 1)) {
                     invalidSeqNum = true;
@@ -2465,29 +2845,6 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
             unsigned int appDataLen = totalLen - headerSize - optionsSize -
                                       lastByte;
 
-            if (!d_ignoreCrc32c) {
-                // Check CRC32C
-                unsigned int checksum = bmqp::Crc32c::calculate(
-                    dataFd->block().base() + appDataOffset,
-                    appDataLen);
-
-                if (rec.crc32c() != checksum) {
-                    MWCTSK_ALARMLOG_ALARM("RECOVERY")
-                        << partitionDesc()
-                        << "Recovery: CRC mismatch for guid ["
-                        << rec.messageGUID() << "] for queueKey ["
-                        << rec.queueKey() << "] in journal file ["
-                        << activeFileSet->d_journalFileName
-                        << "], offset: " << jit->recordOffset()
-                        << ", index: " << jit->recordIndex()
-                        << ". CRC32-C in JOURNAL record: " << rec.crc32c()
-                        << ". CRC32-C of payload in DATA file: " << checksum
-                        << ". Payload offset in DATA file: " << appDataOffset
-                        << MWCTSK_ALARMLOG_END;
-                    continue;  // CONTINUE
-                }
-            }
-
             DataStoreRecordKey key(sequenceNum, primaryLeaseId);
             DataStoreRecord record(RecordType::e_MESSAGE, jit->recordOffset());
             record.d_messageOffset              = dataHeaderOffset;
@@ -2498,7 +2855,20 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
             record.d_messagePropertiesInfo      = bmqp::MessagePropertiesInfo(
                 *dataHeader);
 
-            if (d_lastRecoveredMessage < key) {
+            if (!d_ignoreCrc32c) {
+                // The CRC32-C of the payload is verified once the second pass
+                // is complete, and the record is then removed in case of
+                // mismatch.
+
+                PendingCrc32cCheck check;
+                check.d_key           = key;
+                check.d_recordOffset  = jit->recordOffset();
+                check.d_appDataOffset = appDataOffset;
+                check.d_appDataLen    = appDataLen;
+                check.d_crc32c        = rec.crc32c();
+                pendingCrc32cChecks.push_back(check);
+            }
+            else if (d_lastRecoveredMessage < key) {
                 // This will be used as Implicit Receipt
                 d_lastRecoveredMessage = key;
             }
@@ -2517,6 +2887,51 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
     BALL_LOG_INFO << partitionDesc() << "Completed second pass over the "
                   << "journal with rc: " << rc;
 
+    // Verify the CRC32-C of the payloads of the recovered messages, in
+    // parallel, and process the results in the order of the second pass.
+
+    bsl::vector<char> crc32cResults(d_allocator_p);
+    verifyCrc32cs(&crc32cResults,
+                  pendingCrc32cChecks,
+                  dataFd->block().base(),
+                  d_miscWorkThreadPool_p);
+
+    for (size_t i = 0; i < pendingCrc32cChecks.size(); ++i) {
+        const PendingCrc32cCheck& check = pendingCrc32cChecks[i];
+        if (crc32cResults[i]) {
+            if (d_lastRecoveredMessage < check.d_key) {
+                // This will be used as Implicit Receipt
+                d_lastRecoveredMessage = check.d_key;
+            }
+            continue;  // CONTINUE
+        }
+
+        RecordIterator recordIt = d_records.find(check.d_key);
+        BSLS_ASSERT_SAFE(recordIt != d_records.end());
+
+        OffsetPtr<const MessageRecord> rec(
+            jit->mappedFileDescriptor()->block(),
+            check.d_recordOffset);
+        MWCTSK_ALARMLOG_ALARM("RECOVERY")
+            << partitionDesc() << "Recovery: CRC mismatch for guid ["
+            << rec->messageGUID() << "] for queueKey [" << rec->queueKey()
+            << "] in journal file [" << activeFileSet->d_journalFileName
+            << "], offset: " << check.d_recordOffset
+            << ". CRC32-C in JOURNAL record: " << check.d_crc32c
+            << ". CRC32-C of payload in DATA file: "
+            << bmqp::Crc32c::calculate(dataFd->block().base() +
+                                           check.d_appDataOffset,
+                                       check.d_appDataLen)
+            << ". Payload offset in DATA file: " << check.d_appDataOffset
+            << MWCTSK_ALARMLOG_END;
+
+        activeFileSet->d_outstandingBytesJournal -=
+            FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
+        activeFileSet->d_outstandingBytesData -=
+            recordIt->second.d_dataOrQlistRecordPaddedLen;
+        d_records.erase(recordIt);
+    }
+
     return rc_SUCCESS;
 }
 
@@ -2526,14 +2941,20 @@ int FileStore::create(FileSetSp* fileSetSp)
     BSLS_ASSERT_SAFE(fileSetSp);
 
     mwcu::MemOutStream errorDesc;
-    return FileStoreUtil::create(errorDesc,
-                                 fileSetSp,
-                                 this,
-                                 d_config.partitionId(),
-                                 d_config,
-                                 partitionDesc(),
-                                 !d_isFSMWorkflow,
-                                 d_allocator_p);
+
+    int rc = FileStoreUtil::create(errorDesc,
+                                   fileSetSp,
+                                   this,
+                                   d_config.partitionId(),
+                                   d_config,
+                                   partitionDesc(),
+                                   !d_isFSMWorkflow,
+                                   d_allocator_p);
+    if (0 == rc) {
+        adviseHugePages(**fileSetSp);
+    }
+
+    return rc;
 }
 
 int FileStore::rollover(bsls::Types::Uint64 timestamp)
@@ -2561,12 +2982,17 @@ int FileStore::rollover(bsls::Types::Uint64 timestamp)
     mwcsys::StatMonitorSnapshotRecorder statRecorder(partitionDesc(),
                                                      d_allocator_p);
 
-    // Create new files, add header etc.
+    // Use the file set prepared ahead of time if any, so that files do not
+    // have to be created, grown and mapped in this thread.  Otherwise, create
+    // new files, add header etc.
     FileSetSp newActiveFileSetSp;
-    int       rc = create(&newActiveFileSetSp);
+    int       rc = takeNextFileSet(&newActiveFileSetSp);
     if (0 != rc) {
-        // 'create' will log error
-        return rc;  // RETURN
+        rc = create(&newActiveFileSetSp);
+        if (0 != rc) {
+            // 'create' will log error
+            return rc;  // RETURN
+        }
     }
 
     // Iterate over outstanding records in the active set, and copy them to the
@@ -2834,16 +3260,21 @@ int FileStore::rollover(bsls::Types::Uint64 timestamp)
         }
     }
 
-    // Enqueue an event in the scheduler thread to be executed right away to
-    // delete any archived files for this partition, if applicable.  Note that
-    // one such recurring event is also scheduled by the StorageMgr, and
-    // processed in the event scheduler's dispatcher thread.  So this event
-    // should also be processed in the same event scheduler's dispatcher thread
-    // to avoid any race while deleting archived files.
+    // Enqueue a job in the misc work thread pool to delete any archived files
+    // for this partition, if applicable.  Removing multi-gigabyte files can
+    // take long, so this is not done in the scheduler's dispatcher thread,
+    // which also drives the sync points and group commits of the partitions.
+    // Note that one such clean up is also triggered periodically by the
+    // StorageMgr, and that 'FileStoreUtil::deleteArchiveFiles' skips a clean
+    // up if another one is in progress, avoiding any race while deleting
+    // archived files.
 
-    d_config.scheduler()->scheduleEvent(
-        mwcsys::Time::nowMonotonicClock(),
+    rc = d_miscWorkThreadPool_p->enqueueJob(
         bdlf::BindUtil::bind(&FileStore::deleteArchiveFilesCb, this));
+    if (0 != rc) {
+        BALL_LOG_WARN << partitionDesc() << "Failed to enqueue the clean up "
+                      << "of archived files, rc: " << rc << ".";
+    }
 
     BALL_LOG_INFO_BLOCK
     {
@@ -2887,6 +3318,7 @@ int FileStore::rolloverIfNeeded(FileType::Enum              fileType,
     }
 
     if (!needRollover(file, currentSize, requestedSpace)) {
+        prepareNextFileSetIfNeeded(file, currentSize);
         return rc_SUCCESS;  // RETURN
     }
 
@@ -3819,6 +4251,9 @@ int FileStore::issueSyncPointInternal(SyncPointType::Enum type,
         d_config.partitionId(),
         fs->d_outstandingBytesData,
         fs->d_outstandingBytesJournal);
+    reportHugePageBytes();
+    checkpointRecoveryIndexIfNeeded();
+    compactIfNeeded();
 
     return rc_SUCCESS;
 }
@@ -3876,7 +4311,32 @@ void FileStore::processReceiptEvent(unsigned int         primaryLeaseId,
         return;  // RETURN
     }
 
+    // Report how far behind the primary the replica is: the slowest replica
+    // of the partition gives the maximum over the report interval.
+    if (primaryLeaseId == d_primaryLeaseId) {
+        d_clusterStats_p->onPartitionEvent(
+            mqbstat::ClusterStats::PartitionEventType::
+                e_PARTITION_REPLICA_LAG_RECORDS,
+            d_config.partitionId(),
+            d_sequenceNum - sequenceNumber);
+    }
+
+    const bsls::Types::Uint64 receiptedOffset =
+        to->second.d_handle->second.d_recordOffset;
+    const bsls::Types::Uint64 journalOffset =
+        d_fileSets[0]->d_journalFilePosition;
+    if (receiptedOffset <= journalOffset) {
+        // Otherwise, the journal rolled over since the receipted record was
+        // written.
+        d_clusterStats_p->onPartitionEvent(
+            mqbstat::ClusterStats::PartitionEventType::
+                e_PARTITION_REPLICA_LAG_BYTES,
+            d_config.partitionId(),
+            journalOffset - receiptedOffset);
+    }
+
     // everything in [from, to] is Receipt'ed
+    const bsls::Types::Int64         now = mwcsys::Time::highResolutionTimer();
     bool                             isEndOfRange = false;
     mqbu::StorageKey                 lastKey;
     bsl::unordered_set<mqbi::Queue*> affectedQueues(d_allocator_p);
@@ -3889,6 +4349,11 @@ void FileStore::processReceiptEvent(unsigned int         primaryLeaseId,
         }
         if (++(from->second.d_count) >= d_replicationFactor) {
             from->second.d_handle->second.d_hasReceipt = true;
+            d_clusterStats_p->onPartitionEvent(
+                mqbstat::ClusterStats::PartitionEventType::
+                    e_PARTITION_QUORUM_TIME,
+                d_config.partitionId(),
+                now - from->second.d_handle->second.d_arrivalTimepoint);
             // notify the queue
 
             const mqbu::StorageKey& queueKey  = from->second.d_queueKey;
@@ -4057,6 +4522,11 @@ int FileStore::writeMessageRecord(const bmqp::StorageHeader& header,
         FileStoreProtocol::k_JOURNAL_RECORD_SIZE);
     journalPos += FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
 
+    // Make the message durable before it is receipted to the primary.
+    if (isPersistentMemory(*activeFileSet)) {
+        persistMessage(*activeFileSet, dataOffset, messageSize, recordOffset);
+    }
+
     OffsetPtr<const MessageRecord> msgRec(journal.block(), recordOffset);
 
     // Check if the queueKey is known.  Ideally, this check should occur at the
@@ -4682,6 +5152,10 @@ int FileStore::writeJournalRecord(const bmqp::StorageHeader& header,
                     return 10 * rc + rc_ROLLOVER_FAILURE;  // RETURN
                 }
             }
+            else {
+                checkpointRecoveryIndexIfNeeded();
+                compactIfNeeded();
+            }
 
             // If self is stopping, update the flag which indicates that self
             // has received the "last" SyncPt from the primary, and self should
@@ -4867,14 +5341,15 @@ void FileStore::replicateRecord(bmqp::StorageMessageType::Enum type,
     }
 
     // Flush if the builder is 'full' or if immediate flush is requested.
-    flushIfNeeded(immediateFlush);
+    flushIfNeeded(immediateFlush, DataStoreRecordProfile::k_PARTITION_DEFAULT);
 }
 
 void FileStore::replicateRecord(bmqp::StorageMessageType::Enum type,
                                 int                            flags,
                                 bsls::Types::Uint64            journalOffset,
                                 bsls::Types::Uint64            dataOffset,
-                                unsigned int                   totalDataLen)
+                                unsigned int                   totalDataLen,
+                                int                            maxLatencyUs)
 {
     BSLS_ASSERT_SAFE(bmqp::StorageMessageType::e_DATA == type ||
                      bmqp::StorageMessageType::e_QLIST == type);
@@ -4969,16 +5444,17 @@ void FileStore::replicateRecord(bmqp::StorageMessageType::Enum type,
     }
 
     // Flush if the builder is 'full'.
-    flushIfNeeded(false);
+    flushIfNeeded(false, maxLatencyUs);
 }
 
 void FileStore::deleteArchiveFilesCb()
 {
-    // executed by the scheduler's *DISPATCHER* thread
+    // executed by *ANY* thread of the misc work thread pool
 
     FileStoreUtil::deleteArchiveFiles(d_config.partitionId(),
                                       d_config.archiveLocation(),
                                       d_config.maxArchivedFileSets(),
+                                      d_config.tierLocation(),
                                       d_config.clusterName());
 }
 
@@ -5046,6 +5522,49 @@ void FileStore::replicateAndInsertDataStoreRecord(
 }
 
 // PRIVATE ACCESSORS
+void FileStore::loadRecoveryIndexCheckpoint(
+    RecoveryIndex* recoveryIndex) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(recoveryIndex);
+    BSLS_ASSERT_SAFE(!d_fileSets.empty());
+
+    const FileSet* activeFileSet = d_fileSets[0].get();
+    BSLS_ASSERT_SAFE(activeFileSet);
+
+    const bsls::Types::Uint64 position = activeFileSet->d_journalFilePosition;
+    BSLS_ASSERT_SAFE(position >= FileStoreProtocol::k_JOURNAL_RECORD_SIZE);
+
+    OffsetPtr<const RecordHeader> lastRecord(
+        activeFileSet->d_journalFile.block(),
+        position - FileStoreProtocol::k_JOURNAL_RECORD_SIZE);
+
+    bsl::string leaf;
+    bdls::PathUtil::getLeaf(&leaf, activeFileSet->d_journalFileName);
+
+    recoveryIndex->setJournalFileName(leaf)
+        .setJournalPosition(position)
+        .setPrimaryLeaseId(lastRecord->primaryLeaseId())
+        .setSequenceNumber(lastRecord->sequenceNumber());
+
+    // The live records of the active journal are the outstanding records and
+    // the sync points, which is also what a rollover retains.
+
+    RecoveryIndex::RecordOffsets& offsets = recoveryIndex->recordOffsets();
+    offsets.reserve(d_records.size() + d_syncPoints.size());
+    for (RecordConstIterator cit = d_records.begin(); cit != d_records.end();
+         ++cit) {
+        offsets.push_back(cit->second.d_recordOffset);
+    }
+    for (SyncPointOffsetConstIter cit = d_syncPoints.begin();
+         cit != d_syncPoints.end();
+         ++cit) {
+        offsets.push_back(cit->offset());
+    }
+    bsl::sort(offsets.begin(), offsets.end());
+    offsets.erase(bsl::unique(offsets.begin(), offsets.end()), offsets.end());
+}
+
 void FileStore::aliasMessage(bsl::shared_ptr<bdlbb::Blob>* appData,
                              bsl::shared_ptr<bdlbb::Blob>* options,
                              const DataStoreRecord&        record) const
@@ -5090,13 +5609,104 @@ void FileStore::aliasMessage(bsl::shared_ptr<bdlbb::Blob>* appData,
 
     *appData = d_blobSpPool_p->getObject();
     (*appData)->appendDataBuffer(appDataBlobBuffer);
+
+    readAhead(activeFileSet,
+              record.d_messageOffset,
+              appDataOffset + record.d_appDataUnpaddedLen);
 }
 
-void FileStore::flushIfNeeded(bool immediateFlush)
+void FileStore::readAhead(FileSet*            fileSet,
+                          bsls::Types::Uint64 messageOffset,
+                          bsls::Types::Uint64 messageEnd) const
 {
-    if (immediateFlush ||
+    const bsls::Types::Uint64 maxSize = d_config.readAheadMaxBytes();
+    if (0 == maxSize) {
+        return;  // RETURN
+    }
+
+    const bsls::Types::Uint64 position = fileSet->d_dataFileReadAheadPosition;
+    const bsls::Types::Uint64 size     = fileSet->d_dataFileReadAheadSize;
+
+    bsls::Types::Uint64 begin;
+    bsls::Types::Uint64 length;
+    if (position - size <= messageOffset && messageOffset < position) {
+        // The message is within the last region: read the next region once
+        // half of the last one has been consumed.
+        if (messageEnd + size / 2 < position) {
+            return;  // RETURN
+        }
+
+        begin  = position;
+        length = bsl::min(2 * size, maxSize);
+    }
+    else {
+        begin  = messageEnd;
+        length = bsl::min(k_READ_AHEAD_MIN_SIZE, maxSize);
+    }
+
+    if (begin + length > fileSet->d_dataFilePosition) {
+        // Messages close to the write position are still in the page cache,
+        // and reading ahead of them would issue a system call per message.
+        return;  // RETURN
+    }
+
+    mwcu::MemOutStream errorDesc;
+    const int          rc = FileSystemUtil::readAhead(fileSet->d_dataFile,
+                                             begin,
+                                             length,
+                                             errorDesc);
+    if (0 != rc) {
+        BALL_LOG_WARN << partitionDesc() << "Failed to read ahead data file ["
+                      << fileSet->d_dataFileName
+                      << "], error: " << errorDesc.str();
+    }
+
+    // Even on failure, so that the next read ahead does not retry the same
+    // region.
+    fileSet->d_dataFileReadAheadPosition = begin + length;
+    fileSet->d_dataFileReadAheadSize     = length;
+}
+
+void FileStore::flushIfNeeded(bool immediateFlush, int maxLatencyUs)
+{
+    if (immediateFlush || 0 == maxLatencyUs ||
         d_storageEventBuilder.messageCount() >= d_nagglePacketCount) {
         dispatcherFlush(true, false);
+        return;  // RETURN
+    }
+
+    const int maxBytes = d_config.replicationBatchMaxBytes();
+    if (maxBytes > 0 && d_storageEventBuilder.eventSize() >= maxBytes) {
+        dispatcherFlush(true, false);
+        return;  // RETURN
+    }
+
+    if (DataStoreRecordProfile::k_PARTITION_DEFAULT == maxLatencyUs) {
+        maxLatencyUs = d_config.replicationBatchMaxLatencyUs();
+    }
+
+    if (d_storageEventBuilder.messageCount() == 1) {
+        // First message of the batch.
+        d_replicationBatchDeadline = k_NO_REPLICATION_DEADLINE;
+    }
+
+    if (maxLatencyUs <= 0 &&
+        k_NO_REPLICATION_DEADLINE == d_replicationBatchDeadline) {
+        // Neither this message nor the previous ones of the batch bound its
+        // latency.
+        return;  // RETURN
+    }
+
+    const bsls::Types::Int64 now = mwcsys::Time::highResolutionTimer();
+    if (now >= d_replicationBatchDeadline) {
+        dispatcherFlush(true, false);
+        return;  // RETURN
+    }
+
+    if (maxLatencyUs > 0) {
+        d_replicationBatchDeadline = bsl::min(
+            d_replicationBatchDeadline,
+            now + maxLatencyUs * bdlt::TimeUnitRatio::k_NS_PER_US);
     }
 }
 
@@ -5145,21 +5755,67 @@ FileStore::FileStore(const DataStoreConfig&  config,
 , d_sequenceNum(0)
 , d_syncPoints(allocator)
 , d_storages(allocator)
+, d_expiryIndex(allocator)
+, d_expiryIndexPositions(allocator)
+, d_dueStorages(allocator)
 , d_isCSLModeEnabled(isCSLModeEnabled)
 , d_isFSMWorkflow(isFSMWorkflow)
 , d_ignoreCrc32c(false)
 , d_nagglePacketCount(k_NAGLE_PACKET_COUNT)
+, d_replicationBatchDeadline(k_NO_REPLICATION_DEADLINE)
+, d_summarySnapshot()
+, d_pendingReceiptNode_p(0)
+, d_pendingReceiptKey()
+, d_numPendingReceipts(0)
+, d_syncThreadPool_mp()
+, d_groupCommitEventHandle()
+, d_groupCommitFileSets(allocator)
+, d_groupCommitKey()
+, d_groupCommitDeadline()
+, d_groupCommitBytes(0)
+, d_syncedKey()
+, d_isGroupCommitInProgress(false)
+, d_nextFileSetLocation(config.location(), allocator)
+, d_nextFileSet_sp()
+, d_isPreparingNextFileSet(false)
+, d_lastHugePageReportTime(0)
+, d_recoveryIndexFileName(config.location(), allocator)
+, d_lastRecoveryIndexTime(0)
+, d_isSavingRecoveryIndex(false)
+, d_recoveryIndexLock()
+, d_isRecoveryIndexFinal(false)
+, d_lastCompactionTime(0)
+, d_pendingHoles(allocator)
+, d_pendingHolesDataFileName(allocator)
 {
     // PRECONDITIONS
     BSLS_ASSERT(allocator);
     BSLS_ASSERT(d_cluster_p);
     BSLS_ASSERT(1 <= clusterSize());
 
+    if (0 < d_config.groupCommitWindowUs()) {
+        // A single thread, as group commits of a partition are serialized.
+        d_syncThreadPool_mp.load(new (*allocator)
+                                     bdlmt::FixedThreadPool(1, 16, allocator),
+                                 allocator);
+    }
+
     mwcu::MemOutStream os;
     os << "PartitionId [" << d_config.partitionId()
        << "] (cluster: " << d_cluster_p->name() << "): ";
     d_partitionDescription.assign(os.str().data(), os.str().length());
 
+    bdls::PathUtil::appendRaw(&d_nextFileSetLocation,
+                              k_NEXT_FILE_SET_DIRECTORY);
+
+    mwcu::MemOutStream indexFileName;
+    indexFileName << "bmq_" << config.partitionId() << ".index";
+    bdls::PathUtil::appendRaw(&d_recoveryIndexFileName,
+                              k_RECOVERY_INDEX_DIRECTORY);
+    bdls::PathUtil::appendRaw(&d_recoveryIndexFileName,
+                              indexFileName.str().data(),
+                              indexFileName.str().length());
+
     dispatcher->registerClient(this,
                                mqbi::DispatcherClientType::e_QUEUE,
                                processorId);
@@ -5197,6 +5853,12 @@ int FileStore::open(const QueueKeyInfoMap& queueKeyInfoMap)
         return rc_SUCCESS;  // RETURN
     }
 
+    // Remove any file set prepared for rollover during a previous run, as it
+    // was never used.
+    if (bdls::FilesystemUtil::exists(d_nextFileSetLocation)) {
+        bdls::FilesystemUtil::remove(d_nextFileSetLocation, true);
+    }
+
     mwcu::MemOutStream errorDescription;
     int rc = openInRecoveryMode(errorDescription, queueKeyInfoMap);
     if (rc == 0) {
@@ -5228,6 +5890,16 @@ int FileStore::open(const QueueKeyInfoMap& queueKeyInfoMap)
 
     BSLS_ASSERT_SAFE(d_isOpen);
 
+    if (d_syncThreadPool_mp && !d_syncThreadPool_mp->isStarted()) {
+        rc = d_syncThreadPool_mp->start();
+        if (0 != rc) {
+            // Not fatal: messages will be acknowledged without group commit.
+            BALL_LOG_ERROR << partitionDesc() << "Failed to start the group "
+                           << "commit thread, rc: " << rc;
+            d_syncThreadPool_mp.reset();
+        }
+    }
+
     // Report cluster's partition stats
     d_clusterStats_p->setPartitionOutstandingBytes(
         d_config.partitionId(),
@@ -5243,6 +5915,10 @@ void FileStore::close(bool flush)
         return;  // RETURN
     }
 
+    // A partition closed at shutdown checkpoints its recovery index, so that
+    // the next broker process, e.g., an upgraded one, recovers it quickly.
+    const bool isShutdown = d_isStopping;
+
     d_isOpen             = false;
     d_isStopping         = false;
     d_lastSyncPtReceived = false;
@@ -5250,10 +5926,27 @@ void FileStore::close(bool flush)
     d_config.scheduler()->cancelEventAndWait(&d_syncPointEventHandle);
     d_config.scheduler()->cancelEventAndWait(
         &d_partitionHighwatermarkEventHandle);
+    d_config.scheduler()->cancelEventAndWait(&d_groupCommitEventHandle);
     // Ok to ignore rc above
 
+    if (d_syncThreadPool_mp) {
+        // Wait for the group commit in progress, if any, to complete before
+        // closing the files.  Its completion is then ignored.
+        d_syncThreadPool_mp->drain();
+    }
+    d_groupCommitFileSets.clear();
+    d_groupCommitBytes        = 0;
+    d_isGroupCommitInProgress = false;
+
+    // A file set being prepared, if any, is discarded once prepared.
+    discardNextFileSet();
+
     BALL_LOG_INFO << partitionDesc() << "Closing partition. ";
 
+    if (isShutdown) {
+        saveFinalRecoveryIndex();
+    }
+
     // Clear 'd_records' so that gc logic is invoked on all mapped data files.
     // Note that logic will be invoked in this thread.  Note that data file of
     // active file set will not be gc'd because its alias blob buffer count
@@ -5295,17 +5988,47 @@ void FileStore::createStorage(bsl::shared_ptr<ReplicatedStorage>* storageSp,
     }
 
     bslma::Allocator* storageAlloc = d_storageAllocatorStore.baseAllocator();
+    if (d_config.storageEngine()) {
+        StorageEngine*     engine = d_config.storageEngine();
+        mwcu::MemOutStream errorDesc;
+        const int          rc = engine->createStorage(
+            storageSp,
+            errorDesc,
+            this,
+            queueUri,
+            queueKey,
+            domain->config(),
+            domain->capacityMeter(),
+            rdaInfo,
+            storageAlloc,
+            &d_storageAllocatorStore);
+        if (0 == rc) {
+            return;  // RETURN
+        }
+
+        // Fall back to the storages of the data store, so that the queue is
+        // still usable, and consistent with the replicas of the partition.
+        MWCTSK_ALARMLOG_ALARM("STORAGE")
+            << partitionDesc() << "Storage engine '" << engine->name()
+            << "' failed to create the storage of queue '" << queueUri
+            << "' [queueKey: " << queueKey << "], rc: " << rc
+            << ", error: '" << errorDesc.str()
+            << "'. Using the storage of the partition instead."
+            << MWCTSK_ALARMLOG_END;
+    }
+
     if (storageCfg.isInMemoryValue()) {
-        storageSp->reset(new (*storageAlloc)
-                             InMemoryStorage(queueUri,
-                                             queueKey,
-                                             config().partitionId(),
-                                             domain->config(),
-                                             domain->capacityMeter(),
-                                             rdaInfo,
-                                             storageAlloc,
-                                             &d_storageAllocatorStore),
-                         storageAlloc);
+        InMemoryStorage* storage = new (*storageAlloc)
+            InMemoryStorage(queueUri,
+                            queueKey,
+                            config().partitionId(),
+                            domain->config(),
+                            domain->capacityMeter(),
+                            rdaInfo,
+                            storageAlloc,
+                            &d_storageAllocatorStore);
+        storage->setSpillLocation(d_config.spillLocation());
+        storageSp->reset(storage, storageAlloc);
     }
     else if (storageCfg.isFileBackedValue()) {
         storageSp->reset(new (*storageAlloc)
@@ -5329,7 +6052,8 @@ int FileStore::writeMessageRecord(mqbi::StorageMessageAttributes* attributes,
                                   const bmqt::MessageGUID&        guid,
                                   const bsl::shared_ptr<bdlbb::Blob>& appData,
                                   const bsl::shared_ptr<bdlbb::Blob>& options,
-                                  const mqbu::StorageKey&             queueKey)
+                                  const mqbu::StorageKey&             queueKey,
+                                  const DataStoreRecordProfile&       profile)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(handle);
@@ -5412,8 +6136,15 @@ int FileStore::writeMessageRecord(mqbi::StorageMessageAttributes* attributes,
 
     // If 'd_replicationFactor' is 1, then the message need not be persisted to
     // any replicas (i.e. eventual consistency). Therefore the writing of the
-    // message by this node is sufficient to set the receipt.
-    if (1 == d_replicationFactor && !attributes->hasReceipt()) {
+    // message by this node is sufficient to set the receipt, unless it also
+    // needs to be synced to disk by a group commit, which the profile of the
+    // message may opt out of, and which is not needed on persistent memory
+    // where the message is made durable as soon as it is written.
+    const bool isPersistent  = isPersistentMemory(*d_fileSets[0]);
+    const bool isGroupCommit = isGroupCommitEnabled() && !isPersistent &&
+                               0 != profile.groupCommitWindowUs();
+    if (1 == d_replicationFactor && !attributes->hasReceipt() &&
+        !isGroupCommit) {
         attributes->setReceipt(true);
     }
 
@@ -5490,6 +6221,10 @@ int FileStore::writeMessageRecord(mqbi::StorageMessageAttributes* attributes,
         .setMagic(RecordHeader::k_MAGIC);
     journalPos += FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
 
+    if (isPersistent) {
+        persistMessage(*activeFileSet, dataOffset, totalLength, journalOffset);
+    }
+
     DataStoreRecordKey key(d_sequenceNum, d_primaryLeaseId);
     DataStoreRecord    record(RecordType::e_MESSAGE, journalOffset);
     record.d_messageOffset      = dataOffset;
@@ -5512,9 +6247,22 @@ int FileStore::writeMessageRecord(mqbi::StorageMessageAttributes* attributes,
                            ReceiptContext(queueKey,
                                           guid,
                                           recordIt,
-                                          1,  // receipt count
+                                          isGroupCommit ? 0 : 1,
+                                          // receipt count, self node is
+                                          // counted once synced if group
+                                          // commit is enabled
+                                          isGroupCommit,
                                           attributes->queueHandle())));
         flags = bmqp::StorageHeaderFlags::e_RECEIPT_REQUESTED;
+
+        if (isGroupCommit) {
+            addToGroupCommit(
+                key,
+                totalLength + FileStoreProtocol::k_JOURNAL_RECORD_SIZE,
+                profile.groupCommitWindowUs() > 0
+                    ? profile.groupCommitWindowUs()
+                    : d_config.groupCommitWindowUs());
+        }
     }
 
     // Replicate the message.
@@ -5522,7 +6270,8 @@ int FileStore::writeMessageRecord(mqbi::StorageMessageAttributes* attributes,
                     flags,
                     journalOffset,
                     dataOffset,
-                    totalLength);
+                    totalLength,
+                    profile.replicationBatchMaxLatencyUs());
 
     // Update outstanding JOURNAL and DATA bytes.
     activeFileSet->d_outstandingBytesJournal +=
@@ -6027,6 +6776,27 @@ int FileStore::removeRecord(const DataStoreRecordHandle& handle)
     return rc_SUCCESS;
 }
 
+void FileStore::onStorageExpiryChanged(const mqbu::StorageKey& queueKey)
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+
+    if (d_expiryIndexPositions.end() ==
+        d_expiryIndexPositions.find(queueKey)) {
+        // Storage is not registered with this partition yet, in which case
+        // its registration schedules an immediate check.
+
+        return;  // RETURN
+    }
+
+    // Visit the storage at the next GC, which computes its next expiry with
+    // the current TTL.
+
+    scheduleExpiryCheck(queueKey, 0);
+}
+
 void FileStore::removeRecordRaw(const DataStoreRecordHandle& handle)
 {
     BSLS_ASSERT_SAFE(handle.isValid());
@@ -6138,9 +6908,9 @@ void FileStore::processStorageEvent(const bsl::shared_ptr<bdlbb::Blob>& blob,
             if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 == rc)) {
                 if (header.flags() &
                     bmqp::StorageHeaderFlags::e_RECEIPT_REQUESTED) {
-                    issueReceipt(source,
-                                 recHeader->primaryLeaseId(),
-                                 recHeader->sequenceNumber());
+                    bufferReceipt(source,
+                                  recHeader->primaryLeaseId(),
+                                  recHeader->sequenceNumber());
                 }
             }
         }
@@ -6356,42 +7126,902 @@ int FileStore::processRecoveryEvent(const bsl::shared_ptr<bdlbb::Blob>& blob)
     return rc_SUCCESS;
 }
 
-void FileStore::issueReceipt(mqbnet::ClusterNode* node,
-                             unsigned int         primaryLeaseId,
-                             bsls::Types::Uint64  sequenceNumber)
+int FileStore::writeToNextReplicationHop(const bdlbb::Blob& blob)
 {
-    const int                     nodeId = node->nodeId();
-    NodeReceiptContexts::iterator itNode = d_nodes.find(nodeId);
-    const DataStoreRecordKey      key(sequenceNumber, primaryLeaseId);
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_isPrimary);
+    BSLS_ASSERT_SAFE(d_config.hasChainReplication());
 
-    if (itNode == d_nodes.end()) {
-        // no prior history about this node
-        itNode =
-            d_nodes
-                .insert(bsl::make_pair(
-                    nodeId,
-                    NodeContext(d_config.bufferFactory(), key, d_allocator_p)))
-                .first;
+    // A replica which cannot be written to is skipped, and the event written
+    // to the replica after it in the chain, which relays it further.
+
+    int numItems = 0;
+    if (0 == StorageUtil::writeToReplicationChain(&numItems,
+                                                  d_cluster_p,
+                                                  d_config.nodeId(),
+                                                  blob)) {
+        // No replica is currently available.
+
+        return 0;  // RETURN
     }
-    else if (itNode->second.d_key < key) {
-        itNode->second.d_key = key;
+
+    return numItems;
+}
+
+void FileStore::bufferReceipt(mqbnet::ClusterNode* node,
+                              unsigned int         primaryLeaseId,
+                              bsls::Types::Uint64  sequenceNumber)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(node);
+
+    if (d_pendingReceiptNode_p && d_pendingReceiptNode_p != node) {
+        // Primary has changed, confirm what was received from the previous
+        // one first.
+
+        flushPendingReceipt();
     }
-    else {
-        // outdated receipt
+
+    d_pendingReceiptNode_p = node;
+    d_pendingReceiptKey = DataStoreRecordKey(sequenceNumber, primaryLeaseId);
+
+    if (++d_numPendingReceipts >= k_MAX_COALESCED_RECEIPTS) {
+        flushPendingReceipt();
+    }
+}
+
+void FileStore::flushPendingReceipt()
+{
+    if (0 == d_pendingReceiptNode_p) {
         return;  // RETURN
     }
-    NodeContext& nodeContext = itNode->second;
 
-    if (nodeContext.d_state && nodeContext.d_state->tryLock()) {
-        char*                     buffer = nodeContext.d_blob.buffer(0).data();
-        bmqp::ReplicationReceipt* receipt =
-            reinterpret_cast<bmqp::ReplicationReceipt*>(
-                buffer + sizeof(bmqp::EventHeader));
+    // Receipts are cumulative: the primary considers all the messages up to
+    // the one being confirmed as received by this node.
 
-        // Overwrite Receipt sequence number
-        (*receipt)
-            .setPrimaryLeaseId(primaryLeaseId)
-            .setSequenceNum(sequenceNumber);
+    issueReceipt(d_pendingReceiptNode_p,
+                 d_pendingReceiptKey.d_primaryLeaseId,
+                 d_pendingReceiptKey.d_sequenceNum);
+
+    d_pendingReceiptNode_p = 0;
+    d_numPendingReceipts   = 0;
+}
+
+bool FileStore::isGroupCommitEnabled() const
+{
+    return d_syncThreadPool_mp && d_syncThreadPool_mp->isStarted();
+}
+
+bool FileStore::isPersistentMemory(const FileSet& fileSet)
+{
+    return fileSet.d_dataFile.isPersistentMemory() &&
+           fileSet.d_journalFile.isPersistentMemory();
+}
+
+void FileStore::persistMessage(const FileSet&      fileSet,
+                               bsls::Types::Uint64 dataOffset,
+                               bsls::Types::Uint64 dataLength,
+                               bsls::Types::Uint64 journalOffset)
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isPersistentMemory(fileSet));
+
+    mwcu::MemOutStream errorDesc;
+    if (0 != FileSystemUtil::persist(fileSet.d_dataFile,
+                                     dataOffset,
+                                     dataLength,
+                                     errorDesc) ||
+        0 != FileSystemUtil::persist(fileSet.d_journalFile,
+                                     journalOffset,
+                                     FileStoreProtocol::k_JOURNAL_RECORD_SIZE,
+                                     errorDesc)) {
+        MWCTSK_ALARMLOG_ALARM("FILE_IO")
+            << partitionDesc() << "Failed to persist message at offset "
+            << dataOffset << " of file set [" << fileSet.d_journalFileName
+            << "], error: " << errorDesc.str() << MWCTSK_ALARMLOG_END;
+    }
+}
+
+void FileStore::addToGroupCommit(const DataStoreRecordKey& key,
+                                 bsls::Types::Uint64       length,
+                                 int                       windowUs)
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isGroupCommitEnabled());
+    BSLS_ASSERT_SAFE(0 < d_fileSets.size());
+
+    // Note that the file sets of a failed group commit being retried are
+    // pending, in which case the retry is already scheduled.
+    const bool isFirst = d_groupCommitFileSets.empty();
+    if (isFirst || d_groupCommitFileSets.back() != d_fileSets[0]) {
+        d_groupCommitFileSets.push_back(d_fileSets[0]);
+    }
+
+    d_groupCommitKey = key;
+    d_groupCommitBytes += length;
+
+    if (d_isGroupCommitInProgress) {
+        // The next group commit is started when this one completes.
+        return;  // RETURN
+    }
+
+    if (d_groupCommitBytes >=
+        static_cast<bsls::Types::Uint64>(d_config.groupCommitMaxBytes())) {
+        startGroupCommit();
+        return;  // RETURN
+    }
+
+    bsls::TimeInterval when = mwcsys::Time::nowMonotonicClock();
+    when.addMicroseconds(windowUs);
+    if (isFirst) {
+        d_groupCommitDeadline = when;
+        d_config.scheduler()->scheduleEvent(
+            &d_groupCommitEventHandle,
+            when,
+            bdlf::BindUtil::bind(&FileStore::groupCommitWindowCb, this));
+    }
+    else if (when < d_groupCommitDeadline) {
+        // The window of this message ends before the one of the previous
+        // messages of the group commit.  Note that rescheduling fails if the
+        // event is being dispatched, in which case the group commit starts
+        // anyway.
+        d_groupCommitDeadline = when;
+        d_config.scheduler()->rescheduleEvent(d_groupCommitEventHandle, when);
+    }
+}
+
+void FileStore::groupCommitWindowCb()
+{
+    // executed by the *SCHEDULER* thread
+
+    if (!d_isOpen) {
+        return;  // RETURN
+    }
+
+    execute(bdlf::BindUtil::bind(&FileStore::startGroupCommit, this));
+}
+
+void FileStore::startGroupCommit()
+{
+    // executed by the *DISPATCHER* thread
+
+    if (d_isGroupCommitInProgress || d_groupCommitFileSets.empty() ||
+        !d_isOpen) {
+        return;  // RETURN
+    }
+
+    d_config.scheduler()->cancelEvent(&d_groupCommitEventHandle);
+
+    bsl::vector<FileSetSp> fileSets(d_allocator_p);
+    fileSets.swap(d_groupCommitFileSets);
+    d_groupCommitBytes        = 0;
+    d_isGroupCommitInProgress = true;
+
+    int rc = d_syncThreadPool_mp->enqueueJob(
+        bdlf::BindUtil::bind(&FileStore::groupCommitWorker,
+                             this,
+                             fileSets,
+                             d_groupCommitKey));
+    BSLS_ASSERT_SAFE(rc == 0);
+    (void)rc;  // Compiler happiness
+}
+
+void FileStore::groupCommitWorker(const bsl::vector<FileSetSp>& fileSets,
+                                  const DataStoreRecordKey&     key)
+{
+    // executed by the *SYNC* thread
+
+    mwcu::MemOutStream errorDesc;
+    int                status = 0;
+    for (unsigned int i = 0; i < fileSets.size(); ++i) {
+        const FileSet& fileSet = *fileSets[i];
+        if (0 != FileSystemUtil::syncData(fileSet.d_dataFile, errorDesc) ||
+            0 != FileSystemUtil::syncData(fileSet.d_journalFile, errorDesc)) {
+            MWCTSK_ALARMLOG_ALARM("FILE_IO")
+                << partitionDesc() << "Failed to sync file set ["
+                << fileSet.d_journalFileName << "] for group commit, error: "
+                << errorDesc.str() << MWCTSK_ALARMLOG_END;
+            errorDesc.reset();
+            status = -1;
+        }
+    }
+
+    execute(bdlf::BindUtil::bind(&FileStore::onGroupCommitDone,
+                                 this,
+                                 fileSets,
+                                 key,
+                                 status));
+}
+
+void FileStore::onGroupCommitDone(const bsl::vector<FileSetSp>& fileSets,
+                                  const DataStoreRecordKey&     key,
+                                  int                           status)
+{
+    // executed by the *DISPATCHER* thread
+
+    if (!d_isGroupCommitInProgress) {
+        // The file store was closed while the group commit was in progress.
+        return;  // RETURN
+    }
+
+    d_isGroupCommitInProgress = false;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 != status)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // The failure has been alarmed.  The records up to 'key' are not
+        // known to be durable, so the local receipt is not counted for them,
+        // which would acknowledge them, and the sync of their file sets is
+        // retried, along with the ones written to since, after a while.
+        bsl::vector<FileSetSp> retried(fileSets, d_allocator_p);
+        for (unsigned int i = 0; i < d_groupCommitFileSets.size(); ++i) {
+            if (retried.empty() ||
+                retried.back() != d_groupCommitFileSets[i]) {
+                retried.push_back(d_groupCommitFileSets[i]);
+            }
+        }
+        d_groupCommitFileSets.swap(retried);
+
+        bsls::TimeInterval when = mwcsys::Time::nowMonotonicClock();
+        when.addMilliseconds(k_GROUP_COMMIT_RETRY_INTERVAL_MS);
+        d_groupCommitDeadline = when;
+        d_config.scheduler()->scheduleEvent(
+            &d_groupCommitEventHandle,
+            when,
+            bdlf::BindUtil::bind(&FileStore::groupCommitWindowCb, this));
+        return;  // RETURN
+    }
+
+    if (d_isPrimary) {
+        // Everything in the unreceipted records after 'd_syncedKey' and up to
+        // 'key' is synced.  Note that records are inserted in increasing key
+        // order by the primary.
+
+        Unreceipted::iterator it = d_unreceipted.find(d_syncedKey);
+        it = it == d_unreceipted.end() ? d_unreceipted.begin() : ++it;
+
+        const bsls::Types::Int64 now = mwcsys::Time::highResolutionTimer();
+        mqbu::StorageKey         lastKey;
+        bsl::unordered_set<mqbi::Queue*> affectedQueues(d_allocator_p);
+        mqbi::Queue*                     lastQueue = 0;
+
+        while (it != d_unreceipted.end() && !(key < it->first)) {
+            if (!(d_syncedKey < it->first) || !it->second.d_awaitsSync) {
+                // Already counted by a previous group commit, or counted when
+                // written.
+                ++it;
+                continue;  // CONTINUE
+            }
+            if (++(it->second.d_count) >= d_replicationFactor) {
+                it->second.d_handle->second.d_hasReceipt = true;
+                d_clusterStats_p->onPartitionEvent(
+                    mqbstat::ClusterStats::PartitionEventType::
+                        e_PARTITION_QUORUM_TIME,
+                    d_config.partitionId(),
+                    now - it->second.d_handle->second.d_arrivalTimepoint);
+                // notify the queue
+
+                const mqbu::StorageKey& queueKey  = it->second.d_queueKey;
+                bool                    haveQueue = (queueKey == lastKey);
+                if (!haveQueue) {
+                    StorageMapIter sit = d_storages.find(queueKey);
+                    if (sit != d_storages.end()) {
+                        haveQueue = true;
+                        lastKey   = queueKey;
+                        lastQueue = sit->second->queue();
+                        BSLS_ASSERT_SAFE(lastQueue);
+
+                        affectedQueues.insert(lastQueue);
+                    }
+                    // else the queue and its storage are gone
+                }
+                if (haveQueue) {
+                    lastQueue->onReceipt(
+                        it->second.d_guid,
+                        it->second.d_qH,
+                        it->second.d_handle->second.d_arrivalTimepoint);
+                }  // else the queue is gone
+                it = d_unreceipted.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+        for (bsl::unordered_set<mqbi::Queue*>::iterator qit =
+                 affectedQueues.begin();
+             qit != affectedQueues.end();
+             ++qit) {
+            (*qit)->queueEngine()->afterNewMessage(bmqt::MessageGUID(), 0);
+        }
+    }
+    d_syncedKey = key;
+
+    // Records written while this group commit was in progress have waited
+    // long enough.
+    startGroupCommit();
+}
+
+void FileStore::prepareNextFileSetIfNeeded(const MappedFileDescriptor& file,
+                                           bsls::Types::Uint64 currentSize)
+{
+    if (d_nextFileSet_sp || d_isPreparingNextFileSet ||
+        currentSize * 100 <
+            file.fileSize() * k_PREPARE_NEXT_FILE_SET_PERCENT) {
+        return;  // RETURN
+    }
+
+    BALL_LOG_INFO << partitionDesc() << "Preparing next file set in ["
+                  << d_nextFileSetLocation << "].";
+
+    d_isPreparingNextFileSet = true;
+    int rc                   = d_miscWorkThreadPool_p->enqueueJob(
+        bdlf::BindUtil::bind(&FileStore::prepareNextFileSetWorker, this));
+    BSLS_ASSERT_SAFE(rc == 0);
+    (void)rc;  // Compiler happiness
+}
+
+void FileStore::prepareNextFileSetWorker()
+{
+    // executed by a *WORKER* thread
+
+    FileSetSp fileSetSp;
+    int       rc = bdls::FilesystemUtil::createDirectories(
+        d_nextFileSetLocation,
+        true);  // isLeafDirectory
+    if (0 != rc) {
+        BALL_LOG_WARN << partitionDesc() << "Failed to create directory ["
+                      << d_nextFileSetLocation << "] for the next file set, "
+                      << "rc: " << rc;
+    }
+    else {
+        // Prefault the pages of the prepared files, as this is done off the
+        // partition dispatcher thread.
+        DataStoreConfig config(d_config);
+        config.setLocation(d_nextFileSetLocation).setPrefaultPages(true);
+
+        mwcu::MemOutStream errorDesc;
+        rc = FileStoreUtil::create(errorDesc,
+                                   &fileSetSp,
+                                   this,
+                                   d_config.partitionId(),
+                                   config,
+                                   partitionDesc(),
+                                   !d_isFSMWorkflow,
+                                   d_allocator_p);
+        if (0 != rc) {
+            BALL_LOG_WARN << partitionDesc() << "Failed to prepare the next "
+                          << "file set, rc: " << rc
+                          << ", error: " << errorDesc.str();
+            fileSetSp.reset();
+        }
+    }
+
+    execute(bdlf::BindUtil::bind(&FileStore::onNextFileSetPrepared,
+                                 this,
+                                 fileSetSp));
+}
+
+void FileStore::onNextFileSetPrepared(const FileSetSp& fileSet)
+{
+    // executed by the *DISPATCHER* thread
+
+    d_isPreparingNextFileSet = false;
+    d_nextFileSet_sp         = fileSet;
+
+    if (!d_isOpen) {
+        discardNextFileSet();
+    }
+}
+
+int FileStore::takeNextFileSet(FileSetSp* fileSetSp)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(fileSetSp);
+
+    enum { rc_SUCCESS = 0, rc_NO_FILE_SET = -1, rc_MOVE_FAILURE = -2 };
+
+    if (!d_nextFileSet_sp) {
+        return rc_NO_FILE_SET;  // RETURN
+    }
+
+    FileSet& fileSet = *d_nextFileSet_sp;
+
+    // Move the files to the partition location.  Moving the journal last
+    // ensures that recovery never finds a journal without its data file.
+    bsl::string* fileNames[3];
+    int          numFiles = 0;
+    fileNames[numFiles++] = &fileSet.d_dataFileName;
+    if (!d_isFSMWorkflow) {
+        fileNames[numFiles++] = &fileSet.d_qlistFileName;
+    }
+    fileNames[numFiles++] = &fileSet.d_journalFileName;
+
+    for (int i = 0; i < numFiles; ++i) {
+        bsl::string leaf;
+        bdls::PathUtil::getLeaf(&leaf, *fileNames[i]);
+        bsl::string newName(d_config.location());
+        bdls::PathUtil::appendRaw(&newName, leaf.c_str());
+
+        int rc = FileSystemUtil::move(*fileNames[i], d_config.location());
+        if (0 != rc) {
+            BALL_LOG_WARN << partitionDesc() << "Failed to move prepared "
+                          << "file [" << *fileNames[i] << "] to ["
+                          << d_config.location() << "], rc: " << rc;
+
+            // Files already moved are removed along with the others.
+            for (int j = 0; j < i; ++j) {
+                bsl::string leafJ;
+                bdls::PathUtil::getLeaf(&leafJ, *fileNames[j]);
+                bsl::string movedName(d_config.location());
+                bdls::PathUtil::appendRaw(&movedName, leafJ.c_str());
+                *fileNames[j] = movedName;
+            }
+            discardNextFileSet();
+            return rc_MOVE_FAILURE;  // RETURN
+        }
+        *fileNames[i] = newName;
+    }
+
+    BALL_LOG_INFO << partitionDesc() << "Using prepared file set ["
+                  << fileSet.d_dataFileName << "], ["
+                  << fileSet.d_journalFileName << "] for rollover.";
+
+    adviseHugePages(fileSet);
+
+    fileSetSp->swap(d_nextFileSet_sp);
+    d_nextFileSet_sp.reset();
+    return rc_SUCCESS;
+}
+
+void FileStore::discardNextFileSet()
+{
+    if (!d_nextFileSet_sp) {
+        return;  // RETURN
+    }
+
+    FileSet& fileSet = *d_nextFileSet_sp;
+    close(fileSet, false);  // flush
+    bdls::FilesystemUtil::remove(fileSet.d_journalFileName);
+    bdls::FilesystemUtil::remove(fileSet.d_dataFileName);
+    if (!d_isFSMWorkflow) {
+        bdls::FilesystemUtil::remove(fileSet.d_qlistFileName);
+    }
+    d_nextFileSet_sp.reset();
+}
+
+void FileStore::adviseHugePages(const FileSet& fileSet)
+{
+    if (!d_config.hasHugePages()) {
+        return;  // RETURN
+    }
+
+    const MappedFileDescriptor* files[] = {&fileSet.d_journalFile,
+                                           &fileSet.d_dataFile};
+    for (size_t i = 0; i < sizeof(files) / sizeof(files[0]); ++i) {
+        mwcu::MemOutStream errorDesc;
+        int rc = FileSystemUtil::adviseHugePages(*files[i], errorDesc);
+        if (0 != rc) {
+            BALL_LOG_WARN << partitionDesc() << "Failed to advise huge pages "
+                          << "for file set [" << fileSet.d_dataFileName
+                          << "], rc: " << rc << ", error: " << errorDesc.str();
+            return;  // RETURN
+        }
+    }
+
+    // Force a report for the new file set.
+    d_lastHugePageReportTime = 0;
+}
+
+void FileStore::reportHugePageBytes()
+{
+    if (!d_config.hasHugePages() || d_fileSets.empty()) {
+        return;  // RETURN
+    }
+
+    const bsls::Types::Int64 now = mwcsys::Time::highResolutionTimer();
+    if (0 != d_lastHugePageReportTime &&
+        now - d_lastHugePageReportTime < k_HUGE_PAGE_REPORT_INTERVAL_NS) {
+        return;  // RETURN
+    }
+    d_lastHugePageReportTime = now;
+
+    const FileSet*      activeFileSet = d_fileSets[0].get();
+    bsls::Types::Uint64 total         = 0;
+    bsls::Types::Uint64 size          = 0;
+    if (0 == FileSystemUtil::loadHugePageBackedSize(
+                 &size,
+                 activeFileSet->d_journalFile)) {
+        total += size;
+    }
+    if (0 == FileSystemUtil::loadHugePageBackedSize(
+                 &size,
+                 activeFileSet->d_dataFile)) {
+        total += size;
+    }
+
+    d_clusterStats_p->setPartitionHugePageBytes(
+        d_config.partitionId(),
+        static_cast<bsls::Types::Int64>(total));
+}
+
+int FileStore::loadRecoveryIndex(RecoveryIndex*             recoveryIndex,
+                                 const JournalFileIterator& jit,
+                                 const bsl::string&         journalFileName)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS          = 0,
+        rc_DISABLED         = -1,
+        rc_NOT_FOUND        = -2,
+        rc_LOAD_FAILURE     = -3,
+        rc_JOURNAL_MISMATCH = -4,
+        rc_INVALID_POSITION = -5,
+        rc_RECORD_MISMATCH  = -6,
+        rc_INVALID_OFFSET   = -7
+    };
+
+    if (0 >= d_config.recoveryIndexIntervalSec()) {
+        return rc_DISABLED;  // RETURN
+    }
+
+    if (!bdls::FilesystemUtil::exists(d_recoveryIndexFileName)) {
+        return rc_NOT_FOUND;  // RETURN
+    }
+
+    mwcu::MemOutStream errorDesc;
+    int rc = recoveryIndex->load(errorDesc, d_recoveryIndexFileName);
+    if (0 != rc) {
+        BALL_LOG_WARN << partitionDesc() << "Ignoring recovery index, rc: "
+                      << rc << ", error: " << errorDesc.str();
+        return 10 * rc + rc_LOAD_FAILURE;  // RETURN
+    }
+
+    bsl::string leaf;
+    bdls::PathUtil::getLeaf(&leaf, journalFileName);
+    if (leaf != recoveryIndex->journalFileName()) {
+        BALL_LOG_INFO << partitionDesc() << "Ignoring recovery index of "
+                      << "journal [" << recoveryIndex->journalFileName()
+                      << "], recovering journal [" << leaf << "].";
+        return rc_JOURNAL_MISMATCH;  // RETURN
+    }
+
+    // The checkpoint position must be right after a record of the journal.
+
+    const bsls::Types::Uint64 recordSize = jit.header().recordWords() *
+                                           bmqp::Protocol::k_WORD_SIZE;
+    const bsls::Types::Uint64 firstRecordPosition = jit.firstRecordPosition();
+    const bsls::Types::Uint64 position = recoveryIndex->journalPosition();
+    if (0 == recordSize || 0 == jit.lastRecordPosition() ||
+        position < firstRecordPosition + recordSize ||
+        position > jit.lastRecordPosition() + recordSize ||
+        0 != (position - firstRecordPosition) % recordSize) {
+        BALL_LOG_WARN << partitionDesc() << "Ignoring recovery index having "
+                      << "invalid position " << position << " in journal ["
+                      << leaf << "].";
+        return rc_INVALID_POSITION;  // RETURN
+    }
+
+    OffsetPtr<const RecordHeader> lastRecord(
+        jit.mappedFileDescriptor()->block(),
+        position - recordSize);
+    if (lastRecord->primaryLeaseId() != recoveryIndex->primaryLeaseId() ||
+        lastRecord->sequenceNumber() != recoveryIndex->sequenceNumber()) {
+        BALL_LOG_WARN << partitionDesc() << "Ignoring recovery index of "
+                      << "record (" << recoveryIndex->primaryLeaseId() << ", "
+                      << recoveryIndex->sequenceNumber() << "), found record ("
+                      << lastRecord->primaryLeaseId() << ", "
+                      << lastRecord->sequenceNumber() << ") at offset "
+                      << (position - recordSize) << " in journal [" << leaf
+                      << "].";
+        return rc_RECORD_MISMATCH;  // RETURN
+    }
+
+    const RecoveryIndex::RecordOffsets& offsets =
+        recoveryIndex->recordOffsets();
+    for (RecoveryIndex::RecordOffsets::const_iterator cit = offsets.begin();
+         cit != offsets.end();
+         ++cit) {
+        if (*cit < firstRecordPosition ||
+            0 != (*cit - firstRecordPosition) % recordSize) {
+            BALL_LOG_WARN << partitionDesc() << "Ignoring recovery index "
+                          << "having invalid record offset " << *cit
+                          << " in journal [" << leaf << "].";
+            return rc_INVALID_OFFSET;  // RETURN
+        }
+    }
+
+    return rc_SUCCESS;
+}
+
+void FileStore::checkpointRecoveryIndexIfNeeded()
+{
+    if (0 >= d_config.recoveryIndexIntervalSec() || d_isSavingRecoveryIndex ||
+        d_fileSets.empty()) {
+        return;  // RETURN
+    }
+
+    const bsls::Types::Int64 now = mwcsys::Time::highResolutionTimer();
+    if (0 != d_lastRecoveryIndexTime &&
+        now - d_lastRecoveryIndexTime <
+            d_config.recoveryIndexIntervalSec() *
+                bdlt::TimeUnitRatio::k_NANOSECONDS_PER_SECOND) {
+        return;  // RETURN
+    }
+
+    bsl::shared_ptr<RecoveryIndex> recoveryIndex;
+    recoveryIndex.createInplace(d_allocator_p, d_allocator_p);
+    loadRecoveryIndexCheckpoint(recoveryIndex.get());
+
+    d_lastRecoveryIndexTime = now;
+    d_isSavingRecoveryIndex = true;
+    int rc                  = d_miscWorkThreadPool_p->enqueueJob(
+        bdlf::BindUtil::bind(&FileStore::saveRecoveryIndexWorker,
+                             this,
+                             recoveryIndex));
+    BSLS_ASSERT_SAFE(rc == 0);
+    (void)rc;  // Compiler happiness
+}
+
+void FileStore::saveFinalRecoveryIndex()
+{
+    // The active journal starts with a sync point, which is always live: a
+    // journal without any is empty, and has nothing to index.
+
+    if (0 >= d_config.recoveryIndexIntervalSec() || d_fileSets.empty() ||
+        d_syncPoints.empty()) {
+        return;  // RETURN
+    }
+
+    RecoveryIndex recoveryIndex(d_allocator_p);
+    loadRecoveryIndexCheckpoint(&recoveryIndex);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_recoveryIndexLock);  // LOCK
+
+    // A checkpoint still being saved by a worker thread is older than this
+    // one, and must not replace it.
+    d_isRecoveryIndexFinal = true;
+
+    if (0 == saveRecoveryIndex(recoveryIndex)) {
+        BALL_LOG_INFO << partitionDesc() << "Saved final recovery index of "
+                      << recoveryIndex.recordOffsets().size()
+                      << " records at journal offset "
+                      << recoveryIndex.journalPosition() << ".";
+    }
+}
+
+int FileStore::saveRecoveryIndex(const RecoveryIndex& recoveryIndex)
+{
+    bsl::string directory;
+    int rc = bdls::PathUtil::getDirname(&directory, d_recoveryIndexFileName);
+    if (0 == rc) {
+        rc = bdls::FilesystemUtil::createDirectories(directory,
+                                                     true);  // isLeafDirectory
+    }
+
+    if (0 != rc) {
+        BALL_LOG_WARN << partitionDesc() << "Failed to create directory of "
+                      << "recovery index [" << d_recoveryIndexFileName
+                      << "], rc: " << rc;
+        return rc;  // RETURN
+    }
+
+    mwcu::MemOutStream errorDesc;
+    rc = recoveryIndex.save(errorDesc, d_recoveryIndexFileName);
+    if (0 != rc) {
+        BALL_LOG_WARN << partitionDesc() << "Failed to save recovery "
+                      << "index, rc: " << rc << ", error: " << errorDesc.str();
+    }
+
+    return rc;
+}
+
+void FileStore::saveRecoveryIndexWorker(
+    const bsl::shared_ptr<RecoveryIndex>& recoveryIndex)
+{
+    // executed by a *WORKER* thread
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_recoveryIndexLock);  // LOCK
+
+        // Once the partition was closed at shutdown, its final recovery index
+        // must not be replaced by this older checkpoint.
+        if (!d_isRecoveryIndexFinal) {
+            saveRecoveryIndex(*recoveryIndex);
+        }
+    }
+
+    execute(bdlf::BindUtil::bind(&FileStore::onRecoveryIndexSaved, this));
+}
+
+void FileStore::onRecoveryIndexSaved()
+{
+    // executed by the *DISPATCHER* thread
+
+    d_isSavingRecoveryIndex = false;
+}
+
+void FileStore::compactIfNeeded()
+{
+    if (0 >= d_config.compactionIntervalSec() || d_fileSets.empty()) {
+        return;  // RETURN
+    }
+
+    const bsls::Types::Int64 now = mwcsys::Time::highResolutionTimer();
+    if (0 != d_lastCompactionTime &&
+        now - d_lastCompactionTime <
+            d_config.compactionIntervalSec() *
+                bdlt::TimeUnitRatio::k_NANOSECONDS_PER_SECOND) {
+        return;  // RETURN
+    }
+    d_lastCompactionTime = now;
+
+    FileSet* activeFileSet = d_fileSets[0].get();
+    BSLS_ASSERT_SAFE(activeFileSet);
+    const MappedFileDescriptor& dataFile = activeFileSet->d_dataFile;
+
+    // Deallocate the regions found at the last compaction, unless the file
+    // set has been rolled over since then.  Note that the messages in these
+    // regions have been deleted for at least one interval.
+
+    if (d_pendingHolesDataFileName == activeFileSet->d_dataFileName) {
+        bsls::Types::Uint64 deallocatedBytes = 0;
+        for (FileRegions::const_iterator cit = d_pendingHoles.begin();
+             cit != d_pendingHoles.end();
+             ++cit) {
+            mwcu::MemOutStream errorDesc;
+
+            int rc = FileSystemUtil::punchHole(dataFile.fd(),
+                                               cit->first,
+                                               cit->second,
+                                               errorDesc);
+            if (0 != rc) {
+                BALL_LOG_WARN << partitionDesc() << "Failed to compact data "
+                              << "file [" << activeFileSet->d_dataFileName
+                              << "], rc: " << rc
+                              << ", error: " << errorDesc.str();
+                break;  // BREAK
+            }
+            deallocatedBytes += cit->second;
+        }
+
+        if (0 != deallocatedBytes) {
+            BALL_LOG_INFO << partitionDesc() << "Compacted data file ["
+                          << activeFileSet->d_dataFileName << "]: "
+                          << mwcu::PrintUtil::prettyBytes(deallocatedBytes)
+                          << " in " << d_pendingHoles.size()
+                          << " region(s) of deleted messages.";
+        }
+    }
+
+    d_pendingHoles.clear();
+    d_pendingHolesDataFileName = activeFileSet->d_dataFileName;
+
+    // Find the regions between the outstanding messages which are large
+    // enough for their deallocation to be worthwhile.  The region after the
+    // last outstanding message is excluded, as a replica may have written
+    // messages there for which it has not yet received the journal record.
+
+    FileRegions messages(d_allocator_p);
+    for (RecordConstIterator cit = d_records.begin(); cit != d_records.end();
+         ++cit) {
+        if (RecordType::e_MESSAGE == cit->second.d_recordType) {
+            messages.push_back(
+                bsl::make_pair(cit->second.d_messageOffset,
+                               static_cast<bsls::Types::Uint64>(
+                                   cit->second.d_dataOrQlistRecordPaddedLen)));
+        }
+    }
+    bsl::sort(messages.begin(), messages.end());
+
+    // The first page contains the file headers.
+
+    bsls::Types::Uint64 regionBegin = k_COMPACTION_ALIGNMENT;
+    for (FileRegions::const_iterator cit = messages.begin();
+         cit != messages.end();
+         ++cit) {
+        const bsls::Types::Uint64 begin =
+            (regionBegin + k_COMPACTION_ALIGNMENT - 1) /
+            k_COMPACTION_ALIGNMENT * k_COMPACTION_ALIGNMENT;
+        const bsls::Types::Uint64 end = cit->first / k_COMPACTION_ALIGNMENT *
+                                        k_COMPACTION_ALIGNMENT;
+        if (end > begin && end - begin >= k_MIN_COMPACTION_REGION_SIZE) {
+            d_pendingHoles.push_back(bsl::make_pair(begin, end - begin));
+        }
+        regionBegin = bsl::max(regionBegin, cit->first + cit->second);
+    }
+}
+
+void FileStore::writeBackActiveFileSet()
+{
+    if (!d_config.hasIncrementalWriteBack() || !d_isOpen) {
+        return;  // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(0 < d_fileSets.size());
+    FileSet* activeFileSet = d_fileSets[0].get();
+    BSLS_ASSERT_SAFE(activeFileSet);
+
+    struct local {
+        static void writeBack(bsls::Types::Uint64*        writeBackPosition,
+                              const MappedFileDescriptor& mfd,
+                              bsls::Types::Uint64         position,
+                              const FileStore&            store,
+                              const bsl::string&          fileName)
+        {
+            if (position < *writeBackPosition + k_WRITE_BACK_THRESHOLD) {
+                return;  // RETURN
+            }
+
+            mwcu::MemOutStream errorDesc;
+            const int          rc = FileSystemUtil::writeBack(
+                mfd,
+                *writeBackPosition,
+                position - *writeBackPosition,
+                errorDesc);
+            if (0 != rc) {
+                BALL_LOG_WARN << store.partitionDesc()
+                              << "Failed to start write back of file ["
+                              << fileName << "], error: " << errorDesc.str();
+            }
+
+            // Even on failure, so that the next write back does not retry
+            // the same range.
+            *writeBackPosition = position;
+        }
+    };
+
+    local::writeBack(&activeFileSet->d_dataFileWriteBackPosition,
+                     activeFileSet->d_dataFile,
+                     activeFileSet->d_dataFilePosition,
+                     *this,
+                     activeFileSet->d_dataFileName);
+    local::writeBack(&activeFileSet->d_journalFileWriteBackPosition,
+                     activeFileSet->d_journalFile,
+                     activeFileSet->d_journalFilePosition,
+                     *this,
+                     activeFileSet->d_journalFileName);
+}
+
+void FileStore::issueReceipt(mqbnet::ClusterNode* node,
+                             unsigned int         primaryLeaseId,
+                             bsls::Types::Uint64  sequenceNumber)
+{
+    const int                     nodeId = node->nodeId();
+    NodeReceiptContexts::iterator itNode = d_nodes.find(nodeId);
+    const DataStoreRecordKey      key(sequenceNumber, primaryLeaseId);
+
+    if (itNode == d_nodes.end()) {
+        // no prior history about this node
+        itNode =
+            d_nodes
+                .insert(bsl::make_pair(
+                    nodeId,
+                    NodeContext(d_config.bufferFactory(), key, d_allocator_p)))
+                .first;
+    }
+    else if (itNode->second.d_key < key) {
+        itNode->second.d_key = key;
+    }
+    else {
+        // outdated receipt
+        return;  // RETURN
+    }
+    NodeContext& nodeContext = itNode->second;
+
+    if (nodeContext.d_state && nodeContext.d_state->tryLock()) {
+        char*                     buffer = nodeContext.d_blob.buffer(0).data();
+        bmqp::ReplicationReceipt* receipt =
+            reinterpret_cast<bmqp::ReplicationReceipt*>(
+                buffer + sizeof(bmqp::EventHeader));
+
+        // Overwrite Receipt sequence number
+        (*receipt)
+            .setPrimaryLeaseId(primaryLeaseId)
+            .setSequenceNum(sequenceNumber);
 
         nodeContext.d_state->unlock();
     }
@@ -6800,8 +8430,10 @@ void FileStore::dispatcherFlush(bool storage, bool queues)
             BALL_LOG_TRACE << partitionDesc() << "Flushing "
                            << d_storageEventBuilder.messageCount()
                            << " STORAGE messages.";
-            const int maxChannelPendingItems = d_cluster_p->broadcast(
-                d_storageEventBuilder.blob());
+            const int maxChannelPendingItems =
+                d_config.hasChainReplication()
+                    ? writeToNextReplicationHop(d_storageEventBuilder.blob())
+                    : d_cluster_p->broadcast(d_storageEventBuilder.blob());
             if (maxChannelPendingItems > 0) {
                 if (d_nagglePacketCount < k_NAGLE_PACKET_COUNT) {
                     // back off
@@ -6811,6 +8443,11 @@ void FileStore::dispatcherFlush(bool storage, bool queues)
             else if (d_nagglePacketCount) {
                 --d_nagglePacketCount;
             }
+            d_clusterStats_p->onPartitionEvent(
+                mqbstat::ClusterStats::PartitionEventType::
+                    e_PARTITION_REPLICATION_BATCH,
+                d_config.partitionId(),
+                d_storageEventBuilder.messageCount());
             d_storageEventBuilder.reset();
         }
     }
@@ -6845,8 +8482,11 @@ bool FileStore::gcExpiredMessages(const bdlt::Datetime& currentTimeUtc)
         return false;  // RETURN
     }
 
-    // Go over each file-backed storage registered with this partition and
-    // indicate it to GC any applicable messages.
+    // Go over each storage registered with this partition which the expiry
+    // index marks as due, and indicate it to GC any applicable messages.
+    // Messages of a storage share the same TTL, so a storage stops at its
+    // first unexpired message, whose timestamp tells when that storage is
+    // next due.
 
     const bsls::Types::Uint64 currentSecondsFromEpoch =
         static_cast<bsls::Types::Uint64>(
@@ -6854,14 +8494,54 @@ bool FileStore::gcExpiredMessages(const bdlt::Datetime& currentTimeUtc)
     bool haveMore    = false;
     bool needToFlush = false;
 
-    for (StorageMapIter it = d_storages.begin(); it != d_storages.end();
+    d_dueStorages.clear();
+    for (ExpiryIndexIter it = d_expiryIndex.begin();
+         it != d_expiryIndex.end() && it->first <= currentSecondsFromEpoch;
          ++it) {
-        ReplicatedStorage*  rs                        = it->second;
+        d_dueStorages.push_back(it->second);
+    }
+
+    for (size_t i = 0; i < d_dueStorages.size(); ++i) {
+        StorageMapIter sit = d_storages.find(d_dueStorages[i]);
+        BSLS_ASSERT_SAFE(sit != d_storages.end());
+
+        ReplicatedStorage*  rs                        = sit->second;
         bsls::Types::Uint64 latestMsgTimestamp        = 0;
         bsls::Types::Int64  configuredTtlValueSeconds = 0;
         int numMsgsGc = rs->gcExpiredMessages(&latestMsgTimestamp,
                                               &configuredTtlValueSeconds,
                                               currentSecondsFromEpoch);
+
+        // Compute when this storage is next due.  The next message to expire
+        // is the first remaining one, and messages added later expire after
+        // the current time plus the TTL.  Messages still waiting for a quorum
+        // of Receipts may also be GC'd after the deduplication time.
+
+        bsls::Types::Uint64 nextCheck = currentSecondsFromEpoch +
+                                        k_GC_EXPIRY_CHECK_MAX_DELAY_SECONDS;
+        const bsls::Types::Uint64 ttl =
+            static_cast<bsls::Types::Uint64>(configuredTtlValueSeconds);
+        const bsls::Types::Uint64 nextExpiry =
+            (rs->isEmpty() ? currentSecondsFromEpoch : latestMsgTimestamp) +
+            ttl + 1;
+        nextCheck = bsl::min(nextCheck, nextExpiry);
+
+        const bsls::Types::Int64 deduplicationTimeMs =
+            rs->queue() ? rs->queue()->domain()->config().deduplicationTimeMs()
+                        : 0;
+        if (deduplicationTimeMs > 0) {
+            const bsls::Types::Uint64 deduplicationTimeSeconds = bsl::max(
+                static_cast<bsls::Types::Uint64>(
+                    deduplicationTimeMs /
+                    bdlt::TimeUnitRatio::k_MILLISECONDS_PER_SECOND),
+                static_cast<bsls::Types::Uint64>(1));
+            nextCheck = bsl::min(nextCheck,
+                                 currentSecondsFromEpoch +
+                                     deduplicationTimeSeconds);
+        }
+
+        scheduleExpiryCheck(sit->first, nextCheck);
+
         if (numMsgsGc <= 0) {
             // No messages GC'd or error.
 
@@ -6872,7 +8552,7 @@ bool FileStore::gcExpiredMessages(const bdlt::Datetime& currentTimeUtc)
         }
 
         BALL_LOG_INFO << partitionDesc() << "For storage for queue ["
-                      << rs->queueUri() << "] and queueKey [" << it->first
+                      << rs->queueUri() << "] and queueKey [" << sit->first
                       << "] configured with TTL value of ["
                       << configuredTtlValueSeconds
                       << "] seconds, garbage-collected [" << numMsgsGc
@@ -6906,6 +8586,23 @@ bool FileStore::gcExpiredMessages(const bdlt::Datetime& currentTimeUtc)
     return haveMore;
 }
 
+void FileStore::scheduleExpiryCheck(const mqbu::StorageKey& queueKey,
+                                    bsls::Types::Uint64     secondsFromEpoch)
+{
+    ExpiryIndexPositions::iterator pit = d_expiryIndexPositions.find(
+        queueKey);
+    if (pit != d_expiryIndexPositions.end()) {
+        d_expiryIndex.erase(pit->second);
+        pit->second = d_expiryIndex.insert(
+            bsl::make_pair(secondsFromEpoch, queueKey));
+        return;  // RETURN
+    }
+
+    d_expiryIndexPositions.insert(bsl::make_pair(
+        queueKey,
+        d_expiryIndex.insert(bsl::make_pair(secondsFromEpoch, queueKey))));
+}
+
 bool FileStore::gcHistory()
 {
     if (!d_isOpen) {
@@ -6979,6 +8676,10 @@ void FileStore::registerStorage(ReplicatedStorage* storage)
     BALL_LOG_INFO << "Registering storage for queue '" << storage->queueUri()
                   << "', queueKey: " << storage->queueKey();
     d_storages[storage->queueKey()] = storage;
+
+    // A new storage may already contain expired messages, so check it at
+    // the next garbage collection.
+    scheduleExpiryCheck(storage->queueKey(), 0);
 }
 
 void FileStore::unregisterStorage(const ReplicatedStorage* storage)
@@ -6990,6 +8691,13 @@ void FileStore::unregisterStorage(const ReplicatedStorage* storage)
     size_t count = d_storages.erase(storage->queueKey());
     BSLS_ASSERT_SAFE(1 == count);
     static_cast<void>(count);
+
+    ExpiryIndexPositions::iterator pit = d_expiryIndexPositions.find(
+        storage->queueKey());
+    if (pit != d_expiryIndexPositions.end()) {
+        d_expiryIndex.erase(pit->second);
+        d_expiryIndexPositions.erase(pit);
+    }
 }
 
 void FileStore::cancelTimersAndWait()
@@ -7044,8 +8752,8 @@ void FileStore::onDispatcherEvent(const mqbi::DispatcherEvent& event)
     case mqbi::DispatcherEventType::e_CALLBACK: {
         const mqbi::DispatcherCallbackEvent* realEvent =
             event.asCallbackEvent();
-        BSLS_ASSERT_SAFE(realEvent->callback());
-        realEvent->callback()(dispatcherClientData().processorHandle());
+        BSLS_ASSERT_SAFE(realEvent->hasCallback());
+        realEvent->invokeCallback(dispatcherClientData().processorHandle());
     } break;  // BREAK
     case mqbi::DispatcherEventType::e_UNDEFINED:
     case mqbi::DispatcherEventType::e_PUT:
@@ -7079,6 +8787,15 @@ void FileStore::flush()
         return;  // RETURN
     }
 
+    // End of the dispatcher batch: send the Receipt coalescing the messages
+    // received during that batch.
+    flushPendingReceipt();
+
+    // Start writing back what has been written during that batch, so that
+    // dirty pages do not accumulate until the kernel (or a 'msync') writes
+    // them all back at once.
+    writeBackActiveFileSet();
+
     const bool haveMore        = gcExpiredMessages(bdlt::CurrentTime::utc());
     const bool haveMoreHistory = gcHistory();
 
@@ -7201,6 +8918,21 @@ void FileStore::loadSummary(mqbcmd::FileStore* fileStore) const
                                     d_storages);
 }
 
+bsl::shared_ptr<const mqbcmd::FileStore> FileStore::publishSummarySnapshot()
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+
+    bsl::shared_ptr<mqbcmd::FileStore> snapshot;
+    snapshot.createInplace(d_allocator_p, d_allocator_p);
+    loadSummary(snapshot.get());
+
+    d_summarySnapshot.publish(snapshot, mwcsys::Time::highResolutionTimer());
+    return snapshot;
+}
+
 // ACCESSORS
 void FileStore::loadMessageRecordRaw(MessageRecord*               buffer,
                                      const DataStoreRecordHandle& handle) const
@@ -7351,6 +9083,14 @@ bool FileStore::hasReceipt(const DataStoreRecordHandle& handle) const
     return record.d_hasReceipt;
 }
 
+bsl::shared_ptr<const mqbcmd::FileStore> FileStore::summarySnapshot() const
+{
+    // executed by *ANY* thread
+
+    return d_summarySnapshot.get(k_SUMMARY_SNAPSHOT_MAX_AGE,
+                                 mwcsys::Time::highResolutionTimer());
+}
+
 // -----------------------
 // class FileStoreIterator
 // -----------------------
@@ -43,6 +43,7 @@
 #include <mqbs_filestoreprotocol.h>
 #include <mqbs_mappedfiledescriptor.h>
 #include <mqbs_storagecollectionutil.h>
+#include <mqbu_snapshotholder.h>
 #include <mqbu_storagekey.h>
 
 // BMQ
@@ -66,6 +67,7 @@
 #include <bdlmt_throttle.h>
 #include <bsl_deque.h>
 #include <bsl_limits.h>
+#include <bsl_map.h>
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
 #include <bsl_string.h>
@@ -74,8 +76,10 @@
 #include <bsl_vector.h>
 #include <bslh_hash.h>
 #include <bslma_allocator.h>
+#include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_mutex.h>
 #include <bsls_assert.h>
 #include <bsls_cpp11.h>
 #include <bsls_types.h>
@@ -104,6 +108,7 @@ class FileStore;
 class FileStoreSet;
 class JournalFileIterator;
 class QlistFileIterator;
+class RecoveryIndex;
 class ReplicatedStorage;
 
 // =====================================
@@ -209,6 +214,15 @@ class FileStore : public DataStore {
 
     typedef bdlmt::EventScheduler::RecurringEventHandle RecurringEventHandle;
 
+    /// Region of a file, as a pair of (offset, length).
+    typedef bsl::pair<bsls::Types::Uint64, bsls::Types::Uint64> FileRegion;
+
+    typedef bsl::vector<FileRegion> FileRegions;
+
+    typedef bdlmt::EventScheduler::EventHandle EventHandle;
+
+    typedef bslma::ManagedPtr<bdlmt::FixedThreadPool> ThreadPoolMp;
+
     typedef DataStoreConfig::QueueKeyInfoMapConstIter QueueKeyInfoMapConstIter;
     typedef DataStoreConfig::QueueKeyInfoMapInsertRc  QueueKeyInfoMapInsertRc;
 
@@ -219,6 +233,17 @@ class FileStore : public DataStore {
     typedef StorageCollectionUtil::StorageMapIter      StorageMapIter;
     typedef StorageCollectionUtil::StorageMapConstIter StorageMapConstIter;
 
+    /// Index of the storages registered with this partition, by the time
+    /// (seconds from epoch) at which each of them may next have a message
+    /// to garbage-collect.
+    typedef bsl::multimap<bsls::Types::Uint64, mqbu::StorageKey> ExpiryIndex;
+    typedef ExpiryIndex::iterator ExpiryIndexIter;
+
+    typedef bsl::unordered_map<mqbu::StorageKey,
+                               ExpiryIndexIter,
+                               bslh::Hash<mqbu::StorageKeyHashAlgo> >
+        ExpiryIndexPositions;
+
     /// This context we keep for un-receipted messages.
     struct ReceiptContext {
         const mqbu::StorageKey  d_queueKey;
@@ -231,11 +256,15 @@ class FileStore : public DataStore {
                                           // 'd_replicationFactor', the
                                           // Receipt'ed messages are
                                           // strong consistent.
+        bool d_awaitsSync;  // Whether the local sync to disk of the message
+                            // by a group commit counts as a Receipt, instead
+                            // of its write.
 
         ReceiptContext(const mqbu::StorageKey&  queueKey,
                        const bmqt::MessageGUID& guid,
                        const RecordIterator&    handle,
                        int                      count,
+                       bool                     awaitsSync,
                        mqbi::QueueHandle*       qH);
     };
 
@@ -373,6 +402,24 @@ class FileStore : public DataStore {
     StoragesMap d_storages;
     // Map [QueueKey->ReplicatedStorage*]
 
+    ExpiryIndex d_expiryIndex;
+    // Index of the storages in
+    // 'd_storages' by the time at which
+    // each of them may next have an
+    // expired message, so that garbage
+    // collection only visits the storages
+    // which are due.
+
+    ExpiryIndexPositions d_expiryIndexPositions;
+    // Map [QueueKey->position in
+    // 'd_expiryIndex']
+
+    bsl::vector<mqbu::StorageKey> d_dueStorages;
+    // Scratch list of the storages due
+    // for garbage collection, reused
+    // across invocations of
+    // 'gcExpiredMessages'.
+
     bdlmt::Throttle d_alarmSoftLimiter;
     // Throttler for alarming on soft
     // limits of partition files
@@ -396,6 +443,140 @@ class FileStore : public DataStore {
     // the cluster channels load, it can
     // grow or shrink.
 
+    bsls::Types::Int64 d_replicationBatchDeadline;
+    // HiRes timer value by which the
+    // 'd_storageEventBuilder' is to be
+    // flushed, i.e. the earliest deadline
+    // of the messages added to it, used to
+    // bound the latency of a replication
+    // batch.
+
+    mqbu::SnapshotHolder<mqbcmd::FileStore> d_summarySnapshot;
+    // Latest snapshot of the summary of
+    // this partition, published by the
+    // partition dispatcher thread, and
+    // read by the admin commands.
+
+    mqbnet::ClusterNode* d_pendingReceiptNode_p;
+    // Node to which the pending Receipt,
+    // if any, is to be sent (replica only).
+
+    DataStoreRecordKey d_pendingReceiptKey;
+    // Highest record key received since the
+    // last Receipt was sent, and to be
+    // confirmed by the pending Receipt.
+
+    int d_numPendingReceipts;
+    // Number of records confirmed by the
+    // pending Receipt.  Receipts are
+    // coalesced until the end of the
+    // current dispatcher batch, or until
+    // this number reaches a threshold.
+
+    ThreadPoolMp d_syncThreadPool_mp;
+    // Thread syncing the files to disk
+    // for group commit, so that syncing
+    // does not block the partition
+    // dispatcher thread.  Null unless
+    // group commit is enabled.
+
+    EventHandle d_groupCommitEventHandle;
+    // Event starting a group commit once
+    // the group commit window elapsed.
+
+    bsl::vector<FileSetSp> d_groupCommitFileSets;
+    // File sets written to since the
+    // last group commit was started
+    // (usually only the active one, unless
+    // a rollover happened since then).
+
+    DataStoreRecordKey d_groupCommitKey;
+    // Key of the latest message record
+    // written since the last group commit
+    // was started.
+
+    bsls::TimeInterval d_groupCommitDeadline;
+    // Time at which the pending group
+    // commit is to be started, i.e. the
+    // earliest end of the group commit
+    // windows of its message records.
+
+    bsls::Types::Uint64 d_groupCommitBytes;
+    // Number of bytes of the message
+    // records written since the last group
+    // commit was started.
+
+    DataStoreRecordKey d_syncedKey;
+    // Key of the latest message record
+    // covered by a completed group commit.
+
+    bool d_isGroupCommitInProgress;
+    // Whether a group commit is being
+    // executed by the sync thread.
+
+    bsl::string d_nextFileSetLocation;
+    // Directory in which the next file set
+    // is prepared.  It is a sub-directory
+    // of the partition location, so that
+    // the prepared (empty) file set is
+    // never picked up by recovery.
+
+    FileSetSp d_nextFileSet_sp;
+    // File set prepared (created, grown
+    // and prefaulted) ahead of time by a
+    // worker thread, and used by the next
+    // rollover, if any.
+
+    bool d_isPreparingNextFileSet;
+    // Whether the next file set is being
+    // prepared by a worker thread.
+
+    bsls::Types::Int64 d_lastHugePageReportTime;
+    // Time, in nanoseconds, at which the
+    // huge page backed size of the active
+    // file set was last reported.
+
+    bsl::string d_recoveryIndexFileName;
+    // Name of the file to which the
+    // recovery index of the active journal
+    // is checkpointed.
+
+    bsls::Types::Int64 d_lastRecoveryIndexTime;
+    // Time, in nanoseconds, at which the
+    // recovery index was last checkpointed.
+
+    bool d_isSavingRecoveryIndex;
+    // Whether a checkpoint of the recovery
+    // index is being saved by a worker
+    // thread.
+
+    bslmt::Mutex d_recoveryIndexLock;
+    // Mutex serializing the saves of the
+    // recovery index, and protecting
+    // 'd_isRecoveryIndexFinal'.
+
+    bool d_isRecoveryIndexFinal;
+    // Whether the recovery index was
+    // checkpointed as the partition was
+    // closed at shutdown, in which case the
+    // checkpoints still being saved by a
+    // worker thread are discarded.
+
+    bsls::Types::Int64 d_lastCompactionTime;
+    // Time, in nanoseconds, at which the
+    // active data file was last compacted.
+
+    FileRegions d_pendingHoles;
+    // Regions of deleted messages found in
+    // the data file named
+    // 'd_pendingHolesDataFileName' at the
+    // last compaction, to be deallocated at
+    // the next one.
+
+    bsl::string d_pendingHolesDataFileName;
+    // Name of the data file to which
+    // 'd_pendingHoles' belong.
+
   private:
     // NOT IMPLEMENTED
     FileStore(const FileStore&) BSLS_CPP11_DELETED;
@@ -478,13 +659,26 @@ class FileStore : public DataStore {
     /// information.  Return zero on success, non zero value otherwise.  The
     /// behavior is undefined unless the journal iterator `jit` is in
     /// reverse mode.  Note that this method invalidates all iterators.
+    /// Also note that if the specified `recoveryIndex` is not null, the
+    /// records of the journal before its checkpoint position which are not
+    /// in the index are skipped.
     int recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
                         bsls::Types::Uint64* journalOffset,
                         bsls::Types::Uint64* qlistOffset,
                         bsls::Types::Uint64* dataOffset,
                         JournalFileIterator* jit,
                         QlistFileIterator*   qit,
-                        DataFileIterator*    dit);
+                        DataFileIterator*    dit,
+                        const RecoveryIndex* recoveryIndex);
+
+    /// Load into the specified `recoveryIndex` the last checkpoint of the
+    /// recovery index, if enabled in the configuration, and validate it
+    /// against the journal having the specified `journalFileName` and
+    /// represented by the specified `jit`.  Return zero if the index can be
+    /// used to recover the journal, and a non-zero value otherwise.
+    int loadRecoveryIndex(RecoveryIndex*             recoveryIndex,
+                          const JournalFileIterator& jit,
+                          const bsl::string&         journalFileName);
 
     /// Rollover the outstanding messages belonging to the storages mapped
     /// to this file store, from active file set into the rollover file set,
@@ -579,18 +773,21 @@ class FileStore : public DataStore {
     /// `journalOffset` in the journal file, and having the associated DATA
     /// or QLIST block starting at the specified `dataOffset` and of the
     /// specified `totalDataLen` length.  Use the specified `flags` for the
-    /// packet header.  The behavior is undefined unless `type` is `e_DATA`
-    /// or `e_QLIST`.  Note that upon return of this method, it is
-    /// guaranteed that a valid packet was created and enqueued to be sent
-    /// to all peers; it does not mean that packet was successfully sent to
-    /// any/all peers.
-    void replicateRecord(bmqp::StorageMessageType::Enum type,
-                         int                            flags,
-                         bsls::Types::Uint64            journalOffset,
-                         bsls::Types::Uint64            dataOffset,
-                         unsigned int                   totalDataLen);
-
-    /// Executed in the scheduler's dispatcher thread.
+    /// packet header.  Optionally specify the `maxLatencyUs` of the record
+    /// in the replication batch (see `flushIfNeeded`).  The behavior is
+    /// undefined unless `type` is `e_DATA` or `e_QLIST`.  Note that upon
+    /// return of this method, it is guaranteed that a valid packet was
+    /// created and enqueued to be sent to all peers; it does not mean that
+    /// packet was successfully sent to any/all peers.
+    void replicateRecord(
+        bmqp::StorageMessageType::Enum type,
+        int                            flags,
+        bsls::Types::Uint64            journalOffset,
+        bsls::Types::Uint64            dataOffset,
+        unsigned int                   totalDataLen,
+        int maxLatencyUs = DataStoreRecordProfile::k_PARTITION_DEFAULT);
+
+    /// Executed by any thread of the misc work thread pool.
     void deleteArchiveFilesCb();
 
     /// Validate whether we can write and replicate a record, returning
@@ -603,6 +800,166 @@ class FileStore : public DataStore {
     /// still pending receipt of quorum Receipts.
     void cancelUnreceipted(const DataStoreRecordKey& recordKey);
 
+    /// Write the specified storage event `blob` to the first replica of the
+    /// replication chain of this partition to which it can be written, and
+    /// return the number of items pending in the channel of that replica
+    /// prior to writing, or 0 if no replica is available.  The behavior is
+    /// undefined unless self is the primary and chain replication is
+    /// enabled.
+    int writeToNextReplicationHop(const bdlbb::Blob& blob);
+
+    /// Record that a Replication Receipt is to be sent to the specified
+    /// `node` confirming the receipt of message with the specified
+    /// `primaryLeaseId` and `sequenceNumber`.  Receipts are coalesced, the
+    /// pending one being sent, confirming all messages up to the latest
+    /// one, when enough messages have been confirmed, or when this object
+    /// is flushed at the end of the current dispatcher batch.
+    void bufferReceipt(mqbnet::ClusterNode* node,
+                       unsigned int         primaryLeaseId,
+                       bsls::Types::Uint64  sequenceNumber);
+
+    /// Send the pending Replication Receipt, if any.
+    void flushPendingReceipt();
+
+    /// Return true if group commit is enabled, i.e. if the local sync to
+    /// disk of a message is required, in addition to the receipts of the
+    /// replicas, before acknowledging it.
+    bool isGroupCommitEnabled() const;
+
+    /// Return true if the data and journal files of the specified `fileSet`
+    /// are mapped onto persistent memory, in which case a message written
+    /// to them is made durable by `persistMessage`, and needs no group
+    /// commit.
+    static bool isPersistentMemory(const FileSet& fileSet);
+
+    /// Make durable the message written to the data file of the specified
+    /// `fileSet` at the specified `dataOffset` and of the specified
+    /// `dataLength` bytes, and its record written to the journal at the
+    /// specified `journalOffset`, by flushing them from the CPU caches to
+    /// the persistent memory.  The behavior is undefined unless
+    /// `isPersistentMemory(fileSet)` is true.
+    void persistMessage(const FileSet&      fileSet,
+                        bsls::Types::Uint64 dataOffset,
+                        bsls::Types::Uint64 dataLength,
+                        bsls::Types::Uint64 journalOffset);
+
+    /// Record that the message with the specified `key`, and of the
+    /// specified `length` bytes, has been written to the active file set
+    /// and requires a group commit within the specified `windowUs`
+    /// microseconds, starting or shortening the group commit window, or
+    /// starting the group commit itself, as appropriate.
+    void addToGroupCommit(const DataStoreRecordKey& key,
+                          bsls::Types::Uint64       length,
+                          int                       windowUs);
+
+    /// Enqueue the event starting a group commit in the dispatcher thread.
+    ///
+    /// THREAD: This method is called from the scheduler thread.
+    void groupCommitWindowCb();
+
+    /// Start a group commit covering all the records written since the
+    /// last one, unless one is already in progress or there is none.
+    void startGroupCommit();
+
+    /// Sync to disk the data and journal files of the specified `fileSets`
+    /// and then notify the dispatcher thread that the records up to the
+    /// specified `key` are synced.
+    ///
+    /// THREAD: This method is called from the sync thread.
+    void groupCommitWorker(const bsl::vector<FileSetSp>& fileSets,
+                           const DataStoreRecordKey&     key);
+
+    /// Process the completion, with the specified `status`, of the group
+    /// commit of the specified `fileSets` covering the records up to the
+    /// specified `key`, counting the local sync as a receipt for these
+    /// records on success, and scheduling a retry of the group commit
+    /// otherwise.
+    void onGroupCommitDone(const bsl::vector<FileSetSp>& fileSets,
+                           const DataStoreRecordKey&     key,
+                           int                           status);
+
+    /// Start preparing the next file set in a worker thread if the
+    /// specified `file`, whose current size is the specified
+    /// `currentSize`, is close enough to its capacity, and no next file set
+    /// is prepared or being prepared.
+    void prepareNextFileSetIfNeeded(const MappedFileDescriptor& file,
+                                    bsls::Types::Uint64         currentSize);
+
+    /// Create, grow and prefault the next file set in the directory for
+    /// prepared file sets, and hand it over to the dispatcher thread.
+    ///
+    /// THREAD: This method is called from a worker thread.
+    void prepareNextFileSetWorker();
+
+    /// Keep the specified `fileSet`, prepared by a worker thread, for the
+    /// next rollover.  Note that `fileSet` is null if its preparation
+    /// failed.
+    void onNextFileSetPrepared(const FileSetSp& fileSet);
+
+    /// Load into the specified `fileSetSp` the prepared next file set, if
+    /// any, after moving its files to the partition location.  Return zero
+    /// on success, and a non-zero value if there is no prepared file set or
+    /// if it could not be moved, in which case it is discarded.
+    int takeNextFileSet(FileSetSp* fileSetSp);
+
+    /// Close the prepared next file set, if any, and remove its files.
+    void discardNextFileSet();
+
+    /// Advise the OS to back the mappings of the data and journal files of
+    /// the specified `fileSet` with huge pages, if enabled in the
+    /// configuration.
+    void adviseHugePages(const FileSet& fileSet);
+
+    /// Report the number of bytes of the mappings of the data and journal
+    /// files of the active file set which are backed by huge pages, if
+    /// enabled in the configuration.
+    void reportHugePageBytes();
+
+    /// Checkpoint the live records of the active journal into the recovery
+    /// index if enabled in the configuration, and if the configured
+    /// interval has elapsed since the last checkpoint.
+    void checkpointRecoveryIndexIfNeeded();
+
+    /// Checkpoint the live records of the active journal into the recovery
+    /// index, if enabled in the configuration, and save it from this
+    /// thread, so that the next recovery of the partition (e.g., by the
+    /// broker restarted as part of an upgrade) only reads these records.
+    /// The behavior is undefined unless this is the last checkpoint before
+    /// the active journal is closed.
+    void saveFinalRecoveryIndex();
+
+    /// Save the specified `recoveryIndex` to the recovery index file,
+    /// creating its directory if needed.  Return 0 on success, or a
+    /// non-zero value otherwise.  The behavior is undefined unless
+    /// `d_recoveryIndexLock` is locked.
+    int saveRecoveryIndex(const RecoveryIndex& recoveryIndex);
+
+    /// Save the specified `recoveryIndex` to the recovery index file,
+    /// unless the final recovery index was saved.
+    ///
+    /// THREAD: This method is called from a worker thread.
+    void saveRecoveryIndexWorker(
+        const bsl::shared_ptr<RecoveryIndex>& recoveryIndex);
+
+    /// Process the completion of the save of the recovery index.
+    void onRecoveryIndexSaved();
+
+    /// Deallocate the disk space of the regions of the active data file
+    /// which were found to only contain deleted messages at the last
+    /// compaction, and find the ones to deallocate at the next compaction,
+    /// if enabled in the configuration and if the configured interval has
+    /// elapsed since the last compaction.  Note that the regions are only
+    /// deallocated one interval after they have been found, so that blobs
+    /// aliasing deleted messages which may still be in flight at the time
+    /// of their deletion are released by then.
+    void compactIfNeeded();
+
+    /// Start the write back to disk of the data and journal files of the
+    /// active file set, if enough bytes have been written to them since
+    /// the last time it was started.  Note that this method has no effect
+    /// unless incremental write back is enabled in the configuration.
+    void writeBackActiveFileSet();
+
     /// Send Replication Receipt to the specified `node` confirming the
     /// receipt of message with the specified `primaryLeaseId` and
     /// `sequenceNumber`.
@@ -633,9 +990,14 @@ class FileStore : public DataStore {
         RecordType::Enum               recordType,
         bsls::Types::Uint64            recordOffset);
 
-    ///  if the specified `immediateFlush` is `true` or the
-    /// `d_storageEventBuilder` is over the `d_nagglePacketCount` limit.
-    void flushIfNeeded(bool immediateFlush);
+    /// Flush the `d_storageEventBuilder` if the specified `immediateFlush`
+    /// is `true` or if the builder is over the `d_nagglePacketCount` limit,
+    /// the configured replication batch size limit or the replication batch
+    /// latency limit.  The latency limit of the record just added to the
+    /// builder is the specified `maxLatencyUs`, flushing the builder
+    /// immediately if 0, or the configured one if
+    /// `DataStoreRecordProfile::k_PARTITION_DEFAULT`.
+    void flushIfNeeded(bool immediateFlush, int maxLatencyUs);
 
     // PRIVATE ACCESSORS
 
@@ -653,6 +1015,23 @@ class FileStore : public DataStore {
                       bsl::shared_ptr<bdlbb::Blob>* options,
                       const DataStoreRecord&        record) const;
 
+    /// Load into the specified `recoveryIndex` the live records of the
+    /// active journal, i.e., its outstanding records and sync points, and
+    /// the current position of its end.
+    void loadRecoveryIndexCheckpoint(RecoveryIndex* recoveryIndex) const;
+
+    /// Ask the OS to read ahead the region of the data file of the
+    /// specified `fileSet` following the message ending at the specified
+    /// `messageEnd` offset and starting at the specified `messageOffset`,
+    /// if read-ahead is enabled and the region previously requested does
+    /// not extend far enough past the message.  The size of the requested
+    /// region doubles, up to the configured maximum, while messages are
+    /// read in order, and is reset to its minimum when a message outside of
+    /// the last region is read.
+    void readAhead(FileSet*            fileSet,
+                   bsls::Types::Uint64 messageOffset,
+                   bsls::Types::Uint64 messageEnd) const;
+
     /// Attempt to garbage-collect messages for which TTL has expired where
     /// the specified `currentTimeUtc` is the current timestamp (UTC).
     /// Return `true`, if there are expired items unprocessed because of the
@@ -660,6 +1039,13 @@ class FileStore : public DataStore {
     /// the primary node".
     bool gcExpiredMessages(const bdlt::Datetime& currentTimeUtc);
 
+    /// Record in the expiry index that the storage having the specified
+    /// `queueKey` may next have a message to garbage-collect at the
+    /// specified `secondsFromEpoch`, replacing any previous entry for that
+    /// storage.
+    void scheduleExpiryCheck(const mqbu::StorageKey& queueKey,
+                             bsls::Types::Uint64     secondsFromEpoch);
+
     /// Delete an history of guids or messages maintained by this data
     /// store.  Return `true`, if there are expired items unprocessed
     /// because of the batch size limitation.  Note that this routine is
@@ -743,14 +1129,18 @@ class FileStore : public DataStore {
     /// Write the specified `appData` and `options` belonging to specified
     /// `queueKey` and having specified `guid` and `attributes` to the data
     /// store, and update the specified `handle` with an identifier which
-    /// can be used to retrieve the message.
-    int
-    writeMessageRecord(mqbi::StorageMessageAttributes*     attributes,
-                       DataStoreRecordHandle*              handle,
-                       const bmqt::MessageGUID&            guid,
-                       const bsl::shared_ptr<bdlbb::Blob>& appData,
-                       const bsl::shared_ptr<bdlbb::Blob>& options,
-                       const mqbu::StorageKey& queueKey) BSLS_KEYWORD_OVERRIDE;
+    /// can be used to retrieve the message.  Optionally specify a `profile`
+    /// overriding, for this record, the group commit window and the
+    /// replication batch latency of the data store.
+    int writeMessageRecord(
+        mqbi::StorageMessageAttributes*     attributes,
+        DataStoreRecordHandle*              handle,
+        const bmqt::MessageGUID&            guid,
+        const bsl::shared_ptr<bdlbb::Blob>& appData,
+        const bsl::shared_ptr<bdlbb::Blob>& options,
+        const mqbu::StorageKey&             queueKey,
+        const DataStoreRecordProfile&       profile = DataStoreRecordProfile())
+        BSLS_KEYWORD_OVERRIDE;
 
     /// Qlist related
     /// -------------
@@ -815,6 +1205,13 @@ class FileStore : public DataStore {
     void
     removeRecordRaw(const DataStoreRecordHandle& handle) BSLS_KEYWORD_OVERRIDE;
 
+    /// Notify this data store that the time at which the messages of the
+    /// storage associated with the specified `queueKey` expire may have
+    /// changed, e.g. because the TTL of that storage has been
+    /// reconfigured.
+    void onStorageExpiryChanged(const mqbu::StorageKey& queueKey)
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Process the specified storage event `blob` containing one or more
     /// storage messages.  The behavior is undefined unless each message in
     /// the event belongs to this partition, and has same primary and
@@ -907,6 +1304,13 @@ class FileStore : public DataStore {
     /// object.
     void loadSummary(mqbcmd::FileStore* fileStore) const;
 
+    /// Take a snapshot of the summary of this partition, publish it so that
+    /// it is returned by `summarySnapshot` for a while, and return it.
+    ///
+    /// THREAD: This method must be invoked from the dispatcher thread of
+    ///         this partition.
+    bsl::shared_ptr<const mqbcmd::FileStore> publishSummarySnapshot();
+
     // ACCESSORS
 
     /// Return true if this instance is open, false otherwise.
@@ -953,6 +1357,12 @@ class FileStore : public DataStore {
     // ACCESSORS
     int processorId() const;
 
+    /// Return the latest snapshot of the summary of this partition if it is
+    /// recent enough, or an empty shared pointer otherwise.
+    ///
+    /// THREAD: This method can be invoked from *any* thread.
+    bsl::shared_ptr<const mqbcmd::FileStore> summarySnapshot() const;
+
     //   (virtual: mqbi::DispatcherClient)
 
     /// Return a pointer to the dispatcher this client is associated with.
@@ -1074,12 +1484,14 @@ inline FileStore::ReceiptContext::ReceiptContext(
     const bmqt::MessageGUID& guid,
     const RecordIterator&    handle,
     int                      count,
+    bool                     awaitsSync,
     mqbi::QueueHandle*       qH)
 : d_queueKey(queueKey)
 , d_guid(guid)
 , d_handle(handle)
 , d_qH(qH)
 , d_count(count)
+, d_awaitsSync(awaitsSync)
 {
     // NOTHING
 }
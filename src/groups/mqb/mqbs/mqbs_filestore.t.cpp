@@ -54,16 +54,23 @@
 #include <bdls_filesystemutil.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_epochutil.h>
+#include <bsl_limits.h>
 #include <bsl_memory.h>
 #include <bsl_vector.h>
 #include <bslma_default.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_threadutil.h>
 #include <bsls_platform.h>
 #include <bsls_systemclocktype.h>
+#include <bsls_timeinterval.h>
 #include <bsls_types.h>
 
+// SYS
+#include <sys/stat.h>
+#include <unistd.h>
+
 // CONVENIENCE
 using namespace BloombergLP;
 using namespace bsl;
@@ -137,6 +144,96 @@ void recoveredQueuesCb(
 }
 
 // CLASSES
+// ======================
+// class SyncFailureGuard
+// ======================
+
+/// Mechanism making the sync of a file opened by this process fail, by
+/// pointing the file descriptor of that file to a pipe, which does not
+/// support synchronization, until this object is destroyed or `restore` is
+/// called.  Note that memory mappings of the file are not affected.
+class SyncFailureGuard {
+  private:
+    // DATA
+    int d_fd;       // file descriptor of the file, or -1
+
+    int d_savedFd;  // duplicate of the original 'd_fd'
+
+    int d_pipe[2];  // pipe 'd_fd' points to
+
+  private:
+    // NOT IMPLEMENTED
+    SyncFailureGuard(const SyncFailureGuard&);
+    SyncFailureGuard& operator=(const SyncFailureGuard&);
+
+  public:
+    // CREATORS
+
+    /// Make the sync of the file at the specified `path`, if opened by
+    /// this process, fail.
+    explicit SyncFailureGuard(const bsl::string& path)
+    : d_fd(-1)
+    , d_savedFd(-1)
+    {
+        d_pipe[0] = d_pipe[1] = -1;
+
+        struct stat fileStat;
+        if (0 != ::stat(path.c_str(), &fileStat)) {
+            return;  // RETURN
+        }
+
+        const long maxFd = ::sysconf(_SC_OPEN_MAX);
+        for (int fd = 0; fd < maxFd; ++fd) {
+            struct stat fdStat;
+            if (0 == ::fstat(fd, &fdStat) &&
+                fdStat.st_dev == fileStat.st_dev &&
+                fdStat.st_ino == fileStat.st_ino) {
+                d_fd = fd;
+                break;  // BREAK
+            }
+        }
+
+        if (-1 == d_fd || 0 != ::pipe(d_pipe)) {
+            d_fd = -1;
+            return;  // RETURN
+        }
+
+        d_savedFd = ::dup(d_fd);
+        BSLS_ASSERT_OPT(-1 != d_savedFd);
+        BSLS_ASSERT_OPT(d_fd == ::dup2(d_pipe[0], d_fd));
+    }
+
+    /// Destroy this object, after calling `restore`.
+    ~SyncFailureGuard()
+    {
+        restore();
+
+        if (-1 != d_pipe[0]) {
+            ::close(d_pipe[0]);
+            ::close(d_pipe[1]);
+        }
+    }
+
+    // MANIPULATORS
+
+    /// Point the file descriptor back to the file, if not already done.
+    void restore()
+    {
+        if (-1 == d_savedFd) {
+            return;  // RETURN
+        }
+
+        BSLS_ASSERT_OPT(d_fd == ::dup2(d_savedFd, d_fd));
+        ::close(d_savedFd);
+        d_savedFd = -1;
+    }
+
+    // ACCESSORS
+
+    /// Return `true` if the sync of the file currently fails.
+    bool isFailing() const { return -1 != d_savedFd; }
+};
+
 // =============
 // struct Tester
 // =============
@@ -166,7 +263,9 @@ struct Tester {
 
   public:
     // CREATORS
-    Tester(const char* location)
+    Tester(const char* location,
+           int         groupCommitWindowUs = 0,
+           int         groupCommitMaxBytes = 0)
     : d_scheduler(bsls::SystemClockType::e_MONOTONIC, s_allocator_p)
     , d_bufferFactory(1024, s_allocator_p)
     , d_itemPool(mqbnet::Channel::k_ITEM_SIZE, s_allocator_p)
@@ -241,6 +340,8 @@ struct Tester {
             .setMaxDataFileSize(d_partitionCfg.maxDataFileSize())
             .setMaxJournalFileSize(d_partitionCfg.maxJournalFileSize())
             .setMaxQlistFileSize(d_partitionCfg.maxQlistFileSize())
+            .setGroupCommitWindowUs(groupCommitWindowUs)
+            .setGroupCommitMaxBytes(groupCommitMaxBytes)
             .setQueueCreationCb(
                 bdlf::BindUtil::bind(&queueCreationCb,
                                      bdlf::PlaceHolders::_1,   // status
@@ -744,12 +845,78 @@ struct Tester {
         return true;
     }
 
+    /// Write to the specified `fs` a message record requesting a receipt,
+    /// for a queue whose creation record is written first, and load its
+    /// handle into the specified `handle`.  Return 0 on success.
+    int writeMessageRecord(mqbs::FileStore*             fs,
+                           mqbs::DataStoreRecordHandle* handle)
+    {
+        const mqbu::StorageKey queueKey(
+            mqbu::StorageKey::HexRepresentation(),
+            "ABCDEF1234");
+
+        mqbs::DataStoreRecordHandle queueHandle;
+        int                         rc = fs->writeQueueCreationRecord(
+            &queueHandle,
+            bmqt::Uri("bmq://si.amw.bmq.stats/queue", s_allocator_p),
+            queueKey,
+            AppIdKeyPairs(),
+            bdlt::EpochUtil::convertToTimeT64(bdlt::CurrentTime::utc()),
+            true);  // isNewQueue
+        if (0 != rc) {
+            return rc;  // RETURN
+        }
+
+        bmqt::MessageGUID guid;
+        mqbu::MessageGUIDUtil::generateGUID(&guid);
+
+        bsl::shared_ptr<bdlbb::Blob> appData;
+        appData.createInplace(s_allocator_p, &d_bufferFactory, s_allocator_p);
+        bsl::string payload(1024, 'x', s_allocator_p);
+        bdlbb::BlobUtil::append(appData.get(),
+                                payload.c_str(),
+                                payload.length());
+
+        mqbi::StorageMessageAttributes attributes(
+            bdlt::EpochUtil::convertToTimeT64(bdlt::CurrentTime::utc()),
+            1,  // refCount
+            bmqp::MessagePropertiesInfo(),
+            bmqt::CompressionAlgorithmType::e_NONE,
+            false);  // hasReceipt
+        return fs->writeMessageRecord(&attributes,
+                                      handle,
+                                      guid,
+                                      appData,
+                                      bsl::shared_ptr<bdlbb::Blob>(),
+                                      queueKey);
+    }
+
     // ACCESSORS
     mqbs::FileStore& fileStore() const { return *(d_fs_mp); }
 
+    bdlmt::EventScheduler& scheduler() { return d_scheduler; }
+
     mqbnet::ClusterNode* node() const { return d_node_p; }
 };
 
+/// Return true if the record having the specified `handle` in the
+/// specified `fs` has a receipt, waiting for it at most the specified
+/// `timeout`.
+bool waitForReceipt(const mqbs::FileStore&             fs,
+                    const mqbs::DataStoreRecordHandle& handle,
+                    const bsls::TimeInterval&          timeout)
+{
+    const bsls::TimeInterval deadline = mwcsys::Time::nowMonotonicClock() +
+                                        timeout;
+    while (!fs.hasReceipt(handle)) {
+        if (deadline < mwcsys::Time::nowMonotonicClock()) {
+            return false;  // RETURN
+        }
+        bslmt::ThreadUtil::microSleep(1000);  // 1ms
+    }
+    return true;
+}
+
 // ============================================================================
 //                                    TESTS
 // ----------------------------------------------------------------------------
@@ -974,6 +1141,190 @@ static void test2_printTest()
     fs.close();
 }
 
+static void test3_groupCommitWindow()
+// ------------------------------------------------------------------------
+// GROUP COMMIT WINDOW
+//
+// Concerns:
+//   When group commit is enabled, a message record requesting a receipt
+//   gets its local receipt only once synced to disk, which happens when
+//   the group commit window expires.
+//
+// Testing:
+//   writeMessageRecord
+//   hasReceipt
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("GROUP COMMIT WINDOW");
+
+    s_ignoreCheckDefAlloc = true;
+
+    const char k_FILE_STORE_LOCATION[] = "./test-cluster123-3";
+    const int  k_WINDOW_US             = 100 * 1000;  // 100ms
+
+    Tester tester(k_FILE_STORE_LOCATION,
+                  k_WINDOW_US,
+                  bsl::numeric_limits<int>::max());  // groupCommitMaxBytes
+
+    mqbs::FileStore& fs = tester.fileStore();
+    BSLS_ASSERT_OPT(fs.open() == 0);
+    BSLS_ASSERT_OPT(tester.scheduler().start() == 0);
+    fs.setPrimary(tester.node(), 1);
+
+    mqbs::DataStoreRecordHandle handle;
+    ASSERT_EQ(0, tester.writeMessageRecord(&fs, &handle));
+
+    // The window has not expired yet.
+    ASSERT_EQ(false, fs.hasReceipt(handle));
+
+    ASSERT_EQ(true, waitForReceipt(fs, handle, bsls::TimeInterval(5)));
+
+    fs.close();
+    tester.scheduler().stop();
+}
+
+static void test4_groupCommitMaxBytes()
+// ------------------------------------------------------------------------
+// GROUP COMMIT MAX BYTES
+//
+// Concerns:
+//   When group commit is enabled, a group commit starts as soon as the
+//   size of the records written since the last one reaches the configured
+//   maximum, without waiting for the end of the group commit window (which
+//   never expires here, as the scheduler is not started).
+//
+// Testing:
+//   writeMessageRecord
+//   hasReceipt
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("GROUP COMMIT MAX BYTES");
+
+    s_ignoreCheckDefAlloc = true;
+
+    const char k_FILE_STORE_LOCATION[] = "./test-cluster123-4";
+    const int  k_WINDOW_US             = 60 * 1000 * 1000;  // 60s
+
+    Tester tester(k_FILE_STORE_LOCATION,
+                  k_WINDOW_US,
+                  1);  // groupCommitMaxBytes
+
+    mqbs::FileStore& fs = tester.fileStore();
+    BSLS_ASSERT_OPT(fs.open() == 0);
+    fs.setPrimary(tester.node(), 1);
+
+    mqbs::DataStoreRecordHandle handle;
+    ASSERT_EQ(0, tester.writeMessageRecord(&fs, &handle));
+    ASSERT_EQ(true, waitForReceipt(fs, handle, bsls::TimeInterval(5)));
+
+    fs.close();
+}
+
+static void test5_groupCommitCloseInFlight()
+// ------------------------------------------------------------------------
+// GROUP COMMIT CLOSE IN FLIGHT
+//
+// Concerns:
+//   Closing the file store while a group commit is being executed waits
+//   for it to complete, and leaves no group commit in progress, so that
+//   group commits resume once the file store is opened again.
+//
+// Testing:
+//   close
+//   open
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("GROUP COMMIT CLOSE IN FLIGHT");
+
+    s_ignoreCheckDefAlloc = true;
+
+    const char k_FILE_STORE_LOCATION[] = "./test-cluster123-5";
+    const int  k_WINDOW_US             = 60 * 1000 * 1000;  // 60s
+
+    Tester tester(k_FILE_STORE_LOCATION,
+                  k_WINDOW_US,
+                  1);  // groupCommitMaxBytes
+
+    mqbs::FileStore& fs = tester.fileStore();
+    BSLS_ASSERT_OPT(fs.open() == 0);
+    fs.setPrimary(tester.node(), 1);
+
+    // The group commit starts as the record is written, and is in flight
+    // when closing.
+    mqbs::DataStoreRecordHandle handle;
+    ASSERT_EQ(0, tester.writeMessageRecord(&fs, &handle));
+    fs.close();
+    ASSERT_EQ(false, fs.isOpen());
+
+    BSLS_ASSERT_OPT(fs.open() == 0);
+    fs.setPrimary(tester.node(), 2);
+
+    mqbs::DataStoreRecordHandle nextHandle;
+    ASSERT_EQ(0, tester.writeMessageRecord(&fs, &nextHandle));
+    ASSERT_EQ(true, waitForReceipt(fs, nextHandle, bsls::TimeInterval(5)));
+
+    fs.close();
+}
+
+static void test6_groupCommitSyncFailure()
+// ------------------------------------------------------------------------
+// GROUP COMMIT SYNC FAILURE
+//
+// Concerns:
+//   When the sync of a group commit fails, the records it covers do not
+//   get their local receipt, and the group commit is retried after a
+//   while, until the sync succeeds and the local receipt is counted.
+//
+// Plan:
+//   Make the sync of the active data file fail, and write a message record
+//   starting a group commit.  Check that the record has no receipt after
+//   the initial attempt and a retry have failed.  Then let the sync
+//   succeed again, and check that the record gets its receipt once the
+//   next retry completes.
+//
+// Testing:
+//   writeMessageRecord
+//   hasReceipt
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("GROUP COMMIT SYNC FAILURE");
+
+    s_ignoreCheckDefAlloc = true;
+
+    const char k_FILE_STORE_LOCATION[] = "./test-cluster123-6";
+    const int  k_WINDOW_US             = 60 * 1000 * 1000;  // 60s
+
+    Tester tester(k_FILE_STORE_LOCATION,
+                  k_WINDOW_US,
+                  1);  // groupCommitMaxBytes
+
+    mqbs::FileStore& fs = tester.fileStore();
+    BSLS_ASSERT_OPT(fs.open() == 0);
+    BSLS_ASSERT_OPT(tester.scheduler().start() == 0);
+    fs.setPrimary(tester.node(), 1);
+
+    mqbs::FileStoreSet fileSet(s_allocator_p);
+    fs.loadCurrentFiles(&fileSet);
+
+    SyncFailureGuard syncFailure(fileSet.dataFile());
+    BSLS_ASSERT_OPT(syncFailure.isFailing());
+
+    // The group commit starts as the record is written, and fails.
+    mqbs::DataStoreRecordHandle handle;
+    ASSERT_EQ(0, tester.writeMessageRecord(&fs, &handle));
+
+    // Let the initial attempt and the first retry, 500ms later, fail.
+    bslmt::ThreadUtil::microSleep(0, 1);  // 1s
+    ASSERT_EQ(false, fs.hasReceipt(handle));
+
+    // The next retry, at most 500ms later, succeeds.
+    syncFailure.restore();
+    ASSERT_EQ(true, waitForReceipt(fs, handle, bsls::TimeInterval(5)));
+
+    fs.close();
+    tester.scheduler().stop();
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -990,6 +1341,10 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 6: test6_groupCommitSyncFailure(); break;
+    case 5: test5_groupCommitCloseInFlight(); break;
+    case 4: test4_groupCommitMaxBytes(); break;
+    case 3: test3_groupCommitWindow(); break;
     case 2: test2_printTest(); break;
     case 1: test1_breathingTest(); break;
     default: {
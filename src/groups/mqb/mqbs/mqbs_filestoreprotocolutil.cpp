@@ -28,6 +28,7 @@
 #include <bdlb_bigendian.h>
 #include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
+#include <bsl_cstring.h>
 #include <bsls_assert.h>
 
 namespace BloombergLP {
@@ -330,6 +331,49 @@ int FileStoreProtocolUtil::calculateMd5Digest(
     return 0;
 }
 
+int FileStoreProtocolUtil::copyAndCalculateMd5Digest(
+    bdlde::Md5::Md5Digest*    buffer,
+    char*                     destination,
+    const bdlbb::Blob&        blob,
+    const mwcu::BlobPosition& startPos,
+    unsigned int              length)
+{
+    BSLS_ASSERT_SAFE(buffer);
+    BSLS_ASSERT_SAFE(destination);
+    BSLS_ASSERT_SAFE(0 < length);
+    BSLS_ASSERT_SAFE(mwcu::BlobUtil::isValidPos(blob, startPos));
+
+    mwcu::BlobPosition endPos;
+    int                rc =
+        mwcu::BlobUtil::findOffsetSafe(&endPos, blob, startPos, length - 1);
+    if (0 != rc) {
+        return rc;  // RETURN
+    }
+
+    // Hash and copy each buffer of the blob in turn, while it is still in
+    // the cache, instead of making two passes over the whole section.
+
+    bdlde::Md5         hasher;
+    mwcu::BlobPosition pos(startPos);
+    while (length) {
+        unsigned int len = bsl::min(
+            static_cast<int>(length),
+            mwcu::BlobUtil::bufferSize(blob, pos.buffer()) - pos.byte());
+
+        const char* data = blob.buffer(pos.buffer()).data() + pos.byte();
+        hasher.update(data, len);
+        bsl::memcpy(destination, data, len);
+
+        destination += len;
+        pos.setBuffer(pos.buffer() + 1);
+        pos.setByte(0);
+        length -= len;
+    }
+
+    hasher.loadDigest(buffer);
+    return 0;
+}
+
 void FileStoreProtocolUtil::loadAppIdKeyPairs(
     bsl::vector<bsl::pair<bsl::string, mqbu::StorageKey> >* appIdKeyPairs,
     const MemoryBlock&                                      appIdsBlock,
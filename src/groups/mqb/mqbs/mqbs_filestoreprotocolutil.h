@@ -108,6 +108,21 @@ struct FileStoreProtocolUtil {
                                   const mwcu::BlobPosition& startPos,
                                   unsigned int              length);
 
+    /// Copy to the specified `destination` the section of the specified
+    /// `blob` of the specified `length` starting at the specified
+    /// `startPos` position, and load into the specified `buffer` the MD5
+    /// digest of that section, reading the section only once.  Return zero
+    /// on success, non-zero value otherwise, in which case nothing is
+    /// copied.  Behavior is undefined unless `buffer` and `destination` are
+    /// non null, and `destination` has room for at least `length` bytes.
+    /// Behavior is also undefined unless `startPos` represents a valid
+    /// position in the `blob` and `length` is non-zero.
+    static int copyAndCalculateMd5Digest(bdlde::Md5::Md5Digest*    buffer,
+                                         char*                     destination,
+                                         const bdlbb::Blob&        blob,
+                                         const mwcu::BlobPosition& startPos,
+                                         unsigned int              length);
+
     static void loadAppIdKeyPairs(
         bsl::vector<bsl::pair<bsl::string, mqbu::StorageKey> >* appIdKeyPairs,
         const MemoryBlock&                                      appIdsBlock,
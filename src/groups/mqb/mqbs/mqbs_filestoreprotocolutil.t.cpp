@@ -897,6 +897,75 @@ static void test5_calculateMd5Digest()
     }
 }
 
+static void test6_copyAndCalculateMd5Digest()
+// ------------------------------------------------------------------------
+// Testing:
+//   copyAndCalculateMd5Digest()
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("COPY AND CALCULATE MD5 DIGEST");
+
+    bsl::string data("12345678901234567890", s_allocator_p);
+    bsl::string md5("fd85e62d9beb45428771ec688418b271", s_allocator_p);
+    bsl::string md5b(s_allocator_p);
+    bytesFromHex(&md5b, md5);
+
+    // Blob made of several buffers
+    bdlbb::PooledBlobBufferFactory myLittleFactory(7, s_allocator_p);
+    bdlbb::Blob                    blob(&myLittleFactory, s_allocator_p);
+    blob.setLength(data.size());
+    for (int index = 0; index < blob.numBuffers(); ++index) {
+        bsl::memcpy(blob.buffer(index).data(),
+                    data.c_str() + index * 7,
+                    bsl::min(static_cast<bsl::size_t>(7),
+                             data.size() - index * 7));
+    }
+
+    {
+        PVV("Whole blob");
+        bdlde::Md5::Md5Digest buffer;
+        bsl::string           destination(data.size(), '\0', s_allocator_p);
+
+        int rc = mqbs::FileStoreProtocolUtil::copyAndCalculateMd5Digest(
+            &buffer,
+            &destination[0],
+            blob,
+            mwcu::BlobPosition(),
+            data.size());
+        ASSERT_EQ(0, rc);
+        bsl::string result(buffer.buffer(), MD5_DIGEST_BYTES, s_allocator_p);
+        ASSERT_EQ(result, md5b);
+        ASSERT_EQ(destination, data);
+    }
+
+    {
+        PVV("Section of the blob");
+        const unsigned int    offset = 5;
+        const unsigned int    length = 11;
+        bdlde::Md5::Md5Digest expected;
+        bdlde::Md5::Md5Digest buffer;
+        bsl::string           destination(length, '\0', s_allocator_p);
+
+        ASSERT_EQ(0,
+                  mqbs::FileStoreProtocolUtil::calculateMd5Digest(
+                      &expected,
+                      blob,
+                      mwcu::BlobPosition(0, offset),
+                      length));
+
+        int rc = mqbs::FileStoreProtocolUtil::copyAndCalculateMd5Digest(
+            &buffer,
+            &destination[0],
+            blob,
+            mwcu::BlobPosition(0, offset),
+            length);
+        ASSERT_EQ(0, rc);
+        ASSERT_EQ(expected, buffer);
+        ASSERT_EQ(destination,
+                  bsl::string(data, offset, length, s_allocator_p));
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -910,6 +979,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 6: test6_copyAndCalculateMd5Digest(); break;
     case 5: test5_calculateMd5Digest(); break;
     case 4: test4_loadAppIdKeyPairs(); break;
     case 3: test3_lastJournalSyncPoint(); break;
@@ -38,6 +38,7 @@
 #include <bdlb_string.h>
 #include <bdlf_bind.h>
 #include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_datetimeutil.h>
 #include <bdlt_epochutil.h>
@@ -45,9 +46,12 @@
 #include <bsl_cstddef.h>
 #include <bsl_cstring.h>
 #include <bsl_ctime.h>
+#include <bsl_fstream.h>
 #include <bsl_iostream.h>
 #include <bslim_printer.h>
+#include <bslmt_threadutil.h>
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
 
@@ -63,6 +67,46 @@ namespace mqbs {
 
 namespace {
 
+/// Whether a clean up of archived files is in progress.  Clean ups run off
+/// the scheduler's dispatcher thread, possibly on several threads at once,
+/// and must not race deleting the same files.
+bsls::AtomicBool s_isArchiveCleanupInProgress(false);
+
+// =========================
+// class ArchiveCleanupGuard
+// =========================
+
+/// Guard marking a clean up of archived files as in progress, if no other
+/// one is, for its lifetime.
+class ArchiveCleanupGuard {
+  private:
+    // DATA
+    bool d_isAcquired;
+
+  private:
+    // NOT IMPLEMENTED
+    ArchiveCleanupGuard(const ArchiveCleanupGuard&);
+    ArchiveCleanupGuard& operator=(const ArchiveCleanupGuard&);
+
+  public:
+    // CREATORS
+    ArchiveCleanupGuard()
+    : d_isAcquired(!s_isArchiveCleanupInProgress.testAndSwap(false, true))
+    {
+        // NOTHING
+    }
+
+    ~ArchiveCleanupGuard()
+    {
+        if (d_isAcquired) {
+            s_isArchiveCleanupInProgress = false;
+        }
+    }
+
+    // ACCESSORS
+    bool isAcquired() const { return d_isAcquired; }
+};
+
 /// Append the specified `value` to `result` in YYYYMMDD_HHMMSS format.
 void appendFormattedDatetime(bsl::string* result, const bdlt::Datetime& value)
 {
@@ -108,6 +152,7 @@ int openFileSet(bsl::ostream&         errorDescription,
                 const FileStoreSet&   fileSet,
                 bool                  readOnly,
                 bool                  prefaultPages,
+                bool                  persistentMemory,
                 MappedFileDescriptor* journalFd = 0,
                 MappedFileDescriptor* dataFd    = 0,
                 MappedFileDescriptor* qlistFd   = 0)
@@ -142,7 +187,8 @@ int openFileSet(bsl::ostream&         errorDescription,
                                   fileSet.journalFileSize(),
                                   readOnly,
                                   errorDescription,
-                                  prefaultPages);
+                                  prefaultPages,
+                                  persistentMemory);
         if (0 != rc) {
             return 10 * rc + rc_JOURNAL_OPEN_FAILURE;  // RETURN
         }
@@ -154,7 +200,8 @@ int openFileSet(bsl::ostream&         errorDescription,
                                   fileSet.dataFileSize(),
                                   readOnly,
                                   errorDescription,
-                                  prefaultPages);
+                                  prefaultPages,
+                                  persistentMemory);
 
         if (0 != rc) {
             if (journalFd) {
@@ -170,7 +217,8 @@ int openFileSet(bsl::ostream&         errorDescription,
                                   fileSet.qlistFileSize(),
                                   readOnly,
                                   errorDescription,
-                                  prefaultPages);
+                                  prefaultPages,
+                                  persistentMemory);
 
         if (0 != rc) {
             if (journalFd) {
@@ -563,7 +611,8 @@ int FileStoreUtil::create(bsl::ostream&            errorDescription,
                                   &result->d_journalFile,
                                   &result->d_dataFile,
                                   needQList ? &result->d_qlistFile : 0,
-                                  dataStoreConfig.hasPrefaultPages());
+                                  dataStoreConfig.hasPrefaultPages(),
+                                  dataStoreConfig.hasPersistentMemory());
 
     if (0 != rc) {
         errorDescription << partitionDesc << " Failed to open file set in "
@@ -797,10 +846,12 @@ int FileStoreUtil::findFileSets(bsl::vector<FileStoreSet>* fileSets,
     return 0;
 }
 
-void FileStoreUtil::deleteArchiveFiles(int                partitionId,
-                                       const bsl::string& archiveLocation,
-                                       int                maxArchivedFileSets,
-                                       const bsl::string& cluster)
+void FileStoreUtil::deleteArchiveFilesImp(
+    int                partitionId,
+    const bsl::string& archiveLocation,
+    int                maxArchivedFileSets,
+    const bsl::string& tierLocation,
+    const bsl::string& cluster)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(0 <= partitionId);
@@ -846,7 +897,25 @@ void FileStoreUtil::deleteArchiveFiles(int                partitionId,
                   << "], deleting " << numFilesToDelete << " files.";
 
     for (unsigned int i = 0; i < numFilesToDelete; ++i) {
-        rc = bdls::FilesystemUtil::remove(archivedFiles[i]);
+        if (!tierLocation.empty()) {
+            rc = offloadFile(archivedFiles[i], tierLocation);
+            if (0 != rc) {
+                MWCTSK_ALARMLOG_ALARM("FILE_IO")
+                    << cluster << ": Failed to offload [" << archivedFiles[i]
+                    << "] file to [" << tierLocation << "] during archived "
+                    << "storage cleanup for PartitionId [" << partitionId
+                    << "], rc: " << rc << MWCTSK_ALARMLOG_END;
+                continue;  // CONTINUE
+            }
+
+            BALL_LOG_INFO << cluster << ": Offloaded file ["
+                          << archivedFiles[i] << "] to [" << tierLocation
+                          << "] during archived storage cleanup for "
+                          << "PartitionId [" << partitionId << "].";
+            continue;  // CONTINUE
+        }
+
+        rc = removeFileGradually(archivedFiles[i]);
         if (0 != rc) {
             MWCTSK_ALARMLOG_ALARM("FILE_IO")
                 << cluster << ": Failed to remove [" << archivedFiles[i]
@@ -862,6 +931,27 @@ void FileStoreUtil::deleteArchiveFiles(int                partitionId,
     }
 }
 
+void FileStoreUtil::deleteArchiveFiles(int                partitionId,
+                                       const bsl::string& archiveLocation,
+                                       int                maxArchivedFileSets,
+                                       const bsl::string& tierLocation,
+                                       const bsl::string& cluster)
+{
+    ArchiveCleanupGuard guard;
+    if (!guard.isAcquired()) {
+        BALL_LOG_INFO << cluster << ": PartitionId [" << partitionId
+                      << "], skipping archived storage cleanup already in "
+                      << "progress.";
+        return;  // RETURN
+    }
+
+    deleteArchiveFilesImp(partitionId,
+                          archiveLocation,
+                          maxArchivedFileSets,
+                          tierLocation,
+                          cluster);
+}
+
 void FileStoreUtil::deleteArchiveFiles(
     const mqbcfg::PartitionConfig& partitionCfg,
     const bsl::string&             cluster)
@@ -884,17 +974,128 @@ void FileStoreUtil::deleteArchiveFiles(
         return;  // RETURN
     }
 
+    ArchiveCleanupGuard guard;
+    if (!guard.isAcquired()) {
+        BALL_LOG_INFO << cluster << ": Skipping archived storage cleanup "
+                      << "already in progress.";
+        return;  // RETURN
+    }
+
     const unsigned int numPartitions = static_cast<unsigned int>(
         partitionCfg.numPartitions());
 
     for (unsigned int pid = 0; pid < numPartitions; ++pid) {
-        deleteArchiveFiles(pid,
-                           archiveLocation,
-                           partitionCfg.maxArchivedFileSets(),
-                           cluster);
+        deleteArchiveFilesImp(pid,
+                              archiveLocation,
+                              partitionCfg.maxArchivedFileSets(),
+                              partitionCfg.tierLocation(),
+                              cluster);
     }
 }
 
+int FileStoreUtil::removeFileGradually(const bsl::string& file)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS       = 0,
+        rc_REMOVE_FAILED = -1
+    };
+
+    // Shrink the file first, unless that would also shrink another link to
+    // it.  Failing to shrink it is not an error: it is then removed as is.
+    struct ::stat st;
+    if (0 == ::stat(file.c_str(), &st) && 1 == st.st_nlink &&
+        S_ISREG(st.st_mode)) {
+        bsls::Types::Int64 size = st.st_size;
+        while (size > k_REMOVE_STEP_SIZE) {
+            size -= k_REMOVE_STEP_SIZE;
+            if (0 != ::truncate(file.c_str(), size)) {
+                BALL_LOG_WARN << "Failed to shrink [" << file << "] to "
+                              << size << " bytes before removing it, errno: "
+                              << errno << " [" << bsl::strerror(errno)
+                              << "].";
+                break;  // BREAK
+            }
+            bslmt::ThreadUtil::microSleep(k_REMOVE_STEP_PAUSE_MS * 1000);
+        }
+    }
+
+    if (0 != bdls::FilesystemUtil::remove(file)) {
+        return rc_REMOVE_FAILED;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+int FileStoreUtil::offloadFile(const bsl::string& file,
+                               const bsl::string& tierLocation)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS        = 0,
+        rc_NO_LEAF        = -1,
+        rc_APPEND_FAILURE = -2,
+        rc_OPEN_FAILURE   = -3,
+        rc_COPY_FAILURE   = -4,
+        rc_RENAME_FAILURE = -5,
+        rc_REMOVE_FAILURE = -6
+    };
+
+    bsl::string leaf;
+    int         rc = bdls::PathUtil::getLeaf(&leaf, file);
+    if (0 != rc) {
+        return rc * 10 + rc_NO_LEAF;  // RETURN
+    }
+
+    bsl::string target(tierLocation);
+    rc = bdls::PathUtil::appendIfValid(&target, leaf);
+    if (0 != rc) {
+        return rc * 10 + rc_APPEND_FAILURE;  // RETURN
+    }
+
+    // Fast path: 'tierLocation' is on the same file system.
+
+    if (0 == bdls::FilesystemUtil::move(file, target)) {
+        return rc_SUCCESS;  // RETURN
+    }
+
+    const bsl::string partial(target + ".part");
+    {
+        bsl::ifstream in(file.c_str(), bsl::ios::in | bsl::ios::binary);
+        if (!in) {
+            return rc_OPEN_FAILURE;  // RETURN
+        }
+
+        bsl::ofstream out(partial.c_str(),
+                          bsl::ios::out | bsl::ios::binary |
+                              bsl::ios::trunc);
+        if (!out) {
+            return rc_OPEN_FAILURE;  // RETURN
+        }
+
+        out << in.rdbuf();
+        out.flush();
+        if (!out) {
+            out.close();
+            bdls::FilesystemUtil::remove(partial);
+            return rc_COPY_FAILURE;  // RETURN
+        }
+    }
+
+    rc = bdls::FilesystemUtil::move(partial, target);
+    if (0 != rc) {
+        bdls::FilesystemUtil::remove(partial);
+        return rc * 10 + rc_RENAME_FAILURE;  // RETURN
+    }
+
+    rc = bdls::FilesystemUtil::remove(file);
+    if (0 != rc) {
+        return rc * 10 + rc_REMOVE_FAILURE;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
 int FileStoreUtil::openFileSetReadMode(bsl::ostream&         errorDescription,
                                        const FileStoreSet&   fileSet,
                                        MappedFileDescriptor* journalFd,
@@ -908,6 +1109,7 @@ int FileStoreUtil::openFileSetReadMode(bsl::ostream&         errorDescription,
                        fileSet,
                        true,   // readOnly
                        false,  // prefaultPages
+                       false,  // persistentMemory
                        journalFd,
                        dataFd,
                        qlistFd);
@@ -920,7 +1122,8 @@ int FileStoreUtil::openFileSetWriteMode(bsl::ostream&         errorDescription,
                                         MappedFileDescriptor* journalFd,
                                         MappedFileDescriptor* dataFd,
                                         MappedFileDescriptor* qlistFd,
-                                        bool                  prefaultPages)
+                                        bool                  prefaultPages,
+                                        bool                  persistentMemory)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(journalFd || dataFd || qlistFd);
@@ -944,6 +1147,7 @@ int FileStoreUtil::openFileSetWriteMode(bsl::ostream&         errorDescription,
                          fileSet,
                          false,  // readOnly
                          prefaultPages,
+                         persistentMemory,
                          journalFd,
                          dataFd,
                          qlistFd);
@@ -1106,7 +1310,8 @@ int FileStoreUtil::openRecoveryFileSet(bsl::ostream&         errorDescription,
                                       journalFd,
                                       dataFd,
                                       qlistFd,
-                                      config.hasPrefaultPages());
+                                      config.hasPrefaultPages(),
+                                      config.hasPersistentMemory());
         }
 
         if (rc != 0) {
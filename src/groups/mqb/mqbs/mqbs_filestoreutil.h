@@ -46,6 +46,7 @@
 #include <bsl_string.h>
 #include <bsl_vector.h>
 #include <bslma_allocator.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 namespace mqbs {
@@ -82,6 +83,14 @@ struct FileStoreUtil {
   public:
     typedef bsl::shared_ptr<FileSet> FileSetSp;
 
+    // CONSTANTS
+
+    /// Number of bytes freed at each step by `removeFileGradually`.
+    static const bsls::Types::Int64 k_REMOVE_STEP_SIZE = 256 * 1024 * 1024;
+
+    /// Pause, in milliseconds, between two steps of `removeFileGradually`.
+    static const int k_REMOVE_STEP_PAUSE_MS = 20;
+
   private:
     // PRIVATE CLASS METHODS
 
@@ -94,6 +103,14 @@ struct FileStoreUtil {
                                const bsl::vector<bsl::string>& files,
                                bool                            withSize);
 
+    /// Implementation of `deleteArchiveFiles` for the specified
+    /// `partitionId`, once no other clean up is in progress.
+    static void deleteArchiveFilesImp(int                partitionId,
+                                      const bsl::string& archiveLocation,
+                                      int                maxArchivedFileSets,
+                                      const bsl::string& tierLocation,
+                                      const bsl::string& cluster);
+
   public:
     // CLASS METHODS
 
@@ -201,19 +218,47 @@ struct FileStoreUtil {
     /// Delete the archived files located at the specified `archiveLocation`
     /// belonging to the specified `partitionId` of the specified `cluster`
     /// and keep at most a maximum of the specified `maxArchivedFileSets`.
-    /// Behavior is undefined unless `archiveLocation` exists and is a
-    /// directory.  Note that `cluster` is used for logging purposes only.
+    /// If the specified `tierLocation` is not empty, offload the files to
+    /// `tierLocation` instead of deleting them.  Behavior is undefined
+    /// unless `archiveLocation` exists and is a directory.  Note that
+    /// `cluster` is used for logging purposes only.  Note also that files
+    /// are removed with `removeFileGradually`, so this method may take a
+    /// while and should not be called from a latency-sensitive thread, and
+    /// that it returns without doing anything if another clean up of
+    /// archived files is already in progress.
     static void deleteArchiveFiles(int                partitionId,
                                    const bsl::string& archiveLocation,
                                    int                maxArchivedFileSets,
+                                   const bsl::string& tierLocation,
                                    const bsl::string& cluster);
 
-    /// Delete the archived files belonging to *all* partitions in the
-    /// specified `partitionCfg` of the specified `cluster`.  Note that
-    /// `cluster` is used for logging purposes only.
+    /// Delete, or offload to its tier location, the archived files
+    /// belonging to *all* partitions in the specified `partitionCfg` of the
+    /// specified `cluster`.  Note that `cluster` is used for logging
+    /// purposes only.  Note also that, as above, this method may take a
+    /// while, and returns without doing anything if another clean up of
+    /// archived files is already in progress.
     static void deleteArchiveFiles(const mqbcfg::PartitionConfig& partitionCfg,
                                    const bsl::string&             cluster);
 
+    /// Remove the specified `file`, first shrinking it from its end by
+    /// steps of `k_REMOVE_STEP_SIZE` bytes, pausing between steps, unless
+    /// it has other links.  Return 0 on success, and a non-zero value
+    /// otherwise.  Note that unlinking a multi-gigabyte file can block for
+    /// a long time on some file systems, stalling other writers to the same
+    /// file system while its blocks are freed, whereas freeing them in
+    /// small, spaced out steps does not.
+    static int removeFileGradually(const bsl::string& file);
+
+    /// Move the specified `file` to the specified `tierLocation`, copying
+    /// it if `tierLocation` is on a different file system than `file`.
+    /// Return 0 on success, and a non-zero value otherwise, in which case
+    /// `file` is left in place.  Note that the copy is made under a
+    /// temporary name and renamed once complete, so that a partially
+    /// offloaded file is never visible under its final name.
+    static int offloadFile(const bsl::string& file,
+                           const bsl::string& tierLocation);
+
     /// Populate the optionally specified `journalFd`, `dataFd` and
     /// `qlistFd` file descriptors with the corresponding journal, data and
     /// qlist file representations respectively **if specified**, and open
@@ -239,7 +284,10 @@ struct FileStoreUtil {
     /// for logging purposes.  If the specified `preallocate` flag is true,
     /// reserve the space for the files on disk.  If the specified
     /// `deleteOnFailure` flag is true, delete the files on disk on failure.
-    /// Note that in case of errors, this method closes any files it opened.
+    /// If the optionally specified `persistentMemory` flag is true, attempt
+    /// to map the files onto persistent memory (see
+    /// `FileSystemUtil::open`).  Note that in case of errors, this method
+    /// closes any files it opened.
     static int openFileSetWriteMode(bsl::ostream&         errorDescription,
                                     const FileStoreSet&   fileSet,
                                     bool                  preallocate,
@@ -247,7 +295,8 @@ struct FileStoreUtil {
                                     MappedFileDescriptor* journalFd = 0,
                                     MappedFileDescriptor* dataFd    = 0,
                                     MappedFileDescriptor* qlistFd   = 0,
-                                    bool prefaultPages              = false);
+                                    bool prefaultPages              = false,
+                                    bool persistentMemory           = false);
 
     /// Validate the journal, qlist and data files represented by the
     /// specified `journalFd`, `qlistFd` and `dataFd` respectively.
@@ -73,17 +73,23 @@ struct FileSystemUtil {
 
     /// Open the specified `filename` and map *at* *least* `fileSize` bytes
     /// of the file, and populate the specified `mfd` to represent the
-    /// mapped file respecting the specified `readOnly` flag.  Return zero
-    /// on success, non-zero otherwise with the specified `errorDescription`
-    /// containing a detailed error.  Note that the mapped region may be
-    /// greater than `fileSize` if `fileSize` is not a multiple of page
-    /// size.
+    /// mapped file respecting the specified `readOnly` flag.  If the
+    /// optionally specified `persistentMemory` flag is true and `readOnly`
+    /// is false, attempt to map the file synchronously (`MAP_SYNC`), which
+    /// only succeeds if the file resides on a DAX mount of persistent
+    /// memory, in which case `mfd.isPersistentMemory()` is true and the
+    /// writes to the mapping are made durable with `persist`; otherwise,
+    /// log a warning and map the file regularly.  Return zero on success,
+    /// non-zero otherwise with the specified `errorDescription` containing
+    /// a detailed error.  Note that the mapped region may be greater than
+    /// `fileSize` if `fileSize` is not a multiple of page size.
     static int open(MappedFileDescriptor* mfd,
                     const char*           filename,
                     bsls::Types::Uint64   fileSize,
                     bool                  readOnly,
                     bsl::ostream&         errorDescription,
-                    bool                  prefaultPages = false);
+                    bool                  prefaultPages    = false,
+                    bool                  persistentMemory = false);
 
     /// Unmap and close the file represented by the specified `mfd`.  Return
     /// zero on success, non-zero value otherwise.  The `mfd` is reset
@@ -141,6 +147,19 @@ struct FileSystemUtil {
                          bsls::Types::Uint64 length,
                          bsl::ostream&       errorDescription);
 
+    /// Deallocate the disk space of the specified `length` bytes starting
+    /// at the specified `offset` in the file represented by the specified
+    /// `fd`, without changing the size of the file, so that subsequent
+    /// reads of that range return zeros.  Return zero on success, non-zero
+    /// value otherwise with the specified `errorDescription` containing a
+    /// detailed error.  Note that return value of `1` is reserved to
+    /// indicate the absence of support for punching holes in the underlying
+    /// OS/file-system.
+    static int punchHole(int                 fd,
+                         bsls::Types::Uint64 offset,
+                         bsls::Types::Uint64 length,
+                         bsl::ostream&       errorDescription);
+
     /// Execute the `madvise` system call using the specified `mapping`,
     /// `size`, and `advice`.
     static void madvise(void* mapping, bsls::Types::Uint64 size, int advice);
@@ -152,6 +171,76 @@ struct FileSystemUtil {
                      bsls::Types::Uint64 size,
                      bsl::ostream&       errorDescription);
 
+    /// Start the write back to disk of the dirty pages of the file
+    /// represented by the specified `mfd` in the range starting at the
+    /// specified `offset` and of the specified `length` bytes, without
+    /// waiting for it to complete.  Return zero on success, a non-zero
+    /// value otherwise with the specified `errorDescription` containing a
+    /// detailed error.  Note that this method does not provide any
+    /// durability guarantee, but bounds the amount of dirty pages that a
+    /// subsequent `flush` (or the kernel) has to write back at once.
+    static int writeBack(const MappedFileDescriptor& mfd,
+                         bsls::Types::Uint64         offset,
+                         bsls::Types::Uint64         length,
+                         bsl::ostream&               errorDescription);
+
+    /// Ask the OS to start reading into the page cache, without waiting for
+    /// it, the range starting at the specified `offset` and of the
+    /// specified `length` bytes of the file represented by the specified
+    /// `mfd`, so that a subsequent access to the mapping of that range does
+    /// not stall on a page fault.  Return zero on success, a non-zero value
+    /// otherwise with the specified `errorDescription` containing a
+    /// detailed error.
+    static int readAhead(const MappedFileDescriptor& mfd,
+                         bsls::Types::Uint64         offset,
+                         bsls::Types::Uint64         length,
+                         bsl::ostream&               errorDescription);
+
+    /// Synchronously write back to disk the data of the file represented by
+    /// the specified `mfd` (but not necessarily its metadata, which is not
+    /// needed to read the data back as the file is never resized while it
+    /// is mapped).  Return zero on success, a non-zero value otherwise with
+    /// the specified `errorDescription` containing a detailed error.
+    static int syncData(const MappedFileDescriptor& mfd,
+                        bsl::ostream&               errorDescription);
+
+    /// Make durable the range starting at the specified `offset` and of the
+    /// specified `length` bytes of the mapping of the file represented by
+    /// the specified `mfd`, which is mapped onto persistent memory, by
+    /// writing back to the memory the CPU cache lines covering the range
+    /// (using `clwb`, or `clflushopt` or `clflush` on older CPUs) and
+    /// waiting for the write back to complete (`sfence`).  Return zero on
+    /// success, a non-zero value otherwise with the specified
+    /// `errorDescription` containing a detailed error.  The behavior is
+    /// undefined unless `mfd.isPersistentMemory()` is true.  Note that on
+    /// platforms other than x86-64, the range is synced with `msync`.
+    static int persist(const MappedFileDescriptor& mfd,
+                       bsls::Types::Uint64         offset,
+                       bsls::Types::Uint64         length,
+                       bsl::ostream&               errorDescription);
+
+    /// Advise the OS to back the mapping of the file represented by the
+    /// specified `mfd` with huge pages, in order to reduce TLB misses when
+    /// accessing it.  Return zero on success, a non-zero value otherwise
+    /// with the specified `errorDescription` containing a detailed error.
+    /// Note that return value of `1` is reserved to indicate the absence of
+    /// support for transparent huge pages on this platform.  Also note that
+    /// this is only a hint: depending on the file system and on the
+    /// transparent huge pages configuration of the host, the OS may back
+    /// none or only part of the mapping with huge pages (see
+    /// `loadHugePageBackedSize`).
+    static int adviseHugePages(const MappedFileDescriptor& mfd,
+                               bsl::ostream&               errorDescription);
+
+    /// Load into the specified `size` the number of bytes of the mapping of
+    /// the file represented by the specified `mfd` which are currently
+    /// backed by huge pages.  Return zero on success, and a non-zero value
+    /// otherwise, in which case `size` is unchanged.  Note that this method
+    /// reads `/proc/self/smaps`, and that return value of `1` is reserved
+    /// to indicate that this is not supported on this platform.
+    static int loadHugePageBackedSize(bsls::Types::Uint64*        size,
+                                      const MappedFileDescriptor& mfd);
+
     /// Indicate to the OS not to dump the specified `mapping` of the
     /// specified `size` to file.  Note that this method only has effect if
     /// on Linux and the `MADV_DONTDUMP` flag is defined.
@@ -25,13 +25,19 @@
 // MWC
 #include <mwcma_countingallocatorstore.h>
 #include <mwcsys_time.h>
+#include <mwctsk_alarmlog.h>
+#include <mwcu_memoutstream.h>
 #include <mwcu_printutil.h>
 
 // BDE
+#include <bdlbb_blobutil.h>
 #include <bsl_algorithm.h>
+#include <bsl_c_errno.h>
+#include <bsl_cstring.h>
 #include <bsl_iostream.h>
 #include <bsl_utility.h>
 #include <bslma_allocator.h>
+#include <bsls_alignmentutil.h>
 #include <bsls_annotation.h>
 #include <bsls_assert.h>
 
@@ -42,12 +48,167 @@ namespace {
 
 const int k_GC_MESSAGES_BATCH_SIZE = 1000;  // how many to process in one run
 
+const int k_SEGMENT_MAX_BLOB_RATIO = 4;
+// Blobs larger than 1/k_SEGMENT_MAX_BLOB_RATIO of the segment size are not
+// copied into segments, to bound the space wasted at the end of a segment.
+
+}
+
+// ---------------------------
+// class InMemoryStorage_Arena
+// ---------------------------
+
+// CREATORS
+InMemoryStorage_Arena::InMemoryStorage_Arena(bslma::Allocator* allocator)
+: d_segment_sp()
+, d_segmentSize(0)
+, d_offset(0)
+, d_allocator_p(allocator)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+void InMemoryStorage_Arena::setSegmentSize(int value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= value);
+
+    if (value == d_segmentSize) {
+        return;  // RETURN
+    }
+
+    d_segmentSize = value;
+    d_segment_sp.reset();
+    d_offset = 0;
+}
+
+bsl::shared_ptr<bdlbb::Blob>
+InMemoryStorage_Arena::copy(const bsl::shared_ptr<bdlbb::Blob>& blob)
+{
+    const int length = blob ? blob->length() : 0;
+    if (0 == length || length > d_segmentSize / k_SEGMENT_MAX_BLOB_RATIO) {
+        return blob;  // RETURN
+    }
+
+    // Keep every copy maximally aligned, so that readers of the payload are
+    // not penalized compared to a payload received in its own buffer.
+    const int alignedLength = static_cast<int>(
+        bsls::AlignmentUtil::roundUpToMaximalAlignment(length));
+
+    if (!d_segment_sp || d_offset + alignedLength > d_segmentSize) {
+        // Leave the current segment to the blobs still referring to it, and
+        // start a new one.
+        d_segment_sp = bslstl::SharedPtrUtil::createInplaceUninitializedBuffer(
+            d_segmentSize,
+            d_allocator_p);
+        d_offset = 0;
+    }
+
+    char* data = d_segment_sp.get() + d_offset;
+    bdlbb::BlobUtil::copy(data, *blob, 0, length);
+    d_offset += alignedLength;
+
+    bsl::shared_ptr<bdlbb::Blob> result;
+    result.createInplace(d_allocator_p, d_allocator_p);
+    result->appendDataBuffer(
+        bdlbb::BlobBuffer(bsl::shared_ptr<char>(d_segment_sp, data), length));
+
+    return result;
 }
 
 // ---------------------
 // class InMemoryStorage
 // ---------------------
 
+// PRIVATE MANIPULATORS
+void InMemoryStorage::insertItem(
+    const bmqt::MessageGUID&              msgGUID,
+    const bsl::shared_ptr<bdlbb::Blob>&   appData,
+    const bsl::shared_ptr<bdlbb::Blob>&   options,
+    const mqbi::StorageMessageAttributes& attributes)
+{
+    const int          length      = appData ? appData->length() : 0;
+    bsls::Types::Int64 spillOffset = -1;
+
+    if (d_spillLog.isOpen() && !d_isSpillSuspended && 0 < length &&
+        d_capacityMeter.isHighWatermarkReached()) {
+        if (0 != d_spillLog.append(&spillOffset, *appData)) {
+            // Keep the payload in memory, and stop trying until the spill log
+            // is cleared rather than failing on every message.
+            BALL_LOG_WARN << "#STORAGE_SPILL_FAILURE "
+                          << "Failed to spill a message of queue '"
+                          << queueUri() << "' & queueKey '" << queueKey()
+                          << "', spilling suspended until the "
+                          << d_numSpilledItems
+                          << " spilled messages are removed.";
+            d_isSpillSuspended = true;
+            spillOffset        = -1;
+        }
+    }
+
+    if (spillOffset < 0) {
+        d_items.insert(bsl::make_pair(msgGUID,
+                                      Item(d_arena.copy(appData),
+                                           d_arena.copy(options),
+                                           attributes)),
+                       attributes.arrivalTimepoint());
+        return;  // RETURN
+    }
+
+    Item item(bsl::shared_ptr<bdlbb::Blob>(),
+              d_arena.copy(options),
+              attributes);
+    item.setSpilled(spillOffset, length);
+    d_items.insert(bsl::make_pair(msgGUID, item),
+                   attributes.arrivalTimepoint());
+    ++d_numSpilledItems;
+}
+
+void InMemoryStorage::onItemErased(const Item& item)
+{
+    if (!item.isSpilled()) {
+        return;  // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(0 < d_numSpilledItems);
+
+    if (0 == --d_numSpilledItems) {
+        d_spillLog.clear();
+        d_isSpillSuspended = false;
+    }
+}
+
+// PRIVATE ACCESSORS
+int InMemoryStorage::loadAppData(bsl::shared_ptr<bdlbb::Blob>* appData,
+                                 const bmqt::MessageGUID&      msgGUID,
+                                 const Item&                   item) const
+{
+    if (!item.isSpilled()) {
+        *appData = item.appData();
+        return 0;  // RETURN
+    }
+
+    const int rc = d_spillLog.read(appData,
+                                   item.spillOffset(),
+                                   item.appDataLength());
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 != rc)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        const int errorNum = errno;
+        appData->reset();
+        MWCTSK_ALARMLOG_ALARM("STORAGE")
+            << "Failed to read back the spilled payload of message '"
+            << msgGUID << "' of queue '" << queueUri() << "' & queueKey '"
+            << queueKey() << "', rc: " << rc << ", errno: " << errorNum
+            << " [" << bsl::strerror(errorNum)
+            << "]. The message will not be delivered."
+            << MWCTSK_ALARMLOG_END;
+    }
+
+    return rc;
+}
+
 // CREATORS
 InMemoryStorage::InMemoryStorage(const bmqt::Uri&        uri,
                                  const mqbu::StorageKey& queueKey,
@@ -70,8 +231,14 @@ InMemoryStorage::InMemoryStorage(const bmqt::Uri&        uri,
               .addMilliseconds(config.deduplicationTimeMs())
               .totalNanoseconds(),
           allocatorStore ? allocatorStore->get("Handles") : d_allocator_p)
+, d_arena(allocatorStore ? allocatorStore->get("Segments") : d_allocator_p)
+, d_spillLocation(d_allocator_p)
+, d_spillLog(d_allocator_p)
+, d_numSpilledItems(0)
+, d_isSpillSuspended(false)
 , d_virtualStorageCatalog(
       this,
+      VirtualStorageCatalog::AppStatesMode::e_STORAGE,
       allocatorStore ? allocatorStore->get("VirtualHandles") : d_allocator_p)
 , d_ttlSeconds(config.messageTtl())
 , d_emptyAppId(allocator)
@@ -80,6 +247,8 @@ InMemoryStorage::InMemoryStorage(const bmqt::Uri&        uri,
 , d_defaultRdaInfo(defaultRdaInfo)
 {
     BSLS_ASSERT_SAFE(0 <= d_ttlSeconds);  // Broadcast queues can use 0 for TTL
+
+    d_virtualStorageCatalog.setDefaultRdaInfo(d_defaultRdaInfo);
 }
 
 InMemoryStorage::~InMemoryStorage()
@@ -90,19 +259,50 @@ InMemoryStorage::~InMemoryStorage()
 // MANIPULATORS
 //   (virtual mqbi::Storage)
 int InMemoryStorage::configure(
-    BSLS_ANNOTATION_UNUSED bsl::ostream& errorDescription,
-    const mqbconfm::Storage&             config,
-    const mqbconfm::Limits&              limits,
-    const bsls::Types::Int64             messageTtl,
-    BSLS_ANNOTATION_UNUSED const int     maxDeliveryAttempts)
+    bsl::ostream&                    errorDescription,
+    const mqbconfm::Storage&         config,
+    const mqbconfm::Limits&          limits,
+    const bsls::Types::Int64         messageTtl,
+    BSLS_ANNOTATION_UNUSED const int maxDeliveryAttempts)
 {
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS              = 0,
+        rc_INVALID_SEGMENT_SIZE = -1
+    };
+
+    // The configuration of a proxy or replica may be file-backed, in which
+    // case segments are disabled.
+    const int segmentSize = config.isInMemoryValue()
+                                ? config.inMemory().segmentSize()
+                                : 0;
+    if (segmentSize < 0) {
+        errorDescription << "Invalid segment size: " << segmentSize;
+        return rc_INVALID_SEGMENT_SIZE;  // RETURN
+    }
+
     d_config = config;
+    d_arena.setSegmentSize(segmentSize);
+
+    // Spilling is only for the queues whose messages are not persisted
+    // anyway.  Failing to set it up is not fatal: messages are kept in
+    // memory.
+    if (config.isInMemoryValue() && !d_spillLocation.empty() &&
+        !d_spillLog.isOpen()) {
+        mwcu::MemOutStream spillErrorDesc(d_allocator_p);
+        if (0 != d_spillLog.open(spillErrorDesc, d_spillLocation)) {
+            BALL_LOG_WARN << "#STORAGE_SPILL_FAILURE "
+                          << "Messages of queue '" << queueUri()
+                          << "' will not be spilled: " << spillErrorDesc.str();
+        }
+    }
+
     d_capacityMeter.setLimits(limits.messages(), limits.bytes())
         .setWatermarkThresholds(limits.messagesWatermarkRatio(),
                                 limits.bytesWatermarkRatio());
     d_ttlSeconds = messageTtl;
 
-    return 0;
+    return rc_SUCCESS;
 }
 
 void InMemoryStorage::setQueue(mqbi::Queue* queue)
@@ -199,9 +399,11 @@ InMemoryStorage::put(mqbi::StorageMessageAttributes*     attributes,
                         : mqbi::StorageResult::e_LIMIT_BYTES);  // RETURN
         }
 
-        d_items.insert(bsl::make_pair(msgGUID,
-                                      Item(appData, options, *attributes)),
-                       attributes->arrivalTimepoint());
+        // The app states of the message are maintained by this storage and
+        // its virtual storages only.
+        attributes->setAppStates(0);
+
+        insertItem(msgGUID, appData, options, *attributes);
 
         d_virtualStorageCatalog.put(msgGUID,
                                     msgSize,
@@ -223,21 +425,12 @@ InMemoryStorage::put(mqbi::StorageMessageAttributes*     attributes,
         return mqbi::StorageResult::e_SUCCESS;  // RETURN
     }
 
-    // Specific appKeys have been specified.  Insert the guid in the
-    // corresponding virtual storages.
-
-    for (size_t i = 0; i < storageKeys.size(); ++i) {
-        d_virtualStorageCatalog.put(msgGUID,
-                                    msgSize,
-                                    d_defaultRdaInfo,
-                                    bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID,
-                                    storageKeys[i]);
-    }
-
-    // If the guid also exists in the 'physical' storage, bump up its reference
-    // count by appropriate value.  Note that in-memory storage is used at the
-    // proxy as well, and the way messages routed to a proxy in fanout mode,
-    // the message may or may not exist in the storage.
+    // Specific appKeys have been specified.  If the guid also exists in the
+    // 'physical' storage, bump up its reference count by appropriate value.
+    // Note that in-memory storage is used at the proxy as well, and the way
+    // messages routed to a proxy in fanout mode, the message may or may not
+    // exist in the storage.  The message is added to the 'physical' storage
+    // first because virtual storages keep their state in it.
 
     ItemsMapIter it = d_items.find(msgGUID);
     if (it != d_items.end()) {
@@ -246,9 +439,18 @@ InMemoryStorage::put(mqbi::StorageMessageAttributes*     attributes,
                             storageKeys.size());  // Bump up
     }
     else {
-        d_items.insert(bsl::make_pair(msgGUID,
-                                      Item(appData, options, *attributes)),
-                       attributes->arrivalTimepoint());
+        attributes->setAppStates(0);
+        insertItem(msgGUID, appData, options, *attributes);
+    }
+
+    // Insert the guid in the corresponding virtual storages.
+
+    for (size_t i = 0; i < storageKeys.size(); ++i) {
+        d_virtualStorageCatalog.put(msgGUID,
+                                    msgSize,
+                                    d_defaultRdaInfo,
+                                    bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID,
+                                    storageKeys[i]);
     }
 
     return mqbi::StorageResult::e_SUCCESS;  // RETURN
@@ -299,8 +501,9 @@ InMemoryStorage::remove(const bmqt::MessageGUID& msgGUID,
 
     BSLS_ASSERT_SAFE(!d_virtualStorageCatalog.hasMessage(msgGUID));
 
-    int msgLen = it->second.appData()->length();
+    int msgLen = it->second.appDataLength();
 
+    onItemErased(it->second);
     d_items.erase(it);
 
     // Update resource usage
@@ -333,6 +536,12 @@ InMemoryStorage::removeAll(const mqbu::StorageKey& appKey)
         d_items.clear();
         d_capacityMeter.clear();
 
+        if (d_numSpilledItems) {
+            d_numSpilledItems = 0;
+            d_spillLog.clear();
+        }
+        d_isSpillSuspended = false;
+
         if (d_queue_p) {
             d_queue_p->stats()->onEvent(
                 mqbstat::QueueStatsDomain::EventType::e_PURGE,
@@ -352,13 +561,17 @@ InMemoryStorage::removeAll(const mqbu::StorageKey& appKey)
     // A valid AppKey has been specified.  For each outstanding guid in the
     // virtual storage associated with the 'appKey', decrement its outstanding
     // refCount, and if updated refCount is zero, delete that msg from the
-    // underlying (this) storage.
+    // underlying (this) storage.  Note that the virtual storage iterates over
+    // the underlying storage, so it is advanced before the message it points
+    // to is deleted.
 
     bslma::ManagedPtr<mqbi::StorageIterator> iter =
         d_virtualStorageCatalog.getIterator(appKey);
     while (!iter->atEnd()) {
-        const bmqt::MessageGUID& guid = iter->guid();
-        ItemsMapIter             it   = d_items.find(guid);
+        const bmqt::MessageGUID guid = iter->guid();
+        iter->advance();
+
+        ItemsMapIter it = d_items.find(guid);
         if (it == d_items.end()) {
             BALL_LOG_WARN
                 << "#STORAGE_PURGE_ERROR "
@@ -367,7 +580,6 @@ InMemoryStorage::removeAll(const mqbu::StorageKey& appKey)
                 << "' & appKey '" << appKey << "' for queue '" << queueUri()
                 << "' & queueKey '" << queueKey()
                 << "', but GUID does not exist in the underlying storage.";
-            iter->advance();
             continue;  // CONTINUE
         }
 
@@ -380,7 +592,6 @@ InMemoryStorage::removeAll(const mqbu::StorageKey& appKey)
                           << "' & appKey '" << appKey << "' for queue '"
                           << queueUri() << "' & queueKey '" << queueKey()
                           << "], for which refCount is already zero.";
-            iter->advance();
             continue;  // CONTINUE
         }
         it->second.attributes().setRefCount(--refCount);
@@ -389,7 +600,7 @@ InMemoryStorage::removeAll(const mqbu::StorageKey& appKey)
             // This appKey was the last outstanding client for this message.
             // Message can now be deleted.
 
-            int msgLen = it->second.appData()->length();
+            int msgLen = it->second.appDataLength();
             d_capacityMeter.remove(1, msgLen);
             if (d_queue_p) {
                 d_queue_p->queueEngine()->beforeMessageRemoved(guid);
@@ -405,10 +616,9 @@ InMemoryStorage::removeAll(const mqbu::StorageKey& appKey)
             // zero).  So we just delete the guid from the underlying (this)
             // storage.
 
+            onItemErased(it->second);
             d_items.erase(it);
         }
-
-        iter->advance();
     }
 
     // Clear out the virtual storage associated with the specified 'appKey'.
@@ -452,7 +662,7 @@ int InMemoryStorage::gcExpiredMessages(
             break;  // BREAK
         }
 
-        int msgLen = cit->second.appData()->length();
+        int msgLen = cit->second.appDataLength();
         d_capacityMeter.remove(1, msgLen);
         if (d_queue_p) {
             d_queue_p->queueEngine()->beforeMessageRemoved(cit->first);
@@ -465,6 +675,7 @@ int InMemoryStorage::gcExpiredMessages(
         // storage.
         d_virtualStorageCatalog.remove(cit->first,
                                        mqbu::StorageKey::k_NULL_KEY);
+        onItemErased(cit->second);
         d_items.erase(cit, now);
         ++numMsgsDeleted;
     }
@@ -488,6 +699,42 @@ bool InMemoryStorage::gcHistory()
                       k_GC_MESSAGES_BATCH_SIZE);
 }
 
+mqbi::StorageResult::Enum
+InMemoryStorage::updateAppStates(bsls::Types::Uint64*     previous,
+                                 const bmqt::MessageGUID& msgGUID,
+                                 bsls::Types::Uint64      setMask,
+                                 bsls::Types::Uint64      clearMask)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(previous);
+
+    ItemsMapIter it = d_items.find(msgGUID);
+    if (it == d_items.end()) {
+        return mqbi::StorageResult::e_GUID_NOT_FOUND;  // RETURN
+    }
+
+    mqbi::StorageMessageAttributes& attributes = it->second.attributes();
+
+    *previous = attributes.appStates();
+    attributes.setAppStates((*previous & ~clearMask) | setMask);
+
+    return mqbi::StorageResult::e_SUCCESS;
+}
+
+void InMemoryStorage::clearAppStates(bsls::Types::Uint64 mask)
+{
+    for (ItemsMapIter it = d_items.begin(); it != d_items.end(); ++it) {
+        mqbi::StorageMessageAttributes& attributes = it->second.attributes();
+        attributes.setAppStates(attributes.appStates() & ~mask);
+    }
+}
+
+// MANIPULATORS
+void InMemoryStorage::setSpillLocation(const bslstl::StringRef& value)
+{
+    d_spillLocation = value;
+}
+
 // ACCESSORS
 //   (virtual mqbi::Storage)
 mqbi::StorageResult::Enum
@@ -501,10 +748,13 @@ InMemoryStorage::get(bsl::shared_ptr<bdlbb::Blob>*   appData,
         return mqbi::StorageResult::e_GUID_NOT_FOUND;  // RETURN
     }
 
-    *appData    = it->second.appData();
     *options    = it->second.options();
     *attributes = it->second.attributes();
 
+    if (0 != loadAppData(appData, msgGUID, it->second)) {
+        return mqbi::StorageResult::e_READ_FAILURE;  // RETURN
+    }
+
     return mqbi::StorageResult::e_SUCCESS;
 }
 
@@ -602,5 +852,26 @@ InMemoryStorageIterator::~InMemoryStorageIterator()
     // NOTHING
 }
 
+// ACCESSORS
+const bsl::shared_ptr<bdlbb::Blob>& InMemoryStorageIterator::appData() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!atEnd());
+
+    const InMemoryStorage_Item& item = d_iterator->second;
+    if (!item.isSpilled()) {
+        return item.appData();  // RETURN
+    }
+
+    // Page the payload in once per item, as long as the iterator points to
+    // it.  On failure, 'd_appData' is left null for the caller to skip the
+    // message, and the read is attempted again on the next call.
+    if (!d_appData) {
+        d_storage_p->loadAppData(&d_appData, d_iterator->first, item);
+    }
+
+    return d_appData;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
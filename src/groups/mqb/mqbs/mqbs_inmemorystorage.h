@@ -28,12 +28,54 @@
 // memory.  'mqbs::InMemoryStorageIterator' provides an iterator implementation
 // of 'mqbi::StorageIterator' protocol and can be used to iterate over messages
 // stored in the in-memory storage.
+//
+/// Segments
+///--------
+// When the 'segmentSize' of the 'mqbconfm::InMemoryStorage' configuration is
+// not 0, the payload and options of every message not larger than a quarter
+// of that size are copied, in arrival order, into fixed-size segments
+// allocated as a whole, instead of keeping the (typically many, small and
+// scattered) buffers they were received in.  A segment is freed when the last
+// message copied into it has been removed from the storage and released by
+// everyone holding it (e.g., pending PUSH events), which keeps the heap of a
+// high-rate non-persistent queue from fragmenting, and makes iterating
+// messages in order walk memory sequentially.
+//
+/// Spilling
+///--------
+// When it was given a spill location (see 'setSpillLocation', which the
+// 'mqbs::FileStore' creating the storage calls with the 'spillLocation' of
+// its 'mqbs::DataStoreConfig', i.e., of the 'mqbcfg::PartitionConfig' of the
+// cluster), the storage of an in-memory queue creates, when configured, an
+// anonymous scratch file (see 'mqbs_spilllog') in that directory, and the
+// payload of every message put while the queue or its domain is above its
+// high watermark (i.e., until it drains back below its low watermark) is
+// appended to that file instead of being kept in memory.  Spilled payloads
+// are read back, one message at a time, when the message is iterated over
+// (e.g., to be delivered) or retrieved, and the scratch file is truncated
+// once all the spilled messages have been removed.  The options and
+// attributes of a spilled message remain in memory, and spilling does not
+// change how messages count against the limits of the queue and of its
+// domain.
+//
+// Failing to read a spilled payload back raises a 'STORAGE' alarm, and the
+// payload is reported as missing: 'get' returns 'e_READ_FAILURE' and the
+// 'appData' of an iterator is a null pointer.  The queue engines skip such a
+// message instead of delivering it, and it remains in the storage until it is
+// purged or expires.
+//
+// Note that the spill log is written and read synchronously, by the
+// dispatcher thread of the queue, so that a slow scratch file directly
+// delays the processing of the queue (and of the other queues sharing its
+// dispatcher thread) while it is spilling.  The spill location should
+// therefore be on a fast local device.
 
 // MQB
 
 #include <mqbconfm_messages.h>
 #include <mqbi_storage.h>
 #include <mqbs_replicatedstorage.h>
+#include <mqbs_spilllog.h>
 #include <mqbs_virtualstoragecatalog.h>
 #include <mqbu_capacitymeter.h>
 #include <mqbu_storagekey.h>
@@ -60,6 +102,7 @@
 #include <bsls_keyword.h>
 #include <bsls_performancehint.h>
 #include <bsls_types.h>
+#include <bslstl_stringref.h>
 
 namespace BloombergLP {
 
@@ -87,11 +130,21 @@ class InMemoryStorage_Item {
   private:
     // DATA
     bsl::shared_ptr<bdlbb::Blob> d_appData;
+    // Payload of the message, or empty if
+    // spilled.
 
     bsl::shared_ptr<bdlbb::Blob> d_options;
 
     mqbi::StorageMessageAttributes d_attributes;
 
+    bsls::Types::Int64 d_spillOffset;
+    // Offset of the payload in the spill
+    // log of the storage, or -1 if the
+    // payload is in memory.
+
+    int d_appDataLength;
+    // Length of the payload.
+
   public:
     // CREATORS
     InMemoryStorage_Item();
@@ -109,12 +162,92 @@ class InMemoryStorage_Item {
     setAttributes(const mqbi::StorageMessageAttributes& value);
     mqbi::StorageMessageAttributes& attributes();
 
+    /// Release the payload of this item, recording that it was appended,
+    /// having the specified `length`, to the spill log of the storage at
+    /// the specified `offset`.
+    InMemoryStorage_Item& setSpilled(bsls::Types::Int64 offset, int length);
+
     void reset();
 
     // ACCESSORS
     const bsl::shared_ptr<bdlbb::Blob>&   appData() const;
     const bsl::shared_ptr<bdlbb::Blob>&   options() const;
     const mqbi::StorageMessageAttributes& attributes() const;
+
+    /// Return `true` if the payload of this item is in the spill log of
+    /// the storage rather than in memory, and `false` otherwise.
+    bool isSpilled() const;
+
+    /// Return the offset of the payload of this item in the spill log of
+    /// the storage.  The behavior is undefined unless `isSpilled()`.
+    bsls::Types::Int64 spillOffset() const;
+
+    /// Return the length of the payload of this item, whether it is spilled
+    /// or not.
+    int appDataLength() const;
+};
+
+// ===========================
+// class InMemoryStorage_Arena
+// ===========================
+
+/// This class provides a mechanism to copy blobs into large, fixed-size,
+/// reference-counted segments of memory, each segment being freed when the
+/// last blob referring to it is destroyed.  This class is an implementation
+/// detail of `mqbs::InMemoryStorage`, and should not be used outside this
+/// component.
+class InMemoryStorage_Arena {
+  private:
+    // DATA
+    bsl::shared_ptr<char> d_segment_sp;
+    // Segment currently being filled, if
+    // any.
+
+    int d_segmentSize;
+    // Size, in bytes, of each segment, or 0
+    // if segments are disabled.
+
+    int d_offset;
+    // Offset of the first free byte in the
+    // current segment.
+
+    bslma::Allocator* d_allocator_p;
+    // Allocator used for segments and
+    // blobs.  Must be thread-safe since
+    // blobs may be released from any
+    // thread.
+
+  private:
+    // NOT IMPLEMENTED
+    InMemoryStorage_Arena(const InMemoryStorage_Arena&) BSLS_KEYWORD_DELETED;
+    InMemoryStorage_Arena&
+    operator=(const InMemoryStorage_Arena&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+
+    /// Create an arena having segments disabled and using the specified
+    /// `allocator`.
+    explicit InMemoryStorage_Arena(bslma::Allocator* allocator);
+
+    // MANIPULATORS
+
+    /// Set the size of the segments of this arena to the specified `value`,
+    /// 0 disabling them.  The current segment, if any, is left to the
+    /// blobs referring to it.
+    void setSegmentSize(int value);
+
+    /// Return a blob having the same contents as the specified `blob`,
+    /// copied into the current segment if `blob` is not empty and not
+    /// larger than a quarter of the segment size, or `blob` itself
+    /// otherwise.
+    bsl::shared_ptr<bdlbb::Blob>
+    copy(const bsl::shared_ptr<bdlbb::Blob>& blob);
+
+    // ACCESSORS
+
+    /// Return the size of the segments of this arena, 0 if disabled.
+    int segmentSize() const;
 };
 
 // =====================
@@ -148,6 +281,32 @@ class InMemoryStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
 
     typedef mqbi::Storage::StorageKeys StorageKeys;
 
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Insert into the items of this storage the message having the
+    /// specified `msgGUID`, `appData`, `options` and `attributes`, spilling
+    /// `appData` to the spill log if it is open and the capacity meter of
+    /// this storage, or of its domain, is above its high watermark.
+    void insertItem(const bmqt::MessageGUID&              msgGUID,
+                    const bsl::shared_ptr<bdlbb::Blob>&   appData,
+                    const bsl::shared_ptr<bdlbb::Blob>&   options,
+                    const mqbi::StorageMessageAttributes& attributes);
+
+    /// Account for the removal of the specified `item` from the items of
+    /// this storage, clearing the spill log once no item is spilled.
+    void onItemErased(const Item& item);
+
+    // PRIVATE ACCESSORS
+
+    /// Load into the specified `appData` the payload of the specified
+    /// `item` having the specified `msgGUID`, read from the spill log if
+    /// `item` is spilled.  Return 0 on success, or raise an alarm, reset
+    /// `appData` and return a non-zero value otherwise.
+    int loadAppData(bsl::shared_ptr<bdlbb::Blob>* appData,
+                    const bmqt::MessageGUID&      msgGUID,
+                    const Item&                   item) const;
+
   public:
     // CLASS METHODS
 
@@ -184,6 +343,29 @@ class InMemoryStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
 
     ItemsMap d_items;
 
+    InMemoryStorage_Arena d_arena;
+    // Segments into which the payloads of
+    // messages are copied, if enabled.
+
+    bsl::string d_spillLocation;
+    // Directory in which 'd_spillLog' is
+    // created when this storage is
+    // configured, or empty to never spill.
+
+    SpillLog d_spillLog;
+    // Scratch file to which the payloads
+    // of messages are spilled under memory
+    // pressure, if enabled.
+
+    bsls::Types::Int64 d_numSpilledItems;
+    // Number of items whose payload is in
+    // 'd_spillLog'.
+
+    bool d_isSpillSuspended;
+    // Whether spilling is suspended after
+    // a failure to append to 'd_spillLog',
+    // until it is cleared.
+
     VirtualStorageCatalog d_virtualStorageCatalog;
 
     RecordHandles d_queueOpRecordHandles;
@@ -386,6 +568,30 @@ class InMemoryStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
     virtual bool
     removeVirtualStorage(const mqbu::StorageKey& appKey) BSLS_KEYWORD_OVERRIDE;
 
+    /// Set the app states of the message having the specified `msgGUID` to
+    /// its current value with the bits in the specified `clearMask` cleared
+    /// and then the bits in the specified `setMask` set, and load the
+    /// previous value into the specified `previous`.  Return `e_SUCCESS`,
+    /// or `e_GUID_NOT_FOUND` if no message with `msgGUID` exists.
+    virtual mqbi::StorageResult::Enum
+    updateAppStates(bsls::Types::Uint64*     previous,
+                    const bmqt::MessageGUID& msgGUID,
+                    bsls::Types::Uint64      setMask,
+                    bsls::Types::Uint64 clearMask) BSLS_KEYWORD_OVERRIDE;
+
+    /// Clear the bits in the specified `mask` from the app states of every
+    /// message in this storage.
+    virtual void
+    clearAppStates(bsls::Types::Uint64 mask) BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// Set the directory in which the spill log of this storage is created
+    /// to the specified `value`, or disable spilling if `value` is empty.
+    /// Note that this takes effect on the next call to `configure`, and
+    /// only if this storage is configured as in-memory.
+    void setSpillLocation(const bslstl::StringRef& value);
+
     // ACCESSORS
     //   (virtual mqbi::Storage)
 
@@ -490,6 +696,13 @@ class InMemoryStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
     // Load into the specified 'buffer' the list of pairs of appId and
     // appKey for all the virtual storages registered with this instance.
 
+    /// Load into the specified `appStates` the app states of the message
+    /// having the specified `msgGUID`.  Return `e_SUCCESS`, or
+    /// `e_GUID_NOT_FOUND` if no message with `msgGUID` exists.
+    virtual mqbi::StorageResult::Enum
+    getAppStates(bsls::Types::Uint64*     appStates,
+                 const bmqt::MessageGUID& msgGUID) const BSLS_KEYWORD_OVERRIDE;
+
     // MANIPULATORS
     //   (virtual mqbs::ReplicatedStorage)
     virtual void processMessageRecord(const bmqt::MessageGUID&     guid,
@@ -538,6 +751,11 @@ class InMemoryStorageIterator : public mqbi::StorageIterator {
     ItemsMapConstIter d_iterator;  // Internal iterator representing the
                                    // current position
 
+    mutable bsl::shared_ptr<bdlbb::Blob> d_appData;
+    // Payload of the current item read
+    // from the spill log of the storage,
+    // if spilled and already loaded.
+
   public:
     // CREATORS
 
@@ -567,8 +785,10 @@ class InMemoryStorageIterator : public mqbi::StorageIterator {
     unsigned int subscriptionId() const BSLS_KEYWORD_OVERRIDE;
 
     /// Return a reference offering non-modifiable access to the application
-    /// data associated with the item currently pointed at by this iterator.
-    /// The behavior is undefined unless `atEnd` returns `false`.
+    /// data associated with the item currently pointed at by this iterator,
+    /// or to a null pointer if it is spilled and could not be read back
+    /// from the spill log (in which case an alarm was raised).  The
+    /// behavior is undefined unless `atEnd` returns `false`.
     const bsl::shared_ptr<bdlbb::Blob>& appData() const BSLS_KEYWORD_OVERRIDE;
 
     /// Return a reference offering non-modifiable access to the options
@@ -591,6 +811,11 @@ class InMemoryStorageIterator : public mqbi::StorageIterator {
     /// iterator has received replication factor Receipts.
     bool hasReceipt() const BSLS_KEYWORD_OVERRIDE;
 
+    /// Return the bitmap of the virtual storages holding the message
+    /// currently pointed at by this iterator.  The behavior is undefined
+    /// unless `atEnd` returns `false`.
+    bsls::Types::Uint64 appStates() const BSLS_KEYWORD_OVERRIDE;
+
     // MANIPULATORS
 
     /// Advance the iterator to the next item.  The behavior is undefined
@@ -617,6 +842,8 @@ inline InMemoryStorage_Item::InMemoryStorage_Item()
 : d_appData()
 , d_options()
 , d_attributes()
+, d_spillOffset(-1)
+, d_appDataLength(0)
 {
 }
 
@@ -627,6 +854,8 @@ inline InMemoryStorage_Item::InMemoryStorage_Item(
 : d_appData(appData)
 , d_options(options)
 , d_attributes(attributes)
+, d_spillOffset(-1)
+, d_appDataLength(appData ? appData->length() : 0)
 {
 }
 
@@ -634,7 +863,9 @@ inline InMemoryStorage_Item::InMemoryStorage_Item(
 inline InMemoryStorage_Item&
 InMemoryStorage_Item::setAppData(const bsl::shared_ptr<bdlbb::Blob>& value)
 {
-    d_appData = value;
+    d_appData       = value;
+    d_spillOffset   = -1;
+    d_appDataLength = value ? value->length() : 0;
     return *this;
 }
 
@@ -657,10 +888,24 @@ inline mqbi::StorageMessageAttributes& InMemoryStorage_Item::attributes()
     return d_attributes;
 }
 
+inline InMemoryStorage_Item&
+InMemoryStorage_Item::setSpilled(bsls::Types::Int64 offset, int length)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= offset && 0 <= length);
+
+    d_appData.reset();
+    d_spillOffset   = offset;
+    d_appDataLength = length;
+    return *this;
+}
+
 inline void InMemoryStorage_Item::reset()
 {
     d_appData.reset();
     d_options.reset();
+    d_spillOffset   = -1;
+    d_appDataLength = 0;
 }
 
 // ACCESSORS
@@ -682,6 +927,34 @@ InMemoryStorage_Item::attributes() const
     return d_attributes;
 }
 
+inline bool InMemoryStorage_Item::isSpilled() const
+{
+    return 0 <= d_spillOffset;
+}
+
+inline bsls::Types::Int64 InMemoryStorage_Item::spillOffset() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isSpilled());
+
+    return d_spillOffset;
+}
+
+inline int InMemoryStorage_Item::appDataLength() const
+{
+    return d_appDataLength;
+}
+
+// ---------------------------
+// class InMemoryStorage_Arena
+// ---------------------------
+
+// ACCESSORS
+inline int InMemoryStorage_Arena::segmentSize() const
+{
+    return d_segmentSize;
+}
+
 // ---------------------
 // class InMemoryStorage
 // ---------------------
@@ -786,7 +1059,7 @@ InMemoryStorage::getMessageSize(int*                     msgSize,
         return mqbi::StorageResult::e_GUID_NOT_FOUND;  // RETURN
     }
 
-    *msgSize = it->second.appData()->length();
+    *msgSize = it->second.appDataLength();
     return mqbi::StorageResult::e_SUCCESS;
 }
 
@@ -831,6 +1104,20 @@ inline int InMemoryStorage::partitionId() const
     return d_partitionId;
 }
 
+inline mqbi::StorageResult::Enum
+InMemoryStorage::getAppStates(bsls::Types::Uint64*     appStates,
+                              const bmqt::MessageGUID& msgGUID) const
+{
+    ItemsMapConstIter it = d_items.find(msgGUID);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(it == d_items.end())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return mqbi::StorageResult::e_GUID_NOT_FOUND;  // RETURN
+    }
+
+    *appStates = it->second.attributes().appStates();
+    return mqbi::StorageResult::e_SUCCESS;
+}
+
 // -----------------------------
 // class InMemoryStorageIterator
 // -----------------------------
@@ -852,15 +1139,6 @@ inline unsigned int InMemoryStorageIterator::subscriptionId() const
     return bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID;
 }
 
-inline const bsl::shared_ptr<bdlbb::Blob>&
-InMemoryStorageIterator::appData() const
-{
-    // PRECONDITIONS
-    BSLS_ASSERT_SAFE(!atEnd());
-
-    return d_iterator->second.appData();
-}
-
 inline const bsl::shared_ptr<bdlbb::Blob>&
 InMemoryStorageIterator::options() const
 {
@@ -889,18 +1167,28 @@ inline bool InMemoryStorageIterator::hasReceipt() const
     return !atEnd();
 }
 
+inline bsls::Types::Uint64 InMemoryStorageIterator::appStates() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!atEnd());
+
+    return d_iterator->second.attributes().appStates();
+}
+
 // MANIPULATORS
 inline bool InMemoryStorageIterator::advance()
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(!atEnd());
 
+    d_appData.reset();
     ++d_iterator;
     return !atEnd();
 }
 
 inline void InMemoryStorageIterator::reset()
 {
+    d_appData.reset();
     d_iterator = d_storage_p->d_items.begin();
 }
 
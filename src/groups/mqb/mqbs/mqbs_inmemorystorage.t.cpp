@@ -38,6 +38,7 @@
 
 // MWC
 #include <mwcu_memoutstream.h>
+#include <mwcu_tempdirectory.h>
 
 // BDE
 #include <ball_log.h>
@@ -52,6 +53,7 @@
 #include <bsl_utility.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
+#include <bsls_alignmentutil.h>
 #include <bsls_assert.h>
 #include <bsls_objectbuffer.h>
 #include <bsls_types.h>
@@ -88,6 +90,8 @@ using namespace bsl;
 //   capacityMeter_limitBytes
 // - garbageCollect
 // - addQueueOpRecordHandle
+// - segments
+// - spill
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -225,7 +229,8 @@ struct Tester {
                   bsls::Types::Int64 byteCapacity,
                   double             msgWatermarkRatio  = 0.8,
                   double             byteWatermarkRatio = 0.8,
-                  bsls::Types::Int64 messageTtl         = k_INT64_MAX)
+                  bsls::Types::Int64 messageTtl         = k_INT64_MAX,
+                  int                segmentSize        = 0)
     {
         // PRECONDITIONS
         BSLS_ASSERT_OPT(d_inMemoryStorage_mp && "Storage was not created");
@@ -233,7 +238,7 @@ struct Tester {
         mqbconfm::Storage config;
         mqbconfm::Limits  limits;
 
-        config.makeInMemory();
+        config.makeInMemory().segmentSize() = segmentSize;
 
         limits.messages()               = msgCapacity;
         limits.messagesWatermarkRatio() = msgWatermarkRatio;
@@ -1574,6 +1579,223 @@ TEST_F(Test, addQueueOpRecordHandle)
     ASSERT(d_tester.storage().queueOpRecordHandles()[0] == handle);
 }
 
+TEST_F(BasicTest, segments)
+// ------------------------------------------------------------------------
+// SEGMENTS
+//
+// Concerns:
+//   1. A negative segment size is rejected.
+//   2. When segments are enabled, small payloads are copied, in arrival
+//      order, into shared segments and remain readable; a new segment is
+//      started when the current one is full.
+//   3. Payloads larger than a quarter of the segment size are stored as
+//      received.
+//
+// Testing:
+//   configure(...) with 'segmentSize'
+//   put(...)
+//   get(...)
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("SEGMENTS");
+
+    // 1. Negative segment size
+    ASSERT_NE(d_tester.configure(k_DEFAULT_MSG,
+                                 k_DEFAULT_BYTES,
+                                 0.8,
+                                 0.8,
+                                 k_INT64_MAX,
+                                 -1),
+              0);
+
+    // 2. Each message has a 4 bytes payload and options, each taking a
+    //    maximally aligned slot, so that a 64 bytes segment holds 4 messages.
+    const int k_SEGMENT_SIZE = 64;
+    const int k_MSG_COUNT    = 6;
+    ASSERT_EQ(d_tester.configure(k_DEFAULT_MSG,
+                                 k_DEFAULT_BYTES,
+                                 0.8,
+                                 0.8,
+                                 k_INT64_MAX,
+                                 k_SEGMENT_SIZE),
+              0);
+    ASSERT_EQ(d_tester.storage().config().inMemory().segmentSize(),
+              k_SEGMENT_SIZE);
+
+    const mqbi::Storage::StorageKeys storageKeys;
+    bsl::vector<bmqt::MessageGUID>   guids(s_allocator_p);
+    ASSERT_EQ(d_tester.addMessages(&guids, storageKeys, k_MSG_COUNT),
+              mqbi::StorageResult::e_SUCCESS);
+
+    bsl::vector<bsl::shared_ptr<char> > buffers(s_allocator_p);
+    for (int i = 0; i < k_MSG_COUNT; ++i) {
+        mqbi::StorageMessageAttributes attributes;
+        bsl::shared_ptr<bdlbb::Blob>   appData;
+        bsl::shared_ptr<bdlbb::Blob>   options;
+        ASSERT_EQ_D(i,
+                    d_tester.storage().get(&appData,
+                                           &options,
+                                           &attributes,
+                                           guids[i]),
+                    mqbi::StorageResult::e_SUCCESS);
+        ASSERT_EQ_D(i, appData->numDataBuffers(), 1);
+        ASSERT_EQ_D(i, appData->length(), static_cast<int>(sizeof(int)));
+        ASSERT_EQ_D(i, *reinterpret_cast<int*>(appData->buffer(0).data()), i);
+        ASSERT_NE_D(i, appData, options);
+
+        buffers.push_back(appData->buffer(0).buffer());
+    }
+
+    // Messages [0, 3] share the first segment, and [4, 5] the second one.
+    for (int i = 1; i < k_MSG_COUNT; ++i) {
+        const bool sameSegment = !buffers[0].owner_before(buffers[i]) &&
+                                 !buffers[i].owner_before(buffers[0]);
+        ASSERT_EQ_D(i, sameSegment, i < 4);
+    }
+    ASSERT_EQ(static_cast<int>(buffers[1].get() - buffers[0].get()),
+              2 * static_cast<int>(bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT));
+
+    // 3. Large payload
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    const bsl::shared_ptr<bdlbb::Blob> largeData(
+        new (*s_allocator_p) bdlbb::Blob(&bufferFactory, s_allocator_p),
+        s_allocator_p);
+    const bsl::string largePayload(k_SEGMENT_SIZE, 'x', s_allocator_p);
+    bdlbb::BlobUtil::append(largeData.get(),
+                            largePayload.data(),
+                            static_cast<int>(largePayload.size()));
+
+    const bmqt::MessageGUID        largeGuid = generateUniqueGUID(guids);
+    mqbi::StorageMessageAttributes attributes;
+    ASSERT_EQ(d_tester.storage().put(&attributes,
+                                     largeGuid,
+                                     largeData,
+                                     bsl::shared_ptr<bdlbb::Blob>()),
+              mqbi::StorageResult::e_SUCCESS);
+
+    bsl::shared_ptr<bdlbb::Blob> appData;
+    bsl::shared_ptr<bdlbb::Blob> options;
+    ASSERT_EQ(
+        d_tester.storage().get(&appData, &options, &attributes, largeGuid),
+        mqbi::StorageResult::e_SUCCESS);
+    ASSERT_EQ(appData, largeData);
+}
+
+TEST_F(BasicTest, spill)
+// ------------------------------------------------------------------------
+// SPILL
+//
+// Concerns:
+//   1. When a spill location is configured, the payloads of the messages
+//      put while the queue is above its high watermark are spilled, and
+//      the others are kept in memory.
+//   2. Spilled payloads are read back by 'get' and by the iterators, and
+//      count as in-memory ones towards the size of the storage.
+//   3. Once all the messages are removed, payloads are kept in memory
+//      again.
+//
+// Testing:
+//   setSpillLocation(...)
+//   put(...)
+//   get(...)
+//   getIterator(...)
+//   getMessageSize(...)
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("SPILL");
+
+    mwcu::TempDirectory tempDir(s_allocator_p);
+
+    // High watermark at 4 of 8 messages
+    const int k_MSG_COUNT = 6;
+    d_tester.storage().setSpillLocation(tempDir.path());
+    ASSERT_EQ(d_tester.configure(8, k_DEFAULT_BYTES, 0.5), 0);
+
+    const mqbi::Storage::StorageKeys storageKeys;
+    bsl::vector<bmqt::MessageGUID>   guids(s_allocator_p);
+    ASSERT_EQ(d_tester.addMessages(&guids, storageKeys, k_MSG_COUNT),
+              mqbi::StorageResult::e_SUCCESS);
+    ASSERT_EQ(d_tester.storage().numBytes(k_NULL_KEY),
+              k_MSG_COUNT * static_cast<int>(sizeof(int)));
+
+    // A spilled payload is read into a new blob on every 'get', whereas an
+    // in-memory one is shared.
+    bsl::vector<bool> spilled(s_allocator_p);
+    for (int i = 0; i < k_MSG_COUNT; ++i) {
+        mqbi::StorageMessageAttributes attributes;
+        bsl::shared_ptr<bdlbb::Blob>   appData;
+        bsl::shared_ptr<bdlbb::Blob>   appDataAgain;
+        bsl::shared_ptr<bdlbb::Blob>   options;
+        ASSERT_EQ_D(i,
+                    d_tester.storage().get(&appData,
+                                           &options,
+                                           &attributes,
+                                           guids[i]),
+                    mqbi::StorageResult::e_SUCCESS);
+        ASSERT_EQ_D(i,
+                    d_tester.storage().get(&appDataAgain,
+                                           &options,
+                                           &attributes,
+                                           guids[i]),
+                    mqbi::StorageResult::e_SUCCESS);
+        ASSERT_EQ_D(i, appData->length(), static_cast<int>(sizeof(int)));
+        ASSERT_EQ_D(i, *reinterpret_cast<int*>(appData->buffer(0).data()), i);
+        ASSERT_EQ_D(i, options->length(), static_cast<int>(sizeof(int)));
+
+        int msgSize = 0;
+        ASSERT_EQ_D(i,
+                    d_tester.storage().getMessageSize(&msgSize, guids[i]),
+                    mqbi::StorageResult::e_SUCCESS);
+        ASSERT_EQ_D(i, msgSize, static_cast<int>(sizeof(int)));
+
+        spilled.push_back(appData != appDataAgain);
+    }
+    ASSERT(!spilled.front());
+    ASSERT(spilled.back());
+
+    bslma::ManagedPtr<mqbi::StorageIterator> iterator =
+        d_tester.storage().getIterator(k_NULL_KEY);
+    for (int i = 0; i < k_MSG_COUNT; ++i) {
+        ASSERT_D(i, !iterator->atEnd());
+        ASSERT_EQ_D(i, iterator->guid(), guids[i]);
+        ASSERT_EQ_D(i,
+                    *reinterpret_cast<int*>(
+                        iterator->appData()->buffer(0).data()),
+                    i);
+
+        // Paged in once per position
+        ASSERT_EQ_D(i, iterator->appData(), iterator->appData());
+        iterator->advance();
+    }
+    ASSERT(iterator->atEnd());
+    iterator.reset();
+
+    int msgSize = 0;
+    ASSERT_EQ(d_tester.storage().remove(guids.back(), &msgSize),
+              mqbi::StorageResult::e_SUCCESS);
+    ASSERT_EQ(msgSize, static_cast<int>(sizeof(int)));
+
+    // 3. Back to memory
+    ASSERT_EQ(d_tester.storage().removeAll(k_NULL_KEY),
+              mqbi::StorageResult::e_SUCCESS);
+
+    guids.clear();
+    ASSERT_EQ(d_tester.addMessages(&guids, storageKeys, 1),
+              mqbi::StorageResult::e_SUCCESS);
+
+    mqbi::StorageMessageAttributes attributes;
+    bsl::shared_ptr<bdlbb::Blob>   appData;
+    bsl::shared_ptr<bdlbb::Blob>   appDataAgain;
+    bsl::shared_ptr<bdlbb::Blob>   options;
+    ASSERT_EQ(
+        d_tester.storage().get(&appData, &options, &attributes, guids[0]),
+        mqbi::StorageResult::e_SUCCESS);
+    ASSERT_EQ(
+        d_tester.storage().get(&appDataAgain, &options, &attributes, guids[0]),
+        mqbi::StorageResult::e_SUCCESS);
+    ASSERT_EQ(appData, appDataAgain);
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
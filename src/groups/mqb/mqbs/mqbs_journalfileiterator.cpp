@@ -269,6 +269,37 @@ int JournalFileIterator::nextRecord()
     return rc_HAS_NEXT;
 }
 
+int JournalFileIterator::advance(bsls::Types::Uint64 numRecords)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 < numRecords);
+
+    if (isValid() && 1 < numRecords) {
+        // Skip the first 'numRecords - 1' records at once, and let
+        // 'nextRecord' validate the last one.  Note that in reverse mode,
+        // 'd_advanceLength' is always the record size.
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                d_blockIter.advance(d_advanceLength +
+                                    (numRecords - 2) * d_recordSize) ==
+                false)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            clear();
+            return 0;  // RETURN
+        }
+
+        d_advanceLength = d_recordSize;
+        if (d_blockIter.isForwardIterator()) {
+            d_journalRecordIndex += numRecords - 1;
+        }
+        else {
+            d_journalRecordIndex -= numRecords - 1;
+        }
+    }
+
+    return nextRecord();
+}
+
 void JournalFileIterator::flipDirection()
 {
     d_blockIter.flipDirection();
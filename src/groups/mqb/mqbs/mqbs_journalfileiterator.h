@@ -109,6 +109,16 @@ class JournalFileIterator {
     /// and `isValid`.
     int nextRecord();
 
+    /// Advance by the specified `numRecords` records in the direction of
+    /// the iteration, which is equivalent to, but much faster than,
+    /// invoking `nextRecord` `numRecords` times, as the skipped records are
+    /// not validated.  Return 1 if the new position is valid and represents
+    /// a valid record, 0 if iteration has reached the end of the file, or
+    /// < 0 if an error was encountered.  Behavior is undefined unless
+    /// `0 < numRecords`.  Note that if this method does not return 1, this
+    /// instance goes in an invalid state.
+    int advance(bsls::Types::Uint64 numRecords);
+
     /// Changes the direction of the iterator.  Unlike calling reset,
     /// calling this function maintains the current file position within the
     /// journal.  Returns 0 if it was successful, otherwise < 0.  If the
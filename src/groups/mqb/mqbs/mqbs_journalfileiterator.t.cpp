@@ -31,6 +31,7 @@
 #include <bsl_limits.h>
 #include <bsl_list.h>
 #include <bsl_utility.h>
+#include <bsl_vector.h>
 #include <bslma_default.h>
 #include <bsls_alignedbuffer.h>
 
@@ -1279,6 +1280,132 @@ static void test10_bidirectionalIteration()
     s_allocator_p->deallocate(p);
 }
 
+static void test11_advance()
+// ------------------------------------------------------------------------
+// ADVANCE
+//
+// Concerns:
+//   1. Advancing by N records positions the iterator on the same record
+//      as invoking 'nextRecord' N times, both from a freshly reset
+//      iterator and from an iterator already pointing to a record.
+//   2. Advancing past the last record invalidates the iterator.
+//   3. Concerns 1 and 2 also hold when iterating in reverse.
+//
+// Testing:
+//   advance
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("ADVANCE");
+
+    const unsigned int k_NUM_RECORDS = 500;
+
+    bsls::Types::Uint64 totalSize =
+        sizeof(FileHeader) + sizeof(JournalFileHeader) +
+        k_NUM_RECORDS * FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
+
+    char* p = static_cast<char*>(s_allocator_p->allocate(totalSize));
+
+    MemoryBlock         block(p, totalSize);
+    FileHeader          fileHeader;
+    bsls::Types::Uint64 lastRecordPos = 0;
+    bsls::Types::Uint64 lastSyncPtPos = 0;
+    RecordsListType     records(s_allocator_p);
+
+    addRecords(&block,
+               &fileHeader,
+               &lastRecordPos,
+               &lastSyncPtPos,
+               &records,
+               k_NUM_RECORDS);
+
+    MappedFileDescriptor mfd;
+    mfd.setFd(-1);  // invalid fd will suffice.
+    mfd.setBlock(block);
+    mfd.setFileSize(totalSize);
+
+    // Collect the offsets of all records, iterating one record at a time.
+    bsl::vector<bsls::Types::Uint64> offsets(s_allocator_p);
+    {
+        JournalFileIterator it(&mfd, fileHeader, false);
+        while (it.nextRecord() == 1) {
+            offsets.push_back(it.recordOffset());
+        }
+    }
+    ASSERT_EQ(offsets.size(), k_NUM_RECORDS);
+
+    const unsigned int k_STEPS[] = {1, 2, 3, 17, 100, 499, 500};
+    const size_t       k_NUM_STEPS = sizeof(k_STEPS) / sizeof(*k_STEPS);
+
+    PVV("Advance from a freshly reset iterator");
+    for (size_t i = 0; i < k_NUM_STEPS; ++i) {
+        JournalFileIterator it(&mfd, fileHeader, false);
+
+        ASSERT_EQ_D(i, 1, it.advance(k_STEPS[i]));
+        ASSERT_EQ_D(i, offsets[k_STEPS[i] - 1], it.recordOffset());
+        ASSERT_EQ_D(i, k_STEPS[i] - 1, it.recordIndex());
+    }
+
+    PVV("Advance from an iterator pointing to a record");
+    {
+        JournalFileIterator it(&mfd, fileHeader, false);
+        ASSERT_EQ(1, it.nextRecord());
+
+        unsigned int index = 0;
+        for (size_t i = 0; i < k_NUM_STEPS; ++i) {
+            if (index + k_STEPS[i] >= k_NUM_RECORDS) {
+                break;  // BREAK
+            }
+            index += k_STEPS[i];
+
+            ASSERT_EQ_D(i, 1, it.advance(k_STEPS[i]));
+            ASSERT_EQ_D(i, offsets[index], it.recordOffset());
+            ASSERT_EQ_D(i, index, it.recordIndex());
+        }
+    }
+
+    PVV("Advance past the last record");
+    {
+        JournalFileIterator it(&mfd, fileHeader, false);
+        ASSERT_NE(1, it.advance(k_NUM_RECORDS + 1));
+        ASSERT_EQ(false, it.isValid());
+    }
+    {
+        JournalFileIterator it(&mfd, fileHeader, false);
+        ASSERT_EQ(1, it.advance(k_NUM_RECORDS));
+        ASSERT_NE(1, it.advance(1));
+        ASSERT_EQ(false, it.isValid());
+    }
+
+    PVV("Advance in reverse");
+    {
+        bsl::vector<bsls::Types::Uint64> indices(s_allocator_p);
+        {
+            JournalFileIterator it(&mfd, fileHeader, true);
+            while (it.nextRecord() == 1) {
+                indices.push_back(it.recordIndex());
+            }
+        }
+        ASSERT_EQ(indices.size(), k_NUM_RECORDS);
+
+        for (size_t i = 0; i < k_NUM_STEPS; ++i) {
+            JournalFileIterator it(&mfd, fileHeader, true);
+
+            ASSERT_EQ_D(i, 1, it.advance(k_STEPS[i]));
+            ASSERT_EQ_D(i,
+                        offsets[k_NUM_RECORDS - k_STEPS[i]],
+                        it.recordOffset());
+            ASSERT_EQ_D(i, indices[k_STEPS[i] - 1], it.recordIndex());
+        }
+
+        JournalFileIterator it(&mfd, fileHeader, true);
+        ASSERT_EQ(1, it.advance(k_NUM_RECORDS));
+        ASSERT_NE(1, it.advance(1));
+        ASSERT_EQ(false, it.isValid());
+    }
+
+    s_allocator_p->deallocate(p);
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1291,6 +1418,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 11: test11_advance(); break;
     case 10: test10_bidirectionalIteration(); break;
     case 9: test9_backwardIterationOfSparseJournalFileWithRecords(); break;
     case 8: test8_forwardIterationOfSparseJournalFileWithRecords(); break;
@@ -57,6 +57,11 @@ class MappedFileDescriptor {
     int d_fd;  // File descriptor of the memory mapped
                // file
 
+    bool d_isPersistentMemory;  // Whether the file is mapped directly
+                                // onto persistent memory (DAX), its
+                                // writes being made durable by
+                                // flushing the CPU caches
+
     bsls::Types::Uint64 d_fileSize;  // Size of the mapped file
 
     MemoryBlock d_block;  // Contiguous block of memory used for
@@ -79,6 +84,7 @@ class MappedFileDescriptor {
     MappedFileDescriptor& setFileSize(bsls::Types::Uint64 value);
     MappedFileDescriptor& setBlock(const MemoryBlock& value);
     MappedFileDescriptor& setMapping(char* value);
+    MappedFileDescriptor& setPersistentMemory(bool value);
 
     /// Set the corresponding field to the specified `value`.
     MappedFileDescriptor& setMappingSize(bsls::Types::Uint64 value);
@@ -95,6 +101,7 @@ class MappedFileDescriptor {
     bsls::Types::Uint64 fileSize() const;
     const MemoryBlock&  block() const;
     char*               mapping() const;
+    bool                isPersistentMemory() const;
 
     /// Return the corresponding value.
     bsls::Types::Uint64 mappingSize() const;
@@ -148,10 +155,18 @@ MappedFileDescriptor::setMappingSize(bsls::Types::Uint64 value)
     return *this;
 }
 
+inline MappedFileDescriptor&
+MappedFileDescriptor::setPersistentMemory(bool value)
+{
+    d_isPersistentMemory = value;
+    return *this;
+}
+
 inline void MappedFileDescriptor::reset()
 {
-    d_fd       = k_INVALID_FILE_DESCRIPTOR;
-    d_fileSize = 0;
+    d_fd                 = k_INVALID_FILE_DESCRIPTOR;
+    d_isPersistentMemory = false;
+    d_fileSize           = 0;
     d_block.reset(0, k_INVALID_MAPPING_SIZE);
 }
 
@@ -181,6 +196,11 @@ inline bsls::Types::Uint64 MappedFileDescriptor::mappingSize() const
     return d_block.size();
 }
 
+inline bool MappedFileDescriptor::isPersistentMemory() const
+{
+    return d_isPersistentMemory;
+}
+
 inline bool MappedFileDescriptor::isValid() const
 {
     if (k_INVALID_FILE_DESCRIPTOR == d_fd) {
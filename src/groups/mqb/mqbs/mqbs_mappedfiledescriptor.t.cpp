@@ -53,6 +53,7 @@ static void test1_breathingTest()
     ASSERT_EQ(obj.mappingSize(),
               static_cast<bsls::Types::Uint64>(obj.k_INVALID_MAPPING_SIZE));
     ASSERT_EQ(obj.mapping(), obj.k_INVALID_MAPPING);
+    ASSERT(!obj.isPersistentMemory());
     ASSERT(!obj.isValid());
 }
 
@@ -81,7 +82,8 @@ static void test2_operations()
         .setFileSize(fileSize)
         .setBlock(block)
         .setMapping(block.base())
-        .setMappingSize(block.size());
+        .setMappingSize(block.size())
+        .setPersistentMemory(true);
 
     ASSERT(obj.isValid());
 
@@ -90,6 +92,7 @@ static void test2_operations()
     ASSERT_EQ(obj.fileSize(), fileSize);
     ASSERT_EQ(obj.mapping(), block.base());
     ASSERT_EQ(obj.mappingSize(), block.size());
+    ASSERT(obj.isPersistentMemory());
 }
 
 static void test3_reset()
@@ -116,7 +119,8 @@ static void test3_reset()
         .setFileSize(fileSize)
         .setBlock(block)
         .setMapping(block.base())
-        .setMappingSize(block.size());
+        .setMappingSize(block.size())
+        .setPersistentMemory(true);
 
     ASSERT(obj.isValid());
 
@@ -128,6 +132,7 @@ static void test3_reset()
     ASSERT_EQ(obj.mappingSize(),
               static_cast<bsls::Types::Uint64>(obj.k_INVALID_MAPPING_SIZE));
     ASSERT_EQ(obj.mapping(), obj.k_INVALID_MAPPING);
+    ASSERT(!obj.isPersistentMemory());
     ASSERT(!obj.isValid());
 }
 
@@ -0,0 +1,267 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_recoveryindex.cpp                                             -*-C++-*-
+#include <mqbs_recoveryindex.h>
+
+#include <mqbscm_version.h>
+// BDE
+#include <bdlb_bigendian.h>
+#include <bdls_filesystemutil.h>
+#include <bsl_fstream.h>
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+namespace {
+
+/// Fixed size header of a recovery index file.
+struct Header {
+    bdlb::BigEndianUint32 d_magic;
+
+    bdlb::BigEndianUint32 d_version;
+
+    bdlb::BigEndianUint32 d_primaryLeaseId;
+
+    bdlb::BigEndianUint32 d_journalFileNameLength;
+
+    bdlb::BigEndianUint64 d_sequenceNumber;
+
+    bdlb::BigEndianUint64 d_journalPosition;
+
+    bdlb::BigEndianUint64 d_numRecords;
+};
+
+/// Upper bound to the length of the journal file name, to protect against
+/// corrupted files.
+const unsigned int k_MAX_JOURNAL_FILE_NAME_LENGTH = 4096;
+
+}  // close unnamed namespace
+
+// -------------------
+// class RecoveryIndex
+// -------------------
+
+// CONSTANTS
+const unsigned int RecoveryIndex::k_MAGIC = 0x52494458;  // 'RIDX'
+
+const unsigned int RecoveryIndex::k_VERSION = 1;
+
+// CREATORS
+RecoveryIndex::RecoveryIndex(bslma::Allocator* basicAllocator)
+: d_journalFileName(basicAllocator)
+, d_journalPosition(0)
+, d_primaryLeaseId(0)
+, d_sequenceNumber(0)
+, d_recordOffsets(basicAllocator)
+{
+    // NOTHING
+}
+
+RecoveryIndex::RecoveryIndex(const RecoveryIndex& src,
+                             bslma::Allocator*    basicAllocator)
+: d_journalFileName(src.d_journalFileName, basicAllocator)
+, d_journalPosition(src.d_journalPosition)
+, d_primaryLeaseId(src.d_primaryLeaseId)
+, d_sequenceNumber(src.d_sequenceNumber)
+, d_recordOffsets(src.d_recordOffsets, basicAllocator)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+void RecoveryIndex::reset()
+{
+    d_journalFileName.clear();
+    d_journalPosition = 0;
+    d_primaryLeaseId  = 0;
+    d_sequenceNumber  = 0;
+    d_recordOffsets.clear();
+}
+
+int RecoveryIndex::load(bsl::ostream&      errorDescription,
+                        const bsl::string& path)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS          = 0,
+        rc_OPEN_FAILURE     = -1,
+        rc_READ_FAILURE     = -2,
+        rc_INVALID_MAGIC    = -3,
+        rc_INVALID_VERSION  = -4,
+        rc_INVALID_CONTENTS = -5
+    };
+
+    reset();
+
+    bsl::ifstream file(path.c_str(), bsl::ios::in | bsl::ios::binary);
+    if (!file) {
+        errorDescription << "Failed to open recovery index file [" << path
+                         << "]";
+        return rc_OPEN_FAILURE;  // RETURN
+    }
+
+    Header header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        errorDescription << "Failed to read the header of recovery index "
+                         << "file [" << path << "]";
+        return rc_READ_FAILURE;  // RETURN
+    }
+
+    if (k_MAGIC != header.d_magic) {
+        errorDescription << "Invalid magic in recovery index file [" << path
+                         << "]: " << static_cast<unsigned int>(header.d_magic);
+        return rc_INVALID_MAGIC;  // RETURN
+    }
+
+    if (k_VERSION != header.d_version) {
+        errorDescription << "Unsupported version "
+                         << static_cast<unsigned int>(header.d_version)
+                         << " of recovery index file [" << path << "]";
+        return rc_INVALID_VERSION;  // RETURN
+    }
+
+    const unsigned int nameLength = header.d_journalFileNameLength;
+    if (nameLength > k_MAX_JOURNAL_FILE_NAME_LENGTH) {
+        errorDescription << "Invalid journal file name length " << nameLength
+                         << " in recovery index file [" << path << "]";
+        return rc_INVALID_CONTENTS;  // RETURN
+    }
+
+    // Ensure that the file is big enough for the declared number of records
+    // before allocating memory for them.
+    const bsls::Types::Uint64 numRecords = header.d_numRecords;
+    const bsls::Types::Int64  fileSize   = bdls::FilesystemUtil::getFileSize(
+        path);
+    if (fileSize < 0 ||
+        static_cast<bsls::Types::Uint64>(fileSize) !=
+            sizeof(header) + nameLength +
+                numRecords * sizeof(bdlb::BigEndianUint64)) {
+        errorDescription << "Unexpected size " << fileSize
+                         << " of recovery index file [" << path << "] for "
+                         << numRecords << " records";
+        return rc_INVALID_CONTENTS;  // RETURN
+    }
+
+    d_journalFileName.resize(nameLength);
+    if (nameLength > 0 && !file.read(&d_journalFileName[0], nameLength)) {
+        errorDescription << "Failed to read the journal file name of recovery "
+                         << "index file [" << path << "]";
+        return rc_READ_FAILURE;  // RETURN
+    }
+
+    d_recordOffsets.resize(numRecords);
+    for (bsls::Types::Uint64 i = 0; i < numRecords; ++i) {
+        bdlb::BigEndianUint64 offset;
+        if (!file.read(reinterpret_cast<char*>(&offset), sizeof(offset))) {
+            errorDescription << "Failed to read record offsets of recovery "
+                             << "index file [" << path << "]";
+            return rc_READ_FAILURE;  // RETURN
+        }
+
+        d_recordOffsets[i] = offset;
+        if (i > 0 && d_recordOffsets[i] <= d_recordOffsets[i - 1]) {
+            errorDescription << "Record offsets of recovery index file ["
+                             << path << "] are not in ascending order";
+            return rc_INVALID_CONTENTS;  // RETURN
+        }
+    }
+
+    d_primaryLeaseId  = header.d_primaryLeaseId;
+    d_sequenceNumber  = header.d_sequenceNumber;
+    d_journalPosition = header.d_journalPosition;
+
+    if (!d_recordOffsets.empty() &&
+        d_recordOffsets.back() >= d_journalPosition) {
+        errorDescription << "Record offsets of recovery index file [" << path
+                         << "] are beyond the checkpoint position "
+                         << d_journalPosition;
+        return rc_INVALID_CONTENTS;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+// ACCESSORS
+int RecoveryIndex::save(bsl::ostream&      errorDescription,
+                        const bsl::string& path) const
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS        = 0,
+        rc_OPEN_FAILURE   = -1,
+        rc_WRITE_FAILURE  = -2,
+        rc_RENAME_FAILURE = -3
+    };
+
+    // Write to a temporary file first, and rename it, so that a crash while
+    // saving never leaves a partially written index behind.
+    bsl::string tempPath(path, path.get_allocator());
+    tempPath.append(".tmp");
+
+    {
+        bsl::ofstream file(tempPath.c_str(),
+                           bsl::ios::out | bsl::ios::binary |
+                               bsl::ios::trunc);
+        if (!file) {
+            errorDescription << "Failed to open recovery index file ["
+                             << tempPath << "]";
+            return rc_OPEN_FAILURE;  // RETURN
+        }
+
+        Header header;
+        header.d_magic                 = k_MAGIC;
+        header.d_version               = k_VERSION;
+        header.d_primaryLeaseId        = d_primaryLeaseId;
+        header.d_journalFileNameLength = static_cast<unsigned int>(
+            d_journalFileName.length());
+        header.d_sequenceNumber  = d_sequenceNumber;
+        header.d_journalPosition = d_journalPosition;
+        header.d_numRecords      = d_recordOffsets.size();
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(d_journalFileName.data(), d_journalFileName.length());
+        for (RecordOffsets::const_iterator cit = d_recordOffsets.begin();
+             cit != d_recordOffsets.end();
+             ++cit) {
+            const bdlb::BigEndianUint64 offset = bdlb::BigEndianUint64::make(
+                *cit);
+            file.write(reinterpret_cast<const char*>(&offset),
+                       sizeof(offset));
+        }
+
+        file.close();
+        if (!file) {
+            errorDescription << "Failed to write recovery index file ["
+                             << tempPath << "]";
+            bdls::FilesystemUtil::remove(tempPath);
+            return rc_WRITE_FAILURE;  // RETURN
+        }
+    }
+
+    const int rc = bdls::FilesystemUtil::move(tempPath, path);
+    if (0 != rc) {
+        errorDescription << "Failed to rename recovery index file ["
+                         << tempPath << "] to [" << path << "], rc: " << rc;
+        bdls::FilesystemUtil::remove(tempPath);
+        return rc_RENAME_FAILURE;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
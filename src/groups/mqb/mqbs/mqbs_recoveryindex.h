@@ -0,0 +1,243 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_recoveryindex.h                                               -*-C++-*-
+#ifndef INCLUDED_MQBS_RECOVERYINDEX
+#define INCLUDED_MQBS_RECOVERYINDEX
+
+//@PURPOSE: Provide a VST to checkpoint the live records of a journal.
+//
+//@CLASSES:
+//  mqbs::RecoveryIndex: VST capturing the live records of a journal.
+//
+//@DESCRIPTION: This component provides a VST class, 'mqbs::RecoveryIndex',
+// capturing, at a given point of time (the checkpoint), the offsets of the
+// records of a journal file which are still needed to recover the partition
+// (outstanding records and sync points), along with the position of the end
+// of the journal at that time and the (primaryLeaseId, sequenceNumber) of the
+// last record before that position.  The index can be saved to, and loaded
+// from, a sidecar file of the journal.
+//
+// At recovery, the records located before the checkpoint position and which
+// are not in the index can be skipped without being read, as they had been
+// deleted (or were superseded) at the time of the checkpoint.  Only the tail
+// of the journal written after the checkpoint needs to be fully iterated.
+// Note that the index is only a hint: it must be validated against the
+// journal it refers to (see 'journalFileName', 'primaryLeaseId' and
+// 'sequenceNumber') before being used.
+//
+/// File Format
+///-----------
+// All fields are stored in network byte order.
+//..
+//  +---------------+---------------+---------------+---------------+
+//  |                             Magic                             |
+//  +---------------+---------------+---------------+---------------+
+//  |                            Version                            |
+//  +---------------+---------------+---------------+---------------+
+//  |                        PrimaryLeaseId                         |
+//  +---------------+---------------+---------------+---------------+
+//  |                     JournalFileNameLength                     |
+//  +---------------+---------------+---------------+---------------+
+//  |                        SequenceNumber                         |
+//  |                                                               |
+//  +---------------+---------------+---------------+---------------+
+//  |                        JournalPosition                        |
+//  |                                                               |
+//  +---------------+---------------+---------------+---------------+
+//  |                          NumRecords                           |
+//  |                                                               |
+//  +---------------+---------------+---------------+---------------+
+//  |             JournalFileName (JournalFileNameLength)           |
+//  +---------------+---------------+---------------+---------------+
+//  |                 RecordOffsets (NumRecords * 8)                |
+//  +---------------+---------------+---------------+---------------+
+//..
+
+// MQB
+
+// BDE
+#include <bsl_iosfwd.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_cpp11.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+
+namespace mqbs {
+
+// ===================
+// class RecoveryIndex
+// ===================
+
+/// This class provides a VST to capture the live records of a journal at a
+/// given point of time.
+class RecoveryIndex BSLS_CPP11_FINAL {
+  public:
+    // TYPES
+    typedef bsl::vector<bsls::Types::Uint64> RecordOffsets;
+
+    // CONSTANTS
+    static const unsigned int k_MAGIC;
+
+    static const unsigned int k_VERSION;
+
+  private:
+    // DATA
+    bsl::string d_journalFileName;
+    // Name (without directory) of the
+    // journal file this index refers to.
+
+    bsls::Types::Uint64 d_journalPosition;
+    // Position of the end of the journal at
+    // the time of the checkpoint.
+
+    unsigned int d_primaryLeaseId;
+    // Primary leaseId of the last record
+    // before 'd_journalPosition'.
+
+    bsls::Types::Uint64 d_sequenceNumber;
+    // Sequence number of the last record
+    // before 'd_journalPosition'.
+
+    RecordOffsets d_recordOffsets;
+    // Offsets, in ascending order, of the
+    // live records before
+    // 'd_journalPosition'.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(RecoveryIndex, bslma::UsesBslmaAllocator)
+
+  public:
+    // CREATORS
+    explicit RecoveryIndex(bslma::Allocator* basicAllocator = 0);
+
+    RecoveryIndex(const RecoveryIndex& src,
+                  bslma::Allocator*    basicAllocator = 0);
+
+    // MANIPULATORS
+    RecoveryIndex& setJournalFileName(const bsl::string& value);
+    RecoveryIndex& setJournalPosition(bsls::Types::Uint64 value);
+    RecoveryIndex& setPrimaryLeaseId(unsigned int value);
+
+    /// Set the corresponding attribute to the specified `value` and return
+    /// a reference offering modifiable access to this object.
+    RecoveryIndex& setSequenceNumber(bsls::Types::Uint64 value);
+
+    /// Return a reference offering modifiable access to the record offsets
+    /// of this object.
+    RecordOffsets& recordOffsets();
+
+    /// Reset this object to its default constructed state.
+    void reset();
+
+    /// Load this object from the file having the specified `path`.  Return
+    /// zero on success, and a non-zero value otherwise with the specified
+    /// `errorDescription` containing a detailed error, in which case the
+    /// state of this object is unspecified.
+    int load(bsl::ostream& errorDescription, const bsl::string& path);
+
+    // ACCESSORS
+    const bsl::string&   journalFileName() const;
+    bsls::Types::Uint64  journalPosition() const;
+    unsigned int         primaryLeaseId() const;
+    bsls::Types::Uint64  sequenceNumber() const;
+    const RecordOffsets& recordOffsets() const;
+
+    /// Save this object to the file having the specified `path`, replacing
+    /// it atomically if it exists.  Return zero on success, and a non-zero
+    /// value otherwise with the specified `errorDescription` containing a
+    /// detailed error, in which case any existing file at `path` is left
+    /// unchanged.
+    int save(bsl::ostream& errorDescription, const bsl::string& path) const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// -------------------
+// class RecoveryIndex
+// -------------------
+
+// MANIPULATORS
+inline RecoveryIndex&
+RecoveryIndex::setJournalFileName(const bsl::string& value)
+{
+    d_journalFileName = value;
+    return *this;
+}
+
+inline RecoveryIndex&
+RecoveryIndex::setJournalPosition(bsls::Types::Uint64 value)
+{
+    d_journalPosition = value;
+    return *this;
+}
+
+inline RecoveryIndex& RecoveryIndex::setPrimaryLeaseId(unsigned int value)
+{
+    d_primaryLeaseId = value;
+    return *this;
+}
+
+inline RecoveryIndex&
+RecoveryIndex::setSequenceNumber(bsls::Types::Uint64 value)
+{
+    d_sequenceNumber = value;
+    return *this;
+}
+
+inline RecoveryIndex::RecordOffsets& RecoveryIndex::recordOffsets()
+{
+    return d_recordOffsets;
+}
+
+// ACCESSORS
+inline const bsl::string& RecoveryIndex::journalFileName() const
+{
+    return d_journalFileName;
+}
+
+inline bsls::Types::Uint64 RecoveryIndex::journalPosition() const
+{
+    return d_journalPosition;
+}
+
+inline unsigned int RecoveryIndex::primaryLeaseId() const
+{
+    return d_primaryLeaseId;
+}
+
+inline bsls::Types::Uint64 RecoveryIndex::sequenceNumber() const
+{
+    return d_sequenceNumber;
+}
+
+inline const RecoveryIndex::RecordOffsets&
+RecoveryIndex::recordOffsets() const
+{
+    return d_recordOffsets;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
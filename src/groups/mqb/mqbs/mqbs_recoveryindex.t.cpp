@@ -0,0 +1,163 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_recoveryindex.t.cpp                                           -*-C++-*-
+#include <mqbs_recoveryindex.h>
+
+// MWC
+#include <mwcu_memoutstream.h>
+#include <mwcu_tempdirectory.h>
+
+// BDE
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+#include <bsl_fstream.h>
+#include <bsl_string.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   1. A saved index is loaded back with the same attributes.
+//   2. Saving replaces an existing index.
+//   3. Loading a missing or corrupted file fails.
+//
+// Testing:
+//   RecoveryIndex()
+//   save
+//   load
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    mwcu::TempDirectory tempDir(s_allocator_p);
+    bsl::string         path(tempDir.path(), s_allocator_p);
+    bdls::PathUtil::appendRaw(&path, "bmq_0.index");
+
+    bsl::string tempPath(path, s_allocator_p);
+    tempPath.append(".tmp");
+
+    bsl::string missingPath(path, s_allocator_p);
+    missingPath.append(".missing");
+
+    mqbs::RecoveryIndex obj(s_allocator_p);
+    obj.setJournalFileName(
+           bsl::string("bmq_0.20230101_000000.bmq_journal", s_allocator_p))
+        .setJournalPosition(1000)
+        .setPrimaryLeaseId(3)
+        .setSequenceNumber(42);
+    obj.recordOffsets().push_back(60);
+    obj.recordOffsets().push_back(120);
+    obj.recordOffsets().push_back(900);
+
+    PVV("Save and load");
+    {
+        mwcu::MemOutStream errorDesc(s_allocator_p);
+        ASSERT_EQ(0, obj.save(errorDesc, path));
+        ASSERT(!bdls::FilesystemUtil::exists(tempPath));
+
+        mqbs::RecoveryIndex loaded(s_allocator_p);
+        ASSERT_EQ(0, loaded.load(errorDesc, path));
+        ASSERT_EQ(loaded.journalFileName(), obj.journalFileName());
+        ASSERT_EQ(loaded.journalPosition(), obj.journalPosition());
+        ASSERT_EQ(loaded.primaryLeaseId(), obj.primaryLeaseId());
+        ASSERT_EQ(loaded.sequenceNumber(), obj.sequenceNumber());
+        ASSERT(loaded.recordOffsets() == obj.recordOffsets());
+    }
+
+    PVV("Save replaces the existing index");
+    {
+        obj.setSequenceNumber(43);
+        obj.recordOffsets().clear();
+
+        mwcu::MemOutStream errorDesc(s_allocator_p);
+        ASSERT_EQ(0, obj.save(errorDesc, path));
+
+        mqbs::RecoveryIndex loaded(s_allocator_p);
+        ASSERT_EQ(0, loaded.load(errorDesc, path));
+        ASSERT_EQ(43U, loaded.sequenceNumber());
+        ASSERT(loaded.recordOffsets().empty());
+    }
+
+    PVV("Load a missing file");
+    {
+        mwcu::MemOutStream  errorDesc(s_allocator_p);
+        mqbs::RecoveryIndex loaded(s_allocator_p);
+        ASSERT_NE(0, loaded.load(errorDesc, missingPath));
+    }
+
+    PVV("Load a truncated file");
+    {
+        obj.recordOffsets().push_back(60);
+        mwcu::MemOutStream errorDesc(s_allocator_p);
+        ASSERT_EQ(0, obj.save(errorDesc, path));
+
+        const bsls::Types::Int64 size = bdls::FilesystemUtil::getFileSize(
+            path);
+        bdls::FilesystemUtil::FileDescriptor fd = bdls::FilesystemUtil::open(
+            path,
+            bdls::FilesystemUtil::e_OPEN,
+            bdls::FilesystemUtil::e_READ_WRITE);
+        ASSERT(fd != bdls::FilesystemUtil::k_INVALID_FD);
+        ASSERT_EQ(0, bdls::FilesystemUtil::truncateFileSize(fd, size - 1));
+        bdls::FilesystemUtil::close(fd);
+
+        mqbs::RecoveryIndex loaded(s_allocator_p);
+        ASSERT_NE(0, loaded.load(errorDesc, path));
+    }
+
+    PVV("Load a file with an invalid magic");
+    {
+        bsl::ofstream file(path.c_str(), bsl::ios::out | bsl::ios::binary);
+        file << "not a recovery index, not a recovery index";
+        file.close();
+
+        mwcu::MemOutStream  errorDesc(s_allocator_p);
+        mqbs::RecoveryIndex loaded(s_allocator_p);
+        ASSERT_NE(0, loaded.load(errorDesc, path));
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
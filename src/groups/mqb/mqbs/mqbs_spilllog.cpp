@@ -0,0 +1,219 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_spilllog.cpp                                                  -*-C++-*-
+#include <mqbs_spilllog.h>
+
+#include <mqbscm_version.h>
+// BDE
+#include <bsl_c_errno.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_vector.h>
+#include <bslma_default.h>
+#include <bsls_assert.h>
+
+// SYS
+#include <fcntl.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+// --------------
+// class SpillLog
+// --------------
+
+// CREATORS
+SpillLog::SpillLog(bslma::Allocator* allocator)
+: d_fd(-1)
+, d_size(0)
+, d_allocator_p(bslma::Default::allocator(allocator))
+{
+    // NOTHING
+}
+
+SpillLog::~SpillLog()
+{
+    close();
+}
+
+// MANIPULATORS
+int SpillLog::open(bsl::ostream& errorDescription, const bsl::string& location)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!isOpen());
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS       = 0,
+        rc_CREATE_FAILED = -1,
+        rc_UNLINK_FAILED = -2
+    };
+
+    bsl::string pattern(location, d_allocator_p);
+    pattern.append("/bmq_spill_XXXXXX");
+
+    // 'mkstemp' modifies its argument in place.
+    bsl::vector<char> path(pattern.begin(), pattern.end(), d_allocator_p);
+    path.push_back('\0');
+
+    const int fd = ::mkstemp(path.data());
+    if (fd < 0) {
+        errorDescription << "Failed to create spill file in [" << location
+                         << "], errno: " << errno << " ["
+                         << bsl::strerror(errno) << "]";
+        return rc_CREATE_FAILED;  // RETURN
+    }
+
+    // Remove the file from the directory right away, so that its space is
+    // reclaimed once it is closed, whichever way the process terminates.
+    if (::unlink(path.data()) != 0) {
+        errorDescription << "Failed to unlink spill file [" << path.data()
+                         << "], errno: " << errno << " ["
+                         << bsl::strerror(errno) << "]";
+        ::close(fd);
+        return rc_UNLINK_FAILED;  // RETURN
+    }
+
+    d_fd   = fd;
+    d_size = 0;
+
+    return rc_SUCCESS;
+}
+
+void SpillLog::close()
+{
+    if (!isOpen()) {
+        return;  // RETURN
+    }
+
+    ::close(d_fd);
+    d_fd   = -1;
+    d_size = 0;
+}
+
+int SpillLog::append(bsls::Types::Int64* offset, const bdlbb::Blob& blob)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(offset);
+    BSLS_ASSERT_SAFE(isOpen());
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS      = 0,
+        rc_WRITE_FAILED = -1
+    };
+
+    bsls::Types::Int64 position = d_size;
+    for (int i = 0; i < blob.numDataBuffers(); ++i) {
+        const char* data   = blob.buffer(i).data();
+        int         length = i == blob.numDataBuffers() - 1
+                                 ? blob.lastDataBufferLength()
+                                 : blob.buffer(i).size();
+        while (length > 0) {
+            const ssize_t rc = ::pwrite(d_fd, data, length, position);
+            if (rc < 0) {
+                if (errno == EINTR) {
+                    continue;  // CONTINUE
+                }
+                // Whatever was written past 'd_size' is overwritten by the
+                // next append.
+                return rc_WRITE_FAILED;  // RETURN
+            }
+            data += rc;
+            length -= static_cast<int>(rc);
+            position += rc;
+        }
+    }
+
+    *offset = d_size;
+    d_size  = position;
+
+    return rc_SUCCESS;
+}
+
+void SpillLog::clear()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isOpen());
+
+    if (d_size == 0) {
+        return;  // RETURN
+    }
+
+    // Failing to truncate only delays reclaiming the space: the file is
+    // overwritten from its start by the next appends.
+    const int rc = ::ftruncate(d_fd, 0);
+    (void)rc;
+
+    d_size = 0;
+}
+
+// ACCESSORS
+int SpillLog::read(bsl::shared_ptr<bdlbb::Blob>* blob,
+                   bsls::Types::Int64            offset,
+                   int                           length) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(blob);
+    BSLS_ASSERT_SAFE(isOpen());
+    BSLS_ASSERT_SAFE(0 <= offset && 0 <= length);
+    BSLS_ASSERT_SAFE(offset + length <= d_size);
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS     = 0,
+        rc_READ_FAILED = -1,
+        rc_TRUNCATED   = -2
+    };
+
+    blob->createInplace(d_allocator_p, d_allocator_p);
+    if (length == 0) {
+        return rc_SUCCESS;  // RETURN
+    }
+
+    bsl::shared_ptr<char> buffer =
+        bslstl::SharedPtrUtil::createInplaceUninitializedBuffer(length,
+                                                                d_allocator_p);
+
+    int read = 0;
+    while (read < length) {
+        const ssize_t rc = ::pread(d_fd,
+                                   buffer.get() + read,
+                                   length - read,
+                                   offset + read);
+        if (rc < 0) {
+            if (errno == EINTR) {
+                continue;  // CONTINUE
+            }
+            blob->reset();
+            return rc_READ_FAILED;  // RETURN
+        }
+        if (rc == 0) {
+            blob->reset();
+            return rc_TRUNCATED;  // RETURN
+        }
+        read += static_cast<int>(rc);
+    }
+
+    (*blob)->appendDataBuffer(bdlbb::BlobBuffer(buffer, length));
+
+    return rc_SUCCESS;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,180 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_spilllog.h                                                    -*-C++-*-
+#ifndef INCLUDED_MQBS_SPILLLOG
+#define INCLUDED_MQBS_SPILLLOG
+
+//@PURPOSE: Provide a scratch log to move blobs out of memory.
+//
+//@CLASSES:
+//  mqbs::SpillLog: append-only scratch file of blobs.
+//
+//@DESCRIPTION: This component provides a mechanism, 'mqbs::SpillLog', to move
+// blobs out of memory: each blob appended to the log is written at the end of
+// a scratch file, and can be read back, into a newly allocated blob, from the
+// offset returned when it was appended.  The log does not keep track of the
+// blobs it holds: its owner records the offset and length of each of them,
+// and clears the log (truncating the scratch file) once none of them is needed
+// anymore.
+//
+// The scratch file is created with a unique name in the directory specified
+// to 'open', and removed from that directory right away, so that its space is
+// reclaimed as soon as the log is closed, including when the process
+// terminates abnormally.  Nothing written to the log outlives it, and nothing
+// is ever synced to disk.
+//
+/// Thread Safety
+///-------------
+// NOT thread-safe, except for 'read', which can be called concurrently with
+// itself.
+//
+/// Usage
+///-----
+//..
+//  mqbs::SpillLog log(allocator);
+//  bmqu::MemOutStream errorDesc;
+//  if (log.open(errorDesc, "/tmp") != 0) {
+//      // Keep the blob in memory
+//  }
+//
+//  bsls::Types::Int64 offset;
+//  int                rc = log.append(&offset, blob);
+//
+//  bsl::shared_ptr<bdlbb::Blob> copy;
+//  rc = log.read(&copy, offset, blob.length());
+//..
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bsl_memory.h>
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+// ==============
+// class SpillLog
+// ==============
+
+/// Mechanism appending blobs to, and reading them back from, a scratch
+/// file.
+class SpillLog {
+  private:
+    // DATA
+    int d_fd;
+    // Descriptor of the scratch file, or -1
+    // if this log is not open.
+
+    bsls::Types::Int64 d_size;
+    // Offset of the end of the data
+    // appended to the scratch file.
+
+    bslma::Allocator* d_allocator_p;
+    // Allocator used for the blobs read.
+    // Must be thread-safe since blobs may
+    // be released from any thread.
+
+  private:
+    // NOT IMPLEMENTED
+    SpillLog(const SpillLog&) BSLS_KEYWORD_DELETED;
+    SpillLog& operator=(const SpillLog&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(SpillLog, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a log which is not open.  Optionally specify an `allocator`
+    /// used to supply memory.  If `allocator` is 0, the currently installed
+    /// default allocator is used.
+    explicit SpillLog(bslma::Allocator* allocator = 0);
+
+    /// Close this log, and destroy it.
+    ~SpillLog();
+
+    // MANIPULATORS
+
+    /// Create the scratch file of this log in the directory having the
+    /// specified `location`.  Return 0 on success, or a non-zero value
+    /// otherwise with the specified `errorDescription` containing a
+    /// description of the error.  The behavior is undefined if this log is
+    /// already open.
+    int open(bsl::ostream& errorDescription, const bsl::string& location);
+
+    /// Close this log, discarding its contents.  This method has no effect
+    /// if this log is not open.
+    void close();
+
+    /// Append the contents of the specified `blob` to this log, and load
+    /// into the specified `offset` the offset from which they can be read.
+    /// Return 0 on success, or a non-zero value otherwise, in which case
+    /// this log is unchanged.  The behavior is undefined unless this log is
+    /// open.
+    int append(bsls::Types::Int64* offset, const bdlbb::Blob& blob);
+
+    /// Discard the contents of this log, releasing the disk space they
+    /// used.  The behavior is undefined unless this log is open.
+    void clear();
+
+    // ACCESSORS
+
+    /// Return `true` if this log is open, and `false` otherwise.
+    bool isOpen() const;
+
+    /// Return the number of bytes appended to this log since it was opened
+    /// or last cleared.
+    bsls::Types::Int64 size() const;
+
+    /// Load into the specified `blob` a new blob holding the specified
+    /// `length` bytes appended to this log from the specified `offset`.
+    /// Return 0 on success, or a non-zero value otherwise.  The behavior is
+    /// undefined unless this log is open, and unless `offset` and `length`
+    /// delimit bytes appended to this log since it was last cleared.
+    int read(bsl::shared_ptr<bdlbb::Blob>* blob,
+             bsls::Types::Int64            offset,
+             int                           length) const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// --------------
+// class SpillLog
+// --------------
+
+// ACCESSORS
+inline bool SpillLog::isOpen() const
+{
+    return d_fd >= 0;
+}
+
+inline bsls::Types::Int64 SpillLog::size() const
+{
+    return d_size;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,172 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_spilllog.t.cpp                                                -*-C++-*-
+#include <mqbs_spilllog.h>
+
+// MWC
+#include <mwcu_memoutstream.h>
+#include <mwcu_tempdirectory.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Return the content of the specified `blob` as a string.
+bsl::string toString(const bdlbb::Blob& blob)
+{
+    bsl::string result(s_allocator_p);
+    for (int i = 0; i < blob.numDataBuffers(); ++i) {
+        result.append(blob.buffer(i).data(),
+                      i == blob.numDataBuffers() - 1
+                          ? blob.lastDataBufferLength()
+                          : blob.buffer(i).size());
+    }
+    return result;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   1. Opening creates a scratch file which does not appear in the
+//      directory, and fails if the directory does not exist.
+//   2. Blobs spanning several buffers are read back from the offset
+//      returned when they were appended.
+//   3. Clearing discards the contents, and the next blob is appended from
+//      the start of the log.
+//
+// Testing:
+//   SpillLog()
+//   open
+//   close
+//   append
+//   clear
+//   isOpen
+//   size
+//   read
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    mwcu::TempDirectory tempDir(s_allocator_p);
+
+    PVV("Open in a missing directory");
+    {
+        bsl::string path(tempDir.path(), s_allocator_p);
+        bdls::PathUtil::appendRaw(&path, "missing");
+
+        mwcu::MemOutStream errorDesc(s_allocator_p);
+        mqbs::SpillLog     log(s_allocator_p);
+        ASSERT_NE(0, log.open(errorDesc, path));
+        ASSERT(!log.isOpen());
+    }
+
+    PVV("Append and read");
+    {
+        mwcu::MemOutStream errorDesc(s_allocator_p);
+        mqbs::SpillLog     log(s_allocator_p);
+        ASSERT(!log.isOpen());
+        ASSERT_EQ(0, log.open(errorDesc, tempDir.path()));
+        ASSERT(log.isOpen());
+        ASSERT_EQ(0, log.size());
+
+        // The scratch file is anonymous
+        bsl::vector<bsl::string> files(s_allocator_p);
+        bsl::string              pattern(tempDir.path(), s_allocator_p);
+        bdls::PathUtil::appendRaw(&pattern, "*");
+        bdls::FilesystemUtil::findMatchingPaths(&files, pattern.c_str());
+        ASSERT(files.empty());
+
+        // Small buffers, so that the blobs span several of them
+        bdlbb::PooledBlobBufferFactory bufferFactory(4, s_allocator_p);
+        bdlbb::Blob                    first(&bufferFactory, s_allocator_p);
+        bdlbb::Blob                    second(&bufferFactory, s_allocator_p);
+        bdlbb::BlobUtil::append(&first, "hello world", 11);
+        bdlbb::BlobUtil::append(&second, "spilled", 7);
+
+        bsls::Types::Int64 firstOffset  = -1;
+        bsls::Types::Int64 secondOffset = -1;
+        ASSERT_EQ(0, log.append(&firstOffset, first));
+        ASSERT_EQ(0, log.append(&secondOffset, second));
+        ASSERT_EQ(0, firstOffset);
+        ASSERT_EQ(11, secondOffset);
+        ASSERT_EQ(18, log.size());
+
+        bsl::shared_ptr<bdlbb::Blob> blob;
+        ASSERT_EQ(0, log.read(&blob, secondOffset, 7));
+        ASSERT(blob);
+        ASSERT_EQ("spilled", toString(*blob));
+        ASSERT_EQ(0, log.read(&blob, firstOffset, 11));
+        ASSERT_EQ("hello world", toString(*blob));
+
+        log.clear();
+        ASSERT_EQ(0, log.size());
+
+        ASSERT_EQ(0, log.append(&secondOffset, second));
+        ASSERT_EQ(0, secondOffset);
+        ASSERT_EQ(0, log.read(&blob, secondOffset, 7));
+        ASSERT_EQ("spilled", toString(*blob));
+
+        log.close();
+        ASSERT(!log.isOpen());
+        ASSERT_EQ(0, log.size());
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -41,7 +41,9 @@
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
 #include <bsl_string.h>
+#include <bsl_unordered_map.h>
 #include <bsl_vector.h>
+#include <bslh_hash.h>
 #include <bsls_types.h>
 
 namespace BloombergLP {
@@ -126,7 +128,9 @@ struct StorageCollectionUtil {
     typedef StorageList::const_iterator           StorageListConstIter;
 
     /// QueueKey -> ReplicatedStorage* map
-    typedef bsl::unordered_map<mqbu::StorageKey, ReplicatedStorage*>
+    typedef bsl::unordered_map<mqbu::StorageKey,
+                               ReplicatedStorage*,
+                               bslh::Hash<mqbu::StorageKeyHashAlgo> >
                                         StoragesMap;
     typedef StoragesMap::iterator       StorageMapIter;
     typedef StoragesMap::const_iterator StorageMapConstIter;
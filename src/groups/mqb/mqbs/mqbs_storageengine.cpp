@@ -0,0 +1,114 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_storageengine.cpp                                             -*-C++-*-
+#include <mqbs_storageengine.h>
+
+#include <mqbscm_version.h>
+
+// BDE
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+namespace {
+
+/// Registered storage engines, the first `s_numEngines` being set.
+StorageEngine* s_engines_p[StorageEngineRegistry::k_MAX_ENGINES];
+
+/// Number of registered storage engines.
+int s_numEngines = 0;
+
+}  // close unnamed namespace
+
+// -------------------
+// class StorageEngine
+// -------------------
+
+// CREATORS
+StorageEngine::~StorageEngine()
+{
+    // NOTHING
+}
+
+// --------------------------------
+// class StorageEnginePluginFactory
+// --------------------------------
+
+// CREATORS
+StorageEnginePluginFactory::StorageEnginePluginFactory()
+{
+    // NOTHING
+}
+
+StorageEnginePluginFactory::~StorageEnginePluginFactory()
+{
+    // NOTHING
+}
+
+// ----------------------------
+// struct StorageEngineRegistry
+// ----------------------------
+
+// CLASS METHODS
+int StorageEngineRegistry::registerEngine(StorageEngine* engine)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(engine);
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS        = 0,
+        rc_DUPLICATE_NAME = -1,
+        rc_TOO_MANY       = -2
+    };
+
+    if (lookup(engine->name())) {
+        return rc_DUPLICATE_NAME;  // RETURN
+    }
+
+    if (s_numEngines == k_MAX_ENGINES) {
+        return rc_TOO_MANY;  // RETURN
+    }
+
+    s_engines_p[s_numEngines++] = engine;
+    return rc_SUCCESS;
+}
+
+void StorageEngineRegistry::unregisterEngine(StorageEngine* engine)
+{
+    for (int i = 0; i < s_numEngines; ++i) {
+        if (s_engines_p[i] == engine) {
+            s_engines_p[i] = s_engines_p[--s_numEngines];
+            s_engines_p[s_numEngines] = 0;
+            return;  // RETURN
+        }
+    }
+}
+
+StorageEngine* StorageEngineRegistry::lookup(const bslstl::StringRef& name)
+{
+    for (int i = 0; i < s_numEngines; ++i) {
+        if (s_engines_p[i]->name() == name) {
+            return s_engines_p[i];  // RETURN
+        }
+    }
+
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
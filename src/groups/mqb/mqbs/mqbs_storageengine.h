@@ -0,0 +1,194 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_storageengine.h                                               -*-C++-*-
+#ifndef INCLUDED_MQBS_STORAGEENGINE
+#define INCLUDED_MQBS_STORAGEENGINE
+
+//@PURPOSE: Provide base classes for the 'StorageEngine' plugin.
+//
+//@CLASSES:
+//  mqbs::StorageEngine: interface for a plugin of type 'e_STORAGE_ENGINE'
+//  mqbs::StorageEnginePluginFactory: base class for the 'StorageEngine'
+//                                    plugin factory
+//  mqbs::StorageEngineRegistry: registry of the started storage engines
+//
+//@DESCRIPTION: This component provides definitions for the classes
+// 'mqbs::StorageEngine' and 'mqbs::StorageEnginePluginFactory', used as base
+// classes for plugins creating the storages of the queues of a cluster, and
+// for their factories, and for the utility 'mqbs::StorageEngineRegistry',
+// holding the storage engines started by the broker.
+//
+// A cluster selects a storage engine by name, with the 'storageEngine' of its
+// partition configuration.  The storage of each of its queues is then created
+// by the engine instead of being an 'mqbs::InMemoryStorage' or an
+// 'mqbs::FileBackedStorage', for instance to keep the messages in a
+// specialized store (persistent memory, user space NVMe driver, ...).  The
+// storage is given the 'mqbs::DataStore' of the partition of the queue, which
+// it may use to journal and replicate its records like an
+// 'mqbs::FileBackedStorage' does.
+//
+// The factories are the plugin types seen by 'mqbplug::PluginManager'; they
+// are declared in this package, rather than in 'mqbplug', because their
+// interface is expressed with the types of this package, which depends on
+// 'mqbplug'.
+//
+/// Thread Safety
+///-------------
+// 'mqbs::StorageEngine::createStorage' may be called concurrently from any
+// thread.  The 'mqbs::StorageEngineRegistry' is *NOT* thread-safe: engines are
+// registered when the broker starts, before the clusters are created, and
+// unregistered once they are destroyed.
+
+// MQB
+#include <mqbplug_pluginfactory.h>
+#include <mqbs_replicatedstorage.h>
+
+// BDE
+#include <bsl_memory.h>
+#include <bsl_ostream.h>
+#include <bslma_allocator.h>
+#include <bslma_managedptr.h>
+#include <bsls_keyword.h>
+#include <bslstl_stringref.h>
+
+namespace BloombergLP {
+
+// FORWARD DECLARATION
+namespace bmqp {
+class RdaInfo;
+}
+namespace bmqt {
+class Uri;
+}
+namespace mqbconfm {
+class Domain;
+}
+namespace mqbu {
+class CapacityMeter;
+class StorageKey;
+}
+namespace mwcma {
+class CountingAllocatorStore;
+}
+
+namespace mqbs {
+
+// FORWARD DECLARATION
+class DataStore;
+
+// ===================
+// class StorageEngine
+// ===================
+
+/// Interface for a StorageEngine.
+class StorageEngine {
+  public:
+    // CREATORS
+
+    /// Destroy this object.
+    virtual ~StorageEngine();
+
+    // ACCESSORS
+
+    /// Return the name of the engine, as referred to by the `storageEngine`
+    /// of the partition configuration of a cluster.
+    virtual bslstl::StringRef name() const = 0;
+
+    // MANIPULATORS
+
+    /// Start the StorageEngine and return 0 on success, or return a
+    /// non-zero value and populate the specified `errorDescription` with
+    /// the description of any failure encountered.
+    virtual int start(bsl::ostream& errorDescription) = 0;
+
+    /// Stop the StorageEngine.  The behavior is undefined unless all the
+    /// storages created by this engine have been destroyed.
+    virtual void stop() = 0;
+
+    /// Load into the specified `storageSp` a new storage for the queue
+    /// identified by the specified `queueUri` and `queueKey`, belonging to
+    /// the partition of the specified `dataStore` and to a domain having
+    /// the specified `config`, `parentCapacityMeter` and `defaultRdaInfo`,
+    /// and using the specified `allocator` and the optionally specified
+    /// `allocatorStore` to supply memory.  Return 0 on success, or a
+    /// non-zero value and populate the specified `errorDescription`
+    /// otherwise, in which case `storageSp` is not modified.  Note that
+    /// this method is called from the same threads, and with the same
+    /// arguments, as the constructor of `mqbs::FileBackedStorage`.
+    virtual int
+    createStorage(bsl::shared_ptr<ReplicatedStorage>* storageSp,
+                  bsl::ostream&                       errorDescription,
+                  DataStore*                          dataStore,
+                  const bmqt::Uri&                    queueUri,
+                  const mqbu::StorageKey&             queueKey,
+                  const mqbconfm::Domain&             config,
+                  mqbu::CapacityMeter*                parentCapacityMeter,
+                  const bmqp::RdaInfo&                defaultRdaInfo,
+                  bslma::Allocator*                   allocator,
+                  mwcma::CountingAllocatorStore*      allocatorStore = 0) = 0;
+};
+
+// ================================
+// class StorageEnginePluginFactory
+// ================================
+
+/// This is the base class for the factory of plugins of type
+/// `StorageEngine`.  All it does is allow to instantiate a concrete object
+/// of the `StorageEngine` interface.
+class StorageEnginePluginFactory : public mqbplug::PluginFactory {
+  public:
+    // CREATORS
+    StorageEnginePluginFactory();
+
+    ~StorageEnginePluginFactory() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// Create a new StorageEngine using the specified `allocator`.
+    virtual bslma::ManagedPtr<StorageEngine>
+    create(bslma::Allocator* allocator) = 0;
+};
+
+// ============================
+// struct StorageEngineRegistry
+// ============================
+
+/// Registry of the storage engines started by the broker.
+struct StorageEngineRegistry {
+    // CONSTANTS
+
+    /// Maximum number of storage engines registered at once.
+    static const int k_MAX_ENGINES = 16;
+
+    // CLASS METHODS
+
+    /// Register the specified `engine`, under its name.  Return 0 on
+    /// success, or a non-zero value if an engine having the same name is
+    /// already registered, or if `k_MAX_ENGINES` engines are registered.
+    static int registerEngine(StorageEngine* engine);
+
+    /// Unregister the specified `engine`, if it is registered.
+    static void unregisterEngine(StorageEngine* engine);
+
+    /// Return the registered engine having the specified `name`, or 0 if
+    /// there is none.
+    static StorageEngine* lookup(const bslstl::StringRef& name);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
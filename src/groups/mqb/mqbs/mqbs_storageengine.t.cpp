@@ -0,0 +1,163 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_storageengine.t.cpp                                           -*-C++-*-
+#include <mqbs_storageengine.h>
+
+// BDE
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bsls_keyword.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// Storage engine having a given name, and creating no storage.
+class TestStorageEngine : public mqbs::StorageEngine {
+  private:
+    // DATA
+    bsl::string d_name;
+
+  public:
+    // CREATORS
+    TestStorageEngine(const bslstl::StringRef& name,
+                      bslma::Allocator*        allocator)
+    : d_name(name, allocator)
+    {
+        // NOTHING
+    }
+
+    // ACCESSORS
+    bslstl::StringRef name() const BSLS_KEYWORD_OVERRIDE { return d_name; }
+
+    // MANIPULATORS
+    int start(bsl::ostream&) BSLS_KEYWORD_OVERRIDE { return 0; }
+
+    void stop() BSLS_KEYWORD_OVERRIDE {}
+
+    int createStorage(bsl::shared_ptr<mqbs::ReplicatedStorage>*,
+                      bsl::ostream& errorDescription,
+                      mqbs::DataStore*,
+                      const bmqt::Uri&,
+                      const mqbu::StorageKey&,
+                      const mqbconfm::Domain&,
+                      mqbu::CapacityMeter*,
+                      const bmqp::RdaInfo&,
+                      bslma::Allocator*,
+                      mwcma::CountingAllocatorStore*) BSLS_KEYWORD_OVERRIDE
+    {
+        errorDescription << "not implemented";
+        return -1;
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_registry()
+// ------------------------------------------------------------------------
+// REGISTRY
+//
+// Concerns:
+//   1. A registered engine is found by its name, and no longer found once
+//      unregistered.
+//   2. An engine having the name of a registered engine is rejected.
+//   3. No more than 'k_MAX_ENGINES' engines are registered at once.
+//
+// Testing:
+//   registerEngine
+//   unregisterEngine
+//   lookup
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("REGISTRY");
+
+    TestStorageEngine engine1("engine1", s_allocator_p);
+    TestStorageEngine engine2("engine2", s_allocator_p);
+    TestStorageEngine duplicate("engine1", s_allocator_p);
+
+    ASSERT(mqbs::StorageEngineRegistry::lookup("engine1") == 0);
+
+    ASSERT_EQ(mqbs::StorageEngineRegistry::registerEngine(&engine1), 0);
+    ASSERT_EQ(mqbs::StorageEngineRegistry::registerEngine(&engine2), 0);
+    ASSERT_NE(mqbs::StorageEngineRegistry::registerEngine(&duplicate), 0);
+
+    ASSERT(mqbs::StorageEngineRegistry::lookup("engine1") == &engine1);
+    ASSERT(mqbs::StorageEngineRegistry::lookup("engine2") == &engine2);
+    ASSERT(mqbs::StorageEngineRegistry::lookup("engine3") == 0);
+
+    mqbs::StorageEngineRegistry::unregisterEngine(&engine1);
+    ASSERT(mqbs::StorageEngineRegistry::lookup("engine1") == 0);
+    ASSERT(mqbs::StorageEngineRegistry::lookup("engine2") == &engine2);
+
+    // Unregistering an engine which is not registered has no effect
+    mqbs::StorageEngineRegistry::unregisterEngine(&duplicate);
+    ASSERT(mqbs::StorageEngineRegistry::lookup("engine2") == &engine2);
+
+    mqbs::StorageEngineRegistry::unregisterEngine(&engine2);
+    ASSERT(mqbs::StorageEngineRegistry::lookup("engine2") == 0);
+
+    // Fill the registry
+    bsl::vector<bsl::shared_ptr<TestStorageEngine> > engines(s_allocator_p);
+    for (int i = 0; i < mqbs::StorageEngineRegistry::k_MAX_ENGINES; ++i) {
+        engines.push_back(bsl::allocate_shared<TestStorageEngine>(
+            s_allocator_p,
+            "engine" + bsl::to_string(i),
+            s_allocator_p));
+        ASSERT_EQ(
+            mqbs::StorageEngineRegistry::registerEngine(engines.back().get()),
+            0);
+    }
+    ASSERT_NE(mqbs::StorageEngineRegistry::registerEngine(&engine1), 0);
+
+    for (size_t i = 0; i < engines.size(); ++i) {
+        mqbs::StorageEngineRegistry::unregisterEngine(engines[i].get());
+    }
+    ASSERT_EQ(mqbs::StorageEngineRegistry::registerEngine(&engine1), 0);
+    mqbs::StorageEngineRegistry::unregisterEngine(&engine1);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 1: test1_registry(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
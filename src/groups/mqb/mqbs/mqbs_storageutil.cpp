@@ -17,8 +17,12 @@
 #include <mqbs_storageutil.h>
 
 #include <mqbscm_version.h>
+// MQB
+#include <mqbnet_channel.h>
+
 // BMQ
 #include <bmqp_protocol.h>
+#include <bmqt_resultcode.h>
 
 // MWC
 #include <mwcsys_time.h>
@@ -284,5 +288,83 @@ int StorageUtil::loadRecordHeaderAndPos(
     return rc_SUCCESS;
 }
 
+mqbnet::ClusterNode* StorageUtil::nextReplicationHop(mqbnet::Cluster* cluster,
+                                                     int primaryNodeId)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(cluster);
+
+    return nextReplicationHop(cluster, primaryNodeId, cluster->selfNodeId());
+}
+
+mqbnet::ClusterNode* StorageUtil::nextReplicationHop(mqbnet::Cluster* cluster,
+                                                     int primaryNodeId,
+                                                     int fromNodeId)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(cluster);
+
+    typedef mqbnet::Cluster::NodesList::iterator NodesListIter;
+
+    mqbnet::Cluster::NodesList& nodes = cluster->nodes();
+
+    NodesListIter fromIt = nodes.begin();
+    for (; fromIt != nodes.end(); ++fromIt) {
+        if ((*fromIt)->nodeId() == fromNodeId) {
+            break;  // BREAK
+        }
+    }
+
+    if (fromIt == nodes.end()) {
+        return 0;  // RETURN
+    }
+
+    NodesListIter it = fromIt;
+    while (true) {
+        if (++it == nodes.end()) {
+            it = nodes.begin();
+        }
+
+        if (it == fromIt || (*it)->nodeId() == cluster->selfNodeId() ||
+            (*it)->nodeId() == primaryNodeId) {
+            // Went around the whole chain, no node is left after
+            // 'fromNodeId'.
+            return 0;  // RETURN
+        }
+
+        if ((*it)->isAvailable()) {
+            return *it;  // RETURN
+        }
+    }
+}
+
+mqbnet::ClusterNode*
+StorageUtil::writeToReplicationChain(int*               numItems,
+                                     mqbnet::Cluster*   cluster,
+                                     int                primaryNodeId,
+                                     const bdlbb::Blob& event)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(numItems);
+    BSLS_ASSERT_SAFE(cluster);
+
+    mqbnet::ClusterNode* node = nextReplicationHop(cluster, primaryNodeId);
+    while (node) {
+        const int nodeNumItems = node->channel().numItems();
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                bmqt::GenericResult::e_SUCCESS ==
+                node->write(event, bmqp::EventType::e_STORAGE))) {
+            *numItems = nodeNumItems;
+            return node;  // RETURN
+        }
+
+        // The node went down since it was found available, skip it.
+        node = nextReplicationHop(cluster, primaryNodeId, node->nodeId());
+    }
+
+    return 0;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
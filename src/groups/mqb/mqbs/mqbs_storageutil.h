@@ -31,6 +31,7 @@
 // MQB
 
 #include <mqbi_storage.h>
+#include <mqbnet_cluster.h>
 #include <mqbs_filestoreprotocol.h>
 #include <mqbu_storagekey.h>
 
@@ -141,6 +142,43 @@ struct StorageUtil {
         const bmqp::StorageMessageIterator&        storageIter,
         const bsl::shared_ptr<bdlbb::Blob>&        stroageEvent,
         const bslstl::StringRef&                   partitionDesc);
+
+    /// Return the node of the specified `cluster` to which self node should
+    /// send, or relay, the storage events of a partition whose primary is
+    /// the node having the specified `primaryNodeId` when storage records
+    /// are replicated along a chain, or a null pointer if self node is the
+    /// last node of the chain.  The chain follows the order of the nodes in
+    /// the cluster, starting after the primary and wrapping around, and
+    /// skips the nodes which are currently unavailable.
+    static mqbnet::ClusterNode* nextReplicationHop(mqbnet::Cluster* cluster,
+                                                   int primaryNodeId);
+
+    /// Return the node of the specified `cluster` following the node
+    /// having the specified `fromNodeId` in the replication chain of a
+    /// partition whose primary is the node having the specified
+    /// `primaryNodeId`, or a null pointer if no node after `fromNodeId` and
+    /// before self node or the primary is currently available.  The chain
+    /// is the one described in `nextReplicationHop` above.
+    static mqbnet::ClusterNode* nextReplicationHop(mqbnet::Cluster* cluster,
+                                                   int primaryNodeId,
+                                                   int fromNodeId);
+
+    /// Write the specified storage `event` to the first node of the
+    /// replication chain of the specified `cluster` following self node,
+    /// for a partition whose primary is the node having the specified
+    /// `primaryNodeId`, to which `event` can be written.  A node to which
+    /// the write fails is skipped, and `event` is written to the node after
+    /// it instead, so that a broken link does not cut off the rest of the
+    /// chain.  Load into the specified `numItems` the number of items
+    /// pending in the channel of the node written to, prior to writing.
+    /// Return that node, or a null pointer, leaving `numItems` untouched,
+    /// if self node is the last node of the chain or `event` could not be
+    /// written to any of the nodes after self.
+    static mqbnet::ClusterNode*
+    writeToReplicationChain(int*               numItems,
+                            mqbnet::Cluster*   cluster,
+                            int                primaryNodeId,
+                            const bdlbb::Blob& event);
 };
 
 }  // close package namespace
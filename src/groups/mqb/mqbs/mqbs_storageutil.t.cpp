@@ -17,17 +17,29 @@
 #include <mqbs_storageutil.h>
 
 // MQB
+#include <mqbcfg_messages.h>
 #include <mqbi_storage.h>
+#include <mqbnet_mockcluster.h>
+
+// BMQ
+#include <bmqp_ctrlmsg_messages.h>
 
 // MWC
+#include <mwcio_testchannel.h>
 #include <mwcsys_time.h>
 
 // BDE
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_datetime.h>
 #include <bdlt_datetimeinterval.h>
 #include <bdlt_epochutil.h>
 #include <bdlt_timeunitratio.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+#include <bslma_managedptr.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
 
@@ -80,6 +92,116 @@ struct Tester {
     }
 };
 
+// ==================
+// struct ChainTester
+// ==================
+struct ChainTester {
+    // Provide a mock cluster of 'k_NUM_NODES' nodes, with ids '1' to
+    // 'k_NUM_NODES' in chain order, all of which are available.
+
+  public:
+    // CONSTANTS
+    static const int k_NUM_NODES = 4;
+
+    // DATA
+    bdlbb::PooledBlobBufferFactory d_bufferFactory;
+
+    mqbnet::Channel::ItemPool d_itemPool;
+
+    mqbcfg::ClusterDefinition d_clusterDefinition;
+
+    bslma::ManagedPtr<mqbnet::MockCluster> d_cluster_mp;
+
+    bsl::vector<bsl::shared_ptr<mwcio::TestChannel> > d_channels;
+
+  public:
+    // CREATORS
+    ChainTester()
+    : d_bufferFactory(1024, s_allocator_p)
+    , d_itemPool(mqbnet::Channel::k_ITEM_SIZE, s_allocator_p)
+    , d_clusterDefinition(s_allocator_p)
+    , d_cluster_mp()
+    , d_channels(s_allocator_p)
+    {
+        d_clusterDefinition.name() = "chainCluster";
+        for (int i = 1; i <= k_NUM_NODES; ++i) {
+            mqbcfg::ClusterNode node(s_allocator_p);
+            node.id()         = i;
+            node.name()       = "node" + bsl::to_string(i);
+            node.dataCenter() = "dc";
+            d_clusterDefinition.nodes().push_back(node);
+        }
+
+        d_cluster_mp.load(new (*s_allocator_p)
+                              mqbnet::MockCluster(d_clusterDefinition,
+                                                  &d_bufferFactory,
+                                                  &d_itemPool,
+                                                  s_allocator_p),
+                          s_allocator_p);
+
+        mqbnet::Cluster::NodesList& nodes = d_cluster_mp->nodes();
+        for (mqbnet::Cluster::NodesList::iterator it = nodes.begin();
+             it != nodes.end();
+             ++it) {
+            d_channels.push_back(
+                bsl::allocate_shared<mwcio::TestChannel>(s_allocator_p));
+
+            bsl::weak_ptr<mwcio::Channel> channelWp(d_channels.back());
+            (*it)->setChannel(channelWp,
+                              bmqp_ctrlmsg::ClientIdentity(),
+                              mwcio::Channel::ReadCallback());
+        }
+    }
+
+    // MANIPULATORS
+    int nextHop(int selfNodeId, int primaryNodeId)
+    {
+        // Return the id of the next replication hop of the node with the
+        // specified 'selfNodeId' when the node with the specified
+        // 'primaryNodeId' is the primary, or 0 if there is none.
+
+        d_cluster_mp->_setSelfNodeId(selfNodeId);
+
+        mqbnet::ClusterNode* node = mqbs::StorageUtil::nextReplicationHop(
+            d_cluster_mp.get(),
+            primaryNodeId);
+
+        return node ? node->nodeId() : 0;
+    }
+
+    int writeToChain(int selfNodeId, int primaryNodeId)
+    {
+        // Write an event to the replication chain from the node with the
+        // specified 'selfNodeId' when the node with the specified
+        // 'primaryNodeId' is the primary, and return the id of the node
+        // written to, or 0 if there is none.
+
+        d_cluster_mp->_setSelfNodeId(selfNodeId);
+
+        bdlbb::Blob event(&d_bufferFactory, s_allocator_p);
+        bdlbb::BlobUtil::append(&event, "storage", 7);
+
+        int                  numItems = -1;
+        mqbnet::ClusterNode* node =
+            mqbs::StorageUtil::writeToReplicationChain(&numItems,
+                                                       d_cluster_mp.get(),
+                                                       primaryNodeId,
+                                                       event);
+        if (node) {
+            ASSERT_LE(0, numItems);
+        }
+
+        return node ? node->nodeId() : 0;
+    }
+
+    mwcio::TestChannel& channel(int nodeId)
+    {
+        // Return the test channel of the node with the specified 'nodeId'.
+
+        return *d_channels[nodeId - 1];
+    }
+};
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -357,6 +479,171 @@ static void test5_loadArrivalTimeDelta()
     }
 }
 
+static void test6_nextReplicationHop()
+// ------------------------------------------------------------------------
+// NEXT REPLICATION HOP
+//
+// Concerns:
+//   Ensure proper behavior of 'nextReplicationHop' method:
+//   1. The chain starts at the primary and follows the order of the nodes
+//      in the cluster, wrapping around the end of the list.
+//   2. The node preceding the primary is the last node of the chain.
+//   3. Unavailable nodes are skipped.
+//   4. No hop is returned when the self node is not part of the cluster,
+//      or when it is the only available node.
+//
+// Testing:
+//   nextReplicationHop(...)
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("NEXT REPLICATION HOP");
+
+    {
+        PV("Chain order");
+
+        ChainTester tester;
+
+        // Primary is the first node
+        ASSERT_EQ(tester.nextHop(1, 1), 2);
+        ASSERT_EQ(tester.nextHop(2, 1), 3);
+        ASSERT_EQ(tester.nextHop(3, 1), 4);
+        ASSERT_EQ(tester.nextHop(4, 1), 0);
+
+        // Primary is in the middle, chain wraps around
+        ASSERT_EQ(tester.nextHop(3, 3), 4);
+        ASSERT_EQ(tester.nextHop(4, 3), 1);
+        ASSERT_EQ(tester.nextHop(1, 3), 2);
+        ASSERT_EQ(tester.nextHop(2, 3), 0);
+    }
+
+    {
+        PV("Unavailable nodes are skipped");
+
+        ChainTester tester;
+
+        mqbnet::ClusterNode* node3 = tester.d_cluster_mp->lookupNode(3);
+        ASSERT(node3);
+        node3->resetChannel();
+        ASSERT(!node3->isAvailable());
+
+        ASSERT_EQ(tester.nextHop(1, 1), 2);
+        ASSERT_EQ(tester.nextHop(2, 1), 4);
+        ASSERT_EQ(tester.nextHop(4, 1), 0);
+
+        // The last node before the primary being down does not extend the
+        // chain past the primary.
+        ASSERT_EQ(tester.nextHop(1, 4), 2);
+        ASSERT_EQ(tester.nextHop(2, 4), 0);
+    }
+
+    {
+        PV("No next hop");
+
+        ChainTester tester;
+
+        // Self is not part of the cluster
+        ASSERT_EQ(tester.nextHop(-1, 1), 0);
+        ASSERT_EQ(tester.nextHop(ChainTester::k_NUM_NODES + 1, 1), 0);
+
+        // All other nodes are unavailable
+        mqbnet::Cluster::NodesList& nodes = tester.d_cluster_mp->nodes();
+        for (mqbnet::Cluster::NodesList::iterator it = nodes.begin();
+             it != nodes.end();
+             ++it) {
+            if ((*it)->nodeId() != 1) {
+                (*it)->resetChannel();
+            }
+        }
+
+        ASSERT_EQ(tester.nextHop(1, 1), 0);
+    }
+}
+
+static void test7_writeToReplicationChain()
+// ------------------------------------------------------------------------
+// WRITE TO REPLICATION CHAIN
+//
+// Concerns:
+//   Ensure proper behavior of 'writeToReplicationChain' method:
+//   1. The event is written to the next hop of the chain only.
+//   2. A hop in the middle of the chain being down does not cut off the
+//      nodes after it: the event is written to the node after it, both
+//      from the primary and from a replica relaying the event.
+//   3. Nothing is written, and no node returned, from the last node of the
+//      chain or when all the nodes after self are down.
+//
+// Testing:
+//   writeToReplicationChain(...)
+//   nextReplicationHop(..., int fromNodeId)
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("WRITE TO REPLICATION CHAIN");
+
+    const bsls::TimeInterval k_TIMEOUT(1.0);
+
+    {
+        PV("Write to the next hop");
+
+        ChainTester tester;
+
+        ASSERT_EQ(tester.writeToChain(1, 1), 2);
+        ASSERT(tester.channel(2).waitFor(1, false, k_TIMEOUT));
+        ASSERT(tester.channel(3).writeCalls().empty());
+        ASSERT(tester.channel(4).writeCalls().empty());
+    }
+
+    {
+        PV("Middle hop is down");
+
+        ChainTester tester;
+
+        mqbnet::ClusterNode* node2 = tester.d_cluster_mp->lookupNode(2);
+        BSLS_ASSERT_OPT(node2);
+        node2->resetChannel();
+
+        // Primary writes past the node which is down
+        ASSERT_EQ(tester.writeToChain(1, 1), 3);
+        ASSERT(tester.channel(3).waitFor(1, false, k_TIMEOUT));
+
+        // Replica relays past the node which is down, wrapping around
+        ASSERT_EQ(tester.writeToChain(4, 3), 1);
+        ASSERT(tester.channel(1).waitFor(1, false, k_TIMEOUT));
+
+        ASSERT(tester.channel(2).writeCalls().empty());
+
+        // The hop after the node which is down, as seen from the primary
+        tester.d_cluster_mp->_setSelfNodeId(1);
+        mqbnet::ClusterNode* hop = mqbs::StorageUtil::nextReplicationHop(
+            tester.d_cluster_mp.get(),
+            1,
+            2);
+        ASSERT(hop);
+        ASSERT_EQ(hop->nodeId(), 3);
+    }
+
+    {
+        PV("End of the chain");
+
+        ChainTester tester;
+
+        ASSERT_EQ(tester.writeToChain(4, 1), 0);
+
+        mqbnet::Cluster::NodesList& nodes = tester.d_cluster_mp->nodes();
+        for (mqbnet::Cluster::NodesList::iterator it = nodes.begin();
+             it != nodes.end();
+             ++it) {
+            if ((*it)->nodeId() != 1) {
+                (*it)->resetChannel();
+            }
+        }
+        ASSERT_EQ(tester.writeToChain(1, 1), 0);
+
+        for (int nodeId = 1; nodeId <= ChainTester::k_NUM_NODES; ++nodeId) {
+            ASSERT_D(nodeId, tester.channel(nodeId).writeCalls().empty());
+        }
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -370,6 +657,8 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 7: test7_writeToReplicationChain(); break;
+    case 6: test6_nextReplicationHop(); break;
     case 5: test5_loadArrivalTimeDelta(); break;
     case 4: test4_loadArrivalTime(); break;
     case 3: test3_mergeDomainQueueMessagesCountMap(); break;
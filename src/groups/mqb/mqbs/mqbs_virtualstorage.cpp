@@ -17,6 +17,9 @@
 #include <mqbs_virtualstorage.h>
 
 #include <mqbscm_version.h>
+// MQB
+#include <mqbs_virtualstoragecatalog.h>
+
 // BDE
 #include <bsl_cstring.h>
 #include <bsl_utility.h>
@@ -30,22 +33,77 @@ namespace mqbs {
 // class VirtualStorage
 // --------------------
 
+// PRIVATE MANIPULATORS
+void VirtualStorage::onAdded(const bmqt::MessageGUID& msgGUID,
+                             int                      msgSize,
+                             const bmqp::RdaInfo&     rdaInfo,
+                             unsigned int             subscriptionId)
+{
+    ++d_numMessages;
+    d_totalBytes += msgSize;
+
+    if (rdaInfo == d_defaultRdaInfo &&
+        subscriptionId == bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID) {
+        // Nothing to remember, which is the common case.
+        return;  // RETURN
+    }
+
+    d_contexts.insert(
+        bsl::make_pair(msgGUID, MessageContext(rdaInfo, subscriptionId)));
+}
+
+void VirtualStorage::onRemoved(const bmqt::MessageGUID& msgGUID, int msgSize)
+{
+    BSLS_ASSERT_SAFE(0 < d_numMessages);
+
+    --d_numMessages;
+    d_totalBytes -= msgSize;
+
+    if (!d_contexts.empty()) {
+        d_contexts.erase(msgGUID);
+    }
+}
+
+void VirtualStorage::clear()
+{
+    d_contexts.clear();
+    d_numMessages = 0;
+    d_totalBytes  = 0;
+}
+
+void VirtualStorage::setDefaultRdaInfo(const bmqp::RdaInfo& value)
+{
+    d_defaultRdaInfo = value;
+}
+
 // CREATORS
-VirtualStorage::VirtualStorage(mqbi::Storage*          storage,
+VirtualStorage::VirtualStorage(VirtualStorageCatalog*  catalog,
+                               mqbi::Storage*          storage,
                                const bsl::string&      appId,
                                const mqbu::StorageKey& appKey,
+                               int                     ordinal,
+                               const bmqp::RdaInfo&    defaultRdaInfo,
                                bslma::Allocator*       allocator)
 : d_allocator_p(allocator)
+, d_catalog_p(catalog)
 , d_storage_p(storage)
 , d_appId(appId, allocator)
 , d_appKey(appKey)
-, d_guids(allocator)
+, d_ordinal(ordinal)
+, d_appMask(bsls::Types::Uint64(1) << ordinal)
+, d_defaultRdaInfo(defaultRdaInfo)
+, d_contexts(allocator)
+, d_numMessages(0)
 , d_totalBytes(0)
 {
+    BSLS_ASSERT_SAFE(d_catalog_p);
     BSLS_ASSERT_SAFE(d_storage_p);
     BSLS_ASSERT_SAFE(allocator);
     BSLS_ASSERT_SAFE(!appId.empty());
     BSLS_ASSERT_SAFE(!appKey.isNull());
+    BSLS_ASSERT_SAFE(0 <= ordinal);
+    BSLS_ASSERT_SAFE(ordinal <
+                     VirtualStorageCatalog::k_MAX_NUM_VIRTUAL_STORAGES);
 }
 
 VirtualStorage::~VirtualStorage()
@@ -110,17 +168,24 @@ mqbi::StorageResult::Enum VirtualStorage::put(const bmqt::MessageGUID& msgGUID,
                                               const bmqp::RdaInfo&     rdaInfo,
                                               unsigned int subScriptionId)
 {
-    if (d_guids
-            .insert(bsl::make_pair(
-                msgGUID,
-                MessageContext(msgSize, rdaInfo, subScriptionId)))
-            .second == false) {
+    bsls::Types::Uint64       previous = 0;
+    mqbi::StorageResult::Enum rc       = d_catalog_p->updateAppStates(
+        &previous,
+        msgGUID,
+        d_appMask,
+        0,
+        msgSize);
+    if (mqbi::StorageResult::e_SUCCESS != rc) {
+        return rc;  // RETURN
+    }
+
+    if (previous & d_appMask) {
         // Duplicate GUID
         return mqbi::StorageResult::e_GUID_NOT_UNIQUE;  // RETURN
     }
 
     // Success: new GUID
-    d_totalBytes += msgSize;
+    onAdded(msgGUID, msgSize, rdaInfo, subScriptionId);
     return mqbi::StorageResult::e_SUCCESS;
 }
 
@@ -141,8 +206,11 @@ VirtualStorage::getIterator(const mqbu::StorageKey& appKey)
     BSLS_ASSERT_SAFE(d_appKey == appKey);
     static_cast<void>(appKey);
 
+    bslma::ManagedPtr<mqbi::StorageIterator> messages =
+        d_catalog_p->getMessagesIterator();
+
     bslma::ManagedPtr<mqbi::StorageIterator> mp(
-        new (*d_allocator_p) VirtualStorageIterator(this, d_guids.begin()),
+        new (*d_allocator_p) VirtualStorageIterator(this, messages),
         d_allocator_p);
 
     return mp;
@@ -157,12 +225,18 @@ VirtualStorage::getIterator(bslma::ManagedPtr<mqbi::StorageIterator>* out,
     BSLS_ASSERT_SAFE(d_appKey == appKey);
     static_cast<void>(appKey);
 
-    GuidListIter it = d_guids.find(msgGUID);
-    if (it == d_guids.end()) {
+    if (!hasMessage(msgGUID)) {
         return mqbi::StorageResult::e_GUID_NOT_FOUND;  // RETURN
     }
 
-    out->load(new (*d_allocator_p) VirtualStorageIterator(this, it),
+    bslma::ManagedPtr<mqbi::StorageIterator> messages;
+    mqbi::StorageResult::Enum                rc =
+        d_catalog_p->getMessagesIterator(&messages, msgGUID);
+    if (mqbi::StorageResult::e_SUCCESS != rc) {
+        return rc;  // RETURN
+    }
+
+    out->load(new (*d_allocator_p) VirtualStorageIterator(this, messages),
               d_allocator_p);
 
     return mqbi::StorageResult::e_SUCCESS;
@@ -184,24 +258,33 @@ VirtualStorage::remove(const bmqt::MessageGUID&    msgGUID,
                        BSLS_ANNOTATION_UNUSED bool clearAll)
 
 {
-    GuidList::const_iterator it = d_guids.find(msgGUID);
-    if (it == d_guids.end()) {
+    // Retrieve the size first since, with the catalog keeping the app
+    // states, clearing the last bit forgets the message.
+    int                       size = 0;
+    mqbi::StorageResult::Enum rc   = d_catalog_p->getMessageSize(&size,
+                                                               msgGUID);
+    if (mqbi::StorageResult::e_SUCCESS != rc) {
+        return mqbi::StorageResult::e_GUID_NOT_FOUND;  // RETURN
+    }
+
+    bsls::Types::Uint64 previous = 0;
+    rc = d_catalog_p->updateAppStates(&previous, msgGUID, 0, d_appMask);
+    if (mqbi::StorageResult::e_SUCCESS != rc || 0 == (previous & d_appMask)) {
         return mqbi::StorageResult::e_GUID_NOT_FOUND;  // RETURN
     }
 
     if (msgSize) {
-        *msgSize = it->second.d_size;
+        *msgSize = size;
     }
-    d_totalBytes -= it->second.d_size;
-    d_guids.erase(it);
+    onRemoved(msgGUID, size);
     return mqbi::StorageResult::e_SUCCESS;
 }
 
 mqbi::StorageResult::Enum VirtualStorage::removeAll(
     BSLS_ANNOTATION_UNUSED const mqbu::StorageKey& appKey)
 {
-    d_guids.clear();
-    d_totalBytes = 0;
+    d_catalog_p->clearAppStates(d_appMask);
+    clear();
     return mqbi::StorageResult::e_SUCCESS;
 }
 
@@ -215,13 +298,19 @@ mqbi::StorageResult::Enum
 VirtualStorage::getMessageSize(int*                     msgSize,
                                const bmqt::MessageGUID& msgGUID) const
 {
-    GuidList::const_iterator cit = d_guids.find(msgGUID);
-    if (cit == d_guids.end()) {
+    if (!hasMessage(msgGUID)) {
         return mqbi::StorageResult::e_GUID_NOT_FOUND;  // RETURN
     }
 
-    *msgSize = cit->second.d_size;
-    return mqbi::StorageResult::e_SUCCESS;
+    return d_catalog_p->getMessageSize(msgSize, msgGUID);
+}
+
+bool VirtualStorage::hasMessage(const bmqt::MessageGUID& msgGUID) const
+{
+    bsls::Types::Uint64 appStates = 0;
+    return mqbi::StorageResult::e_SUCCESS ==
+               d_catalog_p->getAppStates(&appStates, msgGUID) &&
+           (appStates & d_appMask);
 }
 
 int VirtualStorage::numVirtualStorages() const
@@ -257,6 +346,14 @@ void VirtualStorage::loadVirtualStorageDetails(
     BSLS_ASSERT_OPT(false && "Should not be invoked.");
 }
 
+mqbi::StorageResult::Enum VirtualStorage::getAppStates(
+    BSLS_ANNOTATION_UNUSED bsls::Types::Uint64* appStates,
+    BSLS_ANNOTATION_UNUSED const bmqt::MessageGUID& msgGUID) const
+{
+    BSLS_ASSERT_OPT(false && "Should not be invoked.");
+    return mqbi::StorageResult::e_INVALID_OPERATION;
+}
+
 int VirtualStorage::gcExpiredMessages(
     BSLS_ANNOTATION_UNUSED bsls::Types::Uint64* latestGcMsgTimestampEpoch,
     BSLS_ANNOTATION_UNUSED bsls::Types::Int64* configuredTtlValue,
@@ -288,56 +385,80 @@ bool VirtualStorage::removeVirtualStorage(
     return false;
 }
 
+mqbi::StorageResult::Enum VirtualStorage::updateAppStates(
+    BSLS_ANNOTATION_UNUSED bsls::Types::Uint64* previous,
+    BSLS_ANNOTATION_UNUSED const bmqt::MessageGUID& msgGUID,
+    BSLS_ANNOTATION_UNUSED bsls::Types::Uint64 setMask,
+    BSLS_ANNOTATION_UNUSED bsls::Types::Uint64 clearMask)
+{
+    BSLS_ASSERT_OPT(false && "Should not be invoked.");
+    return mqbi::StorageResult::e_INVALID_OPERATION;
+}
+
+void VirtualStorage::clearAppStates(
+    BSLS_ANNOTATION_UNUSED bsls::Types::Uint64 mask)
+{
+    BSLS_ASSERT_OPT(false && "Should not be invoked.");
+}
+
 // ----------------------------
 // class VirtualStorageIterator
 // ----------------------------
 
-// PRIVATE MANIPULATORS
-void VirtualStorageIterator::clear()
+// PRIVATE ACCESSORS
+void VirtualStorageIterator::skipToMessage() const
 {
-    // Clear previous state, if any.  This is required so that new state can be
-    // loaded in 'appData', 'options' or 'attributes' routines.
-    d_appData_sp.reset();
-    d_options_sp.reset();
-    d_attributes.reset();
-    d_haveReceipt = false;
+    const bsls::Types::Uint64 appMask = d_virtualStorage_p->d_appMask;
+
+    while (!d_iterator->atEnd() && 0 == (d_iterator->appStates() & appMask)) {
+        d_iterator->advance();
+    }
 }
 
-// PRIVATE ACCESSORS
-bool VirtualStorageIterator::loadMessageAndAttributes() const
+void VirtualStorageIterator::flushRdaInfo() const
 {
-    BSLS_ASSERT_SAFE(!atEnd());
+    if (d_lentGuid.isUnset()) {
+        return;  // RETURN
+    }
+
+    const bmqt::MessageGUID guid = d_lentGuid;
+    d_lentGuid.setUnset();
 
-    if (!d_appData_sp) {
-        mqbi::StorageResult::Enum rc = d_virtualStorage_p->d_storage_p->get(
-            &d_appData_sp,
-            &d_options_sp,
-            &d_attributes,
-            d_iterator->first);
-        BSLS_ASSERT_SAFE(mqbi::StorageResult::e_SUCCESS == rc);
-        static_cast<void>(rc);  // suppress compiler warning
-        return true;            // RETURN
+    if (d_rdaInfo == d_lentRdaInfo) {
+        // Not modified, which is the common case.  Note that the virtual
+        // storage may be gone (e.g., when this iterator is destroyed after
+        // the virtual storage is removed from its catalog).
+        return;  // RETURN
+    }
+
+    if (d_virtualStorage_p->hasMessage(guid)) {
+        d_virtualStorage_p->d_contexts.insert(bsl::make_pair(
+            guid,
+            VirtualStorage::MessageContext(
+                d_rdaInfo,
+                bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID)));
     }
-    return false;
 }
 
 // CREATORS
 VirtualStorageIterator::VirtualStorageIterator(
-    VirtualStorage*                                 storage,
-    const VirtualStorage::GuidList::const_iterator& initialPosition)
+    VirtualStorage*                           storage,
+    bslma::ManagedPtr<mqbi::StorageIterator>& iterator)
 : d_virtualStorage_p(storage)
-, d_iterator(initialPosition)
-, d_attributes()
-, d_appData_sp()
-, d_options_sp()
-, d_haveReceipt(false)
+, d_iterator(iterator)
+, d_rdaInfo()
+, d_lentRdaInfo()
+, d_lentGuid()
 {
     BSLS_ASSERT_SAFE(d_virtualStorage_p);
+    BSLS_ASSERT_SAFE(d_iterator);
+
+    skipToMessage();
 }
 
 VirtualStorageIterator::~VirtualStorageIterator()
 {
-    // NOTHING
+    flushRdaInfo();
 }
 
 // MANIPULATORS
@@ -346,17 +467,19 @@ bool VirtualStorageIterator::advance()
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(!atEnd());
 
-    clear();
-    ++d_iterator;
-    return !atEnd();
+    flushRdaInfo();
+    d_iterator->advance();
+    skipToMessage();
+    return !d_iterator->atEnd();
 }
 
 void VirtualStorageIterator::reset()
 {
-    clear();
+    flushRdaInfo();
 
     // Reset iterator to beginning
-    d_iterator = d_virtualStorage_p->d_guids.begin();
+    d_iterator->reset();
+    skipToMessage();
 }
 
 // ACCESSORS
@@ -365,7 +488,7 @@ const bmqt::MessageGUID& VirtualStorageIterator::guid() const
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(!atEnd());
 
-    return d_iterator->first;
+    return d_iterator->guid();
 }
 
 bmqp::RdaInfo& VirtualStorageIterator::rdaInfo() const
@@ -373,7 +496,23 @@ bmqp::RdaInfo& VirtualStorageIterator::rdaInfo() const
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(!atEnd());
 
-    return d_iterator->second.d_rdaInfo;
+    flushRdaInfo();
+
+    VirtualStorage::MessageContexts& contexts =
+        d_virtualStorage_p->d_contexts;
+    if (!contexts.empty()) {
+        VirtualStorage::MessageContextsIter it = contexts.find(guid());
+        if (it != contexts.end()) {
+            return it->second.d_rdaInfo;  // RETURN
+        }
+    }
+
+    // Lend a copy of the default, saved by 'flushRdaInfo' if modified.
+    d_rdaInfo     = d_virtualStorage_p->d_defaultRdaInfo;
+    d_lentRdaInfo = d_rdaInfo;
+    d_lentGuid    = guid();
+
+    return d_rdaInfo;
 }
 
 unsigned int VirtualStorageIterator::subscriptionId() const
@@ -381,46 +520,52 @@ unsigned int VirtualStorageIterator::subscriptionId() const
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(!atEnd());
 
-    return d_iterator->second.d_subscriptionId;
+    const VirtualStorage::MessageContexts& contexts =
+        d_virtualStorage_p->d_contexts;
+    if (!contexts.empty()) {
+        VirtualStorage::MessageContexts::const_iterator cit = contexts.find(
+            guid());
+        if (cit != contexts.end()) {
+            return cit->second.d_subscriptionId;  // RETURN
+        }
+    }
+
+    return bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID;
 }
 
 const bsl::shared_ptr<bdlbb::Blob>& VirtualStorageIterator::appData() const
 {
-    loadMessageAndAttributes();
-    return d_appData_sp;
+    return d_iterator->appData();
 }
 
 const bsl::shared_ptr<bdlbb::Blob>& VirtualStorageIterator::options() const
 {
-    loadMessageAndAttributes();
-    return d_options_sp;
+    return d_iterator->options();
 }
 
 const mqbi::StorageMessageAttributes&
 VirtualStorageIterator::attributes() const
 {
-    loadMessageAndAttributes();
-    return d_attributes;
+    return d_iterator->attributes();
 }
 
 bool VirtualStorageIterator::atEnd() const
 {
-    return (d_iterator == d_virtualStorage_p->d_guids.end());
+    skipToMessage();
+    return d_iterator->atEnd();
 }
 
 bool VirtualStorageIterator::hasReceipt() const
 {
-    if (atEnd()) {
-        return false;  // RETURN
-    }
-    if (!d_haveReceipt) {
-        // 'd_attributes.hasReceipt' can be stale.  Double check by reloading
-        if (d_virtualStorage_p->d_storage_p->hasReceipt(d_iterator->first)) {
-            d_haveReceipt = true;
-        }
-    }
+    return !atEnd() && d_iterator->hasReceipt();
+}
+
+bsls::Types::Uint64 VirtualStorageIterator::appStates() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!atEnd());
 
-    return d_haveReceipt;
+    return d_iterator->appStates();
 }
 
 }  // close package namespace
@@ -26,6 +26,18 @@
 //@DESCRIPTION: 'mqbs::VirtualStorage' provides a mechanism to add per-client
 // state to an underlying BlazingMQ storage.
 //
+/// App States
+///----------
+// A virtual storage does not keep its own list of messages.  Each virtual
+// storage of a 'mqbs::VirtualStorageCatalog' has a distinct ordinal, and the
+// catalog keeps, for each message, a bitmap having one bit per ordinal (see
+// 'mqbi::StorageMessageAttributes::appStates').  A message is part of the
+// virtual storage if the bit of its ordinal is set.  The
+// 'mqbs::VirtualStorageIterator' is therefore a scan of the messages of the
+// catalog, in their order, skipping the messages not part of the virtual
+// storage.  The virtual storage only keeps the RDA info and the subscription
+// id of the messages for which they differ from the defaults.
+//
 /// Warning
 ///-------
 // An instance of this component is backed by a "real" underlying storage.
@@ -42,14 +54,13 @@
 #include <mqbu_storagekey.h>
 
 // BMQ
+#include <bmqp_protocol.h>
 #include <bmqt_messageguid.h>
 
-// MWC
-#include <mwcc_orderedhashmap.h>
-
 // BDE
 #include <bdlbb_blob.h>
 #include <bsl_memory.h>
+#include <bsl_unordered_map.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslmf_nestedtraitdeclaration.h>
@@ -62,6 +73,7 @@ namespace BloombergLP {
 namespace mqbs {
 
 // FORWARD DECLARATION
+class VirtualStorageCatalog;
 class VirtualStorageIterator;
 
 // ====================
@@ -73,28 +85,26 @@ class VirtualStorage : public mqbi::Storage {
 
   private:
     // FRIENDS
+    friend class VirtualStorageCatalog;
     friend class VirtualStorageIterator;
 
     // PRIVATE TYPES
     struct MessageContext {
-        int                   d_size;
         mutable bmqp::RdaInfo d_rdaInfo;
         unsigned int          d_subscriptionId;
 
-        MessageContext(int                  size,
-                       const bmqp::RdaInfo& rdaInfo,
+        MessageContext(const bmqp::RdaInfo& rdaInfo,
                        unsigned int         subScriptionId);
     };
 
-    /// msgGUID -> MessageContext
-    /// Must be a container in which iteration order is same as insertion
-    /// order.
-    typedef mwcc::OrderedHashMap<bmqt::MessageGUID,
-                                 MessageContext,
-                                 bslh::Hash<bmqt::MessageGUIDHashAlgo> >
-        GuidList;
+    /// msgGUID -> MessageContext, only for the messages whose RDA info or
+    /// subscription id differ from the defaults.
+    typedef bsl::unordered_map<bmqt::MessageGUID,
+                               MessageContext,
+                               bslh::Hash<bmqt::MessageGUIDHashAlgo> >
+        MessageContexts;
 
-    typedef GuidList::iterator GuidListIter;
+    typedef MessageContexts::iterator MessageContextsIter;
 
     typedef mqbi::Storage::StorageKeys StorageKeys;
 
@@ -102,6 +112,10 @@ class VirtualStorage : public mqbi::Storage {
     // DATA
     bslma::Allocator* d_allocator_p;
 
+    VirtualStorageCatalog* d_catalog_p;
+    // Catalog this instance belongs to, keeping
+    // the app states of the messages.  Held.
+
     mqbi::Storage* d_storage_p;
     // underlying 'real' storage.  Held.
 
@@ -112,8 +126,25 @@ class VirtualStorage : public mqbi::Storage {
     mqbu::StorageKey d_appKey;
     // Storage key of the associated 'appId'.
 
-    GuidList d_guids;
-    // List of guids that are part of this storage.
+    int d_ordinal;
+    // Ordinal of this instance among the virtual
+    // storages of 'd_storage_p'.
+
+    bsls::Types::Uint64 d_appMask;
+    // Bit of 'd_ordinal' in the app states of the
+    // messages of 'd_storage_p'.
+
+    bmqp::RdaInfo d_defaultRdaInfo;
+    // RDA info of the messages not in
+    // 'd_contexts'.
+
+    MessageContexts d_contexts;
+    // Contexts of the messages that are part of
+    // this storage and whose RDA info or
+    // subscription id are not the defaults.
+
+    bsls::Types::Int64 d_numMessages;
+    // Number of messages that it holds.
 
     bsls::Types::Int64 d_totalBytes;
     // Total size (in bytes) of all the messages that
@@ -124,21 +155,50 @@ class VirtualStorage : public mqbi::Storage {
     VirtualStorage(const VirtualStorage&);             // = delete
     VirtualStorage& operator=(const VirtualStorage&);  // = delete
 
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Account for the message having the specified `msgGUID`, `msgSize`,
+    /// `rdaInfo` and `subscriptionId`, whose bit has just been set in the
+    /// underlying storage.
+    void onAdded(const bmqt::MessageGUID& msgGUID,
+                 int                      msgSize,
+                 const bmqp::RdaInfo&     rdaInfo,
+                 unsigned int             subscriptionId);
+
+    /// Account for the message having the specified `msgGUID` and
+    /// `msgSize`, whose bit has just been cleared in the underlying
+    /// storage.
+    void onRemoved(const bmqt::MessageGUID& msgGUID, int msgSize);
+
+    /// Forget all messages, without updating the underlying storage.
+    void clear();
+
+    /// Set the RDA info of the messages without a context to the specified
+    /// `value`.
+    void setDefaultRdaInfo(const bmqp::RdaInfo& value);
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(VirtualStorage, bslma::UsesBslmaAllocator)
 
     // CREATORS
 
-    /// Create an instance of virtual storage backed by the specified real
-    /// `storage`, and having the specified `appId` and `appKey`, and use
-    /// the specified `allocator` for any memory allocations.  Behavior is
-    /// undefined unless `storage` is non-null, `appId` is non-empty and
-    /// `appKey` is non-null.  Note that the specified real `storage` must
-    /// outlive this virtual storage instance.
-    VirtualStorage(mqbi::Storage*          storage,
+    /// Create an instance of virtual storage of the specified `catalog`,
+    /// backed by the specified real `storage`, and having the specified
+    /// `appId`, `appKey` and `ordinal`, in which messages have the
+    /// specified `defaultRdaInfo` unless put with another one, and use the
+    /// specified `allocator` for any memory allocations.  Behavior is
+    /// undefined unless `catalog` and `storage` are non-null, `appId` is
+    /// non-empty, `appKey` is non-null and `ordinal` is an ordinal reserved
+    /// for this instance by `catalog`.  Note that the specified real
+    /// `storage` must outlive this virtual storage instance.
+    VirtualStorage(VirtualStorageCatalog*  catalog,
+                   mqbi::Storage*          storage,
                    const bsl::string&      appId,
                    const mqbu::StorageKey& appKey,
+                   int                     ordinal,
+                   const bmqp::RdaInfo&    defaultRdaInfo,
                    bslma::Allocator*       allocator);
 
     /// Destructor.
@@ -160,6 +220,10 @@ class VirtualStorage : public mqbi::Storage {
     /// Note that the returned key is always non-null.
     const mqbu::StorageKey& appKey() const BSLS_KEYWORD_OVERRIDE;
 
+    /// Return the ordinal of this instance among the virtual storages of
+    /// the underlying storage.
+    int ordinal() const;
+
     /// Return the current configuration used by this storage. The behavior
     /// is undefined unless `configure` was successfully called.
     const mqbconfm::Storage& config() const BSLS_KEYWORD_OVERRIDE;
@@ -213,6 +277,12 @@ class VirtualStorage : public mqbi::Storage {
     void loadVirtualStorageDetails(AppIdKeyPairs* buffer) const
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Behavior is undefined if this method is ever invoked.  This method
+    /// needs to be implemented as its part of base protocol.
+    mqbi::StorageResult::Enum
+    getAppStates(bsls::Types::Uint64*     appStates,
+                 const bmqt::MessageGUID& msgGUID) const BSLS_KEYWORD_OVERRIDE;
+
     /// Store in the specified `msgSize` the size, in bytes, of the message
     /// having the specified `msgGUID` if found and return success, or
     /// return a non-zero return code and leave `msgSize` untouched if no
@@ -273,7 +343,8 @@ class VirtualStorage : public mqbi::Storage {
 
     /// Save the message having the specified `msgGUID`, `msgSize`, and
     /// `rdaInfo` into this virtual storage. Return 0 on success or an
-    /// non-zero error code on failure.
+    /// non-zero error code on failure.  Note that the message must already
+    /// be in the underlying storage, or `e_GUID_NOT_FOUND` is returned.
     mqbi::StorageResult::Enum put(const bmqt::MessageGUID& msgGUID,
                                   int                      msgSize,
                                   const bmqp::RdaInfo&     rdaInfo,
@@ -367,12 +438,27 @@ class VirtualStorage : public mqbi::Storage {
     /// needs to be implemented as its part of base protocol.
     bool
     removeVirtualStorage(const mqbu::StorageKey& appKey) BSLS_KEYWORD_OVERRIDE;
+
+    /// Behavior is undefined if this method is ever invoked.  This method
+    /// needs to be implemented as its part of base protocol.
+    mqbi::StorageResult::Enum
+    updateAppStates(bsls::Types::Uint64*     previous,
+                    const bmqt::MessageGUID& msgGUID,
+                    bsls::Types::Uint64      setMask,
+                    bsls::Types::Uint64 clearMask) BSLS_KEYWORD_OVERRIDE;
+
+    /// Behavior is undefined if this method is ever invoked.  This method
+    /// needs to be implemented as its part of base protocol.
+    void clearAppStates(bsls::Types::Uint64 mask) BSLS_KEYWORD_OVERRIDE;
 };
 
 // ============================
 // class VirtualStorageIterator
 // ============================
 
+/// Iterator over the messages of a `VirtualStorage`, scanning the messages
+/// of the underlying storage and skipping those whose app states do not
+/// have the bit of the virtual storage.
 class VirtualStorageIterator : public mqbi::StorageIterator {
     // TBD
 
@@ -380,21 +466,21 @@ class VirtualStorageIterator : public mqbi::StorageIterator {
     // DATA
     VirtualStorage* d_virtualStorage_p;
 
-    VirtualStorage::GuidList::const_iterator d_iterator;
-
-    mutable mqbi::StorageMessageAttributes d_attributes;
+    bslma::ManagedPtr<mqbi::StorageIterator> d_iterator;
+    // Iterator over the underlying storage.
 
-    mutable bsl::shared_ptr<bdlbb::Blob> d_appData_sp;
-    // If this variable is empty, it is
-    // assumed that attributes, message,
-    // and options have not been loaded in
-    // this iteration (see also
-    // 'loadMessageAndAttributes' impl).
+    mutable bmqp::RdaInfo d_rdaInfo;
+    // RDA info handed out by 'rdaInfo' for a
+    // message without a context, which the
+    // caller may modify.
 
-    mutable bsl::shared_ptr<bdlbb::Blob> d_options_sp;
+    mutable bmqp::RdaInfo d_lentRdaInfo;
+    // Value of 'd_rdaInfo' when it was handed
+    // out.
 
-    mutable bool d_haveReceipt;
-    // Avoid reading Attributes.
+    mutable bmqt::MessageGUID d_lentGuid;
+    // GUID of the message for which 'd_rdaInfo'
+    // was handed out, or unset if it was not.
 
   private:
     // NOT IMPLEMENTED
@@ -403,30 +489,29 @@ class VirtualStorageIterator : public mqbi::StorageIterator {
     operator=(const VirtualStorageIterator&);  // = delete
 
   private:
-    // PRIVATE MANIPULATORS
-
-    /// Clear previous state, if any.  This is required so that new state
-    /// can be loaded in `appData`, `options` or `attributes` routines.
-    void clear();
-
     // PRIVATE ACCESSORS
 
-    /// Load the internal state of this iterator instance with the
-    /// attributes and blob pointed to by the MessageGUID to which this
-    /// iterator is currently pointing.  Behavior is undefined if `atEnd()`
-    /// returns true or if underlying storage does not contain the
-    /// MessageGUID being pointed to by this iterator.  Return `false` if
-    /// data are already loaded; return `true` otherwise.
-    bool loadMessageAndAttributes() const;
+    /// Advance the underlying iterator until it is at the end or points to
+    /// a message that is part of the virtual storage.  Note that this is
+    /// needed in `atEnd` too, since a message added to the underlying
+    /// storage while the underlying iterator is at the end becomes its
+    /// current message, whether or not it is part of the virtual storage.
+    void skipToMessage() const;
+
+    /// If the RDA info handed out by `rdaInfo` was modified, save it as the
+    /// context of its message, if that message is still part of the
+    /// virtual storage.  Note that the virtual storage is not accessed
+    /// unless the RDA info was modified.
+    void flushRdaInfo() const;
 
   public:
     // CREATORS
 
-    /// Create a new VirtualStorageIterator from the specified `storage` and
-    /// pointing at the specified `initialPosition`.
-    VirtualStorageIterator(
-        VirtualStorage*                                 storage,
-        const VirtualStorage::GuidList::const_iterator& initialPosition);
+    /// Create a new VirtualStorageIterator over the specified `storage`,
+    /// scanning the messages of its underlying storage with the specified
+    /// `iterator`, starting at its current position.
+    VirtualStorageIterator(VirtualStorage*                           storage,
+                           bslma::ManagedPtr<mqbi::StorageIterator>& iterator);
 
     /// Destructor
     ~VirtualStorageIterator() BSLS_KEYWORD_OVERRIDE;
@@ -444,7 +529,10 @@ class VirtualStorageIterator : public mqbi::StorageIterator {
 
     /// Return a reference offering modifiable access to the RdaInfo
     /// associated to the item currently pointed at by this iterator.  The
-    /// behavior is undefined unless `atEnd` returns `false`.
+    /// behavior is undefined unless `atEnd` returns `false`.  Note that, for
+    /// a message with the default RdaInfo, the returned reference remains
+    /// valid, and modifications through it are saved, until this iterator
+    /// is moved, destroyed or `rdaInfo` is called again.
     bmqp::RdaInfo& rdaInfo() const BSLS_KEYWORD_OVERRIDE;
 
     /// Return subscription id associated to the item currently pointed at
@@ -476,6 +564,11 @@ class VirtualStorageIterator : public mqbi::StorageIterator {
     /// `items` collection and the message currently pointed at by this
     /// iterator has received replication factor Receipts.
     bool hasReceipt() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the bitmap of the virtual storages holding the message
+    /// currently pointed at by this iterator.  The behavior is undefined
+    /// unless `atEnd` returns `false`.
+    bsls::Types::Uint64 appStates() const BSLS_KEYWORD_OVERRIDE;
 };
 
 // ============================================================================
@@ -487,11 +580,9 @@ class VirtualStorageIterator : public mqbi::StorageIterator {
 // ------------------------------------
 
 inline VirtualStorage::MessageContext::MessageContext(
-    int                  size,
     const bmqp::RdaInfo& rdaInfo,
     unsigned int         subScriptionId)
-: d_size(size)
-, d_rdaInfo(rdaInfo)
+: d_rdaInfo(rdaInfo)
 , d_subscriptionId(subScriptionId)
 {
     // NOTHING
@@ -522,6 +613,11 @@ inline const mqbu::StorageKey& VirtualStorage::appKey() const
     return d_appKey;
 }
 
+inline int VirtualStorage::ordinal() const
+{
+    return d_ordinal;
+}
+
 inline const mqbconfm::Storage& VirtualStorage::config() const
 {
     return d_storage_p->config();
@@ -546,7 +642,7 @@ inline mqbu::CapacityMeter* VirtualStorage::capacityMeter()
 inline bsls::Types::Int64 VirtualStorage::numMessages(
     BSLS_ANNOTATION_UNUSED const mqbu::StorageKey& appKey) const
 {
-    return d_guids.size();
+    return d_numMessages;
 }
 
 inline bsls::Types::Int64 VirtualStorage::numBytes(
@@ -566,11 +662,6 @@ inline bool VirtualStorage::isEmpty() const
     return false;
 }
 
-inline bool VirtualStorage::hasMessage(const bmqt::MessageGUID& msgGUID) const
-{
-    return 1 == d_guids.count(msgGUID);
-}
-
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -26,6 +26,7 @@
 #include <mqbmock_queue.h>
 #include <mqbmock_queueengine.h>
 #include <mqbs_inmemorystorage.h>
+#include <mqbs_virtualstoragecatalog.h>
 #include <mqbstat_brokerstats.h>
 #include <mqbu_messageguidutil.h>
 #include <mqbu_storagekey.h>
@@ -68,6 +69,8 @@ using namespace bsl;
 // - remove
 // - removeAll
 // - getIterator
+// - appStates
+// - maxVirtualStorages
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -85,6 +88,9 @@ const mqbu::StorageKey k_QUEUE_KEY(mqbu::StorageKey::HexRepresentation(),
                                    k_HEX_QUEUE);
 const mqbu::StorageKey k_APP_KEY(mqbu::StorageKey::HexRepresentation(),
                                  k_APP_ID);
+const char             k_APP_ID_2[] = "ABCDEF2222";
+const mqbu::StorageKey k_APP_KEY_2(mqbu::StorageKey::HexRepresentation(),
+                                   k_APP_ID_2);
 const unsigned int     k_DEFAULT_MSG_SIZE = 25;
 
 // ALIASES
@@ -124,9 +130,9 @@ struct Tester {
     mqbmock::Domain                         d_mockDomain;
     mqbmock::Queue                          d_mockQueue;
     mqbmock::QueueEngine                    d_mockQueueEngine;
-    bsl::shared_ptr<mqbi::Storage>          d_storage_sp;
-    bslma::ManagedPtr<mqbs::VirtualStorage> d_virtualStorage_mp;
-    bslma::Allocator*                       d_allocator_p;
+    bsl::shared_ptr<mqbi::Storage>                 d_storage_sp;
+    bslma::ManagedPtr<mqbs::VirtualStorageCatalog> d_catalog_mp;
+    bslma::Allocator*                              d_allocator_p;
 
   public:
     // CREATORS
@@ -161,18 +167,21 @@ struct Tester {
         d_storage_sp->setQueue(&d_mockQueue);
         BSLS_ASSERT_OPT(d_storage_sp->queue() == &d_mockQueue);
 
-        d_virtualStorage_mp.load(new (*d_allocator_p)
-                                     mqbs::VirtualStorage(d_storage_sp.get(),
-                                                          k_APP_ID,
-                                                          k_APP_KEY,
+        d_catalog_mp.load(new (*d_allocator_p)
+                              mqbs::VirtualStorageCatalog(d_storage_sp.get(),
                                                           d_allocator_p),
-                                 d_allocator_p);
+                          d_allocator_p);
+
+        mwcu::MemOutStream errDescription(s_allocator_p);
+        BSLS_ASSERT_OPT(0 == d_catalog_mp->addVirtualStorage(errDescription,
+                                                             k_APP_ID,
+                                                             k_APP_KEY));
     }
 
     ~Tester()
     {
-        d_virtualStorage_mp->removeAll(mqbu::StorageKey::k_NULL_KEY);
-        d_virtualStorage_mp->close();
+        d_catalog_mp->removeAll(mqbu::StorageKey::k_NULL_KEY);
+        d_catalog_mp.reset();
         d_storage_sp->removeAll(mqbu::StorageKey::k_NULL_KEY);
         d_storage_sp->close();
     }
@@ -237,7 +246,13 @@ struct Tester {
         return mqbi::StorageResult::e_SUCCESS;
     }
 
-    mqbs::VirtualStorage& vStorage() { return *d_virtualStorage_mp.ptr(); }
+    mqbs::VirtualStorage& vStorage(const mqbu::StorageKey& appKey = k_APP_KEY)
+    {
+        return *static_cast<mqbs::VirtualStorage*>(
+            d_catalog_mp->virtualStorage(appKey));
+    }
+
+    mqbs::VirtualStorageCatalog& catalog() { return *d_catalog_mp.ptr(); }
 
     mqbi::Storage& storage() { return *d_storage_sp.ptr(); }
 
@@ -761,6 +776,180 @@ static void test9_getIterator()
               mqbi::StorageResult::e_SUCCESS);
 }
 
+static void test10_appStates()
+// ------------------------------------------------------------------------
+// APP STATES
+//
+// Concerns:
+//   Virtual storages of the same catalog share a single list of messages,
+//   each one iterating only over the messages whose app state it holds,
+//   and an iterator having reached the end of the list resumes with the
+//   messages added afterwards, even if some of them were removed since.
+//
+// Testing:
+//   put(...)
+//   remove(...)
+//   getIterator(...)
+//   mqbs::VirtualStorageIterator::appStates()
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("APP STATES");
+    Tester tester;
+
+    mwcu::MemOutStream errDescription(s_allocator_p);
+    BSLS_ASSERT_OPT(0 == tester.catalog().addVirtualStorage(errDescription,
+                                                            k_APP_ID_2,
+                                                            k_APP_KEY_2));
+    BSLS_ASSERT_OPT(tester.configure(k_INT64_MAX, k_INT64_MAX) == 0);
+
+    mqbs::VirtualStorage& vs1 = tester.vStorage(k_APP_KEY);
+    mqbs::VirtualStorage& vs2 = tester.vStorage(k_APP_KEY_2);
+
+    // Put 10 messages, the even ones to both apps and the odd ones to the
+    // second app only.
+    MessageGuids guids;
+    const int    k_MSG_COUNT = 10;
+    for (int i = 0; i < k_MSG_COUNT; ++i) {
+        const bmqt::MessageGUID guid = generateUniqueGUID(&guids);
+        if (i % 2 == 0) {
+            BSLS_ASSERT_OPT(
+                tester.catalog().put(guid,
+                                     k_DEFAULT_MSG_SIZE,
+                                     bmqp::RdaInfo(),
+                                     bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID,
+                                     mqbu::StorageKey::k_NULL_KEY) ==
+                mqbi::StorageResult::e_SUCCESS);
+        }
+        else {
+            BSLS_ASSERT_OPT(
+                vs2.put(guid,
+                        k_DEFAULT_MSG_SIZE,
+                        bmqp::RdaInfo(),
+                        bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID) ==
+                mqbi::StorageResult::e_SUCCESS);
+        }
+    }
+    BSLS_ASSERT_OPT(tester.addPhysicalMessages(guids) ==
+                    mqbi::StorageResult::e_SUCCESS);
+
+    ASSERT_EQ(vs1.numMessages(k_APP_KEY), k_MSG_COUNT / 2);
+    ASSERT_EQ(vs2.numMessages(k_APP_KEY_2), k_MSG_COUNT);
+
+    // The first app iterates over the even messages only
+    bslma::ManagedPtr<mqbi::StorageIterator> it1 = vs1.getIterator(k_APP_KEY);
+    for (int i = 0; i < k_MSG_COUNT; i += 2) {
+        ASSERT(!it1->atEnd());
+        ASSERT_EQ(it1->guid(), guids[i]);
+        ASSERT_EQ(it1->appStates(),
+                  static_cast<bsls::Types::Uint64>(3));  // both apps
+        it1->advance();
+    }
+    ASSERT(it1->atEnd());
+
+    // Removing a message from the first app leaves it to the second one
+    int msgSize = 0;
+    ASSERT_EQ(vs1.remove(guids[0], &msgSize), mqbi::StorageResult::e_SUCCESS);
+    ASSERT_EQ(msgSize, static_cast<int>(k_DEFAULT_MSG_SIZE));
+    ASSERT(!vs1.hasMessage(guids[0]));
+    ASSERT(vs2.hasMessage(guids[0]));
+
+    bslma::ManagedPtr<mqbi::StorageIterator> it2 = vs2.getIterator(
+        k_APP_KEY_2);
+    ASSERT_EQ(it2->guid(), guids[0]);
+    ASSERT_EQ(it2->appStates(), static_cast<bsls::Types::Uint64>(2));
+
+    // A message added, and removed, while the first app is at the end of the
+    // list is not seen by it, but the one added after that is.
+    MessageGuids            newGuids;
+    const bmqt::MessageGUID removedGuid = generateUniqueGUID(&guids);
+    const bmqt::MessageGUID keptGuid    = generateUniqueGUID(&guids);
+    newGuids.push_back(removedGuid);
+    newGuids.push_back(keptGuid);
+    BSLS_ASSERT_OPT(tester.addPhysicalMessages(newGuids, k_MSG_COUNT) ==
+                    mqbi::StorageResult::e_SUCCESS);
+
+    BSLS_ASSERT_OPT(vs2.put(removedGuid,
+                            k_DEFAULT_MSG_SIZE,
+                            bmqp::RdaInfo(),
+                            bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID) ==
+                    mqbi::StorageResult::e_SUCCESS);
+    ASSERT(it1->atEnd());
+    BSLS_ASSERT_OPT(vs2.remove(removedGuid, &msgSize) ==
+                    mqbi::StorageResult::e_SUCCESS);
+    ASSERT(it1->atEnd());
+
+    BSLS_ASSERT_OPT(
+        tester.catalog().put(keptGuid,
+                             k_DEFAULT_MSG_SIZE,
+                             bmqp::RdaInfo(),
+                             bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID,
+                             mqbu::StorageKey::k_NULL_KEY) ==
+        mqbi::StorageResult::e_SUCCESS);
+    ASSERT(!it1->atEnd());
+    ASSERT_EQ(it1->guid(), keptGuid);
+    ASSERT_EQ(*(reinterpret_cast<int*>(it1->appData()->buffer(0).data())),
+              k_MSG_COUNT + 1);
+}
+
+static void test11_maxVirtualStorages()
+// ------------------------------------------------------------------------
+// MAX VIRTUAL STORAGES
+//
+// Concerns:
+//   A catalog holds at most 'k_MAX_NUM_VIRTUAL_STORAGES' virtual storages,
+//   one per bit of the app states of a message.  Adding a virtual storage
+//   past that limit fails and leaves the catalog unchanged, and removing a
+//   virtual storage frees its ordinal for the next one.
+//
+// Testing:
+//   addVirtualStorage(...)
+//   removeVirtualStorage(...)
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("MAX VIRTUAL STORAGES");
+    Tester tester;
+
+    const int k_MAX = mqbs::VirtualStorageCatalog::k_MAX_NUM_VIRTUAL_STORAGES;
+
+    mwcu::MemOutStream errDescription(s_allocator_p);
+
+    // The tester registers one virtual storage, fill up the catalog.
+    for (int i = 1; i < k_MAX; ++i) {
+        const bsl::string appId = "app" + bsl::to_string(i);
+        ASSERT_EQ(0,
+                  tester.catalog().addVirtualStorage(
+                      errDescription,
+                      appId,
+                      mqbu::StorageKey(static_cast<unsigned int>(i))));
+    }
+    ASSERT_EQ(k_MAX, tester.catalog().numVirtualStorages());
+
+    // Adding more apps fails
+    for (int i = k_MAX; i < k_MAX + 2; ++i) {
+        const bsl::string      appId = "app" + bsl::to_string(i);
+        const mqbu::StorageKey appKey(static_cast<unsigned int>(i));
+
+        errDescription.reset();
+        ASSERT_NE(0,
+                  tester.catalog().addVirtualStorage(errDescription,
+                                                     appId,
+                                                     appKey));
+        ASSERT(!errDescription.str().empty());
+        ASSERT(!tester.catalog().hasVirtualStorage(appKey));
+        ASSERT_EQ(k_MAX, tester.catalog().numVirtualStorages());
+    }
+
+    // Removing an app makes room for another one
+    ASSERT(tester.catalog().removeVirtualStorage(
+        mqbu::StorageKey(static_cast<unsigned int>(1))));
+    ASSERT_EQ(0,
+              tester.catalog().addVirtualStorage(
+                  errDescription,
+                  "app" + bsl::to_string(k_MAX),
+                  mqbu::StorageKey(static_cast<unsigned int>(k_MAX))));
+    ASSERT_EQ(k_MAX, tester.catalog().numVirtualStorages());
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -780,6 +969,8 @@ int main(int argc, char* argv[])
 
         switch (_testCase) {
         case 0:
+        case 11: test11_maxVirtualStorages(); break;
+        case 10: test10_appStates(); break;
         case 9: test9_getIterator(); break;
         case 8: test8_removeAll(); break;
         case 7: test7_remove(); break;
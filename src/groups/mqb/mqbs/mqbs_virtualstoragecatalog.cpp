@@ -23,6 +23,7 @@
 // BDE
 #include <bdlbb_blob.h>
 #include <bsl_utility.h>
+#include <bslma_managedptr.h>
 #include <bslma_allocator.h>
 #include <bsls_annotation.h>
 #include <bsls_assert.h>
@@ -34,10 +35,168 @@ namespace mqbs {
 // class VirtualStorageCatalog
 // ---------------------------
 
+// PUBLIC CONSTANTS
+const int VirtualStorageCatalog::k_MAX_NUM_VIRTUAL_STORAGES;
+
+// PRIVATE MANIPULATORS
+mqbi::StorageResult::Enum
+VirtualStorageCatalog::updateAppStates(bsls::Types::Uint64*     previous,
+                                       const bmqt::MessageGUID& msgGUID,
+                                       bsls::Types::Uint64      setMask,
+                                       bsls::Types::Uint64      clearMask,
+                                       int                      msgSize)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(previous);
+
+    if (AppStatesMode::e_STORAGE == d_appStatesMode) {
+        return d_storage_p->updateAppStates(previous,
+                                            msgGUID,
+                                            setMask,
+                                            clearMask);  // RETURN
+    }
+
+    MessagesIter it = d_messages.find(msgGUID);
+    if (it == d_messages.end()) {
+        if (0 == setMask) {
+            return mqbi::StorageResult::e_GUID_NOT_FOUND;  // RETURN
+        }
+
+        *previous = 0;
+        d_messages.insert(bsl::make_pair(
+            msgGUID,
+            MessageState(setMask, d_nextSequenceNumber++, msgSize)));
+        return mqbi::StorageResult::e_SUCCESS;  // RETURN
+    }
+
+    MessageState& state = it->second;
+    *previous           = state.d_appStates;
+    state.d_appStates   = (*previous & ~clearMask) | setMask;
+    if (0 == state.d_appStates) {
+        d_messages.erase(it);
+    }
+
+    return mqbi::StorageResult::e_SUCCESS;
+}
+
+void VirtualStorageCatalog::clearAppStates(bsls::Types::Uint64 mask)
+{
+    if (AppStatesMode::e_STORAGE == d_appStatesMode) {
+        d_storage_p->clearAppStates(mask);
+        return;  // RETURN
+    }
+
+    MessagesIter it = d_messages.begin();
+    while (it != d_messages.end()) {
+        it->second.d_appStates &= ~mask;
+        if (0 == it->second.d_appStates) {
+            it = d_messages.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+bslma::ManagedPtr<mqbi::StorageIterator>
+VirtualStorageCatalog::getMessagesIterator()
+{
+    if (AppStatesMode::e_STORAGE == d_appStatesMode) {
+        return d_storage_p->getIterator(
+            mqbu::StorageKey::k_NULL_KEY);  // RETURN
+    }
+
+    bslma::ManagedPtr<mqbi::StorageIterator> mp(
+        new (*d_allocator_p)
+            VirtualStorageCatalog_Iterator(this, d_messages.begin()),
+        d_allocator_p);
+
+    return mp;
+}
+
+mqbi::StorageResult::Enum VirtualStorageCatalog::getMessagesIterator(
+    bslma::ManagedPtr<mqbi::StorageIterator>* out,
+    const bmqt::MessageGUID&                  msgGUID)
+{
+    if (AppStatesMode::e_STORAGE == d_appStatesMode) {
+        return d_storage_p->getIterator(out,
+                                        mqbu::StorageKey::k_NULL_KEY,
+                                        msgGUID);  // RETURN
+    }
+
+    MessagesConstIter cit = d_messages.find(msgGUID);
+    if (cit == d_messages.end()) {
+        return mqbi::StorageResult::e_GUID_NOT_FOUND;  // RETURN
+    }
+
+    out->load(new (*d_allocator_p) VirtualStorageCatalog_Iterator(this, cit),
+              d_allocator_p);
+
+    return mqbi::StorageResult::e_SUCCESS;
+}
+
+// PRIVATE ACCESSORS
+mqbi::StorageResult::Enum
+VirtualStorageCatalog::getAppStates(bsls::Types::Uint64*     appStates,
+                                    const bmqt::MessageGUID& msgGUID) const
+{
+    if (AppStatesMode::e_STORAGE == d_appStatesMode) {
+        return d_storage_p->getAppStates(appStates, msgGUID);  // RETURN
+    }
+
+    MessagesConstIter cit = d_messages.find(msgGUID);
+    if (cit == d_messages.end()) {
+        return mqbi::StorageResult::e_GUID_NOT_FOUND;  // RETURN
+    }
+
+    *appStates = cit->second.d_appStates;
+    return mqbi::StorageResult::e_SUCCESS;
+}
+
+mqbi::StorageResult::Enum
+VirtualStorageCatalog::getMessageSize(int*                     msgSize,
+                                      const bmqt::MessageGUID& msgGUID) const
+{
+    if (AppStatesMode::e_STORAGE == d_appStatesMode) {
+        return d_storage_p->getMessageSize(msgSize, msgGUID);  // RETURN
+    }
+
+    MessagesConstIter cit = d_messages.find(msgGUID);
+    if (cit == d_messages.end()) {
+        return mqbi::StorageResult::e_GUID_NOT_FOUND;  // RETURN
+    }
+
+    *msgSize = cit->second.d_size;
+    return mqbi::StorageResult::e_SUCCESS;
+}
+
 // CREATORS
 VirtualStorageCatalog::VirtualStorageCatalog(mqbi::Storage*    storage,
                                              bslma::Allocator* allocator)
 : d_storage_p(storage)
+, d_appStatesMode(AppStatesMode::e_CATALOG)
+, d_messages(allocator)
+, d_nextSequenceNumber(0)
+, d_usedOrdinals(0)
+, d_defaultRdaInfo()
+, d_virtualStorages(allocator)
+, d_allocator_p(allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(storage);
+    BSLS_ASSERT_SAFE(allocator);
+}
+
+VirtualStorageCatalog::VirtualStorageCatalog(
+    mqbi::Storage*      storage,
+    AppStatesMode::Enum appStatesMode,
+    bslma::Allocator*   allocator)
+: d_storage_p(storage)
+, d_appStatesMode(appStatesMode)
+, d_messages(allocator)
+, d_nextSequenceNumber(0)
+, d_usedOrdinals(0)
+, d_defaultRdaInfo()
 , d_virtualStorages(allocator)
 , d_allocator_p(allocator)
 {
@@ -70,12 +229,28 @@ VirtualStorageCatalog::put(const bmqt::MessageGUID& msgGUID,
                                subScriptionId);  // RETURN
     }
 
-    // Add guid to all virtual storages.
+    // Add guid to all virtual storages, setting all their bits at once.
+
+    if (0 == d_usedOrdinals) {
+        return mqbi::StorageResult::e_SUCCESS;  // RETURN
+    }
+
+    bsls::Types::Uint64       previous = 0;
+    mqbi::StorageResult::Enum rc       = updateAppStates(&previous,
+                                                   msgGUID,
+                                                   d_usedOrdinals,
+                                                   0,
+                                                   msgSize);
+    if (mqbi::StorageResult::e_SUCCESS != rc) {
+        return rc;  // RETURN
+    }
 
     for (VirtualStoragesIter it = d_virtualStorages.begin();
          it != d_virtualStorages.end();
          ++it) {
-        it->second->put(msgGUID, msgSize, rdaInfo, subScriptionId);
+        if (0 == (previous & it->second->d_appMask)) {
+            it->second->onAdded(msgGUID, msgSize, rdaInfo, subScriptionId);
+        }
     }
 
     return mqbi::StorageResult::e_SUCCESS;  // RETURN
@@ -115,11 +290,31 @@ VirtualStorageCatalog::remove(const bmqt::MessageGUID& msgGUID,
         return it->second->remove(msgGUID);  // RETURN
     }
 
-    // Remove guid from all virtual storages.
+    // Remove guid from all virtual storages, clearing all their bits at
+    // once.
+
+    // Retrieve the size first since, in 'e_CATALOG' mode, clearing the last
+    // bit forgets the message.
+    int msgSize = 0;
+    if (mqbi::StorageResult::e_SUCCESS != getMessageSize(&msgSize, msgGUID)) {
+        return mqbi::StorageResult::e_SUCCESS;  // RETURN
+    }
+
+    bsls::Types::Uint64       previous = 0;
+    mqbi::StorageResult::Enum rc       = updateAppStates(&previous,
+                                                   msgGUID,
+                                                   0,
+                                                   d_usedOrdinals);
+    if (mqbi::StorageResult::e_SUCCESS != rc || 0 == previous) {
+        return mqbi::StorageResult::e_SUCCESS;  // RETURN
+    }
+
     for (VirtualStoragesIter it = d_virtualStorages.begin();
          it != d_virtualStorages.end();
          ++it) {
-        it->second->remove(msgGUID);  // ignore rc
+        if (previous & it->second->d_appMask) {
+            it->second->onRemoved(msgGUID, msgSize);
+        }
     }
 
     return mqbi::StorageResult::e_SUCCESS;
@@ -134,11 +329,12 @@ VirtualStorageCatalog::removeAll(const mqbu::StorageKey& appKey)
         return it->second->removeAll(appKey);  // RETURN
     }
 
-    // Clear all virtual storages.
+    // Clear all virtual storages with a single pass over the messages.
+    clearAppStates(d_usedOrdinals);
     for (VirtualStoragesIter it = d_virtualStorages.begin();
          it != d_virtualStorages.end();
          ++it) {
-        it->second->removeAll(it->first);  // ignore rc
+        it->second->clear();
     }
 
     return mqbi::StorageResult::e_SUCCESS;
@@ -164,13 +360,30 @@ int VirtualStorageCatalog::addVirtualStorage(bsl::ostream& errorDescription,
         return -1;  // RETURN
     }
 
+    int ordinal = 0;
+    while (ordinal < k_MAX_NUM_VIRTUAL_STORAGES &&
+           (d_usedOrdinals & (bsls::Types::Uint64(1) << ordinal))) {
+        ++ordinal;
+    }
+    if (ordinal == k_MAX_NUM_VIRTUAL_STORAGES) {
+        errorDescription << "Too many virtual storages, maximum is "
+                         << k_MAX_NUM_VIRTUAL_STORAGES
+                         << ". Specified appId & appKey: [" << appId
+                         << "] & [" << appKey << "].";
+        return -2;  // RETURN
+    }
+
     VirtualStorageSp vsp;
     vsp.createInplace(d_allocator_p,
+                      this,
                       d_storage_p,
                       appId,
                       appKey,
+                      ordinal,
+                      d_defaultRdaInfo,
                       d_allocator_p);
     d_virtualStorages.insert(bsl::make_pair(appKey, vsp));
+    d_usedOrdinals |= vsp->d_appMask;
 
     return 0;
 }
@@ -180,12 +393,19 @@ bool VirtualStorageCatalog::removeVirtualStorage(
 {
     if (appKey.isNull()) {
         // Remove all virtual storages
+        clearAppStates(d_usedOrdinals);
+        d_usedOrdinals = 0;
         d_virtualStorages.clear();
         return true;  // RETURN
     }
 
     VirtualStoragesConstIter it = d_virtualStorages.find(appKey);
     if (it != d_virtualStorages.end()) {
+        // Clear the bit of the virtual storage from all messages, so that
+        // its ordinal can be reused.
+        const bsls::Types::Uint64 appMask = it->second->d_appMask;
+        clearAppStates(appMask);
+        d_usedOrdinals &= ~appMask;
         d_virtualStorages.erase(it);
         return true;  // RETURN
     }
@@ -204,6 +424,17 @@ VirtualStorageCatalog::virtualStorage(const mqbu::StorageKey& appKey)
     return it->second.get();
 }
 
+void VirtualStorageCatalog::setDefaultRdaInfo(const bmqp::RdaInfo& value)
+{
+    d_defaultRdaInfo = value;
+
+    for (VirtualStoragesIter it = d_virtualStorages.begin();
+         it != d_virtualStorages.end();
+         ++it) {
+        it->second->setDefaultRdaInfo(value);
+    }
+}
+
 // ACCESSORS
 bool VirtualStorageCatalog::hasVirtualStorage(const mqbu::StorageKey& appKey,
                                               bsl::string* appId) const
@@ -252,15 +483,10 @@ bool VirtualStorageCatalog::hasVirtualStorage(const bsl::string& appId,
 
 bool VirtualStorageCatalog::hasMessage(const bmqt::MessageGUID& msgGUID) const
 {
-    for (VirtualStoragesConstIter it = d_virtualStorages.begin();
-         it != d_virtualStorages.end();
-         ++it) {
-        if (it->second->hasMessage(msgGUID)) {
-            return true;  // RETURN
-        }
-    }
-
-    return false;
+    bsls::Types::Uint64 appStates = 0;
+    return mqbi::StorageResult::e_SUCCESS ==
+               getAppStates(&appStates, msgGUID) &&
+           (appStates & d_usedOrdinals);
 }
 
 void VirtualStorageCatalog::loadVirtualStorageDetails(
@@ -278,5 +504,183 @@ void VirtualStorageCatalog::loadVirtualStorageDetails(
     }
 }
 
+// ------------------------------------
+// class VirtualStorageCatalog_Iterator
+// ------------------------------------
+
+// PRIVATE MANIPULATORS
+void VirtualStorageCatalog_Iterator::clear()
+{
+    d_appData_sp.reset();
+    d_options_sp.reset();
+    d_attributes.reset();
+}
+
+// PRIVATE ACCESSORS
+void VirtualStorageCatalog_Iterator::detachIfAtEnd() const
+{
+    if (d_iterator == d_catalog_p->d_messages.end()) {
+        d_isAtEnd              = true;
+        d_resumeSequenceNumber = d_catalog_p->d_nextSequenceNumber;
+    }
+}
+
+void VirtualStorageCatalog_Iterator::loadMessageAndAttributes() const
+{
+    BSLS_ASSERT_SAFE(!atEnd());
+
+    if (!d_appData_sp) {
+        mqbi::StorageResult::Enum rc = d_catalog_p->d_storage_p->get(
+            &d_appData_sp,
+            &d_options_sp,
+            &d_attributes,
+            d_iterator->first);
+
+        // The payload of a message spilled by an in-memory storage may fail
+        // to be read back, in which case the storage raised an alarm and
+        // 'd_appData_sp' is left null for the caller to skip the message.
+        BSLS_ASSERT_SAFE(mqbi::StorageResult::e_SUCCESS == rc ||
+                         mqbi::StorageResult::e_READ_FAILURE == rc);
+        static_cast<void>(rc);  // suppress compiler warning
+    }
+}
+
+// CREATORS
+VirtualStorageCatalog_Iterator::VirtualStorageCatalog_Iterator(
+    VirtualStorageCatalog*                          catalog,
+    const VirtualStorageCatalog::MessagesConstIter& initialPosition)
+: d_catalog_p(catalog)
+, d_iterator(initialPosition)
+, d_isAtEnd(false)
+, d_resumeSequenceNumber(0)
+, d_attributes()
+, d_appData_sp()
+, d_options_sp()
+{
+    BSLS_ASSERT_SAFE(d_catalog_p);
+
+    detachIfAtEnd();
+}
+
+VirtualStorageCatalog_Iterator::~VirtualStorageCatalog_Iterator()
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+bool VirtualStorageCatalog_Iterator::advance()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!atEnd());
+
+    clear();
+    ++d_iterator;
+    detachIfAtEnd();
+    return !atEnd();
+}
+
+void VirtualStorageCatalog_Iterator::reset()
+{
+    clear();
+
+    // Reset iterator to beginning
+    d_iterator = d_catalog_p->d_messages.begin();
+    d_isAtEnd  = false;
+    detachIfAtEnd();
+}
+
+// ACCESSORS
+const bmqt::MessageGUID& VirtualStorageCatalog_Iterator::guid() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!atEnd());
+
+    return d_iterator->first;
+}
+
+bmqp::RdaInfo& VirtualStorageCatalog_Iterator::rdaInfo() const
+{
+    BSLS_ASSERT_OPT(false && "Should not be invoked.");
+
+    static bmqp::RdaInfo dummy;
+    return dummy;
+}
+
+unsigned int VirtualStorageCatalog_Iterator::subscriptionId() const
+{
+    BSLS_ASSERT_OPT(false && "Should not be invoked.");
+    return bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID;
+}
+
+const bsl::shared_ptr<bdlbb::Blob>&
+VirtualStorageCatalog_Iterator::appData() const
+{
+    loadMessageAndAttributes();
+    return d_appData_sp;
+}
+
+const bsl::shared_ptr<bdlbb::Blob>&
+VirtualStorageCatalog_Iterator::options() const
+{
+    loadMessageAndAttributes();
+    return d_options_sp;
+}
+
+const mqbi::StorageMessageAttributes&
+VirtualStorageCatalog_Iterator::attributes() const
+{
+    loadMessageAndAttributes();
+    return d_attributes;
+}
+
+bool VirtualStorageCatalog_Iterator::atEnd() const
+{
+    if (!d_isAtEnd) {
+        return false;  // RETURN
+    }
+
+    const VirtualStorageCatalog::Messages& messages = d_catalog_p->d_messages;
+    if (d_resumeSequenceNumber == d_catalog_p->d_nextSequenceNumber) {
+        // No message was added since this iterator reached the end.
+        return true;  // RETURN
+    }
+
+    // Look, from the back of the list, for the oldest message added since
+    // this iterator reached the end.
+    VirtualStorageCatalog::MessagesConstIter it = messages.end();
+    while (it != messages.begin()) {
+        VirtualStorageCatalog::MessagesConstIter prev = it;
+        --prev;
+        if (prev->second.d_sequenceNumber < d_resumeSequenceNumber) {
+            break;  // BREAK
+        }
+        it = prev;
+    }
+
+    if (it == messages.end()) {
+        // The messages added since were all removed.
+        d_resumeSequenceNumber = d_catalog_p->d_nextSequenceNumber;
+        return true;  // RETURN
+    }
+
+    d_iterator = it;
+    d_isAtEnd  = false;
+    return false;
+}
+
+bool VirtualStorageCatalog_Iterator::hasReceipt() const
+{
+    return !atEnd() &&
+           d_catalog_p->d_storage_p->hasReceipt(d_iterator->first);
+}
+
+bsls::Types::Uint64 VirtualStorageCatalog_Iterator::appStates() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!atEnd());
+
+    return d_iterator->second.d_appStates;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
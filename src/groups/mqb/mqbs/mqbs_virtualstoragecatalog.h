@@ -24,6 +24,23 @@
 //
 //@DESCRIPTION: 'mqbs::VirtualStorageCatalog' provides a collection of virtual
 // storages associated with a queue.
+//
+/// App States
+///----------
+// The catalog gives each of its virtual storages an ordinal, and keeps, for
+// each message, a bitmap having the bit of the ordinal of every virtual
+// storage holding the message (see 'mqbs::VirtualStorage').  Depending on the
+// 'AppStatesMode' it is created with, the bitmaps are either kept in the
+// messages of the underlying storage ('e_STORAGE', for the catalog owned by
+// that storage, whose virtual storages receive the messages in the order of
+// the storage), or in a list of messages kept by the catalog itself
+// ('e_CATALOG', for a catalog whose virtual storages receive the messages of
+// the underlying storage in another order, such as the PUSH order of a relay
+// queue).  In both cases, a message held by several virtual storages costs
+// one bitmap instead of one entry per virtual storage.
+//
+// Note that a virtual storage iterator which has moved past a message does
+// not see that message if the message is later added to its virtual storage.
 
 // MQB
 
@@ -32,9 +49,14 @@
 #include <mqbu_storagekey.h>
 
 // BMQ
+#include <bmqp_protocol.h>
 #include <bmqt_messageguid.h>
 
+// MWC
+#include <mwcc_orderedhashmap.h>
+
 // BDE
+#include <bdlbb_blob.h>
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
 #include <bsl_string.h>
@@ -42,35 +64,107 @@
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 
 namespace mqbs {
 
+// FORWARD DECLARATION
+class VirtualStorageCatalog_Iterator;
+
 // ===========================
 // class VirtualStorageCatalog
 // ===========================
 
 /// A catalog of virtual storages associated with a queue.
 class VirtualStorageCatalog {
+  public:
+    // PUBLIC TYPES
+
+    /// Where the app states of the messages are kept.
+    struct AppStatesMode {
+        enum Enum {
+            e_CATALOG = 0,  // In a list of messages kept by the catalog
+            e_STORAGE = 1   // In the messages of the underlying storage
+        };
+    };
+
+    // PUBLIC CONSTANTS
+
+    /// Maximum number of virtual storages of a catalog, i.e., number of
+    /// bits in the app states of a message.
+    static const int k_MAX_NUM_VIRTUAL_STORAGES = 64;
+
   private:
+    // FRIENDS
+    friend class VirtualStorage;
+    friend class VirtualStorageCatalog_Iterator;
+
     // PRIVATE TYPES
     typedef bsl::shared_ptr<VirtualStorage> VirtualStorageSp;
 
     /// appKey -> virtualStorage
-    typedef bsl::unordered_map<mqbu::StorageKey, VirtualStorageSp>
+    typedef bsl::unordered_map<mqbu::StorageKey,
+                               VirtualStorageSp,
+                               bslh::Hash<mqbu::StorageKeyHashAlgo> >
         VirtualStorages;
 
     typedef VirtualStorages::iterator VirtualStoragesIter;
 
     typedef VirtualStorages::const_iterator VirtualStoragesConstIter;
 
+    /// State of a message in the list kept in `e_CATALOG` mode.
+    struct MessageState {
+        bsls::Types::Uint64 d_appStates;
+        bsls::Types::Uint64 d_sequenceNumber;
+        int                 d_size;
+
+        MessageState(bsls::Types::Uint64 appStates,
+                     bsls::Types::Uint64 sequenceNumber,
+                     int                 size);
+    };
+
+    /// msgGUID -> state, in the order the messages were added.
+    typedef mwcc::OrderedHashMap<bmqt::MessageGUID,
+                                 MessageState,
+                                 bslh::Hash<bmqt::MessageGUIDHashAlgo> >
+        Messages;
+
+    typedef Messages::iterator MessagesIter;
+
+    typedef Messages::const_iterator MessagesConstIter;
+
   private:
     // DATA
     mqbi::Storage* d_storage_p;  // Physical storage underlying all
                                  // virtual storages known to this
                                  // object
 
+    AppStatesMode::Enum d_appStatesMode;
+    // Where the app states of the messages
+    // are kept
+
+    Messages d_messages;
+    // Messages held by at least one virtual
+    // storage, with their app states, if
+    // 'd_appStatesMode' is 'e_CATALOG';
+    // empty otherwise
+
+    bsls::Types::Uint64 d_nextSequenceNumber;
+    // Sequence number of the next message
+    // added to 'd_messages'
+
+    bsls::Types::Uint64 d_usedOrdinals;
+    // Bitmap of the ordinals of the virtual
+    // storages
+
+    bmqp::RdaInfo d_defaultRdaInfo;
+    // RDA info of the messages put in a
+    // virtual storage with the same RDA
+    // info
+
     VirtualStorages d_virtualStorages;
     // Map of appKey to corresponding
     // virtual storage
@@ -83,6 +177,56 @@ class VirtualStorageCatalog {
     VirtualStorageCatalog&
     operator=(const VirtualStorageCatalog&);  // = delete
 
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Set the app states of the message having the specified `msgGUID` to
+    /// its current value with the bits in the specified `clearMask` cleared
+    /// and then the bits in the specified `setMask` set, and load the
+    /// previous value into the specified `previous`.  Return `e_SUCCESS`,
+    /// or `e_GUID_NOT_FOUND` if the message is unknown.  Note that, if
+    /// `d_appStatesMode` is `e_CATALOG`, an unknown message is added, with
+    /// the optionally specified `msgSize`, if `setMask` is not zero, and a
+    /// message is forgotten when its app states become zero.
+    mqbi::StorageResult::Enum
+    updateAppStates(bsls::Types::Uint64*     previous,
+                    const bmqt::MessageGUID& msgGUID,
+                    bsls::Types::Uint64      setMask,
+                    bsls::Types::Uint64      clearMask,
+                    int                      msgSize = 0);
+
+    /// Clear the bits in the specified `mask` from the app states of every
+    /// message.
+    void clearAppStates(bsls::Types::Uint64 mask);
+
+    /// Return an iterator over the messages whose app states are kept by
+    /// this object, pointing to the oldest one, if any.
+    bslma::ManagedPtr<mqbi::StorageIterator> getMessagesIterator();
+
+    /// Load into the specified `out` an iterator over the messages whose
+    /// app states are kept by this object, pointing to the message having
+    /// the specified `msgGUID`.  Return `e_SUCCESS`, or `e_GUID_NOT_FOUND`
+    /// if the message is unknown.
+    mqbi::StorageResult::Enum
+    getMessagesIterator(bslma::ManagedPtr<mqbi::StorageIterator>* out,
+                        const bmqt::MessageGUID&                  msgGUID);
+
+    // PRIVATE ACCESSORS
+
+    /// Load into the specified `appStates` the app states of the message
+    /// having the specified `msgGUID`.  Return `e_SUCCESS`, or
+    /// `e_GUID_NOT_FOUND`, leaving `appStates` untouched, if the message is
+    /// unknown.
+    mqbi::StorageResult::Enum
+    getAppStates(bsls::Types::Uint64*     appStates,
+                 const bmqt::MessageGUID& msgGUID) const;
+
+    /// Load into the specified `msgSize` the size of the message having the
+    /// specified `msgGUID`.  Return `e_SUCCESS`, or `e_GUID_NOT_FOUND`,
+    /// leaving `msgSize` untouched, if the message is unknown.
+    mqbi::StorageResult::Enum
+    getMessageSize(int* msgSize, const bmqt::MessageGUID& msgGUID) const;
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(VirtualStorageCatalog,
@@ -96,10 +240,20 @@ class VirtualStorageCatalog {
 
     // CREATORS
 
-    /// Create an instance of virtual storage catalog with the specified
-    /// `allocator`.
+    /// Create an instance of virtual storage catalog of the specified
+    /// `storage`, keeping the app states of the messages in a list of its
+    /// own, with the specified `allocator`.
     VirtualStorageCatalog(mqbi::Storage* storage, bslma::Allocator* allocator);
 
+    /// Create an instance of virtual storage catalog of the specified
+    /// `storage`, keeping the app states of the messages as specified by
+    /// `appStatesMode`, with the specified `allocator`.  The behavior is
+    /// undefined unless, if `appStatesMode` is `e_STORAGE`, this object is
+    /// the only catalog of `storage` in that mode.
+    VirtualStorageCatalog(mqbi::Storage*      storage,
+                          AppStatesMode::Enum appStatesMode,
+                          bslma::Allocator*   allocator);
+
     /// Destructor
     ~VirtualStorageCatalog();
 
@@ -108,7 +262,8 @@ class VirtualStorageCatalog {
     /// Save the message having the specified `msgGUID`, `msgSize` and
     /// `rdaInfo` to the virtual storage associated with the specified
     /// `appKey`.  Note that if `appKey` is null, the message will be added
-    /// to all virtual storages maintained by this instance.
+    /// to all virtual storages maintained by this instance, with a single
+    /// update of its app states.
     mqbi::StorageResult::Enum put(const bmqt::MessageGUID& msgGUID,
                                   int                      msgSize,
                                   const bmqp::RdaInfo&     rdaInfo,
@@ -159,7 +314,9 @@ class VirtualStorageCatalog {
     /// Create, if it doesn't exist already, a virtual storage instance with
     /// the specified `appId` and `appKey`.  Return zero upon success and a
     /// non-zero value otherwise, and populate the specified
-    /// `errorDescription` with a brief reason in case of failure.
+    /// `errorDescription` with a brief reason in case of failure.  Note
+    /// that creation fails if this object already has
+    /// `k_MAX_NUM_VIRTUAL_STORAGES` virtual storages.
     int addVirtualStorage(bsl::ostream&           errorDescription,
                           const bsl::string&      appId,
                           const mqbu::StorageKey& appKey);
@@ -174,6 +331,10 @@ class VirtualStorageCatalog {
 
     mqbi::Storage* virtualStorage(const mqbu::StorageKey& appKey);
 
+    /// Set the RDA info of the messages put with the default RDA info, and
+    /// not redelivered since, to the specified `value`.
+    void setDefaultRdaInfo(const bmqp::RdaInfo& value);
+
     // ACCESSORS
 
     /// Return the number of virtual storages registered with this instance.
@@ -212,10 +373,130 @@ class VirtualStorageCatalog {
     bool hasMessage(const bmqt::MessageGUID& msgGUID) const;
 };
 
+// ====================================
+// class VirtualStorageCatalog_Iterator
+// ====================================
+
+/// For use only by `mqbs::VirtualStorageCatalog` implementation.  Iterator
+/// over the list of messages of a catalog in `e_CATALOG` mode, loading the
+/// messages from the underlying storage.  Note that, unlike an iterator
+/// over the list, this iterator does not rest on the end of the list once
+/// it reaches it, since a message added afterwards would then be its
+/// current message even if the virtual storages which skip it later
+/// remove it from the list.  It rather remembers the sequence number of
+/// the next message to be added, and resumes from the oldest message added
+/// since, if any.
+class VirtualStorageCatalog_Iterator : public mqbi::StorageIterator {
+  private:
+    // DATA
+    VirtualStorageCatalog* d_catalog_p;
+
+    mutable VirtualStorageCatalog::MessagesConstIter d_iterator;
+    // Current message, unless
+    // 'd_isAtEnd' is true.
+
+    mutable bool d_isAtEnd;
+    // Whether this iterator has reached
+    // the end of the list.
+
+    mutable bsls::Types::Uint64 d_resumeSequenceNumber;
+    // Sequence number of the first
+    // message to resume from, if
+    // 'd_isAtEnd' is true.
+
+    mutable mqbi::StorageMessageAttributes d_attributes;
+
+    mutable bsl::shared_ptr<bdlbb::Blob> d_appData_sp;
+    // If this variable is empty, it is
+    // assumed that attributes, message,
+    // and options have not been loaded in
+    // this iteration (see also
+    // 'loadMessageAndAttributes' impl).
+
+    mutable bsl::shared_ptr<bdlbb::Blob> d_options_sp;
+
+  private:
+    // NOT IMPLEMENTED
+    VirtualStorageCatalog_Iterator(
+        const VirtualStorageCatalog_Iterator&);  // = delete
+    VirtualStorageCatalog_Iterator&
+    operator=(const VirtualStorageCatalog_Iterator&);  // = delete
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Clear previous state, if any.  This is required so that new state
+    /// can be loaded in `appData`, `options` or `attributes` routines.
+    void clear();
+
+    // PRIVATE ACCESSORS
+
+    /// Detach this iterator from the list if it is at the end of it.
+    void detachIfAtEnd() const;
+
+    /// Load the internal state of this iterator instance with the
+    /// attributes and blob pointed to by the MessageGUID to which this
+    /// iterator is currently pointing.  Behavior is undefined if `atEnd()`
+    /// returns true or if underlying storage does not contain the
+    /// MessageGUID being pointed to by this iterator.
+    void loadMessageAndAttributes() const;
+
+  public:
+    // CREATORS
+
+    /// Create a new VirtualStorageCatalog_Iterator over the messages of
+    /// the specified `catalog`, pointing at the specified
+    /// `initialPosition`.
+    VirtualStorageCatalog_Iterator(
+        VirtualStorageCatalog*                          catalog,
+        const VirtualStorageCatalog::MessagesConstIter& initialPosition);
+
+    /// Destructor
+    ~VirtualStorageCatalog_Iterator() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+    bool advance() BSLS_KEYWORD_OVERRIDE;
+    void reset() BSLS_KEYWORD_OVERRIDE;
+
+    // ACCESSORS
+    const bmqt::MessageGUID& guid() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Behavior is undefined if this method is ever invoked.  This method
+    /// needs to be implemented as its part of base protocol.
+    bmqp::RdaInfo& rdaInfo() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Behavior is undefined if this method is ever invoked.  This method
+    /// needs to be implemented as its part of base protocol.
+    unsigned int subscriptionId() const BSLS_KEYWORD_OVERRIDE;
+
+    const bsl::shared_ptr<bdlbb::Blob>& appData() const BSLS_KEYWORD_OVERRIDE;
+    const bsl::shared_ptr<bdlbb::Blob>& options() const BSLS_KEYWORD_OVERRIDE;
+    const mqbi::StorageMessageAttributes&
+         attributes() const BSLS_KEYWORD_OVERRIDE;
+    bool atEnd() const BSLS_KEYWORD_OVERRIDE;
+    bool hasReceipt() const BSLS_KEYWORD_OVERRIDE;
+    bsls::Types::Uint64 appStates() const BSLS_KEYWORD_OVERRIDE;
+};
+
 // ============================================================================
 //                             INLINE DEFINITIONS
 // ============================================================================
 
+// -------------------------------------------
+// struct VirtualStorageCatalog::MessageState
+// -------------------------------------------
+
+inline VirtualStorageCatalog::MessageState::MessageState(
+    bsls::Types::Uint64 appStates,
+    bsls::Types::Uint64 sequenceNumber,
+    int                 size)
+: d_appStates(appStates)
+, d_sequenceNumber(sequenceNumber)
+, d_size(size)
+{
+    // NOTHING
+}
+
 // ---------------------------
 // class VirtualStorageCatalog
 // ---------------------------
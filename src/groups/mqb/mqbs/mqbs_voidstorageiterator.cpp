@@ -93,6 +93,11 @@ bool VoidStorageIterator::hasReceipt() const
     return false;
 }
 
+bsls::Types::Uint64 VoidStorageIterator::appStates() const
+{
+    return 0;
+}
+
 // MANIPULATORS
 bool VoidStorageIterator::advance()
 {
@@ -119,6 +119,9 @@ class VoidStorageIterator : public mqbi::StorageIterator {
     /// iterator has received replication factor Receipts.
     virtual bool hasReceipt() const BSLS_KEYWORD_OVERRIDE;
 
+    /// Return zero.
+    virtual bsls::Types::Uint64 appStates() const BSLS_KEYWORD_OVERRIDE;
+
     // MANIPULATORS
 
     /// Advance the iterator to the next item.  The behavior is undefined
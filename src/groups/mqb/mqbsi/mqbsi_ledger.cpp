@@ -183,6 +183,8 @@ LedgerConfig::LedgerConfig(bslma::Allocator* allocator)
 , d_reserveOnDisk(false)
 , d_prefaultPages(false)
 , d_keepOldLogs(false)
+, d_directIo(false)
+, d_readCacheSize(0)
 , d_logFactory_sp()
 , d_logIdGenerator_sp()
 , d_extractLogIdCallback(bsl::allocator_arg, allocator)
@@ -201,6 +203,8 @@ LedgerConfig::LedgerConfig(const LedgerConfig& other,
 , d_reserveOnDisk(other.d_reserveOnDisk)
 , d_prefaultPages(other.d_prefaultPages)
 , d_keepOldLogs(other.d_keepOldLogs)
+, d_directIo(other.d_directIo)
+, d_readCacheSize(other.d_readCacheSize)
 , d_logFactory_sp(other.d_logFactory_sp)
 , d_logIdGenerator_sp(other.d_logIdGenerator_sp)
 , d_extractLogIdCallback(bsl::allocator_arg,
@@ -252,6 +256,18 @@ LedgerConfig& LedgerConfig::setKeepOldLogs(bool value)
     return *this;
 }
 
+LedgerConfig& LedgerConfig::setDirectIo(bool value)
+{
+    d_directIo = value;
+    return *this;
+}
+
+LedgerConfig& LedgerConfig::setReadCacheSize(bsls::Types::Int64 value)
+{
+    d_readCacheSize = value;
+    return *this;
+}
+
 LedgerConfig&
 LedgerConfig::setLogFactory(const bsl::shared_ptr<mqbsi::LogFactory>& value)
 {
@@ -322,6 +338,16 @@ bool LedgerConfig::keepOldLogs() const
     return d_keepOldLogs;
 }
 
+bool LedgerConfig::directIo() const
+{
+    return d_directIo;
+}
+
+bsls::Types::Int64 LedgerConfig::readCacheSize() const
+{
+    return d_readCacheSize;
+}
+
 mqbsi::LogFactory* LedgerConfig::logFactory() const
 {
     return d_logFactory_sp.get();
@@ -360,6 +386,8 @@ LedgerConfig::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("location", location());
     printer.printAttribute("pattern", pattern());
     printer.printAttribute("maxLogSize", maxLogSize());
+    printer.printAttribute("directIo", directIo());
+    printer.printAttribute("readCacheSize", readCacheSize());
 
     return stream;
 }
@@ -288,6 +288,17 @@ class LedgerConfig {
     // logs and keep old logs open when
     // rolling over to a new log.
 
+    bool d_directIo;
+    // Flag indicating whether logs should
+    // bypass the page cache, if supported
+    // by the log implementation.
+
+    bsls::Types::Int64 d_readCacheSize;
+    // Maximum number of most recently
+    // written bytes of the current log
+    // kept in memory to serve reads, or 0
+    // to disable the read cache.
+
     bsl::shared_ptr<mqbsi::LogFactory> d_logFactory_sp;
     // Pointer to log factory used to
     // create logs.
@@ -332,6 +343,8 @@ class LedgerConfig {
     LedgerConfig& setReserveOnDisk(bool value);
     LedgerConfig& setPrefaultPages(bool value);
     LedgerConfig& setKeepOldLogs(bool value);
+    LedgerConfig& setDirectIo(bool value);
+    LedgerConfig& setReadCacheSize(bsls::Types::Int64 value);
     LedgerConfig&
     setLogFactory(const bsl::shared_ptr<mqbsi::LogFactory>& value);
     LedgerConfig&
@@ -351,6 +364,8 @@ class LedgerConfig {
     bool                   reserveOnDisk() const;
     bool                   prefaultPages() const;
     bool                   keepOldLogs() const;
+    bool                   directIo() const;
+    bsls::Types::Int64     readCacheSize() const;
     mqbsi::LogFactory*     logFactory() const;
     mqbsi::LogIdGenerator* logIdGenerator() const;
     const ExtractLogIdCb&  extractLogIdCallback() const;
@@ -466,6 +481,15 @@ class Ledger {
     /// mechanism, and return 0 on success, or a non-zero value on error.
     virtual int flush() = 0;
 
+    /// Roll over the current log being written to, so that subsequent
+    /// records are written to a new log, and return 0 on success, or a
+    /// non-zero `mqbsi::LedgerOpResult` otherwise.  If successful, invoke
+    /// the `OnRolloverCb` (and, unless old logs are kept, the `CleanupCb`
+    /// of the old log) found in the ledger config.  Note that a ledger
+    /// rolls over on its own when the current log is full; this method
+    /// allows a client to compact the ledger earlier.
+    virtual int rollOver() = 0;
+
     // ACCESSORS
 
     /// Copy the specified `length` bytes from the specified `recordId` in
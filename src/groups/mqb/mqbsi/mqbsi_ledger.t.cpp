@@ -106,6 +106,8 @@ struct LedgerTestImp : bsls::ProtocolTestImp<mqbsi::Ledger> {
 
     int flush() BSLS_KEYWORD_OVERRIDE { return markDone(); }
 
+    int rollOver() BSLS_KEYWORD_OVERRIDE { return markDone(); }
+
     int readRecord(void*                 entry,
                    int                   length,
                    const LedgerRecordId& recordId) const BSLS_KEYWORD_OVERRIDE
@@ -143,6 +143,7 @@ LogConfig::print(bsl::ostream& stream, int level, int spacesPerLevel) const
         printer.printAttribute("location", location());
         printer.printAttribute("reserveOnDisk", reserveOnDisk());
         printer.printAttribute("prefaultPages", prefaultPages());
+        printer.printAttribute("directIo", directIo());
     }
     printer.end();
 
@@ -44,6 +44,7 @@
 
 // BDE
 #include <bdlbb_blob.h>
+#include <bsl_functional.h>
 #include <bsl_ostream.h>
 #include <bsl_string.h>
 #include <bslma_allocator.h>
@@ -242,6 +243,10 @@ class LogConfig {
                            // a memory mapping of the underlying
                            // file representing the log
 
+    bool d_directIo;  // Whether to bypass the page cache when
+                      // accessing the underlying file
+                      // representing the log, if supported
+
   public:
     // CREATORS
 
@@ -264,19 +269,21 @@ class LogConfig {
     LogConfig& setLogId(const mqbu::StorageKey& value);
     LogConfig& setLocation(const bslstl::StringRef& value);
     LogConfig& setReserveOnDisk(bool value);
+    LogConfig& setPrefaultPages(bool value);
 
     /// Set the corresponding attribute to the specified `value` and return
     /// a reference offering modifiable access to this object.
-    LogConfig& setPrefaultPages(bool value);
+    LogConfig& setDirectIo(bool value);
 
     // ACCESSORS
     bsls::Types::Int64      maxSize() const;
     const mqbu::StorageKey& logId() const;
     const bsl::string&      location() const;
     bool                    reserveOnDisk() const;
+    bool                    prefaultPages() const;
 
     /// Get the value of the corresponding attribute.
-    bool prefaultPages() const;
+    bool directIo() const;
 
     /// Format this object to the specified output `stream` at the (absolute
     /// value of) the optionally specified indentation `level` and return a
@@ -338,6 +345,13 @@ class Log {
     typedef bsls::Types::Int64  Offset;
     typedef bsls::Types::Uint64 UnsignedOffset;
 
+    /// Signature of the callback invoked upon completion of an
+    /// asynchronous flush, where `status` is 0 on success or a negative
+    /// value `LogOpResult` on error, and `durableOffset` is the offset up
+    /// to which the log is known to be durable.
+    typedef bsl::function<void(int status, Offset durableOffset)>
+        FlushCallback;
+
     enum Enum {
         e_READ_ONLY = (1 << 0)  // Whether the log is read-only
         ,
@@ -425,6 +439,18 @@ class Log {
     /// data is flushed.
     virtual int flush(Offset offset = 0) = 0;
 
+    /// Request that any cached data up to the specified `offset` be flushed
+    /// to the underlying storing mechanism, and invoke the specified
+    /// `callback` once it is durable or once the flush fails.  Return 0 if
+    /// the request was accepted, or a negative value `LogOpResult` on
+    /// error, in which case `callback` is not invoked.  If `offset` is 0,
+    /// all data written so far is flushed.  Note that `callback` may be
+    /// invoked from a thread other than the caller's, and possibly before
+    /// this method returns; implementations not supporting asynchronous
+    /// flushing invoke it synchronously.  Also note that all outstanding
+    /// callbacks are invoked before `close()` returns.
+    virtual int flushAsync(Offset offset, const FlushCallback& callback) = 0;
+
     // ACCESSORS
 
     /// Copy the specified `length` bytes starting at the specified `offset`
@@ -477,6 +503,7 @@ inline LogConfig::LogConfig(bsls::Types::Int64      maxSize,
 , d_location("", allocator)
 , d_reserveOnDisk(false)
 , d_prefaultPages(false)
+, d_directIo(false)
 {
     // NOTHING
 }
@@ -492,6 +519,7 @@ inline LogConfig::LogConfig(bsls::Types::Int64       maxSize,
 , d_location(location, allocator)
 , d_reserveOnDisk(reserveOnDisk)
 , d_prefaultPages(prefaultPages)
+, d_directIo(false)
 {
     // NOTHING
 }
@@ -527,6 +555,12 @@ inline LogConfig& LogConfig::setPrefaultPages(bool value)
     return *this;
 }
 
+inline LogConfig& LogConfig::setDirectIo(bool value)
+{
+    d_directIo = value;
+    return *this;
+}
+
 // ACCESSORS
 inline bsls::Types::Int64 LogConfig::maxSize() const
 {
@@ -553,6 +587,11 @@ inline bool LogConfig::prefaultPages() const
     return d_prefaultPages;
 }
 
+inline bool LogConfig::directIo() const
+{
+    return d_directIo;
+}
+
 }  // close package namespace
 
 // FREE OPERATORS
@@ -573,7 +612,8 @@ inline bool mqbsi::operator==(const LogConfig& lhs, const LogConfig& rhs)
     return lhs.maxSize() == rhs.maxSize() && lhs.logId() == rhs.logId() &&
            lhs.location() == rhs.location() &&
            lhs.reserveOnDisk() == rhs.reserveOnDisk() &&
-           lhs.prefaultPages() == rhs.prefaultPages();
+           lhs.prefaultPages() == rhs.prefaultPages() &&
+           lhs.directIo() == rhs.directIo();
 }
 
 }  // close enterprise namespace
@@ -115,6 +115,12 @@ struct LogTestImp : bsls::ProtocolTestImp<mqbsi::Log> {
 
     int flush(Offset offset = 0) BSLS_KEYWORD_OVERRIDE { return markDone(); }
 
+    int flushAsync(Offset               offset,
+                   const FlushCallback& callback) BSLS_KEYWORD_OVERRIDE
+    {
+        return markDone();
+    }
+
     int
     read(void* entry, int length, Offset offset) const BSLS_KEYWORD_OVERRIDE
     {
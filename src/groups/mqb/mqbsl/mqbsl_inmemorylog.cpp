@@ -19,6 +19,8 @@
 #include <mqbscm_version.h>
 // BDE
 #include <bdlbb_blobutil.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
 #include <bslma_allocator.h>
 #include <bsls_annotation.h>
 #include <bsls_assert.h>
@@ -31,10 +33,8 @@ namespace mqbsl {
 // ------------------------
 
 // CREATORS
-InMemoryLogFactory::InMemoryLogFactory(bslma::Allocator*         allocator,
-                                       bdlbb::BlobBufferFactory* bufferFactory)
+InMemoryLogFactory::InMemoryLogFactory(bslma::Allocator* allocator)
 : d_allocator_p(allocator)
-, d_bufferFactory_p(bufferFactory)
 {
     // NOTHING
 }
@@ -48,10 +48,9 @@ InMemoryLogFactory::~InMemoryLogFactory()
 bslma::ManagedPtr<mqbsi::Log>
 InMemoryLogFactory::create(const mqbsi::LogConfig& config)
 {
-    bslma::ManagedPtr<mqbsi::Log> log(
-        new (*d_allocator_p)
-            InMemoryLog(config, d_bufferFactory_p, d_allocator_p),
-        d_allocator_p);
+    bslma::ManagedPtr<mqbsi::Log> log(new (*d_allocator_p)
+                                          InMemoryLog(config, d_allocator_p),
+                                      d_allocator_p);
     return log;
 }
 
@@ -59,8 +58,13 @@ InMemoryLogFactory::create(const mqbsi::LogConfig& config)
 // class InMemoryLog
 // -----------------
 
-mqbsi::Log::Offset InMemoryLog::writeImpl(const bdlbb::Blob& entry)
+// PRIVATE MANIPULATORS
+mqbsi::Log::Offset InMemoryLog::reserveRecord(char** dest, int length)
 {
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dest);
+    BSLS_ASSERT_SAFE(length >= 0);
+
     if (d_logState != LogState::e_OPENED_READWRITE) {
         return LogOpResult::e_UNSUPPORTED_OPERATION;  // RETURN
     }
@@ -68,18 +72,28 @@ mqbsi::Log::Offset InMemoryLog::writeImpl(const bdlbb::Blob& entry)
     const bool isAppend = static_cast<UnsignedOffset>(d_currentOffset) ==
                           d_records.size();
 
-    const int                length = entry.length();
     const bsls::Types::Int64 numBytesDelta =
-        isAppend ? length : length - d_records[d_currentOffset].length();
+        isAppend ? length : length - d_records[d_currentOffset].d_length;
     if (d_totalNumBytes + numBytesDelta > d_config.maxSize()) {
         return LogOpResult::e_REACHED_END_OF_LOG;  // RETURN
     }
 
     if (isAppend) {
-        d_records.push_back(entry);
+        Record record;
+        *dest = allocateTail(&record, length);
+        d_records.push_back(record);
     }
     else {
-        d_records[d_currentOffset] = entry;
+        Record& record = d_records[d_currentOffset];
+        if (length <= record.d_length) {
+            // Overwrite the record in place
+            *dest = d_segments[record.d_segment].d_data_sp.get() +
+                    record.d_position;
+            record.d_length = length;
+        }
+        else {
+            *dest = allocateTail(&record, length);
+        }
     }
 
     ++d_currentOffset;
@@ -89,6 +103,38 @@ mqbsi::Log::Offset InMemoryLog::writeImpl(const bdlbb::Blob& entry)
     return d_currentOffset - 1;
 }
 
+char* InMemoryLog::allocateTail(Record* record, int length)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(record);
+    BSLS_ASSERT_SAFE(length >= 0);
+
+    if (d_segments.empty() ||
+        d_segments.back().d_capacity - d_segments.back().d_length < length) {
+        const int segmentSize = static_cast<int>(bsl::min(
+            static_cast<bsls::Types::Int64>(k_SEGMENT_SIZE),
+            d_config.maxSize()));
+
+        Segment segment;
+        segment.d_capacity = bsl::max(segmentSize, length);
+        segment.d_length   = 0;
+        segment.d_data_sp =
+            bslstl::SharedPtrUtil::createInplaceUninitializedBuffer(
+                segment.d_capacity,
+                d_allocator_p);
+        d_segments.push_back(segment);
+    }
+
+    Segment& segment   = d_segments.back();
+    record->d_segment  = static_cast<int>(d_segments.size()) - 1;
+    record->d_position = segment.d_length;
+    record->d_length   = length;
+    segment.d_length += length;
+
+    return segment.d_data_sp.get() + record->d_position;
+}
+
+// PRIVATE ACCESSORS
 int InMemoryLog::validateRead(int length, Offset offset) const
 {
     // PRECONDITIONS
@@ -100,20 +146,25 @@ int InMemoryLog::validateRead(int length, Offset offset) const
         return LogOpResult::e_UNSUPPORTED_OPERATION;  // RETURN
     }
 
-    if (static_cast<UnsignedOffset>(offset) > d_records.size()) {
+    if (static_cast<UnsignedOffset>(offset) >= d_records.size()) {
         return LogOpResult::e_OFFSET_OUT_OF_RANGE;  // RETURN
     }
 
-    if (length > d_records[offset].length()) {
+    if (length > d_records[offset].d_length) {
         return LogOpResult::e_REACHED_END_OF_RECORD;  // RETURN
     }
 
     return LogOpResult::e_SUCCESS;
 }
 
-InMemoryLog::InMemoryLog(const LogConfig&          config,
-                         bdlbb::BlobBufferFactory* blobBufferFactory,
-                         bslma::Allocator*         allocator)
+const char* InMemoryLog::recordData(Offset offset) const
+{
+    const Record& record = d_records[offset];
+    return d_segments[record.d_segment].d_data_sp.get() + record.d_position;
+}
+
+// CREATORS
+InMemoryLog::InMemoryLog(const LogConfig& config, bslma::Allocator* allocator)
 : d_allocator_p(allocator)
 , d_isOpened(false)
 , d_totalNumBytes(0)
@@ -121,8 +172,8 @@ InMemoryLog::InMemoryLog(const LogConfig&          config,
 , d_currentOffset(0)
 , d_config(config)
 , d_logState(LogState::e_NON_EXISTENT)
+, d_segments(allocator)
 , d_records(allocator)
-, d_blobBufferFactory_p(blobBufferFactory)
 {
     // NOTHING
 }
@@ -186,6 +237,50 @@ int InMemoryLog::seek(Offset offset)
     return LogOpResult::e_SUCCESS;
 }
 
+int InMemoryLog::truncate(Offset offset)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(offset >= 0);
+
+    if (d_logState != LogState::e_OPENED_READWRITE) {
+        return LogOpResult::e_UNSUPPORTED_OPERATION;  // RETURN
+    }
+
+    if (static_cast<UnsignedOffset>(offset) > d_records.size()) {
+        return LogOpResult::e_OFFSET_OUT_OF_RANGE;  // RETURN
+    }
+
+    for (Records::size_type i = offset; i < d_records.size(); ++i) {
+        d_totalNumBytes -= d_records[i].d_length;
+    }
+    d_records.resize(offset);
+
+    // Find the last byte still referenced by a record.  Records overwritten
+    // with a larger one are moved to the tail, so the segment of the last
+    // record is not necessarily the last one in use.
+    int lastSegment  = -1;
+    int lastPosition = 0;
+    for (Records::const_iterator it = d_records.begin();
+         it != d_records.end();
+         ++it) {
+        const int end = it->d_position + it->d_length;
+        if (it->d_segment > lastSegment ||
+            (it->d_segment == lastSegment && end > lastPosition)) {
+            lastSegment  = it->d_segment;
+            lastPosition = end;
+        }
+    }
+
+    d_segments.resize(lastSegment + 1);
+    if (!d_segments.empty()) {
+        d_segments.back().d_length = lastPosition;
+    }
+
+    d_currentOffset = bsl::min(d_currentOffset, offset);
+
+    return LogOpResult::e_SUCCESS;
+}
+
 mqbsi::Log::Offset
 InMemoryLog::write(const void* entry, int offset, int length)
 {
@@ -194,13 +289,15 @@ InMemoryLog::write(const void* entry, int offset, int length)
     BSLS_ASSERT_SAFE(offset >= 0);
     BSLS_ASSERT_SAFE(length >= 0);
 
-    bdlbb::Blob blob(d_blobBufferFactory_p, d_allocator_p);
-    bdlbb::BlobUtil::append(&blob,
-                            static_cast<const char*>(entry),
-                            offset,
-                            length);
+    char*        dest;
+    const Offset rc = reserveRecord(&dest, length);
+    if (rc < 0) {
+        return rc;  // RETURN
+    }
 
-    return writeImpl(blob);
+    bsl::memcpy(dest, static_cast<const char*>(entry) + offset, length);
+
+    return rc;
 }
 
 mqbsi::Log::Offset InMemoryLog::write(const bdlbb::Blob&        entry,
@@ -210,14 +307,17 @@ mqbsi::Log::Offset InMemoryLog::write(const bdlbb::Blob&        entry,
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(length >= 0);
 
-    bdlbb::Blob blob(d_blobBufferFactory_p, d_allocator_p);
-    mwcu::BlobUtil::appendBlobFromIndex(&blob,
-                                        entry,
-                                        offset.buffer(),
-                                        offset.byte(),
-                                        length);
+    char*        dest;
+    const Offset rc = reserveRecord(&dest, length);
+    if (rc < 0) {
+        return rc;  // RETURN
+    }
+
+    const int readRc = mwcu::BlobUtil::readNBytes(dest, entry, offset, length);
+    BSLS_ASSERT_SAFE(readRc == 0);
+    (void)readRc;
 
-    return writeImpl(blob);
+    return rc;
 }
 
 mqbsi::Log::Offset InMemoryLog::write(const bdlbb::Blob&       entry,
@@ -237,6 +337,22 @@ int InMemoryLog::flush(BSLS_ANNOTATION_UNUSED Offset offset)
     return LogOpResult::e_SUCCESS;
 }
 
+int InMemoryLog::flushAsync(Offset offset, const FlushCallback& callback)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(offset >= 0);
+    BSLS_ASSERT_SAFE(callback);
+
+    const int rc = flush(offset);
+    if (rc != LogOpResult::e_SUCCESS) {
+        return rc;  // RETURN
+    }
+
+    callback(rc, offset == 0 ? d_currentOffset : offset);
+
+    return LogOpResult::e_SUCCESS;
+}
+
 int InMemoryLog::read(void* entry, int length, Offset offset) const
 {
     // PRECONDITIONS
@@ -247,10 +363,7 @@ int InMemoryLog::read(void* entry, int length, Offset offset) const
         return rc;  // RETURN
     }
 
-    mwcu::BlobUtil::readNBytes(static_cast<char*>(entry),
-                               d_records[offset],
-                               mwcu::BlobPosition(),
-                               length);
+    bsl::memcpy(entry, recordData(offset), length);
 
     return LogOpResult::e_SUCCESS;
 }
@@ -265,16 +378,24 @@ int InMemoryLog::read(bdlbb::Blob* entry, int length, Offset offset) const
         return rc;  // RETURN
     }
 
-    bdlbb::BlobUtil::copy(entry, 0, d_records[offset], 0, length);
+    bdlbb::BlobUtil::copy(entry, 0, recordData(offset), length);
 
     return LogOpResult::e_SUCCESS;
 }
 
-int InMemoryLog::alias(BSLS_ANNOTATION_UNUSED void** entry,
-                       BSLS_ANNOTATION_UNUSED int    length,
-                       BSLS_ANNOTATION_UNUSED Offset offset) const
+int InMemoryLog::alias(void** entry, int length, Offset offset) const
 {
-    return LogOpResult::e_UNSUPPORTED_OPERATION;
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(entry);
+
+    int rc = validateRead(length, offset);
+    if (rc != LogOpResult::e_SUCCESS) {
+        return rc;  // RETURN
+    }
+
+    *entry = const_cast<char*>(recordData(offset));
+
+    return LogOpResult::e_SUCCESS;
 }
 
 int InMemoryLog::alias(bdlbb::Blob* entry, int length, Offset offset) const
@@ -287,7 +408,11 @@ int InMemoryLog::alias(bdlbb::Blob* entry, int length, Offset offset) const
         return rc;  // RETURN
     }
 
-    bdlbb::BlobUtil::append(entry, d_records[offset], 0, length);
+    // Share ownership of the segment, so that it outlives the alias
+    const Record&         record = d_records[offset];
+    bsl::shared_ptr<char> entryBufferSp(d_segments[record.d_segment].d_data_sp,
+                                        const_cast<char*>(recordData(offset)));
+    entry->appendDataBuffer(bdlbb::BlobBuffer(entryBufferSp, length));
 
     return LogOpResult::e_SUCCESS;
 }
@@ -33,6 +33,22 @@
 // implementation of the 'mqbsi::LogFactory' protocol used to create in-memory
 // log instances.
 //
+// Note that offsets in an in-memory log identify records rather than bytes:
+// the 'N'th record written to the log is at offset 'N'.
+//
+/// Memory Layout
+///-------------
+// Records are copied back to back into large segments, allocated as needed
+// and each holding up to 'k_SEGMENT_SIZE' bytes (or the maximum size of the
+// log, if smaller), so that writing a record does not allocate beyond the
+// occasional new segment.  A record larger than a segment is given a
+// segment of its own.  Because each record is contiguous in memory, 'alias'
+// returns a reference to the segment without copying, and aliased blobs
+// keep the segment alive.  Overwriting a record (after a 'seek') reuses its
+// storage if the new record fits, or moves it to the tail otherwise.
+// 'truncate' drops records at the end of the log and releases the segments
+// no longer referenced.
+//
 /// Thread Safety
 ///-------------
 // This component is *NOT* thread safe.
@@ -52,12 +68,6 @@
 #include <bsls_keyword.h>
 
 namespace BloombergLP {
-
-// FORWARD DECLARATION
-namespace bdlbb {
-class BlobBufferFactory;
-}
-
 namespace mqbsl {
 
 // ========================
@@ -68,8 +78,7 @@ namespace mqbsl {
 class InMemoryLogFactory BSLS_KEYWORD_FINAL : public mqbsi::LogFactory {
   private:
     // DATA
-    bslma::Allocator*         d_allocator_p;
-    bdlbb::BlobBufferFactory* d_bufferFactory_p;
+    bslma::Allocator* d_allocator_p;
 
   private:
     // NOT IMPLEMENTED
@@ -81,9 +90,8 @@ class InMemoryLogFactory BSLS_KEYWORD_FINAL : public mqbsi::LogFactory {
     // CREATORS
 
     /// Constructor of a `mqbsl::InMemoryLogFactory` object, using the
-    /// specified `allocator` and `bufferFactory` to supply memory.
-    InMemoryLogFactory(bslma::Allocator*         allocator,
-                       bdlbb::BlobBufferFactory* bufferFactory);
+    /// specified `allocator` to supply memory.
+    explicit InMemoryLogFactory(bslma::Allocator* allocator);
 
     /// Destructor.
     virtual ~InMemoryLogFactory() BSLS_KEYWORD_OVERRIDE;
@@ -117,6 +125,45 @@ class InMemoryLog BSLS_KEYWORD_FINAL : public mqbsi::Log {
         };
     };
 
+    /// Block of memory into which records are copied back to back.
+    struct Segment {
+        // DATA
+        bsl::shared_ptr<char> d_data_sp;
+        // Memory of the segment
+
+        int d_capacity;
+        // Number of bytes available in the
+        // segment
+
+        int d_length;
+        // Number of bytes used in the segment
+    };
+
+    /// Location of a record in the segments.
+    struct Record {
+        // DATA
+        int d_segment;
+        // Index of the segment holding the
+        // record
+
+        int d_position;
+        // Position of the record in its
+        // segment
+
+        int d_length;
+        // Length of the record
+    };
+
+    typedef bsl::vector<Segment> Segments;
+
+    typedef bsl::vector<Record> Records;
+
+  public:
+    // CONSTANTS
+
+    /// Default capacity of a segment, in bytes.
+    static const int k_SEGMENT_SIZE = 1024 * 1024;  // 1 MiB
+
   private:
     // DATA
     bslma::Allocator* d_allocator_p;
@@ -148,11 +195,13 @@ class InMemoryLog BSLS_KEYWORD_FINAL : public mqbsi::Log {
     LogState::Enum d_logState;
     // Current state of the log
 
-    bsl::vector<bdlbb::Blob> d_records;
-    // Vector of log records
+    Segments d_segments;
+    // Segments holding the records, in
+    // order of allocation
 
-    bdlbb::BlobBufferFactory* d_blobBufferFactory_p;
-    // BlobBufferFactory to use, held not owned
+    Records d_records;
+    // Location of each record, indexed by
+    // offset
 
   private:
     // NOT IMPLEMENTED
@@ -162,11 +211,18 @@ class InMemoryLog BSLS_KEYWORD_FINAL : public mqbsi::Log {
   private:
     // PRIVATE MANIPULATORS
 
-    /// Write the specified `entry` into the log's internal write position.
-    /// The number of outstanding bytes in the log will be incremented by
-    /// the length of the `entry`.  Return the offset at which the `entry`
-    /// was written on success, or a negative value on error.
-    Offset writeImpl(const bdlbb::Blob& entry);
+    /// Reserve space for a record of the specified `length` at the log's
+    /// internal write position, and load into the specified `dest` the
+    /// address at which its bytes must be copied.  The number of
+    /// outstanding bytes in the log will be incremented by `length`.
+    /// Return the offset of the record on success, or a negative value on
+    /// error.
+    Offset reserveRecord(char** dest, int length);
+
+    /// Return the address of a contiguous area of the specified `length`
+    /// bytes at the tail of the segments, allocating a new segment if
+    /// needed, and load into the specified `record` its location.
+    char* allocateTail(Record* record, int length);
 
     // PRIVATE ACCESSORS
 
@@ -175,18 +231,19 @@ class InMemoryLog BSLS_KEYWORD_FINAL : public mqbsi::Log {
     /// Return 0 on success or a negative value LogOpResult otherwise.
     int validateRead(int length, Offset offset) const;
 
+    /// Return the address of the first byte of the record at the specified
+    /// `offset`.
+    const char* recordData(Offset offset) const;
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(InMemoryLog, bslma::UsesBslmaAllocator)
 
     // CREATORS
 
-    /// Create an instance of in-memory log having the specified `config`
-    /// and using the specified `blobBufferFactory`.  Memory allocations are
-    /// performed using the optionally specified `allocator`.
-    InMemoryLog(const LogConfig&          config,
-                bdlbb::BlobBufferFactory* blobBufferFactory,
-                bslma::Allocator*         allocator);
+    /// Create an instance of in-memory log having the specified `config`.
+    /// Memory allocations are performed using the specified `allocator`.
+    InMemoryLog(const LogConfig& config, bslma::Allocator* allocator);
 
     /// Destructor
     ~InMemoryLog() BSLS_KEYWORD_OVERRIDE;
@@ -231,6 +288,13 @@ class InMemoryLog BSLS_KEYWORD_FINAL : public mqbsi::Log {
     virtual void
     setOutstandingNumBytes(bsls::Types::Int64 value) BSLS_KEYWORD_OVERRIDE;
 
+    /// Drop the records at and after the specified `offset`, release the
+    /// segments no longer holding any record, and move the log's internal
+    /// write position to `offset` if it was beyond it.  Return 0 on
+    /// success, or a negative value LogOpResult on error.  Note that it is
+    /// the onus of the user to update the number of outstanding bytes.
+    int truncate(Offset offset);
+
     virtual Offset
     write(const void* entry, int offset, int length) BSLS_KEYWORD_OVERRIDE;
 
@@ -265,6 +329,15 @@ class InMemoryLog BSLS_KEYWORD_FINAL : public mqbsi::Log {
     /// all data is flushed.
     virtual int flush(Offset offset = 0) BSLS_KEYWORD_OVERRIDE;
 
+    /// Flush the data up to the specified `offset` synchronously and invoke
+    /// the specified `callback` before returning.  Return 0 on success, or
+    /// a negative value `mqbsi::LogOpResult` on error, in which case
+    /// `callback` is not invoked.  Note that this log does not support
+    /// asynchronous flushing.
+    virtual int
+    flushAsync(Offset               offset,
+               const FlushCallback& callback) BSLS_KEYWORD_OVERRIDE;
+
     // ACCESSORS
     virtual int
     read(void* entry, int length, Offset offset) const BSLS_KEYWORD_OVERRIDE;
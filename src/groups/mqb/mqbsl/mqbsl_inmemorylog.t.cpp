@@ -24,7 +24,9 @@
 #include <bdlbb_blob.h>
 #include <bdlbb_blobutil.h>
 #include <bdlbb_pooledblobbufferfactory.h>
+#include <bsl_algorithm.h>
 #include <bsl_cstring.h>  // for bsl::memcmp
+#include <bsl_vector.h>
 #include <bsls_types.h>
 
 // TEST DRIVER
@@ -50,6 +52,7 @@ using namespace bsl;
 // - aliasRaw
 // - aliasBlob
 // - seek
+// - truncate
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -117,7 +120,7 @@ static void test1_breathingTest()
     mwctst::TestHelper::printTestName("BREATHING TEST");
 
     const mqbsi::LogConfig k_CONFIG(k_LOG_MAX_SIZE, k_LOG_KEY, s_allocator_p);
-    InMemoryLog            log(k_CONFIG, g_bufferFactory_p, s_allocator_p);
+    InMemoryLog            log(k_CONFIG, s_allocator_p);
     ASSERT_EQ(log.isOpened(), false);
 
     ASSERT_EQ(log.open(Log::e_CREATE_IF_MISSING), LogOpResult::e_SUCCESS);
@@ -147,7 +150,7 @@ static void test2_doubleOpen()
     mwctst::TestHelper::printTestName("DOUBLE OPEN");
 
     const mqbsi::LogConfig k_CONFIG(k_LOG_MAX_SIZE, k_LOG_KEY, s_allocator_p);
-    InMemoryLog            log(k_CONFIG, g_bufferFactory_p, s_allocator_p);
+    InMemoryLog            log(k_CONFIG, s_allocator_p);
     BSLS_ASSERT_OPT(log.open(Log::e_CREATE_IF_MISSING) ==
                     LogOpResult::e_SUCCESS);
     ASSERT_EQ(log.open(Log::e_CREATE_IF_MISSING),
@@ -168,7 +171,7 @@ static void test3_doubleClose()
     mwctst::TestHelper::printTestName("DOUBLE CLOSE");
 
     const mqbsi::LogConfig k_CONFIG(k_LOG_MAX_SIZE, k_LOG_KEY, s_allocator_p);
-    InMemoryLog            log(k_CONFIG, g_bufferFactory_p, s_allocator_p);
+    InMemoryLog            log(k_CONFIG, s_allocator_p);
     BSLS_ASSERT_OPT(log.open(Log::e_CREATE_IF_MISSING) ==
                     LogOpResult::e_SUCCESS);
     BSLS_ASSERT_OPT(log.close() == LogOpResult::e_SUCCESS);
@@ -189,7 +192,7 @@ static void test4_updateOutstandingNumBytes()
     mwctst::TestHelper::printTestName("UPDATE OUTSTANDING NUM BYTES");
 
     const mqbsi::LogConfig k_CONFIG(k_LOG_MAX_SIZE, k_LOG_KEY, s_allocator_p);
-    InMemoryLog            log(k_CONFIG, g_bufferFactory_p, s_allocator_p);
+    InMemoryLog            log(k_CONFIG, s_allocator_p);
     BSLS_ASSERT_OPT(log.open(Log::e_CREATE_IF_MISSING) ==
                     LogOpResult::e_SUCCESS);
     BSLS_ASSERT_OPT(log.outstandingNumBytes() == 0);
@@ -224,7 +227,7 @@ static void test5_setOutstandingNumBytes()
     mwctst::TestHelper::printTestName("SET OUTSTANDING NUM BYTES");
 
     const mqbsi::LogConfig k_CONFIG(k_LOG_MAX_SIZE, k_LOG_KEY, s_allocator_p);
-    InMemoryLog            log(k_CONFIG, g_bufferFactory_p, s_allocator_p);
+    InMemoryLog            log(k_CONFIG, s_allocator_p);
     BSLS_ASSERT_OPT(log.open(Log::e_CREATE_IF_MISSING) ==
                     LogOpResult::e_SUCCESS);
     BSLS_ASSERT_OPT(log.outstandingNumBytes() == 0);
@@ -262,7 +265,7 @@ static void test6_writeRaw()
     const bsls::Types::Int64 maxSize = k_NUM_ENTRIES * k_ENTRY_LENGTH +
                                        k_LONG_ENTRY_LENGTH + 10;
     const mqbsi::LogConfig config(maxSize, k_LOG_KEY, s_allocator_p);
-    InMemoryLog            log(config, g_bufferFactory_p, s_allocator_p);
+    InMemoryLog            log(config, s_allocator_p);
     BSLS_ASSERT_OPT(log.open(Log::e_CREATE_IF_MISSING) ==
                     LogOpResult::e_SUCCESS);
 
@@ -328,7 +331,7 @@ static void test7_writeBlob()
     const bsls::Types::Int64 maxSize = k_NUM_ENTRIES * k_ENTRY_LENGTH +
                                        k_LONG_ENTRY_LENGTH + 10;
     const mqbsi::LogConfig config(maxSize, k_LOG_KEY, s_allocator_p);
-    InMemoryLog            log(config, g_bufferFactory_p, s_allocator_p);
+    InMemoryLog            log(config, s_allocator_p);
     BSLS_ASSERT_OPT(log.open(Log::e_CREATE_IF_MISSING) ==
                     LogOpResult::e_SUCCESS);
 
@@ -403,7 +406,7 @@ static void test8_writeBlobSection()
     const bsls::Types::Int64 maxSize = k_NUM_ENTRIES * k_ENTRY_LENGTH +
                                        k_LONG_ENTRY_LENGTH + 10;
     const mqbsi::LogConfig config(maxSize, k_LOG_KEY, s_allocator_p);
-    InMemoryLog            log(config, g_bufferFactory_p, s_allocator_p);
+    InMemoryLog            log(config, s_allocator_p);
     BSLS_ASSERT_OPT(log.open(Log::e_CREATE_IF_MISSING) ==
                     LogOpResult::e_SUCCESS);
 
@@ -473,7 +476,7 @@ static void test9_readRaw()
     mwctst::TestHelper::printTestName("READ RAW");
 
     const mqbsi::LogConfig k_CONFIG(k_LOG_MAX_SIZE, k_LOG_KEY, s_allocator_p);
-    InMemoryLog            log(k_CONFIG, g_miniBufferFactory_p, s_allocator_p);
+    InMemoryLog            log(k_CONFIG, s_allocator_p);
     BSLS_ASSERT_OPT(log.open(Log::e_CREATE_IF_MISSING) ==
                     LogOpResult::e_SUCCESS);
 
@@ -560,7 +563,7 @@ static void test10_readBlob()
     mwctst::TestHelper::printTestName("READ BLOB");
 
     const mqbsi::LogConfig k_CONFIG(k_LOG_MAX_SIZE, k_LOG_KEY, s_allocator_p);
-    InMemoryLog            log(k_CONFIG, g_miniBufferFactory_p, s_allocator_p);
+    InMemoryLog            log(k_CONFIG, s_allocator_p);
     BSLS_ASSERT_OPT(log.open(Log::e_CREATE_IF_MISSING) ==
                     LogOpResult::e_SUCCESS);
 
@@ -660,14 +663,44 @@ static void test11_aliasRaw()
     mwctst::TestHelper::printTestName("ALIAS RAW");
 
     const mqbsi::LogConfig k_CONFIG(k_LOG_MAX_SIZE, k_LOG_KEY, s_allocator_p);
-    InMemoryLog            log(k_CONFIG, g_bufferFactory_p, s_allocator_p);
+    InMemoryLog            log(k_CONFIG, s_allocator_p);
     BSLS_ASSERT_OPT(log.open(Log::e_CREATE_IF_MISSING) ==
                     LogOpResult::e_SUCCESS);
 
-    // Raw aliasing is not supported
-    char entry[k_ENTRY_LENGTH];
-    ASSERT_EQ(log.alias(reinterpret_cast<void**>(&entry), k_ENTRY_LENGTH, 0),
-              LogOpResult::e_UNSUPPORTED_OPERATION);
+    // 1. Write a list of entries, then a long entry
+    for (int i = 0; i < k_NUM_ENTRIES; ++i) {
+        BSLS_ASSERT_OPT(log.write(k_ENTRIES[i], 0, k_ENTRY_LENGTH) ==
+                        static_cast<Offset>(i));
+    }
+    BSLS_ASSERT_OPT(log.write(k_LONG_ENTRY,
+                              k_LONG_ENTRY_OFFSET,
+                              k_LONG_ENTRY_LENGTH) ==
+                    static_cast<Offset>(k_NUM_ENTRIES));
+
+    // 2. Alias each entry
+    char* entry = 0;
+    for (int i = 0; i < k_NUM_ENTRIES; ++i) {
+        ASSERT_EQ(log.alias(reinterpret_cast<void**>(&entry),
+                            k_ENTRY_LENGTH,
+                            i),
+                  LogOpResult::e_SUCCESS);
+        ASSERT_EQ(bsl::memcmp(entry, k_ENTRIES[i], k_ENTRY_LENGTH), 0);
+    }
+
+    ASSERT_EQ(log.alias(reinterpret_cast<void**>(&entry),
+                        k_LONG_ENTRY_LENGTH,
+                        k_NUM_ENTRIES),
+              LogOpResult::e_SUCCESS);
+    ASSERT_EQ(bsl::memcmp(entry, k_LONG_ENTRY_MEAT, k_LONG_ENTRY_LENGTH), 0);
+
+    // 3. Alias beyond the last record offset should fail
+    ASSERT_EQ(
+        log.alias(reinterpret_cast<void**>(&entry), k_ENTRY_LENGTH, 9999),
+        LogOpResult::e_OFFSET_OUT_OF_RANGE);
+
+    // 4. Alias beyond the length of the record should fail
+    ASSERT_EQ(log.alias(reinterpret_cast<void**>(&entry), 9999, 0),
+              LogOpResult::e_REACHED_END_OF_RECORD);
 
     BSLS_ASSERT_OPT(log.close() == LogOpResult::e_SUCCESS);
 }
@@ -686,7 +719,7 @@ static void test12_aliasBlob()
     mwctst::TestHelper::printTestName("ALIAS BLOB");
 
     const mqbsi::LogConfig k_CONFIG(k_LOG_MAX_SIZE, k_LOG_KEY, s_allocator_p);
-    InMemoryLog            log(k_CONFIG, g_miniBufferFactory_p, s_allocator_p);
+    InMemoryLog            log(k_CONFIG, s_allocator_p);
     BSLS_ASSERT_OPT(log.open(Log::e_CREATE_IF_MISSING) ==
                     LogOpResult::e_SUCCESS);
 
@@ -792,7 +825,7 @@ static void test13_seek()
     mwctst::TestHelper::printTestName("SEEK");
 
     const mqbsi::LogConfig k_CONFIG(k_LOG_MAX_SIZE, k_LOG_KEY, s_allocator_p);
-    InMemoryLog            log(k_CONFIG, g_bufferFactory_p, s_allocator_p);
+    InMemoryLog            log(k_CONFIG, s_allocator_p);
     BSLS_ASSERT_OPT(log.open(Log::e_CREATE_IF_MISSING) ==
                     LogOpResult::e_SUCCESS);
     BSLS_ASSERT_OPT(log.currentOffset() == static_cast<Offset>(0));
@@ -880,6 +913,120 @@ static void test13_seek()
     BSLS_ASSERT_OPT(log.close() == LogOpResult::e_SUCCESS);
 }
 
+static void test14_truncate()
+// ------------------------------------------------------------------------
+// TRUNCATE
+//
+// Concerns:
+//   Verify that records spanning several segments, including records
+//   larger than a segment and records overwritten with a larger one, are
+//   read back correctly, that 'truncate' drops the records at and after
+//   the specified offset, and that aliased records outlive the truncation
+//   of their segment.
+//
+// Testing:
+//   truncate(Offset offset)
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("TRUNCATE");
+
+    static const int k_MAX_SIZE    = 4 * InMemoryLog::k_SEGMENT_SIZE;
+    static const int k_RECORD_SIZE = InMemoryLog::k_SEGMENT_SIZE / 4 + 1;
+
+    const mqbsi::LogConfig config(k_MAX_SIZE, k_LOG_KEY, s_allocator_p);
+    InMemoryLog            log(config, s_allocator_p);
+    BSLS_ASSERT_OPT(log.open(Log::e_CREATE_IF_MISSING) ==
+                    LogOpResult::e_SUCCESS);
+
+    // 1. Write records spanning several segments, each filled with a
+    //    distinct character, then a record larger than a segment
+    const int         k_NUM_RECORDS = 8;
+    bsl::vector<char> record(InMemoryLog::k_SEGMENT_SIZE + 1, s_allocator_p);
+    for (int i = 0; i < k_NUM_RECORDS; ++i) {
+        bsl::fill(record.begin(), record.end(), static_cast<char>('a' + i));
+        ASSERT_EQ(log.write(record.data(), 0, k_RECORD_SIZE),
+                  static_cast<Offset>(i));
+    }
+    bsl::fill(record.begin(), record.end(), 'Z');
+    ASSERT_EQ(log.write(record.data(), 0, static_cast<int>(record.size())),
+              static_cast<Offset>(k_NUM_RECORDS));
+
+    // 2. Overwrite the first record with a larger one
+    ASSERT_EQ(log.seek(0), LogOpResult::e_SUCCESS);
+    bsl::fill(record.begin(), record.end(), 'Y');
+    ASSERT_EQ(log.write(record.data(), 0, k_RECORD_SIZE + 1),
+              static_cast<Offset>(0));
+    ASSERT_EQ(log.seek(k_NUM_RECORDS + 1), LogOpResult::e_SUCCESS);
+
+    // 3. Read back every record
+    char* entry = 0;
+    ASSERT_EQ(log.alias(reinterpret_cast<void**>(&entry),
+                        k_RECORD_SIZE + 1,
+                        0),
+              LogOpResult::e_SUCCESS);
+    ASSERT_EQ(entry[0], 'Y');
+    ASSERT_EQ(entry[k_RECORD_SIZE], 'Y');
+    for (int i = 1; i < k_NUM_RECORDS; ++i) {
+        ASSERT_EQ(log.alias(reinterpret_cast<void**>(&entry),
+                            k_RECORD_SIZE,
+                            i),
+                  LogOpResult::e_SUCCESS);
+        ASSERT_EQ_D(i, entry[0], static_cast<char>('a' + i));
+        ASSERT_EQ_D(i, entry[k_RECORD_SIZE - 1], static_cast<char>('a' + i));
+    }
+
+    // 4. Alias the last record as a blob, then truncate the log before it
+    bdlbb::Blob blob(g_bufferFactory_p, s_allocator_p);
+    ASSERT_EQ(log.alias(&blob,
+                        static_cast<int>(record.size()),
+                        k_NUM_RECORDS),
+              LogOpResult::e_SUCCESS);
+
+    const bsls::Types::Int64 numBytes = log.totalNumBytes();
+    ASSERT_EQ(log.truncate(k_NUM_RECORDS / 2), LogOpResult::e_SUCCESS);
+    ASSERT_EQ(log.currentOffset(), static_cast<Offset>(k_NUM_RECORDS / 2));
+    ASSERT_EQ(log.totalNumBytes(),
+              numBytes - (k_NUM_RECORDS / 2) * k_RECORD_SIZE -
+                  static_cast<bsls::Types::Int64>(record.size()));
+    char byte;
+    ASSERT_EQ(log.read(static_cast<void*>(&byte), 1, k_NUM_RECORDS / 2),
+              LogOpResult::e_OFFSET_OUT_OF_RANGE);
+
+    // The aliased record is still valid
+    ASSERT_EQ(blob.length(), static_cast<int>(record.size()));
+    ASSERT_EQ(blob.buffer(0).data()[0], 'Z');
+    blob.removeAll();
+
+    // 5. Write past the truncation point, then read all records back
+    bsl::fill(record.begin(), record.end(), 'X');
+    ASSERT_EQ(log.write(record.data(), 0, k_RECORD_SIZE),
+              static_cast<Offset>(k_NUM_RECORDS / 2));
+
+    ASSERT_EQ(log.alias(reinterpret_cast<void**>(&entry),
+                        k_RECORD_SIZE + 1,
+                        0),
+              LogOpResult::e_SUCCESS);
+    ASSERT_EQ(entry[0], 'Y');
+    for (int i = 1; i < k_NUM_RECORDS / 2; ++i) {
+        ASSERT_EQ(log.alias(reinterpret_cast<void**>(&entry),
+                            k_RECORD_SIZE,
+                            i),
+                  LogOpResult::e_SUCCESS);
+        ASSERT_EQ_D(i, entry[0], static_cast<char>('a' + i));
+    }
+    ASSERT_EQ(log.alias(reinterpret_cast<void**>(&entry),
+                        k_RECORD_SIZE,
+                        k_NUM_RECORDS / 2),
+              LogOpResult::e_SUCCESS);
+    ASSERT_EQ(entry[0], 'X');
+    ASSERT_EQ(entry[k_RECORD_SIZE - 1], 'X');
+
+    // 6. Truncating beyond the end of the log should fail
+    ASSERT_EQ(log.truncate(9999), LogOpResult::e_OFFSET_OUT_OF_RANGE);
+
+    BSLS_ASSERT_OPT(log.close() == LogOpResult::e_SUCCESS);
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -911,6 +1058,7 @@ int main(int argc, char* argv[])
         case 11: test11_aliasRaw(); break;
         case 12: test12_aliasBlob(); break;
         case 13: test13_seek(); break;
+        case 14: test14_truncate(); break;
         default: {
             cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
             s_testStatus = -1;
@@ -20,15 +20,20 @@
 // MQB
 #include <mqbsi_ledger.h>
 
+// MWC
+#include <mwcu_blob.h>
+
 // BDE
 #include <ball_log.h>
 #include <bdlb_scopeexit.h>
+#include <bdlbb_blobutil.h>
 #include <bdlf_bind.h>
 #include <bdls_filesystemutil.h>
 #include <bdls_pathutil.h>
 #include <bdlt_datetime.h>
 #include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
+#include <bsl_cstring.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
 #include <bsl_utility.h>
@@ -56,6 +61,33 @@ void populateLogFlags(int* logFlags, int ledgerFlags)
     }
 }
 
+/// Copy into the specified `destination` the specified `length` bytes
+/// starting at the specified `offset` of the specified `record`.
+void copyRecord(char*       destination,
+                const void* record,
+                int         offset,
+                int         length)
+{
+    bsl::memcpy(destination,
+                static_cast<const char*>(record) + offset,
+                length);
+}
+
+/// Copy into the specified `destination` the specified `length` bytes
+/// starting at the specified `offset` of the specified `record`.
+void copyRecord(char*                     destination,
+                const bdlbb::Blob&        record,
+                const mwcu::BlobPosition& offset,
+                int                       length)
+{
+    const int rc = mwcu::BlobUtil::readNBytes(destination,
+                                              record,
+                                              offset,
+                                              length);
+    BSLS_ASSERT_SAFE(rc == 0);
+    (void)rc;  // Compiler happiness
+}
+
 // ===================================
 // struct FileLastModificationTimeLess
 // ===================================
@@ -157,7 +189,8 @@ bsl::shared_ptr<mqbsi::Log> Ledger::createLog(const mqbu::StorageKey& logId,
 
     logConfig.setLocation(fullPath)
         .setReserveOnDisk(d_config.reserveOnDisk())
-        .setPrefaultPages(d_config.prefaultPages());
+        .setPrefaultPages(d_config.prefaultPages())
+        .setDirectIo(d_config.directIo());
 
     // Create a new log from the config and return it
     return bsl::shared_ptr<mqbsi::Log>(
@@ -227,6 +260,19 @@ bool Ledger::canWrite(int length) const
     return !(isEmpty || willExceedSize);
 }
 
+const char* Ledger::findInReadCache(int                   length,
+                                    const LedgerRecordId& recordId) const
+{
+    if (d_readCache.empty() || recordId.logId() != d_readCacheLogId ||
+        recordId.offset() < d_readCacheOffset ||
+        recordId.offset() + length >
+            d_readCacheOffset + static_cast<Offset>(d_readCache.size())) {
+        return 0;  // RETURN
+    }
+
+    return d_readCache.data() + (recordId.offset() - d_readCacheOffset);
+}
+
 int Ledger::find(Log** logPtr, const mqbu::StorageKey& logId) const
 {
     LogsMapCIt cit = d_logs.find(logId);
@@ -260,36 +306,6 @@ int Ledger::rollOverImpl(const mqbu::StorageKey& oldLogId)
     return LedgerOpResult::e_SUCCESS;
 }
 
-int Ledger::rollOver()
-{
-    LogSp& lastLog = currentLog();
-
-    // Flush the log and roll over
-    int rc = lastLog->flush();
-    if (rc != LogOpResult::e_SUCCESS) {
-        return rc * 100 + LedgerOpResult::e_LOG_FLUSH_FAILURE;  // RETURN
-    }
-
-    rc = rollOverImpl(lastLog->logConfig().logId());
-    if (rc != LedgerOpResult::e_SUCCESS) {
-        return rc;  // RETURN
-    }
-
-    // If not keeping old logs, close the log and invoke the cleanup callback
-    if (!d_config.keepOldLogs()) {
-        rc = lastLog->close();
-        if (rc != LogOpResult::e_SUCCESS) {
-            return rc * 100 + LedgerOpResult::e_LOG_CLOSE_FAILURE;  // RETURN
-        }
-        rc = d_config.cleanupCallback()(lastLog->logConfig().location());
-        if (rc != 0) {
-            return LedgerOpResult::e_LOG_CLEANUP_FAILURE;  // RETURN
-        }
-    }
-
-    return LedgerOpResult::e_SUCCESS;
-}
-
 template <typename RECORD, typename OFFSET>
 int Ledger::writeRecordImpl(LedgerRecordId* recordId,
                             const RECORD    record,
@@ -331,9 +347,55 @@ int Ledger::writeRecordImpl(LedgerRecordId* recordId,
     d_outstandingNumBytes += length;
     d_totalNumBytes += currLog->totalNumBytes() - oldNumBytes;
 
+    updateReadCache(logId, recordOffset, record, offset, length);
+
     return LedgerOpResult::e_SUCCESS;
 }
 
+template <typename RECORD, typename OFFSET>
+void Ledger::updateReadCache(const mqbu::StorageKey& logId,
+                             Offset                  recordOffset,
+                             const RECORD&           record,
+                             OFFSET                  offset,
+                             int                     length)
+{
+    const bsls::Types::Int64 capacity = d_config.readCacheSize();
+    if (capacity == 0) {
+        return;  // RETURN
+    }
+
+    if (logId != d_readCacheLogId ||
+        recordOffset !=
+            d_readCacheOffset + static_cast<Offset>(d_readCache.size())) {
+        // Not contiguous with the cached tail (e.g., rollover to a new log,
+        // or seek in the current log), so start caching afresh.
+        d_readCache.clear();
+        d_readCacheLogId  = logId;
+        d_readCacheOffset = recordOffset;
+    }
+
+    if (length > capacity) {
+        // Too large to be worth caching
+        d_readCache.clear();
+        d_readCacheOffset = recordOffset + length;
+        return;  // RETURN
+    }
+
+    const bsl::size_t oldSize = d_readCache.size();
+    d_readCache.resize(oldSize + length);
+    copyRecord(d_readCache.data() + oldSize, record, offset, length);
+
+    if (static_cast<bsls::Types::Int64>(d_readCache.size()) > 2 * capacity) {
+        // Evict the oldest bytes, keeping the last 'capacity' ones.  Letting
+        // the cache grow up to twice its capacity amortizes the cost of
+        // eviction.
+        const bsl::size_t numEvicted = d_readCache.size() - capacity;
+        d_readCache.erase(d_readCache.begin(),
+                          d_readCache.begin() + numEvicted);
+        d_readCacheOffset += numEvicted;
+    }
+}
+
 // CREATORS
 Ledger::Ledger(const mqbsi::LedgerConfig& config, bslma::Allocator* allocator)
 : d_isFirstOpen(true)
@@ -345,6 +407,9 @@ Ledger::Ledger(const mqbsi::LedgerConfig& config, bslma::Allocator* allocator)
 , d_logs(allocator)
 , d_logList(allocator)
 , d_state(LedgerState::e_CLOSED)
+, d_readCache(allocator)
+, d_readCacheLogId()
+, d_readCacheOffset(0)
 , d_allocator_p(allocator)
 {
     // PRECONDITIONS
@@ -510,6 +575,10 @@ int Ledger::close()
         }
     }
 
+    d_readCache.clear();
+    d_readCacheLogId.reset();
+    d_readCacheOffset = 0;
+
     d_state      = LedgerState::e_CLOSED;
     d_isReadOnly = false;
     return LedgerOpResult::e_SUCCESS;
@@ -619,6 +688,44 @@ int Ledger::flush()
     return LedgerOpResult::e_SUCCESS;
 }
 
+int Ledger::rollOver()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_state == LedgerState::e_OPENED);
+    BSLS_ASSERT_SAFE(!d_logs.empty());
+
+    if (d_isReadOnly) {
+        return LedgerOpResult::e_LEDGER_READ_ONLY;  // RETURN
+    }
+
+    LogSp& lastLog = currentLog();
+
+    // Flush the log and roll over
+    int rc = lastLog->flush();
+    if (rc != LogOpResult::e_SUCCESS) {
+        return rc * 100 + LedgerOpResult::e_LOG_FLUSH_FAILURE;  // RETURN
+    }
+
+    rc = rollOverImpl(lastLog->logConfig().logId());
+    if (rc != LedgerOpResult::e_SUCCESS) {
+        return rc;  // RETURN
+    }
+
+    // If not keeping old logs, close the log and invoke the cleanup callback
+    if (!d_config.keepOldLogs()) {
+        rc = lastLog->close();
+        if (rc != LogOpResult::e_SUCCESS) {
+            return rc * 100 + LedgerOpResult::e_LOG_CLOSE_FAILURE;  // RETURN
+        }
+        rc = d_config.cleanupCallback()(lastLog->logConfig().location());
+        if (rc != 0) {
+            return LedgerOpResult::e_LOG_CLEANUP_FAILURE;  // RETURN
+        }
+    }
+
+    return LedgerOpResult::e_SUCCESS;
+}
+
 // ACCESSORS
 //   (virtual 'mqbsi::Ledger')
 int Ledger::readRecord(void*                 entry,
@@ -630,6 +737,12 @@ int Ledger::readRecord(void*                 entry,
     BSLS_ASSERT_SAFE(entry);
     BSLS_ASSERT_SAFE(length >= 0);
 
+    const char* cached = findInReadCache(length, recordId);
+    if (cached) {
+        bsl::memcpy(entry, cached, length);
+        return LedgerOpResult::e_SUCCESS;  // RETURN
+    }
+
     Log* log = 0;
     int  rc  = find(&log, recordId.logId());
     if (rc != LedgerOpResult::e_SUCCESS) {
@@ -653,6 +766,12 @@ int Ledger::readRecord(bdlbb::Blob*          entry,
     BSLS_ASSERT_SAFE(entry);
     BSLS_ASSERT_SAFE(length >= 0);
 
+    const char* cached = findInReadCache(length, recordId);
+    if (cached) {
+        bdlbb::BlobUtil::append(entry, cached, length);
+        return LedgerOpResult::e_SUCCESS;  // RETURN
+    }
+
     Log* log = 0;
     int  rc  = find(&log, recordId.logId());
     if (rc != LedgerOpResult::e_SUCCESS) {
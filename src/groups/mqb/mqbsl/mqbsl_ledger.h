@@ -42,6 +42,7 @@
 
 // BDE
 #include <ball_log.h>
+#include <bsl_vector.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_istriviallycopyable.h>
 #include <bslmf_nestedtraitdeclaration.h>
@@ -128,6 +129,24 @@ class Ledger BSLS_KEYWORD_FINAL : public mqbsi::Ledger {
     LedgerState::Enum d_state;  // State of this ledger (open, closed,
                                 // etc.)
 
+    bsl::vector<char> d_readCache;
+    // Most recently written bytes of the
+    // current log, used to serve reads of
+    // the hot tail of this ledger without
+    // going to the log.  Holds between
+    // 'readCacheSize' and twice as many
+    // bytes of the ledger config, and is
+    // unused if 'readCacheSize' is 0.
+
+    mqbu::StorageKey d_readCacheLogId;
+    // ID of the log whose bytes are held in
+    // 'd_readCache'.
+
+    Offset d_readCacheOffset;
+    // Offset, in the log identified by
+    // 'd_readCacheLogId', of the first byte
+    // of 'd_readCache'.
+
     bslma::Allocator* d_allocator_p;  // Allocator used to supply memory
 
   private:
@@ -175,17 +194,23 @@ class Ledger BSLS_KEYWORD_FINAL : public mqbsi::Ledger {
     /// ledger config) when finished.
     int rollOverImpl(const mqbu::StorageKey& oldLogId);
 
-    /// Roll over the current log being written to and return 0 on success,
-    /// or a non-zero `mqbsi::LedgerOpResult` otherwise.  If successful,
-    /// invoke the optional `OnRolloverCb` when finished.
-    int rollOver();
-
     template <typename RECORD, typename OFFSET>
     int writeRecordImpl(LedgerRecordId* recordId,
                         const RECORD    record,
                         OFFSET          offset,
                         int             length);
 
+    /// Append to the read cache the specified `length` bytes starting at
+    /// the specified `offset` of the specified `record`, which was just
+    /// written at the specified `recordOffset` of the log identified by
+    /// the specified `logId`, and evict the oldest cached bytes if needed.
+    template <typename RECORD, typename OFFSET>
+    void updateReadCache(const mqbu::StorageKey& logId,
+                         Offset                  recordOffset,
+                         const RECORD&           record,
+                         OFFSET                  offset,
+                         int                     length);
+
     // PRIVATE ACCESSORS
 
     /// Return true if the current log being written to can accommodate
@@ -199,6 +224,12 @@ class Ledger BSLS_KEYWORD_FINAL : public mqbsi::Ledger {
     /// `mqbsi::LedgerOpResult::Enum` value otherwise.
     int find(Log** log, const mqbu::StorageKey& logId) const;
 
+    /// Return the address of the specified `length` bytes of the specified
+    /// `recordId` in the read cache if they are all cached, and 0
+    /// otherwise.
+    const char* findInReadCache(int                   length,
+                                const LedgerRecordId& recordId) const;
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(Ledger, bslma::UsesBslmaAllocator)
@@ -274,6 +305,11 @@ class Ledger BSLS_KEYWORD_FINAL : public mqbsi::Ledger {
     /// mechanism, and return 0 on success, or a non-zero value on error.
     virtual int flush() BSLS_KEYWORD_OVERRIDE;
 
+    /// Roll over the current log being written to and return 0 on success,
+    /// or a non-zero `mqbsi::LedgerOpResult` otherwise.  If successful,
+    /// invoke the optional `OnRolloverCb` when finished.
+    virtual int rollOver() BSLS_KEYWORD_OVERRIDE;
+
     // ACCESSORS
     //   (virtual 'mqbsi::Ledger')
     virtual int
@@ -21,17 +21,23 @@
 #include <mqbs_filesystemutil.h>
 
 // MWC
+#include <mwcsys_threadutil.h>
 #include <mwcu_memoutstream.h>
 
 // BDE
 #include <bdlb_scopeexit.h>
 #include <bdlbb_blobutil.h>
 #include <bdlf_bind.h>
+#include <bdlf_memfn.h>
 #include <bdls_filesystemutil.h>
+#include <bdls_memoryutil.h>
 #include <bsl_algorithm.h>  // for bsl::max
 #include <bsl_cstring.h>    // for bsl::memcpy
 #include <bsl_memory.h>
 #include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_threadattributes.h>
 #include <bsls_assert.h>
 
 // SYS
@@ -78,7 +84,8 @@ bslma::ManagedPtr<mqbsi::Log>
 MemoryMappedOnDiskLogFactory::create(const mqbsi::LogConfig& config)
 {
     bslma::ManagedPtr<mqbsi::Log> log(new (*d_allocator_p)
-                                          MemoryMappedOnDiskLog(config),
+                                          MemoryMappedOnDiskLog(config,
+                                                                d_allocator_p),
                                       d_allocator_p);
     return log;
 }
@@ -120,7 +127,101 @@ void MemoryMappedOnDiskLog::updateInternalState(int writeLength)
     d_totalNumBytes = bsl::max(d_totalNumBytes, d_currentOffset);
 }
 
-MemoryMappedOnDiskLog::MemoryMappedOnDiskLog(const mqbsi::LogConfig& config)
+int MemoryMappedOnDiskLog::syncRange(Offset endOffset)
+{
+    Offset              beginOffset;
+    bsls::Types::Uint64 generation;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_flushLock);  // LOCK
+
+        if (endOffset <= d_durableOffset) {
+            return LogOpResult::e_SUCCESS;  // RETURN
+        }
+
+        beginOffset = d_durableOffset;
+        generation  = d_durableGeneration;
+    }  // UNLOCK
+
+    // msync requires a page-aligned address
+    beginOffset -= beginOffset % d_pageSize;
+
+    const int rc = ::msync(d_mfd.mapping() + beginOffset,
+                           endOffset - beginOffset,
+                           MS_SYNC);
+    if (rc != 0) {
+        return LogOpResult::e_FILE_MSYNC_FAILURE;  // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_flushLock);  // LOCK
+    if (generation == d_durableGeneration) {
+        d_durableOffset = bsl::max(d_durableOffset, endOffset);
+    }
+
+    return LogOpResult::e_SUCCESS;
+}
+
+void MemoryMappedOnDiskLog::flushThreadMain()
+{
+    FlushRequests requests(d_allocator_p);
+
+    while (true) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_flushLock);  // LOCK
+
+            while (d_flushRequests.empty() && !d_stopFlushThread) {
+                d_flushCondition.wait(&d_flushLock);
+            }
+
+            if (d_flushRequests.empty()) {
+                // Asked to stop, and all requests have been served
+                return;  // RETURN
+            }
+
+            requests.swap(d_flushRequests);
+        }  // UNLOCK
+
+        // Coalesce all pending requests into a single msync
+        Offset endOffset = 0;
+        for (FlushRequests::const_iterator it = requests.begin();
+             it != requests.end();
+             ++it) {
+            endOffset = bsl::max(endOffset, it->first);
+        }
+
+        const int    rc      = syncRange(endOffset);
+        const Offset durable = durableOffset();
+        for (FlushRequests::const_iterator it = requests.begin();
+             it != requests.end();
+             ++it) {
+            it->second(rc, durable);
+        }
+
+        requests.clear();
+    }
+}
+
+void MemoryMappedOnDiskLog::stopFlushThread()
+{
+    if (!d_isFlushThreadRunning) {
+        return;  // RETURN
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_flushLock);  // LOCK
+        d_stopFlushThread = true;
+    }  // UNLOCK
+    d_flushCondition.signal();
+
+    const int rc = bslmt::ThreadUtil::join(d_flushThread);
+    BSLS_ASSERT_OPT(rc == 0);
+    (void)rc;
+
+    d_isFlushThreadRunning = false;
+    d_stopFlushThread      = false;
+}
+
+MemoryMappedOnDiskLog::MemoryMappedOnDiskLog(const mqbsi::LogConfig& config,
+                                             bslma::Allocator*       allocator)
 : d_isOpened(false)
 , d_isReadOnly(false)
 , d_totalNumBytes(0)
@@ -128,13 +229,23 @@ MemoryMappedOnDiskLog::MemoryMappedOnDiskLog(const mqbsi::LogConfig& config)
 , d_currentOffset(0)
 , d_config(config)
 , d_mfd()
+, d_pageSize(bdls::MemoryUtil::pageSize())
+, d_flushLock()
+, d_flushCondition()
+, d_flushRequests(bslma::Default::allocator(allocator))
+, d_durableOffset(0)
+, d_durableGeneration(0)
+, d_stopFlushThread(false)
+, d_isFlushThreadRunning(false)
+, d_flushThread()
+, d_allocator_p(bslma::Default::allocator(allocator))
 {
     // NOTHING
 }
 
 MemoryMappedOnDiskLog::~MemoryMappedOnDiskLog()
 {
-    // NOTHING
+    stopFlushThread();
 }
 
 int MemoryMappedOnDiskLog::open(int flags)
@@ -159,6 +270,13 @@ int MemoryMappedOnDiskLog::open(int flags)
     d_isOpened      = true;
     d_totalNumBytes = bdls::FilesystemUtil::getFileSize(d_config.location());
     d_outstandingNumBytes = d_totalNumBytes;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_flushLock);  // LOCK
+
+        // Durability of the existing content is unknown: let the first
+        // flush cover the whole log.
+        d_durableOffset = 0;
+    }  // UNLOCK
 
     bdlb::ScopeExitAny guard(
         bdlf::BindUtil::bind(openFailureCleanup, &d_mfd, &d_isOpened));
@@ -195,6 +313,9 @@ int MemoryMappedOnDiskLog::close()
         return LogOpResult::e_LOG_ALREADY_CLOSED;  // RETURN
     }
 
+    // Serve all outstanding flush requests before unmapping the log
+    stopFlushThread();
+
     int rc = LogOpResult::e_UNKNOWN;
     if (!d_isReadOnly) {
         mwcu::MemOutStream errorDescription;
@@ -230,6 +351,13 @@ int MemoryMappedOnDiskLog::seek(Offset offset)
 
     d_currentOffset = offset;
 
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_flushLock);  // LOCK
+    if (offset < d_durableOffset) {
+        // Bytes from 'offset' may be overwritten, and must be flushed again
+        d_durableOffset = offset;
+        ++d_durableGeneration;
+    }
+
     return LogOpResult::e_SUCCESS;
 }
 
@@ -321,11 +449,46 @@ int MemoryMappedOnDiskLog::flush(Offset offset)
         offset = d_currentOffset;
     }
 
-    const int rc = ::msync(d_mfd.mapping(), offset, MS_SYNC);
-    if (rc != 0) {
-        return LogOpResult::e_FILE_MSYNC_FAILURE;  // RETURN
+    return syncRange(offset);
+}
+
+int MemoryMappedOnDiskLog::flushAsync(Offset               offset,
+                                      const FlushCallback& callback)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(offset >= 0);
+    BSLS_ASSERT_SAFE(offset <= d_currentOffset);
+    BSLS_ASSERT_SAFE(callback);
+
+    if (!d_isOpened) {
+        return LogOpResult::e_UNSUPPORTED_OPERATION;  // RETURN
+    }
+
+    if (offset == 0) {
+        offset = d_currentOffset;
+    }
+
+    if (!d_isFlushThreadRunning) {
+        bslmt::ThreadAttributes attr = mwcsys::ThreadUtil::defaultAttributes();
+        attr.setThreadName("bmqLogFlush");
+        const int rc = bslmt::ThreadUtil::createWithAllocator(
+            &d_flushThread,
+            attr,
+            bdlf::MemFnUtil::memFn(&MemoryMappedOnDiskLog::flushThreadMain,
+                                   this),
+            d_allocator_p);
+        if (rc != 0) {
+            return LogOpResult::e_UNKNOWN;  // RETURN
+        }
+        d_isFlushThreadRunning = true;
     }
 
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_flushLock);  // LOCK
+        d_flushRequests.push_back(bsl::make_pair(offset, callback));
+    }  // UNLOCK
+    d_flushCondition.signal();
+
     return LogOpResult::e_SUCCESS;
 }
 
@@ -396,5 +559,11 @@ int MemoryMappedOnDiskLog::alias(bdlbb::Blob* entry,
     return LogOpResult::e_SUCCESS;
 }
 
+mqbsi::Log::Offset MemoryMappedOnDiskLog::durableOffset() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_flushLock);  // LOCK
+    return d_durableOffset;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
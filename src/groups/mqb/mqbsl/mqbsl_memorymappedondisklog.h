@@ -33,9 +33,21 @@
 // used solely in an append-only fashion.  Note that this implementation
 // memory-maps the log.
 //
+/// Flushing
+///--------
+// 'flush' synchronously msyncs the pages written since the last successful
+// flush, rather than the whole mapping.  'flushAsync' hands the same work
+// to a background thread, started upon the first call, which coalesces all
+// pending requests into a single msync and then invokes their callbacks
+// with the new durable offset.  This allows the user to keep appending to
+// the log while earlier writes become durable.  Seeking below the durable
+// offset lowers it, so that overwritten bytes are flushed again.  The
+// background thread is drained and joined upon 'close'.
+//
 /// Thread Safety
 ///-------------
-// This component is *NOT* thread safe.
+// This component is *NOT* thread safe, except that flush callbacks are
+// invoked from the background flushing thread.
 
 // MQB
 
@@ -47,7 +59,12 @@
 #include <mwcu_blob.h>
 
 // BDE
+#include <bsl_deque.h>
+#include <bsl_utility.h>
 #include <bslma_allocator.h>
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
 #include <bsls_keyword.h>
 
 namespace BloombergLP {
@@ -102,6 +119,12 @@ class MemoryMappedOnDiskLog BSLS_KEYWORD_FINAL : public OnDiskLog {
 
     typedef mqbs::MappedFileDescriptor MappedFileDescriptor;
 
+    /// Pair of the offset to flush up to and the callback to invoke once
+    /// it is durable.
+    typedef bsl::pair<Offset, FlushCallback> FlushRequest;
+
+    typedef bsl::deque<FlushRequest> FlushRequests;
+
   private:
     // DATA
     bool d_isOpened;  // Whether the log is opened.
@@ -133,6 +156,47 @@ class MemoryMappedOnDiskLog BSLS_KEYWORD_FINAL : public OnDiskLog {
     MappedFileDescriptor d_mfd;  // File descriptor to the underlying
                                  // memory-mapped file storing the log.
 
+    const int d_pageSize;  // Size of a memory page, to which the
+                           // start of each msync'ed range is
+                           // aligned.
+
+    mutable bslmt::Mutex d_flushLock;
+    // Lock protecting the flush requests,
+    // the durable offset and the stop
+    // flag.
+
+    bslmt::Condition d_flushCondition;
+    // Condition signaled when a flush
+    // request is enqueued or when the
+    // flushing thread must stop.
+
+    FlushRequests d_flushRequests;
+    // Pending asynchronous flush requests.
+
+    Offset d_durableOffset;
+    // Offset up to which the log is known
+    // to be durable.
+
+    bsls::Types::Uint64 d_durableGeneration;
+    // Incremented each time the durable
+    // offset is lowered by 'seek', so that
+    // a concurrent msync of a range which
+    // has since been overwritten does not
+    // raise it back.
+
+    bool d_stopFlushThread;  // Whether the flushing thread must
+                             // drain its requests and exit.
+
+    bool d_isFlushThreadRunning;
+    // Whether the flushing thread has been
+    // started.  Only accessed from the
+    // owner thread.
+
+    bslmt::ThreadUtil::Handle d_flushThread;
+    // Handle to the flushing thread.
+
+    bslma::Allocator* d_allocator_p;  // Allocator used to supply memory.
+
   private:
     // NOT IMPLEMENTED
     MemoryMappedOnDiskLog(const MemoryMappedOnDiskLog&) BSLS_KEYWORD_DELETED;
@@ -151,12 +215,28 @@ class MemoryMappedOnDiskLog BSLS_KEYWORD_FINAL : public OnDiskLog {
     /// the log if it has grown to a new max.
     void updateInternalState(int writeLength);
 
+    /// Msync the pages of the log from the durable offset up to the
+    /// specified `endOffset` and raise the durable offset accordingly.
+    /// Return 0 on success or a negative value LogOpResult otherwise.  This
+    /// method may be called from the flushing thread.
+    int syncRange(Offset endOffset);
+
+    /// Entry point of the flushing thread, which serves flush requests
+    /// until it is asked to stop and all requests have been served.
+    void flushThreadMain();
+
+    /// Drain and join the flushing thread, if it was started.
+    void stopFlushThread();
+
   public:
     // CREATORS
 
     /// Create an instance of memory-mapped on-disk log having the specified
-    /// `config`.
-    explicit MemoryMappedOnDiskLog(const mqbsi::LogConfig& config);
+    /// `config`.  Use the optionally specified `allocator` to supply
+    /// memory.  If `allocator` is 0, the currently installed default
+    /// allocator is used.
+    explicit MemoryMappedOnDiskLog(const mqbsi::LogConfig& config,
+                                   bslma::Allocator*       allocator = 0);
 
     /// Destructor
     ~MemoryMappedOnDiskLog() BSLS_KEYWORD_OVERRIDE;
@@ -235,6 +315,16 @@ class MemoryMappedOnDiskLog BSLS_KEYWORD_FINAL : public OnDiskLog {
     /// all data is flushed.
     virtual int flush(Offset offset = 0) BSLS_KEYWORD_OVERRIDE;
 
+    /// Request that the data up to the specified `offset` be flushed by the
+    /// background flushing thread, and invoke the specified `callback` from
+    /// that thread once it is durable or once the flush fails.  Return 0 if
+    /// the request was accepted, or a negative value `mqbsi::LogOpResult`
+    /// on error, in which case `callback` is not invoked.  If `offset` is
+    /// 0, all data written so far is flushed.
+    virtual int
+    flushAsync(Offset               offset,
+               const FlushCallback& callback) BSLS_KEYWORD_OVERRIDE;
+
     // ACCESSORS
     virtual int
     read(void* entry, int length, Offset offset) const BSLS_KEYWORD_OVERRIDE;
@@ -279,6 +369,9 @@ class MemoryMappedOnDiskLog BSLS_KEYWORD_FINAL : public OnDiskLog {
 
     /// Return the config of this on-disk log
     virtual const mqbsi::LogConfig& config() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the offset up to which the log is known to be durable.
+    Offset durableOffset() const;
 };
 
 // ============================================================================
@@ -25,7 +25,11 @@
 #include <bdlbb_blob.h>
 #include <bdlbb_blobutil.h>
 #include <bdlbb_pooledblobbufferfactory.h>
+#include <bdlf_bind.h>
 #include <bsl_cstring.h>  // for memcmp
+#include <bsl_vector.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
 #include <bsls_types.h>
 
 // TEST DRIVER
@@ -51,6 +55,7 @@ using namespace bsl;
 // - aliasRaw
 // - aliasBlob
 // - seek
+// - flushAsync
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -100,6 +105,21 @@ typedef mqbsi::LogOpResult           LogOpResult;
 static bdlbb::PooledBlobBufferFactory* g_bufferFactory_p     = 0;
 static bdlbb::PooledBlobBufferFactory* g_miniBufferFactory_p = 0;
 
+// FUNCTIONS
+
+/// Append the specified `status` and `durableOffset` to the specified
+/// `statuses` and `durableOffsets`, under the specified `lock`.
+void onFlushed(bslmt::Mutex*        lock,
+               bsl::vector<int>*    statuses,
+               bsl::vector<Offset>* durableOffsets,
+               int                  status,
+               Offset               durableOffset)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(lock);  // LOCK
+    statuses->push_back(status);
+    durableOffsets->push_back(durableOffset);
+}
+
 // CLASSES
 // =============
 // struct Tester
@@ -123,7 +143,7 @@ struct Tester {
                true,   // reserveOnDisk
                false,  // prefaultPages
                allocator)
-    , d_log(d_config)
+    , d_log(d_config, allocator)
     {
         // NOTHING
     }
@@ -1000,6 +1020,84 @@ static void test12_seek()
     s_allocator_p->deallocate(entry);
 }
 
+static void test13_flushAsync()
+// ------------------------------------------------------------------------
+// FLUSH ASYNC
+//
+// Concerns:
+//   Verify that 'flushAsync' invokes every callback with the offset up to
+//   which the log is durable, that all outstanding callbacks are invoked
+//   upon 'close', and that seeking below the durable offset lowers it.
+//
+// Testing:
+//   flushAsync(Offset offset, const FlushCallback& callback)
+//   flush(Offset offset)
+//   durableOffset()
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("FLUSH ASYNC");
+
+    Tester                 tester;
+    MemoryMappedOnDiskLog& log = tester.log();
+    BSLS_ASSERT_OPT(log.open(Log::e_CREATE_IF_MISSING) ==
+                    LogOpResult::e_SUCCESS);
+
+    // 1. Nothing is known to be durable before the first flush
+    ASSERT_EQ(log.durableOffset(), 0);
+
+    // 2. Write entries, requesting an asynchronous flush after each
+    bslmt::Mutex        lock;
+    bsl::vector<int>    statuses(s_allocator_p);
+    bsl::vector<Offset> durableOffsets(s_allocator_p);
+    for (int i = 0; i < k_NUM_ENTRIES; ++i) {
+        BSLS_ASSERT_OPT(log.write(k_ENTRIES[i], 0, k_ENTRY_LENGTH) ==
+                        i * k_ENTRY_LENGTH);
+        ASSERT_EQ(log.flushAsync(0,
+                                 bdlf::BindUtil::bind(&onFlushed,
+                                                      &lock,
+                                                      &statuses,
+                                                      &durableOffsets,
+                                                      bdlf::PlaceHolders::_1,
+                                                      bdlf::PlaceHolders::_2)),
+                  LogOpResult::e_SUCCESS);
+    }
+    const Offset endOffset = k_NUM_ENTRIES * k_ENTRY_LENGTH;
+
+    // 3. A synchronous flush makes the whole log durable
+    ASSERT_EQ(log.flush(), LogOpResult::e_SUCCESS);
+    ASSERT_EQ(log.durableOffset(), endOffset);
+
+    // 4. Seeking below the durable offset lowers it, until the next flush
+    ASSERT_EQ(log.seek(k_ENTRY_LENGTH), LogOpResult::e_SUCCESS);
+    ASSERT_EQ(log.durableOffset(), k_ENTRY_LENGTH);
+    ASSERT_EQ(log.seek(endOffset), LogOpResult::e_SUCCESS);
+    ASSERT_EQ(log.flush(), LogOpResult::e_SUCCESS);
+    ASSERT_EQ(log.durableOffset(), endOffset);
+
+    // 5. Closing the log invokes all outstanding callbacks
+    BSLS_ASSERT_OPT(log.close() == LogOpResult::e_SUCCESS);
+
+    ASSERT_EQ(statuses.size(), static_cast<size_t>(k_NUM_ENTRIES));
+    for (size_t i = 0; i < statuses.size(); ++i) {
+        ASSERT_EQ_D(i, statuses[i], LogOpResult::e_SUCCESS);
+        ASSERT_GE_D(i,
+                    durableOffsets[i],
+                    static_cast<Offset>((i + 1) * k_ENTRY_LENGTH));
+    }
+    ASSERT_EQ(durableOffsets.back(), endOffset);
+
+    // 6. Flushing a closed log is rejected
+    ASSERT_EQ(log.flushAsync(0,
+                             bdlf::BindUtil::bind(&onFlushed,
+                                                  &lock,
+                                                  &statuses,
+                                                  &durableOffsets,
+                                                  bdlf::PlaceHolders::_1,
+                                                  bdlf::PlaceHolders::_2)),
+              LogOpResult::e_UNSUPPORTED_OPERATION);
+    ASSERT_EQ(statuses.size(), static_cast<size_t>(k_NUM_ENTRIES));
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1030,6 +1128,7 @@ int main(int argc, char* argv[])
         case 10: test10_aliasRaw(); break;
         case 11: test11_aliasBlob(); break;
         case 12: test12_seek(); break;
+        case 13: test13_flushAsync(); break;
         default: {
             cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
             s_testStatus = -1;
@@ -29,8 +29,11 @@
 #include <bdlf_bind.h>
 #include <bdls_filesystemutil.h>
 #include <bsl_algorithm.h>  // for bsl::max, bsl::min
+#include <bsl_cstring.h>
 #include <bsl_limits.h>
 #include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bsls_alignmentutil.h>
 #include <bsls_annotation.h>
 #include <bsls_assert.h>
 
@@ -82,9 +85,9 @@ ReadWriteOnDiskLogFactory::~ReadWriteOnDiskLogFactory()
 bslma::ManagedPtr<mqbsi::Log>
 ReadWriteOnDiskLogFactory::create(const mqbsi::LogConfig& config)
 {
-    bslma::ManagedPtr<mqbsi::Log> log(new (*d_allocator_p)
-                                          ReadWriteOnDiskLog(config),
-                                      d_allocator_p);
+    bslma::ManagedPtr<mqbsi::Log> log(
+        new (*d_allocator_p) ReadWriteOnDiskLog(config, d_allocator_p),
+        d_allocator_p);
     return log;
 }
 
@@ -94,6 +97,10 @@ ReadWriteOnDiskLogFactory::create(const mqbsi::LogConfig& config)
 
 const int mqbsl::ReadWriteOnDiskLog::k_INVALID_FD = -1;
 
+const int mqbsl::ReadWriteOnDiskLog::k_DIRECT_IO_ALIGNMENT = 4096;
+
+const int mqbsl::ReadWriteOnDiskLog::k_DIRECT_IO_BUFFER_SIZE = 256 * 1024;
+
 int ReadWriteOnDiskLog::seekImpl(Offset offset) const
 {
     // PRECONDITIONS
@@ -160,7 +167,222 @@ void ReadWriteOnDiskLog::populateIoVectors(struct iovec*      ioVectors,
     *iovecCount = iovecCnt;
 }
 
-ReadWriteOnDiskLog::ReadWriteOnDiskLog(const mqbsi::LogConfig& config)
+bool ReadWriteOnDiskLog::enableDirectIo()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!d_isDirectIo);
+    BSLS_ASSERT_SAFE(d_fd != k_INVALID_FD);
+
+#if defined(O_DIRECT)
+    // Enable direct I/O only now, so that growing the file when opening it
+    // is not subject to the alignment constraints of direct I/O.
+    const int flags = ::fcntl(d_fd, F_GETFL);
+    if (flags < 0 || ::fcntl(d_fd, F_SETFL, flags | O_DIRECT) != 0) {
+        // Direct I/O is not supported by the underlying file system
+
+        return false;  // RETURN
+    }
+
+    // Layout: [write buffer][scratch block][read buffer], suitably aligned
+    const int size = 2 * k_DIRECT_IO_BUFFER_SIZE + 2 * k_DIRECT_IO_ALIGNMENT;
+    d_directIoMemory_p = static_cast<char*>(d_allocator_p->allocate(size));
+    d_writeBuffer_p    = d_directIoMemory_p +
+                      bsls::AlignmentUtil::calculateAlignmentOffset(
+                          d_directIoMemory_p,
+                          k_DIRECT_IO_ALIGNMENT);
+    d_readBuffer_p = d_writeBuffer_p + k_DIRECT_IO_BUFFER_SIZE +
+                     k_DIRECT_IO_ALIGNMENT;
+    d_isDirectIo   = true;
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+void ReadWriteOnDiskLog::releaseDirectIo()
+{
+    if (d_directIoMemory_p) {
+        d_allocator_p->deallocate(d_directIoMemory_p);
+    }
+
+    d_directIoMemory_p  = 0;
+    d_writeBuffer_p     = 0;
+    d_readBuffer_p      = 0;
+    d_writeBufferOffset = 0;
+    d_isDirectIo        = false;
+}
+
+int ReadWriteOnDiskLog::loadCurrentBlock()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_isDirectIo);
+
+    d_writeBufferOffset = d_currentOffset -
+                          d_currentOffset % k_DIRECT_IO_ALIGNMENT;
+
+    return loadBlock(d_writeBuffer_p, d_writeBufferOffset);
+}
+
+int ReadWriteOnDiskLog::appendToWriteBuffer(int*        position,
+                                            bool*       hasWrapped,
+                                            const char* data,
+                                            int         length)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_isDirectIo);
+    BSLS_ASSERT_SAFE(position);
+    BSLS_ASSERT_SAFE(hasWrapped);
+
+    while (length > 0) {
+        if (*position == k_DIRECT_IO_BUFFER_SIZE) {
+            // Write buffer is full, and therefore block-aligned
+            const ssize_t rc = ::pwrite(d_fd,
+                                        d_writeBuffer_p,
+                                        k_DIRECT_IO_BUFFER_SIZE,
+                                        d_writeBufferOffset);
+            if (rc != k_DIRECT_IO_BUFFER_SIZE) {
+                return LogOpResult::e_BYTE_WRITE_FAILURE;  // RETURN
+            }
+
+            d_writeBufferOffset += k_DIRECT_IO_BUFFER_SIZE;
+            *position   = 0;
+            *hasWrapped = true;
+        }
+
+        const int numBytes = bsl::min(length,
+                                      k_DIRECT_IO_BUFFER_SIZE - *position);
+        bsl::memcpy(d_writeBuffer_p + *position, data, numBytes);
+
+        *position += numBytes;
+        data += numBytes;
+        length -= numBytes;
+    }
+
+    return LogOpResult::e_SUCCESS;
+}
+
+int ReadWriteOnDiskLog::completeDirectWrite(int position, bool hasWrapped)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_isDirectIo);
+    BSLS_ASSERT_SAFE(0 < position && position <= k_DIRECT_IO_BUFFER_SIZE);
+
+    const int tailLength   = position % k_DIRECT_IO_ALIGNMENT;
+    const int lastBlockPos = position - tailLength;
+
+    int rc;
+    if (tailLength != 0 && (lastBlockPos != 0 || hasWrapped)) {
+        // The last block written to is not the one which was loaded in the
+        // write buffer before this write: retrieve its existing content past
+        // the written bytes, so that padding the write does not clobber it.
+        char* scratch = d_writeBuffer_p + k_DIRECT_IO_BUFFER_SIZE;
+        rc            = loadBlock(scratch, d_writeBufferOffset + lastBlockPos);
+        if (rc != LogOpResult::e_SUCCESS) {
+            return rc;  // RETURN
+        }
+
+        bsl::memcpy(d_writeBuffer_p + position,
+                    scratch + tailLength,
+                    k_DIRECT_IO_ALIGNMENT - tailLength);
+    }
+
+    const int writeLength = tailLength == 0
+                                ? position
+                                : lastBlockPos + k_DIRECT_IO_ALIGNMENT;
+    const ssize_t numWritten = ::pwrite(d_fd,
+                                        d_writeBuffer_p,
+                                        writeLength,
+                                        d_writeBufferOffset);
+    if (numWritten != writeLength) {
+        return LogOpResult::e_BYTE_WRITE_FAILURE;  // RETURN
+    }
+
+    // Move the block containing the new write position to the front of the
+    // write buffer.
+    if (tailLength == 0) {
+        d_writeBufferOffset += position;
+        return loadBlock(d_writeBuffer_p, d_writeBufferOffset);  // RETURN
+    }
+
+    if (lastBlockPos != 0) {
+        bsl::memcpy(d_writeBuffer_p,
+                    d_writeBuffer_p + lastBlockPos,
+                    k_DIRECT_IO_ALIGNMENT);
+        d_writeBufferOffset += lastBlockPos;
+    }
+
+    return LogOpResult::e_SUCCESS;
+}
+
+int ReadWriteOnDiskLog::abortDirectWrite(int rc)
+{
+    // The log's internal write position has not moved, so reloading its block
+    // discards whatever was staged.
+    loadCurrentBlock();
+
+    return rc;
+}
+
+int ReadWriteOnDiskLog::loadBlock(char* buffer, Offset offset) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_isDirectIo);
+    BSLS_ASSERT_SAFE(offset % k_DIRECT_IO_ALIGNMENT == 0);
+
+    ssize_t numRead = 0;
+    if (offset < d_totalNumBytes) {
+        numRead = ::pread(d_fd, buffer, k_DIRECT_IO_ALIGNMENT, offset);
+        if (numRead < 0) {
+            return LogOpResult::e_BYTE_READ_FAILURE;  // RETURN
+        }
+    }
+
+    bsl::memset(buffer + numRead, 0, k_DIRECT_IO_ALIGNMENT - numRead);
+
+    return LogOpResult::e_SUCCESS;
+}
+
+int ReadWriteOnDiskLog::directRead(char*  entry,
+                                   int    length,
+                                   Offset offset) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_isDirectIo);
+    BSLS_ASSERT_SAFE(entry);
+
+    while (length > 0) {
+        const Offset blockOffset = offset - offset % k_DIRECT_IO_ALIGNMENT;
+        const int    skip        = static_cast<int>(offset - blockOffset);
+        const int numBytes = bsl::min(length, k_DIRECT_IO_BUFFER_SIZE - skip);
+
+        // Round the read up to a whole number of blocks
+        int readLength = skip + numBytes;
+        if (readLength % k_DIRECT_IO_ALIGNMENT != 0) {
+            readLength += k_DIRECT_IO_ALIGNMENT -
+                          readLength % k_DIRECT_IO_ALIGNMENT;
+        }
+
+        const ssize_t numRead = ::pread(d_fd,
+                                        d_readBuffer_p,
+                                        readLength,
+                                        blockOffset);
+        if (numRead < skip + numBytes) {
+            return LogOpResult::e_BYTE_READ_FAILURE;  // RETURN
+        }
+
+        bsl::memcpy(entry, d_readBuffer_p + skip, numBytes);
+
+        entry += numBytes;
+        offset += numBytes;
+        length -= numBytes;
+    }
+
+    return LogOpResult::e_SUCCESS;
+}
+
+ReadWriteOnDiskLog::ReadWriteOnDiskLog(const mqbsi::LogConfig& config,
+                                       bslma::Allocator*       allocator)
 : d_isOpened(false)
 , d_isReadOnly(false)
 , d_totalNumBytes(0)
@@ -168,13 +390,19 @@ ReadWriteOnDiskLog::ReadWriteOnDiskLog(const mqbsi::LogConfig& config)
 , d_currentOffset(0)
 , d_config(config)
 , d_fd(k_INVALID_FD)
+, d_isDirectIo(false)
+, d_directIoMemory_p(0)
+, d_writeBuffer_p(0)
+, d_readBuffer_p(0)
+, d_writeBufferOffset(0)
+, d_allocator_p(bslma::Default::allocator(allocator))
 {
     // NOTHING
 }
 
 ReadWriteOnDiskLog::~ReadWriteOnDiskLog()
 {
-    // NOTHING
+    releaseDirectIo();
 }
 
 int ReadWriteOnDiskLog::open(int flags)
@@ -223,6 +451,14 @@ int ReadWriteOnDiskLog::open(int flags)
     }
     d_currentOffset = endOffset;
 
+    if (d_config.directIo() && enableDirectIo()) {
+        rc = loadCurrentBlock();
+        if (rc != LogOpResult::e_SUCCESS) {
+            releaseDirectIo();
+            return rc;  // RETURN
+        }
+    }
+
     // POSTCONDITIONS
     BSLS_ASSERT_SAFE(alreadyExists || d_totalNumBytes == 0);
     BSLS_ASSERT_SAFE(d_currentOffset == d_totalNumBytes);
@@ -248,6 +484,8 @@ int ReadWriteOnDiskLog::close()
         }
     }
 
+    releaseDirectIo();
+
     rc = ::close(d_fd);
     if (rc != 0) {
         d_fd = k_INVALID_FD;
@@ -276,6 +514,10 @@ int ReadWriteOnDiskLog::seek(Offset offset)
 
     d_currentOffset = offset;
 
+    if (d_isDirectIo) {
+        return loadCurrentBlock();  // RETURN
+    }
+
     return LogOpResult::e_SUCCESS;
 }
 
@@ -295,6 +537,25 @@ ReadWriteOnDiskLog::write(const void* entry, int offset, int length)
         return LogOpResult::e_REACHED_END_OF_LOG;  // RETURN
     }
 
+    if (d_isDirectIo) {
+        int position = static_cast<int>(d_currentOffset -
+                                        d_writeBufferOffset);
+        bool hasWrapped = false;
+        int  rc = appendToWriteBuffer(&position,
+                                      &hasWrapped,
+                                      static_cast<const char*>(entry) + offset,
+                                      length);
+        if (rc == LogOpResult::e_SUCCESS) {
+            rc = completeDirectWrite(position, hasWrapped);
+        }
+        if (rc != LogOpResult::e_SUCCESS) {
+            return abortDirectWrite(rc);  // RETURN
+        }
+
+        updateInternalState(length);
+        return oldOffset;  // RETURN
+    }
+
     int rc              = LogOpResult::e_UNKNOWN;
     int remainingLength = length;
     do {
@@ -330,6 +591,40 @@ mqbsi::Log::Offset ReadWriteOnDiskLog::write(const bdlbb::Blob&        entry,
         return LogOpResult::e_REACHED_END_OF_LOG;  // RETURN
     }
 
+    if (d_isDirectIo) {
+        int position = static_cast<int>(d_currentOffset -
+                                        d_writeBufferOffset);
+        bool hasWrapped      = false;
+        int  rc              = LogOpResult::e_SUCCESS;
+        int  remainingLength = length;
+        int  bufIndex        = offset.buffer();
+        int  bufOffset       = offset.byte();
+        while (rc == LogOpResult::e_SUCCESS && remainingLength > 0) {
+            BSLS_ASSERT_SAFE(bufIndex < entry.numDataBuffers());
+
+            const int bufSize  = mwcu::BlobUtil::bufferSize(entry, bufIndex);
+            const int numBytes = bsl::min(remainingLength,
+                                          bufSize - bufOffset);
+            rc = appendToWriteBuffer(&position,
+                                     &hasWrapped,
+                                     entry.buffer(bufIndex).data() + bufOffset,
+                                     numBytes);
+
+            ++bufIndex;
+            bufOffset = 0;
+            remainingLength -= numBytes;
+        }
+        if (rc == LogOpResult::e_SUCCESS) {
+            rc = completeDirectWrite(position, hasWrapped);
+        }
+        if (rc != LogOpResult::e_SUCCESS) {
+            return abortDirectWrite(rc);  // RETURN
+        }
+
+        updateInternalState(length);
+        return oldOffset;  // RETURN
+    }
+
     // writev() supports up to IOV_MAX iovecs, so batch it up
     struct iovec ioVectors[IOV_MAX];
 
@@ -401,6 +696,23 @@ int ReadWriteOnDiskLog::flush(BSLS_ANNOTATION_UNUSED Offset offset)
     return LogOpResult::e_SUCCESS;
 }
 
+int ReadWriteOnDiskLog::flushAsync(Offset               offset,
+                                   const FlushCallback& callback)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(offset >= 0);
+    BSLS_ASSERT_SAFE(callback);
+
+    const int rc = flush(offset);
+    if (rc != LogOpResult::e_SUCCESS) {
+        return rc;  // RETURN
+    }
+
+    callback(rc, offset == 0 ? d_currentOffset : offset);
+
+    return LogOpResult::e_SUCCESS;
+}
+
 int ReadWriteOnDiskLog::read(void* entry, int length, Offset offset) const
 {
     // PRECONDITIONS
@@ -411,6 +723,12 @@ int ReadWriteOnDiskLog::read(void* entry, int length, Offset offset) const
         return rc;  // RETURN
     }
 
+    if (d_isDirectIo) {
+        return directRead(static_cast<char*>(entry),
+                          length,
+                          offset);  // RETURN
+    }
+
     int numRead = 0;
     do {
         rc = ::pread(d_fd,
@@ -446,6 +764,28 @@ int ReadWriteOnDiskLog::read(bdlbb::Blob* entry,
         return rc;  // RETURN
     }
 
+    if (d_isDirectIo) {
+        // Ensure blob has enough space for the intended length
+        mwcu::BlobUtil::reserve(entry, length);
+
+        int remainingLength = length;
+        for (int bufIndex = 0; remainingLength > 0; ++bufIndex) {
+            const int numBytes = bsl::min(
+                remainingLength,
+                mwcu::BlobUtil::bufferSize(*entry, bufIndex));
+            rc = directRead(entry->buffer(bufIndex).data(),
+                            numBytes,
+                            offset + (length - remainingLength));
+            if (rc != LogOpResult::e_SUCCESS) {
+                return rc;  // RETURN
+            }
+
+            remainingLength -= numBytes;
+        }
+
+        return LogOpResult::e_SUCCESS;  // RETURN
+    }
+
     rc = seekImpl(offset);
     if (rc != LogOpResult::e_SUCCESS) {
         return 100 * rc + LogOpResult::e_FILE_SEEK_FAILURE;  // RETURN
@@ -34,6 +34,17 @@
 // is a concrete implementation of the 'mqbsi::LogFactory' protocol used to
 // create read-write on-disk logs.
 //
+/// Direct I/O
+///----------
+// If 'mqbsi::LogConfig::directIo()' is true and the underlying file system
+// supports it, the file is accessed with 'O_DIRECT', bypassing the page cache.
+// Direct I/O requires file offsets, lengths and memory addresses to be
+// aligned, so each write is staged in an aligned buffer which also holds the
+// block of the file containing the current write position, and is issued as
+// one 'pwrite' per buffer's worth of data.  Reads go through an aligned bounce
+// buffer.  If direct I/O is not supported, the log silently falls back to
+// buffered I/O.
+//
 /// Thread Safety
 ///-------------
 // This component is *NOT* thread safe.
@@ -109,6 +120,15 @@ class ReadWriteOnDiskLog BSLS_KEYWORD_FINAL : public OnDiskLog {
                                     // file, used as the error return for
                                     // 'open'.
 
+    static const int k_DIRECT_IO_ALIGNMENT;
+    // Alignment, in bytes, of file offsets,
+    // lengths and memory addresses used for
+    // direct I/O.
+
+    static const int k_DIRECT_IO_BUFFER_SIZE;
+    // Size, in bytes, of each aligned buffer
+    // used for direct I/O.
+
   private:
     // DATA
     bool d_isOpened;
@@ -141,6 +161,34 @@ class ReadWriteOnDiskLog BSLS_KEYWORD_FINAL : public OnDiskLog {
     // File descriptor to the underlying file
     // storing the log.
 
+    bool d_isDirectIo;
+    // Whether the underlying file is accessed
+    // with direct I/O.
+
+    char* d_directIoMemory_p;
+    // Memory backing the aligned buffers
+    // below, allocated upon opening the log
+    // in direct I/O mode.
+
+    char* d_writeBuffer_p;
+    // Aligned buffer in which writes are
+    // staged in direct I/O mode, followed by
+    // one block of scratch space.  Between
+    // writes, its first block holds the block
+    // of the log containing
+    // 'd_currentOffset'.
+
+    char* d_readBuffer_p;
+    // Aligned bounce buffer used by reads in
+    // direct I/O mode.
+
+    Offset d_writeBufferOffset;
+    // Offset in the log of the first byte of
+    // 'd_writeBuffer_p'.
+
+    bslma::Allocator* d_allocator_p;
+    // Allocator used to supply memory.
+
   private:
     // NOT IMPLEMENTED
     ReadWriteOnDiskLog(const ReadWriteOnDiskLog&) BSLS_KEYWORD_DELETED;
@@ -179,11 +227,69 @@ class ReadWriteOnDiskLog BSLS_KEYWORD_FINAL : public OnDiskLog {
                            const mwcu::BlobPosition& offset,
                            int                       length);
 
+    /// Switch the underlying file to direct I/O and allocate the aligned
+    /// buffers it requires, if direct I/O is supported.  Return true if
+    /// direct I/O is enabled, and false otherwise.
+    bool enableDirectIo();
+
+    /// Release the aligned buffers used for direct I/O, if any.
+    void releaseDirectIo();
+
+    /// Load into the first block of the write buffer the block of the log
+    /// containing `d_currentOffset`, and return 0 on success, or a
+    /// negative value LogOpResult on error.  The behavior is undefined
+    /// unless the log is in direct I/O mode.
+    int loadCurrentBlock();
+
+    /// Append the specified `length` bytes of the specified `data` to the
+    /// write buffer at the specified `position`, and advance `position`.
+    /// Whenever the write buffer is full, write it to the log and set the
+    /// specified `hasWrapped` to true.  Return 0 on success, or a negative
+    /// value LogOpResult on error.  The behavior is undefined unless the
+    /// log is in direct I/O mode.
+    int appendToWriteBuffer(int*        position,
+                            bool*       hasWrapped,
+                            const char* data,
+                            int         length);
+
+    /// Write the first specified `position` bytes of the write buffer to
+    /// the log, padded to a whole number of blocks while preserving the
+    /// existing content of the log in the padding, and move the block
+    /// containing the new write position to the front of the write buffer.
+    /// The specified `hasWrapped` indicates whether the write buffer was
+    /// written at least once since the start of this write.  Return 0 on
+    /// success, or a negative value LogOpResult on error.  The behavior is
+    /// undefined unless the log is in direct I/O mode.
+    int completeDirectWrite(int position, bool hasWrapped);
+
+    /// Undo any partially completed direct write and restore the invariant
+    /// of the write buffer, then return the specified `rc`.
+    int abortDirectWrite(int rc);
+
+    // PRIVATE ACCESSORS
+
+    /// Load into the specified `buffer` the block of the log starting at
+    /// the specified aligned `offset`, zero-filling any part of the block
+    /// beyond the end of the log, and return 0 on success, or a negative
+    /// value LogOpResult on error.  The behavior is undefined unless the
+    /// log is in direct I/O mode and `buffer` is aligned.
+    int loadBlock(char* buffer, Offset offset) const;
+
+    /// Copy the specified `length` bytes starting at the specified `offset`
+    /// of the log into the specified `entry` using direct I/O, and return 0
+    /// on success, or a negative value LogOpResult on error.  The behavior
+    /// is undefined unless the log is in direct I/O mode and the range is
+    /// within the bounds of the log.
+    int directRead(char* entry, int length, Offset offset) const;
+
   public:
     // CREATORS
 
     /// Create a `mqbsl::ReadWriteOnDiskLog` using the specified `config`.
-    explicit ReadWriteOnDiskLog(const mqbsi::LogConfig& config);
+    /// Optionally specify an `allocator` used to supply memory.  If
+    /// `allocator` is 0, the currently installed default allocator is used.
+    explicit ReadWriteOnDiskLog(const mqbsi::LogConfig& config,
+                                bslma::Allocator*       allocator = 0);
 
     /// Destructor
     ~ReadWriteOnDiskLog() BSLS_KEYWORD_OVERRIDE;
@@ -262,6 +368,15 @@ class ReadWriteOnDiskLog BSLS_KEYWORD_FINAL : public OnDiskLog {
     /// all data is flushed.
     virtual int flush(Offset offset = 0) BSLS_KEYWORD_OVERRIDE;
 
+    /// Flush the data up to the specified `offset` synchronously and invoke
+    /// the specified `callback` before returning.  Return 0 on success, or
+    /// a negative value `mqbsi::LogOpResult` on error, in which case
+    /// `callback` is not invoked.  Note that this log does not support
+    /// asynchronous flushing.
+    virtual int
+    flushAsync(Offset               offset,
+               const FlushCallback& callback) BSLS_KEYWORD_OVERRIDE;
+
     // ACCESSORS
     virtual int
     read(void* entry, int length, Offset offset) const BSLS_KEYWORD_OVERRIDE;
@@ -28,6 +28,7 @@
 #include <bdlbb_pooledblobbufferfactory.h>
 #include <bsl_cstring.h>  // for memcmp
 #include <bsl_limits.h>
+#include <bsl_vector.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
@@ -55,6 +56,7 @@ using namespace bsl;
 // - aliasBlob
 // - seek
 // - readWriteHugeBlob
+// - directIo
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -929,6 +931,140 @@ static void test13_readWriteHugeBlob()
     s_allocator_p->deallocate(entry);
 }
 
+static void test14_directIo()
+// ------------------------------------------------------------------------
+// DIRECT I/O
+//
+// Concerns:
+//   Verify that when direct I/O is requested, entries of arbitrary length
+//   written at unaligned offsets, including entries larger than the
+//   internal aligned buffer and overwrites following a 'seek', are read
+//   back correctly while the log is open and after it is reopened.  Note
+//   that if the file system does not support direct I/O, the log falls
+//   back to buffered I/O and this test still holds.
+//
+// Testing:
+//   write(const void *entry, int offset, int length)
+//   write(const bdlbb::Blob&        entry,
+//         const mwcu::BlobPosition& offset,
+//         int                       length)
+//   read(void *entry, int length, Offset offset)
+//   read(bdlbb::Blob *entry, int length, Offset offset)
+//   seek(Offset offset)
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("DIRECT I/O");
+
+    static const int k_MAX_SIZE       = 2 * 1024 * 1024;  // 2 MiB
+    static const int k_BIG_ENTRY_SIZE = 300 * 1024 + 3;
+    static const int k_OVERWRITE_SIZE = 5000;
+
+    mwcu::TempDirectory tempDir(s_allocator_p);
+    mqbsi::LogConfig    config(k_MAX_SIZE,
+                            k_LOG_KEY,
+                            tempDir.path() + "/test_log.bmq",
+                            false,  // reserveOnDisk
+                            false,  // prefaultPages
+                            s_allocator_p);
+    config.setDirectIo(true);
+
+    bsl::vector<char> expected(s_allocator_p);
+    bsl::vector<char> bigEntry(k_BIG_ENTRY_SIZE, s_allocator_p);
+    generateRandomString(bigEntry.data(), k_BIG_ENTRY_SIZE);
+
+    {
+        ReadWriteOnDiskLog log(config, s_allocator_p);
+        BSLS_ASSERT_OPT(log.open(Log::e_CREATE_IF_MISSING) ==
+                        LogOpResult::e_SUCCESS);
+
+        // 1. Write small raw entries
+        for (int i = 0; i < k_NUM_ENTRIES; ++i) {
+            ASSERT_EQ(log.write(k_ENTRIES[i], 0, k_ENTRY_LENGTH),
+                      static_cast<Offset>(expected.size()));
+            expected.insert(expected.end(),
+                            k_ENTRIES[i],
+                            k_ENTRIES[i] + k_ENTRY_LENGTH);
+        }
+
+        // 2. Write a blob entry larger than the internal aligned buffer
+        bdlbb::Blob bigBlob(g_bufferFactory_p, s_allocator_p);
+        bdlbb::BlobUtil::append(&bigBlob, bigEntry.data(), k_BIG_ENTRY_SIZE);
+        ASSERT_EQ(log.write(bigBlob,
+                            mwcu::BlobPosition(0, 1),
+                            k_BIG_ENTRY_SIZE - 1),
+                  static_cast<Offset>(expected.size()));
+        expected.insert(expected.end(), bigEntry.begin() + 1, bigEntry.end());
+
+        // 3. Write a raw entry at an unaligned offset
+        ASSERT_EQ(log.write(k_LONG_ENTRY, 0, k_LONG_ENTRY_FULL_LENGTH),
+                  static_cast<Offset>(expected.size()));
+        expected.insert(expected.end(),
+                        k_LONG_ENTRY,
+                        k_LONG_ENTRY + k_LONG_ENTRY_FULL_LENGTH);
+
+        const Offset endOffset = static_cast<Offset>(expected.size());
+        ASSERT_EQ(log.totalNumBytes(), endOffset);
+        ASSERT_EQ(log.currentOffset(), endOffset);
+
+        // 4. Overwrite within a single block
+        const int smallOffset = 2 * k_ENTRY_LENGTH + 1;
+        ASSERT_EQ(log.seek(smallOffset), LogOpResult::e_SUCCESS);
+        ASSERT_EQ(log.write(k_LONG_ENTRY, 0, k_LONG_ENTRY_LENGTH),
+                  static_cast<Offset>(smallOffset));
+        bsl::memcpy(expected.data() + smallOffset,
+                    k_LONG_ENTRY,
+                    k_LONG_ENTRY_LENGTH);
+
+        // 5. Overwrite across blocks, ending in the middle of existing data
+        const int bigOffset = 4000;
+        ASSERT_EQ(log.seek(bigOffset), LogOpResult::e_SUCCESS);
+        ASSERT_EQ(log.write(bigEntry.data(), 7, k_OVERWRITE_SIZE),
+                  static_cast<Offset>(bigOffset));
+        bsl::memcpy(expected.data() + bigOffset,
+                    bigEntry.data() + 7,
+                    k_OVERWRITE_SIZE);
+        ASSERT_EQ(log.totalNumBytes(), endOffset);
+
+        // 6. Append after seeking back to the end
+        ASSERT_EQ(log.seek(endOffset), LogOpResult::e_SUCCESS);
+        ASSERT_EQ(log.write(k_LONG_ENTRY2, 0, k_LONG_ENTRY2_FULL_LENGTH),
+                  endOffset);
+        expected.insert(expected.end(),
+                        k_LONG_ENTRY2,
+                        k_LONG_ENTRY2 + k_LONG_ENTRY2_FULL_LENGTH);
+
+        // 7. Read back the whole log, raw and as a blob
+        const int         totalSize = static_cast<int>(expected.size());
+        bsl::vector<char> out(totalSize, s_allocator_p);
+        ASSERT_EQ(log.read(out.data(), totalSize, 0), LogOpResult::e_SUCCESS);
+        ASSERT_EQ(bsl::memcmp(out.data(), expected.data(), totalSize), 0);
+
+        bdlbb::Blob outBlob(g_bufferFactory_p, s_allocator_p);
+        ASSERT_EQ(log.read(&outBlob, totalSize - 3, 3),
+                  LogOpResult::e_SUCCESS);
+        bdlbb::Blob expectedBlob(g_bufferFactory_p, s_allocator_p);
+        bdlbb::BlobUtil::append(&expectedBlob,
+                                expected.data() + 3,
+                                totalSize - 3);
+        ASSERT_EQ(bdlbb::BlobUtil::compare(expectedBlob, outBlob), 0);
+
+        BSLS_ASSERT_OPT(log.flush() == LogOpResult::e_SUCCESS);
+        BSLS_ASSERT_OPT(log.close() == LogOpResult::e_SUCCESS);
+    }
+
+    // 8. Reopen the log and verify its content
+    ReadWriteOnDiskLog log(config, s_allocator_p);
+    BSLS_ASSERT_OPT(log.open(Log::e_READ_ONLY) == LogOpResult::e_SUCCESS);
+    ASSERT_EQ(log.totalNumBytes(), static_cast<Offset>(expected.size()));
+
+    const int         totalSize = static_cast<int>(expected.size());
+    bsl::vector<char> out(totalSize, s_allocator_p);
+    ASSERT_EQ(log.read(out.data(), totalSize, 0), LogOpResult::e_SUCCESS);
+    ASSERT_EQ(bsl::memcmp(out.data(), expected.data(), totalSize), 0);
+
+    BSLS_ASSERT_OPT(log.close() == LogOpResult::e_SUCCESS);
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -960,6 +1096,7 @@ int main(int argc, char* argv[])
         case 11: test11_aliasBlob(); break;
         case 12: test12_seek(); break;
         case 13: test13_readWriteHugeBlob(); break;
+        case 14: test14_directIo(); break;
         default: {
             cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
             s_testStatus = -1;
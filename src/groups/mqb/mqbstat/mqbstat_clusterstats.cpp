@@ -83,6 +83,24 @@ struct ClusterStatsIndex {
         ,
         e_PARTITION_JOURNAL_BYTES
         // Value: Outstanding bytes in the journal file of the partition.
+        ,
+        e_PARTITION_HUGE_PAGE_BYTES
+        // Value: Bytes of the mappings of the data and journal files of the
+        //        partition backed by huge pages.
+        ,
+        e_PARTITION_REPLICATION_BATCH_RECORDS
+        // Value: Number of storage records replicated as one storage event.
+        ,
+        e_PARTITION_QUORUM_TIME
+        // Value: Nanoseconds between the write of a message by the primary
+        //        and the receipt of its replication quorum.
+        ,
+        e_PARTITION_REPLICA_LAG_RECORDS
+        // Value: Records a replica was behind the primary when receipting.
+        ,
+        e_PARTITION_REPLICA_LAG_BYTES
+        // Value: Journal bytes a replica was behind the primary when
+        //        receipting.
     };
 };
 
@@ -205,6 +223,42 @@ bsls::Types::Int64 ClusterStats::getValue(const mwcst::StatContext& context,
         return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
                                                                        : value;
     }
+    case Stat::e_PARTITION_HUGE_PAGE_BYTES: {
+        const bsls::Types::Int64 value =
+            STAT_RANGE(rangeMax, e_PARTITION_HUGE_PAGE_BYTES);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
+                                                                       : value;
+    }
+    case Stat::e_PARTITION_REPLICATION_BATCH_RECORDS_AVG: {
+        const bsls::Types::Int64 avg =
+            STAT_RANGE(averagePerEvent, e_PARTITION_REPLICATION_BATCH_RECORDS);
+        return avg == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : avg;
+    }
+    case Stat::e_PARTITION_REPLICATION_BATCH_RECORDS_MAX: {
+        const bsls::Types::Int64 max =
+            STAT_RANGE(rangeMax, e_PARTITION_REPLICATION_BATCH_RECORDS);
+        return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
+    }
+    case Stat::e_PARTITION_QUORUM_TIME_AVG: {
+        const bsls::Types::Int64 avg = STAT_RANGE(averagePerEvent,
+                                                  e_PARTITION_QUORUM_TIME);
+        return avg == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : avg;
+    }
+    case Stat::e_PARTITION_QUORUM_TIME_MAX: {
+        const bsls::Types::Int64 max = STAT_RANGE(rangeMax,
+                                                  e_PARTITION_QUORUM_TIME);
+        return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
+    }
+    case Stat::e_PARTITION_REPLICA_LAG_RECORDS_MAX: {
+        const bsls::Types::Int64 max =
+            STAT_RANGE(rangeMax, e_PARTITION_REPLICA_LAG_RECORDS);
+        return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
+    }
+    case Stat::e_PARTITION_REPLICA_LAG_BYTES_MAX: {
+        const bsls::Types::Int64 max =
+            STAT_RANGE(rangeMax, e_PARTITION_REPLICA_LAG_BYTES);
+        return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
+    }
 
     default: {
         BSLS_ASSERT_SAFE(false && "Attempting to access an unknown stat");
@@ -277,6 +331,22 @@ void ClusterStats::onPartitionEvent(PartitionEventType::Enum type,
     case PartitionEventType::e_PARTITION_ROLLOVER: {
         sc->reportValue(ClusterStatsIndex::e_PARTITION_ROLLOVER_TIME, value);
     } break;
+    case PartitionEventType::e_PARTITION_REPLICATION_BATCH: {
+        sc->reportValue(
+            ClusterStatsIndex::e_PARTITION_REPLICATION_BATCH_RECORDS,
+            value);
+    } break;
+    case PartitionEventType::e_PARTITION_QUORUM_TIME: {
+        sc->reportValue(ClusterStatsIndex::e_PARTITION_QUORUM_TIME, value);
+    } break;
+    case PartitionEventType::e_PARTITION_REPLICA_LAG_RECORDS: {
+        sc->reportValue(ClusterStatsIndex::e_PARTITION_REPLICA_LAG_RECORDS,
+                        value);
+    } break;
+    case PartitionEventType::e_PARTITION_REPLICA_LAG_BYTES: {
+        sc->reportValue(ClusterStatsIndex::e_PARTITION_REPLICA_LAG_BYTES,
+                        value);
+    } break;
     default: {
         BSLS_ASSERT_SAFE(false && "Unknown event type");
     } break;
@@ -386,6 +456,23 @@ ClusterStats::setPartitionOutstandingBytes(int                partitionId,
     return *this;
 }
 
+ClusterStats&
+ClusterStats::setPartitionHugePageBytes(int                partitionId,
+                                        bsls::Types::Int64 value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(partitionId >= 0 &&
+                     partitionId <
+                         static_cast<int>(d_partitionsStatContexts.size()));
+    BSLS_ASSERT_SAFE(d_partitionsStatContexts[partitionId] &&
+                     "initialize was not called");
+
+    d_partitionsStatContexts[partitionId]->reportValue(
+        ClusterStatsIndex::e_PARTITION_HUGE_PAGE_BYTES,
+        value);
+    return *this;
+}
+
 // -------------------------
 // struct ClusterStats::Role
 // -------------------------
@@ -569,7 +656,15 @@ ClusterStatsUtil::initializeStatContextCluster(int               historySize,
         .value("partition_status")
         .value("partition.rollover_time", mwcst::StatValue::DMCST_DISCRETE)
         .value("partition.data_bytes", mwcst::StatValue::DMCST_DISCRETE)
-        .value("partition.journal_bytes", mwcst::StatValue::DMCST_DISCRETE);
+        .value("partition.journal_bytes", mwcst::StatValue::DMCST_DISCRETE)
+        .value("partition.huge_page_bytes", mwcst::StatValue::DMCST_DISCRETE)
+        .value("partition.replication_batch_records",
+               mwcst::StatValue::DMCST_DISCRETE)
+        .value("partition.quorum_time", mwcst::StatValue::DMCST_DISCRETE)
+        .value("partition.replica_lag_records",
+               mwcst::StatValue::DMCST_DISCRETE)
+        .value("partition.replica_lag_bytes",
+               mwcst::StatValue::DMCST_DISCRETE);
 
     // NOTE: For the clusters, the stat context will have two levels of
     //       children, first level is per cluster, and second level is per
@@ -70,6 +70,21 @@ class ClusterStats {
         enum Enum {
             e_PARTITION_ROLLOVER
             // Time in nanoseconds it took for the rollover operation.
+            ,
+            e_PARTITION_REPLICATION_BATCH
+            // Number of storage records replicated as one storage event.
+            ,
+            e_PARTITION_QUORUM_TIME
+            // Time in nanoseconds between the write of a message by the
+            // primary and the receipt of its replication quorum.
+            ,
+            e_PARTITION_REPLICA_LAG_RECORDS
+            // Number of records written by the primary and not yet receipted
+            // by the replica sending a receipt.
+            ,
+            e_PARTITION_REPLICA_LAG_BYTES
+            // Number of journal bytes written by the primary and not yet
+            // receipted by the replica sending a receipt.
         };
     };
 
@@ -109,6 +124,37 @@ class ClusterStats {
             e_PARTITION_JOURNAL_CONTENT
             // Maximum observed outstanding bytes in the journal file of the
             // partition.
+            ,
+            e_PARTITION_HUGE_PAGE_BYTES
+            // Maximum observed number of bytes of the mappings of the data
+            // and journal files of the partition backed by huge pages.
+            ,
+            e_PARTITION_REPLICATION_BATCH_RECORDS_AVG
+            // Average number of storage records per storage event replicated
+            // by the primary of the partition.
+            ,
+            e_PARTITION_REPLICATION_BATCH_RECORDS_MAX
+            // Maximum number of storage records in a storage event
+            // replicated by the primary of the partition.
+            ,
+            e_PARTITION_QUORUM_TIME_AVG
+            // Average time in nanoseconds between the write of a message by
+            // the primary of the partition and the receipt of its
+            // replication quorum.
+            ,
+            e_PARTITION_QUORUM_TIME_MAX
+            // Maximum time in nanoseconds between the write of a message by
+            // the primary of the partition and the receipt of its
+            // replication quorum.
+            ,
+            e_PARTITION_REPLICA_LAG_RECORDS_MAX
+            // Maximum observed number of records the slowest replica of the
+            // partition was behind the primary when sending a receipt.
+            ,
+            e_PARTITION_REPLICA_LAG_BYTES_MAX
+            // Maximum observed number of journal bytes the slowest replica
+            // of the partition was behind the primary when sending a
+            // receipt.
         };
     };
 
@@ -257,6 +303,12 @@ class ClusterStats {
                                  bsls::Types::Int64 dataBytes,
                                  bsls::Types::Int64 journalBytes);
 
+    /// Set the number of bytes of the mappings of the data and journal
+    /// files of the specified `partitionId` which are backed by huge pages
+    /// to the specified `value`.
+    ClusterStats& setPartitionHugePageBytes(int                partitionId,
+                                            bsls::Types::Int64 value);
+
     /// Return a pointer to the statcontext.
     mwcst::StatContext* statContext();
 };
@@ -0,0 +1,266 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbstat_dispatcherstats.cpp                                        -*-C++-*-
+#include <mqbstat_dispatcherstats.h>
+
+#include <mqbscm_version.h>
+// MWC
+#include <mwcst_statutil.h>
+#include <mwcst_statvalue.h>
+#include <mwcst_tablerecords.h>
+#include <mwcst_tableschema.h>
+#include <mwcu_memoutstream.h>
+
+// BDE
+#include <bdlma_localsequentialallocator.h>
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+
+namespace BloombergLP {
+namespace mqbstat {
+
+namespace {
+
+/// Name of the stat context to create (holding all dispatcher's statistics)
+static const char k_DISPATCHER_STAT_NAME[] = "dispatcher";
+
+/// Number of types of dispatcher events.
+const int k_NUM_EVENT_TYPES =
+    mqbi::DispatcherEventType::e_REPLICATION_RECEIPT + 1;
+
+//----------------------------
+// struct DispatcherStatsIndex
+//----------------------------
+
+/// Namespace for the constants of stat values that applies to the
+/// processors of the dispatcher
+struct DispatcherStatsIndex {
+    enum Enum {
+        /// Time spent processing an event, in nanoseconds
+        e_STAT_PROCESSING_TIME,
+        /// Time an event waited in the queue of the processor, in
+        /// nanoseconds
+        e_STAT_QUEUE_TIME,
+        /// Flushes of the clients of the processor
+        e_STAT_FLUSH
+    };
+};
+
+/// Filter for the table printing the dispatcher stats, keeping only the
+/// totals of each stat context.
+bool filterDirect(const mwcst::TableRecords::Record& record)
+{
+    return record.type() == mwcst::StatContext::DMCST_TOTAL_VALUE;
+}
+
+}  // close unnamed namespace
+
+// ---------------------
+// class DispatcherStats
+// ---------------------
+
+DispatcherStats::DispatcherStats(bslma::Allocator* allocator)
+: d_statContext_mp(0)
+, d_eventTypesStatContexts(k_NUM_EVENT_TYPES, allocator)
+, d_allocator_p(allocator)
+{
+    // NOTHING
+}
+
+mwcst::StatContext* DispatcherStats::createEventTypeStatContext(
+    mqbi::DispatcherEventType::Enum type)
+{
+    bdlma::LocalSequentialAllocator<1024> localAllocator(d_allocator_p);
+
+    d_eventTypesStatContexts[type] = StatContextSp(
+        d_statContext_mp->addSubcontext(mwcst::StatContextConfiguration(
+            mqbi::DispatcherEventType::toAscii(type),
+            &localAllocator)));
+
+    return d_eventTypesStatContexts[type].get();
+}
+
+void DispatcherStats::initialize(mqbi::DispatcherClientType::Enum type,
+                                 int                              processorId,
+                                 mwcst::StatContext* dispatcherStatContext)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!d_statContext_mp && "initialize was already called");
+
+    bdlma::LocalSequentialAllocator<1024> localAllocator(d_allocator_p);
+
+    mwcu::MemOutStream name(&localAllocator);
+    name << mqbi::DispatcherClientType::toAscii(type) << "-" << processorId;
+
+    d_statContext_mp = dispatcherStatContext->addSubcontext(
+        mwcst::StatContextConfiguration(name.str(), &localAllocator));
+}
+
+void DispatcherStats::onEvent(mqbi::DispatcherEventType::Enum type,
+                              bsls::Types::Int64              processingTime)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_statContext_mp && "initialize was not called");
+    BSLS_ASSERT_SAFE(0 <= type && type < k_NUM_EVENT_TYPES);
+
+    mwcst::StatContext* context = d_eventTypesStatContexts[type].get();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!context)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        context = createEventTypeStatContext(type);
+    }
+
+    context->reportValue(DispatcherStatsIndex::e_STAT_PROCESSING_TIME,
+                         processingTime);
+}
+
+void DispatcherStats::onQueueTime(bsls::Types::Int64 queueTime)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_statContext_mp && "initialize was not called");
+
+    d_statContext_mp->reportValue(DispatcherStatsIndex::e_STAT_QUEUE_TIME,
+                                  queueTime);
+}
+
+void DispatcherStats::onFlush()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_statContext_mp && "initialize was not called");
+
+    d_statContext_mp->adjustValue(DispatcherStatsIndex::e_STAT_FLUSH, 1);
+}
+
+// --------------------------
+// struct DispatcherStatsUtil
+// --------------------------
+
+bsl::shared_ptr<mwcst::StatContext>
+DispatcherStatsUtil::initializeStatContext(int               historySize,
+                                           bslma::Allocator* allocator)
+{
+    bdlma::LocalSequentialAllocator<2048> localAllocator(allocator);
+
+    mwcst::StatContextConfiguration config(k_DISPATCHER_STAT_NAME,
+                                           &localAllocator);
+    config.isTable(true)
+        .defaultHistorySize(historySize)
+        .statValueAllocator(allocator)
+        .storeExpiredSubcontextValues(true)
+        .value("processing_time", mwcst::StatValue::DMCST_HISTOGRAM)
+        .value("queue_time", mwcst::StatValue::DMCST_DISCRETE)
+        .value("flush");
+
+    return bsl::shared_ptr<mwcst::StatContext>(
+        new (*allocator) mwcst::StatContext(config, allocator),
+        allocator);
+}
+
+void DispatcherStatsUtil::initializeTableAndTip(
+    mwcst::Table*                 table,
+    mwcu::BasicTableInfoProvider* tip,
+    int                           historySize,
+    mwcst::StatContext*           statContext)
+{
+    // Use only one level for now ...
+    mwcst::StatValue::SnapshotLocation start(0, 0);
+    mwcst::StatValue::SnapshotLocation end(0, historySize - 1);
+
+    // Create table
+    mwcst::TableSchema& schema = table->schema();
+
+    schema.addDefaultIdColumn("id");
+
+    schema.addColumn("events_delta",
+                     DispatcherStatsIndex::e_STAT_PROCESSING_TIME,
+                     mwcst::StatUtil::eventsDifference,
+                     start,
+                     end);
+    schema.addColumn("processing_time_avg",
+                     DispatcherStatsIndex::e_STAT_PROCESSING_TIME,
+                     mwcst::StatUtil::averagePerEvent,
+                     start,
+                     end);
+    schema.addColumn("processing_time_max",
+                     DispatcherStatsIndex::e_STAT_PROCESSING_TIME,
+                     mwcst::StatUtil::rangeMax,
+                     start,
+                     end);
+    // Only the distribution of the last snapshot is kept (see
+    // 'mwcst::StatValue').
+    schema.addColumn("processing_time_p99",
+                     DispatcherStatsIndex::e_STAT_PROCESSING_TIME,
+                     mwcst::StatUtil::percentile99,
+                     start);
+
+    schema.addColumn("queue_time_avg",
+                     DispatcherStatsIndex::e_STAT_QUEUE_TIME,
+                     mwcst::StatUtil::averagePerEvent,
+                     start,
+                     end);
+    schema.addColumn("queue_time_max",
+                     DispatcherStatsIndex::e_STAT_QUEUE_TIME,
+                     mwcst::StatUtil::rangeMax,
+                     start,
+                     end);
+
+    schema.addColumn("flush_delta",
+                     DispatcherStatsIndex::e_STAT_FLUSH,
+                     mwcst::StatUtil::incrementsDifference,
+                     start,
+                     end);
+
+    // Configure records
+    mwcst::TableRecords& records = table->records();
+    records.setContext(statContext);
+    records.setFilter(&filterDirect);
+
+    // Create the tip
+    tip->setTable(table);
+    tip->setColumnGroup("");
+    tip->addColumn("id", "").justifyLeft();
+
+    tip->setColumnGroup("Events");
+    tip->addColumn("events_delta", "events (d)").zeroString("");
+
+    tip->setColumnGroup("Processing Time");
+    tip->addColumn("processing_time_avg", "avg")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("processing_time_max", "max")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("processing_time_p99", "p99 (last)")
+        .zeroString("")
+        .printAsNsTimeInterval();
+
+    tip->setColumnGroup("Queue Time");
+    tip->addColumn("queue_time_avg", "avg")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("queue_time_max", "max")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+
+    tip->setColumnGroup("Flush");
+    tip->addColumn("flush_delta", "flushes (d)").zeroString("");
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,180 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbstat_dispatcherstats.h                                          -*-C++-*-
+#ifndef INCLUDED_MQBSTAT_DISPATCHERSTATS
+#define INCLUDED_MQBSTAT_DISPATCHERSTATS
+
+//@PURPOSE: Provide mechanism to keep track of Dispatcher statistics.
+//
+//@CLASSES:
+//  mqbstat::DispatcherStats:     Mechanism to maintain stats of a processor
+//  mqbstat::DispatcherStatsUtil: Utilities to initialize statistics
+//
+//@DESCRIPTION: 'mqbstat::DispatcherStats' provides a mechanism to keep track
+// of the statistics of a processor of the dispatcher: the number of events it
+// processed and the distribution of the time it spent processing them, per
+// type of event, the time the events waited in its queue, and the number of
+// times it flushed its clients.  'mqbstat::DispatcherStatsUtil' is a utility
+// namespace exposing methods to initialize the stat contexts and the table
+// printing them.
+//
+// Each processor has a subcontext of the dispatcher stat context, itself
+// having a subcontext for each type of event the processor processed, created
+// when the processor processes the first event of that type, so that the
+// distributions of the processing times, which are large, are only kept for
+// the types of events each processor actually processes.  The totals of the
+// subcontext of a processor are those of all the events it processed.
+//
+/// Thread Safety
+///-------------
+// The manipulators of 'mqbstat::DispatcherStats' must only be invoked from
+// the thread of its processor.
+
+// MQB
+#include <mqbi_dispatcher.h>
+
+// MWC
+#include <mwcst_basictableinfoprovider.h>
+#include <mwcst_statcontext.h>
+#include <mwcst_table.h>
+
+// BDE
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_managedptr.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_cpp11.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mqbstat {
+
+// =====================
+// class DispatcherStats
+// =====================
+
+/// Mechanism to keep track of the statistics of a processor of the
+/// dispatcher.
+class DispatcherStats {
+  private:
+    // PRIVATE TYPES
+    typedef bsl::shared_ptr<mwcst::StatContext> StatContextSp;
+
+    // DATA
+    bslma::ManagedPtr<mwcst::StatContext> d_statContext_mp;
+    // StatContext of the processor
+
+    bsl::vector<StatContextSp> d_eventTypesStatContexts;
+    // StatContext of each type of event,
+    // indexed by type, or null if no event
+    // of that type was processed yet
+
+    bslma::Allocator* d_allocator_p;
+    // Allocator to use
+
+  private:
+    // NOT IMPLEMENTED
+    DispatcherStats(const DispatcherStats&) BSLS_CPP11_DELETED;
+
+    /// Copy constructor and assignment operator are not implemented.
+    DispatcherStats& operator=(const DispatcherStats&) BSLS_CPP11_DELETED;
+
+    // PRIVATE MANIPULATORS
+
+    /// Create and return the stat context of the events of the specified
+    /// `type`.
+    mwcst::StatContext*
+    createEventTypeStatContext(mqbi::DispatcherEventType::Enum type);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(DispatcherStats, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a new object in an uninitialized state, using the specified
+    /// `allocator`.
+    explicit DispatcherStats(bslma::Allocator* allocator);
+
+    // MANIPULATORS
+
+    /// Initialize this object for the processor having the specified
+    /// `processorId` of clients of the specified `type`, registering its
+    /// subcontext to the specified `dispatcherStatContext`.  This method
+    /// ought to be called exactly once.
+    void initialize(mqbi::DispatcherClientType::Enum type,
+                    int                              processorId,
+                    mwcst::StatContext*              dispatcherStatContext);
+
+    /// Update statistics for an event of the specified `type` which took
+    /// the specified `processingTime` (in nanoseconds) to be processed.
+    void onEvent(mqbi::DispatcherEventType::Enum type,
+                 bsls::Types::Int64              processingTime);
+
+    /// Update statistics for an event which waited the specified
+    /// `queueTime` (in nanoseconds) in the queue of the processor before
+    /// being processed.
+    void onQueueTime(bsls::Types::Int64 queueTime);
+
+    /// Update statistics for a flush of the clients of the processor.
+    void onFlush();
+
+    /// Return a pointer to the stat context of the processor.
+    mwcst::StatContext* statContext();
+};
+
+// ==========================
+// struct DispatcherStatsUtil
+// ==========================
+
+/// Utility namespace of methods to initialize dispatcher stats.
+struct DispatcherStatsUtil {
+    // CLASS METHODS
+
+    /// Initialize the statistics for the dispatcher stat context, keeping
+    /// the specified `historySize` of history.  Return the created top
+    /// level stat context to use for all dispatcher level statistics.  Use
+    /// the specified `allocator` for all stat context and stat values.
+    static bsl::shared_ptr<mwcst::StatContext>
+    initializeStatContext(int historySize, bslma::Allocator* allocator);
+
+    /// Load into the specified `table` and `tip` the objects to print the
+    /// specified `statContext` for the specified `historySize`.
+    static void initializeTableAndTip(mwcst::Table*                 table,
+                                      mwcu::BasicTableInfoProvider* tip,
+                                      int                 historySize,
+                                      mwcst::StatContext* statContext);
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ---------------------
+// class DispatcherStats
+// ---------------------
+
+inline mwcst::StatContext* DispatcherStats::statContext()
+{
+    return d_statContext_mp.get();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -19,6 +19,7 @@
 #include <mqbscm_version.h>
 // MQB
 #include <mqbscm_versiontag.h>
+#include <mqbstat_dispatcherstats.h>
 #include <mqbstat_queuestats.h>
 
 // MWC
@@ -103,6 +104,12 @@ void Printer::initializeTablesAndTips()
                                                  historySize,
                                                  context->d_statContext_p);
 
+    context = d_contexts["dispatcher"].get();
+    DispatcherStatsUtil::initializeTableAndTip(&context->d_table,
+                                               &context->d_tip,
+                                               historySize,
+                                               context->d_statContext_p);
+
     context = d_contexts["channels"].get();
     mwcst::StatValue::SnapshotLocation start(0, 0);
     mwcst::StatValue::SnapshotLocation end(0, historySize - 1);
@@ -237,6 +244,13 @@ void Printer::printStats(bsl::ostream& stream)
     context->d_table.records().update();
     mwcu::TableUtil::printTable(stream, context->d_tip);
 
+    // DISPATCHER
+    stream << "\n"
+           << ":::::::::: :::::::::: DISPATCHER >>";
+    context = d_contexts["dispatcher"].get();
+    context->d_table.records().update();
+    mwcu::TableUtil::printTable(stream, context->d_tip);
+
     // CHANNELS
     stream << "\n"
            << ":::::::::: :::::::::: TCP CHANNELS >>";
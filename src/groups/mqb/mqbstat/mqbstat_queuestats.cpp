@@ -52,6 +52,12 @@ static const char k_DOMAIN_STAT_NAME[] = "domain";
 /// statistics)
 static const char k_CLIENT_STAT_NAME[] = "client";
 
+/// Number of writer shards of the values of the stat context of each queue
+/// in a domain.  These values are updated from the queue dispatcher thread,
+/// the client sessions threads and the cluster thread; each shard occupies
+/// one cache line per value.
+static const int k_DOMAIN_QUEUE_NUM_WRITER_SHARDS = 4;
+
 // -----------------------
 // struct DomainQueueStats
 // -----------------------
@@ -108,6 +114,23 @@ struct DomainQueueStats {
         // Value:      The time spent by the message in the queue (in
         //             nanoseconds).
 
+        ,
+        e_STAT_TRACE_DISPATCH_TIME
+        // Value:      For sampled PUT messages, the time between the post
+        //             by the session and the processing by the queue
+        //             dispatcher thread (in nanoseconds).
+
+        ,
+        e_STAT_TRACE_STORAGE_TIME
+        // Value:      For sampled PUT messages, the time spent writing the
+        //             message to the storage (in nanoseconds).
+
+        ,
+        e_STAT_TRACE_REPLICATION_TIME
+        // Value:      For sampled PUT messages, the time between the write
+        //             to the storage and the receipt of the replication
+        //             quorum (in nanoseconds).
+
         ,
         e_STAT_PUSH
         // Value:      Accumulated bytes of all messages ever pushed from
@@ -170,6 +193,11 @@ struct ClientStats {
         // Value:      Accumulated bytes of all messages ever received from
         //             the client
         // Increments: Number of messages ever received from the client
+
+        ,
+        e_STAT_PUSH_EVENT
+        // Value:      Number of messages of each PUSH event sent to the
+        //             client (reported to the client-level context only)
     };
 };
 
@@ -275,6 +303,40 @@ QueueStatsDomain::getValue(const mwcst::StatContext& context,
             STAT_RANGE(rangeMax, DomainQueueStats::e_STAT_QUEUE_TIME);
         return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
     }
+    case QueueStatsDomain::Stat::e_TRACE_DISPATCH_TIME_AVG: {
+        const bsls::Types::Int64 avg = STAT_RANGE(
+            averagePerEvent,
+            DomainQueueStats::e_STAT_TRACE_DISPATCH_TIME);
+        return avg == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : avg;
+    }
+    case QueueStatsDomain::Stat::e_TRACE_DISPATCH_TIME_MAX: {
+        const bsls::Types::Int64 max =
+            STAT_RANGE(rangeMax, DomainQueueStats::e_STAT_TRACE_DISPATCH_TIME);
+        return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
+    }
+    case QueueStatsDomain::Stat::e_TRACE_STORAGE_TIME_AVG: {
+        const bsls::Types::Int64 avg = STAT_RANGE(
+            averagePerEvent,
+            DomainQueueStats::e_STAT_TRACE_STORAGE_TIME);
+        return avg == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : avg;
+    }
+    case QueueStatsDomain::Stat::e_TRACE_STORAGE_TIME_MAX: {
+        const bsls::Types::Int64 max =
+            STAT_RANGE(rangeMax, DomainQueueStats::e_STAT_TRACE_STORAGE_TIME);
+        return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
+    }
+    case QueueStatsDomain::Stat::e_TRACE_REPLICATION_TIME_AVG: {
+        const bsls::Types::Int64 avg = STAT_RANGE(
+            averagePerEvent,
+            DomainQueueStats::e_STAT_TRACE_REPLICATION_TIME);
+        return avg == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : avg;
+    }
+    case QueueStatsDomain::Stat::e_TRACE_REPLICATION_TIME_MAX: {
+        const bsls::Types::Int64 max = STAT_RANGE(
+            rangeMax,
+            DomainQueueStats::e_STAT_TRACE_REPLICATION_TIME);
+        return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
+    }
     case QueueStatsDomain::Stat::e_GC_MSGS_ABS: {
         return STAT_SINGLE(value, DomainQueueStats::e_STAT_GC_MSGS);
     }
@@ -354,7 +416,8 @@ void QueueStatsDomain::initialize(const bmqt::Uri&  uri,
     bdlma::LocalSequentialAllocator<2048> localAllocator(allocator);
 
     d_statContext_mp = domain->queueStatContext()->addSubcontext(
-        mwcst::StatContextConfiguration(uri.canonical(), &localAllocator));
+        mwcst::StatContextConfiguration(uri.canonical(), &localAllocator)
+            .numWriterShards(k_DOMAIN_QUEUE_NUM_WRITER_SHARDS));
 
     // Initialize the role to 'unknown'; once the 'mqbblp::Queue' is
     // configured, the role will be accordingly set
@@ -436,6 +499,21 @@ void QueueStatsDomain::onEvent(EventType::Enum type, bsls::Types::Int64 value)
         d_statContext_mp->reportValue(DomainQueueStats::e_STAT_QUEUE_TIME,
                                       value);
     } break;
+    case EventType::e_TRACE_DISPATCH_TIME: {
+        d_statContext_mp->reportValue(
+            DomainQueueStats::e_STAT_TRACE_DISPATCH_TIME,
+            value);
+    } break;
+    case EventType::e_TRACE_STORAGE_TIME: {
+        d_statContext_mp->reportValue(
+            DomainQueueStats::e_STAT_TRACE_STORAGE_TIME,
+            value);
+    } break;
+    case EventType::e_TRACE_REPLICATION_TIME: {
+        d_statContext_mp->reportValue(
+            DomainQueueStats::e_STAT_TRACE_REPLICATION_TIME,
+            value);
+    } break;
     case EventType::e_PUSH: {
         d_statContext_mp->adjustValue(DomainQueueStats::e_STAT_PUSH, value);
     } break;
@@ -595,6 +673,16 @@ QueueStatsClient::getValue(const mwcst::StatContext& context,
 #undef STAT_SINGLE
 }
 
+void QueueStatsClient::onPushEvent(mwcst::StatContext* clientStatContext,
+                                   int                 numMessages)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(clientStatContext);
+
+    clientStatContext->reportValue(ClientStats::e_STAT_PUSH_EVENT,
+                                   numMessages);
+}
+
 QueueStatsClient::QueueStatsClient()
 : d_statContext_mp(0)
 {
@@ -657,6 +745,7 @@ QueueStatsUtil::initializeStatContextDomains(int               historySize,
         .defaultHistorySize(historySize)
         .statValueAllocator(allocator)
         .storeExpiredSubcontextValues(true)
+        .incrementalSnapshot(true)
         .value("nb_producer")
         .value("nb_consumer")
         .value("messages")
@@ -668,6 +757,9 @@ QueueStatsUtil::initializeStatContextDomains(int               historySize,
         .value("confirm_time", mwcst::StatValue::DMCST_DISCRETE)
         .value("reject")
         .value("queue_time", mwcst::StatValue::DMCST_DISCRETE)
+        .value("trace_dispatch_time", mwcst::StatValue::DMCST_DISCRETE)
+        .value("trace_storage_time", mwcst::StatValue::DMCST_DISCRETE)
+        .value("trace_replication_time", mwcst::StatValue::DMCST_DISCRETE)
         .value("gc")
         .value("push")
         .value("put")
@@ -697,10 +789,12 @@ QueueStatsUtil::initializeStatContextClients(int               historySize,
         .defaultHistorySize(historySize)
         .statValueAllocator(allocator)
         .storeExpiredSubcontextValues(true)
+        .incrementalSnapshot(true)
         .value("ack")
         .value("confirm")
         .value("push")
-        .value("put");
+        .value("put")
+        .value("push_event", mwcst::StatValue::DMCST_DISCRETE);
     // NOTE: If the stats are using too much memory, we could reconsider
     //       in_event and out_event to be using atomic int and not stat value.
 
@@ -844,6 +938,36 @@ void QueueStatsUtil::initializeTableAndTipDomains(
                      mwcst::StatUtil::rangeMax,
                      start,
                      end);
+    schema.addColumn("trace_dispatch_time_avg",
+                     DomainQueueStats::e_STAT_TRACE_DISPATCH_TIME,
+                     mwcst::StatUtil::averagePerEvent,
+                     start,
+                     end);
+    schema.addColumn("trace_dispatch_time_max",
+                     DomainQueueStats::e_STAT_TRACE_DISPATCH_TIME,
+                     mwcst::StatUtil::rangeMax,
+                     start,
+                     end);
+    schema.addColumn("trace_storage_time_avg",
+                     DomainQueueStats::e_STAT_TRACE_STORAGE_TIME,
+                     mwcst::StatUtil::averagePerEvent,
+                     start,
+                     end);
+    schema.addColumn("trace_storage_time_max",
+                     DomainQueueStats::e_STAT_TRACE_STORAGE_TIME,
+                     mwcst::StatUtil::rangeMax,
+                     start,
+                     end);
+    schema.addColumn("trace_replication_time_avg",
+                     DomainQueueStats::e_STAT_TRACE_REPLICATION_TIME,
+                     mwcst::StatUtil::averagePerEvent,
+                     start,
+                     end);
+    schema.addColumn("trace_replication_time_max",
+                     DomainQueueStats::e_STAT_TRACE_REPLICATION_TIME,
+                     mwcst::StatUtil::rangeMax,
+                     start,
+                     end);
     schema.addColumn("gc_msgs_delta",
                      DomainQueueStats::e_STAT_GC_MSGS,
                      mwcst::StatUtil::valueDifference,
@@ -907,6 +1031,32 @@ void QueueStatsUtil::initializeTableAndTipDomains(
         .extremeValueString("")
         .printAsNsTimeInterval();
 
+    tip->setColumnGroup("Put Trace");
+    tip->addColumn("trace_dispatch_time_avg", "dispatch avg")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("trace_dispatch_time_max", "dispatch max")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("trace_storage_time_avg", "storage avg")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("trace_storage_time_max", "storage max")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("trace_replication_time_avg", "repl avg")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("trace_replication_time_max", "repl max")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+
     tip->setColumnGroup("Ack");
     tip->addColumn("ack_delta", "delta").zeroString("");
     tip->addColumn("ack_abs", "abs").zeroString("");
@@ -1015,6 +1165,17 @@ void QueueStatsUtil::initializeTableAndTipClients(
                      mwcst::StatUtil::increments,
                      start);
 
+    schema.addColumn("push_event_avg",
+                     ClientStats::e_STAT_PUSH_EVENT,
+                     mwcst::StatUtil::averagePerEvent,
+                     start,
+                     end);
+    schema.addColumn("push_event_max",
+                     ClientStats::e_STAT_PUSH_EVENT,
+                     mwcst::StatUtil::rangeMax,
+                     start,
+                     end);
+
     // Configure records
     mwcst::TableRecords& records = table->records();
     records.setContext(statContext);
@@ -1048,6 +1209,14 @@ void QueueStatsUtil::initializeTableAndTipClients(
     tip->setColumnGroup("Ack");
     tip->addColumn("ack_delta", "events (d)").zeroString("");
     tip->addColumn("ack_abs", "events").zeroString("");
+
+    tip->setColumnGroup("Push Batch");
+    tip->addColumn("push_event_avg", "messages avg")
+        .zeroString("")
+        .extremeValueString("");
+    tip->addColumn("push_event_max", "messages max")
+        .zeroString("")
+        .extremeValueString("");
 }
 
 }  // close package namespace
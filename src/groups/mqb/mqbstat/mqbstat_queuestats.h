@@ -88,6 +88,9 @@ class QueueStatsDomain {
             e_CONFIRM_TIME,
             e_REJECT,
             e_QUEUE_TIME,
+            e_TRACE_DISPATCH_TIME,
+            e_TRACE_STORAGE_TIME,
+            e_TRACE_REPLICATION_TIME,
             e_PURGE,
             e_CHANGE_ROLE,
             e_CFG_MSGS,
@@ -129,6 +132,12 @@ class QueueStatsDomain {
             e_REJECT_DELTA,
             e_QUEUE_TIME_AVG,
             e_QUEUE_TIME_MAX,
+            e_TRACE_DISPATCH_TIME_AVG,
+            e_TRACE_DISPATCH_TIME_MAX,
+            e_TRACE_STORAGE_TIME_AVG,
+            e_TRACE_STORAGE_TIME_MAX,
+            e_TRACE_REPLICATION_TIME_AVG,
+            e_TRACE_REPLICATION_TIME_MAX,
             e_GC_MSGS_DELTA,
             e_GC_MSGS_ABS,
             e_ROLE,
@@ -223,7 +232,9 @@ class QueueStatsDomain {
 
     /// Update statistics for the event of the specified `type` and with the
     /// specified `value` (depending on the `type`, `value` can represent
-    /// the number of bytes, a counter, ...
+    /// the number of bytes, a counter, ...  This method can be called from
+    /// any thread: the updates are spread over writer shards local to the
+    /// calling thread, and merged when the stats are snapshot.
     void onEvent(EventType::Enum type, bsls::Types::Int64 value);
 
     /// Force set the stats of the content of the queue to the specified
@@ -311,6 +322,13 @@ class QueueStatsClient {
                                        int                       snapshotId,
                                        const Stat::Enum&         stat);
 
+    /// Update the statistics of the specified `clientStatContext` (the
+    /// client-level stat context, parent of the stat contexts of the queues
+    /// of the client) for a PUSH event of the specified `numMessages`
+    /// messages sent to the client.
+    static void onPushEvent(mwcst::StatContext* clientStatContext,
+                            int                 numMessages);
+
     // CREATORS
 
     /// Create a new object in an uninitialized state.
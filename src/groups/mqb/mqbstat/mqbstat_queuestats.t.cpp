@@ -304,6 +304,16 @@ static void test3_queueStatsDomain()
     queueStatsDomain.onEvent(QueueStatsDomain::EventType::e_PUT, 11);
     queueStatsDomain.onEvent(QueueStatsDomain::EventType::e_PUT, 12);
 
+    // 2 sampled puts : dispatch and storage times
+    queueStatsDomain.onEvent(
+        QueueStatsDomain::EventType::e_TRACE_DISPATCH_TIME,
+        10);
+    queueStatsDomain.onEvent(
+        QueueStatsDomain::EventType::e_TRACE_DISPATCH_TIME,
+        30);
+    queueStatsDomain.onEvent(QueueStatsDomain::EventType::e_TRACE_STORAGE_TIME,
+                             5);
+
     // 1 add message : 15 bytes
     queueStatsDomain.onEvent(QueueStatsDomain::EventType::e_ADD_MESSAGE, 15);
     domain->snapshot();
@@ -328,6 +338,11 @@ static void test3_queueStatsDomain()
     ASSERT_EQ_DOMAINSTAT(e_PUT_MESSAGES_DELTA, 1, 3);
     ASSERT_EQ_DOMAINSTAT(e_PUT_BYTES_DELTA, 1, 33);
 
+    ASSERT_EQ_DOMAINSTAT(e_TRACE_DISPATCH_TIME_AVG, 1, 20);
+    ASSERT_EQ_DOMAINSTAT(e_TRACE_DISPATCH_TIME_MAX, 1, 30);
+    ASSERT_EQ_DOMAINSTAT(e_TRACE_STORAGE_TIME_AVG, 1, 5);
+    ASSERT_EQ_DOMAINSTAT(e_TRACE_REPLICATION_TIME_AVG, 1, 0);
+
     // *SNAPSHOT 2*
     // add 3 consumers, close 1 producer
     bmqt::QueueFlags::Enum consumer;
@@ -28,12 +28,14 @@
 #include <mqbscm_versiontag.h>
 #include <mqbstat_brokerstats.h>
 #include <mqbstat_clusterstats.h>
+#include <mqbstat_dispatcherstats.h>
 #include <mqbstat_domainstats.h>
 #include <mqbstat_queuestats.h>
 
 // MWC
 #include <mwcio_statchannelfactory.h>
 #include <mwcst_statcontext.h>
+#include <mwcst_statsnapshotbuffer.h>
 #include <mwcst_statvalue.h>
 #include <mwcsys_threadutil.h>
 #include <mwcsys_time.h>
@@ -53,11 +55,13 @@
 #include <bdlf_bind.h>
 #include <bdlf_placeholder.h>
 #include <bdlmt_eventscheduler.h>
+#include <bdlmt_fixedthreadpool.h>
 #include <bdlt_timeunitratio.h>
 #include <bsl_algorithm.h>
 #include <bsl_ctime.h>
 #include <bsl_iostream.h>
 #include <bslma_allocator.h>
+#include <bslmt_latch.h>
 #include <bslmt_semaphore.h>
 #include <bslmt_threadutil.h>
 #include <bsls_performancehint.h>
@@ -75,6 +79,14 @@ const char k_PUBLISHINTERVAL_SUFFIX[] = ".PUBLISHINTERVAL";
 
 typedef bsl::unordered_set<mqbplug::PluginFactory*> PluginFactories;
 
+/// Number of threads snapshotting the root stat contexts in parallel with
+/// the stat scheduler thread.
+const int k_SNAPSHOT_NUM_THREADS = 3;
+
+/// Maximum number of snapshot buffers waiting to be published: when the
+/// publication thread lags behind by more than this, snapshots are dropped.
+const int k_PUBLICATION_MAX_PENDING = 2;
+
 /// Post on the optionally specified `semaphore`.
 void optionalSemaphorePost(bslmt::Semaphore* semaphore)
 {
@@ -83,6 +95,13 @@ void optionalSemaphorePost(bslmt::Semaphore* semaphore)
     }
 }
 
+/// Snapshot the specified `statContext` and arrive on the specified `latch`.
+void snapshotStatContext(mwcst::StatContext* statContext, bslmt::Latch* latch)
+{
+    statContext->snapshot();
+    latch->arrive();
+}
+
 }  // close unnamed namespace
 
 // ------------------------
@@ -114,6 +133,39 @@ StatController::StatContextDetails::StatContextDetails(
     // NOTHING
 }
 
+// ---------------------------------------
+// struct StatController::SnapshotBuffers
+// ---------------------------------------
+
+/// Snapshot buffers of the root stat contexts, and the map handed to the
+/// stat consumers referencing them by name.
+struct StatController::SnapshotBuffers {
+    // PUBLIC DATA
+    bsl::vector<bsl::shared_ptr<mwcst::StatSnapshotBuffer> > d_buffers;
+    // Snapshot buffer of each root stat
+    // context.
+
+    mqbplug::StatConsumer::StatSnapshotBuffersMap d_buffersMap;
+    // Map of root stat context name to its
+    // snapshot buffer in 'd_buffers'.
+
+    bslma::Allocator* d_allocator_p;
+    // Allocator to use.
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(SnapshotBuffers,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+    explicit SnapshotBuffers(bslma::Allocator* allocator)
+    : d_buffers(allocator)
+    , d_buffersMap(allocator)
+    , d_allocator_p(allocator)
+    {
+        // NOTHING
+    }
+};
+
 // --------------------
 // class StatController
 // --------------------
@@ -231,6 +283,17 @@ void StatController::initializeStats()
             ClusterStatsUtil::initializeStatContextCluster(historySize,
                                                            clustersAllocator),
             false)));
+
+    // ----------
+    // Dispatcher
+    bslma::Allocator* dispatcherAllocator = d_allocators.get(
+        "DispatcherStats");
+    d_statContextsMap.insert(bsl::make_pair(
+        bsl::string("dispatcher"),
+        StatContextDetails(
+            DispatcherStatsUtil::initializeStatContext(historySize,
+                                                       dispatcherAllocator),
+            false)));
 }
 
 void StatController::captureStats(mqbcmd::StatResult* result)
@@ -482,6 +545,74 @@ void StatController::listTunables(mqbcmd::StatResult* result,
     }
 }
 
+void StatController::loadSnapshotBuffers()
+{
+    // executed by the *SCHEDULER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_publicationThreadPool_mp);
+
+    // Reuse the buffers of the previous snapshot, unless they are still
+    // referenced by the publication thread or by a stat consumer: they must
+    // not be modified once published.
+    if (!d_snapshotBuffers_sp || d_snapshotBuffers_sp.use_count() != 1) {
+        d_snapshotBuffers_sp.createInplace(d_allocator_p, d_allocator_p);
+    }
+
+    SnapshotBuffers& buffers = *d_snapshotBuffers_sp;
+    buffers.d_buffersMap.clear();
+
+    bsl::size_t numBuffers = 0;
+    for (StatContextDetailsMap::const_iterator mit =
+             d_statContextsMap.begin();
+         mit != d_statContextsMap.end();
+         ++mit) {
+        if (mit->second.d_managed) {
+            continue;  // CONTINUE
+        }
+
+        if (numBuffers == buffers.d_buffers.size()) {
+            buffers.d_buffers.emplace_back();
+            buffers.d_buffers.back().createInplace(d_allocator_p,
+                                                   d_allocator_p);
+        }
+
+        mwcst::StatSnapshotBuffer* buffer =
+            buffers.d_buffers[numBuffers++].get();
+        buffer->load(*mit->second.d_statContext_sp);
+        buffers.d_buffersMap[mit->first] = buffer;
+    }
+    buffers.d_buffers.resize(numBuffers);
+
+    const int rc = d_publicationThreadPool_mp->tryEnqueueJob(
+        bdlf::BindUtil::bind(&StatController::publishSnapshotBuffers,
+                             this,
+                             d_snapshotBuffers_sp));
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        if (d_publicationLogLimiter.requestPermission()) {
+            BALL_LOG_WARN << "#STATS The stat publication thread is lagging, "
+                          << "dropping the snapshot buffers";
+        }
+    }
+}
+
+void StatController::publishSnapshotBuffers(
+    const SnapshotBuffersSp& snapshotBuffers)
+{
+    // executed by the *PUBLICATION* thread
+
+    const mqbplug::StatConsumer::StatSnapshotBuffersSp buffersMap(
+        snapshotBuffers,
+        &snapshotBuffers->d_buffersMap);
+
+    bsl::vector<mqbplug::StatConsumer*>::const_iterator it =
+        d_snapshotBuffersConsumers.begin();
+    for (; it != d_snapshotBuffersConsumers.end(); ++it) {
+        (*it)->onSnapshotBuffers(buffersMap);
+    }
+}
+
 void StatController::snapshot()
 {
     // executed by the *SCHEDULER* thread
@@ -504,24 +635,50 @@ void StatController::snapshot()
 
     d_lastSnapshotTime = now;
 
-    // Snapshot all root stat contexts
+    // Snapshot all root stat contexts.  Each of them is an independent tree,
+    // so they are snapshotted in parallel by the snapshot threads, this
+    // thread taking its share, and the snapshot is complete once all of them
+    // have arrived on the latch.
+    bsl::vector<mwcst::StatContext*> statContexts(d_allocator_p);
+    statContexts.reserve(d_statContextsMap.size());
     for (StatContextDetailsMap::iterator mit = d_statContextsMap.begin();
          mit != d_statContextsMap.end();
          ++mit) {
         if (!mit->second.d_managed) {
             BSLS_ASSERT_SAFE(mit->second.d_statContext_sp);
-            mit->second.d_statContext_sp->snapshot();
+            statContexts.push_back(mit->second.d_statContext_sp.get());
+        }
+    }
+
+    bslmt::Latch latch(static_cast<int>(statContexts.size()));
+    for (bsl::size_t i = 1; i < statContexts.size(); ++i) {
+        if (!d_snapshotThreadPool_mp ||
+            d_snapshotThreadPool_mp->tryEnqueueJob(
+                bdlf::BindUtil::bind(&snapshotStatContext,
+                                     statContexts[i],
+                                     &latch)) != 0) {
+            snapshotStatContext(statContexts[i], &latch);
         }
     }
+    if (!statContexts.empty()) {
+        snapshotStatContext(statContexts[0], &latch);
+    }
+    latch.wait();
 
     // The system stat monitor does some additional work that is invoked
     // through snapshot
     d_systemStatMonitor_mp->snapshot();
 
-    // StatConsumers will report all stats
+    // StatConsumers will report all stats.  Those publishing from the
+    // snapshot buffers are notified from the publication thread instead.
     bsl::vector<StatConsumerMp>::iterator it = d_statConsumers.begin();
     for (; it != d_statConsumers.end(); ++it) {
-        (*it)->onSnapshot();
+        if (!(*it)->usesSnapshotBuffers()) {
+            (*it)->onSnapshot();
+        }
+    }
+    if (d_publicationThreadPool_mp) {
+        loadSnapshotBuffers();
     }
 
     // Printer needs to be notified of every snapshot, but has an internal
@@ -611,6 +768,7 @@ StatController::StatController(const CommandProcessorFn& commandProcessor,
                                bslma::Allocator*         allocator)
 : d_allocators(allocator)
 , d_scheduler_mp(0)
+, d_snapshotThreadPool_mp(0)
 , d_lastSnapshotTime()
 , d_allocatorsStatContext_p(allocatorsStatContext)
 , d_statContextsMap(allocator)
@@ -622,6 +780,10 @@ StatController::StatController(const CommandProcessorFn& commandProcessor,
 , d_commandProcessorFn(bsl::allocator_arg, allocator, commandProcessor)
 , d_printer_mp(0)
 , d_statConsumers(allocator)
+, d_snapshotBuffersConsumers(allocator)
+, d_publicationThreadPool_mp(0)
+, d_snapshotBuffers_sp()
+, d_publicationLogLimiter()
 , d_statConsumerMaxPublishInterval(0)
 , d_eventScheduler_p(eventScheduler)
 , d_allocator_p(allocator)
@@ -633,6 +795,8 @@ StatController::StatController(const CommandProcessorFn& commandProcessor,
     d_lastSnapshotLogLimiter.initialize(1,
                                         15 * bdlt::TimeUnitRatio::k_NS_PER_M);
     // Throttling of one maximum alarm per 15 minutes
+    d_publicationLogLimiter.initialize(1,
+                                       15 * bdlt::TimeUnitRatio::k_NS_PER_M);
 }
 
 int StatController::start(bsl::ostream& errorDescription)
@@ -663,6 +827,25 @@ int StatController::start(bsl::ostream& errorDescription)
         return -2;  // RETURN
     }
 
+    // Start the snapshot threads.  Failing to do so only makes the snapshot
+    // slower, as it is then entirely performed by the scheduler thread.
+    d_snapshotThreadPool_mp.load(
+        new (*d_allocator_p) bdlmt::FixedThreadPool(
+            mwcsys::ThreadUtil::defaultAttributes().setThreadName(
+                "bmqSnapStat"),
+            k_SNAPSHOT_NUM_THREADS,
+            64,  // maxNumPendingJobs
+            d_allocator_p),
+        d_allocator_p);
+    rc = d_snapshotThreadPool_mp->start();
+    if (rc != 0) {
+        BALL_LOG_WARN << "#STATS Failed to start the snapshot thread pool "
+                      << "(rc: " << rc << "), snapshotting from the "
+                      << "scheduler thread only";
+        d_snapshotThreadPool_mp.clear();
+        rc = 0;
+    }
+
     if (mwcsys::ThreadUtil::k_SUPPORT_THREAD_NAME) {
         d_scheduler_mp->scheduleEvent(
             bsls::TimeInterval(0),  // execute as soon as possible
@@ -759,12 +942,38 @@ int StatController::start(bsl::ostream& errorDescription)
             consumer->setPublishInterval(
                 bsls::TimeInterval(consumerCfg->publishInterval()));
 
+            if (consumer->usesSnapshotBuffers()) {
+                d_snapshotBuffersConsumers.push_back(consumer.get());
+            }
+
             // Take ownership of the 'StatController'.
             d_statConsumers.emplace_back(
                 bslmf::MovableRefUtil::move(consumer));
         }
     }
 
+    // Start the publication thread, only needed by the stat consumers
+    // publishing from the snapshot buffers.
+    if (!d_snapshotBuffersConsumers.empty()) {
+        d_publicationThreadPool_mp.load(
+            new (*d_allocator_p) bdlmt::FixedThreadPool(
+                mwcsys::ThreadUtil::defaultAttributes().setThreadName(
+                    "bmqPubStat"),
+                1,  // numThreads
+                k_PUBLICATION_MAX_PENDING,
+                d_allocator_p),
+            d_allocator_p);
+        rc = d_publicationThreadPool_mp->start();
+        if (rc != 0) {
+            MWCTSK_ALARMLOG_ALARM("#STATS")
+                << "Failed to start the stat publication thread [rc: " << rc
+                << "], " << d_snapshotBuffersConsumers.size()
+                << " StatConsumer(s) will not publish" << MWCTSK_ALARMLOG_END;
+            d_publicationThreadPool_mp.clear();
+            rc = 0;
+        }
+    }
+
     // Start the printer
     d_printer_mp.load(new (*d_allocator_p) Printer(brkrCfg.stats(),
                                                    d_eventScheduler_p,
@@ -819,6 +1028,10 @@ void StatController::stop()
         d_scheduler_mp->cancelAllClocks(true);
         d_scheduler_mp->stop();
     }
+    STOP_OBJ(d_snapshotThreadPool_mp, "SnapshotThreadPool");
+
+    // Stop the publication thread before the stat consumers it notifies
+    STOP_OBJ(d_publicationThreadPool_mp, "PublicationThreadPool");
 
     // Stop everything
     bsl::vector<StatConsumerMp>::iterator it = d_statConsumers.begin();
@@ -836,6 +1049,10 @@ void StatController::stop()
     DESTROY_OBJ(d_printer_mp, "Printer");
     DESTROY_OBJ(d_systemStatMonitor_mp, "SystemStatMonitor");
     DESTROY_OBJ(d_scheduler_mp, "Scheduler");
+    DESTROY_OBJ(d_snapshotThreadPool_mp, "SnapshotThreadPool");
+    DESTROY_OBJ(d_publicationThreadPool_mp, "PublicationThreadPool");
+    d_snapshotBuffersConsumers.clear();
+    d_snapshotBuffers_sp.reset();
 
 #undef DESTROY_OBJ
 #undef STOP_OBJ
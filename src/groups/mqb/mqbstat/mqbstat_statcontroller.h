@@ -26,6 +26,23 @@
 // the top level StatContext, from which all subcontexts are created, and is
 // responsible from calling snapshot on them as well as regularly (if enable in
 // config) dumping the stats to a dedicated log file.
+//
+// The root stat contexts (domains, clients, clusters, channels, ...) being
+// independent trees, they are snapshotted in parallel by a small pool of
+// threads, so that the time of a snapshot is the one of the largest tree
+// rather than the sum of all of them.  The stat consumers and the printer are
+// only notified once all the trees have been snapshotted, from the stat
+// scheduler thread, which also executes the stat commands: they therefore
+// always observe a complete snapshot, without any locking.
+//
+// The stat consumers publishing from snapshot buffers (see
+// 'mqbplug_statconsumer') are instead notified from a dedicated publication
+// thread.  After each snapshot, the scheduler thread loads one columnar
+// 'mwcst::StatSnapshotBuffer' per root stat context, and hands these buffers,
+// which are immutable from then on, to the publication thread, which passes
+// them to every such consumer in turn.  The buffers are reloaded in place at
+// the next snapshot, unless a consumer still holds on to them, in which case
+// new ones are allocated.
 
 // MQB
 
@@ -40,6 +57,7 @@
 // BDE
 #include <ball_log.h>
 #include <bdlbb_blob.h>
+#include <bdlmt_fixedthreadpool.h>
 #include <bdlmt_throttle.h>
 #include <bdlmt_timereventscheduler.h>
 #include <bsl_functional.h>
@@ -125,6 +143,7 @@ class StatController {
   private:
     // PRIVATE TYPES
     typedef bslma::ManagedPtr<bdlmt::TimerEventScheduler> SchedulerMp;
+    typedef bslma::ManagedPtr<bdlmt::FixedThreadPool>     ThreadPoolMp;
     typedef bslma::ManagedPtr<mwcst::StatContext>         StatContextMp;
     typedef bsl::shared_ptr<mwcst::StatContext>           StatContextSp;
     typedef bslma::ManagedPtr<mwcsys::StatMonitor>        SystemStatMonitorMp;
@@ -153,6 +172,11 @@ class StatController {
     typedef bsl::unordered_map<bsl::string, StatContextDetails>
         StatContextDetailsMap;
 
+    /// Snapshot buffers of the root stat contexts.
+    struct SnapshotBuffers;
+
+    typedef bsl::shared_ptr<SnapshotBuffers> SnapshotBuffersSp;
+
     // DATA
     mwcma::CountingAllocatorStore d_allocators;
     // Allocator store to spawn new allocators
@@ -163,6 +187,14 @@ class StatController {
     // scheduler to not have stats interfere
     // with critical other parts.
 
+    ThreadPoolMp d_snapshotThreadPool_mp;
+    // Threads snapshotting root stat
+    // contexts in parallel with the
+    // scheduler thread, or null if it
+    // failed to start, in which case all of
+    // them are snapshotted by the scheduler
+    // thread.
+
     bsls::Types::Int64 d_lastSnapshotTime;
     // Time at which snapshot was last called.
 
@@ -206,6 +238,23 @@ class StatController {
 
     bsl::vector<StatConsumerMp> d_statConsumers;
 
+    bsl::vector<mqbplug::StatConsumer*> d_snapshotBuffersConsumers;
+    // Stat consumers publishing from the
+    // snapshot buffers.
+
+    ThreadPoolMp d_publicationThreadPool_mp;
+    // Thread notifying the stat consumers
+    // publishing from the snapshot buffers,
+    // or null if there is no such consumer.
+
+    SnapshotBuffersSp d_snapshotBuffers_sp;
+    // Snapshot buffers of the last snapshot.
+
+    bdlmt::Throttle d_publicationLogLimiter;
+    // Throttler for alarming on snapshot
+    // buffers dropped because the
+    // publication thread is lagging.
+
     int d_statConsumerMaxPublishInterval;
     // StatConsumer max publish interval
 
@@ -254,6 +303,16 @@ class StatController {
     /// Snapshot the stats.
     void snapshot();
 
+    /// Load the snapshot buffers of the root stat contexts from their last
+    /// snapshot, and enqueue them to be published by the publication
+    /// thread.
+    void loadSnapshotBuffers();
+
+    /// Notify the stat consumers publishing from the snapshot buffers of
+    /// the specified `snapshotBuffers`.  This is executed by the
+    /// publication thread.
+    void publishSnapshotBuffers(const SnapshotBuffersSp& snapshotBuffers);
+
     // PRIVATE ACCESSORS
 
     /// Validate that the statistics parameter from the config are valid,
@@ -319,6 +378,9 @@ class StatController {
     /// Retrieve the clusters top-level stat context.
     mwcst::StatContext* clustersStatContext();
 
+    /// Retrieve the dispatcher top-level stat context.
+    mwcst::StatContext* dispatcherStatContext();
+
     /// Retrieve the channels stat context corresponding to the specified
     /// `selector`.
     mwcst::StatContext* channelsStatContext(ChannelSelector::Enum selector);
@@ -357,6 +419,11 @@ inline mwcst::StatContext* StatController::clustersStatContext()
     return d_statContextsMap["clusters"].d_statContext_sp.get();
 }
 
+inline mwcst::StatContext* StatController::dispatcherStatContext()
+{
+    return d_statContextsMap["dispatcher"].d_statContext_sp.get();
+}
+
 inline mwcst::StatContext*
 StatController::channelsStatContext(ChannelSelector::Enum selector)
 {
@@ -0,0 +1,108 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbu_adaptivebatchpolicy.cpp                                       -*-C++-*-
+#include <mqbu_adaptivebatchpolicy.h>
+
+#include <mqbscm_version.h>
+
+// BDE
+#include <bdlt_timeunitratio.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace mqbu {
+
+// -------------------------
+// class AdaptiveBatchPolicy
+// -------------------------
+
+// MANIPULATORS
+void AdaptiveBatchPolicy::initialize(int                targetSize,
+                                     bsls::Types::Int64 maxDelay)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 < targetSize);
+    BSLS_ASSERT_SAFE(0 <= maxDelay);
+
+    d_targetSize = targetSize;
+    d_maxDelay   = maxDelay;
+    d_rate       = 0;
+    d_sampleTime = 0;
+    d_sampleSize = 0;
+    d_isPending  = false;
+}
+
+bsls::Types::Int64
+AdaptiveBatchPolicy::deferral(int pendingSize, bsls::Types::Int64 now)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 < pendingSize);
+
+    if (d_maxDelay == 0) {
+        return 0;  // RETURN
+    }
+
+    // Update the rate estimate with the growth of the batch since the last
+    // observation.  Weighting each observation by the time it covers keeps
+    // the estimate independent of how often the batch is observed, and lets
+    // it decay within a few maximum delays once the messages stop coming.
+    const bsls::Types::Int64 elapsed = now - d_sampleTime;
+    if (elapsed > 0) {
+        const int    growth = pendingSize > d_sampleSize
+                                  ? pendingSize - d_sampleSize
+                                  : 0;
+        const double sample = static_cast<double>(growth) / elapsed;
+        const double weight = static_cast<double>(elapsed) /
+                              static_cast<double>(elapsed + d_maxDelay);
+
+        d_rate += (sample - d_rate) * weight;
+        d_sampleTime = now;
+        d_sampleSize = pendingSize;
+    }
+
+    if (pendingSize >= d_targetSize) {
+        return 0;  // RETURN
+    }
+
+    if (!d_isPending) {
+        d_pendingTime = now;
+        d_isPending   = true;
+    }
+
+    const bsls::Types::Int64 remaining = d_pendingTime + d_maxDelay - now;
+    if (remaining <= 0) {
+        return 0;  // RETURN
+    }
+
+    // Only hold the batch if it is expected to reach the target size before
+    // the maximum delay expires: holding it longer would only add latency.
+    if (d_rate * static_cast<double>(remaining) <
+        static_cast<double>(d_targetSize - pendingSize)) {
+        return 0;  // RETURN
+    }
+
+    return remaining;
+}
+
+// ACCESSORS
+bsls::Types::Int64 AdaptiveBatchPolicy::bytesPerSecond() const
+{
+    return static_cast<bsls::Types::Int64>(d_rate *
+                                           bdlt::TimeUnitRatio::k_NS_PER_S);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,195 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// mqbu_adaptivebatchpolicy.h                                         -*-C++-*-
+#ifndef INCLUDED_MQBU_ADAPTIVEBATCHPOLICY
+#define INCLUDED_MQBU_ADAPTIVEBATCHPOLICY
+
+//@PURPOSE: Provide a policy deciding when to send a batch of messages.
+//
+//@CLASSES:
+//  mqbu::AdaptiveBatchPolicy: batching policy driven by the observed rate
+//
+//@DESCRIPTION: 'mqbu::AdaptiveBatchPolicy' decides whether a batch of
+// messages being accumulated (for example the PUSH event built for a client)
+// should be sent right away, or held for some more time so that it grows
+// closer to a configured *target size*, without any message of the batch
+// being held for longer than a configured *maximum delay*.
+//
+// Each time the owner of the batch considers sending it, it provides the
+// current size of the batch to 'deferral', which updates an estimate of the
+// rate at which the batch grows (an exponentially weighted moving average of
+// the growth since the previous observation, each observation being weighted
+// by the time it covers relative to the maximum delay), and returns for how
+// long the batch should be held:
+//: o 0, meaning the batch should be sent now, if it reached the target size,
+//:   if its oldest messages are already held for the maximum delay, or if, at
+//:   the estimated rate, it would not reach the target size before the
+//:   maximum delay expires, which is always the case under light load, so
+//:   that sparse messages are not delayed;
+//: o otherwise, the time left before the maximum delay expires, after which
+//:   the owner must consider sending the batch again.
+//
+// The owner must notify the policy, with 'onSent', each time it sends the
+// batch, whether or not the policy advised to.
+//
+// A default constructed policy, or a policy initialized with a maximum delay
+// of 0, is *disabled* and always advises to send the batch now.  The current
+// time is provided by the caller, so that one clock read can be shared.
+//
+/// Thread Safety
+///-------------
+// NOT Thread-Safe.
+//
+/// Usage
+///-----
+//..
+//  mqbu::AdaptiveBatchPolicy policy;
+//  policy.initialize(64 * 1024,  // aim for batches of 64KB
+//                    500000);    // holding messages for at most 500us
+//
+//  const bsls::Types::Int64 now   = mwcsys::Time::highResolutionTimer();
+//  const bsls::Types::Int64 delay = policy.deferral(builder.eventSize(),
+//                                                   now);
+//  if (delay == 0) {
+//      send(builder.blob());
+//      policy.onSent(now);
+//  }
+//  else {
+//      // Consider sending the batch again in at most 'delay' nanoseconds.
+//  }
+//..
+
+// BDE
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mqbu {
+
+// =========================
+// class AdaptiveBatchPolicy
+// =========================
+
+/// Batching policy driven by the observed rate at which a batch grows.
+class AdaptiveBatchPolicy {
+  private:
+    // DATA
+    int d_targetSize;
+    // Size, in bytes, the batches aim for.
+
+    bsls::Types::Int64 d_maxDelay;
+    // Maximum time, in nanoseconds, a
+    // message is held in a batch, or 0 if
+    // the policy is disabled.
+
+    double d_rate;
+    // Estimated rate, in bytes per
+    // nanosecond, at which the batch grows.
+
+    bsls::Types::Int64 d_sampleTime;
+    // Time, in nanoseconds, of the last
+    // observation of the batch.
+
+    int d_sampleSize;
+    // Size of the batch at the last
+    // observation.
+
+    bsls::Types::Int64 d_pendingTime;
+    // Time, in nanoseconds, at which the
+    // batch was first held, if
+    // 'd_isPending'.
+
+    bool d_isPending;
+    // Whether the batch was held since it
+    // was last sent.
+
+  public:
+    // CREATORS
+
+    /// Create a disabled policy.
+    AdaptiveBatchPolicy();
+
+    // MANIPULATORS
+
+    /// Configure this policy to aim for batches of the specified
+    /// `targetSize` bytes, holding messages for at most the specified
+    /// `maxDelay` nanoseconds.  If `maxDelay` is 0, the policy is disabled.
+    /// The rate estimate is reset by this call.  The behavior is undefined
+    /// unless `0 < targetSize` and `0 <= maxDelay`.
+    void initialize(int targetSize, bsls::Types::Int64 maxDelay);
+
+    /// Observe the batch having the specified `pendingSize` bytes at the
+    /// specified `now` time (in nanoseconds, from an arbitrary but fixed
+    /// origin, such as `mwcsys::Time::highResolutionTimer()`), and return
+    /// the time, in nanoseconds, for which sending it should be deferred,
+    /// or 0 if it should be sent now.  A disabled policy always returns 0.
+    /// The behavior is undefined unless `0 < pendingSize`.
+    bsls::Types::Int64 deferral(int pendingSize, bsls::Types::Int64 now);
+
+    /// Notify this policy that the batch was sent at the specified `now`
+    /// time, and that a new, empty, batch is being accumulated.
+    void onSent(bsls::Types::Int64 now);
+
+    // ACCESSORS
+
+    /// Return true if this policy may defer sending batches, and false
+    /// otherwise.
+    bool isEnabled() const;
+
+    /// Return the estimated rate, in bytes per second, at which the batch
+    /// grows.
+    bsls::Types::Int64 bytesPerSecond() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// -------------------------
+// class AdaptiveBatchPolicy
+// -------------------------
+
+// CREATORS
+inline AdaptiveBatchPolicy::AdaptiveBatchPolicy()
+: d_targetSize(1)
+, d_maxDelay(0)
+, d_rate(0)
+, d_sampleTime(0)
+, d_sampleSize(0)
+, d_pendingTime(0)
+, d_isPending(false)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+inline void AdaptiveBatchPolicy::onSent(bsls::Types::Int64 now)
+{
+    d_sampleTime = now;
+    d_sampleSize = 0;
+    d_isPending  = false;
+}
+
+// ACCESSORS
+inline bool AdaptiveBatchPolicy::isEnabled() const
+{
+    return d_maxDelay != 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,149 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// mqbu_adaptivebatchpolicy.t.cpp                                     -*-C++-*-
+#include <mqbu_adaptivebatchpolicy.h>
+
+// BDE
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   1. A default constructed policy is disabled and never defers.
+//   2. A policy initialized with a maximum delay of 0 is disabled.
+//   3. An enabled policy does not defer sparse messages.
+//
+// Testing:
+//   AdaptiveBatchPolicy()
+//   initialize
+//   isEnabled
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    mqbu::AdaptiveBatchPolicy obj;
+    ASSERT(!obj.isEnabled());
+    ASSERT_EQ(0, obj.deferral(10, 1000));
+
+    obj.initialize(1000, 1000);
+    ASSERT(obj.isEnabled());
+    ASSERT_EQ(0, obj.bytesPerSecond());
+
+    // 10 bytes in 100us: far from reaching the target within the delay
+    obj.onSent(0);
+    ASSERT_EQ(0, obj.deferral(10, 100000));
+
+    obj.initialize(1000, 0);
+    ASSERT(!obj.isEnabled());
+    ASSERT_EQ(0, obj.deferral(10, 200000));
+}
+
+static void test2_adaptiveDeferral()
+// ------------------------------------------------------------------------
+// ADAPTIVE DEFERRAL
+//
+// Concerns:
+//   1. The rate estimate converges to the rate at which the batch grows.
+//   2. Once the rate allows reaching the target size within the maximum
+//      delay, a small batch is deferred for the time left before the
+//      maximum delay expires.
+//   3. A batch reaching the target size is sent.
+//   4. A batch held for the maximum delay is sent.
+//   5. The rate estimate decays when the messages stop coming, and sparse
+//      messages are then sent right away again.
+//
+// Testing:
+//   deferral
+//   onSent
+//   bytesPerSecond
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("ADAPTIVE DEFERRAL");
+
+    // Batches of 1000 bytes, holding messages for at most 1000ns
+    mqbu::AdaptiveBatchPolicy obj;
+    obj.initialize(1000, 1000);
+
+    // Grow the batch by 100 bytes every 100ns (i.e. 1 byte per ns), sending
+    // it every time.
+    bsls::Types::Int64 now = 0;
+    obj.onSent(now);
+    for (int i = 0; i < 100; ++i) {
+        now += 100;
+        obj.deferral(100, now);
+        obj.onSent(now);
+    }
+    ASSERT_GE(obj.bytesPerSecond(), 990000000LL);
+    ASSERT_GE(1000000000LL, obj.bytesPerSecond());
+
+    PVV("Defer a small batch expected to reach the target size");
+    now += 100;
+    ASSERT_EQ(1000, obj.deferral(100, now));
+    now += 500;
+    ASSERT_EQ(500, obj.deferral(600, now));
+
+    PVV("Send a batch reaching the target size");
+    now += 400;
+    ASSERT_EQ(0, obj.deferral(1000, now));
+    obj.onSent(now);
+
+    PVV("Send a batch held for the maximum delay");
+    now += 100;
+    ASSERT_EQ(1000, obj.deferral(100, now));
+    now += 1000;
+    ASSERT_EQ(0, obj.deferral(900, now));
+    obj.onSent(now);
+
+    PVV("Send sparse messages once the messages stopped coming");
+    now += 1000000;
+    ASSERT_EQ(0, obj.deferral(10, now));
+    ASSERT_GE(1000000LL, obj.bytesPerSecond());
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 2: test2_adaptiveDeferral(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
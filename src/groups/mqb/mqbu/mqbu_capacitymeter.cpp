@@ -43,12 +43,145 @@ const double k_DEFAULT_HI_THRESHOLD = 0.80;
 // capacity
 const bsls::Types::Int64 k_ZERO = 0;
 
+/// Reserve, on the specified `reserved` counter, at most the specified
+/// `requested` amount of a resource having the specified `capacity` and of
+/// which the specified `committed` amount is in use, and return the amount
+/// reserved.
+bsls::Types::Int64 reserveResource(bsls::AtomicInt64*       reserved,
+                                   const bsls::AtomicInt64& committed,
+                                   bsls::Types::Int64       capacity,
+                                   bsls::Types::Int64       requested)
+{
+    bsls::Types::Int64 current = reserved->load();
+    while (true) {
+        const bsls::Types::Int64 available = bsl::min(
+            requested,
+            bsl::max(k_ZERO, capacity - committed.load() - current));
+        if (available == 0) {
+            return 0;  // RETURN
+        }
+
+        const bsls::Types::Int64 previous = reserved->testAndSwap(
+            current,
+            current + available);
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(previous == current)) {
+            return available;  // RETURN
+        }
+
+        // Another thread updated the reservations concurrently, retry with
+        // the new value
+        current = previous;
+    }
+}
+
+/// Add the specified `requested` resources to the specified `committed`
+/// ones if, right before the addition, the resources committed plus the
+/// specified `reserved` ones do not exceed the specified `capacity`.  Load
+/// the resulting number of committed resources into the specified `result`
+/// and return true on success, return false otherwise.  Note that the check
+/// and the addition are done atomically, so that concurrent callers exceed
+/// `capacity` at most once.
+bool commitResource(bsls::Types::Int64*      result,
+                    bsls::AtomicInt64*       committed,
+                    const bsls::AtomicInt64& reserved,
+                    bsls::Types::Int64       capacity,
+                    bsls::Types::Int64       requested)
+{
+    bsls::Types::Int64 current = committed->load();
+    while (true) {
+        if (current + reserved.load() > capacity) {
+            return false;  // RETURN
+        }
+
+        const bsls::Types::Int64 previous = committed->testAndSwap(
+            current,
+            current + requested);
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(previous == current)) {
+            *result = current + requested;
+            return true;  // RETURN
+        }
+
+        // Another thread updated the committed resources concurrently, retry
+        // with the new value
+        current = previous;
+    }
+}
+
 }  // close unnamed namespace
 
 // -------------------
 // class CapacityMeter
 // -------------------
 
+// PRIVATE MANIPULATORS
+ResourceUsageMonitorStateTransition::Enum CapacityMeter::syncMonitor()
+{
+    ResourceUsageMonitorStateTransition::Enum stateTransition =
+        d_monitor.update(d_nbBytes.load() - d_monitor.bytes(),
+                         d_nbMessages.load() - d_monitor.messages());
+    d_isMonitorNormal.store(d_monitor.state() ==
+                            ResourceUsageMonitorState::e_STATE_NORMAL);
+
+    return stateTransition;
+}
+
+void CapacityMeter::updateMonitorMirrors()
+{
+    d_messageCapacity.store(d_monitor.messageCapacity());
+    d_byteCapacity.store(d_monitor.byteCapacity());
+
+    // NOTE: The high watermarks are computed the same way as in
+    //       'ResourceUsageMonitor', so that the fast path of 'updateMonitor'
+    //       never misses a state transition.
+    d_messageHighWatermark.store(static_cast<bsls::Types::Int64>(
+        d_monitor.messageCapacity() * d_monitor.messageHighWatermarkRatio()));
+    d_byteHighWatermark.store(static_cast<bsls::Types::Int64>(
+        d_monitor.byteCapacity() * d_monitor.byteHighWatermarkRatio()));
+
+    d_isMonitorNormal.store(d_monitor.state() ==
+                            ResourceUsageMonitorState::e_STATE_NORMAL);
+}
+
+void CapacityMeter::updateMonitor(bsls::Types::Int64 messages,
+                                  bsls::Types::Int64 bytes,
+                                  bool               silentMode)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+            d_isMonitorNormal.load() &&
+            messages < d_messageHighWatermark.loadRelaxed() &&
+            bytes < d_byteHighWatermark.loadRelaxed())) {
+        // The monitor is in the normal state and below the high watermarks:
+        // no state transition can occur.
+        return;  // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    bsls::SpinLockGuard guard(&d_lock);  // d_lock LOCK
+
+    // NOTE: Since the monitor is brought up to date with the latest counters,
+    //       the transition may result from the update of another thread which
+    //       did not get the lock first: always log the high watermark and full
+    //       alarms, and honor 'silentMode' for the low watermark only.
+    ResourceUsageMonitorStateTransition::Enum monitorStateTransition =
+        syncMonitor();
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+            monitorStateTransition ==
+            ResourceUsageMonitorStateTransition::e_NO_CHANGE)) {
+        return;  // RETURN
+    }
+
+    const bool isLowWatermarkTransition =
+        monitorStateTransition ==
+        ResourceUsageMonitorStateTransition::e_LOW_WATERMARK;
+    if (silentMode && isLowWatermarkTransition) {
+        return;  // RETURN
+    }
+
+    logOnMonitorStateTransition(monitorStateTransition);
+}
+
+// PRIVATE ACCESSORS
 void CapacityMeter::logOnMonitorStateTransition(
     ResourceUsageMonitorStateTransition::Enum stateTransition) const
 {
@@ -65,18 +198,20 @@ void CapacityMeter::logOnMonitorStateTransition(
            << " (limit: "
            << mwcu::PrintUtil::prettyNumber(d_monitor.messageCapacity());
 
-    if (d_nbMessagesReserved > 0) {
+    const bsls::Types::Int64 nbMessagesReserved = d_nbMessagesReserved.load();
+    if (nbMessagesReserved > 0) {
         stream << ", reserved: "
-               << mwcu::PrintUtil::prettyNumber(d_nbMessagesReserved);
+               << mwcu::PrintUtil::prettyNumber(nbMessagesReserved);
     }
 
     stream << "), Bytes (" << d_monitor.byteState()
            << "): " << mwcu::PrintUtil::prettyBytes(d_monitor.bytes())
            << " (limit: "
            << mwcu::PrintUtil::prettyBytes(d_monitor.byteCapacity());
-    if (d_nbBytesReserved > 0) {
+    const bsls::Types::Int64 nbBytesReserved = d_nbBytesReserved.load();
+    if (nbBytesReserved > 0) {
         stream << ", reserved: "
-               << mwcu::PrintUtil::prettyBytes(d_nbBytesReserved);
+               << mwcu::PrintUtil::prettyBytes(nbBytesReserved);
     }
     stream << ")]";
 
@@ -112,11 +247,18 @@ CapacityMeter::CapacityMeter(const bsl::string& name,
             k_DEFAULT_HI_THRESHOLD * k_LO_HI_THRESHOLD_RATIO,
             k_DEFAULT_HI_THRESHOLD)
 // will be reconfigured in setLimits
+, d_nbMessages(0)
+, d_nbBytes(0)
 , d_nbMessagesReserved(0)
 , d_nbBytesReserved(0)
+, d_messageCapacity(0)
+, d_byteCapacity(0)
+, d_messageHighWatermark(0)
+, d_byteHighWatermark(0)
+, d_isMonitorNormal(false)
 , d_lock(bsls::SpinLock::s_unlocked)
 {
-    // NOTHING
+    updateMonitorMirrors();
 }
 
 CapacityMeter::CapacityMeter(const bsl::string& name,
@@ -132,24 +274,36 @@ CapacityMeter::CapacityMeter(const bsl::string& name,
             k_DEFAULT_HI_THRESHOLD * k_LO_HI_THRESHOLD_RATIO,
             k_DEFAULT_HI_THRESHOLD)
 // will be reconfigured in setLimits
+, d_nbMessages(0)
+, d_nbBytes(0)
 , d_nbMessagesReserved(0)
 , d_nbBytesReserved(0)
+, d_messageCapacity(0)
+, d_byteCapacity(0)
+, d_messageHighWatermark(0)
+, d_byteHighWatermark(0)
+, d_isMonitorNormal(false)
 , d_lock()
 {
-    // NOTHING
+    updateMonitorMirrors();
 }
 
 CapacityMeter& CapacityMeter::setLimits(bsls::Types::Int64 messages,
                                         bsls::Types::Int64 bytes)
 {
+    bsls::SpinLockGuard guard(&d_lock);  // d_lock LOCK
+
     // NOTE: ResourceUsageMonitor.reconfigure() will preserve the values for
-    //       bytes and messages being monitored.
+    //       bytes and messages being monitored, which are first brought up to
+    //       date.
+    syncMonitor();
     d_monitor.reconfigureByRatio(bytes,
                                  messages,
                                  d_monitor.byteLowWatermarkRatio(),
                                  d_monitor.byteHighWatermarkRatio(),
                                  d_monitor.messageLowWatermarkRatio(),
                                  d_monitor.messageHighWatermarkRatio());
+    updateMonitorMirrors();
 
     return *this;
 }
@@ -161,14 +315,19 @@ CapacityMeter& CapacityMeter::setWatermarkThresholds(double messages,
     BSLS_ASSERT(0.0 <= messages && messages <= 1.0);
     BSLS_ASSERT(0.0 <= bytes && bytes <= 1.0);
 
+    bsls::SpinLockGuard guard(&d_lock);  // d_lock LOCK
+
     // NOTE: ResourceUsageMonitor.reconfigure() will preserve the values for
-    //       bytes and messages being monitored.
+    //       bytes and messages being monitored, which are first brought up to
+    //       date.
+    syncMonitor();
     d_monitor.reconfigureByRatio(d_monitor.byteCapacity(),
                                  d_monitor.messageCapacity(),
                                  bytes * k_LO_HI_THRESHOLD_RATIO,
                                  bytes,
                                  messages * k_LO_HI_THRESHOLD_RATIO,
                                  messages);
+    updateMonitorMirrors();
 
     return *this;
 }
@@ -185,22 +344,19 @@ void CapacityMeter::reserve(bsls::Types::Int64* nbMessagesAvailable,
         return;  // RETURN
     }
 
-    bsls::SpinLockGuard guard(&d_lock);  // d_lock LOCK
-
-    // First check with self how much resource is available
-    *nbMessagesAvailable = bsl::min(messages,
-                                    bsl::max(k_ZERO,
-                                             d_monitor.messageCapacity() -
-                                                 d_monitor.messages() -
-                                                 d_nbMessagesReserved));
-    *nbBytesAvailable    = bsl::min(bytes,
-                                 bsl::max(k_ZERO,
-                                          d_monitor.byteCapacity() -
-                                              d_monitor.bytes() -
-                                              d_nbBytesReserved));
+    // First reserve on self how much resource is available
+    *nbMessagesAvailable = reserveResource(&d_nbMessagesReserved,
+                                           d_nbMessages,
+                                           d_messageCapacity.loadRelaxed(),
+                                           messages);
+    *nbBytesAvailable    = reserveResource(&d_nbBytesReserved,
+                                        d_nbBytes,
+                                        d_byteCapacity.loadRelaxed(),
+                                        bytes);
 
     // If we have an associated parent, reserve resources on it (but at most
     // what is currently available in self, not what was requested by the user)
+    // and give back to self what the parent could not reserve.
     if (d_parent_p) {
         messages = *nbMessagesAvailable;
         bytes    = *nbBytesAvailable;
@@ -209,10 +365,15 @@ void CapacityMeter::reserve(bsls::Types::Int64* nbMessagesAvailable,
                             nbBytesAvailable,
                             messages,
                             bytes);
-    }
 
-    d_nbMessagesReserved += *nbMessagesAvailable;
-    d_nbBytesReserved += *nbBytesAvailable;
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                *nbMessagesAvailable != messages ||
+                *nbBytesAvailable != bytes)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            d_nbMessagesReserved.add(*nbMessagesAvailable - messages);
+            d_nbBytesReserved.add(*nbBytesAvailable - bytes);
+        }
+    }
 }
 
 void CapacityMeter::release(bsls::Types::Int64 messages,
@@ -226,16 +387,15 @@ void CapacityMeter::release(bsls::Types::Int64 messages,
         d_parent_p->release(messages, bytes);
     }
 
-    {
-        bsls::SpinLockGuard guard(&d_lock);  // d_lock LOCK
-
-        d_nbMessagesReserved -= messages;
-        d_nbBytesReserved -= bytes;
-    }  // close lock guard scope
+    const bsls::Types::Int64 nbMessagesReserved = d_nbMessagesReserved.add(
+        -messages);
+    const bsls::Types::Int64 nbBytesReserved = d_nbBytesReserved.add(-bytes);
 
     // POSTCONDITIONS: We should never be releasing more than was reserved
-    BSLS_ASSERT_SAFE(d_nbMessagesReserved >= 0);
-    BSLS_ASSERT_SAFE(d_nbBytesReserved >= 0);
+    BSLS_ASSERT_SAFE(nbMessagesReserved >= 0);
+    BSLS_ASSERT_SAFE(nbBytesReserved >= 0);
+    (void)nbMessagesReserved;
+    (void)nbBytesReserved;
 }
 
 void CapacityMeter::commit(bsls::Types::Int64 messages,
@@ -248,29 +408,21 @@ void CapacityMeter::commit(bsls::Types::Int64 messages,
     // PRECONDITIONS: Since resources must always be reserved prior to being
     //                committed, we should never be requested to put more than
     //                has been reserved or more than the configured capacity.
-    BSLS_ASSERT_SAFE(d_nbMessagesReserved >= messages);
-    BSLS_ASSERT_SAFE(d_nbBytesReserved >= bytes);
-    BSLS_ASSERT_SAFE(d_monitor.messages() + messages <=
-                     d_monitor.messageCapacity());
-    BSLS_ASSERT_SAFE(d_monitor.bytes() + bytes <= d_monitor.byteCapacity());
-
-    {
-        bsls::SpinLockGuard guard(&d_lock);  // d_lock LOCK
-
-        // Update the reserved counters
-        d_nbMessagesReserved -= messages;
-        d_nbBytesReserved -= bytes;
-
-        // Update monitor
-        ResourceUsageMonitorStateTransition::Enum monitorStateTransition =
-            d_monitor.update(bytes, messages);
-        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
-                monitorStateTransition !=
-                ResourceUsageMonitorStateTransition::e_NO_CHANGE)) {
-            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-            logOnMonitorStateTransition(monitorStateTransition);
-        }
-    }  // close lock guard scope
+    BSLS_ASSERT_SAFE(d_nbMessagesReserved.load() >= messages);
+    BSLS_ASSERT_SAFE(d_nbBytesReserved.load() >= bytes);
+    BSLS_ASSERT_SAFE(d_nbMessages.load() + messages <=
+                     d_messageCapacity.load());
+    BSLS_ASSERT_SAFE(d_nbBytes.load() + bytes <= d_byteCapacity.load());
+
+    // NOTE: The committed counters are increased before the reserved ones are
+    //       decreased, so that a concurrent 'reserve' never observes less
+    //       resources in use than there actually are.
+    const bsls::Types::Int64 nbMessages = d_nbMessages.add(messages);
+    const bsls::Types::Int64 nbBytes    = d_nbBytes.add(bytes);
+    d_nbMessagesReserved.add(-messages);
+    d_nbBytesReserved.add(-bytes);
+
+    updateMonitor(nbMessages, nbBytes, false);
 
     if (d_parent_p) {
         d_parent_p->commit(messages, bytes);
@@ -285,23 +437,34 @@ CapacityMeter::commitUnreserved(bsls::Types::Int64 messages,
         return e_SUCCESS;  // RETURN
     }
 
-    bsls::SpinLockGuard guard(&d_lock);  // d_lock LOCK
-
     // NOTE: The 'messages' and 'bytes' parameters are not considered in the
-    //       'hasCapacity' check because we want to allow to exceed the
-    //       capacity for either messages or bytes *exactly* once, which also
-    //       means that we want to log on 'STATE_FULL' exactly once.
-    bool hasMessagesCapacity = d_monitor.messages() + d_nbMessagesReserved <=
-                               d_monitor.messageCapacity();
-    bool hasBytesCapacity = d_monitor.bytes() + d_nbBytesReserved <=
-                            d_monitor.byteCapacity();
-
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!hasMessagesCapacity ||
-                                              !hasBytesCapacity)) {
+    //       capacity check because we want to allow to exceed the capacity
+    //       for either messages or bytes *exactly* once, which also means
+    //       that we want to log on 'STATE_FULL' exactly once.  The check and
+    //       the commit are done atomically on each counter, and the commit is
+    //       rolled back if the other counter, or the parent, has no capacity
+    //       left.
+    bsls::Types::Int64 nbMessages;
+    bsls::Types::Int64 nbBytes;
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            !commitResource(&nbMessages,
+                            &d_nbMessages,
+                            d_nbMessagesReserved,
+                            d_messageCapacity.loadRelaxed(),
+                            messages))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return e_LIMIT_MESSAGES;  // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            !commitResource(&nbBytes,
+                            &d_nbBytes,
+                            d_nbBytesReserved,
+                            d_byteCapacity.loadRelaxed(),
+                            bytes))) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        // Self doesn't have enough capacity
-        return !hasMessagesCapacity ? e_LIMIT_MESSAGES
-                                    : e_LIMIT_BYTES;  // RETURN
+        d_nbMessages.add(-messages);
+        return e_LIMIT_BYTES;  // RETURN
     }
 
     // Self has enough capacity, if it has a parent, try to acquire resources
@@ -310,19 +473,13 @@ CapacityMeter::commitUnreserved(bsls::Types::Int64 messages,
         CommitResult res = d_parent_p->commitUnreserved(messages, bytes);
         if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(res != e_SUCCESS)) {
             BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            d_nbMessages.add(-messages);
+            d_nbBytes.add(-bytes);
             return res;  // RETURN
         }
     }
 
-    // Update monitor
-    ResourceUsageMonitorStateTransition::Enum monitorStateTransition =
-        d_monitor.update(bytes, messages);
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
-            monitorStateTransition !=
-            ResourceUsageMonitorStateTransition::e_NO_CHANGE)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        logOnMonitorStateTransition(monitorStateTransition);
-    }
+    updateMonitor(nbMessages, nbBytes, false);
 
     return e_SUCCESS;
 }
@@ -334,10 +491,14 @@ void CapacityMeter::forceCommit(bsls::Types::Int64 messages,
         return;  // RETURN
     }
 
+    d_nbMessages.add(messages);
+    d_nbBytes.add(bytes);
+
     {
         bsls::SpinLockGuard guard(&d_lock);  // d_lock LOCK
 
-        d_monitor.update(bytes, messages);
+        // Any resulting state transition is silently absorbed
+        syncMonitor();
     }  // close lock guard scope
 
     if (d_parent_p) {
@@ -357,21 +518,9 @@ void CapacityMeter::remove(bsls::Types::Int64 messages,
         d_parent_p->remove(messages, bytes);
     }
 
-    {
-        bsls::SpinLockGuard guard(&d_lock);  // d_lock LOCK
-
-        // Update monitor
-        ResourceUsageMonitorStateTransition::Enum monitorStateTransition =
-            d_monitor.update(-1 * bytes, -1 * messages);
-
-        bool isLowWatermarkTransition =
-            monitorStateTransition ==
-            ResourceUsageMonitorStateTransition::e_LOW_WATERMARK;
-
-        if (!silentMode && isLowWatermarkTransition) {
-            logOnMonitorStateTransition(monitorStateTransition);
-        }
-    }  // close lock guard scope
+    updateMonitor(d_nbMessages.add(-messages),
+                  d_nbBytes.add(-bytes),
+                  silentMode);
 }
 
 void CapacityMeter::clear()
@@ -382,14 +531,30 @@ void CapacityMeter::clear()
 
     bsls::SpinLockGuard guard(&d_lock);  // d_lock LOCK
 
+    const bsls::Types::Int64 messages = d_nbMessages.swap(0);
+    const bsls::Types::Int64 bytes    = d_nbBytes.swap(0);
+
     if (d_parent_p) {
-        d_parent_p->remove(d_monitor.messages(), d_monitor.bytes());
+        d_parent_p->remove(messages, bytes);
     }
 
     d_monitor.reset();
+    d_isMonitorNormal.store(d_monitor.state() ==
+                            ResourceUsageMonitorState::e_STATE_NORMAL);
 }
 
 // ACCESSORS
+bool CapacityMeter::isHighWatermarkReached() const
+{
+    for (const CapacityMeter* meter = this; meter; meter = meter->d_parent_p) {
+        if (!meter->d_isDisabled && !meter->d_isMonitorNormal.load()) {
+            return true;  // RETURN
+        }
+    }
+
+    return false;
+}
+
 bsl::ostream&
 CapacityMeter::print(bsl::ostream& stream, int level, int spacesPerLevel) const
 {
@@ -400,31 +565,27 @@ CapacityMeter::print(bsl::ostream& stream, int level, int spacesPerLevel) const
         return stream;  // RETURN
     }
 
-    {
-        bsls::SpinLockGuard guard(&d_lock);  // d_lock LOCK
+    const bsls::Types::Int64 nbMessagesReserved = d_nbMessagesReserved.load();
+    const bsls::Types::Int64 nbBytesReserved    = d_nbBytesReserved.load();
 
-        stream << name() << ":"
-               << mwcu::PrintUtil::newlineAndIndent(level + 1, spacesPerLevel)
-               << "Messages: [current: "
-               << mwcu::PrintUtil::prettyNumber(d_monitor.messages())
-               << ", limit: "
-               << mwcu::PrintUtil::prettyNumber(d_monitor.messageCapacity());
-        if (d_nbMessagesReserved != 0) {
-            stream << ", reserved: "
-                   << mwcu::PrintUtil::prettyNumber(d_nbMessagesReserved);
-        }
-        stream << "]"
-               << mwcu::PrintUtil::newlineAndIndent(level + 1, spacesPerLevel)
-               << "Bytes   : [current: "
-               << mwcu::PrintUtil::prettyBytes(d_monitor.bytes())
-               << ", limit: "
-               << mwcu::PrintUtil::prettyBytes(d_monitor.byteCapacity());
-        if (d_nbBytesReserved != 0) {
-            stream << ", reserved: "
-                   << mwcu::PrintUtil::prettyBytes(d_nbBytesReserved);
-        }
-        stream << "]";
+    stream << name() << ":"
+           << mwcu::PrintUtil::newlineAndIndent(level + 1, spacesPerLevel)
+           << "Messages: [current: "
+           << mwcu::PrintUtil::prettyNumber(messages())
+           << ", limit: " << mwcu::PrintUtil::prettyNumber(messageCapacity());
+    if (nbMessagesReserved != 0) {
+        stream << ", reserved: "
+               << mwcu::PrintUtil::prettyNumber(nbMessagesReserved);
+    }
+    stream << "]"
+           << mwcu::PrintUtil::newlineAndIndent(level + 1, spacesPerLevel)
+           << "Bytes   : [current: " << mwcu::PrintUtil::prettyBytes(bytes())
+           << ", limit: " << mwcu::PrintUtil::prettyBytes(byteCapacity());
+    if (nbBytesReserved != 0) {
+        stream << ", reserved: "
+               << mwcu::PrintUtil::prettyBytes(nbBytesReserved);
     }
+    stream << "]";
 
     if (d_parent_p) {
         d_parent_p->print(stream, level, spacesPerLevel);
@@ -440,16 +601,11 @@ bsl::ostream& CapacityMeter::printShortSummary(bsl::ostream& stream) const
         return stream;  // RETURN
     }
 
-    {
-        bsls::SpinLockGuard guard(&d_lock);  // d_lock LOCK
-        stream << "Messages [current: "
-               << mwcu::PrintUtil::prettyNumber(d_monitor.messages()) << " / "
-               << mwcu::PrintUtil::prettyNumber(d_monitor.messageCapacity())
-               << "], Bytes [current: "
-               << mwcu::PrintUtil::prettyBytes(d_monitor.bytes()) << " / "
-               << mwcu::PrintUtil::prettyBytes(d_monitor.byteCapacity())
-               << "]";
-    }
+    stream << "Messages [current: "
+           << mwcu::PrintUtil::prettyNumber(messages()) << " / "
+           << mwcu::PrintUtil::prettyNumber(messageCapacity())
+           << "], Bytes [current: " << mwcu::PrintUtil::prettyBytes(bytes())
+           << " / " << mwcu::PrintUtil::prettyBytes(byteCapacity()) << "]";
 
     return stream;
 }
@@ -466,12 +622,12 @@ void CapacityMeterUtil::loadState(mqbcmd::CapacityMeter* state,
 
     state->name()                = capacityMeter.d_name;
     state->isDisabled()          = capacityMeter.d_isDisabled;
-    state->numMessages()         = capacityMeter.d_monitor.messages();
-    state->messageCapacity()     = capacityMeter.d_monitor.messageCapacity();
-    state->numMessagesReserved() = capacityMeter.d_nbMessagesReserved;
-    state->numBytes()            = capacityMeter.d_monitor.bytes();
-    state->byteCapacity()        = capacityMeter.d_monitor.byteCapacity();
-    state->numBytesReserved()    = capacityMeter.d_nbBytesReserved;
+    state->numMessages()         = capacityMeter.d_nbMessages.load();
+    state->messageCapacity()     = capacityMeter.d_messageCapacity.load();
+    state->numMessagesReserved() = capacityMeter.d_nbMessagesReserved.load();
+    state->numBytes()            = capacityMeter.d_nbBytes.load();
+    state->byteCapacity()        = capacityMeter.d_byteCapacity.load();
+    state->numBytesReserved()    = capacityMeter.d_nbBytesReserved.load();
 
     if (capacityMeter.d_parent_p) {
         mqbcmd::CapacityMeter& parent = state->parent().makeValue();
@@ -69,8 +69,8 @@
 // keeps track of the resources.  In certain situations, interfaces and APIs
 // require to use a meter, but the object doesn't care about resource
 // management: this is the case for example for a remote domain or queue.
-// Because resource tracking has a cost (spinLock, ...), the meter can be
-// entirely disabled.  Once disabled APIs such as 'reserve' will always
+// Because resource tracking has a cost (atomic operations, ...), the meter
+// can be entirely disabled.  Once disabled APIs such as 'reserve' will always
 // authorize what was asked, but 'commit' or 'remove' will not update any
 // internal state.  This means that a disabled meter is pretty much a void
 // pass-through object.
@@ -81,6 +81,18 @@
 // 'bsldoc_glossary'), meaning that two threads can safely call any methods on
 // the *same* *instance* without external synchronization.
 //
+// The numbers of messages and bytes committed and reserved are kept in atomic
+// counters: 'reserve' and 'commitUnreserved' optimistically reserve or commit
+// resources with compare-and-swap loops, and 'commit', 'release', 'remove' and
+// the accessors are lock-free.  The state of the watermarks (which drives the
+// alarms logged) is only updated, under a spin lock, when the counters reach
+// the high watermark, or while the meter is not in the normal state, so that
+// the common case of a meter far from its limits never contends on a lock.
+// Note that 'commitUnreserved' rolls back its commit when the meter or its
+// parent has no capacity left, so that a concurrent 'commitUnreserved' may
+// briefly observe, and be refused because of, resources which end up not
+// being committed.
+//
 /// Usage Example
 ///-------------
 // This example shows typical usage of the 'CapacityMeter' object.
@@ -159,6 +171,7 @@
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_atomic.h>
 #include <bsls_spinlock.h>
 #include <bsls_types.h>
 
@@ -206,22 +219,71 @@ class CapacityMeter {
 
     ResourceUsageMonitor d_monitor;
     // Monitor for the bytes and messages capacity
-    // of this meter
+    // of this meter.  Its values lag behind
+    // 'd_nbMessages' and 'd_nbBytes', and are only
+    // brought up to date, under 'd_lock', when a
+    // state transition may have occurred.
+
+    bsls::AtomicInt64 d_nbMessages;
+    // Number of messages committed
+
+    bsls::AtomicInt64 d_nbBytes;
+    // Number of bytes committed
 
-    bsls::Types::Int64 d_nbMessagesReserved;
+    bsls::AtomicInt64 d_nbMessagesReserved;
     // Number of messages reserved
 
-    bsls::Types::Int64 d_nbBytesReserved;
+    bsls::AtomicInt64 d_nbBytesReserved;
     // Number of bytes reserved
 
+    bsls::AtomicInt64 d_messageCapacity;
+    // Message capacity of 'd_monitor'
+
+    bsls::AtomicInt64 d_byteCapacity;
+    // Byte capacity of 'd_monitor'
+
+    bsls::AtomicInt64 d_messageHighWatermark;
+    // Number of messages at which 'd_monitor'
+    // leaves the normal state
+
+    bsls::AtomicInt64 d_byteHighWatermark;
+    // Number of bytes at which 'd_monitor' leaves
+    // the normal state
+
+    bsls::AtomicBool d_isMonitorNormal;
+    // True if 'd_monitor' is in the normal state,
+    // in which case no state transition can occur
+    // until the high watermark is reached
+
     mutable bsls::SpinLock d_lock;
-    // SpinLock for synchronization of this
-    // component
+    // SpinLock serializing the updates of
+    // 'd_monitor'
 
     // FRIENDS
     friend struct CapacityMeterUtil;
 
   private:
+    // PRIVATE MANIPULATORS
+
+    /// Bring the values of `d_monitor` up to date with the numbers of
+    /// messages and bytes committed, and return the resulting state
+    /// transition.  The behavior is undefined unless `d_lock` is held.
+    ResourceUsageMonitorStateTransition::Enum syncMonitor();
+
+    /// Store the capacities, high watermarks and state of `d_monitor` into
+    /// the atomic members mirroring them.  The behavior is undefined unless
+    /// `d_lock` is held.
+    void updateMonitorMirrors();
+
+    /// Update `d_monitor`, if the specified `messages` and `bytes`,
+    /// resulting from an update of the numbers of messages and bytes
+    /// committed, may have caused a state transition, and log that
+    /// transition.  Do not log a transition to the low watermark if the
+    /// specified `silentMode` is true.
+    void updateMonitor(bsls::Types::Int64 messages,
+                       bsls::Types::Int64 bytes,
+                       bool               silentMode);
+
     // PRIVATE ACCESSORS
 
     /// Function invoked to print, if necessary, the specified
@@ -360,6 +422,12 @@ class CapacityMeter {
     /// otherwise.
     const CapacityMeter* parent() const;
 
+    /// Return `true` if the messages or bytes committed to this meter, or
+    /// to any of its ancestors, reached the high watermark and did not yet
+    /// fall back to the low watermark, and `false` otherwise.  Note that a
+    /// disabled meter never reaches its high watermark.
+    bool isHighWatermarkReached() const;
+
     /// Format this object to the specified output `stream` at the (absolute
     /// value of) the optionally specified indentation `level` and return a
     /// reference to `stream`.  If `level` is specified, optionally specify
@@ -415,8 +483,7 @@ inline bsls::Types::Int64 CapacityMeter::messages() const
         return 0;  // RETURN
     }
 
-    bsls::SpinLockGuard guard(&d_lock);  // d_lock LOCK
-    return d_monitor.messages();
+    return d_nbMessages.loadRelaxed();
 }
 
 inline bsls::Types::Int64 CapacityMeter::bytes() const
@@ -425,20 +492,17 @@ inline bsls::Types::Int64 CapacityMeter::bytes() const
         return 0;  // RETURN
     }
 
-    bsls::SpinLockGuard guard(&d_lock);  // d_lock LOCK
-    return d_monitor.bytes();
+    return d_nbBytes.loadRelaxed();
 }
 
 inline bsls::Types::Int64 CapacityMeter::messageCapacity() const
 {
-    bsls::SpinLockGuard guard(&d_lock);  // d_lock LOCK
-    return d_monitor.messageCapacity();
+    return d_messageCapacity.loadRelaxed();
 }
 
 inline bsls::Types::Int64 CapacityMeter::byteCapacity() const
 {
-    bsls::SpinLockGuard guard(&d_lock);  // d_lock LOCK
-    return d_monitor.byteCapacity();
+    return d_byteCapacity.loadRelaxed();
 }
 
 inline const CapacityMeter* CapacityMeter::parent() const
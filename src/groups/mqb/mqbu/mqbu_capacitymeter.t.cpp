@@ -23,6 +23,11 @@
 // BDE
 #include <ball_log.h>
 #include <ball_severity.h>
+#include <bdlf_bind.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
 #include <bsls_assert.h>
 #include <bsls_types.h>
 
@@ -33,6 +38,54 @@
 using namespace BloombergLP;
 using namespace bsl;
 
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Reserve, commit and then remove, the specified `numIterations` times,
+/// one message of the specified `messageSize` bytes on the specified
+/// `capacityMeter`.
+void reserveCommitRemove(mqbu::CapacityMeter* capacityMeter,
+                         int                  numIterations,
+                         bsls::Types::Int64   messageSize)
+{
+    for (int i = 0; i < numIterations; ++i) {
+        bsls::Types::Int64 nbMessagesAvailable;
+        bsls::Types::Int64 nbBytesAvailable;
+        capacityMeter->reserve(&nbMessagesAvailable,
+                               &nbBytesAvailable,
+                               1,
+                               messageSize);
+        if (nbMessagesAvailable != 1 || nbBytesAvailable != messageSize) {
+            capacityMeter->release(nbMessagesAvailable, nbBytesAvailable);
+            continue;  // CONTINUE
+        }
+
+        capacityMeter->commit(1, messageSize);
+        ASSERT_LE(capacityMeter->messages(),
+                  capacityMeter->messageCapacity());
+        capacityMeter->remove(1, messageSize, true);
+    }
+}
+
+/// Wait on the specified `barrier`, then commit unreserved, the specified
+/// `numIterations` times, one message of the specified `messageSize` bytes
+/// on the specified `capacityMeter`, without ever removing it.
+void commitUnreservedLoop(mqbu::CapacityMeter* capacityMeter,
+                          bslmt::Barrier*      barrier,
+                          int                  numIterations,
+                          bsls::Types::Int64   messageSize)
+{
+    barrier->wait();
+
+    for (int i = 0; i < numIterations; ++i) {
+        capacityMeter->commitUnreserved(1, messageSize);
+    }
+}
+
+}  // close unnamed namespace
+
 // ============================================================================
 //                                    TESTS
 // ----------------------------------------------------------------------------
@@ -230,6 +283,229 @@ static void test2_logStateChange()
     }
 }
 
+static void test3_concurrentReserveCommit()
+// ------------------------------------------------------------------------
+// CONCURRENT RESERVE COMMIT
+//
+// Concerns:
+//   1. Concurrently reserving, committing and removing resources never
+//      commits more than the capacity of the meter and of its parent.
+//   2. Once all the threads are done, no resource remains committed or
+//      reserved.
+//
+// Plan:
+//   Have several threads reserve, commit and remove one message at a time
+//   on child meters sharing a parent having a capacity lower than the sum
+//   of the capacities of its children.
+//
+// Testing:
+//   reserve
+//   release
+//   commit
+//   remove
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("CONCURRENT RESERVE COMMIT");
+
+    s_ignoreCheckDefAlloc = true;
+    // Logging infrastructure allocates using the default allocator, and
+    // that logging is beyond the control of this function.
+
+    const int                k_NUM_THREADS    = 4;
+    const int                k_NUM_ITERATIONS = 10000;
+    const bsls::Types::Int64 k_MESSAGE_SIZE   = 16;
+
+    mqbu::CapacityMeter parent("parent", s_allocator_p);
+    parent.setLimits(k_NUM_THREADS, k_NUM_THREADS * k_MESSAGE_SIZE);
+
+    mqbu::CapacityMeter child1("child1", &parent, s_allocator_p);
+    mqbu::CapacityMeter child2("child2", &parent, s_allocator_p);
+    child1.setLimits(k_NUM_THREADS, k_NUM_THREADS * k_MESSAGE_SIZE);
+    child2.setLimits(k_NUM_THREADS, k_NUM_THREADS * k_MESSAGE_SIZE);
+
+    bslmt::ThreadGroup threadGroup(s_allocator_p);
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        const int rc = threadGroup.addThread(
+            bdlf::BindUtil::bindS(s_allocator_p,
+                                  &reserveCommitRemove,
+                                  i % 2 ? &child1 : &child2,
+                                  k_NUM_ITERATIONS,
+                                  k_MESSAGE_SIZE));
+        ASSERT_EQ_D(i, rc, 0);
+    }
+    threadGroup.joinAll();
+
+    ASSERT_EQ(child1.messages(), 0);
+    ASSERT_EQ(child1.bytes(), 0);
+    ASSERT_EQ(child2.messages(), 0);
+    ASSERT_EQ(child2.bytes(), 0);
+    ASSERT_EQ(parent.messages(), 0);
+    ASSERT_EQ(parent.bytes(), 0);
+
+    // All the reservations were released or committed: the whole capacity
+    // can be reserved again.
+    bsls::Types::Int64 nbMessagesAvailable;
+    bsls::Types::Int64 nbBytesAvailable;
+    child1.reserve(&nbMessagesAvailable,
+                   &nbBytesAvailable,
+                   k_NUM_THREADS,
+                   k_NUM_THREADS * k_MESSAGE_SIZE);
+    ASSERT_EQ(nbMessagesAvailable, k_NUM_THREADS);
+    ASSERT_EQ(nbBytesAvailable, k_NUM_THREADS * k_MESSAGE_SIZE);
+    child1.release(nbMessagesAvailable, nbBytesAvailable);
+}
+
+static void test4_highWatermarkReached()
+// ------------------------------------------------------------------------
+// HIGH WATERMARK REACHED
+//
+// Concerns:
+//   1. 'isHighWatermarkReached' is 'true' from the time the resources of
+//      the meter reach the high watermark until they fall below the low
+//      watermark.
+//   2. 'isHighWatermarkReached' is 'true' if the high watermark of the
+//      parent of the meter is reached.
+//   3. 'isHighWatermarkReached' is always 'false' for a disabled meter.
+//
+// Plan:
+//   1. Commit and remove resources across the watermarks of a meter and
+//      its parent, and check 'isHighWatermarkReached' at each step.
+//
+// Testing:
+//   isHighWatermarkReached
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("HIGH WATERMARK REACHED");
+
+    s_ignoreCheckDefAlloc = true;
+    // Logging infrastructure allocates using the default allocator, and
+    // that logging is beyond the control of this function.
+
+    mqbu::CapacityMeter parent("parent", s_allocator_p);
+    parent.setLimits(100, 1000).setWatermarkThresholds(0.8, 0.8);
+
+    mqbu::CapacityMeter child("child", &parent, s_allocator_p);
+    child.setLimits(10, 1000).setWatermarkThresholds(0.8, 0.8);
+
+    mqbu::CapacityMeter sibling("sibling", &parent, s_allocator_p);
+    sibling.setLimits(100, 1000).setWatermarkThresholds(0.8, 0.8);
+
+    ASSERT(!child.isHighWatermarkReached());
+
+    // 1. High watermark of the child, then back below its low watermark
+    child.commitUnreserved(7, 7);
+    ASSERT(!child.isHighWatermarkReached());
+
+    child.commitUnreserved(1, 1);
+    ASSERT(child.isHighWatermarkReached());
+    ASSERT(!sibling.isHighWatermarkReached());
+
+    child.remove(3, 3, true);
+    ASSERT(child.isHighWatermarkReached());
+
+    child.remove(2, 2, true);
+    ASSERT(!child.isHighWatermarkReached());
+
+    // 2. High watermark of the parent
+    sibling.commitUnreserved(1, 800);
+    ASSERT(sibling.isHighWatermarkReached());
+    ASSERT(child.isHighWatermarkReached());
+
+    sibling.remove(1, 800, true);
+    ASSERT(!child.isHighWatermarkReached());
+
+    child.remove(3, 3, true);
+
+    // 3. Disabled meter
+    mqbu::CapacityMeter disabled("disabled", s_allocator_p);
+    disabled.disable();
+    disabled.commitUnreserved(1, 1);
+    ASSERT(!disabled.isHighWatermarkReached());
+}
+
+static void test5_concurrentCommitUnreserved()
+// ------------------------------------------------------------------------
+// CONCURRENT COMMIT UNRESERVED
+//
+// Concerns:
+//   1. Concurrently committing unreserved resources on meters sharing a
+//      parent exceeds the capacity of the parent exactly once, however
+//      many threads commit at the same time.
+//   2. A commit refused by the parent is rolled back from the child, so
+//      that the children account for exactly what the parent committed.
+//
+// Plan:
+//   Have several threads, each with its own child meter having a large
+//   capacity, commit one message at a time, starting all together, on a
+//   shared parent having a small capacity.
+//
+// Testing:
+//   commitUnreserved
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("CONCURRENT COMMIT UNRESERVED");
+
+    s_ignoreCheckDefAlloc = true;
+    // Logging infrastructure allocates using the default allocator, and
+    // that logging is beyond the control of this function.
+
+    const int                k_NUM_THREADS    = 8;
+    const int                k_NUM_ITERATIONS = 10000;
+    const bsls::Types::Int64 k_MESSAGE_SIZE   = 16;
+    const bsls::Types::Int64 k_PARENT_LIMIT   = 100;
+    const bsls::Types::Int64 k_CHILD_LIMIT    = k_NUM_ITERATIONS;
+
+    mqbu::CapacityMeter parent("parent", s_allocator_p);
+    parent.setLimits(k_PARENT_LIMIT, k_CHILD_LIMIT * k_MESSAGE_SIZE);
+
+    bsl::vector<bsl::shared_ptr<mqbu::CapacityMeter> > children(
+        s_allocator_p);
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        children.push_back(
+            bsl::allocate_shared<mqbu::CapacityMeter>(s_allocator_p,
+                                                      "child",
+                                                      &parent));
+        children.back()->setLimits(k_CHILD_LIMIT,
+                                   k_CHILD_LIMIT * k_MESSAGE_SIZE);
+    }
+
+    bslmt::Barrier     barrier(k_NUM_THREADS);
+    bslmt::ThreadGroup threadGroup(s_allocator_p);
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        const int rc = threadGroup.addThread(
+            bdlf::BindUtil::bindS(s_allocator_p,
+                                  &commitUnreservedLoop,
+                                  children[i].get(),
+                                  &barrier,
+                                  k_NUM_ITERATIONS,
+                                  k_MESSAGE_SIZE));
+        ASSERT_EQ_D(i, rc, 0);
+    }
+    threadGroup.joinAll();
+
+    // 1. The parent accepted one message past its capacity, and no more
+    ASSERT_EQ(parent.messages(), k_PARENT_LIMIT + 1);
+    ASSERT_EQ(parent.bytes(), (k_PARENT_LIMIT + 1) * k_MESSAGE_SIZE);
+
+    // 2. The children hold exactly what the parent committed
+    bsls::Types::Int64 childrenMessages = 0;
+    bsls::Types::Int64 childrenBytes    = 0;
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        childrenMessages += children[i]->messages();
+        childrenBytes += children[i]->bytes();
+    }
+    ASSERT_EQ(childrenMessages, parent.messages());
+    ASSERT_EQ(childrenBytes, parent.bytes());
+
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        children[i]->remove(children[i]->messages(),
+                            children[i]->bytes(),
+                            true);
+    }
+    ASSERT_EQ(parent.messages(), 0);
+    ASSERT_EQ(parent.bytes(), 0);
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -240,6 +516,9 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 5: test5_concurrentCommitUnreserved(); break;
+    case 4: test4_highWatermarkReached(); break;
+    case 3: test3_concurrentReserveCommit(); break;
     case 2: test2_logStateChange(); break;
     case 1: test1_breathingTest(); break;
     default: {
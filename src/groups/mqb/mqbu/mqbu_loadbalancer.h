@@ -27,6 +27,20 @@
 // processors by associating them with a processorId (an integer in the range
 // '[0 .. processorsCount() - 1]'.
 //
+/// Load-aware placement
+///--------------------
+// By default, a new client is associated with the processor having the
+// fewest clients, irrespective of the traffic they carry.  The owner of the
+// processors can periodically report the load of each processor (e.g., the
+// time it spent processing events during the last sampling interval) with
+// 'setProcessorLoad', in which case a new client is associated with the least
+// loaded processor (the one with the fewest clients among the least loaded
+// ones).  Since the reported loads do not account for the clients placed
+// since the last report, the load of the processor a client is placed on is
+// increased by the average load of a client (i.e., the total load divided by
+// the number of clients), until the next report, so that a burst of new
+// clients is still spread across the processors.
+//
 /// Thread Safety
 ///-------------
 // The 'mqbu::LoadBalancer' object is fully thread-safe, meaning that two
@@ -73,6 +87,7 @@
 #include <bslmt_mutex.h>
 #include <bslmt_mutexassert.h>
 #include <bsls_assert.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 namespace mqbu {
@@ -95,6 +110,14 @@ class LoadBalancer {
     bsl::vector<int> d_counters;
     // Client counters per processor
 
+    bsl::vector<bsls::Types::Int64> d_loads;
+    // Load per processor, as last reported with
+    // 'setProcessorLoad' and increased by the
+    // estimated load of the clients placed since
+
+    bool d_hasLoads;
+    // Whether a non-zero load was ever reported
+
     ClientMap d_clients;
     // Map between the registered clients and the
     // corresponding processorId
@@ -110,6 +133,11 @@ class LoadBalancer {
     /// clients associated with it.
     int findSmallestCounterLocked() const;
 
+    /// Return the id of the processor that have the lowest load, and the
+    /// lowest number of clients associated with it among the ones having
+    /// that load.
+    int findSmallestLoadLocked() const;
+
   private:
     // NOT IMPLEMENTED
 
@@ -150,6 +178,14 @@ class LoadBalancer {
     /// processor.
     void removeClient(const TYPE* client);
 
+    /// Set the load of the specified `processorId` to the specified `load`,
+    /// in an arbitrary unit which must be the same for all processors.  New
+    /// clients are associated with the least loaded processor once a
+    /// non-zero load has been reported (see "Load-aware placement" in the
+    /// component documentation).  The behavior is undefined unless
+    /// `0 <= processorId < processorsCount()` and `0 <= load`.
+    void setProcessorLoad(int processorId, bsls::Types::Int64 load);
+
     // ACCESSORS
 
     /// Return the number of processors configured for this object.
@@ -162,6 +198,12 @@ class LoadBalancer {
     /// `processorId`.  The behavior is undefined unless '0 <= processorId <
     /// processorsCount()'.
     int clientsCountForProcessor(int processorId) const;
+
+    /// Return the load of the specified `processorId`, as last reported
+    /// with `setProcessorLoad` and increased by the estimated load of the
+    /// clients associated to it since.  The behavior is undefined unless
+    /// '0 <= processorId < processorsCount()'.
+    bsls::Types::Int64 processorLoad(int processorId) const;
 };
 
 // ============================================================================
@@ -183,10 +225,30 @@ int LoadBalancer<TYPE>::findSmallestCounterLocked() const
                                           d_counters.end()));
 }
 
+template <class TYPE>
+int LoadBalancer<TYPE>::findSmallestLoadLocked() const
+{
+    // PRECONDITIONS
+    BSLMT_MUTEXASSERT_IS_LOCKED_SAFE(&d_mutex);  // d_mutex was LOCKED
+
+    int processorId = 0;
+    for (int i = 1; i < static_cast<int>(d_loads.size()); ++i) {
+        if (d_loads[i] < d_loads[processorId] ||
+            (d_loads[i] == d_loads[processorId] &&
+             d_counters[i] < d_counters[processorId])) {
+            processorId = i;
+        }
+    }
+
+    return processorId;
+}
+
 template <class TYPE>
 LoadBalancer<TYPE>::LoadBalancer(int               numProcessors,
                                  bslma::Allocator* allocator)
 : d_counters(numProcessors, 0, allocator)
+, d_loads(numProcessors, 0, allocator)
+, d_hasLoads(false)
 , d_clients(allocator)
 , d_mutex()
 {
@@ -206,6 +268,26 @@ int LoadBalancer<TYPE>::getProcessorForClient(const TYPE* client)
     }
 
     // This is brand new client
+    if (d_hasLoads) {
+        const int processorId = findSmallestLoadLocked();
+
+        // Account for the load the new client will likely bring, until the
+        // next report of the loads.
+        if (!d_clients.empty()) {
+            bsls::Types::Int64 totalLoad = 0;
+            for (size_t i = 0; i < d_loads.size(); ++i) {
+                totalLoad += d_loads[i];
+            }
+            d_loads[processorId] += totalLoad /
+                                    static_cast<int>(d_clients.size());
+        }
+
+        d_counters[processorId] += 1;
+        d_clients[client] = processorId;
+
+        return processorId;  // RETURN
+    }
+
     int processorId = findSmallestCounterLocked();
 
     // Add the client to the map and bump the counter for the selected
@@ -249,6 +331,22 @@ void LoadBalancer<TYPE>::removeClient(const TYPE* client)
     d_clients.erase(it);
 }
 
+template <class TYPE>
+void LoadBalancer<TYPE>::setProcessorLoad(int                processorId,
+                                          bsls::Types::Int64 load)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // d_mutex LOCKED
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= processorId && processorId < processorsCount());
+    BSLS_ASSERT_SAFE(0 <= load);
+
+    d_loads[processorId] = load;
+    if (load != 0) {
+        d_hasLoads = true;
+    }
+}
+
 template <class TYPE>
 int LoadBalancer<TYPE>::processorsCount() const
 {
@@ -273,6 +371,17 @@ int LoadBalancer<TYPE>::clientsCountForProcessor(int processorId) const
     return d_counters[processorId];
 }
 
+template <class TYPE>
+bsls::Types::Int64 LoadBalancer<TYPE>::processorLoad(int processorId) const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // d_mutex LOCKED
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(processorId >= 0 && processorId < processorsCount());
+
+    return d_loads[processorId];
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -227,6 +227,57 @@ static void test4_forceAssociate()
         obj.setProcessorForClient(reinterpret_cast<MyDummyType*>(4), -1));
 }
 
+static void test5_loadAwarePlacement()
+{
+    mwctst::TestHelper::printTestName("LOAD AWARE PLACEMENT");
+
+    const int                       k_NUM_PROCESSORS = 3;
+    mqbu::LoadBalancer<MyDummyType> obj(k_NUM_PROCESSORS, s_allocator_p);
+
+    PV(":: Register one client per processor");
+    for (int i = 0; i < k_NUM_PROCESSORS; ++i) {
+        ASSERT_EQ(obj.getProcessorForClient(reinterpret_cast<MyDummyType*>(i)),
+                  i);
+        ASSERT_EQ(obj.processorLoad(i), 0);
+    }
+
+    PV(":: Report a busy processor '0' and idle processor '2'");
+    obj.setProcessorLoad(0, 900);
+    obj.setProcessorLoad(1, 300);
+    obj.setProcessorLoad(2, 0);
+    ASSERT_EQ(obj.processorLoad(0), 900);
+
+    // The new client goes to the least loaded processor, even though all of
+    // them have the same number of clients, and the load of that processor
+    // is increased by the average load of a client (1200 / 3).
+    ASSERT_EQ(obj.getProcessorForClient(reinterpret_cast<MyDummyType*>(10)),
+              2);
+    ASSERT_EQ(obj.processorLoad(2), 400);
+    ASSERT_EQ(obj.clientsCountForProcessor(2), 2);
+
+    // Processor '1' is now the least loaded one
+    ASSERT_EQ(obj.getProcessorForClient(reinterpret_cast<MyDummyType*>(11)),
+              1);
+    ASSERT_EQ(obj.processorLoad(1), 300 + 1600 / 4);
+
+    PV(":: Same loads, fewest clients");
+    obj.setProcessorLoad(0, 100);
+    obj.setProcessorLoad(1, 50);
+    obj.setProcessorLoad(2, 50);
+    obj.removeClient(reinterpret_cast<MyDummyType*>(11));
+
+    // Processors '1' and '2' have the same load, '1' has fewer clients
+    ASSERT_EQ(obj.clientsCountForProcessor(1), 1);
+    ASSERT_EQ(obj.clientsCountForProcessor(2), 2);
+    ASSERT_EQ(obj.getProcessorForClient(reinterpret_cast<MyDummyType*>(12)),
+              1);
+
+    // Explicit association is not affected by the loads
+    obj.setProcessorForClient(reinterpret_cast<MyDummyType*>(13), 0);
+    ASSERT_EQ(obj.getProcessorForClient(reinterpret_cast<MyDummyType*>(13)),
+              0);
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -237,6 +288,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 5: test5_loadAwarePlacement(); break;
     case 4: test4_forceAssociate(); break;
     case 3: test3_loadBalancing(); break;
     case 2: test2_singleProcessorLoadBalancer(); break;
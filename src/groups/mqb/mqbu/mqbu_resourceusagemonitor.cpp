@@ -147,7 +147,7 @@ const char* ResourceUsageMonitorStateTransition::toAscii(
 
 // PRIVATE MANIPULATORS
 ResourceUsageMonitorStateTransition::Enum
-ResourceUsageMonitor::updateValueInternal(ResourceAttributes* attributes,
+ResourceUsageMonitor::updateValueSlowPath(ResourceAttributes* attributes,
                                           bsls::Types::Int64  delta)
 {
     // PRECONDITIONS
@@ -231,6 +231,41 @@ ResourceUsageMonitor::updateValueInternal(ResourceAttributes* attributes,
     return ret;
 }
 
+ResourceUsageMonitorStateTransition::Enum
+ResourceUsageMonitor::updateSlowPath(bsls::Types::Int64 bytesDelta,
+                                     bsls::Types::Int64 messagesDelta)
+{
+    // TYPES
+    typedef ResourceUsageMonitorStateTransition RUMStateTransition;
+    typedef ResourceUsageMonitorState           RUMState;
+
+    RUMState::Enum stateBefore = state();
+
+    RUMStateTransition::Enum byteStateTransition    = updateBytes(bytesDelta);
+    RUMStateTransition::Enum messageStateTransition = updateMessages(
+        messagesDelta);
+
+    RUMState::Enum stateAfter = state();
+
+    // An individual resource's state might have changed and yet the overall
+    // state of the monitor has not.
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(stateBefore == stateAfter)) {
+        // Monitor state has not changed
+        return RUMStateTransition::e_NO_CHANGE;  // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    // Monitor state has changed. At the time of this writing, this necessarily
+    // means that there was a state transition in bytes, messages, or both.  We
+    // return the change in state of the monitor with respect to the highest
+    // limit reached for either bytes or messages.
+    // NOTE: Below assumes that the ResourceUsageMonitorStateTransition Enum is
+    //       in increasing order of limit reached (after 'e_NO_CHANGE' as it
+    //       comes first)
+    return bsl::max(byteStateTransition, messageStateTransition);
+}
+
 // CREATORS
 ResourceUsageMonitor::ResourceUsageMonitor(bsls::Types::Int64 byteCapacity,
                                            bsls::Types::Int64 messageCapacity)
@@ -457,41 +492,6 @@ void ResourceUsageMonitor::reconfigureByRatio(
     }
 }
 
-ResourceUsageMonitorStateTransition::Enum
-ResourceUsageMonitor::update(bsls::Types::Int64 bytesDelta,
-                             bsls::Types::Int64 messagesDelta)
-{
-    // TYPES
-    typedef ResourceUsageMonitorStateTransition RUMStateTransition;
-    typedef ResourceUsageMonitorState           RUMState;
-
-    RUMState::Enum stateBefore = state();
-
-    RUMStateTransition::Enum byteStateTransition    = updateBytes(bytesDelta);
-    RUMStateTransition::Enum messageStateTransition = updateMessages(
-        messagesDelta);
-
-    RUMState::Enum stateAfter = state();
-
-    // An individual resource's state might have changed and yet the overall
-    // state of the monitor has not.
-    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(stateBefore == stateAfter)) {
-        // Monitor state has not changed
-        return RUMStateTransition::e_NO_CHANGE;  // RETURN
-    }
-
-    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-
-    // Monitor state has changed. At the time of this writing, this necessarily
-    // means that there was a state transition in bytes, messages, or both.  We
-    // return the change in state of the monitor with respect to the highest
-    // limit reached for either bytes or messages.
-    // NOTE: Below assumes that the ResourceUsageMonitorStateTransition Enum is
-    //       in increasing order of limit reached (after 'e_NO_CHANGE' as it
-    //       comes first)
-    return bsl::max(byteStateTransition, messageStateTransition);
-}
-
 // ACCESSORS
 bsl::ostream& ResourceUsageMonitor::print(bsl::ostream& stream,
                                           int           level,
@@ -53,6 +53,16 @@
 //:   'byteCapacity' parameter, the monitor emits 'FULL' and enters the 'FULL'
 //:   state with respect to bytes.
 //
+/// Performance
+///-----------
+// 'update' is invoked for every message added to or removed from a storage,
+// so it is split into an inline fast path and an out-of-line slow path.  Each
+// resource caches the range of values within which no state transition can
+// occur in its current state (for instance, any value below the high
+// watermark in the 'NORMAL' state): as long as the updated values stay in
+// their ranges, an update costs two integer comparisons per resource, and
+// only the updates crossing a boundary evaluate the state transitions.
+//
 /// Thread Safety
 ///-------------
 // NOT Thread-Safe.
@@ -119,7 +129,9 @@
 // BDE
 #include <bsl_algorithm.h>
 #include <bsl_iosfwd.h>
+#include <bsl_limits.h>
 #include <bsls_assert.h>
+#include <bsls_performancehint.h>
 #include <bsls_types.h>
 
 namespace BloombergLP {
@@ -258,6 +270,20 @@ class ResourceUsageMonitor {
         // current resource usage value
         ResourceUsageMonitorState::Enum d_state;
         // current state of the monitor
+        bsls::Types::Int64 d_quietLowerBound;
+        // value above which no state transition
+        // can occur in the current state
+        bsls::Types::Int64 d_quietUpperBound;
+        // value below which no state transition
+        // can occur in the current state
+
+      private:
+        // PRIVATE MANIPULATORS
+
+        /// Compute the range of values within which no state transition
+        /// can occur, from the current state, capacity and watermark
+        /// ratios.
+        void updateQuietBounds();
 
       public:
         // CREATORS
@@ -290,6 +316,11 @@ class ResourceUsageMonitor {
 
         /// Get the value of the corresponding attribute.
         ResourceUsageMonitorState::Enum state() const;
+
+        /// Return `true` if changing the value of this resource to the
+        /// specified `value` cannot cause a state transition, and `false`
+        /// if it may.
+        bool isQuiet(bsls::Types::Int64 value) const;
     };
 
   private:
@@ -309,6 +340,20 @@ class ResourceUsageMonitor {
     updateValueInternal(ResourceAttributes* attributes,
                         bsls::Types::Int64  delta);
 
+    /// Slow path of `updateValueInternal`, evaluating the state transitions
+    /// caused by a change of the specified `delta` in the value stored in
+    /// the specified `attributes`.
+    ResourceUsageMonitorStateTransition::Enum
+    updateValueSlowPath(ResourceAttributes* attributes,
+                        bsls::Types::Int64  delta);
+
+    /// Slow path of `update`, evaluating the state transitions caused by a
+    /// change of the specified `bytesDelta` and `messagesDelta` in the
+    /// values of bytes and messages being monitored.
+    ResourceUsageMonitorStateTransition::Enum
+    updateSlowPath(bsls::Types::Int64 bytesDelta,
+                   bsls::Types::Int64 messagesDelta);
+
   public:
     // CREATORS
 
@@ -489,11 +534,48 @@ inline ResourceUsageMonitor::ResourceAttributes::ResourceAttributes(
 , d_highWatermarkRatio(highWatermarkRatio)
 , d_value(value)
 , d_state(state)
+, d_quietLowerBound(0)
+, d_quietUpperBound(0)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(0.0 <= d_lowWatermarkRatio &&
                      d_lowWatermarkRatio <= d_highWatermarkRatio &&
                      d_highWatermarkRatio <= 1.0);
+
+    updateQuietBounds();
+}
+
+// PRIVATE MANIPULATORS
+inline void ResourceUsageMonitor::ResourceAttributes::updateQuietBounds()
+{
+    // NOTE: The watermarks are computed the same way as in
+    //       'ResourceUsageMonitor::updateValueSlowPath', and the bounds are
+    //       exclusive: a value equal to a bound takes the slow path.
+    const bsls::Types::Int64 lowWatermark = d_capacity * d_lowWatermarkRatio;
+    const bsls::Types::Int64 highWatermark = d_capacity *
+                                             d_highWatermarkRatio;
+
+    switch (d_state) {
+    case ResourceUsageMonitorState::e_STATE_NORMAL: {
+        // Only reaching the high watermark leaves the 'NORMAL' state
+        d_quietLowerBound = bsl::numeric_limits<bsls::Types::Int64>::min();
+        d_quietUpperBound = highWatermark;
+    } break;
+    case ResourceUsageMonitorState::e_STATE_HIGH_WATERMARK: {
+        d_quietLowerBound = lowWatermark;
+        d_quietUpperBound = d_capacity;
+    } break;
+    case ResourceUsageMonitorState::e_STATE_FULL: {
+        // Only going down to the high watermark leaves the 'FULL' state
+        d_quietLowerBound = highWatermark;
+        d_quietUpperBound = bsl::numeric_limits<bsls::Types::Int64>::max();
+    } break;
+    default: {
+        // Always take the slow path
+        d_quietLowerBound = bsl::numeric_limits<bsls::Types::Int64>::max();
+        d_quietUpperBound = bsl::numeric_limits<bsls::Types::Int64>::min();
+    }
+    }
 }
 
 // MANIPULATORS
@@ -501,6 +583,7 @@ inline ResourceUsageMonitor::ResourceAttributes&
 ResourceUsageMonitor::ResourceAttributes::setCapacity(bsls::Types::Int64 value)
 {
     d_capacity = value;
+    updateQuietBounds();
     return *this;
 }
 
@@ -511,6 +594,7 @@ ResourceUsageMonitor::ResourceAttributes::setLowWatermarkRatio(double value)
     BSLS_ASSERT_SAFE(0.0 <= value && value <= d_highWatermarkRatio);
 
     d_lowWatermarkRatio = value;
+    updateQuietBounds();
     return *this;
 }
 
@@ -521,6 +605,7 @@ ResourceUsageMonitor::ResourceAttributes::setHighWatermarkRatio(double value)
     BSLS_ASSERT_SAFE(d_lowWatermarkRatio <= value && value <= 1.0);
 
     d_highWatermarkRatio = value;
+    updateQuietBounds();
     return *this;
 }
 
@@ -536,6 +621,7 @@ ResourceUsageMonitor::ResourceAttributes::setState(
     ResourceUsageMonitorState::Enum value)
 {
     d_state = value;
+    updateQuietBounds();
     return *this;
 }
 
@@ -548,6 +634,7 @@ ResourceUsageMonitor::ResourceAttributes::setWatermarkRatios(double low,
 
     d_lowWatermarkRatio  = low;
     d_highWatermarkRatio = high;
+    updateQuietBounds();
     return *this;
 }
 
@@ -582,11 +669,52 @@ ResourceUsageMonitor::ResourceAttributes::state() const
     return d_state;
 }
 
+inline bool ResourceUsageMonitor::ResourceAttributes::isQuiet(
+    bsls::Types::Int64 value) const
+{
+    return d_quietLowerBound < value && value < d_quietUpperBound;
+}
+
 // --------------------------
 // class ResourceUsageMonitor
 // --------------------------
 
+// PRIVATE MANIPULATORS
+inline ResourceUsageMonitorStateTransition::Enum
+ResourceUsageMonitor::updateValueInternal(ResourceAttributes* attributes,
+                                          bsls::Types::Int64  delta)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(attributes);
+
+    const bsls::Types::Int64 value = attributes->value() + delta;
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(attributes->isQuiet(value))) {
+        attributes->setValue(value);
+        return ResourceUsageMonitorStateTransition::e_NO_CHANGE;  // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    return updateValueSlowPath(attributes, delta);
+}
+
 // MANIPULATORS
+inline ResourceUsageMonitorStateTransition::Enum
+ResourceUsageMonitor::update(bsls::Types::Int64 bytesDelta,
+                             bsls::Types::Int64 messagesDelta)
+{
+    const bsls::Types::Int64 bytes    = d_bytes.value() + bytesDelta;
+    const bsls::Types::Int64 messages = d_messages.value() + messagesDelta;
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_bytes.isQuiet(bytes) &&
+                                            d_messages.isQuiet(messages))) {
+        d_bytes.setValue(bytes);
+        d_messages.setValue(messages);
+        return ResourceUsageMonitorStateTransition::e_NO_CHANGE;  // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    return updateSlowPath(bytesDelta, messagesDelta);
+}
+
 inline ResourceUsageMonitorStateTransition::Enum
 ResourceUsageMonitor::updateBytes(bsls::Types::Int64 delta)
 {
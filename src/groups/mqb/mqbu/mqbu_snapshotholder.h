@@ -0,0 +1,177 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbu_snapshotholder.h                                              -*-C++-*-
+#ifndef INCLUDED_MQBU_SNAPSHOTHOLDER
+#define INCLUDED_MQBU_SNAPSHOTHOLDER
+
+//@PURPOSE: Provide a thread-safe holder of the latest snapshot of a state.
+//
+//@CLASSES:
+//  mqbu::SnapshotHolder: holder of the latest immutable snapshot of a state
+//
+//@DESCRIPTION: 'mqbu::SnapshotHolder' holds the latest immutable snapshot of
+// some state (for example the internals of a queue), published by the thread
+// owning that state, along with the time it was taken.  Other threads (for
+// example the ones executing admin commands) can read the snapshot as long as
+// it is recent enough, instead of querying the owning thread each time.
+//
+// Snapshots are held by shared pointer to 'const', so that reading a snapshot
+// only copies a shared pointer under the lock, and a reader can keep using a
+// snapshot after a newer one has been published.
+//
+/// Thread Safety
+///-------------
+// Thread safe.
+//
+/// Usage
+///-----
+// The thread owning the state publishes a snapshot:
+//..
+//  bsl::shared_ptr<mqbcmd::QueueInternals> snapshot;
+//  snapshot.createInplace(allocator, allocator);
+//  loadInternals(snapshot.get());
+//  d_internalsSnapshot.publish(snapshot, mwcsys::Time::highResolutionTimer());
+//..
+// Other threads read it if it is no older than one second:
+//..
+//  bsl::shared_ptr<const mqbcmd::QueueInternals> snapshot =
+//      d_internalsSnapshot.get(bdlt::TimeUnitRatio::k_NS_PER_S,
+//                              mwcsys::Time::highResolutionTimer());
+//  if (!snapshot) {
+//      // No recent enough snapshot, ask the owning thread for a new one
+//  }
+//..
+
+// BDE
+#include <bsl_memory.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bsls_cpp11.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mqbu {
+
+// ====================
+// class SnapshotHolder
+// ====================
+
+/// Thread-safe holder of the latest immutable snapshot of a state.
+template <class TYPE>
+class SnapshotHolder {
+  public:
+    // TYPES
+    typedef bsl::shared_ptr<const TYPE> SnapshotSp;
+
+  private:
+    // DATA
+    mutable bslmt::Mutex d_mutex;
+    // Mutex protecting the members below.
+
+    SnapshotSp d_snapshot_sp;
+    // Latest published snapshot, if any.
+
+    bsls::Types::Int64 d_timestamp;
+    // Time, in nanoseconds, at which the
+    // latest snapshot was taken.
+
+  private:
+    // NOT IMPLEMENTED
+    SnapshotHolder(const SnapshotHolder&) BSLS_CPP11_DELETED;
+
+    /// Copy constructor and assignment operator are not implemented.
+    SnapshotHolder& operator=(const SnapshotHolder&) BSLS_CPP11_DELETED;
+
+  public:
+    // CREATORS
+
+    /// Create an empty holder.
+    SnapshotHolder();
+
+    // MANIPULATORS
+
+    /// Publish the specified `snapshot`, taken at the specified `timestamp`
+    /// (in nanoseconds, from an arbitrary but fixed origin, such as
+    /// `mwcsys::Time::highResolutionTimer()`), replacing the previous one.
+    void publish(const SnapshotSp& snapshot, bsls::Types::Int64 timestamp);
+
+    /// Discard the held snapshot, if any.
+    void reset();
+
+    // ACCESSORS
+
+    /// Return the held snapshot if it was taken no more than the specified
+    /// `maxAge` before the specified `now` time (both in nanoseconds), or
+    /// an empty shared pointer otherwise.
+    SnapshotSp get(bsls::Types::Int64 maxAge, bsls::Types::Int64 now) const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// --------------------
+// class SnapshotHolder
+// --------------------
+
+// CREATORS
+template <class TYPE>
+inline SnapshotHolder<TYPE>::SnapshotHolder()
+: d_mutex()
+, d_snapshot_sp()
+, d_timestamp(0)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline void SnapshotHolder<TYPE>::publish(const SnapshotSp&  snapshot,
+                                          bsls::Types::Int64 timestamp)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    d_snapshot_sp = snapshot;
+    d_timestamp   = timestamp;
+}
+
+template <class TYPE>
+inline void SnapshotHolder<TYPE>::reset()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    d_snapshot_sp.reset();
+}
+
+// ACCESSORS
+template <class TYPE>
+inline typename SnapshotHolder<TYPE>::SnapshotSp
+SnapshotHolder<TYPE>::get(bsls::Types::Int64 maxAge,
+                          bsls::Types::Int64 now) const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    if (!d_snapshot_sp || now - d_timestamp > maxAge) {
+        return SnapshotSp();  // RETURN
+    }
+
+    return d_snapshot_sp;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,103 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbu_snapshotholder.t.cpp                                          -*-C++-*-
+#include <mqbu_snapshotholder.h>
+
+// BDE
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   1. A default constructed holder has no snapshot.
+//   2. A published snapshot is returned until it is older than the
+//      requested maximum age.
+//   3. Publishing replaces the snapshot, without affecting the readers of
+//      the previous one.
+//   4. 'reset' discards the snapshot.
+//
+// Testing:
+//   SnapshotHolder()
+//   publish
+//   reset
+//   get
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    typedef mqbu::SnapshotHolder<bsl::string> Obj;
+
+    Obj obj;
+    ASSERT(!obj.get(1000, 0));
+
+    PVV("Publish");
+    bsl::shared_ptr<bsl::string> first;
+    first.createInplace(s_allocator_p, "first", s_allocator_p);
+    obj.publish(first, 100);
+
+    Obj::SnapshotSp snapshot = obj.get(1000, 100);
+    ASSERT(snapshot);
+    ASSERT_EQ(*snapshot, "first");
+    ASSERT(obj.get(1000, 1100));
+    ASSERT(!obj.get(1000, 1101));
+
+    PVV("Publish again");
+    bsl::shared_ptr<bsl::string> second;
+    second.createInplace(s_allocator_p, "second", s_allocator_p);
+    obj.publish(second, 2000);
+
+    ASSERT_EQ(*obj.get(1000, 2000), "second");
+    ASSERT_EQ(*snapshot, "first");
+
+    PVV("Reset");
+    obj.reset();
+    ASSERT(!obj.get(1000, 2000));
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
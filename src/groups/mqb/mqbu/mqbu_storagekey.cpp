@@ -24,6 +24,8 @@ namespace BloombergLP {
 namespace mqbu {
 
 BSLMF_ASSERT(StorageKey::e_KEY_LENGTH_BINARY == sizeof(StorageKey));
+BSLMF_ASSERT(StorageKey::e_KEY_LENGTH_BINARY == sizeof(unsigned int) + 1);
+// 'StorageKeyHashAlgo' folds the key as a 32-bit word and a last byte.
 
 // ----------------
 // class StorageKey
@@ -32,5 +34,11 @@ BSLMF_ASSERT(StorageKey::e_KEY_LENGTH_BINARY == sizeof(StorageKey));
 const char*      StorageKey::k_NULL_KEY_BUFFER("\0\0\0\0\0");
 const StorageKey StorageKey::k_NULL_KEY;
 
+// ------------------------
+// class StorageKeyHashAlgo
+// ------------------------
+
+const char StorageKeyHashAlgo::s_seedAnchor = 0;
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -43,6 +43,7 @@
 #include <bslmf_istriviallycopyable.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bsls_annotation.h>
+#include <bsls_assert.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
@@ -215,16 +216,28 @@ struct StorageKeyLess {
 // class StorageKeyHashAlgo
 // ========================
 
-/// This class provides a hashing algorithm for `mqbu::StorageKey`.  At the
-/// time of writing, this algorithm was found to be approximately X than the
-/// default hashing algorithm which comes with `bslh` package.
-/// Performance-critical applications may want to use this hashing algorithm
-/// instead of the default one.
+/// This class provides a hashing algorithm for `mqbu::StorageKey`, folding
+/// the bytes of the key with a seed which differs across processes (when
+/// the address space layout is randomized).  This algorithm is cheaper than
+/// the default hashing algorithm which comes with `bslh` package (see the
+/// benchmarks in the test driver of this component).  Performance-critical
+/// applications may want to use this hashing algorithm instead of the
+/// default one.  Note that the hash must never be persisted or exchanged
+/// between processes.
 class StorageKeyHashAlgo {
   private:
+    // CLASS DATA
+    static const char s_seedAnchor;
+    // Object whose address seeds the hash.
+
     // DATA
     bsls::Types::Uint64 d_result;
 
+    // PRIVATE CLASS METHODS
+
+    /// Return the seed of the hash in this process.
+    static bsls::Types::Uint64 seed();
+
   public:
     // TYPES
     typedef bsls::Types::Uint64 result_type;
@@ -374,6 +387,13 @@ inline bool StorageKeyLess::operator()(const StorageKey& lhs,
 // class StorageKeyHashAlgo
 // ------------------------
 
+// PRIVATE CLASS METHODS
+inline bsls::Types::Uint64 StorageKeyHashAlgo::seed()
+{
+    return static_cast<bsls::Types::Uint64>(
+        reinterpret_cast<bsls::Types::UintPtr>(&s_seedAnchor));
+}
+
 // CREATORS
 inline StorageKeyHashAlgo::StorageKeyHashAlgo()
 : d_result(0)
@@ -385,17 +405,26 @@ inline void
 StorageKeyHashAlgo::operator()(const void*                   data,
                                BSLS_ANNOTATION_UNUSED size_t numBytes)
 {
-    // 10K Keys
-    // --------
-    // o With 'mwcc::OrderedHashMap': Average of 17M insertions per second
-    //                                (compared to average of 12M insertions
-    //                                per second using the default hash)
-
-    d_result = 5381ULL;
-
-    const unsigned char* start = reinterpret_cast<const unsigned char*>(data);
-    d_result += (start[0]) + (start[1] << 8) + (start[2] << 16) +
-                (start[3] << 24);
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(numBytes == StorageKey::e_KEY_LENGTH_BINARY);
+
+    // All the bytes of the key are folded in a 64-bit word, which is mixed
+    // with the seed by a multiplication by a large odd constant (the 64-bit
+    // golden ratio) and a xor-shift, so that keys differing only by their
+    // last byte (such as those built from consecutive integers) spread over
+    // all the buckets.
+
+    const bsls::Types::Uint64 k_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+    unsigned int word;
+    bsl::memcpy(&word, data, sizeof(word));
+    const unsigned char lastByte = static_cast<const unsigned char*>(
+        data)[sizeof(word)];
+
+    d_result = ((static_cast<bsls::Types::Uint64>(lastByte) << 32 | word) ^
+                seed()) *
+               k_MULTIPLIER;
+    d_result ^= d_result >> 32;
 }
 
 inline StorageKeyHashAlgo::result_type StorageKeyHashAlgo::computeHash()
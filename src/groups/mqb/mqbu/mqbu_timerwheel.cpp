@@ -0,0 +1,276 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbu_timerwheel.cpp                                                -*-C++-*-
+#include <mqbu_timerwheel.h>
+
+#include <mqbscm_version.h>
+// BDE
+#include <bdlf_bind.h>
+#include <bsl_cstddef.h>
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mqbu {
+
+namespace {
+
+/// Return the duration of a tick of the wheel.
+bsls::TimeInterval tickInterval()
+{
+    bsls::TimeInterval tick;
+    tick.addMilliseconds(TimerWheel::k_TICK_MS);
+    return tick;
+}
+
+}  // close unnamed namespace
+
+// -----------------------
+// class TimerWheel::Timer
+// -----------------------
+
+TimerWheel::Timer::Timer(bslma::Allocator* basicAllocator)
+: d_callback(bsl::allocator_arg, basicAllocator)
+, d_deadline()
+, d_slot(-1)
+, d_prev_p(0)
+, d_next_p(0)
+{
+    // NOTHING
+}
+
+TimerWheel::Timer::~Timer()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_slot == -1);
+}
+
+// ----------------
+// class TimerWheel
+// ----------------
+
+// CONSTANTS
+const int TimerWheel::k_TICK_MS;
+const int TimerWheel::k_NUM_SLOTS;
+
+// PRIVATE MANIPULATORS
+void TimerWheel::onTick(unsigned int generation)
+{
+    // executed by the *SCHEDULER* thread
+
+    const bsls::TimeInterval tick = tickInterval();
+
+    bsl::vector<Callback> expiredCallbacks(d_allocator_p);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+        if (generation != d_generation) {
+            // The wheel was restarted, and this tick is stale.
+            return;  // RETURN
+        }
+
+        const bsls::TimeInterval now = d_scheduler_p->now();
+
+        // Visit the slots of the ticks elapsed since the last one processed,
+        // up to one revolution of the wheel (after which all slots have been
+        // visited).  A slot may hold timers expiring at a later revolution,
+        // hence the comparison with the deadline of each timer.
+        int numTicks = 0;
+        while (d_time + tick <= now) {
+            d_time += tick;
+            if (numTicks++ >= k_NUM_SLOTS) {
+                continue;  // CONTINUE
+            }
+
+            d_slot = (d_slot + 1) % k_NUM_SLOTS;
+
+            Timer* timer = d_slots[d_slot];
+            while (timer) {
+                Timer* next = timer->d_next_p;
+                if (timer->d_deadline <= now) {
+                    expiredCallbacks.push_back(timer->d_callback);
+                    timer->d_callback = bsl::nullptr_t();
+                    unlink(timer);
+                }
+                timer = next;
+            }
+        }
+
+        if (d_numTimers != 0) {
+            d_scheduler_p->scheduleEvent(
+                &d_eventHandle,
+                d_time + tick,
+                bdlf::BindUtil::bind(&TimerWheel::onTick, this, generation));
+        }
+        else {
+            d_eventHandle.release();
+        }
+    }  // close guard scope
+
+    // Fire the expired timers outside the mutex, in the order in which they
+    // were found, so that their callbacks can arm timers.
+    for (bsl::vector<Callback>::const_iterator it = expiredCallbacks.begin();
+         it != expiredCallbacks.end();
+         ++it) {
+        (*it)();
+    }
+}
+
+void TimerWheel::unlink(Timer* timer)
+{
+    // mutex LOCKED
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(timer->d_slot != -1);
+
+    if (timer->d_prev_p) {
+        timer->d_prev_p->d_next_p = timer->d_next_p;
+    }
+    else {
+        d_slots[timer->d_slot] = timer->d_next_p;
+    }
+    if (timer->d_next_p) {
+        timer->d_next_p->d_prev_p = timer->d_prev_p;
+    }
+
+    timer->d_slot   = -1;
+    timer->d_prev_p = 0;
+    timer->d_next_p = 0;
+
+    --d_numTimers;
+}
+
+// CREATORS
+TimerWheel::TimerWheel(bdlmt::EventScheduler* scheduler,
+                       bslma::Allocator*      basicAllocator)
+: d_scheduler_p(scheduler)
+, d_mutex()
+, d_slots(k_NUM_SLOTS,
+          static_cast<Timer*>(0),
+          bslma::Default::allocator(basicAllocator))
+, d_slot(0)
+, d_time()
+, d_numTimers(0)
+, d_generation(0)
+, d_eventHandle()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(scheduler);
+}
+
+TimerWheel::~TimerWheel()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_numTimers == 0);
+
+    d_scheduler_p->cancelEventAndWait(&d_eventHandle);
+}
+
+// MANIPULATORS
+void TimerWheel::arm(Timer*                    timer,
+                     const bsls::TimeInterval& deadline,
+                     const Callback&           callback)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(timer);
+    BSLS_ASSERT_SAFE(callback);
+
+    const bsls::TimeInterval tick = tickInterval();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    if (timer->d_slot != -1) {
+        unlink(timer);
+    }
+
+    if (d_numTimers == 0) {
+        // The wheel is idle: restart it from now.  Note that the tick of the
+        // previous generation, if any, may still be scheduled or running.
+        d_scheduler_p->cancelEvent(&d_eventHandle);
+
+        ++d_generation;
+        d_time = d_scheduler_p->now();
+        d_scheduler_p->scheduleEvent(
+            &d_eventHandle,
+            d_time + tick,
+            bdlf::BindUtil::bind(&TimerWheel::onTick, this, d_generation));
+    }
+
+    // Number of ticks, rounded up, until the deadline
+    bsls::Types::Int64 numTicks = 1;
+    if (deadline > d_time) {
+        const bsls::Types::Int64 tickNs = tick.totalNanoseconds();
+        numTicks = ((deadline - d_time).totalNanoseconds() + tickNs - 1) /
+                   tickNs;
+    }
+
+    const int slot = static_cast<int>((d_slot + numTicks) % k_NUM_SLOTS);
+
+    timer->d_callback = callback;
+    timer->d_deadline = deadline;
+    timer->d_slot     = slot;
+    timer->d_prev_p   = 0;
+    timer->d_next_p   = d_slots[slot];
+    if (d_slots[slot]) {
+        d_slots[slot]->d_prev_p = timer;
+    }
+    d_slots[slot] = timer;
+
+    ++d_numTimers;
+}
+
+bool TimerWheel::disarm(Timer* timer)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(timer);
+
+    // The callback is released outside the mutex, as releasing its bound
+    // arguments may have side effects.
+    Callback callback(bsl::allocator_arg, d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+        if (timer->d_slot == -1) {
+            return false;  // RETURN
+        }
+
+        unlink(timer);
+        callback          = timer->d_callback;
+        timer->d_callback = bsl::nullptr_t();
+    }
+
+    return true;
+}
+
+// ACCESSORS
+int TimerWheel::numTimers() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    return d_numTimers;
+}
+
+bdlmt::EventScheduler* TimerWheel::scheduler() const
+{
+    return d_scheduler_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
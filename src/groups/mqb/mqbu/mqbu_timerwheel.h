@@ -0,0 +1,248 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbu_timerwheel.h                                                  -*-C++-*-
+#ifndef INCLUDED_MQBU_TIMERWHEEL
+#define INCLUDED_MQBU_TIMERWHEEL
+
+//@PURPOSE: Provide a hashed timing wheel sharing one scheduler event.
+//
+//@CLASSES:
+//  mqbu::TimerWheel:        timers sharing one event of a scheduler
+//  mqbu::TimerWheel::Timer: timer armed on a 'mqbu::TimerWheel'
+//
+//@DESCRIPTION: 'mqbu::TimerWheel' provides coarse timers to a potentially
+// very large number of objects (for instance, one per client session), while
+// scheduling at most one event at a time on the provided
+// 'bdlmt::EventScheduler'.  This keeps the number of scheduler events, and
+// the cost of each scheduler operation, independent of the number of armed
+// timers: arming and disarming a timer are constant time operations, and
+// each tick only visits the timers of one slot of the wheel.  The tick event
+// is only scheduled for as long as at least one timer is armed.
+//
+// The timers are stored in 'k_NUM_SLOTS' slots, each one covering
+// 'k_TICK_MS' milliseconds.  A timer fires from the scheduler thread up to
+// one tick after its deadline: the wheel is only suitable for timers which
+// can tolerate that imprecision.
+//
+// Timers are intrusive: a 'mqbu::TimerWheel::Timer' is a member of the
+// object owning it, so that arming a timer does not allocate, other than to
+// copy the callback.
+//
+/// Thread Safety
+///-------------
+// 'mqbu::TimerWheel' is fully *thread-safe*, meaning that timers can be armed
+// and disarmed concurrently from any thread.  The callback of a timer is
+// invoked from the scheduler thread, without holding any lock, so that it
+// can arm timers of the wheel.  Note that disarming a timer does not wait for
+// its callback, if concurrently executing, to complete.
+//
+/// Usage
+///-----
+//..
+//  mqbu::TimerWheel        wheel(&scheduler, allocator);
+//  mqbu::TimerWheel::Timer timer(allocator);
+//
+//  wheel.arm(&timer,
+//            scheduler.now() + bsls::TimeInterval(1),
+//            bdlf::BindUtil::bind(&onTimer, ...));
+//
+//  // ...
+//
+//  wheel.disarm(&timer);
+//..
+
+// BDE
+#include <bdlmt_eventscheduler.h>
+#include <bsl_functional.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_mutex.h>
+#include <bsls_keyword.h>
+#include <bsls_timeinterval.h>
+
+namespace BloombergLP {
+namespace mqbu {
+
+// ================
+// class TimerWheel
+// ================
+
+/// Timers sharing one event of a scheduler.
+class TimerWheel {
+  public:
+    // TYPES
+
+    /// Signature of the callback invoked when a timer fires.
+    typedef bsl::function<void()> Callback;
+
+    // CONSTANTS
+
+    /// Resolution, in milliseconds, of the timers.
+    static const int k_TICK_MS = 100;
+
+    /// Number of slots of the wheel.
+    static const int k_NUM_SLOTS = 256;
+
+    // ===========
+    // class Timer
+    // ===========
+
+    /// Timer armed on a `TimerWheel`.
+    class Timer {
+      private:
+        // DATA
+        Callback d_callback;
+        // Callback to invoke when this timer
+        // fires.
+
+        bsls::TimeInterval d_deadline;
+        // Time at which this timer expires.
+
+        int d_slot;
+        // Slot of the wheel holding this
+        // timer, or -1 if not armed.
+
+        Timer* d_prev_p;
+        // Previous timer of the slot.
+
+        Timer* d_next_p;
+        // Next timer of the slot.
+
+        // FRIENDS
+        friend class TimerWheel;
+
+      private:
+        // NOT IMPLEMENTED
+        Timer(const Timer&) BSLS_KEYWORD_DELETED;
+        Timer& operator=(const Timer&) BSLS_KEYWORD_DELETED;
+
+      public:
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(Timer, bslma::UsesBslmaAllocator)
+
+        // CREATORS
+
+        /// Create a timer which is not armed.  Optionally specify a
+        /// `basicAllocator` used to supply memory.
+        explicit Timer(bslma::Allocator* basicAllocator = 0);
+
+        /// Destroy this object.  The behavior is undefined unless this
+        /// timer is not armed.
+        ~Timer();
+    };
+
+  private:
+    // PRIVATE TYPES
+
+    /// Each slot is the head of the intrusive list of its timers.
+    typedef bsl::vector<Timer*> Slots;
+
+    // DATA
+    bdlmt::EventScheduler* d_scheduler_p;
+    // Scheduler ticking the wheel.
+
+    mutable bslmt::Mutex d_mutex;
+    // Mutex protecting the members below.
+
+    Slots d_slots;
+    // Slots of the wheel.
+
+    int d_slot;
+    // Slot corresponding to the last tick
+    // processed.
+
+    bsls::TimeInterval d_time;
+    // Time of the last tick processed.
+
+    int d_numTimers;
+    // Number of armed timers.
+
+    unsigned int d_generation;
+    // Incremented each time the wheel is
+    // restarted, so that a tick of a
+    // previous generation is ignored.
+
+    bdlmt::EventScheduler::EventHandle d_eventHandle;
+    // Scheduler handle of the next tick, if
+    // one is scheduled.
+
+    bslma::Allocator* d_allocator_p;
+    // Allocator to use.
+
+  private:
+    // NOT IMPLEMENTED
+    TimerWheel(const TimerWheel&) BSLS_KEYWORD_DELETED;
+    TimerWheel& operator=(const TimerWheel&) BSLS_KEYWORD_DELETED;
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Callback invoked by the scheduler at each tick of the wheel started
+    /// at the specified `generation`: process the ticks elapsed since the
+    /// last one, firing the timers whose deadline expired, and schedule the
+    /// next tick if any timer is still armed.  Do nothing if the wheel was
+    /// restarted since `generation`.
+    void onTick(unsigned int generation);
+
+    /// Unlink the specified `timer` from its slot.  The behavior is
+    /// undefined unless `d_mutex` is locked and `timer` is armed.
+    void unlink(Timer* timer);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TimerWheel, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a wheel ticked by the specified `scheduler`.  Optionally
+    /// specify a `basicAllocator` used to supply memory.
+    explicit TimerWheel(bdlmt::EventScheduler* scheduler,
+                        bslma::Allocator*      basicAllocator = 0);
+
+    /// Cancel the next tick, waiting for it to complete if it is executing,
+    /// and destroy this object.  The behavior is undefined unless no timer
+    /// is armed.
+    ~TimerWheel();
+
+    // MANIPULATORS
+
+    /// Arm the specified `timer` to invoke the specified `callback` once
+    /// the specified absolute `deadline`, in the clock of the scheduler,
+    /// expired.  If `timer` is already armed, it is disarmed first.
+    void arm(Timer*                    timer,
+             const bsls::TimeInterval& deadline,
+             const Callback&           callback);
+
+    /// Disarm the specified `timer`.  Return `true` if `timer` was armed,
+    /// and `false` otherwise.
+    bool disarm(Timer* timer);
+
+    // ACCESSORS
+
+    /// Return the number of armed timers.
+    int numTimers() const;
+
+    /// Return the scheduler ticking this wheel, to schedule the events
+    /// requiring a finer resolution than `k_TICK_MS`.
+    bdlmt::EventScheduler* scheduler() const;
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
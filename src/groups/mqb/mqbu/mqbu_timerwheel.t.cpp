@@ -0,0 +1,240 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbu_timerwheel.t.cpp                                              -*-C++-*-
+#include <mqbu_timerwheel.h>
+
+// BDE
+#include <bdlf_bind.h>
+#include <bdlmt_eventscheduler.h>
+#include <bdlmt_eventschedulertesttimesource.h>
+#include <bsls_atomic.h>
+#include <bsls_systemclocktype.h>
+#include <bsls_timeinterval.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Increment the specified `counter`.
+void increment(bsls::AtomicInt* counter)
+{
+    ++(*counter);
+}
+
+/// Increment the specified `counter` and re-arm the specified `timer` on the
+/// specified `wheel` to fire one second later, until `counter` reaches the
+/// specified `maxCount`.
+void incrementAndRearm(bsls::AtomicInt*         counter,
+                       int                      maxCount,
+                       mqbu::TimerWheel*        wheel,
+                       mqbu::TimerWheel::Timer* timer,
+                       bdlmt::EventScheduler*   scheduler)
+{
+    if (++(*counter) < maxCount) {
+        wheel->arm(timer,
+                   scheduler->now() + bsls::TimeInterval(1),
+                   bdlf::BindUtil::bind(&incrementAndRearm,
+                                        counter,
+                                        maxCount,
+                                        wheel,
+                                        timer,
+                                        scheduler));
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   1. A timer fires once its deadline expired, and not before.
+//   2. A disarmed timer does not fire.
+//
+// Testing:
+//   arm
+//   disarm
+//   numTimers
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    bdlmt::EventScheduler scheduler(bsls::SystemClockType::e_MONOTONIC,
+                                    s_allocator_p);
+    bdlmt::EventSchedulerTestTimeSource timeSource(&scheduler);
+    ASSERT_EQ(scheduler.start(), 0);
+
+    {
+        mqbu::TimerWheel        obj(&scheduler, s_allocator_p);
+        mqbu::TimerWheel::Timer timer1(s_allocator_p);
+        mqbu::TimerWheel::Timer timer2(s_allocator_p);
+        bsls::AtomicInt         counter1(0);
+        bsls::AtomicInt         counter2(0);
+
+        obj.arm(&timer1,
+                scheduler.now() + bsls::TimeInterval(1),
+                bdlf::BindUtil::bind(&increment, &counter1));
+        obj.arm(&timer2,
+                scheduler.now() + bsls::TimeInterval(1),
+                bdlf::BindUtil::bind(&increment, &counter2));
+        ASSERT_EQ(obj.numTimers(), 2);
+
+        ASSERT(obj.disarm(&timer2));
+        ASSERT(!obj.disarm(&timer2));
+        ASSERT_EQ(obj.numTimers(), 1);
+
+        timeSource.advanceTime(bsls::TimeInterval(0.5));
+        ASSERT_EQ(counter1, 0);
+
+        timeSource.advanceTime(bsls::TimeInterval(0.6));
+        ASSERT_EQ(counter1, 1);
+        ASSERT_EQ(counter2, 0);
+        ASSERT_EQ(obj.numTimers(), 0);
+        ASSERT(!obj.disarm(&timer1));
+    }
+
+    scheduler.stop();
+}
+
+static void test2_longDeadline()
+// ------------------------------------------------------------------------
+// LONG DEADLINE
+//
+// Concerns:
+//   1. A timer whose deadline is more than one revolution of the wheel
+//      away is not fired when its slot is first visited.
+//
+// Testing:
+//   arm
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("LONG DEADLINE");
+
+    const int k_REVOLUTION_S = mqbu::TimerWheel::k_TICK_MS *
+                               mqbu::TimerWheel::k_NUM_SLOTS / 1000;
+
+    bdlmt::EventScheduler scheduler(bsls::SystemClockType::e_MONOTONIC,
+                                    s_allocator_p);
+    bdlmt::EventSchedulerTestTimeSource timeSource(&scheduler);
+    ASSERT_EQ(scheduler.start(), 0);
+
+    {
+        mqbu::TimerWheel        obj(&scheduler, s_allocator_p);
+        mqbu::TimerWheel::Timer timer(s_allocator_p);
+        bsls::AtomicInt         counter(0);
+
+        obj.arm(&timer,
+                scheduler.now() + bsls::TimeInterval(2 * k_REVOLUTION_S),
+                bdlf::BindUtil::bind(&increment, &counter));
+
+        timeSource.advanceTime(bsls::TimeInterval(k_REVOLUTION_S + 1));
+        ASSERT_EQ(counter, 0);
+        ASSERT_EQ(obj.numTimers(), 1);
+
+        timeSource.advanceTime(bsls::TimeInterval(k_REVOLUTION_S));
+        ASSERT_EQ(counter, 1);
+        ASSERT_EQ(obj.numTimers(), 0);
+    }
+
+    scheduler.stop();
+}
+
+static void test3_rearmFromCallback()
+// ------------------------------------------------------------------------
+// REARM FROM CALLBACK
+//
+// Concerns:
+//   1. The callback of a timer can re-arm the timer.
+//   2. The wheel restarts when a timer is armed after it became idle.
+//
+// Testing:
+//   arm
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("REARM FROM CALLBACK");
+
+    const int k_MAX_COUNT = 3;
+
+    bdlmt::EventScheduler scheduler(bsls::SystemClockType::e_MONOTONIC,
+                                    s_allocator_p);
+    bdlmt::EventSchedulerTestTimeSource timeSource(&scheduler);
+    ASSERT_EQ(scheduler.start(), 0);
+
+    {
+        mqbu::TimerWheel        obj(&scheduler, s_allocator_p);
+        mqbu::TimerWheel::Timer timer(s_allocator_p);
+        bsls::AtomicInt         counter(0);
+
+        obj.arm(&timer,
+                scheduler.now() + bsls::TimeInterval(1),
+                bdlf::BindUtil::bind(&incrementAndRearm,
+                                     &counter,
+                                     k_MAX_COUNT,
+                                     &obj,
+                                     &timer,
+                                     &scheduler));
+
+        for (int i = 1; i <= k_MAX_COUNT; ++i) {
+            timeSource.advanceTime(bsls::TimeInterval(1.1));
+            ASSERT_EQ_D(i, counter, i);
+        }
+        ASSERT_EQ(obj.numTimers(), 0);
+
+        // Arm again the idle wheel.
+        obj.arm(&timer,
+                scheduler.now() + bsls::TimeInterval(1),
+                bdlf::BindUtil::bind(&increment, &counter));
+        timeSource.advanceTime(bsls::TimeInterval(1.1));
+        ASSERT_EQ(counter, k_MAX_COUNT + 1);
+    }
+
+    scheduler.stop();
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_rearmFromCallback(); break;
+    case 2: test2_longDeadline(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
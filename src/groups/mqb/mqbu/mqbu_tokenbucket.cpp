@@ -0,0 +1,52 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbu_tokenbucket.cpp                                               -*-C++-*-
+#include <mqbu_tokenbucket.h>
+
+#include <mqbscm_version.h>
+// BDE
+#include <bdlt_timeunitratio.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace mqbu {
+
+// -----------------
+// class TokenBucket
+// -----------------
+
+// MANIPULATORS
+void TokenBucket::initialize(int ratePerSecond, int burst)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= ratePerSecond);
+    BSLS_ASSERT_SAFE(ratePerSecond <= bdlt::TimeUnitRatio::k_NS_PER_S);
+    BSLS_ASSERT_SAFE(0 < burst);
+
+    d_fullTime = 0;
+
+    if (ratePerSecond == 0) {
+        d_interval = 0;
+        d_capacity = 0;
+        return;  // RETURN
+    }
+
+    d_interval = bdlt::TimeUnitRatio::k_NS_PER_S / ratePerSecond;
+    d_capacity = d_interval * burst;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,170 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbu_tokenbucket.h                                                 -*-C++-*-
+#ifndef INCLUDED_MQBU_TOKENBUCKET
+#define INCLUDED_MQBU_TOKENBUCKET
+
+//@PURPOSE: Provide a value-semantic token bucket rate limiter.
+//
+//@CLASSES:
+//  mqbu::TokenBucket: token bucket rate limiter driven by a caller's clock
+//
+//@DESCRIPTION: 'mqbu::TokenBucket' limits the rate of some actions (for
+// example messages posted by a producer) to a configured number of actions
+// per second, allowing bursts of up to a configured number of actions.
+//
+// The bucket is implemented as a *generic cell rate algorithm*: instead of a
+// number of tokens which would have to be periodically refilled, it keeps
+// track of the theoretical time at which the bucket will be full again.
+// Consuming tokens only performs a few integer operations, and the current
+// time is provided by the caller, so that one clock read can be shared
+// between several buckets and several actions (e.g. all the messages of an
+// event).
+//
+// A default constructed bucket, or a bucket initialized with a rate of 0, is
+// *disabled* and always grants the requested tokens.
+//
+/// Thread Safety
+///-------------
+// NOT Thread-Safe.
+//
+/// Usage
+///-----
+//..
+//  mqbu::TokenBucket bucket;
+//  bucket.initialize(1000,  // 1000 messages per second
+//                    100);  // bursts of up to 100 messages
+//
+//  const bsls::Types::Int64 now = mwcsys::Time::highResolutionTimer();
+//  if (!bucket.consume(1, now)) {
+//      // Rate exceeded, reject the message
+//  }
+//..
+
+// BDE
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mqbu {
+
+// =================
+// class TokenBucket
+// =================
+
+/// Token bucket rate limiter driven by a caller's clock.
+class TokenBucket {
+  private:
+    // DATA
+    bsls::Types::Int64 d_interval;
+    // Time, in nanoseconds, to produce one
+    // token, or 0 if the bucket is
+    // disabled.
+
+    bsls::Types::Int64 d_capacity;
+    // Time, in nanoseconds, to produce a
+    // full bucket of tokens.
+
+    bsls::Types::Int64 d_fullTime;
+    // Time, in nanoseconds, at which the
+    // bucket will be full if no more token
+    // is consumed.
+
+  public:
+    // CREATORS
+
+    /// Create a disabled bucket.
+    TokenBucket();
+
+    // MANIPULATORS
+
+    /// Configure this bucket to produce the specified `ratePerSecond`
+    /// tokens per second, holding at most the specified `burst` tokens.  If
+    /// `ratePerSecond` is 0, the bucket is disabled.  The bucket is full
+    /// after this call.  The behavior is undefined unless
+    /// `0 <= ratePerSecond <= 1000000000` and `0 < burst`.
+    void initialize(int ratePerSecond, int burst);
+
+    /// Consume the specified `count` tokens at the specified `now` time
+    /// (in nanoseconds, from an arbitrary but fixed origin, such as
+    /// `mwcsys::Time::highResolutionTimer()`), and return true if they were
+    /// available, or return false, leaving the bucket unchanged, otherwise.
+    /// A disabled bucket always returns true.  The behavior is undefined
+    /// unless `0 <= count`.
+    bool consume(int count, bsls::Types::Int64 now);
+
+    /// Give back the specified `count` tokens, previously consumed from this
+    /// bucket but eventually not used.  The behavior is undefined unless
+    /// `0 <= count` and the tokens were consumed.
+    void release(int count);
+
+    // ACCESSORS
+
+    /// Return true if this bucket limits the rate of actions, and false
+    /// otherwise.
+    bool isEnabled() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// -----------------
+// class TokenBucket
+// -----------------
+
+// CREATORS
+inline TokenBucket::TokenBucket()
+: d_interval(0)
+, d_capacity(0)
+, d_fullTime(0)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+inline bool TokenBucket::consume(int count, bsls::Types::Int64 now)
+{
+    if (d_interval == 0) {
+        return true;  // RETURN
+    }
+
+    // A bucket which has been full for some time can't hold more tokens.
+    const bsls::Types::Int64 fullTime = d_fullTime < now ? now : d_fullTime;
+    const bsls::Types::Int64 newFullTime = fullTime + count * d_interval;
+
+    if (newFullTime - now > d_capacity) {
+        return false;  // RETURN
+    }
+
+    d_fullTime = newFullTime;
+    return true;
+}
+
+inline void TokenBucket::release(int count)
+{
+    d_fullTime -= count * d_interval;
+}
+
+// ACCESSORS
+inline bool TokenBucket::isEnabled() const
+{
+    return d_interval != 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,139 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbu_tokenbucket.t.cpp                                             -*-C++-*-
+#include <mqbu_tokenbucket.h>
+
+// BDE
+#include <bdlt_timeunitratio.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   1. A default constructed bucket is disabled and grants all tokens.
+//   2. A bucket initialized with a rate of 0 is disabled.
+//
+// Testing:
+//   TokenBucket()
+//   initialize
+//   isEnabled
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    mqbu::TokenBucket obj;
+    ASSERT(!obj.isEnabled());
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT(obj.consume(1000, 0));
+    }
+
+    obj.initialize(10, 1);
+    ASSERT(obj.isEnabled());
+
+    obj.initialize(0, 1);
+    ASSERT(!obj.isEnabled());
+    ASSERT(obj.consume(1000, 0));
+}
+
+static void test2_rateAndBurst()
+// ------------------------------------------------------------------------
+// RATE AND BURST
+//
+// Concerns:
+//   1. A full bucket grants up to 'burst' tokens at once.
+//   2. Tokens are then granted at the configured rate.
+//   3. A refused request leaves the bucket unchanged.
+//   4. Released tokens can be consumed again.
+//   5. An idle bucket does not accumulate more than 'burst' tokens.
+//
+// Testing:
+//   consume
+//   release
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("RATE AND BURST");
+
+    typedef bsls::Types::Int64 Int64;
+
+    const Int64 k_NS_PER_S = bdlt::TimeUnitRatio::k_NS_PER_S;
+    const Int64 k_START    = 1000 * k_NS_PER_S;
+
+    // 10 tokens per second (one every 100ms), bursts of 5
+    mqbu::TokenBucket obj;
+    obj.initialize(10, 5);
+
+    PVV("Burst");
+    ASSERT(obj.consume(3, k_START));
+    ASSERT(obj.consume(2, k_START));
+    ASSERT(!obj.consume(1, k_START));
+
+    PVV("Rate");
+    const Int64 k_INTERVAL = k_NS_PER_S / 10;
+    ASSERT(!obj.consume(1, k_START + k_INTERVAL - 1));
+    ASSERT(obj.consume(1, k_START + k_INTERVAL));
+    ASSERT(!obj.consume(1, k_START + k_INTERVAL));
+
+    PVV("Refused request");
+    ASSERT(!obj.consume(3, k_START + 3 * k_INTERVAL));
+    ASSERT(obj.consume(2, k_START + 3 * k_INTERVAL));
+
+    PVV("Release");
+    obj.release(1);
+    ASSERT(obj.consume(1, k_START + 3 * k_INTERVAL));
+    ASSERT(!obj.consume(1, k_START + 3 * k_INTERVAL));
+
+    PVV("Idle");
+    const Int64 k_LATER = k_START + 60 * k_NS_PER_S;
+    ASSERT(obj.consume(5, k_LATER));
+    ASSERT(!obj.consume(1, k_LATER));
+
+    PVV("More tokens than the burst");
+    ASSERT(!obj.consume(6, k_LATER + 60 * k_NS_PER_S));
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 2: test2_rateAndBurst(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
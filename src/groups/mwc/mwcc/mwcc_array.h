@@ -36,6 +36,31 @@
 // the cost of additional memory, which is directly proportional to the value
 // of static length provided at compile-time.
 //
+/// Inline Capacity
+///---------------
+// The length of the static part of the array defaults to
+// 'mwcc::ArrayInlineCapacity<TYPE>::value', which is the number of elements
+// fitting in one cache line (64 bytes), and at least one.  A use site may
+// tune it for its own element type and expected number of elements either by
+// passing an explicit length, or by using 'mwcc::ArrayInlineCapacity' with a
+// different number of bytes, e.g.:
+//..
+//  typedef mwcc::Array<unsigned int,
+//                      mwcc::ArrayInlineCapacity<unsigned int, 32>::value>
+//      SmallIdList;  // 8 inline elements
+//..
+//
+/// Searching
+///---------
+// 'findIndex' and 'contains' perform a linear search for an element.  For
+// element types that are bitwise equality comparable (as indicated by the
+// 'bslmf::IsBitwiseEqualityComparable' trait, e.g. integers, enumerations
+// and pointers), elements are compared by blocks of 8 without branching on
+// each comparison, so that the compiler can turn the comparisons of a block
+// into vector instructions, and only the block containing the match is
+// scanned element by element.  Other element types are compared one at a
+// time using 'operator=='.
+//
 /// Exception Safety
 ///----------------
 // At this time, this component provides *no* exception safety guarantee.  In
@@ -61,6 +86,8 @@
 #include <bslma_allocatortraits.h>
 #include <bslma_stdallocator.h>
 #include <bslma_usesbslmaallocator.h>
+#include <bslmf_integralconstant.h>
+#include <bslmf_isbitwiseequalitycomparable.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bsls_assert.h>
 #include <bsls_objectbuffer.h>
@@ -69,8 +96,67 @@ namespace BloombergLP {
 
 namespace mwcc {
 
+// ==========================
+// struct ArrayInlineCapacity
+// ==========================
+
+/// Metafunction providing, as `value`, the number of elements of the
+/// (template parameter) `TYPE` fitting in the (template parameter) `BYTES`
+/// bytes, and at least 1, to be used as the length of the static part of
+/// an `Array`.
+template <class TYPE, size_t BYTES = 64>
+struct ArrayInlineCapacity {
+    // PUBLIC CLASS DATA
+    static const size_t value = sizeof(TYPE) >= BYTES ? 1
+                                                      : BYTES / sizeof(TYPE);
+};
+
+// =====================
+// struct Array_FindUtil
+// =====================
+
+/// PRIVATE CLASS. For use only by `mwcc::ArraySpan` implementation.
+/// Provide linear search of an element in a contiguous range.
+struct Array_FindUtil {
+  private:
+    // PRIVATE TYPES
+    enum {
+        k_BLOCK_SIZE = 8  // Number of elements compared without branching
+    };
+
+    // PRIVATE CLASS METHODS
+
+    /// Return the index of the first element equal to the specified
+    /// `value` in the specified range `[first, first + length)`, or
+    /// `length` if there is none, comparing elements one at a time.
+    template <class TYPE>
+    static size_t findIndexImp(const TYPE* first,
+                               size_t      length,
+                               const TYPE& value,
+                               bsl::false_type);
+
+    /// Return the index of the first element equal to the specified
+    /// `value` in the specified range `[first, first + length)`, or
+    /// `length` if there is none, comparing elements by blocks.
+    template <class TYPE>
+    static size_t findIndexImp(const TYPE* first,
+                               size_t      length,
+                               const TYPE& value,
+                               bsl::true_type);
+
+  public:
+    // CLASS METHODS
+
+    /// Return the index of the first element equal to the specified
+    /// `value` in the specified range `[first, first + length)`, or
+    /// `length` if there is none.
+    template <class TYPE>
+    static size_t
+    findIndex(const TYPE* first, size_t length, const TYPE& value);
+};
+
 // FORWARD DECLARATION
-template <class TYPE, size_t STATIC_LEN>
+template <class TYPE, size_t STATIC_LEN = ArrayInlineCapacity<TYPE>::value>
 class Array;
 
 // ===============
@@ -139,6 +225,14 @@ class ArraySpan {
     const_iterator begin() const;
 
     const_iterator end() const;
+
+    /// Return the index of the first element equal to the specified
+    /// `value`, or `size()` if there is none.
+    size_t findIndex(const VALUE& value) const;
+
+    /// Return `true` if an element is equal to the specified `value`, and
+    /// `false` otherwise.
+    bool contains(const VALUE& value) const;
 };
 
 // ===========
@@ -256,12 +350,93 @@ class Array {
     const_iterator begin() const;
 
     const_iterator end() const;
+
+    /// Return the index of the first element equal to the specified
+    /// `value`, or `size()` if there is none.
+    size_t findIndex(const TYPE& value) const;
+
+    /// Return `true` if an element is equal to the specified `value`, and
+    /// `false` otherwise.
+    bool contains(const TYPE& value) const;
 };
 
 // ============================================================================
 //                             INLINE DEFINITIONS
 // ============================================================================
 
+// --------------------------
+// struct ArrayInlineCapacity
+// --------------------------
+
+// PUBLIC CLASS DATA
+template <class TYPE, size_t BYTES>
+const size_t ArrayInlineCapacity<TYPE, BYTES>::value;
+
+// ---------------------
+// struct Array_FindUtil
+// ---------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+inline size_t Array_FindUtil::findIndexImp(const TYPE* first,
+                                           size_t      length,
+                                           const TYPE& value,
+                                           bsl::false_type)
+{
+    for (size_t i = 0; i < length; ++i) {
+        if (first[i] == value) {
+            return i;  // RETURN
+        }
+    }
+
+    return length;
+}
+
+template <class TYPE>
+inline size_t Array_FindUtil::findIndexImp(const TYPE* first,
+                                           size_t      length,
+                                           const TYPE& value,
+                                           bsl::true_type)
+{
+    // Accumulate the results of the comparisons of a whole block without
+    // branching, so that the compiler can vectorize them, then locate the
+    // match, if any, in the remaining elements.
+    size_t i = 0;
+    for (; i + k_BLOCK_SIZE <= length; i += k_BLOCK_SIZE) {
+        const TYPE* block = first + i;
+        unsigned    found = 0;
+        for (size_t j = 0; j < k_BLOCK_SIZE; ++j) {
+            found |= static_cast<unsigned>(block[j] == value);
+        }
+
+        if (found) {
+            break;  // BREAK
+        }
+    }
+
+    for (; i < length; ++i) {
+        if (first[i] == value) {
+            return i;  // RETURN
+        }
+    }
+
+    return length;
+}
+
+// CLASS METHODS
+template <class TYPE>
+inline size_t
+Array_FindUtil::findIndex(const TYPE* first, size_t length, const TYPE& value)
+{
+    return findIndexImp(
+        first,
+        length,
+        value,
+        bsl::integral_constant<
+            bool,
+            bslmf::IsBitwiseEqualityComparable<TYPE>::value>());
+}
+
 // ----------------
 // class ArraySpan
 // ----------------
@@ -382,6 +557,18 @@ inline typename ArraySpan<VALUE>::const_iterator ArraySpan<VALUE>::end() const
     return d_end_p;
 }
 
+template <class VALUE>
+inline size_t ArraySpan<VALUE>::findIndex(const VALUE& value) const
+{
+    return Array_FindUtil::findIndex(d_begin_p, size(), value);
+}
+
+template <class VALUE>
+inline bool ArraySpan<VALUE>::contains(const VALUE& value) const
+{
+    return findIndex(value) != size();
+}
+
 // -----------
 // class Array
 // -----------
@@ -687,6 +874,18 @@ Array<TYPE, STATIC_LEN>::end() const
     return d_span.end();
 }
 
+template <class TYPE, size_t STATIC_LEN>
+inline size_t Array<TYPE, STATIC_LEN>::findIndex(const TYPE& value) const
+{
+    return d_span.findIndex(value);
+}
+
+template <class TYPE, size_t STATIC_LEN>
+inline bool Array<TYPE, STATIC_LEN>::contains(const TYPE& value) const
+{
+    return d_span.contains(value);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
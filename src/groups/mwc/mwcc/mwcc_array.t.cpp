@@ -28,6 +28,7 @@
 #include <bslmf_isconst.h>
 
 #include <bsls_platform.h>
+#include <bsls_types.h>
 
 // TEST DRIVER
 #include <mwctst_testhelper.h>
@@ -112,6 +113,11 @@ bool operator<(const TestType& lhs, const TestType& rhs)
 
 int TestType::s_numAliveInstances(0);
 
+/// Type larger than a cache line.
+struct LargeType {
+    char d_buffer[100];
+};
+
 // NOTE: Throughout this test driver, we only instantiate the following
 //       'mwcc::Array' of templated type 'TestType' and size 'k_STATIC_LEN' to
 //       assist in providing meaningful coverage report.
@@ -851,6 +857,75 @@ static void test10_pushBackSelfRef()
     }
 }
 
+static void test11_findIndex()
+// ------------------------------------------------------------------------
+// FIND INDEX
+//
+// Concerns:
+//   1. 'findIndex' returns the index of the first matching element, or
+//      'size()' if there is none, wherever the match is relative to the
+//      blocks compared at once, both for bitwise equality comparable
+//      element types and for other element types.
+//   2. The default length of the static part fills a cache line.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("FIND INDEX");
+
+    {
+        PV("BITWISE EQUALITY COMPARABLE");
+
+        mwcc::Array<unsigned int> obj(s_allocator_p);
+        ASSERT_EQ(obj.size(), obj.findIndex(0));
+        ASSERT_EQ(false, obj.contains(0));
+
+        for (unsigned int length = 1; length < 40; ++length) {
+            obj.push_back(length - 1);
+
+            for (unsigned int i = 0; i < length; ++i) {
+                ASSERT_EQ_D(length << 8 | i, i, obj.findIndex(i));
+                ASSERT_EQ_D(length << 8 | i, true, obj.contains(i));
+            }
+            ASSERT_EQ_D(length, obj.size(), obj.findIndex(length));
+            ASSERT_EQ_D(length, false, obj.contains(length));
+        }
+
+        // The first of several matching elements is found.
+        obj.push_back(20);
+        ASSERT_EQ(20U, obj.findIndex(20));
+    }
+
+    {
+        PV("NOT BITWISE EQUALITY COMPARABLE");
+
+        ObjType obj(s_allocator_p);
+        for (int i = 0; i < 2 * k_STATIC_LEN; ++i) {
+            obj.push_back(TestType(i, s_allocator_p));
+        }
+
+        for (int i = 0; i < 2 * k_STATIC_LEN; ++i) {
+            ASSERT_EQ_D(i,
+                        static_cast<size_t>(i),
+                        obj.findIndex(TestType(i, s_allocator_p)));
+        }
+        ASSERT_EQ(obj.size(), obj.findIndex(TestType(-1, s_allocator_p)));
+    }
+
+    {
+        PV("DEFAULT STATIC LENGTH");
+
+        typedef bsls::Types::Int64 Int64;
+
+        const size_t k_INT_LEN   = mwcc::Array<unsigned int>::static_size;
+        const size_t k_INT64_LEN = mwcc::Array<Int64>::static_size;
+        const size_t k_LARGE_LEN = mwcc::Array<LargeType>::static_size;
+
+        ASSERT_EQ(16U, k_INT_LEN);
+        ASSERT_EQ(8U, k_INT64_LEN);
+        ASSERT_EQ(1U, k_LARGE_LEN);
+        ASSERT_EQ(4U, (mwcc::ArrayInlineCapacity<int, 16>::value));
+    }
+}
+
 #ifdef BSLS_PLATFORM_OS_LINUX
 
 using namespace BloombergLP;
@@ -879,6 +954,20 @@ static void VectorFindLarge_GoogleBenchmark(benchmark::State& state)
     }
 }
 
+static void VectorFindIndex_GoogleBenchmark(benchmark::State& state)
+{
+    bslma::TestAllocator ta;
+    mwcc::Array<int, 16> vec(&ta);
+
+    for (int i = 0; i < state.range(0); ++i) {
+        vec.push_back(i);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vec.findIndex(state.range(0) - 1));
+    }
+}
+
 static void VectorPushBack_GoogleBenchmark(benchmark::State& state)
 {
     bslma::TestAllocator ta;
@@ -914,6 +1003,7 @@ int main(int argc, char* argv[])
     TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
     switch (_testCase) {
     case 0:
+    case 11: test11_findIndex(); break;
     case 10: test10_pushBackSelfRef(); break;
     case 9: test9_copyAssignDifferentStaticLength(); break;
     case 8: test8_allocatorProp(); break;
@@ -934,6 +1024,9 @@ int main(int argc, char* argv[])
         // Vector Iteration Large
         BENCHMARK(VectorIteration_GoogleBenchmark)->Range(1024, 32768);
         BENCHMARK(VectorFindLarge_GoogleBenchmark)->Range(256, 8192);
+        BENCHMARK(VectorFindIndex_GoogleBenchmark)
+            ->RangeMultiplier(2)
+            ->Range(1, 64);
         benchmark::RunSpecifiedBenchmarks();
         break;
 #endif  // BSLS_PLATFORM_OS_LINUX
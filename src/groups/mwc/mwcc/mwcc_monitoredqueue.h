@@ -212,11 +212,18 @@ class MonitoredQueue {
     /// it or the `newState` denotes a "less full" state.
     bool setState(int newState);
 
-    /// Increment `d_queueLength` and report if necessary
-    void incrementLength();
+    /// Increment `d_queueLength` by the optionally specified `count` (1 by
+    /// default) and report if necessary
+    void incrementLength(bsls::Types::Int64 count = 1);
 
-    /// Decrement `d_queueLength` and report if necessary
-    void decrementLength();
+    /// Decrement `d_queueLength` by the optionally specified `count` (1 by
+    /// default) and report if necessary
+    void decrementLength(bsls::Types::Int64 count = 1);
+
+    /// Account for the specified `count` elements having been appended to
+    /// the queue: update `d_queueLength`, report if necessary and wake up
+    /// any thread blocked in a timed operation.
+    void onElementsPushed(int count);
 
   private:
     // NOT IMPLEMENTED
@@ -287,6 +294,15 @@ class MonitoredQueue {
     /// queue is full or disabled.
     int tryPushBack(bslmf::MovableRef<ElementType> value);
 
+    /// Append the specified `numValues` elements of the specified `values`
+    /// array, in order, to the back of this queue, blocking whenever the
+    /// queue is full until space is available or the queue is disabled.
+    /// Return the number of elements appended, which is less than
+    /// `numValues` only if the queue is disabled.  The queue length is
+    /// updated, and the state callback possibly invoked, once for all the
+    /// elements appended without blocking rather than once per element.
+    int pushBackBatch(const ElementType* values, int numValues);
+
     /// Remove the element from the front of this queue and load that
     /// element into the specified `value`.  If the queue is empty, block
     /// until it is not empty.  Return 0 on success, and a non-zero value
@@ -299,6 +315,17 @@ class MonitoredQueue {
     /// was empty.  On failure, `value` is not changed.
     int tryPopFront(ElementType* value);
 
+    /// Remove up to the specified `maxValues` elements from the front of
+    /// this queue and load them, in order, into the specified `buffer`,
+    /// which must have room for at least `maxValues` elements.  If the
+    /// queue is empty, block until it is not empty; once the first element
+    /// has been removed, do not block for the remaining ones.  Return the
+    /// number of elements removed, or 0 if an error occurred.  The queue
+    /// length is updated, and the state callback possibly invoked, once
+    /// for all the elements removed.  The behavior is undefined unless
+    /// `0 < maxValues`.
+    int popFrontBatch(ElementType* buffer, int maxValues);
+
     /// Pop an element from the front of the queue into the specified
     /// `buffer`.  Block if there are no elements in the queue, up to the
     /// specified `timeout` *absolute* time.  Return 0 if an item was
@@ -397,9 +424,10 @@ inline bool MonitoredQueue<QUEUE, QUEUE_TRAITS>::setState(int newState)
 }
 
 template <class QUEUE, class QUEUE_TRAITS>
-inline void MonitoredQueue<QUEUE, QUEUE_TRAITS>::incrementLength()
+inline void
+MonitoredQueue<QUEUE, QUEUE_TRAITS>::incrementLength(bsls::Types::Int64 count)
 {
-    const bsls::Types::Int64 newLength = ++d_queueLength;
+    const bsls::Types::Int64 newLength = d_queueLength.add(count);
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
             newLength >= d_highWatermark2 &&
@@ -424,9 +452,10 @@ inline void MonitoredQueue<QUEUE, QUEUE_TRAITS>::incrementLength()
 }
 
 template <class QUEUE, class QUEUE_TRAITS>
-inline void MonitoredQueue<QUEUE, QUEUE_TRAITS>::decrementLength()
+inline void
+MonitoredQueue<QUEUE, QUEUE_TRAITS>::decrementLength(bsls::Types::Int64 count)
 {
-    const bsls::Types::Int64 newLength = --d_queueLength;
+    const bsls::Types::Int64 newLength = d_queueLength.add(-count);
 
     if (d_state > MonitoredQueueState::e_NORMAL &&
         newLength <= d_lowWatermark) {
@@ -447,6 +476,22 @@ inline void MonitoredQueue<QUEUE, QUEUE_TRAITS>::decrementLength()
     }
 }
 
+template <class QUEUE, class QUEUE_TRAITS>
+inline void MonitoredQueue<QUEUE, QUEUE_TRAITS>::onElementsPushed(int count)
+{
+    incrementLength(count);
+
+    if (d_supportTimedOperations) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_timedOperationsMutex);
+        if (count == 1) {
+            d_timedOperationsCondition.signal();
+        }
+        else {
+            d_timedOperationsCondition.broadcast();
+        }
+    }
+}
+
 // CREATORS
 template <class QUEUE, class QUEUE_TRAITS>
 inline MonitoredQueue<QUEUE, QUEUE_TRAITS>::MonitoredQueue(
@@ -616,6 +661,56 @@ inline int MonitoredQueue<QUEUE, QUEUE_TRAITS>::pushBack(
     return 0;
 }
 
+template <class QUEUE, class QUEUE_TRAITS>
+inline int MonitoredQueue<QUEUE, QUEUE_TRAITS>::pushBackBatch(
+    const ElementType* values,
+    int                numValues)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(values || numValues == 0);
+    BSLS_ASSERT_SAFE(numValues >= 0);
+
+    int numPushed  = 0;  // Total number of elements appended
+    int numPending = 0;  // Appended but not yet accounted for
+    for (; numPushed < numValues; ++numPushed) {
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                d_queue.tryPushBack(values[numPushed]) == 0)) {
+            ++numPending;
+            continue;  // CONTINUE
+        }
+
+        // The queue is either full or disabled.  Account for the elements
+        // appended so far before possibly blocking, so that consumers can
+        // make room.
+        if (numPending != 0) {
+            onElementsPushed(numPending);
+            numPending = 0;
+        }
+
+        if (Traits::isPushBackDisabled(d_queue)) {
+            break;  // BREAK
+        }
+
+        // We've filled the queue.  Alarm
+        if (setState(MonitoredQueueState::e_QUEUE_FILLED) &&
+            d_stateChangedCb) {
+            d_stateChangedCb(MonitoredQueueState::e_QUEUE_FILLED);
+        }
+
+        if (d_queue.pushBack(values[numPushed]) != 0) {
+            break;  // BREAK
+        }
+
+        ++numPending;
+    }
+
+    if (numPending != 0) {
+        onElementsPushed(numPending);
+    }
+
+    return numPushed;
+}
+
 template <class QUEUE, class QUEUE_TRAITS>
 inline int
 MonitoredQueue<QUEUE, QUEUE_TRAITS>::tryPopFront(ElementType* buffer)
@@ -650,6 +745,31 @@ inline int MonitoredQueue<QUEUE, QUEUE_TRAITS>::popFront(ElementType* value)
     return 0;
 }
 
+template <class QUEUE, class QUEUE_TRAITS>
+inline int
+MonitoredQueue<QUEUE, QUEUE_TRAITS>::popFrontBatch(ElementType* buffer,
+                                                   int          maxValues)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(buffer);
+    BSLS_ASSERT_SAFE(maxValues > 0);
+
+    if (Traits::popFront(&d_queue, buffer) != 0) {
+        // Failure to remove an element from front of queue.
+        return 0;  // RETURN
+    }
+
+    int numPopped = 1;
+    while (numPopped < maxValues &&
+           d_queue.tryPopFront(buffer + numPopped) == 0) {
+        ++numPopped;
+    }
+
+    decrementLength(numPopped);
+
+    return numPopped;
+}
+
 template <class QUEUE, class QUEUE_TRAITS>
 inline int MonitoredQueue<QUEUE, QUEUE_TRAITS>::timedPopFront(
     ElementType*              buffer,
@@ -29,6 +29,7 @@
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 #include <bslmt_semaphore.h>
 #include <bslmt_threadattributes.h>
 #include <bslmt_threadutil.h>
@@ -107,6 +108,12 @@ static void performanceTestPusher(int                        iterations,
     sem->post();
 }
 
+static void recordState(bsl::vector<mwcc::MonitoredQueueState::Enum>* states,
+                        mwcc::MonitoredQueueState::Enum               state)
+{
+    states->push_back(state);
+}
+
 static void printProcessedItems(int numItems, bsls::Types::Int64 elapsedTime)
 {
     const double numSeconds = static_cast<double>(elapsedTime) / 1000000000LL;
@@ -341,6 +348,83 @@ static void test2_MonitoredQueue_reset()
     ASSERT_EQ(queue.state(), mwcc::MonitoredQueueState::e_NORMAL);
 }
 
+static void test3_MonitoredQueue_batch()
+// ------------------------------------------------------------------------
+// MONITORED QUEUE - BATCH
+//
+// Concerns:
+//   Ensure that batch push and pop move all the elements in order and
+//   update the length and state of the queue once per batch.
+//
+// Plan:
+//   1. Push a batch of elements crossing the high watermark and verify
+//      the length, the state and the reported state changes.
+//   2. Pop batches of elements, down to the low watermark, and verify the
+//      elements, the length and the state.
+//   3. Disable the queue and verify that no element of a batch is pushed.
+//
+// Testing:
+//   pushBackBatch
+//   popFrontBatch
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("MONITORED QUEUE - BATCH");
+
+    // CONSTRAINS
+    const int k_QUEUE_SIZE      = 10;
+    const int k_LOW_WATERMARK   = 3;
+    const int k_HIGH_WATERMARK  = 6;
+    const int k_HIGH_WATERMARK2 = 9;
+    const int k_VALUES[]        = {0, 1, 2, 3, 4, 5, 6, 7};
+    const int k_NUM_VALUES      = sizeof(k_VALUES) / sizeof(*k_VALUES);
+
+    bsl::vector<mwcc::MonitoredQueueState::Enum> states(s_allocator_p);
+
+    mwcc::MonitoredQueue<bdlcc::FixedQueue<int> > queue(k_QUEUE_SIZE,
+                                                        s_allocator_p);
+    queue.setWatermarks(k_LOW_WATERMARK, k_HIGH_WATERMARK, k_HIGH_WATERMARK2);
+    queue.setStateCallback(bdlf::BindUtil::bindS(s_allocator_p,
+                                                 &recordState,
+                                                 &states,
+                                                 bdlf::PlaceHolders::_1));
+
+    // 1. Push a batch of elements crossing the high watermark
+    ASSERT_EQ(queue.pushBackBatch(k_VALUES, k_NUM_VALUES), k_NUM_VALUES);
+    ASSERT_EQ(queue.numElements(), k_NUM_VALUES);
+    ASSERT_EQ(queue.state(),
+              mwcc::MonitoredQueueState::e_HIGH_WATERMARK_REACHED);
+    ASSERT_EQ(states.size(), 1U);
+    ASSERT_EQ(states[0], mwcc::MonitoredQueueState::e_HIGH_WATERMARK_REACHED);
+
+    // 2. Pop batches of elements
+    int buffer[k_QUEUE_SIZE];
+    ASSERT_EQ(queue.popFrontBatch(buffer, 4), 4);
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_EQ_D(i, buffer[i], k_VALUES[i]);
+    }
+    ASSERT_EQ(queue.numElements(), k_NUM_VALUES - 4);
+    ASSERT_EQ(queue.state(),
+              mwcc::MonitoredQueueState::e_HIGH_WATERMARK_REACHED);
+
+    // Only the remaining elements are popped, without blocking
+    ASSERT_EQ(queue.popFrontBatch(buffer, k_QUEUE_SIZE), k_NUM_VALUES - 4);
+    for (int i = 0; i < k_NUM_VALUES - 4; ++i) {
+        ASSERT_EQ_D(i, buffer[i], k_VALUES[i + 4]);
+    }
+    ASSERT_EQ(queue.numElements(), 0);
+    ASSERT_EQ(queue.isEmpty(), true);
+    ASSERT_EQ(queue.state(), mwcc::MonitoredQueueState::e_NORMAL);
+    ASSERT_EQ(states.size(), 2U);
+    ASSERT_EQ(states[1], mwcc::MonitoredQueueState::e_NORMAL);
+
+    // 3. Disable the queue
+    queue.disablePushBack();
+    ASSERT_EQ(queue.pushBackBatch(k_VALUES, k_NUM_VALUES), 0);
+    ASSERT_EQ(queue.numElements(), 0);
+    ASSERT_EQ(queue.state(), mwcc::MonitoredQueueState::e_NORMAL);
+    ASSERT_EQ(states.size(), 2U);
+}
+
 BSLA_MAYBE_UNUSED
 static void testN1_MonitoredQueue_performance()
 // ------------------------------------------------------------------------
@@ -812,6 +896,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 3: test3_MonitoredQueue_batch(); break;
     case 2: test2_MonitoredQueue_reset(); break;
     case 1: test1_MonitoredQueue_breathingTest(); break;
     case -1:
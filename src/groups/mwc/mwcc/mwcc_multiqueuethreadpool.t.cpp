@@ -34,7 +34,9 @@
 #include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
+#include <bslmt_barrier.h>
 #include <bslmt_threadattributes.h>
+#include <bslmt_threadgroup.h>
 #include <bslmt_threadutil.h>
 #include <bsls_annotation.h>
 #include <bsls_assert.h>
@@ -116,6 +118,76 @@ static void performanceTestFixedQueuePopper(
     }
 }
 
+static void performanceTestProducer(MQTP*          mqtp,
+                                    bslmt::Barrier* barrier,
+                                    int             numEvents)
+{
+    barrier->wait();
+
+    for (int i = 0; i < numEvents; ++i) {
+        MQTP::Event* event = mqtp->getUnmanagedEvent();
+        event->object()    = i;
+        mqtp->enqueueEvent(event, 0);
+    }
+}
+
+/// Enqueue the specified `numEvents` events on the single queue of a newly
+/// created MQTP from the specified `numProducers` concurrent threads, wait
+/// for all of them to be processed and return the elapsed time in
+/// nanoseconds.
+static bsls::Types::Int64 multiProducerEnqueue(int numProducers, int numEvents)
+{
+    // CONSTANTS
+    const int k_FIXED_QUEUE_SIZE = 250 * 1000;  // 250K
+
+    bdlmt::ThreadPool threadPool(
+        bslmt::ThreadAttributes(),        // default
+        1,                                // minThreads
+        1,                                // maxThreads
+        bsl::numeric_limits<int>::max(),  // maxIdleTime
+        s_allocator_p);
+    BSLS_ASSERT_OPT(threadPool.start() == 0);
+
+    MQTP::Config config(1,  // numQueues
+                        &threadPool,
+                        bdlf::BindUtil::bindS(s_allocator_p,
+                                              &performanceTestEventCb),
+                        bdlf::BindUtil::bindS(s_allocator_p,
+                                              &performanceTestQueueCreator,
+                                              bdlf::PlaceHolders::_3,
+                                              k_FIXED_QUEUE_SIZE),
+                        mwcc::MultiQueueThreadPoolUtil::defaultCreator<int>(),
+                        mwcc::MultiQueueThreadPoolUtil::noOpResetter<int>(),
+                        s_allocator_p);
+
+    MQTP mqtp(config, s_allocator_p);
+    BSLS_ASSERT_OPT(mqtp.start() == 0);
+
+    // The main thread participates to the barrier so that the timer only
+    // starts once all producers have been created.
+    bslmt::Barrier     barrier(numProducers + 1);
+    bslmt::ThreadGroup producers(s_allocator_p);
+    BSLS_ASSERT_OPT(producers.addThreads(
+                        bdlf::BindUtil::bindS(s_allocator_p,
+                                              &performanceTestProducer,
+                                              &mqtp,
+                                              &barrier,
+                                              numEvents / numProducers),
+                        numProducers) == numProducers);
+
+    barrier.wait();
+    const bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+
+    producers.joinAll();
+    mqtp.waitUntilEmpty();
+    const bsls::Types::Int64 endTime = bsls::TimeUtil::getTimer();
+
+    mqtp.stop();
+    threadPool.stop();
+
+    return endTime - startTime;
+}
+
 static void printProcessedItems(int numItems, bsls::Types::Int64 elapsedTime)
 {
     const double numSeconds = static_cast<double>(elapsedTime) / 1000000000LL;
@@ -373,6 +445,79 @@ static void testN1_performance()
     printProcessedItems(k_NUM_ITERATIONS, endTime - startTime);
 }
 
+static void testN2_multiProducerPerformance()
+// ------------------------------------------------------------------------
+// MULTI-PRODUCER PERFORMANCE TEST
+//
+// Concerns:
+//  a) Check how the enqueue throughput of the MQTP scales with the number
+//     of threads concurrently producing on the same queue.
+//
+// Plan:
+//  1) For an increasing number of producer threads, create a MQTP with a
+//     single queue, have all producers concurrently enqueue events on it
+//     and report the number of events processed per second.
+//
+// Testing:
+//  Performance
+// ------------------------------------------------------------------------
+{
+    s_ignoreCheckDefAlloc = true;
+
+    mwctst::TestHelper::printTestName("MULTI-PRODUCER PERFORMANCE TEST");
+
+    // CONSTANTS
+    const int k_NUM_ITERATIONS      = 8 * 1000 * 1000;  // 8 M
+    const int k_NUM_PRODUCERS[]     = {1, 2, 4, 8};
+    const int k_NUM_PRODUCERS_COUNT = sizeof(k_NUM_PRODUCERS) /
+                                      sizeof(*k_NUM_PRODUCERS);
+
+    for (int i = 0; i < k_NUM_PRODUCERS_COUNT; ++i) {
+        const int numProducers = k_NUM_PRODUCERS[i];
+
+        PRINT("Enqueuing " << k_NUM_ITERATIONS << " items from "
+                           << numProducers << " producer(s) ...");
+        printProcessedItems(k_NUM_ITERATIONS,
+                            multiProducerEnqueue(numProducers,
+                                                 k_NUM_ITERATIONS));
+    }
+}
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+static void
+testN2_multiProducerPerformance_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// MULTI-PRODUCER PERFORMANCE TEST
+//
+// Concerns:
+//  a) Check how the enqueue throughput of the MQTP scales with the number
+//     of threads concurrently producing on the same queue.
+//
+// Plan:
+//  1) Create a MQTP with a single queue, have 'state.range(0)' producers
+//     concurrently enqueue events on it and report the number of events
+//     processed per second.
+//
+// Testing:
+//  Performance
+// ------------------------------------------------------------------------
+{
+    s_ignoreCheckDefAlloc = true;
+
+    // CONSTANTS
+    const int k_NUM_ITERATIONS = 8 * 1000 * 1000;  // 8 M
+
+    const int numProducers = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        const bsls::Types::Int64 elapsed = multiProducerEnqueue(
+            numProducers,
+            k_NUM_ITERATIONS);
+        state.SetIterationTime(static_cast<double>(elapsed) / 1000000000LL);
+    }
+    state.SetItemsProcessed(state.iterations() * k_NUM_ITERATIONS);
+}
+#endif  // BSLS_PLATFORM_OS_LINUX
+
 #ifdef BSLS_PLATFORM_OS_LINUX
 static void testN1_performance_GoogleBenchmark(benchmark::State& state)
 // ------------------------------------------------------------------------
@@ -525,6 +670,21 @@ int main(int argc, char* argv[])
         benchmark::RunSpecifiedBenchmarks();
 #else
         testN1_performance();
+#endif
+        break;
+    case -2:
+#ifdef BSLS_PLATFORM_OS_LINUX
+        BENCHMARK(testN2_multiProducerPerformance_GoogleBenchmark)
+            ->Arg(1)
+            ->Arg(2)
+            ->Arg(4)
+            ->Arg(8)
+            ->UseManualTime()
+            ->Unit(benchmark::kMillisecond);
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+#else
+        testN2_multiProducerPerformance();
 #endif
         break;
     default: {
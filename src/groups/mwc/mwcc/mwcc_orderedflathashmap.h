@@ -0,0 +1,1307 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcc_orderedflathashmap.h                                          -*-C++-*-
+#ifndef INCLUDED_MWCC_ORDEREDFLATHASHMAP
+#define INCLUDED_MWCC_ORDEREDFLATHASHMAP
+
+//@PURPOSE: Provide an open-addressing hash table with insertion order.
+//
+//@CLASSES:
+//  mwcc::OrderedFlatHashMap : Open-addressing hash table with insertion order
+//
+//@SEE_ALSO: mwcc_orderedhashmap
+//
+//@DESCRIPTION: 'mwcc::OrderedFlatHashMap' provides an associative container
+// with constant time performance for basic operations (insertion, deletion
+// and lookup), and whose iteration order is the order in which keys are
+// inserted in the container.  It offers the same nested types and the same
+// insertion, lookup, erasure and iteration interface as
+// 'mwcc::OrderedHashMap', so that a typedef can be switched from one to the
+// other, but it does not allocate memory per element.
+//
+/// Memory Layout
+///-------------
+// Elements are stored contiguously, in insertion order, in a single array.
+// An erased element leaves a hole in this array, which is skipped by
+// iterators and reclaimed when the array is next grown.  Lookup is performed
+// in a separate open-addressing table of slots, each slot holding the index
+// of an element in the element array, along with a table of one byte per
+// slot (the "control bytes") in the style of a Swiss table: a control byte
+// is either empty, deleted, or holds 7 bits of the hash of the key of the
+// element in the slot.  Slots are probed by groups of 8, whose control bytes
+// are matched against the hash all at once using 64-bit word arithmetic, so
+// that the key of an element is compared only when its hash bits match.
+//
+// The table is rehashed when more than 7/8 of its slots are in use (including
+// the slots of erased elements).  Rehashing and growing the element array
+// only read the hash values cached alongside each element, and never invoke
+// the hash function again.
+//
+/// Differences with 'mwcc::OrderedHashMap'
+///---------------------------------------
+// Because elements are not allocated individually, this container does not
+// provide the following guarantees and features of 'mwcc::OrderedHashMap':
+//: o Pointers, references and iterators to elements are invalidated by any
+//:   insertion and by 'clear'.  Erasing an element invalidates only the
+//:   pointers, references and iterators to that element.
+//:
+//: o As a consequence, the 'end()' iterator obtained before an insertion does
+//:   not refer to the newly inserted element.
+//:
+//: o 'rinsert' (insertion at the front) and the bucket interface
+//:   ('bucket', 'bucket_count' and local iterators) are not provided.
+//
+/// Exception Safety
+///----------------
+// At this time, this component provides *no* exception safety guarantee.  If
+// any exception is thrown during the invocation of a method on the object,
+// the object is left in an inconsistent state, and using the object from that
+// point forward will cause undefined behavior.
+//
+/// Thread Safety
+///-------------
+// Not thread safe.
+
+// MWC
+
+// BDE
+#include <bdlb_bitutil.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+#include <bsl_functional.h>
+#include <bsl_utility.h>
+#include <bslalg_scalarprimitives.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmf_removecvq.h>
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+
+namespace BloombergLP {
+
+namespace mwcc {
+
+// FORWARD DECLARATION
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+class OrderedFlatHashMap;
+
+// ====================================
+// struct OrderedFlatHashMap_ImpDetails
+// ====================================
+
+/// PRIVATE CLASS. For use only by `mwcc::OrderedFlatHashMap`
+/// implementation.  Provide operations on groups of control bytes.
+struct OrderedFlatHashMap_ImpDetails {
+    // PUBLIC CONSTANTS
+
+    /// Number of control bytes in a group.
+    static const size_t k_GROUP_WIDTH = 8;
+
+    /// Control byte of a slot which has never been used since the last
+    /// rehash.
+    static const unsigned char k_EMPTY = 0x80;
+
+    /// Control byte of a slot whose element has been erased.
+    static const unsigned char k_DELETED = 0xFE;
+
+    /// Index of the slot of an erased element.
+    static const size_t k_INVALID_SLOT = static_cast<size_t>(-1);
+
+    // CLASS METHODS
+
+    /// Return the specified `hash` with its bits mixed, so that both its
+    /// lowest 7 bits and its remaining bits are uniformly distributed even
+    /// for trivial hash functions, such as the identity.
+    static size_t mix(size_t hash);
+
+    /// Return the control byte of a slot holding an element with the
+    /// specified mixed `hash`.
+    static unsigned char tag(size_t hash);
+
+    /// Return the 8 control bytes starting at the specified `controls` as a
+    /// word, the control byte at `controls[i]` being the byte `i` of the
+    /// word in order of significance.
+    static bsl::uint64_t loadGroup(const unsigned char* controls);
+
+    /// Return a mask having the most significant bit of each byte of the
+    /// specified `group` set if the corresponding control byte is equal to
+    /// the specified `control`.  Note that a byte may spuriously match if it
+    /// immediately follows a matching byte, in which case its control byte
+    /// still denotes a slot in use.
+    static bsl::uint64_t matchTag(bsl::uint64_t group, unsigned char control);
+
+    /// Return a mask having the most significant bit of each byte of the
+    /// specified `group` set if the corresponding control byte is empty.
+    static bsl::uint64_t matchEmpty(bsl::uint64_t group);
+
+    /// Return a mask having the most significant bit of each byte of the
+    /// specified `group` set if the corresponding control byte is empty or
+    /// deleted.
+    static bsl::uint64_t matchEmptyOrDeleted(bsl::uint64_t group);
+
+    /// Return the index in its group of the first byte set in the specified
+    /// non-zero `mask`.
+    static size_t firstIndex(bsl::uint64_t mask);
+};
+
+// ===============================
+// struct OrderedFlatHashMap_Entry
+// ===============================
+
+/// PRIVATE CLASS. For use only by `mwcc::OrderedFlatHashMap`
+/// implementation.  Bookkeeping information of an element.
+struct OrderedFlatHashMap_Entry {
+    // PUBLIC DATA
+    size_t d_hash;  // Mixed hash of the key of the element
+
+    size_t d_slot;  // Slot of the element, or 'k_INVALID_SLOT' if the
+                    // element has been erased
+};
+
+// =================================
+// class OrderedFlatHashMap_Iterator
+// =================================
+
+/// PRIVATE CLASS TEMPLATE. For use only by `mwcc::OrderedFlatHashMap`
+/// implementation.
+template <class VALUE>
+class OrderedFlatHashMap_Iterator {
+  private:
+    // PRIVATE TYPES
+    typedef typename bsl::remove_cv<VALUE>::type NcType;
+
+    typedef OrderedFlatHashMap_Iterator<NcType> NcIter;
+
+    typedef OrderedFlatHashMap_ImpDetails ImpDetails;
+
+    typedef OrderedFlatHashMap_Entry Entry;
+
+    // FRIENDS
+    template <class OFHM_KEY,
+              class OFHM_VALUE,
+              class OFHM_HASH,
+              typename OFHM_VALUE_TYPE>
+    friend class OrderedFlatHashMap;
+
+    friend class OrderedFlatHashMap_Iterator<const VALUE>;
+
+    template <class VALUE1, class VALUE2>
+    friend bool operator==(const OrderedFlatHashMap_Iterator<VALUE1>&,
+                           const OrderedFlatHashMap_Iterator<VALUE2>&);
+
+    // DATA
+    VALUE* d_values_p;  // Element array of the container
+
+    const Entry* d_entries_p;  // Entry array of the container
+
+    size_t d_index;  // Index of the element referred to
+
+    size_t d_numEntries;  // Number of used entries of the container,
+                          // which is the index of 'end()'
+
+  private:
+    // PRIVATE CREATORS
+
+    /// Create an iterator referring to the element at the specified
+    /// `index` of the specified `values` and `entries` arrays having the
+    /// specified `numEntries` used entries.
+    OrderedFlatHashMap_Iterator(VALUE*       values,
+                                const Entry* entries,
+                                size_t       index,
+                                size_t       numEntries);
+
+  public:
+    // CREATORS
+
+    /// Create a singular iterator (i.e., one that cannot be incremented,
+    /// decremented, or dereferenced.
+    OrderedFlatHashMap_Iterator();
+
+    /// Create an iterator to `VALUE` from the corresponding iterator to
+    /// non-const `VALUE`.  If `VALUE` is not const-qualified, then this
+    /// constructor becomes the copy constructor.  Otherwise, the copy
+    /// constructor is implicitly generated.
+    OrderedFlatHashMap_Iterator(const NcIter& other);
+
+    // MANIPULATORS
+
+    /// Advance this iterator to the next element in insertion order and
+    /// return its new value.  The behavior is undefined unless this
+    /// iterator is in the range `[begin() .. end())` (i.e., the iterator is
+    /// not singular, is not `end()`, and has not been invalidated).
+    OrderedFlatHashMap_Iterator& operator++();
+
+    /// Move this iterator to the previous element in insertion order and
+    /// return its new value.  The behavior is undefined unless this
+    /// iterator is in the range `( begin(), end() ]` (i.e., the iterator is
+    /// not singular, is not `begin()`, and has not been invalidated).
+    OrderedFlatHashMap_Iterator& operator--();
+
+    /// Advance this iterator to the next element in insertion order and
+    /// return its previous value.  The behavior is undefined unless this
+    /// iterator is in the range `[begin() .. end())` (i.e., the iterator is
+    /// not singular, is not `end()`, and has not been invalidated).
+    OrderedFlatHashMap_Iterator operator++(int);
+
+    /// Move this iterator to the previous element in insertion order and
+    /// return its previous value.  The behavior is undefined unless this
+    /// iterator is in the range `( begin(), end() ]` (i.e., the iterator is
+    /// not singular, is not `begin()`, and has not been invalidated).
+    OrderedFlatHashMap_Iterator operator--(int);
+
+    // ACCESSORS
+
+    /// Return a reference to the element referred to by this iterator.
+    /// The behavior is undefined unless this iterator is in the range
+    /// `[begin() .. end())` (i.e., the iterator is not singular, is not
+    /// `end()`, and has not been invalidated).
+    VALUE& operator*() const;
+
+    /// Return a pointer to the element referred to by this iterator.  The
+    /// behavior is undefined unless this iterator is in the range
+    /// `[begin() .. end())` (i.e., the iterator is not singular, is not
+    /// `end()`, and has not been invalidated).
+    VALUE* operator->() const;
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified iterators `lhs` and `rhs` have the same
+/// value and `false` otherwise.  Two iterators have the same value if both
+/// refer to the same element of the same container or both are the end()
+/// iterator of the same container.  The return value is undefined unless
+/// both `lhs` and `rhs` are non-singular.
+template <class VALUE1, class VALUE2>
+bool operator==(const OrderedFlatHashMap_Iterator<VALUE1>& lhs,
+                const OrderedFlatHashMap_Iterator<VALUE2>& rhs);
+
+/// Return `true` if the specified iterators `lhs` and `rhs` do not have the
+/// same value and `false` otherwise.  Two iterators have the same value if
+/// both refer to the same element of the same container or both are the
+/// end() iterator of the same container.  The return value is undefined
+/// unless both `lhs` and `rhs` are non-singular.
+template <class VALUE1, class VALUE2>
+bool operator!=(const OrderedFlatHashMap_Iterator<VALUE1>& lhs,
+                const OrderedFlatHashMap_Iterator<VALUE2>& rhs);
+
+// ========================
+// class OrderedFlatHashMap
+// ========================
+
+/// This class provides an open-addressing hash table with predictive
+/// iteration order.
+template <class KEY,
+          class VALUE,
+          class HASH       = bsl::hash<KEY>,
+          class VALUE_TYPE = bsl::pair<const KEY, VALUE> >
+class OrderedFlatHashMap {
+  private:
+    // PRIVATE TYPES
+    typedef VALUE_TYPE ValueType;
+
+    typedef typename bsl::remove_cv<ValueType>::type NcValueType;
+
+    typedef OrderedFlatHashMap_ImpDetails ImpDetails;
+    typedef OrderedFlatHashMap_Entry      Entry;
+
+    enum {
+        e_MIN_NUM_SLOTS = 16  // Must be a power of 2, and a multiple of
+                              // the group width
+        ,
+        e_MIN_NUM_ENTRIES = 8
+    };
+
+  public:
+    // TYPES
+    typedef KEY key_type;
+
+    typedef ValueType value_type;
+
+    typedef bslma::Allocator* allocator_type;
+
+    typedef HASH hasher;
+
+    typedef OrderedFlatHashMap_Iterator<value_type> iterator;
+
+    typedef OrderedFlatHashMap_Iterator<const value_type> const_iterator;
+
+  private:
+    // DATA
+    bslma::Allocator* d_allocator_p;
+
+    unsigned char* d_controls_p;  // Control byte of each slot
+
+    size_t* d_slots_p;  // Index in the element array of the element in
+                        // each slot
+
+    size_t d_numSlots;  // Number of slots, a power of 2 which is 0 or
+                        // at least 'e_MIN_NUM_SLOTS'
+
+    size_t d_numDeletedSlots;  // Number of slots whose control byte is
+                               // 'k_DELETED'
+
+    NcValueType* d_values_p;  // Elements, in insertion order
+
+    Entry* d_entries_p;  // Bookkeeping information of each element
+
+    size_t d_numEntries;  // Number of used entries, including the ones
+                          // of erased elements
+
+    size_t d_entryCapacity;  // Number of allocated entries
+
+    size_t d_firstEntry;  // Index of the first entry which is not
+                          // erased, or 'd_numEntries'
+
+    size_t d_numElements;
+
+  private:
+    // PRIVATE ACCESSORS
+
+    /// Return the slot holding the element having the specified `key`
+    /// whose mixed hash is the specified `hash`, or `k_INVALID_SLOT` if no
+    /// such element exists.
+    size_t findSlot(const key_type& key, size_t hash) const;
+
+    /// Return the first empty or deleted slot in the probe sequence of the
+    /// specified mixed `hash`.  The behavior is undefined unless the table
+    /// is not full.
+    size_t findFreeSlot(size_t hash) const;
+
+    /// Return the maximum number of slots that can be in use for the
+    /// specified `numSlots` before the table is rehashed.
+    static size_t maxLoad(size_t numSlots);
+
+    // PRIVATE MANIPULATORS
+
+    /// Rebuild the table of slots with the specified `numSlots` slots,
+    /// discarding all deleted slots.  The behavior is undefined unless
+    /// `numSlots` is a power of 2 which is at least `e_MIN_NUM_SLOTS` and
+    /// can hold all the elements of this container.
+    void rehash(size_t numSlots);
+
+    /// Move all the elements of this container to a newly allocated
+    /// element array of the specified `capacity`, discarding the entries of
+    /// erased elements.  The behavior is undefined unless `size() <=
+    /// capacity`.
+    void reallocateEntries(size_t capacity);
+
+    /// Make room for one more element in the element array and in the table
+    /// of slots.
+    void prepareInsert();
+
+    /// Erase the element at the specified `index` of the element array.
+    void eraseEntry(size_t index);
+
+    /// Destroy all the elements of this container and reset it to an empty
+    /// state, without releasing memory.
+    void destroyAll();
+
+    // PRIVATE CLASS METHODS
+    static const key_type& get_key(const bsl::pair<const KEY, VALUE>& value)
+    {
+        return value.first;
+    }
+
+    static const key_type& get_key(const KEY& value) { return value; }
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(OrderedFlatHashMap,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty `OrderedFlatHashMap` object.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  Use a default constructed
+    /// object of the (template parameter) type `HASH` to organize elements
+    /// in the table.  Note that no memory is allocated until the first
+    /// insertion.
+    explicit OrderedFlatHashMap(bslma::Allocator* basicAllocator = 0);
+
+    /// Create an empty `OrderedFlatHashMap` having room for at least the
+    /// specified `initialCapacity` elements without reallocating.
+    /// Optionally specify a `basicAllocator` used to supply memory.  The
+    /// behavior is undefined unless `0 <= initialCapacity`.
+    explicit OrderedFlatHashMap(int               initialCapacity,
+                                bslma::Allocator* basicAllocator = 0);
+
+    /// Create an `OrderedFlatHashMap` having the same value as the
+    /// specified `other`, that will use the optionally specified
+    /// `basicAllocator` to supply memory.
+    OrderedFlatHashMap(const OrderedFlatHashMap& other,
+                       bslma::Allocator*         basicAllocator = 0);
+
+    /// Destroy this object and each of its elements.
+    ~OrderedFlatHashMap();
+
+    // MANIPULATORS
+
+    /// Assign to this object the value of the specified `other` object.
+    OrderedFlatHashMap& operator=(const OrderedFlatHashMap& other);
+
+    /// Return a mutating iterator referring to the first element in the
+    /// container, if any, or one past the end of this container if there
+    /// are no elements.
+    iterator begin();
+
+    /// Return a mutating iterator referring to one past the end of this
+    /// container.
+    iterator end();
+
+    /// Remove all entries from this container.  Note that this container
+    /// will be empty after calling this method, but allocated memory is
+    /// retained for future use.
+    void clear();
+
+    /// Remove from this container the `value_type` object at the specified
+    /// `position`, and return an iterator referring to the element
+    /// immediately following the removed element, or to the past-the-end
+    /// position if the removed element was the last element in the sequence
+    /// of elements maintained by this container.  The behavior is
+    /// undefined unless `position` refers to a `value_type` object in this
+    /// container.
+    iterator erase(const_iterator position);
+
+    /// Remove from this container the `value_type` object having the
+    /// specified `key`, if it exists, and return 1; otherwise (there is no
+    /// `value_type` object having `key` in this container) return 0 with no
+    /// other effect.
+    size_t erase(const key_type& key);
+
+    /// Remove from this container the sequence of elements starting at the
+    /// specified `first` position and ending before the specified `last`
+    /// position, and return an iterator providing non-modifiable access to
+    /// the element immediately following the last removed element, or the
+    /// position returned by the method `end` if the removed elements were
+    /// last in the sequence.  The behavior is undefined unless `first` is
+    /// an iterator in the range `[begin() .. end()]` (both endpoints
+    /// included) and `last` is an iterator in the range
+    /// `[first .. end()]` (both endpoints included).
+    const_iterator erase(const_iterator first, const_iterator last);
+
+    /// Return an iterator providing modifiable access to the `value_type`
+    /// object in this container having the specified `key`, if such an
+    /// entry exists, and the past-the-end iterator (`end`) otherwise.
+    iterator find(const key_type& key);
+
+    /// Insert the specified `value` at the end of this container if the key
+    /// (the `first` element) of a `value_type` object constructed from
+    /// `value` does not already exist in this container; otherwise, this
+    /// method has no effect.  Return a `pair` whose `first` member is an
+    /// iterator referring to the (possibly newly inserted) `value_type`
+    /// object in this container whose key is the same as that of `value`,
+    /// and whose `second` member is `true` if a new value was inserted, and
+    /// `false` if the value was already present.  Note that this method
+    /// requires that the (template parameter) types `KEY` and `VALUE` both
+    /// be "copy-constructible", and that it invalidates all iterators to
+    /// this container.
+    template <class SOURCE_TYPE>
+    bsl::pair<iterator, bool> insert(const SOURCE_TYPE& value);
+
+    /// Make room for at least the specified `numElements` elements in this
+    /// container, so that it can grow to `size() == numElements` without
+    /// reallocating.  Note that this method invalidates all iterators to
+    /// this container.
+    void reserve(size_t numElements);
+
+    // ACCESSORS
+
+    /// Return an iterator providing non-modifiable access to the first
+    /// `value_type` object in the sequence of `value_type` objects
+    /// maintained by this container, or the `end` iterator if this
+    /// container is empty.
+    const_iterator begin() const;
+
+    /// Return an iterator providing non-modifiable access to the
+    /// past-the-end element in the sequence of `value_type` objects
+    /// maintained by this container.
+    const_iterator end() const;
+
+    /// Return the number of `value_type` objects contained within this
+    /// container having the specified `key`.  Note that since an ordered
+    /// hash map maintains unique keys, the returned value will be either 0
+    /// or 1.
+    size_t count(const key_type& key) const;
+
+    /// Return `true` if this container contains no elements, and `false`
+    /// otherwise.
+    bool empty() const;
+
+    /// Return an iterator providing non-modifiable access to the
+    /// `value_type` object in this container having the specified `key`, if
+    /// such an entry exists, and the past-the-end iterator (`end`)
+    /// otherwise.
+    const_iterator find(const key_type& key) const;
+
+    /// Return the number of elements in this container.
+    size_t size() const;
+
+    /// Return the current ratio between the `size` of this container and
+    /// the number of slots of its table, or 0 if no table has been
+    /// allocated yet.
+    double load_factor() const;
+
+    /// Return the allocator associated with this object.
+    allocator_type get_allocator() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ------------------------------------
+// struct OrderedFlatHashMap_ImpDetails
+// ------------------------------------
+
+inline size_t OrderedFlatHashMap_ImpDetails::mix(size_t hash)
+{
+    // Fibonacci hashing, folding the high half of the product onto its low
+    // half so that the low bits depend on all the bits of 'hash'.
+    bsl::uint64_t product = static_cast<bsl::uint64_t>(hash) *
+                            0x9E3779B97F4A7C15ULL;
+    return static_cast<size_t>(product ^ (product >> 32));
+}
+
+inline unsigned char OrderedFlatHashMap_ImpDetails::tag(size_t hash)
+{
+    return static_cast<unsigned char>(hash & 0x7F);
+}
+
+inline bsl::uint64_t
+OrderedFlatHashMap_ImpDetails::loadGroup(const unsigned char* controls)
+{
+    // Assemble the word byte by byte so that the result does not depend on
+    // the endianness of the platform.  Compilers turn this into a single
+    // load on little-endian platforms.
+    bsl::uint64_t group = 0;
+    for (size_t i = 0; i < k_GROUP_WIDTH; ++i) {
+        group |= static_cast<bsl::uint64_t>(controls[i]) << (8 * i);
+    }
+
+    return group;
+}
+
+inline bsl::uint64_t
+OrderedFlatHashMap_ImpDetails::matchTag(bsl::uint64_t group,
+                                        unsigned char control)
+{
+    const bsl::uint64_t k_LSBS = 0x0101010101010101ULL;
+    const bsl::uint64_t k_MSBS = 0x8080808080808080ULL;
+
+    // A byte of 'x' is zero if and only if the corresponding control byte
+    // matches, and subtracting 1 from a zero byte sets its most significant
+    // bit.
+    const bsl::uint64_t x = group ^ (k_LSBS * control);
+    return (x - k_LSBS) & ~x & k_MSBS;
+}
+
+inline bsl::uint64_t
+OrderedFlatHashMap_ImpDetails::matchEmpty(bsl::uint64_t group)
+{
+    // 'k_EMPTY' is the only control byte having its most significant bit set
+    // and its second least significant bit unset.
+    const bsl::uint64_t k_MSBS = 0x8080808080808080ULL;
+
+    return group & ~(group << 6) & k_MSBS;
+}
+
+inline bsl::uint64_t
+OrderedFlatHashMap_ImpDetails::matchEmptyOrDeleted(bsl::uint64_t group)
+{
+    // 'k_EMPTY' and 'k_DELETED' are the only control bytes having their most
+    // significant bit set and their least significant bit unset.
+    const bsl::uint64_t k_MSBS = 0x8080808080808080ULL;
+
+    return group & ~(group << 7) & k_MSBS;
+}
+
+inline size_t OrderedFlatHashMap_ImpDetails::firstIndex(bsl::uint64_t mask)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(mask != 0);
+
+    return bdlb::BitUtil::numTrailingUnsetBits(mask) / 8;
+}
+
+// ---------------------------------
+// class OrderedFlatHashMap_Iterator
+// ---------------------------------
+
+template <class VALUE>
+inline OrderedFlatHashMap_Iterator<VALUE>::OrderedFlatHashMap_Iterator(
+    VALUE*       values,
+    const Entry* entries,
+    size_t       index,
+    size_t       numEntries)
+: d_values_p(values)
+, d_entries_p(entries)
+, d_index(index)
+, d_numEntries(numEntries)
+{
+}
+
+template <class VALUE>
+inline OrderedFlatHashMap_Iterator<VALUE>::OrderedFlatHashMap_Iterator()
+: d_values_p(0)
+, d_entries_p(0)
+, d_index(0)
+, d_numEntries(0)
+{
+}
+
+template <class VALUE>
+inline OrderedFlatHashMap_Iterator<VALUE>::OrderedFlatHashMap_Iterator(
+    const NcIter& other)
+: d_values_p(other.d_values_p)
+, d_entries_p(other.d_entries_p)
+, d_index(other.d_index)
+, d_numEntries(other.d_numEntries)
+{
+}
+
+// MANIPULATORS
+template <class VALUE>
+inline OrderedFlatHashMap_Iterator<VALUE>&
+OrderedFlatHashMap_Iterator<VALUE>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_index < d_numEntries);
+
+    do {
+        ++d_index;
+    } while (d_index < d_numEntries &&
+             d_entries_p[d_index].d_slot == ImpDetails::k_INVALID_SLOT);
+
+    return *this;
+}
+
+template <class VALUE>
+inline OrderedFlatHashMap_Iterator<VALUE>&
+OrderedFlatHashMap_Iterator<VALUE>::operator--()
+{
+    BSLS_ASSERT_SAFE(d_index > 0);
+
+    do {
+        --d_index;
+    } while (d_entries_p[d_index].d_slot == ImpDetails::k_INVALID_SLOT);
+
+    return *this;
+}
+
+template <class VALUE>
+inline OrderedFlatHashMap_Iterator<VALUE>
+OrderedFlatHashMap_Iterator<VALUE>::operator++(int)
+{
+    OrderedFlatHashMap_Iterator<VALUE> rc(*this);
+    ++(*this);
+    return rc;
+}
+
+template <class VALUE>
+inline OrderedFlatHashMap_Iterator<VALUE>
+OrderedFlatHashMap_Iterator<VALUE>::operator--(int)
+{
+    OrderedFlatHashMap_Iterator<VALUE> rc(*this);
+    --(*this);
+    return rc;
+}
+
+// ACCESSORS
+template <class VALUE>
+inline VALUE& OrderedFlatHashMap_Iterator<VALUE>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_index < d_numEntries);
+    return d_values_p[d_index];
+}
+
+template <class VALUE>
+inline VALUE* OrderedFlatHashMap_Iterator<VALUE>::operator->() const
+{
+    BSLS_ASSERT_SAFE(d_index < d_numEntries);
+    return d_values_p + d_index;
+}
+
+// FREE OPERATORS
+template <class VALUE1, class VALUE2>
+inline bool operator==(const OrderedFlatHashMap_Iterator<VALUE1>& lhs,
+                       const OrderedFlatHashMap_Iterator<VALUE2>& rhs)
+{
+    return lhs.d_index == rhs.d_index;
+}
+
+template <class VALUE1, class VALUE2>
+inline bool operator!=(const OrderedFlatHashMap_Iterator<VALUE1>& lhs,
+                       const OrderedFlatHashMap_Iterator<VALUE2>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// ------------------------
+// class OrderedFlatHashMap
+// ------------------------
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline size_t OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::findSlot(
+    const key_type& key,
+    size_t          hash) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_numSlots == 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return ImpDetails::k_INVALID_SLOT;  // RETURN
+    }
+
+    const unsigned char tag   = ImpDetails::tag(hash);
+    const size_t        mask  = d_numSlots / ImpDetails::k_GROUP_WIDTH - 1;
+    size_t              group = (hash >> 7) & mask;
+
+    // Triangular probing over the groups, which visits each group exactly
+    // once since their number is a power of 2.  The loop terminates since
+    // the table always has at least one empty slot.
+    for (size_t step = 1;; ++step) {
+        const size_t        first   = group * ImpDetails::k_GROUP_WIDTH;
+        const bsl::uint64_t control = ImpDetails::loadGroup(d_controls_p +
+                                                            first);
+
+        for (bsl::uint64_t match = ImpDetails::matchTag(control, tag);
+             match != 0;
+             match &= match - 1) {
+            const size_t slot = first + ImpDetails::firstIndex(match);
+            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                    get_key(d_values_p[d_slots_p[slot]]) == key)) {
+                return slot;  // RETURN
+            }
+        }
+
+        if (ImpDetails::matchEmpty(control) != 0) {
+            return ImpDetails::k_INVALID_SLOT;  // RETURN
+        }
+
+        group = (group + step) & mask;
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline size_t
+OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::findFreeSlot(
+    size_t hash) const
+{
+    const size_t mask  = d_numSlots / ImpDetails::k_GROUP_WIDTH - 1;
+    size_t       group = (hash >> 7) & mask;
+
+    for (size_t step = 1;; ++step) {
+        const size_t        first = group * ImpDetails::k_GROUP_WIDTH;
+        const bsl::uint64_t match = ImpDetails::matchEmptyOrDeleted(
+            ImpDetails::loadGroup(d_controls_p + first));
+        if (match != 0) {
+            return first + ImpDetails::firstIndex(match);  // RETURN
+        }
+
+        group = (group + step) & mask;
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline size_t
+OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::maxLoad(size_t numSlots)
+{
+    return numSlots - numSlots / 8;
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+void OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::rehash(size_t numSlots)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(numSlots >= e_MIN_NUM_SLOTS);
+    BSLS_ASSERT_SAFE((numSlots & (numSlots - 1)) == 0);
+    BSLS_ASSERT_SAFE(d_numElements < maxLoad(numSlots));
+
+    if (numSlots != d_numSlots) {
+        d_allocator_p->deallocate(d_controls_p);
+        d_allocator_p->deallocate(d_slots_p);
+
+        d_controls_p = static_cast<unsigned char*>(
+            d_allocator_p->allocate(numSlots));
+        d_slots_p = static_cast<size_t*>(
+            d_allocator_p->allocate(numSlots * sizeof(size_t)));
+        d_numSlots = numSlots;
+    }
+
+    bsl::memset(d_controls_p, ImpDetails::k_EMPTY, d_numSlots);
+    d_numDeletedSlots = 0;
+
+    // Reinsert each element, using its cached hash.
+    for (size_t i = d_firstEntry; i < d_numEntries; ++i) {
+        Entry& entry = d_entries_p[i];
+        if (entry.d_slot == ImpDetails::k_INVALID_SLOT) {
+            continue;  // CONTINUE
+        }
+
+        const size_t slot  = findFreeSlot(entry.d_hash);
+        d_controls_p[slot] = ImpDetails::tag(entry.d_hash);
+        d_slots_p[slot]    = i;
+        entry.d_slot       = slot;
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+void OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::reallocateEntries(
+    size_t capacity)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_numElements <= capacity);
+
+    NcValueType* values = static_cast<NcValueType*>(
+        d_allocator_p->allocate(capacity * sizeof(NcValueType)));
+    Entry* entries = static_cast<Entry*>(
+        d_allocator_p->allocate(capacity * sizeof(Entry)));
+
+    // Move the elements which are not erased to the front of the new arrays,
+    // in order, and update the index held by their slot.
+    size_t numEntries = 0;
+    for (size_t i = d_firstEntry; i < d_numEntries; ++i) {
+        const Entry& entry = d_entries_p[i];
+        if (entry.d_slot == ImpDetails::k_INVALID_SLOT) {
+            continue;  // CONTINUE
+        }
+
+        bslalg::ScalarPrimitives::destructiveMove(values + numEntries,
+                                                  d_values_p + i,
+                                                  d_allocator_p);
+        entries[numEntries]     = entry;
+        d_slots_p[entry.d_slot] = numEntries;
+        ++numEntries;
+    }
+
+    BSLS_ASSERT_SAFE(numEntries == d_numElements);
+
+    d_allocator_p->deallocate(d_values_p);
+    d_allocator_p->deallocate(d_entries_p);
+
+    d_values_p      = values;
+    d_entries_p     = entries;
+    d_numEntries    = numEntries;
+    d_entryCapacity = capacity;
+    d_firstEntry    = 0;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline void OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::prepareInsert()
+{
+    if (d_numElements == 0 && d_numEntries != 0) {
+        // All elements have been erased: start over from the beginning of the
+        // element array and forget about the deleted slots.
+        destroyAll();
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_numEntries ==
+                                              d_entryCapacity)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        // Grow the element array, unless enough elements have been erased
+        // for compacting it to be sufficient.
+        reallocateEntries(bsl::max(2 * d_numElements,
+                                   static_cast<size_t>(e_MIN_NUM_ENTRIES)));
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            d_numElements + d_numDeletedSlots + 1 > maxLoad(d_numSlots))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        // Double the table, unless enough slots are deleted for purging them
+        // to be sufficient.
+        size_t numSlots = d_numSlots;
+        if (numSlots == 0) {
+            numSlots = e_MIN_NUM_SLOTS;
+        }
+        else if (2 * (d_numElements + 1) > maxLoad(numSlots)) {
+            numSlots *= 2;
+        }
+
+        rehash(numSlots);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline void
+OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::eraseEntry(size_t index)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(index < d_numEntries);
+
+    Entry&       entry = d_entries_p[index];
+    const size_t slot  = entry.d_slot;
+    BSLS_ASSERT_SAFE(slot != ImpDetails::k_INVALID_SLOT);
+
+    // A slot can be made empty again if its group has an empty slot, since
+    // no probe sequence ever went past that group in that case.
+    const size_t first = slot - slot % ImpDetails::k_GROUP_WIDTH;
+    if (ImpDetails::matchEmpty(ImpDetails::loadGroup(d_controls_p + first))) {
+        d_controls_p[slot] = ImpDetails::k_EMPTY;
+    }
+    else {
+        d_controls_p[slot] = ImpDetails::k_DELETED;
+        ++d_numDeletedSlots;
+    }
+
+    d_values_p[index].~NcValueType();
+    entry.d_slot = ImpDetails::k_INVALID_SLOT;
+    --d_numElements;
+
+    while (d_firstEntry < d_numEntries &&
+           d_entries_p[d_firstEntry].d_slot == ImpDetails::k_INVALID_SLOT) {
+        ++d_firstEntry;
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+void OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::destroyAll()
+{
+    for (size_t i = d_firstEntry; i < d_numEntries; ++i) {
+        if (d_entries_p[i].d_slot != ImpDetails::k_INVALID_SLOT) {
+            d_values_p[i].~NcValueType();
+        }
+    }
+
+    if (d_numSlots != 0) {
+        bsl::memset(d_controls_p, ImpDetails::k_EMPTY, d_numSlots);
+    }
+
+    d_numDeletedSlots = 0;
+    d_numEntries      = 0;
+    d_firstEntry      = 0;
+    d_numElements     = 0;
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::OrderedFlatHashMap(
+    bslma::Allocator* basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_controls_p(0)
+, d_slots_p(0)
+, d_numSlots(0)
+, d_numDeletedSlots(0)
+, d_values_p(0)
+, d_entries_p(0)
+, d_numEntries(0)
+, d_entryCapacity(0)
+, d_firstEntry(0)
+, d_numElements(0)
+{
+    // NOTHING
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::OrderedFlatHashMap(
+    int               initialCapacity,
+    bslma::Allocator* basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_controls_p(0)
+, d_slots_p(0)
+, d_numSlots(0)
+, d_numDeletedSlots(0)
+, d_values_p(0)
+, d_entries_p(0)
+, d_numEntries(0)
+, d_entryCapacity(0)
+, d_firstEntry(0)
+, d_numElements(0)
+{
+    BSLS_ASSERT_SAFE(0 <= initialCapacity);
+
+    reserve(initialCapacity);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::OrderedFlatHashMap(
+    const OrderedFlatHashMap& other,
+    bslma::Allocator*         basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_controls_p(0)
+, d_slots_p(0)
+, d_numSlots(0)
+, d_numDeletedSlots(0)
+, d_values_p(0)
+, d_entries_p(0)
+, d_numEntries(0)
+, d_entryCapacity(0)
+, d_firstEntry(0)
+, d_numElements(0)
+{
+    reserve(other.size());
+
+    // Iterate over 'other' and insert elements in 'this'.
+
+    const_iterator cit = other.begin();
+    for (; cit != other.end(); ++cit) {
+        insert(*cit);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::~OrderedFlatHashMap()
+{
+    destroyAll();
+
+    d_allocator_p->deallocate(d_controls_p);
+    d_allocator_p->deallocate(d_slots_p);
+    d_allocator_p->deallocate(d_values_p);
+    d_allocator_p->deallocate(d_entries_p);
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>&
+OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::operator=(
+    const OrderedFlatHashMap& other)
+{
+    if (this != &other) {
+        clear();
+        reserve(other.size());
+
+        // Iterate over 'other' and insert elements in 'this'.
+
+        const_iterator cit = other.begin();
+        for (; cit != other.end(); ++cit) {
+            insert(*cit);
+        }
+    }
+
+    return *this;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline typename OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::iterator
+OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::begin()
+{
+    return iterator(d_values_p, d_entries_p, d_firstEntry, d_numEntries);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline typename OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::iterator
+OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::end()
+{
+    return iterator(d_values_p, d_entries_p, d_numEntries, d_numEntries);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline void OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::clear()
+{
+    destroyAll();
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline typename OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::iterator
+OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::erase(
+    const_iterator position)
+{
+    BSLS_ASSERT_SAFE(end() != position);
+
+    iterator nextPosition(d_values_p,
+                          d_entries_p,
+                          position.d_index,
+                          d_numEntries);
+    eraseEntry(position.d_index);
+    return ++nextPosition;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline size_t
+OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::erase(const key_type& key)
+{
+    hasher       hash;
+    const size_t slot = findSlot(key, ImpDetails::mix(hash(key)));
+    if (slot == ImpDetails::k_INVALID_SLOT) {
+        return 0;  // RETURN
+    }
+
+    eraseEntry(d_slots_p[slot]);
+    return 1;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+typename OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::const_iterator
+OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::erase(const_iterator first,
+                                                        const_iterator last)
+{
+    while (first != last) {
+        first = erase(first);
+    }
+
+    return first;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline typename OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::iterator
+OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::find(const key_type& key)
+{
+    hasher       hash;
+    const size_t slot = findSlot(key, ImpDetails::mix(hash(key)));
+    if (slot == ImpDetails::k_INVALID_SLOT) {
+        return end();  // RETURN
+    }
+
+    return iterator(d_values_p, d_entries_p, d_slots_p[slot], d_numEntries);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+template <class SOURCE_TYPE>
+inline bsl::pair<
+    typename OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::iterator,
+    bool>
+OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::insert(
+    const SOURCE_TYPE& value)
+{
+    const value_type& element = value;
+    hasher            hash;
+    const size_t      mixedHash = ImpDetails::mix(hash(get_key(element)));
+
+    size_t slot = findSlot(get_key(element), mixedHash);
+    if (slot != ImpDetails::k_INVALID_SLOT) {
+        return bsl::make_pair(iterator(d_values_p,
+                                       d_entries_p,
+                                       d_slots_p[slot],
+                                       d_numEntries),
+                              false);  // RETURN
+    }
+    // Element does not exist in the container
+
+    prepareInsert();
+
+    slot = findFreeSlot(mixedHash);
+    if (d_controls_p[slot] == ImpDetails::k_DELETED) {
+        --d_numDeletedSlots;
+    }
+
+    const size_t index = d_numEntries;
+    bslalg::ScalarPrimitives::copyConstruct(d_values_p + index,
+                                            element,
+                                            d_allocator_p);
+    d_entries_p[index].d_hash = mixedHash;
+    d_entries_p[index].d_slot = slot;
+    d_controls_p[slot]        = ImpDetails::tag(mixedHash);
+    d_slots_p[slot]           = index;
+
+    ++d_numEntries;
+    ++d_numElements;
+    return bsl::make_pair(
+        iterator(d_values_p, d_entries_p, index, d_numEntries),
+        true);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+void OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::reserve(
+    size_t numElements)
+{
+    if (numElements > d_entryCapacity - (d_numEntries - d_numElements)) {
+        reallocateEntries(bsl::max(numElements,
+                                   static_cast<size_t>(e_MIN_NUM_ENTRIES)));
+    }
+
+    size_t numSlots = e_MIN_NUM_SLOTS;
+    while (maxLoad(numSlots) <= numElements) {
+        numSlots *= 2;
+    }
+
+    if (numSlots > d_numSlots) {
+        rehash(numSlots);
+    }
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline
+    typename OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::const_iterator
+    OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::begin() const
+{
+    return const_iterator(d_values_p, d_entries_p, d_firstEntry, d_numEntries);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline
+    typename OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::const_iterator
+    OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::end() const
+{
+    return const_iterator(d_values_p, d_entries_p, d_numEntries, d_numEntries);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline size_t
+OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::count(
+    const key_type& key) const
+{
+    hasher       hash;
+    const size_t slot = findSlot(key, ImpDetails::mix(hash(key)));
+    return slot == ImpDetails::k_INVALID_SLOT ? 0 : 1;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline bool OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::empty() const
+{
+    return 0 == d_numElements;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline
+    typename OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::const_iterator
+    OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::find(
+        const key_type& key) const
+{
+    hasher       hash;
+    const size_t slot = findSlot(key, ImpDetails::mix(hash(key)));
+    if (slot == ImpDetails::k_INVALID_SLOT) {
+        return end();  // RETURN
+    }
+
+    return const_iterator(d_values_p,
+                          d_entries_p,
+                          d_slots_p[slot],
+                          d_numEntries);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline size_t OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::size() const
+{
+    return d_numElements;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline double
+OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::load_factor() const
+{
+    if (d_numSlots == 0) {
+        return 0.0;  // RETURN
+    }
+
+    return static_cast<double>(d_numElements) /
+           static_cast<double>(d_numSlots);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline
+    typename OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::allocator_type
+    OrderedFlatHashMap<KEY, VALUE, HASH, VALUE_TYPE>::get_allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
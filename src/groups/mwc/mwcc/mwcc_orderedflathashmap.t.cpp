@@ -0,0 +1,739 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcc_orderedflathashmap.t.cpp                                      -*-C++-*-
+#include <mwcc_orderedflathashmap.h>
+
+// MWC
+#include <mwcc_orderedhashmap.h>
+
+// BDE
+#include <bsl_cstdint.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>  // for performance comparison test
+#include <bsl_utility.h>
+#include <bslh_hash.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// BENCHMARKING LIBRARY
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <benchmark/benchmark.h>
+#endif
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+namespace {
+
+/// Hash function mapping each key to itself, which is the worst case for
+/// the distribution of the hash bits.
+class IdentityHasher {
+  public:
+    IdentityHasher() {}
+
+    size_t operator()(int x) const { return x; }
+};
+
+struct TestKeyType {
+    // CLASS LEVEL DATA
+    static int s_numDeletions;
+
+    // DATA
+    int d_a;
+
+    // CREATORS
+    TestKeyType(int a) { d_a = a; }
+
+    ~TestKeyType() { s_numDeletions += 1; }
+};
+
+int TestKeyType::s_numDeletions(0);
+
+// FREE FUNCTIONS
+bool operator==(const TestKeyType& lhs, const TestKeyType& rhs)
+{
+    return lhs.d_a == rhs.d_a;
+}
+
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& hashAlgo, const TestKeyType& key)
+{
+    using bslh::hashAppend;  // for ADL
+    hashAppend(hashAlgo, key.d_a);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise basic functionality before beginning testing in earnest.
+//   Probe that functionality to discover basic errors.
+//
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    typedef mwcc::OrderedFlatHashMap<int, bsl::string> MyMapType;
+    typedef MyMapType::iterator                        IterType;
+    typedef MyMapType::const_iterator                  ConstIterType;
+
+    const bsl::string s("foo", s_allocator_p);
+
+    MyMapType        map(s_allocator_p);
+    const MyMapType& cmap = map;
+    ASSERT_EQ(true, map.begin() == map.end());
+    ASSERT_EQ(true, cmap.begin() == cmap.end());
+
+    map.clear();
+
+    ASSERT_EQ(0U, map.count(1));
+    ASSERT_EQ(0U, map.erase(1));
+    ASSERT_EQ(true, map.end() == map.find(1));
+    ASSERT_EQ(true, cmap.empty());
+    ASSERT_EQ(true, cmap.end() == cmap.find(1));
+    ASSERT_EQ(0U, cmap.count(1));
+    ASSERT_EQ(0U, cmap.size());
+
+    bsl::pair<IterType, bool> rc = map.insert(bsl::make_pair(1, s));
+    ASSERT_EQ(true, rc.first != map.end());
+    ASSERT_EQ(rc.second, true);
+    ASSERT_EQ(1, rc.first->first);
+    ASSERT_EQ(s, rc.first->second);
+    ASSERT_EQ(1U, cmap.count(1));
+
+    rc = map.insert(bsl::make_pair(1, bsl::string("bar", s_allocator_p)));
+    ASSERT_EQ(rc.second, false);
+    ASSERT_EQ(s, rc.first->second);
+
+    ConstIterType cit = cmap.find(1);
+    ASSERT_EQ(true, cmap.end() != cit);
+    ASSERT_EQ(1U, cmap.size());
+    ASSERT_EQ(false, cmap.empty());
+    ASSERT_EQ(1U, map.erase(1));
+    ASSERT_EQ(true, map.begin() == map.end());
+    ASSERT_EQ(true, cmap.begin() == cmap.end());
+    ASSERT_EQ(true, cmap.end() == cmap.find(1));
+}
+
+static void test2_impDetails_match()
+// ------------------------------------------------------------------------
+// IMP DETAILS - MATCH
+//
+// Concerns:
+//   1. Matching a group of control bytes against a tag, against empty
+//      control bytes and against empty or deleted control bytes reports
+//      exactly the expected bytes, in order of significance.
+//
+// Testing:
+//   OrderedFlatHashMap_ImpDetails::loadGroup
+//   OrderedFlatHashMap_ImpDetails::matchTag
+//   OrderedFlatHashMap_ImpDetails::matchEmpty
+//   OrderedFlatHashMap_ImpDetails::matchEmptyOrDeleted
+//   OrderedFlatHashMap_ImpDetails::firstIndex
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("IMP DETAILS - MATCH");
+
+    typedef mwcc::OrderedFlatHashMap_ImpDetails ImpDetails;
+
+    const unsigned char k_E = ImpDetails::k_EMPTY;
+    const unsigned char k_D = ImpDetails::k_DELETED;
+
+    const unsigned char controls[] =
+        {0x11, k_D, 0x05, k_E, 0x05, 0x7F, k_E, 0x00};
+    const bsl::uint64_t group = ImpDetails::loadGroup(controls);
+
+    bsl::uint64_t match = ImpDetails::matchTag(group, 0x05);
+    ASSERT_EQ(ImpDetails::firstIndex(match), 2U);
+    match &= match - 1;
+    ASSERT_EQ(ImpDetails::firstIndex(match), 4U);
+    match &= match - 1;
+    ASSERT_EQ(match, 0U);
+
+    ASSERT_EQ(ImpDetails::matchTag(group, 0x42), 0U);
+
+    match = ImpDetails::matchEmpty(group);
+    ASSERT_EQ(ImpDetails::firstIndex(match), 3U);
+    match &= match - 1;
+    ASSERT_EQ(ImpDetails::firstIndex(match), 6U);
+    match &= match - 1;
+    ASSERT_EQ(match, 0U);
+
+    match = ImpDetails::matchEmptyOrDeleted(group);
+    ASSERT_EQ(ImpDetails::firstIndex(match), 1U);
+    match &= match - 1;
+    ASSERT_EQ(ImpDetails::firstIndex(match), 3U);
+    match &= match - 1;
+    ASSERT_EQ(ImpDetails::firstIndex(match), 6U);
+    match &= match - 1;
+    ASSERT_EQ(match, 0U);
+}
+
+static void test3_insert()
+// ------------------------------------------------------------------------
+// INSERT
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("INSERT");
+
+    typedef mwcc::OrderedFlatHashMap<int, int, IdentityHasher> MyMapType;
+    typedef MyMapType::iterator                                IterType;
+    typedef MyMapType::const_iterator                          ConstIterType;
+    typedef bsl::pair<IterType, bool>                          RcType;
+
+    MyMapType map(s_allocator_p);
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+    const int k_NUM_ELEMENTS = 1000 * 1000;  // 1M
+#else
+    // Avoid timeout on AIX and Solaris
+    const int k_NUM_ELEMENTS = 100 * 1000;   // 100K
+#endif
+
+    // Insert 1M elements
+    for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+        RcType rc = map.insert(bsl::make_pair(i, i + 1));
+        ASSERT_EQ_D(i, true, rc.second);
+        ASSERT_EQ_D(i, true, rc.first != map.end());
+        ASSERT_EQ_D(i, i, rc.first->first);
+        ASSERT_EQ_D(i, (i + 1), rc.first->second);
+        ASSERT_EQ_D(i, true, 0.875 >= map.load_factor());
+    }
+
+    ASSERT_EQ(map.size(), static_cast<unsigned int>(k_NUM_ELEMENTS));
+
+    // Find each element
+    for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+        ConstIterType cit = map.find(i);
+        ASSERT_EQ_D(i, true, cit != map.end());
+        ASSERT_EQ_D(i, (i + 1), cit->second);
+    }
+    ASSERT_EQ(true, map.end() == map.find(k_NUM_ELEMENTS));
+
+    // Iterate and confirm
+    {
+        const MyMapType& cmap = map;
+        int              i    = 0;
+        for (ConstIterType cit = cmap.begin(); cit != cmap.end(); ++cit) {
+            ASSERT_EQ_D(i, true, i < k_NUM_ELEMENTS);
+            ASSERT_EQ_D(i, i, cit->first);
+            ASSERT_EQ_D(i, (i + 1), cit->second);
+            ++i;
+        }
+        ASSERT_EQ(i, k_NUM_ELEMENTS);
+    }
+
+    // Reverse iterate using --(end()) and confirm
+    {
+        const MyMapType& cmap = map;
+        int              i    = k_NUM_ELEMENTS - 1;
+        ConstIterType    cit  = --(cmap.end());  // last element
+        for (; cit != cmap.begin(); --cit) {
+            ASSERT_EQ_D(i, true, i > 0);
+            ASSERT_EQ_D(i, i, cit->first);
+            ASSERT_EQ_D(i, (i + 1), cit->second);
+            --i;
+        }
+        ASSERT_EQ(true, cit == cmap.begin());
+        ASSERT_EQ(cit->first, i);
+        ASSERT_EQ(cit->second, (i + 1));
+    }
+}
+
+static void test4_insertEraseInsert()
+// ------------------------------------------------------------------------
+// INSERT ERASE INSERT
+//
+// Concerns:
+//   Erased elements are skipped by iteration and lookup, and elements
+//   inserted after an erasure are appended in insertion order.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("INSERT ERASE INSERT");
+
+    typedef mwcc::OrderedFlatHashMap<int, int> MyMapType;
+    typedef MyMapType::iterator                IterType;
+    typedef MyMapType::const_iterator          ConstIterType;
+    typedef bsl::pair<IterType, bool>          RcType;
+
+    MyMapType map(s_allocator_p);
+
+    const int k_NUM_ELEMENTS = 100 * 1000;  // 100K
+    const int k_STEP         = 10;
+
+    // Insert elements
+    for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+        RcType rc = map.insert(bsl::make_pair(i, i + 1));
+        ASSERT_EQ_D(i, rc.second, true);
+    }
+
+    // Erase few elements
+    for (int i = 0; i < k_NUM_ELEMENTS; i += k_STEP) {
+        ASSERT_EQ_D(i, 1U, map.erase(i));
+        ASSERT_EQ_D(i, 0U, map.erase(i));
+    }
+
+    // Find erased elements
+    for (int i = 0; i < k_NUM_ELEMENTS; i += k_STEP) {
+        ASSERT_EQ_D(i, true, map.end() == map.find(i));
+    }
+
+    // Iterate and confirm
+    {
+        const MyMapType& cmap = map;
+        int              i    = 1;
+        for (ConstIterType cit = cmap.begin(); cit != cmap.end(); ++cit) {
+            ASSERT_EQ_D(i, true, i < k_NUM_ELEMENTS);
+            ASSERT_EQ_D(i, i, cit->first);
+            ASSERT_EQ_D(i, (i + 1), cit->second);
+            ++i;
+            if (i % k_STEP == 0) {
+                ++i;
+            }
+        }
+    }
+
+    // Insert elements which were erased earlier
+    for (int i = 0; i < k_NUM_ELEMENTS; i += k_STEP) {
+        RcType rc = map.insert(bsl::make_pair(i, i + 1));
+        ASSERT_EQ_D(i, true, rc.second);
+        ASSERT_EQ_D(i, i, rc.first->first);
+        ASSERT_EQ_D(i, (i + 1), rc.first->second);
+    }
+
+    ASSERT_EQ(map.size(), static_cast<unsigned int>(k_NUM_ELEMENTS));
+
+    // Iterate and confirm
+    {
+        IterType it = map.begin();
+        int      i  = 1;
+
+        // Iterate over original elements
+        for (; it != map.end(); ++it) {
+            ASSERT_EQ_D(i, i, it->first);
+            ASSERT_EQ_D(i, (i + 1), it->second);
+            if (it->first == (k_NUM_ELEMENTS - 1)) {
+                ++it;
+                break;  // BREAK
+            }
+            ++i;
+            if (i % k_STEP == 0) {
+                ++i;
+            }
+        }
+
+        // Iterate over elements inserted after erase operation
+        for (i = 0; i < k_NUM_ELEMENTS; i += k_STEP) {
+            ASSERT_EQ_D(i, true, it != map.end());
+            ASSERT_EQ_D(i, i, it->first);
+            ASSERT_EQ_D(i, (i + 1), it->second);
+            ++it;
+        }
+
+        ASSERT_EQ(true, it == map.end());
+    }
+}
+
+static void test5_eraseWhileIterating()
+// ------------------------------------------------------------------------
+// ERASE WHILE ITERATING
+//
+// Concerns:
+//   1. 'erase(const_iterator)' returns the iterator to the next element.
+//   2. 'erase(first, last)' erases exactly the elements in the range.
+//   3. A map used as a FIFO (inserting at the back and erasing at the
+//      front) keeps a bounded load.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("ERASE WHILE ITERATING");
+
+    typedef mwcc::OrderedFlatHashMap<int, int> MyMapType;
+    typedef MyMapType::iterator                IterType;
+    typedef MyMapType::const_iterator          ConstIterType;
+
+    const int k_NUM_ELEMENTS = 1000;
+
+    MyMapType map(s_allocator_p);
+    for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+        map.insert(bsl::make_pair(i, i));
+    }
+
+    // 1. Erase every other element
+    IterType it = map.begin();
+    while (it != map.end()) {
+        const int key = it->first;
+        it            = map.erase(it);
+        if (it != map.end()) {
+            ASSERT_EQ_D(key, key + 1, it->first);
+            ++it;
+        }
+    }
+    ASSERT_EQ(map.size(), static_cast<unsigned int>(k_NUM_ELEMENTS / 2));
+
+    int i = 1;
+    for (ConstIterType cit = map.begin(); cit != map.end(); ++cit, i += 2) {
+        ASSERT_EQ_D(i, i, cit->first);
+    }
+
+    // 2. Erase a range
+    ConstIterType first = map.find(11);
+    ConstIterType last  = map.find(21);
+    ConstIterType cit   = map.erase(first, last);
+    ASSERT_EQ(true, cit == map.find(21));
+    ASSERT_EQ(map.size(), static_cast<unsigned int>(k_NUM_ELEMENTS / 2 - 5));
+    for (i = 11; i < 21; i += 2) {
+        ASSERT_EQ_D(i, 0U, map.count(i));
+    }
+
+    cit = map.erase(map.begin(), map.end());
+    ASSERT_EQ(true, cit == map.end());
+    ASSERT_EQ(true, map.empty());
+
+    // 3. FIFO
+    const int k_WINDOW = 100;
+    for (i = 0; i < 100 * k_NUM_ELEMENTS; ++i) {
+        map.insert(bsl::make_pair(i, i));
+        if (i >= k_WINDOW) {
+            ASSERT_EQ_D(i, i - k_WINDOW, map.begin()->first);
+            map.erase(map.begin());
+        }
+    }
+    ASSERT_EQ(map.size(), static_cast<unsigned int>(k_WINDOW));
+    ASSERT_EQ(true, map.load_factor() > 0.25);
+}
+
+static void test6_clear()
+// ------------------------------------------------------------------------
+// CLEAR
+//
+// Concerns:
+//   Clearing the map and destroying it destroy each element exactly once.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("CLEAR");
+
+    typedef mwcc::OrderedFlatHashMap<TestKeyType, int> MyMapType;
+
+    const int k_NUM_ELEMENTS = 100;
+
+    {
+        MyMapType map(s_allocator_p);
+        for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+            map.insert(bsl::make_pair(TestKeyType(i), i));
+        }
+        ASSERT_EQ(map.size(), static_cast<unsigned int>(k_NUM_ELEMENTS));
+
+        TestKeyType::s_numDeletions = 0;
+        map.clear();
+        ASSERT_EQ(TestKeyType::s_numDeletions, k_NUM_ELEMENTS);
+        ASSERT_EQ(true, map.empty());
+        ASSERT_EQ(true, map.begin() == map.end());
+
+        for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+            map.insert(bsl::make_pair(TestKeyType(i), i));
+        }
+        ASSERT_EQ(1U, map.erase(TestKeyType(0)));
+
+        TestKeyType::s_numDeletions = 0;
+    }
+
+    // Only the remaining elements are destroyed along with the map.
+    ASSERT_EQ(TestKeyType::s_numDeletions, k_NUM_ELEMENTS - 1);
+}
+
+static void test7_copyAndAssignment()
+// ------------------------------------------------------------------------
+// COPY AND ASSIGNMENT
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("COPY AND ASSIGNMENT");
+
+    typedef mwcc::OrderedFlatHashMap<int, bsl::string> MyMapType;
+    typedef MyMapType::const_iterator                  ConstIterType;
+
+    const int k_NUM_ELEMENTS = 1000;
+
+    MyMapType map(s_allocator_p);
+    for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+        map.insert(bsl::make_pair(i, bsl::string(i, 'x', s_allocator_p)));
+    }
+    for (int i = 0; i < k_NUM_ELEMENTS; i += 3) {
+        map.erase(i);
+    }
+
+    MyMapType copy(map, s_allocator_p);
+    MyMapType assigned(s_allocator_p);
+    assigned.insert(bsl::make_pair(-1, bsl::string("y", s_allocator_p)));
+    assigned = map;
+
+    ASSERT_EQ(copy.size(), map.size());
+    ASSERT_EQ(assigned.size(), map.size());
+    ASSERT_EQ(0U, assigned.count(-1));
+
+    ConstIterType cit = copy.begin();
+    ConstIterType ait = assigned.begin();
+    ConstIterType mit = map.begin();
+    for (; mit != map.end(); ++mit, ++cit, ++ait) {
+        ASSERT_EQ_D(mit->first, mit->first, cit->first);
+        ASSERT_EQ_D(mit->first, mit->second, cit->second);
+        ASSERT_EQ_D(mit->first, mit->first, ait->first);
+        ASSERT_EQ_D(mit->first, mit->second, ait->second);
+    }
+    ASSERT_EQ(true, cit == copy.end());
+    ASSERT_EQ(true, ait == assigned.end());
+}
+
+BSLA_MAYBE_UNUSED
+static void testN1_insertPerformance()
+// ------------------------------------------------------------------------
+// INSERT PERFORMANCE
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("INSERT PERFORMANCE");
+
+    // Performance comparison of insert() with mwcc::OrderedHashMap
+    const int k_NUM_ELEMENTS = 5000000;
+
+    {
+        typedef mwcc::OrderedFlatHashMap<int, int> MyMapType;
+
+        MyMapType map(k_NUM_ELEMENTS, s_allocator_p);
+
+        bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+        for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+            map.insert(bsl::make_pair(i, i));
+        }
+        bsls::Types::Int64 end = bsls::TimeUtil::getTimer();
+        cout << "Time diff (OrderedFlatHashMap): " << end - begin << endl;
+    }
+
+    {
+        typedef mwcc::OrderedHashMap<int, int> MyMapType;
+
+        MyMapType map(k_NUM_ELEMENTS, s_allocator_p);
+
+        bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+        for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+            map.insert(bsl::make_pair(i, i));
+        }
+        bsls::Types::Int64 end = bsls::TimeUtil::getTimer();
+        cout << "Time diff (OrderedHashMap)    : " << end - begin << endl;
+    }
+}
+
+BSLA_MAYBE_UNUSED
+static void testN2_findPerformance()
+// ------------------------------------------------------------------------
+// FIND PERFORMANCE
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("FIND PERFORMANCE");
+
+    // Performance comparison of find() with mwcc::OrderedHashMap
+    const int k_NUM_ELEMENTS = 5000000;
+
+    {
+        typedef mwcc::OrderedFlatHashMap<int, int> MyMapType;
+
+        MyMapType map(k_NUM_ELEMENTS, s_allocator_p);
+        for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+            map.insert(bsl::make_pair(i, i));
+        }
+
+        bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+        for (int i = 0; i < 2 * k_NUM_ELEMENTS; ++i) {
+            ASSERT_EQ_D(i, (i < k_NUM_ELEMENTS), map.find(i) != map.end());
+        }
+        bsls::Types::Int64 end = bsls::TimeUtil::getTimer();
+        cout << "Time diff (OrderedFlatHashMap): " << end - begin << endl;
+    }
+
+    {
+        typedef mwcc::OrderedHashMap<int, int> MyMapType;
+
+        MyMapType map(k_NUM_ELEMENTS, s_allocator_p);
+        for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+            map.insert(bsl::make_pair(i, i));
+        }
+
+        bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+        for (int i = 0; i < 2 * k_NUM_ELEMENTS; ++i) {
+            ASSERT_EQ_D(i, (i < k_NUM_ELEMENTS), map.find(i) != map.end());
+        }
+        bsls::Types::Int64 end = bsls::TimeUtil::getTimer();
+        cout << "Time diff (OrderedHashMap)    : " << end - begin << endl;
+    }
+}
+
+// Begin benchmarking library tests (Linux only)
+#ifdef BSLS_PLATFORM_OS_LINUX
+
+/// Insert `state.range(0)` elements in a map of the specified `MAP` type,
+/// and erase them all while iterating.
+template <class MAP>
+static void insertErase_GoogleBenchmark(benchmark::State& state)
+{
+    typedef typename MAP::iterator IterType;
+
+    MAP map(s_allocator_p);
+    for (auto _ : state) {
+        for (int i = 0; i < state.range(0); ++i) {
+            map.insert(bsl::make_pair(i, i));
+        }
+
+        IterType it = map.begin();
+        while (it != map.end()) {
+            it = map.erase(it);
+        }
+    }
+}
+
+/// Look up `state.range(0)` present keys and as many absent keys in a map
+/// of the specified `MAP` type.
+template <class MAP>
+static void find_GoogleBenchmark(benchmark::State& state)
+{
+    MAP map(s_allocator_p);
+    for (int i = 0; i < state.range(0); ++i) {
+        map.insert(bsl::make_pair(i, i));
+    }
+
+    for (auto _ : state) {
+        for (int i = 0; i < 2 * state.range(0); ++i) {
+            benchmark::DoNotOptimize(map.find(i));
+        }
+    }
+}
+
+static void
+testN1_insertPerformanceFlat_GoogleBenchmark(benchmark::State& state)
+{
+    insertErase_GoogleBenchmark<mwcc::OrderedFlatHashMap<int, int> >(state);
+}
+
+static void
+testN1_insertPerformanceOrdered_GoogleBenchmark(benchmark::State& state)
+{
+    insertErase_GoogleBenchmark<mwcc::OrderedHashMap<int, int> >(state);
+}
+
+static void
+testN1_insertPerformanceUnordered_GoogleBenchmark(benchmark::State& state)
+{
+    insertErase_GoogleBenchmark<bsl::unordered_map<int, int> >(state);
+}
+
+static void testN2_findPerformanceFlat_GoogleBenchmark(benchmark::State& state)
+{
+    find_GoogleBenchmark<mwcc::OrderedFlatHashMap<int, int> >(state);
+}
+
+static void
+testN2_findPerformanceOrdered_GoogleBenchmark(benchmark::State& state)
+{
+    find_GoogleBenchmark<mwcc::OrderedHashMap<int, int> >(state);
+}
+
+static void
+testN2_findPerformanceUnordered_GoogleBenchmark(benchmark::State& state)
+{
+    find_GoogleBenchmark<bsl::unordered_map<int, int> >(state);
+}
+
+#endif  // BSLS_PLATFORM_OS_LINUX
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    // One time initialization
+    bsls::TimeUtil::initialize();
+
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 7: test7_copyAndAssignment(); break;
+    case 6: test6_clear(); break;
+    case 5: test5_eraseWhileIterating(); break;
+    case 4: test4_insertEraseInsert(); break;
+    case 3: test3_insert(); break;
+    case 2: test2_impDetails_match(); break;
+    case 1: test1_breathingTest(); break;
+    case -1:
+#ifdef BSLS_PLATFORM_OS_LINUX
+        BENCHMARK(testN1_insertPerformanceFlat_GoogleBenchmark)
+            ->RangeMultiplier(10)
+            ->Range(10, 5000000)
+            ->Unit(benchmark::kMillisecond);
+        BENCHMARK(testN1_insertPerformanceOrdered_GoogleBenchmark)
+            ->RangeMultiplier(10)
+            ->Range(10, 5000000)
+            ->Unit(benchmark::kMillisecond);
+        BENCHMARK(testN1_insertPerformanceUnordered_GoogleBenchmark)
+            ->RangeMultiplier(10)
+            ->Range(10, 5000000)
+            ->Unit(benchmark::kMillisecond);
+#else
+        testN1_insertPerformance();
+#endif
+        break;
+    case -2:
+#ifdef BSLS_PLATFORM_OS_LINUX
+        BENCHMARK(testN2_findPerformanceFlat_GoogleBenchmark)
+            ->RangeMultiplier(10)
+            ->Range(10, 5000000)
+            ->Unit(benchmark::kMillisecond);
+        BENCHMARK(testN2_findPerformanceOrdered_GoogleBenchmark)
+            ->RangeMultiplier(10)
+            ->Range(10, 5000000)
+            ->Unit(benchmark::kMillisecond);
+        BENCHMARK(testN2_findPerformanceUnordered_GoogleBenchmark)
+            ->RangeMultiplier(10)
+            ->Range(10, 5000000)
+            ->Unit(benchmark::kMillisecond);
+#else
+        testN2_findPerformance();
+#endif
+        break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+#ifdef BSLS_PLATFORM_OS_LINUX
+    if (_testCase < 0) {
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+    }
+#endif
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -566,6 +566,12 @@ class OrderedHashMap {
     /// not invalidated by rehashing.
     bool rehashIfNeeded();
 
+    /// Rehash the hash table into the specified `numBuckets` buckets.  The
+    /// behavior is undefined unless `numBuckets` is one of the prime
+    /// numbers returned by `OrderedHashMap_ImpDetails::nextPrime`.  Note
+    /// that the iterators are not invalidated by rehashing.
+    void rehash(size_t numBuckets);
+
     // PRIVATE CLASS METHODS
     static const key_type& get_key(const bsl::pair<const KEY, VALUE>& value)
     {
@@ -699,15 +705,16 @@ class OrderedHashMap {
     template <class SOURCE_TYPE>
     bsl::pair<iterator, bool> rinsert(const SOURCE_TYPE& value);
 
-    // void reserve(int numElements);
-    // Increase the number of buckets of this set to a quantity such that
-    // the ratio between the specified 'numElements' and this quantity does
-    // not exceed 'max_load_factor'.  Note that this guarantees that, after
-    // the reserve, elements can be inserted to grow the container to
-    // 'size() == numElements' without rehashing.  Also note that memory
-    // allocations may still occur when growing the container to 'size() ==
-    // numElements'.  Also note that this operation has no effect if
-    // 'numElements <= size()'.
+    /// Increase the number of buckets of this container to a quantity such
+    /// that the ratio between the specified `numElements` and this
+    /// quantity does not exceed 1, and reserve the nodes for that many
+    /// elements.  Note that this guarantees that, after the reserve,
+    /// elements can be inserted to grow the container to `size() ==
+    /// numElements` without rehashing, which is of interest when a large
+    /// number of elements is inserted at once.  Also note that this
+    /// operation has no effect if the container already has enough
+    /// buckets.
+    void reserve(size_t numElements);
 
     // ACCESSORS
 
@@ -1184,51 +1191,59 @@ bool OrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::rehashIfNeeded()
                static_cast<double>(d_bucketArraySize))) {
         // Calculate next size for d_bucketArraySize.
 
-        size_t oldBucketArraySize = d_bucketArraySize;
-        d_bucketArraySize         = ImpDetails::nextPrime(d_numElements);
-        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == d_bucketArraySize)) {
+        const size_t numBuckets = ImpDetails::nextPrime(d_numElements);
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == numBuckets)) {
             BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
             throw bsl::runtime_error("HashTable ran out of prime numbers");
         }
 
-        // Reserve in nodepool.
+        rehash(numBuckets);
 
-        if (d_bucketArraySize > d_numElements) {
-            d_nodePool.reserveCapacity(d_bucketArraySize - d_numElements);
-        }
+        return true;  // RETURN
+    }
 
-        // Destroy & deallocate old bucket array.
+    return false;
+}
 
-        for (size_t i = 0; i < oldBucketArraySize; ++i) {
-            Bucket* bucket = static_cast<Bucket*>(d_bucketArray_p + i);
-            bucket->~Bucket();
-        }
-        d_allocator_p->deallocate(d_bucketArray_p);
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+void OrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::rehash(size_t numBuckets)
+{
+    size_t oldBucketArraySize = d_bucketArraySize;
+    d_bucketArraySize         = numBuckets;
 
-        // Allocate new bucket array of new size.
+    // Reserve in nodepool.
 
-        d_bucketArray_p = static_cast<Bucket*>(
-            d_allocator_p->allocate(sizeof(Bucket) * d_bucketArraySize));
-        bsl::fill_n(d_bucketArray_p, d_bucketArraySize, Bucket());
+    if (d_bucketArraySize > d_numElements) {
+        d_nodePool.reserveCapacity(d_bucketArraySize - d_numElements);
+    }
 
-        // For each key in list, rehash & insert in new bucketArray.
+    // Destroy & deallocate old bucket array.
 
-        size_t numRehashed = 0;
-        for (Link* link = d_sentinel_p->nextInList(); link != d_sentinel_p;
-             link       = link->nextInList()) {
-            Node*   node   = static_cast<Node*>(link);
-            Bucket* bucket = getBucketForKey(get_key(node->value()));
-            appendNodeToBucket(link, bucket);
-            ++numRehashed;
-        }
+    for (size_t i = 0; i < oldBucketArraySize; ++i) {
+        Bucket* bucket = static_cast<Bucket*>(d_bucketArray_p + i);
+        bucket->~Bucket();
+    }
+    d_allocator_p->deallocate(d_bucketArray_p);
 
-        BSLS_ASSERT_SAFE(numRehashed == d_numElements);
-        static_cast<void>(numRehashed);  // suppress compiler warning
+    // Allocate new bucket array of new size.
 
-        return true;  // RETURN
+    d_bucketArray_p = static_cast<Bucket*>(
+        d_allocator_p->allocate(sizeof(Bucket) * d_bucketArraySize));
+    bsl::fill_n(d_bucketArray_p, d_bucketArraySize, Bucket());
+
+    // For each key in list, rehash & insert in new bucketArray.
+
+    size_t numRehashed = 0;
+    for (Link* link = d_sentinel_p->nextInList(); link != d_sentinel_p;
+         link       = link->nextInList()) {
+        Node*   node   = static_cast<Node*>(link);
+        Bucket* bucket = getBucketForKey(get_key(node->value()));
+        appendNodeToBucket(link, bucket);
+        ++numRehashed;
     }
 
-    return false;
+    BSLS_ASSERT_SAFE(numRehashed == d_numElements);
+    static_cast<void>(numRehashed);  // suppress compiler warning
 }
 
 // CREATORS
@@ -1522,6 +1537,21 @@ OrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::rinsert(const SOURCE_TYPE& value)
     return bsl::make_pair(iterator(d_sentinel_p->nextInList()), true);
 }
 
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+void OrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::reserve(size_t numElements)
+{
+    if (numElements <= d_bucketArraySize) {
+        return;  // RETURN
+    }
+
+    const size_t numBuckets = ImpDetails::nextPrime(numElements);
+    if (0 == numBuckets) {
+        throw bsl::runtime_error("HashTable ran out of prime numbers");
+    }
+
+    rehash(numBuckets);
+}
+
 // ACCESSORS
 template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
 inline typename OrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::const_iterator
@@ -932,6 +932,60 @@ static void test15_eraseRange()
     ASSERT_EQ(true, map.empty());
 }
 
+static void test16_reserve()
+// ------------------------------------------------------------------------
+// RESERVE
+//
+// Concerns:
+//   Check that reserving allows inserting the reserved number of elements
+//   without rehashing, and keeps the elements and their order.
+//
+// Plan:
+//   Insert elements
+//   Reserve fewer elements than the number of buckets
+//   Reserve more elements than the number of buckets
+//   Insert up to the reserved number of elements
+//
+// Testing:
+//   reserve(size_t numElements)
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("RESERVE");
+
+    typedef mwcc::OrderedHashMap<int, int> MyMapType;
+    typedef MyMapType::const_iterator      ConstIterType;
+
+    const int k_NUM_ELEMENTS = 10;
+    const int k_NUM_RESERVED = 10000;
+    MyMapType map(s_allocator_p);
+
+    for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+        map.insert(bsl::make_pair(i, i));
+    }
+
+    const size_t numBuckets = map.bucket_count();
+    map.reserve(1);
+    ASSERT_EQ(numBuckets, map.bucket_count());
+
+    map.reserve(k_NUM_RESERVED);
+    const size_t numReservedBuckets = map.bucket_count();
+    ASSERT_GE(numReservedBuckets, size_t(k_NUM_RESERVED));
+    ASSERT_EQ(size_t(k_NUM_ELEMENTS), map.size());
+
+    for (int i = k_NUM_ELEMENTS; i < k_NUM_RESERVED; ++i) {
+        map.insert(bsl::make_pair(i, i));
+    }
+    ASSERT_EQ(numReservedBuckets, map.bucket_count());
+    ASSERT_EQ(size_t(k_NUM_RESERVED), map.size());
+
+    int i = 0;
+    for (ConstIterType cit = map.begin(); cit != map.end(); ++cit, ++i) {
+        ASSERT_EQ_D(i, i, cit->first);
+        ASSERT_EQ_D(i, true, map.find(i) == cit);
+    }
+    ASSERT_EQ(k_NUM_RESERVED, i);
+}
+
 BSLA_MAYBE_UNUSED
 static void testN1_insertPerformanceOrdered()
 // ------------------------------------------------------------------------
@@ -1213,6 +1267,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 16: test16_reserve(); break;
     case 15: test15_eraseRange(); break;
     case 14: test14_localIterator(); break;
     case 13: test13_previousEndIterator(); break;
@@ -29,12 +29,20 @@
 //@DESCRIPTION: 'mwcc::OrderedHashMapWithHistory' is a wrapper around
 // 'mwcc::OrderedHashMap' which adds insertion time in nanoseconds as part of
 // the value.  It keeps history of erased keys until called 'gc' outside of
-// specified time window.  For optimization (at expense of extra memory), it
-// tracks the history from the moment an item is inserted.  That means, there
-// are 3 collections effectively: 1) a hashtable, 2) a list of all items
-// including erased ones which get tracked as history, and 3) a list of valid,
-// not-erased items.  'OrderedHashMap' provides the 1) and the 2).  This
-// component adds 3) and exposes new iterator over valid, not-erased items.
+// specified time window.  There are 3 collections effectively: 1) a hashtable
+// of live items, 2) a list of valid, not-erased items, and 3) a history of
+// erased keys.  'OrderedHashMap' provides the 1).  This component adds 2) and
+// exposes new iterator over valid, not-erased items.
+//
+// The history (see 'mwcc::OrderedHashMapWithHistory_History') only keeps the
+// keys of erased items, not their values, in a ring of buckets each covering
+// a slice of the timeout interval.  'gc' expires a whole bucket at once when
+// all of its keys are older than the time window, instead of visiting the
+// items one by one, and each bucket has a small Bloom filter so that looking
+// up a key which is not in the history (i.e., the common case of a new key)
+// rarely needs to probe the key sets.  Note that a key may remain in the
+// history for up to one bucket duration (the timeout divided by
+// 'k_NUM_BUCKETS') longer than the timeout.
 //
 
 // MWC
@@ -44,7 +52,11 @@
 // BDE
 #include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
+#include <bsl_unordered_set.h>
 #include <bsl_utility.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bslmf_removecv.h>
 #include <bsls_annotation.h>
@@ -159,6 +171,148 @@ bool operator!=(const OrderedHashMapWithHistory_Iterator<VALUE1>& lhs,
 template <class VALUE>
 void clean(VALUE& value);
 
+// =======================================
+// class OrderedHashMapWithHistory_History
+// =======================================
+
+/// For use only by `mwcc::OrderedHashMapWithHistory` implementation.
+/// This class keeps the keys of erased items in a ring of time buckets, each
+/// with a Bloom filter in front of its set of keys.
+template <class KEY, class HASH>
+class OrderedHashMapWithHistory_History {
+  public:
+    // PUBLIC TYPES
+    typedef bsls::Types::Int64 TimeType;
+
+    // CONSTANTS
+
+    /// Number of buckets the timeout interval is divided into.
+    static const size_t k_NUM_BUCKETS = 8;
+
+  private:
+    // PRIVATE CONSTANTS
+
+    /// Number of bits of a Bloom filter per key of its bucket.
+    static const size_t k_FILTER_BITS_PER_KEY = 16;
+
+    /// Minimum number of bits of a non-empty Bloom filter.
+    static const size_t k_MIN_FILTER_BITS = 512;
+
+    // PRIVATE TYPES
+    typedef bsl::unordered_set<KEY, HASH> Keys;
+
+    typedef bsl::vector<bsls::Types::Uint64> Filter;
+
+    struct Bucket {
+        TimeType d_expiry;
+        // Highest expiration time of the keys in this bucket.
+
+        Keys d_keys;
+
+        Filter d_filter;
+        // Bloom filter of 'd_keys', having a power of two number of
+        // bits, or empty if 'd_keys' has always been empty.
+
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(Bucket, bslma::UsesBslmaAllocator)
+
+        // CREATORS
+        explicit Bucket(bslma::Allocator* basicAllocator = 0);
+
+        Bucket(const Bucket& other, bslma::Allocator* basicAllocator = 0);
+    };
+
+    typedef bsl::vector<Bucket> Buckets;
+
+    // DATA
+    Buckets d_buckets;
+    // 'k_NUM_BUCKETS + 1' buckets, so that a whole timeout interval
+    // plus a partially expired bucket fit in the ring.
+
+    TimeType d_bucketDuration;
+
+    size_t d_size;
+    // Total number of keys in all buckets.
+
+    HASH d_hasher;
+
+  private:
+    // NOT IMPLEMENTED
+    OrderedHashMapWithHistory_History(
+        const OrderedHashMapWithHistory_History&) BSLS_KEYWORD_DELETED;
+    OrderedHashMapWithHistory_History&
+    operator=(const OrderedHashMapWithHistory_History&) BSLS_KEYWORD_DELETED;
+
+    // PRIVATE CLASS METHODS
+
+    /// Load into the specified `first` and `second` the positions of the
+    /// bits of a Bloom filter having the specified `numBits` for a key
+    /// having the specified `hash`.  The behavior is undefined unless
+    /// `numBits` is a power of two.
+    static void filterPositions(size_t* first,
+                                size_t* second,
+                                size_t  hash,
+                                size_t  numBits);
+
+    /// Set the bits of the specified `filter` for a key having the
+    /// specified `hash`.
+    static void addToFilter(Filter* filter, size_t hash);
+
+    /// Return `false` if a key having the specified `hash` is definitely
+    /// not in the specified `filter`, and `true` otherwise.
+    static bool mayContain(const Filter& filter, size_t hash);
+
+    // PRIVATE MANIPULATORS
+
+    /// Rebuild the Bloom filter of the specified `bucket` so that it can
+    /// accommodate twice the number of its keys.
+    void rebuildFilter(Bucket* bucket);
+
+    /// Remove all keys from the specified `bucket`.
+    void clearBucket(Bucket* bucket);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(OrderedHashMapWithHistory_History,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty history for the specified `timeout` interval.
+    /// Optionally specify a `basicAllocator` used to supply memory.
+    explicit OrderedHashMapWithHistory_History(
+        TimeType          timeout,
+        bslma::Allocator* basicAllocator = 0);
+
+    // MANIPULATORS
+
+    /// Add the specified `key` to the history until the specified
+    /// `expiry` time.
+    void insert(const KEY& key, TimeType expiry);
+
+    /// Remove the specified `key` from the history, if it is there.
+    void erase(const KEY& key);
+
+    /// Remove all the keys in the buckets which are expired according to
+    /// the specified `now` time, stopping after the bucket which reaches
+    /// the specified `batchSize` number of removed keys, unless it is zero.
+    /// Return `true`, if there are expired keys unprocessed because of the
+    /// `batchSize` limit.
+    bool gc(TimeType now, unsigned batchSize);
+
+    /// Remove all keys from the history.
+    void clear();
+
+    // ACCESSORS
+
+    /// Return `true` if the specified `key` is in the history, and `false`
+    /// otherwise.
+    bool contains(const KEY& key) const;
+
+    /// Return the number of keys in the history.
+    size_t size() const;
+};
+
 // ===============================
 // class OrderedHashMapWithHistory
 // ===============================
@@ -183,10 +337,8 @@ class OrderedHashMapWithHistory {
         OrderedHashMap_SequentialIterator<Value> d_next;
 
         /// `d_next` and `d_prev` implement the list of `live`
-        /// un-TTL-expired elements.  See 3) in the Component Description.
+        /// un-TTL-expired elements.  See 2) in the Component Description.
         OrderedHashMap_SequentialIterator<Value> d_prev;
-        bool                                     d_isLive;
-        // not confirmed, not TTLed
 
         // CREATORS
         Value(const VALUE_TYPE& value, TimeType time);
@@ -194,6 +346,8 @@ class OrderedHashMapWithHistory {
 
     typedef OrderedHashMap<KEY, VALUE, HASH, Value> ImplType;
 
+    typedef OrderedHashMapWithHistory_History<KEY, HASH> HistoryType;
+
   public:
     // PUBLIC TYPES
 
@@ -212,11 +366,11 @@ class OrderedHashMapWithHistory {
     iterator d_last;
     // 'd_first' and 'd_last' refer to the first and last 'live'
     // un-TTL-expired elements or they both refer to `end()` if there
-    // are no 'live' elements.  See 3) in the Component Description.
+    // are no 'live' elements.  See 2) in the Component Description.
 
-    size_t d_historySize;  // how many historical (!d_isLive) items
+    HistoryType d_history;  // keys of erased items
 
-    gc_iterator d_gcIt;  // where to start 'gc'
+    TimeType d_lastGcTime;  // 'now' of the last 'gc'
 
     // PRIVATE CLASS METHODS
     static const KEY& get_key(const bsl::pair<const KEY, VALUE>& value)
@@ -248,9 +402,10 @@ class OrderedHashMapWithHistory {
     operator=(const OrderedHashMapWithHistory&) BSLS_KEYWORD_DELETED;
 
     /// Remove the specified `it` from the list of `live` un-TTL-expired
-    /// items accessed by `live` iterators while still keeping the item in
-    /// the `d_impl` as a historical record.
-    void unlink(iterator it);
+    /// items accessed by `live` iterators and from `d_impl`, keeping its
+    /// key in the history if its expiration time is after the specified
+    /// `now` time.
+    void eraseImpl(iterator it, TimeType now);
 
   public:
     // PUBLIC MANIPULATORS
@@ -264,20 +419,20 @@ class OrderedHashMapWithHistory {
     /// container.
     iterator end();
 
-    /// Return iterator referring to the first element in the entire history
-    /// of items, if any, or one past the end of this container if there are
-    /// no elements.
+    /// Return iterator referring to the first element in the hashtable in
+    /// insertion order, if any, or one past the end of this container if
+    /// there are no elements.  Note that historical items are not part of
+    /// the hashtable.
     gc_iterator beginGc();
 
-    /// Return iterator referring to one past the end of the entire history
-    /// of items, if any, or one past the end of this container if there are
-    /// no elements.
+    /// Return iterator referring to one past the end of the hashtable.
     gc_iterator endGc();
 
-    /// Iterate up to the specified `batchSize` of elements (both historical
-    /// and live) and erase expired historical records according to the
-    /// specified `now` time.  Return `true`, if there are expired items
-    /// unprocessed because of the `batchSize` limit.
+    /// Erase the history buckets which are expired according to the
+    /// specified `now` time, up to the bucket reaching the specified
+    /// `batchSize` number of erased historical records.  Return `true`, if
+    /// there are expired items unprocessed because of the `batchSize`
+    /// limit.
     bool gc(TimeType now, unsigned batchSize = 0);
 
     /// Remove all entries from this container.  Clear all history.  Note
@@ -303,7 +458,9 @@ class OrderedHashMapWithHistory {
     /// Insert the specified `value` along with the specified `timePoint`
     /// into this container if the key (the `first` element) of the
     /// `value_type` object constructed from `value` does not already exist
-    /// in this container; otherwise, this method has no effect.  Return a
+    /// in this container; otherwise, this method has no effect.  A key
+    /// which is only historical is removed from the history and inserted
+    /// as a new live item.  Return a
     /// `pair` whose `first` member is an iterator referring to the
     /// (possibly newly inserted) `value_type` object in this container
     /// whose key is the same as that of `value`, and whose `second` member
@@ -347,8 +504,8 @@ class OrderedHashMapWithHistory {
     /// otherwise.
     const_iterator find(const KEY& key) const;
 
-    /// Return `true` if an entry for the specified `key` exists or `false`
-    /// otherwise.
+    /// Return `true` if a live or historical entry for the specified `key`
+    /// exists or `false` otherwise.
     bool isInHistory(const KEY& key) const;
 
     /// Return the number of elements in this container.
@@ -409,16 +566,12 @@ OrderedHashMapWithHistory_Iterator<VALUE>::operator++(int)
 template <class VALUE>
 inline VALUE& OrderedHashMapWithHistory_Iterator<VALUE>::operator*() const
 {
-    BSLS_ASSERT_SAFE(d_baseIterator->d_isLive);
-
     return *d_baseIterator;
 }
 
 template <class VALUE>
 inline VALUE* OrderedHashMapWithHistory_Iterator<VALUE>::operator->() const
 {
-    BSLS_ASSERT_SAFE(d_baseIterator->d_isLive);
-
     return d_baseIterator.operator->();
 }
 
@@ -443,6 +596,251 @@ inline void clean(BSLS_ANNOTATION_UNUSED VALUE& value)
     // NOTHING
 }
 
+// ------------------------------------------------
+// struct OrderedHashMapWithHistory_History::Bucket
+// ------------------------------------------------
+
+template <class KEY, class HASH>
+inline OrderedHashMapWithHistory_History<KEY, HASH>::Bucket::Bucket(
+    bslma::Allocator* basicAllocator)
+: d_expiry(0)
+, d_keys(basicAllocator)
+, d_filter(basicAllocator)
+{
+    // NOTHING
+}
+
+template <class KEY, class HASH>
+inline OrderedHashMapWithHistory_History<KEY, HASH>::Bucket::Bucket(
+    const Bucket&     other,
+    bslma::Allocator* basicAllocator)
+: d_expiry(other.d_expiry)
+, d_keys(other.d_keys, basicAllocator)
+, d_filter(other.d_filter, basicAllocator)
+{
+    // NOTHING
+}
+
+// ---------------------------------------
+// class OrderedHashMapWithHistory_History
+// ---------------------------------------
+
+// CONSTANTS
+template <class KEY, class HASH>
+const size_t OrderedHashMapWithHistory_History<KEY, HASH>::k_NUM_BUCKETS;
+
+template <class KEY, class HASH>
+const size_t
+    OrderedHashMapWithHistory_History<KEY, HASH>::k_FILTER_BITS_PER_KEY;
+
+template <class KEY, class HASH>
+const size_t OrderedHashMapWithHistory_History<KEY, HASH>::k_MIN_FILTER_BITS;
+
+// PRIVATE CLASS METHODS
+template <class KEY, class HASH>
+inline void OrderedHashMapWithHistory_History<KEY, HASH>::filterPositions(
+    size_t* first,
+    size_t* second,
+    size_t  hash,
+    size_t  numBits)
+{
+    // Derive the second position from the high bits of the hash, mixed in
+    // case the hash function leaves them weak.
+
+    const size_t mask = numBits - 1;
+
+    *first  = hash & mask;
+    *second = ((hash >> 16) ^ (hash * 0x9E3779B9U)) & mask;
+}
+
+template <class KEY, class HASH>
+inline void
+OrderedHashMapWithHistory_History<KEY, HASH>::addToFilter(Filter* filter,
+                                                          size_t  hash)
+{
+    size_t first;
+    size_t second;
+    filterPositions(&first, &second, hash, filter->size() * 64);
+
+    (*filter)[first / 64] |= bsls::Types::Uint64(1) << (first % 64);
+    (*filter)[second / 64] |= bsls::Types::Uint64(1) << (second % 64);
+}
+
+template <class KEY, class HASH>
+inline bool
+OrderedHashMapWithHistory_History<KEY, HASH>::mayContain(const Filter& filter,
+                                                         size_t        hash)
+{
+    if (filter.empty()) {
+        return false;  // RETURN
+    }
+
+    size_t first;
+    size_t second;
+    filterPositions(&first, &second, hash, filter.size() * 64);
+
+    return (filter[first / 64] >> (first % 64)) & 1 &&
+           (filter[second / 64] >> (second % 64)) & 1;
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class HASH>
+inline void
+OrderedHashMapWithHistory_History<KEY, HASH>::rebuildFilter(Bucket* bucket)
+{
+    size_t numBits = k_MIN_FILTER_BITS;
+    while (numBits < 2 * bucket->d_keys.size() * k_FILTER_BITS_PER_KEY) {
+        numBits *= 2;
+    }
+
+    bucket->d_filter.assign(numBits / 64, 0);
+    for (typename Keys::const_iterator cit = bucket->d_keys.begin();
+         cit != bucket->d_keys.end();
+         ++cit) {
+        addToFilter(&bucket->d_filter, d_hasher(*cit));
+    }
+}
+
+template <class KEY, class HASH>
+inline void
+OrderedHashMapWithHistory_History<KEY, HASH>::clearBucket(Bucket* bucket)
+{
+    d_size -= bucket->d_keys.size();
+
+    bucket->d_keys.clear();
+    bsl::fill(bucket->d_filter.begin(), bucket->d_filter.end(), 0);
+    bucket->d_expiry = 0;
+}
+
+// CREATORS
+template <class KEY, class HASH>
+inline OrderedHashMapWithHistory_History<KEY, HASH>::
+    OrderedHashMapWithHistory_History(TimeType          timeout,
+                                      bslma::Allocator* basicAllocator)
+: d_buckets(k_NUM_BUCKETS + 1, Bucket(basicAllocator), basicAllocator)
+, d_bucketDuration(bsl::max(timeout / static_cast<TimeType>(k_NUM_BUCKETS),
+                            static_cast<TimeType>(1)))
+, d_size(0)
+, d_hasher()
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+template <class KEY, class HASH>
+inline void
+OrderedHashMapWithHistory_History<KEY, HASH>::insert(const KEY& key,
+                                                     TimeType   expiry)
+{
+    // Keys expiring within the same 'd_bucketDuration' share a bucket.  A
+    // bucket still holding keys of an earlier round of the ring (i.e., which
+    // has not been collected yet) simply keeps them until the latest expiry.
+
+    Bucket& bucket = d_buckets[static_cast<size_t>(expiry / d_bucketDuration) %
+                               d_buckets.size()];
+
+    if (!bucket.d_keys.insert(key).second) {
+        return;  // RETURN
+    }
+
+    ++d_size;
+    bucket.d_expiry = bsl::max(bucket.d_expiry, expiry);
+
+    if (bucket.d_keys.size() * k_FILTER_BITS_PER_KEY >
+        bucket.d_filter.size() * 64) {
+        rebuildFilter(&bucket);
+    }
+    else {
+        addToFilter(&bucket.d_filter, d_hasher(key));
+    }
+}
+
+template <class KEY, class HASH>
+inline void OrderedHashMapWithHistory_History<KEY, HASH>::erase(const KEY& key)
+{
+    if (d_size == 0) {
+        return;  // RETURN
+    }
+
+    const size_t hash = d_hasher(key);
+
+    for (typename Buckets::iterator it = d_buckets.begin();
+         it != d_buckets.end();
+         ++it) {
+        if (mayContain(it->d_filter, hash) && it->d_keys.erase(key)) {
+            --d_size;
+            if (it->d_keys.empty()) {
+                clearBucket(&*it);
+            }
+            return;  // RETURN
+        }
+    }
+}
+
+template <class KEY, class HASH>
+inline bool
+OrderedHashMapWithHistory_History<KEY, HASH>::gc(TimeType now,
+                                                 unsigned batchSize)
+{
+    size_t numErased = 0;
+
+    for (typename Buckets::iterator it = d_buckets.begin();
+         it != d_buckets.end();
+         ++it) {
+        if (it->d_keys.empty() || now < it->d_expiry) {
+            continue;  // CONTINUE
+        }
+
+        if (batchSize && numErased >= batchSize) {
+            // Resume from the remaining expired buckets next time.
+            return true;  // RETURN
+        }
+
+        numErased += it->d_keys.size();
+        clearBucket(&*it);
+    }
+
+    return false;
+}
+
+template <class KEY, class HASH>
+inline void OrderedHashMapWithHistory_History<KEY, HASH>::clear()
+{
+    for (typename Buckets::iterator it = d_buckets.begin();
+         it != d_buckets.end();
+         ++it) {
+        clearBucket(&*it);
+    }
+}
+
+// ACCESSORS
+template <class KEY, class HASH>
+inline bool
+OrderedHashMapWithHistory_History<KEY, HASH>::contains(const KEY& key) const
+{
+    if (d_size == 0) {
+        return false;  // RETURN
+    }
+
+    const size_t hash = d_hasher(key);
+
+    for (typename Buckets::const_iterator cit = d_buckets.begin();
+         cit != d_buckets.end();
+         ++cit) {
+        if (mayContain(cit->d_filter, hash) && cit->d_keys.count(key)) {
+            return true;  // RETURN
+        }
+    }
+
+    return false;
+}
+
+template <class KEY, class HASH>
+inline size_t OrderedHashMapWithHistory_History<KEY, HASH>::size() const
+{
+    return d_size;
+}
+
 // -----------
 // class Value
 // -----------
@@ -455,7 +853,6 @@ inline OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::Value::Value(
 , d_time(time)
 , d_next()
 , d_prev()
-, d_isLive(true)
 {
     // NOTHING
 }
@@ -472,8 +869,8 @@ inline OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::
 , d_timeout(timeout)
 , d_first(d_impl.end())
 , d_last(d_impl.end())
-, d_historySize(0)
-, d_gcIt(endGc())
+, d_history(timeout, basicAllocator)
+, d_lastGcTime(0)
 {
     // NOTHING
 }
@@ -499,30 +896,19 @@ template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
 inline void OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::clear()
 {
     d_impl.clear();
+    d_history.clear();
 
     d_first = d_last = end();
-    d_gcIt           = endGc();
-    d_historySize    = 0;
 }
 
 template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
 inline void
 OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::erase(iterator it)
 {
-    TimeType   time = it->d_time;
-    const KEY& key  = get_key(*it);
-
-    unlink(it);
+    // Items which were already expired at the time of the last 'gc' do not
+    // need to be kept in the history.
 
-    if (time) {
-        ++d_historySize;
-    }
-    else {
-        if (d_gcIt == it.d_baseIterator) {
-            d_gcIt++;
-        }
-        d_impl.erase(key);
-    }
+    eraseImpl(it, d_lastGcTime);
 }
 
 template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
@@ -530,28 +916,15 @@ inline void
 OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::erase(iterator it,
                                                                TimeType now)
 {
-    TimeType   time = it->d_time;
-    const KEY& key  = get_key(*it);
-
-    unlink(it);
-
-    if (time && now < time) {
-        ++d_historySize;
-    }
-    else {
-        if (d_gcIt == it.d_baseIterator) {
-            d_gcIt++;
-        }
-        d_impl.erase(key);
-    }
+    eraseImpl(it, now);
 }
 
 template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
 inline void
-OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::unlink(iterator it)
+OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::eraseImpl(
+    iterator it,
+    TimeType now)
 {
-    BSLS_ASSERT(it->d_isLive);
-
     if (it == d_first) {
         if (it == d_last) {
             d_last = d_first = end();
@@ -575,7 +948,12 @@ OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::unlink(iterator it)
 
     clean(*it);
 
-    it->d_isLive = false;
+    const TimeType time = it->d_time;
+    if (time && now < time) {
+        d_history.insert(get_key(*it), time);
+    }
+
+    d_impl.erase(it.d_baseIterator);
 }
 
 template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
@@ -584,15 +962,7 @@ inline
     OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::find(
         const KEY& key)
 {
-    gc_iterator it = d_impl.find(key);
-
-    if (it != d_impl.end()) {
-        if (!it->d_isLive) {
-            it = d_impl.end();
-        }
-    }
-
-    return iterator(it);
+    return iterator(d_impl.find(key));
 }
 
 template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
@@ -612,6 +982,10 @@ OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::insert(
     gc_iterator& it = result.first;
 
     if (result.second) {
+        if (d_history.size()) {
+            d_history.erase(get_key(*it));
+        }
+
         if (d_last.d_baseIterator == it) {
             BSLS_ASSERT_SAFE(d_first.d_baseIterator == it);
         }
@@ -631,44 +1005,9 @@ inline bool
 OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::gc(TimeType now,
                                                             unsigned batchSize)
 {
-    // Try to advance to either a young item, or to the end of the batch, or to
-    // the end of collection.
-    // Return 'true' if at the end of the batch to be called as soon as
-    // possible.  Otherwise, return 'false' to be called at the next timeout.
-    // In either case, resume iteration from where we stopped (or wrap around).
-    // 'erase' can set the iterator back to erase item if its expiration time
-    // is sooner than the current one.
-
-    if (d_gcIt == endGc()) {
-        d_gcIt = beginGc();
-    }
+    d_lastGcTime = now;
 
-    while (d_gcIt != endGc() && d_historySize) {
-        if (now < d_gcIt->d_time) {
-            // next time resume from this item unless some earlier item(s) will
-            // get erased in which case 'erase' will move 'd_gcIt' back.
-            break;  // BREAK
-        }
-        gc_iterator it = d_gcIt++;
-        if (it->d_isLive) {
-            // This is an old item.  It should be removed by 'erase'.
-            // No need to return to this item.  No need to check time again.
-            // Indicate that it needs to be removed by setting its time to 0.
-            it->d_time = 0;
-        }
-        else {
-            d_impl.erase(it);
-            --d_historySize;
-        }
-        // Meaning, there is no need for 'd_gcIt' to step back.  Only forward.
-
-        if (--batchSize == 0) {
-            // remember where we have stopped and resume from there next time
-            return true;  // RETURN
-        }
-    }
-
-    return false;
+    return d_history.gc(now, batchSize);
 }
 
 template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
@@ -707,9 +1046,7 @@ template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
 inline size_t OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::count(
     const KEY& key) const
 {
-    const_gc_iterator it = d_impl.find(key);
-
-    return it == d_impl.end() ? 0 : it->d_isLive ? 1 : 0;
+    return d_impl.find(key) == d_impl.end() ? 0 : 1;
 }
 
 template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
@@ -725,15 +1062,7 @@ inline typename OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::
     OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::find(
         const KEY& key) const
 {
-    const_gc_iterator cit = d_impl.find(key);
-
-    if (cit != d_impl.end()) {
-        if (!cit->d_isLive) {
-            cit = d_impl.end();
-        }
-    }
-
-    return const_iterator(cit);
+    return const_iterator(d_impl.find(key));
 }
 
 template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
@@ -741,14 +1070,14 @@ inline bool
 OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::isInHistory(
     const KEY& key) const
 {
-    return d_impl.find(key) != d_impl.end();
+    return d_impl.find(key) != d_impl.end() || d_history.contains(key);
 }
 
 template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
 inline size_t
 OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::size() const
 {
-    return d_impl.size() - d_historySize;
+    return d_impl.size();
 }
 
 }  // close package namespace
@@ -332,6 +332,89 @@ static void test6_eraseThenGc()
     obj.gc(now, BATCH_SIZE);
 }
 
+static void test7_historyBuckets()
+{
+    // ------------------------------------------------------------------------
+    // HISTORY BUCKETS
+    //
+    // Concerns:
+    //   Erased keys are kept in time buckets expiring as a whole, and a
+    //   historical key can be inserted again.
+    //
+    // Plan:
+    //   Insert and erase enough items to grow the Bloom filters of the
+    //   buckets.
+    //   'gc' in batches and check that the history expires bucket by bucket.
+    //   Insert a historical key again.
+    //
+    // Testing:
+    //   insert, erase, gc, isInHistory, size
+    // ------------------------------------------------------------------------
+
+    mwctst::TestHelper::printTestName("HISTORY_BUCKETS");
+
+    const bsls::Types::Int64 timeout = 8000;
+    const bsls::Types::Int64 bucketDuration =
+        timeout / mwcc::OrderedHashMapWithHistory_History<
+                      size_t,
+                      bsl::hash<size_t> >::k_NUM_BUCKETS;
+    const size_t    TOTAL = 10000;
+    ObjectUnderTest obj(timeout, s_allocator_p);
+
+    // Insert all items at time 0, expiring in the same bucket at 'timeout'.
+    for (size_t key = 0; key < TOTAL; ++key) {
+        ASSERT_EQ(true, obj.insert(bsl::make_pair(key, key), 0).second);
+    }
+
+    // Erase all but the last one.
+    for (size_t key = 0; key < TOTAL - 1; ++key) {
+        obj.erase(obj.find(key), 0);
+    }
+    ASSERT_EQ(1U, obj.size());
+
+    for (size_t key = 0; key < TOTAL; ++key) {
+        ASSERT_EQ(true, obj.isInHistory(key));
+    }
+    ASSERT_EQ(false, obj.isInHistory(TOTAL));
+
+    // Insert the key 0 again: it is live, and no longer historical.
+    ASSERT_EQ(true, obj.insert(bsl::make_pair(0U, 1U), bucketDuration).second);
+    ASSERT_EQ(2U, obj.size());
+    ASSERT_EQ(1U, obj.find(0)->second);
+
+    // Erase it again, expiring in the next bucket.
+    obj.erase(obj.find(0), 0);
+
+    // Nothing is expired before 'timeout'.
+    ASSERT_EQ(false, obj.gc(timeout - 1, 1));
+    ASSERT_EQ(true, obj.isInHistory(0));
+    ASSERT_EQ(true, obj.isInHistory(1));
+
+    // The first bucket expires as a whole, not the second one.
+    ASSERT_EQ(false, obj.gc(timeout, 1));
+    ASSERT_EQ(true, obj.isInHistory(0));
+    for (size_t key = 1; key < TOTAL - 1; ++key) {
+        ASSERT_EQ(false, obj.isInHistory(key));
+    }
+    ASSERT_EQ(true, obj.isInHistory(TOTAL - 1));
+
+    // Erase the last item after the last 'gc' passed its expiration time:
+    // it is not kept in the history.
+    obj.erase(obj.find(TOTAL - 1));
+    ASSERT_EQ(false, obj.isInHistory(TOTAL - 1));
+    ASSERT_EQ(0U, obj.size());
+
+    // Both remaining buckets are expired, the batch stops after the first.
+    obj.insert(bsl::make_pair(TOTAL, TOTAL), 3 * bucketDuration);
+    obj.erase(obj.find(TOTAL), 0);
+
+    bsls::Types::Int64 now = timeout + 3 * bucketDuration;
+    ASSERT_EQ(true, obj.gc(now, 1));
+    ASSERT_EQ(false, obj.gc(now, 1));
+    ASSERT_EQ(false, obj.isInHistory(0));
+    ASSERT_EQ(false, obj.isInHistory(TOTAL));
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -348,6 +431,7 @@ int main(int argc, char* argv[])
     case 4: test4_gc(); break;
     case 5: test5_insertAfterEnd(); break;
     case 6: test6_eraseThenGc(); break;
+    case 7: test7_historyBuckets(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
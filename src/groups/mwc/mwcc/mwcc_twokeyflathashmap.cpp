@@ -0,0 +1,31 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcc_twokeyflathashmap.cpp                                         -*-C++-*-
+#include <mwcc_twokeyflathashmap.h>
+
+#include <mwcscm_version.h>
+namespace BloombergLP {
+namespace mwcc {
+
+// -----------------------------
+// struct TwoKeyFlatHashMap_Slot
+// -----------------------------
+
+// PUBLIC CONSTANTS
+const bsl::uint32_t TwoKeyFlatHashMap_Slot::k_EMPTY;
+
+}  // close package namespace
+}  // close enterprise namespace
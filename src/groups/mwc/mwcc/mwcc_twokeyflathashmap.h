@@ -0,0 +1,1343 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcc_twokeyflathashmap.h                                           -*-C++-*-
+#ifndef INCLUDED_MWCC_TWOKEYFLATHASHMAP
+#define INCLUDED_MWCC_TWOKEYFLATHASHMAP
+
+//@PURPOSE: Provide an open-addressing hash map container with two keys.
+//
+//@CLASSES:
+//  mwcc::TwoKeyFlatHashMap:      open-addressing hash map with two keys
+//  mwcc::TwoKeyFlatHashMapValue: element of the 'TwoKeyFlatHashMap'
+//
+//@SEE_ALSO: mwcc_twokeyhashmap
+//
+//@DESCRIPTION: 'mwcc::TwoKeyFlatHashMap' provides an associative container
+// in which each element is indexed by two unique keys, like
+// 'mwcc::TwoKeyHashMap', but which does not allocate memory per element.  It
+// offers the same 'insert', 'findByKey1', 'findByKey2', 'erase',
+// 'eraseByKey1', 'eraseByKey2' and 'clear' interface, and its elements offer
+// the same 'key1()', 'key2()' and 'value()' accessors, so that code looking
+// up elements by either key can be switched from one container to the other.
+//
+/// Memory Layout
+///-------------
+// Elements are stored contiguously in a single array (the "slab"), without
+// holes: erasing an element moves the last element of the slab into its
+// place.  Each element holds its two keys and its value inline, along with
+// the 32-bit hash of each key.
+//
+// Each key is indexed by its own open-addressing table, using linear probing.
+// A slot of such a table is 8 bytes long, and holds the 32-bit hash of the
+// key along with the index of the element in the slab, so that a lookup
+// scans consecutive slots, usually in a single cache line, and touches the
+// slab only to compare the key of an element whose hash matches.  Erasing
+// shifts the following slots of the probe sequence backward instead of
+// leaving tombstones, so that the length of probe sequences does not degrade
+// over time.  A table is rehashed when more than 3/4 of its slots are in use.
+// Rehashing and growing the slab only read the hashes cached in each element,
+// and never invoke the hash functions again.
+//
+/// Differences with 'mwcc::TwoKeyHashMap'
+///--------------------------------------
+// Because elements are not allocated individually, this container does not
+// provide the following guarantees and features of 'mwcc::TwoKeyHashMap':
+//: o Pointers, references and iterators to elements are invalidated by any
+//:   insertion and by 'clear'.  Erasing an element invalidates the pointers,
+//:   references and iterators to that element and to the last element of the
+//:   container.
+//:
+//: o Iteration is performed in slab order, which is the same whichever key
+//:   is used; hence 'begin' and 'end' do not take a key index.  'erase'
+//:   returns an iterator referring to the element moved into the position of
+//:   the erased element, so that erasing while iterating visits every
+//:   element exactly once.
+//:
+//: o The keys are passed to 'insert' by 'const' reference and are copied.
+//
+/// Usage
+///-----
+// Create a map keyed by a queue id and by a queue URI, and insert elements:
+//..
+//  typedef mwcc::TwoKeyFlatHashMap<int, bsl::string, bsl::string> Map;
+//  Map map(&allocator);
+//
+//  bsl::pair<Map::iterator, Map::InsertResult> rc = map.insert(
+//                                                         1,
+//                                                         "bmq://foo/bar",
+//                                                         "first");
+//  BSLS_ASSERT(rc.second == Map::e_INSERTED);
+//
+//  rc = map.insert(2, "bmq://foo/bar", "second");
+//  BSLS_ASSERT(rc.second == Map::e_SECOND_KEY_EXISTS);
+//  BSLS_ASSERT(rc.first->value() == "first");
+//..
+// Lookup by either key:
+//..
+//  Map::iterator it = map.findByKey2("bmq://foo/bar");
+//  BSLS_ASSERT(it != map.end());
+//  BSLS_ASSERT(it->key1() == 1);
+//  BSLS_ASSERT(it == map.findByKey1(1));
+//..
+// Erase every element matching a predicate while iterating:
+//..
+//  for (Map::iterator it = map.begin(); it != map.end();) {
+//      if (it->value() == "first") {
+//          it = map.erase(it);
+//      }
+//      else {
+//          ++it;
+//      }
+//  }
+//  BSLS_ASSERT(map.empty());
+//..
+//
+/// Exception Safety
+///----------------
+//: o if an exception is thrown by 'insert', that function has no effects.
+//:
+//: o no 'erase', 'eraseByKey1', 'eraseByKey2', 'clear' or 'swap' function
+//:   throws an exception, provided that moving an element using the
+//:   allocator of the container does not throw.
+//
+/// Thread Safety
+///-------------
+// NOT THREAD SAFE.
+
+// MWC
+
+// BDE
+#include <bdlb_scopeexit.h>
+#include <bdlf_memfn.h>
+#include <bsl_algorithm.h>  // bsl::max, bsl::swap
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_functional.h>  // bsl::hash
+#include <bsl_new.h>
+#include <bsl_utility.h>  // bsl::pair
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_destructorproctor.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_performancehint.h>
+
+namespace BloombergLP {
+
+namespace mwcc {
+
+// FORWARD DECLARATION
+template <class, class, class, class, class>
+class TwoKeyFlatHashMap;
+
+// =============================
+// struct TwoKeyFlatHashMap_Slot
+// =============================
+
+/// PRIVATE CLASS. For use only by `mwcc::TwoKeyFlatHashMap`
+/// implementation.  A slot of the table indexing one of the keys.
+struct TwoKeyFlatHashMap_Slot {
+    // PUBLIC CONSTANTS
+
+    /// Index of an empty slot.
+    static const bsl::uint32_t k_EMPTY = 0xFFFFFFFFu;
+
+    // PUBLIC DATA
+    bsl::uint32_t d_hash;  // Mixed hash of the key of the element
+
+    bsl::uint32_t d_index;  // Index of the element in the slab, or
+                            // 'k_EMPTY'
+};
+
+// ============================
+// class TwoKeyFlatHashMapValue
+// ============================
+
+/// An element of a `TwoKeyFlatHashMap`, holding both keys and the mapped
+/// value.
+template <class K1, class K2, class VALUE>
+class TwoKeyFlatHashMapValue {
+    // FRIENDS
+    template <class, class, class, class, class>
+    friend class TwoKeyFlatHashMap;
+
+  private:
+    // DATA
+    bsl::uint32_t d_hash1;  // Mixed hash of the first key
+
+    bsl::uint32_t d_hash2;  // Mixed hash of the second key
+
+    bsls::ObjectBuffer<K1> d_key1;
+
+    bsls::ObjectBuffer<K2> d_key2;
+
+    bsls::ObjectBuffer<VALUE> d_value;
+
+  private:
+    // NOT IMPLEMENTED
+    TwoKeyFlatHashMapValue() BSLS_KEYWORD_DELETED;
+    TwoKeyFlatHashMapValue(const TwoKeyFlatHashMapValue&) BSLS_KEYWORD_DELETED;
+    TwoKeyFlatHashMapValue&
+    operator=(const TwoKeyFlatHashMapValue&) BSLS_KEYWORD_DELETED;
+
+  private:
+    // PRIVATE CREATORS
+
+    /// Create an element having the specified `k1`, `k2` and `value`,
+    /// whose keys have the specified mixed `hash1` and `hash2`, using the
+    /// specified `allocator` to supply memory.
+    template <class VALUE_T>
+    TwoKeyFlatHashMapValue(bsl::uint32_t hash1,
+                           bsl::uint32_t hash2,
+                           const K1&     k1,
+                           const K2&     k2,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_T) value,
+                           bslma::Allocator* allocator);
+
+    /// Create an element having the same value as the specified `original`,
+    /// using the specified `allocator` to supply memory.
+    TwoKeyFlatHashMapValue(const TwoKeyFlatHashMapValue& original,
+                           bslma::Allocator*             allocator);
+
+    /// Create an element having the value of the specified `original`,
+    /// leaving `original` in a valid but unspecified state, using the
+    /// specified `allocator` to supply memory.
+    TwoKeyFlatHashMapValue(
+        bslmf::MovableRef<TwoKeyFlatHashMapValue> original,
+        bslma::Allocator*                         allocator);
+
+    /// Destroy this object.
+    ~TwoKeyFlatHashMapValue();
+
+  public:
+    // MANIPULATORS
+
+    /// Return a reference providing modifiable access to the mapped value
+    /// of this element.
+    VALUE& value() BSLS_KEYWORD_NOEXCEPT;
+
+    // ACCESSORS
+
+    /// Return a reference providing non-modifiable access to the first key
+    /// of this element.
+    const K1& key1() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return a reference providing non-modifiable access to the second key
+    /// of this element.
+    const K2& key2() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return a reference providing non-modifiable access to the mapped
+    /// value of this element.
+    const VALUE& value() const BSLS_KEYWORD_NOEXCEPT;
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified `lhs` and `rhs` elements have the same
+/// keys and the same mapped value, and `false` otherwise.
+template <class K1, class K2, class VALUE>
+bool operator==(const TwoKeyFlatHashMapValue<K1, K2, VALUE>& lhs,
+                const TwoKeyFlatHashMapValue<K1, K2, VALUE>& rhs);
+
+/// Return `true` if the specified `lhs` and `rhs` elements do not have the
+/// same keys or the same mapped value, and `false` otherwise.
+template <class K1, class K2, class VALUE>
+bool operator!=(const TwoKeyFlatHashMapValue<K1, K2, VALUE>& lhs,
+                const TwoKeyFlatHashMapValue<K1, K2, VALUE>& rhs);
+
+// =======================
+// class TwoKeyFlatHashMap
+// =======================
+
+/// Provides a template for an associative container with two unique keys,
+/// K1 and K2, containing objects of type VALUE stored contiguously.
+template <class K1,
+          class K2,
+          class VALUE,
+          class HASH1 = bsl::hash<K1>,
+          class HASH2 = bsl::hash<K2> >
+class TwoKeyFlatHashMap {
+  private:
+    // PRIVATE TYPES
+    typedef TwoKeyFlatHashMap_Slot Slot;
+
+    enum {
+        e_MIN_NUM_SLOTS = 16  // Must be a power of 2
+        ,
+        e_MIN_CAPACITY = 8
+    };
+
+  public:
+    // TYPES
+    enum InsertResult {
+        // Defines a numeric type to be used as the result of the 'insert()'
+        // member function.
+
+        e_INSERTED = 0  // ALWAYS 0
+        ,
+        e_FIRST_KEY_EXISTS = 1  // ALWAYS 1
+        ,
+        e_SECOND_KEY_EXISTS = 2  // ALWAYS 2
+    };
+
+    typedef K1                                    first_key_type;
+    typedef K2                                    second_key_type;
+    typedef VALUE                                 mapped_type;
+    typedef HASH1                                 first_hasher;
+    typedef HASH2                                 second_hasher;
+    typedef TwoKeyFlatHashMapValue<K1, K2, VALUE> value_type;
+    typedef value_type&                           reference;
+    typedef const value_type&                     const_reference;
+    typedef value_type*                           pointer;
+    typedef const value_type*                     const_pointer;
+    typedef value_type*                           iterator;
+    typedef const value_type*                     const_iterator;
+    typedef bsl::ptrdiff_t                        difference_type;
+    typedef bsl::size_t                           size_type;
+
+  private:
+    // DATA
+    bslma::Allocator* d_allocator_p;
+
+    HASH1 d_hasher1;
+
+    HASH2 d_hasher2;
+
+    Slot* d_slots_p;  // Table of the first key, immediately followed
+                      // by the table of the second key
+
+    bsl::size_t d_numSlots;  // Number of slots of each table, a power of
+                             // 2 which is 0 or at least
+                             // 'e_MIN_NUM_SLOTS'
+
+    int d_shift;  // Shift turning a mixed hash into its home slot
+
+    value_type* d_values_p;  // The slab
+
+    bsl::size_t d_size;  // Number of elements in the slab
+
+    bsl::size_t d_capacity;  // Number of elements the slab can hold
+
+  private:
+    // PRIVATE CLASS METHODS
+
+    /// Return the specified `hash` with its bits mixed down to 32 bits, so
+    /// that its highest bits are uniformly distributed even for trivial
+    /// hash functions, such as the identity.
+    static bsl::uint32_t mix(bsl::size_t hash);
+
+    /// Return the maximum number of slots of a table that can be in use for
+    /// the specified `numSlots` before the tables are rehashed.
+    static bsl::size_t maxLoad(bsl::size_t numSlots);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the index of the first slot in the probe sequence of the
+    /// specified mixed `hash`.
+    bsl::size_t homeSlot(bsl::uint32_t hash) const;
+
+    /// Return the index in the slab of the element having the specified
+    /// first key `k1`, whose mixed hash is the specified `hash`, or `d_size`
+    /// if no such element exists.
+    bsl::size_t findIndex1(const K1& k1, bsl::uint32_t hash) const;
+
+    /// Return the index in the slab of the element having the specified
+    /// second key `k2`, whose mixed hash is the specified `hash`, or
+    /// `d_size` if no such element exists.
+    bsl::size_t findIndex2(const K2& k2, bsl::uint32_t hash) const;
+
+    /// Return the address of the slot of the specified `table` holding the
+    /// specified slab `index`, whose key has the specified mixed `hash`.
+    /// The behavior is undefined unless such a slot exists.
+    Slot* findSlot(Slot* table, bsl::uint32_t hash, bsl::size_t index) const;
+
+    // PRIVATE MANIPULATORS
+
+    /// Store the specified slab `index`, whose key has the specified mixed
+    /// `hash`, in the first empty slot of its probe sequence in the
+    /// specified `table`.  The behavior is undefined unless `table` is not
+    /// full.
+    void insertSlot(Slot* table, bsl::uint32_t hash, bsl::size_t index);
+
+    /// Empty the specified `slot` of the specified `table`, shifting
+    /// backward the slots following it in their probe sequence.
+    void eraseSlot(Slot* table, Slot* slot);
+
+    /// Rebuild both tables with the specified `numSlots` slots each.  The
+    /// behavior is undefined unless `numSlots` is a power of 2 which is at
+    /// least `e_MIN_NUM_SLOTS` and can hold all the elements of this
+    /// container.
+    void rehash(bsl::size_t numSlots);
+
+    /// Move all the elements of this container to a newly allocated slab of
+    /// the specified `capacity`.  The behavior is undefined unless
+    /// `size() <= capacity`.
+    void reallocateValues(bsl::size_t capacity);
+
+    /// Make room for one more element in the slab and in the tables.
+    void prepareInsert();
+
+    /// Destroy all the elements of this container and release all memory.
+    void reset();
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TwoKeyFlatHashMap,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty `TwoKeyFlatHashMap`.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.  Note that no
+    /// memory is allocated until the first insertion.
+    explicit TwoKeyFlatHashMap(bslma::Allocator* basicAllocator = 0);
+
+    /// Create an empty `TwoKeyFlatHashMap` using the specified `hash1` and
+    /// `hash2` functors to hash the first and second keys respectively.
+    /// Optionally specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.
+    TwoKeyFlatHashMap(const HASH1&      hash1,
+                      const HASH2&      hash2,
+                      bslma::Allocator* basicAllocator = 0);
+
+    /// Create a `TwoKeyFlatHashMap` having the same value as the specified
+    /// `original`.  Optionally specify a `basicAllocator` used to supply
+    /// memory.  If `basicAllocator` is 0, the currently installed default
+    /// allocator is used.
+    TwoKeyFlatHashMap(const TwoKeyFlatHashMap& original,
+                      bslma::Allocator*        basicAllocator = 0);
+
+    /// Destroy this object and each of its elements.
+    ~TwoKeyFlatHashMap();
+
+    // MANIPULATORS
+
+    /// Assign to this object the value of the specified `rhs` object, and
+    /// return a reference providing modifiable access to this object.
+    TwoKeyFlatHashMap& operator=(const TwoKeyFlatHashMap& rhs);
+
+    /// Insert an element having the specified `k1`, `k2` and `value` keys
+    /// and mapped value, if neither `k1` nor `k2` already exist in this
+    /// container.  Return a pair whose first member is an iterator to the
+    /// inserted element and whose second member is `e_INSERTED` on success.
+    /// Otherwise, return a pair whose first member is an iterator to the
+    /// element having `k1` (respectively `k2`) and whose second member is
+    /// `e_FIRST_KEY_EXISTS` (respectively `e_SECOND_KEY_EXISTS`).  Note
+    /// that a successful insertion invalidates all iterators to this
+    /// container.
+    template <class VALUE_T>
+    bsl::pair<iterator, InsertResult>
+    insert(const K1& k1,
+           const K2& k2,
+           BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_T) value);
+
+    /// Insert a copy of the specified `value`, with the same semantics as
+    /// `insert(value.key1(), value.key2(), value.value())`.
+    bsl::pair<iterator, InsertResult> insert(const value_type& value);
+
+    /// Remove the element referred to by the specified `position` from
+    /// this container, and return an iterator referring to the element
+    /// which took its place in the slab, or `end()` if `position` referred
+    /// to the last element.  The behavior is undefined unless `position`
+    /// refers to an element of this container.
+    iterator erase(const_iterator position);
+
+    /// Remove the element having the specified first key `k1`, if any.
+    /// Return 0 on success, and a non-zero value if no such element exists.
+    int eraseByKey1(const K1& k1);
+
+    /// Remove the element having the specified second key `k2`, if any.
+    /// Return 0 on success, and a non-zero value if no such element exists.
+    int eraseByKey2(const K2& k2);
+
+    /// Remove all elements from this container.  Note that allocated memory
+    /// is retained for future use.
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+
+    /// Make room for at least the specified `numElements` elements in this
+    /// container, so that it can grow to `size() == numElements` without
+    /// allocating.  Note that this method invalidates all iterators to this
+    /// container.
+    void reserve(size_type numElements);
+
+    /// Exchange the value of this object with that of the specified `other`
+    /// object.  The behavior is undefined unless this object and `other`
+    /// use the same allocator.
+    void swap(TwoKeyFlatHashMap& other) BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return an iterator to the first element of this container, or
+    /// `end()` if this container is empty.
+    iterator begin() BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return the past-the-end iterator of this container.
+    iterator end() BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return an iterator to the element having the specified first key
+    /// `k1`, or `end()` if no such element exists.
+    iterator findByKey1(const K1& k1);
+
+    /// Return an iterator to the element having the specified second key
+    /// `k2`, or `end()` if no such element exists.
+    iterator findByKey2(const K2& k2);
+
+    // ACCESSORS
+
+    /// Return an iterator to the first element of this container, or
+    /// `end()` if this container is empty.
+    const_iterator begin() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cbegin() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return the past-the-end iterator of this container.
+    const_iterator end() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cend() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return an iterator to the element having the specified first key
+    /// `k1`, or `end()` if no such element exists.
+    const_iterator findByKey1(const K1& k1) const;
+
+    /// Return an iterator to the element having the specified second key
+    /// `k2`, or `end()` if no such element exists.
+    const_iterator findByKey2(const K2& k2) const;
+
+    /// Return `true` if this container has no elements, and `false`
+    /// otherwise.
+    bool empty() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return the number of elements in this container.
+    size_type size() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return the number of elements this container can hold without
+    /// allocating.
+    size_type capacity() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return a copy of the functor used to hash the first key.
+    first_hasher hash1() const;
+
+    /// Return a copy of the functor used to hash the second key.
+    second_hasher hash2() const;
+
+    /// Return the allocator used by this container to supply memory.
+    bslma::Allocator* allocator() const;
+};
+
+// FREE OPERATORS
+
+/// Exchange the values of the specified `lhs` and `rhs` objects.  The
+/// behavior is undefined unless both objects use the same allocator.
+template <class K1, class K2, class VALUE, class H1, class H2>
+void swap(TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>& lhs,
+          TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>& rhs)
+    BSLS_KEYWORD_NOEXCEPT;
+
+/// Return `true` if the specified `lhs` and `rhs` objects hold the same
+/// elements, irrespective of their order, and `false` otherwise.
+template <class K1, class K2, class VALUE, class H1, class H2>
+bool operator==(const TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>& lhs,
+                const TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>& rhs);
+
+/// Return `true` if the specified `lhs` and `rhs` objects do not hold the
+/// same elements, and `false` otherwise.
+template <class K1, class K2, class VALUE, class H1, class H2>
+bool operator!=(const TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>& lhs,
+                const TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>& rhs);
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ----------------------------
+// class TwoKeyFlatHashMapValue
+// ----------------------------
+
+// PRIVATE CREATORS
+template <class K1, class K2, class VALUE>
+template <class VALUE_T>
+inline TwoKeyFlatHashMapValue<K1, K2, VALUE>::TwoKeyFlatHashMapValue(
+    bsl::uint32_t hash1,
+    bsl::uint32_t hash2,
+    const K1&     k1,
+    const K2&     k2,
+    BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_T) value,
+    bslma::Allocator* allocator)
+: d_hash1(hash1)
+, d_hash2(hash2)
+{
+    bslma::ConstructionUtil::construct(d_key1.address(), allocator, k1);
+    bslma::DestructorProctor<K1> key1Proctor(d_key1.address());
+
+    bslma::ConstructionUtil::construct(d_key2.address(), allocator, k2);
+    bslma::DestructorProctor<K2> key2Proctor(d_key2.address());
+
+    bslma::ConstructionUtil::construct(
+        d_value.address(),
+        allocator,
+        BSLS_COMPILERFEATURES_FORWARD(VALUE_T, value));
+
+    key2Proctor.release();
+    key1Proctor.release();
+}
+
+template <class K1, class K2, class VALUE>
+inline TwoKeyFlatHashMapValue<K1, K2, VALUE>::TwoKeyFlatHashMapValue(
+    const TwoKeyFlatHashMapValue& original,
+    bslma::Allocator*             allocator)
+: d_hash1(original.d_hash1)
+, d_hash2(original.d_hash2)
+{
+    bslma::ConstructionUtil::construct(d_key1.address(),
+                                       allocator,
+                                       original.key1());
+    bslma::DestructorProctor<K1> key1Proctor(d_key1.address());
+
+    bslma::ConstructionUtil::construct(d_key2.address(),
+                                       allocator,
+                                       original.key2());
+    bslma::DestructorProctor<K2> key2Proctor(d_key2.address());
+
+    bslma::ConstructionUtil::construct(d_value.address(),
+                                       allocator,
+                                       original.value());
+
+    key2Proctor.release();
+    key1Proctor.release();
+}
+
+template <class K1, class K2, class VALUE>
+inline TwoKeyFlatHashMapValue<K1, K2, VALUE>::TwoKeyFlatHashMapValue(
+    bslmf::MovableRef<TwoKeyFlatHashMapValue> original,
+    bslma::Allocator*                         allocator)
+{
+    TwoKeyFlatHashMapValue& lvalue = bslmf::MovableRefUtil::access(original);
+
+    d_hash1 = lvalue.d_hash1;
+    d_hash2 = lvalue.d_hash2;
+
+    bslma::ConstructionUtil::construct(
+        d_key1.address(),
+        allocator,
+        bslmf::MovableRefUtil::move(lvalue.d_key1.object()));
+    bslma::DestructorProctor<K1> key1Proctor(d_key1.address());
+
+    bslma::ConstructionUtil::construct(
+        d_key2.address(),
+        allocator,
+        bslmf::MovableRefUtil::move(lvalue.d_key2.object()));
+    bslma::DestructorProctor<K2> key2Proctor(d_key2.address());
+
+    bslma::ConstructionUtil::construct(
+        d_value.address(),
+        allocator,
+        bslmf::MovableRefUtil::move(lvalue.d_value.object()));
+
+    key2Proctor.release();
+    key1Proctor.release();
+}
+
+template <class K1, class K2, class VALUE>
+inline TwoKeyFlatHashMapValue<K1, K2, VALUE>::~TwoKeyFlatHashMapValue()
+{
+    d_value.object().~VALUE();
+    d_key2.object().~K2();
+    d_key1.object().~K1();
+}
+
+// MANIPULATORS
+template <class K1, class K2, class VALUE>
+inline VALUE&
+TwoKeyFlatHashMapValue<K1, K2, VALUE>::value() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_value.object();
+}
+
+// ACCESSORS
+template <class K1, class K2, class VALUE>
+inline const K1&
+TwoKeyFlatHashMapValue<K1, K2, VALUE>::key1() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_key1.object();
+}
+
+template <class K1, class K2, class VALUE>
+inline const K2&
+TwoKeyFlatHashMapValue<K1, K2, VALUE>::key2() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_key2.object();
+}
+
+template <class K1, class K2, class VALUE>
+inline const VALUE&
+TwoKeyFlatHashMapValue<K1, K2, VALUE>::value() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_value.object();
+}
+
+// -----------------------
+// class TwoKeyFlatHashMap
+// -----------------------
+
+// PRIVATE CLASS METHODS
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline bsl::uint32_t
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::mix(bsl::size_t hash)
+{
+    // Fibonacci hashing: the highest bits of the product depend on all the
+    // bits of 'hash'.
+    return static_cast<bsl::uint32_t>(
+        (static_cast<bsl::uint64_t>(hash) * 0x9E3779B97F4A7C15ULL) >> 32);
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline bsl::size_t
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::maxLoad(bsl::size_t numSlots)
+{
+    return numSlots - numSlots / 4;
+}
+
+// PRIVATE ACCESSORS
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline bsl::size_t
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::homeSlot(bsl::uint32_t hash) const
+{
+    return hash >> d_shift;
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline bsl::size_t
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::findIndex1(const K1&     k1,
+                                                     bsl::uint32_t hash) const
+{
+    if (d_size == 0) {
+        return d_size;  // RETURN
+    }
+
+    const bsl::size_t mask = d_numSlots - 1;
+    for (bsl::size_t i = homeSlot(hash);; i = (i + 1) & mask) {
+        const Slot& slot = d_slots_p[i];
+        if (slot.d_index == Slot::k_EMPTY) {
+            return d_size;  // RETURN
+        }
+
+        if (slot.d_hash == hash && d_values_p[slot.d_index].key1() == k1) {
+            return slot.d_index;  // RETURN
+        }
+    }
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline bsl::size_t
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::findIndex2(const K2&     k2,
+                                                     bsl::uint32_t hash) const
+{
+    if (d_size == 0) {
+        return d_size;  // RETURN
+    }
+
+    const Slot*       table = d_slots_p + d_numSlots;
+    const bsl::size_t mask  = d_numSlots - 1;
+    for (bsl::size_t i = homeSlot(hash);; i = (i + 1) & mask) {
+        const Slot& slot = table[i];
+        if (slot.d_index == Slot::k_EMPTY) {
+            return d_size;  // RETURN
+        }
+
+        if (slot.d_hash == hash && d_values_p[slot.d_index].key2() == k2) {
+            return slot.d_index;  // RETURN
+        }
+    }
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline typename TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::Slot*
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::findSlot(Slot*         table,
+                                                   bsl::uint32_t hash,
+                                                   bsl::size_t   index) const
+{
+    const bsl::size_t mask = d_numSlots - 1;
+    for (bsl::size_t i = homeSlot(hash);; i = (i + 1) & mask) {
+        BSLS_ASSERT_SAFE(table[i].d_index != Slot::k_EMPTY);
+
+        if (table[i].d_index == index) {
+            return table + i;  // RETURN
+        }
+    }
+}
+
+// PRIVATE MANIPULATORS
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline void
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::insertSlot(Slot*         table,
+                                                     bsl::uint32_t hash,
+                                                     bsl::size_t   index)
+{
+    const bsl::size_t mask = d_numSlots - 1;
+    bsl::size_t       i    = homeSlot(hash);
+    while (table[i].d_index != Slot::k_EMPTY) {
+        i = (i + 1) & mask;
+    }
+
+    table[i].d_hash  = hash;
+    table[i].d_index = static_cast<bsl::uint32_t>(index);
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline void TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::eraseSlot(Slot* table,
+                                                                Slot* slot)
+{
+    // Backward shift deletion: move back into the hole any following slot of
+    // the probe sequence whose home slot is not between the hole and itself,
+    // so that no lookup stops at the hole before reaching it.
+    const bsl::size_t mask = d_numSlots - 1;
+    bsl::size_t       hole = static_cast<bsl::size_t>(slot - table);
+    for (bsl::size_t i = (hole + 1) & mask;
+         table[i].d_index != Slot::k_EMPTY;
+         i = (i + 1) & mask) {
+        const bsl::size_t home = homeSlot(table[i].d_hash);
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            table[hole] = table[i];
+            hole        = i;
+        }
+    }
+
+    table[hole].d_index = Slot::k_EMPTY;
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+void TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::rehash(bsl::size_t numSlots)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(numSlots >= e_MIN_NUM_SLOTS);
+    BSLS_ASSERT_SAFE((numSlots & (numSlots - 1)) == 0);
+    BSLS_ASSERT_SAFE(d_size <= maxLoad(numSlots));
+
+    Slot* slots = static_cast<Slot*>(
+        d_allocator_p->allocate(2 * numSlots * sizeof(Slot)));
+    for (bsl::size_t i = 0; i < 2 * numSlots; ++i) {
+        slots[i].d_index = Slot::k_EMPTY;
+    }
+
+    d_allocator_p->deallocate(d_slots_p);
+
+    d_slots_p  = slots;
+    d_numSlots = numSlots;
+    d_shift    = 32;
+    for (bsl::size_t n = numSlots; n > 1; n >>= 1) {
+        --d_shift;
+    }
+
+    for (bsl::size_t i = 0; i < d_size; ++i) {
+        insertSlot(d_slots_p, d_values_p[i].d_hash1, i);
+        insertSlot(d_slots_p + d_numSlots, d_values_p[i].d_hash2, i);
+    }
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+void TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::reallocateValues(
+    bsl::size_t capacity)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_size <= capacity);
+    BSLS_ASSERT_SAFE(capacity <= Slot::k_EMPTY);
+
+    value_type* values = static_cast<value_type*>(
+        d_allocator_p->allocate(capacity * sizeof(value_type)));
+
+    // Elements keep their index, so that the tables need not be updated.
+    for (bsl::size_t i = 0; i < d_size; ++i) {
+        new (values + i)
+            value_type(bslmf::MovableRefUtil::move(d_values_p[i]),
+                       d_allocator_p);
+        d_values_p[i].~value_type();
+    }
+
+    d_allocator_p->deallocate(d_values_p);
+
+    d_values_p = values;
+    d_capacity = capacity;
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline void TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::prepareInsert()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_size == d_capacity)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        reallocateValues(bsl::max(2 * d_capacity,
+                                  static_cast<bsl::size_t>(e_MIN_CAPACITY)));
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_size + 1 >
+                                              maxLoad(d_numSlots))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        rehash(d_numSlots == 0 ? static_cast<bsl::size_t>(e_MIN_NUM_SLOTS)
+                               : 2 * d_numSlots);
+    }
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+void TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::reset()
+{
+    clear();
+
+    d_allocator_p->deallocate(d_values_p);
+    d_allocator_p->deallocate(d_slots_p);
+
+    d_values_p = 0;
+    d_capacity = 0;
+    d_slots_p  = 0;
+    d_numSlots = 0;
+}
+
+// CREATORS
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::TwoKeyFlatHashMap(
+    bslma::Allocator* basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_hasher1()
+, d_hasher2()
+, d_slots_p(0)
+, d_numSlots(0)
+, d_shift(32)
+, d_values_p(0)
+, d_size(0)
+, d_capacity(0)
+{
+    // NOTHING
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::TwoKeyFlatHashMap(
+    const H1&         hash1,
+    const H2&         hash2,
+    bslma::Allocator* basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_hasher1(hash1)
+, d_hasher2(hash2)
+, d_slots_p(0)
+, d_numSlots(0)
+, d_shift(32)
+, d_values_p(0)
+, d_size(0)
+, d_capacity(0)
+{
+    // NOTHING
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::TwoKeyFlatHashMap(
+    const TwoKeyFlatHashMap& original,
+    bslma::Allocator*        basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_hasher1(original.d_hasher1)
+, d_hasher2(original.d_hasher2)
+, d_slots_p(0)
+, d_numSlots(0)
+, d_shift(32)
+, d_values_p(0)
+, d_size(0)
+, d_capacity(0)
+{
+    if (original.empty()) {
+        return;  // RETURN
+    }
+
+    // free memory on failure
+    BDLB_SCOPEEXIT_PROCTOR(guard,
+                           bdlf::MemFnUtil::memFn(&TwoKeyFlatHashMap::reset,
+                                                  this));
+
+    // copy the slab, then index it using the cached hashes
+    reallocateValues(original.d_size);
+    for (; d_size < original.d_size; ++d_size) {
+        new (d_values_p + d_size)
+            value_type(original.d_values_p[d_size], d_allocator_p);
+    }
+
+    rehash(original.d_numSlots);
+
+    // success
+    guard.release();
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::~TwoKeyFlatHashMap()
+{
+    reset();
+}
+
+// MANIPULATORS
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>&
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::operator=(
+    const TwoKeyFlatHashMap& rhs)
+{
+    if (&rhs != this) {
+        TwoKeyFlatHashMap(rhs, d_allocator_p).swap(*this);  // copy-and-swap
+    }
+
+    return *this;
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+template <class VALUE_T>
+inline bsl::pair<
+    typename TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::iterator,
+    typename TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::InsertResult>
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::insert(
+    const K1& k1,
+    const K2& k2,
+    BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_T) value)
+{
+    const bsl::uint32_t hash1 = mix(d_hasher1(k1));
+    bsl::size_t         index = findIndex1(k1, hash1);
+    if (index != d_size) {
+        return bsl::make_pair(d_values_p + index,
+                              e_FIRST_KEY_EXISTS);  // RETURN
+    }
+
+    const bsl::uint32_t hash2 = mix(d_hasher2(k2));
+    index                     = findIndex2(k2, hash2);
+    if (index != d_size) {
+        return bsl::make_pair(d_values_p + index,
+                              e_SECOND_KEY_EXISTS);  // RETURN
+    }
+
+    prepareInsert();
+
+    // Construct the element first, so that the tables are left untouched if
+    // the construction throws.
+    index = d_size;
+    new (d_values_p + index)
+        value_type(hash1,
+                   hash2,
+                   k1,
+                   k2,
+                   BSLS_COMPILERFEATURES_FORWARD(VALUE_T, value),
+                   d_allocator_p);
+    ++d_size;
+
+    insertSlot(d_slots_p, hash1, index);
+    insertSlot(d_slots_p + d_numSlots, hash2, index);
+
+    return bsl::make_pair(d_values_p + index, e_INSERTED);
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline bsl::pair<
+    typename TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::iterator,
+    typename TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::InsertResult>
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::insert(const value_type& value)
+{
+    return insert(value.key1(), value.key2(), value.value());
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline typename TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::iterator
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::erase(const_iterator position)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(d_values_p <= position && position < d_values_p + d_size);
+
+    const bsl::size_t index = static_cast<bsl::size_t>(position -
+                                                        d_values_p);
+    const bsl::size_t last  = d_size - 1;
+    value_type*       value = d_values_p + index;
+
+    eraseSlot(d_slots_p, findSlot(d_slots_p, value->d_hash1, index));
+    eraseSlot(d_slots_p + d_numSlots,
+              findSlot(d_slots_p + d_numSlots, value->d_hash2, index));
+    value->~value_type();
+
+    if (index != last) {
+        // Move the last element into the hole, and update its slots.
+        value_type* lastValue = d_values_p + last;
+        new (value) value_type(bslmf::MovableRefUtil::move(*lastValue),
+                               d_allocator_p);
+        lastValue->~value_type();
+
+        findSlot(d_slots_p, value->d_hash1, last)->d_index =
+            static_cast<bsl::uint32_t>(index);
+        findSlot(d_slots_p + d_numSlots, value->d_hash2, last)->d_index =
+            static_cast<bsl::uint32_t>(index);
+    }
+
+    --d_size;
+
+    return value;
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline int TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::eraseByKey1(const K1& k1)
+{
+    const bsl::size_t index = findIndex1(k1, mix(d_hasher1(k1)));
+    if (index == d_size) {
+        return -1;  // RETURN
+    }
+
+    erase(d_values_p + index);
+    return 0;
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline int TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::eraseByKey2(const K2& k2)
+{
+    const bsl::size_t index = findIndex2(k2, mix(d_hasher2(k2)));
+    if (index == d_size) {
+        return -1;  // RETURN
+    }
+
+    erase(d_values_p + index);
+    return 0;
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline void
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::clear() BSLS_KEYWORD_NOEXCEPT
+{
+    for (bsl::size_t i = 0; i < d_size; ++i) {
+        d_values_p[i].~value_type();
+    }
+
+    for (bsl::size_t i = 0; i < 2 * d_numSlots; ++i) {
+        d_slots_p[i].d_index = Slot::k_EMPTY;
+    }
+
+    d_size = 0;
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline void
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::reserve(size_type numElements)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(numElements <= Slot::k_EMPTY);
+
+    if (numElements > d_capacity) {
+        reallocateValues(numElements);
+    }
+
+    if (numElements > maxLoad(d_numSlots)) {
+        bsl::size_t numSlots = d_numSlots == 0
+                                   ? static_cast<bsl::size_t>(e_MIN_NUM_SLOTS)
+                                   : d_numSlots;
+        while (numElements > maxLoad(numSlots)) {
+            numSlots *= 2;
+        }
+
+        rehash(numSlots);
+    }
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline void TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::swap(
+    TwoKeyFlatHashMap& other) BSLS_KEYWORD_NOEXCEPT
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(d_allocator_p == other.d_allocator_p);
+
+    using bsl::swap;
+
+    swap(d_hasher1, other.d_hasher1);
+    swap(d_hasher2, other.d_hasher2);
+    swap(d_slots_p, other.d_slots_p);
+    swap(d_numSlots, other.d_numSlots);
+    swap(d_shift, other.d_shift);
+    swap(d_values_p, other.d_values_p);
+    swap(d_size, other.d_size);
+    swap(d_capacity, other.d_capacity);
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline typename TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::iterator
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::begin() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_values_p;
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline typename TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::iterator
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::end() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_values_p + d_size;
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline typename TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::iterator
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::findByKey1(const K1& k1)
+{
+    return d_values_p + findIndex1(k1, mix(d_hasher1(k1)));
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline typename TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::iterator
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::findByKey2(const K2& k2)
+{
+    return d_values_p + findIndex2(k2, mix(d_hasher2(k2)));
+}
+
+// ACCESSORS
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline typename TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::const_iterator
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::begin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_values_p;
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline typename TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::const_iterator
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::cbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_values_p;
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline typename TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::const_iterator
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::end() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_values_p + d_size;
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline typename TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::const_iterator
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::cend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_values_p + d_size;
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline typename TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::const_iterator
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::findByKey1(const K1& k1) const
+{
+    return d_values_p + findIndex1(k1, mix(d_hasher1(k1)));
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline typename TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::const_iterator
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::findByKey2(const K2& k2) const
+{
+    return d_values_p + findIndex2(k2, mix(d_hasher2(k2)));
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline bool
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::empty() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_size == 0;
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline typename TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::size_type
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::size() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_size;
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline typename TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::size_type
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::capacity() const
+    BSLS_KEYWORD_NOEXCEPT
+{
+    return d_capacity;
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline typename TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::first_hasher
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::hash1() const
+{
+    return d_hasher1;
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline typename TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::second_hasher
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::hash2() const
+{
+    return d_hasher2;
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline bslma::Allocator*
+TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class K1, class K2, class VALUE>
+inline bool
+mwcc::operator==(const TwoKeyFlatHashMapValue<K1, K2, VALUE>& lhs,
+                 const TwoKeyFlatHashMapValue<K1, K2, VALUE>& rhs)
+{
+    return lhs.key1() == rhs.key1() && lhs.key2() == rhs.key2() &&
+           lhs.value() == rhs.value();
+}
+
+template <class K1, class K2, class VALUE>
+inline bool
+mwcc::operator!=(const TwoKeyFlatHashMapValue<K1, K2, VALUE>& lhs,
+                 const TwoKeyFlatHashMapValue<K1, K2, VALUE>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline void mwcc::swap(TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>& lhs,
+                       TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>& rhs)
+    BSLS_KEYWORD_NOEXCEPT
+{
+    lhs.swap(rhs);
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline bool
+mwcc::operator==(const TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>& lhs,
+                 const TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>& rhs)
+{
+    typedef TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2> Map;
+
+    if (lhs.size() != rhs.size()) {
+        return false;  // RETURN
+    }
+
+    for (typename Map::const_iterator lIt = lhs.cbegin(); lIt != lhs.cend();
+         ++lIt) {
+        typename Map::const_iterator rIt = rhs.findByKey1(lIt->key1());
+        if (rIt == rhs.cend() || *lIt != *rIt) {
+            return false;  // RETURN
+        }
+    }
+
+    return true;
+}
+
+template <class K1, class K2, class VALUE, class H1, class H2>
+inline bool
+mwcc::operator!=(const TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>& lhs,
+                 const TwoKeyFlatHashMap<K1, K2, VALUE, H1, H2>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,529 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcc_twokeyflathashmap.t.cpp                                       -*-C++-*-
+#include <mwcc_twokeyflathashmap.h>
+
+// MWC
+#include <mwcc_twokeyhashmap.h>
+
+// BDE
+#include <bsl_cstddef.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// BENCHMARKING LIBRARY
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <benchmark/benchmark.h>
+#endif
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+namespace {
+
+/// Hash function mapping each key to itself, which is the worst case for
+/// the distribution of the hash bits.
+class IdentityHasher {
+  public:
+    IdentityHasher() {}
+
+    size_t operator()(int x) const { return x; }
+};
+
+struct TestValueType {
+    // CLASS LEVEL DATA
+    static int s_numDeletions;
+
+    // DATA
+    int d_a;
+
+    // CREATORS
+    TestValueType(int a) { d_a = a; }
+
+    ~TestValueType() { s_numDeletions += 1; }
+};
+
+int TestValueType::s_numDeletions(0);
+
+/// Return the URI-like second key of the element having the specified
+/// first key `i`.
+bsl::string uriOf(int i)
+{
+    bsl::string uri("bmq://bmq.test.mem.priority/queue", s_allocator_p);
+    uri += bsl::to_string(i);
+    return uri;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise basic functionality before beginning testing in earnest.
+//   Probe that functionality to discover basic errors.
+//
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    typedef mwcc::TwoKeyFlatHashMap<int, bsl::string, bsl::string> MyMapType;
+
+    typedef MyMapType::iterator       IterType;
+    typedef MyMapType::const_iterator ConstIterType;
+
+    const bsl::string k2("foo", s_allocator_p);
+    const bsl::string value("bar", s_allocator_p);
+
+    MyMapType        map(s_allocator_p);
+    const MyMapType& cmap = map;
+    ASSERT_EQ(true, map.begin() == map.end());
+    ASSERT_EQ(true, cmap.begin() == cmap.end());
+    ASSERT_EQ(true, cmap.empty());
+    ASSERT_EQ(0U, cmap.size());
+    ASSERT_EQ(true, map.findByKey1(1) == map.end());
+    ASSERT_EQ(true, cmap.findByKey2(k2) == cmap.end());
+    ASSERT_NE(0, map.eraseByKey1(1));
+    ASSERT_NE(0, map.eraseByKey2(k2));
+
+    map.clear();
+
+    bsl::pair<IterType, MyMapType::InsertResult> rc = map.insert(1,
+                                                                 k2,
+                                                                 value);
+    ASSERT_EQ(MyMapType::e_INSERTED, rc.second);
+    ASSERT_EQ(true, rc.first == map.begin());
+    ASSERT_EQ(1, rc.first->key1());
+    ASSERT_EQ(k2, rc.first->key2());
+    ASSERT_EQ(value, rc.first->value());
+    ASSERT_EQ(1U, cmap.size());
+    ASSERT_EQ(false, cmap.empty());
+
+    // The existing element is not modified when either key exists.
+    rc = map.insert(1, bsl::string("baz", s_allocator_p), "x");
+    ASSERT_EQ(MyMapType::e_FIRST_KEY_EXISTS, rc.second);
+    ASSERT_EQ(value, rc.first->value());
+
+    rc = map.insert(2, k2, "x");
+    ASSERT_EQ(MyMapType::e_SECOND_KEY_EXISTS, rc.second);
+    ASSERT_EQ(value, rc.first->value());
+    ASSERT_EQ(1U, cmap.size());
+
+    ConstIterType cit = cmap.findByKey2(k2);
+    ASSERT_EQ(true, cit != cmap.end());
+    ASSERT_EQ(true, cit == cmap.findByKey1(1));
+
+    map.findByKey1(1)->value() = "baz";
+    ASSERT_EQ(bsl::string("baz"), cit->value());
+
+    ASSERT_EQ(0, map.eraseByKey2(k2));
+    ASSERT_EQ(true, map.begin() == map.end());
+    ASSERT_EQ(true, map.findByKey1(1) == map.end());
+}
+
+static void test2_insert()
+// ------------------------------------------------------------------------
+// INSERT
+//
+// Concerns:
+//   Inserting many elements, including with a hash function which does not
+//   distribute its bits, keeps every element reachable by both keys.
+//   Reserving makes room for the requested number of elements.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("INSERT");
+
+    typedef mwcc::TwoKeyFlatHashMap<int, bsl::string, int, IdentityHasher>
+        MyMapType;
+
+    const int k_NUM_ELEMENTS = 100000;
+
+    MyMapType map(s_allocator_p);
+    for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+        ASSERT_EQ_D(i,
+                    MyMapType::e_INSERTED,
+                    map.insert(i << 16, uriOf(i), i).second);
+    }
+    ASSERT_EQ(static_cast<size_t>(k_NUM_ELEMENTS), map.size());
+
+    for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+        MyMapType::iterator it = map.findByKey1(i << 16);
+        ASSERT_EQ_D(i, true, it != map.end());
+        ASSERT_EQ_D(i, i, it->value());
+        ASSERT_EQ_D(i, true, it == map.findByKey2(uriOf(i)));
+        ASSERT_EQ_D(i, true, map.findByKey1((i << 16) + 1) == map.end());
+    }
+
+    // Reserve
+    MyMapType reserved(s_allocator_p);
+    reserved.reserve(k_NUM_ELEMENTS);
+    const size_t capacity = reserved.capacity();
+    ASSERT_EQ(true, capacity >= static_cast<size_t>(k_NUM_ELEMENTS));
+
+    for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+        reserved.insert(i, uriOf(i), i);
+    }
+    ASSERT_EQ(capacity, reserved.capacity());
+}
+
+static void test3_erase()
+// ------------------------------------------------------------------------
+// ERASE
+//
+// Concerns:
+//   Erasing elements by either key or by iterator, interleaved with
+//   insertions, keeps the container consistent with a reference container,
+//   in particular when the erased element is replaced by the last element
+//   of the slab and when slots are shifted backward.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("ERASE");
+
+    typedef mwcc::TwoKeyFlatHashMap<int, bsl::string, int> MyMapType;
+    typedef bsl::unordered_map<int, int>                   RefMapType;
+
+    const int k_NUM_KEYS       = 2000;
+    const int k_NUM_OPERATIONS = 200000;
+
+    MyMapType  map(s_allocator_p);
+    RefMapType ref(s_allocator_p);
+
+    unsigned int seed = 12345;
+    for (int op = 0; op < k_NUM_OPERATIONS; ++op) {
+        // Linear congruential generator, to have a deterministic sequence.
+        seed        = seed * 1103515245 + 12345;
+        const int i = static_cast<int>((seed >> 8) % k_NUM_KEYS);
+
+        switch ((seed >> 4) % 4) {
+        case 0:
+        case 1: {
+            const bool inserted =
+                map.insert(i, uriOf(i), op).second == MyMapType::e_INSERTED;
+            ASSERT_EQ_D(op, ref.count(i) == 0, inserted);
+            if (inserted) {
+                ref[i] = op;
+            }
+        } break;
+        case 2: {
+            ASSERT_EQ_D(op, ref.erase(i) == 1, map.eraseByKey1(i) == 0);
+        } break;
+        case 3: {
+            MyMapType::iterator it = map.findByKey2(uriOf(i));
+            ASSERT_EQ_D(op, ref.count(i) == 1, it != map.end());
+            if (it != map.end()) {
+                map.erase(it);
+                ref.erase(i);
+            }
+        } break;
+        }
+    }
+
+    ASSERT_EQ(ref.size(), map.size());
+    for (RefMapType::const_iterator it = ref.begin(); it != ref.end(); ++it) {
+        MyMapType::const_iterator mit = map.findByKey1(it->first);
+        ASSERT_EQ_D(it->first, true, mit != map.end());
+        ASSERT_EQ_D(it->first, it->second, mit->value());
+        ASSERT_EQ_D(it->first, true, mit == map.findByKey2(uriOf(it->first)));
+    }
+}
+
+static void test4_eraseWhileIterating()
+// ------------------------------------------------------------------------
+// ERASE WHILE ITERATING
+//
+// Concerns:
+//   Erasing elements while iterating visits each element exactly once.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("ERASE WHILE ITERATING");
+
+    typedef mwcc::TwoKeyFlatHashMap<int, bsl::string, int> MyMapType;
+
+    const int k_NUM_ELEMENTS = 1000;
+
+    MyMapType map(s_allocator_p);
+    for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+        map.insert(i, uriOf(i), i);
+    }
+
+    bsl::vector<int> numVisits(k_NUM_ELEMENTS, 0, s_allocator_p);
+    for (MyMapType::iterator it = map.begin(); it != map.end();) {
+        ++numVisits[it->value()];
+        if (it->value() % 3 != 0) {
+            it = map.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+        ASSERT_EQ_D(i, 1, numVisits[i]);
+        ASSERT_EQ_D(i, i % 3 == 0, map.findByKey1(i) != map.end());
+        ASSERT_EQ_D(i, i % 3 == 0, map.findByKey2(uriOf(i)) != map.end());
+    }
+    ASSERT_EQ(static_cast<size_t>((k_NUM_ELEMENTS + 2) / 3), map.size());
+
+    // Erase the remaining elements, from the last one.
+    while (!map.empty()) {
+        ASSERT_EQ(true, map.erase(map.end() - 1) == map.end());
+    }
+}
+
+static void test5_clear()
+// ------------------------------------------------------------------------
+// CLEAR
+//
+// Concerns:
+//   Clearing the map and destroying it destroy each element exactly once,
+//   and elements moved within the slab are not destroyed twice.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("CLEAR");
+
+    typedef mwcc::TwoKeyFlatHashMap<int, int, TestValueType> MyMapType;
+
+    const int k_NUM_ELEMENTS = 100;
+
+    {
+        MyMapType map(s_allocator_p);
+        for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+            map.insert(i, -i, TestValueType(i));
+        }
+        ASSERT_EQ(map.size(), static_cast<size_t>(k_NUM_ELEMENTS));
+
+        TestValueType::s_numDeletions = 0;
+        map.clear();
+        ASSERT_EQ(TestValueType::s_numDeletions, k_NUM_ELEMENTS);
+        ASSERT_EQ(true, map.empty());
+        ASSERT_EQ(true, map.begin() == map.end());
+
+        for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+            map.insert(i, -i, TestValueType(i));
+        }
+        ASSERT_EQ(0, map.eraseByKey1(0));
+        ASSERT_EQ(k_NUM_ELEMENTS - 1, map.begin()->value().d_a);
+
+        TestValueType::s_numDeletions = 0;
+    }
+
+    // Only the remaining elements are destroyed along with the map.
+    ASSERT_EQ(TestValueType::s_numDeletions, k_NUM_ELEMENTS - 1);
+}
+
+static void test6_copyAndAssignment()
+// ------------------------------------------------------------------------
+// COPY, ASSIGNMENT AND SWAP
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("COPY, ASSIGNMENT AND SWAP");
+
+    typedef mwcc::TwoKeyFlatHashMap<int, bsl::string, bsl::string> MyMapType;
+
+    const int k_NUM_ELEMENTS = 1000;
+
+    MyMapType map(s_allocator_p);
+    for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+        map.insert(i, uriOf(i), bsl::string(i, 'x', s_allocator_p));
+    }
+    for (int i = 0; i < k_NUM_ELEMENTS; i += 3) {
+        map.eraseByKey1(i);
+    }
+
+    MyMapType copy(map, s_allocator_p);
+    MyMapType assigned(s_allocator_p);
+    assigned.insert(-1, uriOf(-1), "y");
+    assigned = map;
+
+    ASSERT_EQ(true, copy == map);
+    ASSERT_EQ(true, assigned == map);
+    ASSERT_EQ(true, assigned.findByKey1(-1) == assigned.end());
+
+    // The copies are indexed by both keys.
+    for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+        ASSERT_EQ_D(i, i % 3 != 0, copy.findByKey2(uriOf(i)) != copy.end());
+    }
+
+    copy.begin()->value() = "z";
+    ASSERT_EQ(true, copy != map);
+
+    MyMapType other(s_allocator_p);
+    other.insert(-1, uriOf(-1), "y");
+
+    mwcc::swap(other, assigned);
+    ASSERT_EQ(true, other == map);
+    ASSERT_EQ(1U, assigned.size());
+    ASSERT_EQ(true, assigned.findByKey2(uriOf(-1)) != assigned.end());
+}
+
+BSLA_MAYBE_UNUSED
+static void testN1_findPerformance()
+// ------------------------------------------------------------------------
+// FIND PERFORMANCE
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("FIND PERFORMANCE");
+
+    // Performance comparison of findByKey1() and findByKey2() with
+    // mwcc::TwoKeyHashMap
+    const int k_NUM_ELEMENTS = 1000000;
+
+    bsl::vector<bsl::string> uris(s_allocator_p);
+    uris.reserve(k_NUM_ELEMENTS);
+    for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+        uris.push_back(uriOf(i));
+    }
+
+    {
+        typedef mwcc::TwoKeyFlatHashMap<int, bsl::string, int> MyMapType;
+
+        MyMapType map(s_allocator_p);
+        for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+            map.insert(i, uris[i], i);
+        }
+
+        bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+        for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+            ASSERT_EQ_D(i, i, map.findByKey1(i)->value());
+            ASSERT_EQ_D(i, i, map.findByKey2(uris[i])->value());
+        }
+        bsls::Types::Int64 end = bsls::TimeUtil::getTimer();
+        cout << "Time diff (TwoKeyFlatHashMap): " << end - begin << endl;
+    }
+
+    {
+        typedef mwcc::TwoKeyHashMap<int, bsl::string, int> MyMapType;
+
+        MyMapType map(s_allocator_p);
+        for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+            map.insert(i, uris[i], i);
+        }
+
+        bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+        for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+            ASSERT_EQ_D(i, i, map.findByKey1(i)->value());
+            ASSERT_EQ_D(i, i, map.findByKey2(uris[i])->value());
+        }
+        bsls::Types::Int64 end = bsls::TimeUtil::getTimer();
+        cout << "Time diff (TwoKeyHashMap)    : " << end - begin << endl;
+    }
+}
+
+// Begin benchmarking library tests (Linux only)
+#ifdef BSLS_PLATFORM_OS_LINUX
+
+/// Look up each of `state.range(0)` elements by both of its keys in a map
+/// of the specified `MAP` type.
+template <class MAP>
+static void find_GoogleBenchmark(benchmark::State& state)
+{
+    const int numElements = static_cast<int>(state.range(0));
+
+    bsl::vector<bsl::string> uris(s_allocator_p);
+    uris.reserve(numElements);
+    for (int i = 0; i < numElements; ++i) {
+        uris.push_back(uriOf(i));
+    }
+
+    MAP map(s_allocator_p);
+    for (int i = 0; i < numElements; ++i) {
+        map.insert(i, uris[i], i);
+    }
+
+    for (auto _ : state) {
+        for (int i = 0; i < numElements; ++i) {
+            benchmark::DoNotOptimize(map.findByKey1(i)->value());
+            benchmark::DoNotOptimize(map.findByKey2(uris[i])->value());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * numElements);
+}
+
+static void testN1_findPerformanceFlat_GoogleBenchmark(benchmark::State& state)
+{
+    find_GoogleBenchmark<mwcc::TwoKeyFlatHashMap<int, bsl::string, int> >(
+        state);
+}
+
+static void
+testN1_findPerformanceNodes_GoogleBenchmark(benchmark::State& state)
+{
+    find_GoogleBenchmark<mwcc::TwoKeyHashMap<int, bsl::string, int> >(state);
+}
+
+#endif  // BSLS_PLATFORM_OS_LINUX
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    // One time initialization
+    bsls::TimeUtil::initialize();
+
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 6: test6_copyAndAssignment(); break;
+    case 5: test5_clear(); break;
+    case 4: test4_eraseWhileIterating(); break;
+    case 3: test3_erase(); break;
+    case 2: test2_insert(); break;
+    case 1: test1_breathingTest(); break;
+    case -1:
+#ifdef BSLS_PLATFORM_OS_LINUX
+        BENCHMARK(testN1_findPerformanceFlat_GoogleBenchmark)
+            ->RangeMultiplier(10)
+            ->Range(10, 1000000)
+            ->Unit(benchmark::kMillisecond);
+        BENCHMARK(testN1_findPerformanceNodes_GoogleBenchmark)
+            ->RangeMultiplier(10)
+            ->Range(10, 1000000)
+            ->Unit(benchmark::kMillisecond);
+#else
+        testN1_findPerformance();
+#endif
+        break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+#ifdef BSLS_PLATFORM_OS_LINUX
+    if (_testCase < 0) {
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+    }
+#endif
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
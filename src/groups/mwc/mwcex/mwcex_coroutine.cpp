@@ -0,0 +1,77 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcex_coroutine.cpp                                                -*-C++-*-
+#include <mwcex_coroutine.h>
+
+#include <mwcscm_version.h>
+
+#ifdef MWCEX_COROUTINE_SUPPORTED
+
+// BDE
+#include <bsl_cstring.h>
+#include <bsls_assert.h>
+#include <bsls_alignmentutil.h>
+
+namespace BloombergLP {
+namespace mwcex {
+
+namespace {
+
+/// Return the offset, from the beginning of a coroutine frame block of
+/// memory, at which the allocator pointer is stored for a frame of the
+/// specified `size` bytes.
+bsl::size_t allocatorOffset(bsl::size_t size)
+{
+    return bsls::AlignmentUtil::roundUpToMaximalAlignment(size);
+}
+
+}  // close unnamed namespace
+
+// -------------------------------
+// struct Coroutine_FrameAllocator
+// -------------------------------
+
+// CLASS METHODS
+void* Coroutine_FrameAllocator::allocate(bsl::size_t       size,
+                                         bslma::Allocator* allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(allocator);
+
+    const bsl::size_t offset = allocatorOffset(size);
+    char*             frame  = static_cast<char*>(
+        allocator->allocate(offset + sizeof(bslma::Allocator*)));
+
+    bsl::memcpy(frame + offset, &allocator, sizeof(bslma::Allocator*));
+    return frame;
+}
+
+void Coroutine_FrameAllocator::deallocate(void*       frame,
+                                          bsl::size_t size)
+    BSLS_KEYWORD_NOEXCEPT
+{
+    bslma::Allocator* allocator = 0;
+    bsl::memcpy(&allocator,
+                static_cast<char*>(frame) + allocatorOffset(size),
+                sizeof(bslma::Allocator*));
+
+    allocator->deallocate(frame);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif  // MWCEX_COROUTINE_SUPPORTED
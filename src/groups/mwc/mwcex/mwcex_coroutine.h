@@ -0,0 +1,840 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcex_coroutine.h                                                  -*-C++-*-
+#ifndef INCLUDED_MWCEX_COROUTINE
+#define INCLUDED_MWCEX_COROUTINE
+
+//@PURPOSE: Provides C++20 coroutine support for futures and executors.
+//
+//@CLASSES:
+//  mwcex::FutureAwaiter:         an awaiter for 'mwcex::Future'
+//  mwcex::FutureExecutorAwaiter: an awaiter for 'mwcex::Future' + executor
+//  mwcex::ExecutorAwaiter:       an awaiter resuming on an executor
+//
+//@MACROS:
+//  MWCEX_COROUTINE_SUPPORTED: defined if coroutines are supported
+//
+//@SEE ALSO:
+//  mwcex_future, mwcex_promise, mwcex_executionutil
+//
+//@DESCRIPTION:
+// This component provides the building blocks allowing 'mwcex::Future' objects
+// and executors to be used from C++20 coroutines:
+//: o 'mwcex::FutureAwaiter', the awaiter obtained by applying 'co_await' to a
+//:   'mwcex::Future'.  The awaiting coroutine is resumed from the thread
+//:   making the future ready (or, if the future is already ready, is not
+//:   suspended at all), and the result of the 'co_await' expression is the
+//:   result of 'mwcex::Future::get'.
+//:
+//: o 'mwcex::FutureExecutorAwaiter', an awaiter that behaves like
+//:   'mwcex::FutureAwaiter', but resumes the awaiting coroutine on a specified
+//:   executor.
+//:
+//: o 'mwcex::ExecutorAwaiter', an awaiter that suspends the awaiting coroutine
+//:   and resumes it on a specified executor.
+//
+// In addition, 'mwcex::Future<R>' may be used as the return type of a
+// coroutine.  Such a coroutine starts executing immediately when called, and
+// the returned future is made ready with the value of its 'co_return'
+// statement, or with the exception escaping its body.
+//
+// Objects of the two executor-related awaiter types are normally obtained
+// from 'mwcex::ExecutionUtil::resumeOn' (see 'mwcex_executionutil').
+//
+/// Memory allocation
+///-----------------
+// The frame of a coroutine returning 'mwcex::Future', as well as the shared
+// state of the returned future, are allocated from the default allocator,
+// unless the leading parameters of the coroutine (following the implicit
+// object parameter, for member functions) are 'bsl::allocator_arg' and a
+// 'bslma::Allocator *', in which case that allocator is used.
+//..
+//  mwcex::Future<int> myCoroutine(bsl::allocator_arg_t,
+//                                 bslma::Allocator     *allocator,
+//                                 int                   value);
+//..
+//
+// Note that a coroutine suspended on a future that is never made ready is
+// never resumed, and its frame is never destroyed.  As the promise associated
+// with a future is broken on destruction (see 'mwcex::PromiseBroken'), this
+// only happens if the result provider itself is never destroyed.
+//
+// Coroutines require C++20.  The 'MWCEX_COROUTINE_SUPPORTED' macro is defined
+// by this component if, and only if, the compiler supports coroutines.
+// Otherwise, this component provides nothing.
+//
+/// Thread safety
+///-------------
+// Awaiting a future attaches a notification callback to its shared state (see
+// 'mwcex::Future::whenReady').  Therefore, the behavior is undefined if a
+// callback is already attached to the shared state of an awaited future, or
+// if the same shared state is awaited more than once.
+//
+/// Usage
+///-----
+// Lets suppose we have a multi-step asynchronous flow, where each step is an
+// operation returning an 'mwcex::Future<int>' holding a status code, 0 on
+// success.
+//..
+//  mwcex::Future<int> openAsync();
+//  mwcex::Future<int> configureAsync();
+//..
+// Instead of chaining callbacks, we can write the flow as a coroutine, and
+// choose on which executor each step is continued.
+//..
+//  mwcex::Future<int> openAndConfigure(
+//                         const mwcex::Strand<mwcex::SystemExecutor>& strand)
+//  {
+//      // wait for the first operation to complete, and continue on the strand
+//      int rc = co_await mwcex::ExecutionUtil::resumeOn(strand.executor(),
+//                                                       openAsync());
+//      if (rc != 0) {
+//          co_return rc;                                             // RETURN
+//      }
+//
+//      // wait for the second operation to complete, and continue from
+//      // whichever thread it completed on
+//      rc = co_await configureAsync();
+//
+//      // get back to the strand
+//      co_await mwcex::ExecutionUtil::resumeOn(strand.executor());
+//
+//      co_return rc;
+//  }
+//..
+
+// MWC
+#include <mwcex_executortraits.h>
+#include <mwcex_future.h>
+#include <mwcex_promise.h>
+
+// BDE
+#include <bsls_annotation.h>
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+
+#if BSLS_COMPILERFEATURES_CPLUSPLUS >= 202002L &&                             \
+    defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+#define MWCEX_COROUTINE_SUPPORTED 1
+#endif
+
+#ifdef MWCEX_COROUTINE_SUPPORTED
+
+#include <bsl_cstddef.h>
+#include <bsl_exception.h>
+#include <bsl_memory.h>  // bsl::allocator_arg_t
+#include <bsl_utility.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+
+#include <coroutine>
+
+namespace BloombergLP {
+
+namespace mwcex {
+
+// =======================
+// class Coroutine_Resumer
+// =======================
+
+/// Provides a function object resuming a suspended coroutine.
+class Coroutine_Resumer {
+  private:
+    // PRIVATE DATA
+
+    // Handle to the coroutine to be resumed.
+    std::coroutine_handle<> d_handle;
+
+  public:
+    // TYPES
+
+    /// Defines the result type of the call operator.
+    typedef void ResultType;
+
+  public:
+    // CREATORS
+
+    /// Create a `Coroutine_Resumer` object resuming the coroutine having
+    /// the specified `handle`.
+    explicit Coroutine_Resumer(std::coroutine_handle<> handle)
+        BSLS_KEYWORD_NOEXCEPT;
+
+  public:
+    // ACCESSORS
+
+    /// Resume the coroutine.
+    void operator()() const;
+
+    /// Resume the coroutine. Ignore the specified `result` argument.
+    template <class FUTURE_RESULT>
+    void operator()(const FUTURE_RESULT& result) const;
+};
+
+// ===============================
+// class Coroutine_ExecutorResumer
+// ===============================
+
+/// Provides a function object resuming a suspended coroutine on an
+/// executor.
+template <class EXECUTOR>
+class Coroutine_ExecutorResumer {
+  private:
+    // PRIVATE DATA
+
+    // Executor used to resume the coroutine.
+    EXECUTOR d_executor;
+
+    // Handle to the coroutine to be resumed.
+    std::coroutine_handle<> d_handle;
+
+  public:
+    // TYPES
+
+    /// Defines the result type of the call operator.
+    typedef void ResultType;
+
+  public:
+    // CREATORS
+
+    /// Create a `Coroutine_ExecutorResumer` object resuming the coroutine
+    /// having the specified `handle` on the specified `executor`.
+    Coroutine_ExecutorResumer(const EXECUTOR&         executor,
+                              std::coroutine_handle<> handle);
+
+  public:
+    // ACCESSORS
+
+    /// Submit the resumption of the coroutine to the executor, as if by
+    /// 'ExecutorTraits<EXECUTOR>::post(executor, f)', where `f` is a
+    /// function object resuming the coroutine. Ignore the specified
+    /// `result` argument.
+    template <class FUTURE_RESULT>
+    void operator()(const FUTURE_RESULT& result) const;
+};
+
+// ===================
+// class FutureAwaiter
+// ===================
+
+/// Provides an awaiter for `Future<R>`, resuming the awaiting coroutine
+/// from the thread making the future ready.
+template <class R>
+class FutureAwaiter {
+  protected:
+    // PROTECTED DATA
+
+    // Awaited future.
+    Future<R> d_future;
+
+  public:
+    // CREATORS
+
+    /// Create a `FutureAwaiter` object awaiting the specified `future`.
+    /// The behavior is undefined unless the future has a shared state.
+    explicit FutureAwaiter(const Future<R>& future);
+
+  public:
+    // MANIPULATORS
+
+    /// Attach a callback to the awaited future resuming the coroutine
+    /// having the specified `handle`. Throw any exception thrown by
+    /// `Future::whenReady`.
+    void await_suspend(std::coroutine_handle<> handle);
+
+    /// Return the result of `Future::get` on the awaited future, or throw
+    /// the exception stored in it.
+    decltype(auto) await_resume();
+
+  public:
+    // ACCESSORS
+
+    /// Return `true` if the awaited future is ready, and `false` otherwise.
+    bool await_ready() const BSLS_KEYWORD_NOEXCEPT;
+};
+
+// ===========================
+// class FutureExecutorAwaiter
+// ===========================
+
+/// Provides an awaiter for `Future<R>`, resuming the awaiting coroutine on
+/// an executor of type `EXECUTOR` once the future is ready.
+///
+/// `EXECUTOR` must meet the requirements of Executor (see package
+/// documentation).
+template <class R, class EXECUTOR>
+class FutureExecutorAwaiter : public FutureAwaiter<R> {
+  private:
+    // PRIVATE DATA
+
+    // Executor used to resume the coroutine.
+    EXECUTOR d_executor;
+
+  public:
+    // CREATORS
+
+    /// Create a `FutureExecutorAwaiter` object awaiting the specified
+    /// `future` and resuming on the specified `executor`. The behavior is
+    /// undefined unless the future has a shared state.
+    FutureExecutorAwaiter(const EXECUTOR& executor, const Future<R>& future);
+
+  public:
+    // MANIPULATORS
+
+    /// Attach a callback to the awaited future submitting the resumption
+    /// of the coroutine having the specified `handle` to the executor.
+    /// Throw any exception thrown by `Future::whenReady`.
+    ///
+    /// Note that the resumption is submitted from the thread making the
+    /// future ready, and that any exception thrown by the executor is
+    /// propagated to that thread.
+    void await_suspend(std::coroutine_handle<> handle);
+
+  public:
+    // ACCESSORS
+
+    /// Return `false`, so that the coroutine is always resumed on the
+    /// executor, even if the awaited future is already ready.
+    bool await_ready() const BSLS_KEYWORD_NOEXCEPT;
+};
+
+// =====================
+// class ExecutorAwaiter
+// =====================
+
+/// Provides an awaiter that suspends the awaiting coroutine and resumes it
+/// on an executor of type `EXECUTOR`.
+///
+/// `EXECUTOR` must meet the requirements of Executor (see package
+/// documentation).
+template <class EXECUTOR>
+class ExecutorAwaiter {
+  private:
+    // PRIVATE DATA
+
+    // Executor used to resume the coroutine.
+    EXECUTOR d_executor;
+
+  public:
+    // CREATORS
+
+    /// Create a `ExecutorAwaiter` object resuming on the specified
+    /// `executor`.
+    explicit ExecutorAwaiter(const EXECUTOR& executor);
+
+  public:
+    // ACCESSORS
+
+    /// Return `false`.
+    bool await_ready() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Submit the resumption of the coroutine having the specified
+    /// `handle` to the executor, as if by 'ExecutorTraits<EXECUTOR>::post(
+    /// executor, f)', where `f` is a function object resuming the
+    /// coroutine. Throw any exception thrown by the executor, in which
+    /// case the coroutine is resumed immediately and the exception is
+    /// rethrown from the `co_await` expression.
+    void await_suspend(std::coroutine_handle<> handle) const;
+
+    /// Do nothing.
+    void await_resume() const BSLS_KEYWORD_NOEXCEPT;
+};
+
+// ===============================
+// struct Coroutine_FrameAllocator
+// ===============================
+
+/// Provides a namespace for functions allocating coroutine frames from a
+/// `bslma::Allocator`.
+struct Coroutine_FrameAllocator {
+    // CLASS METHODS
+
+    /// Return a block of memory of at least the specified `size` bytes,
+    /// allocated from the specified `allocator`, and remember the
+    /// allocator for `deallocate`.
+    static void* allocate(bsl::size_t size, bslma::Allocator* allocator);
+
+    /// Return the specified `frame` block of memory of the specified
+    /// `size` bytes to the allocator it has been allocated from. The
+    /// behavior is undefined unless `frame` has been obtained from
+    /// `allocate` with the same `size`.
+    static void deallocate(void* frame, bsl::size_t size)
+        BSLS_KEYWORD_NOEXCEPT;
+};
+
+// =================================
+// class Coroutine_FuturePromiseBase
+// =================================
+
+/// Provides the part of the coroutine promise type common to all
+/// coroutines returning `Future<R>`.
+template <class R>
+class Coroutine_FuturePromiseBase {
+  protected:
+    // PROTECTED DATA
+
+    // Promise used to make the returned future ready.
+    Promise<R> d_promise;
+
+  public:
+    // CLASS METHODS
+
+    /// Return a block of memory of the specified `size` bytes, allocated
+    /// from the default allocator, to hold a coroutine frame.
+    static void* operator new(bsl::size_t size);
+
+    /// Return a block of memory of the specified `size` bytes, allocated
+    /// from the specified `allocator`, to hold the frame of a coroutine
+    /// whose leading parameters are `bsl::allocator_arg` and `allocator`.
+    template <class... ARGS>
+    static void* operator new(bsl::size_t               size,
+                              const bsl::allocator_arg_t&,
+                              bslma::Allocator* allocator,
+                              ARGS&...);
+
+    /// Return a block of memory of the specified `size` bytes, allocated
+    /// from the specified `allocator`, to hold the frame of a coroutine
+    /// member function whose leading parameters are `bsl::allocator_arg`
+    /// and `allocator`.
+    template <class OBJECT, class... ARGS>
+    static void* operator new(bsl::size_t size,
+                              OBJECT&,
+                              const bsl::allocator_arg_t&,
+                              bslma::Allocator* allocator,
+                              ARGS&...);
+
+    /// Return the specified `frame` block of memory of the specified
+    /// `size` bytes to the allocator it has been allocated from.
+    static void operator delete(void* frame, bsl::size_t size);
+
+  public:
+    // CREATORS
+
+    /// Create a `Coroutine_FuturePromiseBase` object using the default
+    /// allocator to supply memory.
+    Coroutine_FuturePromiseBase();
+
+    /// Create a `Coroutine_FuturePromiseBase` object for a coroutine whose
+    /// leading parameters are `bsl::allocator_arg` and the specified
+    /// `allocator` used to supply memory.
+    template <class... ARGS>
+    Coroutine_FuturePromiseBase(const bsl::allocator_arg_t&,
+                                bslma::Allocator* allocator,
+                                ARGS&...);
+
+    /// Create a `Coroutine_FuturePromiseBase` object for a coroutine
+    /// member function whose leading parameters are `bsl::allocator_arg`
+    /// and the specified `allocator` used to supply memory.
+    template <class OBJECT, class... ARGS>
+    Coroutine_FuturePromiseBase(OBJECT&,
+                                const bsl::allocator_arg_t&,
+                                bslma::Allocator* allocator,
+                                ARGS&...);
+
+  public:
+    // MANIPULATORS
+
+    /// Return a future associated with the promise.
+    Future<R> get_return_object() BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return an awaitable object that does not suspend the coroutine, so
+    /// that the coroutine starts executing immediately.
+    std::suspend_never initial_suspend() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return an awaitable object that does not suspend the coroutine, so
+    /// that the coroutine frame is destroyed upon completion.
+    std::suspend_never final_suspend() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Store the exception currently being handled into the promise.
+    void unhandled_exception();
+};
+
+// =============================
+// class Coroutine_FuturePromise
+// =============================
+
+/// Provides the promise type of a coroutine returning `Future<R>`.
+template <class R>
+class Coroutine_FuturePromise : public Coroutine_FuturePromiseBase<R> {
+  public:
+    // CREATORS
+    using Coroutine_FuturePromiseBase<R>::Coroutine_FuturePromiseBase;
+
+  public:
+    // MANIPULATORS
+
+    /// Store the specified `value` into the promise.
+    template <class VALUE = R>
+    void return_value(VALUE&& value);
+};
+
+/// Provides a specialization of `Coroutine_FuturePromise` for `void`
+/// result type.
+template <>
+class Coroutine_FuturePromise<void>
+: public Coroutine_FuturePromiseBase<void> {
+  public:
+    // CREATORS
+    using Coroutine_FuturePromiseBase<void>::Coroutine_FuturePromiseBase;
+
+  public:
+    // MANIPULATORS
+
+    /// Make the promise ready.
+    void return_void();
+};
+
+/// Provides a specialization of `Coroutine_FuturePromise` for reference
+/// result types.
+template <class R>
+class Coroutine_FuturePromise<R&> : public Coroutine_FuturePromiseBase<R&> {
+  public:
+    // CREATORS
+    using Coroutine_FuturePromiseBase<R&>::Coroutine_FuturePromiseBase;
+
+  public:
+    // MANIPULATORS
+
+    /// Store the specified `value` reference into the promise.
+    void return_value(R& value);
+};
+
+// FREE OPERATORS
+
+/// Return an awaiter for the specified `future`. The behavior is undefined
+/// unless the future has a shared state.
+template <class R>
+FutureAwaiter<R> operator co_await(const Future<R>& future);
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+// -----------------------
+// class Coroutine_Resumer
+// -----------------------
+
+// CREATORS
+inline Coroutine_Resumer::Coroutine_Resumer(std::coroutine_handle<> handle)
+    BSLS_KEYWORD_NOEXCEPT : d_handle(handle)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(handle);
+}
+
+// ACCESSORS
+inline void Coroutine_Resumer::operator()() const
+{
+    d_handle.resume();
+}
+
+template <class FUTURE_RESULT>
+inline void Coroutine_Resumer::operator()(
+    BSLS_ANNOTATION_UNUSED const FUTURE_RESULT& result) const
+{
+    d_handle.resume();
+}
+
+// -------------------------------
+// class Coroutine_ExecutorResumer
+// -------------------------------
+
+// CREATORS
+template <class EXECUTOR>
+inline Coroutine_ExecutorResumer<EXECUTOR>::Coroutine_ExecutorResumer(
+    const EXECUTOR&         executor,
+    std::coroutine_handle<> handle)
+: d_executor(executor)
+, d_handle(handle)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(handle);
+}
+
+// ACCESSORS
+template <class EXECUTOR>
+template <class FUTURE_RESULT>
+inline void Coroutine_ExecutorResumer<EXECUTOR>::operator()(
+    BSLS_ANNOTATION_UNUSED const FUTURE_RESULT& result) const
+{
+    ExecutorTraits<EXECUTOR>::post(d_executor, Coroutine_Resumer(d_handle));
+}
+
+// -------------------
+// class FutureAwaiter
+// -------------------
+
+// CREATORS
+template <class R>
+inline FutureAwaiter<R>::FutureAwaiter(const Future<R>& future)
+: d_future(future)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(future.isValid());
+}
+
+// MANIPULATORS
+template <class R>
+inline void FutureAwaiter<R>::await_suspend(std::coroutine_handle<> handle)
+{
+    // NOTE: If the future is already ready, the coroutine is resumed from
+    //       within 'whenReady' and may complete, destroying '*this', before
+    //       'whenReady' returns. Use a local copy of the future to keep the
+    //       shared state alive till then.
+    Future<R> future(d_future);
+    future.whenReady(Coroutine_Resumer(handle));
+}
+
+template <class R>
+inline decltype(auto) FutureAwaiter<R>::await_resume()
+{
+    return d_future.get();
+}
+
+// ACCESSORS
+template <class R>
+inline bool FutureAwaiter<R>::await_ready() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_future.isReady();
+}
+
+// ---------------------------
+// class FutureExecutorAwaiter
+// ---------------------------
+
+// CREATORS
+template <class R, class EXECUTOR>
+inline FutureExecutorAwaiter<R, EXECUTOR>::FutureExecutorAwaiter(
+    const EXECUTOR&  executor,
+    const Future<R>& future)
+: FutureAwaiter<R>(future)
+, d_executor(executor)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+template <class R, class EXECUTOR>
+inline void
+FutureExecutorAwaiter<R, EXECUTOR>::await_suspend(
+    std::coroutine_handle<> handle)
+{
+    // NOTE: See 'FutureAwaiter::await_suspend'.
+    Future<R> future(this->d_future);
+    future.whenReady(Coroutine_ExecutorResumer<EXECUTOR>(d_executor, handle));
+}
+
+// ACCESSORS
+template <class R, class EXECUTOR>
+inline bool FutureExecutorAwaiter<R, EXECUTOR>::await_ready() const
+    BSLS_KEYWORD_NOEXCEPT
+{
+    return false;
+}
+
+// ---------------------
+// class ExecutorAwaiter
+// ---------------------
+
+// CREATORS
+template <class EXECUTOR>
+inline ExecutorAwaiter<EXECUTOR>::ExecutorAwaiter(const EXECUTOR& executor)
+: d_executor(executor)
+{
+    // NOTHING
+}
+
+// ACCESSORS
+template <class EXECUTOR>
+inline bool ExecutorAwaiter<EXECUTOR>::await_ready() const
+    BSLS_KEYWORD_NOEXCEPT
+{
+    return false;
+}
+
+template <class EXECUTOR>
+inline void
+ExecutorAwaiter<EXECUTOR>::await_suspend(std::coroutine_handle<> handle) const
+{
+    ExecutorTraits<EXECUTOR>::post(d_executor, Coroutine_Resumer(handle));
+}
+
+template <class EXECUTOR>
+inline void ExecutorAwaiter<EXECUTOR>::await_resume() const
+    BSLS_KEYWORD_NOEXCEPT
+{
+    // NOTHING
+}
+
+// ---------------------------------
+// class Coroutine_FuturePromiseBase
+// ---------------------------------
+
+// CLASS METHODS
+template <class R>
+inline void* Coroutine_FuturePromiseBase<R>::operator new(bsl::size_t size)
+{
+    return Coroutine_FrameAllocator::allocate(size,
+                                              bslma::Default::allocator());
+}
+
+template <class R>
+template <class... ARGS>
+inline void* Coroutine_FuturePromiseBase<R>::operator new(
+    bsl::size_t size,
+    const bsl::allocator_arg_t&,
+    bslma::Allocator* allocator,
+    ARGS&...)
+{
+    return Coroutine_FrameAllocator::allocate(
+        size,
+        bslma::Default::allocator(allocator));
+}
+
+template <class R>
+template <class OBJECT, class... ARGS>
+inline void* Coroutine_FuturePromiseBase<R>::operator new(
+    bsl::size_t size,
+    OBJECT&,
+    const bsl::allocator_arg_t&,
+    bslma::Allocator* allocator,
+    ARGS&...)
+{
+    return Coroutine_FrameAllocator::allocate(
+        size,
+        bslma::Default::allocator(allocator));
+}
+
+template <class R>
+inline void Coroutine_FuturePromiseBase<R>::operator delete(void*       frame,
+                                                            bsl::size_t size)
+{
+    Coroutine_FrameAllocator::deallocate(frame, size);
+}
+
+// CREATORS
+template <class R>
+inline Coroutine_FuturePromiseBase<R>::Coroutine_FuturePromiseBase()
+: d_promise()
+{
+    // NOTHING
+}
+
+template <class R>
+template <class... ARGS>
+inline Coroutine_FuturePromiseBase<R>::Coroutine_FuturePromiseBase(
+    const bsl::allocator_arg_t&,
+    bslma::Allocator* allocator,
+    ARGS&...)
+: d_promise(allocator)
+{
+    // NOTHING
+}
+
+template <class R>
+template <class OBJECT, class... ARGS>
+inline Coroutine_FuturePromiseBase<R>::Coroutine_FuturePromiseBase(
+    OBJECT&,
+    const bsl::allocator_arg_t&,
+    bslma::Allocator* allocator,
+    ARGS&...)
+: d_promise(allocator)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+template <class R>
+inline Future<R>
+Coroutine_FuturePromiseBase<R>::get_return_object() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_promise.future();
+}
+
+template <class R>
+inline std::suspend_never
+Coroutine_FuturePromiseBase<R>::initial_suspend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return std::suspend_never();
+}
+
+template <class R>
+inline std::suspend_never
+Coroutine_FuturePromiseBase<R>::final_suspend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return std::suspend_never();
+}
+
+template <class R>
+inline void Coroutine_FuturePromiseBase<R>::unhandled_exception()
+{
+    d_promise.setException(bsl::current_exception());
+}
+
+// -----------------------------
+// class Coroutine_FuturePromise
+// -----------------------------
+
+// MANIPULATORS
+template <class R>
+template <class VALUE>
+inline void Coroutine_FuturePromise<R>::return_value(VALUE&& value)
+{
+    this->d_promise.emplaceValue(bsl::forward<VALUE>(value));
+}
+
+inline void Coroutine_FuturePromise<void>::return_void()
+{
+    d_promise.setValue();
+}
+
+template <class R>
+inline void Coroutine_FuturePromise<R&>::return_value(R& value)
+{
+    this->d_promise.setValue(value);
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class R>
+inline mwcex::FutureAwaiter<R>
+mwcex::operator co_await(const Future<R>& future)
+{
+    return FutureAwaiter<R>(future);
+}
+
+}  // close enterprise namespace
+
+// ============================================================================
+//                           STANDARD SPECIALIZATIONS
+// ============================================================================
+
+namespace std {
+
+/// Specialize `std::coroutine_traits` so that `mwcex::Future<R>` may be used
+/// as the return type of a coroutine.
+template <class R, class... ARGS>
+struct coroutine_traits<BloombergLP::mwcex::Future<R>, ARGS...> {
+    // TYPES
+    typedef BloombergLP::mwcex::Coroutine_FuturePromise<R> promise_type;
+};
+
+}  // close namespace std
+
+#endif  // MWCEX_COROUTINE_SUPPORTED
+
+#endif
@@ -0,0 +1,602 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcex_coroutine.t.cpp                                              -*-C++-*-
+#include <mwcex_coroutine.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// MWC
+#include <mwcex_future.h>
+#include <mwcex_promise.h>
+
+// BDE
+#include <bsl_functional.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+#include <bslma_testallocator.h>
+#include <bsls_assert.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+
+#ifdef MWCEX_COROUTINE_SUPPORTED
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+// ===================
+// class QueueExecutor
+// ===================
+
+/// Provides an executor storing submitted function objects into a queue,
+/// to be executed on demand.
+class QueueExecutor {
+  public:
+    // TYPES
+
+    /// Defines the type of the queue.
+    typedef bsl::vector<bsl::function<void()> > Queue;
+
+  private:
+    // PRIVATE DATA
+    Queue* d_queue_p;
+
+  public:
+    // CREATORS
+    explicit QueueExecutor(Queue* queue)
+    : d_queue_p(queue)
+    {
+        // PRECONDITIONS
+        BSLS_ASSERT(queue);
+    }
+
+  public:
+    // MANIPULATORS
+
+    /// Push the specified function object `f` to the queue.
+    template <class FUNCTION>
+    void post(const FUNCTION& f) const
+    {
+        d_queue_p->push_back(f);
+    }
+
+    /// Not implemented.
+    template <class FUNCTION>
+    void dispatch(const FUNCTION& f) const;
+
+  public:
+    // ACCESSORS
+    bool operator==(const QueueExecutor& rhs) const
+    {
+        return d_queue_p == rhs.d_queue_p;
+    }
+};
+
+/// Execute all function objects in the specified `queue`, including the
+/// ones submitted during the execution, and return the number of executed
+/// function objects.
+int drain(QueueExecutor::Queue* queue)
+{
+    int count = 0;
+    while (!queue->empty()) {
+        bsl::function<void()> f(bsl::allocator_arg,
+                                queue->get_allocator(),
+                                queue->front());
+        queue->erase(queue->begin());
+
+        f();
+        ++count;
+    }
+
+    return count;
+}
+
+/// Provides a type thrown as an exception by coroutines.
+struct TestException {};
+
+/// Return the specified `value`.
+mwcex::Future<int> returnValue(bsl::allocator_arg_t,
+                               bslma::Allocator*,
+                               int value)
+{
+    co_return value;
+}
+
+/// Set the specified `flag` to `true`.
+mwcex::Future<void>
+returnVoid(bsl::allocator_arg_t, bslma::Allocator*, bool* flag)
+{
+    *flag = true;
+    co_return;
+}
+
+/// Return a reference to the specified `value`.
+mwcex::Future<int&> returnReference(bsl::allocator_arg_t,
+                                    bslma::Allocator*,
+                                    int* value)
+{
+    co_return *value;
+}
+
+/// Throw an instance of `TestException`.
+mwcex::Future<int> throwException(bsl::allocator_arg_t, bslma::Allocator*)
+{
+    throw TestException();
+    co_return 0;
+}
+
+/// Await the specified `future`, and return the awaited value plus one.
+/// Set the specified `resumed` flag to `true` when resumed.
+mwcex::Future<int> awaitFuture(bsl::allocator_arg_t,
+                               bslma::Allocator*,
+                               mwcex::Future<int> future,
+                               bool*              resumed)
+{
+    int value = co_await future;
+    *resumed  = true;
+    co_return value + 1;
+}
+
+/// Await the specified `future` of type `Future<void>`.
+mwcex::Future<void> awaitVoidFuture(bsl::allocator_arg_t,
+                                    bslma::Allocator*,
+                                    mwcex::Future<void> future)
+{
+    co_await future;
+}
+
+/// Await the specified `future` of type `Future<int&>`, and return the
+/// address of the referenced object.
+mwcex::Future<int*> awaitReferenceFuture(bsl::allocator_arg_t,
+                                         bslma::Allocator*,
+                                         mwcex::Future<int&> future)
+{
+    int& value = co_await future;
+    co_return &value;
+}
+
+/// Suspend and resume on the specified `executor`, and return the number
+/// of function objects submitted to the executor before the resumption.
+mwcex::Future<int> awaitExecutor(bsl::allocator_arg_t,
+                                 bslma::Allocator*,
+                                 QueueExecutor::Queue* queue)
+{
+    co_await mwcex::ExecutorAwaiter<QueueExecutor>(QueueExecutor(queue));
+    co_return static_cast<int>(queue->size());
+}
+
+/// Await the specified `future` and resume on the executor associated with
+/// the specified `queue`, and return the awaited value.
+mwcex::Future<int> awaitFutureOnExecutor(bsl::allocator_arg_t,
+                                         bslma::Allocator*,
+                                         QueueExecutor::Queue* queue,
+                                         mwcex::Future<int>    future)
+{
+    int value = co_await mwcex::FutureExecutorAwaiter<int, QueueExecutor>(
+        QueueExecutor(queue),
+        future);
+    co_return value;
+}
+
+}  // close unnamed namespace
+
+#endif  // MWCEX_COROUTINE_SUPPORTED
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_coroutine_returnFuture()
+// ------------------------------------------------------------------------
+// COROUTINE RETURN FUTURE
+//
+// Concerns:
+//   Ensure proper behavior of coroutines returning 'mwcex::Future'.
+//
+// Plan:
+//   1. Call a coroutine returning a 'Future<int>'. Check that the returned
+//      future is ready and contains the returned value.
+//
+//   2. Call a coroutine returning a 'Future<void>'. Check that the
+//      coroutine was executed and the returned future is ready.
+//
+//   3. Call a coroutine returning a 'Future<int&>'. Check that the
+//      returned future is ready and refers to the returned object.
+//
+//   4. Call a coroutine throwing an exception. Check that the returned
+//      future is ready and contains the thrown exception.
+//
+//   5. Check that the memory is supplied by the specified allocator.
+//
+// Testing:
+//   Coroutines returning 'mwcex::Future'
+// ------------------------------------------------------------------------
+{
+#ifdef MWCEX_COROUTINE_SUPPORTED
+    bslma::TestAllocator alloc;
+
+    // 1. return a value
+    {
+        mwcex::Future<int> future = returnValue(bsl::allocator_arg,
+                                                &alloc,
+                                                42);
+        ASSERT(future.isReady());
+        ASSERT_EQ(future.get(), 42);
+    }
+
+    // 2. return void
+    {
+        bool                executed = false;
+        mwcex::Future<void> future   = returnVoid(bsl::allocator_arg,
+                                                &alloc,
+                                                &executed);
+        ASSERT(executed);
+        ASSERT(future.isReady());
+    }
+
+    // 3. return a reference
+    {
+        int                 value  = 42;
+        mwcex::Future<int&> future = returnReference(bsl::allocator_arg,
+                                                     &alloc,
+                                                     &value);
+        ASSERT(future.isReady());
+        ASSERT_EQ(&future.get(), &value);
+    }
+
+    // 4. throw an exception
+    {
+        mwcex::Future<int> future = throwException(bsl::allocator_arg,
+                                                   &alloc);
+        ASSERT(future.isReady());
+
+        bool exceptionThrown = false;
+        try {
+            future.get();
+        }
+        catch (const TestException&) {
+            exceptionThrown = true;
+        }
+        ASSERT(exceptionThrown);
+    }
+
+    // 5. memory is supplied by the specified allocator
+    ASSERT_NE(alloc.numAllocations(), 0);
+    ASSERT_EQ(alloc.numBlocksInUse(), 0);
+#endif
+}
+
+static void test2_futureAwaiter()
+// ------------------------------------------------------------------------
+// FUTURE AWAITER
+//
+// Concerns:
+//   Ensure proper behavior of awaiting an 'mwcex::Future'.
+//
+// Plan:
+//   1. Await a non-ready future. Check that the coroutine is suspended,
+//      then resumed with the value stored in the future when it is made
+//      ready.
+//
+//   2. Await a ready future. Check that the coroutine is not suspended.
+//
+//   3. Await a future of type 'Future<void>' and 'Future<int&>'.
+//
+//   4. Await a future made ready with an exception. Check that the
+//      exception is propagated to the awaiting coroutine.
+//
+//   5. Await a future which promise is broken. Check that the
+//      'mwcex::PromiseBroken' exception is propagated to the awaiting
+//      coroutine.
+//
+// Testing:
+//   mwcex::FutureAwaiter
+//   operator co_await(const mwcex::Future<R>&)
+// ------------------------------------------------------------------------
+{
+#ifdef MWCEX_COROUTINE_SUPPORTED
+    bslma::TestAllocator alloc;
+
+    // 1. await a non-ready future
+    {
+        mwcex::Promise<int> promise(&alloc);
+        bool                resumed = false;
+
+        mwcex::Future<int> future = awaitFuture(bsl::allocator_arg,
+                                                &alloc,
+                                                promise.future(),
+                                                &resumed);
+
+        // the coroutine is suspended
+        ASSERT(!resumed);
+        ASSERT(!future.isReady());
+
+        // make the awaited future ready
+        promise.setValue(41);
+
+        // the coroutine was resumed and completed
+        ASSERT(resumed);
+        ASSERT(future.isReady());
+        ASSERT_EQ(future.get(), 42);
+    }
+
+    // 2. await a ready future
+    {
+        mwcex::Promise<int> promise(&alloc);
+        bool                resumed = false;
+
+        promise.setValue(41);
+        mwcex::Future<int> future = awaitFuture(bsl::allocator_arg,
+                                                &alloc,
+                                                promise.future(),
+                                                &resumed);
+
+        ASSERT(resumed);
+        ASSERT(future.isReady());
+        ASSERT_EQ(future.get(), 42);
+    }
+
+    // 3. await a 'Future<void>' and a 'Future<int&>'
+    {
+        mwcex::Promise<void> voidPromise(&alloc);
+        mwcex::Future<void>  voidFuture = awaitVoidFuture(bsl::allocator_arg,
+                                                         &alloc,
+                                                         voidPromise.future());
+        ASSERT(!voidFuture.isReady());
+
+        voidPromise.setValue();
+        ASSERT(voidFuture.isReady());
+
+        int                  value = 0;
+        mwcex::Promise<int&> refPromise(&alloc);
+        mwcex::Future<int*>  refFuture = awaitReferenceFuture(
+            bsl::allocator_arg,
+            &alloc,
+            refPromise.future());
+        ASSERT(!refFuture.isReady());
+
+        refPromise.setValue(value);
+        ASSERT(refFuture.isReady());
+        ASSERT_EQ(refFuture.get(), &value);
+    }
+
+    // 4. await a future made ready with an exception
+    {
+        mwcex::Promise<int> promise(&alloc);
+        bool                resumed = false;
+
+        mwcex::Future<int> future = awaitFuture(bsl::allocator_arg,
+                                                &alloc,
+                                                promise.future(),
+                                                &resumed);
+
+        promise.setException(TestException());
+
+        // the exception was propagated to the coroutine
+        ASSERT(!resumed);
+        ASSERT(future.isReady());
+
+        bool exceptionThrown = false;
+        try {
+            future.get();
+        }
+        catch (const TestException&) {
+            exceptionThrown = true;
+        }
+        ASSERT(exceptionThrown);
+    }
+
+    // 5. await a future which promise is broken
+    {
+        bool               resumed = false;
+        mwcex::Future<int> future;
+        {
+            mwcex::Promise<int> promise(&alloc);
+            future = awaitFuture(bsl::allocator_arg,
+                                 &alloc,
+                                 promise.future(),
+                                 &resumed);
+        }
+
+        ASSERT(!resumed);
+        ASSERT(future.isReady());
+
+        bool exceptionThrown = false;
+        try {
+            future.get();
+        }
+        catch (const mwcex::PromiseBroken&) {
+            exceptionThrown = true;
+        }
+        ASSERT(exceptionThrown);
+    }
+
+    ASSERT_EQ(alloc.numBlocksInUse(), 0);
+#endif
+}
+
+static void test3_executorAwaiter()
+// ------------------------------------------------------------------------
+// EXECUTOR AWAITER
+//
+// Concerns:
+//   Ensure proper behavior of the 'ExecutorAwaiter' class.
+//
+// Plan:
+//   Await an 'ExecutorAwaiter' object. Check that the coroutine is
+//   suspended, and that its resumption is submitted to the executor.
+//
+// Testing:
+//   mwcex::ExecutorAwaiter
+// ------------------------------------------------------------------------
+{
+#ifdef MWCEX_COROUTINE_SUPPORTED
+    bslma::TestAllocator alloc;
+
+    {
+        QueueExecutor::Queue queue(&alloc);
+
+        mwcex::Future<int> future = awaitExecutor(bsl::allocator_arg,
+                                                  &alloc,
+                                                  &queue);
+
+        // the coroutine is suspended and its resumption is submitted
+        ASSERT(!future.isReady());
+        ASSERT_EQ(queue.size(), 1U);
+
+        // resume the coroutine
+        ASSERT_EQ(drain(&queue), 1);
+
+        ASSERT(future.isReady());
+        ASSERT_EQ(future.get(), 0);
+    }
+
+    ASSERT_EQ(alloc.numBlocksInUse(), 0);
+#endif
+}
+
+static void test4_futureExecutorAwaiter()
+// ------------------------------------------------------------------------
+// FUTURE EXECUTOR AWAITER
+//
+// Concerns:
+//   Ensure proper behavior of the 'FutureExecutorAwaiter' class.
+//
+// Plan:
+//   1. Await a non-ready future via a 'FutureExecutorAwaiter'. Check that
+//      the resumption of the coroutine is submitted to the executor once
+//      the future is ready, and not before.
+//
+//   2. Await a ready future via a 'FutureExecutorAwaiter'. Check that the
+//      resumption of the coroutine is still submitted to the executor.
+//
+//   3. Await a future made ready with an exception via a
+//      'FutureExecutorAwaiter'. Check that the exception is propagated to
+//      the awaiting coroutine, resumed on the executor.
+//
+// Testing:
+//   mwcex::FutureExecutorAwaiter
+// ------------------------------------------------------------------------
+{
+#ifdef MWCEX_COROUTINE_SUPPORTED
+    bslma::TestAllocator alloc;
+
+    // 1. await a non-ready future
+    {
+        QueueExecutor::Queue queue(&alloc);
+        mwcex::Promise<int>  promise(&alloc);
+
+        mwcex::Future<int> future = awaitFutureOnExecutor(bsl::allocator_arg,
+                                                          &alloc,
+                                                          &queue,
+                                                          promise.future());
+
+        // the coroutine is suspended and nothing is submitted yet
+        ASSERT(!future.isReady());
+        ASSERT(queue.empty());
+
+        // make the awaited future ready
+        promise.setValue(42);
+
+        // the resumption of the coroutine is submitted
+        ASSERT(!future.isReady());
+        ASSERT_EQ(queue.size(), 1U);
+
+        // resume the coroutine
+        ASSERT_EQ(drain(&queue), 1);
+
+        ASSERT(future.isReady());
+        ASSERT_EQ(future.get(), 42);
+    }
+
+    // 2. await a ready future
+    {
+        QueueExecutor::Queue queue(&alloc);
+        mwcex::Promise<int>  promise(&alloc);
+
+        promise.setValue(42);
+        mwcex::Future<int> future = awaitFutureOnExecutor(bsl::allocator_arg,
+                                                          &alloc,
+                                                          &queue,
+                                                          promise.future());
+
+        // the resumption of the coroutine is submitted
+        ASSERT(!future.isReady());
+        ASSERT_EQ(queue.size(), 1U);
+
+        // resume the coroutine
+        ASSERT_EQ(drain(&queue), 1);
+
+        ASSERT(future.isReady());
+        ASSERT_EQ(future.get(), 42);
+    }
+
+    // 3. await a future made ready with an exception
+    {
+        QueueExecutor::Queue queue(&alloc);
+        mwcex::Promise<int>  promise(&alloc);
+
+        mwcex::Future<int> future = awaitFutureOnExecutor(bsl::allocator_arg,
+                                                          &alloc,
+                                                          &queue,
+                                                          promise.future());
+
+        promise.setException(TestException());
+        ASSERT(!future.isReady());
+
+        // resume the coroutine
+        ASSERT_EQ(drain(&queue), 1);
+        ASSERT(future.isReady());
+
+        bool exceptionThrown = false;
+        try {
+            future.get();
+        }
+        catch (const TestException&) {
+            exceptionThrown = true;
+        }
+        ASSERT(exceptionThrown);
+    }
+
+    ASSERT_EQ(alloc.numBlocksInUse(), 0);
+#endif
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 1: test1_coroutine_returnFuture(); break;
+    case 2: test2_futureAwaiter(); break;
+    case 3: test3_executorAwaiter(); break;
+    case 4: test4_futureExecutorAwaiter(); break;
+    default: {
+        bsl::cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND."
+                  << bsl::endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -60,7 +60,7 @@
 //    commonly referred as "fire and forget". For that we may use a One-Way
 //    Never Blocking execution policy.
 //..
-//  using mwcex;
+//  using namespace mwcex;
 //
 //  // initiate the execution and "forget" about it
 //  ExecutionUtil::execute(ExecutionPolicyUtil::oneWay()
@@ -71,7 +71,7 @@
 //    completion, but still want to retrieve the invocation result. Lets use a
 //    Two-Way Never Blocking execution policy.
 //..
-//  using mwcex;
+//  using namespace mwcex;
 //
 //  // initiate the execution, obtain a future
 //  Future<int> future = ExecutionUtil::execute(
@@ -113,7 +113,7 @@
 // representing the asynchronous operation after the completion of which the
 // callback is to be executed.
 //..
-//  using mwcex;
+//  using namespace mwcex;
 //
 //  // initiate an async operation, obtain an associated future
 //  Future<int> future = doAsyncStuff();
@@ -129,7 +129,7 @@
 // execution policy, the callback result is discarded. If we want to obtain the
 // callback invocation result, we have to use a Two-Way policy.
 //..
-//  using mwcex;
+//  using namespace mwcex;
 //
 //  // initiate an async operation, obtain an associated future
 //  Future<int> future1 = doAsyncStuff();
@@ -150,16 +150,39 @@
 // 'Future' object. That optimization allows to avoid unnecessary memory
 // allocations.
 //..
-//  using mwcex;
+//  using namespace mwcex;
 //
 //  // initiate the execution, wait for its completion, and get the result
 //  int result = ExecutionUtil::invoke(SystemExecutor(), myFunction);
 //
 //  BSLS_ASSERT(result == 42);
 //..
+//
+///'mwcex::ExecutionUtil::resumeOn'
+///--------------------------------
+// If coroutines are supported (see 'mwcex_coroutine'),
+// 'mwcex::ExecutionUtil::resumeOn' returns an awaitable object allowing a
+// coroutine to continue its execution on a specified executor, optionally
+// after a specified future becomes ready.
+//..
+//  using namespace mwcex;
+//
+//  Future<int> myCoroutine(const Strand<SystemExecutor>& strand)
+//  {
+//      // continue on the strand once 'doAsyncStuff' is complete
+//      int result = co_await ExecutionUtil::resumeOn(strand.executor(),
+//                                                    doAsyncStuff());
+//
+//      // continue on a new thread
+//      co_await ExecutionUtil::resumeOn(SystemExecutor());
+//
+//      co_return result;
+//  }
+//..
 
 // MWC
 
+#include <mwcex_coroutine.h>
 #include <mwcex_executionproperty.h>
 #include <mwcex_executortraits.h>
 #include <mwcex_future.h>
@@ -1262,6 +1285,38 @@ struct ExecutionUtil {
     template <class R, class EXECUTOR, class FUNCTION>
     static R invokeR(const EXECUTOR& executor,
                      BSLS_COMPILERFEATURES_FORWARD_REF(FUNCTION) f);
+
+#ifdef MWCEX_COROUTINE_SUPPORTED
+    /// Return an awaitable object that, when awaited from a coroutine,
+    /// suspends the coroutine and resumes it on the specified `executor`,
+    /// as if by 'ExecutorTraits<EXECUTOR>::post(executor, f)', where `f` is
+    /// a function object resuming the coroutine. The `co_await` expression
+    /// is of type `void`. If the executor throws, the exception is rethrown
+    /// from the `co_await` expression.
+    ///
+    /// `EXECUTOR` must meet the requirements of Executor (see package
+    /// documentation).
+    template <class EXECUTOR>
+    static ExecutorAwaiter<EXECUTOR> resumeOn(const EXECUTOR& executor);
+
+    /// Return an awaitable object that, when awaited from a coroutine,
+    /// suspends the coroutine until the specified `future` is ready, and
+    /// then resumes it on the specified `executor`, as if by
+    /// 'ExecutorTraits<EXECUTOR>::post(executor, f)', where `f` is a
+    /// function object resuming the coroutine. The result of the
+    /// `co_await` expression is the result of `future.get()`. The behavior
+    /// is undefined unless `future` has a shared state, and no callback is
+    /// attached to it.
+    ///
+    /// Note that the coroutine is resumed on the executor even if `future`
+    /// is already ready at the time it is awaited.
+    ///
+    /// `EXECUTOR` must meet the requirements of Executor (see package
+    /// documentation).
+    template <class EXECUTOR, class R>
+    static FutureExecutorAwaiter<R, EXECUTOR>
+    resumeOn(const EXECUTOR& executor, const Future<R>& future);
+#endif
 };
 
 // ============================================================================
@@ -2054,6 +2109,22 @@ inline R ExecutionUtil::invokeR(const EXECUTOR& executor,
     return task.get();
 }
 
+#ifdef MWCEX_COROUTINE_SUPPORTED
+template <class EXECUTOR>
+inline ExecutorAwaiter<EXECUTOR>
+ExecutionUtil::resumeOn(const EXECUTOR& executor)
+{
+    return ExecutorAwaiter<EXECUTOR>(executor);
+}
+
+template <class EXECUTOR, class R>
+inline FutureExecutorAwaiter<R, EXECUTOR>
+ExecutionUtil::resumeOn(const EXECUTOR& executor, const Future<R>& future)
+{
+    return FutureExecutorAwaiter<R, EXECUTOR>(executor, future);
+}
+#endif
+
 }  // close package namespace
 }  // close enterprise namespace
 
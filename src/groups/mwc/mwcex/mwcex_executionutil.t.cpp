@@ -23,6 +23,7 @@
 #include <mwcex_executionpolicy.h>
 #include <mwcex_executionproperty.h>
 #include <mwcex_future.h>
+#include <mwcex_promise.h>
 
 // BDE
 #include <bdlf_bind.h>
@@ -451,6 +452,21 @@ class TestExecutionContext {
     }
 };
 
+#ifdef MWCEX_COROUTINE_SUPPORTED
+/// Await the specified `future` resuming on the specified `executor`, then
+/// resume on the `executor` again, and return the awaited value.
+template <class EXECUTOR>
+mwcex::Future<int> resumeOnCoroutine(bsl::allocator_arg_t,
+                                     bslma::Allocator*,
+                                     EXECUTOR           executor,
+                                     mwcex::Future<int> future)
+{
+    int value = co_await mwcex::ExecutionUtil::resumeOn(executor, future);
+    co_await mwcex::ExecutionUtil::resumeOn(executor);
+    co_return value;
+}
+#endif
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -1653,6 +1669,53 @@ static void test11_invoke()
 #endif
 }
 
+static void test12_resumeOn()
+// ------------------------------------------------------------------------
+// RESUME ON
+//
+// Concerns:
+//   Ensure proper behavior of the 'resumeOn' function.
+//
+// Plan:
+//   Call a coroutine that awaits a future via 'resumeOn(ex, future)', then
+//   awaits 'resumeOn(ex)'. Make the future ready. Check that:
+//:     o The coroutine is resumed on the executor 'ex' twice, as if by a
+//:       call to 'ex.post(f)';
+//:     o The coroutine completes with the value stored in the future.
+//
+// Testing:
+//   mwcex::ExecutionUtil::resumeOn
+// ------------------------------------------------------------------------
+{
+#ifdef MWCEX_COROUTINE_SUPPORTED
+    bslma::TestAllocator alloc;
+    TestExecutionContext context(&alloc);
+
+    {
+        mwcex::Promise<int> promise(&alloc);
+        mwcex::Future<int>  future = resumeOnCoroutine(bsl::allocator_arg,
+                                                      &alloc,
+                                                      context.executor(),
+                                                      promise.future());
+
+        // the coroutine is suspended pending the future
+        ASSERT(!future.isReady());
+        ASSERT_EQ(context.statistics().d_postCount, 0);
+
+        // make the future ready and wait till the coroutine completes
+        promise.setValue(42);
+        context.drain();
+
+        // the coroutine was resumed twice on the executor via 'post()'
+        ASSERT_EQ(context.statistics().d_postCount, 2);
+        ASSERT_EQ(context.statistics().d_dispatchCount, 0);
+
+        ASSERT(future.isReady());
+        ASSERT_EQ(future.get(), 42);
+    }
+#endif
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1683,6 +1746,9 @@ int main(int argc, char* argv[])
     // invoke
     case 11: test11_invoke(); break;
 
+    // coroutines
+    case 12: test12_resumeOn(); break;
+
     default: {
         bsl::cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND."
                   << bsl::endl;
@@ -18,9 +18,67 @@
 
 #include <mwcscm_version.h>
 
+// BDE
+#include <bslma_newdeleteallocator.h>
+#include <bslma_sharedptrinplacerep.h>
+#include <bslmf_nil.h>
+#include <bslmt_once.h>
+#include <bsls_atomic.h>
+#include <bsls_objectbuffer.h>
+
 namespace BloombergLP {
 namespace mwcex {
 
+namespace {
+
+// TYPES
+
+/// Defines the type of the representation of the ready shared state shared
+/// by all futures returned by `Future<void>::makeReady`.
+typedef bslma::SharedPtrInplaceRep<FutureSharedState<bslmf::Nil> >
+    ReadyStateRep;
+
+// GLOBAL DATA
+
+/// Pointer to the ready shared state representation. The reason this is an
+/// atomic is that this pointer might be initialized from one thread, and be
+/// read from another.
+bsls::AtomicPointer<ReadyStateRep> s_readyStateRep_p(0);
+
+/// Memory buffer used to store the ready shared state representation. Note
+/// that the object stored in that buffer is never destroyed.
+bsls::ObjectBuffer<ReadyStateRep> s_readyStateRepBuffer;
+
+// UTILITY FUNCTIONS
+
+/// Return a reference to the ready shared state representation, creating
+/// it if not already.
+ReadyStateRep& readyStateRep()
+{
+    BSLMT_ONCE_DO
+    {
+        // NOTE: Use the new/delete allocator, rather than the default or the
+        //       global allocator, since the shared state is never destroyed.
+        //       Note also that the shared state being ready, it never stores
+        //       a callback and, therefore, never allocates.
+        bslma::Allocator* allocator = &bslma::NewDeleteAllocator::singleton();
+
+        // create the representation, holding one reference that is never
+        // released
+        ReadyStateRep* rep = new (s_readyStateRepBuffer.buffer())
+            ReadyStateRep(allocator, allocator);
+
+        // make the shared state ready
+        rep->ptr()->setValue(bslmf::Nil());
+
+        s_readyStateRep_p.storeRelease(rep);
+    }
+
+    return *s_readyStateRep_p.loadAcquire();
+}
+
+}  // close unnamed namespace
+
 // ----------------------
 // class Future_Exception
 // ----------------------
@@ -73,5 +131,19 @@ Future_Callback::TargetBase::~TargetBase()
     // NOTHING
 }
 
+// ------------------
+// class Future<void>
+// ------------------
+
+// CLASS METHODS
+Future<void> Future<void>::makeReady()
+{
+    ReadyStateRep& rep = readyStateRep();
+
+    // the constructed shared pointer adopts the acquired reference
+    rep.acquireRef();
+    return Future<void>(bsl::shared_ptr<SharedStateType>(rep.ptr(), &rep));
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -111,6 +111,24 @@
 // specifically, to the future's associated shared state. An important thing to
 // keep in mind is that the attached callback is always invoked from the
 // result-supplier thread.
+//
+// Operations that complete without delay and have no result to supply may
+// return a ready future obtained from 'mwcex::Future<void>::makeReady'.
+// Contrary to a future obtained from a promise, such a future does not
+// require any memory allocation.
+//..
+//  mwcex::Future<void> flushAsync()
+//  {
+//      if (d_pendingBytes == 0) {
+//          // nothing to flush
+//          return mwcex::Future<void>::makeReady();                 // RETURN
+//      }
+//
+//      // ...
+//  }
+//..
+// Note that the result of calling 'whenReady' on a ready future is that the
+// callback is invoked in-place, before 'whenReady' returns.
 
 // MWC
 
@@ -360,7 +378,7 @@ class Future_Callback {
     /// Provides a "small" dummy object which size is used to calculate the
     /// size of the on-stack buffer used for optimization.
     struct Dummy {
-        void* d_padding[3];
+        void* d_padding[6];
     };
 
   private:
@@ -368,8 +386,9 @@ class Future_Callback {
 
     // Uses an on-stack buffer to allocate memory for "small" objects, and
     // falls back to requesting memory from the the supplied allocator if
-    // the buffer is not large enough. Note that the size of the on-stack
-    // buffer is an arbitrary value.
+    // the buffer is not large enough. Note that the buffer is sized so
+    // that a typical continuation, holding a small executor, a future and
+    // a small function object, is stored without allocating memory.
     mwcu::ObjectPlaceHolder<sizeof(Target<void, Dummy>)> d_target;
 
   private:
@@ -568,6 +587,14 @@ class Future<void> : private Future<bslmf::Nil> {
     template <class>
     friend class FutureResult;
 
+  public:
+    // CLASS METHODS
+
+    /// Return a `Future` object having a shared state that is ready. No
+    /// memory is allocated: all futures returned by this function refer to
+    /// the same, process-wide, ready shared state.
+    static Future makeReady();
+
   public:
     // CREATORS
 
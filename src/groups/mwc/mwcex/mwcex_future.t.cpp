@@ -1771,6 +1771,53 @@ static void test16_futureResult_swap()
     }
 }
 
+static void test17_future_makeReady()
+// ------------------------------------------------------------------------
+// FUTURE MAKE READY
+//
+// Concerns:
+//   Ensure proper behavior of the 'Future<void>::makeReady' function.
+//
+// Plan:
+//   1. Call 'makeReady'. Check that the returned future has a shared
+//      state that is ready, and that waiting on it does not block.
+//
+//   2. Call 'makeReady' several times, and attach a callback to each of
+//      the returned futures. Check that the callbacks are invoked
+//      in-place.
+//
+//   3. Check that no memory is allocated from the default or the global
+//      allocator (done by the test epilog).
+//
+// Testing:
+//   mwcex::Future<void>::makeReady
+// ------------------------------------------------------------------------
+{
+    // 1. the future is ready
+    {
+        mwcex::Future<void> future = mwcex::Future<void>::makeReady();
+
+        ASSERT_EQ(future.isValid(), true);
+        ASSERT_EQ(future.isReady(), true);
+        ASSERT_EQ(future.waitFor(bsls::TimeInterval(0)),
+                  mwcex::FutureStatus::e_READY);
+
+        future.get();  // does not throw
+    }
+
+    // 2. callbacks are invoked in-place
+    for (int i = 0; i < 3; ++i) {
+        mwcex::Future<void> future = mwcex::Future<void>::makeReady();
+
+        bool invoked = false;
+        future.whenReady(bdlf::BindUtil::bind(Assign(),
+                                              &invoked,
+                                              true,
+                                              bdlf::PlaceHolders::_1));
+        ASSERT_EQ(invoked, true);
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1802,6 +1849,9 @@ int main(int argc, char* argv[])
     case 15: test15_futureResult_creators(); break;
     case 16: test16_futureResult_swap(); break;
 
+    // mwcex::Future<void>::makeReady
+    case 17: test17_future_makeReady(); break;
+
     default: {
         bsl::cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND."
                   << bsl::endl;
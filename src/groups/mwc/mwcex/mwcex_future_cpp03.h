@@ -242,7 +242,7 @@ class Future_Callback {
         // Provides a "small" dummy object which size is used to calculate the
         // size of the on-stack buffer used for optimization.
 
-        void* d_padding[3];
+        void* d_padding[6];
     };
 
   private:
@@ -250,8 +250,9 @@ class Future_Callback {
     mwcu::ObjectPlaceHolder<sizeof(Target<void, Dummy>)> d_target;
     // Uses an on-stack buffer to allocate memory for "small" objects, and
     // falls back to requesting memory from the the supplied allocator if
-    // the buffer is not large enough. Note that the size of the on-stack
-    // buffer is an arbitrary value.
+    // the buffer is not large enough. Note that the buffer is sized so
+    // that a typical continuation, holding a small executor, a future and
+    // a small function object, is stored without allocating memory.
 
   private:
     // NOT IMPLEMENTED
@@ -466,6 +467,13 @@ class Future<void> : private Future<bslmf::Nil> {
     template <class>
     friend class FutureResult;
 
+  public:
+    // CLASS METHODS
+    static Future makeReady();
+    // Return a 'Future' object having a shared state that is ready.  No
+    // memory is allocated: all futures returned by this function refer to
+    // the same, process-wide, ready shared state.
+
   public:
     // CREATORS
     Future() BSLS_KEYWORD_NOEXCEPT;
@@ -31,5 +31,61 @@ bsls::Types::Uint64 Strand_ThreadUtil::invalidThreadId() BSLS_KEYWORD_NOEXCEPT
         bslmt::ThreadUtil::handleToId(bslmt::ThreadUtil::invalidHandle()));
 }
 
+// ---------------------
+// class Strand_JobQueue
+// ---------------------
+
+// CREATORS
+Strand_JobQueue::Strand_JobQueue()
+: d_back(&d_stub)
+, d_front_p(&d_stub)
+, d_stub()
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+Strand_JobQueueNode* Strand_JobQueue::popFront() BSLS_KEYWORD_NOEXCEPT
+{
+    Strand_JobQueueNode* front = d_front_p;
+    Strand_JobQueueNode* next  = front->d_next.loadAcquire();
+
+    if (front == &d_stub) {
+        // Skip the stub node.
+        if (next == 0) {
+            // The queue is empty.
+            return 0;  // RETURN
+        }
+
+        d_front_p = next;
+        front     = next;
+        next      = front->d_next.loadAcquire();
+    }
+
+    if (next != 0) {
+        // The front node is not the last one.
+        d_front_p = next;
+        return front;  // RETURN
+    }
+
+    if (front != d_back.loadAcquire()) {
+        // A producer is in the middle of a push.
+        return 0;  // RETURN
+    }
+
+    // The front node is the last one. Push the stub node behind it, so that
+    // the front node can be popped without leaving the queue empty.
+    pushBack(&d_stub);
+
+    next = front->d_next.loadAcquire();
+    if (next != 0) {
+        d_front_p = next;
+        return front;  // RETURN
+    }
+
+    // A producer is in the middle of a push.
+    return 0;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -39,6 +39,28 @@
 // multiple threads may use their own instances of the class or use a shared
 // instance without further synchronization.
 //
+/// Implementation notes
+///--------------------
+// Functors submitted to 'mwcex::Strand' are stored in an intrusive, lock-free,
+// multi-producer single-consumer queue, so that 'StrandExecutor::post' does
+// not acquire any lock.  Each submitted functor increments the strand's job
+// counter, and the thread that brings that counter from 0 to 1 becomes
+// responsible for initiating a drain operation on the inner executor (or for
+// parking the strand, if it is stopped).  That thread publishes its functor
+// before initiating the drain operation, so that the inner executor may
+// invoke the drain operation inline.  Concurrent submitters only push their
+// functors to the queue.
+//
+// The drain operation executes functors one by one until the job counter
+// drops back to 0, or the strand is stopped.  To keep the inner executor fair
+// to other work, the drain operation executes at most 'k_MAX_JOBS_PER_RUN'
+// functors per invocation and then re-submits itself to the inner executor.
+//
+// The strand's mutex is only acquired by the drain operation, when popping
+// functors from the queue, and by the control operations: 'start', 'stop',
+// 'join', 'dropPendingJobs' and 'outstandingJobs'.  It is never held while
+// submitting the drain operation to the inner executor.
+//
 /// Usage
 ///-----
 // Given an executor 'ex' of type 'EX' associated with an arbitrary execution
@@ -73,10 +95,11 @@
 
 // BDE
 #include <bdlf_memfn.h>
+#include <bdlma_concurrentpool.h>
 #include <bsl_algorithm.h>  // bsl::swap
-#include <bsl_deque.h>
 #include <bslalg_constructorproxy.h>
 #include <bslma_allocator.h>
+#include <bslma_default.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_decay.h>
 #include <bslmf_istriviallycopyable.h>
@@ -91,6 +114,8 @@
 #include <bsls_compilerfeatures.h>
 #include <bsls_exceptionutil.h>  // BSLS_NOTHROW_SPEC
 #include <bsls_keyword.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 
@@ -112,6 +137,70 @@ struct Strand_ThreadUtil {
     static bsls::Types::Uint64 invalidThreadId() BSLS_KEYWORD_NOEXCEPT;
 };
 
+// ==========================
+// struct Strand_JobQueueNode
+// ==========================
+
+/// Provides a node of the `Strand_JobQueue`.
+struct Strand_JobQueueNode {
+    // PUBLIC DATA
+
+    // Next node in the queue, or 0 if this node is the last one.
+    bsls::AtomicPointer<Strand_JobQueueNode> d_next;
+
+    // Functor stored in this node. Left uninitialized in the stub node of
+    // the queue.
+    bsls::ObjectBuffer<Job> d_job;
+};
+
+// =====================
+// class Strand_JobQueue
+// =====================
+
+/// Provides an intrusive, unbounded, lock-free, multi-producer single-
+/// consumer queue of `Strand_JobQueueNode` objects.
+///
+/// Note that `pushBack` may be invoked concurrently from any number of
+/// threads, while invocations of `popFront` have to be serialized.
+class Strand_JobQueue {
+  private:
+    // PRIVATE DATA
+
+    // Most recently pushed node. Modified by producers.
+    bsls::AtomicPointer<Strand_JobQueueNode> d_back;
+
+    // Least recently pushed node that is not yet popped. Modified by the
+    // consumer.
+    Strand_JobQueueNode* d_front_p;
+
+    // Placeholder node keeping the queue non-empty.
+    Strand_JobQueueNode d_stub;
+
+  private:
+    // NOT IMPLEMENTED
+    Strand_JobQueue(const Strand_JobQueue&) BSLS_KEYWORD_DELETED;
+    Strand_JobQueue& operator=(const Strand_JobQueue&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+
+    /// Create an empty `Strand_JobQueue` object.
+    Strand_JobQueue();
+
+  public:
+    // MANIPULATORS
+
+    /// Push the specified `node` to the back of this queue. This function
+    /// may be invoked concurrently from multiple threads.
+    void pushBack(Strand_JobQueueNode* node) BSLS_KEYWORD_NOEXCEPT;
+
+    /// Pop the node at the front of this queue and return it. Return 0 if
+    /// the queue is empty, or if the producer of the front node has not
+    /// yet completed the corresponding `pushBack`. The behavior is
+    /// undefined unless invocations of this function are serialized.
+    Strand_JobQueueNode* popFront() BSLS_KEYWORD_NOEXCEPT;
+};
+
 // ============
 // class Strand
 // ============
@@ -132,29 +221,64 @@ class Strand {
     /// Defines the type of the underlying executor.
     typedef EXECUTOR InnerExecutorType;
 
+  public:
+    // CONSTANTS
+
+    /// Maximum number of functors executed by a single invocation of the
+    /// drain operation submitted to the inner executor, before the drain
+    /// operation re-submits itself.
+    static const int k_MAX_JOBS_PER_RUN = 64;
+
+  private:
+    // PRIVATE TYPES
+    typedef Strand_JobQueueNode Node;
+
   private:
     // PRIVATE DATA
+
+    // Protects the consumer side of `d_jobQueue`, as well as the members
+    // documented as protected by the mutex.
     mutable bslmt::Mutex d_mutex;
 
-    // Used to signal that `run` has completed.
+    // Used to signal that `run` has completed, or that the strand has been
+    // parked.
     bslmt::Condition d_condition;
 
     // Underlying executor used to submit work.
     EXECUTOR d_innerExecutor;
 
-    // The thread that is currently executing `run`, or an invalid id, if
-    // `run` is not being executed.
+    // The thread that is currently executing a functor from within `run`,
+    // or an invalid id, if no functor is being executed.
     bsls::AtomicUint64 d_workingThreadId;
 
-    // `true` if the strand is started, and `false` otherwise.
-    bool d_isStarted;
+    // `true` if the strand is started, and `false` otherwise. Modified
+    // under the mutex, but may be read without it.
+    bsls::AtomicBool d_isStarted;
 
-    // `true` if a call to `run` has been initiated and is not yet
-    // completed, and `false` otherwise.
-    bool d_isRunning;
+    // `true` if there are outstanding jobs, but no call to `run` has been
+    // initiated to execute them because the strand is stopped, and `false`
+    // otherwise. Protected by the mutex.
+    bool d_isParked;
+
+    // Number of functors that have been submitted to the strand and not
+    // yet executed, including the currently executing functor and the ones
+    // accounted for in `d_numDroppedJobs`. The thread that changes this
+    // value from 0 to 1 is responsible for either initiating a call to
+    // `run`, or parking the strand.
+    bsls::AtomicInt64 d_numJobs;
+
+    // Number of functors removed by `dropPendingJobs` that are not yet
+    // subtracted from `d_numJobs`. Protected by the mutex.
+    bsls::Types::Int64 d_numDroppedJobs;
+
+    // Pool used to allocate job queue nodes.
+    bdlma::ConcurrentPool d_nodePool;
 
     // Functors to be executed.
-    bsl::deque<Job> d_jobQueue;
+    Strand_JobQueue d_jobQueue;
+
+    // Allocator used to supply memory.
+    bslma::Allocator* d_allocator_p;
 
     // FRIENDS
     template <class>
@@ -163,10 +287,38 @@ class Strand {
   private:
     // PRIVATE MANIPULATORS
 
-    /// Invoke functors from the job queue until either the queue is empty,
-    /// or the context is stopped. Then, signal the condition.
+    /// Invoke functors from the job queue until either there are no more
+    /// outstanding jobs, or the context is stopped, or
+    /// `k_MAX_JOBS_PER_RUN` functors have been invoked, in which case
+    /// another call to `run` is initiated. Then, signal the condition.
     void run() BSLS_NOTHROW_SPEC;
 
+    /// Initiate a call to `run` on the inner executor.
+    void initiateRun();
+
+    /// Return a new job queue node containing a functor direct-non-list-
+    /// initialized by `bsl::forward<FUNCTION>(f)`.
+    template <class FUNCTION>
+    Node* createNode(BSLS_COMPILERFEATURES_FORWARD_REF(FUNCTION) f);
+
+    /// Destroy the functor contained in the specified `node` and return
+    /// the node to the pool.
+    void destroyNode(Node* node) BSLS_KEYWORD_NOEXCEPT;
+
+    /// Submit the functor contained in the specified `node` for execution.
+    /// If the inner executor throws an exception, `node` stays pending, the
+    /// strand is parked until the next call to `start`, and the exception
+    /// is rethrown.
+    void submit(Node* node);
+
+    /// Subtract the specified `numJobs` along with `d_numDroppedJobs` from
+    /// the number of outstanding jobs and reset `d_numDroppedJobs`. Return
+    /// `true` if there are no more outstanding jobs, and `false`
+    /// otherwise. The behavior is undefined unless the mutex is locked and
+    /// the calling thread is responsible for the execution of the
+    /// outstanding jobs (see `d_numJobs`).
+    bool retireJobs(bsls::Types::Int64 numJobs) BSLS_KEYWORD_NOEXCEPT;
+
   private:
     // NOT IMPLEMENTED
     Strand(const Strand&) BSLS_KEYWORD_DELETED;
@@ -196,7 +348,10 @@ class Strand {
   public:
     // MANIPULATORS
 
-    /// Begin executing functors on this execution context.
+    /// Begin executing functors on this execution context. If the context
+    /// is already started, but has pending functors that are not being
+    /// executed due to a prior failure of the inner executor (see
+    /// `StrandExecutor::post`), resume their execution.
     ///
     /// This function meets the strong exception guarantee. If an exception
     /// is thrown, this function has no effect.
@@ -285,8 +440,14 @@ class StrandExecutor {
     /// guarantees of ordering and non-concurrency are met. If `f` exits via
     /// an exception, the `Strand` calls `bsl::terminate()`.
     ///
-    /// This function meets the strong exception guarantee. If an exception
-    /// is thrown, this function has no effect.
+    /// If an exception is thrown while copying `f`, this function has no
+    /// effect. If an exception is thrown by the inner executor, `f` has
+    /// already been added to the strand and stays pending, along with any
+    /// functor submitted afterwards, until the next call to `start` on the
+    /// associated `Strand` (or until removed by `dropPendingJobs`).
+    ///
+    /// Note that the inner executor may invoke the functors submitted to it
+    /// inline, that is, from within its `post` function.
     ///
     /// `bsl::decay_t<FUNCTION>` must meet the requirements of Destructible
     /// and MoveConstructible as specified in the C++ standard.
@@ -350,10 +511,34 @@ void swap(StrandExecutor<EXECUTOR>& lhs,
 //                           INLINE DEFINITIONS
 // ============================================================================
 
+// ---------------------
+// class Strand_JobQueue
+// ---------------------
+
+// MANIPULATORS
+inline void
+Strand_JobQueue::pushBack(Strand_JobQueueNode* node) BSLS_KEYWORD_NOEXCEPT
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(node);
+
+    node->d_next.storeRelaxed(0);
+
+    // NOTE: Between the two statements below the queue is temporarily
+    //       disconnected, which is observed by the consumer as an empty
+    //       queue (see 'popFront').
+    Strand_JobQueueNode* prev = d_back.swapAcqRel(node);
+    prev->d_next.storeRelease(node);
+}
+
 // ------------
 // class Strand
 // ------------
 
+// CONSTANTS
+template <class EXECUTOR>
+const int Strand<EXECUTOR>::k_MAX_JOBS_PER_RUN;
+
 // PRIVATE MANIPULATORS
 template <class EXECUTOR>
 inline void Strand<EXECUTOR>::run() BSLS_NOTHROW_SPEC
@@ -363,32 +548,176 @@ inline void Strand<EXECUTOR>::run() BSLS_NOTHROW_SPEC
 
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);  // LOCK
 
-    // set the working thread to this one
-    d_workingThreadId.storeRelease(bslmt::ThreadUtil::selfIdAsUint64());
+    bsls::Types::Int64 numCompletedJobs = 0;
+    int                numJobsBudget    = k_MAX_JOBS_PER_RUN;
 
-    while (d_isStarted && !d_jobQueue.empty()) {
-        // Execute all jobs in the queue.
+    while (!retireJobs(numCompletedJobs)) {
+        // Execute outstanding jobs.
+
+        numCompletedJobs = 0;
+
+        if (!d_isStarted.loadRelaxed()) {
+            // The strand is stopped. Park it until it is restarted.
+            d_isParked = true;
+            break;  // BREAK
+        }
+
+        if (numJobsBudget == 0) {
+            // The budget is exhausted. Let the inner executor run other work
+            // by initiating another call to 'run'. Note that the mutex is
+            // released first, as the inner executor may invoke 'run' inline.
+            d_mutex.unlock();  // UNLOCK
+            try {
+                initiateRun();
+            }
+            catch (...) {
+                // Failed to initiate another call. Keep executing jobs.
+                d_mutex.lock();  // LOCK
+                numJobsBudget = k_MAX_JOBS_PER_RUN;
+                continue;  // CONTINUE
+            }
+
+            // The execution of outstanding jobs has been handed over to the
+            // initiated call.
+            lock.release();
+            return;  // RETURN
+        }
+
+        Node* node = d_jobQueue.popFront();
+        if (!node) {
+            // The job is accounted for, but not yet published by a thread
+            // that is not responsible for the execution of outstanding jobs
+            // (see 'submit'). That thread has nothing left to do but the
+            // 'pushBack', so wait for it to complete.
+            d_mutex.unlock();  // UNLOCK
+            bslmt::ThreadUtil::yield();
+            d_mutex.lock();  // LOCK
+            continue;        // CONTINUE
+        }
 
         // execute job outside the lock
-        Job& job = d_jobQueue.front();
+        d_workingThreadId.storeRelease(bslmt::ThreadUtil::selfIdAsUint64());
         d_mutex.unlock();  // UNLOCK
-        job();
+        node->d_job.object()();
+        destroyNode(node);
         d_mutex.lock();  // LOCK
+        d_workingThreadId.storeRelease(Strand_ThreadUtil::invalidThreadId());
 
-        // remove job from the queue
-        d_jobQueue.pop_front();
+        ++numCompletedJobs;
+        --numJobsBudget;
     }
 
-    // unset the working thread
-    d_workingThreadId.storeRelease(Strand_ThreadUtil::invalidThreadId());
-
-    // unset the 'isRunning' flag
-    d_isRunning = false;
-
     // signal the function has completed
     d_condition.broadcast();
 }
 
+template <class EXECUTOR>
+inline void Strand<EXECUTOR>::initiateRun()
+{
+    ExecutorTraits<EXECUTOR>::post(d_innerExecutor,
+                                   bdlf::MemFnUtil::memFn(&Strand::run,
+                                                          this));
+}
+
+template <class EXECUTOR>
+template <class FUNCTION>
+inline typename Strand<EXECUTOR>::Node*
+Strand<EXECUTOR>::createNode(BSLS_COMPILERFEATURES_FORWARD_REF(FUNCTION) f)
+{
+    Node* node = new (d_nodePool) Node();
+
+    try {
+        new (node->d_job.buffer())
+            Job(BSLS_COMPILERFEATURES_FORWARD(FUNCTION, f), d_allocator_p);
+    }
+    catch (...) {
+        d_nodePool.deleteObject(node);  // rollback
+        throw;                          // rethrow exception
+    }
+
+    return node;
+}
+
+template <class EXECUTOR>
+inline void Strand<EXECUTOR>::destroyNode(Node* node) BSLS_KEYWORD_NOEXCEPT
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(node);
+
+    node->d_job.object().~Job();
+    d_nodePool.deleteObject(node);
+}
+
+template <class EXECUTOR>
+inline void Strand<EXECUTOR>::submit(Node* node)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(node);
+
+    // NOTE: The job is accounted for before it is published, so that the
+    //       number of outstanding jobs never gets lower than the number of
+    //       jobs in the queue.
+
+    if (d_numJobs.addAcqRel(1) != 1) {
+        // Another thread is responsible for the execution of outstanding
+        // jobs. Just publish the job.
+        d_jobQueue.pushBack(node);
+        return;  // RETURN
+    }
+
+    // This thread is responsible for the execution of outstanding jobs.
+    // Publish the job before initiating a call to 'run', so that 'run' never
+    // has to wait for it, even if invoked inline by the inner executor.
+    d_jobQueue.pushBack(node);
+
+    if (!d_isStarted.loadAcquire()) {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);  // LOCK
+
+        if (!d_isStarted.loadRelaxed()) {
+            // The strand is stopped. Park it until it is started.
+            d_isParked = true;
+
+            // let 'join' observe the strand parked
+            d_condition.broadcast();
+            return;  // RETURN
+        }
+
+        // The strand has been started concurrently.
+    }
+
+    try {
+        initiateRun();
+    }
+    catch (...) {
+        // The job is published and may already have been consumed by
+        // 'dropPendingJobs', so it can't be withdrawn. Park the strand until
+        // it is restarted.
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);  // LOCK
+
+        if (!retireJobs(0)) {
+            d_isParked = true;
+        }
+
+        d_condition.broadcast();
+        throw;  // rethrow exception
+    }
+}
+
+template <class EXECUTOR>
+inline bool Strand<EXECUTOR>::retireJobs(bsls::Types::Int64 numJobs)
+    BSLS_KEYWORD_NOEXCEPT
+{
+    const bsls::Types::Int64 numRetiredJobs = numJobs + d_numDroppedJobs;
+    if (numRetiredJobs == 0) {
+        // The calling thread is responsible for the execution of outstanding
+        // jobs, so there is at least one.
+        return false;  // RETURN
+    }
+
+    d_numDroppedJobs = 0;
+    return d_numJobs.addAcqRel(-numRetiredJobs) == 0;
+}
+
 // CREATORS
 template <class EXECUTOR>
 inline Strand<EXECUTOR>::Strand(bslma::Allocator* basicAllocator)
@@ -397,8 +726,12 @@ inline Strand<EXECUTOR>::Strand(bslma::Allocator* basicAllocator)
 , d_innerExecutor()
 , d_workingThreadId(Strand_ThreadUtil::invalidThreadId())
 , d_isStarted(false)
-, d_isRunning(false)
-, d_jobQueue(basicAllocator)
+, d_isParked(false)
+, d_numJobs(0)
+, d_numDroppedJobs(0)
+, d_nodePool(sizeof(Node), basicAllocator)
+, d_jobQueue()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     // NOTHING
 }
@@ -411,8 +744,12 @@ inline Strand<EXECUTOR>::Strand(EXECUTOR          executor,
 , d_innerExecutor(bslmf::MovableRefUtil::move(executor))
 , d_workingThreadId(Strand_ThreadUtil::invalidThreadId())
 , d_isStarted(false)
-, d_isRunning(false)
-, d_jobQueue(basicAllocator)
+, d_isParked(false)
+, d_numJobs(0)
+, d_numDroppedJobs(0)
+, d_nodePool(sizeof(Node), basicAllocator)
+, d_jobQueue()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     // NOTHING
 }
@@ -422,6 +759,12 @@ inline Strand<EXECUTOR>::~Strand()
 {
     stop();
     join();
+
+    // destroy jobs that have not been executed
+    for (Node* node = d_jobQueue.popFront(); node;
+         node       = d_jobQueue.popFront()) {
+        destroyNode(node);
+    }
 }
 
 // MANIPULATORS
@@ -430,21 +773,38 @@ inline void Strand<EXECUTOR>::start()
 {
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);  // LOCK
 
-    if (d_isStarted) {
+    if (d_isStarted.loadRelaxed() && !d_isParked) {
         // Already started. Do nothing.
         return;  // RETURN
     }
 
-    if (!d_jobQueue.empty() && !d_isRunning) {
-        // The job queue isn't empty but no async operation is in progress.
-        // Initiate one.
-        ExecutorTraits<EXECUTOR>::post(d_innerExecutor,
-                                       bdlf::MemFnUtil::memFn(&Strand::run,
-                                                              this));
-        d_isRunning = true;
-    }
+    const bool wasStarted = d_isStarted.loadRelaxed();
+    d_isStarted.storeRelease(true);
 
-    d_isStarted = true;
+    if (d_isParked) {
+        // There are outstanding jobs but no async operation is in progress.
+        // Initiate one. Note that the mutex is released first, as the inner
+        // executor may invoke 'run' inline.
+        d_isParked = false;
+
+        d_mutex.unlock();  // UNLOCK
+        try {
+            initiateRun();
+        }
+        catch (...) {
+            d_mutex.lock();  // LOCK
+
+            // rollback, unless the strand has been stopped concurrently
+            if (!wasStarted) {
+                d_isStarted.storeRelease(false);
+            }
+            d_isParked = true;
+
+            d_condition.broadcast();
+            throw;  // rethrow exception
+        }
+        d_mutex.lock();  // LOCK
+    }
 }
 
 template <class EXECUTOR>
@@ -452,7 +812,7 @@ inline void Strand<EXECUTOR>::stop() BSLS_KEYWORD_NOEXCEPT
 {
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);  // LOCK
 
-    d_isStarted = false;
+    d_isStarted.storeRelease(false);
 }
 
 template <class EXECUTOR>
@@ -464,7 +824,7 @@ inline void Strand<EXECUTOR>::join() BSLS_KEYWORD_NOEXCEPT
 
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);  // LOCK
 
-    while (d_isRunning) {
+    while (d_numJobs.loadAcquire() != 0 && !d_isParked) {
         d_condition.wait(&d_mutex);  // UNLOCK / LOCK
     }
 }
@@ -474,30 +834,25 @@ inline size_t Strand<EXECUTOR>::dropPendingJobs() BSLS_KEYWORD_NOEXCEPT
 {
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);  // LOCK
 
-    // obtain the queue size
-    const size_t jobQueueSize = d_jobQueue.size();
-
-    // do remove
-    if (d_isRunning) {
-        // A job is currently executing. Remove all jobs from the queue but
-        // that one.
-
-        // If we are here, the job queue shall not be empty.
-        BSLS_ASSERT(jobQueueSize != 0);
-
-        for (size_t i = 0; i < jobQueueSize - 1; ++i) {
-            // NOTE: Can't call 'erase' because it requires elements to be
-            //       moveable, so we 'pop_back'.
-            d_jobQueue.pop_back();
-        }
-
-        return jobQueueSize - 1;  // RETURN
+    // Remove all jobs from the queue. Note that the currently executing job
+    // (if any) has already been removed from the queue by 'run'.
+    bsls::Types::Int64 numDroppedJobs = 0;
+    for (Node* node = d_jobQueue.popFront(); node;
+         node       = d_jobQueue.popFront()) {
+        destroyNode(node);
+        ++numDroppedJobs;
     }
-    else {
-        // No job is currently executing. Remove all jobs from the queue.
-        d_jobQueue.clear();
-        return jobQueueSize;  // RETURN
+
+    // NOTE: Unless the strand is parked, dropped jobs are subtracted from the
+    //       number of outstanding jobs by the thread responsible for their
+    //       execution.
+    d_numDroppedJobs += numDroppedJobs;
+    if (d_isParked && retireJobs(0)) {
+        // No more outstanding jobs.
+        d_isParked = false;
     }
+
+    return static_cast<size_t>(numDroppedJobs);
 }
 
 // ACCESSORS
@@ -506,7 +861,7 @@ inline size_t Strand<EXECUTOR>::outstandingJobs() const BSLS_KEYWORD_NOEXCEPT
 {
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);  // LOCK
 
-    return d_jobQueue.size();
+    return static_cast<size_t>(d_numJobs.loadAcquire() - d_numDroppedJobs);
 }
 
 template <class EXECUTOR>
@@ -527,7 +882,7 @@ template <class EXECUTOR>
 inline bslma::Allocator*
 Strand<EXECUTOR>::allocator() const BSLS_KEYWORD_NOEXCEPT
 {
-    return d_jobQueue.get_allocator().mechanism();
+    return d_allocator_p;
 }
 
 // --------------------
@@ -550,27 +905,8 @@ inline void
 StrandExecutor<EXECUTOR>::post(BSLS_COMPILERFEATURES_FORWARD_REF(FUNCTION)
                                    f) const
 {
-    bslmt::LockGuard<bslmt::Mutex> lock(&d_context_p->d_mutex);  // LOCK
-
-    // enqueue the functor
-    d_context_p->d_jobQueue.emplace_back(
-        BSLS_COMPILERFEATURES_FORWARD(FUNCTION, f));
-
-    if (d_context_p->d_isStarted && !d_context_p->d_isRunning) {
-        // The strand is started but no async operation is in progress.
-        // Initiate one.
-
-        try {
-            ExecutorTraits<EXECUTOR>::post(
-                d_context_p->d_innerExecutor,
-                bdlf::MemFnUtil::memFn(&ContextType::run, d_context_p));
-            d_context_p->d_isRunning = true;
-        }
-        catch (...) {
-            d_context_p->d_jobQueue.pop_back();  // rollback
-            throw;                               // rethrow exception
-        }
-    }
+    d_context_p->submit(
+        d_context_p->createNode(BSLS_COMPILERFEATURES_FORWARD(FUNCTION, f)));
 }
 
 template <class EXECUTOR>
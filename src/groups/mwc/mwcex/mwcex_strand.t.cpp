@@ -28,8 +28,10 @@
 #include <bsl_numeric.h>
 #include <bsl_vector.h>
 #include <bslma_testallocator.h>
+#include <bslmt_barrier.h>
 #include <bslmt_semaphore.h>
 #include <bslmt_threadattributes.h>
+#include <bslmt_threadgroup.h>
 #include <bsls_annotation.h>
 #include <bsls_assert.h>
 #include <bsls_keyword.h>
@@ -120,6 +122,36 @@ struct Post {
     }
 };
 
+// ===============
+// struct PostMany
+// ===============
+
+/// Provides a function object that waits on a specified `barrier` and then
+/// calls `post` on a specified `executor` a specified `numJobs` number of
+/// times, submitting function objects that push back values in range
+/// `[first, first + numJobs)` to a specified `container`.
+struct PostMany {
+    // TYPES
+
+    /// Defines the result type of the call operator.
+    typedef void ResultType;
+
+    // ACCESSORS
+    template <class EXECUTOR, class CONTAINER>
+    void operator()(const EXECUTOR& executor,
+                    CONTAINER*      container,
+                    bslmt::Barrier* barrier,
+                    int             first,
+                    int             numJobs) const
+    {
+        barrier->wait();
+
+        for (int i = first; i < first + numJobs; ++i) {
+            executor.post(bdlf::BindUtil::bind(PushBack(), container, i));
+        }
+    }
+};
+
 // ===============
 // struct Dispatch
 // ===============
@@ -272,6 +304,32 @@ class ThrowingExecutor {
     bool operator==(const ThrowingExecutor&) const { return true; }
 };
 
+// ====================
+// class InlineExecutor
+// ====================
+
+/// Provides an executor that invokes submitted functors inline, from within
+/// the call to `post` or `dispatch`.
+class InlineExecutor {
+  public:
+    // MANIPULATORS
+    template <class FUNCTION>
+    void post(FUNCTION f) const
+    {
+        f();
+    }
+
+    template <class FUNCTION>
+    void dispatch(FUNCTION f) const
+    {
+        f();
+    }
+
+  public:
+    // ACCESSORS
+    bool operator==(const InlineExecutor&) const { return true; }
+};
+
 // ==========================
 // class TestExecutionContext
 // ==========================
@@ -797,12 +855,14 @@ static void test7_executor_post()
 //        submitted.
 //
 //   4. Create a strand with an inner executor such that it throws on
-//      submission. Start the strand and submit a function object to it via
-//      a call to 'post'. Check that:
+//      submission. Start the strand and submit function objects to it via
+//      calls to 'post'. Check that:
 //      - No memory is leaked;
-//      - The strand state is the same as before the exception;
-//      - The strand stays usable, i.e. new function objects can be
-//        submitted.
+//      - The first call throws, and the submitted function object stays
+//        pending, as well as the following ones;
+//      - 'start' throws, and the function objects stay pending;
+//      - Pending function objects can be dropped, after which the next
+//        call to 'post' throws again.
 //
 // Testing:
 //   mwcex::StrandExecutor::post
@@ -943,7 +1003,28 @@ static void test7_executor_post()
             // exception thrown
             ASSERT_EQ(exceptionThrown, true);
 
-            // strand not affected
+            // the job stays pending and the strand is parked
+            ASSERT_EQ(strand.outstandingJobs(), 1u);
+
+            // following jobs are queued without calling the inner executor
+            strand.executor().post(NoOp());
+            strand.executor().post(NoOp());
+            ASSERT_EQ(strand.outstandingJobs(), 3u);
+
+            // 'start' tries to resume the execution, and throws
+            exceptionThrown = false;
+            try {
+                strand.start();
+            }
+            catch (const ThrowingExecutor::ExceptionType&) {
+                exceptionThrown = true;
+            }
+
+            ASSERT_EQ(exceptionThrown, true);
+            ASSERT_EQ(strand.outstandingJobs(), 3u);
+
+            // pending jobs can be dropped
+            ASSERT_EQ(strand.dropPendingJobs(), 3u);
             ASSERT_EQ(strand.outstandingJobs(), 0u);
         }
 
@@ -1191,6 +1272,179 @@ static void test11_executor_context()
     ASSERT_EQ(&ex2.context(), &strand2);
 }
 
+static void test12_executor_postConcurrent()
+// ------------------------------------------------------------------------
+// EXECUTOR POST CONCURRENT
+//
+// Concerns:
+//   Ensure proper behavior of the 'post' method when invoked concurrently
+//   from multiple threads on a started strand.
+//
+// Plan:
+//   Create and start a strand on top of a multi-threaded context. From
+//   several threads, concurrently submit more function objects than
+//   'mwcex::Strand::k_MAX_JOBS_PER_RUN', so that the strand has to
+//   re-submit itself to the inner executor. Then, call 'join'. Check
+//   that:
+//   - All submitted function objects have been executed;
+//   - Function objects submitted from the same thread have been executed
+//     in the submission order.
+//
+// Testing:
+//   mwcex::StrandExecutor::post
+// ------------------------------------------------------------------------
+{
+    typedef mwcex::Strand<TestExecutionContext::ExecutorType> Strand;
+
+    static const int k_NUM_THREADS   = 4;
+    static const int k_NUM_PRODUCERS = 4;
+    static const int k_NUM_JOBS      = 10 * Strand::k_MAX_JOBS_PER_RUN;
+
+    bslma::TestAllocator alloc;
+    bsl::vector<int>     out(&alloc);  // job result storage
+    bslmt::Barrier       barrier(k_NUM_PRODUCERS);
+    bslmt::ThreadGroup   producers(&alloc);
+
+    // create a strand on top a multi-threaded context
+    TestExecutionContext ctx(k_NUM_THREADS, &alloc);
+    Strand               strand(ctx.executor(), &alloc);
+
+    // start the strand
+    strand.start();
+
+    // submit jobs concurrently from several threads
+    for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+        int rc = producers.addThread(bdlf::BindUtil::bind(PostMany(),
+                                                          strand.executor(),
+                                                          &out,
+                                                          &barrier,
+                                                          i * k_NUM_JOBS,
+                                                          k_NUM_JOBS));
+        BSLS_ASSERT_OPT(rc == 0);
+    }
+
+    // wait till all jobs are submitted and executed
+    producers.joinAll();
+    strand.join();
+
+    // all jobs executed
+    ASSERT_EQ(out.size(), static_cast<size_t>(k_NUM_PRODUCERS * k_NUM_JOBS));
+    ASSERT_EQ(strand.outstandingJobs(), 0u);
+
+    // jobs submitted by the same thread executed in submission order
+    bsl::vector<int> last(k_NUM_PRODUCERS, -1, &alloc);
+    for (size_t i = 0; i < out.size(); ++i) {
+        const int producer = out[i] / k_NUM_JOBS;
+        ASSERT_LT(last[producer], out[i]);
+        last[producer] = out[i];
+    }
+}
+
+static void test13_executor_postInline()
+// ------------------------------------------------------------------------
+// EXECUTOR POST INLINE
+//
+// Concerns:
+//   Ensure proper behavior of the 'post' method when the inner executor
+//   invokes submitted function objects inline, from within its own 'post'.
+//
+// Plan:
+//   1. Create and start a strand on top of an inline executor. Submit
+//      several function objects by calling 'post' on the strand's
+//      executor. Check that each function object has been executed by the
+//      time 'post' returns.
+//
+//   2. Create a strand on top of an inline executor without starting it.
+//      Submit several function objects. Check that no function object has
+//      been executed so far. Then, call 'start'. Check that all submitted
+//      function objects have been executed in the submission order by the
+//      time 'start' returns.
+//
+//   3. Create and start a strand on top of an inline executor. Submit a
+//      function object that itself submits more function objects than
+//      'mwcex::Strand::k_MAX_JOBS_PER_RUN', so that the strand has to
+//      re-submit itself to the inner executor. Check that all submitted
+//      function objects have been executed in the submission order by the
+//      time 'post' returns.
+//
+// Testing:
+//   mwcex::StrandExecutor::post
+// ------------------------------------------------------------------------
+{
+    typedef mwcex::Strand<InlineExecutor> Strand;
+
+    static const int k_NUM_JOBS = 10;
+
+    bslma::TestAllocator alloc;
+
+    // 1. started strand
+    {
+        bsl::vector<int> out(&alloc);
+        Strand           strand(InlineExecutor(), &alloc);
+
+        strand.start();
+
+        for (int i = 0; i < k_NUM_JOBS; ++i) {
+            strand.executor().post(bdlf::BindUtil::bind(PushBack(), &out, i));
+
+            // the function object executed before 'post' returned
+            ASSERT_EQ(out.size(), static_cast<size_t>(i + 1));
+            ASSERT_EQ(out[i], i);
+            ASSERT_EQ(strand.outstandingJobs(), 0u);
+        }
+    }
+
+    // 2. stopped strand
+    {
+        bsl::vector<int> out(&alloc);
+        Strand           strand(InlineExecutor(), &alloc);
+
+        for (int i = 0; i < k_NUM_JOBS; ++i) {
+            strand.executor().post(bdlf::BindUtil::bind(PushBack(), &out, i));
+        }
+
+        // no function object executed so far
+        ASSERT(out.empty());
+        ASSERT_EQ(strand.outstandingJobs(), static_cast<size_t>(k_NUM_JOBS));
+
+        // all function objects executed before 'start' returned
+        strand.start();
+
+        ASSERT_EQ(out.size(), static_cast<size_t>(k_NUM_JOBS));
+        for (int i = 0; i < k_NUM_JOBS; ++i) {
+            ASSERT_EQ(out[i], i);
+        }
+        ASSERT_EQ(strand.outstandingJobs(), 0u);
+    }
+
+    // 3. more function objects than a single run executes
+    {
+        static const int k_NUM_NESTED_JOBS = 2 * Strand::k_MAX_JOBS_PER_RUN +
+                                             1;
+
+        bsl::vector<int> out(&alloc);
+        bslmt::Barrier   barrier(1);
+        Strand           strand(InlineExecutor(), &alloc);
+
+        strand.start();
+
+        // submit a function object that submits many function objects
+        strand.executor().post(bdlf::BindUtil::bind(PostMany(),
+                                                    strand.executor(),
+                                                    &out,
+                                                    &barrier,
+                                                    0,
+                                                    k_NUM_NESTED_JOBS));
+
+        // all function objects executed before 'post' returned
+        ASSERT_EQ(out.size(), static_cast<size_t>(k_NUM_NESTED_JOBS));
+        for (int i = 0; i < k_NUM_NESTED_JOBS; ++i) {
+            ASSERT_EQ(out[i], i);
+        }
+        ASSERT_EQ(strand.outstandingJobs(), 0u);
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1214,6 +1468,8 @@ int main(int argc, char* argv[])
     case 9: test9_executor_swap(); break;
     case 10: test10_executor_runningInThisThread(); break;
     case 11: test11_executor_context(); break;
+    case 12: test12_executor_postConcurrent(); break;
+    case 13: test13_executor_postInline(); break;
 
     default: {
         bsl::cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND."
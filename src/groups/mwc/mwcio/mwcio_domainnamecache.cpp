@@ -0,0 +1,122 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// mwcio_domainnamecache.cpp                                          -*-C++-*-
+#include <mwcio_domainnamecache.h>
+
+#include <mwcscm_version.h>
+// MWC
+#include <mwcsys_time.h>
+
+// BDE
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace mwcio {
+
+// ---------------------
+// class DomainNameCache
+// ---------------------
+
+// CREATORS
+DomainNameCache::DomainNameCache(const ResolveFn&          resolveFn,
+                                 const bsls::TimeInterval& timeToLive,
+                                 size_t                    capacity,
+                                 bslma::Allocator*         basicAllocator)
+: d_resolveFn(bsl::allocator_arg, basicAllocator, resolveFn)
+, d_timeToLive(timeToLive.totalNanoseconds())
+, d_capacity(capacity)
+, d_mutex()
+, d_entries(bslma::Default::allocator(basicAllocator))
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(resolveFn);
+    BSLS_ASSERT(capacity > 0);
+}
+
+// MANIPULATORS
+ntsa::Error DomainNameCache::getDomainName(bsl::string*           result,
+                                           const ntsa::IpAddress& ipAddress)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(result);
+
+    bsls::Types::Int64 now = mwcsys::Time::highResolutionTimer();
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+        Entries::const_iterator cit = d_entries.find(ipAddress);
+        if (cit != d_entries.end() && now < cit->second.second) {
+            *result = cit->second.first;
+            return ntsa::Error();  // RETURN
+        }
+    }  // UNLOCK
+
+    // Resolve without holding the lock: this may block for a while.
+    ntsa::Error error = d_resolveFn(result, ipAddress);
+    if (error.code() != ntsa::Error::e_OK) {
+        return error;  // RETURN
+    }
+
+    now = mwcsys::Time::highResolutionTimer();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    if (d_entries.size() >= d_capacity &&
+        d_entries.find(ipAddress) == d_entries.end()) {
+        // Evict the expired entries, or all of them if none expired.
+        for (Entries::iterator it = d_entries.begin();
+             it != d_entries.end();) {
+            if (it->second.second <= now) {
+                it = d_entries.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+
+        if (d_entries.size() >= d_capacity) {
+            d_entries.clear();
+        }
+    }
+
+    Entry& entry = d_entries[ipAddress];
+    entry.first  = *result;
+    entry.second = now + d_timeToLive;
+
+    return error;
+}
+
+void DomainNameCache::clear()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    d_entries.clear();
+}
+
+// ACCESSORS
+size_t DomainNameCache::size() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    return d_entries.size();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
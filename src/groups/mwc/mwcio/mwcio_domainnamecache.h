@@ -0,0 +1,171 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// mwcio_domainnamecache.h                                            -*-C++-*-
+#ifndef INCLUDED_MWCIO_DOMAINNAMECACHE
+#define INCLUDED_MWCIO_DOMAINNAMECACHE
+
+//@PURPOSE: Provide a cache of the domain names of IP addresses.
+//
+//@CLASSES:
+//  mwcio::DomainNameCache: cache of the domain names of IP addresses
+//
+//@SEE_ALSO: mwcio_resolveutil, mwcio_resolvingchannelfactory
+//
+//@DESCRIPTION: This component provides a mechanism, 'mwcio::DomainNameCache',
+// resolving the domain name of an IP address using a resolution function
+// (typically 'mwcio::ResolveUtil::getDomainName'), and keeping the domain
+// names successfully resolved for a configurable time to live, so that the
+// channels repeatedly established with the same peers (e.g., when clients
+// reconnect after a failover) do not each block on a reverse DNS query.
+//
+// Failed resolutions are not cached.  Once the cache holds its maximum number
+// of entries, the expired entries are evicted, and, if all the entries are
+// still fresh, the cache is emptied.
+//
+/// Thread Safety
+///-------------
+// This component is thread safe.  The resolution function is invoked without
+// holding any lock, so that concurrent lookups of cached names never wait for
+// a resolution in progress.
+//
+/// Usage
+///-----
+// The cache can be used as the resolution function of
+// 'mwcio::ResolvingChannelFactoryUtil::defaultResolutionFn':
+//..
+//  mwcio::DomainNameCache cache(&mwcio::ResolveUtil::getDomainName,
+//                               bsls::TimeInterval(300),
+//                               1024,
+//                               allocator);
+//
+//  mwcio::ResolvingChannelFactoryUtil::defaultResolutionFn(
+//      &resolvedUri,
+//      baseChannel,
+//      bdlf::MemFnUtil::memFn(&mwcio::DomainNameCache::getDomainName,
+//                             &cache),
+//      true);
+//..
+
+// BDE
+#include <bsl_functional.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+#include <bslh_hash.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_mutex.h>
+#include <bsls_keyword.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+// NTC
+#include <ntsa_error.h>
+#include <ntsa_ipaddress.h>
+
+namespace BloombergLP {
+namespace mwcio {
+
+// =====================
+// class DomainNameCache
+// =====================
+
+/// Mechanism caching the domain names of IP addresses.
+class DomainNameCache {
+  public:
+    // TYPES
+
+    /// Type of the function resolving the specified `address` into its
+    /// domain name, loaded into the specified `domainName`, and returning
+    /// the error.
+    typedef bsl::function<ntsa::Error(bsl::string*           domainName,
+                                      const ntsa::IpAddress& address)>
+        ResolveFn;
+
+  private:
+    // PRIVATE TYPES
+
+    /// Domain name, and expiration time (in nanoseconds of the high
+    /// resolution timer) of an entry.
+    typedef bsl::pair<bsl::string, bsls::Types::Int64> Entry;
+
+    typedef bsl::unordered_map<ntsa::IpAddress, Entry, bslh::Hash<> >
+        Entries;
+
+    // DATA
+    ResolveFn d_resolveFn;
+    // Function resolving the addresses
+    // missing from the cache.
+
+    bsls::Types::Int64 d_timeToLive;
+    // Time to live, in nanoseconds, of
+    // the entries.
+
+    size_t d_capacity;
+    // Maximum number of entries.
+
+    mutable bslmt::Mutex d_mutex;
+    // Mutex protecting 'd_entries'.
+
+    Entries d_entries;
+    // Domain names resolved.
+
+  private:
+    // NOT IMPLEMENTED
+    DomainNameCache(const DomainNameCache&) BSLS_KEYWORD_DELETED;
+    DomainNameCache& operator=(const DomainNameCache&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(DomainNameCache, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a cache resolving the domain names with the specified
+    /// `resolveFn`, keeping them for the specified `timeToLive`, and
+    /// holding at most the specified `capacity` entries.  Optionally
+    /// specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the default memory allocator is used.  The
+    /// behavior is undefined unless `capacity > 0`.
+    DomainNameCache(const ResolveFn&          resolveFn,
+                    const bsls::TimeInterval& timeToLive,
+                    size_t                    capacity,
+                    bslma::Allocator*         basicAllocator = 0);
+
+    // MANIPULATORS
+
+    /// Load into the specified `result` the domain name to which the
+    /// specified `ipAddress` is assigned, resolving it if it is not cached
+    /// or has expired.  Return the error.
+    ntsa::Error getDomainName(bsl::string*           result,
+                              const ntsa::IpAddress& ipAddress);
+
+    /// Remove all the entries from this cache.
+    void clear();
+
+    // ACCESSORS
+
+    /// Return the number of entries, including the expired ones, of this
+    /// cache.
+    size_t size() const;
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
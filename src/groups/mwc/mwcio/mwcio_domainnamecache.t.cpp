@@ -0,0 +1,197 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// mwcio_domainnamecache.t.cpp                                        -*-C++-*-
+#include <mwcio_domainnamecache.h>
+
+// MWC
+#include <mwcsys_time.h>
+
+// BDE
+#include <bdlt_timeunitratio.h>
+#include <bsl_string.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+// NTC
+#include <ntsa_error.h>
+#include <ntsa_ipaddress.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Value, in nanoseconds, of the high resolution timer of the test.
+bsls::Types::Int64 s_now = 0;
+
+/// Number of invocations of `resolve`.
+int s_numResolutions = 0;
+
+/// Return the value of the high resolution timer of the test.
+bsls::Types::Int64 highResTimer()
+{
+    return s_now;
+}
+
+/// Return the value of the clocks of the test.
+bsls::TimeInterval testClock()
+{
+    bsls::TimeInterval result;
+    result.addNanoseconds(s_now);
+    return result;
+}
+
+/// Load into the specified `domainName` the name `host<N>`, where `<N>` is
+/// the number of invocations of this function, unless the specified
+/// `address` is the loopback address, in which case fail.
+ntsa::Error resolve(bsl::string* domainName, const ntsa::IpAddress& address)
+{
+    ++s_numResolutions;
+
+    if (address == ntsa::IpAddress("127.0.0.1")) {
+        return ntsa::Error(ntsa::Error::e_EOF);  // RETURN
+    }
+
+    domainName->assign("host");
+    domainName->append(1, static_cast<char>('0' + s_numResolutions));
+    return ntsa::Error();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   1. A domain name is resolved once, and then returned from the cache
+//      until it expires.
+//   2. A failed resolution is not cached.
+//   3. Once full, the cache evicts the expired entries, or all of them if
+//      none expired.
+//
+// Testing:
+//   getDomainName
+//   clear
+//   size
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    mwcsys::Time::initialize(&testClock,
+                             &testClock,
+                             &highResTimer,
+                             s_allocator_p);
+
+    const bsls::Types::Int64 k_TTL = 10 * bdlt::TimeUnitRatio::k_NS_PER_S;
+
+    const ntsa::IpAddress address1("10.0.0.1");
+    const ntsa::IpAddress address2("10.0.0.2");
+    const ntsa::IpAddress address3("10.0.0.3");
+    const ntsa::IpAddress loopback("127.0.0.1");
+
+    mwcio::DomainNameCache cache(&resolve,
+                                 bsls::TimeInterval(10),
+                                 2,
+                                 s_allocator_p);
+    bsl::string            name(s_allocator_p);
+
+    // Resolved once
+    ASSERT_EQ(cache.getDomainName(&name, address1).code(),
+              ntsa::Error::e_OK);
+    ASSERT_EQ(name, "host1");
+    ASSERT_EQ(s_numResolutions, 1);
+
+    s_now += k_TTL - 1;
+    ASSERT_EQ(cache.getDomainName(&name, address1).code(),
+              ntsa::Error::e_OK);
+    ASSERT_EQ(name, "host1");
+    ASSERT_EQ(s_numResolutions, 1);
+    ASSERT_EQ(cache.size(), 1U);
+
+    // Expired
+    s_now += 1;
+    ASSERT_EQ(cache.getDomainName(&name, address1).code(),
+              ntsa::Error::e_OK);
+    ASSERT_EQ(name, "host2");
+    ASSERT_EQ(s_numResolutions, 2);
+    ASSERT_EQ(cache.size(), 1U);
+
+    // Failure not cached
+    ASSERT_NE(cache.getDomainName(&name, loopback).code(), ntsa::Error::e_OK);
+    ASSERT_NE(cache.getDomainName(&name, loopback).code(), ntsa::Error::e_OK);
+    ASSERT_EQ(s_numResolutions, 4);
+    ASSERT_EQ(cache.size(), 1U);
+
+    ASSERT_EQ(cache.getDomainName(&name, address2).code(),
+              ntsa::Error::e_OK);
+    ASSERT_EQ(name, "host5");
+    ASSERT_EQ(cache.size(), 2U);
+
+    // Full: evicts the expired 'address1'
+    s_now += k_TTL;
+    ASSERT_EQ(cache.getDomainName(&name, address2).code(),
+              ntsa::Error::e_OK);
+    ASSERT_EQ(name, "host6");
+    ASSERT_EQ(cache.size(), 2U);
+    ASSERT_EQ(cache.getDomainName(&name, address3).code(),
+              ntsa::Error::e_OK);
+    ASSERT_EQ(name, "host7");
+    ASSERT_EQ(cache.size(), 2U);
+
+    // Full, none expired: evicts all the entries
+    ASSERT_EQ(cache.getDomainName(&name, address1).code(),
+              ntsa::Error::e_OK);
+    ASSERT_EQ(name, "host8");
+    ASSERT_EQ(cache.size(), 1U);
+
+    cache.clear();
+    ASSERT_EQ(cache.size(), 0U);
+
+    mwcsys::Time::shutdown();
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
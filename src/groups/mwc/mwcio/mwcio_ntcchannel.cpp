@@ -30,6 +30,7 @@
 #include <bdlf_bind.h>
 #include <bdlf_memfn.h>
 #include <bdlf_placeholder.h>
+#include <bsl_algorithm.h>
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bslma_allocator.h>
@@ -38,6 +39,12 @@
 #include <bsls_assert.h>
 #include <bsls_platform.h>
 
+// SYSTEM
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <sys/socket.h>  // for socket, setsockopt, SO_REUSEPORT
+#include <unistd.h>      // for close, unlink
+#endif
+
 namespace BloombergLP {
 namespace mwcio {
 
@@ -48,6 +55,14 @@ BALL_LOG_SET_NAMESPACE_CATEGORY("MWCIO.NTCCHANNEL");
 /// Maximum number of bytes to dump when in read/write.
 const int k_MAX_BYTES_DUMP = 512;
 
+/// Maximum number of seconds allowed for a TLS handshake to complete.
+const int k_UPGRADE_TIMEOUT_SECONDS = 10;
+
+/// Maximum read queue low watermark, in bytes, requested while a read is
+/// waiting for more data.  Bounding it keeps the watermark below the read
+/// queue high watermark, past which the socket stops receiving.
+const int k_MAX_READ_QUEUE_LOW_WATERMARK = 256 * 1024;
+
 #if defined(BSLS_PLATFORM_CPU_64_BIT)
 #define MWCIO_ADDRESS_WIDTH 16
 #else
@@ -118,6 +133,30 @@ struct AddressFormatter {
                        << " connection failed: " << (event) << BALL_LOG_END;  \
     } while (false)
 
+#define MWCIO_NTCCHANNEL_LOG_UPGRADE_START(address, streamSocket)             \
+    do {                                                                      \
+        BALL_LOG_TRACE << "NTC channel " << AddressFormatter(address)         \
+                       << " at " << (streamSocket)->sourceEndpoint()          \
+                       << " to " << (streamSocket)->remoteEndpoint()          \
+                       << " upgrade starting" << BALL_LOG_END;                \
+    } while (false)
+
+#define MWCIO_NTCCHANNEL_LOG_UPGRADE_COMPLETE(address, streamSocket, event)   \
+    do {                                                                      \
+        BALL_LOG_TRACE << "NTC channel " << AddressFormatter(address)         \
+                       << " at " << (streamSocket)->sourceEndpoint()          \
+                       << " to " << (streamSocket)->remoteEndpoint()          \
+                       << " upgrade complete: " << (event) << BALL_LOG_END;   \
+    } while (false)
+
+#define MWCIO_NTCCHANNEL_LOG_UPGRADE_FAILED(address, streamSocket, event)     \
+    do {                                                                      \
+        BALL_LOG_TRACE << "NTC channel " << AddressFormatter(address)         \
+                       << " at " << (streamSocket)->sourceEndpoint()          \
+                       << " to " << (streamSocket)->remoteEndpoint()          \
+                       << " upgrade failed: " << (event) << BALL_LOG_END;     \
+    } while (false)
+
 #define MWCIO_NTCCHANNEL_LOG_RECEIVE_WOULD_BLOCK(address, streamSocket)       \
     do {                                                                      \
         BALL_LOG_TRACE << "NTC channel " << AddressFormatter(address)         \
@@ -383,6 +422,76 @@ int parseEndpoint(bsl::string*             host,
     return 0;
 }
 
+/// Return `true` if the specified `str` designates a local stream socket,
+/// i.e., is of the form `local:<path>`, and `false` otherwise.
+bool isLocalEndpoint(const bslstl::StringRef& str)
+{
+    const bslstl::StringRef prefix = NtcChannelUtil::localEndpointPrefix();
+
+    return str.length() > prefix.length() &&
+           bslstl::StringRef(str.data(), prefix.length()) == prefix;
+}
+
+/// Load into the specified `endpoint` the local stream socket endpoint
+/// named by the specified `str`, which is of the form `local:<path>`.
+/// Return the error.
+ntsa::Error parseLocalEndpoint(ntsa::Endpoint*          endpoint,
+                               const bslstl::StringRef& str)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isLocalEndpoint(str));
+
+    const bslstl::StringRef prefix = NtcChannelUtil::localEndpointPrefix();
+
+    ntsa::LocalName   localName;
+    const ntsa::Error error = localName.setValue(
+        bslstl::StringRef(str.data() + prefix.length(),
+                          str.length() - prefix.length()));
+    if (error) {
+        return error;  // RETURN
+    }
+
+    endpoint->makeLocal(localName);
+    return ntsa::Error();
+}
+
+/// Open the specified `listenerSocket` on a newly created IPv4 stream
+/// socket having the SO_REUSEPORT option set, so that several listeners
+/// may bind the same port.  Return the error.
+ntsa::Error
+openReusePort(const bsl::shared_ptr<ntci::ListenerSocket>& listenerSocket)
+{
+#if defined(BSLS_PLATFORM_OS_UNIX) && defined(SO_REUSEPORT)
+    const ntsa::Handle handle = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (handle < 0) {
+        return ntsa::Error::last();  // RETURN
+    }
+
+    const int enabled = 1;
+    if (::setsockopt(handle,
+                     SOL_SOCKET,
+                     SO_REUSEPORT,
+                     &enabled,
+                     sizeof(enabled)) != 0) {
+        const ntsa::Error error = ntsa::Error::last();
+        ::close(handle);
+        return error;  // RETURN
+    }
+
+    ntsa::Error error = listenerSocket->open(
+                                          ntsa::Transport::e_TCP_IPV4_STREAM,
+                                          handle);
+    if (error) {
+        ::close(handle);
+    }
+
+    return error;
+#else
+    MWCIO_UNUSED(listenerSocket);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+#endif
+}
+
 }  // close unnamed namespace
 
 // -------------
@@ -555,13 +664,37 @@ void NtcChannel::processConnect(
 
         d_streamSocket_sp->registerSession(self);
 
+        d_peerUri = d_streamSocket_sp->remoteEndpoint().text();
+
+        if (d_encryptionClient_sp) {
+            // The channel is only up once the handshake completes, see
+            // 'processUpgrade'.
+
+            ntca::UpgradeOptions upgradeOptions;
+            upgradeOptions.setDeadline(
+                d_streamSocket_sp->currentTime() +
+                bsls::TimeInterval(k_UPGRADE_TIMEOUT_SECONDS, 0));
+
+            MWCIO_NTCCHANNEL_LOG_UPGRADE_START(this, d_streamSocket_sp);
+
+            ntsa::Error error = d_streamSocket_sp->upgrade(
+                d_encryptionClient_sp,
+                upgradeOptions,
+                bdlf::BindUtil::bind(&NtcChannel::processUpgrade,
+                                     self,
+                                     bdlf::PlaceHolders::_1,
+                                     bdlf::PlaceHolders::_2));
+            if (error) {
+                processEstablishFailed("upgrade", error);
+            }
+            return;
+        }
+
         mwcio::ChannelFactory::ResultCallback resultCallback(
             bsl::allocator_arg,
             d_allocator_p);
         resultCallback.swap(d_resultCallback);
 
-        d_peerUri = d_streamSocket_sp->remoteEndpoint().text();
-
         lock.release()->unlock();
 
         if (resultCallback) {
@@ -576,13 +709,13 @@ void NtcChannel::processConnect(
                                             d_options.endpoint(),
                                             event);
 
-        mwcio::Status status;
-        NtcChannelUtil::fail(&status,
-                             mwcio::StatusCategory::e_CONNECTION,
-                             "connect",
-                             event.context().error());
-
         if (event.context().attemptsRemaining() > 0) {
+            mwcio::Status status;
+            NtcChannelUtil::fail(&status,
+                                 mwcio::StatusCategory::e_CONNECTION,
+                                 "connect",
+                                 event.context().error());
+
             mwcio::ChannelFactory::ResultCallback resultCallback =
                 d_resultCallback;
 
@@ -595,31 +728,97 @@ void NtcChannel::processConnect(
             }
         }
         else {
-            mwcio::ChannelFactory::ResultCallback resultCallback(
-                bsl::allocator_arg,
-                d_allocator_p);
+            processEstablishFailed("connect", event.context().error());
+        }
+    }
+}
 
-            resultCallback.swap(d_resultCallback);
+void NtcChannel::processUpgrade(
+    const bsl::shared_ptr<ntci::Upgradable>& upgradable,
+    const ntca::UpgradeEvent&                event)
+{
+    MWCIO_UNUSED(upgradable);
 
-            if (resultCallback) {
-                bslmt::UnLockGuard<bslmt::Mutex> unlock(&d_mutex);
-                resultCallback(mwcio::ChannelFactoryEvent::e_CONNECT_FAILED,
-                               status,
-                               bsl::shared_ptr<mwcio::Channel>());
-            }
+    bsl::shared_ptr<NtcChannel> self = this->shared_from_this();
 
-            if (d_state != e_STATE_OPEN) {
-                return;
-            }
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
-            MWCIO_NTCCHANNEL_LOG_CLOSING(this, d_streamSocket_sp);
+    if (d_state != e_STATE_OPEN) {
+        return;
+    }
 
-            d_state = e_STATE_CLOSING;
+    if (event.type() == ntca::UpgradeEventType::e_COMPLETE) {
+        MWCIO_NTCCHANNEL_LOG_UPGRADE_COMPLETE(this, d_streamSocket_sp, event);
 
-            d_streamSocket_sp->close(
-                bdlf::BindUtil::bind(&NtcChannel::processClose, self, status));
+        mwcio::ChannelFactory::ResultCallback resultCallback(
+            bsl::allocator_arg,
+            d_allocator_p);
+        resultCallback.swap(d_resultCallback);
+
+        lock.release()->unlock();
+
+        if (resultCallback) {
+            resultCallback(mwcio::ChannelFactoryEvent::e_CHANNEL_UP,
+                           mwcio::Status(),
+                           self);
         }
     }
+    else {
+        MWCIO_NTCCHANNEL_LOG_UPGRADE_FAILED(this, d_streamSocket_sp, event);
+
+        processEstablishFailed("upgrade", event.context().error());
+    }
+}
+
+void NtcChannel::processEstablishFailed(const char*        operation,
+                                        const ntsa::Error& error)
+{
+    bsl::shared_ptr<NtcChannel> self = this->shared_from_this();
+
+    mwcio::Status status;
+    NtcChannelUtil::fail(&status,
+                         mwcio::StatusCategory::e_CONNECTION,
+                         operation,
+                         error);
+
+    mwcio::ChannelFactory::ResultCallback resultCallback(bsl::allocator_arg,
+                                                         d_allocator_p);
+
+    resultCallback.swap(d_resultCallback);
+
+    if (resultCallback) {
+        bslmt::UnLockGuard<bslmt::Mutex> unlock(&d_mutex);
+        resultCallback(mwcio::ChannelFactoryEvent::e_CONNECT_FAILED,
+                       status,
+                       bsl::shared_ptr<mwcio::Channel>());
+    }
+
+    if (d_state != e_STATE_OPEN) {
+        return;
+    }
+
+    MWCIO_NTCCHANNEL_LOG_CLOSING(this, d_streamSocket_sp);
+
+    d_state = e_STATE_CLOSING;
+
+    d_streamSocket_sp->close(
+        bdlf::BindUtil::bind(&NtcChannel::processClose, self, status));
+}
+
+void NtcChannel::updateReadQueueLowWatermark(int numNeeded)
+{
+    const bsl::size_t lowWatermark = static_cast<bsl::size_t>(
+        bsl::max(1, bsl::min(numNeeded, k_MAX_READ_QUEUE_LOW_WATERMARK)));
+
+    if (lowWatermark == d_readQueueLowWatermark) {
+        return;
+    }
+
+    ntsa::Error error = d_streamSocket_sp->setReadQueueLowWatermark(
+        lowWatermark);
+    if (!error) {
+        d_readQueueLowWatermark = lowWatermark;
+    }
 }
 
 void NtcChannel::processReadTimeout(
@@ -729,6 +928,11 @@ void NtcChannel::processReadQueueLowWatermark(
                     MWCIO_NTCCHANNEL_LOG_RECEIVE_WOULD_BLOCK(
                         this,
                         d_streamSocket_sp);
+
+                    // Coalesce the remainder of the read: do not wake up
+                    // until enough bytes have arrived to satisfy it.
+                    updateReadQueueLowWatermark(read->numNeeded() -
+                                                d_readCache.length());
                     break;
                 }
                 else if (error == ntsa::Error(ntsa::Error::e_EOF)) {
@@ -970,8 +1174,10 @@ NtcChannel::NtcChannel(
 : d_mutex()
 , d_interface_sp(interface)
 , d_streamSocket_sp()
+, d_encryptionClient_sp()
 , d_readQueue(basicAllocator)
 , d_readCache(basicAllocator)
+, d_readQueueLowWatermark(1)
 , d_channelId(0)
 , d_peerUri(basicAllocator)
 , d_state(e_STATE_DEFAULT)
@@ -1019,8 +1225,12 @@ int NtcChannel::connect(mwcio::Status*               status,
         return 2;
     }
 
+    const bool isLocal = isLocalEndpoint(options.endpoint());
+
     ntca::StreamSocketOptions streamSocketOptions;
-    streamSocketOptions.setTransport(ntsa::Transport::e_TCP_IPV4_STREAM);
+    streamSocketOptions.setTransport(isLocal
+                                         ? ntsa::Transport::e_LOCAL_STREAM
+                                         : ntsa::Transport::e_TCP_IPV4_STREAM);
     streamSocketOptions.setKeepHalfOpen(false);
 
     bsl::shared_ptr<ntci::StreamSocket> streamSocket =
@@ -1058,8 +1268,21 @@ int NtcChannel::connect(mwcio::Status*               status,
         }
     }
 
-    bsl::string endpointString;
-    {
+    bsl::string    endpointString;
+    ntsa::Endpoint localEndpoint;
+    if (isLocal) {
+        error = parseLocalEndpoint(&localEndpoint, options.endpoint());
+        if (error) {
+            mwcio::NtcChannelUtil::fail(status,
+                                        mwcio::StatusCategory::e_GENERIC_ERROR,
+                                        "connect",
+                                        error);
+            return 2;
+        }
+
+        endpointString = options.endpoint();
+    }
+    else {
         BSLS_ASSERT_OPT(!options.endpoint().empty());
 
         bsl::string host;
@@ -1092,9 +1315,16 @@ int NtcChannel::connect(mwcio::Status*               status,
 
     MWCIO_NTCCHANNEL_LOG_CONNECT_START(this, streamSocket, endpointString);
 
-    error = streamSocket->connect(endpointString,
-                                  connectOptions,
-                                  connectCallback);
+    if (isLocal) {
+        error = streamSocket->connect(localEndpoint,
+                                      connectOptions,
+                                      connectCallback);
+    }
+    else {
+        error = streamSocket->connect(endpointString,
+                                      connectOptions,
+                                      connectCallback);
+    }
     if (error) {
         mwcio::NtcChannelUtil::fail(status,
                                     mwcio::StatusCategory::e_CONNECTION,
@@ -1125,6 +1355,67 @@ void NtcChannel::import(
     d_streamSocket_sp->registerSession(self);
 }
 
+void NtcChannel::setEncryptionClient(
+    const bsl::shared_ptr<ntci::EncryptionClient>& encryptionClient)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_state == e_STATE_DEFAULT);
+
+    d_encryptionClient_sp = encryptionClient;
+}
+
+int NtcChannel::upgrade(
+    mwcio::Status*                                 status,
+    const bsl::shared_ptr<ntci::EncryptionServer>& encryptionServer)
+{
+    ntsa::Error error;
+
+    if (status) {
+        status->reset();
+    }
+
+    bsl::shared_ptr<NtcChannel> self = this->shared_from_this();
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(encryptionServer);
+
+    if (d_state != e_STATE_OPEN) {
+        mwcio::NtcChannelUtil::fail(status,
+                                    mwcio::StatusCategory::e_GENERIC_ERROR,
+                                    "state",
+                                    ntsa::Error(ntsa::Error::e_INVALID));
+        return 1;
+    }
+
+    ntca::UpgradeOptions upgradeOptions;
+    upgradeOptions.setDeadline(
+        d_streamSocket_sp->currentTime() +
+        bsls::TimeInterval(k_UPGRADE_TIMEOUT_SECONDS, 0));
+
+    MWCIO_NTCCHANNEL_LOG_UPGRADE_START(this, d_streamSocket_sp);
+
+    error = d_streamSocket_sp->upgrade(
+        encryptionServer,
+        upgradeOptions,
+        bdlf::BindUtil::bind(&NtcChannel::processUpgrade,
+                             self,
+                             bdlf::PlaceHolders::_1,
+                             bdlf::PlaceHolders::_2));
+    if (error) {
+        mwcio::NtcChannelUtil::fail(status,
+                                    mwcio::StatusCategory::e_CONNECTION,
+                                    "upgrade",
+                                    error);
+        return 2;
+    }
+
+    return 0;
+}
+
 void NtcChannel::read(Status*                   status,
                       int                       numBytes,
                       const ReadCallback&       readCallback,
@@ -1183,6 +1474,11 @@ void NtcChannel::read(Status*                   status,
     }
 
     if (enableRead) {
+        // A low watermark left over by a previous read must not delay this
+        // one.
+
+        updateReadQueueLowWatermark(numBytes - d_readCache.length());
+
         error = d_streamSocket_sp->relaxFlowControl(
             ntca::FlowControlType::e_RECEIVE);
         if (error) {
@@ -1412,6 +1708,11 @@ bslma::Allocator* NtcChannel::allocator() const
 // ---------------------
 
 // CLASS METHODS
+bslstl::StringRef NtcChannelUtil::localEndpointPrefix()
+{
+    return bslstl::StringRef("local:", 6);
+}
+
 void NtcChannelUtil::fail(Status*                     status,
                           mwcio::StatusCategory::Enum category,
                           const bslstl::StringRef&    operation,
@@ -1461,7 +1762,20 @@ void NtcListener::processAccept(
 
         channel->import(streamSocket);
 
-        {
+        if (d_encryptionServer_sp) {
+            // The channel reports itself up once the handshake completes.
+
+            mwcio::Status status;
+            if (channel->upgrade(&status, d_encryptionServer_sp) != 0) {
+                BALL_LOG_WARN << "NTC listener " << AddressFormatter(this)
+                              << " at " << d_localUri
+                              << " failed to initiate the TLS handshake "
+                              << "with " << channel->peerUri() << ": "
+                              << status << BALL_LOG_END;
+                channel->close(status);
+            }
+        }
+        else {
             bslmt::UnLockGuard<bslmt::Mutex> unlock(&d_mutex);
             d_resultCallback(mwcio::ChannelFactoryEvent::e_CHANNEL_UP,
                              mwcio::Status(),
@@ -1546,6 +1860,7 @@ NtcListener::NtcListener(
 : d_mutex()
 , d_interface_sp(interface)
 , d_listenerSocket_sp()
+, d_encryptionServer_sp()
 , d_state(e_STATE_DEFAULT)
 , d_options(basicAllocator)
 , d_properties(basicAllocator)
@@ -1588,9 +1903,31 @@ int NtcListener::listen(mwcio::Status*              status,
         backlog = 10;
     }
 
+    int reusePort;
+    if (!options.properties().load(
+            &reusePort,
+            NtcListenerUtil::listenReusePortProperty())) {
+        reusePort = 0;
+    }
+
+    const bool isLocal = isLocalEndpoint(options.endpoint());
+
     ntsa::Endpoint endpoint;
     bsl::string    endpointString;
-    {
+    if (isLocal) {
+        error = parseLocalEndpoint(&endpoint, options.endpoint());
+        if (error) {
+            mwcio::NtcListenerUtil::fail(
+                status,
+                mwcio::StatusCategory::e_GENERIC_ERROR,
+                "bind",
+                error);
+            return 2;
+        }
+
+        endpointString = options.endpoint();
+    }
+    else {
         BSLS_ASSERT_OPT(!options.endpoint().empty());
 
         bsl::string host;
@@ -1617,31 +1954,48 @@ int NtcListener::listen(mwcio::Status*              status,
     }
 
     ntca::ListenerSocketOptions listenerSocketOptions;
-    listenerSocketOptions.setTransport(ntsa::Transport::e_TCP_IPV4_STREAM);
+    listenerSocketOptions.setTransport(
+        isLocal ? ntsa::Transport::e_LOCAL_STREAM
+                : ntsa::Transport::e_TCP_IPV4_STREAM);
     listenerSocketOptions.setReuseAddress(true);
     listenerSocketOptions.setKeepHalfOpen(false);
     listenerSocketOptions.setBacklog(backlog);
 
+    if (isLocal) {
+        // A local name needs no resolution, so it is always bound when the
+        // socket is opened.  Remove any socket file left behind by a previous
+        // process bound to the same path, which would fail the bind.
+#if defined(BSLS_PLATFORM_OS_UNIX)
+        ::unlink(endpoint.local().value().c_str());
+#endif
+        listenerSocketOptions.setSourceEndpoint(endpoint);
+    }
 #if MWCIO_NTCLISTENER_BIND_ASYNC == 0
+    else {
+        bsl::shared_ptr<ntsi::Resolver> resolver =
+            ntsf::System::createResolver();
 
-    bsl::shared_ptr<ntsi::Resolver> resolver = ntsf::System::createResolver();
+        ntsa::EndpointOptions endpointOptions;
+        endpointOptions.setTransport(ntsa::Transport::e_TCP_IPV4_STREAM);
 
-    ntsa::EndpointOptions endpointOptions;
-    endpointOptions.setTransport(ntsa::Transport::e_TCP_IPV4_STREAM);
+        error = resolver->getEndpoint(&endpoint,
+                                      endpointString,
+                                      endpointOptions);
+        if (error) {
+            MWCIO_NTCLISTENER_LOG_RESOLVE_FAILED(this,
+                                                 options.endpoint(),
+                                                 error);
 
-    error = resolver->getEndpoint(&endpoint, endpointString, endpointOptions);
-    if (error) {
-        MWCIO_NTCLISTENER_LOG_RESOLVE_FAILED(this, options.endpoint(), error);
+            mwcio::NtcListenerUtil::fail(
+                status,
+                mwcio::StatusCategory::e_GENERIC_ERROR,
+                "resolve",
+                error);
+            return 3;
+        }
 
-        mwcio::NtcListenerUtil::fail(status,
-                                     mwcio::StatusCategory::e_GENERIC_ERROR,
-                                     "resolve",
-                                     error);
-        return 3;
+        listenerSocketOptions.setSourceEndpoint(endpoint);
     }
-
-    listenerSocketOptions.setSourceEndpoint(endpoint);
-
 #endif
 
     bsl::shared_ptr<ntci::ListenerSocket> listenerSocket =
@@ -1650,7 +2004,12 @@ int NtcListener::listen(mwcio::Status*              status,
 
     ntci::ListenerSocketCloseGuard listenerSocketGuard(listenerSocket);
 
-    error = listenerSocket->open();
+    if (reusePort && !isLocal) {
+        error = openReusePort(listenerSocket);
+    }
+    else {
+        error = listenerSocket->open();
+    }
     if (error) {
         mwcio::NtcListenerUtil::fail(status,
                                      mwcio::StatusCategory::e_GENERIC_ERROR,
@@ -1661,49 +2020,55 @@ int NtcListener::listen(mwcio::Status*              status,
 
 #if MWCIO_NTCLISTENER_BIND_ASYNC
 
-    MWCIO_NTCLISTENER_LOG_BIND_START(this, listenerSocket, endpointString);
-
-    ntca::BindOptions bindOptions;
-    bindOptions.setIpAddressType(ntsa::IpAddressType::e_V4);
+    if (!isLocal) {
+        MWCIO_NTCLISTENER_LOG_BIND_START(this,
+                                         listenerSocket,
+                                         endpointString);
 
-    ntci::BindFuture bindFuture;
+        ntca::BindOptions bindOptions;
+        bindOptions.setIpAddressType(ntsa::IpAddressType::e_V4);
 
-    error = listenerSocket->bind(endpointString, bindOptions, bindFuture);
-    if (error) {
-        mwcio::NtcListenerUtil::fail(status,
-                                     mwcio::StatusCategory::e_GENERIC_ERROR,
-                                     "bind",
-                                     error);
-        return 5;
-    }
+        ntci::BindFuture bindFuture;
 
-    ntci::BindResult bindResult;
-    error = bindFuture.wait(&bindResult);
-    if (error) {
-        mwcio::NtcListenerUtil::fail(status,
-                                     mwcio::StatusCategory::e_GENERIC_ERROR,
-                                     "bind",
-                                     error);
-        return 6;
-    }
+        error = listenerSocket->bind(endpointString, bindOptions, bindFuture);
+        if (error) {
+            mwcio::NtcListenerUtil::fail(
+                status,
+                mwcio::StatusCategory::e_GENERIC_ERROR,
+                "bind",
+                error);
+            return 5;
+        }
 
-    if (bindResult.event().context().error()) {
-        MWCIO_NTCLISTENER_LOG_BIND_FAILED(this,
-                                          listenerSocket,
-                                          options.endpoint(),
-                                          bindResult.event());
+        ntci::BindResult bindResult;
+        error = bindFuture.wait(&bindResult);
+        if (error) {
+            mwcio::NtcListenerUtil::fail(
+                status,
+                mwcio::StatusCategory::e_GENERIC_ERROR,
+                "bind",
+                error);
+            return 6;
+        }
 
-        mwcio::NtcListenerUtil::fail(status,
-                                     mwcio::StatusCategory::e_GENERIC_ERROR,
-                                     "bind",
-                                     bindResult.event().context().error());
-        return 7;
-    }
+        if (bindResult.event().context().error()) {
+            MWCIO_NTCLISTENER_LOG_BIND_FAILED(this,
+                                              listenerSocket,
+                                              options.endpoint(),
+                                              bindResult.event());
 
-    MWCIO_NTCLISTENER_LOG_BIND_COMPLETE(this,
-                                        listenerSocket,
-                                        bindResult.event());
+            mwcio::NtcListenerUtil::fail(
+                status,
+                mwcio::StatusCategory::e_GENERIC_ERROR,
+                "bind",
+                bindResult.event().context().error());
+            return 7;
+        }
 
+        MWCIO_NTCLISTENER_LOG_BIND_COMPLETE(this,
+                                            listenerSocket,
+                                            bindResult.event());
+    }
 #endif
 
     error = listenerSocket->listen(backlog);
@@ -1716,16 +2081,19 @@ int NtcListener::listen(mwcio::Status*              status,
     }
 
     endpoint = listenerSocket->sourceEndpoint();
-    if (!endpoint.isIp() && !endpoint.ip().host().isV4()) {
-        mwcio::NtcListenerUtil::fail(status,
-                                     mwcio::StatusCategory::e_GENERIC_ERROR,
-                                     "bind",
-                                     ntsa::Error(ntsa::Error::e_INVALID));
-        return 9;
-    }
+    if (!isLocal) {
+        if (!endpoint.isIp() && !endpoint.ip().host().isV4()) {
+            mwcio::NtcListenerUtil::fail(
+                status,
+                mwcio::StatusCategory::e_GENERIC_ERROR,
+                "bind",
+                ntsa::Error(ntsa::Error::e_INVALID));
+            return 9;
+        }
 
-    d_properties.set(mwcio::NtcListenerUtil::listenPortProperty(),
-                     static_cast<int>(endpoint.ip().port()));
+        d_properties.set(mwcio::NtcListenerUtil::listenPortProperty(),
+                         static_cast<int>(endpoint.ip().port()));
+    }
 
     ntci::AcceptFunction acceptCallback = bdlf::BindUtil::bind(
         &NtcListener::processAccept,
@@ -1753,6 +2121,17 @@ int NtcListener::listen(mwcio::Status*              status,
     return 0;
 }
 
+void NtcListener::setEncryptionServer(
+    const bsl::shared_ptr<ntci::EncryptionServer>& encryptionServer)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_state == e_STATE_DEFAULT);
+
+    d_encryptionServer_sp = encryptionServer;
+}
+
 void NtcListener::cancel()
 {
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
@@ -1813,6 +2192,11 @@ bslstl::StringRef NtcListenerUtil::listenBacklogProperty()
     return bslstl::StringRef("tcp.listen.backlog", 18);
 }
 
+bslstl::StringRef NtcListenerUtil::listenReusePortProperty()
+{
+    return bslstl::StringRef("tcp.listen.reusePort", 20);
+}
+
 bslstl::StringRef NtcListenerUtil::listenPortProperty()
 {
     return bslstl::StringRef("tcp.listen.port", 15);
@@ -25,6 +25,24 @@
 //@DESCRIPTION: This component provides a mechanism, 'mwcio::NtcChannel',
 // implemented by NTC to asynchronously send and receive arbitrary blobs of
 // data.
+//
+/// Encryption
+///----------
+// A channel may be secured with TLS by supplying an 'ntci::EncryptionClient'
+// before connecting, or by upgrading an accepted channel with an
+// 'ntci::EncryptionServer'.  In both cases the result callback reports
+// 'e_CHANNEL_UP' only once the handshake has completed, and reports
+// 'e_CONNECT_FAILED' if the handshake fails.  Records are then protected
+// transparently by the underlying stream socket: 'write' and 'read' keep
+// exchanging plaintext blobs.
+//
+/// Local Endpoints
+///---------------
+// An endpoint of the form 'local:<path>' (see
+// 'NtcChannelUtil::localEndpointPrefix') designates a local (Unix domain)
+// stream socket bound to '<path>' instead of a '[<host>:]port' TCP endpoint.
+// Such channels are only usable between processes of the same host, but they
+// bypass the TCP/IP stack of the loopback interface entirely.
 
 // MWC
 
@@ -201,20 +219,22 @@ class NtcChannel : public mwcio::Channel,
     };
 
     // INSTANCE DATA
-    bslmt::Mutex                          d_mutex;
-    bsl::shared_ptr<ntci::Interface>      d_interface_sp;
-    bsl::shared_ptr<ntci::StreamSocket>   d_streamSocket_sp;
-    mwcio::NtcReadQueue                   d_readQueue;
-    bdlbb::Blob                           d_readCache;
-    int                                   d_channelId;
-    bsl::string                           d_peerUri;
-    State                                 d_state;
-    mwcio::ConnectOptions                 d_options;
-    mwct::PropertyBag                     d_properties;
-    bdlmt::Signaler<WatermarkFnType>      d_watermarkSignaler;
-    bdlmt::Signaler<CloseFnType>          d_closeSignaler;
-    mwcio::ChannelFactory::ResultCallback d_resultCallback;
-    bslma::Allocator*                     d_allocator_p;
+    bslmt::Mutex                            d_mutex;
+    bsl::shared_ptr<ntci::Interface>        d_interface_sp;
+    bsl::shared_ptr<ntci::StreamSocket>     d_streamSocket_sp;
+    bsl::shared_ptr<ntci::EncryptionClient> d_encryptionClient_sp;
+    mwcio::NtcReadQueue                     d_readQueue;
+    bdlbb::Blob                             d_readCache;
+    bsl::size_t                             d_readQueueLowWatermark;
+    int                                     d_channelId;
+    bsl::string                             d_peerUri;
+    State                                   d_state;
+    mwcio::ConnectOptions                   d_options;
+    mwct::PropertyBag                       d_properties;
+    bdlmt::Signaler<WatermarkFnType>        d_watermarkSignaler;
+    bdlmt::Signaler<CloseFnType>            d_closeSignaler;
+    mwcio::ChannelFactory::ResultCallback   d_resultCallback;
+    bslma::Allocator*                       d_allocator_p;
 
   private:
     // NOT IMPLEMENTED
@@ -229,6 +249,25 @@ class NtcChannel : public mwcio::Channel,
     void processConnect(const bsl::shared_ptr<ntci::Connector>& connector,
                         const ntca::ConnectEvent&               event);
 
+    /// Process the completion of the TLS handshake securing the specified
+    /// `upgradable` according to the specified `event`.
+    void processUpgrade(const bsl::shared_ptr<ntci::Upgradable>& upgradable,
+                        const ntca::UpgradeEvent&                event);
+
+    /// Process the specified `error` of the specified `operation` which
+    /// prevented this channel from being established: report it to the
+    /// result callback, if any, and close the socket.  The behavior is
+    /// undefined unless `d_mutex` is locked.
+    void processEstablishFailed(const char*        operation,
+                                const ntsa::Error& error);
+
+    /// Set the read queue low watermark of the stream socket so that the
+    /// next read queue event is only announced once the specified
+    /// `numNeeded` bytes, bounded by an implementation-defined maximum and
+    /// at least 1, have been received.  The behavior is undefined unless
+    /// `d_mutex` is locked.
+    void updateReadQueueLowWatermark(int numNeeded);
+
     /// Process the timeout of the specified `read` operation by the
     /// specified `timer` according to the specified `event`.
     void processReadTimeout(const bsl::shared_ptr<mwcio::NtcRead>& read,
@@ -326,6 +365,26 @@ class NtcChannel : public mwcio::Channel,
     /// callback.
     void import(const bsl::shared_ptr<ntci::StreamSocket>& streamSocket);
 
+    /// Secure the connection established by a subsequent call to `connect`
+    /// with TLS, using the specified `encryptionClient` for the client side
+    /// of the handshake.  The underlying result callback is invoked with
+    /// `e_CHANNEL_UP` only once the handshake completes.  The behavior is
+    /// undefined unless `connect` has not yet been called.
+    void setEncryptionClient(
+        const bsl::shared_ptr<ntci::EncryptionClient>& encryptionClient);
+
+    /// Secure the imported stream socket with TLS, using the specified
+    /// `encryptionServer` for the server side of the handshake, and invoke
+    /// the underlying result callback with `e_CHANNEL_UP` once the
+    /// handshake completes, or with `e_CONNECT_FAILED` if it fails.
+    /// Return 0 on success, or a non-zero value if the handshake could not
+    /// be initiated, populating the optionally-specified `status` with
+    /// more detailed error information.  The behavior is undefined unless
+    /// `import` has been called.
+    int
+    upgrade(mwcio::Status*                                 status,
+            const bsl::shared_ptr<ntci::EncryptionServer>& encryptionServer);
+
     /// Initiate an asynchronous (timed) read operation on this channel, or
     /// append this request to the currently pending requests if an
     /// asynchronous read operation was already initiated, with an
@@ -436,6 +495,11 @@ class NtcChannel : public mwcio::Channel,
 struct NtcChannelUtil {
     // CLASS METHODS
 
+    /// Return the prefix which, in the endpoint of a ConnectOptions or
+    /// ListenOptions, identifies the path of a local (Unix domain) stream
+    /// socket rather than a `[<host>:]port` TCP endpoint.
+    static bslstl::StringRef localEndpointPrefix();
+
     /// Load into the specified `status`, if defined, the description of
     /// the specified `error` assigned to the specified `category` that
     /// was detected when performing the specified `operation`.
@@ -473,16 +537,17 @@ class NtcListener : public mwcio::ChannelFactoryOperationHandle,
     };
 
     // INSTANCE DATA
-    bslmt::Mutex                          d_mutex;
-    bsl::shared_ptr<ntci::Interface>      d_interface_sp;
-    bsl::shared_ptr<ntci::ListenerSocket> d_listenerSocket_sp;
-    bsl::string                           d_localUri;
-    State                                 d_state;
-    mwcio::ListenOptions                  d_options;
-    mwct::PropertyBag                     d_properties;
-    bdlmt::Signaler<CloseFnType>          d_closeSignaler;
-    mwcio::ChannelFactory::ResultCallback d_resultCallback;
-    bslma::Allocator*                     d_allocator_p;
+    bslmt::Mutex                            d_mutex;
+    bsl::shared_ptr<ntci::Interface>        d_interface_sp;
+    bsl::shared_ptr<ntci::ListenerSocket>   d_listenerSocket_sp;
+    bsl::shared_ptr<ntci::EncryptionServer> d_encryptionServer_sp;
+    bsl::string                             d_localUri;
+    State                                   d_state;
+    mwcio::ListenOptions                    d_options;
+    mwct::PropertyBag                       d_properties;
+    bdlmt::Signaler<CloseFnType>            d_closeSignaler;
+    mwcio::ChannelFactory::ResultCallback   d_resultCallback;
+    bslma::Allocator*                       d_allocator_p;
 
   private:
     // NOT IMPLEMENTED
@@ -529,6 +594,13 @@ class NtcListener : public mwcio::ChannelFactoryOperationHandle,
     /// optionally-specified `status` with more detailed error information.
     int listen(mwcio::Status* status, const mwcio::ListenOptions& options);
 
+    /// Secure every channel subsequently accepted by this listener with
+    /// TLS, using the specified `encryptionServer` for the server side of
+    /// the handshake.  The behavior is undefined unless `listen` has not
+    /// yet been called.
+    void setEncryptionServer(
+        const bsl::shared_ptr<ntci::EncryptionServer>& encryptionServer);
+
     /// Cancel the operation.
     void cancel() BSLS_KEYWORD_OVERRIDE;
 
@@ -574,6 +646,14 @@ struct NtcListenerUtil {
     /// This property must contain an `Integer`.
     static bslstl::StringRef listenBacklogProperty();
 
+    /// Return a reference providing const access to the name of the
+    /// property used to request that the listening socket of a
+    /// ListenOptions sets SO_REUSEPORT, so that several listeners may bind
+    /// to the same port and have incoming connections spread across them
+    /// by the kernel.  This property must contain an `Integer`, non-zero
+    /// to enable.
+    static bslstl::StringRef listenReusePortProperty();
+
     /// Return a reference providing const access to the name of the
     /// property that will be returned on the handle returned from
     /// `NtcChannelFactory::listen` with an integer property containing the
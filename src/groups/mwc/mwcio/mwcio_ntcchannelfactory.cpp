@@ -184,6 +184,8 @@ NtcChannelFactory::NtcChannelFactory(
     const bsl::shared_ptr<ntci::Interface>& interface,
     bslma::Allocator*                       basicAllocator)
 : d_interface_sp(interface)
+, d_encryptionServer_sp()
+, d_encryptionClient_sp()
 , d_listeners(basicAllocator)
 , d_channels(basicAllocator)
 , d_createSignaler(basicAllocator)
@@ -201,6 +203,8 @@ NtcChannelFactory::NtcChannelFactory(
     bdlbb::BlobBufferFactory*    blobBufferFactory,
     bslma::Allocator*            basicAllocator)
 : d_interface_sp()
+, d_encryptionServer_sp()
+, d_encryptionClient_sp()
 , d_listeners(basicAllocator)
 , d_channels(basicAllocator)
 , d_createSignaler(basicAllocator)
@@ -309,6 +313,46 @@ void NtcChannelFactory::stop()
     BALL_LOG_TRACE << "NTC factory has stopped" << BALL_LOG_END;
 }
 
+int NtcChannelFactory::enableServerEncryption(
+    const ntca::EncryptionServerOptions& options)
+{
+    bsl::shared_ptr<ntci::EncryptionServer> encryptionServer;
+    ntsa::Error                             error =
+        d_interface_sp->createEncryptionServer(&encryptionServer,
+                                               options,
+                                               d_allocator_p);
+    if (error) {
+        BALL_LOG_ERROR << "Failed to create the NTC encryption server: "
+                       << error << BALL_LOG_END;
+        return error.number();  // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_stateMutex);  // LOCKED
+    d_encryptionServer_sp = encryptionServer;
+
+    return 0;
+}
+
+int NtcChannelFactory::enableClientEncryption(
+    const ntca::EncryptionClientOptions& options)
+{
+    bsl::shared_ptr<ntci::EncryptionClient> encryptionClient;
+    ntsa::Error                             error =
+        d_interface_sp->createEncryptionClient(&encryptionClient,
+                                               options,
+                                               d_allocator_p);
+    if (error) {
+        BALL_LOG_ERROR << "Failed to create the NTC encryption client: "
+                       << error << BALL_LOG_END;
+        return error.number();  // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_stateMutex);  // LOCKED
+    d_encryptionClient_sp = encryptionClient;
+
+    return 0;
+}
+
 void NtcChannelFactory::listen(Status*                      status,
                                bslma::ManagedPtr<OpHandle>* handle,
                                const ListenOptions&         options,
@@ -349,6 +393,10 @@ void NtcChannelFactory::listen(Status*                      status,
                            resultCallbackProxy,
                            d_allocator_p);
 
+    if (d_encryptionServer_sp) {
+        listener->setEncryptionServer(d_encryptionServer_sp);
+    }
+
     int catalogHandle = d_listeners.add(listener);
 
     listener->onClose(
@@ -413,6 +461,10 @@ void NtcChannelFactory::connect(Status*                      status,
                           resultCallbackProxy,
                           d_allocator_p);
 
+    if (d_encryptionClient_sp) {
+        channel->setEncryptionClient(d_encryptionClient_sp);
+    }
+
     int catalogHandle = d_channels.add(channel);
 
     channel->setChannelId(catalogHandle);
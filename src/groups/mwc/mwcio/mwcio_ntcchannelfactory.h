@@ -28,6 +28,9 @@
 //@DESCRIPTION: This component defines a mechanism, 'mwcio::NtcChannelFactory',
 // that implements the 'mwcio::ChannelFactory' protocol to produce and manage
 // 'mwcio::NtcChannel' objects that implement the 'mwcio::Channel' protocol.
+// Channels may be secured with TLS by enabling server encryption, applied to
+// every accepted channel, and client encryption, applied to every connected
+// channel (see 'enableServerEncryption' and 'enableClientEncryption').
 
 // MWC
 
@@ -108,16 +111,18 @@ class NtcChannelFactory : public mwcio::ChannelFactory {
     };
 
     // INSTANCE DATA
-    bsl::shared_ptr<ntci::Interface> d_interface_sp;
-    ListenerCatalog                  d_listeners;
-    ChannelCatalog                   d_channels;
-    bdlmt::Signaler<CreateFnType>    d_createSignaler;
-    bdlmt::Signaler<LimitFnType>     d_limitSignaler;
-    bool                             d_owned;
-    bslmt::Mutex                     d_stateMutex;
-    bslmt::Condition                 d_stateCondition;
-    State                            d_state;
-    bslma::Allocator*                d_allocator_p;
+    bsl::shared_ptr<ntci::Interface>        d_interface_sp;
+    bsl::shared_ptr<ntci::EncryptionServer> d_encryptionServer_sp;
+    bsl::shared_ptr<ntci::EncryptionClient> d_encryptionClient_sp;
+    ListenerCatalog                         d_listeners;
+    ChannelCatalog                          d_channels;
+    bdlmt::Signaler<CreateFnType>           d_createSignaler;
+    bdlmt::Signaler<LimitFnType>            d_limitSignaler;
+    bool                                    d_owned;
+    bslmt::Mutex                            d_stateMutex;
+    bslmt::Condition                        d_stateCondition;
+    State                                   d_state;
+    bslma::Allocator*                       d_allocator_p;
 
   private:
     // NOT IMPLEMENTED
@@ -194,6 +199,20 @@ class NtcChannelFactory : public mwcio::ChannelFactory {
     /// `start()` and is not one of the I/O threads used by this object.
     void stop();
 
+    /// Secure every channel subsequently accepted by a listener of this
+    /// factory with TLS, configuring the server side of the handshake
+    /// according to the specified `options`.  Return 0 on success and a
+    /// non-zero value otherwise.  Note that listeners already started are
+    /// not affected.
+    int enableServerEncryption(const ntca::EncryptionServerOptions& options);
+
+    /// Secure every channel subsequently connected by this factory with
+    /// TLS, configuring the client side of the handshake according to the
+    /// specified `options`.  Return 0 on success and a non-zero value
+    /// otherwise.  Note that connections already initiated are not
+    /// affected.
+    int enableClientEncryption(const ntca::EncryptionClientOptions& options);
+
     /// Listen for connections according to the specified `options` (whose
     /// meaning is implementation-defined), and invoke the specified `cb`
     /// when they are created or a connection attempt fails.  Load into the
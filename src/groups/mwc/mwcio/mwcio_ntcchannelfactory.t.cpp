@@ -17,8 +17,16 @@
 #include <mwcio_ntcchannelfactory.h>
 
 #include <mwcu_blob.h>
+#include <mwcu_memoutstream.h>
 
+#include <ntca_encryptioncertificateoptions.h>
+#include <ntca_encryptionclientoptions.h>
+#include <ntca_encryptionkeyoptions.h>
+#include <ntca_encryptionserveroptions.h>
 #include <ntcf_system.h>
+#include <ntci_encryptioncertificate.h>
+#include <ntci_encryptionkey.h>
+#include <ntsa_distinguishedname.h>
 #include <ntsf_system.h>
 
 #include <ball_filteringobserver.h>
@@ -32,6 +40,7 @@
 #include <bdlf_bind.h>
 #include <bsl_deque.h>
 #include <bsl_memory.h>
+#include <bsl_vector.h>
 #include <bslmt_threadutil.h>
 #include <bsls_annotation.h>
 #include <bsls_timeutil.h>
@@ -90,6 +99,62 @@ static bool ballFilter(const bsl::string&           messageSubstring,
                 .isEmpty();
 }
 
+/// Load into the specified `certificate` a self-signed certificate for the
+/// specified `commonName`, and into the specified `privateKey` its private
+/// key.  Return 0 on success, or a non-zero value if the NTF library this
+/// test driver is linked with does not support encryption.
+static int
+generateIdentity(bsl::shared_ptr<ntci::EncryptionCertificate>* certificate,
+                 bsl::shared_ptr<ntci::EncryptionKey>*         privateKey,
+                 const bsl::string&                            commonName)
+{
+    ntsa::Error error = ntcf::System::generateKey(privateKey,
+                                                  ntca::EncryptionKeyOptions(),
+                                                  s_allocator_p);
+    if (error) {
+        return error.number();  // RETURN
+    }
+
+    ntsa::DistinguishedName identity(s_allocator_p);
+    identity["CN"] = commonName;
+
+    ntca::EncryptionCertificateOptions options;
+    options.setAuthority(true);
+
+    error = ntcf::System::generateCertificate(certificate,
+                                              identity,
+                                              *privateKey,
+                                              options,
+                                              s_allocator_p);
+    return error.number();
+}
+
+/// Load into the specified `options` the server side of the TLS handshake
+/// presenting the specified `certificate` with its specified `privateKey`.
+static void makeServerOptions(
+    ntca::EncryptionServerOptions*                      options,
+    const bsl::shared_ptr<ntci::EncryptionCertificate>& certificate,
+    const bsl::shared_ptr<ntci::EncryptionKey>&         privateKey)
+{
+    options->setMinMethod(ntca::EncryptionMethod::e_TLS_V1_2);
+    options->setMaxMethod(ntca::EncryptionMethod::e_TLS_V1_X);
+    options->setAuthentication(ntca::EncryptionAuthentication::e_NONE);
+    options->setIdentity(certificate);
+    options->setPrivateKey(privateKey);
+}
+
+/// Load into the specified `options` the client side of the TLS handshake
+/// trusting only the specified `authority`.
+static void makeClientOptions(
+    ntca::EncryptionClientOptions*                      options,
+    const bsl::shared_ptr<ntci::EncryptionCertificate>& authority)
+{
+    options->setMinMethod(ntca::EncryptionMethod::e_TLS_V1_2);
+    options->setMaxMethod(ntca::EncryptionMethod::e_TLS_V1_X);
+    options->setAuthentication(ntca::EncryptionAuthentication::e_VERIFY);
+    options->addAuthority(authority);
+}
+
 // CONSTANTS
 static const bslstl::StringRef k_BALL_OBSERVER_NAME = "testDriverObserver";
 static const ChannelFactoryEvent::Enum CFE_CHANNEL_UP =
@@ -316,12 +381,22 @@ class Tester {
     /// supporting objects.
     void init(int line);
 
-    /// Listen for connections at the specified `endpoint` and assign the
-    /// returned handle to the specified `handleName`, verifying that the
-    /// status of the operation has the specified `resultStatus`.
+    /// Listen for connections at the specified `endpointOrServer` and
+    /// assign the returned handle to the specified `handleName`, verifying
+    /// that the status of the operation has the specified `resultStatus`.
+    /// If the `endpointOrServer` is a `handleName` used in a previous
+    /// successful `listen`, the listen will be made to the same port.
+    /// Otherwise, the listen will use the `endpointOrServer` as the
+    /// endpoint as-is.  The optionally specified `options` will be used as
+    /// the base of the options passed to the `listen`.
+    void listen(int                         line,
+                const bslstl::StringRef&    handleName,
+                const bslstl::StringRef&    endpointOrServer,
+                const mwcio::ListenOptions& options,
+                StatusCategory::Enum resultStatus = StatusCategory::e_SUCCESS);
     void listen(int                      line,
                 const bslstl::StringRef& handleName,
-                const bslstl::StringRef& endpoint,
+                const bslstl::StringRef& endpointOrServer,
                 StatusCategory::Enum resultStatus = StatusCategory::e_SUCCESS);
 
     /// Connect to the specified `endpointOrServer` and assign the
@@ -407,6 +482,14 @@ class Tester {
                              const bslstl::StringRef& handleName,
                              const bslstl::StringRef& channelName);
 
+    /// Check that the total number of unchecked calls to the ResultCb
+    /// associated with the specified `handleNames` is the specified
+    /// `expected`.  This function will wait for up to 5s for the calls to
+    /// be received before failing the check.
+    void checkNumResultCallbacks(int                             line,
+                                 const bsl::vector<bsl::string>& handleNames,
+                                 int                             expected);
+
     /// Make sure there are no unchecked calls to the ResultCb associated
     /// with the specified `handleName`.  This function will wait for a
     /// few ms before doing the check.
@@ -592,19 +675,29 @@ void Tester::init(int line)
     ASSERT_EQ_D(line, ret, 0);
 }
 
-void Tester::listen(int                      line,
-                    const bslstl::StringRef& handleName,
-                    const bslstl::StringRef& endpoint,
-                    StatusCategory::Enum     resultStatus)
+void Tester::listen(int                         line,
+                    const bslstl::StringRef&    handleName,
+                    const bslstl::StringRef&    endpointOrServer,
+                    const mwcio::ListenOptions& options,
+                    StatusCategory::Enum        resultStatus)
 {
     bsl::string handleNameStr(handleName);
 
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
 
-    HandleInfo& info = d_handleMap[handleNameStr];
+    ListenOptions reqOptions(options, d_allocator_p);
+
+    HandleMap::iterator serverIter = d_handleMap.find(endpointOrServer);
+    if (serverIter != d_handleMap.end()) {
+        bsl::ostringstream ss;
+        ss << "127.0.0.1:" << serverIter->second.d_listenPort;
+        reqOptions.setEndpoint(ss.str());
+    }
+    else {
+        reqOptions.setEndpoint(endpointOrServer);
+    }
 
-    ListenOptions options(d_allocator_p);
-    options.setEndpoint(endpoint);
+    HandleInfo& info = d_handleMap[handleNameStr];
 
     bslma::ManagedPtr<ChannelFactory::OpHandle> opHandle;
 
@@ -620,7 +713,7 @@ void Tester::listen(int                      line,
                               bdlf::PlaceHolders::_3));
 
     Status status;
-    d_object->listen(&status, &opHandle, options, resultCb);
+    d_object->listen(&status, &opHandle, reqOptions, resultCb);
     info.d_handle = opHandle;
 
     if (status) {
@@ -635,6 +728,18 @@ void Tester::listen(int                      line,
     ASSERT_EQ_D(line << ", " << status, status.category(), resultStatus);
 }
 
+void Tester::listen(int                      line,
+                    const bslstl::StringRef& handleName,
+                    const bslstl::StringRef& endpointOrServer,
+                    StatusCategory::Enum     resultStatus)
+{
+    listen(line,
+           handleName,
+           endpointOrServer,
+           mwcio::ListenOptions(d_allocator_p),
+           resultStatus);
+}
+
 void Tester::connect(int                          line,
                      const bslstl::StringRef&     handleName,
                      const bslstl::StringRef&     endpointOrServer,
@@ -911,6 +1016,35 @@ void Tester::checkResultCallback(int                      line,
                         channelName);
 }
 
+void Tester::checkNumResultCallbacks(
+    int                             line,
+    const bsl::vector<bsl::string>& handleNames,
+    int                             expected)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+
+    int numCalls = 0;
+    while (true) {
+        numCalls = 0;
+        for (size_t i = 0; i < handleNames.size(); ++i) {
+            numCalls += static_cast<int>(
+                d_handleMap[handleNames[i]].d_resultCbCalls.size());
+        }
+
+        if (numCalls >= expected || (bsls::TimeUtil::getTimer() - startTime) >=
+                                        5 * bdlt::TimeUnitRatio::k_NS_PER_S) {
+            break;  // BREAK
+        }
+
+        bslmt::LockGuardUnlock<bslmt::Mutex> unlockGuard(&d_mutex);
+        bslmt::ThreadUtil::microSleep(1000);
+    }
+
+    ASSERT_EQ_D(line, numCalls, expected);
+}
+
 void Tester::checkNoResultCallback(int                      line,
                                    const bslstl::StringRef& handleName)
 {
@@ -1035,6 +1169,153 @@ NtcChannelFactory& Tester::object()
 // ============================================================================
 //                                    TESTS
 // ----------------------------------------------------------------------------
+static void test8_encryptionTest()
+// ------------------------------------------------------------------------
+// ENCRYPTION TEST
+//
+// Concerns:
+//  a) With server and client encryption enabled, listening for a
+//     connection and connecting to the same port establishes both
+//     channels once the TLS handshake completes, and data written on one
+//     end is read in plaintext on the other end.
+//  b) A plaintext connection to a listener securing its channels fails
+//     the handshake: the listener reports 'e_CONNECT_FAILED' and the
+//     connecting channel is closed.
+//  c) A client not trusting the certificate presented by the server
+//     fails the handshake: both ends report 'e_CONNECT_FAILED'.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("Encryption Test");
+
+    bsl::shared_ptr<ntci::EncryptionCertificate> serverCertificate;
+    bsl::shared_ptr<ntci::EncryptionKey>         serverKey;
+    if (0 != generateIdentity(&serverCertificate, &serverKey, "server")) {
+        // NTF was built without an encryption driver
+        PV("Encryption is not supported, skipping test");
+        return;  // RETURN
+    }
+
+    bsl::shared_ptr<ntci::EncryptionCertificate> otherCertificate;
+    bsl::shared_ptr<ntci::EncryptionKey>         otherKey;
+    ASSERT_EQ(0, generateIdentity(&otherCertificate, &otherKey, "other"));
+
+    ntca::EncryptionServerOptions serverOptions;
+    makeServerOptions(&serverOptions, serverCertificate, serverKey);
+
+    Tester t(s_allocator_p);
+
+    // Concern 'a'
+    {
+        ntca::EncryptionClientOptions clientOptions;
+        makeClientOptions(&clientOptions, serverCertificate);
+
+        t.init(L_);
+        ASSERT_EQ(0, t.object().enableServerEncryption(serverOptions));
+        ASSERT_EQ(0, t.object().enableClientEncryption(clientOptions));
+
+        t.listen(L_, "listenHandle", "127.0.0.1:0");
+        t.connect(L_, "connectHandle", "listenHandle");
+
+        t.checkResultCallback(L_, "listenHandle", "listenChannel");
+        t.checkResultCallback(L_, "connectHandle", "connectChannel");
+
+        t.writeChannel(L_, "listenChannel", "abcdef");
+        t.readChannel(L_, "connectChannel", "abcdef");
+
+        t.writeChannel(L_, "connectChannel", "ghijkl");
+        t.readChannel(L_, "listenChannel", "ghijkl");
+    }
+
+    // Concern 'b'
+    {
+        t.init(L_);
+        ASSERT_EQ(0, t.object().enableServerEncryption(serverOptions));
+
+        t.listen(L_, "listenHandle", "127.0.0.1:0");
+        t.connect(L_, "connectHandle", "listenHandle");
+
+        // The plaintext connection is up, but is not a TLS client
+        t.checkResultCallback(L_, "connectHandle", "connectChannel");
+        t.writeChannel(L_, "connectChannel", "abcdef");
+
+        t.checkResultCallback(L_,
+                              "listenHandle",
+                              ChannelFactoryEvent::e_CONNECT_FAILED,
+                              StatusCategory::e_CONNECTION);
+        t.checkChannelClose(L_, "connectChannel");
+    }
+
+    // Concern 'c'
+    {
+        ntca::EncryptionClientOptions clientOptions;
+        makeClientOptions(&clientOptions, otherCertificate);
+
+        t.init(L_);
+        ASSERT_EQ(0, t.object().enableServerEncryption(serverOptions));
+        ASSERT_EQ(0, t.object().enableClientEncryption(clientOptions));
+
+        t.listen(L_, "listenHandle", "127.0.0.1:0");
+        t.connect(L_, "connectHandle", "listenHandle");
+
+        t.checkResultCallback(L_,
+                              "connectHandle",
+                              ChannelFactoryEvent::e_CONNECT_FAILED,
+                              StatusCategory::e_CONNECTION);
+        t.checkResultCallback(L_,
+                              "listenHandle",
+                              ChannelFactoryEvent::e_CONNECT_FAILED,
+                              StatusCategory::e_CONNECTION);
+    }
+}
+
+static void test7_reusePortListenTest()
+// ------------------------------------------------------------------------
+// REUSE PORT LISTEN TEST
+//
+// Concerns:
+//  a) Several listeners requesting 'listenReusePortProperty' listen to the
+//     same port.
+//  b) The connections to that port are spread by the kernel across these
+//     listeners, each connection being accepted by exactly one of them.
+//  c) A listener not requesting 'listenReusePortProperty' fails to listen
+//     to a port already listened to.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("Reuse Port Listen Test");
+
+    Tester t(s_allocator_p);
+    t.init(L_);
+
+    ListenOptions options(s_allocator_p);
+    options.properties().set(NtcListenerUtil::listenReusePortProperty(), 1);
+
+    // Concern 'a'
+    bsl::vector<bsl::string> listenHandles(s_allocator_p);
+    listenHandles.push_back("listen1Handle");
+    listenHandles.push_back("listen2Handle");
+    listenHandles.push_back("listen3Handle");
+
+    t.listen(L_, listenHandles[0], "127.0.0.1:0", options);
+    t.listen(L_, listenHandles[1], listenHandles[0], options);
+    t.listen(L_, listenHandles[2], listenHandles[0], options);
+
+    // Concern 'b'
+    const int k_NUM_CONNECTIONS = 16;
+    for (int i = 0; i < k_NUM_CONNECTIONS; ++i) {
+        mwcu::MemOutStream handleName(s_allocator_p);
+        mwcu::MemOutStream channelName(s_allocator_p);
+        handleName << "connect" << i << "Handle";
+        channelName << "connect" << i << "Channel";
+
+        t.connect(L_, handleName.str(), listenHandles[0]);
+        t.checkResultCallback(L_, handleName.str(), channelName.str());
+    }
+    t.checkNumResultCallbacks(L_, listenHandles, k_NUM_CONNECTIONS);
+
+    // Concern 'c'
+    t.listen(L_, "listen4Handle", listenHandles[0], CAT_GENERIC);
+}
+
 static void test6_preCreationCbTest()
 // ------------------------------------------------------------------------
 // PRE CREATION CB TEST
@@ -1327,6 +1608,8 @@ int main(int argc, char* argv[])
     case 4: test4_cancelHandleTest(); break;
     case 5: test5_visitChannelsTest(); break;
     case 6: test6_preCreationCbTest(); break;
+    case 7: test7_reusePortListenTest(); break;
+    case 8: test8_encryptionTest(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
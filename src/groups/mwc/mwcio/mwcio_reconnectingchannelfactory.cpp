@@ -18,6 +18,7 @@
 
 #include <mwcscm_version.h>
 // MWC
+#include <mwcio_ntcchannel.h>
 #include <mwcio_resolveutil.h>
 #include <mwcsys_time.h>
 #include <mwcu_memoutstream.h>
@@ -582,6 +583,16 @@ void ReconnectingChannelFactoryUtil::resolveEndpointFn(
     for (bdlb::TokenizerIterator endpointsIter = endpoints.begin();
          endpointsIter != endpoints.end();
          ++endpointsIter) {
+        if (bdlb::StringRefUtil::substr(
+                *endpointsIter,
+                0,
+                NtcChannelUtil::localEndpointPrefix().length()) ==
+            NtcChannelUtil::localEndpointPrefix()) {
+            // A local socket path, which has nothing to resolve
+            out->push_back(bsl::string(*endpointsIter, &arena));
+            continue;  // CONTINUE
+        }
+
         const size_t colonOffset = bdlb::StringRefUtil::findFirstOf(
             *endpointsIter,
             bslstl::StringRef(&k_HOSTPORT_SEPARATOR, 1));
@@ -342,7 +342,9 @@ struct ReconnectingChannelFactoryUtil {
     /// <host>:<port>[;<host>:<port>;...]
     /// ```
     /// Where each `host` will be resolved and expanded to all host it
-    /// potentially maps to.
+    /// potentially maps to.  A local endpoint, starting with
+    /// `NtcChannelUtil::localEndpointPrefix()`, names a socket path and is
+    /// loaded as is.
     static void resolveEndpointFn(bsl::vector<bsl::string>* out,
                                   const ConnectOptions&     options,
                                   char                      separator = ';');
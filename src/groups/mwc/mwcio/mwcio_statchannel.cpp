@@ -30,6 +30,37 @@
 namespace BloombergLP {
 namespace mwcio {
 
+// -------------------------
+// class StatChannelCounters
+// -------------------------
+
+// CREATORS
+StatChannelCounters::StatChannelCounters()
+: d_bytesIn(0)
+, d_bytesOut(0)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+void StatChannelCounters::fold(const mwcst::StatContext& context)
+{
+    // 'context' is snapshotting itself, and invokes this method from its
+    // (non-const) 'snapshot' method.
+    mwcst::StatContext& statContext = const_cast<mwcst::StatContext&>(
+        context);
+
+    const bsls::Types::Int64 bytesIn = d_bytesIn.swap(0);
+    if (bytesIn != 0) {
+        statContext.adjustValue(StatChannel::Stat::e_BYTES_IN, bytesIn);
+    }
+
+    const bsls::Types::Int64 bytesOut = d_bytesOut.swap(0);
+    if (bytesOut != 0) {
+        statContext.adjustValue(StatChannel::Stat::e_BYTES_OUT, bytesOut);
+    }
+}
+
 // -----------------------
 // class StatChannelConfig
 // -----------------------
@@ -41,6 +72,19 @@ StatChannelConfig::StatChannelConfig(
     BSLS_ANNOTATION_UNUSED bslma::Allocator* basicAllocator)
 : d_channel_sp(channel)
 , d_statContext_sp(statContext)
+, d_counters_sp()
+{
+    // NOTHING
+}
+
+StatChannelConfig::StatChannelConfig(
+    const bsl::shared_ptr<mwcio::Channel>&      channel,
+    const bsl::shared_ptr<mwcst::StatContext>&  statContext,
+    const bsl::shared_ptr<StatChannelCounters>& counters,
+    BSLS_ANNOTATION_UNUSED bslma::Allocator* basicAllocator)
+: d_channel_sp(channel)
+, d_statContext_sp(statContext)
+, d_counters_sp(counters)
 {
     // NOTHING
 }
@@ -50,6 +94,7 @@ StatChannelConfig::StatChannelConfig(
     BSLS_ANNOTATION_UNUSED bslma::Allocator* basicAllocator)
 : d_channel_sp(other.d_channel_sp)
 , d_statContext_sp(other.d_statContext_sp)
+, d_counters_sp(other.d_counters_sp)
 {
     // NOTHING
 }
@@ -68,7 +113,12 @@ void StatChannel::readCbWrapper(const Channel::ReadCallback& userCb,
     userCb(status, numNeeded, blob);
     if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(status &&
                                             (length > blob->length()))) {
-        d_config.d_statContext_sp->adjustValue(Stat::e_BYTES_IN, length);
+        if (d_config.d_counters_sp) {
+            d_config.d_counters_sp->addBytesIn(length);
+        }
+        else {
+            d_config.d_statContext_sp->adjustValue(Stat::e_BYTES_IN, length);
+        }
     }
 }
 
@@ -121,8 +171,13 @@ void StatChannel::write(Status*            status,
     d_config.d_channel_sp->write(status, blob, highWatermark);
 
     if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(*status)) {
-        d_config.d_statContext_sp->adjustValue(Stat::e_BYTES_OUT,
-                                               blob.length());
+        if (d_config.d_counters_sp) {
+            d_config.d_counters_sp->addBytesOut(blob.length());
+        }
+        else {
+            d_config.d_statContext_sp->adjustValue(Stat::e_BYTES_OUT,
+                                                   blob.length());
+        }
     }
 }
 
@@ -22,12 +22,20 @@
 //@CLASSES:
 // mwcio::StatChannel
 // mwcio::StatChannelConfig
+// mwcio::StatChannelCounters
 //
 //@SEE_ALSO:
 //
 //@DESCRIPTION: This component defines a mechanism, 'mwcio::StatChannel', which
 // is a concrete implementation of the 'mwcio::Channel' protocol that collects
 // stats.
+//
+// A 'mwcio::StatChannel' configured with 'mwcio::StatChannelCounters' counts
+// the bytes read and written in these counters, private to the channel,
+// rather than updating its stat context on every read and write, and the
+// counters are folded into the stat context when the latter is snapshotted
+// (see 'mwcio::StatChannelCounters::fold').  This spares the IO threads the
+// updates of stat contexts shared with other channels (e.g., their parent).
 
 // MWC
 
@@ -41,6 +49,7 @@
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_atomic.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
 
@@ -50,6 +59,48 @@ namespace mwcio {
 // FORWARD DECLARE
 class StatChannel;
 
+// =========================
+// class StatChannelCounters
+// =========================
+
+/// Counters of the bytes read and written by a `StatChannel` since they
+/// were last folded into its stat context.
+class StatChannelCounters {
+  private:
+    // DATA
+    bsls::AtomicInt64 d_bytesIn;
+    // bytes read since the last fold
+
+    bsls::AtomicInt64 d_bytesOut;
+    // bytes written since the last fold
+
+  private:
+    // NOT IMPLEMENTED
+    StatChannelCounters(const StatChannelCounters&);
+    StatChannelCounters& operator=(const StatChannelCounters&);
+
+  public:
+    // CREATORS
+
+    /// Create counters having no bytes.
+    StatChannelCounters();
+
+    // MANIPULATORS
+
+    /// Add the specified `value` to the bytes read.
+    void addBytesIn(bsls::Types::Int64 value);
+
+    /// Add the specified `value` to the bytes written.
+    void addBytesOut(bsls::Types::Int64 value);
+
+    /// Add to the values of the specified `context` the bytes read and
+    /// written since the last call, and reset the counters.  The behavior
+    /// is undefined unless this method is invoked as the pre-snapshot
+    /// callback of `context` (see
+    /// `mwcst::StatContextConfiguration::preSnapshotCallback`).
+    void fold(const mwcst::StatContext& context);
+};
+
 // =======================
 // class StatChannelConfig
 // =======================
@@ -64,6 +115,11 @@ class StatChannelConfig {
     bsl::shared_ptr<mwcst::StatContext> d_statContext_sp;
     // stat conext for this channel
 
+    bsl::shared_ptr<StatChannelCounters> d_counters_sp;
+    // counters folded into
+    // 'd_statContext_sp' when it is
+    // snapshotted, if any
+
     // FRIENDS
     friend class StatChannel;
 
@@ -76,6 +132,15 @@ class StatChannelConfig {
     StatChannelConfig(const bsl::shared_ptr<Channel>&            channel,
                       const bsl::shared_ptr<mwcst::StatContext>& statContext,
                       bslma::Allocator* basicAllocator = 0);
+
+    /// Create a configuration for the specified `channel` counting its
+    /// bytes in the specified `counters`, which are folded into the
+    /// specified `statContext` when it is snapshotted.  Optionally specify
+    /// a `basicAllocator` used to supply memory.
+    StatChannelConfig(const bsl::shared_ptr<Channel>&             channel,
+                      const bsl::shared_ptr<mwcst::StatContext>&  statContext,
+                      const bsl::shared_ptr<StatChannelCounters>& counters,
+                      bslma::Allocator* basicAllocator = 0);
     StatChannelConfig(const StatChannelConfig& other,
                       bslma::Allocator*        basicAllocator = 0);
 };
@@ -140,6 +205,25 @@ class StatChannel : public DecoratingChannelPartialImp {
                bsls::Types::Int64 highWatermark) BSLS_KEYWORD_OVERRIDE;
 };
 
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// -------------------------
+// class StatChannelCounters
+// -------------------------
+
+// MANIPULATORS
+inline void StatChannelCounters::addBytesIn(bsls::Types::Int64 value)
+{
+    d_bytesIn.addRelaxed(value);
+}
+
+inline void StatChannelCounters::addBytesOut(bsls::Types::Int64 value)
+{
+    d_bytesOut.addRelaxed(value);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
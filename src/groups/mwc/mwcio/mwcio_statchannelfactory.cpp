@@ -122,15 +122,26 @@ void StatChannelFactory::baseResultCallback(
         return;  // RETURN
     }
 
-    // Create a StatContext for this channel
+    // Create a StatContext for this channel, into which the counters of the
+    // channel are folded when it is snapshotted
+    bsl::shared_ptr<StatChannelCounters> counters;
+    counters.createInplace(handleSp->d_allocator_p);
+
     bsl::shared_ptr<mwcst::StatContext> statContext(
-        d_config.d_statContextCreator(channel, handleSp));
+        d_config.d_statContextCreator(
+            channel,
+            handleSp,
+            bdlf::BindUtil::bind(&StatChannelCounters::fold,
+                                 counters,
+                                 bdlf::PlaceHolders::_1)));  // context
     // Create the channel and notify user
     bsl::shared_ptr<StatChannel> newChannel;
-    newChannel.createInplace(
-        handleSp->d_allocator_p,
-        StatChannelConfig(channel, statContext, handleSp->d_allocator_p),
-        handleSp->d_allocator_p);
+    newChannel.createInplace(handleSp->d_allocator_p,
+                             StatChannelConfig(channel,
+                                               statContext,
+                                               counters,
+                                               handleSp->d_allocator_p),
+                             handleSp->d_allocator_p);
 
     handleSp->d_resultCallback(event, status, newChannel);
 }
@@ -76,10 +76,14 @@ class StatChannelFactoryConfig {
 
     /// Signature of the callback to create and return the statContext to be
     /// used for tracking stats of the specified `channel` obtained from the
-    /// specified `handle`.
+    /// specified `handle`.  The statContext must be configured with the
+    /// specified `preSnapshotCallback` (see
+    /// `mwcst::StatContextConfiguration::preSnapshotCallback`), which
+    /// folds the stats collected by the channel into the statContext.
     typedef bsl::function<bslma::ManagedPtr<mwcst::StatContext>(
         const bsl::shared_ptr<Channel>&                  channel,
-        const bsl::shared_ptr<StatChannelFactoryHandle>& handle)>
+        const bsl::shared_ptr<StatChannelFactoryHandle>& handle,
+        const mwcst::StatContext::SnapshotCallback&      preSnapshotCallback)>
         StatContextCreatorFn;
 
   private:
@@ -29,6 +29,7 @@
 #include <balst_stacktraceprintutil.h>
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
+#include <bdlb_bitutil.h>
 #include <bsls_alignmentutil.h>
 #include <bsls_annotation.h>
 #include <bsls_assert.h>
@@ -88,6 +89,11 @@ union Header {
         // checks.  Since we're union'ed with
         // 'MaxAlignedType' this doesn't add
         // anything to the header size.
+
+        unsigned int d_sampleWeight;
+        // Weight with which this allocation
+        // was reported to the stat context,
+        // or 0 if it was not sampled.
     } d_data;
 
     bsls::AlignmentUtil::MaxAlignedType d_dummy;
@@ -96,6 +102,34 @@ union Header {
 
 }  // close unnamed namespace
 
+// -----------------------------
+// class CountingAllocator_Shard
+// -----------------------------
+
+// CREATORS
+CountingAllocator_Shard::CountingAllocator_Shard()
+: d_pendingBytes(0)
+, d_numAllocations(0)
+{
+}
+
+CountingAllocator_Shard::CountingAllocator_Shard(
+    const CountingAllocator_Shard& other)
+: d_pendingBytes(other.d_pendingBytes.loadRelaxed())
+, d_numAllocations(other.d_numAllocations.loadRelaxed())
+{
+}
+
+// MANIPULATORS
+CountingAllocator_Shard&
+CountingAllocator_Shard::operator=(const CountingAllocator_Shard& rhs)
+{
+    d_pendingBytes.storeRelaxed(rhs.d_pendingBytes.loadRelaxed());
+    d_numAllocations.storeRelaxed(rhs.d_numAllocations.loadRelaxed());
+
+    return *this;
+}
+
 // -----------------------
 // class CountingAllocator
 // -----------------------
@@ -187,8 +221,13 @@ void CountingAllocator::onAllocationChange(bsls::Types::Int64 deltaValue)
     const bsls::Types::Uint64 totalAllocated = d_allocated.addRelaxed(
         deltaValue);
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(totalAllocated >
-                                              d_allocationLimit)) {
+    // With thread-local counting, the deallocations of a thread may be
+    // flushed before the allocations of another thread they free, so that
+    // the total is transiently negative: it must not be mistaken for a huge
+    // allocation.
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            totalAllocated > d_allocationLimit &&
+            static_cast<bsls::Types::Int64>(totalAllocated) > 0)) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
         const bsls::Types::Uint64 uint64Max =
             bsl::numeric_limits<bsls::Types::Uint64>::max();
@@ -210,6 +249,36 @@ void CountingAllocator::onAllocationChange(bsls::Types::Int64 deltaValue)
     }
 }
 
+void CountingAllocator::countAllocationChange(bsls::Types::Int64 deltaValue)
+{
+    if (d_shards.empty()) {
+        onAllocationChange(deltaValue);
+        return;  // RETURN
+    }
+
+    CountingAllocator_Shard& localShard = shard();
+
+    const bsls::Types::Int64 pendingBytes =
+        localShard.d_pendingBytes.addRelaxed(deltaValue);
+    if (pendingBytes >= d_flushThreshold ||
+        pendingBytes <= -d_flushThreshold) {
+        // Another writer of the shard may flush it concurrently, in which
+        // case this one flushes whatever was accumulated since.
+        onAllocationChange(localShard.d_pendingBytes.swap(0));
+    }
+}
+
+void CountingAllocator::flushShards()
+{
+    for (size_t i = 0; i < d_shards.size(); ++i) {
+        const bsls::Types::Int64 pendingBytes =
+            d_shards[i].d_pendingBytes.swap(0);
+        if (pendingBytes != 0) {
+            onAllocationChange(pendingBytes);
+        }
+    }
+}
+
 CountingAllocator::CountingAllocator(const bslstl::StringRef& name,
                                      bslma::Allocator*        allocator)
 : d_statContext_mp()
@@ -218,6 +287,9 @@ CountingAllocator::CountingAllocator(const bslstl::StringRef& name,
 , d_allocated(0)
 , d_allocationLimit(bsl::numeric_limits<bsls::Types::Uint64>::max())
 // Disable allocation limit by default
+, d_shards(allocator)
+, d_flushThreshold(0)
+, d_samplingMask(0)
 {
     CountingAllocator* ca = dynamic_cast<CountingAllocator*>(d_allocator_p);
     if (ca) {
@@ -226,6 +298,9 @@ CountingAllocator::CountingAllocator(const bslstl::StringRef& name,
             d_statContext_mp = ca->d_statContext_mp->addSubcontext(
                 mwcst::StatContextConfiguration(name, allocator));
             d_parentCounting_p = ca;
+            d_shards.resize(ca->d_shards.size());
+            d_flushThreshold = ca->d_flushThreshold;
+            d_samplingMask   = ca->d_samplingMask;
         }
     }
 }
@@ -239,12 +314,18 @@ CountingAllocator::CountingAllocator(const bslstl::StringRef& name,
 , d_allocated(0)
 , d_allocationLimit(bsl::numeric_limits<bsls::Types::Uint64>::max())
 // Disable allocation limit by default
+, d_shards(allocator)
+, d_flushThreshold(0)
+, d_samplingMask(0)
 {
     CountingAllocator* ca = dynamic_cast<CountingAllocator*>(d_allocator_p);
     if (ca) {
         // The 'allocator' is a 'CountingAllocator'
         d_allocator_p      = ca->d_allocator_p;
         d_parentCounting_p = ca;
+        d_shards.resize(ca->d_shards.size());
+        d_flushThreshold = ca->d_flushThreshold;
+        d_samplingMask   = ca->d_samplingMask;
     }
 
     if (parentStatContext) {
@@ -265,7 +346,8 @@ CountingAllocator::CountingAllocator(const bslstl::StringRef& name,
 
 CountingAllocator::~CountingAllocator()
 {
-    // NOTHING
+    // Keep the totals of the parents consistent with the blocks freed.
+    flushShards();
 }
 
 // MANIPULATORS
@@ -281,6 +363,30 @@ void CountingAllocator::setAllocationLimit(
     d_allocationLimit   = limit;
 }
 
+void CountingAllocator::setThreadLocalCounting(
+    int                numShards,
+    bsls::Types::Int64 flushThreshold,
+    int                samplingPeriod)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(0 <= numShards);
+    BSLS_ASSERT(0 <= flushThreshold);
+    BSLS_ASSERT(0 < samplingPeriod);
+    BSLS_ASSERT(0 < numShards || 1 == samplingPeriod);
+
+    flushShards();
+
+    d_shards.clear();
+    if (numShards > 0) {
+        d_shards.resize(bdlb::BitUtil::roundUpToBinaryPower(
+            static_cast<bsl::uint32_t>(numShards)));
+    }
+    d_flushThreshold = flushThreshold;
+    d_samplingMask   = bdlb::BitUtil::roundUpToBinaryPower(
+                         static_cast<bsl::uint32_t>(samplingPeriod)) -
+                     1;
+}
+
 void* CountingAllocator::allocate(size_type size)
 {
     // PRECONDITIONS
@@ -304,13 +410,26 @@ void* CountingAllocator::allocate(size_type size)
     const bsls::Types::Int64 totalSize =
         bsls::AlignmentUtil::roundUpToMaximalAlignment(size) + sizeof(Header);
     BSLS_ASSERT_SAFE(totalSize >= 0);
-    d_statContext_mp->adjustValue(0, totalSize);
+
+    // Report one out of every 'samplingPeriod' allocations, weighted by
+    // 'samplingPeriod', to the stat context.
+    unsigned int sampleWeight = 1;
+    if (d_samplingMask != 0) {
+        sampleWeight = (shard().d_numAllocations.addRelaxed(1) &
+                        d_samplingMask) == 0
+                           ? d_samplingMask + 1
+                           : 0;
+    }
+    if (sampleWeight != 0) {
+        d_statContext_mp->adjustValue(0, totalSize * sampleWeight);
+    }
 
     Header* header = static_cast<Header*>(d_allocator_p->allocate(totalSize));
     header->d_data.d_numAllocatedBytes = totalSize;
     header->d_data.d_magic             = k_MAGIC;
+    header->d_data.d_sampleWeight      = sampleWeight;
 
-    onAllocationChange(totalSize);
+    countAllocationChange(totalSize);
 
     return header + 1;
 }
@@ -356,11 +475,16 @@ void CountingAllocator::deallocate(void* address)
 
     const CountingAllocator::size_type totalSize =
         header->d_data.d_numAllocatedBytes;
-    header->d_data.d_magic = ~k_MAGIC;
+    const unsigned int sampleWeight = header->d_data.d_sampleWeight;
+    header->d_data.d_magic          = ~k_MAGIC;
     d_allocator_p->deallocate(header);
 
-    d_statContext_mp->adjustValue(0, -totalSize);
-    onAllocationChange(-totalSize);
+    if (sampleWeight != 0) {
+        d_statContext_mp->adjustValue(
+            0,
+            -static_cast<bsls::Types::Int64>(totalSize) * sampleWeight);
+    }
+    countAllocationChange(-totalSize);
 }
 
 }  // close package namespace
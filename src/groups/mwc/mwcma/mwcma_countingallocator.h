@@ -63,6 +63,37 @@
 //: o each CountingAllocator now has a slightly bigger memory footprint, which
 //:   should be fine as we usually only instantiate a small handful of such
 //:   objects
+//
+/// Thread-Local Counting
+///---------------------
+// By default, each allocation and deallocation updates the stat context of
+// the allocator, and the total of the allocator and of each of its parents,
+// which are atomic variables shared by all the threads using the allocators.
+// At high allocation rates, this accounting, and the contention on those
+// variables, becomes noticeable.  'setThreadLocalCounting' configures the
+// allocator to instead:
+//: o accumulate the bytes allocated and deallocated into a number of
+//:   writer-local shards, each on its own cache line, each thread using the
+//:   shard selected by its thread id; a shard is only flushed to the total of
+//:   the allocator, and propagated to its parents, once the absolute value of
+//:   its pending delta reaches a 'flushThreshold' number of bytes, so that
+//:   the hierarchy is only walked once every few allocations.  The allocation
+//:   limit is then only checked on flush, and may be exceeded by up to
+//:   'numShards * flushThreshold' bytes per level of the hierarchy before
+//:   being detected.
+//: o optionally, only report to the stat context one out of every
+//:   'samplingPeriod' allocations, weighted by 'samplingPeriod', with the
+//:   deallocation of a sampled block reporting the same weighted size.  The
+//:   bytes allocated reported by the stat context are then an unbiased
+//:   estimate of the actual bytes allocated, and the number of allocations
+//:   and deallocations are those of the sampled blocks only.
+//
+// Allocators created from an allocator configured for thread-local counting
+// inherit its configuration, so configuring the top allocator of a hierarchy
+// before creating its children configures the whole hierarchy.  Note that
+// the updates of the stat contexts themselves can also be sharded, by
+// configuring the parent stat context of the hierarchy with
+// 'mwcst::StatContextConfiguration::numWriterShards'.
 
 // MWC
 
@@ -73,12 +104,15 @@
 #include <bsl_functional.h>
 #include <bsl_map.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_istriviallycopyable.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+#include <bsls_assert.h>
 #include <bsls_atomic.h>
 #include <bsls_keyword.h>
 #include <bsls_types.h>
@@ -101,6 +135,51 @@ class BasicTableInfoProvider;
 
 namespace mwcma {
 
+// ============================
+// class CountingAllocator_Shard
+// ============================
+
+/// Writer-local accumulator of the allocations made through a
+/// `CountingAllocator` configured for thread-local counting.  The object is
+/// padded so that the accumulators of two distinct shards stored
+/// contiguously never share a cache line.
+class CountingAllocator_Shard {
+  private:
+    // PRIVATE TYPES
+    enum {
+        // Size of the object, large enough for the accumulators of two
+        // contiguous shards to be on distinct cache lines, whatever the
+        // alignment of the first one.
+        k_SIZE = 128,
+
+        // Size of the accumulators
+        k_DATA_SIZE = sizeof(bsls::Types::Int64) + sizeof(unsigned int)
+    };
+
+    // DATA
+
+    // Bytes allocated minus bytes deallocated by the writers of this shard,
+    // not yet flushed to the total of the allocator.
+    bsls::AtomicInt64 d_pendingBytes;
+
+    // Number of allocations made by the writers of this shard, used to
+    // select the sampled allocations.
+    bsls::AtomicUint d_numAllocations;
+
+    char d_padding[k_SIZE - k_DATA_SIZE];
+
+    // FRIENDS
+    friend class CountingAllocator;
+
+  public:
+    // CREATORS
+    CountingAllocator_Shard();
+    CountingAllocator_Shard(const CountingAllocator_Shard& other);
+
+    // MANIPULATORS
+    CountingAllocator_Shard& operator=(const CountingAllocator_Shard& rhs);
+};
+
 // =======================
 // class CountingAllocator
 // =======================
@@ -158,6 +237,24 @@ class CountingAllocator BSLS_KEYWORD_FINAL : public bslma::Allocator {
     // invoked at most once, the first
     // time only the limit is breached.
 
+    bsl::vector<CountingAllocator_Shard> d_shards;
+    // Writer-local accumulators of the
+    // bytes allocated, empty unless
+    // thread-local counting is enabled.
+
+    bsls::Types::Int64 d_flushThreshold;
+    // Absolute value of the pending
+    // bytes of a shard from which the
+    // shard is flushed to 'd_allocated'.
+
+    unsigned int d_samplingMask;
+    // Sampling period minus 1, the
+    // sampling period being a power of
+    // 2: an allocation is reported to
+    // the stat context if the number
+    // of allocations of its shard
+    // masked with it is 0.
+
   private:
     // NOT IMPLEMENTED
     CountingAllocator(const CountingAllocator&) BSLS_KEYWORD_DELETED;
@@ -196,6 +293,20 @@ class CountingAllocator BSLS_KEYWORD_FINAL : public bslma::Allocator {
     /// deallocation).
     void onAllocationChange(bsls::Types::Int64 deltaValue);
 
+    /// Account for the specified `deltaValue` bytes allocated by this
+    /// object, either directly in the total of this object and its parents,
+    /// or in the shard of the calling thread if thread-local counting is
+    /// enabled.
+    void countAllocationChange(bsls::Types::Int64 deltaValue);
+
+    /// Flush the pending bytes of all the shards of this object to the
+    /// total of this object and of its parents.
+    void flushShards();
+
+    /// Return the shard of the calling thread.  The behavior is undefined
+    /// unless thread-local counting is enabled.
+    CountingAllocator_Shard& shard();
+
   public:
     // CREATORS
 
@@ -204,7 +315,8 @@ class CountingAllocator BSLS_KEYWORD_FINAL : public bslma::Allocator {
     /// supply memory.  If `allocator` is 0, the currently installed default
     /// allocator is used.  If `allocator` is itself a counting allocator,
     /// the stat context is created as a child of the stat context of
-    /// `allocator`; otherwise, no stat context is created.
+    /// `allocator`, and this object inherits the thread-local counting
+    /// configuration of `allocator`; otherwise, no stat context is created.
     CountingAllocator(const bslstl::StringRef& name,
                       bslma::Allocator*        allocator = 0);
 
@@ -213,7 +325,9 @@ class CountingAllocator BSLS_KEYWORD_FINAL : public bslma::Allocator {
     /// specify an `allocator` used to supply memory.  If `allocator` is 0,
     /// the currently installed default allocator is used.  If `context` is
     /// not a null pointer, the stat context is created as a child of
-    /// `context`; otherwise no stat context is created.
+    /// `context`; otherwise no stat context is created.  If `allocator` is
+    /// itself a counting allocator, this object inherits its thread-local
+    /// counting configuration.
     CountingAllocator(const bslstl::StringRef& name,
                       mwcst::StatContext*      parentStatContext,
                       bslma::Allocator*        allocator = 0);
@@ -230,6 +344,24 @@ class CountingAllocator BSLS_KEYWORD_FINAL : public bslma::Allocator {
     void setAllocationLimit(bsls::Types::Uint64            limit,
                             const AllocationLimitCallback& callback);
 
+    /// Enable thread-local counting, accumulating the bytes allocated by
+    /// this object into the specified `numShards` writer-local shards,
+    /// rounded up to a power of 2, each flushed to the total of this object
+    /// and of its parents once the absolute value of its pending bytes
+    /// reaches the specified `flushThreshold`, and reporting to the stat
+    /// context one out of every specified `samplingPeriod` allocations,
+    /// rounded up to a power of 2.  If `numShards` is 0, disable
+    /// thread-local counting.  Allocators created from this object after
+    /// this call inherit this configuration.  The behavior is undefined
+    /// unless `0 <= numShards`, `0 <= flushThreshold`, `0 < samplingPeriod`
+    /// and `0 < numShards || 1 == samplingPeriod`.  Note that this method
+    /// is not thread-safe and should be called on the allocator prior to
+    /// its usage.  See "Thread-Local Counting" in the component
+    /// documentation.
+    void setThreadLocalCounting(int                numShards,
+                                bsls::Types::Int64 flushThreshold,
+                                int                samplingPeriod = 1);
+
     //  (virtual bslma::Allocator)
 
     /// Return a newly allocated block of memory of (at least) the specified
@@ -267,6 +399,19 @@ class CountingAllocator BSLS_KEYWORD_FINAL : public bslma::Allocator {
 // class CountingAllocator
 // -----------------------
 
+// PRIVATE MANIPULATORS
+inline CountingAllocator_Shard& CountingAllocator::shard()
+{
+    BSLS_ASSERT_SAFE(!d_shards.empty());
+
+    // Thread ids are typically aligned addresses: mix the bits so that the
+    // selected shard depends on all of them.
+    const bsls::Types::Uint64 hash = bslmt::ThreadUtil::selfIdAsUint64() *
+                                     0x9E3779B97F4A7C15ULL;
+
+    return d_shards[static_cast<size_t>(hash >> 32) & (d_shards.size() - 1)];
+}
+
 // ACCESSORS
 //   (specific to mwcma::CountingAllocator)
 inline const mwcst::StatContext* CountingAllocator::context() const
@@ -20,6 +20,7 @@
 #include <mwcst_basictableinfoprovider.h>
 #include <mwcst_statcontext.h>
 #include <mwcst_statcontexttableinfoprovider.h>
+#include <mwcst_statutil.h>
 #include <mwcst_statvalue.h>
 #include <mwcst_table.h>
 #include <mwctst_scopedlogobserver.h>
@@ -529,6 +530,143 @@ static void test7_configureStatContextTableInfoProvider_part2()
     }
 }
 
+static void test8_threadLocalCounting()
+// ------------------------------------------------------------------------
+// THREAD-LOCAL COUNTING
+//
+// Concerns:
+//   1. With thread-local counting, the allocation limit is only checked
+//      once the pending bytes of a shard reach the flush threshold.
+//   2. With sampling, only one out of every 'samplingPeriod' allocations
+//      is reported to the stat context, weighted by 'samplingPeriod', and
+//      the deallocation of a sampled block reports the same weighted size.
+//   3. Allocators created from a configured allocator inherit its
+//      configuration.
+//
+// Testing:
+//   setThreadLocalCounting
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("THREAD-LOCAL COUNTING");
+
+    typedef mwcst::StatUtil SU;
+
+    /// Increment the integer at the specified `value`
+    struct local {
+        static void incrementInteger(int* value) { ++(*value); }
+    };
+
+    // Each allocation of 112 bytes, a multiple of the maximal alignment,
+    // uses 128 bytes once accounting for the header.
+    const bsls::Types::Int64 k_SIZE_ALLOC = 112;
+    const bsls::Types::Int64 k_SIZE_BLOCK = 128;
+    const int                k_NUM_ALLOCS = 8;
+    void*                    allocs[k_NUM_ALLOCS];
+
+    {
+        PV("Allocation limit is checked when a shard is flushed");
+
+        int                cbInvocationCount = 0;
+        mwcst::StatContext statContext(
+            mwcst::StatContextConfiguration("myAllocatorStatContext",
+                                            s_allocator_p),
+            s_allocator_p);
+        mwcma::CountingAllocator obj("Test", &statContext, s_allocator_p);
+
+        obj.setAllocationLimit(1024,
+                               bdlf::BindUtil::bind(local::incrementInteger,
+                                                    &cbInvocationCount));
+        obj.setThreadLocalCounting(4, 4096);
+
+        // 8 * 128 bytes reach the limit but not the flush threshold
+        for (int i = 0; i < k_NUM_ALLOCS; ++i) {
+            allocs[i] = obj.allocate(k_SIZE_ALLOC);
+        }
+        ASSERT_EQ(cbInvocationCount, 0);
+
+        // Reaching the flush threshold notifies the limit
+        void* big = obj.allocate(4096);
+        ASSERT_EQ(cbInvocationCount, 1);
+
+        // The stat context is exactly updated without sampling
+        statContext.snapshot();
+        const mwcst::StatValue& value = obj.context()->value(
+            mwcst::StatContext::DMCST_DIRECT_VALUE,
+            0);
+        ASSERT_EQ(SU::value(value, 0),
+                  k_NUM_ALLOCS * k_SIZE_BLOCK + 4096 +
+                      (k_SIZE_BLOCK - k_SIZE_ALLOC));
+        ASSERT_EQ(SU::increments(value, 0), k_NUM_ALLOCS + 1);
+
+        obj.deallocate(big);
+        for (int i = 0; i < k_NUM_ALLOCS; ++i) {
+            obj.deallocate(allocs[i]);
+        }
+    }
+
+    {
+        PV("Sampled allocations are weighted by the sampling period");
+
+        mwcst::StatContext statContext(
+            mwcst::StatContextConfiguration("myAllocatorStatContext",
+                                            s_allocator_p),
+            s_allocator_p);
+        mwcma::CountingAllocator obj("Test", &statContext, s_allocator_p);
+
+        // A single shard makes the sampled allocations deterministic.
+        obj.setThreadLocalCounting(1, 0, 4);
+
+        // The child inherits the configuration of its parent.  Its creation
+        // allocates from 'obj', whose shards are then reset so that the
+        // sampling of the allocations below starts afresh.
+        mwcma::CountingAllocator child("Child", &obj);
+        obj.setThreadLocalCounting(1, 0, 4);
+
+        statContext.snapshot();
+        const mwcst::StatValue& value = obj.context()->value(
+            mwcst::StatContext::DMCST_DIRECT_VALUE,
+            0);
+        const mwcst::StatValue& childValue = child.context()->value(
+            mwcst::StatContext::DMCST_DIRECT_VALUE,
+            0);
+        const bsls::Types::Int64 baseValue      = SU::value(value, 0);
+        const bsls::Types::Int64 baseIncrements = SU::increments(value, 0);
+        const bsls::Types::Int64 baseDecrements = SU::decrements(value, 0);
+
+        for (int i = 0; i < k_NUM_ALLOCS; ++i) {
+            allocs[i] = obj.allocate(k_SIZE_ALLOC);
+        }
+        void* childAlloc[4];
+        for (int i = 0; i < 4; ++i) {
+            childAlloc[i] = child.allocate(k_SIZE_ALLOC);
+        }
+
+        statContext.snapshot();
+
+        // 2 of the 8 allocations are sampled, each weighted by 4.
+        ASSERT_EQ(SU::value(value, 0) - baseValue,
+                  k_NUM_ALLOCS * k_SIZE_BLOCK);
+        ASSERT_EQ(SU::increments(value, 0) - baseIncrements, 2);
+
+        // 1 of the 4 allocations of the child is sampled.
+        ASSERT_EQ(SU::value(childValue, 0), 4 * k_SIZE_BLOCK);
+        ASSERT_EQ(SU::increments(childValue, 0), 1);
+
+        for (int i = 0; i < k_NUM_ALLOCS; ++i) {
+            obj.deallocate(allocs[i]);
+        }
+        for (int i = 0; i < 4; ++i) {
+            child.deallocate(childAlloc[i]);
+        }
+
+        statContext.snapshot();
+        ASSERT_EQ(SU::value(value, 0), baseValue);
+        ASSERT_EQ(SU::decrements(value, 0) - baseDecrements, 2);
+        ASSERT_EQ(SU::value(childValue, 0), 0);
+        ASSERT_EQ(SU::decrements(childValue, 0), 1);
+    }
+}
+
 BSLA_MAYBE_UNUSED
 static void testN1_performance_allocation()
 // ------------------------------------------------------------------------
@@ -757,6 +895,7 @@ int main(int argc, char** argv)
 
     switch (_testCase) {
     case 0:
+    case 8: test8_threadLocalCounting(); break;
     case 7: test7_configureStatContextTableInfoProvider_part2(); break;
     case 6: test6_configureStatContextTableInfoProvider_part1(); break;
     case 5: test5_allocationLimitHierarchical(); break;
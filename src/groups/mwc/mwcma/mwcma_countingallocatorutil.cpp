@@ -67,6 +67,20 @@ bsls::AtomicBool g_initialized(false);
 void CountingAllocatorUtil::initGlobalAllocators(
     const mwcst::StatContextConfiguration& globalStatContextConfiguration,
     const bslstl::StringRef&               topAllocatorName)
+{
+    initGlobalAllocators(globalStatContextConfiguration,
+                         topAllocatorName,
+                         0,
+                         0,
+                         1);
+}
+
+void CountingAllocatorUtil::initGlobalAllocators(
+    const mwcst::StatContextConfiguration& globalStatContextConfiguration,
+    const bslstl::StringRef&               topAllocatorName,
+    int                                    numShards,
+    bsls::Types::Int64                     flushThreshold,
+    int                                    samplingPeriod)
 {
     // PRECONDITIONS
     BSLS_ASSERT_OPT(g_initialized.testAndSwap(false, true) != true);
@@ -83,8 +97,14 @@ void CountingAllocatorUtil::initGlobalAllocators(
     new (g_topAllocator.buffer())
         mwcma::CountingAllocator(topAllocatorName, &stats, alloc);
 
-    // Create the topAllocatorStore and the default and global allocators
+    // Configure the top allocator before creating its children, which
+    // inherit its configuration.
     mwcma::CountingAllocator& topAllocator = g_topAllocator.object();
+    topAllocator.setThreadLocalCounting(numShards,
+                                        flushThreshold,
+                                        samplingPeriod);
+
+    // Create the topAllocatorStore and the default and global allocators
     new (g_topAllocatorStore.buffer())
         mwcma::CountingAllocatorStore(&topAllocator);
 
@@ -37,6 +37,7 @@
 // BDE
 #include <bsl_iosfwd.h>
 #include <bsl_string.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 
@@ -78,6 +79,18 @@ struct CountingAllocatorUtil {
     initGlobalAllocators(const bslstl::StringRef& globalStatContextName,
                          const bslstl::StringRef& topAllocatorName);
 
+    /// Set the global and default allocators as above, with the top
+    /// counting allocator, and therefore all the counting allocators
+    /// created from it, configured for thread-local counting with the
+    /// specified `numShards`, `flushThreshold` and `samplingPeriod`.  See
+    /// `mwcma::CountingAllocator::setThreadLocalCounting`.
+    static void initGlobalAllocators(
+        const mwcst::StatContextConfiguration& globalStatContextConfiguration,
+        const bslstl::StringRef&               topAllocatorName,
+        int                                    numShards,
+        bsls::Types::Int64                     flushThreshold,
+        int                                    samplingPeriod);
+
     /// Return the stat context created by `initGlobalAllocators`.  The
     /// behavior is undefined unless `initGlobalAllocators` has been called.
     static mwcst::StatContext* globalStatContext();
@@ -0,0 +1,446 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcma_threadcachedblobbufferfactory.cpp                            -*-C++-*-
+#include <mwcma_threadcachedblobbufferfactory.h>
+
+#include <mwcscm_version.h>
+// BDE
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_memory.h>
+#include <bsl_typeinfo.h>
+#include <bslma_default.h>
+#include <bslma_sharedptrrep.h>
+#include <bslmt_lockguard.h>
+#include <bsls_alignmentutil.h>
+#include <bsls_annotation.h>
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <sys/mman.h>
+#endif
+
+namespace BloombergLP {
+namespace mwcma {
+
+// =======================================
+// class ThreadCachedBlobBufferFactory_Rep
+// =======================================
+
+/// Shared pointer representation of a buffer dispensed by a
+/// `ThreadCachedBlobBufferFactory`, preceding the buffer in memory, and
+/// returning it to the factory once no longer referenced.
+class ThreadCachedBlobBufferFactory_Rep BSLS_KEYWORD_FINAL
+: public bslma::SharedPtrRep {
+  private:
+    // DATA
+    ThreadCachedBlobBufferFactory* d_factory_p;
+    // Factory the buffer belongs to.
+
+    ThreadCachedBlobBufferFactory_Rep* d_next_p;
+    // Next free buffer of the magazine
+    // holding this one, if free.
+
+    // FRIENDS
+    friend class ThreadCachedBlobBufferFactory;
+    friend class ThreadCachedBlobBufferFactory_Cache;
+
+  public:
+    // CREATORS
+    explicit ThreadCachedBlobBufferFactory_Rep(
+        ThreadCachedBlobBufferFactory* factory);
+
+    // MANIPULATORS
+
+    /// Do nothing: the buffer is a character array.
+    void disposeObject() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return this object and its buffer to the factory.
+    void disposeRep() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return 0: the buffer has no deleter.
+    void* getDeleter(const std::type_info& type) BSLS_KEYWORD_OVERRIDE;
+
+    // ACCESSORS
+
+    /// Return the address of the buffer.
+    void* originalPtr() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the address of the buffer.
+    char* buffer() const;
+};
+
+// =========================================
+// class ThreadCachedBlobBufferFactory_Cache
+// =========================================
+
+/// Free buffers of a thread using a `ThreadCachedBlobBufferFactory`.
+class ThreadCachedBlobBufferFactory_Cache {
+  private:
+    // PRIVATE TYPES
+    typedef ThreadCachedBlobBufferFactory::Magazine Magazine;
+
+    // DATA
+    ThreadCachedBlobBufferFactory* d_factory_p;
+    // Factory this cache belongs to.
+
+    Magazine d_loaded;
+    // Magazine buffers are allocated from
+    // and released to.
+
+    Magazine d_previous;
+    // Either empty or full magazine
+    // absorbing bursts of allocations or
+    // deallocations.
+
+    // FRIENDS
+    friend class ThreadCachedBlobBufferFactory;
+
+  public:
+    // CLASS METHODS
+
+    /// Release the cache at the specified `cache` to its factory.  Invoked
+    /// when the thread owning the cache exits.
+    static void onThreadExit(void* cache);
+
+    // CREATORS
+    explicit ThreadCachedBlobBufferFactory_Cache(
+        ThreadCachedBlobBufferFactory* factory);
+};
+
+namespace {
+
+// FUNCTIONS
+extern "C" void threadCachedBlobBufferFactoryThreadExit(void* cache)
+{
+    ThreadCachedBlobBufferFactory_Cache::onThreadExit(cache);
+}
+
+}  // close unnamed namespace
+
+// ---------------------------------------
+// class ThreadCachedBlobBufferFactory_Rep
+// ---------------------------------------
+
+// CREATORS
+ThreadCachedBlobBufferFactory_Rep::ThreadCachedBlobBufferFactory_Rep(
+    ThreadCachedBlobBufferFactory* factory)
+: d_factory_p(factory)
+, d_next_p(0)
+{
+}
+
+// MANIPULATORS
+void ThreadCachedBlobBufferFactory_Rep::disposeObject()
+{
+    // NOTHING
+}
+
+void ThreadCachedBlobBufferFactory_Rep::disposeRep()
+{
+    d_factory_p->releaseBuffer(this);
+}
+
+void* ThreadCachedBlobBufferFactory_Rep::getDeleter(
+    BSLS_ANNOTATION_UNUSED const std::type_info& type)
+{
+    return 0;
+}
+
+// ACCESSORS
+void* ThreadCachedBlobBufferFactory_Rep::originalPtr() const
+{
+    return buffer();
+}
+
+char* ThreadCachedBlobBufferFactory_Rep::buffer() const
+{
+    return const_cast<char*>(reinterpret_cast<const char*>(this)) +
+           d_factory_p->d_repSize;
+}
+
+// -----------------------------------------
+// class ThreadCachedBlobBufferFactory_Cache
+// -----------------------------------------
+
+// CLASS METHODS
+void ThreadCachedBlobBufferFactory_Cache::onThreadExit(void* cache)
+{
+    ThreadCachedBlobBufferFactory_Cache* self =
+        static_cast<ThreadCachedBlobBufferFactory_Cache*>(cache);
+    self->d_factory_p->releaseCache(self);
+}
+
+// CREATORS
+ThreadCachedBlobBufferFactory_Cache::ThreadCachedBlobBufferFactory_Cache(
+    ThreadCachedBlobBufferFactory* factory)
+: d_factory_p(factory)
+, d_loaded()
+, d_previous()
+{
+}
+
+// ---------------------------------------------
+// struct ThreadCachedBlobBufferFactory::Magazine
+// ---------------------------------------------
+
+// CREATORS
+ThreadCachedBlobBufferFactory::Magazine::Magazine()
+: d_head_p(0)
+, d_numBuffers(0)
+{
+}
+
+// -----------------------------------
+// class ThreadCachedBlobBufferFactory
+// -----------------------------------
+
+// CONSTANTS
+const int ThreadCachedBlobBufferFactory::k_DEFAULT_MAGAZINE_SIZE;
+
+// PRIVATE CLASS METHODS
+void ThreadCachedBlobBufferFactory::push(Magazine* magazine, Rep* rep)
+{
+    rep->d_next_p      = magazine->d_head_p;
+    magazine->d_head_p = rep;
+    ++magazine->d_numBuffers;
+}
+
+// PRIVATE MANIPULATORS
+ThreadCachedBlobBufferFactory::Cache*
+ThreadCachedBlobBufferFactory::localCache()
+{
+    Cache* cache = static_cast<Cache*>(
+        bslmt::ThreadUtil::getSpecific(d_cacheKey));
+    if (cache) {
+        return cache;  // RETURN
+    }
+
+    // First use of this factory by the calling thread
+    cache = new (*d_allocator_p) Cache(this);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_depotMutex);  // LOCK
+        d_caches.push_back(cache);
+    }
+
+    const int rc = bslmt::ThreadUtil::setSpecific(d_cacheKey, cache);
+    BSLS_ASSERT_OPT(rc == 0);
+    (void)rc;
+
+    return cache;
+}
+
+ThreadCachedBlobBufferFactory::Magazine
+ThreadCachedBlobBufferFactory::newMagazine()
+{
+    Chunk chunk;
+    chunk.d_size      = d_blockSize * d_magazineSize;
+    chunk.d_address_p = 0;
+    chunk.d_isMapped  = false;
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+    if (d_backingMemory == e_NUMA_LOCAL) {
+        void* address = mmap(0,
+                             chunk.d_size,
+                             PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS,
+                             -1,
+                             0);
+        if (address != MAP_FAILED) {
+            // Fault in all the pages of the chunk from this thread, so that
+            // they are placed on its NUMA node.
+            bsl::memset(address, 0, chunk.d_size);
+
+            chunk.d_address_p = address;
+            chunk.d_isMapped  = true;
+        }
+    }
+#endif
+
+    if (!chunk.d_address_p) {
+        chunk.d_address_p = d_allocator_p->allocate(chunk.d_size);
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_depotMutex);  // LOCK
+        d_chunks.push_back(chunk);
+    }
+    d_numBytesReserved.addRelaxed(chunk.d_size);
+
+    Magazine magazine;
+    char*    block = static_cast<char*>(chunk.d_address_p);
+    for (int i = 0; i < d_magazineSize; ++i, block += d_blockSize) {
+        push(&magazine, new (block) Rep(this));
+    }
+
+    return magazine;
+}
+
+void ThreadCachedBlobBufferFactory::releaseCache(Cache* cache)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_depotMutex);  // LOCK
+
+        if (cache->d_loaded.d_numBuffers != 0) {
+            d_depot.push_back(cache->d_loaded);
+        }
+        if (cache->d_previous.d_numBuffers != 0) {
+            d_depot.push_back(cache->d_previous);
+        }
+
+        d_caches.erase(bsl::find(d_caches.begin(), d_caches.end(), cache));
+    }
+
+    d_allocator_p->deleteObject(cache);
+}
+
+void ThreadCachedBlobBufferFactory::releaseBuffer(Rep* rep)
+{
+    Cache* cache = localCache();
+
+    if (cache->d_loaded.d_numBuffers == d_magazineSize) {
+        if (cache->d_previous.d_numBuffers != 0) {
+            // Both magazines are full: move one of them to the depot.
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_depotMutex);  // LOCK
+            d_depot.push_back(cache->d_previous);
+        }
+        cache->d_previous = cache->d_loaded;
+        cache->d_loaded   = Magazine();
+    }
+
+    push(&cache->d_loaded, rep);
+}
+
+// CREATORS
+ThreadCachedBlobBufferFactory::ThreadCachedBlobBufferFactory(
+    int               bufferSize,
+    bslma::Allocator* basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_bufferSize(bufferSize)
+, d_repSize(bsls::AlignmentUtil::roundUpToMaximalAlignment(sizeof(Rep)))
+, d_blockSize(d_repSize +
+              bsls::AlignmentUtil::roundUpToMaximalAlignment(bufferSize))
+, d_magazineSize(k_DEFAULT_MAGAZINE_SIZE)
+, d_backingMemory(e_ALLOCATOR)
+, d_cacheKey()
+, d_depotMutex()
+, d_depot(d_allocator_p)
+, d_caches(d_allocator_p)
+, d_chunks(d_allocator_p)
+, d_numBytesReserved(0)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(0 < bufferSize);
+
+    const int rc = bslmt::ThreadUtil::createKey(
+        &d_cacheKey,
+        &threadCachedBlobBufferFactoryThreadExit);
+    BSLS_ASSERT_OPT(rc == 0);
+    (void)rc;
+}
+
+ThreadCachedBlobBufferFactory::ThreadCachedBlobBufferFactory(
+    int               bufferSize,
+    int               magazineSize,
+    BackingMemory     backingMemory,
+    bslma::Allocator* basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_bufferSize(bufferSize)
+, d_repSize(bsls::AlignmentUtil::roundUpToMaximalAlignment(sizeof(Rep)))
+, d_blockSize(d_repSize +
+              bsls::AlignmentUtil::roundUpToMaximalAlignment(bufferSize))
+, d_magazineSize(magazineSize)
+, d_backingMemory(backingMemory)
+, d_cacheKey()
+, d_depotMutex()
+, d_depot(d_allocator_p)
+, d_caches(d_allocator_p)
+, d_chunks(d_allocator_p)
+, d_numBytesReserved(0)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(0 < bufferSize);
+    BSLS_ASSERT(0 < magazineSize);
+
+    const int rc = bslmt::ThreadUtil::createKey(
+        &d_cacheKey,
+        &threadCachedBlobBufferFactoryThreadExit);
+    BSLS_ASSERT_OPT(rc == 0);
+    (void)rc;
+}
+
+ThreadCachedBlobBufferFactory::~ThreadCachedBlobBufferFactory()
+{
+    // Deleting the key first guarantees that the exit of the threads still
+    // referencing a cache no longer calls back into this object.
+    bslmt::ThreadUtil::deleteKey(d_cacheKey);
+
+    for (bsl::size_t i = 0; i < d_caches.size(); ++i) {
+        d_allocator_p->deleteObject(d_caches[i]);
+    }
+
+    for (bsl::size_t i = 0; i < d_chunks.size(); ++i) {
+        const Chunk& chunk = d_chunks[i];
+#ifdef BSLS_PLATFORM_OS_LINUX
+        if (chunk.d_isMapped) {
+            munmap(chunk.d_address_p, chunk.d_size);
+            continue;  // CONTINUE
+        }
+#endif
+        d_allocator_p->deallocate(chunk.d_address_p);
+    }
+}
+
+// MANIPULATORS
+void ThreadCachedBlobBufferFactory::allocate(bdlbb::BlobBuffer* buffer)
+{
+    Cache* cache = localCache();
+
+    if (cache->d_loaded.d_numBuffers == 0) {
+        if (cache->d_previous.d_numBuffers != 0) {
+            bsl::swap(cache->d_loaded, cache->d_previous);
+        }
+        else {
+            // Both magazines are empty: get a full one from the depot, or
+            // a new one.
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&d_depotMutex);  // LOCK
+                if (!d_depot.empty()) {
+                    cache->d_loaded = d_depot.back();
+                    d_depot.pop_back();
+                }
+            }
+            if (cache->d_loaded.d_numBuffers == 0) {
+                cache->d_loaded = newMagazine();
+            }
+        }
+    }
+
+    BSLS_ASSERT_SAFE(cache->d_loaded.d_numBuffers > 0);
+
+    Rep* rep                 = cache->d_loaded.d_head_p;
+    cache->d_loaded.d_head_p = rep->d_next_p;
+    --cache->d_loaded.d_numBuffers;
+
+    // Reset the reference counts of the representation.
+    new (rep) Rep(this);
+
+    buffer->reset(bsl::shared_ptr<char>(rep->buffer(), rep), d_bufferSize);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,314 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcma_threadcachedblobbufferfactory.h                              -*-C++-*-
+#ifndef INCLUDED_MWCMA_THREADCACHEDBLOBBUFFERFACTORY
+#define INCLUDED_MWCMA_THREADCACHEDBLOBBUFFERFACTORY
+
+//@PURPOSE: Provide a blob buffer factory with per-thread buffer caches.
+//
+//@CLASSES:
+//  mwcma::ThreadCachedBlobBufferFactory: pooling factory with thread caches
+//
+//@SEE_ALSO: bdlbb_pooledblobbufferfactory
+//           mwcma_countingallocatorstore
+//
+//@DESCRIPTION: This component defines a mechanism,
+// 'mwcma::ThreadCachedBlobBufferFactory', implementing the
+// 'bdlbb::BlobBufferFactory' protocol, which, like
+// 'bdlbb::PooledBlobBufferFactory', dispenses blob buffers of a fixed size
+// out of pooled memory, and is meant to be shared by all the threads of an
+// application which exchange blobs.
+//
+// 'bdlbb::PooledBlobBufferFactory' keeps its free buffers in a single pool
+// shared by all the threads, so that threads allocating and releasing buffers
+// concurrently (typically, IO threads allocating the buffers of the blobs they
+// read, and other threads releasing them once processed) keep contending on
+// that pool.  'mwcma::ThreadCachedBlobBufferFactory' instead gives each thread
+// its own cache of free buffers, so that the vast majority of allocations and
+// deallocations do not synchronize with any other thread.
+//
+/// Magazines
+///---------
+// The free buffers are grouped into *magazines* of a fixed number of buffers,
+// in the style of magazine allocators.  The cache of a thread holds at most
+// two magazines: buffers are allocated from, and released to, the *loaded*
+// magazine, the *previous* magazine absorbing bursts of allocations or
+// deallocations.  When both magazines of a thread are empty, the thread takes
+// a full magazine from a *depot* shared by all the threads, or carves a new
+// magazine out of a freshly allocated chunk of memory if the depot is empty.
+// When both magazines of a thread are full, the thread moves one of them to
+// the depot.  The depot is therefore only accessed, under a mutex, once every
+// magazine-size allocations or deallocations of a thread, and this is how
+// buffers allocated by a thread and released by another one (which end up in
+// the cache of the latter) flow back to the former.  The caches of a thread
+// are moved to the depot when the thread exits.
+//
+// As with 'bdlbb::PooledBlobBufferFactory', memory is never returned to the
+// allocator supplied at construction before the factory is destroyed.
+// Supplying a 'mwcma::CountingAllocator' (for instance, one obtained from a
+// 'mwcma::CountingAllocatorStore') reports the memory held by the factory
+// with the statistics of this allocator.
+//
+/// NUMA-Local Memory
+///-----------------
+// If created with 'e_NUMA_LOCAL' backing memory, the factory maps the chunks
+// of memory it carves magazines from directly from the kernel, and writes
+// them entirely from the thread which needs the new magazine, before handing
+// them out.  With the default memory policy of the kernel (first touch), the
+// pages of the chunk are then placed on the NUMA node of the CPU running that
+// thread.  Note that such chunks are not allocated from the allocator
+// supplied at construction, and are therefore not reported in its
+// statistics; 'numBytesReserved' reports the memory held by the factory
+// whatever its backing memory.  This is only supported on Linux; on other
+// platforms, the chunks are allocated from the allocator.
+//
+/// Thread Safety
+///-------------
+// 'allocate' is thread-safe, and so is the release of the buffers it
+// dispenses.  The behavior is undefined if the factory is destroyed while
+// any of the buffers it dispensed are still in use, or while other threads
+// are using it.
+//
+/// Usage
+///-----
+//..
+//  mwcma::ThreadCachedBlobBufferFactory factory(4096,
+//                                               allocators.get("Buffers"));
+//  bdlbb::Blob blob(&factory, allocator);
+//  blob.setLength(10000);  // allocates 3 buffers from the thread's cache
+//..
+
+// MWC
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bsl_cstddef.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mwcma {
+
+// FORWARD DECLARATION
+class ThreadCachedBlobBufferFactory_Cache;
+class ThreadCachedBlobBufferFactory_Rep;
+
+// ===================================
+// class ThreadCachedBlobBufferFactory
+// ===================================
+
+/// Blob buffer factory pooling its buffers in per-thread caches.
+class ThreadCachedBlobBufferFactory BSLS_KEYWORD_FINAL
+: public bdlbb::BlobBufferFactory {
+  public:
+    // TYPES
+
+    /// Where the memory of the buffers comes from.
+    enum BackingMemory {
+        e_ALLOCATOR = 0  // allocator supplied at construction
+        ,
+        e_NUMA_LOCAL = 1  // memory local to the NUMA node of the thread
+                          // needing it
+    };
+
+    // CONSTANTS
+
+    /// Default number of buffers per magazine.
+    static const int k_DEFAULT_MAGAZINE_SIZE = 64;
+
+  private:
+    // PRIVATE TYPES
+    typedef ThreadCachedBlobBufferFactory_Cache Cache;
+    typedef ThreadCachedBlobBufferFactory_Rep   Rep;
+
+    /// Singly-linked list of free buffers.
+    struct Magazine {
+        // DATA
+        Rep* d_head_p;
+
+        int d_numBuffers;
+
+        // CREATORS
+        Magazine();
+    };
+
+    /// Chunk of memory out of which magazines are carved.
+    struct Chunk {
+        // DATA
+        void* d_address_p;
+
+        bsl::size_t d_size;
+
+        bool d_isMapped;
+        // Whether the chunk was mapped from
+        // the kernel rather than allocated
+        // from the allocator.
+    };
+
+    // DATA
+    bslma::Allocator* d_allocator_p;
+    // Allocator to use.
+
+    int d_bufferSize;
+    // Size of the buffers dispensed.
+
+    bsl::size_t d_repSize;
+    // Size of the representation
+    // preceding each buffer in memory,
+    // rounded to the maximal alignment.
+
+    bsl::size_t d_blockSize;
+    // Size of a representation and its
+    // buffer.
+
+    int d_magazineSize;
+    // Number of buffers per magazine.
+
+    BackingMemory d_backingMemory;
+    // Where the memory of the buffers
+    // comes from.
+
+    bslmt::ThreadUtil::Key d_cacheKey;
+    // Key of the thread-specific cache
+    // of each thread.
+
+    bslmt::Mutex d_depotMutex;
+    // Mutex protecting the depot, the
+    // caches and the chunks.
+
+    bsl::vector<Magazine> d_depot;
+    // Magazines not owned by any thread.
+
+    bsl::vector<Cache*> d_caches;
+    // Caches of all the threads which
+    // used this factory and have not yet
+    // exited.
+
+    bsl::vector<Chunk> d_chunks;
+    // Chunks of memory allocated.
+
+    bsls::AtomicInt64 d_numBytesReserved;
+    // Total size of 'd_chunks'.
+
+    // FRIENDS
+    friend class ThreadCachedBlobBufferFactory_Cache;
+    friend class ThreadCachedBlobBufferFactory_Rep;
+
+  private:
+    // NOT IMPLEMENTED
+    ThreadCachedBlobBufferFactory(const ThreadCachedBlobBufferFactory&)
+        BSLS_KEYWORD_DELETED;
+    ThreadCachedBlobBufferFactory&
+    operator=(const ThreadCachedBlobBufferFactory&) BSLS_KEYWORD_DELETED;
+
+  private:
+    // PRIVATE CLASS METHODS
+
+    /// Push the free buffer of the specified `rep` on top of the specified
+    /// `magazine`.
+    static void push(Magazine* magazine, Rep* rep);
+
+    // PRIVATE MANIPULATORS
+
+    /// Return the cache of the calling thread, creating it if needed.
+    Cache* localCache();
+
+    /// Return a magazine of free buffers carved out of a new chunk of
+    /// memory.
+    Magazine newMagazine();
+
+    /// Move the magazines of the specified `cache` to the depot, and
+    /// destroy it.  Invoked when the thread owning `cache` exits.
+    void releaseCache(Cache* cache);
+
+    /// Return the specified `rep`, whose buffer is no longer in use, to the
+    /// cache of the calling thread.
+    void releaseBuffer(Rep* rep);
+
+  public:
+    // CREATORS
+
+    /// Create a factory dispensing buffers of the specified `bufferSize`,
+    /// grouped by magazines of `k_DEFAULT_MAGAZINE_SIZE` buffers allocated
+    /// from the optionally specified `basicAllocator`.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined unless `0 < bufferSize`.
+    explicit ThreadCachedBlobBufferFactory(
+        int               bufferSize,
+        bslma::Allocator* basicAllocator = 0);
+
+    /// Create a factory dispensing buffers of the specified `bufferSize`,
+    /// grouped by magazines of the specified `magazineSize` buffers whose
+    /// memory comes from the specified `backingMemory`.  Use the
+    /// optionally specified `basicAllocator` to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined unless `0 < bufferSize` and
+    /// `0 < magazineSize`.
+    ThreadCachedBlobBufferFactory(int               bufferSize,
+                                  int               magazineSize,
+                                  BackingMemory     backingMemory,
+                                  bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object, releasing all the memory it allocated.  The
+    /// behavior is undefined if any buffer dispensed by this object is
+    /// still in use.
+    ~ThreadCachedBlobBufferFactory() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// Allocate a buffer from the cache of the calling thread and load it
+    /// into the specified `buffer`.
+    void allocate(bdlbb::BlobBuffer* buffer) BSLS_KEYWORD_OVERRIDE;
+
+    // ACCESSORS
+
+    /// Return the size of the buffers dispensed by this object.
+    int bufferSize() const;
+
+    /// Return the number of bytes of memory currently held by this object,
+    /// whether dispensed or free.
+    bsls::Types::Int64 numBytesReserved() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// -----------------------------------
+// class ThreadCachedBlobBufferFactory
+// -----------------------------------
+
+// ACCESSORS
+inline int ThreadCachedBlobBufferFactory::bufferSize() const
+{
+    return d_bufferSize;
+}
+
+inline bsls::Types::Int64
+ThreadCachedBlobBufferFactory::numBytesReserved() const
+{
+    return d_numBytesReserved.loadRelaxed();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,254 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcma_threadcachedblobbufferfactory.t.cpp                          -*-C++-*-
+#include <mwcma_threadcachedblobbufferfactory.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bdlf_bind.h>
+#include <bsl_algorithm.h>
+#include <bsl_vector.h>
+#include <bslmt_threadgroup.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+typedef mwcma::ThreadCachedBlobBufferFactory Obj;
+
+/// Allocate the specified `numBuffers` buffers from the specified `factory`
+/// into the specified `buffers`.
+void allocateBuffers(bsl::vector<bdlbb::BlobBuffer>* buffers,
+                     Obj*                            factory,
+                     int                             numBuffers)
+{
+    buffers->resize(numBuffers);
+    for (int i = 0; i < numBuffers; ++i) {
+        factory->allocate(&(*buffers)[i]);
+        bsl::fill_n((*buffers)[i].data(), factory->bufferSize(), 'x');
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   1. The factory dispenses writable buffers of the configured size.
+//   2. A released buffer is reused by the next allocation of the same
+//      thread.
+//
+// Testing:
+//   ThreadCachedBlobBufferFactory(int, bslma::Allocator *)
+//   allocate
+//   bufferSize
+//   numBytesReserved
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    Obj obj(1024, s_allocator_p);
+    ASSERT_EQ(obj.bufferSize(), 1024);
+    ASSERT_EQ(obj.numBytesReserved(), 0);
+
+    bdlbb::BlobBuffer buffer;
+    obj.allocate(&buffer);
+    ASSERT_EQ(buffer.size(), 1024);
+    ASSERT(buffer.data() != 0);
+    bsl::fill_n(buffer.data(), buffer.size(), 'x');
+
+    // A whole magazine was carved out of a new chunk.
+    const bsls::Types::Int64 reserved = obj.numBytesReserved();
+    ASSERT_GE(reserved, Obj::k_DEFAULT_MAGAZINE_SIZE * 1024);
+
+    const char* data = buffer.data();
+    buffer.reset();
+
+    obj.allocate(&buffer);
+    ASSERT(buffer.data() == data);
+    ASSERT_EQ(obj.numBytesReserved(), reserved);
+
+    // Buffers can be shared by blobs.
+    {
+        bdlbb::Blob blob(&obj, s_allocator_p);
+        blob.setLength(3000);
+        ASSERT_EQ(blob.numDataBuffers(), 3);
+
+        bdlbb::Blob copy(blob, s_allocator_p);
+        blob.removeAll();
+        ASSERT_EQ(copy.length(), 3000);
+    }
+}
+
+static void test2_magazines()
+// ------------------------------------------------------------------------
+// MAGAZINES
+//
+// Concerns:
+//   1. New chunks are only allocated when no free buffer is available.
+//   2. Buffers released by the same thread are all reused.
+//
+// Testing:
+//   ThreadCachedBlobBufferFactory(int, int, BackingMemory,
+//                                 bslma::Allocator *)
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("MAGAZINES");
+
+    const int k_MAGAZINE_SIZE = 4;
+
+    Obj obj(128, k_MAGAZINE_SIZE, Obj::e_ALLOCATOR, s_allocator_p);
+
+    bsl::vector<bdlbb::BlobBuffer> buffers(s_allocator_p);
+
+    allocateBuffers(&buffers, &obj, 3 * k_MAGAZINE_SIZE);
+    const bsls::Types::Int64 reserved = obj.numBytesReserved();
+    ASSERT_GE(reserved, 3 * k_MAGAZINE_SIZE * 128);
+
+    // Release all the buffers, filling the two magazines of the cache of
+    // this thread and moving the last one to the depot, then allocate them
+    // all again.
+    buffers.clear();
+    allocateBuffers(&buffers, &obj, 3 * k_MAGAZINE_SIZE);
+    ASSERT_EQ(obj.numBytesReserved(), reserved);
+
+    // One more buffer requires a new magazine.
+    bdlbb::BlobBuffer buffer;
+    obj.allocate(&buffer);
+    ASSERT_GT(obj.numBytesReserved(), reserved);
+}
+
+static void test3_crossThreadRelease()
+// ------------------------------------------------------------------------
+// CROSS-THREAD RELEASE
+//
+// Concerns:
+//   1. Buffers allocated by a thread and released by another one flow back
+//      to the allocating threads through the depot, so that the memory
+//      reserved by the factory stays bounded.
+//   2. The cache of a thread is returned to the depot when it exits.
+//
+// Testing:
+//   allocate
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("CROSS-THREAD RELEASE");
+
+    const int k_MAGAZINE_SIZE = 8;
+    const int k_NUM_BUFFERS   = 100;
+    const int k_NUM_ROUNDS    = 20;
+
+    Obj obj(256, k_MAGAZINE_SIZE, Obj::e_ALLOCATOR, s_allocator_p);
+
+    bsl::vector<bdlbb::BlobBuffer> buffers(s_allocator_p);
+    bsls::Types::Int64             firstRoundReserved = 0;
+
+    for (int round = 0; round < k_NUM_ROUNDS; ++round) {
+        // Allocate from a new thread, and release from this one.
+        bslmt::ThreadGroup threadGroup(s_allocator_p);
+        const int          rc = threadGroup.addThread(
+            bdlf::BindUtil::bindS(s_allocator_p,
+                                  &allocateBuffers,
+                                  &buffers,
+                                  &obj,
+                                  k_NUM_BUFFERS));
+        ASSERT_EQ_D(round, rc, 0);
+        threadGroup.joinAll();
+
+        ASSERT_EQ_D(round, buffers.size(), static_cast<size_t>(k_NUM_BUFFERS));
+        buffers.clear();
+
+        if (round == 0) {
+            firstRoundReserved = obj.numBytesReserved();
+        }
+    }
+
+    PV("Reserved: " << obj.numBytesReserved() << " bytes after "
+                    << k_NUM_ROUNDS << " rounds, " << firstRoundReserved
+                    << " bytes after the first round");
+
+    // Only the (at most two) magazines held by the cache of this thread are
+    // not available to the allocating threads: allow for them, and for the
+    // rounding of the buffers allocated to whole magazines.
+    ASSERT_LE(obj.numBytesReserved(),
+              firstRoundReserved +
+                  firstRoundReserved * 4 * k_MAGAZINE_SIZE / k_NUM_BUFFERS);
+}
+
+static void test4_numaLocal()
+// ------------------------------------------------------------------------
+// NUMA-LOCAL BACKING MEMORY
+//
+// Concerns:
+//   1. A factory with NUMA-local backing memory dispenses writable buffers
+//      and reports the memory it reserved.
+//
+// Testing:
+//   ThreadCachedBlobBufferFactory(int, int, BackingMemory,
+//                                 bslma::Allocator *)
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("NUMA-LOCAL BACKING MEMORY");
+
+    Obj obj(4096, 16, Obj::e_NUMA_LOCAL, s_allocator_p);
+
+    bsl::vector<bdlbb::BlobBuffer> buffers(s_allocator_p);
+    allocateBuffers(&buffers, &obj, 40);
+
+    ASSERT_GE(obj.numBytesReserved(), 48 * 4096);
+
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        ASSERT_EQ_D(i, buffers[i].data()[4095], 'x');
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 4: test4_numaLocal(); break;
+    case 3: test3_crossThreadRelease(); break;
+    case 2: test2_magazines(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
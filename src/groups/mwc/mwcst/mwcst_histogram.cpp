@@ -0,0 +1,214 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcst_histogram.cpp                                                -*-C++-*-
+#include <mwcst_histogram.h>
+
+#include <mwcscm_version.h>
+// BDE
+#include <bdlb_bitutil.h>
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+
+namespace BloombergLP {
+namespace mwcst {
+
+namespace {
+
+/// Number of buckets in each power of two range, except the first one.
+const bsls::Types::Int64 k_HALF_SUB_BUCKET_COUNT =
+    Histogram::k_SUB_BUCKET_COUNT / 2;
+
+}  // close unnamed namespace
+
+// ---------------
+// class Histogram
+// ---------------
+
+// PRIVATE CLASS METHODS
+int Histogram::bucketIndex(bsls::Types::Uint64 value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(value <= static_cast<bsls::Types::Uint64>(k_MAX_VALUE));
+
+    if (value < static_cast<bsls::Types::Uint64>(k_SUB_BUCKET_COUNT)) {
+        return static_cast<int>(value);  // RETURN
+    }
+
+    // Position of the most significant bit set, and number of low bits to
+    // drop from 'value' so that it fits in the upper half of a sub-bucket.
+    const int msb   = 63 - bdlb::BitUtil::numLeadingUnsetBits(value);
+    const int shift = msb - (k_SUB_BUCKET_BITS - 1);
+
+    return static_cast<int>(k_SUB_BUCKET_COUNT +
+                            (shift - 1) * k_HALF_SUB_BUCKET_COUNT +
+                            (value >> shift) - k_HALF_SUB_BUCKET_COUNT);
+}
+
+bsls::Types::Int64 Histogram::bucketHighestValue(int index)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= index && index < k_NUM_BUCKETS);
+
+    if (index < k_SUB_BUCKET_COUNT) {
+        return index;  // RETURN
+    }
+
+    const bsls::Types::Int64 offset = index - k_SUB_BUCKET_COUNT;
+    const int shift = static_cast<int>(offset / k_HALF_SUB_BUCKET_COUNT) + 1;
+    const bsls::Types::Int64 subBucket = offset % k_HALF_SUB_BUCKET_COUNT +
+                                         k_HALF_SUB_BUCKET_COUNT;
+
+    return ((subBucket + 1) << shift) - 1;
+}
+
+// PRIVATE MANIPULATORS
+void Histogram::updateMax(bsls::Types::Int64 value)
+{
+    bsls::Types::Int64 currentMax = d_max.loadRelaxed();
+    while (value > currentMax) {
+        const bsls::Types::Int64 previous = d_max.testAndSwap(currentMax,
+                                                              value);
+        if (previous == currentMax) {
+            break;  // BREAK
+        }
+        currentMax = previous;
+    }
+}
+
+// CREATORS
+Histogram::Histogram()
+: d_count(0)
+, d_max(0)
+{
+    // NOTHING: 'd_buckets' are zero-initialized by 'bsls::AtomicInt64'
+}
+
+Histogram::Histogram(const Histogram& other)
+: d_count(other.d_count.loadRelaxed())
+, d_max(other.d_max.loadRelaxed())
+{
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        d_buckets[i].storeRelaxed(other.d_buckets[i].loadRelaxed());
+    }
+}
+
+// MANIPULATORS
+Histogram& Histogram::operator=(const Histogram& rhs)
+{
+    if (this != &rhs) {
+        for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+            d_buckets[i].storeRelaxed(rhs.d_buckets[i].loadRelaxed());
+        }
+        d_count.storeRelaxed(rhs.d_count.loadRelaxed());
+        d_max.storeRelaxed(rhs.d_max.loadRelaxed());
+    }
+
+    return *this;
+}
+
+void Histogram::add(const Histogram& other)
+{
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        const bsls::Types::Int64 count = other.d_buckets[i].loadRelaxed();
+        if (count != 0) {
+            d_buckets[i].addRelaxed(count);
+        }
+    }
+    d_count.addRelaxed(other.d_count.loadRelaxed());
+    updateMax(other.d_max.loadRelaxed());
+}
+
+void Histogram::moveTo(Histogram* destination)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(destination);
+    BSLS_ASSERT(destination != this);
+
+    // A value concurrently recorded may have its bucket moved but not its
+    // count, or conversely.  This is acceptable since 'valueAtPercentile'
+    // only relies on the buckets.
+    destination->d_count.addRelaxed(d_count.swap(0));
+    destination->updateMax(d_max.swap(0));
+
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        if (d_buckets[i].loadRelaxed() != 0) {
+            destination->d_buckets[i].addRelaxed(d_buckets[i].swap(0));
+        }
+    }
+}
+
+void Histogram::record(bsls::Types::Int64 value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(value < 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        value = 0;
+    }
+    else if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(value > k_MAX_VALUE)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        value = k_MAX_VALUE;
+    }
+
+    d_buckets[bucketIndex(value)].addRelaxed(1);
+    d_count.addRelaxed(1);
+
+    updateMax(value);
+}
+
+void Histogram::reset()
+{
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        d_buckets[i].storeRelaxed(0);
+    }
+    d_count.storeRelaxed(0);
+    d_max.storeRelaxed(0);
+}
+
+// ACCESSORS
+bsls::Types::Int64 Histogram::valueAtPercentile(double percentile) const
+{
+    // Compute the total from the buckets (instead of using 'd_count') so
+    // that the rank is consistent with the counts being iterated over.
+    bsls::Types::Int64 total = 0;
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        total += d_buckets[i].loadRelaxed();
+    }
+
+    if (total == 0) {
+        return 0;  // RETURN
+    }
+
+    percentile = bsl::min(bsl::max(percentile, 0.0), 100.0);
+
+    bsls::Types::Int64 rank = static_cast<bsls::Types::Int64>(
+        bsl::ceil(percentile / 100.0 * static_cast<double>(total)));
+    rank = bsl::max(rank, static_cast<bsls::Types::Int64>(1));
+
+    const bsls::Types::Int64 maxValue = max();
+    bsls::Types::Int64       seen     = 0;
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        seen += d_buckets[i].loadRelaxed();
+        if (seen >= rank) {
+            return bsl::min(bucketHighestValue(i), maxValue);  // RETURN
+        }
+    }
+
+    return maxValue;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,213 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcst_histogram.h                                                  -*-C++-*-
+#ifndef INCLUDED_MWCST_HISTOGRAM
+#define INCLUDED_MWCST_HISTOGRAM
+
+//@PURPOSE: Provide a lock-free log-linear histogram of integer values.
+//
+//@CLASSES:
+//  mwcst::Histogram: lock-free histogram with bounded relative error
+//
+//@DESCRIPTION: 'mwcst::Histogram' records non-negative integer values (for
+// example latencies in nanoseconds) into a fixed set of buckets, and can
+// report the value at any percentile of the recorded distribution.
+//
+// The bucketing scheme follows the one used by HDR histograms: values lower
+// than 'k_SUB_BUCKET_COUNT' each have their own bucket, and every subsequent
+// power of two range is split into 'k_SUB_BUCKET_COUNT / 2' buckets of equal
+// width.  The width of the bucket holding a value is therefore always lower
+// than '2 / k_SUB_BUCKET_COUNT' of that value, which bounds the relative
+// error of the reported percentiles (about 3%).  Values greater than
+// 'k_MAX_VALUE' are recorded as 'k_MAX_VALUE', and negative values are
+// recorded as 0.
+//
+// The memory footprint of a histogram is fixed (no allocation is ever
+// performed), and recording a value only performs a few relaxed atomic
+// operations, so that it can be done on the hot path.
+//
+// Histograms are mergeable: 'add' accumulates the values recorded in another
+// histogram, so that the distribution of values recorded over several
+// intervals, or by several sources, can be computed without loss of
+// precision.  'moveTo' does the same while atomically removing the values
+// from the source histogram, which allows taking interval snapshots of a
+// histogram being concurrently recorded to without losing any value.
+//
+/// Thread Safety
+///-------------
+// 'record' and 'moveTo' can be called concurrently from any thread, and
+// concurrently with the accessors.  The accessors do not provide a
+// consistent snapshot when values are concurrently recorded: a value being
+// recorded may or may not be accounted for.  'reset' should not be called concurrently with 'record' if
+// the values recorded at that time must be discarded.
+//
+/// Usage
+///-----
+//..
+//  mwcst::Histogram histogram;
+//  for (int i = 1; i <= 100; ++i) {
+//      histogram.record(i * 1000);
+//  }
+//
+//  assert(histogram.count() == 100);
+//  assert(histogram.max()   == 100000);
+//
+//  // The median is reported within the precision of the histogram
+//  const bsls::Types::Int64 median = histogram.valueAtPercentile(50.0);
+//  assert(50000 <= median && median <= 50000 + 50000 / 32);
+//..
+
+// BDE
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mwcst {
+
+// ===============
+// class Histogram
+// ===============
+
+/// Lock-free histogram with bounded relative error.
+class Histogram {
+  public:
+    // PUBLIC CONSTANTS
+    static const int k_SUB_BUCKET_BITS = 6;
+    // Number of bits of precision of the
+    // recorded values.
+
+    static const bsls::Types::Int64 k_SUB_BUCKET_COUNT = 1
+                                                         << k_SUB_BUCKET_BITS;
+    // Number of values recorded exactly,
+    // and number of buckets in the first
+    // power of two range.
+
+    static const int k_MAX_VALUE_BITS = 40;
+    // Number of significant bits of the
+    // largest value which can be recorded.
+
+    static const bsls::Types::Int64 k_MAX_VALUE =
+        (static_cast<bsls::Types::Int64>(1) << k_MAX_VALUE_BITS) - 1;
+    // Largest value that can be recorded
+    // (about 18 minutes, in nanoseconds).
+
+    static const int k_NUM_BUCKETS =
+        k_SUB_BUCKET_COUNT +
+        (k_MAX_VALUE_BITS - k_SUB_BUCKET_BITS) * (k_SUB_BUCKET_COUNT / 2);
+    // Total number of buckets.
+
+  private:
+    // DATA
+    bsls::AtomicInt64 d_buckets[k_NUM_BUCKETS];
+    // Number of recorded values in each
+    // bucket.
+
+    bsls::AtomicInt64 d_count;
+    // Number of recorded values.
+
+    bsls::AtomicInt64 d_max;
+    // Largest recorded value.
+
+  private:
+    // PRIVATE CLASS METHODS
+
+    /// Return the index of the bucket holding the specified `value`.  The
+    /// behavior is undefined unless `0 <= value <= k_MAX_VALUE`.
+    static int bucketIndex(bsls::Types::Uint64 value);
+
+    /// Return the largest value recorded in the bucket having the
+    /// specified `index`.
+    static bsls::Types::Int64 bucketHighestValue(int index);
+
+    // PRIVATE MANIPULATORS
+
+    /// Set the largest recorded value to the specified `value` if it is
+    /// greater.
+    void updateMax(bsls::Types::Int64 value);
+
+  public:
+    // CREATORS
+
+    /// Create an empty histogram.
+    Histogram();
+
+    /// Create a histogram having the same recorded values as the specified
+    /// `other` histogram.
+    Histogram(const Histogram& other);
+
+    // MANIPULATORS
+
+    /// Make this histogram have the same recorded values as the specified
+    /// `rhs` histogram, and return a reference to this object.
+    Histogram& operator=(const Histogram& rhs);
+
+    /// Add all the values recorded in the specified `other` histogram to
+    /// this histogram.
+    void add(const Histogram& other);
+
+    /// Add all the values recorded in this histogram to the specified
+    /// `destination` histogram, and remove them from this histogram.  A
+    /// value concurrently recorded in this histogram is either moved, or
+    /// left in this histogram.  The behavior is undefined unless
+    /// `destination != this`.
+    void moveTo(Histogram* destination);
+
+
+    /// Record one occurrence of the specified `value`.
+    void record(bsls::Types::Int64 value);
+
+    /// Remove all recorded values.
+    void reset();
+
+    // ACCESSORS
+
+    /// Return the number of values recorded.
+    bsls::Types::Int64 count() const;
+
+    /// Return the largest value recorded, or 0 if no value was recorded.
+    bsls::Types::Int64 max() const;
+
+    /// Return the smallest value such that the specified `percentile` (in
+    /// the range `[0.0 .. 100.0]`) of the recorded values are lower or
+    /// equal to it, within the precision of this histogram, or 0 if no
+    /// value was recorded.  The returned value is never greater than
+    /// `max()`.
+    bsls::Types::Int64 valueAtPercentile(double percentile) const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ---------------
+// class Histogram
+// ---------------
+
+// ACCESSORS
+inline bsls::Types::Int64 Histogram::count() const
+{
+    return d_count.loadRelaxed();
+}
+
+inline bsls::Types::Int64 Histogram::max() const
+{
+    return d_max.loadRelaxed();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
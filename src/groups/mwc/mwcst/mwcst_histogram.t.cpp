@@ -0,0 +1,282 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcst_histogram.t.cpp                                              -*-C++-*-
+#include <mwcst_histogram.h>
+
+// BDE
+#include <bsl_algorithm.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise the basic functionality of the component.
+//
+// Testing:
+//   Basic functionality
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    mwcst::Histogram obj;
+
+    // Empty histogram
+    ASSERT_EQ(obj.count(), 0);
+    ASSERT_EQ(obj.max(), 0);
+    ASSERT_EQ(obj.valueAtPercentile(50.0), 0);
+
+    // Values lower than the sub-bucket count are recorded exactly
+    for (int i = 1; i <= 10; ++i) {
+        obj.record(i);
+    }
+    ASSERT_EQ(obj.count(), 10);
+    ASSERT_EQ(obj.max(), 10);
+    ASSERT_EQ(obj.valueAtPercentile(0.0), 1);
+    ASSERT_EQ(obj.valueAtPercentile(10.0), 1);
+    ASSERT_EQ(obj.valueAtPercentile(50.0), 5);
+    ASSERT_EQ(obj.valueAtPercentile(90.0), 9);
+    ASSERT_EQ(obj.valueAtPercentile(100.0), 10);
+
+    // Out of range percentiles are clamped
+    ASSERT_EQ(obj.valueAtPercentile(-1.0), 1);
+    ASSERT_EQ(obj.valueAtPercentile(200.0), 10);
+
+    // Reset
+    obj.reset();
+    ASSERT_EQ(obj.count(), 0);
+    ASSERT_EQ(obj.max(), 0);
+    ASSERT_EQ(obj.valueAtPercentile(100.0), 0);
+}
+
+static void test2_precision()
+// ------------------------------------------------------------------------
+// PRECISION
+//
+// Concerns:
+//   1. The value reported for a percentile is never lower than the actual
+//      value, and exceeds it by less than '2 / k_SUB_BUCKET_COUNT' of it.
+//   2. The value reported is never greater than the largest recorded
+//      value.
+//   3. Values out of the supported range are clamped.
+//
+// Testing:
+//   record
+//   valueAtPercentile
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("PRECISION");
+
+    typedef bsls::Types::Int64 Int64;
+
+    const Int64 k_VALUES[] = {63,
+                              64,
+                              65,
+                              127,
+                              128,
+                              1000,
+                              12345,
+                              1000000,
+                              987654321,
+                              mwcst::Histogram::k_MAX_VALUE};
+
+    for (size_t i = 0; i < sizeof(k_VALUES) / sizeof(*k_VALUES); ++i) {
+        const Int64 value = k_VALUES[i];
+
+        PVV("Value: " << value);
+
+        // Also record the largest value, so that the reported value is not
+        // bounded by 'max()'
+        mwcst::Histogram obj;
+        obj.record(value);
+        obj.record(mwcst::Histogram::k_MAX_VALUE);
+
+        const Int64 reported = obj.valueAtPercentile(50.0);
+        ASSERT_LE(value, reported);
+        ASSERT_LT(reported - value,
+                  bsl::max(static_cast<Int64>(1),
+                           2 * value / mwcst::Histogram::k_SUB_BUCKET_COUNT));
+        ASSERT_EQ(obj.max(), mwcst::Histogram::k_MAX_VALUE);
+    }
+
+    {
+        PVV("Two values in the same bucket");
+
+        mwcst::Histogram obj;
+        obj.record(1000000);
+        obj.record(1000001);
+
+        // The reported value is bounded by the largest recorded value
+        ASSERT_EQ(obj.valueAtPercentile(100.0), 1000001);
+    }
+
+    {
+        PVV("Out of range values");
+
+        mwcst::Histogram obj;
+        obj.record(-5);
+        obj.record(mwcst::Histogram::k_MAX_VALUE + 1);
+
+        ASSERT_EQ(obj.count(), 2);
+        ASSERT_EQ(obj.valueAtPercentile(50.0), 0);
+        ASSERT_EQ(obj.valueAtPercentile(100.0),
+                  mwcst::Histogram::k_MAX_VALUE);
+        ASSERT_EQ(obj.max(), mwcst::Histogram::k_MAX_VALUE);
+    }
+}
+
+static void test3_percentiles()
+// ------------------------------------------------------------------------
+// PERCENTILES
+//
+// Concerns:
+//   Percentiles of a distribution spanning several orders of magnitude
+//   are reported within the precision of the histogram.
+//
+// Testing:
+//   valueAtPercentile
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("PERCENTILES");
+
+    typedef bsls::Types::Int64 Int64;
+
+    const Int64 k_NUM_VALUES = 10000;
+
+    mwcst::Histogram obj;
+
+    // Record values 1 us, 2 us, ..., 10 ms (in nanoseconds)
+    for (Int64 i = 1; i <= k_NUM_VALUES; ++i) {
+        obj.record(i * 1000);
+    }
+
+    ASSERT_EQ(obj.count(), k_NUM_VALUES);
+    ASSERT_EQ(obj.max(), k_NUM_VALUES * 1000);
+
+    const double k_PERCENTILES[] = {1.0, 50.0, 90.0, 99.0, 99.9, 100.0};
+
+    for (size_t i = 0; i < sizeof(k_PERCENTILES) / sizeof(*k_PERCENTILES);
+         ++i) {
+        const double percentile = k_PERCENTILES[i];
+        const Int64  expected   = static_cast<Int64>(
+                                   percentile * k_NUM_VALUES / 100.0) *
+                               1000;
+
+        PVV("Percentile: " << percentile);
+
+        const Int64 reported = obj.valueAtPercentile(percentile);
+        ASSERT_LE(expected, reported);
+        ASSERT_LT(reported - expected,
+                  2 * expected / mwcst::Histogram::k_SUB_BUCKET_COUNT);
+    }
+}
+
+static void test4_merge()
+// ------------------------------------------------------------------------
+// MERGE
+//
+// Concerns:
+//   1. A copy of a histogram has the same recorded values.
+//   2. Adding a histogram to another one results in the distribution of
+//      all the values recorded in both.
+//   3. Moving a histogram to another one also empties the source.
+//
+// Testing:
+//   Histogram(const Histogram&)
+//   operator=
+//   add
+//   moveTo
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("MERGE");
+
+    mwcst::Histogram low;
+    mwcst::Histogram high;
+    for (int i = 1; i <= 10; ++i) {
+        low.record(i);
+        high.record(i + 10);
+    }
+
+    // Copy
+    mwcst::Histogram copy(low);
+    ASSERT_EQ(copy.count(), 10);
+    ASSERT_EQ(copy.max(), 10);
+    ASSERT_EQ(copy.valueAtPercentile(50.0), 5);
+
+    copy = high;
+    ASSERT_EQ(copy.count(), 10);
+    ASSERT_EQ(copy.max(), 20);
+    ASSERT_EQ(copy.valueAtPercentile(50.0), 15);
+
+    // Add
+    mwcst::Histogram merged(low);
+    merged.add(high);
+    ASSERT_EQ(merged.count(), 20);
+    ASSERT_EQ(merged.max(), 20);
+    ASSERT_EQ(merged.valueAtPercentile(0.0), 1);
+    ASSERT_EQ(merged.valueAtPercentile(50.0), 10);
+    ASSERT_EQ(merged.valueAtPercentile(100.0), 20);
+    ASSERT_EQ(high.count(), 10);
+
+    // Move
+    mwcst::Histogram moved;
+    merged.moveTo(&moved);
+    ASSERT_EQ(merged.count(), 0);
+    ASSERT_EQ(merged.max(), 0);
+    ASSERT_EQ(merged.valueAtPercentile(100.0), 0);
+    ASSERT_EQ(moved.count(), 20);
+    ASSERT_EQ(moved.max(), 20);
+    ASSERT_EQ(moved.valueAtPercentile(50.0), 10);
+
+    low.moveTo(&moved);
+    ASSERT_EQ(moved.count(), 30);
+    ASSERT_EQ(moved.valueAtPercentile(50.0), 8);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 4: test4_merge(); break;
+    case 3: test3_percentiles(); break;
+    case 2: test2_precision(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
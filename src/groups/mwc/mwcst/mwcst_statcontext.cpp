@@ -31,6 +31,7 @@
 #include <bsls_systemtime.h>
 
 #include <bsl_algorithm.h>
+#include <bsl_limits.h>
 #include <bsl_utility.h>
 #include <bslim_printer.h>
 #include <bsls_alignedbuffer.h>
@@ -94,6 +95,30 @@ void syncValues(bsl::vector<StatValue>*       vec,
     }
 }
 
+/// Return the number of snapshots after which the history of all the
+/// specified `values` only holds snapshots taken after a given snapshot, or
+/// 0 if `values` is empty.
+int historyLength(const bsl::vector<StatValue>& values)
+{
+    bsls::Types::Int64 length = 0;
+    for (size_t i = 0; i < values.size(); ++i) {
+        // A snapshot of level 'l' aggregates a whole history of level 'l - 1'
+        // snapshots.
+
+        bsls::Types::Int64 valueLength = 0;
+        bsls::Types::Int64 levelLength = 1;
+        for (int level = 0; level < values[i].numLevels(); ++level) {
+            levelLength *= values[i].historySize(level);
+            valueLength += levelLength;
+        }
+        length = bsl::max(length, valueLength);
+    }
+
+    return static_cast<int>(
+        bsl::min<bsls::Types::Int64>(length,
+                                     bsl::numeric_limits<int>::max()));
+}
+
 void clearStats(bsl::vector<StatValue>* values)
 {
     if (values) {
@@ -165,7 +190,12 @@ inline static bsls::Types::Int64 convertFromEpoch(bsls::Types::Int64 epochTime)
 void StatContext::statContextDeleter(void* context_vp, void* allocator_vp)
 {
     mwcst::StatContext* context = (mwcst::StatContext*)context_vp;
-    context->d_isDeleted        = true;
+
+    // Mark the context before flagging it as deleted, so that its parent
+    // notices the deletion, and before the parent may delete it.
+
+    context->markUpdated();
+    context->d_isDeleted = true;
     if (context->d_released.swap(true)) {
         // Context was already release by its parent context, therefore we are
         // responsible for deallocating it.
@@ -183,7 +213,9 @@ void StatContext::datumDeleter(void* /*datum_vp*/, void* datumLock_vp)
 }
 
 // PRIVATE MANIPULATORS
-void StatContext::initValues(ValueVecPtr& vec, bsls::Types::Int64 initTime)
+void StatContext::initValues(ValueVecPtr&       vec,
+                             bsls::Types::Int64 initTime,
+                             int                numShards)
 {
     if (!d_valueDefs_p) {
         return;
@@ -196,6 +228,9 @@ void StatContext::initValues(ValueVecPtr& vec, bsls::Types::Int64 initTime)
         (*newVec)[vIdx].init((*d_valueDefs_p)[vIdx].d_sizes,
                              (*d_valueDefs_p)[vIdx].d_type,
                              initTime);
+        if (numShards > 0) {
+            (*newVec)[vIdx].setNumShards(numShards);
+        }
     }
 
     vec.load(newVec, d_valueVecPool_p.get());
@@ -295,19 +330,55 @@ StatContext::ValueVec* StatContext::getTotalValuesVec()
     }
 }
 
+void StatContext::markUpdatedImp()
+{
+    // Stop at the first context already marked: its ancestors are either
+    // marked as well, or were snapshotted with the marked context and are
+    // then not idle, so that none of them is skipped by the next snapshot.
+
+    for (StatContext* context = this; context && !context->d_isUpdated.swap(1);
+         context = context->d_parent_p) {
+    }
+}
+
 void StatContext::snapshotSubcontext(StatContext*       subcontext,
-                                     bsls::Types::Int64 snapshotTime)
+                                     bsls::Types::Int64 snapshotTime,
+                                     int                numIdleSnapshotsToSkip)
 {
-    if (subcontext->d_numSnapshots == 0 && d_isTable && d_directValues_p) {
-        // Sync the child context's values' snapshotSchedules with ours.
-        syncValues(subcontext->d_totalValues_p.ptr(), *d_directValues_p);
-        syncValues(subcontext->d_activeChildrenTotalValues_p.ptr(),
-                   *d_directValues_p);
-        syncValues(subcontext->d_directValues_p.ptr(), *d_directValues_p);
-        syncValues(subcontext->d_expiredValues_p.ptr(), *d_directValues_p);
+    if (d_isBehind) {
+        // Our subcontexts were skipped along with us.
+        subcontext->d_isBehind = true;
+    }
+
+    if (0 < numIdleSnapshotsToSkip &&
+        numIdleSnapshotsToSkip <= subcontext->d_numIdleSnapshots &&
+        !subcontext->d_isUpdated) {
+        // The history of all values of the subcontext and of its own
+        // subcontexts only holds identical snapshots, so snapshotting them
+        // would not change any statistic.  Their latest snapshot is still
+        // added to our total below.
+
+        subcontext->d_isBehind = true;
+    }
+    else {
+        if ((subcontext->d_numSnapshots == 0 || subcontext->d_isBehind) &&
+            d_isTable && d_directValues_p) {
+            // Sync the child context's values' snapshotSchedules with ours.
+            syncValues(subcontext->d_totalValues_p.ptr(), *d_directValues_p);
+            syncValues(subcontext->d_activeChildrenTotalValues_p.ptr(),
+                       *d_directValues_p);
+            syncValues(subcontext->d_directValues_p.ptr(), *d_directValues_p);
+            syncValues(subcontext->d_expiredValues_p.ptr(),
+                       *d_directValues_p);
+        }
+
+        subcontext->snapshotImp(snapshotTime);
     }
 
-    subcontext->snapshotImp(snapshotTime);
+    if (0 == subcontext->d_numIdleSnapshots) {
+        d_numIdleSnapshots = 0;
+    }
+    d_needsCleanup = d_needsCleanup || subcontext->d_needsCleanup;
 
     // Don't just add the subcontext's total values because that will include
     // their expired children too, if it's keeping track of them
@@ -338,6 +409,17 @@ void StatContext::snapshotImp(bsls::Types::Int64 snapshotTime)
 
     moveNewSubcontexts();
 
+    // Subcontexts are skipped only if we are an incremental table, and our
+    // own idle count is reset by any subcontext that was not idle.
+
+    int numIdleSnapshotsToSkip = 0;
+    if (d_incrementalSnapshot && d_isTable && d_directValues_p) {
+        numIdleSnapshotsToSkip = historyLength(*d_directValues_p);
+    }
+    if (d_numIdleSnapshots < bsl::numeric_limits<int>::max()) {
+        ++d_numIdleSnapshots;
+    }
+
     if (d_isTable && !d_subcontexts.empty() &&
         !d_activeChildrenTotalValues_p && d_directValues_p) {
         // Initialize 'd_activeChildrenTotalValues_p' if we have subtables
@@ -352,13 +434,13 @@ void StatContext::snapshotImp(bsls::Types::Int64 snapshotTime)
     for (StatContextVector::iterator iter = d_deletedSubcontexts.begin();
          iter != d_deletedSubcontexts.end();
          ++iter) {
-        snapshotSubcontext(*iter, snapshotTime);
+        snapshotSubcontext(*iter, snapshotTime, numIdleSnapshotsToSkip);
     }
 
     for (StatContextMap::iterator iter = d_subcontexts.begin();
          iter != d_subcontexts.end();
          /*nothing*/) {
-        snapshotSubcontext(iter->second, snapshotTime);
+        snapshotSubcontext(iter->second, snapshotTime, numIdleSnapshotsToSkip);
 
         if (iter->second->isDeleted()) {
             d_deletedSubcontexts.push_back(iter->second);
@@ -414,6 +496,13 @@ void StatContext::snapshotImp(bsls::Types::Int64 snapshotTime)
 
     ++d_numSnapshots;
 
+    d_isBehind     = false;
+    d_needsCleanup = d_needsCleanup || !d_deletedSubcontexts.empty();
+    if (!d_incrementalSnapshot || d_isUpdated.swap(0) ||
+        d_preSnapshotCallback || d_userData_p || d_update_p) {
+        d_numIdleSnapshots = 0;
+    }
+
     // Snapshot the user data.  This must happen last so that the user data may
     // trigger a read from the latest snapshot of data in this context.
 
@@ -431,6 +520,12 @@ void StatContext::cleanupImp(bsl::vector<ValueVec*>* expiredValuesVec)
         syncValues(d_expiredValues_p.ptr(), *d_directValues_p);
     }
 
+    if (d_incrementalSnapshot && !d_needsCleanup) {
+        // Neither we nor our subcontexts have deleted subcontexts.
+        return;  // RETURN
+    }
+    d_needsCleanup = false;
+
     // Push our expiredValues onto the vector.  All children will add the
     // final values of any subcontexts being deleted to all the ValueVecs in
     // this vector.
@@ -438,6 +533,12 @@ void StatContext::cleanupImp(bsl::vector<ValueVec*>* expiredValuesVec)
         expiredValuesVec->push_back(d_expiredValues_p.ptr());
     }
 
+    if (!d_deletedSubcontexts.empty()) {
+        // Our totals, and the expired values of our ancestors, change on our
+        // next snapshot.
+        markUpdated();
+    }
+
     clearDeletedSubcontexts(expiredValuesVec);
 
     for (StatContextMap::iterator iter = d_subcontexts.begin();
@@ -455,6 +556,8 @@ void StatContext::applyUpdate(const mwcstm::StatContextUpdate& update)
 {
     // Apply the update to all of our values.
 
+    markUpdated();
+
     BSLS_ASSERT(update.directValues().size() == d_directValues_p->size());
     bsl::size_t numValues = bsl::min(d_directValues_p->size(),
                                      update.directValues().size());
@@ -512,6 +615,13 @@ StatContext::StatContext(const Config&     config,
 , d_isTable(config.d_isTable)
 , d_storeExpiredValues(config.d_storeExpiredSubcontextValues)
 , d_defaultHistorySizes(config.d_defaultHistorySizes, basicAllocator)
+, d_numWriterShards(config.d_numWriterShards)
+, d_incrementalSnapshot(config.d_incrementalSnapshot)
+, d_parent_p(0)
+, d_isUpdated(1)
+, d_numIdleSnapshots(0)
+, d_isBehind(false)
+, d_needsCleanup(false)
 , d_valueDefs_p()
 , d_valueVecPool_p()
 , d_totalValues_p()
@@ -553,7 +663,9 @@ StatContext::StatContext(const Config&     config,
             }
         }
 
-        initValues(d_directValues_p, bsls::TimeUtil::getTimer());
+        initValues(d_directValues_p,
+                   bsls::TimeUtil::getTimer(),
+                   d_numWriterShards);
     }
 
     if (config.d_update_p) {
@@ -585,6 +697,11 @@ bslma::ManagedPtr<StatContext> StatContext::addSubcontext(const Config& config)
     Config       newConfig(config, &seqAlloc);
     newConfig.d_updateValueFieldMask = d_updateValueFieldMask;
     newConfig.d_nextSubcontextId_p   = d_nextSubcontextId_p;
+    if (0 == newConfig.d_numWriterShards) {
+        newConfig.d_numWriterShards = d_numWriterShards;
+    }
+    newConfig.d_incrementalSnapshot = newConfig.d_incrementalSnapshot ||
+                                      d_incrementalSnapshot;
 
     // Stash the 'update' to be applied to the subcontext so that we can wait
     // to apply it after we have completely initialized the subcontext.
@@ -604,7 +721,9 @@ bslma::ManagedPtr<StatContext> StatContext::addSubcontext(const Config& config)
         newContext->d_valueVecPool_p = d_valueVecPool_p;
 
         newContext->d_valueDefs_p = d_valueDefs_p;
-        newContext->initValues(newContext->d_directValues_p);
+        newContext->initValues(newContext->d_directValues_p,
+                               0,
+                               newContext->d_numWriterShards);
     }
     else {
         newConfig.d_statValueAllocator_p = d_statValueAllocator_p;
@@ -617,6 +736,8 @@ bslma::ManagedPtr<StatContext> StatContext::addSubcontext(const Config& config)
             StatContext(newConfig, d_allocator_p);
     }
 
+    newContext->d_parent_p = this;
+
     if (update) {
         newContext->applyUpdate(*update);
     }
@@ -629,8 +750,12 @@ bslma::ManagedPtr<StatContext> StatContext::addSubcontext(const Config& config)
                                        d_allocator_p,
                                        &StatContext::statContextDeleter);
 
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_newSubcontextsLock);  // LOCK
-    d_newSubcontexts.push_back(newContext);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_newSubcontextsLock);  // LOCK
+        d_newSubcontexts.push_back(newContext);
+    }
+
+    markUpdated();
 
     return ret;
 }
@@ -701,6 +826,10 @@ void StatContext::clearSubcontexts()
 
             d_allocator_p->deleteObject(iter->second);
         }
+        else {
+            // The subcontext outlives us.
+            iter->second->d_parent_p = 0;
+        }
     }
     d_subcontexts.clear();
 
@@ -772,8 +901,11 @@ void StatContext::initializeUpdate(mwcstm::StatContextUpdate* update) const
         mwcstm::StatValueDefinition& definition = config.values()[i];
         const StatValue& val = value(StatContext::DMCST_DIRECT_VALUE, i);
         definition.name()    = valueName(i);
-        definition.type()    = static_cast<mwcstm::StatValueType::Value>(
-            val.type());
+        // The distribution of a histogram value is not part of updates, so
+        // it is seen as a discrete value by the receiver.
+        definition.type() = val.type() == StatValue::DMCST_CONTINUOUS
+                                ? mwcstm::StatValueType::DMCSTM_CONTINUOUS
+                                : mwcstm::StatValueType::DMCSTM_DISCRETE;
         definition.historySizes().resize(val.numLevels());
         for (int l = 0; l < val.numLevels(); ++l) {
             definition.historySizes()[l] = val.historySize(l);
@@ -852,6 +984,7 @@ StatContextConfiguration::StatContextConfiguration(
 , d_isTable(false)
 , d_userData_p()
 , d_storeExpiredSubcontextValues(false)
+, d_numWriterShards(0)
 , d_preSnapshotCallback(bsl::allocator_arg, basicAllocator)
 , d_update_p(&update)
 , d_updateCollector_p(0)
@@ -97,6 +97,38 @@
 // 'reportValue', and 'setValue' are thread-safe.  All other functions should
 // be considered not thread safe.
 //
+// A context whose values are updated at a high rate by many threads at once
+// can be configured with 'StatContextConfiguration::numWriterShards'.  Each
+// direct value of such a context (and of its subcontexts and subtables) then
+// spreads its updates over that many cache-line sized shards, selected by the
+// updating thread, instead of having every writer contend on the same
+// counters.  The shards are folded back into the value on 'snapshot'.  See
+// 'mwcst::StatValue' for the details and the associated memory cost.
+//
+/// Incremental Snapshots
+///---------------------
+// By default, 'snapshot' visits every subcontext of the tree, even those
+// whose values have not changed for a long time.  A table configured with
+// 'StatContextConfiguration::incrementalSnapshot' (which is inherited by its
+// subtables) instead tracks which of its subtables were updated: each update
+// marks the updated context and its ancestors, and 'snapshot' skips the whole
+// subtree of a subtable that was not updated during as many snapshots as the
+// history of its values holds.  The history of all the values of such a
+// subtree only holds identical snapshots, so the statistics computed from
+// them are the same as if they had been snapshotted, and the parent still
+// accounts for their latest snapshot in its totals.  Only the snapshot time
+// of the values of a skipped subtable is stale, until it is updated again and
+// its snapshot schedule is resynchronized with that of its parent.  Likewise,
+// 'cleanup' only visits the subtrees having deleted subcontexts.  The cost of
+// 'snapshot' and 'cleanup' then grows with the number of active subtables
+// instead of the total number of subtables.
+//
+// 'isIdle' tells whether a context and its subcontexts were updated in the
+// interval ending with their latest snapshot, so that exporters (see
+// 'mwcst::StatSnapshotBuffer::loadChanged') can publish only the statistics
+// that changed.  Contexts having a pre-snapshot callback or user data, or
+// collecting updates, are snapshotted every time.
+//
 /// Intended Usage Pattern
 ///----------------------
 // The easiest way to use a 'StatContext' to collect statistics for an
@@ -622,6 +654,34 @@ class StatContext {
     // without it.  This is only used to
     // forward the default to subcontexts.
 
+    // number of writer shards of each direct value, also forwarded to
+    // subcontexts not overriding it
+    int d_numWriterShards;
+
+    // `true` if idle subtables are skipped by `snapshot`, also forwarded to
+    // subcontexts
+    bool d_incrementalSnapshot;
+
+    // the context this context is a subcontext of, or 0
+    StatContext* d_parent_p;
+
+    // 1 if this context or one of its subcontexts was updated since this
+    // context was last snapshotted, and 0 otherwise
+    bsls::AtomicInt d_isUpdated;
+
+    // number of consecutive snapshots of this context during which neither
+    // this context nor its subcontexts were updated
+    int d_numIdleSnapshots;
+
+    // `true` if snapshots of this context were skipped, in which case the
+    // snapshot schedule of its values is resynchronized with that of its
+    // parent on its next snapshot
+    bool d_isBehind;
+
+    // `true` if this context or one of its subcontexts has deleted
+    // subcontexts to remove on the next `cleanup`
+    bool d_needsCleanup;
+
     ValueDefsPtr d_valueDefs_p;
 
     ValueVecPoolPtr d_valueVecPool_p;
@@ -673,8 +733,13 @@ class StatContext {
 
     // PRIVATE MANIPULATORS
 
-    /// Initialize the specified `vec` using `d_valueDefs_p`
-    void initValues(ValueVecPtr& vec, bsls::Types::Int64 initTime = 0);
+    /// Initialize the specified `vec` using `d_valueDefs_p`, with the
+    /// optionally specified `initTime` as the time of the initial snapshot
+    /// and each value having the optionally specified `numShards` writer
+    /// shards.
+    void initValues(ValueVecPtr&       vec,
+                    bsls::Types::Int64 initTime  = 0,
+                    int                numShards = 0);
 
     /// Delete everything in `d_deletedSubcontexts`
     void clearDeletedSubcontexts(bsl::vector<ValueVec*>* expiredValuesVec);
@@ -686,9 +751,21 @@ class StatContext {
     /// StatContext.
     ValueVec* getTotalValuesVec();
 
-    /// Snapshot the specified `subcontext`
+    /// Mark this context as updated since its last snapshot if it is
+    /// configured for incremental snapshots.
+    void markUpdated();
+
+    /// Mark this context and its ancestors as updated since their last
+    /// snapshot.
+    void markUpdatedImp();
+
+    /// Snapshot the specified `subcontext`, unless it has been idle for at
+    /// least the specified `numIdleSnapshotsToSkip` snapshots, and add its
+    /// latest snapshot to the total of our active children.  If
+    /// `numIdleSnapshotsToSkip` is 0, always snapshot `subcontext`.
     void snapshotSubcontext(StatContext*       subcontext,
-                            bsls::Types::Int64 snapshotTime);
+                            bsls::Types::Int64 snapshotTime,
+                            int                numIdleSnapshotsToSkip);
 
     /// Snapshot all values of all subcontexts.
     void snapshotImp(bsls::Types::Int64 snapshotTime);
@@ -786,6 +863,13 @@ class StatContext {
     /// deleted during its parent's next `cleanup`.
     bool isDeleted() const;
 
+    /// Return `true` if this StatContext is configured for incremental
+    /// snapshots, and neither it nor any of its subcontexts was updated
+    /// during the interval ending with its latest snapshot, and `false`
+    /// otherwise.  Note that the values of an idle context did not change
+    /// since their previous snapshot.
+    bool isIdle() const;
+
     /// Return `true` if we have any expired StatContexts whose values
     /// we've remembered.
     bool hasExpiredValues() const;
@@ -885,6 +969,8 @@ class StatContextConfiguration {
     bool                                 d_isTable;
     bsl::shared_ptr<StatContextUserData> d_userData_p;
     bool                                 d_storeExpiredSubcontextValues;
+    int                                  d_numWriterShards;
+    bool                                 d_incrementalSnapshot;
     StatContext::SnapshotCallback        d_preSnapshotCallback;
     const mwcstm::StatContextUpdate*     d_update_p;
     mwcstm::StatContextUpdate*           d_updateCollector_p;
@@ -952,6 +1038,23 @@ class StatContextConfiguration {
     /// object.
     StatContextConfiguration& storeExpiredSubcontextValues(bool value);
 
+    /// Set the number of writer shards of each value directly updated on
+    /// the stat context to the specified `numShards`, rounded up to a power
+    /// of 2, and return this object.  Zero, the default, disables sharding.
+    /// This setting is inherited by any subcontexts that don't override it.
+    /// The behavior is undefined unless `0 <= numShards`.  Note that each
+    /// shard occupies its own cache line, so this should only be used for
+    /// contexts updated at a high rate by many threads concurrently; see
+    /// `StatValue::setNumShards`.
+    StatContextConfiguration& numWriterShards(int numShards);
+
+    /// Set whether `snapshot` skips the subtables that were not updated
+    /// during a whole history of their values to the specified `value`, and
+    /// return this object.  This setting is inherited by all subcontexts,
+    /// and only has an effect on tables.  See the "Incremental Snapshots"
+    /// section of the component documentation.
+    StatContextConfiguration& incrementalSnapshot(bool value);
+
     /// Configure the default history size of this stat context with the
     /// specified `level1` and optionally specified `level2` and `level3`
     /// snapshot history sizes.  This history size configuration will be
@@ -1067,23 +1170,34 @@ inline StatContext::~StatContext()
     clearSubcontexts();
 }
 
+// PRIVATE MANIPULATORS
+inline void StatContext::markUpdated()
+{
+    if (d_incrementalSnapshot && !d_isUpdated.loadRelaxed()) {
+        markUpdatedImp();
+    }
+}
+
 // MANIPULATORS
 inline void StatContext::adjustValue(int valueKey, bsls::Types::Int64 delta)
 {
     BSLS_ASSERT(valueKey < static_cast<int>(d_directValues_p->size()));
     (*d_directValues_p)[valueKey].adjustValue(delta);
+    markUpdated();
 }
 
 inline void StatContext::setValue(int valueKey, bsls::Types::Int64 value)
 {
     BSLS_ASSERT(valueKey < static_cast<int>(d_directValues_p->size()));
     (*d_directValues_p)[valueKey].setValue(value);
+    markUpdated();
 }
 
 inline void StatContext::reportValue(int valueKey, bsls::Types::Int64 value)
 {
     BSLS_ASSERT(valueKey < static_cast<int>(d_directValues_p->size()));
     (*d_directValues_p)[valueKey].reportValue(value);
+    markUpdated();
 }
 
 // ACCESSORS
@@ -1119,6 +1233,11 @@ inline bool StatContext::isDeleted() const
     return d_isDeleted;
 }
 
+inline bool StatContext::isIdle() const
+{
+    return 0 < d_numIdleSnapshots;
+}
+
 inline bool StatContext::hasExpiredValues() const
 {
     return d_expiredValues_p.ptr();
@@ -1226,6 +1345,8 @@ inline StatContextConfiguration::StatContextConfiguration(
 , d_isTable(false)
 , d_userData_p()
 , d_storeExpiredSubcontextValues(false)
+, d_numWriterShards(0)
+, d_incrementalSnapshot(false)
 , d_preSnapshotCallback(bsl::allocator_arg, basicAllocator)
 , d_update_p(0)
 , d_updateCollector_p(0)
@@ -1245,6 +1366,8 @@ inline StatContextConfiguration::StatContextConfiguration(
 , d_isTable(false)
 , d_userData_p()
 , d_storeExpiredSubcontextValues(false)
+, d_numWriterShards(0)
+, d_incrementalSnapshot(false)
 , d_preSnapshotCallback(bsl::allocator_arg, basicAllocator)
 , d_update_p(0)
 , d_updateCollector_p(0)
@@ -1264,6 +1387,8 @@ inline StatContextConfiguration::StatContextConfiguration(
 , d_isTable(other.d_isTable)
 , d_userData_p(other.d_userData_p)
 , d_storeExpiredSubcontextValues(other.d_storeExpiredSubcontextValues)
+, d_numWriterShards(other.d_numWriterShards)
+, d_incrementalSnapshot(other.d_incrementalSnapshot)
 , d_preSnapshotCallback(bsl::allocator_arg,
                         basicAllocator,
                         other.d_preSnapshotCallback)
@@ -1303,6 +1428,22 @@ StatContextConfiguration::storeExpiredSubcontextValues(bool value)
     return *this;
 }
 
+inline StatContextConfiguration&
+StatContextConfiguration::numWriterShards(int numShards)
+{
+    BSLS_ASSERT_SAFE(0 <= numShards);
+
+    d_numWriterShards = numShards;
+    return *this;
+}
+
+inline StatContextConfiguration&
+StatContextConfiguration::incrementalSnapshot(bool value)
+{
+    d_incrementalSnapshot = value;
+    return *this;
+}
+
 inline StatContextConfiguration&
 StatContextConfiguration::defaultHistorySize(int level1)
 {
@@ -1078,6 +1078,293 @@ static void testDatum(bslma::Allocator* allocator)
     ASSERT(datum->datum().isInteger());
 }
 
+static void testShardedValues(bslma::Allocator* allocator)
+{
+    // ------------------------------------------------------------------------
+    // TEST SHARDED VALUES
+    //
+    // Concerns:
+    //   1. A context configured with writer shards, and its subcontexts,
+    //      have sharded direct values.
+    //   2. After a snapshot, the values of a sharded context are the same as
+    //      those of an identically updated non-sharded context.
+    //
+    // Testing:
+    //   StatContextConfiguration::numWriterShards
+    //   StatValue::setNumShards
+    // ------------------------------------------------------------------------
+
+    enum { e_CONTINUOUS = 0, e_DISCRETE = 1 };
+
+    mwcst::StatContextConfiguration config("test", allocator);
+    config.value("continuous")
+        .value("discrete", mwcst::StatValue::DMCST_DISCRETE)
+        .defaultHistorySize(2);
+
+    mwcst::StatContext plain(config, allocator);
+    mwcst::StatContext sharded(mwcst::StatContextConfiguration(config,
+                                                               allocator)
+                                   .numWriterShards(3),
+                               allocator);
+
+    const mwcst::StatValue& shardedValue =
+        sharded.value(mwcst::StatContext::DMCST_DIRECT_VALUE, e_CONTINUOUS);
+    ASSERT_EQUALS(shardedValue.numShards(), 4);
+    ASSERT_EQUALS(plain.value(mwcst::StatContext::DMCST_DIRECT_VALUE,
+                              e_CONTINUOUS)
+                      .numShards(),
+                  0);
+
+    bslma::ManagedPtr<mwcst::StatContext> subcontext = sharded.addSubcontext(
+        mwcst::StatContextConfiguration("sub", allocator)
+            .value("value")
+            .defaultHistorySize(2));
+    ASSERT_EQUALS(subcontext
+                      ->value(mwcst::StatContext::DMCST_DIRECT_VALUE, 0)
+                      .numShards(),
+                  4);
+
+    mwcst::StatContext* contexts[] = {&plain, &sharded};
+    for (int i = 0; i < 2; ++i) {
+        mwcst::StatContext& context = *contexts[i];
+
+        context.adjustValue(e_CONTINUOUS, 10);
+        context.adjustValue(e_CONTINUOUS, -3);
+        context.adjustValue(e_CONTINUOUS, 5);
+        context.reportValue(e_DISCRETE, 7);
+        context.reportValue(e_DISCRETE, -2);
+        context.reportValue(e_DISCRETE, 11);
+        context.snapshot();
+    }
+
+    // Note that the min and max of a sharded continuous value are only
+    // those observed at snapshot time, so only the last value is compared.
+
+    const mwcst::StatValue::SnapshotLocation latest(0, 0);
+    const mwcst::StatValue& plainContinuous =
+        plain.value(mwcst::StatContext::DMCST_DIRECT_VALUE, e_CONTINUOUS);
+    ASSERT_EQUALS(mwcst::StatUtil::value(shardedValue, latest),
+                  mwcst::StatUtil::value(plainContinuous, latest));
+    ASSERT_EQUALS(mwcst::StatUtil::value(shardedValue, latest), 12);
+    ASSERT_EQUALS(mwcst::StatUtil::increments(shardedValue, latest),
+                  mwcst::StatUtil::increments(plainContinuous, latest));
+    ASSERT_EQUALS(mwcst::StatUtil::decrements(shardedValue, latest),
+                  mwcst::StatUtil::decrements(plainContinuous, latest));
+
+    const mwcst::StatValue& shardedDiscrete =
+        sharded.value(mwcst::StatContext::DMCST_DIRECT_VALUE, e_DISCRETE);
+    const mwcst::StatValue& plainDiscrete =
+        plain.value(mwcst::StatContext::DMCST_DIRECT_VALUE, e_DISCRETE);
+    ASSERT_EQUALS(mwcst::StatUtil::events(shardedDiscrete, latest), 3);
+    ASSERT_EQUALS(mwcst::StatUtil::sum(shardedDiscrete, latest), 16);
+    ASSERT_EQUALS(mwcst::StatUtil::min(shardedDiscrete, latest), -2);
+    ASSERT_EQUALS(mwcst::StatUtil::max(shardedDiscrete, latest), 11);
+    ASSERT_EQUALS(mwcst::StatUtil::min(plainDiscrete, latest), -2);
+    ASSERT_EQUALS(mwcst::StatUtil::max(plainDiscrete, latest), 11);
+}
+
+static void testHistogramValues(bslma::Allocator* allocator)
+{
+    // ------------------------------------------------------------------------
+    // TEST HISTOGRAM VALUES
+    //
+    // Concerns:
+    //   1. A histogram value reports the percentiles of the values reported
+    //      since the previous snapshot, as well as discrete statistics.
+    //   2. The distribution of the total values of a table is the merge of
+    //      the distributions of its subtables.
+    //   3. The distribution of a higher level snapshot is the merge of the
+    //      distributions of the snapshots it aggregates.
+    //
+    // Testing:
+    //   StatValue::DMCST_HISTOGRAM
+    //   StatValue::histogram
+    //   StatUtil::percentile
+    // ------------------------------------------------------------------------
+
+    typedef mwcst::StatValue::SnapshotLocation Location;
+
+    enum { e_LATENCY = 0 };
+
+    mwcst::StatContext table(
+        mwcst::StatContextConfiguration("table", allocator)
+            .isTable(true)
+            .value("latency", mwcst::StatValue::DMCST_HISTOGRAM, 3)
+            .valueLevel(2),
+        allocator);
+
+    bslma::ManagedPtr<mwcst::StatContext> first = table.addSubcontext(
+        mwcst::StatContextConfiguration("first", allocator));
+    bslma::ManagedPtr<mwcst::StatContext> second = table.addSubcontext(
+        mwcst::StatContextConfiguration("second", allocator));
+
+    for (int i = 1; i <= 50; ++i) {
+        first->reportValue(e_LATENCY, i);
+        second->reportValue(e_LATENCY, i + 50);
+    }
+    table.snapshot();
+
+    const mwcst::StatValue& firstValue =
+        first->value(mwcst::StatContext::DMCST_DIRECT_VALUE, e_LATENCY);
+    const mwcst::StatValue& secondValue =
+        second->value(mwcst::StatContext::DMCST_DIRECT_VALUE, e_LATENCY);
+    const mwcst::StatValue& totalValue =
+        table.value(mwcst::StatContext::DMCST_TOTAL_VALUE, e_LATENCY);
+
+    ASSERT_EQUALS(firstValue.type(), mwcst::StatValue::DMCST_HISTOGRAM);
+    ASSERT_EQUALS(mwcst::StatUtil::events(firstValue, 0), 50);
+    ASSERT_EQUALS(mwcst::StatUtil::min(firstValue, 0), 1);
+    ASSERT_EQUALS(mwcst::StatUtil::max(firstValue, 0), 50);
+    ASSERT_EQUALS(mwcst::StatUtil::percentile50(firstValue, 0), 25);
+    ASSERT_EQUALS(mwcst::StatUtil::percentile50(secondValue, 0), 75);
+
+    // Values above 'mwcst::Histogram::k_SUB_BUCKET_COUNT' are recorded in
+    // buckets of 2 values.
+    ASSERT_EQUALS(mwcst::StatUtil::events(totalValue, 0), 100);
+    ASSERT_EQUALS(mwcst::StatUtil::percentile50(totalValue, 0), 50);
+    ASSERT_EQUALS(mwcst::StatUtil::percentile99(totalValue, 0), 99);
+    ASSERT_EQUALS(mwcst::StatUtil::percentile(totalValue, 0, 100.0), 100);
+
+    // Only the values reported since the previous snapshot are accounted for
+    first->reportValue(e_LATENCY, 60);
+    table.snapshot();
+
+    ASSERT_EQUALS(mwcst::StatUtil::percentile(firstValue, 0, 0.0), 60);
+    ASSERT_EQUALS(mwcst::StatUtil::percentile999(firstValue, 0), 60);
+    ASSERT_EQUALS(mwcst::StatUtil::percentile50(secondValue, 0), 0);
+    ASSERT_EQUALS(firstValue.histogram(0).count(), 1);
+    ASSERT_EQUALS(totalValue.histogram(0).count(), 1);
+
+    // The level 1 snapshot aggregates the 3 level 0 snapshots
+    ASSERT_EQUALS(firstValue.histogram(1).count(), 0);
+    table.snapshot();
+
+    ASSERT_EQUALS(firstValue.histogram(0).count(), 0);
+    ASSERT_EQUALS(firstValue.histogram(1).count(), 51);
+    ASSERT_EQUALS(mwcst::StatUtil::percentile50(firstValue, Location(1, 0)),
+                  26);
+    ASSERT_EQUALS(totalValue.histogram(1).count(), 101);
+}
+
+static void testIncrementalSnapshot(bslma::Allocator* allocator)
+{
+    // ------------------------------------------------------------------------
+    // TEST INCREMENTAL SNAPSHOT
+    //
+    // Concerns:
+    //   1. Subtables not updated during a whole history of their values are
+    //      skipped by 'snapshot', and still accounted for in the totals of
+    //      their parent.
+    //   2. A skipped subtable is resynchronized with its parent when it is
+    //      updated again.
+    //   3. The deletion of a skipped subtable is noticed and cleaned up.
+    //   4. 'isIdle' is 'false' for contexts not configured for incremental
+    //      snapshots.
+    //
+    // Testing:
+    //   StatContextConfiguration::incrementalSnapshot
+    //   StatContext::isIdle
+    // ------------------------------------------------------------------------
+
+    typedef mwcst::StatValue::SnapshotLocation Location;
+
+    const mwcst::StatContext::ValueType k_TOTAL =
+        mwcst::StatContext::DMCST_TOTAL_VALUE;
+    const mwcst::StatContext::ValueType k_DIRECT =
+        mwcst::StatContext::DMCST_DIRECT_VALUE;
+
+    mwcst::StatContext table(
+        mwcst::StatContextConfiguration("table", allocator)
+            .isTable(true)
+            .incrementalSnapshot(true)
+            .storeExpiredSubcontextValues(true)
+            .value("bytes")
+            .defaultHistorySize(2),
+        allocator);
+
+    bslma::ManagedPtr<mwcst::StatContext> active = table.addSubcontext(
+        mwcst::StatContextConfiguration("active", allocator));
+    bslma::ManagedPtr<mwcst::StatContext> idle = table.addSubcontext(
+        mwcst::StatContextConfiguration("idle", allocator));
+    bslma::ManagedPtr<mwcst::StatContext> nested = idle->addSubcontext(
+        mwcst::StatContextConfiguration("nested", allocator));
+
+    const mwcst::StatValue& tableValue  = table.value(k_DIRECT, 0);
+    const mwcst::StatValue& idleValue   = idle->value(k_DIRECT, 0);
+    const mwcst::StatValue& nestedValue = nested->value(k_DIRECT, 0);
+
+    idle->adjustValue(0, 10);
+    nested->adjustValue(0, 5);
+    table.snapshot();
+    ASSERT(!table.isIdle());
+    ASSERT(!idle->isIdle());
+    ASSERT(!nested->isIdle());
+
+    // The history of the values holds 2 snapshots, after which 'idle' and
+    // 'nested' are skipped.
+    for (int i = 0; i < 4; ++i) {
+        active->adjustValue(0, 1);
+        table.snapshot();
+    }
+    ASSERT(!table.isIdle());
+    ASSERT(!active->isIdle());
+    ASSERT(idle->isIdle());
+    ASSERT(nested->isIdle());
+
+    const bsls::Types::Int64 idleTime =
+        idleValue.snapshot(Location(0, 0)).snapshotTime();
+    ASSERT(idleTime < tableValue.snapshot(Location(0, 0)).snapshotTime());
+
+    table.snapshot();
+    ASSERT_EQUALS(idleValue.snapshot(Location(0, 0)).snapshotTime(),
+                  idleTime);
+    ASSERT_EQUALS(mwcst::StatUtil::value(idle->value(k_TOTAL, 0), 0), 15);
+    ASSERT_EQUALS(mwcst::StatUtil::value(idle->value(k_TOTAL, 0), 1), 15);
+    ASSERT_EQUALS(mwcst::StatUtil::value(table.value(k_TOTAL, 0), 0), 19);
+
+    // Updating 'nested' resumes the snapshots of 'idle' and 'nested'
+    nested->adjustValue(0, 1);
+    table.snapshot();
+    ASSERT(!idle->isIdle());
+    ASSERT(!nested->isIdle());
+    ASSERT_EQUALS(nestedValue.snapshot(Location(0, 0)).snapshotTime(),
+                  tableValue.snapshot(Location(0, 0)).snapshotTime());
+    ASSERT_EQUALS(idleValue.snapshot(Location(0, 0)).snapshotTime(),
+                  tableValue.snapshot(Location(0, 0)).snapshotTime());
+    ASSERT_EQUALS(mwcst::StatUtil::value(idle->value(k_TOTAL, 0), 0), 16);
+    ASSERT_EQUALS(mwcst::StatUtil::value(table.value(k_TOTAL, 0), 0), 20);
+
+    // Delete 'nested' while it is skipped
+    for (int i = 0; i < 4; ++i) {
+        table.snapshot();
+    }
+    ASSERT(table.isIdle());
+    ASSERT(nested->isIdle());
+
+    nested.clear();
+    table.snapshot();
+    ASSERT(!table.isIdle());
+    ASSERT_EQUALS(idle->numSubcontexts(), 1);
+
+    table.cleanup();
+    ASSERT_EQUALS(idle->numSubcontexts(), 0);
+
+    table.snapshot();
+    ASSERT_EQUALS(mwcst::StatUtil::value(table.value(k_TOTAL, 0), 0), 20);
+
+    // Contexts not configured for incremental snapshots are never idle
+    mwcst::StatContext plain(mwcst::StatContextConfiguration("plain",
+                                                             allocator)
+                                 .isTable(true)
+                                 .value("bytes")
+                                 .defaultHistorySize(2),
+                             allocator);
+    for (int i = 0; i < 4; ++i) {
+        plain.snapshot();
+    }
+    ASSERT(!plain.isIdle());
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -1118,6 +1405,42 @@ int main(int argc, char** argv)
 
     switch (test) {
     case 0:  // Zero is always the leading case.
+    case 10: {
+        // --------------------------------------------------------------------
+        // TEST INCREMENTAL SNAPSHOT
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "TEST INCREMENTAL SNAPSHOT" << endl
+                 << "=========================" << endl;
+        testIncrementalSnapshot(&ta);
+    } break;
+
+    case 9: {
+        // --------------------------------------------------------------------
+        // TEST HISTOGRAM VALUES
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "TEST HISTOGRAM VALUES" << endl
+                 << "=====================" << endl;
+        testHistogramValues(&ta);
+    } break;
+
+    case 8: {
+        // --------------------------------------------------------------------
+        // TEST SHARDED VALUES
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "TEST SHARDED VALUES" << endl
+                 << "===================" << endl;
+        testShardedValues(&ta);
+    } break;
+
     case 7: {
         // --------------------------------------------------------------------
         // TEST DATUM
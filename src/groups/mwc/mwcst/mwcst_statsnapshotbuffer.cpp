@@ -0,0 +1,172 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcst_statsnapshotbuffer.cpp                                       -*-C++-*-
+#include <mwcst_statsnapshotbuffer.h>
+
+#include <mwcscm_version.h>
+
+namespace BloombergLP {
+namespace mwcst {
+
+// ------------------------
+// class StatSnapshotBuffer
+// ------------------------
+
+// PRIVATE CLASS METHODS
+int StatSnapshotBuffer::countRows(const StatContext& context,
+                                  bool               changedOnly)
+{
+    if (changedOnly && context.isIdle()) {
+        return 0;  // RETURN
+    }
+
+    int numRows = 1;
+    for (StatContextIterator iter = context.subcontextIterator(); iter;
+         ++iter) {
+        numRows += countRows(*iter, changedOnly);
+    }
+
+    return numRows;
+}
+
+// PRIVATE MANIPULATORS
+int StatSnapshotBuffer::loadRows(const StatContext& context,
+                                 int                parent,
+                                 int                row,
+                                 bool               changedOnly)
+{
+    BSLS_ASSERT_SAFE(row < d_numRows);
+    BSLS_ASSERT_SAFE(context.numValues() == d_numValues);
+
+    d_parents[row] = parent;
+    d_flags[row]   = context.isDeleted() ? e_IS_DELETED : 0;
+    if (context.hasName()) {
+        d_flags[row] |= e_HAS_NAME;
+        d_ids[row] = 0;
+        d_names.append(context.name());
+    }
+    else {
+        d_ids[row] = context.id();
+    }
+    d_nameOffsets[row + 1] = static_cast<int>(d_names.length());
+
+    const bsl::size_t numRows = d_numRows;
+    for (int valueIndex = 0; valueIndex < d_numValues; ++valueIndex) {
+        const StatValue::Snapshot& snapshot =
+            context.value(d_valueType, valueIndex).snapshot(d_snapshot);
+
+        bsls::Types::Int64* fields = d_columns.data() +
+                                     valueIndex * e_NUM_FIELDS * numRows +
+                                     row;
+        fields[e_VALUE * numRows]      = snapshot.value();
+        fields[e_MIN * numRows]        = snapshot.min();
+        fields[e_MAX * numRows]        = snapshot.max();
+        fields[e_INCREMENTS * numRows] = snapshot.increments();
+        fields[e_DECREMENTS * numRows] = snapshot.decrements();
+    }
+
+    int nextRow = row + 1;
+    for (StatContextIterator iter = context.subcontextIterator(); iter;
+         ++iter) {
+        if (!changedOnly || !iter->isIdle()) {
+            nextRow = loadRows(*iter, row, nextRow, changedOnly);
+        }
+    }
+
+    return nextRow;
+}
+
+void StatSnapshotBuffer::loadImp(
+    const StatContext&                 context,
+    StatContext::ValueType             valueType,
+    const StatValue::SnapshotLocation& snapshot,
+    bool                               changedOnly)
+{
+    BSLS_ASSERT(valueType == StatContext::DMCST_TOTAL_VALUE ||
+                valueType == StatContext::DMCST_DIRECT_VALUE);
+
+    d_numRows   = countRows(context, changedOnly);
+    d_numValues = context.numValues();
+    d_valueType = valueType;
+    d_snapshot  = snapshot;
+
+    // 'resize' and 'clear' keep the capacity of the vectors, so that no
+    // memory is allocated once the buffer has grown to the size of the tree.
+    d_parents.resize(d_numRows);
+    d_flags.resize(d_numRows);
+    d_ids.resize(d_numRows);
+    d_nameOffsets.resize(d_numRows + 1);
+    d_names.clear();
+    d_columns.resize(static_cast<bsl::size_t>(d_numRows) * d_numValues *
+                     e_NUM_FIELDS);
+
+    if (0 < d_numRows) {
+        const int numLoaded = loadRows(context, -1, 0, changedOnly);
+        BSLS_ASSERT_SAFE(numLoaded == d_numRows);
+        (void)numLoaded;
+    }
+}
+
+// CREATORS
+StatSnapshotBuffer::StatSnapshotBuffer(bslma::Allocator* basicAllocator)
+: d_numRows(0)
+, d_numValues(0)
+, d_parents(basicAllocator)
+, d_flags(basicAllocator)
+, d_ids(basicAllocator)
+, d_nameOffsets(basicAllocator)
+, d_names(basicAllocator)
+, d_columns(basicAllocator)
+, d_valueType(StatContext::DMCST_TOTAL_VALUE)
+, d_snapshot()
+{
+    d_nameOffsets.push_back(0);
+}
+
+// MANIPULATORS
+void StatSnapshotBuffer::load(const StatContext&                 context,
+                              StatContext::ValueType             valueType,
+                              const StatValue::SnapshotLocation& snapshot)
+{
+    loadImp(context, valueType, snapshot, false);
+}
+
+void StatSnapshotBuffer::load(const StatContext&     context,
+                              StatContext::ValueType valueType)
+{
+    loadImp(context, valueType, StatValue::SnapshotLocation(), false);
+}
+
+void StatSnapshotBuffer::loadChanged(const StatContext&     context,
+                                     StatContext::ValueType valueType)
+{
+    loadImp(context, valueType, StatValue::SnapshotLocation(), true);
+}
+
+void StatSnapshotBuffer::reset()
+{
+    d_numRows   = 0;
+    d_numValues = 0;
+    d_parents.clear();
+    d_flags.clear();
+    d_ids.clear();
+    d_nameOffsets.resize(1);
+    d_names.clear();
+    d_columns.clear();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,380 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcst_statsnapshotbuffer.h                                         -*-C++-*-
+#ifndef INCLUDED_MWCST_STATSNAPSHOTBUFFER
+#define INCLUDED_MWCST_STATSNAPSHOTBUFFER
+
+//@PURPOSE: Provide a reusable columnar buffer of a 'StatContext' snapshot.
+//
+//@CLASSES:
+//  mwcst::StatSnapshotBuffer: columnar copy of the snapshot of a stat context
+//
+//@SEE_ALSO: mwcst_statcontext
+//
+//@DESCRIPTION: 'mwcst::StatSnapshotBuffer' holds a compact, columnar copy of
+// one snapshot of a 'mwcst::StatContext' and of all of its subcontexts, for
+// consumers exporting statistics in bulk (for example to a monitoring
+// system) without going through 'mwcst::Table' and its string formatting.
+//
+// 'load' walks the stat context tree once to count the contexts, and once
+// to copy, for each context (a "row"), its identifier, its parent row, and
+// the raw fields of the requested snapshot of each of its values.  The
+// fields of a given value are stored contiguously for all rows ("columns"),
+// so that a consumer can iterate over one statistic of all contexts with a
+// simple pointer walk.  Rows are in depth-first order, the loaded context
+// being the first row, so that the parent of a row always precedes it.
+//
+// All the storage of the buffer is kept between calls to 'load', so that
+// loading a tree of the same size as, or smaller than, a previously loaded
+// one performs no memory allocation.  Consumers computing rates typically
+// keep two buffers and alternate between them at each snapshot.
+//
+// For a stat context configured for incremental snapshots (see the
+// "Incremental Snapshots" section of 'mwcst_statcontext'), 'loadChanged'
+// only loads the contexts that were updated during the last snapshot
+// interval, pruning the idle subtrees without visiting them, so that a
+// consumer publishing deltas only pays for the active contexts of a large,
+// mostly idle tree.
+//
+// The fields are those of 'mwcst::StatValue::Snapshot': the
+// 'e_INCREMENTS' and 'e_DECREMENTS' fields hold respectively the number of
+// events and the sum of the reported values for a discrete value.  Like
+// those of 'mwcst::StatValue', the number of increments, decrements, and
+// events, and the sum, are cumulative, and statistics over an interval are
+// obtained as the difference between two snapshots.
+//
+/// Thread Safety
+///-------------
+// 'load' must be called from the thread snapshotting the stat context, like
+// any other accessor of the stat context.  A loaded buffer is a value
+// independent of the stat context, and can be read from any thread.
+//
+/// Usage
+///-----
+//..
+//  mwcst::StatSnapshotBuffer buffer(allocator);
+//
+//  // After each snapshot of 'context'
+//  buffer.load(context);
+//
+//  const int                 valueIndex = context.valueIndex("In");
+//  const bsls::Types::Int64 *values     = buffer.column(
+//                                  valueIndex,
+//                                  mwcst::StatSnapshotBuffer::e_VALUE);
+//  for (int row = 0; row < buffer.numRows(); ++row) {
+//      if (buffer.hasName(row)) {
+//          publish(buffer.name(row), values[row]);
+//      }
+//  }
+//..
+
+// MWC
+#include <mwcst_statcontext.h>
+#include <mwcst_statvalue.h>
+
+// BDE
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_assert.h>
+#include <bsls_types.h>
+#include <bslstl_stringref.h>
+
+namespace BloombergLP {
+namespace mwcst {
+
+// ========================
+// class StatSnapshotBuffer
+// ========================
+
+/// Reusable columnar copy of the snapshot of a stat context tree.
+class StatSnapshotBuffer {
+  public:
+    // PUBLIC TYPES
+
+    /// Fields stored for each value of each row.
+    enum Field {
+        e_VALUE      = 0,
+        e_MIN        = 1,
+        e_MAX        = 2,
+        e_INCREMENTS = 3,  // or number of events of a discrete value
+        e_DECREMENTS = 4,  // or sum of the values of a discrete value
+        e_NUM_FIELDS = 5
+    };
+
+  private:
+    // PRIVATE TYPES
+    enum RowFlag { e_HAS_NAME = 1 << 0, e_IS_DELETED = 1 << 1 };
+
+    // DATA
+    int d_numRows;
+    // Number of loaded contexts.
+
+    int d_numValues;
+    // Number of values of each context.
+
+    bsl::vector<int> d_parents;
+    // Row of the parent of each row, or -1
+    // for the first row.
+
+    bsl::vector<unsigned char> d_flags;
+    // 'RowFlag's of each row.
+
+    bsl::vector<bsls::Types::Int64> d_ids;
+    // Integer identifier of each row not
+    // having a name, 0 otherwise.
+
+    bsl::vector<int> d_nameOffsets;
+    // Offset in 'd_names' of the name of
+    // each row, followed by the total length
+    // of the names.
+
+    bsl::string d_names;
+    // Concatenated names of the rows.
+
+    bsl::vector<bsls::Types::Int64> d_columns;
+    // Fields of all rows, one column of
+    // 'd_numRows' elements per value and
+    // field.
+
+    StatContext::ValueType d_valueType;
+    // Type of the loaded values.
+
+    StatValue::SnapshotLocation d_snapshot;
+    // Location of the loaded snapshot.
+
+    // PRIVATE CLASS METHODS
+
+    /// Return the number of contexts in the tree rooted at the specified
+    /// `context`, not counting the idle ones if the specified `changedOnly`
+    /// is `true`.
+    static int countRows(const StatContext& context, bool changedOnly);
+
+    // PRIVATE MANIPULATORS
+
+    /// Copy the specified `context`, having the specified `parent` row, and
+    /// its subcontexts, except the idle ones if the specified `changedOnly`
+    /// is `true`, starting at the specified `row`, and return the row
+    /// following the last copied one.
+    int loadRows(const StatContext& context,
+                 int                parent,
+                 int                row,
+                 bool               changedOnly);
+
+    /// Implement `load` and `loadChanged` for the specified `context`,
+    /// `valueType`, `snapshot`, and `changedOnly`.
+    void loadImp(const StatContext&                 context,
+                 StatContext::ValueType             valueType,
+                 const StatValue::SnapshotLocation& snapshot,
+                 bool                               changedOnly);
+
+  private:
+    // NOT IMPLEMENTED
+    StatSnapshotBuffer(const StatSnapshotBuffer&);
+    StatSnapshotBuffer& operator=(const StatSnapshotBuffer&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(StatSnapshotBuffer,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty buffer.  Optionally specify a `basicAllocator` used
+    /// to supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.
+    explicit StatSnapshotBuffer(bslma::Allocator* basicAllocator = 0);
+
+    // MANIPULATORS
+
+    /// Load into this buffer the specified `snapshot` of the values of the
+    /// optionally specified `valueType` of the specified `context` and all
+    /// of its subcontexts, replacing any previously loaded content.  If
+    /// `valueType` is not specified, the total values are loaded.  If
+    /// `snapshot` is not specified, the most recent snapshot is loaded.
+    /// The behavior is undefined unless `valueType` is `DMCST_TOTAL_VALUE`
+    /// or `DMCST_DIRECT_VALUE`, all the contexts of the tree have the same
+    /// values as `context` (which is the case of subtables), and
+    /// `snapshot` is valid for these values.
+    void load(const StatContext&                 context,
+              StatContext::ValueType             valueType,
+              const StatValue::SnapshotLocation& snapshot);
+    void load(const StatContext&     context,
+              StatContext::ValueType valueType =
+                  StatContext::DMCST_TOTAL_VALUE);
+
+    /// Load into this buffer the most recent snapshot of the values of the
+    /// optionally specified `valueType` of the specified `context` and of
+    /// those of its subcontexts that are not idle, replacing any previously
+    /// loaded content.  If `valueType` is not specified, the total values
+    /// are loaded.  No row is loaded if `context` is idle.  The behavior is
+    /// undefined unless `valueType` is `DMCST_TOTAL_VALUE` or
+    /// `DMCST_DIRECT_VALUE`, and all the contexts of the tree have the same
+    /// values as `context`.  Note that the subcontexts of an idle context
+    /// are idle as well, and that no context is idle unless configured for
+    /// incremental snapshots, in which case this method is equivalent to
+    /// `load`; see `StatContext::isIdle`.
+    void loadChanged(const StatContext&     context,
+                     StatContext::ValueType valueType =
+                         StatContext::DMCST_TOTAL_VALUE);
+
+    /// Remove all loaded content, keeping the allocated storage.
+    void reset();
+
+    // ACCESSORS
+
+    /// Return the number of loaded contexts.
+    int numRows() const;
+
+    /// Return the number of values of each loaded context.
+    int numValues() const;
+
+    /// Return the type of the loaded values.
+    StatContext::ValueType valueType() const;
+
+    /// Return the location of the loaded snapshot.
+    const StatValue::SnapshotLocation& snapshot() const;
+
+    /// Return the row of the parent context of the context at the specified
+    /// `row`, or -1 if `row` is the first row.  The behavior is undefined
+    /// unless `0 <= row < numRows()`.
+    int parent(int row) const;
+
+    /// Return `true` if the context at the specified `row` is identified by
+    /// a name, and `false` if it is identified by an integer.  The behavior
+    /// is undefined unless `0 <= row < numRows()`.
+    bool hasName(int row) const;
+
+    /// Return the name of the context at the specified `row`, or an empty
+    /// string if it is identified by an integer.  The returned reference
+    /// is valid until the next call to `load` or `reset`.  The behavior is
+    /// undefined unless `0 <= row < numRows()`.
+    bslstl::StringRef name(int row) const;
+
+    /// Return the integer identifier of the context at the specified
+    /// `row`, or 0 if it is identified by a name.  The behavior is
+    /// undefined unless `0 <= row < numRows()`.
+    bsls::Types::Int64 id(int row) const;
+
+    /// Return `true` if the context at the specified `row` was deleted, and
+    /// is only kept until the next `cleanup` of its parent, and `false`
+    /// otherwise.  The behavior is undefined unless `0 <= row < numRows()`.
+    bool isDeleted(int row) const;
+
+    /// Return the address of the `numRows()` contiguous values of the
+    /// specified `field` of the value at the specified `valueIndex` of all
+    /// rows.  The returned address is valid until the next call to `load`
+    /// or `reset`.  The behavior is undefined unless
+    /// `0 <= valueIndex < numValues()`.
+    const bsls::Types::Int64* column(int valueIndex, Field field) const;
+
+    /// Return the specified `field` of the value at the specified
+    /// `valueIndex` of the context at the specified `row`.  The behavior is
+    /// undefined unless `0 <= row < numRows()` and
+    /// `0 <= valueIndex < numValues()`.
+    bsls::Types::Int64 value(int row, int valueIndex, Field field) const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ------------------------
+// class StatSnapshotBuffer
+// ------------------------
+
+// ACCESSORS
+inline int StatSnapshotBuffer::numRows() const
+{
+    return d_numRows;
+}
+
+inline int StatSnapshotBuffer::numValues() const
+{
+    return d_numValues;
+}
+
+inline StatContext::ValueType StatSnapshotBuffer::valueType() const
+{
+    return d_valueType;
+}
+
+inline const StatValue::SnapshotLocation& StatSnapshotBuffer::snapshot() const
+{
+    return d_snapshot;
+}
+
+inline int StatSnapshotBuffer::parent(int row) const
+{
+    BSLS_ASSERT_SAFE(0 <= row && row < d_numRows);
+
+    return d_parents[row];
+}
+
+inline bool StatSnapshotBuffer::hasName(int row) const
+{
+    BSLS_ASSERT_SAFE(0 <= row && row < d_numRows);
+
+    return d_flags[row] & e_HAS_NAME;
+}
+
+inline bslstl::StringRef StatSnapshotBuffer::name(int row) const
+{
+    BSLS_ASSERT_SAFE(0 <= row && row < d_numRows);
+
+    return bslstl::StringRef(d_names.data() + d_nameOffsets[row],
+                             d_nameOffsets[row + 1] - d_nameOffsets[row]);
+}
+
+inline bsls::Types::Int64 StatSnapshotBuffer::id(int row) const
+{
+    BSLS_ASSERT_SAFE(0 <= row && row < d_numRows);
+
+    return d_ids[row];
+}
+
+inline bool StatSnapshotBuffer::isDeleted(int row) const
+{
+    BSLS_ASSERT_SAFE(0 <= row && row < d_numRows);
+
+    return d_flags[row] & e_IS_DELETED;
+}
+
+inline const bsls::Types::Int64*
+StatSnapshotBuffer::column(int valueIndex, Field field) const
+{
+    BSLS_ASSERT_SAFE(0 <= valueIndex && valueIndex < d_numValues);
+    BSLS_ASSERT_SAFE(0 <= field && field < e_NUM_FIELDS);
+
+    return d_columns.data() +
+           (valueIndex * e_NUM_FIELDS + field) * static_cast<bsl::size_t>(
+                                                     d_numRows);
+}
+
+inline bsls::Types::Int64
+StatSnapshotBuffer::value(int row, int valueIndex, Field field) const
+{
+    BSLS_ASSERT_SAFE(0 <= row && row < d_numRows);
+
+    return column(valueIndex, field)[row];
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,270 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcst_statsnapshotbuffer.t.cpp                                     -*-C++-*-
+#include <mwcst_statsnapshotbuffer.h>
+
+// MWC
+#include <mwcst_statcontext.h>
+#include <mwcst_statvalue.h>
+
+// BDE
+#include <bslma_managedptr.h>
+#include <bslma_testallocator.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   1. A loaded buffer has one row per context of the tree, in depth-first
+//      order, with the identifier and parent of each context.
+//   2. The columns hold the fields of the loaded snapshot of each value.
+//   3. 'reset' empties the buffer.
+//
+// Testing:
+//   load
+//   reset
+//   Basic functionality
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    typedef mwcst::StatSnapshotBuffer Obj;
+
+    enum { e_BYTES = 0, e_LATENCY = 1 };
+
+    mwcst::StatContext table(
+        mwcst::StatContextConfiguration("table", s_allocator_p)
+            .isTable(true)
+            .value("bytes")
+            .value("latency", mwcst::StatValue::DMCST_DISCRETE)
+            .defaultHistorySize(2),
+        s_allocator_p);
+
+    bslma::ManagedPtr<mwcst::StatContext> named = table.addSubcontext(
+        mwcst::StatContextConfiguration("named", s_allocator_p));
+    bslma::ManagedPtr<mwcst::StatContext> nested = named->addSubcontext(
+        mwcst::StatContextConfiguration(12, s_allocator_p));
+
+    table.adjustValue(e_BYTES, 1);
+    named->adjustValue(e_BYTES, 10);
+    named->reportValue(e_LATENCY, 7);
+    nested->adjustValue(e_BYTES, 100);
+    nested->adjustValue(e_BYTES, -30);
+    nested->reportValue(e_LATENCY, 3);
+    table.snapshot();
+
+    Obj obj(s_allocator_p);
+    ASSERT_EQ(obj.numRows(), 0);
+
+    obj.load(table);
+    ASSERT_EQ(obj.numRows(), 3);
+    ASSERT_EQ(obj.numValues(), 2);
+    ASSERT_EQ(obj.valueType(), mwcst::StatContext::DMCST_TOTAL_VALUE);
+
+    ASSERT_EQ(obj.parent(0), -1);
+    ASSERT(obj.hasName(0));
+    ASSERT_EQ(obj.name(0), "table");
+    ASSERT_EQ(obj.parent(1), 0);
+    ASSERT_EQ(obj.name(1), "named");
+    ASSERT_EQ(obj.id(1), 0);
+    ASSERT_EQ(obj.parent(2), 1);
+    ASSERT(!obj.hasName(2));
+    ASSERT_EQ(obj.name(2), "");
+    ASSERT_EQ(obj.id(2), 12);
+    ASSERT(!obj.isDeleted(2));
+
+    // Total values
+    const bsls::Types::Int64* bytes = obj.column(e_BYTES, Obj::e_VALUE);
+    ASSERT_EQ(bytes[0], 81);
+    ASSERT_EQ(bytes[1], 80);
+    ASSERT_EQ(bytes[2], 70);
+    ASSERT_EQ(obj.value(2, e_BYTES, Obj::e_INCREMENTS), 1);
+    ASSERT_EQ(obj.value(2, e_BYTES, Obj::e_DECREMENTS), 1);
+    ASSERT_EQ(obj.value(0, e_LATENCY, Obj::e_INCREMENTS), 2);
+    ASSERT_EQ(obj.value(0, e_LATENCY, Obj::e_DECREMENTS), 10);
+    ASSERT_EQ(obj.value(0, e_LATENCY, Obj::e_MIN), 3);
+    ASSERT_EQ(obj.value(0, e_LATENCY, Obj::e_MAX), 7);
+
+    // Direct values
+    obj.load(*named, mwcst::StatContext::DMCST_DIRECT_VALUE);
+    ASSERT_EQ(obj.numRows(), 2);
+    ASSERT_EQ(obj.name(0), "named");
+    ASSERT_EQ(obj.parent(1), 0);
+    ASSERT_EQ(obj.value(0, e_BYTES, Obj::e_VALUE), 10);
+    ASSERT_EQ(obj.value(1, e_BYTES, Obj::e_VALUE), 70);
+    ASSERT_EQ(obj.value(0, e_LATENCY, Obj::e_MAX), 7);
+
+    // Older snapshot
+    table.adjustValue(e_BYTES, 1000);
+    table.snapshot();
+    obj.load(table);
+    ASSERT_EQ(obj.value(0, e_BYTES, Obj::e_VALUE), 1081);
+
+    obj.load(table,
+             mwcst::StatContext::DMCST_TOTAL_VALUE,
+             mwcst::StatValue::SnapshotLocation(0, 1));
+    ASSERT_EQ(obj.numRows(), 3);
+    ASSERT_EQ(obj.value(0, e_BYTES, Obj::e_VALUE), 81);
+
+    obj.reset();
+    ASSERT_EQ(obj.numRows(), 0);
+    ASSERT_EQ(obj.numValues(), 0);
+}
+
+static void test2_reuse()
+// ------------------------------------------------------------------------
+// REUSE
+//
+// Concerns:
+//   Loading a tree not larger than a previously loaded one does not
+//   allocate memory.
+//
+// Testing:
+//   load
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("REUSE");
+
+    bslma::TestAllocator ta("testAlloc");
+
+    mwcst::StatContext table(
+        mwcst::StatContextConfiguration("table", s_allocator_p)
+            .isTable(true)
+            .value("bytes")
+            .defaultHistorySize(2),
+        s_allocator_p);
+
+    bslma::ManagedPtr<mwcst::StatContext> first = table.addSubcontext(
+        mwcst::StatContextConfiguration("first", s_allocator_p));
+    bslma::ManagedPtr<mwcst::StatContext> second = table.addSubcontext(
+        mwcst::StatContextConfiguration("second", s_allocator_p));
+    table.snapshot();
+
+    mwcst::StatSnapshotBuffer obj(&ta);
+    obj.load(table);
+    ASSERT_EQ(obj.numRows(), 3);
+
+    const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+    for (int i = 0; i < 10; ++i) {
+        first->adjustValue(0, i);
+        table.snapshot();
+        obj.load(table);
+    }
+    ASSERT_EQ(obj.numRows(), 3);
+
+    // The order of sibling contexts is unspecified
+    const int firstRow = obj.name(1) == "first" ? 1 : 2;
+    ASSERT_EQ(obj.name(firstRow), "first");
+    ASSERT_EQ(obj.value(firstRow, 0, mwcst::StatSnapshotBuffer::e_VALUE), 45);
+    ASSERT_EQ(obj.value(0, 0, mwcst::StatSnapshotBuffer::e_VALUE), 45);
+
+    // A smaller tree
+    obj.load(*first);
+    ASSERT_EQ(obj.numRows(), 1);
+    ASSERT_EQ(obj.name(0), "first");
+    ASSERT_EQ(ta.numAllocations(), numAllocations);
+}
+
+static void test3_loadChanged()
+// ------------------------------------------------------------------------
+// LOAD CHANGED
+//
+// Concerns:
+//   'loadChanged' only loads the contexts of an incremental table that were
+//   updated during the last snapshot interval, along with their ancestors.
+//
+// Testing:
+//   loadChanged
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("LOAD CHANGED");
+
+    mwcst::StatContext table(
+        mwcst::StatContextConfiguration("table", s_allocator_p)
+            .isTable(true)
+            .incrementalSnapshot(true)
+            .value("bytes")
+            .defaultHistorySize(2),
+        s_allocator_p);
+
+    bslma::ManagedPtr<mwcst::StatContext> active = table.addSubcontext(
+        mwcst::StatContextConfiguration("active", s_allocator_p));
+    bslma::ManagedPtr<mwcst::StatContext> idle = table.addSubcontext(
+        mwcst::StatContextConfiguration("idle", s_allocator_p));
+
+    active->adjustValue(0, 1);
+    idle->adjustValue(0, 2);
+    table.snapshot();
+
+    mwcst::StatSnapshotBuffer obj(s_allocator_p);
+    obj.loadChanged(table);
+    ASSERT_EQ(obj.numRows(), 3);
+
+    active->adjustValue(0, 10);
+    table.snapshot();
+
+    obj.loadChanged(table);
+    ASSERT_EQ(obj.numRows(), 2);
+    ASSERT_EQ(obj.name(0), "table");
+    ASSERT_EQ(obj.name(1), "active");
+    ASSERT_EQ(obj.parent(1), 0);
+    ASSERT_EQ(obj.value(0, 0, mwcst::StatSnapshotBuffer::e_VALUE), 13);
+    ASSERT_EQ(obj.value(1, 0, mwcst::StatSnapshotBuffer::e_VALUE), 11);
+
+    // Nothing changed
+    table.snapshot();
+    obj.loadChanged(table);
+    ASSERT_EQ(obj.numRows(), 0);
+
+    obj.load(table);
+    ASSERT_EQ(obj.numRows(), 3);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_loadChanged(); break;
+    case 2: test2_reuse(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -343,7 +343,7 @@ bsls::Types::Int64
 StatUtil::events(const StatValue&                   value,
                  const StatValue::SnapshotLocation& snapshot)
 {
-    BSLS_ASSERT(value.type() == StatValue::DMCST_DISCRETE);
+    BSLS_ASSERT(value.type() != StatValue::DMCST_CONTINUOUS);
     return value.snapshot(snapshot).events();
 }
 
@@ -352,7 +352,7 @@ StatUtil::eventsDifference(const StatValue&                   value,
                            const StatValue::SnapshotLocation& firstSnapshot,
                            const StatValue::SnapshotLocation& secondSnapshot)
 {
-    BSLS_ASSERT(value.type() == StatValue::DMCST_DISCRETE);
+    BSLS_ASSERT(value.type() != StatValue::DMCST_CONTINUOUS);
 
     return value.snapshot(firstSnapshot).events() -
            value.snapshot(secondSnapshot).events();
@@ -361,7 +361,7 @@ StatUtil::eventsDifference(const StatValue&                   value,
 bsls::Types::Int64 StatUtil::sum(const StatValue&                   value,
                                  const StatValue::SnapshotLocation& snapshot)
 {
-    BSLS_ASSERT(value.type() == StatValue::DMCST_DISCRETE);
+    BSLS_ASSERT(value.type() != StatValue::DMCST_CONTINUOUS);
     return value.snapshot(snapshot).sum();
 }
 
@@ -370,7 +370,7 @@ StatUtil::sumDifference(const StatValue&                   value,
                         const StatValue::SnapshotLocation& firstSnapshot,
                         const StatValue::SnapshotLocation& secondSnapshot)
 {
-    BSLS_ASSERT(value.type() == StatValue::DMCST_DISCRETE);
+    BSLS_ASSERT(value.type() != StatValue::DMCST_CONTINUOUS);
 
     return value.snapshot(firstSnapshot).sum() -
            value.snapshot(secondSnapshot).sum();
@@ -381,7 +381,7 @@ StatUtil::averagePerEvent(const StatValue&                   value,
                           const StatValue::SnapshotLocation& firstSnapshot,
                           const StatValue::SnapshotLocation& secondSnapshot)
 {
-    BSLS_ASSERT(value.type() == StatValue::DMCST_DISCRETE);
+    BSLS_ASSERT(value.type() != StatValue::DMCST_CONTINUOUS);
 
     bsls::Types::Int64 events = eventsDifference(value,
                                                  firstSnapshot,
@@ -402,7 +402,7 @@ double StatUtil::averagePerEventReal(
     const StatValue::SnapshotLocation& firstSnapshot,
     const StatValue::SnapshotLocation& secondSnapshot)
 {
-    BSLS_ASSERT(value.type() == StatValue::DMCST_DISCRETE);
+    BSLS_ASSERT(value.type() != StatValue::DMCST_CONTINUOUS);
 
     bsls::Types::Int64 events = eventsDifference(value,
                                                  firstSnapshot,
@@ -418,5 +418,37 @@ double StatUtil::averagePerEventReal(
     }
 }
 
+bsls::Types::Int64
+StatUtil::percentile(const StatValue&                   value,
+                     const StatValue::SnapshotLocation& snapshot,
+                     double                             percentile)
+{
+    BSLS_ASSERT(value.type() == StatValue::DMCST_HISTOGRAM);
+    BSLS_ASSERT(snapshot.index() == 0);
+
+    return value.histogram(snapshot.level()).valueAtPercentile(percentile);
+}
+
+bsls::Types::Int64
+StatUtil::percentile50(const StatValue&                   value,
+                       const StatValue::SnapshotLocation& snapshot)
+{
+    return percentile(value, snapshot, 50.0);
+}
+
+bsls::Types::Int64
+StatUtil::percentile99(const StatValue&                   value,
+                       const StatValue::SnapshotLocation& snapshot)
+{
+    return percentile(value, snapshot, 99.0);
+}
+
+bsls::Types::Int64
+StatUtil::percentile999(const StatValue&                   value,
+                        const StatValue::SnapshotLocation& snapshot)
+{
+    return percentile(value, snapshot, 99.9);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -211,9 +211,9 @@ struct StatUtil {
     /// returned.
     static bsls::Types::Int64 absoluteMax(const StatValue& value);
 
-    // ** Discrete StatValue functions only           **
-    // ** The behavior is undefined unless            **
-    // ** 'value.type() == StatValue::DMCST_DISCRETE' **
+    // ** Discrete and histogram StatValue functions only **
+    // ** The behavior is undefined unless                **
+    // ** 'value.type() != StatValue::DMCST_CONTINUOUS'   **
 
     /// Return the total number of events recorded by the
     /// specified `value` up to the specified `snapshot`.
@@ -257,6 +257,35 @@ struct StatUtil {
     averagePerEventReal(const StatValue&                   value,
                         const StatValue::SnapshotLocation& firstSnapshot,
                         const StatValue::SnapshotLocation& secondSnapshot);
+
+    // ** Histogram StatValue functions only             **
+    // ** The behavior is undefined unless               **
+    // ** 'value.type() == StatValue::DMCST_HISTOGRAM'   **
+    // ** and 'snapshot.index() == 0', as only the       **
+    // ** distribution of the most recent snapshot of    **
+    // ** each level is kept                             **
+
+    /// Return the value at the specified `percentile` (in the range
+    /// `[0.0 .. 100.0]`) of the values reported to the specified `value`
+    /// during the interval ending at the specified `snapshot`, within the
+    /// precision of `mwcst::Histogram`, or 0 if no value was reported.
+    static bsls::Types::Int64
+    percentile(const StatValue&                   value,
+               const StatValue::SnapshotLocation& snapshot,
+               double                             percentile);
+
+    /// Return the median, 99th and 99.9th percentile, respectively, of the
+    /// values reported to the specified `value` during the interval ending
+    /// at the specified `snapshot`.
+    static bsls::Types::Int64
+    percentile50(const StatValue&                   value,
+                 const StatValue::SnapshotLocation& snapshot);
+    static bsls::Types::Int64
+    percentile99(const StatValue&                   value,
+                 const StatValue::SnapshotLocation& snapshot);
+    static bsls::Types::Int64
+    percentile999(const StatValue&                   value,
+                  const StatValue::SnapshotLocation& snapshot);
 };
 
 }  // close package namespace
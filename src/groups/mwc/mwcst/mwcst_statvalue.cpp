@@ -32,11 +32,101 @@ bsls::Types::Int64 MIN_INT = bsl::numeric_limits<bsls::Types::Int64>::min();
 
 }  // close anonymous namespace
 
+// ---------------------
+// class StatValue_Shard
+// ---------------------
+
+// CREATORS
+StatValue_Shard::StatValue_Shard()
+{
+    reset();
+}
+
+StatValue_Shard::StatValue_Shard(const StatValue_Shard& other)
+: d_sum(other.d_sum.loadRelaxed())
+, d_incrementsOrEvents(other.d_incrementsOrEvents.loadRelaxed())
+, d_decrements(other.d_decrements.loadRelaxed())
+, d_min(other.d_min.loadRelaxed())
+, d_max(other.d_max.loadRelaxed())
+{
+}
+
+// MANIPULATORS
+StatValue_Shard& StatValue_Shard::operator=(const StatValue_Shard& rhs)
+{
+    d_sum.storeRelaxed(rhs.d_sum.loadRelaxed());
+    d_incrementsOrEvents.storeRelaxed(rhs.d_incrementsOrEvents.loadRelaxed());
+    d_decrements.storeRelaxed(rhs.d_decrements.loadRelaxed());
+    d_min.storeRelaxed(rhs.d_min.loadRelaxed());
+    d_max.storeRelaxed(rhs.d_max.loadRelaxed());
+
+    return *this;
+}
+
+void StatValue_Shard::reset()
+{
+    d_sum.storeRelaxed(0);
+    d_incrementsOrEvents.storeRelaxed(0);
+    d_decrements.storeRelaxed(0);
+    d_min.storeRelaxed(MAX_INT);
+    d_max.storeRelaxed(MIN_INT);
+}
+
 // ---------------
 // class StatValue
 // ---------------
 
 // PRIVATE MANIPULATORS
+void StatValue::collectShards()
+{
+    bool hasUpdates = false;
+
+    for (size_t i = 0; i < d_shards.size(); ++i) {
+        StatValue_Shard& shard = d_shards[i];
+
+        const bsls::Types::Int64 incrementsOrEvents =
+            shard.d_incrementsOrEvents.swap(0);
+        const bsls::Types::Int64 sum        = shard.d_sum.swap(0);
+        const bsls::Types::Int64 decrements = shard.d_decrements.swap(0);
+
+        if (d_type == DMCST_CONTINUOUS) {
+            if (incrementsOrEvents == 0 && decrements == 0) {
+                continue;  // CONTINUE
+            }
+
+            d_currentStats.d_value += sum;
+            d_currentStats.d_incrementsOrEvents += incrementsOrEvents;
+            d_currentStats.d_decrementsOrSum += decrements;
+            hasUpdates = true;
+        }
+        else {
+            const bsls::Types::Int64 min = shard.d_min.swap(MAX_INT);
+            const bsls::Types::Int64 max = shard.d_max.swap(MIN_INT);
+
+            if (incrementsOrEvents == 0) {
+                continue;  // CONTINUE
+            }
+
+            d_currentStats.d_decrementsOrSum += sum;
+            d_currentStats.d_incrementsOrEvents += incrementsOrEvents;
+
+            // A concurrent 'reportValue' may have updated the sum but not
+            // yet the min and max.
+            if (min != MAX_INT) {
+                updateMinMax(min);
+            }
+            if (max != MIN_INT) {
+                updateMinMax(max);
+            }
+        }
+    }
+
+    if (hasUpdates) {
+        // The value of a sharded continuous value is only known now.
+        updateMinMax(d_currentStats.d_value);
+    }
+}
+
 void StatValue::aggregateLevel(int level, bsls::Types::Int64 snapshotTime)
 {
     if (level + 1 >= (int)d_levelStartIndices.size() - 1) {
@@ -70,6 +160,14 @@ void StatValue::aggregateLevel(int level, bsls::Types::Int64 snapshotTime)
         aggSnapshot.d_max        = bsl::max(aggSnapshot.d_max, snapshot.d_max);
     }
 
+    if (!d_histograms.empty()) {
+        // The distribution of the new snapshot is the one aggregated since
+        // the previous snapshot of that level.
+        Histogram& aggHistogram = d_histograms[numLevels() + level + 1];
+        d_histograms[2 + level] = aggHistogram;
+        aggHistogram.reset();
+    }
+
     if (d_curSnapshotIndices[level + 1] == 0) {
         // Advance to the next aggregation level
         aggregateLevel(level + 1, snapshotTime);
@@ -85,6 +183,8 @@ StatValue::StatValue(bslma::Allocator* basicAllocator)
 , d_curSnapshotIndices(basicAllocator)
 , d_min(0)
 , d_max(0)
+, d_shards(basicAllocator)
+, d_histograms(basicAllocator)
 {
 }
 
@@ -99,6 +199,8 @@ StatValue::StatValue(const bsl::vector<int>& sizes,
 , d_curSnapshotIndices(basicAllocator)
 , d_min(0)
 , d_max(0)
+, d_shards(basicAllocator)
+, d_histograms(basicAllocator)
 {
     init(sizes, type, initTime);
 }
@@ -111,6 +213,8 @@ StatValue::StatValue(const StatValue& other, bslma::Allocator* basicAllocator)
 , d_curSnapshotIndices(other.d_curSnapshotIndices, basicAllocator)
 , d_min(other.d_min)
 , d_max(other.d_max)
+, d_shards(other.d_shards, basicAllocator)
+, d_histograms(other.d_histograms, basicAllocator)
 {
 }
 
@@ -123,6 +227,8 @@ StatValue& StatValue::operator=(const StatValue& rhs)
     d_curSnapshotIndices = rhs.d_curSnapshotIndices;
     d_min                = rhs.d_min;
     d_max                = rhs.d_max;
+    d_shards             = rhs.d_shards;
+    d_histograms         = rhs.d_histograms;
 
     return *this;
 }
@@ -161,6 +267,10 @@ void StatValue::addSnapshot(const StatValue& other)
 
     d_currentStats.d_incrementsOrEvents += otherSnapshot.d_incrementsOrEvents;
     d_currentStats.d_decrementsOrSum += otherSnapshot.d_decrementsOrSum;
+
+    if (!d_histograms.empty()) {
+        d_histograms[0].add(other.d_histograms[1]);
+    }
 }
 
 void StatValue::setFromUpdate(const mwcstm::StatValueUpdate& update)
@@ -203,8 +313,23 @@ void StatValue::setFromUpdate(const mwcstm::StatValueUpdate& update)
     }
 }
 
+void StatValue::setNumShards(int numShards)
+{
+    BSLS_ASSERT(0 <= numShards);
+
+    collectShards();
+
+    d_shards.clear();
+    if (numShards > 0) {
+        d_shards.resize(bdlb::BitUtil::roundUpToBinaryPower(
+            static_cast<bsl::uint32_t>(numShards)));
+    }
+}
+
 void StatValue::takeSnapshot(bsls::Types::Int64 snapshotTime)
 {
+    collectShards();
+
     bsls::Types::Int64 value = d_currentStats.d_value;
     bsls::Types::Int64 incrementsOrEvents;
     bsls::Types::Int64 decrementsOrSum;
@@ -237,6 +362,18 @@ void StatValue::takeSnapshot(bsls::Types::Int64 snapshotTime)
     snapshot.d_decrementsOrSum    = decrementsOrSum;
     snapshot.d_snapshotTime       = snapshotTime;
 
+    if (!d_histograms.empty()) {
+        // Move the values reported since the previous snapshot, and
+        // aggregate them into the next snapshot of each higher level.
+        Histogram& histogram = d_histograms[1];
+        histogram.reset();
+        d_histograms[0].moveTo(&histogram);
+
+        for (int level = 1; level < numLevels(); ++level) {
+            d_histograms[numLevels() + level].add(histogram);
+        }
+    }
+
     if (d_curSnapshotIndices[0] == 0) {
         // We've performed enough snapshots to advance to the next aggregation
         // level
@@ -246,14 +383,21 @@ void StatValue::takeSnapshot(bsls::Types::Int64 snapshotTime)
 
 void StatValue::clear(bsls::Types::Int64 snapshotTime)
 {
-    d_currentStats.reset(d_type == DMCST_DISCRETE, 0);
+    d_currentStats.reset(d_type != DMCST_CONTINUOUS, 0);
+    for (size_t i = 0; i < d_shards.size(); ++i) {
+        d_shards[i].reset();
+    }
     d_curSnapshotIndices.assign(d_curSnapshotIndices.size(), 0);
 
+    for (size_t i = 0; i < d_histograms.size(); ++i) {
+        d_histograms[i].reset();
+    }
+
     for (size_t i = 0; i < d_history.size(); ++i) {
-        d_history[i].reset(d_type == DMCST_DISCRETE, snapshotTime);
+        d_history[i].reset(d_type != DMCST_CONTINUOUS, snapshotTime);
     }
 
-    if (d_type == DMCST_DISCRETE) {
+    if (d_type != DMCST_CONTINUOUS) {
         d_min = MAX_INT;
         d_max = MIN_INT;
     }
@@ -268,11 +412,12 @@ void StatValue::init(const bsl::vector<int>& sizes,
                      bsls::Types::Int64      snapshotTime)
 {
     d_type = type;
+    d_shards.clear();
     d_levelStartIndices.resize(sizes.size() + 1);
     d_curSnapshotIndices.assign(sizes.size(), 0);
-    d_min = (d_type == DMCST_DISCRETE ? MAX_INT : 0);
-    d_max = (d_type == DMCST_DISCRETE ? MIN_INT : 0);
-    d_currentStats.reset(d_type == DMCST_DISCRETE, 0);
+    d_min = (d_type != DMCST_CONTINUOUS ? MAX_INT : 0);
+    d_max = (d_type != DMCST_CONTINUOUS ? MIN_INT : 0);
+    d_currentStats.reset(d_type != DMCST_CONTINUOUS, 0);
 
     int historySize = 0;
     for (size_t i = 0; i < sizes.size(); ++i) {
@@ -284,8 +429,16 @@ void StatValue::init(const bsl::vector<int>& sizes,
     d_history.clear();
     d_history.resize(historySize);
 
+    d_histograms.clear();
+    if (d_type == DMCST_HISTOGRAM) {
+        // The current distribution, the distribution of the last snapshot of
+        // each level, and the one being aggregated for each level above the
+        // first one.
+        d_histograms.resize(2 * sizes.size());
+    }
+
     for (size_t i = 0; i < d_history.size(); ++i) {
-        d_history[i].reset(d_type == DMCST_DISCRETE, snapshotTime);
+        d_history[i].reset(d_type != DMCST_CONTINUOUS, snapshotTime);
     }
 }
 
@@ -314,6 +467,7 @@ StatValue::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("CurSnapshotIndices", d_curSnapshotIndices);
     printer.printAttribute("Min", d_min);
     printer.printAttribute("Max", d_max);
+    printer.printAttribute("NumShards", d_shards.size());
     printer.end();
 
     return stream;
@@ -403,14 +557,14 @@ void StatValueUtil::loadUpdateImp(mwcstm::StatValueUpdate* update,
                 }
             } break;
             case Fields::DMCSTM_EVENTS: {
-                if (StatValue::DMCST_DISCRETE == value.type() &&
+                if (StatValue::DMCST_CONTINUOUS != value.type() &&
                     (full || current.events() != last->events())) {
                     update->fields().push_back(current.events());
                     mask = bdlb::BitUtil::withBitSet(mask, i);
                 }
             } break;
             case Fields::DMCSTM_SUM: {
-                if (StatValue::DMCST_DISCRETE == value.type() &&
+                if (StatValue::DMCST_CONTINUOUS != value.type() &&
                     (full || current.sum() != last->sum())) {
                     update->fields().push_back(current.sum());
                     mask = bdlb::BitUtil::withBitSet(mask, i);
@@ -24,6 +24,7 @@
 // mwcst::StatValueUtil : non-primitive operations on a 'StatValue'.
 //
 //@SEE_ALSO:
+//  mwcst_histogram
 //  mwcst_statcontext
 //  mwcst_statutil
 //
@@ -35,9 +36,47 @@
 // the 'mwcst::StatContext' component.  Refer to the usage examples in the
 // documentation of that component.
 //
+/// Histogram Values
+///----------------
+// A 'mwcst::StatValue' of type 'DMCST_HISTOGRAM' is a discrete value which
+// additionally records the distribution of its reported values in a
+// 'mwcst::Histogram', so that percentiles (for example the p99 of a latency)
+// can be extracted, in addition to the min, max, sum and number of events.
+// Recording a value in the histogram takes constant time.
+//
+// As a histogram is large (a few kilobytes), the distribution is not kept
+// for every snapshot of the history: only the distribution of the values
+// reported during the interval ending at the most recent snapshot of each
+// level is kept, and is available from 'histogram'.  The distribution of a
+// higher level snapshot is the merge of the distributions of the lower
+// level snapshots it aggregates, and 'addSnapshot' merges the distribution
+// of the added value, so that the totals of a 'mwcst::StatContext' have the
+// distribution of all of its subcontexts.  Note that the distribution is not
+// part of 'mwcstm::StatValueUpdate', a histogram value is seen as a discrete
+// value by the receiver of an update.
+//
+/// Sharded Writers
+///---------------
+// By default, all threads updating a 'mwcst::StatValue' modify the same
+// atomic variables, so that concurrent writers keep bouncing the cache line
+// holding them.  A 'mwcst::StatValue' may instead be configured, using
+// 'setNumShards', to accumulate the updates made by 'adjustValue' and
+// 'reportValue' into a number of writer-local shards, each on its own cache
+// line, with each thread writing to the shard selected by its thread id.  The
+// shards are folded into the current value by 'takeSnapshot'.
+//
+// This comes at the cost of the memory used by the shards, and of precision
+// for continuous values: as the value is only known when shards are folded,
+// the min and max of a sharded continuous value are those observed at
+// snapshot time, and by 'setValue', rather than after each update.  The min
+// and max of a discrete value are not affected.
+//
 /// Thread Safety
 ///-------------
-// 'adjustValue' and 'setValue' are thread-safe.  All other functions are not.
+// 'adjustValue', 'setValue' and 'reportValue' are thread-safe.  All other
+// functions are not.
+
+#include <mwcst_histogram.h>
 
 #ifndef INCLUDED_BSLIM_PRINTER
 #include <bslim_printer.h>
@@ -51,6 +90,10 @@
 #include <bslmf_nestedtraitdeclaration.h>
 #endif
 
+#ifndef INCLUDED_BSLMT_THREADUTIL
+#include <bslmt_threadutil.h>
+#endif
+
 #ifndef INCLUDED_BSLS_ATOMIC
 #include <bsls_atomic.h>
 #endif
@@ -199,6 +242,60 @@ bool          operator>(const StatValue_SnapshotLocation& lhs,
 bsl::ostream& operator<<(bsl::ostream&                     stream,
                          const StatValue_SnapshotLocation& location);
 
+// =====================
+// class StatValue_Shard
+// =====================
+
+/// Writer-local accumulator of the updates made to a sharded `StatValue`.
+/// The object is padded so that the accumulators of two distinct shards
+/// stored contiguously never share a cache line.
+class StatValue_Shard {
+  private:
+    // PRIVATE TYPES
+    enum {
+        // Size of the object, large enough for the accumulators of two
+        // contiguous shards to be on distinct cache lines, whatever the
+        // alignment of the first one.
+        k_SIZE = 128,
+
+        // Size of the accumulators
+        k_DATA_SIZE = 5 * sizeof(bsls::Types::Int64)
+    };
+
+    // DATA
+
+    // sum of deltas if continuous value, sum of reported values if discrete
+    // value
+    bsls::AtomicInt64 d_sum;
+
+    // # of increments if continuous value, # of events if discrete value
+    bsls::AtomicInt64 d_incrementsOrEvents;
+
+    // # of decrements if continuous value, unused if discrete value
+    bsls::AtomicInt64 d_decrements;
+
+    // min and max reported values if discrete value, unused if continuous
+    // value
+    bsls::AtomicInt64 d_min;
+    bsls::AtomicInt64 d_max;
+
+    char d_padding[k_SIZE - k_DATA_SIZE];
+
+    // FRIENDS
+    friend class StatValue;
+
+  public:
+    // CREATORS
+    StatValue_Shard();
+    StatValue_Shard(const StatValue_Shard& other);
+
+    // MANIPULATORS
+    StatValue_Shard& operator=(const StatValue_Shard& rhs);
+
+    /// Reset all accumulators.
+    void reset();
+};
+
 // ===============
 // class StatValue
 // ===============
@@ -223,7 +320,12 @@ class StatValue {
         /// are added, their set of reported events is simply considered as
         /// a single stream of events.  For example, the max of two added
         /// discrete values will be the max of all the individual maxes.
-        DMCST_DISCRETE
+        DMCST_DISCRETE,
+
+        /// A histogram value is a discrete value which also records the
+        /// distribution of the reported values, so that percentiles of the
+        /// values reported between snapshots can be computed.
+        DMCST_HISTOGRAM
     };
 
   private:
@@ -254,9 +356,32 @@ class StatValue {
 
     bsls::Types::Int64 d_max;  // max value since creation
 
+    bsl::vector<StatValue_Shard> d_shards;
+    // Writer-local shards, empty unless
+    // sharded writers are enabled.  The
+    // number of shards is a power of 2.
+
+    bsl::vector<Histogram> d_histograms;
+    // Distributions of a histogram value,
+    // empty for other types.  The first
+    // element records the current values,
+    // followed by the distribution of the
+    // last snapshot of each level, then by
+    // the distribution being aggregated for
+    // the next snapshot of each level above
+    // the first one.
+
     // PRIVATE MANIPULATORS
     void updateMinMax(bsls::Types::Int64 value);
 
+    /// Return the shard to be updated by the calling thread.  The behavior
+    /// is undefined unless sharded writers are enabled.
+    StatValue_Shard& shard();
+
+    /// Fold the updates accumulated in the shards, if any, into the
+    /// current stats.
+    void collectShards();
+
     /// Aggregate the specified aggregation `level` if there is an
     /// aggregation level above it using the specified `snapshotTime`
     void aggregateLevel(int level, bsls::Types::Int64 snapshotTime);
@@ -285,9 +410,18 @@ class StatValue {
     void setValue(bsls::Types::Int64 value);
 
     /// Report the specified `value` to this StatValue.  The behavior is
-    /// undefined unless this is a discrete StatValue.
+    /// undefined unless this is a discrete or histogram StatValue.
     void reportValue(bsls::Types::Int64 value);
 
+    /// Accumulate subsequent `adjustValue` and `reportValue` updates into
+    /// the specified `numShards` writer-local shards, rounded up to the
+    /// next power of 2, or disable sharded writers if `numShards` is 0.
+    /// Updates already accumulated are folded into the current stats.  The
+    /// behavior is undefined if this function is called concurrently with
+    /// any update, or unless `0 <= numShards`.  See "Sharded Writers" in
+    /// the component documentation.
+    void setNumShards(int numShards);
+
     /// Add the snapshot of the specified `other` StatValue to the current
     /// value of this `StatValue`.
     void addSnapshot(const StatValue& other);
@@ -348,6 +482,16 @@ class StatValue {
     /// Return the maximum value of this StatValue since creation.
     bsls::Types::Int64 max() const;
 
+    /// Return the number of writer-local shards of this StatValue, or 0 if
+    /// sharded writers are disabled.
+    int numShards() const;
+
+    /// Return the distribution of the values reported during the interval
+    /// ending at the most recent snapshot of the specified `level`.  The
+    /// behavior is undefined unless this is a histogram StatValue and
+    /// `0 <= level < numLevels()`.
+    const Histogram& histogram(int level) const;
+
     /// Format this object to the specified output `stream` at the (absolute
     /// value of) the optionally specified indentation `level` and return a
     /// reference to `stream`.  If `level` is specified, optionally specify
@@ -627,10 +771,35 @@ inline void StatValue::updateMinMax(bsls::Types::Int64 value)
 }
 
 // MANIPULATORS
+inline StatValue_Shard& StatValue::shard()
+{
+    BSLS_ASSERT_SAFE(!d_shards.empty());
+
+    // Thread ids are typically aligned addresses: mix the bits so that the
+    // selected shard depends on all of them.
+    const bsls::Types::Uint64 hash = bslmt::ThreadUtil::selfIdAsUint64() *
+                                     0x9E3779B97F4A7C15ULL;
+
+    return d_shards[static_cast<size_t>(hash >> 32) & (d_shards.size() - 1)];
+}
+
 inline void StatValue::adjustValue(bsls::Types::Int64 delta)
 {
     BSLS_ASSERT(d_type == DMCST_CONTINUOUS);
 
+    if (!d_shards.empty()) {
+        StatValue_Shard& localShard = shard();
+
+        localShard.d_sum.addRelaxed(delta);
+        if (delta > 0) {
+            localShard.d_incrementsOrEvents.addRelaxed(1);
+        }
+        else if (delta < 0) {
+            localShard.d_decrements.addRelaxed(1);
+        }
+        return;  // RETURN
+    }
+
     bsls::Types::Int64 newValue = (d_currentStats.d_value += delta);
 
     updateMinMax(newValue);
@@ -647,6 +816,12 @@ inline void StatValue::setValue(bsls::Types::Int64 value)
 {
     BSLS_ASSERT(d_type == DMCST_CONTINUOUS);
 
+    if (!d_shards.empty()) {
+        // Fold pending deltas first, so that they are not applied on top of
+        // the new value at the next snapshot.
+        collectShards();
+    }
+
     bsls::Types::Int64 oldValue = d_currentStats.d_value.swap(value);
     updateMinMax(value);
 
@@ -660,7 +835,29 @@ inline void StatValue::setValue(bsls::Types::Int64 value)
 
 inline void StatValue::reportValue(bsls::Types::Int64 value)
 {
-    BSLS_ASSERT(d_type == DMCST_DISCRETE);
+    BSLS_ASSERT(d_type != DMCST_CONTINUOUS);
+
+    if (!d_histograms.empty()) {
+        d_histograms[0].record(value);
+    }
+
+    if (!d_shards.empty()) {
+        StatValue_Shard& localShard = shard();
+
+        localShard.d_sum.addRelaxed(value);
+        localShard.d_incrementsOrEvents.addRelaxed(1);
+
+        bsls::Types::Int64 min = localShard.d_min.loadRelaxed();
+        while (min > value) {
+            min = localShard.d_min.testAndSwap(min, value);
+        }
+
+        bsls::Types::Int64 max = localShard.d_max.loadRelaxed();
+        while (max < value) {
+            max = localShard.d_max.testAndSwap(max, value);
+        }
+        return;  // RETURN
+    }
 
     d_currentStats.d_decrementsOrSum += value;
     d_currentStats.d_incrementsOrEvents++;
@@ -670,7 +867,15 @@ inline void StatValue::reportValue(bsls::Types::Int64 value)
 
 inline void StatValue::clearCurrentStats()
 {
-    d_currentStats.reset(d_type == DMCST_DISCRETE, 0);
+    d_currentStats.reset(d_type != DMCST_CONTINUOUS, 0);
+
+    for (size_t i = 0; i < d_shards.size(); ++i) {
+        d_shards[i].reset();
+    }
+
+    if (!d_histograms.empty()) {
+        d_histograms[0].reset();
+    }
 }
 
 // ACCESSORS
@@ -679,6 +884,19 @@ inline StatValue::Type StatValue::type() const
     return d_type;
 }
 
+inline int StatValue::numShards() const
+{
+    return static_cast<int>(d_shards.size());
+}
+
+inline const Histogram& StatValue::histogram(int level) const
+{
+    BSLS_ASSERT_SAFE(d_type == DMCST_HISTOGRAM);
+    BSLS_ASSERT_SAFE(0 <= level && level < numLevels());
+
+    return d_histograms[1 + level];
+}
+
 inline int StatValue::numLevels() const
 {
     return static_cast<int>(d_curSnapshotIndices.size());
@@ -0,0 +1,465 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcsys_profilerutil.cpp                                            -*-C++-*-
+#include <mwcsys_profilerutil.h>
+
+#include <mwcscm_version.h>
+// BDE
+#include <ball_log.h>
+#include <balst_stacktrace.h>
+#include <balst_stacktraceframe.h>
+#include <balst_stacktraceutil.h>
+#include <bsl_algorithm.h>
+#include <bsl_cerrno.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_map.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+#include <bslma_default.h>
+#include <bslmt_threadutil.h>
+#include <bsls_annotation.h>
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+#include <bsls_systemclocktype.h>
+#include <bsls_systemtime.h>
+
+// Linux
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#include <execinfo.h>
+#include <signal.h>
+#include <sys/syscall.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+namespace BloombergLP {
+namespace mwcsys {
+
+namespace {
+const char k_LOG_CATEGORY[] = "MWCSYS.PROFILERUTIL";
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+/// Number of innermost frames of a call stack recorded by the signal
+/// handler which belong to the handler itself: the handler, and the signal
+/// trampoline of the C library.
+const int k_NUM_HANDLER_FRAMES = 2;
+
+/// Call stack of a thread, recorded by the signal handler.
+struct Sample {
+    // PUBLIC DATA
+    pid_t d_threadId;
+    // Identifier of the thread
+
+    int d_numFrames;
+    // Number of frames in 'd_frames'
+
+    void* d_frames[ProfilerUtil::k_MAX_FRAMES + k_NUM_HANDLER_FRAMES];
+    // Return addresses of the frames, from
+    // the innermost to the outermost
+};
+
+bsls::AtomicBool g_inProgress(false);
+// Whether a profile is in progress
+
+bool g_isHandlerInstalled = false;
+// Whether the signal handler is installed;
+// only accessed by the thread having set
+// 'g_inProgress'
+
+bsls::AtomicBool g_isSampling(false);
+// Whether the signal handler records
+// samples
+
+bsls::AtomicInt g_numActiveHandlers(0);
+// Number of signal handlers currently
+// recording a sample
+
+Sample* g_samples_p = 0;
+// Buffer of the samples of the profile in
+// progress
+
+int g_capacity = 0;
+// Capacity of 'g_samples_p'
+
+bsls::AtomicInt g_numSamples(0);
+// Number of samples taken by the profile
+// in progress, including the dropped ones
+
+/// Handler of the `SIGPROF` signal, recording the call stack of the
+/// interrupted thread if sampling is enabled.
+extern "C" void onSigProf(int)
+{
+    if (!g_isSampling) {
+        return;  // RETURN
+    }
+
+    const int savedErrno = errno;
+
+    ++g_numActiveHandlers;
+    if (g_isSampling) {
+        // 'g_isSampling' is checked again once this handler is counted as
+        // active, so that the profiling thread, which disables sampling and
+        // then waits for the active handlers, never reads a sample being
+        // recorded.
+        const int index = g_numSamples.add(1) - 1;
+        if (index < g_capacity) {
+            Sample& sample     = g_samples_p[index];
+            sample.d_threadId  = static_cast<pid_t>(::syscall(SYS_gettid));
+            sample.d_numFrames = ::backtrace(
+                sample.d_frames,
+                ProfilerUtil::k_MAX_FRAMES + k_NUM_HANDLER_FRAMES);
+        }
+    }
+    --g_numActiveHandlers;
+
+    errno = savedErrno;
+}
+
+/// Install the signal handler of `SIGPROF`, if not already installed.
+/// Return 0 on success, or a non-zero value and write a description of the
+/// error to the specified `errorDescription` otherwise.
+int installHandler(bsl::ostream& errorDescription)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS         = 0,
+        rc_QUERY_FAILURE   = -1,
+        rc_HANDLER_IN_USE  = -2,
+        rc_INSTALL_FAILURE = -3
+    };
+
+    if (g_isHandlerInstalled) {
+        return rc_SUCCESS;  // RETURN
+    }
+
+    struct sigaction current;
+    if (::sigaction(SIGPROF, 0, &current) != 0) {
+        errorDescription << "failed to query the SIGPROF handler: "
+                         << bsl::strerror(errno);
+        return rc_QUERY_FAILURE;  // RETURN
+    }
+
+    if ((current.sa_flags & SA_SIGINFO) ||
+        (current.sa_handler != SIG_DFL && current.sa_handler != SIG_IGN)) {
+        errorDescription << "another SIGPROF handler is installed";
+        return rc_HANDLER_IN_USE;  // RETURN
+    }
+
+    struct sigaction action;
+    bsl::memset(&action, 0, sizeof(action));
+    action.sa_handler = &onSigProf;
+    action.sa_flags   = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if (::sigaction(SIGPROF, &action, 0) != 0) {
+        errorDescription << "failed to install the SIGPROF handler: "
+                         << bsl::strerror(errno);
+        return rc_INSTALL_FAILURE;  // RETURN
+    }
+
+    g_isHandlerInstalled = true;
+    return rc_SUCCESS;
+}
+
+/// Disable sampling, and wait for the signal handlers recording a sample to
+/// complete.
+void stopSampling()
+{
+    g_isSampling = false;
+    while (g_numActiveHandlers != 0) {
+        bslmt::ThreadUtil::yield();
+    }
+}
+
+/// Return the name of the thread having the specified `threadId`, as set by
+/// `mwcsys::ThreadUtil::setCurrentThreadName`, or a name derived from
+/// `threadId` if the thread is gone.  Use the specified `allocator` to
+/// supply memory.
+bsl::string threadName(pid_t threadId, bslma::Allocator* allocator)
+{
+    bsl::ostringstream path(allocator);
+    path << "/proc/self/task/" << threadId << "/comm";
+
+    bsl::string   name(allocator);
+    bsl::ifstream file(path.str().c_str());
+    if (!file || !bsl::getline(file, name) || name.empty()) {
+        bsl::ostringstream os(allocator);
+        os << "thread-" << threadId;
+        return os.str();  // RETURN
+    }
+
+    return name;
+}
+
+/// Return the address to resolve for the frame at the specified `index` of
+/// the specified `sample`.  The innermost frame below the signal handler is
+/// the interrupted instruction; each other frame is a return address,
+/// which is adjusted to fall into the call instruction, so that it resolves
+/// to the calling function even if the call is the last instruction of the
+/// function.
+const void* frameAddress(const Sample& sample, int index)
+{
+    const char* address = static_cast<const char*>(sample.d_frames[index]);
+    return index == k_NUM_HANDLER_FRAMES ? address : address - 1;
+}
+
+/// Write the specified `numSamples` first `samples` to the specified
+/// `stream` in the folded stacks format, using the specified `allocator` to
+/// supply memory.
+void writeProfile(bsl::ostream&              stream,
+                  const bsl::vector<Sample>& samples,
+                  int                        numSamples,
+                  bslma::Allocator*          allocator)
+{
+    typedef bsl::unordered_map<const void*, bsl::string> Symbols;
+    typedef bsl::unordered_map<pid_t, bsl::string>       ThreadNames;
+    typedef bsl::map<bsl::string, int>                   Stacks;
+
+    // Resolve the symbols of all the distinct addresses at once, as the
+    // resolver parses the symbol tables of the process on each call.
+    Symbols                  symbols(allocator);
+    bsl::vector<const void*> addresses(allocator);
+    for (int i = 0; i < numSamples; ++i) {
+        for (int j = k_NUM_HANDLER_FRAMES; j < samples[i].d_numFrames; ++j) {
+            const void* address = frameAddress(samples[i], j);
+            if (symbols.insert(bsl::make_pair(address, bsl::string()))
+                    .second) {
+                addresses.push_back(address);
+            }
+        }
+    }
+
+    if (!addresses.empty()) {
+        balst::StackTrace trace(allocator);
+        const int         rc = balst::StackTraceUtil::
+            loadStackTraceFromAddressArray(&trace,
+                                           addresses.data(),
+                                           static_cast<int>(addresses.size()));
+        if (rc != 0) {
+            BALL_LOG_SET_CATEGORY(k_LOG_CATEGORY);
+            BALL_LOG_WARN << "Failed to resolve the symbols of the profile "
+                          << "[rc: " << rc << "]";
+        }
+
+        for (int i = 0; i < trace.length(); ++i) {
+            const balst::StackTraceFrame& frame  = trace[i];
+            bsl::string&                  symbol = symbols[frame.address()];
+            if (frame.isSymbolNameKnown()) {
+                symbol = frame.symbolName();
+            }
+            else if (frame.isLibraryFileNameKnown()) {
+                const bsl::string& library = frame.libraryFileName();
+                symbol.assign(1, '[');
+                symbol.append(library,
+                              library.rfind('/') + 1,
+                              bsl::string::npos);
+                symbol.append(1, ']');
+            }
+        }
+    }
+
+    ThreadNames threadNames(allocator);
+    Stacks      stacks(allocator);
+    bsl::string stack(allocator);
+    for (int i = 0; i < numSamples; ++i) {
+        const Sample&         sample = samples[i];
+        ThreadNames::iterator it     = threadNames.find(sample.d_threadId);
+        if (it == threadNames.end()) {
+            it = threadNames
+                     .insert(bsl::make_pair(
+                         sample.d_threadId,
+                         threadName(sample.d_threadId, allocator)))
+                     .first;
+        }
+
+        stack = it->second;
+        for (int j = sample.d_numFrames - 1; j >= k_NUM_HANDLER_FRAMES; --j) {
+            const bsl::string& symbol = symbols[frameAddress(sample, j)];
+            stack.append(1, ';');
+            stack.append(symbol.empty() ? "[unknown]" : symbol);
+        }
+
+        ++stacks[stack];
+    }
+
+    for (Stacks::const_iterator it = stacks.begin(); it != stacks.end();
+         ++it) {
+        stream << it->first << ' ' << it->second << '\n';
+    }
+}
+
+/// Implementation of `ProfilerUtil::profile`, called while having set
+/// `g_inProgress`.
+int profileImp(bsl::ostream&             stream,
+               bsl::ostream&             errorDescription,
+               const bsls::TimeInterval& duration,
+               int                       frequency,
+               bslma::Allocator*         allocator)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS         = 0,
+        rc_HANDLER_FAILURE = -1,
+        rc_TIMER_FAILURE   = -2
+    };
+
+    BALL_LOG_SET_CATEGORY(k_LOG_CATEGORY);
+
+    int rc = installHandler(errorDescription);
+    if (rc != 0) {
+        return rc * 10 + rc_HANDLER_FAILURE;  // RETURN
+    }
+
+    // Unwind a first call stack outside of the signal handler, so that the
+    // unwinder is loaded and initialized before sampling.
+    void* frames[ProfilerUtil::k_MAX_FRAMES];
+    ::backtrace(frames, ProfilerUtil::k_MAX_FRAMES);
+
+    // Size the buffer for the samples of all the CPUs being busy during the
+    // whole profile.
+    const long   numCpus    = bsl::max(::sysconf(_SC_NPROCESSORS_ONLN), 1L);
+    const double maxSamples = duration.totalSecondsAsDouble() * frequency *
+                              static_cast<double>(numCpus);
+    const int capacity = maxSamples < ProfilerUtil::k_MAX_SAMPLES
+                             ? static_cast<int>(maxSamples) + 1
+                             : ProfilerUtil::k_MAX_SAMPLES;
+
+    bsl::vector<Sample> samples(capacity, allocator);
+    g_samples_p  = samples.data();
+    g_capacity   = capacity;
+    g_numSamples = 0;
+    g_isSampling = true;
+
+    struct itimerval timer;
+    timer.it_interval.tv_sec  = 0;
+    timer.it_interval.tv_usec = 1000 * 1000 / frequency;
+    timer.it_value            = timer.it_interval;
+    if (::setitimer(ITIMER_PROF, &timer, 0) != 0) {
+        stopSampling();
+        errorDescription << "failed to arm the profiling timer: "
+                         << bsl::strerror(errno);
+        return rc_TIMER_FAILURE;  // RETURN
+    }
+
+    BALL_LOG_INFO << "Profiling for " << duration.totalSecondsAsDouble()
+                  << " seconds at " << frequency << " Hz";
+
+    const bsls::TimeInterval deadline =
+        bsls::SystemTime::nowMonotonicClock() + duration;
+    while (bsls::SystemTime::nowMonotonicClock() < deadline) {
+        bslmt::ThreadUtil::sleepUntil(deadline,
+                                      bsls::SystemClockType::e_MONOTONIC);
+    }
+
+    bsl::memset(&timer, 0, sizeof(timer));
+    ::setitimer(ITIMER_PROF, &timer, 0);
+    stopSampling();
+
+    const int numSamples = bsl::min(g_numSamples.load(), capacity);
+    if (g_numSamples > capacity) {
+        BALL_LOG_WARN << "Dropped " << (g_numSamples - capacity)
+                      << " samples of the profile, having reached the "
+                      << "maximum of " << capacity << " samples";
+    }
+    g_samples_p = 0;
+    g_capacity  = 0;
+
+    writeProfile(stream, samples, numSamples, allocator);
+
+    BALL_LOG_INFO << "Profiled " << numSamples << " samples";
+
+    return rc_SUCCESS;
+}
+
+#endif
+
+}  // close unnamed namespace
+
+// -------------------
+// struct ProfilerUtil
+// -------------------
+
+// LINUX
+// -----
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+const bool ProfilerUtil::k_SUPPORTED = true;
+
+int ProfilerUtil::profile(bsl::ostream&             stream,
+                          bsl::ostream&             errorDescription,
+                          const bsls::TimeInterval& duration,
+                          int                       frequency,
+                          bslma::Allocator*         basicAllocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(duration > bsls::TimeInterval(0));
+    BSLS_ASSERT_SAFE(1 <= frequency && frequency <= 1000);
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS     = 0,
+        rc_IN_PROGRESS = -1,
+        rc_FAILURE     = -2
+    };
+
+    if (g_inProgress.testAndSwap(false, true)) {
+        errorDescription << "a profile is already in progress";
+        return rc_IN_PROGRESS;  // RETURN
+    }
+
+    const int rc = profileImp(stream,
+                              errorDescription,
+                              duration,
+                              frequency,
+                              bslma::Default::allocator(basicAllocator));
+    g_inProgress = false;
+
+    if (rc != 0) {
+        return rc * 10 + rc_FAILURE;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+// OTHER PLATFORMS
+// ---------------
+#else
+
+const bool ProfilerUtil::k_SUPPORTED = false;
+
+int ProfilerUtil::profile(
+    BSLS_ANNOTATION_UNUSED bsl::ostream&             stream,
+    bsl::ostream&                                    errorDescription,
+    BSLS_ANNOTATION_UNUSED const bsls::TimeInterval& duration,
+    BSLS_ANNOTATION_UNUSED int                       frequency,
+    BSLS_ANNOTATION_UNUSED bslma::Allocator*         basicAllocator)
+{
+    // NOT AVAILABLE
+
+    static_cast<void>(k_LOG_CATEGORY);  // suppress unused variable warning
+
+    errorDescription << "profiling is not supported on this platform";
+    return -1;
+}
+
+#endif
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,140 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcsys_profilerutil.h                                              -*-C++-*-
+#ifndef INCLUDED_MWCSYS_PROFILERUTIL
+#define INCLUDED_MWCSYS_PROFILERUTIL
+
+//@PURPOSE: Provide a sampling CPU profiler of the threads of the process.
+//
+//@CLASSES:
+//  mwcsys::ProfilerUtil: sampling CPU profiler of the threads of the process
+//
+//@DESCRIPTION: 'mwcsys::ProfilerUtil' provides a utility namespace to profile,
+// on demand and for a given duration, the CPU usage of all the threads of the
+// running process.
+//
+// The profiler arms a 'ITIMER_PROF' interval timer, which expires each time
+// the threads of the process have consumed, together, a given amount of CPU
+// time, and delivers a 'SIGPROF' signal to the thread that was running.  The
+// signal handler records the call stack and the identifier of the interrupted
+// thread into a preallocated buffer.  Once the duration has elapsed, the
+// timer is disarmed, the addresses of the call stacks are resolved to
+// symbols, and each thread is identified by its name (as set by
+// 'mwcsys::ThreadUtil::setCurrentThreadName').
+//
+// The profile is written in the *folded stacks* format, which is the input
+// format of the usual flame graph tools (e.g., 'flamegraph.pl'): one line per
+// distinct call stack, having the name of the thread followed by the frames of
+// the stack from the outermost to the innermost, separated by ';', and by the
+// number of samples of that stack, e.g.:
+//..
+//  bmqDispFQ-0;start_thread;...;mqbblp::QueueEngine::deliverMessages 42
+//..
+//
+/// Caveats
+///-------
+//: o The 'SIGPROF' signal handler is installed on the first call to
+//:   'profile', and is never uninstalled, so that a signal still in flight
+//:   when the timer is disarmed cannot terminate the process.  'profile'
+//:   fails if another 'SIGPROF' handler is installed.
+//:
+//: o The signal may interrupt a system call of the sampled thread, which is
+//:   restarted unless the system call does not support it, in which case it
+//:   fails with 'EINTR'.
+//:
+//: o The call stacks are unwound with 'backtrace', which is not guaranteed to
+//:   be async-signal-safe; it is called once before the timer is armed, so
+//:   that the unwinder is loaded outside of the signal handler.
+//
+/// Thread Safety
+///-------------
+// 'profile' is thread-safe, but only one profile can be taken at a time: a
+// call to 'profile' while another one is in progress fails.
+//
+/// Usage
+///-----
+//..
+//  bsl::ostringstream profile;
+//  bsl::ostringstream error;
+//  int rc = mwcsys::ProfilerUtil::profile(profile,
+//                                         error,
+//                                         bsls::TimeInterval(10));
+//  if (rc != 0) {
+//      BALL_LOG_ERROR << "Failed to profile: " << error.str();
+//  }
+//..
+
+// MWC
+
+// BDE
+#include <bsl_ostream.h>
+#include <bslma_allocator.h>
+#include <bsls_timeinterval.h>
+
+namespace BloombergLP {
+namespace mwcsys {
+
+// ===================
+// struct ProfilerUtil
+// ===================
+
+/// Utility namespace to profile the CPU usage of the threads of the process
+struct ProfilerUtil {
+    // CONSTANTS
+
+    /// Boolean constant indicating whether the current platform supports
+    /// profiling.
+    static const bool k_SUPPORTED;
+
+    /// Default sampling frequency, in samples per second of CPU time of the
+    /// process.
+    static const int k_DEFAULT_FREQUENCY = 99;
+
+    /// Maximum number of samples recorded by a profile; samples beyond this
+    /// limit are dropped.
+    static const int k_MAX_SAMPLES = 32 * 1024;
+
+    /// Maximum number of frames recorded per sample; the outermost frames
+    /// of deeper call stacks are dropped.
+    static const int k_MAX_FRAMES = 64;
+
+    // CLASS METHODS
+
+    /// Profile the CPU usage of all the threads of the process during the
+    /// specified `duration`, blocking the calling thread meanwhile, and
+    /// write the profile, in the folded stacks format, to the specified
+    /// `stream`.  Optionally specify a `frequency`, in samples per second
+    /// of CPU time of the process.  Optionally specify a `basicAllocator`
+    /// used to supply memory.  Return 0 on success, or a non-zero value
+    /// and write a description of the error to the specified
+    /// `errorDescription` otherwise (e.g., if a profile is already in
+    /// progress, or if `k_SUPPORTED` is false), in which case nothing is
+    /// written to `stream`.  The behavior is undefined unless `duration` is
+    /// positive and `1 <= frequency <= 1000`.
+    ///
+    /// PLATFORM NOTE:
+    ///   - this functionality is only supported on LINUX.
+    static int profile(bsl::ostream&             stream,
+                       bsl::ostream&             errorDescription,
+                       const bsls::TimeInterval& duration,
+                       int               frequency      = k_DEFAULT_FREQUENCY,
+                       bslma::Allocator* basicAllocator = 0);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,173 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcsys_profilerutil.t.cpp                                          -*-C++-*-
+#include <mwcsys_profilerutil.h>
+
+// MWC
+#include <mwcsys_threadutil.h>
+
+// BDE
+#include <bdlb_numericparseutil.h>
+#include <bdlf_bind.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bslmt_threadutil.h>
+#include <bsls_atomic.h>
+#include <bsls_timeinterval.h>
+#include <bslstl_stringref.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Name of the thread consuming CPU while profiling.
+const char k_BUSY_THREAD_NAME[] = "mwcProfTest";
+
+/// Name the current thread `k_BUSY_THREAD_NAME`, and consume CPU until the
+/// specified `stop` flag is set.
+void busyThread(bsls::AtomicBool* stop)
+{
+    mwcsys::ThreadUtil::setCurrentThreadName(k_BUSY_THREAD_NAME);
+
+    volatile unsigned int value = 0;
+    while (!*stop) {
+        for (int i = 0; i < 1000; ++i) {
+            value = value * 31 + i;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   1. If profiling is supported, 'profile' samples the threads consuming
+//      CPU, and writes one line per distinct call stack, starting with
+//      the name of the thread and ending with the number of samples.
+//   2. Profiling can be repeated.
+//   3. Otherwise, 'profile' fails with an error description.
+//
+// Testing:
+//   profile
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    if (!mwcsys::ProfilerUtil::k_SUPPORTED) {
+        bsl::ostringstream profile(s_allocator_p);
+        bsl::ostringstream error(s_allocator_p);
+        const int          rc = mwcsys::ProfilerUtil::profile(
+            profile,
+            error,
+            bsls::TimeInterval(0.1),
+            mwcsys::ProfilerUtil::k_DEFAULT_FREQUENCY,
+            s_allocator_p);
+        ASSERT_NE(rc, 0);
+        ASSERT(profile.str().empty());
+        ASSERT(!error.str().empty());
+        return;  // RETURN
+    }
+
+    bsls::AtomicBool          stop(false);
+    bslmt::ThreadUtil::Handle handle;
+    int                       rc = bslmt::ThreadUtil::createWithAllocator(
+        &handle,
+        bdlf::BindUtil::bindS(s_allocator_p, &busyThread, &stop),
+        s_allocator_p);
+    BSLS_ASSERT_OPT(rc == 0);
+
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        bsl::ostringstream profile(s_allocator_p);
+        bsl::ostringstream error(s_allocator_p);
+        rc = mwcsys::ProfilerUtil::profile(profile,
+                                           error,
+                                           bsls::TimeInterval(0.5),
+                                           1000,
+                                           s_allocator_p);
+        PV("rc: " << rc << ", error: '" << error.str() << "'");
+        ASSERT_EQ(rc, 0);
+
+        // Each line is a non empty stack followed by a positive count
+        bsl::istringstream lines(profile.str(), s_allocator_p);
+        bsl::string        line(s_allocator_p);
+        int                numBusySamples = 0;
+        while (bsl::getline(lines, line)) {
+            const bsl::string::size_type space = line.rfind(' ');
+            ASSERT_NE(space, bsl::string::npos);
+            ASSERT_GT(space, 0U);
+
+            int               count = 0;
+            bslstl::StringRef remainder;
+            ASSERT_EQ(bdlb::NumericParseUtil::parseInt(
+                          &count,
+                          &remainder,
+                          bslstl::StringRef(line).substr(space + 1)),
+                      0);
+            ASSERT(remainder.isEmpty());
+            ASSERT_GT(count, 0);
+
+            if (line.compare(0,
+                             sizeof(k_BUSY_THREAD_NAME) - 1,
+                             k_BUSY_THREAD_NAME) == 0) {
+                numBusySamples += count;
+            }
+        }
+
+        // The busy thread consumes a full CPU during 500 milliseconds,
+        // that is 500 samples at 1000 Hz; allow for the scheduling of the
+        // thread on a loaded host.
+        PV("busy thread samples: " << numBusySamples);
+        ASSERT_GT(numBusySamples, 50);
+    }
+
+    stop = true;
+    bslmt::ThreadUtil::join(handle);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -20,19 +20,29 @@
 // MWC
 #include <mwcst_statutil.h>
 #include <mwcst_statvalue.h>
+#include <mwcu_memoutstream.h>
 
 // BDE
 #include <bdlf_bind.h>
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
 #include <bdls_processutil.h>
+#include <bdlt_timeunitratio.h>
 #include <bsl_c_errno.h>
 #include <bsl_cmath.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
+#include <bsl_fstream.h>
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
 #include <bsl_ostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
+#include <bsls_platform.h>
 #include <bsls_timeinterval.h>
 
 // SYS
@@ -57,6 +67,9 @@ const char k_SUBCONTEXT_MEM[] = "mem";
 /// StatContext name of the OPERATING-SYSTEM top level statContext
 const char k_SUBCONTEXT_OS[] = "os";
 
+/// StatContext name of the THREADS top level statContext
+const char k_SUBCONTEXT_THREADS[] = "threads";
+
 /// Multiplier to use for reporting CPU stats from PerformanceMonitor into
 /// statContext
 const int k_CPU_MULTIPLIER = 1000;
@@ -109,8 +122,95 @@ enum {
     // because a higher priority process ran or
     // because the current process exceeded its time
     // slice
+
+    // THREADS (cumulative, in nanoseconds or in absolute number)
+    ,
+    k_STAT_THREAD_CPU_TIME = 0
+    // Time spent by the thread running on a CPU
+
+    ,
+    k_STAT_THREAD_RUN_DELAY = 1
+    // Time spent by the thread runnable, but waiting
+    // on a run queue
+
+    ,
+    k_STAT_THREAD_VOLUNTARY_CTX_SWITCHES = 2
+    // Number of times the thread voluntarily gave up
+    // the processor
+
+    ,
+    k_STAT_THREAD_INVOLUNTARY_CTX_SWITCHES = 3
+    // Number of times the thread was preempted
+};
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+/// Scheduling stats of a thread, as read from '/proc/self/task/<tid>'
+struct ThreadSchedStats {
+    bsls::Types::Int64 d_cpuTimeNs;
+    bsls::Types::Int64 d_runDelayNs;
+    bsls::Types::Int64 d_voluntaryCtxSwitches;
+    bsls::Types::Int64 d_involuntaryCtxSwitches;
 };
 
+/// Load into the specified `name` the name of the thread having the
+/// specified `tid`.  Return 0 on success, and a non-zero value otherwise.
+int readThreadName(bsl::string* name, int tid)
+{
+    char path[64];
+    snprintf(path, sizeof(path), "/proc/self/task/%d/comm", tid);
+
+    bsl::ifstream comm(path);
+    if (!bsl::getline(comm, *name)) {
+        return -1;  // RETURN
+    }
+
+    return 0;
+}
+
+/// Load into the specified `stats` the scheduling stats of the thread having
+/// the specified `tid`, using the specified `line` as a scratch buffer.
+/// Return 0 on success, and a non-zero value otherwise.
+int readThreadSchedStats(ThreadSchedStats* stats, bsl::string* line, int tid)
+{
+    char path[64];
+
+    // 'schedstat' holds the time spent on a CPU, the time spent waiting on a
+    // run queue (both in nanoseconds), and the number of time slices run.
+    snprintf(path, sizeof(path), "/proc/self/task/%d/schedstat", tid);
+    bsl::ifstream schedstat(path);
+    if (!(schedstat >> stats->d_cpuTimeNs >> stats->d_runDelayNs)) {
+        return -1;  // RETURN
+    }
+
+    // 'status' holds the context switches, one 'key:\tvalue' per line.
+    snprintf(path, sizeof(path), "/proc/self/task/%d/status", tid);
+    bsl::ifstream status(path);
+    int           numFound = 0;
+    while (numFound < 2 && bsl::getline(status, *line)) {
+        const bsl::size_t colon = line->find(':');
+        if (colon == bsl::string::npos) {
+            continue;  // CONTINUE
+        }
+
+        bsls::Types::Int64* field = 0;
+        if (line->compare(0, colon, "voluntary_ctxt_switches") == 0) {
+            field = &stats->d_voluntaryCtxSwitches;
+        }
+        else if (line->compare(0, colon, "nonvoluntary_ctxt_switches") == 0) {
+            field = &stats->d_involuntaryCtxSwitches;
+        }
+        else {
+            continue;  // CONTINUE
+        }
+
+        *field = bsl::strtoll(line->c_str() + colon + 1, 0, 10);
+        ++numFound;
+    }
+
+    return numFound == 2 ? 0 : -2;
+}
+#endif  // BSLS_PLATFORM_OS_LINUX
+
 typedef bsl::function<
     double(const mwcst::StatContext& statCtx, int snapshotId, int statId)>
     AccessorDouble;
@@ -191,6 +291,9 @@ StatMonitor::StatMonitor(int historySize, bslma::Allocator* allocator)
 , d_cpuStatContext_mp(0)
 , d_memStatContext_mp(0)
 , d_osStatContext_mp(0)
+, d_threadsStatContext_mp(0)
+, d_threadStatContexts(allocator)
+, d_allocator_p(allocator)
 , d_isStarted(false)
 {
     // Create the CPU, MEM and RESOURCE-USAGE subContexts
@@ -210,6 +313,13 @@ StatMonitor::StatMonitor(int historySize, bslma::Allocator* allocator)
             .value("nswap", mwcst::StatValue::DMCST_CONTINUOUS)
             .value("nvcsw", mwcst::StatValue::DMCST_CONTINUOUS)
             .value("nivcsw", mwcst::StatValue::DMCST_CONTINUOUS));
+    d_threadsStatContext_mp = d_systemStatContext.addSubcontext(
+        mwcst::StatContextConfiguration(k_SUBCONTEXT_THREADS, allocator)
+            .isTable(true)
+            .value("cpu", mwcst::StatValue::DMCST_CONTINUOUS)
+            .value("runq", mwcst::StatValue::DMCST_CONTINUOUS)
+            .value("nvcsw", mwcst::StatValue::DMCST_CONTINUOUS)
+            .value("nivcsw", mwcst::StatValue::DMCST_CONTINUOUS));
 }
 
 StatMonitor::~StatMonitor()
@@ -217,6 +327,78 @@ StatMonitor::~StatMonitor()
     stop();
 }
 
+// PRIVATE MANIPULATORS
+void StatMonitor::snapshotThreads()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    static bool failureLogged = false;
+
+    bsl::vector<bsl::string> taskPaths(d_allocator_p);
+    bdls::FilesystemUtil::findMatchingPaths(&taskPaths, "/proc/self/task/*");
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(taskPaths.empty())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        if (!failureLogged) {
+            BALL_LOG_WARN << "Failed listing '/proc/self/task'; thread stats "
+                          << "will not be reported";
+            failureLogged = true;
+        }
+        return;  // RETURN
+    }
+
+    // The subtables of the threads still alive are moved to 'aliveThreads',
+    // so that those of the threads that exited are deleted when swapping it
+    // with 'd_threadStatContexts'; they are then removed from the table on
+    // its next 'cleanup'.
+    ThreadStatContextMap aliveThreads(d_allocator_p);
+    bsl::string          name(d_allocator_p);
+    bsl::string          leaf(d_allocator_p);
+    bsl::string          line(d_allocator_p);
+    mwcu::MemOutStream   label(d_allocator_p);
+    for (bsl::size_t i = 0; i < taskPaths.size(); ++i) {
+        if (bdls::PathUtil::getLeaf(&leaf, taskPaths[i]) != 0) {
+            continue;  // CONTINUE
+        }
+        const int tid = bsl::atoi(leaf.c_str());
+
+        // A thread may exit between the listing of the directory and the
+        // reading of its files, in which case it is ignored.
+        ThreadSchedStats stats;
+        if (readThreadName(&name, tid) != 0 ||
+            readThreadSchedStats(&stats, &line, tid) != 0) {
+            continue;  // CONTINUE
+        }
+
+        label.reset();
+        label << name << ":" << tid;
+
+        // A thread which renamed itself gets a new subtable, labeled with its
+        // current name.
+        bsl::shared_ptr<mwcst::StatContext>& context = aliveThreads[tid];
+        ThreadStatContextMap::iterator it = d_threadStatContexts.find(tid);
+        if (it != d_threadStatContexts.end() &&
+            it->second->name() == label.str()) {
+            context = it->second;
+        }
+        else {
+            context = bsl::shared_ptr<mwcst::StatContext>(
+                d_threadsStatContext_mp->addSubcontext(
+                    mwcst::StatContextConfiguration(label.str(),
+                                                    d_allocator_p)),
+                d_allocator_p);
+        }
+
+        context->setValue(k_STAT_THREAD_CPU_TIME, stats.d_cpuTimeNs);
+        context->setValue(k_STAT_THREAD_RUN_DELAY, stats.d_runDelayNs);
+        context->setValue(k_STAT_THREAD_VOLUNTARY_CTX_SWITCHES,
+                          stats.d_voluntaryCtxSwitches);
+        context->setValue(k_STAT_THREAD_INVOLUNTARY_CTX_SWITCHES,
+                          stats.d_involuntaryCtxSwitches);
+    }
+
+    d_threadStatContexts.swap(aliveThreads);
+#endif  // BSLS_PLATFORM_OS_LINUX
+}
+
 // MANIPULATORS
 int StatMonitor::start(bsl::ostream& errorDescription)
 {
@@ -240,6 +422,7 @@ void StatMonitor::stop()
 {
     d_isStarted = false;
     d_performanceMonitor.unregisterPid(d_pid);
+    d_threadStatContexts.clear();
     statContext()->clearValues();
 }
 
@@ -315,6 +498,8 @@ void StatMonitor::snapshot()
         }
     }
 
+    snapshotThreads();
+
     // Snapshot the stat context
     d_systemStatContext.snapshot();
 }
@@ -403,6 +588,62 @@ StatMonitorUtil::getOperatingSystemStat(const mwcst::StatContext& statContext,
         mwcst::StatValue::SnapshotLocation(0, snapshotId));
 }
 
+double
+StatMonitorUtil::getThreadTimeStat(const mwcst::StatContext& threadContext,
+                                   int                       snapshotId,
+                                   int                       statId)
+{
+    const mwcst::StatValue& statValue =
+        threadContext.value(mwcst::StatContext::DMCST_TOTAL_VALUE, statId);
+
+    const double nsPerSecond = mwcst::StatUtil::ratePerSecond(
+        statValue,
+        mwcst::StatValue::SnapshotLocation(0, 0),
+        mwcst::StatValue::SnapshotLocation(0, snapshotId));
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(nsPerSecond != nsPerSecond)) {
+        // NaN: empty interval, or not enough snapshots
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0.0;  // RETURN
+    }
+
+    return nsPerSecond * 100.0 / bdlt::TimeUnitRatio::k_NS_PER_S;
+}
+
+double StatMonitorUtil::threadCpu(const mwcst::StatContext& threadContext,
+                                  int                       snapshotId)
+{
+    return getThreadTimeStat(threadContext,
+                             snapshotId,
+                             k_STAT_THREAD_CPU_TIME);
+}
+
+double
+StatMonitorUtil::threadRunQueueDelay(const mwcst::StatContext& threadContext,
+                                     int                       snapshotId)
+{
+    return getThreadTimeStat(threadContext,
+                             snapshotId,
+                             k_STAT_THREAD_RUN_DELAY);
+}
+
+bsls::Types::Int64 StatMonitorUtil::threadVoluntaryContextSwitches(
+    const mwcst::StatContext& threadContext,
+    int                       snapshotId)
+{
+    return getOperatingSystemStat(threadContext,
+                                  snapshotId,
+                                  k_STAT_THREAD_VOLUNTARY_CTX_SWITCHES);
+}
+
+bsls::Types::Int64 StatMonitorUtil::threadInvoluntaryContextSwitches(
+    const mwcst::StatContext& threadContext,
+    int                       snapshotId)
+{
+    return getOperatingSystemStat(threadContext,
+                                  snapshotId,
+                                  k_STAT_THREAD_INVOLUNTARY_CTX_SWITCHES);
+}
+
 #define ACCESSOR_METHOD_SYSTEM(NAME, ID)                                      \
     bsls::Types::Int64 StatMonitorUtil::NAME(                                 \
         const mwcst::StatContext& statContext,                                \
@@ -32,9 +32,12 @@
 // cpu (user, system and all) and the maximum memory (resident and virtual)
 // used as reported by the 'balb::PerformanceMonitor'.  It also tracks page
 // faults (minor and major) and context switches (voluntary and involuntary) as
-// reported by the 'getrusage' system call.  'mwcsys::StatMonitorUtil' provides
-// a utility namespace for static accessors that allow access of system
-// statistics from a stat context.
+// reported by the 'getrusage' system call.  On Linux, it also tracks, for
+// each thread of the process, the CPU time, the time spent waiting on a run
+// queue, and the context switches of the thread, as reported in
+// '/proc/self/task', so that an overloaded thread can be identified.
+// 'mwcsys::StatMonitorUtil' provides a utility namespace for static accessors
+// that allow access of system statistics from a stat context.
 //..
 // Measure                                Description
 // -------                                -----------
@@ -77,12 +80,31 @@
 //                                        switches incurred throughout the
 //                                        lifetime of the process.
 //
+// Thread CPU                             Average percentage of one CPU used
+//                                        by a thread.
+//
+// Thread Run Queue Delay                 Average percentage of the time a
+//                                        thread spent runnable but waiting
+//                                        for a CPU.
+//
+// Thread Voluntary Context Switches      Number of voluntary context switches
+//                                        of a thread.
+//
+// Thread Involuntary Context Switches    Number of involuntary context
+//                                        switches of a thread.
+//
 //..
 //
 /// StatContext
 ///-----------
 // Statistics are kept in a 'mwcst::StatContext' having a root level named
-// 'System', and three subcontexts 'cpu', 'mem', and 'os'.
+// 'System', and four subcontexts 'cpu', 'mem', 'os', and 'threads'.  The
+// 'threads' subcontext is a table having one subtable per thread of the
+// process, named after the name and the identifier of the thread (for
+// example 'bmqDispatcher:1234'), whose total values are the sums of those
+// of its threads.  The subtables of the threads that exited are deleted, and
+// removed on the next 'cleanup' of the stat context.  The 'threads' table is
+// empty on platforms other than Linux.
 //
 /// Thread Safety
 ///-------------
@@ -95,6 +117,8 @@
 // BDE
 #include <balb_performancemonitor.h>
 #include <ball_log.h>
+#include <bsl_memory.h>
+#include <bsl_unordered_map.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
@@ -123,6 +147,12 @@ class StatMonitor {
     BALL_LOG_SET_CLASS_CATEGORY("MWCSYS.STATMONITOR");
 
   private:
+    // PRIVATE TYPES
+
+    /// Map of thread identifiers to the subtable of the thread
+    typedef bsl::unordered_map<int, bsl::shared_ptr<mwcst::StatContext> >
+        ThreadStatContextMap;
+
     // DATA
     balb::PerformanceMonitor d_performanceMonitor;
     // Performance Monitor
@@ -143,6 +173,17 @@ class StatMonitor {
     // StatContext for operating system
     // stats ('os' == operating system)
 
+    bslma::ManagedPtr<mwcst::StatContext> d_threadsStatContext_mp;
+    // Table of the stats of each thread
+
+    ThreadStatContextMap d_threadStatContexts;
+    // Subtables of 'd_threadsStatContext_mp'
+    // of the threads alive at the last
+    // snapshot
+
+    bslma::Allocator* d_allocator_p;
+    // Allocator to use
+
     bool d_isStarted;
     // Flag indicating if this StatMonitor
     // object was successfully started via
@@ -153,6 +194,13 @@ class StatMonitor {
     StatMonitor(const StatMonitor& other) BSLS_KEYWORD_DELETED;
     StatMonitor& operator=(const StatMonitor& other) BSLS_KEYWORD_DELETED;
 
+    // PRIVATE MANIPULATORS
+
+    /// Update the stats of each thread of the process, adding the
+    /// subtables of the new threads and deleting those of the threads that
+    /// exited.
+    void snapshotThreads();
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(StatMonitor, bslma::UsesBslmaAllocator)
@@ -327,6 +375,16 @@ struct StatMonitorUtil {
                            int                       snapshotId,
                            int                       statId);
 
+    /// Utility function to get the percentage of the elapsed time
+    /// represented by the time stat of the specified `threadContext`
+    /// corresponding to the specified `statId` over the period starting
+    /// from the specified `snapshotId` snapshots ago to the latest
+    /// snapshot.  Note that passing in `snapshotId == 0` returns 0 (empty
+    /// interval).
+    static double getThreadTimeStat(const mwcst::StatContext& threadContext,
+                                    int                       snapshotId,
+                                    int                       statId);
+
   public:
     // CLASS METHODS
 
@@ -423,6 +481,44 @@ struct StatMonitorUtil {
     static bsls::Types::Int64
     involuntaryContextSwitches(const mwcst::StatContext& statContext,
                                int                       snapshotId);
+
+    /// Return the average percentage of one CPU used by the thread of the
+    /// specified `threadContext`, a subtable of the `threads` subcontext,
+    /// over the period starting from the specified `snapshotId` snapshots
+    /// ago to the latest snapshot (i.e., at `snapshotId == 0`).  If
+    /// `threadContext` is the `threads` subcontext itself, return that of
+    /// the whole process.  Note that passing in `snapshotId == 0` returns 0
+    /// (empty interval).
+    static double threadCpu(const mwcst::StatContext& threadContext,
+                            int                       snapshotId);
+
+    /// Return the average percentage of the time the thread of the
+    /// specified `threadContext` spent runnable, but waiting for a CPU,
+    /// over the period starting from the specified `snapshotId` snapshots
+    /// ago to the latest snapshot (i.e., at `snapshotId == 0`).  Note that
+    /// passing in `snapshotId == 0` returns 0 (empty interval).
+    static double threadRunQueueDelay(const mwcst::StatContext& threadContext,
+                                      int                       snapshotId);
+
+    /// Return the number of voluntary context switches of the thread of the
+    /// specified `threadContext` that occurred between the specified
+    /// `snapshotId` snapshots ago and the latest snapshot (i.e., at
+    /// `snapshotId == 0`), inclusive.
+    ///
+    ///    difference(value[0], value[snapshotId]).
+    static bsls::Types::Int64
+    threadVoluntaryContextSwitches(const mwcst::StatContext& threadContext,
+                                   int                       snapshotId);
+
+    /// Return the number of involuntary context switches of the thread of
+    /// the specified `threadContext` that occurred between the specified
+    /// `snapshotId` snapshots ago and the latest snapshot (i.e., at
+    /// `snapshotId == 0`), inclusive.
+    ///
+    ///    difference(value[0], value[snapshotId]).
+    static bsls::Types::Int64
+    threadInvoluntaryContextSwitches(const mwcst::StatContext& threadContext,
+                                     int                       snapshotId);
 };
 
 // ============================================================================
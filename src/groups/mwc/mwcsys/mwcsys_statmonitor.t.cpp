@@ -559,6 +559,71 @@ static void test4_snapshot()
 #undef PVV_INV_CONTEXT_SWITCHES
 }
 
+static void test5_threads()
+// ------------------------------------------------------------------------
+// THREADS
+//
+// Concerns:
+//   - On Linux, the 'threads' subcontext has one subtable per thread of
+//     the process, whose stats are accessible through 'StatMonitorUtil'.
+//   - 'stop' deletes the subtables of the threads.
+//
+// Testing:
+//   - snapshot
+//   - StatMonitorUtil::threadCpu
+//   - StatMonitorUtil::threadRunQueueDelay
+//   - StatMonitorUtil::threadVoluntaryContextSwitches
+//   - StatMonitorUtil::threadInvoluntaryContextSwitches
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("THREADS");
+
+    mwcsys::StatMonitor obj(5, s_allocator_p);
+    mwcu::MemOutStream  errorDescription(s_allocator_p);
+    ASSERT_EQ(obj.start(errorDescription), 0);
+
+    const mwcst::StatContext* threads = obj.statContext()->getSubcontext(
+        "threads");
+    ASSERT(threads != 0);
+    ASSERT(threads->isTable());
+
+    obj.snapshot();
+    obj.snapshot();
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    ASSERT_GE(threads->numSubcontexts(), 1);
+#endif  // BSLS_PLATFORM_OS_LINUX
+
+    for (mwcst::StatContextIterator it = threads->subcontextIterator(); it;
+         ++it) {
+        PVV(it->name()
+            << ": cpu " << mwcsys::StatMonitorUtil::threadCpu(*it, 1)
+            << "%, runq "
+            << mwcsys::StatMonitorUtil::threadRunQueueDelay(*it, 1)
+            << "%, nvcsw "
+            << mwcsys::StatMonitorUtil::threadVoluntaryContextSwitches(*it, 1)
+            << ", nivcsw "
+            << mwcsys::StatMonitorUtil::threadInvoluntaryContextSwitches(*it,
+                                                                         1));
+
+        ASSERT_GE(mwcsys::StatMonitorUtil::threadCpu(*it, 1), 0.0);
+        ASSERT_GE(mwcsys::StatMonitorUtil::threadRunQueueDelay(*it, 1), 0.0);
+        ASSERT_GE(
+            mwcsys::StatMonitorUtil::threadVoluntaryContextSwitches(*it, 1),
+            0);
+        ASSERT_GE(
+            mwcsys::StatMonitorUtil::threadInvoluntaryContextSwitches(*it, 1),
+            0);
+        ASSERT_EQ(mwcsys::StatMonitorUtil::threadCpu(*it, 0), 0.0);
+    }
+
+    obj.stop();
+    for (mwcst::StatContextIterator it = threads->subcontextIterator(); it;
+         ++it) {
+        ASSERT(it->isDeleted());
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -569,6 +634,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 5: test5_threads(); break;
     case 4: test4_snapshot(); break;
     case 3: test3_stop(); break;
     case 2: test2_start(); break;
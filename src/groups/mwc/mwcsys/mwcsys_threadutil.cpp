@@ -22,16 +22,23 @@
 
 // BDE
 #include <ball_log.h>
+#include <bdlb_numericparseutil.h>
+#include <bdlb_stringrefutil.h>
 #include <bsl_cstring.h>
+#include <bsl_fstream.h>
 #include <bsl_iostream.h>
 #include <bsl_ostream.h>
+#include <bsl_sstream.h>
 #include <bslma_default.h>
 #include <bsls_annotation.h>
+#include <bsls_assert.h>
 #include <bsls_performancehint.h>
 #include <bsls_platform.h>
 
 // Linux
 #if defined(BSLS_PLATFORM_OS_LINUX)
+#include <pthread.h>
+#include <sched.h>
 #include <sys/prctl.h>
 #endif
 
@@ -46,6 +53,52 @@ const char k_LOG_CATEGORY[] = "MWCSYS.THREADUTIL";
 // struct ThreadUtil
 // -----------------
 
+int ThreadUtil::parseCpuList(bsl::vector<int>* cpus, bslstl::StringRef list)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(cpus);
+
+    cpus->clear();
+
+    list = bdlb::StringRefUtil::trim(list);
+    while (!list.isEmpty()) {
+        const bslstl::StringRef::size_type comma = list.find(',');
+        const bslstl::StringRef            range = bdlb::StringRefUtil::trim(
+            list.substr(0, comma));
+        list = comma == bslstl::StringRef::npos ? bslstl::StringRef()
+                                                : list.substr(comma + 1);
+
+        // Parse 'first[-last]'
+        int               first = 0;
+        int               last  = 0;
+        bslstl::StringRef remainder;
+        if (0 != bdlb::NumericParseUtil::parseInt(&first,
+                                                  &remainder,
+                                                  range) ||
+            first < 0) {
+            cpus->clear();
+            return -1;  // RETURN
+        }
+        last = first;
+        if (!remainder.isEmpty()) {
+            if (remainder[0] != '-' ||
+                0 != bdlb::NumericParseUtil::parseInt(&last,
+                                                      &remainder,
+                                                      remainder.substr(1)) ||
+                !remainder.isEmpty() || last < first) {
+                cpus->clear();
+                return -2;  // RETURN
+            }
+        }
+
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus->push_back(cpu);
+        }
+    }
+
+    return 0;
+}
+
 bslmt::ThreadAttributes ThreadUtil::defaultAttributes()
 {
     bslmt::ThreadAttributes attributes;
@@ -65,6 +118,8 @@ bslmt::ThreadAttributes ThreadUtil::defaultAttributes()
 
 const bool ThreadUtil::k_SUPPORT_THREAD_NAME = true;
 
+const bool ThreadUtil::k_SUPPORT_THREAD_AFFINITY = true;
+
 void ThreadUtil::setCurrentThreadName(const bsl::string& value)
 {
     int rc = prctl(PR_SET_NAME, value.c_str(), 0, 0, 0);
@@ -95,12 +150,107 @@ void ThreadUtil::setCurrentThreadNameOnce(const bsl::string& value)
     }
 }
 
+int ThreadUtil::setCurrentThreadAffinity(int cpu)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= cpu);
+
+    if (cpu >= CPU_SETSIZE) {
+        BALL_LOG_SET_CATEGORY(k_LOG_CATEGORY);
+        BALL_LOG_ERROR << "Failed to set thread affinity, invalid CPU "
+                       << "[cpu: " << cpu << "]";
+        return -1;  // RETURN
+    }
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpu, &cpuSet);
+
+    const int rc = pthread_setaffinity_np(pthread_self(),
+                                          sizeof(cpuSet),
+                                          &cpuSet);
+    if (rc != 0) {
+        BALL_LOG_SET_CATEGORY(k_LOG_CATEGORY);
+        BALL_LOG_ERROR << "Failed to set thread affinity "
+                       << "[cpu: " << cpu << ", rc: " << rc
+                       << ", strerr: '" << bsl::strerror(rc) << "']";
+        return rc;  // RETURN
+    }
+
+    return 0;
+}
+
+int ThreadUtil::setCurrentThreadCpuSet(const bsl::vector<int>& cpus)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!cpus.empty());
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (size_t i = 0; i < cpus.size(); ++i) {
+        BSLS_ASSERT_SAFE(0 <= cpus[i]);
+
+        if (cpus[i] >= CPU_SETSIZE) {
+            BALL_LOG_SET_CATEGORY(k_LOG_CATEGORY);
+            BALL_LOG_ERROR << "Failed to set thread affinity, invalid CPU "
+                           << "[cpu: " << cpus[i] << "]";
+            return -1;  // RETURN
+        }
+        CPU_SET(cpus[i], &cpuSet);
+    }
+
+    const int rc = pthread_setaffinity_np(pthread_self(),
+                                          sizeof(cpuSet),
+                                          &cpuSet);
+    if (rc != 0) {
+        BALL_LOG_SET_CATEGORY(k_LOG_CATEGORY);
+        BALL_LOG_ERROR << "Failed to set thread affinity "
+                       << "[numCpus: " << cpus.size() << ", rc: " << rc
+                       << ", strerr: '" << bsl::strerror(rc) << "']";
+        return rc;  // RETURN
+    }
+
+    return 0;
+}
+
+int ThreadUtil::loadNumaNodeCpus(bsl::vector<int>* cpus, int node)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(cpus);
+
+    cpus->clear();
+
+    bsl::ostringstream path;
+    path << "/sys/devices/system/node/node" << node << "/cpulist";
+
+    bsl::ifstream file(path.str().c_str());
+    bsl::string   list;
+    if (!file || !bsl::getline(file, list)) {
+        BALL_LOG_SET_CATEGORY(k_LOG_CATEGORY);
+        BALL_LOG_ERROR << "Failed to read the CPUs of NUMA node " << node
+                       << " [path: '" << path.str() << "']";
+        return -1;  // RETURN
+    }
+
+    if (parseCpuList(cpus, list) != 0 || cpus->empty()) {
+        BALL_LOG_SET_CATEGORY(k_LOG_CATEGORY);
+        BALL_LOG_ERROR << "Invalid CPUs of NUMA node " << node
+                       << " [cpulist: '" << list << "']";
+        cpus->clear();
+        return -2;  // RETURN
+    }
+
+    return 0;
+}
+
 // UNSUPPORTED_PLATFORMS
 // ---------------------
 #else
 
 const bool ThreadUtil::k_SUPPORT_THREAD_NAME = false;
 
+const bool ThreadUtil::k_SUPPORT_THREAD_AFFINITY = false;
+
 void ThreadUtil::setCurrentThreadName(
     BSLS_ANNOTATION_UNUSED const bsl::string& value)
 {
@@ -115,6 +265,30 @@ void ThreadUtil::setCurrentThreadNameOnce(
     // NOT AVAILABLE
 }
 
+int ThreadUtil::setCurrentThreadAffinity(BSLS_ANNOTATION_UNUSED int cpu)
+{
+    // NOT AVAILABLE
+
+    return -1;
+}
+
+int ThreadUtil::setCurrentThreadCpuSet(
+    BSLS_ANNOTATION_UNUSED const bsl::vector<int>& cpus)
+{
+    // NOT AVAILABLE
+
+    return -1;
+}
+
+int ThreadUtil::loadNumaNodeCpus(bsl::vector<int>*      cpus,
+                                 BSLS_ANNOTATION_UNUSED int node)
+{
+    // NOT AVAILABLE
+
+    cpus->clear();
+    return -1;
+}
+
 #endif
 
 }  // close package namespace
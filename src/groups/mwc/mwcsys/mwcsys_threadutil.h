@@ -38,7 +38,9 @@
 
 // BDE
 #include <bsl_string.h>
+#include <bsl_vector.h>
 #include <bslmt_threadattributes.h>
+#include <bslstl_stringref.h>
 
 namespace BloombergLP {
 namespace mwcsys {
@@ -55,6 +57,10 @@ struct ThreadUtil {
     /// naming thread.
     static const bool k_SUPPORT_THREAD_NAME;
 
+    /// Boolean constant indicating whether the current platform supports
+    /// binding a thread to a CPU.
+    static const bool k_SUPPORT_THREAD_AFFINITY;
+
     // CLASS METHODS
 
     /// Return `bslmt::ThreadAttributes` object pre-initialized with default
@@ -78,6 +84,42 @@ struct ThreadUtil {
     ///   - this functionality is only supported on LINUX, and the name can
     ///     be up to 15 characters.
     static void setCurrentThreadNameOnce(const bsl::string& value);
+
+    /// Bind the current thread to the CPU having the specified `cpu` index,
+    /// so that it is only scheduled on that CPU.  Return 0 on success, or a
+    /// non-zero value on error or if `k_SUPPORT_THREAD_AFFINITY` is false.
+    /// The behavior is undefined unless `0 <= cpu`.
+    ///
+    /// PLATFORM NOTE:
+    ///   - this functionality is only supported on LINUX.
+    static int setCurrentThreadAffinity(int cpu);
+
+    /// Bind the current thread to the CPUs having the specified `cpus`
+    /// indices, so that it is only scheduled on one of them.  Return 0 on
+    /// success, or a non-zero value on error or if
+    /// `k_SUPPORT_THREAD_AFFINITY` is false.  The behavior is undefined
+    /// unless `cpus` is not empty and all its elements are non-negative.
+    ///
+    /// PLATFORM NOTE:
+    ///   - this functionality is only supported on LINUX.
+    static int setCurrentThreadCpuSet(const bsl::vector<int>& cpus);
+
+    /// Load into the specified `cpus` the indices of the CPUs of the NUMA
+    /// node having the specified `node` index.  Return 0 on success, or a
+    /// non-zero value on error (e.g., if there is no such node) or if
+    /// `k_SUPPORT_THREAD_AFFINITY` is false, in which case `cpus` is left
+    /// empty.
+    ///
+    /// PLATFORM NOTE:
+    ///   - this functionality is only supported on LINUX, where the CPUs of
+    ///     a node are read from the `sysfs` file system.
+    static int loadNumaNodeCpus(bsl::vector<int>* cpus, int node);
+
+    /// Load into the specified `cpus` the indices of the CPUs in the
+    /// specified `list`, having the format of the Linux CPU lists (e.g.,
+    /// "0-3,8,10-11").  Return 0 on success, or a non-zero value if `list`
+    /// is not well formed, in which case `cpus` is left empty.
+    static int parseCpuList(bsl::vector<int>* cpus, bslstl::StringRef list);
 };
 
 }  // close package namespace
@@ -0,0 +1,108 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcsys_threadutil.t.cpp                                            -*-C++-*-
+#include <mwcsys_threadutil.h>
+
+// BDE
+#include <bsl_vector.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_parseCpuList()
+// ------------------------------------------------------------------------
+// PARSE CPU LIST
+//
+// Concerns:
+//   1. Single CPUs and ranges of CPUs, separated by commas, are parsed.
+//   2. Malformed lists are rejected, leaving the output empty.
+//
+// Testing:
+//   parseCpuList
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("PARSE CPU LIST");
+
+    struct Test {
+        int         d_line;
+        const char* d_list;
+        bool        d_isValid;
+        int         d_numCpus;
+        int         d_firstCpu;
+        int         d_lastCpu;
+    } k_DATA[] = {
+        {L_, "", true, 0, 0, 0},
+        {L_, "3", true, 1, 3, 3},
+        {L_, "0-3", true, 4, 0, 3},
+        {L_, "0-3,8,10-11", true, 7, 0, 11},
+        {L_, " 0-1, 4 \n", true, 3, 0, 4},
+        {L_, "5-5", true, 1, 5, 5},
+        {L_, "-1", false, 0, 0, 0},
+        {L_, "3-1", false, 0, 0, 0},
+        {L_, "a", false, 0, 0, 0},
+        {L_, "0-", false, 0, 0, 0},
+        {L_, "0,,1", false, 0, 0, 0},
+        {L_, "0:1", false, 0, 0, 0},
+    };
+
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    for (size_t idx = 0; idx < k_NUM_DATA; ++idx) {
+        const Test&      test = k_DATA[idx];
+        bsl::vector<int> cpus(s_allocator_p);
+        cpus.push_back(42);  // Must be cleared
+
+        PVV(test.d_line << ": parsing '" << test.d_list << "'");
+
+        const int rc = mwcsys::ThreadUtil::parseCpuList(&cpus, test.d_list);
+        ASSERT_EQ_D(test.d_line, rc == 0, test.d_isValid);
+        ASSERT_EQ_D(test.d_line,
+                    static_cast<int>(cpus.size()),
+                    test.d_numCpus);
+        if (!cpus.empty()) {
+            ASSERT_EQ_D(test.d_line, cpus.front(), test.d_firstCpu);
+            ASSERT_EQ_D(test.d_line, cpus.back(), test.d_lastCpu);
+        }
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 1: test1_parseCpuList(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -17,6 +17,9 @@
 #include <mwcsys_time.h>
 
 #include <mwcscm_version.h>
+// MWC
+#include <mwcsys_tscclock.h>
+
 // BDE
 #include <bdlf_bind.h>
 #include <bslma_default.h>
@@ -25,15 +28,22 @@
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
 #include <bsls_objectbuffer.h>
+#include <bsls_platform.h>
 #include <bsls_systemtime.h>
 #include <bsls_timeutil.h>
 
+// SYS
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#include <time.h>
+#endif
+
 namespace BloombergLP {
 namespace mwcsys {
 
 namespace {
 bsls::ObjectBuffer<Time::SystemTimeCb> g_realTimeClock;
 bsls::ObjectBuffer<Time::SystemTimeCb> g_monotonicClock;
+bsls::ObjectBuffer<Time::SystemTimeCb> g_coarseMonotonicClock;
 
 /// Globals holding the various timer callback set up.  Note that an object
 /// buffer is needed to avoid exit time destructors because bsl::function is
@@ -53,10 +63,30 @@ int g_initialized = 0;
 // value is zero, then the 'Time' is
 // destroyed.
 
+bool g_isTscTimer = false;
+// Whether the installed high resolution
+// timer is 'TscClock::getTimer'.
+
 bslmt::QLock g_initLock = BSLMT_QLOCK_INITIALIZER;
 // Lock used to provide thread-safe
 // protection for accessing the
 // 'g_initialized' counter.
+
+/// Return the current time of the coarse monotonic clock of the platform.
+bsls::TimeInterval nowCoarseMonotonicClockImp()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    // The time at the last tick of the kernel, read from the vDSO without
+    // reading the clock source.
+    struct timespec ts;
+    if (::clock_gettime(CLOCK_MONOTONIC_COARSE, &ts) == 0) {
+        const int nanoseconds = static_cast<int>(ts.tv_nsec);
+        return bsls::TimeInterval(ts.tv_sec, nanoseconds);  // RETURN
+    }
+#endif
+
+    return bsls::SystemTime::nowMonotonicClock();
+}
 }  // close unnamed namespace
 
 // -----------
@@ -64,6 +94,12 @@ bslmt::QLock g_initLock = BSLMT_QLOCK_INITIALIZER;
 // -----------
 
 void Time::initialize(bslma::Allocator* allocator)
+{
+    initialize(e_SYSTEM_TIMER, allocator);
+}
+
+void Time::initialize(HighResolutionTimerSource timerSource,
+                      bslma::Allocator*         allocator)
 {
     // PRECONDITIONS
     bslmt::QLockGuard qlockGuard(&g_initLock);
@@ -89,12 +125,26 @@ void Time::initialize(bslma::Allocator* allocator)
         alloc,
         bdlf::BindUtil::bind(&bsls::SystemTime::nowMonotonicClock));
 
-    new (g_highResTimer.buffer())
-        HighResolutionTimeCb(bsl::allocator_arg,
-                             alloc,
-                             bdlf::BindUtil::bind(&bsls::TimeUtil::getTimer));
+    new (g_coarseMonotonicClock.buffer())
+        SystemTimeCb(bsl::allocator_arg,
+                     alloc,
+                     bdlf::BindUtil::bind(&nowCoarseMonotonicClockImp));
 
     bsls::TimeUtil::initialize();
+
+    g_isTscTimer = timerSource == e_TSC_TIMER && TscClock::initialize() == 0;
+    if (g_isTscTimer) {
+        new (g_highResTimer.buffer()) HighResolutionTimeCb(
+            bsl::allocator_arg,
+            alloc,
+            bdlf::BindUtil::bind(&TscClock::getTimer));
+    }
+    else {
+        new (g_highResTimer.buffer()) HighResolutionTimeCb(
+            bsl::allocator_arg,
+            alloc,
+            bdlf::BindUtil::bind(&bsls::TimeUtil::getTimer));
+    }
 }
 
 void Time::initialize(const SystemTimeCb&         realTimeClockCb,
@@ -120,8 +170,12 @@ void Time::initialize(const SystemTimeCb&         realTimeClockCb,
         SystemTimeCb(bsl::allocator_arg, alloc, realTimeClockCb);
     new (g_monotonicClock.buffer())
         SystemTimeCb(bsl::allocator_arg, alloc, monotonicClockCb);
+    new (g_coarseMonotonicClock.buffer())
+        SystemTimeCb(bsl::allocator_arg, alloc, monotonicClockCb);
     new (g_highResTimer.buffer())
         HighResolutionTimeCb(bsl::allocator_arg, alloc, highResTimeCb);
+
+    g_isTscTimer = false;
 }
 
 void Time::shutdown()
@@ -137,6 +191,7 @@ void Time::shutdown()
 
     g_realTimeClock.object().~SystemTimeCb();
     g_monotonicClock.object().~SystemTimeCb();
+    g_coarseMonotonicClock.object().~SystemTimeCb();
     g_highResTimer.object().~HighResolutionTimeCb();
 }
 
@@ -156,6 +211,14 @@ bsls::TimeInterval Time::nowMonotonicClock()
     return g_monotonicClock.object()();
 }
 
+bsls::TimeInterval Time::nowCoarseMonotonicClock()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(g_initialized && "Not initialized");
+
+    return g_coarseMonotonicClock.object()();
+}
+
 bsls::Types::Int64 Time::highResolutionTimer()
 {
     // PRECONDITIONS
@@ -164,5 +227,13 @@ bsls::Types::Int64 Time::highResolutionTimer()
     return g_highResTimer.object()();
 }
 
+bool Time::isTscHighResolutionTimer()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(g_initialized && "Not initialized");
+
+    return g_isTscTimer;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -28,6 +28,25 @@
 // to monotonic clock, real-time (wall) clock and a high resolution timer.  The
 // mechanism to retrieve system clock and the timer can be overridden, which is
 // useful while testing components which rely on system clock or timer.
+//
+/// High resolution timer source
+///-----------------------------
+// By default, the high resolution timer is 'bsls::TimeUtil::getTimer'.  It
+// can be selected at initialization to be the timestamp counter of the CPU
+// instead (see 'mwcsys_tscclock'), which is cheaper to read, and does not
+// depend on the clock source of the kernel, which, on some virtualized hosts,
+// makes each read of the timer a system call.  If the timestamp counter is not
+// usable on the host, 'initialize' falls back to 'bsls::TimeUtil::getTimer'.
+//
+/// Coarse monotonic clock
+///----------------------
+// 'nowCoarseMonotonicClock' returns a monotonic clock having a precision of
+// one tick of the kernel (at most a few milliseconds), on the same time line
+// as 'nowMonotonicClock'.  On Linux, it reads the time cached by the kernel at
+// its last tick ('CLOCK_MONOTONIC_COARSE'), which never requires reading the
+// clock source, and is therefore cheaper than 'nowMonotonicClock'.  It is
+// meant for code, such as throttling or heartbeats, which only needs a
+// millisecond precision.  On other platforms, it is the monotonic clock.
 
 // MWC
 
@@ -54,6 +73,13 @@ struct Time {
     /// Signature of the callback for the high resolution timer.
     typedef bsl::function<bsls::Types::Int64()> HighResolutionTimeCb;
 
+    /// Source of the high resolution timer installed by `initialize`.
+    enum HighResolutionTimerSource {
+        e_SYSTEM_TIMER = 0  // 'bsls::TimeUtil::getTimer'
+        ,
+        e_TSC_TIMER = 1  // 'mwcsys::TscClock::getTimer', if usable
+    };
+
     // CLASS METHODS
 
     /// Initialize the utilities with platform-provided mechanism to provide
@@ -67,9 +93,21 @@ struct Time {
     /// the global allocator.
     static void initialize(bslma::Allocator* allocator = 0);
 
+    /// Initialize the utilities with platform-provided mechanism to provide
+    /// system clocks, and with the high resolution timer from the specified
+    /// `timerSource`.  If `timerSource` is `e_TSC_TIMER` and the timestamp
+    /// counter of the CPU cannot be used as a timer on this host, fall back
+    /// to `e_SYSTEM_TIMER`, which can be checked with
+    /// `isTscHighResolutionTimer`.  Note that calibrating the timestamp
+    /// counter blocks the calling thread for a few milliseconds.  The
+    /// behavior of this method is otherwise that of `initialize` above.
+    static void initialize(HighResolutionTimerSource timerSource,
+                           bslma::Allocator*         allocator = 0);
+
     /// Initialize the utilities with the specified `realTimeClockCb`,
     /// `monotonicClockCb` and `highResTimeCb` to provide system clocks and
-    /// high resolution timer respectively.  This method only needs to be
+    /// high resolution timer respectively, `monotonicClockCb` also being
+    /// used as the coarse monotonic clock.  This method only needs to be
     /// called once before any other method, but can be called multiple
     /// times provided that for each call to `initialize` there is a
     /// corresponding call to `shutdown`.  Use the optionally specified
@@ -102,11 +140,22 @@ struct Time {
     /// called prior to calling this method.
     static bsls::TimeInterval nowMonotonicClock();
 
+    /// Return the `TimeInterval` value representing the current system time
+    /// according to the currently installed coarse monotonic clock, whose
+    /// precision is at most a few milliseconds.  The behavior is undefined
+    /// unless one of the flavors of `initialize()` has been called prior to
+    /// calling this method.
+    static bsls::TimeInterval nowCoarseMonotonicClock();
+
     /// Return the value representing the current high resolution time
     /// according to the currently installed high resolution timer.  The
     /// behavior is undefined unless one of the flavors of `initialize()`
     /// has been called prior to calling this method.
     static bsls::Types::Int64 highResolutionTimer();
+
+    /// Return true if the currently installed high resolution timer is the
+    /// timestamp counter of the CPU, and false otherwise.
+    static bool isTscHighResolutionTimer();
 };
 
 }  // close package namespace
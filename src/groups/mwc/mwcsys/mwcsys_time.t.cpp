@@ -21,6 +21,7 @@
 
 // BDE
 #include <bdlf_bind.h>
+#include <bsl_cstdlib.h>
 #include <bsl_functional.h>
 #include <bsls_systemtime.h>
 #include <bsls_timeinterval.h>
@@ -109,6 +110,17 @@ static void test1_breathingTest()
         ASSERT_EQ(bsls::TimeInterval(0, 0), mwcsys::Time::nowMonotonicClock());
     }
 
+    PV("Testing coarse monotonic clock");
+    {
+        testClock.d_monotonicClock.setTotalSeconds(5);
+        ASSERT_EQ(bsls::TimeInterval(5, 0),
+                  mwcsys::Time::nowCoarseMonotonicClock());
+
+        testClock.d_monotonicClock.setTotalSeconds(0);
+        ASSERT_EQ(bsls::TimeInterval(0, 0),
+                  mwcsys::Time::nowCoarseMonotonicClock());
+    }
+
     PV("Testing high resolution timer");
     {
         testClock.d_highResTimer = 1000000;
@@ -116,6 +128,7 @@ static void test1_breathingTest()
 
         testClock.d_highResTimer = 0;
         ASSERT_EQ(0, mwcsys::Time::highResolutionTimer());
+        ASSERT(!mwcsys::Time::isTscHighResolutionTimer());
     }
 
     mwcsys::Time::shutdown();
@@ -197,6 +210,57 @@ static void test3_customInitializeShutdown()
     ASSERT_SAFE_FAIL(mwcsys::Time::shutdown());
 }
 
+static void test4_timerSource()
+// ------------------------------------------------------------------------
+// TIMER SOURCE
+//
+// Concerns:
+//   1. Initializing with 'e_TSC_TIMER' installs the timestamp counter as
+//      the high resolution timer if it is usable on the host, and the
+//      system timer otherwise.
+//   2. The high resolution timer is monotonic and on the time line of
+//      'bsls::TimeUtil::getTimer', whatever its source.
+//   3. The coarse monotonic clock is on the time line of the monotonic
+//      clock, lagging behind it by at most a few milliseconds.
+//
+// Testing:
+//   initialize(HighResolutionTimerSource)
+//   isTscHighResolutionTimer()
+//   nowCoarseMonotonicClock()
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("TIMER SOURCE");
+
+    // Generous bound on the lag of the coarse clock, and on the scheduling
+    // of the test thread between the reads of both timers.
+    const bsls::TimeInterval k_MAX_LAG(0, 100 * 1000 * 1000);
+
+    mwcsys::Time::initialize(mwcsys::Time::e_SYSTEM_TIMER);
+    ASSERT(!mwcsys::Time::isTscHighResolutionTimer());
+    mwcsys::Time::shutdown();
+
+    mwcsys::Time::initialize(mwcsys::Time::e_TSC_TIMER);
+    PV("TSC timer: " << bsl::boolalpha
+                     << mwcsys::Time::isTscHighResolutionTimer());
+
+    bsls::Types::Int64 previous = mwcsys::Time::highResolutionTimer();
+    for (int i = 0; i < 1000; ++i) {
+        const bsls::Types::Int64 now = mwcsys::Time::highResolutionTimer();
+        ASSERT_GE(now, previous);
+        previous = now;
+    }
+    const bsls::Types::Int64 systemTimer = bsls::TimeUtil::getTimer();
+    const bsls::Types::Int64 timer       = mwcsys::Time::highResolutionTimer();
+    ASSERT_LT(bsl::abs(timer - systemTimer), k_MAX_LAG.totalNanoseconds());
+
+    const bsls::TimeInterval coarse = mwcsys::Time::nowCoarseMonotonicClock();
+    const bsls::TimeInterval now    = mwcsys::Time::nowMonotonicClock();
+    ASSERT_LE(coarse, now);
+    ASSERT_LT(now - coarse, k_MAX_LAG);
+
+    mwcsys::Time::shutdown();
+}
+
 // ============================================================================
 //                              PERFORMANCE TESTS
 // ----------------------------------------------------------------------------
@@ -386,6 +450,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 4: test4_timerSource(); break;
     case 3: test3_customInitializeShutdown(); break;
     case 2: test2_defaultInitializeShutdown(); break;
     case 1: test1_breathingTest(); break;
@@ -0,0 +1,186 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcsys_tscclock.cpp                                                -*-C++-*-
+#include <mwcsys_tscclock.h>
+
+#include <mwcscm_version.h>
+// BDE
+#include <bdlt_timeunitratio.h>
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+
+#if (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)) &&   \
+    defined(BSLS_PLATFORM_CPU_X86_64)
+#define MWCSYS_TSCCLOCK_SUPPORTED
+#endif
+
+#ifdef MWCSYS_TSCCLOCK_SUPPORTED
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
+namespace BloombergLP {
+namespace mwcsys {
+
+namespace {
+
+bool g_isInitialized = false;
+// Whether the last call to 'initialize'
+// succeeded
+
+bsls::Types::Int64 g_ticksPerSecond = 0;
+// Measured rate of the timestamp counter
+
+#ifdef MWCSYS_TSCCLOCK_SUPPORTED
+/// Duration, in nanoseconds, of the calibration of the timestamp counter.
+/// The relative error of the calibration is of the order of the latency of
+/// 'bsls::TimeUtil::getTimer' divided by this duration.
+const bsls::Types::Int64 k_CALIBRATION_NS =
+    10 * bdlt::TimeUnitRatio::k_NS_PER_MS;
+
+/// Bounds of the rate of the timestamp counter that is considered sane.
+const double k_MIN_TICKS_PER_SECOND = 1e8;
+const double k_MAX_TICKS_PER_SECOND = 2e10;
+
+/// Number of fractional bits of 'g_nsPerTick'.
+const int k_NS_PER_TICK_SHIFT = 32;
+
+bsls::Types::Uint64 g_baseTicks = 0;
+// Value of the timestamp counter at the
+// end of the calibration
+
+bsls::Types::Int64 g_baseNs = 0;
+// Value of 'bsls::TimeUtil::getTimer' at
+// the end of the calibration
+
+bsls::Types::Uint64 g_nsPerTick = 0;
+// Nanoseconds per tick of the timestamp
+// counter, as a fixed point number having
+// 'k_NS_PER_TICK_SHIFT' fractional bits
+
+/// Return true if the CPU advertises an invariant timestamp counter, and
+/// false otherwise.
+bool hasInvariantTsc()
+{
+    // CPUID leaf 0x80000007 (Advanced Power Management), EDX bit 8.
+    // '__get_cpuid' fails if the leaf is not supported by the CPU.
+    const unsigned int k_INVARIANT_TSC = 1U << 8;
+
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) {
+        return false;  // RETURN
+    }
+
+    return (edx & k_INVARIANT_TSC) != 0;
+}
+#endif  // MWCSYS_TSCCLOCK_SUPPORTED
+
+}  // close unnamed namespace
+
+// ---------------
+// struct TscClock
+// ---------------
+
+int TscClock::initialize()
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS             = 0,
+        rc_NOT_SUPPORTED       = -1,
+        rc_NOT_INVARIANT       = -2,
+        rc_CALIBRATION_FAILURE = -3
+    };
+
+    g_isInitialized  = false;
+    g_ticksPerSecond = 0;
+
+#ifdef MWCSYS_TSCCLOCK_SUPPORTED
+    if (!hasInvariantTsc()) {
+        return rc_NOT_INVARIANT;  // RETURN
+    }
+
+    bsls::TimeUtil::initialize();
+
+    const bsls::Types::Int64  startNs    = bsls::TimeUtil::getTimer();
+    const bsls::Types::Uint64 startTicks = __rdtsc();
+
+    bsls::Types::Int64  endNs    = startNs;
+    bsls::Types::Uint64 endTicks = startTicks;
+    do {
+        endNs    = bsls::TimeUtil::getTimer();
+        endTicks = __rdtsc();
+    } while (endNs - startNs < k_CALIBRATION_NS);
+
+    const double elapsedNs      = static_cast<double>(endNs - startNs);
+    const double elapsedTicks   = static_cast<double>(endTicks - startTicks);
+    const double ticksPerSecond = elapsedTicks *
+                                  bdlt::TimeUnitRatio::k_NS_PER_S / elapsedNs;
+    if (ticksPerSecond < k_MIN_TICKS_PER_SECOND ||
+        ticksPerSecond > k_MAX_TICKS_PER_SECOND) {
+        // Not ticking at a plausible rate: most likely emulated or
+        // unreliable.
+        return rc_CALIBRATION_FAILURE;  // RETURN
+    }
+
+    g_baseTicks      = endTicks;
+    g_baseNs         = endNs;
+    g_nsPerTick      = static_cast<bsls::Types::Uint64>(
+        elapsedNs / elapsedTicks *
+        static_cast<double>(1ULL << k_NS_PER_TICK_SHIFT));
+    g_ticksPerSecond = static_cast<bsls::Types::Int64>(ticksPerSecond);
+    g_isInitialized  = true;
+
+    return rc_SUCCESS;
+#else
+    return rc_NOT_SUPPORTED;
+#endif  // MWCSYS_TSCCLOCK_SUPPORTED
+}
+
+bool TscClock::isInitialized()
+{
+    return g_isInitialized;
+}
+
+bsls::Types::Int64 TscClock::getTimer()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(g_isInitialized && "'initialize' did not succeed");
+
+#ifdef MWCSYS_TSCCLOCK_SUPPORTED
+    // The difference is signed, since the timestamp counters of the CPUs
+    // may be a few ticks apart right after the calibration, and the product
+    // is computed on 128 bits, so that it does not overflow however long the
+    // process runs.
+    const bsls::Types::Int64 ticks = static_cast<bsls::Types::Int64>(
+        __rdtsc() - g_baseTicks);
+    const __int128 ns = static_cast<__int128>(ticks) *
+                        static_cast<__int128>(g_nsPerTick);
+
+    return g_baseNs +
+           static_cast<bsls::Types::Int64>(ns >> k_NS_PER_TICK_SHIFT);
+#else
+    return bsls::TimeUtil::getTimer();
+#endif  // MWCSYS_TSCCLOCK_SUPPORTED
+}
+
+bsls::Types::Int64 TscClock::ticksPerSecond()
+{
+    return g_ticksPerSecond;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,107 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcsys_tscclock.h                                                  -*-C++-*-
+#ifndef INCLUDED_MWCSYS_TSCCLOCK
+#define INCLUDED_MWCSYS_TSCCLOCK
+
+//@PURPOSE: Provide a high resolution timer based on the CPU timestamp counter.
+//
+//@CLASSES:
+//  mwcsys::TscClock: high resolution timer reading the timestamp counter
+//
+//@DESCRIPTION: 'mwcsys::TscClock' provides a high resolution timer, in
+// nanoseconds, computed from the timestamp counter ('TSC') of the CPU.
+// Reading the timestamp counter is a single unprivileged instruction, which
+// is cheaper than 'bsls::TimeUtil::getTimer', and does not depend on the
+// clock source of the kernel: on some virtualized hosts, the latter is not
+// readable from user space, and each call to 'clock_gettime' then becomes a
+// system call.
+//
+// The timestamp counter is only usable as a clock if it is *invariant*, that
+// is, if it ticks at a constant rate regardless of the frequency and power
+// states of the CPU, and is synchronized across the CPUs of the host.
+// 'initialize' checks that the CPU advertises an invariant timestamp counter
+// and calibrates its rate against 'bsls::TimeUtil::getTimer'; it fails if the
+// timestamp counter is not usable, in which case callers should keep using
+// 'bsls::TimeUtil::getTimer'.  Once calibrated, the values returned by
+// 'getTimer' start on the same time line as those returned by
+// 'bsls::TimeUtil::getTimer', and drift apart from them only by the error of
+// the calibration (a few nanoseconds per millisecond at worst), so that
+// intervals measured with either timer can be compared.
+//
+// The timestamp counter is only supported on x86-64 CPUs, with the GNU and
+// Clang compilers.
+//
+/// Thread Safety
+///-------------
+// 'initialize' is NOT thread-safe, and must be called before any other method
+// is called.  'getTimer' is thread-safe.
+//
+/// Usage
+///-----
+//..
+//  if (mwcsys::TscClock::initialize() == 0) {
+//      bsls::Types::Int64 start = mwcsys::TscClock::getTimer();
+//      // ...
+//      bsls::Types::Int64 elapsedNs = mwcsys::TscClock::getTimer() - start;
+//  }
+//..
+
+// MWC
+
+// BDE
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mwcsys {
+
+// ===============
+// struct TscClock
+// ===============
+
+/// High resolution timer reading the timestamp counter of the CPU.
+struct TscClock {
+    // CLASS METHODS
+
+    /// Check that the timestamp counter of the CPU is invariant and
+    /// calibrate its rate, blocking the calling thread for a few
+    /// milliseconds.  Return 0 on success, and a non-zero value if the
+    /// timestamp counter cannot be used as a clock on this host.  This
+    /// method can be called multiple times, each call recalibrating the
+    /// clock.
+    static int initialize();
+
+    /// Return true if the last call to `initialize` succeeded, and false
+    /// otherwise.
+    static bool isInitialized();
+
+    /// Return the current value of the timer, in nanoseconds, on the time
+    /// line of `bsls::TimeUtil::getTimer`.  The behavior is undefined
+    /// unless `isInitialized` returns true.  Note that the read of the
+    /// timestamp counter is not a serializing instruction, and can
+    /// therefore be reordered by the CPU with the surrounding instructions.
+    static bsls::Types::Int64 getTimer();
+
+    /// Return the number of ticks of the timestamp counter per second, as
+    /// measured by the last call to `initialize`, or 0 if the last call to
+    /// `initialize` failed or if `initialize` was never called.
+    static bsls::Types::Int64 ticksPerSecond();
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
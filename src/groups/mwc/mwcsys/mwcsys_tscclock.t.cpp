@@ -0,0 +1,116 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcsys_tscclock.t.cpp                                              -*-C++-*-
+#include <mwcsys_tscclock.h>
+
+// BDE
+#include <bdlt_timeunitratio.h>
+#include <bsl_cstdlib.h>
+#include <bslmt_threadutil.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   1. If the timestamp counter is usable on the host, 'initialize'
+//      succeeds, and 'getTimer' is monotonic and measures the same
+//      intervals as 'bsls::TimeUtil::getTimer'.
+//   2. Otherwise, 'initialize' fails and 'isInitialized' returns false.
+//
+// Testing:
+//   initialize
+//   isInitialized
+//   getTimer
+//   ticksPerSecond
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    ASSERT(!mwcsys::TscClock::isInitialized());
+    ASSERT_EQ(mwcsys::TscClock::ticksPerSecond(), 0);
+
+    const int rc = mwcsys::TscClock::initialize();
+    PV("initialize: " << rc << ", ticks per second: "
+                      << mwcsys::TscClock::ticksPerSecond());
+    if (rc != 0) {
+        ASSERT(!mwcsys::TscClock::isInitialized());
+        ASSERT_EQ(mwcsys::TscClock::ticksPerSecond(), 0);
+        return;  // RETURN
+    }
+
+    ASSERT(mwcsys::TscClock::isInitialized());
+    ASSERT_GT(mwcsys::TscClock::ticksPerSecond(), 0);
+
+    // Monotonic
+    bsls::Types::Int64 previous = mwcsys::TscClock::getTimer();
+    for (int i = 0; i < 1000; ++i) {
+        const bsls::Types::Int64 now = mwcsys::TscClock::getTimer();
+        ASSERT_GE(now, previous);
+        previous = now;
+    }
+
+    // Same intervals as the system timer, within 1 millisecond over 100
+    // milliseconds to absorb the scheduling of the test thread between the
+    // reads of both timers.
+    const bsls::Types::Int64 tscStart    = mwcsys::TscClock::getTimer();
+    const bsls::Types::Int64 systemStart = bsls::TimeUtil::getTimer();
+    bslmt::ThreadUtil::microSleep(100 * 1000);
+    const bsls::Types::Int64 tscEnd    = mwcsys::TscClock::getTimer();
+    const bsls::Types::Int64 systemEnd = bsls::TimeUtil::getTimer();
+
+    const bsls::Types::Int64 tscElapsed    = tscEnd - tscStart;
+    const bsls::Types::Int64 systemElapsed = systemEnd - systemStart;
+    PV("elapsed: " << tscElapsed << " ns (TSC), " << systemElapsed
+                   << " ns (system)");
+
+    ASSERT_GE(tscElapsed, 99 * bdlt::TimeUnitRatio::k_NS_PER_MS);
+    ASSERT_LT(bsl::abs(tscElapsed - systemElapsed),
+              bdlt::TimeUnitRatio::k_NS_PER_MS);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
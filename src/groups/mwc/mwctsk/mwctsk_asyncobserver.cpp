@@ -0,0 +1,153 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwctsk_asyncobserver.cpp                                           -*-C++-*-
+#include <mwctsk_asyncobserver.h>
+
+#include <mwcscm_version.h>
+// MWC
+#include <mwcsys_threadutil.h>
+
+// BDE
+#include <bdlf_memfn.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_threadattributes.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace mwctsk {
+
+// -------------------
+// class AsyncObserver
+// -------------------
+
+// PRIVATE MANIPULATORS
+void AsyncObserver::publicationThreadMain()
+{
+    Item item;
+    while (true) {
+        d_queue.popFront(&item);
+        if (!item.d_record) {
+            // Request to stop
+            return;  // RETURN
+        }
+
+        d_observer_p->publish(item.d_record, item.d_context);
+        item.d_record.reset();
+    }
+}
+
+void AsyncObserver::flush()
+{
+    Item item;
+    while (d_queue.tryPopFront(&item) == 0) {
+        if (item.d_record) {
+            d_observer_p->publish(item.d_record, item.d_context);
+        }
+    }
+}
+
+// CREATORS
+AsyncObserver::AsyncObserver(ball::Observer*   observer,
+                             int               maxQueueLength,
+                             bslma::Allocator* allocator)
+: d_allocator_p(allocator)
+, d_observer_p(observer)
+, d_queue(maxQueueLength, allocator)
+, d_threadMutex()
+, d_threadHandle(bslmt::ThreadUtil::invalidHandle())
+, d_numRecordsDropped(0)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(observer);
+}
+
+AsyncObserver::~AsyncObserver()
+{
+    stopPublicationThread();
+}
+
+// MANIPULATORS
+int AsyncObserver::startPublicationThread()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_threadMutex);  // LOCK
+
+    if (d_threadHandle != bslmt::ThreadUtil::invalidHandle()) {
+        return 0;  // RETURN
+    }
+
+    bslmt::ThreadAttributes attributes =
+        mwcsys::ThreadUtil::defaultAttributes();
+    attributes.setThreadName("mwcAsyncLog");
+
+    const int rc = bslmt::ThreadUtil::createWithAllocator(
+        &d_threadHandle,
+        attributes,
+        bdlf::MemFnUtil::memFn(&AsyncObserver::publicationThreadMain, this),
+        d_allocator_p);
+    if (rc != 0) {
+        d_threadHandle = bslmt::ThreadUtil::invalidHandle();
+    }
+
+    return rc;
+}
+
+void AsyncObserver::stopPublicationThread()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_threadMutex);  // LOCK
+
+    if (d_threadHandle == bslmt::ThreadUtil::invalidHandle()) {
+        return;  // RETURN
+    }
+
+    // Enqueue the request to stop, waiting for room if the queue is full, so
+    // that all the records enqueued before are published.
+    d_queue.pushBack(Item());
+    bslmt::ThreadUtil::join(d_threadHandle);
+    d_threadHandle = bslmt::ThreadUtil::invalidHandle();
+
+    // Publish the records enqueued while the thread was stopping.
+    flush();
+}
+
+void AsyncObserver::publish(const bsl::shared_ptr<const ball::Record>& record,
+                            const ball::Context&                       context)
+{
+    Item item;
+    item.d_record  = record;
+    item.d_context = context;
+
+    if (d_queue.tryPushBack(item) != 0) {
+        d_numRecordsDropped.addRelaxed(1);
+    }
+}
+
+void AsyncObserver::releaseRecords()
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_threadMutex);  // LOCK
+
+        // The queue must not be emptied while the publication thread is
+        // running, as this could discard the request to stop it.
+        if (d_threadHandle == bslmt::ThreadUtil::invalidHandle()) {
+            d_queue.removeAll();
+        }
+    }
+
+    d_observer_p->releaseRecords();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
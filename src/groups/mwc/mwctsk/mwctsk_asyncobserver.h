@@ -0,0 +1,223 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwctsk_asyncobserver.h                                             -*-C++-*-
+#ifndef INCLUDED_MWCTSK_ASYNCOBSERVER
+#define INCLUDED_MWCTSK_ASYNCOBSERVER
+
+//@PURPOSE: Provide a BALL observer publishing to another one asynchronously.
+//
+//@CLASSES:
+//  mwctsk::AsyncObserver: BALL observer deferring publication to a thread
+//
+//@SEE_ALSO: ball_asyncfileobserver
+//           mwctsk_consoleobserver
+//
+//@DESCRIPTION: 'mwctsk::AsyncObserver' is a concrete implementation of the
+// 'ball::Observer' protocol which forwards the records it is given to another
+// observer, from a dedicated publication thread.  The threads logging only
+// enqueue a shared reference to the record, whose fields are still in their
+// binary form, into a bounded lock-free queue: all the formatting and the
+// output are performed by the publication thread, so that a slow output (for
+// instance, a terminal or a pipe which is not drained fast enough) does not
+// stall the threads logging.
+//
+// This is, for any observer, what 'ball::AsyncFileObserver' does for the log
+// file.
+//
+/// Full Queue
+///----------
+// When the queue is full, records are dropped rather than blocking the thread
+// logging them, and the number of records dropped is accumulated and reported
+// by 'numRecordsDropped'.
+//
+/// Thread-safety
+///-------------
+// This object is *thread* *enabled*, meaning that two threads can safely call
+// any methods on the *same* *instance* without external synchronization.  The
+// observer wrapped is only ever called from the publication thread while it is
+// running, and from the thread calling 'stopPublicationThread' while the
+// remaining records are flushed.
+//
+/// Usage Example
+///-------------
+//..
+//  mwctsk::ConsoleObserver consoleObserver(allocator);
+//  mwctsk::AsyncObserver   asyncObserver(&consoleObserver, 8192, allocator);
+//
+//  int rc = asyncObserver.startPublicationThread();
+//  if (rc != 0) {
+//      // ...
+//  }
+//  multiplexObserver.registerObserver(&asyncObserver);
+//
+//  // ...
+//
+//  multiplexObserver.deregisterObserver(&asyncObserver);
+//  asyncObserver.stopPublicationThread();
+//..
+
+// MWC
+
+// BDE
+#include <ball_context.h>
+#include <ball_observer.h>
+#include <ball_record.h>
+#include <bdlcc_fixedqueue.h>
+#include <bsl_memory.h>
+#include <bslma_allocator.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mwctsk {
+
+// ===================
+// class AsyncObserver
+// ===================
+
+/// BALL observer publishing records to another observer from a dedicated
+/// thread.
+class AsyncObserver : public ball::Observer {
+  private:
+    // PRIVATE TYPES
+
+    /// Record waiting to be published, or request to stop the publication
+    /// thread if `d_record` is null.
+    struct Item {
+        // DATA
+        bsl::shared_ptr<const ball::Record> d_record;
+
+        ball::Context d_context;
+    };
+
+    typedef bdlcc::FixedQueue<Item> Queue;
+
+    // DATA
+    bslma::Allocator* d_allocator_p;
+    // Allocator to use.
+
+    ball::Observer* d_observer_p;
+    // Observer the records are published
+    // to.
+
+    Queue d_queue;
+    // Records waiting to be published.
+
+    bslmt::Mutex d_threadMutex;
+    // Mutex serializing the start and stop
+    // of the publication thread.
+
+    bslmt::ThreadUtil::Handle d_threadHandle;
+    // Handle of the publication thread, or
+    // 'bslmt::ThreadUtil::invalidHandle()'
+    // if not running.
+
+    bsls::AtomicInt64 d_numRecordsDropped;
+    // Number of records dropped because the
+    // queue was full.
+
+  private:
+    // NOT IMPLEMENTED
+    AsyncObserver(const AsyncObserver&) BSLS_KEYWORD_DELETED;
+    AsyncObserver& operator=(const AsyncObserver&) BSLS_KEYWORD_DELETED;
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Publish the records of the queue until a request to stop is popped.
+    /// This is the body of the publication thread.
+    void publicationThreadMain();
+
+    /// Publish all the records remaining in the queue from the calling
+    /// thread.
+    void flush();
+
+  public:
+    // CREATORS
+
+    /// Create an observer publishing the records it is given to the
+    /// specified `observer`, keeping at most the specified `maxQueueLength`
+    /// records waiting to be published.  Use the specified `allocator` to
+    /// supply memory.  Note that records are only published once the
+    /// publication thread is started.
+    AsyncObserver(ball::Observer*   observer,
+                  int               maxQueueLength,
+                  bslma::Allocator* allocator);
+
+    /// Stop the publication thread, if running, and destroy this object.
+    ~AsyncObserver() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// Start the publication thread.  Return 0 on success, or a non-zero
+    /// value otherwise.  This has no effect if the thread is running.
+    int startPublicationThread();
+
+    /// Stop the publication thread, after it published all the records
+    /// enqueued before this call.  This has no effect if the thread is not
+    /// running.
+    void stopPublicationThread();
+
+    // MANIPULATORS
+    //   (virtual: ball::Observer)
+
+    /// Enqueue the specified `record`, having the specified `context`, to
+    /// be published by the publication thread, or drop it if the queue is
+    /// full.
+    void publish(const bsl::shared_ptr<const ball::Record>& record,
+                 const ball::Context& context) BSLS_KEYWORD_OVERRIDE;
+
+    /// Discard all the records waiting to be published, unless the
+    /// publication thread is running, and release the records held by the
+    /// observer wrapped.
+    void releaseRecords() BSLS_KEYWORD_OVERRIDE;
+
+    // ACCESSORS
+
+    /// Return the number of records waiting to be published.
+    int queueLength() const;
+
+    /// Return the number of records dropped since the creation of this
+    /// object because the queue was full.
+    bsls::Types::Int64 numRecordsDropped() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// -------------------
+// class AsyncObserver
+// -------------------
+
+// ACCESSORS
+inline int AsyncObserver::queueLength() const
+{
+    return d_queue.length();
+}
+
+inline bsls::Types::Int64 AsyncObserver::numRecordsDropped() const
+{
+    return d_numRecordsDropped.loadRelaxed();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,171 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwctsk_asyncobserver.t.cpp                                         -*-C++-*-
+#include <mwctsk_asyncobserver.h>
+
+// BDE
+#include <ball_context.h>
+#include <ball_record.h>
+#include <ball_transmission.h>
+#include <bsl_memory.h>
+#include <bslmt_threadutil.h>
+#include <bsls_atomic.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Observer counting the records published to it, and the threads from
+/// which they were published.
+class CountingObserver : public ball::Observer {
+  public:
+    // DATA
+    bsls::AtomicInt d_numRecords;
+
+    bsls::AtomicInt d_numRecordsFromMainThread;
+
+    bsls::Types::Uint64 d_mainThreadId;
+
+    // CREATORS
+    CountingObserver()
+    : d_numRecords(0)
+    , d_numRecordsFromMainThread(0)
+    , d_mainThreadId(bslmt::ThreadUtil::selfIdAsUint64())
+    {
+    }
+
+    // MANIPULATORS
+    void publish(const bsl::shared_ptr<const ball::Record>& record,
+                 const ball::Context& context) BSLS_KEYWORD_OVERRIDE
+    {
+        (void)record;
+        (void)context;
+
+        ++d_numRecords;
+        if (bslmt::ThreadUtil::selfIdAsUint64() == d_mainThreadId) {
+            ++d_numRecordsFromMainThread;
+        }
+    }
+};
+
+/// Publish the specified `numRecords` records to the specified `observer`.
+void publishRecords(ball::Observer* observer, int numRecords)
+{
+    const ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+    for (int i = 0; i < numRecords; ++i) {
+        bsl::shared_ptr<ball::Record> record =
+            bsl::allocate_shared<ball::Record>(s_allocator_p);
+        record->fixedFields().setMessage("message");
+        observer->publish(record, context);
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   1. Records are published to the wrapped observer from the publication
+//      thread.
+//   2. Stopping the publication thread publishes all the records enqueued.
+//
+// Testing:
+//   startPublicationThread
+//   stopPublicationThread
+//   publish
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    const int k_NUM_RECORDS = 100;
+
+    CountingObserver      observer;
+    mwctsk::AsyncObserver obj(&observer, 1024, s_allocator_p);
+
+    ASSERT_EQ(obj.startPublicationThread(), 0);
+    publishRecords(&obj, k_NUM_RECORDS);
+    obj.stopPublicationThread();
+
+    ASSERT_EQ(observer.d_numRecords, k_NUM_RECORDS);
+    ASSERT_EQ(observer.d_numRecordsFromMainThread, 0);
+    ASSERT_EQ(obj.queueLength(), 0);
+    ASSERT_EQ(obj.numRecordsDropped(), 0);
+}
+
+static void test2_fullQueue()
+// ------------------------------------------------------------------------
+// FULL QUEUE
+//
+// Concerns:
+//   1. Records published while the queue is full are dropped and counted.
+//
+// Testing:
+//   publish
+//   numRecordsDropped
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("FULL QUEUE");
+
+    const int k_MAX_QUEUE_LENGTH = 16;
+
+    CountingObserver      observer;
+    mwctsk::AsyncObserver obj(&observer, k_MAX_QUEUE_LENGTH, s_allocator_p);
+
+    // The publication thread is not started: the queue fills up.
+    publishRecords(&obj, k_MAX_QUEUE_LENGTH + 3);
+    ASSERT_EQ(obj.queueLength(), k_MAX_QUEUE_LENGTH);
+    ASSERT_EQ(obj.numRecordsDropped(), 3);
+    ASSERT_EQ(observer.d_numRecords, 0);
+
+    obj.releaseRecords();
+    ASSERT_EQ(obj.queueLength(), 0);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 2: test2_fullQueue(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -458,6 +458,11 @@ int LogController::processInfoCommand(BSLS_ANNOTATION_UNUSED bsl::istream& cmd,
        << "\n"
        << "    ConsoleSeverityThreshold..: "
        << d_consoleObserver.severityThreshold() << "\n"
+       << "  ConsoleObserver:\n"
+       << "    LogRecordQueueLength....: "
+       << d_asyncConsoleObserver.queueLength() << "\n"
+       << "    NumLogRecordsDropped....: "
+       << d_asyncConsoleObserver.numRecordsDropped() << "\n"
        << "  FileObserver:\n"
        << "    LogFile.................: " << logFile << "\n"
        << "    LogRecordQueueLength....: "
@@ -599,6 +604,9 @@ LogController::LogController(bdlmt::EventScheduler* scheduler,
                  allocator)
 , d_alarmLog(allocator)
 , d_consoleObserver(allocator)
+, d_asyncConsoleObserver(&d_consoleObserver,
+                         8192,  // maxQueueLogEntries
+                         allocator)
 , d_syslogObserver(allocator)
 , d_logCleaner(scheduler, allocator)
 , d_lastLogLinkPath(allocator)
@@ -631,7 +639,8 @@ int LogController::initialize(bsl::ostream&              errorDescription,
         rc_FILEOBSERVER_REGISTRATION_FAILED    = -5,
         rc_ALARMLOG_REGISTRATION_FAILED        = -6,
         rc_CONSOLEOBSERVER_REGISTRATION_FAILED = -7,
-        rc_SYSLOGOBSERVER_REGISTRATION_FAILED  = -8
+        rc_SYSLOGOBSERVER_REGISTRATION_FAILED  = -8,
+        rc_CONSOLEOBSERVER_STARTTHREAD_FAILED  = -9
     };
 
     if (ball::LoggerManager::isInitialized()) {
@@ -718,7 +727,15 @@ int LogController::initialize(bsl::ostream&              errorDescription,
     d_consoleObserver.setSeverityThreshold(config.consoleSeverityThreshold())
         .setLogFormat(config.consoleFormat());
 
-    rc = tryRegisterObserver(&d_consoleObserver);
+    rc = d_asyncConsoleObserver.startPublicationThread();
+    if (rc != 0) {
+        errorDescription << "Failed to start ConsoleObserver publication "
+                         << "thread [rc: " << rc << "]";
+        ball::LoggerManager::shutDownSingleton();
+        return rc_CONSOLEOBSERVER_STARTTHREAD_FAILED;  // RETURN
+    }
+
+    rc = tryRegisterObserver(&d_asyncConsoleObserver);
     if (rc != 0) {
         errorDescription << "Failed registering ConsoleObserver "
                          << "[rc: " << rc << "]";
@@ -821,7 +838,8 @@ void LogController::shutdown()
     d_logCleaner.stop();
 
     // Unregister all observers
-    d_multiplexObserver.deregisterObserver(&d_consoleObserver);
+    d_multiplexObserver.deregisterObserver(&d_asyncConsoleObserver);
+    d_asyncConsoleObserver.stopPublicationThread();
     d_multiplexObserver.deregisterObserver(&d_alarmLog);
     d_multiplexObserver.deregisterObserver(&d_fileObserver);
     d_fileObserver.stopPublicationThread();
@@ -28,10 +28,12 @@
 // value-semantic type object used to provide configuration parameters to an
 // 'mwctsk::LogController'.  'LogController' uses a 'ball::AsyncFileObserver'
 // to asynchronously write logs to a file, and 'mwctsk::ConsoleObserver' to
-// write logs to stdout.  It offers M-Trap like command processing mechanism to
-// dynamically interact with the logging facility (change the verbosity level,
-// the console output severity threshold, or change severity level on a
-// specific category).
+// write logs to stdout, also asynchronously through an 'mwctsk::AsyncObserver'
+// (records are dropped, and counted, rather than stalling the threads logging
+// when stdout can't keep up).  It offers M-Trap like command processing
+// mechanism to dynamically interact with the logging facility (change the
+// verbosity level, the console output severity threshold, or change severity
+// level on a specific category).
 //
 // Typical usage of this component is to create it as early as possible, in
 // main, and keep it until the end of the application.
@@ -122,6 +124,7 @@
 // MWC
 
 #include <mwctsk_alarmlog.h>
+#include <mwctsk_asyncobserver.h>
 #include <mwctsk_consoleobserver.h>
 #include <mwctsk_logcleaner.h>
 #include <mwctsk_syslogobserver.h>
@@ -354,6 +357,11 @@ class LogController {
     ConsoleObserver d_consoleObserver;
     // Observer for printing to stdout.
 
+    AsyncObserver d_asyncConsoleObserver;
+    // Observer publishing to
+    // 'd_consoleObserver' from a dedicated
+    // thread.
+
     SyslogObserver d_syslogObserver;
     // Observer for printing to system log.
 
@@ -21,6 +21,7 @@
 #include <bdlbb_blobutil.h>
 #include <bsl_algorithm.h>
 #include <bsl_cstring.h>
+#include <bsl_memory.h>
 #include <bslim_printer.h>
 
 namespace BloombergLP {
@@ -427,6 +428,50 @@ int BlobUtil::appendToBlob(bdlbb::Blob*        dest,
     return 0;
 }
 
+int BlobUtil::loadBuffers(bsl::vector<bdlbb::BlobBuffer>* buffers,
+                          const bdlbb::Blob&              src,
+                          const BlobPosition&             start,
+                          int                             length)
+{
+    BSLS_ASSERT_SAFE(buffers);
+    BSLS_ASSERT_SAFE(length >= 0);
+
+    buffers->clear();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValidPos(src, start))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return -1;  // RETURN
+    }
+
+    BlobPosition pos(start);
+    while (length > 0) {
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(pos.buffer() >=
+                                                  src.numDataBuffers())) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            buffers->clear();
+            return -2;  // RETURN
+        }
+
+        const bdlbb::BlobBuffer& buffer = src.buffer(pos.buffer());
+
+        const int available = bufferSize(src, pos.buffer()) - pos.byte();
+        const int size      = bsl::min(available, length);
+        if (size > 0) {
+            // Use the aliasing constructor so that the loaded buffer starts at
+            // 'pos' while sharing ownership of the whole underlying buffer.
+            bsl::shared_ptr<char> data(buffer.buffer(),
+                                       buffer.data() + pos.byte());
+            buffers->push_back(bdlbb::BlobBuffer(data, size));
+            length -= size;
+        }
+
+        pos.setBuffer(pos.buffer() + 1);
+        pos.setByte(0);
+    }
+
+    return 0;
+}
+
 void BlobUtil::copyToRawBufferFromIndex(char*              destination,
                                         const bdlbb::Blob& source,
                                         int                startBufferIndex,
@@ -483,6 +528,105 @@ int BlobUtil::compareSection(int*                cmpResult,
     return 0;
 }
 
+int BlobUtil::compareSections(int*                cmpResult,
+                              const bdlbb::Blob&  lhs,
+                              const BlobPosition& lhsStart,
+                              const bdlbb::Blob&  rhs,
+                              const BlobPosition& rhsStart,
+                              int                 length)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValidPos(lhs, lhsStart) ||
+                                              !isValidPos(rhs, rhsStart))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return -2;  // RETURN
+    }
+
+    const int lhsNumBuffers = lhs.numDataBuffers();
+    const int rhsNumBuffers = rhs.numDataBuffers();
+
+    BlobPosition lhsPos(lhsStart);
+    BlobPosition rhsPos(rhsStart);
+    while (length > 0 && lhsPos.buffer() < lhsNumBuffers &&
+           rhsPos.buffer() < rhsNumBuffers) {
+        const int lhsLen = bufferSize(lhs, lhsPos.buffer()) - lhsPos.byte();
+        const int rhsLen = bufferSize(rhs, rhsPos.buffer()) - rhsPos.byte();
+        const int cmpLen = bsl::min(bsl::min(lhsLen, rhsLen), length);
+
+        const int cmpRet = bsl::memcmp(
+            lhs.buffer(lhsPos.buffer()).data() + lhsPos.byte(),
+            rhs.buffer(rhsPos.buffer()).data() + rhsPos.byte(),
+            cmpLen);
+        if (cmpRet != 0) {
+            *cmpResult = cmpRet < 0 ? -1 : 1;
+            return 0;  // RETURN
+        }
+
+        length -= cmpLen;
+
+        // Advance each position, moving to the next buffer if the end of the
+        // current one was reached.
+        if (cmpLen == lhsLen) {
+            lhsPos.setBuffer(lhsPos.buffer() + 1);
+            lhsPos.setByte(0);
+        }
+        else {
+            lhsPos.setByte(lhsPos.byte() + cmpLen);
+        }
+
+        if (cmpLen == rhsLen) {
+            rhsPos.setBuffer(rhsPos.buffer() + 1);
+            rhsPos.setByte(0);
+        }
+        else {
+            rhsPos.setByte(rhsPos.byte() + cmpLen);
+        }
+    }
+
+    if (length > 0) {
+        return -1;  // RETURN
+    }
+
+    *cmpResult = 0;
+    return 0;
+}
+
+int BlobUtil::findByte(BlobPosition*       pos,
+                       const bdlbb::Blob&  blob,
+                       const BlobPosition& start,
+                       int                 length,
+                       char                value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValidPos(blob, start))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return -1;  // RETURN
+    }
+
+    const int    numBuffers = blob.numDataBuffers();
+    BlobPosition cursor(start);
+    while (length > 0 && cursor.buffer() < numBuffers) {
+        const char* data   = blob.buffer(cursor.buffer()).data();
+        const int   bufLen = bufferSize(blob, cursor.buffer()) - cursor.byte();
+        const int   len    = bsl::min(bufLen, length);
+
+        const void* found = bsl::memchr(data + cursor.byte(), value, len);
+        if (found) {
+            pos->setBuffer(cursor.buffer());
+            pos->setByte(static_cast<const char*>(found) - data);
+            return 0;  // RETURN
+        }
+
+        length -= len;
+        cursor.setBuffer(cursor.buffer() + 1);
+        cursor.setByte(0);
+    }
+
+    if (length > 0) {
+        return -2;  // RETURN
+    }
+
+    return 1;
+}
+
 int BlobUtil::readUpToNBytes(char*               buf,
                              const bdlbb::Blob&  blob,
                              const BlobPosition& start,
@@ -525,24 +669,6 @@ int BlobUtil::readUpToNBytes(char*               buf,
     return (outPosition - buf);
 }
 
-int BlobUtil::readNBytes(char*               buf,
-                         const bdlbb::Blob&  blob,
-                         const BlobPosition& start,
-                         int                 length)
-{
-    const int ret = readUpToNBytes(buf, blob, start, length);
-
-    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(ret == length)) {
-        return 0;  // RETURN
-    }
-    else if (ret < 0) {
-        return (ret * 10) - 1;  // RETURN
-    }
-    else {
-        return -2;  // RETURN
-    }
-}
-
 char* BlobUtil::getAlignedSectionSafe(char*               storage,
                                       const bdlbb::Blob&  blob,
                                       const BlobPosition& start,
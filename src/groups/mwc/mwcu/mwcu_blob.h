@@ -35,7 +35,9 @@
 
 // BDE
 #include <bdlbb_blob.h>
+#include <bsl_cstring.h>
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace mwcu {
@@ -302,6 +304,20 @@ struct BlobUtil {
                             const bdlbb::Blob&  src,
                             const BlobPosition& start);
 
+    /// Load into the specified `buffers` the blob buffers covering exactly
+    /// the specified `length` bytes of the specified `src` blob, starting
+    /// at the specified `start`.  The loaded buffers alias the memory of
+    /// the buffers of `src` and share its ownership, so that no data is
+    /// copied and the memory remains valid for as long as any of the loaded
+    /// buffers is alive.  Any previous content of `buffers` is removed, but
+    /// its capacity is reused.  Return `0` on success or a non-zero value
+    /// if [start, start + length] doesn't fall within the `src` blob, in
+    /// which case `buffers` is left empty.
+    static int loadBuffers(bsl::vector<bdlbb::BlobBuffer>* buffers,
+                           const bdlbb::Blob&              src,
+                           const BlobPosition&             start,
+                           int                             length);
+
     /// Copy to memory buffer `destination` `length` bytes of data starting
     /// from offset `offsetInBuffer` of blob buffer with index
     /// `startBufferIndex` in blob `source`.  The buffer `destination` must
@@ -328,6 +344,38 @@ struct BlobUtil {
                               const char*         data,
                               int                 length);
 
+    /// Compare the sections of the specified `length` bytes of the
+    /// specified `lhs` blob starting at the specified `lhsStart`, and of
+    /// the specified `rhs` blob starting at the specified `rhsStart`.  If
+    /// both sections lie within their blob return `0` and in the specified
+    /// `cmpResult` return `0` if the sections are equal, `-1` if the
+    /// section of `lhs` is lexicographically less than the section of
+    /// `rhs`, and `1` otherwise.  Return a negative value if either section
+    /// doesn't fit in its blob.  Note that the sections are compared one
+    /// contiguous span of memory at a time, the spans being bounded by the
+    /// buffers of either blob, so that the number of calls to `memcmp` does
+    /// not depend on `length` but on the number of buffers.
+    static int compareSections(int*                cmpResult,
+                               const bdlbb::Blob&  lhs,
+                               const BlobPosition& lhsStart,
+                               const bdlbb::Blob&  rhs,
+                               const BlobPosition& rhsStart,
+                               int                 length);
+
+    /// Find the first occurrence of the specified `value` in the section of
+    /// the specified `length` bytes of the specified `blob` starting at the
+    /// specified `start`, and load its position into the specified `pos`.
+    /// Return `0` if `value` was found, `1` if the section lies within the
+    /// `blob` but doesn't contain `value`, and a negative value if `start`
+    /// isn't a valid position, or if `value` wasn't found before reaching
+    /// the end of the `blob`.  Note that each buffer is searched with a
+    /// single call to `memchr`, rather than byte by byte.
+    static int findByte(BlobPosition*       pos,
+                        const bdlbb::Blob&  blob,
+                        const BlobPosition& start,
+                        int                 length,
+                        char                value);
+
     /// Read up to the specified `length` bytes starting from the specified
     /// `start` position in the specified `blob` into the specified `buf`.
     /// Return a negative value if the `start` position isn't valid,
@@ -340,7 +388,9 @@ struct BlobUtil {
     /// Read the range of bytes [start, start + length) into the
     /// specified `buf`.  Return 0 on success or a negative
     /// value if the range [start, start + length) doesn't fall within the
-    /// specified `blob`.
+    /// specified `blob`.  Note that a range lying within a single buffer,
+    /// which is the common case of the small headers read from a blob, is
+    /// copied inline with a single `memcpy`.
     static int readNBytes(char*               buf,
                           const bdlbb::Blob&  blob,
                           const BlobPosition& start,
@@ -559,6 +609,35 @@ inline int BlobUtil::bufferSize(const bdlbb::Blob& blob, int index)
                                               : blob.buffer(index).size();
 }
 
+inline int BlobUtil::readNBytes(char*               buf,
+                                const bdlbb::Blob&  blob,
+                                const BlobPosition& start,
+                                int                 length)
+{
+    // Fast path: the range lies within the buffer of 'start'.
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+            0 < length && 0 <= start.byte() &&
+            start.buffer() < blob.numDataBuffers() &&
+            start.byte() + length <= bufferSize(blob, start.buffer()))) {
+        bsl::memcpy(buf,
+                    blob.buffer(start.buffer()).data() + start.byte(),
+                    length);
+        return 0;  // RETURN
+    }
+
+    const int ret = readUpToNBytes(buf, blob, start, length);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(ret == length)) {
+        return 0;  // RETURN
+    }
+    else if (ret < 0) {
+        return (ret * 10) - 1;  // RETURN
+    }
+    else {
+        return -2;  // RETURN
+    }
+}
+
 inline int BlobUtil::findOffsetSafe(BlobPosition*      pos,
                                     const bdlbb::Blob& blob,
                                     int                offset)
@@ -22,6 +22,7 @@
 
 // BDE
 #include <bdlbb_pooledblobbufferfactory.h>
+#include <bsl_vector.h>
 #include <bslim_printer.h>
 
 // TEST DRIVER
@@ -1579,6 +1580,256 @@ static void test19_blobStartHexDumper()
     }
 }
 
+static void test20_loadBuffers()
+// ------------------------------------------------------------------------
+// LOAD BUFFERS TEST
+//
+// Concerns:
+//   Ensure 'loadBuffers' loads buffers exactly covering the requested
+//   section, aliasing the memory of the source blob.
+//
+// Plan:
+//   Generate test data, call `loadBuffers` and compare the concatenated
+//   content of the loaded buffers with the expected data.  Verify that
+//   the loaded buffers point into the source blob's buffers.
+//
+// Testing:
+//   loadBuffers
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("Load Buffers Test");
+
+    using namespace mwcu;
+
+    struct Test {
+        int         d_line;
+        const char* d_srcPattern;
+        const int   d_index;
+        const int   d_byte;
+        const int   d_length;
+        const int   d_rc;
+        const char* d_result;
+        const int   d_numBuffers;
+    } k_DATA[] = {
+        {L_, "ab|cdXX", 2, 1, 1, -1, "", 0},
+        // invalid start
+        {L_, "ab|cdXX", 0, 1, 4, -2, "", 0},
+        // invalid length
+        {L_, "ab|cdXX", 0, 0, 0, 0, "", 0},
+        {L_, "ab|cdXX", 0, 1, 1, 0, "b", 1},
+        {L_, "ab|cdXX", 0, 1, 2, 0, "bc", 2},
+        {L_, "ab|cdXX", 0, 0, 4, 0, "abcd", 2},
+        {L_, "ab|cdXX", 1, 0, 2, 0, "cd", 1},
+    };
+
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    bsl::vector<bdlbb::BlobBuffer> buffers(s_allocator_p);
+
+    for (size_t idx = 0; idx < k_NUM_DATA; ++idx) {
+        const Test& test = k_DATA[idx];
+
+        PVV(test.d_line << ": load " << test.d_length << " bytes of '"
+                        << test.d_srcPattern << "' blob starting from  ("
+                        << test.d_index << ", " << test.d_byte
+                        << ") position");
+
+        bdlbb::Blob src(s_allocator_p);
+        mwctst::BlobTestUtil::fromString(&src,
+                                         test.d_srcPattern,
+                                         s_allocator_p);
+
+        const BlobPosition start(test.d_index, test.d_byte);
+
+        const int rc = mwcu::BlobUtil::loadBuffers(&buffers,
+                                                   src,
+                                                   start,
+                                                   test.d_length);
+
+        bsl::string result(s_allocator_p);
+        for (size_t i = 0; i < buffers.size(); ++i) {
+            result.append(buffers[i].data(), buffers[i].size());
+        }
+
+        ASSERT_EQ_D("line " << test.d_line, rc, test.d_rc);
+        ASSERT_EQ_D("line " << test.d_line,
+                    buffers.size(),
+                    static_cast<size_t>(test.d_numBuffers));
+        ASSERT_EQ_D("line " << test.d_line,
+                    result,
+                    bsl::string(test.d_result, s_allocator_p));
+
+        if (rc == 0 && !buffers.empty()) {
+            // The first loaded buffer aliases the source buffer
+            const bdlbb::BlobBuffer& first = src.buffer(test.d_index);
+            ASSERT_EQ_D("line " << test.d_line,
+                        buffers[0].data(),
+                        first.data() + test.d_byte);
+            ASSERT_EQ_D("line " << test.d_line,
+                        buffers[0].buffer().rep(),
+                        first.buffer().rep());
+        }
+    }
+}
+
+static void test21_compareSections()
+// ------------------------------------------------------------------------
+// COMPARE SECTIONS TEST
+//
+// Concerns:
+//   Ensure 'compareSections' properly compares sections of two blobs
+//   whatever the layout of their buffers.
+//
+// Plan:
+//   Generate test data, call `compareSections` and compare results with
+//   the expected ones.
+//
+// Testing:
+//   compareSections
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("Compare Sections Test");
+
+    using namespace mwcu;
+
+    struct Test {
+        int         d_line;
+        const char* d_lhsPattern;
+        const int   d_lhsIndex;
+        const int   d_lhsByte;
+        const char* d_rhsPattern;
+        const int   d_rhsIndex;
+        const int   d_rhsByte;
+        const int   d_length;
+        const int   d_rc;
+        const int   d_cmpResult;
+    } k_DATA[] = {
+        {L_, "ab|cdXX", 0, 2, "abcd", 0, 0, 1, -2, 0},
+        // invalid lhs start
+        {L_, "ab|cdXX", 0, 0, "abcd", 0, 0, 4, 0, 0},
+        {L_, "ab|cdXX", 0, 1, "a|b|c|d", 1, 0, 3, 0, 0},
+        {L_, "ab|cdXX", 0, 0, "ab|ce", 0, 0, 4, 0, -1},
+        {L_, "ab|ce", 0, 0, "ab|cdXX", 0, 0, 4, 0, 1},
+        {L_, "ab|cd", 1, 0, "xcdy", 0, 1, 2, 0, 0},
+        {L_, "ab|cd", 0, 0, "xyz", 0, 0, 0, 0, 0},
+        {L_, "ab|cdXX", 0, 1, "abcd", 0, 1, 4, -1, 0},
+        // lhs section too long
+        {L_, "abcd", 0, 0, "ab|cdXX", 1, 0, 3, -1, 0},
+        // rhs section too long
+    };
+
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    for (size_t idx = 0; idx < k_NUM_DATA; ++idx) {
+        const Test& test = k_DATA[idx];
+
+        PVV(test.d_line << ": compare " << test.d_length << " bytes of '"
+                        << test.d_lhsPattern << "' and '"
+                        << test.d_rhsPattern << "'");
+
+        bdlbb::Blob lhs(s_allocator_p);
+        bdlbb::Blob rhs(s_allocator_p);
+        mwctst::BlobTestUtil::fromString(&lhs,
+                                         test.d_lhsPattern,
+                                         s_allocator_p);
+        mwctst::BlobTestUtil::fromString(&rhs,
+                                         test.d_rhsPattern,
+                                         s_allocator_p);
+
+        int       cmpResult = 0;
+        const int rc        = mwcu::BlobUtil::compareSections(
+            &cmpResult,
+            lhs,
+            BlobPosition(test.d_lhsIndex, test.d_lhsByte),
+            rhs,
+            BlobPosition(test.d_rhsIndex, test.d_rhsByte),
+            test.d_length);
+
+        ASSERT_EQ_D("line " << test.d_line, rc, test.d_rc);
+        if (rc == 0) {
+            ASSERT_EQ_D("line " << test.d_line, cmpResult, test.d_cmpResult);
+        }
+    }
+}
+
+static void test22_findByte()
+// ------------------------------------------------------------------------
+// FIND BYTE TEST
+//
+// Concerns:
+//   Ensure 'findByte' finds the first occurrence of a byte in a section
+//   spanning any number of buffers.
+//
+// Plan:
+//   Generate test data, call `findByte` and compare the returned
+//   position with the expected one.
+//
+// Testing:
+//   findByte
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("Find Byte Test");
+
+    using namespace mwcu;
+
+    struct Test {
+        int         d_line;
+        const char* d_srcPattern;
+        const int   d_index;
+        const int   d_byte;
+        const int   d_length;
+        const char  d_value;
+        const int   d_rc;
+        const int   d_resultIndex;
+        const int   d_resultByte;
+    } k_DATA[] = {
+        {L_, "ab|cdXX", 2, 1, 1, 'a', -1, 0, 0},
+        // invalid start
+        {L_, "ab|cdXX", 0, 0, 4, 'a', 0, 0, 0},
+        {L_, "ab|cdXX", 0, 0, 4, 'd', 0, 1, 1},
+        {L_, "ab|cdXX", 0, 1, 2, 'c', 0, 1, 0},
+        {L_, "ab|cb", 0, 0, 4, 'b', 0, 0, 1},
+        {L_, "ab|cb", 1, 0, 2, 'b', 0, 1, 1},
+        {L_, "ab|cdXX", 0, 0, 3, 'd', 1, 0, 0},
+        // not in the section
+        {L_, "ab|cdXX", 0, 0, 0, 'a', 1, 0, 0},
+        {L_, "ab|cdXX", 0, 1, 5, 'e', -2, 0, 0},
+        // end of the blob reached
+    };
+
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    for (size_t idx = 0; idx < k_NUM_DATA; ++idx) {
+        const Test& test = k_DATA[idx];
+
+        PVV(test.d_line << ": find '" << test.d_value << "' in "
+                        << test.d_length << " bytes of '"
+                        << test.d_srcPattern << "' blob starting from  ("
+                        << test.d_index << ", " << test.d_byte
+                        << ") position");
+
+        bdlbb::Blob src(s_allocator_p);
+        mwctst::BlobTestUtil::fromString(&src,
+                                         test.d_srcPattern,
+                                         s_allocator_p);
+
+        BlobPosition pos;
+        const int    rc = mwcu::BlobUtil::findByte(
+            &pos,
+            src,
+            BlobPosition(test.d_index, test.d_byte),
+            test.d_length,
+            test.d_value);
+
+        ASSERT_EQ_D("line " << test.d_line, rc, test.d_rc);
+        if (rc == 0) {
+            ASSERT_EQ_D("line " << test.d_line,
+                        pos,
+                        BlobPosition(test.d_resultIndex, test.d_resultByte));
+        }
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1589,6 +1840,9 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 22: test22_findByte(); break;
+    case 21: test21_compareSections(); break;
+    case 20: test20_loadBuffers(); break;
     case 19: test19_blobStartHexDumper(); break;
     case 18: test18_getAlignedObject(); break;
     case 17: test17_getAlignedSection(); break;
@@ -0,0 +1,209 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcu_memoutstreampool.cpp                                          -*-C++-*-
+#include <mwcu_memoutstreampool.h>
+
+#include <mwcscm_version.h>
+// BDE
+#include <bsl_algorithm.h>
+#include <bsl_ios.h>
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace mwcu {
+
+// ============================
+// class MemOutStreamPool_Cache
+// ============================
+
+/// Free streams of a thread using a `MemOutStreamPool`.
+class MemOutStreamPool_Cache {
+  private:
+    // DATA
+    MemOutStreamPool* d_pool_p;
+    // Pool this cache belongs to.
+
+    bsl::vector<MemOutStream*> d_streams;
+    // Free streams.
+
+    // FRIENDS
+    friend class MemOutStreamPool;
+
+  public:
+    // CLASS METHODS
+
+    /// Release the cache at the specified `cache` to its pool.  Invoked
+    /// when the thread owning the cache exits.
+    static void onThreadExit(void* cache);
+
+    // CREATORS
+    MemOutStreamPool_Cache(MemOutStreamPool* pool,
+                           bslma::Allocator* allocator);
+
+    /// Destroy this object and the streams it holds.
+    ~MemOutStreamPool_Cache();
+};
+
+namespace {
+
+// FUNCTIONS
+extern "C" void memOutStreamPoolThreadExit(void* cache)
+{
+    MemOutStreamPool_Cache::onThreadExit(cache);
+}
+
+}  // close unnamed namespace
+
+// ----------------------------
+// class MemOutStreamPool_Cache
+// ----------------------------
+
+// CLASS METHODS
+void MemOutStreamPool_Cache::onThreadExit(void* cache)
+{
+    MemOutStreamPool_Cache* self = static_cast<MemOutStreamPool_Cache*>(
+        cache);
+    self->d_pool_p->releaseCache(self);
+}
+
+// CREATORS
+MemOutStreamPool_Cache::MemOutStreamPool_Cache(MemOutStreamPool* pool,
+                                               bslma::Allocator* allocator)
+: d_pool_p(pool)
+, d_streams(allocator)
+{
+    d_streams.reserve(pool->d_maxStreamsPerThread);
+}
+
+MemOutStreamPool_Cache::~MemOutStreamPool_Cache()
+{
+    for (bsl::size_t i = 0; i < d_streams.size(); ++i) {
+        d_pool_p->d_allocator_p->deleteObject(d_streams[i]);
+    }
+}
+
+// ----------------------
+// class MemOutStreamPool
+// ----------------------
+
+// PRIVATE MANIPULATORS
+MemOutStreamPool::Cache* MemOutStreamPool::localCache()
+{
+    Cache* cache = static_cast<Cache*>(
+        bslmt::ThreadUtil::getSpecific(d_cacheKey));
+    if (cache) {
+        return cache;  // RETURN
+    }
+
+    // First use of this pool by the calling thread
+    cache = new (*d_allocator_p) Cache(this, d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_cachesMutex);  // LOCK
+        d_caches.push_back(cache);
+    }
+
+    const int rc = bslmt::ThreadUtil::setSpecific(d_cacheKey, cache);
+    BSLS_ASSERT_OPT(rc == 0);
+    (void)rc;
+
+    return cache;
+}
+
+void MemOutStreamPool::releaseCache(Cache* cache)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_cachesMutex);  // LOCK
+        d_caches.erase(bsl::find(d_caches.begin(), d_caches.end(), cache));
+    }
+
+    d_allocator_p->deleteObject(cache);
+}
+
+// CREATORS
+MemOutStreamPool::MemOutStreamPool(bsl::size_t       initialCapacity,
+                                   int               maxStreamsPerThread,
+                                   bslma::Allocator* basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_initialCapacity(initialCapacity)
+, d_maxStreamsPerThread(maxStreamsPerThread)
+, d_cacheKey()
+, d_cachesMutex()
+, d_caches(d_allocator_p)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(0 < maxStreamsPerThread);
+
+    const int rc = bslmt::ThreadUtil::createKey(&d_cacheKey,
+                                                &memOutStreamPoolThreadExit);
+    BSLS_ASSERT_OPT(rc == 0);
+    (void)rc;
+}
+
+MemOutStreamPool::~MemOutStreamPool()
+{
+    // Deleting the key first guarantees that the exit of the threads still
+    // referencing a cache no longer calls back into this object.
+    bslmt::ThreadUtil::deleteKey(d_cacheKey);
+
+    for (bsl::size_t i = 0; i < d_caches.size(); ++i) {
+        d_allocator_p->deleteObject(d_caches[i]);
+    }
+}
+
+// MANIPULATORS
+MemOutStream* MemOutStreamPool::getStream()
+{
+    Cache* cache = localCache();
+
+    if (cache->d_streams.empty()) {
+        return new (*d_allocator_p)
+            MemOutStream(d_initialCapacity, d_allocator_p);  // RETURN
+    }
+
+    MemOutStream* stream = cache->d_streams.back();
+    cache->d_streams.pop_back();
+    return stream;
+}
+
+void MemOutStreamPool::releaseStream(MemOutStream* stream)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(stream);
+
+    Cache* cache = localCache();
+
+    if (static_cast<int>(cache->d_streams.size()) >= d_maxStreamsPerThread) {
+        d_allocator_p->deleteObject(stream);
+        return;  // RETURN
+    }
+
+    // Rewind the stream rather than calling 'MemOutStream::reset', which
+    // would release its buffer.  The state is cleared first, as 'seekp' does
+    // nothing on a stream in a failed state.
+    stream->clear();
+    stream->seekp(0);
+    stream->flags(bsl::ios_base::skipws | bsl::ios_base::dec);
+    stream->width(0);
+    stream->precision(6);
+    stream->fill(' ');
+
+    cache->d_streams.push_back(stream);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,233 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcu_memoutstreampool.h                                            -*-C++-*-
+#ifndef INCLUDED_MWCU_MEMOUTSTREAMPOOL
+#define INCLUDED_MWCU_MEMOUTSTREAMPOOL
+
+//@PURPOSE: Provide a pool of reusable 'mwcu::MemOutStream' per thread.
+//
+//@CLASSES:
+//  mwcu::MemOutStreamPool:      pool of pre-reserved streams per thread
+//  mwcu::MemOutStreamPoolGuard: scoped checkout of a stream from a pool
+//
+//@SEE_ALSO: mwcu_memoutstream
+//
+//@DESCRIPTION: 'mwcu::MemOutStreamPool' is a mechanism keeping, for each
+// thread using it, a list of free 'mwcu::MemOutStream' objects whose buffer
+// was reserved up front, and 'mwcu::MemOutStreamPoolGuard' is a guard checking
+// out a stream from a pool for the duration of a scope.  This is meant for
+// code formatting messages on a path executed repeatedly (for instance, once
+// per rejected message) where a 'mwcu::MemOutStream' created on the stack
+// would allocate its buffer on its first write, every time: a stream checked
+// out from a pool is empty, but keeps the buffer it used the last time it was
+// checked out by the same thread, so that formatting does not allocate once
+// the pool is warm.
+//
+// A stream returned to the pool is rewound, without releasing its buffer, and
+// the state and formatting flags of the stream are reset.  Each thread keeps
+// at most the 'maxStreamsPerThread' specified at construction of the pool;
+// streams returned beyond that are destroyed.  Note that a stream keeps the
+// largest buffer it ever needed, so that the memory held by a pool is bounded
+// by the number of threads using it, times 'maxStreamsPerThread', times the
+// size of the largest message formatted.
+//
+/// Thread Safety
+///-------------
+// 'getStream' and 'releaseStream' are thread-safe, and a stream may be
+// released by a different thread than the one which checked it out (it is
+// then added to the list of the releasing thread).  A stream must not be used
+// by more than one thread at a time.  The behavior is undefined if the pool is
+// destroyed while any of its streams are checked out, or while other threads
+// are using it.
+//
+/// Usage
+///-----
+//..
+//  mwcu::MemOutStreamPool pool(256, 4, allocator);
+//
+//  // For each rejected message ...
+//  mwcu::MemOutStreamPoolGuard guard(&pool);
+//  guard.stream() << "Failed to relay PUT message [GUID: " << guid << "]";
+//  BALL_LOG_WARN << guard.stream().str();
+//..
+
+// MWC
+#include <mwcu_memoutstream.h>
+
+// BDE
+#include <bsl_cstddef.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+#include <bsls_keyword.h>
+
+namespace BloombergLP {
+namespace mwcu {
+
+// FORWARD DECLARATION
+class MemOutStreamPool_Cache;
+
+// ======================
+// class MemOutStreamPool
+// ======================
+
+/// Pool of reusable `MemOutStream` objects, cached per thread.
+class MemOutStreamPool {
+  private:
+    // PRIVATE TYPES
+    typedef MemOutStreamPool_Cache Cache;
+
+    // DATA
+    bslma::Allocator* d_allocator_p;
+    // Allocator to use.
+
+    bsl::size_t d_initialCapacity;
+    // Capacity reserved by each new
+    // stream.
+
+    int d_maxStreamsPerThread;
+    // Maximum number of free streams
+    // kept by each thread.
+
+    bslmt::ThreadUtil::Key d_cacheKey;
+    // Key of the thread-specific list of
+    // free streams of each thread.
+
+    bslmt::Mutex d_cachesMutex;
+    // Mutex protecting 'd_caches'.
+
+    bsl::vector<Cache*> d_caches;
+    // Caches of all the threads which
+    // used this pool and have not yet
+    // exited.
+
+    // FRIENDS
+    friend class MemOutStreamPool_Cache;
+
+  private:
+    // NOT IMPLEMENTED
+    MemOutStreamPool(const MemOutStreamPool&) BSLS_KEYWORD_DELETED;
+    MemOutStreamPool& operator=(const MemOutStreamPool&) BSLS_KEYWORD_DELETED;
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Return the cache of the calling thread, creating it if needed.
+    Cache* localCache();
+
+    /// Destroy the specified `cache` and the streams it holds.  Invoked
+    /// when the thread owning `cache` exits.
+    void releaseCache(Cache* cache);
+
+  public:
+    // CREATORS
+
+    /// Create a pool of streams reserving the specified `initialCapacity`
+    /// bytes, each thread keeping at most the specified
+    /// `maxStreamsPerThread` free streams.  Use the optionally specified
+    /// `basicAllocator` to supply memory.  If `basicAllocator` is 0, the
+    /// currently installed default allocator is used.  The behavior is
+    /// undefined unless `0 < maxStreamsPerThread`.
+    MemOutStreamPool(bsl::size_t       initialCapacity,
+                     int               maxStreamsPerThread,
+                     bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object and all the free streams it holds.  The
+    /// behavior is undefined if any stream is still checked out.
+    ~MemOutStreamPool();
+
+    // MANIPULATORS
+
+    /// Return an empty stream taken from the free streams of the calling
+    /// thread, or a new one if there are none.  The returned stream must be
+    /// returned to this pool using `releaseStream`.
+    MemOutStream* getStream();
+
+    /// Reset the specified `stream`, previously returned by `getStream`,
+    /// and return it to the free streams of the calling thread, or destroy
+    /// it if the calling thread already holds `maxStreamsPerThread` free
+    /// streams.
+    void releaseStream(MemOutStream* stream);
+};
+
+// ===========================
+// class MemOutStreamPoolGuard
+// ===========================
+
+/// Guard checking out a stream from a `MemOutStreamPool` at construction,
+/// and returning it to the pool at destruction.
+class MemOutStreamPoolGuard {
+  private:
+    // DATA
+    MemOutStreamPool* d_pool_p;
+    // Pool the stream belongs to.
+
+    MemOutStream* d_stream_p;
+    // Stream checked out.
+
+  private:
+    // NOT IMPLEMENTED
+    MemOutStreamPoolGuard(const MemOutStreamPoolGuard&) BSLS_KEYWORD_DELETED;
+    MemOutStreamPoolGuard&
+    operator=(const MemOutStreamPoolGuard&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+
+    /// Check out a stream from the specified `pool`.
+    explicit MemOutStreamPoolGuard(MemOutStreamPool* pool);
+
+    /// Return the stream to the pool.
+    ~MemOutStreamPoolGuard();
+
+    // ACCESSORS
+
+    /// Return a reference providing modifiable access to the stream.
+    MemOutStream& stream() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ---------------------------
+// class MemOutStreamPoolGuard
+// ---------------------------
+
+// CREATORS
+inline MemOutStreamPoolGuard::MemOutStreamPoolGuard(MemOutStreamPool* pool)
+: d_pool_p(pool)
+, d_stream_p(pool->getStream())
+{
+    // NOTHING
+}
+
+inline MemOutStreamPoolGuard::~MemOutStreamPoolGuard()
+{
+    d_pool_p->releaseStream(d_stream_p);
+}
+
+// ACCESSORS
+inline MemOutStream& MemOutStreamPoolGuard::stream() const
+{
+    return *d_stream_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
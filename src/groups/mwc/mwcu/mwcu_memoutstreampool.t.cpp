@@ -0,0 +1,188 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcu_memoutstreampool.t.cpp                                        -*-C++-*-
+#include <mwcu_memoutstreampool.h>
+
+// BDE
+#include <bdlf_bind.h>
+#include <bsl_ios.h>
+#include <bslma_testallocator.h>
+#include <bslmt_threadgroup.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Format a message using a stream checked out from the specified `pool`.
+void formatMessage(mwcu::MemOutStreamPool* pool)
+{
+    mwcu::MemOutStreamPoolGuard guard(pool);
+    guard.stream() << "message " << 42;
+    ASSERT_EQ(guard.stream().str(), "message 42");
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   1. A stream checked out from a pool is empty, and is returned to the
+//      pool at the end of the scope of the guard.
+//   2. Formatting with a stream reused by the same thread does not
+//      allocate.
+//
+// Testing:
+//   MemOutStreamPool
+//   MemOutStreamPoolGuard
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    bslma::TestAllocator   ta("pool", s_allocator_p);
+    mwcu::MemOutStreamPool pool(64, 2, &ta);
+
+    const mwcu::MemOutStream* first = 0;
+    {
+        mwcu::MemOutStreamPoolGuard guard(&pool);
+        ASSERT(guard.stream().isEmpty());
+        guard.stream() << "hello " << 1;
+        ASSERT_EQ(guard.stream().str(), "hello 1");
+        first = &guard.stream();
+    }
+
+    const bsls::Types::Int64 numAllocations = ta.numAllocations();
+    {
+        mwcu::MemOutStreamPoolGuard guard(&pool);
+        ASSERT(&guard.stream() == first);
+        ASSERT(guard.stream().isEmpty());
+        guard.stream() << "world " << 2;
+        ASSERT_EQ(guard.stream().str(), "world 2");
+    }
+    ASSERT_EQ(ta.numAllocations(), numAllocations);
+}
+
+static void test2_reset()
+// ------------------------------------------------------------------------
+// RESET
+//
+// Concerns:
+//   1. The state and formatting flags of a stream returned to the pool are
+//      reset.
+//   2. A thread keeps at most 'maxStreamsPerThread' free streams.
+//
+// Testing:
+//   getStream
+//   releaseStream
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("RESET");
+
+    bslma::TestAllocator   ta("pool", s_allocator_p);
+    mwcu::MemOutStreamPool pool(64, 2, &ta);
+
+    mwcu::MemOutStream* stream = pool.getStream();
+    *stream << bsl::hex << 255;
+    stream->setstate(bsl::ios_base::failbit);
+    pool.releaseStream(stream);
+
+    stream = pool.getStream();
+    ASSERT(stream->good());
+    ASSERT(stream->isEmpty());
+    *stream << 255;
+    ASSERT_EQ(stream->str(), "255");
+
+    mwcu::MemOutStream* stream2 = pool.getStream();
+    mwcu::MemOutStream* stream3 = pool.getStream();
+    pool.releaseStream(stream);
+    pool.releaseStream(stream2);
+
+    // The third stream is destroyed.
+    const bsls::Types::Int64 numBlocks = ta.numBlocksInUse();
+    pool.releaseStream(stream3);
+    ASSERT_LT(ta.numBlocksInUse(), numBlocks);
+}
+
+static void test3_multipleThreads()
+// ------------------------------------------------------------------------
+// MULTIPLE THREADS
+//
+// Concerns:
+//   1. Each thread uses its own free streams, and the streams of a thread
+//      are destroyed when it exits.
+//
+// Testing:
+//   getStream
+//   releaseStream
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("MULTIPLE THREADS");
+
+    const int k_NUM_THREADS = 4;
+
+    bslma::TestAllocator   ta("pool", s_allocator_p);
+    mwcu::MemOutStreamPool pool(64, 2, &ta);
+
+    formatMessage(&pool);
+    const bsls::Types::Int64 numBlocks = ta.numBlocksInUse();
+
+    bslmt::ThreadGroup threadGroup(s_allocator_p);
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        const int rc = threadGroup.addThread(
+            bdlf::BindUtil::bindS(s_allocator_p, &formatMessage, &pool));
+        ASSERT_EQ_D(i, rc, 0);
+    }
+    threadGroup.joinAll();
+
+    // Only the cache of this thread remains.
+    ASSERT_EQ(ta.numBlocksInUse(), numBlocks);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_multipleThreads(); break;
+    case 2: test2_reset(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
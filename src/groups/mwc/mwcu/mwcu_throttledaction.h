@@ -47,6 +47,15 @@
 // All macros defined in this component are thread-safe, and can be invoked
 // concurrently by multiple threads.
 //
+// Within an interval, a throttled action only reads the time of the last reset
+// with a relaxed load and increments its counter with a relaxed atomic
+// addition; the compare-and-swap electing the thread which performs the reset
+// is only attempted once the interval has elapsed.  This keeps the cost of
+// throttling low on the hot paths where an error storm makes most actions
+// skipped.  Note that the actions of a new interval may, briefly, be counted
+// in the previous interval by threads racing with the reset, which can only
+// make them skipped.
+//
 // Note that this component uses the 'bsls::TimeUtil' timer component, and per
 // documentation, this component is thread-safe only once the one-time
 // initialization 'bsls::TimeUtil::initialize' has been called.
@@ -92,6 +101,7 @@
 // BDE
 #include <ball_log.h>
 #include <bsls_atomic.h>
+#include <bsls_performancehint.h>
 #include <bsls_timeutil.h>
 #include <bsls_types.h>
 
@@ -163,23 +173,25 @@ struct ThrottledActionParams {
     {                                                                         \
         const bsls::Types::Int64 _now =                                       \
             BloombergLP::bsls::TimeUtil::getTimer();                          \
+        const bsls::Types::Int64 _resetTime =                                 \
+            P.d_lastResetTime.loadRelaxed();                                  \
                                                                               \
-        if ((_now - P.d_lastResetTime) >= P.d_intervalNano) {                 \
-            int                _numSkipped = P.d_countSinceLastReset;         \
-            bsls::Types::Int64 _resetTime  = P.d_lastResetTime;               \
-            if (P.d_lastResetTime.testAndSwap(_resetTime, _now) ==            \
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY((_now - _resetTime) >=      \
+                                                  P.d_intervalNano) &&        \
+            P.d_lastResetTime.testAndSwapAcqRel(_resetTime, _now) ==          \
                 _resetTime) {                                                 \
-                P.d_countSinceLastReset -= _numSkipped;                       \
-                if (_numSkipped > P.d_maxCountPerInterval) {                  \
-                    _numSkipped -= P.d_maxCountPerInterval;                   \
-                    {                                                         \
-                        RESET;                                                \
-                    }                                                         \
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;                               \
+            int _numSkipped = P.d_countSinceLastReset.swapAcqRel(0);          \
+            if (_numSkipped > P.d_maxCountPerInterval) {                      \
+                _numSkipped -= P.d_maxCountPerInterval;                       \
+                {                                                             \
+                    RESET;                                                    \
                 }                                                             \
             }                                                                 \
         }                                                                     \
                                                                               \
-        if (++P.d_countSinceLastReset <= P.d_maxCountPerInterval) {           \
+        if (P.d_countSinceLastReset.addRelaxed(1) <=                          \
+            P.d_maxCountPerInterval) {                                        \
             ACTION;                                                           \
         }                                                                     \
         else {                                                                \
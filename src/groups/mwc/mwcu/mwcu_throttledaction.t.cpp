@@ -24,7 +24,9 @@
 #include <ball_severity.h>
 #include <bdlf_bind.h>
 #include <bdlt_timeunitratio.h>
+#include <bslmt_threadgroup.h>
 #include <bslmt_threadutil.h>
+#include <bsls_atomic.h>
 #include <bsls_timeutil.h>
 #include <bsls_types.h>
 
@@ -61,6 +63,17 @@ static void resetInteger(int* n)
     *n = 0;
 }
 
+/// Do the specified `numActions` throttled increments of the specified
+/// `n` using the specified `params`.
+static void throttledIncrements(mwcu::ThrottledActionParams* params,
+                                bsls::AtomicInt*             n,
+                                int                          numActions)
+{
+    for (int i = 0; i < numActions; ++i) {
+        MWCU_THROTTLEDACTION_THROTTLE_NO_RESET(*params, ++(*n));
+    }
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -497,6 +510,52 @@ static void test4_throttleWithCustomReset()
     ASSERT_GT(obj.d_lastResetTime, 0LL);
 }
 
+static void test5_concurrentThrottle()
+// ------------------------------------------------------------------------
+// CONCURRENT THROTTLE
+//
+// Concerns:
+//   1. Throttling from multiple threads concurrently executes the
+//      specified 'ACTION' exactly the maximum number of times during the
+//      specified time interval, and counts all the skipped actions.
+//
+// Plan:
+//   1. From multiple threads, do many 'MWCU_THROTTLEDACTION_THROTTLE' on
+//      the same parameters within a time interval long enough not to
+//      elapse during the test, and ensure the counts of the executed and
+//      skipped actions.
+//
+// Testing:
+//   MWCU_THROTTLEDACTION_THROTTLE_NO_RESET(P, ACTION)
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("CONCURRENT THROTTLE");
+
+    // CONSTANTS
+    const int k_INTERVAL_MS            = 60 * 1000;
+    const int k_MAX_COUNT_PER_INTERVAL = 5;
+    const int k_NUM_THREADS            = 4;
+    const int k_NUM_ACTIONS            = 10000;
+
+    mwcu::ThrottledActionParams obj(k_INTERVAL_MS, k_MAX_COUNT_PER_INTERVAL);
+    bsls::AtomicInt             n(0);
+
+    bslmt::ThreadGroup threadGroup(s_allocator_p);
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        const int rc = threadGroup.addThread(
+            bdlf::BindUtil::bindS(s_allocator_p,
+                                  &throttledIncrements,
+                                  &obj,
+                                  &n,
+                                  k_NUM_ACTIONS));
+        ASSERT_EQ_D(i, rc, 0);
+    }
+    threadGroup.joinAll();
+
+    ASSERT_EQ(n, k_MAX_COUNT_PER_INTERVAL);
+    ASSERT_EQ(obj.d_countSinceLastReset, k_NUM_THREADS * k_NUM_ACTIONS);
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -509,6 +568,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 5: test5_concurrentThrottle(); break;
     case 4: test4_throttleWithCustomReset(); break;
     case 3: test3_throttleWithDefaultReset(); break;
     case 2: test2_throttleNoReset(); break;